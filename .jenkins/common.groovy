@@ -47,6 +47,15 @@ def runTestCommand (platform, project)
                 """
 
     platform.runCommand(this, v2TestCommand)
+
+    // The cuBLASLt gemm path is opt-in and read once per process, so its cached heuristics get a run of their own
+    def ltTestCommand = """#!/usr/bin/env bash
+                    set -x
+                    cd ${project.paths.project_build_prefix}/build/release/clients/staging
+                    ${sudo} LD_LIBRARY_PATH=/opt/rocm/lib GTEST_LISTENER=NO_PASS_LINE_IN_LOG HIPBLAS_GEMM_LT=1 ./hipblas_v2-test --gtest_filter=*gemm_ex*lt_cache* --gtest_output=xml:lt_cache.xml --gtest_color=yes
+                """
+
+    platform.runCommand(this, ltTestCommand)
     junit "${project.paths.project_build_prefix}/build/release/clients/staging/*.xml"
 }
 
@@ -94,7 +94,31 @@ ci: {
     }
 
     String hostBuildCommand = './install.sh -c --compiler=g++'
-    String hipClangBuildCommand = './install.sh -c --compiler=/opt/rocm/hip/bin/hipcc'
+    // The hip-clang build also compiles the hipBLAS kernels behind the BUILD_WITH_* options, which
+    // hipblas-test checks
+    String hipClangBuildCommand = './install.sh -c --compiler=/opt/rocm/hip/bin/hipcc' +
+                                  ' --cmake-arg -DBUILD_WITH_SMALL_LEVEL1=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_GECON=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_BANDED_SOLVE=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_GEMM_QUANTIZED=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_OFFSET_BATCHED=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_PERSISTENT=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_SMALL_LU=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_GEMM_FP64_EMULATION=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_SMALL_GEMM=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_FUSED_LEVEL1=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_TRANSPOSE=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_CONVERT=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_BATCH_SCALARS=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_LEVEL3_EX=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_LEVEL1_EX=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_PACKED=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_TUNED_LEVEL2=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_REPRODUCIBLE=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_ROT_CHAIN=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_GEMM_CHAIN=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_GEMM_BF16X3=ON' +
+                                  ' --cmake-arg -DBUILD_WITH_EPILOGUE_REDUCTION=ON'
     String clangBuildCommand = './install.sh -c --compiler=clang++'
 
     setupCI(urlJobName, jobNameList, hostBuildCommand, runCI, 'g++')
@@ -90,5 +90,10 @@ ci: {
     }
 
     String hostBuildCommand = './install.sh -c --compiler=g++ --cuda'
+    // The hipcc build also compiles the batched Level-1 kernels of the cuBLAS backend, which
+    // hipblas-test checks
+    String hipccBuildCommand = './install.sh -c --compiler=/opt/rocm/bin/hipcc --cuda' +
+                               ' --cmake-arg -DBUILD_WITH_BATCHED_LEVEL1=ON'
     setupCI(urlJobName, jobNameList, hostBuildCommand, runCI, 'g++')
+    setupCI(urlJobName, jobNameList, hipccBuildCommand, runCI, 'hipcc')
 }
@@ -27,32 +27,47 @@
 
 #include "argument_model.hpp"
 #include "clients_common.hpp"
+#include "d_vector.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_datatype2string.hpp"
 #include "hipblas_parse_data.hpp"
+#include "native_blas.hpp"
 #include "test_cleanup.hpp"
 #include "type_dispatch.hpp"
 #include "utility.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <chrono>
+#include <cmath>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <map>
+#include <random>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 using namespace roc; // For emulated program_options
 typedef int hipblas_int;
 
 int hipblas_bench_datafile()
 {
+    // Tests of a data file reuse the device memory of the earlier ones
+    bool reuse = hipblas_set_device_memory_reuse(true);
+
     int ret = 0;
     for(Arguments arg : HipBLAS_TestData())
         ret |= run_bench_test(arg, 0, 1);
+
+    hipblas_set_device_memory_reuse(reuse);
     test_cleanup::cleanup();
     return ret;
 }
@@ -112,6 +127,694 @@ int run_bench_multi_gpu_test(int parallel_devices, Arguments& arg)
     return 0;
 }
 
+// Runs tests[id], tests[id + threads], ... on device with the handles on the stream of bench_thread
+void thread_run_concurrent(int                           id,
+                           int                           threads,
+                           int                           device,
+                           hipblasBenchThread            bench_thread,
+                           const std::vector<Arguments>& tests,
+                           int*                          ret)
+try
+{
+    CHECK_HIP_ERROR(hipSetDevice(device));
+    hipblas_set_bench_thread(bench_thread);
+
+    for(size_t i = id; i < tests.size(); i += threads)
+    {
+        Arguments a(tests[i]);
+        *ret |= run_bench_test(a, 0, 1);
+    }
+}
+catch(const std::exception& exp)
+{
+    std::cerr << exp.what() << std::endl;
+    *ret = 1;
+}
+
+// Runs the tests concurrently on the current device from threads threads, each thread with its
+// own handles. With streams, thread id puts its handles on stream id % streams, else on the null
+// stream. Reports the work of all hot loops over the wall time from the first start to the last
+// end.
+int run_bench_concurrent_test(int threads, int streams, const std::vector<Arguments>& tests)
+{
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    std::vector<hipStream_t> stream_list(streams);
+    for(auto& stream : stream_list)
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    (void)hipblas_take_concurrent_totals();
+
+    auto             thread = std::make_unique<std::thread[]>(threads);
+    std::vector<int> ret(threads);
+    for(int id = 0; id < threads; ++id)
+    {
+        hipblasBenchThread bench_thread;
+        bench_thread.thread = id;
+        if(streams)
+        {
+            bench_thread.stream_index = id % streams;
+            bench_thread.stream       = stream_list[id % streams];
+        }
+        thread[id] = std::thread(
+            ::thread_run_concurrent, id, threads, device, bench_thread, std::cref(tests), &ret[id]);
+    }
+
+    for(int id = 0; id < threads; ++id)
+        thread[id].join();
+
+    for(auto stream : stream_list)
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    test_cleanup::cleanup();
+
+    hipblasConcurrentTotals totals = hipblas_take_concurrent_totals();
+    double                  us     = totals.end_us - totals.start_us;
+    std::cout << "threads,streams,tests,hipblas-Gflops,hipblas-GB/s,hipblas-us\n"
+              << threads << ", " << streams << ", " << totals.tests << ", "
+              << (us > 0 ? totals.gflop / us * 1e6 : 0) << ", "
+              << (us > 0 ? totals.gbyte / us * 1e6 : 0) << ", " << us << std::endl;
+
+    return std::any_of(ret.begin(), ret.end(), [](int r) { return r != 0; });
+}
+
+// Stream of a workload of run_bench_interference: with the priority of the device for latency or
+// bulk work, or limited to the compute units of the bits of cu_mask, a hex number of any length
+// whose lowest bit is compute unit 0
+static hipStream_t create_interference_stream(hipblasStreamPriority_t priority,
+                                              const std::string&      cu_mask)
+{
+    hipStream_t stream;
+    if(!cu_mask.empty())
+    {
+        if(priority != HIPBLAS_STREAM_PRIORITY_DEFAULT)
+            throw std::invalid_argument("A stream cannot have both a CU mask and a priority");
+
+        std::string hex = cu_mask.compare(0, 2, "0x") ? cu_mask : cu_mask.substr(2);
+        if(hex.empty() || hex.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos)
+            throw std::invalid_argument("Invalid CU mask " + cu_mask);
+
+        std::vector<uint32_t> words;
+        for(size_t end = hex.size(); end > 0; end = end > 8 ? end - 8 : 0)
+        {
+            size_t start = end > 8 ? end - 8 : 0;
+            words.push_back(uint32_t(std::stoul(hex.substr(start, end - start), nullptr, 16)));
+        }
+#ifdef __HIP_PLATFORM_NVCC__
+        throw std::invalid_argument("CU masks are not supported on NVIDIA devices");
+#else
+        CHECK_HIP_ERROR(
+            hipExtStreamCreateWithCUMask(&stream, uint32_t(words.size()), words.data()));
+#endif
+    }
+    else if(priority != HIPBLAS_STREAM_PRIORITY_DEFAULT)
+    {
+        int least, greatest;
+        CHECK_HIP_ERROR(hipDeviceGetStreamPriorityRange(&least, &greatest));
+        CHECK_HIP_ERROR(hipStreamCreateWithPriority(
+            &stream,
+            hipStreamNonBlocking,
+            priority == HIPBLAS_STREAM_PRIORITY_LATENCY ? greatest : least));
+    }
+    else
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    return stream;
+}
+
+// Value of --foreground_priority or --background_priority
+static hipblasStreamPriority_t interference_priority(const std::string& option,
+                                                     const std::string& priority)
+{
+    if(priority == "default")
+        return HIPBLAS_STREAM_PRIORITY_DEFAULT;
+    if(priority == "latency")
+        return HIPBLAS_STREAM_PRIORITY_LATENCY;
+    if(priority == "bulk")
+        return HIPBLAS_STREAM_PRIORITY_BULK;
+    throw std::invalid_argument("Invalid value for " + option + " " + priority);
+}
+
+// A workload of run_bench_interference and the stream it runs on
+struct hipblas_interference_workload
+{
+    Arguments               arg;
+    hipblasStreamPriority_t priority = HIPBLAS_STREAM_PRIORITY_DEFAULT;
+    std::string             cu_mask;
+};
+
+// Runs the foreground test on a stream of its own, first alone, then while a thread runs the
+// background test again and again on another stream, starting warmup_ms before the foreground
+// one. The lines lead with a workload column, and a last line reports the degradation of the
+// foreground hipblas-us.
+int run_bench_interference(const hipblas_interference_workload& foreground,
+                           const hipblas_interference_workload& background,
+                           int                                  warmup_ms)
+{
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    hipStream_t foreground_stream
+        = create_interference_stream(foreground.priority, foreground.cu_mask);
+    hipStream_t background_stream
+        = create_interference_stream(background.priority, background.cu_mask);
+
+    hipblasBenchThread foreground_thread, background_thread;
+    foreground_thread.thread       = 0;
+    foreground_thread.stream_index = 0;
+    foreground_thread.stream       = foreground_stream;
+    foreground_thread.priority     = foreground.priority;
+    background_thread.thread       = 1;
+    background_thread.stream_index = 1;
+    background_thread.stream       = background_stream;
+    background_thread.priority     = background.priority;
+
+    bool reuse = hipblas_set_device_memory_reuse(true);
+    hipblas_set_bench_thread(foreground_thread);
+
+    ArgumentModel_set_log_prefix("workload", "foreground-alone");
+    Arguments alone(foreground.arg);
+    int       ret      = run_bench_test(alone, 0, 1);
+    double    alone_us = ArgumentModel_get_last_us();
+
+    std::atomic<bool> done(false);
+    int               background_ret  = 0;
+    int               background_runs = 0;
+    std::thread       thread([&] {
+        try
+        {
+            CHECK_HIP_ERROR(hipSetDevice(device));
+            hipblas_set_bench_thread(background_thread);
+            ArgumentModel_set_log_prefix("workload", "background");
+            while(!done)
+            {
+                Arguments a(background.arg);
+                background_ret |= run_bench_test(a, 0, 1);
+                background_runs++;
+            }
+        }
+        catch(const std::exception& exp)
+        {
+            std::cerr << exp.what() << std::endl;
+            background_ret = 1;
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(warmup_ms));
+    ArgumentModel_set_log_prefix("workload", "foreground");
+    Arguments shared(foreground.arg);
+    ret |= run_bench_test(shared, 0, 1);
+    double shared_us = ArgumentModel_get_last_us();
+
+    done = true;
+    thread.join();
+    ArgumentModel_set_log_prefix("", "");
+    hipblas_set_bench_thread(hipblasBenchThread());
+    hipblas_set_device_memory_reuse(reuse);
+    test_cleanup::cleanup();
+    CHECK_HIP_ERROR(hipStreamDestroy(foreground_stream));
+    CHECK_HIP_ERROR(hipStreamDestroy(background_stream));
+
+    std::cout << "foreground,background,background-runs,alone-us,shared-us,degradation-%\n"
+              << foreground.arg.function << ", " << background.arg.function << ", "
+              << background_runs << ", " << alone_us << ", " << shared_us << ", "
+              << (alone_us > 0 && shared_us > 0 ? 100 * (shared_us / alone_us - 1)
+                                                : ArgumentLogging::NA_value)
+              << std::endl;
+    return ret | background_ret;
+}
+
+// Comma separated items of a list option
+static std::vector<std::string> split_list(const std::string& list)
+{
+    std::vector<std::string> items;
+    std::istringstream       is(list);
+    std::string              item;
+    while(std::getline(is, item, ','))
+        if(!item.empty())
+            items.push_back(item);
+    return items;
+}
+
+// Sizes of a sweep: the list if given, else arg.start to arg.end adding arg.step, or multiplying
+// by it when geometric
+static std::vector<int>
+    sweep_values(const Arguments& arg, const std::string& mode, const std::string& list)
+{
+    std::vector<int> values;
+    if(!list.empty())
+    {
+        for(const auto& item : split_list(list))
+            values.push_back(std::stoi(item));
+    }
+    else if(mode == "linear" && arg.step > 0)
+    {
+        for(int64_t value = arg.start; value <= arg.end; value += arg.step)
+            values.push_back(value);
+    }
+    else if(mode == "geometric" && arg.start > 0 && arg.step > 1)
+    {
+        for(int64_t value = arg.start; value <= arg.end; value *= arg.step)
+            values.push_back(value);
+    }
+    else
+        throw std::invalid_argument("Invalid value for --sweep_mode, --start, --end or --step");
+
+    if(values.empty() || *std::min_element(values.begin(), values.end()) < 0)
+        throw std::invalid_argument("Invalid sizes of --sweep");
+    return values;
+}
+
+// Time budget in ms of --time_budget_ms, 0 for the fixed --cold_iters and --iters, and the half
+// width of the 95% confidence interval of the mean aimed for, as a fraction of the mean
+static double time_budget_ms = 0;
+static double target_ci      = 0.01;
+
+// Runs a timed test. With a time budget, quiet batches of calls, each sized to about 2% of the
+// budget, run until the mean of the last two differs from that of the two before by less than
+// the target, or for half of the budget. The spread of the last four batches then gives the hot
+// iterations for the target confidence interval, as many as the rest of the budget allows, and
+// the test runs once more with them and no cold iterations. The line leads with the warm-up
+// batches, the iterations and the expected confidence interval in percent.
+int run_bench_timed(Arguments& arg)
+{
+    if(time_budget_ms <= 0)
+        return run_bench_test(arg, 0, 1);
+
+    using ms = std::chrono::duration<double, std::milli>;
+
+    auto start    = std::chrono::steady_clock::now();
+    auto elapsed  = [&] { return ms(std::chrono::steady_clock::now() - start).count(); };
+    bool reuse    = hipblas_set_device_memory_reuse(true);
+    auto batch_us = [&](int iters) {
+        Arguments a(arg);
+        a.cold_iters = 0;
+        a.iters      = iters;
+        ArgumentModel_set_last_us(ArgumentLogging::NA_value);
+        run_bench_test(a, 0, 1);
+        return ArgumentModel_get_last_us();
+    };
+
+    ArgumentModel_set_log_quiet(true);
+    double first_us = batch_us(1);
+    int    batch    = 1;
+    if(first_us > 0)
+        batch = int(std::min(std::max(time_budget_ms * 1000 / 50 / first_us, 1.0), 1e6));
+
+    std::vector<double> means;
+    auto                mean_of = [&](size_t first, size_t count) {
+        double sum = 0;
+        for(size_t i = first; i < first + count; i++)
+            sum += means[i];
+        return sum / count;
+    };
+    while(first_us > 0 && elapsed() < time_budget_ms / 2)
+    {
+        double us = batch_us(batch);
+        if(us <= 0)
+            break;
+        means.push_back(us);
+
+        size_t n = means.size();
+        if(n >= 4
+           && std::abs(mean_of(n - 2, 2) - mean_of(n - 4, 2)) < target_ci * mean_of(n - 4, 4))
+            break;
+    }
+    ArgumentModel_set_log_quiet(false);
+
+    // Too few batches for a spread, as for calls longer than a quarter of the budget
+    if(means.size() < 4)
+    {
+        hipblas_set_device_memory_reuse(reuse);
+        return run_bench_test(arg, 0, 1);
+    }
+
+    size_t n    = means.size();
+    double mean = mean_of(n - 4, 4), var = 0;
+    for(size_t i = n - 4; i < n; i++)
+        var += (means[i] - mean) * (means[i] - mean) / 3;
+
+    // The variance of one call is batch times that of the mean of a batch
+    double call_sd   = std::sqrt(var * batch);
+    double needed    = std::pow(1.96 * call_sd / (target_ci * mean), 2);
+    double remaining = std::max(time_budget_ms - elapsed(), 0.0) * 1000 / mean;
+    int    iters     = int(std::max(std::min({needed, remaining, 1e9}), 1.0));
+    double ci        = 100 * 1.96 * call_sd / std::sqrt(double(iters)) / mean;
+
+    std::string names  = ArgumentModel_get_log_prefix_names();
+    std::string values = ArgumentModel_get_log_prefix_values();
+    ArgumentModel_set_log_prefix(
+        (names.empty() ? "" : names + ",") + "warmup-batches,calibrated-iters,calibrated-ci-%",
+        (values.empty() ? "" : values + ",") + std::to_string(n) + "," + std::to_string(iters)
+            + "," + std::to_string(ci));
+
+    Arguments a(arg);
+    a.cold_iters = 0;
+    a.iters      = iters;
+    int ret      = run_bench_test(a, 0, 1);
+
+    ArgumentModel_set_log_prefix(names, values);
+    hipblas_set_device_memory_reuse(reuse);
+    return ret;
+}
+
+// Runs arg for each of the values in one process, setting the dims (m, n, k or batch_count) of
+// arg to the value and the leading dimensions to at least the largest of m, n and k. The largest
+// point first runs without timing, so its device memory is allocated once and reused by the others,
+// and the name line is printed once.
+int run_bench_sweep(const Arguments& arg, const std::string& dims, const std::vector<int>& values)
+{
+    std::vector<std::string> dim_list = split_list(dims);
+
+    auto point = [&](int value) {
+        Arguments a(arg);
+        for(const auto& dim : dim_list)
+        {
+            if(dim == "m")
+                a.M = value;
+            else if(dim == "n")
+                a.N = value;
+            else if(dim == "k")
+                a.K = value;
+            else if(dim == "batch_count")
+                a.batch_count = value;
+            else
+                throw std::invalid_argument("Invalid value for --sweep " + dim);
+        }
+
+        int ld = std::max({a.M, a.N, a.K, 1});
+        a.lda  = std::max(a.lda, ld);
+        a.ldb  = std::max(a.ldb, ld);
+        a.ldc  = std::max(a.ldc, ld);
+        a.ldd  = std::max(a.ldd, ld);
+        return a;
+    };
+
+    bool reuse = hipblas_set_device_memory_reuse(true);
+    ArgumentModel_set_log_name_once(true);
+
+    Arguments largest = point(*std::max_element(values.begin(), values.end()));
+    run_bench_test(largest, 0, 0);
+
+    int ret = 0;
+    for(int value : values)
+    {
+        Arguments a = point(value);
+        ret |= run_bench_timed(a);
+    }
+
+    ArgumentModel_set_log_name_once(false);
+    hipblas_set_device_memory_reuse(reuse);
+    test_cleanup::cleanup();
+    return ret;
+}
+
+// Paddings or offsets of a layout sweep, 0 alone if the list is not given
+static std::vector<int> layout_values(const std::string& option, const std::string& list)
+{
+    std::vector<int> values;
+    for(const auto& item : split_list(list))
+        values.push_back(std::stoi(item));
+    if(values.empty())
+        values.push_back(0);
+    if(*std::min_element(values.begin(), values.end()) < 0)
+        throw std::invalid_argument("Invalid value for " + option);
+    return values;
+}
+
+// Runs arg for each padding of its leading dimensions and each offset in elements of its device
+// pointers in one process, adding the padding to lda, ldb, ldc and ldd. The lines lead with the
+// ld_pad and ptr_offset columns, and a table of hipblas-us with a row per padding and a column per
+// offset follows, ready for a heatmap. As in run_bench_sweep, the largest point runs first without
+// timing so the padded vectors are allocated once.
+int run_bench_layout_sweep(const Arguments&        arg,
+                           const std::vector<int>& pads,
+                           const std::vector<int>& offsets)
+{
+    auto point = [&](int pad) {
+        Arguments a(arg);
+        a.lda += pad;
+        a.ldb += pad;
+        a.ldc += pad;
+        a.ldd += pad;
+        return a;
+    };
+
+    bool reuse = hipblas_set_device_memory_reuse(true);
+    ArgumentModel_set_log_name_once(true);
+
+    Arguments largest = point(*std::max_element(pads.begin(), pads.end()));
+    hipblas_set_device_pointer_offset(*std::max_element(offsets.begin(), offsets.end()));
+    run_bench_test(largest, 0, 0);
+
+    int                              ret = 0;
+    std::vector<std::vector<double>> us(pads.size(), std::vector<double>(offsets.size()));
+    for(size_t i = 0; i < pads.size(); i++)
+    {
+        for(size_t j = 0; j < offsets.size(); j++)
+        {
+            Arguments a = point(pads[i]);
+            hipblas_set_device_pointer_offset(offsets[j]);
+            ArgumentModel_set_log_prefix(
+                "ld_pad,ptr_offset", std::to_string(pads[i]) + "," + std::to_string(offsets[j]));
+            ArgumentModel_set_last_us(ArgumentLogging::NA_value);
+            ret |= run_bench_timed(a);
+            us[i][j] = ArgumentModel_get_last_us();
+        }
+    }
+
+    ArgumentModel_set_log_prefix("", "");
+    hipblas_set_device_pointer_offset(0);
+    ArgumentModel_set_log_name_once(false);
+    hipblas_set_device_memory_reuse(reuse);
+    test_cleanup::cleanup();
+
+    std::cout << "\nhipblas-us,ld_pad \\ ptr_offset";
+    for(int offset : offsets)
+        std::cout << "," << offset;
+    std::cout << "\n";
+    for(size_t i = 0; i < pads.size(); i++)
+    {
+        std::cout << "hipblas-us," << pads[i];
+        for(double value : us[i])
+            std::cout << "," << value;
+        std::cout << "\n";
+    }
+    std::cout << std::flush;
+    return ret;
+}
+
+// A call of a HIPBLAS_LAYER=16 replay trace
+struct hipblas_replay_call
+{
+    Arguments                arg;
+    std::vector<std::string> bench; // hipblas-bench command line of the call
+    double                   start_us = 0;
+    std::string              thread, stream, pointer_mode;
+    double                   replay_start_us = 0, replay_us = 0;
+};
+
+// Reads the "hipblas replay:" lines of a HIPBLAS_LAYER log, in order of their start times
+static std::vector<hipblas_replay_call> read_replay(const std::string& path)
+{
+    std::ifstream file(path);
+    if(!file)
+        throw std::invalid_argument("Cannot open --replay " + path);
+
+    std::vector<hipblas_replay_call> calls;
+    for(std::string line; std::getline(file, line);)
+    {
+        size_t pos = line.find("hipblas replay: ");
+        if(pos == std::string::npos)
+            continue;
+
+        hipblas_replay_call call;
+        std::istringstream  is(line.substr(pos + 16));
+        for(std::string token; is >> token;)
+        {
+            if(!call.bench.empty() || token.find('=') == std::string::npos)
+                call.bench.push_back(token);
+            else if(!token.compare(0, 9, "start_us="))
+                call.start_us = std::stod(token.substr(9));
+            else if(!token.compare(0, 7, "thread="))
+                call.thread = token.substr(7);
+            else if(!token.compare(0, 7, "stream="))
+                call.stream = token.substr(7);
+            else if(!token.compare(0, 13, "pointer_mode="))
+                call.pointer_mode = token.substr(13);
+        }
+        if(!call.bench.empty())
+            calls.push_back(std::move(call));
+    }
+
+    std::stable_sort(calls.begin(), calls.end(), [](const auto& a, const auto& b) {
+        return a.start_us < b.start_us;
+    });
+    return calls;
+}
+
+// Runs the calls of a replay trace in order, each at the same time after the first call as in the
+// trace unless the replay is already later, and prints the timeline of the trace and the replay
+int run_bench_replay(std::vector<hipblas_replay_call>& calls)
+{
+    using clock = std::chrono::steady_clock;
+    using us    = std::chrono::duration<double, std::micro>;
+
+    bool reuse = hipblas_set_device_memory_reuse(true);
+
+    int               ret    = 0;
+    double            first  = calls.empty() ? 0 : calls.front().start_us;
+    clock::time_point origin = clock::now();
+    for(auto& call : calls)
+    {
+        std::this_thread::sleep_until(
+            origin + std::chrono::duration_cast<clock::duration>(us(call.start_us - first)));
+
+        clock::time_point start = clock::now();
+        ret |= run_bench_test(call.arg, 0, 1);
+        clock::time_point end = clock::now();
+
+        call.replay_start_us = us(start - origin).count();
+        call.replay_us       = us(end - start).count();
+    }
+
+    hipblas_set_device_memory_reuse(reuse);
+    test_cleanup::cleanup();
+
+    double replay_span = 0;
+    std::cout << "\ncall,thread,stream,pointer_mode,function,trace-start-us,replay-start-us,"
+                 "replay-us\n";
+    for(size_t i = 0; i < calls.size(); i++)
+    {
+        const auto& call = calls[i];
+        replay_span      = std::max(replay_span, call.replay_start_us + call.replay_us);
+        std::cout << i << ", " << call.thread << ", " << call.stream << ", " << call.pointer_mode
+                  << ", " << call.arg.function << ", " << call.start_us - first << ", "
+                  << call.replay_start_us << ", " << call.replay_us << "\n";
+    }
+    std::cout << "calls,trace-span-us,replay-span-us\n"
+              << calls.size() << ", " << (calls.empty() ? 0 : calls.back().start_us - first)
+              << ", " << replay_span << std::endl;
+    return ret;
+}
+
+// A case of a shape distribution file: its weight and the hipblas-bench options of the case
+struct hipblas_shape_case
+{
+    Arguments                arg;
+    std::vector<std::string> bench;
+    double                   weight = 0;
+    double                   us = 0, gflop = 0;
+};
+
+// Reads a shape distribution: one case per line, its weight, such as the number of calls in a
+// production histogram, then its options. Empty lines and lines starting with # are skipped.
+static std::vector<hipblas_shape_case> read_shape_distribution(const std::string& path)
+{
+    std::ifstream file(path);
+    if(!file)
+        throw std::invalid_argument("Cannot open --shape_distribution " + path);
+
+    std::vector<hipblas_shape_case> cases;
+    for(std::string line; std::getline(file, line);)
+    {
+        std::istringstream is(line);
+        std::string        weight;
+        if(!(is >> weight) || weight[0] == '#')
+            continue;
+
+        hipblas_shape_case shape;
+        shape.bench.push_back("hipblas-bench");
+        for(std::string token; is >> token;)
+            shape.bench.push_back(token);
+
+        char* end;
+        shape.weight = std::strtod(weight.c_str(), &end);
+        if(*end || !(shape.weight >= 0) || shape.bench.size() < 2)
+            throw std::invalid_argument("Invalid line of --shape_distribution: " + line);
+        cases.push_back(std::move(shape));
+    }
+    if(cases.empty())
+        throw std::invalid_argument("No case in --shape_distribution " + path);
+    return cases;
+}
+
+// Runs the cases of a shape distribution, each once with its weight in the leading columns, and
+// prints the share of the weighted time of each case and the weighted throughput of the mix: the
+// Gflop of all calls over their time. With samples, the weights are the counts of the cases in
+// that many draws from the distribution instead.
+int run_bench_shape_distribution(std::vector<hipblas_shape_case>& cases,
+                                 hipblas_int                      samples,
+                                 hipblas_int                      seed)
+{
+    if(samples > 0)
+    {
+        std::vector<double> weights;
+        for(const auto& shape : cases)
+            weights.push_back(shape.weight);
+        std::discrete_distribution<size_t> draw(weights.begin(), weights.end());
+        std::mt19937                       gen(seed);
+        for(auto& shape : cases)
+            shape.weight = 0;
+        for(hipblas_int i = 0; i < samples; i++)
+            cases[draw(gen)].weight++;
+    }
+
+    bool reuse = hipblas_set_device_memory_reuse(true);
+
+    int ret = 0;
+    for(size_t i = 0; i < cases.size(); i++)
+    {
+        auto& shape = cases[i];
+        if(!(shape.weight > 0))
+            continue;
+
+        std::ostringstream weight;
+        weight << i << "," << shape.weight;
+        ArgumentModel_set_log_prefix("case,weight", weight.str());
+        ArgumentModel_set_last_us(ArgumentLogging::NA_value);
+        ArgumentModel_set_last_gflop(0);
+        ret |= run_bench_timed(shape.arg);
+        shape.us    = ArgumentModel_get_last_us();
+        shape.gflop = ArgumentModel_get_last_gflop();
+    }
+
+    ArgumentModel_set_log_prefix("", "");
+    hipblas_set_device_memory_reuse(reuse);
+    test_cleanup::cleanup();
+
+    // Only the cases which ran count
+    double weight = 0, weighted_us = 0, weighted_gflop = 0;
+    size_t count  = 0;
+    for(const auto& shape : cases)
+    {
+        if(!(shape.weight > 0) || !(shape.us > 0))
+            continue;
+        count++;
+        weight += shape.weight;
+        weighted_us += shape.weight * shape.us;
+        weighted_gflop += shape.weight * shape.gflop;
+    }
+
+    std::cout << "
+case,function,weight,hipblas-us,hipblas-Gflops,time-share
+";
+    for(size_t i = 0; i < cases.size(); i++)
+    {
+        const auto& shape = cases[i];
+        if(!(shape.weight > 0) || !(shape.us > 0))
+            continue;
+        std::cout << i << ", " << shape.arg.function << ", " << shape.weight << ", " << shape.us
+                  << ", " << shape.gflop / shape.us * 1e6 << ", "
+                  << shape.weight * shape.us / weighted_us << "
+";
+    }
+    std::cout << "cases,weight,weighted-us,weighted-Gflops
+"
+              << count << ", " << weight << ", " << (weight > 0 ? weighted_us / weight : 0) << ", "
+              << (weighted_us > 0 ? weighted_gflop / weighted_us * 1e6 : 0) << std::endl;
+    return ret;
+}
+
 // Replace --batch with --batch_count for backward compatibility
 void fix_batch(int argc, char* argv[])
 {
@@ -142,13 +845,51 @@ try
     std::string compute_type;
     std::string compute_type_gemm;
     std::string initialization;
+    std::string peak_file;
+    std::string bandwidth_sizes;
+    std::string bandwidth_cache;
+    std::string counters;
+    std::string output;
+    std::string output_file;
+    std::string histogram;
+    std::string sweep;
+    std::string sweep_mode;
+    std::string sweep_list;
+    std::string ld_pad_sweep;
+    std::string ptr_offset_sweep;
+    std::string pointer_mode;
+    std::string replay;
+    std::string shape_distribution;
+    hipblas_int shape_samples;
+    hipblas_int shape_seed;
+    std::string background;
+    std::string foreground_priority;
+    std::string background_priority;
+    std::string foreground_cu_mask;
+    std::string background_cu_mask;
+    hipblas_int background_warmup_ms;
+    double      target_ci_percent;
     hipblas_int device_id;
     hipblas_int parallel_devices;
-
-    bool datafile            = hipblas_parse_data(argc, argv);
-    bool atomics_not_allowed = false;
-    bool log_function_name   = false;
-    bool log_datatype        = false;
+    hipblas_int threads;
+    hipblas_int streams;
+
+    bool   datafile            = hipblas_parse_data(argc, argv);
+    bool   atomics_not_allowed = false;
+    bool   log_function_name   = false;
+    bool   log_datatype        = false;
+    bool   timing_events       = false;
+    bool   graph               = false;
+    bool   efficiency          = false;
+    bool   bandwidth           = false;
+    bool   telemetry           = false;
+    bool   kernel_breakdown    = false;
+    bool   compare_native      = false;
+    size_t flush_memory_size   = 0;
+    size_t batch_alignment     = 0;
+    bool   batch_shuffle       = false;
+    bool   pinned              = false;
+    bool   fresh_handles       = false;
 
     options_description desc("hipblas-bench command line options");
 
@@ -276,7 +1017,7 @@ try
 
         ("compute_type_gemm",
          value<std::string>(&compute_type_gemm), "Precision of computation for gemm_ex with HIPBLAS_V2 define"
-         "Options: 16f,16f_pedantic,32f,32f_pedantic,32f_fast_16f,32f_fast_16bf,32f_fast_tf32,64f,64f_pedantic,32i,32i_pedantic")
+         "Options: 16f,16f_pedantic,32f,32f_pedantic,32f_fast_16f,32f_fast_16bf,32f_fast_tf32,64f,64f_pedantic,32i,32i_pedantic,32f_fast_16bfx3")
 
         ("initialization",
          value<std::string>(&initialization)->default_value("hpl"),
@@ -323,6 +1064,16 @@ try
          value<hipblas_int>(&arg.cold_iters)->default_value(2),
          "Cold Iterations to run before entering the timing loop")
 
+        ("time_budget_ms",
+         value<double>(&time_budget_ms)->default_value(0),
+         "Time in ms for each test in place of --cold_iters and --iters: warm up until the time per call is "
+         "stable, then run as many hot iterations as --target_ci needs, within the budget. 0 = Off (default)")
+
+        ("target_ci",
+         value<double>(&target_ci_percent)->default_value(1),
+         "Half width of the 95% confidence interval of the mean time per call aimed for by --time_budget_ms, "
+         "in percent of the mean")
+
         ("algo",
          value<uint32_t>(&arg.algo)->default_value(0),
          "extended precision gemm algorithm")
@@ -335,6 +1086,10 @@ try
          value<uint32_t>(&arg.flags)->default_value(0),
          "gemm_ex flags")
 
+        ("workspace",
+         value<size_t>(&arg.user_allocated_workspace)->default_value(0),
+         "Set fixed workspace memory size in bytes instead of using hipBLAS managed memory")
+
         ("atomics_not_allowed",
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
@@ -347,6 +1102,17 @@ try
          value<hipblas_int>(&parallel_devices)->default_value(0),
          "Set number of devices used for parallel runs (device 0 to parallel_devices-1)")
 
+        ("threads",
+         value<hipblas_int>(&threads)->default_value(0),
+         "Number of host threads running the test, or the tests of the yaml file split between them, "
+         "concurrently on the device, each with its own handles. Reports the aggregate throughput. "
+         "0 = No threads (default), or one per stream with --streams")
+
+        ("streams",
+         value<hipblas_int>(&streams)->default_value(0),
+         "Number of streams shared round robin by the handles of the --threads threads. "
+         "0 = Null stream (default)")
+
         // ("c_noalias_d",
         //  bool_switch(&arg.c_noalias_d)->default_value(false),
         //  "C and D are stored in separate memory")
@@ -359,6 +1125,196 @@ try
          bool_switch(&log_datatype)->default_value(false),
          "Include datatypes used in output.")
 
+        ("sweep",
+         value<std::string>(&sweep),
+         "Comma separated dims set to each size of a sweep in this process: m, n, k and batch_count, "
+         "for example m,n,k. Leading dimensions grow to at least the largest of m, n and k.")
+
+        ("sweep_mode",
+         value<std::string>(&sweep_mode)->default_value("linear"),
+         "Sizes of --sweep from --start to --end: linear adds --step, geometric multiplies by it")
+
+        ("sweep_list",
+         value<std::string>(&sweep_list),
+         "Comma separated sizes of --sweep, in place of --start, --end and --step")
+
+        ("ld_pad_sweep",
+         value<std::string>(&ld_pad_sweep),
+         "Comma separated paddings added to lda, ldb, ldc and ldd, each run in this process, for example "
+         "0,1,2,4,8,16,32,64. With --ptr_offset_sweep, each pair is run. A table of hipblas-us by padding "
+         "and offset follows the lines.")
+
+        ("ptr_offset_sweep",
+         value<std::string>(&ptr_offset_sweep),
+         "Comma separated offsets in elements of the device pointers from their allocations, which are "
+         "256 byte aligned, each run in this process, for example 0,1,2,3,4,8,16.")
+
+        ("start",
+         value<int>(&arg.start)->default_value(1024),
+         "First size of --sweep")
+
+        ("end",
+         value<int>(&arg.end)->default_value(10240),
+         "Last size of --sweep")
+
+        ("step",
+         value<int>(&arg.step)->default_value(1000),
+         "Increment, or factor if geometric, of the sizes of --sweep")
+
+        ("output",
+         value<std::string>(&output),
+         "Also write one record per test with the device, driver and library versions, all arguments and "
+         "the performance fields: csv, json (one object per line) or sqlite. Records are buffered and written at exit, "
+         "to --output_file or to stdout in place of the name and value lines. sqlite appends them to the results "
+         "table of the database --output_file, which it needs, through libsqlite3.so.0.")
+
+        ("output_file",
+         value<std::string>(&output_file),
+         "File of the --output records, csv if --output is not given.")
+
+        ("timing_events",
+         bool_switch(&timing_events)->default_value(false),
+         "Time each hot iteration with hipEvents and include min, median, p90, p99 and stddev in output.")
+
+        ("histogram",
+         value<std::string>(&histogram),
+         "File of a JSON object per test with the arguments, the performance fields and a histogram of the "
+         "event times of the hot iterations in log buckets. Implies --timing_events and adds p99.9 and max "
+         "to output.")
+
+        ("flush_memory_size",
+         value<size_t>(&flush_memory_size)->default_value(0),
+         "Bytes of device memory overwritten before each iteration to run with cold caches, "
+         "for example twice the last level cache. Implies --timing_events and times the hot iterations with "
+         "hipEvents, excluding the flushes. 0 = No flush (default)")
+
+        ("batch_alignment",
+         value<size_t>(&batch_alignment)->default_value(0),
+         "Carve all vectors of a batched function from one allocation, at slots aligned to this power of two "
+         "in bytes, instead of allocating each vector. 0 = One allocation per vector (default)")
+
+        ("batch_shuffle",
+         bool_switch(&batch_shuffle)->default_value(false),
+         "Place the vectors of a batched function in a fixed random order in their allocation, to measure "
+         "scattered batch pointers. Implies --batch_alignment 256 if it is not given.")
+
+        ("pinned",
+         bool_switch(&pinned)->default_value(false),
+         "Allocate host vectors with hipHostMalloc, so transfers to and from the device run as DMA "
+         "from pinned memory instead of through pageable staging buffers.")
+
+        ("replay",
+         value<std::string>(&replay),
+         "Run the calls of a HIPBLAS_LAYER=16 log again, in the order and at the times after the first "
+         "call that they were made, and print the timeline of the log and of the replay. Options of "
+         "the command line apply to the calls that do not set them, for example -i 1 --cold_iters 0.")
+
+        ("shape_distribution",
+         value<std::string>(&shape_distribution),
+         "File of weighted cases, one per line: the weight, for example the count of a shape in a production "
+         "histogram, then the options of the case, such as \"120 -f gemm -r f16_r -m 4096 -n 512 -k 4096\". "
+         "Each case runs once, then the share of the weighted time of each case and the weighted Gflops of the "
+         "mix, all Gflop over all time, are printed. Options of the command line apply to the cases that do not "
+         "set them.")
+
+        ("shape_samples",
+         value<hipblas_int>(&shape_samples)->default_value(0),
+         "Weigh the cases of --shape_distribution by their counts in this many random draws from it instead. "
+         "0 = The weights of the file (default)")
+
+        ("shape_seed",
+         value<hipblas_int>(&shape_seed)->default_value(1),
+         "Seed of the draws of --shape_samples")
+
+        ("background",
+         value<std::string>(&background),
+         "Options of a second test, for example \"-f axpy -n 100000000 -i 1000\", run again and again from a "
+         "thread on a stream of its own while the test of the command line runs. The test of the command "
+         "line also runs alone first, and the slowdown of its hipblas-us is printed. Options of the command "
+         "line apply to the background test when it does not set them.")
+
+        ("foreground_priority",
+         value<std::string>(&foreground_priority)->default_value("default"),
+         "Priority of the stream of the test of the command line with --background: default, latency "
+         "(the greatest priority of the device) or bulk (the least)")
+
+        ("background_priority",
+         value<std::string>(&background_priority)->default_value("default"),
+         "Priority of the stream of the --background test: default, latency or bulk")
+
+        ("foreground_cu_mask",
+         value<std::string>(&foreground_cu_mask),
+         "Hex mask of the compute units of the stream of the test of the command line with --background, "
+         "bit 0 for compute unit 0, for example 0xffff. AMD devices only, and not with a priority.")
+
+        ("background_cu_mask",
+         value<std::string>(&background_cu_mask),
+         "Hex mask of the compute units of the stream of the --background test")
+
+        ("background_warmup_ms",
+         value<hipblas_int>(&background_warmup_ms)->default_value(1000),
+         "Milliseconds the --background test runs before the test of the command line starts again")
+
+        ("graph",
+         bool_switch(&graph)->default_value(false),
+         "Also capture the hot iterations into a HIP graph and replay it. Includes the time per call of the "
+         "graph and the launch time saved against the eager calls in output.")
+
+        ("fresh_handles",
+         bool_switch(&fresh_handles)->default_value(false),
+         "Create and destroy a handle for each test instead of reusing the handles of the library handle "
+         "pool, to include the first-use effects of a new handle.")
+
+        ("efficiency",
+         bool_switch(&efficiency)->default_value(false),
+         "Include the percent of the peak Gflops and GB/s of the device and the flop/byte arithmetic "
+         "intensity in output.")
+
+        ("peak_file",
+         value<std::string>(&peak_file),
+         "File of peaks overriding the built-in ones of --efficiency, with lines \"<arch> <precision> <Gflops>\" "
+         "and \"<arch> bandwidth <GB/s>\", for example \"gfx90a f64_r 47870\". # starts a comment.")
+
+        ("bandwidth",
+         bool_switch(&bandwidth)->default_value(false),
+         "Measure the copy and triad bandwidth of the device at startup and include the percent of the "
+         "measured triad GB/s of the largest size in output.")
+
+        ("bandwidth_sizes",
+         value<std::string>(&bandwidth_sizes)->default_value("1,8,64,512"),
+         "Comma separated sizes in MiB of each array of --bandwidth. Sizes that do not fit are skipped.")
+
+        ("bandwidth_cache",
+         value<std::string>(&bandwidth_cache),
+         "File of --bandwidth measurements, read for a device and sizes measured before and appended to "
+         "otherwise.")
+
+        ("telemetry",
+         bool_switch(&telemetry)->default_value(false),
+         "Include the power, shader and memory clocks and temperature of the device, sampled every 10 ms "
+         "during the hot iterations, and the Gflops per watt in output.")
+
+        ("counters",
+         value<std::string>(&counters),
+         "Comma-separated list of rocprofiler metrics, for example L2CacheHit,FETCH_SIZE,WRITE_SIZE,VALUUtilization, "
+         "counted on one call run after the timed ones and included in output. NVIDIA devices are not supported.")
+
+        ("kernel_breakdown",
+         bool_switch(&kernel_breakdown)->default_value(false),
+         "Trace one call run after the timed ones and list each kernel it launched, with its time, grid "
+         "and block, after the output line. NVIDIA devices are not supported.")
+
+        ("compare_native",
+         bool_switch(&compare_native)->default_value(false),
+         "With -f host_overhead, also time each routine called directly in rocBLAS or cuBLAS on the same handle "
+         "and include the native time and the hipBLAS overhead per call in output.")
+
+        ("pointer_mode",
+         value<std::string>(&pointer_mode),
+         "Pointer mode of alpha, beta and the results in the timing loops that support both: host, device, "
+         "or both to run each test in host and then in device mode. The output includes the mode of each "
+         "line. Unset, each loop runs in the mode it prefers.")
+
         ("fortran",
          bool_switch(&arg.fortran)->default_value(false),
          "Run using Fortran interface")
@@ -395,6 +1351,43 @@ try
 
     ArgumentModel_set_log_datatype(log_datatype);
 
+    ArgumentModel_set_output(output, output_file);
+
+    ArgumentModel_set_histogram(histogram);
+
+    hipblas_set_timing_events(timing_events || !histogram.empty());
+
+    hipblas_set_flush_memory_size(flush_memory_size);
+
+    hipblas_set_graph_replay(graph);
+
+    hipblas_set_handle_reuse(!fresh_handles);
+
+    hipblas_set_telemetry(telemetry);
+
+    hipblas_set_counters(counters);
+
+    hipblas_set_kernel_breakdown(kernel_breakdown);
+
+    hipblas_set_compare_native(compare_native);
+
+    if(!pointer_mode.empty() && pointer_mode != "host" && pointer_mode != "device"
+       && pointer_mode != "both")
+        throw std::invalid_argument("Invalid value for --pointer_mode " + pointer_mode);
+    hipblas_set_timing_pointer_mode(!pointer_mode.empty(),
+                                    pointer_mode == "device" ? HIPBLAS_POINTER_MODE_DEVICE
+                                                             : HIPBLAS_POINTER_MODE_HOST);
+
+    hipblas_set_host_memory_pinned(pinned);
+
+    hipblas_set_device_batch_layout(batch_shuffle && !batch_alignment ? 256 : batch_alignment,
+                                    batch_shuffle);
+
+    hipblas_set_efficiency(efficiency || !peak_file.empty());
+
+    if(!peak_file.empty())
+        hipblas_load_peak_file(peak_file);
+
     // Device Query
     hipblas_int device_count = query_device_property();
 
@@ -403,55 +1396,212 @@ try
         throw std::invalid_argument("Invalid Device ID");
     set_device(device_id);
 
+    if(bandwidth)
+    {
+        std::vector<size_t> sizes;
+        for(const auto& item : split_list(bandwidth_sizes))
+            sizes.push_back(std::stoul(item));
+        hipblas_set_bandwidth_sizes(sizes);
+        hipblas_set_bandwidth_cache(bandwidth_cache);
+        hipblas_set_bandwidth(true);
+        hipblas_print_bandwidth(std::cout);
+        std::cout << std::endl;
+    }
+
+    if(threads < 0 || streams < 0)
+        throw std::invalid_argument("Invalid value for --threads or --streams");
+    if(target_ci_percent <= 0)
+        throw std::invalid_argument("Invalid value for --target_ci");
+    if(time_budget_ms > 0 && (threads || parallel_devices))
+        throw std::invalid_argument("--time_budget_ms runs in one thread on one device");
+    target_ci = target_ci_percent / 100;
+    if(streams && !threads)
+        threads = streams;
+
+    if(datafile && threads)
+    {
+        std::vector<Arguments> tests;
+        for(Arguments a : HipBLAS_TestData())
+            tests.push_back(a);
+        return run_bench_concurrent_test(threads, streams, tests);
+    }
     if(datafile)
         return hipblas_bench_datafile();
 
-    std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
-    auto prec = string2hipblas_datatype(precision);
-    if(prec == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --precision " + precision);
-
-    arg.a_type = a_type == "" ? prec : string2hipblas_datatype(a_type);
-    if(arg.a_type == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --a_type " + a_type);
-
-    arg.b_type = b_type == "" ? prec : string2hipblas_datatype(b_type);
-    if(arg.b_type == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --b_type " + b_type);
-
-    arg.c_type = c_type == "" ? prec : string2hipblas_datatype(c_type);
-    if(arg.c_type == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --c_type " + c_type);
-
-    arg.d_type = d_type == "" ? prec : string2hipblas_datatype(d_type);
-    if(arg.d_type == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --d_type " + d_type);
-
-    arg.compute_type = compute_type == "" ? prec : string2hipblas_datatype(compute_type);
-    if(arg.compute_type == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --compute_type " + compute_type);
-
-    arg.compute_type_gemm = string2hipblas_computetype(compute_type_gemm);
+    // Sets the types, initialization and function of arg from their options
+    auto set_arg_options = [&] {
+        std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
+        auto prec = string2hipblas_datatype(precision);
+        if(prec == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --precision " + precision);
+
+        arg.a_type = a_type == "" ? prec : string2hipblas_datatype(a_type);
+        if(arg.a_type == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --a_type " + a_type);
+
+        arg.b_type = b_type == "" ? prec : string2hipblas_datatype(b_type);
+        if(arg.b_type == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --b_type " + b_type);
+
+        arg.c_type = c_type == "" ? prec : string2hipblas_datatype(c_type);
+        if(arg.c_type == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --c_type " + c_type);
+
+        arg.d_type = d_type == "" ? prec : string2hipblas_datatype(d_type);
+        if(arg.d_type == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --d_type " + d_type);
+
+        arg.compute_type = compute_type == "" ? prec : string2hipblas_datatype(compute_type);
+        if(arg.compute_type == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --compute_type " + compute_type);
+
+        arg.compute_type_gemm = string2hipblas_computetype(compute_type_gemm);
+
+        arg.initialization = string2hipblas_initialization(initialization);
+        if(arg.initialization == static_cast<hipblas_initialization>(0)) // invalid enum
+            throw std::invalid_argument("Invalid value for --initialization " + initialization);
+
+        if(arg.M < 0)
+            throw std::invalid_argument("Invalid value for -m " + std::to_string(arg.M));
+        if(arg.N < 0)
+            throw std::invalid_argument("Invalid value for -n " + std::to_string(arg.N));
+        if(arg.K < 0)
+            throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
+
+        int copied = snprintf(arg.function, sizeof(arg.function), "%s", function.c_str());
+        if(copied <= 0 || copied >= sizeof(arg.function))
+            throw std::invalid_argument("Invalid value for --function");
+    };
+
+    // Each call of --replay and case of --shape_distribution starts from the options of the
+    // command line, changed by its own
+    Arguments                 cmd_arg = arg;
+    std::vector<std::string*> options = {&function,
+                                         &precision,
+                                         &a_type,
+                                         &b_type,
+                                         &c_type,
+                                         &d_type,
+                                         &compute_type,
+                                         &compute_type_gemm,
+                                         &initialization};
+    std::vector<std::string>  cmd_options;
+    for(auto option : options)
+        cmd_options.push_back(*option);
+
+    auto call_arg = [&](std::vector<std::string>& tokens) {
+        arg = cmd_arg;
+        for(size_t i = 0; i < options.size(); i++)
+            *options[i] = cmd_options[i];
+
+        std::vector<char*> call_argv;
+        for(auto& token : tokens)
+            call_argv.push_back(&token[0]);
+        call_argv.push_back(nullptr);
+        store(parse_command_line(int(tokens.size()), call_argv.data(), desc, true), vm);
+
+        set_arg_options();
+        return arg;
+    };
+
+    if(!replay.empty())
+    {
+        std::vector<hipblas_replay_call> calls = read_replay(replay);
+        for(auto& call : calls)
+            call.arg = call_arg(call.bench);
+        return run_bench_replay(calls);
+    }
 
-    arg.initialization = string2hipblas_initialization(initialization);
-    if(arg.initialization == static_cast<hipblas_initialization>(0)) // invalid enum
-        throw std::invalid_argument("Invalid value for --initialization " + initialization);
+    if(!shape_distribution.empty())
+    {
+        if(threads || parallel_devices || !sweep.empty() || !ld_pad_sweep.empty()
+           || !ptr_offset_sweep.empty() || pointer_mode == "both" || !background.empty())
+            throw std::invalid_argument("--shape_distribution runs in one thread on one device");
+        if(shape_samples < 0)
+            throw std::invalid_argument("Invalid value for --shape_samples");
+
+        std::vector<hipblas_shape_case> cases = read_shape_distribution(shape_distribution);
+        for(auto& shape : cases)
+            shape.arg = call_arg(shape.bench);
+        return run_bench_shape_distribution(cases, shape_samples, shape_seed);
+    }
 
-    if(arg.M < 0)
-        throw std::invalid_argument("Invalid value for -m " + std::to_string(arg.M));
-    if(arg.N < 0)
-        throw std::invalid_argument("Invalid value for -n " + std::to_string(arg.N));
-    if(arg.K < 0)
-        throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
+    if(!background.empty())
+    {
+        if(threads || parallel_devices || !sweep.empty() || !ld_pad_sweep.empty()
+           || !ptr_offset_sweep.empty() || pointer_mode == "both")
+            throw std::invalid_argument(
+                "--background runs one test in the foreground on one device");
+        if(background_warmup_ms < 0)
+            throw std::invalid_argument("Invalid value for --background_warmup_ms");
+
+        hipblas_interference_workload foreground_workload, background_workload;
+        foreground_workload.priority
+            = interference_priority("--foreground_priority", foreground_priority);
+        foreground_workload.cu_mask = foreground_cu_mask;
+        background_workload.priority
+            = interference_priority("--background_priority", background_priority);
+        background_workload.cu_mask = background_cu_mask;
+
+        set_arg_options();
+        foreground_workload.arg = arg;
+
+        // The background test starts from the options of the command line, changed by its own
+        std::vector<std::string> tokens = {"hipblas-bench"};
+        std::istringstream       words(background);
+        for(std::string word; words >> word;)
+            tokens.push_back(word);
+
+        std::vector<char*> background_argv;
+        for(auto& token : tokens)
+            background_argv.push_back(&token[0]);
+        background_argv.push_back(nullptr);
+        store(parse_command_line(int(tokens.size()), background_argv.data(), desc, true), vm);
+
+        set_arg_options();
+        background_workload.arg = arg;
+        return run_bench_interference(
+            foreground_workload, background_workload, background_warmup_ms);
+    }
 
-    int copied = snprintf(arg.function, sizeof(arg.function), "%s", function.c_str());
-    if(copied <= 0 || copied >= sizeof(arg.function))
-        throw std::invalid_argument("Invalid value for --function");
+    set_arg_options();
 
-    if(!parallel_devices)
-        return run_bench_test(arg, 0, 1);
-    else
-        return run_bench_multi_gpu_test(parallel_devices, arg);
+    auto run_bench = [&] {
+        if(!sweep.empty())
+        {
+            if(threads || parallel_devices)
+                throw std::invalid_argument("--sweep runs in one thread on one device");
+            if(!ld_pad_sweep.empty() || !ptr_offset_sweep.empty())
+                throw std::invalid_argument("--sweep and a layout sweep cannot be combined");
+            return run_bench_sweep(arg, sweep, sweep_values(arg, sweep_mode, sweep_list));
+        }
+        if(!ld_pad_sweep.empty() || !ptr_offset_sweep.empty())
+        {
+            if(threads || parallel_devices)
+                throw std::invalid_argument("A layout sweep runs in one thread on one device");
+            return run_bench_layout_sweep(arg,
+                                          layout_values("--ld_pad_sweep", ld_pad_sweep),
+                                          layout_values("--ptr_offset_sweep", ptr_offset_sweep));
+        }
+        if(threads)
+            return run_bench_concurrent_test(
+                threads, streams, std::vector<Arguments>(threads, arg));
+        else if(!parallel_devices)
+            return run_bench_timed(arg);
+        else
+            return run_bench_multi_gpu_test(parallel_devices, arg);
+    };
+
+    if(pointer_mode != "both")
+        return run_bench();
+
+    // Host mode, then device mode, under one name line
+    ArgumentModel_set_log_name_once(true);
+    int ret = run_bench();
+    hipblas_set_timing_pointer_mode(true, HIPBLAS_POINTER_MODE_DEVICE);
+    ret |= run_bench();
+    ArgumentModel_set_log_name_once(false);
+    return ret;
 }
 catch(const std::invalid_argument& exp)
 {
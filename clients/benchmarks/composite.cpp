@@ -0,0 +1,644 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// hipblas-composite-bench times small applications built only from hipBLAS calls: a conjugate
+// gradient solve, a blocked LU factorization and the GEMMs of a transformer layer. Unlike the
+// single functions of hipblas-bench, their time per iteration includes the synchronizations,
+// pointer mode round trips and launch overhead between the calls.
+
+#include "program_options.hpp"
+
+#include <hipblas/hipblas.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace roc; // For emulated program_options
+
+namespace
+{
+    void check(hipError_t error, const char* call)
+    {
+        if(error != hipSuccess)
+            throw std::runtime_error(std::string(call) + ": " + hipGetErrorString(error));
+    }
+
+    void check(hipblasStatus_t status, const char* call)
+    {
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error(std::string(call) + ": " + hipblasStatusToString(status));
+    }
+
+#define CHECK(CALL) check(CALL, #CALL)
+
+    // Device memory of count elements, freed with the buffer
+    template <typename T>
+    struct device_buffer
+    {
+        T* ptr = nullptr;
+
+        explicit device_buffer(size_t count, const std::vector<T>& init = {})
+        {
+            CHECK(hipMalloc(&ptr, std::max<size_t>(count, 1) * sizeof(T)));
+            if(!init.empty())
+                CHECK(hipMemcpy(ptr, init.data(), init.size() * sizeof(T), hipMemcpyHostToDevice));
+        }
+        ~device_buffer()
+        {
+            (void)hipFree(ptr);
+        }
+        device_buffer(const device_buffer&) = delete;
+        device_buffer& operator=(const device_buffer&) = delete;
+
+        operator T*() const
+        {
+            return ptr;
+        }
+    };
+
+    struct composite_options
+    {
+        int         n;
+        int         nb;
+        int         restart;
+        std::string pointer_mode;
+        int         batch;
+        int         seq;
+        int         hidden;
+        int         heads;
+        int         iters;
+        int         cold_iters;
+    };
+
+    // Time per iteration on the device, and on the host to enqueue the calls of an iteration
+    struct composite_time
+    {
+        double us;
+        double enqueue_us;
+    };
+
+    // Runs cold_iters then iters iterations of step, each between the events of the stream
+    template <typename F>
+    composite_time time_iterations(hipStream_t stream, const composite_options& opt, F step)
+    {
+        for(int i = 0; i < opt.cold_iters; i++)
+            step(i);
+        CHECK(hipStreamSynchronize(stream));
+
+        hipEvent_t start, stop;
+        CHECK(hipEventCreate(&start));
+        CHECK(hipEventCreate(&stop));
+
+        auto host_start = std::chrono::steady_clock::now();
+        CHECK(hipEventRecord(start, stream));
+        for(int i = 0; i < opt.iters; i++)
+            step(opt.cold_iters + i);
+        CHECK(hipEventRecord(stop, stream));
+        auto host_stop = std::chrono::steady_clock::now();
+        CHECK(hipEventSynchronize(stop));
+
+        float ms = 0;
+        CHECK(hipEventElapsedTime(&ms, start, stop));
+        (void)hipEventDestroy(start);
+        (void)hipEventDestroy(stop);
+
+        double enqueue_us
+            = std::chrono::duration<double, std::micro>(host_stop - host_start).count() / opt.iters;
+        return {1000.0 * ms / opt.iters, enqueue_us};
+    }
+
+    void print_result(const char*        workload,
+                      const std::string& names,
+                      const std::string& values,
+                      double             flops,
+                      composite_time     time,
+                      double             check_value)
+    {
+        std::cout << "workload," << names << ",iters,us_per_iter,enqueue_us,gflops,check\n"
+                  << workload << "," << values << "," << time.us << "," << time.enqueue_us << ","
+                  << flops / time.us / 1e3 << "," << check_value << "\n"
+                  << std::endl;
+    }
+
+    // One CG step per iteration on a dense n x n SPD matrix. With the device pointer mode the
+    // scalars stay on the device: alpha = rr / pq and beta = rr_new / rr are the solutions of
+    // 1 x 1 triangular systems, so no iteration waits for the host. With the host pointer mode
+    // each dot returns to the host, as in a naive port.
+    void run_cg(hipblasHandle_t handle, hipStream_t stream, const composite_options& opt)
+    {
+        const int           n = opt.n;
+        std::vector<double> hA(size_t(n) * n);
+        std::mt19937        gen(1);
+        std::uniform_real_distribution<double> dist(0, 1);
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i <= j; i++)
+                hA[i + size_t(j) * n] = hA[j + size_t(i) * n] = i == j ? n : dist(gen);
+
+        device_buffer<double> A(size_t(n) * n, hA), b(n, std::vector<double>(n, 1.0)),
+            x(n, std::vector<double>(n, 0.0)), r(n), p(n), q(n);
+
+        // scalars: one, minus_one, zero, rr, rr_new, pq, alpha, neg_alpha, beta
+        enum
+        {
+            one,
+            minus_one,
+            zero,
+            rr,
+            rr_new,
+            pq,
+            alpha,
+            neg_alpha,
+            beta,
+            scalar_count
+        };
+        std::vector<double>   hs(scalar_count, 0.0);
+        device_buffer<double> s(scalar_count, {1.0, -1.0, 0.0, 0, 0, 0, 0, 0, 0});
+        const bool            device_mode = opt.pointer_mode == "device";
+        double*               sc          = device_mode ? s.ptr : hs.data();
+        hs[one] = 1.0, hs[minus_one] = -1.0;
+
+        CHECK(hipblasSetPointerMode(handle,
+                                    device_mode ? HIPBLAS_POINTER_MODE_DEVICE
+                                                : HIPBLAS_POINTER_MODE_HOST));
+
+        auto step = [&](int iteration) {
+            if(iteration % opt.restart == 0)
+            {
+                // x = 0, r = p = b
+                CHECK(hipblasDscal(handle, n, sc + zero, x, 1));
+                CHECK(hipblasDcopy(handle, n, b, 1, r, 1));
+                CHECK(hipblasDcopy(handle, n, b, 1, p, 1));
+                CHECK(hipblasDdot(handle, n, r, 1, r, 1, sc + rr));
+            }
+
+            // q = A p, alpha = rr / (p, q)
+            CHECK(hipblasDgemv(
+                handle, HIPBLAS_OP_N, n, n, sc + one, A, n, p, 1, sc + zero, q, 1));
+            CHECK(hipblasDdot(handle, n, p, 1, q, 1, sc + pq));
+            if(device_mode)
+            {
+                CHECK(hipblasDcopy(handle, 1, s + rr, 1, s + alpha, 1));
+                CHECK(hipblasDtrsv(handle,
+                                   HIPBLAS_FILL_MODE_UPPER,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_DIAG_NON_UNIT,
+                                   1,
+                                   s + pq,
+                                   1,
+                                   s + alpha,
+                                   1));
+                CHECK(hipblasDcopy(handle, 1, s + alpha, 1, s + neg_alpha, 1));
+                CHECK(hipblasDscal(handle, 1, s + minus_one, s + neg_alpha, 1));
+            }
+            else
+            {
+                hs[alpha]     = hs[rr] / hs[pq];
+                hs[neg_alpha] = -hs[alpha];
+            }
+
+            // x += alpha p, r -= alpha q, beta = (r, r) / rr
+            CHECK(hipblasDaxpy(handle, n, sc + alpha, p, 1, x, 1));
+            CHECK(hipblasDaxpy(handle, n, sc + neg_alpha, q, 1, r, 1));
+            CHECK(hipblasDdot(handle, n, r, 1, r, 1, sc + rr_new));
+            if(device_mode)
+            {
+                CHECK(hipblasDcopy(handle, 1, s + rr_new, 1, s + beta, 1));
+                CHECK(hipblasDtrsv(handle,
+                                   HIPBLAS_FILL_MODE_UPPER,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_DIAG_NON_UNIT,
+                                   1,
+                                   s + rr,
+                                   1,
+                                   s + beta,
+                                   1));
+                CHECK(hipblasDcopy(handle, 1, s + rr_new, 1, s + rr, 1));
+            }
+            else
+            {
+                hs[beta] = hs[rr_new] / hs[rr];
+                hs[rr]   = hs[rr_new];
+            }
+
+            // p = r + beta p
+            CHECK(hipblasDscal(handle, n, sc + beta, p, 1));
+            CHECK(hipblasDaxpy(handle, n, sc + one, r, 1, p, 1));
+        };
+
+        composite_time time = time_iterations(stream, opt, step);
+
+        if(device_mode)
+            CHECK(hipMemcpy(&hs[rr], s + rr, sizeof(double), hipMemcpyDeviceToHost));
+        CHECK(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        // gemv, then 2 dots, 3 axpys and a scal
+        double flops = 2.0 * n * n + 11.0 * n;
+        print_result("cg",
+                     "n,restart,pointer_mode",
+                     std::to_string(n) + "," + std::to_string(opt.restart) + ","
+                         + opt.pointer_mode + "," + std::to_string(opt.iters),
+                     flops,
+                     time,
+                     std::sqrt(hs[rr]));
+    }
+
+    // Right-looking blocked LU without pivoting of a diagonally dominant n x n matrix: getrf of
+    // the nb x nb diagonal block, trsm of the blocks of L below it and of U right of it, then a
+    // gemm updating the trailing matrix. Each iteration factors a fresh copy of the matrix.
+    void run_lu(hipblasHandle_t handle, hipStream_t stream, const composite_options& opt)
+    {
+        const int           n = opt.n, nb = std::max(1, std::min(opt.nb, opt.n));
+        std::vector<double> hA(size_t(n) * n);
+        std::mt19937        gen(1);
+        std::uniform_real_distribution<double> dist(-1, 1);
+        for(size_t i = 0; i < hA.size(); i++)
+            hA[i] = i % (size_t(n) + 1) == 0 ? n : dist(gen);
+
+        device_buffer<double> A0(hA.size(), hA), A(hA.size());
+        device_buffer<int>    info(1);
+        const double          one = 1.0, minus_one = -1.0, zero = 0.0;
+
+        CHECK(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        // The copy of the matrix is not part of the factorization, so each iteration is timed
+        // between its own events
+        hipEvent_t start, stop;
+        CHECK(hipEventCreate(&start));
+        CHECK(hipEventCreate(&stop));
+        double total_us = 0, enqueue_us = 0;
+
+        for(int iteration = 0; iteration < opt.cold_iters + opt.iters; iteration++)
+        {
+            CHECK(hipMemcpyAsync(
+                A, A0, hA.size() * sizeof(double), hipMemcpyDeviceToDevice, stream));
+
+            auto host_start = std::chrono::steady_clock::now();
+            CHECK(hipEventRecord(start, stream));
+            for(int k = 0; k < n; k += nb)
+            {
+                int     kb   = std::min(nb, n - k);
+                int     rest = n - k - kb;
+                double* Akk  = A + k + size_t(k) * n;
+
+                CHECK(hipblasDgetrf(handle, kb, Akk, n, nullptr, info));
+                if(!rest)
+                    break;
+
+                double* L21 = Akk + kb;
+                double* U12 = Akk + size_t(kb) * n;
+                CHECK(hipblasDtrsm(handle,
+                                   HIPBLAS_SIDE_RIGHT,
+                                   HIPBLAS_FILL_MODE_UPPER,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_DIAG_NON_UNIT,
+                                   rest,
+                                   kb,
+                                   &one,
+                                   Akk,
+                                   n,
+                                   L21,
+                                   n));
+                CHECK(hipblasDtrsm(handle,
+                                   HIPBLAS_SIDE_LEFT,
+                                   HIPBLAS_FILL_MODE_LOWER,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_DIAG_UNIT,
+                                   kb,
+                                   rest,
+                                   &one,
+                                   Akk,
+                                   n,
+                                   U12,
+                                   n));
+                CHECK(hipblasDgemm(handle,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   rest,
+                                   rest,
+                                   kb,
+                                   &minus_one,
+                                   L21,
+                                   n,
+                                   U12,
+                                   n,
+                                   &one,
+                                   U12 + kb,
+                                   n));
+            }
+            CHECK(hipEventRecord(stop, stream));
+            auto host_stop = std::chrono::steady_clock::now();
+            CHECK(hipEventSynchronize(stop));
+
+            if(iteration >= opt.cold_iters)
+            {
+                float ms = 0;
+                CHECK(hipEventElapsedTime(&ms, start, stop));
+                total_us += 1000.0 * ms;
+                enqueue_us
+                    += std::chrono::duration<double, std::micro>(host_stop - host_start).count();
+            }
+        }
+        (void)hipEventDestroy(start);
+        (void)hipEventDestroy(stop);
+
+        // || L U v - A v || / || A v || for a random v
+        std::vector<double> hv(n);
+        for(auto& value : hv)
+            value = dist(gen);
+        device_buffer<double> v(n, hv), y(n);
+        double                residual = 0, norm = 0;
+        CHECK(hipblasDgemv(handle, HIPBLAS_OP_N, n, n, &one, A0, n, v, 1, &zero, y, 1));
+        CHECK(hipblasDtrmv(
+            handle, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_OP_N, HIPBLAS_DIAG_NON_UNIT, n, A, n, v, 1));
+        CHECK(hipblasDtrmv(
+            handle, HIPBLAS_FILL_MODE_LOWER, HIPBLAS_OP_N, HIPBLAS_DIAG_UNIT, n, A, n, v, 1));
+        CHECK(hipblasDaxpy(handle, n, &minus_one, y, 1, v, 1));
+        CHECK(hipblasDnrm2(handle, n, v, 1, &residual));
+        CHECK(hipblasDnrm2(handle, n, y, 1, &norm));
+
+        composite_time time{total_us / opt.iters, enqueue_us / opt.iters};
+        print_result("lu",
+                     "n,nb",
+                     std::to_string(n) + "," + std::to_string(nb) + ","
+                         + std::to_string(opt.iters),
+                     2.0 / 3.0 * double(n) * n * n,
+                     time,
+                     residual / norm);
+    }
+
+    // The GEMMs of a transformer layer in fp16 with fp32 accumulation on batch sequences of seq
+    // tokens: the QKV projection, the scores K^T Q and the context V S of each sequence and head
+    // with GemmBatchedEx, the output projection and the two GEMMs of the feed-forward network.
+    // Softmax, normalization and activation are not BLAS and are left out.
+    void run_transformer(hipblasHandle_t handle, hipStream_t stream, const composite_options& opt)
+    {
+        const int d = opt.hidden, h = opt.heads, hd = d / opt.heads, seq = opt.seq;
+        const int tokens = opt.batch * opt.seq, bh = opt.batch * opt.heads;
+        if(hd * h != d)
+            throw std::invalid_argument("--hidden must be a multiple of --heads");
+
+        std::mt19937                          gen(1);
+        std::uniform_real_distribution<float> dist(-0.125f, 0.125f);
+        auto                                  random = [&](size_t count) {
+            std::vector<hipblasHalf> values(count);
+            for(auto& value : values)
+                value = hipblasHalf(dist(gen));
+            return values;
+        };
+
+        device_buffer<hipblasHalf> X(size_t(d) * tokens, random(size_t(d) * tokens));
+        device_buffer<hipblasHalf> Wqkv(size_t(3) * d * d, random(size_t(3) * d * d));
+        device_buffer<hipblasHalf> Wo(size_t(d) * d, random(size_t(d) * d));
+        device_buffer<hipblasHalf> W1(size_t(4) * d * d, random(size_t(4) * d * d));
+        device_buffer<hipblasHalf> W2(size_t(4) * d * d, random(size_t(4) * d * d));
+        device_buffer<hipblasHalf> QKV(size_t(3) * d * tokens), S(size_t(seq) * seq * bh),
+            O(size_t(d) * tokens), Y(size_t(d) * tokens), H(size_t(4) * d * tokens),
+            Z(size_t(d) * tokens);
+
+        // Pointers of the matrices of each sequence and head
+        std::vector<const void*> hQ(bh), hK(bh), hV(bh), hS(bh);
+        std::vector<void*>       hSout(bh), hO(bh);
+        for(int b = 0; b < opt.batch; b++)
+            for(int head = 0; head < h; head++)
+            {
+                int          i   = b * h + head;
+                hipblasHalf* qkv = QKV + size_t(head) * hd + size_t(b) * seq * 3 * d;
+                hQ[i]            = qkv;
+                hK[i]            = qkv + d;
+                hV[i]            = qkv + 2 * d;
+                hS[i] = hSout[i] = S + size_t(i) * seq * seq;
+                hO[i]            = O + size_t(head) * hd + size_t(b) * seq * d;
+            }
+        device_buffer<const void*> dQ(bh, hQ), dK(bh, hK), dV(bh, hV), dS(bh, hS);
+        device_buffer<void*>       dSout(bh, hSout), dO(bh, hO);
+
+        const float one = 1.0f, zero = 0.0f, scale = 1.0f / std::sqrt(float(hd));
+        CHECK(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        // C (m x n) = alpha op(A) B
+        auto gemm = [&](hipblasOperation_t transA,
+                        int                m,
+                        int                n,
+                        int                k,
+                        const void*        A,
+                        int                lda,
+                        const void*        B,
+                        int                ldb,
+                        void*              C,
+                        int                ldc) {
+            CHECK(hipblasGemmEx(handle,
+                                transA,
+                                HIPBLAS_OP_N,
+                                m,
+                                n,
+                                k,
+                                &one,
+                                A,
+                                HIP_R_16F,
+                                lda,
+                                B,
+                                HIP_R_16F,
+                                ldb,
+                                &zero,
+                                C,
+                                HIP_R_16F,
+                                ldc,
+                                HIPBLAS_COMPUTE_32F,
+                                HIPBLAS_GEMM_DEFAULT));
+        };
+
+        auto step = [&](int) {
+            gemm(HIPBLAS_OP_N, 3 * d, tokens, d, Wqkv, 3 * d, X, d, QKV, 3 * d);
+            CHECK(hipblasGemmBatchedEx(handle,
+                                       HIPBLAS_OP_T,
+                                       HIPBLAS_OP_N,
+                                       seq,
+                                       seq,
+                                       hd,
+                                       &scale,
+                                       dK,
+                                       HIP_R_16F,
+                                       3 * d,
+                                       dQ,
+                                       HIP_R_16F,
+                                       3 * d,
+                                       &zero,
+                                       dSout,
+                                       HIP_R_16F,
+                                       seq,
+                                       bh,
+                                       HIPBLAS_COMPUTE_32F,
+                                       HIPBLAS_GEMM_DEFAULT));
+            CHECK(hipblasGemmBatchedEx(handle,
+                                       HIPBLAS_OP_N,
+                                       HIPBLAS_OP_N,
+                                       hd,
+                                       seq,
+                                       seq,
+                                       &one,
+                                       dV,
+                                       HIP_R_16F,
+                                       3 * d,
+                                       dS,
+                                       HIP_R_16F,
+                                       seq,
+                                       &zero,
+                                       dO,
+                                       HIP_R_16F,
+                                       d,
+                                       bh,
+                                       HIPBLAS_COMPUTE_32F,
+                                       HIPBLAS_GEMM_DEFAULT));
+            gemm(HIPBLAS_OP_N, d, tokens, d, Wo, d, O, d, Y, d);
+            gemm(HIPBLAS_OP_N, 4 * d, tokens, d, W1, 4 * d, Y, d, H, 4 * d);
+            gemm(HIPBLAS_OP_N, d, tokens, 4 * d, W2, d, H, 4 * d, Z, d);
+        };
+
+        composite_time time = time_iterations(stream, opt, step);
+
+        // First output element, which is finite unless a GEMM overflowed
+        hipblasHalf first;
+        CHECK(hipMemcpy(&first, Z, sizeof(first), hipMemcpyDeviceToHost));
+
+        // QKV, output and feed-forward projections, then scores and context
+        double flops = 2.0 * tokens * d * d * (3 + 1 + 4 + 4) + 4.0 * bh * seq * seq * hd;
+        print_result("transformer",
+                     "batch,seq,hidden,heads",
+                     std::to_string(opt.batch) + "," + std::to_string(seq) + ","
+                         + std::to_string(d) + "," + std::to_string(h) + ","
+                         + std::to_string(opt.iters),
+                     flops,
+                     time,
+                     float(first));
+    }
+}
+
+int main(int argc, char* argv[])
+try
+{
+    composite_options opt;
+    std::string       workload;
+    int               device_id;
+
+    options_description desc("hipblas-composite-bench command line options");
+    desc.add_options()
+        // clang-format off
+        ("workload,w",
+         value<std::string>(&workload)->default_value("all"),
+         "cg, lu, transformer or all")
+
+        ("sizen,n",
+         value<int>(&opt.n)->default_value(4096),
+         "Order of the matrix of cg and lu")
+
+        ("nb",
+         value<int>(&opt.nb)->default_value(256),
+         "Block size of lu")
+
+        ("restart",
+         value<int>(&opt.restart)->default_value(20),
+         "Number of cg iterations before cg restarts from x = 0")
+
+        ("pointer_mode",
+         value<std::string>(&opt.pointer_mode)->default_value("device"),
+         "Where the scalars of cg live: device, so the steps never wait for the host, or host, "
+         "so each dot product returns to the host")
+
+        ("batch",
+         value<int>(&opt.batch)->default_value(8),
+         "Number of sequences of transformer")
+
+        ("seq",
+         value<int>(&opt.seq)->default_value(512),
+         "Tokens per sequence of transformer")
+
+        ("hidden",
+         value<int>(&opt.hidden)->default_value(1024),
+         "Hidden size of transformer")
+
+        ("heads",
+         value<int>(&opt.heads)->default_value(16),
+         "Attention heads of transformer, dividing --hidden")
+
+        ("iters,i",
+         value<int>(&opt.iters)->default_value(20),
+         "Iterations timed. A cg iteration is one step of the solver")
+
+        ("cold_iters,j",
+         value<int>(&opt.cold_iters)->default_value(2),
+         "Iterations run before the timed ones")
+
+        ("device",
+         value<int>(&device_id)->default_value(0),
+         "Device to run on")
+
+        ("help,h", "produces this help message");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+    if(workload != "all" && workload != "cg" && workload != "lu" && workload != "transformer")
+        throw std::invalid_argument("Invalid value for --workload " + workload);
+    if(opt.pointer_mode != "device" && opt.pointer_mode != "host")
+        throw std::invalid_argument("Invalid value for --pointer_mode " + opt.pointer_mode);
+    if(opt.n < 1 || opt.iters < 1 || opt.cold_iters < 0 || opt.restart < 1 || opt.batch < 1
+       || opt.seq < 1 || opt.heads < 1 || opt.hidden < opt.heads)
+        throw std::invalid_argument("Invalid size or iteration count");
+
+    CHECK(hipSetDevice(device_id));
+
+    hipStream_t     stream;
+    hipblasHandle_t handle;
+    CHECK(hipStreamCreate(&stream));
+    CHECK(hipblasCreate(&handle));
+    CHECK(hipblasSetStream(handle, stream));
+
+    if(workload == "all" || workload == "cg")
+        run_cg(handle, stream, opt);
+    if(workload == "all" || workload == "lu")
+        run_lu(handle, stream, opt);
+    if(workload == "all" || workload == "transformer")
+        run_transformer(handle, stream, opt);
+
+    CHECK(hipblasDestroy(handle));
+    CHECK(hipStreamDestroy(stream));
+    return 0;
+}
+catch(const std::exception& e)
+{
+    std::cerr << "hipblas-composite-bench error: " << e.what() << std::endl;
+    return 1;
+}
@@ -21,6 +21,20 @@
  * ************************************************************************ */
 
 #include "argument_model.hpp"
+#include "hipblas_datatype2string.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#ifndef WIN32
+#include <dlfcn.h>
+#endif
 
 // this should have been a member variable but due to the complex variadic template this singleton allows global control
 
@@ -47,3 +61,501 @@ bool ArgumentModel_get_log_datatype()
 {
     return log_datatype;
 }
+
+static bool        log_name_once = false;
+static std::string last_name_line;
+
+void ArgumentModel_set_log_name_once(bool once)
+{
+    log_name_once = once;
+    last_name_line.clear();
+}
+
+bool ArgumentModel_log_name_line(const std::string& names)
+{
+    if(log_name_once && names == last_name_line)
+        return false;
+    last_name_line = names;
+    return true;
+}
+
+static thread_local std::string log_prefix_names;
+static thread_local std::string log_prefix_values;
+
+void ArgumentModel_set_log_prefix(const std::string& names, const std::string& values)
+{
+    log_prefix_names  = names;
+    log_prefix_values = values;
+}
+
+const std::string& ArgumentModel_get_log_prefix_names()
+{
+    return log_prefix_names;
+}
+
+const std::string& ArgumentModel_get_log_prefix_values()
+{
+    return log_prefix_values;
+}
+
+static thread_local double last_us = 0;
+
+void ArgumentModel_set_last_us(double us)
+{
+    last_us = us;
+}
+
+double ArgumentModel_get_last_us()
+{
+    return last_us;
+}
+
+static thread_local double last_gflop = 0;
+
+void ArgumentModel_set_last_gflop(double gflop)
+{
+    last_gflop = gflop;
+}
+
+double ArgumentModel_get_last_gflop()
+{
+    return last_gflop;
+}
+
+static thread_local bool log_quiet = false;
+
+void ArgumentModel_set_log_quiet(bool quiet)
+{
+    log_quiet = quiet;
+}
+
+bool ArgumentModel_get_log_quiet()
+{
+    return log_quiet;
+}
+
+// Structured output of --output, buffered until exit
+static std::string                                                     output_format;
+static std::ofstream                                                   output_file;
+static std::mutex                                                      output_mutex;
+static std::string                                                     output_buffer;
+static std::string                                                     output_header;
+static std::map<int, std::vector<std::pair<std::string, std::string>>> output_machine;
+
+// --output sqlite appends the records to the results table of a database, created if needed.
+// SQLite is loaded at run time, so hipblas-bench does not depend on it.
+struct hipblasSqlite
+{
+    typedef int (*open_t)(const char*, void**);
+    typedef int (*exec_t)(void*, const char*, void*, void*, char**);
+    typedef int (*prepare_t)(void*, const char*, int, void**, const char**);
+    typedef int (*bind_text_t)(void*, int, const char*, int, void (*)(void*));
+    typedef int (*stmt_t)(void*);
+    typedef const char* (*errmsg_t)(void*);
+
+    open_t      open      = nullptr;
+    exec_t      exec      = nullptr;
+    prepare_t   prepare   = nullptr;
+    bind_text_t bind_text = nullptr;
+    stmt_t      step      = nullptr;
+    stmt_t      reset     = nullptr;
+    stmt_t      finalize  = nullptr;
+    stmt_t      close     = nullptr;
+    errmsg_t    errmsg    = nullptr;
+
+    hipblasSqlite()
+    {
+#ifndef WIN32
+        void* lib = dlopen("libsqlite3.so.0", RTLD_NOW);
+        if(!lib)
+            return;
+        exec      = (exec_t)dlsym(lib, "sqlite3_exec");
+        prepare   = (prepare_t)dlsym(lib, "sqlite3_prepare_v2");
+        bind_text = (bind_text_t)dlsym(lib, "sqlite3_bind_text");
+        step      = (stmt_t)dlsym(lib, "sqlite3_step");
+        reset     = (stmt_t)dlsym(lib, "sqlite3_reset");
+        finalize  = (stmt_t)dlsym(lib, "sqlite3_finalize");
+        close     = (stmt_t)dlsym(lib, "sqlite3_close");
+        errmsg    = (errmsg_t)dlsym(lib, "sqlite3_errmsg");
+        if(exec && prepare && bind_text && step && reset && finalize && close && errmsg)
+            open = (open_t)dlsym(lib, "sqlite3_open");
+#endif
+    }
+};
+
+static const hipblasSqlite& hipblas_sqlite()
+{
+    static const hipblasSqlite sqlite;
+    return sqlite;
+}
+
+// Columns of the results table. The key columns identify the library, backend, device and
+// driver, args holds every argument of the test and machine and perf the other machine and the
+// performance fields, as JSON objects.
+static const char* output_sqlite_key[] = {"hipblas_version",
+                                          "backend",
+                                          "device_name",
+                                          "device_arch",
+                                          "driver_version",
+                                          "runtime_version"};
+
+static const char output_sqlite_schema[]
+    = "CREATE TABLE IF NOT EXISTS results(id INTEGER PRIMARY KEY, "
+      "recorded_at TEXT NOT NULL DEFAULT CURRENT_TIMESTAMP, hipblas_version TEXT, backend TEXT, "
+      "device_name TEXT, device_arch TEXT, driver_version TEXT, runtime_version TEXT, "
+      "function TEXT, args TEXT, machine TEXT, perf TEXT);"
+      "CREATE INDEX IF NOT EXISTS results_case ON results(function, device_arch, backend, "
+      "hipblas_version);";
+
+static const char output_sqlite_insert[]
+    = "INSERT INTO results(hipblas_version, backend, device_name, device_arch, driver_version, "
+      "runtime_version, function, args, machine, perf) VALUES(?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+
+static const size_t output_sqlite_columns = std::size(output_sqlite_key) + 4;
+
+static std::string                           output_sqlite_path;
+static std::vector<std::vector<std::string>> output_sqlite_rows;
+
+// Appends the buffered rows in one transaction. output_mutex is held.
+static void output_sqlite_flush()
+{
+    if(output_sqlite_rows.empty())
+        return;
+
+    const hipblasSqlite& sqlite = hipblas_sqlite();
+    void*                db     = nullptr;
+    void*                insert = nullptr;
+    if(!sqlite.open || sqlite.open(output_sqlite_path.c_str(), &db)
+       || sqlite.exec(db, output_sqlite_schema, nullptr, nullptr, nullptr)
+       || sqlite.exec(db, "BEGIN;", nullptr, nullptr, nullptr)
+       || sqlite.prepare(db, output_sqlite_insert, -1, &insert, nullptr))
+    {
+        std::cerr << "hipblas-bench: cannot write --output sqlite to " << output_sqlite_path << ": "
+                  << (db ? sqlite.errmsg(db) : "libsqlite3.so.0 not found") << std::endl;
+        if(db)
+            sqlite.close(db);
+        output_sqlite_rows.clear();
+        return;
+    }
+
+    // SQLITE_TRANSIENT, so SQLite copies the text, and SQLITE_DONE
+    auto transient = (void (*)(void*))(intptr_t)-1;
+    for(const auto& row : output_sqlite_rows)
+    {
+        for(size_t i = 0; i < row.size(); i++)
+            sqlite.bind_text(insert, int(i + 1), row[i].c_str(), -1, transient);
+        if(sqlite.step(insert) != 101)
+            std::cerr << "hipblas-bench: --output sqlite: " << sqlite.errmsg(db) << std::endl;
+        sqlite.reset(insert);
+    }
+    sqlite.finalize(insert);
+    sqlite.exec(db, "COMMIT;", nullptr, nullptr, nullptr);
+    sqlite.close(db);
+    output_sqlite_rows.clear();
+}
+
+void ArgumentModel_set_output(const std::string& format, const std::string& file)
+{
+    if(format != "" && format != "csv" && format != "json" && format != "sqlite")
+        throw std::invalid_argument("Invalid value for --output: " + format);
+
+    std::lock_guard<std::mutex> lock(output_mutex);
+    output_format = format.empty() && !file.empty() ? "csv" : format;
+    if(output_format == "sqlite")
+    {
+        if(file.empty())
+            throw std::invalid_argument("--output sqlite needs the database in --output_file");
+        if(!hipblas_sqlite().open)
+            throw std::invalid_argument("--output sqlite needs libsqlite3.so.0");
+        output_sqlite_path = file;
+    }
+    else if(!file.empty())
+    {
+        output_file.open(file, std::ios::trunc);
+        if(!output_file)
+            throw std::invalid_argument("Cannot open --output_file " + file);
+    }
+    if(!output_format.empty())
+        std::atexit(ArgumentModel_flush_output);
+}
+
+bool ArgumentModel_get_output()
+{
+    return !output_format.empty();
+}
+
+bool ArgumentModel_get_output_to_stdout()
+{
+    return !output_format.empty() && output_format != "sqlite" && !output_file.is_open();
+}
+
+void ArgumentModel_flush_output()
+{
+    std::lock_guard<std::mutex> lock(output_mutex);
+    if(output_format == "sqlite")
+    {
+        output_sqlite_flush();
+        return;
+    }
+    std::ostream& os = output_file.is_open() ? output_file : std::cout;
+    os << output_buffer << std::flush;
+    output_buffer.clear();
+}
+
+// Device, driver and library of the records of the current device
+static const std::vector<std::pair<std::string, std::string>>& output_machine_spec()
+{
+    int device = 0;
+    (void)hipGetDevice(&device);
+
+    auto& spec = output_machine[device];
+    if(!spec.empty())
+        return spec;
+
+    hipDeviceProp_t props{};
+    int             driver = 0, runtime = 0;
+    (void)hipGetDeviceProperties(&props, device);
+    (void)hipDriverGetVersion(&driver);
+    (void)hipRuntimeGetVersion(&runtime);
+
+    std::ostringstream hipblas_version;
+    hipblas_version << hipblasVersionMajor << "." << hipblasVersionMinor << "."
+                    << hipblasVersionPatch << "." << hipblasVersionTweak;
+
+    spec = {{"device", std::to_string(device)},
+            {"device_name", props.name},
+            {"device_arch", hipblas_device_arch(props)},
+            {"compute_units", std::to_string(props.multiProcessorCount)},
+            {"clock_mhz", std::to_string(props.clockRate / 1000)},
+            {"memory_clock_mhz", std::to_string(props.memoryClockRate / 1000)},
+            {"memory_bus_width", std::to_string(props.memoryBusWidth)},
+            {"driver_version", std::to_string(driver)},
+            {"runtime_version", std::to_string(runtime)},
+            {"hipblas_version", hipblas_version.str()},
+#ifdef __HIP_PLATFORM_NVCC__
+            {"backend", "cuBLAS"}};
+#else
+            {"backend", "rocBLAS"}};
+#endif
+    return spec;
+}
+
+template <typename T>
+static std::string output_value(const T& value)
+{
+    std::ostringstream os;
+    if constexpr(std::is_same_v<T, hipblasDatatype_t>)
+        os << hipblas_datatype2string(value);
+    else if constexpr(std::is_same_v<T, hipblasComputeType_t>)
+        os << hipblas_computetype2string(value);
+    else
+        os << value;
+    return os.str();
+}
+
+// Splits a list of log_perf, where values are separated by ", "
+static std::vector<std::string> output_split(const std::string& list)
+{
+    std::vector<std::string> items;
+    std::istringstream       is(list);
+    std::string              item;
+    while(std::getline(is, item, ','))
+    {
+        item.erase(0, item.find_first_not_of(' '));
+        if(!item.empty())
+            items.push_back(item);
+    }
+    return items;
+}
+
+static std::string output_json_value(const std::string& value)
+{
+    char*  end;
+    double number = std::strtod(value.c_str(), &end);
+    if(!value.empty() && !*end && std::isfinite(number))
+        return value;
+
+    std::string quoted = "\"";
+    for(char c : value)
+    {
+        if(c == '"' || c == '\\')
+            quoted += '\\';
+        if(c >= 0 && c < ' ')
+            continue;
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+static std::string output_csv_value(const std::string& value)
+{
+    if(value.find_first_of(",\"\n") == std::string::npos)
+        return value;
+
+    std::string quoted = "\"";
+    for(char c : value)
+        quoted += c == '"' ? std::string("\"\"") : std::string(1, c);
+    return quoted + "\"";
+}
+
+void ArgumentModel_log_record(const Arguments&   arg,
+                              const std::string& perf_names,
+                              const std::string& perf_values)
+{
+    std::lock_guard<std::mutex> lock(output_mutex);
+
+    std::vector<std::pair<std::string, std::string>> fields = output_machine_spec();
+
+#define OUTPUT_FIELD(NAME) fields.emplace_back(#NAME, output_value(arg.NAME))
+    FOR_EACH_ARGUMENT(OUTPUT_FIELD, ;);
+#undef OUTPUT_FIELD
+
+    std::vector<std::string> names  = output_split(perf_names);
+    std::vector<std::string> values = output_split(perf_values);
+    for(size_t i = 0; i < names.size() && i < values.size(); i++)
+        fields.emplace_back(names[i], values[i]);
+
+    std::string record;
+    if(output_format == "sqlite")
+    {
+        // The key columns, then function and the JSON objects of args, machine and perf
+        const size_t             keys = std::size(output_sqlite_key);
+        std::vector<std::string> row(output_sqlite_columns);
+        std::string              objects[3];
+        const size_t             perf_count  = std::min(names.size(), values.size());
+        const size_t             machine_end = output_machine_spec().size();
+        const size_t             args_end    = fields.size() - perf_count;
+        for(size_t i = 0; i < fields.size(); i++)
+        {
+            const auto& field = fields[i];
+            auto key = std::find(std::begin(output_sqlite_key), std::end(output_sqlite_key),
+                                 field.first);
+            if(i < machine_end && key != std::end(output_sqlite_key))
+            {
+                row[key - std::begin(output_sqlite_key)] = field.second;
+                continue;
+            }
+            if(i >= machine_end && i < args_end && field.first == "function")
+                row[keys] = field.second;
+
+            std::string& object = objects[i < machine_end ? 1 : i < args_end ? 0 : 2];
+            object += (object.empty() ? "{" : ", ") + output_json_value(field.first) + ": "
+                      + output_json_value(field.second);
+        }
+        for(size_t i = 0; i < 3; i++)
+            row[keys + 1 + i] = objects[i].empty() ? "{}" : objects[i] + "}";
+
+        output_sqlite_rows.push_back(std::move(row));
+        if(output_sqlite_rows.size() >= 4096)
+            output_sqlite_flush();
+        return;
+    }
+    else if(output_format == "json")
+    {
+        // One object per line
+        for(const auto& field : fields)
+            record += (record.empty() ? "{" : ", ") + output_json_value(field.first) + ": "
+                      + output_json_value(field.second);
+        record += "}\n";
+    }
+    else
+    {
+        // The header again when the columns change
+        std::string header;
+        for(size_t i = 0; i < fields.size(); i++)
+        {
+            header += (i ? "," : "") + output_csv_value(fields[i].first);
+            record += (i ? "," : "") + output_csv_value(fields[i].second);
+        }
+        if(header != output_header)
+            record = header + "\n" + record;
+        output_header = header;
+        record += "\n";
+    }
+
+    output_buffer += record;
+    if(output_buffer.size() > (1 << 20))
+    {
+        std::ostream& os = output_file.is_open() ? output_file : std::cout;
+        os << output_buffer;
+        output_buffer.clear();
+    }
+}
+
+// Latency histograms of --histogram, one JSON object per line, written as each test ends
+static std::ofstream histogram_file;
+
+void ArgumentModel_set_histogram(const std::string& file)
+{
+    std::lock_guard<std::mutex> lock(output_mutex);
+    if(histogram_file.is_open())
+        histogram_file.close();
+    if(file.empty())
+        return;
+    histogram_file.open(file, std::ios::trunc);
+    if(!histogram_file)
+        throw std::invalid_argument("Cannot open --histogram " + file);
+}
+
+bool ArgumentModel_get_histogram()
+{
+    return histogram_file.is_open();
+}
+
+// Bucket of a time: the power of two of its ns, split into histogram_sub_buckets equal parts, so
+// every bucket is at most 1 / histogram_sub_buckets of its lower bound wide, as in HdrHistogram
+static constexpr int histogram_sub_buckets = 16;
+
+static std::pair<double, double> histogram_bucket(double us)
+{
+    double ns    = std::max(us * 1000, 1.0);
+    double low   = std::exp2(std::floor(std::log2(ns)));
+    double width = low / histogram_sub_buckets;
+    double start = low + std::floor((ns - low) / width) * width;
+    return {start / 1000, (start + width) / 1000};
+}
+
+void ArgumentModel_log_histogram(const Arguments&           arg,
+                                 const std::string&         perf_names,
+                                 const std::string&         perf_values,
+                                 const std::vector<double>& sorted_us)
+{
+    std::lock_guard<std::mutex> lock(output_mutex);
+    if(!histogram_file.is_open() || sorted_us.empty())
+        return;
+
+    std::vector<std::pair<std::string, std::string>> fields = output_machine_spec();
+
+#define OUTPUT_FIELD(NAME) fields.emplace_back(#NAME, output_value(arg.NAME))
+    FOR_EACH_ARGUMENT(OUTPUT_FIELD, ;);
+#undef OUTPUT_FIELD
+
+    std::vector<std::string> names  = output_split(perf_names);
+    std::vector<std::string> values = output_split(perf_values);
+    for(size_t i = 0; i < names.size() && i < values.size(); i++)
+        fields.emplace_back(names[i], values[i]);
+
+    std::string record;
+    for(const auto& field : fields)
+        record += (record.empty() ? "{" : ", ") + output_json_value(field.first) + ": "
+                  + output_json_value(field.second);
+
+    // Buckets in increasing order as [low_us, high_us, count], empty ones left out
+    std::ostringstream buckets;
+    buckets.precision(10);
+    size_t count = 0;
+    for(size_t i = 0; i < sorted_us.size(); i++)
+    {
+        auto bucket = histogram_bucket(sorted_us[i]);
+        count++;
+        if(i + 1 < sorted_us.size() && histogram_bucket(sorted_us[i + 1]) == bucket)
+            continue;
+        buckets << (buckets.tellp() ? ", [" : "[") << bucket.first << ", " << bucket.second << ", "
+                << count << "]";
+        count = 0;
+    }
+
+    histogram_file << record << ", \"histogram_unit\": \"us\", \"histogram_count\": "
+                   << sorted_us.size() << ", \"histogram\": [" << buckets.str() << "]}"
+                   << std::endl;
+}
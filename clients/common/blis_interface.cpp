@@ -24,11 +24,19 @@
 #include "blis.h"
 #include "omp.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
 void setup_blis()
 {
 #ifndef WIN32
     bli_init();
 #endif
+    // Run the reference BLAS and the LAPACK routines built on it on all cores, unless the
+    // thread count is given with BLIS_NUM_THREADS
+    if(!std::getenv("BLIS_NUM_THREADS"))
+        bli_thread_set_num_threads(std::max(1u, std::thread::hardware_concurrency()));
 }
 
 static int initialize_blis = (setup_blis(), 0);
@@ -72,6 +72,48 @@ void zgetrs_(char*                 trans,
              int*                  ldb,
              int*                  info);
 
+void sgecon_(char*  norm,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* anorm,
+             float* rcond,
+             float* work,
+             int*   iwork,
+             int*   info);
+void dgecon_(char*   norm,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* anorm,
+             double* rcond,
+             double* work,
+             int*    iwork,
+             int*    info);
+void cgecon_(char*           norm,
+             int*            n,
+             hipblasComplex* A,
+             int*            lda,
+             float*          anorm,
+             float*          rcond,
+             hipblasComplex* work,
+             float*          rwork,
+             int*            info);
+void zgecon_(char*                 norm,
+             int*                  n,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             double*               anorm,
+             double*               rcond,
+             hipblasDoubleComplex* work,
+             double*               rwork,
+             int*                  info);
+
+float  slange_(char* norm, int* m, int* n, float* A, int* lda, float* work);
+double dlange_(char* norm, int* m, int* n, double* A, int* lda, double* work);
+float  clange_(char* norm, int* m, int* n, hipblasComplex* A, int* lda, float* work);
+double zlange_(char* norm, int* m, int* n, hipblasDoubleComplex* A, int* lda, double* work);
+
 void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
 void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
 void cgetri_(
@@ -153,6 +195,127 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipblasComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipblasDoubleComplex* A, int* lda, int* info);
 
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*           uplo,
+             int*            n,
+             int*            nrhs,
+             hipblasComplex* A,
+             int*            lda,
+             hipblasComplex* B,
+             int*            ldb,
+             int*            info);
+void zpotrs_(char*                 uplo,
+             int*                  n,
+             int*                  nrhs,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             hipblasDoubleComplex* B,
+             int*                  ldb,
+             int*                  info);
+
+void spotri_(char* uplo, int* n, float* A, int* lda, int* info);
+void dpotri_(char* uplo, int* n, double* A, int* lda, int* info);
+void cpotri_(char* uplo, int* n, hipblasComplex* A, int* lda, int* info);
+void zpotri_(char* uplo, int* n, hipblasDoubleComplex* A, int* lda, int* info);
+
+void ssyev_(char*  jobz,
+            char*  uplo,
+            int*   n,
+            float* A,
+            int*   lda,
+            float* W,
+            float* work,
+            int*   lwork,
+            int*   info);
+void dsyev_(char*   jobz,
+            char*   uplo,
+            int*    n,
+            double* A,
+            int*    lda,
+            double* W,
+            double* work,
+            int*    lwork,
+            int*    info);
+void cheev_(char*           jobz,
+            char*           uplo,
+            int*            n,
+            hipblasComplex* A,
+            int*            lda,
+            float*          W,
+            hipblasComplex* work,
+            int*            lwork,
+            float*          rwork,
+            int*            info);
+void zheev_(char*                 jobz,
+            char*                 uplo,
+            int*                  n,
+            hipblasDoubleComplex* A,
+            int*                  lda,
+            double*               W,
+            hipblasDoubleComplex* work,
+            int*                  lwork,
+            double*               rwork,
+            int*                  info);
+void sgesvd_(char*  jobu,
+             char*  jobvt,
+             int*   m,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* S,
+             float* U,
+             int*   ldu,
+             float* VT,
+             int*   ldvt,
+             float* work,
+             int*   lwork,
+             int*   info);
+void dgesvd_(char*   jobu,
+             char*   jobvt,
+             int*    m,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* S,
+             double* U,
+             int*    ldu,
+             double* VT,
+             int*    ldvt,
+             double* work,
+             int*    lwork,
+             int*    info);
+void cgesvd_(char*           jobu,
+             char*           jobvt,
+             int*            m,
+             int*            n,
+             hipblasComplex* A,
+             int*            lda,
+             float*          S,
+             hipblasComplex* U,
+             int*            ldu,
+             hipblasComplex* VT,
+             int*            ldvt,
+             hipblasComplex* work,
+             int*            lwork,
+             float*          rwork,
+             int*            info);
+void zgesvd_(char*                 jobu,
+             char*                 jobvt,
+             int*                  m,
+             int*                  n,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             double*               S,
+             hipblasDoubleComplex* U,
+             int*                  ldu,
+             hipblasDoubleComplex* VT,
+             int*                  ldvt,
+             hipblasDoubleComplex* work,
+             int*                  lwork,
+             double*               rwork,
+             int*                  info);
+
 void cspr_(
     char* uplo, int* n, hipblasComplex* alpha, hipblasComplex* x, int* incx, hipblasComplex* A);
 
@@ -1759,6 +1922,223 @@ int cblas_potrf(char uplo, int m, hipblasDoubleComplex* A, int lda)
     return info;
 }
 
+// potrs
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, float* A, int lda, float* B, int ldb)
+{
+    int info;
+    spotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, double* A, int lda, double* B, int ldb)
+{
+    int info;
+    dpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, hipblasComplex* A, int lda, hipblasComplex* B, int ldb)
+{
+    int info;
+    cpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(
+    char uplo, int n, int nrhs, hipblasDoubleComplex* A, int lda, hipblasDoubleComplex* B, int ldb)
+{
+    int info;
+    zpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+// potri
+template <>
+int cblas_potri(char uplo, int n, float* A, int lda)
+{
+    int info;
+    spotri_(&uplo, &n, A, &lda, &info);
+    return info;
+}
+
+template <>
+int cblas_potri(char uplo, int n, double* A, int lda)
+{
+    int info;
+    dpotri_(&uplo, &n, A, &lda, &info);
+    return info;
+}
+
+template <>
+int cblas_potri(char uplo, int n, hipblasComplex* A, int lda)
+{
+    int info;
+    cpotri_(&uplo, &n, A, &lda, &info);
+    return info;
+}
+
+template <>
+int cblas_potri(char uplo, int n, hipblasDoubleComplex* A, int lda)
+{
+    int info;
+    zpotri_(&uplo, &n, A, &lda, &info);
+    return info;
+}
+
+// syev and heev
+template <>
+int cblas_syev(char   jobz,
+               char   uplo,
+               int    n,
+               float* A,
+               int    lda,
+               float* W,
+               float* work,
+               int    lwork,
+               float* rwork)
+{
+    int info;
+    ssyev_(&jobz, &uplo, &n, A, &lda, W, work, &lwork, &info);
+    return info;
+}
+
+template <>
+int cblas_syev(char    jobz,
+               char    uplo,
+               int     n,
+               double* A,
+               int     lda,
+               double* W,
+               double* work,
+               int     lwork,
+               double* rwork)
+{
+    int info;
+    dsyev_(&jobz, &uplo, &n, A, &lda, W, work, &lwork, &info);
+    return info;
+}
+
+template <>
+int cblas_syev(char            jobz,
+               char            uplo,
+               int             n,
+               hipblasComplex* A,
+               int             lda,
+               float*          W,
+               hipblasComplex* work,
+               int             lwork,
+               float*          rwork)
+{
+    int info;
+    cheev_(&jobz, &uplo, &n, A, &lda, W, work, &lwork, rwork, &info);
+    return info;
+}
+
+template <>
+int cblas_syev(char                  jobz,
+               char                  uplo,
+               int                   n,
+               hipblasDoubleComplex* A,
+               int                   lda,
+               double*               W,
+               hipblasDoubleComplex* work,
+               int                   lwork,
+               double*               rwork)
+{
+    int info;
+    zheev_(&jobz, &uplo, &n, A, &lda, W, work, &lwork, rwork, &info);
+    return info;
+}
+
+// gesvd
+template <>
+int cblas_gesvd(char   jobu,
+                char   jobvt,
+                int    m,
+                int    n,
+                float* A,
+                int    lda,
+                float* S,
+                float* UU,
+                int    ldu,
+                float* VT,
+                int    ldvt,
+                float* work,
+                int    lwork,
+                float* rwork)
+{
+    int info;
+    sgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, UU, &ldu, VT, &ldvt, work, &lwork, &info);
+    return info;
+}
+
+template <>
+int cblas_gesvd(char    jobu,
+                char    jobvt,
+                int     m,
+                int     n,
+                double* A,
+                int     lda,
+                double* S,
+                double* UU,
+                int     ldu,
+                double* VT,
+                int     ldvt,
+                double* work,
+                int     lwork,
+                double* rwork)
+{
+    int info;
+    dgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, UU, &ldu, VT, &ldvt, work, &lwork, &info);
+    return info;
+}
+
+template <>
+int cblas_gesvd(char            jobu,
+                char            jobvt,
+                int             m,
+                int             n,
+                hipblasComplex* A,
+                int             lda,
+                float*          S,
+                hipblasComplex* UU,
+                int             ldu,
+                hipblasComplex* VT,
+                int             ldvt,
+                hipblasComplex* work,
+                int             lwork,
+                float*          rwork)
+{
+    int info;
+    cgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, UU, &ldu, VT, &ldvt, work, &lwork, rwork, &info);
+    return info;
+}
+
+template <>
+int cblas_gesvd(char                  jobu,
+                char                  jobvt,
+                int                   m,
+                int                   n,
+                hipblasDoubleComplex* A,
+                int                   lda,
+                double*               S,
+                hipblasDoubleComplex* UU,
+                int                   ldu,
+                hipblasDoubleComplex* VT,
+                int                   ldvt,
+                hipblasDoubleComplex* work,
+                int                   lwork,
+                double*               rwork)
+{
+    int info;
+    zgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, UU, &ldu, VT, &ldvt, work, &lwork, rwork, &info);
+    return info;
+}
+
 // tbmv
 template <>
 void cblas_tbmv<float>(hipblasFillMode_t  uplo,
@@ -3773,6 +4153,79 @@ int cblas_getrs<hipblasDoubleComplex>(char                  trans,
     return info;
 }
 
+// gecon
+template <>
+int cblas_gecon<float, float>(char norm, int n, float* A, int lda, float anorm, float* rcond)
+{
+    int                info;
+    std::vector<float> work(std::max(1, 4 * n));
+    std::vector<int>   iwork(std::max(1, n));
+    sgecon_(&norm, &n, A, &lda, &anorm, rcond, work.data(), iwork.data(), &info);
+    return info;
+}
+
+template <>
+int cblas_gecon<double, double>(char norm, int n, double* A, int lda, double anorm, double* rcond)
+{
+    int                 info;
+    std::vector<double> work(std::max(1, 4 * n));
+    std::vector<int>    iwork(std::max(1, n));
+    dgecon_(&norm, &n, A, &lda, &anorm, rcond, work.data(), iwork.data(), &info);
+    return info;
+}
+
+template <>
+int cblas_gecon<hipblasComplex, float>(
+    char norm, int n, hipblasComplex* A, int lda, float anorm, float* rcond)
+{
+    int                         info;
+    std::vector<hipblasComplex> work(std::max(1, 2 * n));
+    std::vector<float>          rwork(std::max(1, 2 * n));
+    cgecon_(&norm, &n, A, &lda, &anorm, rcond, work.data(), rwork.data(), &info);
+    return info;
+}
+
+template <>
+int cblas_gecon<hipblasDoubleComplex, double>(
+    char norm, int n, hipblasDoubleComplex* A, int lda, double anorm, double* rcond)
+{
+    int                               info;
+    std::vector<hipblasDoubleComplex> work(std::max(1, 2 * n));
+    std::vector<double>               rwork(std::max(1, 2 * n));
+    zgecon_(&norm, &n, A, &lda, &anorm, rcond, work.data(), rwork.data(), &info);
+    return info;
+}
+
+// lange
+template <>
+float cblas_lange<float, float>(char norm, int m, int n, float* A, int lda)
+{
+    std::vector<float> work(std::max(1, m));
+    return slange_(&norm, &m, &n, A, &lda, work.data());
+}
+
+template <>
+double cblas_lange<double, double>(char norm, int m, int n, double* A, int lda)
+{
+    std::vector<double> work(std::max(1, m));
+    return dlange_(&norm, &m, &n, A, &lda, work.data());
+}
+
+template <>
+float cblas_lange<hipblasComplex, float>(char norm, int m, int n, hipblasComplex* A, int lda)
+{
+    std::vector<float> work(std::max(1, m));
+    return clange_(&norm, &m, &n, A, &lda, work.data());
+}
+
+template <>
+double cblas_lange<hipblasDoubleComplex, double>(
+    char norm, int m, int n, hipblasDoubleComplex* A, int lda)
+{
+    std::vector<double> work(std::max(1, m));
+    return zlange_(&norm, &m, &n, A, &lda, work.data());
+}
+
 // getri
 template <>
 int cblas_getri<float>(int n, float* A, int lda, int* ipiv, float* work, int lwork)
@@ -43,8 +43,12 @@
 #include <string>
 #include <type_traits>
 // aux
+#include "testing_gemm_ex_frontier.hpp"
+#include "testing_host_overhead.hpp"
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
+#include "testing_set_get_matrix_batched_async.hpp"
+#include "testing_set_get_matrix_strided_batched_async.hpp"
 #include "testing_set_get_vector.hpp"
 #include "testing_set_get_vector_async.hpp"
 // blas1
@@ -178,6 +182,7 @@
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_grouped_batched_ex.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
 #include "testing_hemm.hpp"
@@ -227,6 +232,13 @@
 #include "testing_geqrf.hpp"
 #include "testing_geqrf_batched.hpp"
 #include "testing_geqrf_strided_batched.hpp"
+#include "testing_geqrs_batched.hpp"
+#include "testing_geqrs_strided_batched.hpp"
+#include "testing_gesv_batched.hpp"
+#include "testing_gesv_ir.hpp"
+#include "testing_gesv_ir_batched.hpp"
+#include "testing_gesv_ir_strided_batched.hpp"
+#include "testing_gesv_strided_batched.hpp"
 #include "testing_getrf.hpp"
 #include "testing_getrf_batched.hpp"
 #include "testing_getrf_npvt.hpp"
@@ -235,9 +247,23 @@
 #include "testing_getrf_strided_batched.hpp"
 #include "testing_getri_batched.hpp"
 #include "testing_getri_npvt_batched.hpp"
+#include "testing_getri_strided_batched.hpp"
 #include "testing_getrs.hpp"
 #include "testing_getrs_batched.hpp"
 #include "testing_getrs_strided_batched.hpp"
+#include "testing_potrf.hpp"
+#include "testing_potrf_batched.hpp"
+#include "testing_potrf_strided_batched.hpp"
+#include "testing_potri.hpp"
+#include "testing_potri_batched.hpp"
+#include "testing_potri_strided_batched.hpp"
+#include "testing_potrs.hpp"
+#include "testing_potrs_batched.hpp"
+#include "testing_potrs_strided_batched.hpp"
+#include "testing_syevj_batched.hpp"
+#include "testing_syevj_strided_batched.hpp"
+#include "testing_gesvdj_batched.hpp"
+#include "testing_gesvdj_strided_batched.hpp"
 #endif
 
 #include "utility.h"
@@ -422,6 +448,7 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gemm_strided_batched", testname_gemm_strided_batched},
         {"gemm_ex", testname_gemm_ex},
         {"gemm_batched_ex", testname_gemm_batched_ex},
+        {"gemm_grouped_batched_ex", testname_gemm_grouped_batched_ex},
         {"gemm_strided_batched_ex", testname_gemm_strided_batched_ex},
         {"hemm", testname_hemm},
         {"hemm_batched", testname_hemm_batched},
@@ -472,12 +499,33 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"getrf_npvt_strided_batched", testname_getrf_npvt_strided_batched},
         {"getri_batched", testname_getri_batched},
         {"getri_npvt_batched", testname_getri_npvt_batched},
+        {"getri_strided_batched", testname_getri_strided_batched},
         {"getrs", testname_getrs},
         {"getrs_batched", testname_getrs_batched},
         {"getrs_strided_batched", testname_getrs_strided_batched},
         {"gels", testname_gels},
         {"gels_batched", testname_gels_batched},
         {"gels_strided_batched", testname_gels_strided_batched},
+        {"geqrs_batched", testname_geqrs_batched},
+        {"geqrs_strided_batched", testname_geqrs_strided_batched},
+        {"gesv_batched", testname_gesv_batched},
+        {"gesv_strided_batched", testname_gesv_strided_batched},
+        {"gesv_ir", testname_gesv_ir},
+        {"gesv_ir_batched", testname_gesv_ir_batched},
+        {"gesv_ir_strided_batched", testname_gesv_ir_strided_batched},
+        {"potrf", testname_potrf},
+        {"potrf_batched", testname_potrf_batched},
+        {"potrf_strided_batched", testname_potrf_strided_batched},
+        {"potrs", testname_potrs},
+        {"potrs_batched", testname_potrs_batched},
+        {"potrs_strided_batched", testname_potrs_strided_batched},
+        {"potri", testname_potri},
+        {"potri_batched", testname_potri_batched},
+        {"potri_strided_batched", testname_potri_strided_batched},
+        {"syevj_batched", testname_syevj_batched},
+        {"syevj_strided_batched", testname_syevj_strided_batched},
+        {"gesvdj_batched", testname_gesvdj_batched},
+        {"gesvdj_strided_batched", testname_gesvdj_strided_batched},
 #endif
 
         // Aux
@@ -485,6 +533,8 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"set_get_vector_async", testname_set_get_vector_async},
         {"set_get_matrix", testname_set_get_matrix},
         {"set_get_matrix_async", testname_set_get_matrix_async},
+        {"set_get_matrix_batched_async", testname_set_get_matrix_batched_async},
+        {"set_get_matrix_strided_batched_async", testname_set_get_matrix_strided_batched_async},
     };
 
     auto match = fmap.find(arg.function);
@@ -513,6 +563,7 @@ struct perf_gemm_ex<Ti,
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex_template<Ti, Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex_template<Ti, Ti, To, Tc>},
+            {"gemm_grouped_batched_ex", testing_gemm_grouped_batched_ex_template<Ti, Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -690,12 +741,30 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"getrf_npvt_strided_batched", testing_getrf_npvt_strided_batched<T>},
             {"getri_batched", testing_getri_batched<T>},
             {"getri_npvt_batched", testing_getri_npvt_batched<T>},
+            {"getri_strided_batched", testing_getri_strided_batched<T>},
             {"getrs", testing_getrs<T>},
             {"getrs_batched", testing_getrs_batched<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
+            {"geqrs_batched", testing_geqrs_batched<T>},
+            {"geqrs_strided_batched", testing_geqrs_strided_batched<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
+            {"potri", testing_potri<T>},
+            {"potri_batched", testing_potri_batched<T>},
+            {"potri_strided_batched", testing_potri_strided_batched<T>},
+            {"syevj_batched", testing_syevj_batched<T>},
+            {"syevj_strided_batched", testing_syevj_strided_batched<T>},
+            {"gesvdj_batched", testing_gesvdj_batched<T>},
+            {"gesvdj_strided_batched", testing_gesvdj_strided_batched<T>},
 #endif
 
             // Aux
@@ -703,6 +772,11 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"set_get_vector_async", testing_set_get_vector_async<T>},
             {"set_get_matrix", testing_set_get_matrix<T>},
             {"set_get_matrix_async", testing_set_get_matrix_async<T>},
+            {"set_get_matrix_batched_async", testing_set_get_matrix_batched_async<T>},
+            {"set_get_matrix_strided_batched_async",
+             testing_set_get_matrix_strided_batched_async<T>},
+            {"host_overhead", testing_host_overhead<T>},
+            {"gemm_ex_frontier", testing_gemm_ex_frontier<T>},
         };
         run_function(fmap, arg);
     }
@@ -912,18 +986,61 @@ struct perf_blas<
             {"getrf_npvt_strided_batched", testing_getrf_npvt_strided_batched<T>},
             {"getri_batched", testing_getri_batched<T>},
             {"getri_npvt_batched", testing_getri_npvt_batched<T>},
+            {"getri_strided_batched", testing_getri_strided_batched<T>},
             {"getrs", testing_getrs<T>},
             {"getrs_batched", testing_getrs_batched<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
+            {"geqrs_batched", testing_geqrs_batched<T>},
+            {"geqrs_strided_batched", testing_geqrs_strided_batched<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
+            {"potri", testing_potri<T>},
+            {"potri_batched", testing_potri_batched<T>},
+            {"potri_strided_batched", testing_potri_strided_batched<T>},
+            {"syevj_batched", testing_syevj_batched<T>},
+            {"syevj_strided_batched", testing_syevj_strided_batched<T>},
+            {"gesvdj_batched", testing_gesvdj_batched<T>},
+            {"gesvdj_strided_batched", testing_gesvdj_strided_batched<T>},
 #endif
         };
         run_function(map, arg);
     }
 };
 
+#ifdef __HIP_PLATFORM_SOLVER__
+// gesv_ir refines double precision solutions in single precision
+template <typename T, typename = void>
+struct perf_blas_gesv_ir : hipblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_blas_gesv_ir<
+    T,
+    std::enable_if_t<std::is_same<T, double>{} || std::is_same<T, hipblasDoubleComplex>{}>>
+    : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gesv_ir", testing_gesv_ir<T>},
+            {"gesv_ir_batched", testing_gesv_ir_batched<T>},
+            {"gesv_ir_strided_batched", testing_gesv_ir_strided_batched<T>},
+        };
+        run_function(map, arg);
+    }
+};
+#endif
+
 template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty, typename = void>
 struct perf_blas_axpy_ex : hipblas_test_invalid
 {
@@ -1264,7 +1381,8 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_grouped_batched_ex"))
     {
         // adjust dimension for GEMM routines
         hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1358,6 +1476,11 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         else if(!strcmp(function, "rot_ex") || !strcmp(function, "rot_batched_ex")
                 || !strcmp(function, "rot_strided_batched_ex"))
             hipblas_blas1_ex_dispatch<perf_blas_rot_ex>(arg);
+#ifdef __HIP_PLATFORM_SOLVER__
+        else if(!strcmp(function, "gesv_ir") || !strcmp(function, "gesv_ir_batched")
+                || !strcmp(function, "gesv_ir_strided_batched"))
+            hipblas_simple_dispatch<perf_blas_gesv_ir>(arg);
+#endif
         else
             hipblas_simple_dispatch<perf_blas>(arg);
     }
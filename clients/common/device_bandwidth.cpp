@@ -0,0 +1,218 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "device_bandwidth.hpp"
+#include "device_peak.hpp"
+#include "utility.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+static bool                                         bandwidth       = false;
+static std::vector<size_t>                          bandwidth_sizes = {1, 8, 64, 512};
+static std::string                                  bandwidth_cache;
+static std::mutex                                   bandwidth_mutex;
+static std::map<int, std::vector<hipblasBandwidth>> device_bandwidths;
+
+void hipblas_set_bandwidth(bool b)
+{
+    bandwidth = b;
+}
+
+bool hipblas_get_bandwidth()
+{
+    return bandwidth;
+}
+
+void hipblas_set_bandwidth_sizes(const std::vector<size_t>& mib)
+{
+    std::lock_guard<std::mutex> lock(bandwidth_mutex);
+    bandwidth_sizes = mib;
+    std::sort(bandwidth_sizes.begin(), bandwidth_sizes.end());
+    device_bandwidths.clear();
+}
+
+void hipblas_set_bandwidth_cache(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(bandwidth_mutex);
+    bandwidth_cache = path;
+    device_bandwidths.clear();
+}
+
+// Best GB/s of bandwidth_reps calls of run moving bytes, or -1 if run fails
+template <typename F>
+static double hipblas_bandwidth_time(hipStream_t stream, double bytes, F&& run)
+{
+    hipEvent_t start, stop;
+    CHECK_HIP_ERROR(hipEventCreate(&start));
+    CHECK_HIP_ERROR(hipEventCreate(&stop));
+
+    double best = -1;
+    if(run() == hipSuccess && hipStreamSynchronize(stream) == hipSuccess)
+    {
+        for(int rep = 0; rep < bandwidth_reps; rep++)
+        {
+            float ms = 0;
+            CHECK_HIP_ERROR(hipEventRecord(start, stream));
+            CHECK_HIP_ERROR(run());
+            CHECK_HIP_ERROR(hipEventRecord(stop, stream));
+            CHECK_HIP_ERROR(hipEventSynchronize(stop));
+            CHECK_HIP_ERROR(hipEventElapsedTime(&ms, start, stop));
+            if(ms > 0)
+                best = std::max(best, bytes / (ms * 1e6));
+        }
+    }
+
+    CHECK_HIP_ERROR(hipEventDestroy(start));
+    CHECK_HIP_ERROR(hipEventDestroy(stop));
+    return best;
+}
+
+static std::vector<hipblasBandwidth> hipblas_measure_bandwidth(const hipDeviceProp_t& props)
+{
+    std::vector<hipblasBandwidth> points;
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    for(size_t mib : bandwidth_sizes)
+    {
+        // Three arrays, leaving at least half of the memory to the tests
+        size_t bytes = mib << 20;
+        size_t n     = bytes / sizeof(double);
+        if(!n || 3 * bytes > props.totalGlobalMem / 2)
+            continue;
+
+        double* a;
+        double* b;
+        double* c;
+        CHECK_HIP_ERROR(hipMalloc(&a, bytes));
+        CHECK_HIP_ERROR(hipMalloc(&b, bytes));
+        CHECK_HIP_ERROR(hipMalloc(&c, bytes));
+        CHECK_HIP_ERROR(hipMemset(a, 0, bytes));
+        CHECK_HIP_ERROR(hipMemset(b, 0, bytes));
+        CHECK_HIP_ERROR(hipMemset(c, 0, bytes));
+
+        hipblasBandwidth point;
+        point.bytes     = bytes;
+        point.copy_gbps = hipblas_bandwidth_time(stream, 2.0 * bytes, [&] {
+            return hipMemcpyAsync(b, a, bytes, hipMemcpyDeviceToDevice, stream);
+        });
+        point.triad_gbps = -1;
+        if(hipblas_device_triad_enabled)
+            point.triad_gbps = hipblas_bandwidth_time(stream, 3.0 * bytes, [&] {
+                return hipblas_device_triad(a, b, c, 3, n, stream);
+            });
+        points.push_back(point);
+
+        CHECK_HIP_ERROR(hipFree(a));
+        CHECK_HIP_ERROR(hipFree(b));
+        CHECK_HIP_ERROR(hipFree(c));
+    }
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return points;
+}
+
+// Key of a device in the cache file: its arch and name, with spaces replaced, and the sizes
+static std::string hipblas_bandwidth_key(const hipDeviceProp_t& props)
+{
+    std::string name(props.name);
+    std::replace(name.begin(), name.end(), ' ', '_');
+
+    std::ostringstream key;
+    key << hipblas_device_arch(props) << " " << (name.empty() ? "unknown" : name);
+    for(size_t i = 0; i < bandwidth_sizes.size(); i++)
+        key << (i ? "," : " ") << bandwidth_sizes[i];
+    return key.str();
+}
+
+// Lines "<arch> <name> <sizes> <bytes> <copy GB/s> <triad GB/s>" of the cache file
+static bool hipblas_read_bandwidth_cache(const std::string&             key,
+                                         std::vector<hipblasBandwidth>& points)
+{
+    std::ifstream file(bandwidth_cache);
+    std::string   line;
+    while(std::getline(file, line))
+    {
+        if(line.compare(0, key.size() + 1, key + " "))
+            continue;
+        std::istringstream words(line.substr(key.size()));
+        hipblasBandwidth   point;
+        if(words >> point.bytes >> point.copy_gbps >> point.triad_gbps)
+            points.push_back(point);
+    }
+    return !points.empty();
+}
+
+static void hipblas_write_bandwidth_cache(const std::string&                   key,
+                                          const std::vector<hipblasBandwidth>& points)
+{
+    std::ofstream file(bandwidth_cache, std::ios::app);
+    for(const auto& point : points)
+        file << key << " " << point.bytes << " " << point.copy_gbps << " " << point.triad_gbps
+             << "\n";
+}
+
+const std::vector<hipblasBandwidth>& hipblas_device_bandwidth()
+{
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    std::lock_guard<std::mutex> lock(bandwidth_mutex);
+    auto                        found = device_bandwidths.find(device);
+    if(found != device_bandwidths.end())
+        return found->second;
+
+    hipDeviceProp_t props;
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&props, device));
+
+    std::vector<hipblasBandwidth> points;
+    std::string                   key = hipblas_bandwidth_key(props);
+    if(bandwidth_cache.empty() || !hipblas_read_bandwidth_cache(key, points))
+    {
+        points = hipblas_measure_bandwidth(props);
+        if(!bandwidth_cache.empty())
+            hipblas_write_bandwidth_cache(key, points);
+    }
+    return device_bandwidths[device] = points;
+}
+
+double hipblas_measured_gbps()
+{
+    const std::vector<hipblasBandwidth>& points = hipblas_device_bandwidth();
+    if(points.empty())
+        return 0;
+    const hipblasBandwidth& largest = points.back();
+    return largest.triad_gbps > 0 ? largest.triad_gbps : std::max(largest.copy_gbps, 0.0);
+}
+
+void hipblas_print_bandwidth(std::ostream& str)
+{
+    std::ostringstream lines;
+    lines << "bandwidth-MiB,copy-GB/s,triad-GB/s\n";
+    for(const auto& point : hipblas_device_bandwidth())
+        lines << (point.bytes >> 20) << ", " << point.copy_gbps << ", " << point.triad_gbps << "\n";
+    str << lines.str() << std::flush;
+}
@@ -0,0 +1,291 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "device_counters.hpp"
+
+#include "hipblas.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+
+#ifndef WIN32
+#include <dlfcn.h>
+#endif
+
+static std::vector<std::string> counters;
+
+void hipblas_set_counters(const std::string& list)
+{
+    std::stringstream stream(list);
+    std::string       name;
+    counters.clear();
+    while(std::getline(stream, name, ','))
+    {
+        if(!name.empty())
+            counters.push_back(name);
+    }
+}
+
+const std::vector<std::string>& hipblas_get_counters()
+{
+    return counters;
+}
+
+// Printed once, as a session is opened per test
+static void hipblas_counters_warning(const char* message)
+{
+    static bool warned = false;
+    if(!warned)
+        fprintf(stderr, "hipblas-bench: %s\n", message);
+    warned = true;
+}
+
+#if !defined(WIN32) && defined(__HIP_PLATFORM_AMD__)
+// The few HSA and rocprofiler (v1) types and entry points used, declared here so that neither
+// their headers nor the libraries are needed to build
+struct hipblasHsaAgent
+{
+    uint64_t handle;
+};
+
+struct hipblasRocprofilerData
+{
+    int kind; // ROCPROFILER_DATA_KIND_INT64 = 2, ROCPROFILER_DATA_KIND_DOUBLE = 4
+    union
+    {
+        uint32_t result_int32;
+        uint64_t result_int64;
+        float    result_float;
+        double   result_double;
+        struct
+        {
+            void*    ptr;
+            uint32_t size;
+            uint32_t instance_count;
+            bool     copy;
+        } result_bytes;
+    };
+};
+
+struct hipblasRocprofilerFeature
+{
+    int kind; // ROCPROFILER_FEATURE_KIND_METRIC = 0
+    union
+    {
+        const char* name;
+        struct
+        {
+            const char* block;
+            uint32_t    event;
+        } counter;
+    };
+    const void*            parameters;
+    uint32_t               parameter_count;
+    hipblasRocprofilerData data;
+};
+
+struct hipblasRocprofilerProperties
+{
+    void*    queue;
+    uint32_t queue_depth;
+    void*    handler;
+    void*    handler_arg;
+};
+
+struct hipblasRocprofiler
+{
+    typedef int (*agent_callback_t)(hipblasHsaAgent, void*);
+    typedef int (*hsa_init_t)();
+    typedef int (*iterate_agents_t)(agent_callback_t, void*);
+    typedef int (*agent_get_info_t)(hipblasHsaAgent, int, void*);
+    typedef int (*open_t)(hipblasHsaAgent,
+                          hipblasRocprofilerFeature*,
+                          uint32_t,
+                          void**,
+                          uint32_t,
+                          hipblasRocprofilerProperties*);
+    typedef int (*group_t)(void*, uint32_t);
+    typedef int (*context_t)(void*);
+
+    iterate_agents_t iterate_agents = nullptr;
+    agent_get_info_t agent_get_info = nullptr;
+    open_t           open           = nullptr;
+    group_t          start          = nullptr;
+    group_t          stop           = nullptr;
+    group_t          read           = nullptr;
+    group_t          get_data       = nullptr;
+    context_t        get_metrics    = nullptr;
+    context_t        close          = nullptr;
+
+    hipblasRocprofiler()
+    {
+        void* hsa = dlopen("libhsa-runtime64.so.1", RTLD_NOW);
+        void* lib = dlopen("librocprofiler64.so.1", RTLD_NOW);
+        if(!hsa || !lib)
+            return;
+        auto init      = (hsa_init_t)dlsym(hsa, "hsa_init");
+        iterate_agents = (iterate_agents_t)dlsym(hsa, "hsa_iterate_agents");
+        agent_get_info = (agent_get_info_t)dlsym(hsa, "hsa_agent_get_info");
+        start          = (group_t)dlsym(lib, "rocprofiler_start");
+        stop           = (group_t)dlsym(lib, "rocprofiler_stop");
+        read           = (group_t)dlsym(lib, "rocprofiler_read");
+        get_data       = (group_t)dlsym(lib, "rocprofiler_get_data");
+        get_metrics    = (context_t)dlsym(lib, "rocprofiler_get_metrics");
+        close          = (context_t)dlsym(lib, "rocprofiler_close");
+        if(init && init() == 0 && iterate_agents && agent_get_info && start && stop && read
+           && get_data && get_metrics && close)
+            open = (open_t)dlsym(lib, "rocprofiler_open");
+    }
+};
+
+static const hipblasRocprofiler& hipblas_rocprofiler()
+{
+    static const hipblasRocprofiler rocprofiler;
+    return rocprofiler;
+}
+
+// The GPU agent at the PCI bus and device of the current HIP device, which is not always the agent
+// of the same index when HIP_VISIBLE_DEVICES is set
+struct hipblasAgentSearch
+{
+    int             bus;
+    int             device;
+    bool            found = false;
+    hipblasHsaAgent agent = {};
+};
+
+static int hipblas_agent_callback(hipblasHsaAgent agent, void* data)
+{
+    // HSA_AGENT_INFO_DEVICE, HSA_DEVICE_TYPE_GPU and HSA_AMD_AGENT_INFO_BDFID, whose bits are
+    // bus << 8 | device << 3 | function
+    const hipblasRocprofiler& rocprofiler = hipblas_rocprofiler();
+    auto*                     search      = static_cast<hipblasAgentSearch*>(data);
+    int                       type        = 0;
+    uint32_t                  bdfid       = 0;
+    if(rocprofiler.agent_get_info(agent, 17, &type) != 0 || type != 1
+       || rocprofiler.agent_get_info(agent, 0xA006, &bdfid) != 0)
+        return 0;
+    if(int(bdfid >> 8) != search->bus || int((bdfid >> 3) & 0x1f) != search->device)
+        return 0;
+    search->found = true;
+    search->agent = agent;
+    return 1; // HSA_STATUS_INFO_BREAK
+}
+#endif
+
+// The rocprofiler context of a session and its features, one per metric
+struct hipblasCounterState
+{
+    void*                                  context = nullptr;
+#if !defined(WIN32) && defined(__HIP_PLATFORM_AMD__)
+    std::vector<hipblasRocprofilerFeature> features;
+#endif
+};
+
+hipblasCounterSession::hipblasCounterSession()
+    : m_state(std::make_unique<hipblasCounterState>())
+{
+#if !defined(WIN32) && defined(__HIP_PLATFORM_AMD__)
+    const hipblasRocprofiler& rocprofiler = hipblas_rocprofiler();
+    int                       device;
+    hipDeviceProp_t           prop;
+    if(!rocprofiler.open || hipGetDevice(&device) != hipSuccess
+       || hipGetDeviceProperties(&prop, device) != hipSuccess)
+    {
+        hipblas_counters_warning("--counters needs librocprofiler64.so.1");
+        return;
+    }
+
+    hipblasAgentSearch search{prop.pciBusID, prop.pciDeviceID};
+    rocprofiler.iterate_agents(hipblas_agent_callback, &search);
+    if(!search.found)
+        return;
+
+    m_state->features.resize(counters.size());
+    for(size_t i = 0; i < counters.size(); i++)
+    {
+        m_state->features[i]      = {};
+        m_state->features[i].name = counters[i].c_str();
+    }
+
+    // ROCPROFILER_MODE_STANDALONE | ROCPROFILER_MODE_CREATEQUEUE | ROCPROFILER_MODE_SINGLEGROUP:
+    // the counters of the whole device, with the start and stop packets on a queue of their own
+    hipblasRocprofilerProperties properties = {};
+    properties.queue_depth                  = 128;
+    if(rocprofiler.open(search.agent,
+                        m_state->features.data(),
+                        uint32_t(m_state->features.size()),
+                        &m_state->context,
+                        1 | 2 | 4,
+                        &properties)
+       != 0)
+    {
+        hipblas_counters_warning("rocprofiler cannot count the metrics of --counters together");
+        m_state->context = nullptr;
+    }
+#else
+    hipblas_counters_warning("--counters is only supported on AMD devices");
+#endif
+}
+
+hipblasCounterSession::~hipblasCounterSession()
+{
+#if !defined(WIN32) && defined(__HIP_PLATFORM_AMD__)
+    if(m_state->context)
+        hipblas_rocprofiler().close(m_state->context);
+#endif
+}
+
+void hipblasCounterSession::start()
+{
+#if !defined(WIN32) && defined(__HIP_PLATFORM_AMD__)
+    if(m_state->context && hipblas_rocprofiler().start(m_state->context, 0) != 0)
+    {
+        hipblas_rocprofiler().close(m_state->context);
+        m_state->context = nullptr;
+    }
+#endif
+}
+
+std::vector<double> hipblasCounterSession::stop()
+{
+    std::vector<double> values(counters.size(), -1.0);
+#if !defined(WIN32) && defined(__HIP_PLATFORM_AMD__)
+    const hipblasRocprofiler& rocprofiler = hipblas_rocprofiler();
+    void*                     context     = m_state->context;
+    if(!context || rocprofiler.stop(context, 0) != 0 || rocprofiler.read(context, 0) != 0
+       || rocprofiler.get_data(context, 0) != 0 || rocprofiler.get_metrics(context) != 0)
+        return values;
+
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        const hipblasRocprofilerData& data = m_state->features[i].data;
+        if(data.kind == 2)
+            values[i] = double(data.result_int64);
+        else if(data.kind == 4)
+            values[i] = data.result_double;
+    }
+#endif
+    return values;
+}
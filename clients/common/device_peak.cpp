@@ -0,0 +1,183 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "device_peak.hpp"
+#include "hipblas_datatype2string.hpp"
+#include "utility.h"
+
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+// Dense flops per clock per compute unit, with matrix cores where the arch has them
+struct hipblasArchFlops
+{
+    const char* arch;
+    double      f64, f32, f16, bf16, i8;
+};
+
+static const hipblasArchFlops arch_flops[] = {
+    {"gfx906", 64, 128, 256, 0, 512},
+    {"gfx908", 64, 256, 1024, 512, 1024},
+    {"gfx90a", 256, 256, 1024, 1024, 1024},
+    {"gfx940", 256, 256, 2048, 2048, 4096},
+    {"gfx941", 256, 256, 2048, 2048, 4096},
+    {"gfx942", 256, 256, 2048, 2048, 4096},
+    {"sm_70", 64, 128, 1024, 0, 0},
+    {"sm_80", 128, 128, 2048, 2048, 4096},
+    {"sm_90", 256, 256, 4096, 4096, 8192},
+};
+
+struct hipblasDevicePeak
+{
+    double gbps = 0;
+    double gflops[5]{}; // f64, f32, f16, bf16, i8
+};
+
+static bool                                                 efficiency = false;
+static std::mutex                                           peak_mutex;
+static std::map<std::string, std::map<std::string, double>> peak_overrides;
+static std::map<int, hipblasDevicePeak>                     device_peaks;
+
+void hipblas_set_efficiency(bool e)
+{
+    efficiency = e;
+}
+
+bool hipblas_get_efficiency()
+{
+    return efficiency;
+}
+
+// Index in hipblasDevicePeak::gflops, complex types counting as their real type, or -1
+static int hipblas_peak_index(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_64F:
+        return 0;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_C_32F:
+        return 1;
+    case HIPBLAS_R_16F:
+    case HIPBLAS_C_16F:
+        return 2;
+    case HIPBLAS_R_16B:
+        return 3;
+    case HIPBLAS_R_8I:
+        return 4;
+    default:
+        return -1;
+    }
+}
+
+std::string hipblas_device_arch(const hipDeviceProp_t& props)
+{
+#ifdef __HIP_PLATFORM_NVCC__
+    return "sm_" + std::to_string(props.major) + std::to_string(props.minor);
+#else
+    std::string arch(props.gcnArchName);
+    return arch.substr(0, arch.find(':'));
+#endif
+}
+
+void hipblas_load_peak_file(const std::string& path)
+{
+    std::ifstream file(path);
+    if(!file)
+        throw std::invalid_argument("Cannot open --peak_file " + path);
+
+    std::lock_guard<std::mutex> lock(peak_mutex);
+    std::string                 line;
+    while(std::getline(file, line))
+    {
+        std::istringstream words(line.substr(0, line.find('#')));
+        std::string        arch, key;
+        double             value;
+        if(!(words >> arch))
+            continue;
+        if(!(words >> key >> value) || value < 0
+           || (key != "bandwidth" && hipblas_peak_index(string2hipblas_datatype(key)) < 0))
+            throw std::invalid_argument("Invalid line in --peak_file " + path + ": " + line);
+        peak_overrides[arch][key] = value;
+    }
+    device_peaks.clear();
+}
+
+static const hipblasDevicePeak& hipblas_device_peak()
+{
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    std::lock_guard<std::mutex> lock(peak_mutex);
+    auto                        found = device_peaks.find(device);
+    if(found != device_peaks.end())
+        return found->second;
+
+    hipDeviceProp_t props;
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&props, device));
+
+    std::string arch = hipblas_device_arch(props);
+
+    // clockRate and memoryClockRate are in kHz, memoryBusWidth in bits with two transfers a clock
+    hipblasDevicePeak peak;
+    double            ghz = props.clockRate * 1e-6;
+    peak.gbps             = props.memoryClockRate * 1e-6 * props.memoryBusWidth / 8 * 2;
+    for(const auto& flops : arch_flops)
+    {
+        if(arch != flops.arch)
+            continue;
+        const double per_clock[5] = {flops.f64, flops.f32, flops.f16, flops.bf16, flops.i8};
+        for(int i = 0; i < 5; i++)
+            peak.gflops[i] = per_clock[i] * props.multiProcessorCount * ghz;
+    }
+
+    auto overrides = peak_overrides.find(arch);
+    if(overrides != peak_overrides.end())
+    {
+        for(const auto& entry : overrides->second)
+        {
+            int index = hipblas_peak_index(string2hipblas_datatype(entry.first));
+            if(entry.first == "bandwidth")
+                peak.gbps = entry.second;
+            else
+                peak.gflops[index] = entry.second;
+        }
+    }
+
+    return device_peaks[device] = peak;
+}
+
+double hipblas_peak_gflops(hipblasDatatype_t type)
+{
+    int index = hipblas_peak_index(type);
+    return index < 0 ? 0 : hipblas_device_peak().gflops[index];
+}
+
+double hipblas_peak_gbps()
+{
+    return hipblas_device_peak().gbps;
+}
@@ -0,0 +1,226 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "device_telemetry.hpp"
+
+#include "hipblas.h"
+
+#include <cctype>
+#include <chrono>
+#include <fstream>
+
+#ifndef WIN32
+#include <dirent.h>
+#include <dlfcn.h>
+#endif
+
+static bool telemetry = false;
+
+void hipblas_set_telemetry(bool enable)
+{
+    telemetry = enable;
+}
+
+bool hipblas_get_telemetry()
+{
+    return telemetry;
+}
+
+#if !defined(WIN32) && defined(__HIP_PLATFORM_NVCC__)
+// The few NVML entry points used, declared here so that neither the NVML headers nor the library
+// are needed to build
+struct hipblasNvml
+{
+    typedef int (*init_t)();
+    typedef int (*handle_t)(const char*, void**);
+    typedef int (*power_t)(void*, unsigned int*);
+    typedef int (*clock_info_t)(void*, int, unsigned int*);
+    typedef int (*temperature_t)(void*, int, unsigned int*);
+
+    handle_t      get_handle  = nullptr;
+    power_t       power       = nullptr;
+    clock_info_t  clock       = nullptr;
+    temperature_t temperature = nullptr;
+
+    hipblasNvml()
+    {
+        void* lib = dlopen("libnvidia-ml.so.1", RTLD_NOW);
+        if(!lib)
+            return;
+        auto init   = (init_t)dlsym(lib, "nvmlInit_v2");
+        get_handle  = (handle_t)dlsym(lib, "nvmlDeviceGetHandleByPciBusId_v2");
+        power       = (power_t)dlsym(lib, "nvmlDeviceGetPowerUsage");
+        clock       = (clock_info_t)dlsym(lib, "nvmlDeviceGetClockInfo");
+        temperature = (temperature_t)dlsym(lib, "nvmlDeviceGetTemperature");
+        if(!init || init() != 0 || !power || !clock || !temperature)
+            get_handle = nullptr;
+    }
+};
+
+static const hipblasNvml& hipblas_nvml()
+{
+    static const hipblasNvml nvml;
+    return nvml;
+}
+#endif
+
+#ifndef WIN32
+// hwmon directory of the amdgpu driver for the PCI device bus_id, empty if none
+static std::string hipblas_hwmon_path(const std::string& bus_id)
+{
+    std::string dir   = "/sys/bus/pci/devices/" + bus_id + "/hwmon";
+    DIR*        hwmon = opendir(dir.c_str());
+    std::string path;
+    if(!hwmon)
+        return path;
+    while(dirent* entry = readdir(hwmon))
+    {
+        if(std::string(entry->d_name).rfind("hwmon", 0) == 0)
+        {
+            path = dir + "/" + entry->d_name + "/";
+            break;
+        }
+    }
+    closedir(hwmon);
+    return path;
+}
+
+static bool hipblas_read_sysfs(const std::string& path, double& value)
+{
+    std::ifstream file(path);
+    return bool(file >> value);
+}
+#endif
+
+hipblasTelemetrySampler::hipblasTelemetrySampler(int period_ms)
+    : m_period_ms(period_ms)
+{
+#ifndef WIN32
+    int  device;
+    char bus_id[64];
+    if(hipGetDevice(&device) != hipSuccess
+       || hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess)
+        return;
+
+    std::string id(bus_id);
+    for(char& c : id)
+        c = std::tolower(c);
+#ifdef __HIP_PLATFORM_NVCC__
+    const hipblasNvml& nvml = hipblas_nvml();
+    if(nvml.get_handle && nvml.get_handle(id.c_str(), &m_nvml_device) != 0)
+        m_nvml_device = nullptr;
+#else
+    m_hwmon = hipblas_hwmon_path(id);
+#endif
+#endif
+}
+
+hipblasTelemetrySampler::~hipblasTelemetrySampler()
+{
+    if(m_thread.joinable())
+        stop();
+}
+
+void hipblasTelemetrySampler::sample()
+{
+    double value[4]{};
+    bool   known[4]{};
+#ifndef WIN32
+    if(!m_hwmon.empty())
+    {
+        // Power in microwatts, clocks in Hz and temperature in millidegrees, where older kernels
+        // have the average power and newer ones only the current one
+        known[0] = hipblas_read_sysfs(m_hwmon + "power1_average", value[0])
+                   || hipblas_read_sysfs(m_hwmon + "power1_input", value[0]);
+        known[1] = hipblas_read_sysfs(m_hwmon + "freq1_input", value[1]);
+        known[2] = hipblas_read_sysfs(m_hwmon + "freq2_input", value[2]);
+        known[3] = hipblas_read_sysfs(m_hwmon + "temp1_input", value[3]);
+        const double scale[4] = {1e-6, 1e-6, 1e-6, 1e-3};
+        for(int i = 0; i < 4; i++)
+            value[i] *= scale[i];
+    }
+#ifdef __HIP_PLATFORM_NVCC__
+    if(m_nvml_device)
+    {
+        // Power in milliwatts, then the SM and memory clocks and the die temperature
+        const hipblasNvml& nvml = hipblas_nvml();
+        unsigned int       raw[4];
+        known[0] = nvml.power(m_nvml_device, &raw[0]) == 0;
+        known[1] = nvml.clock(m_nvml_device, 1, &raw[1]) == 0;
+        known[2] = nvml.clock(m_nvml_device, 2, &raw[2]) == 0;
+        known[3] = nvml.temperature(m_nvml_device, 0, &raw[3]) == 0;
+        for(int i = 0; i < 4; i++)
+            value[i] = i ? raw[i] : raw[i] * 1e-3;
+    }
+#endif
+#endif
+    m_samples++;
+    for(int i = 0; i < 4; i++)
+    {
+        if(known[i])
+        {
+            m_sum[i] += value[i];
+            m_count[i]++;
+        }
+    }
+}
+
+void hipblasTelemetrySampler::start()
+{
+    m_samples = 0;
+    for(int i = 0; i < 4; i++)
+        m_sum[i] = m_count[i] = 0;
+    if(m_hwmon.empty() && !m_nvml_device)
+        return;
+
+    sample();
+    m_running = true;
+    m_thread  = std::thread([this] {
+        auto next = std::chrono::steady_clock::now();
+        while(m_running)
+        {
+            next += std::chrono::milliseconds(m_period_ms);
+            std::this_thread::sleep_until(next);
+            if(m_running)
+                sample();
+        }
+    });
+}
+
+hipblasTelemetry hipblasTelemetrySampler::stop()
+{
+    hipblasTelemetry result;
+    if(!m_thread.joinable())
+        return result;
+
+    m_running = false;
+    m_thread.join();
+    sample();
+
+    double* average[4] = {&result.power_w, &result.sclk_mhz, &result.mclk_mhz, &result.temp_c};
+    result.samples     = m_samples;
+    for(int i = 0; i < 4; i++)
+        if(m_count[i])
+            *average[i] = m_sum[i] / m_count[i];
+    return result;
+}
@@ -0,0 +1,387 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "device_tracer.hpp"
+
+#include "hipblas.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#ifndef WIN32
+#include <dlfcn.h>
+#endif
+
+static bool kernel_breakdown = false;
+
+void hipblas_set_kernel_breakdown(bool breakdown)
+{
+    kernel_breakdown = breakdown;
+}
+
+bool hipblas_get_kernel_breakdown()
+{
+    return kernel_breakdown;
+}
+
+// Printed once, as a tracer is created per test
+static void hipblas_tracer_warning(const char* message)
+{
+    static bool warned = false;
+    if(!warned)
+        fprintf(stderr, "hipblas-bench: %s\n", message);
+    warned = true;
+}
+
+#if !defined(WIN32) && defined(__HIP_PLATFORM_AMD__)
+// The few roctracer types and entry points used, declared here so that neither its headers nor the
+// library are needed to build. The domains are those of activity_domain_t, and the record is
+// activity_record_t of roctracer 4.1 and later.
+constexpr uint32_t roctracer_hip_ops = 2; // ACTIVITY_DOMAIN_HIP_OPS
+constexpr uint32_t roctracer_hip_api = 3; // ACTIVITY_DOMAIN_HIP_API
+
+struct hipblasRoctracerRecord
+{
+    uint32_t domain;
+    uint32_t kind;
+    uint32_t op; // HIP_OP_ID_DISPATCH = 0 in the HIP_OPS domain
+    union
+    {
+        struct
+        {
+            uint64_t correlation_id;
+            uint64_t begin_ns;
+            uint64_t end_ns;
+        };
+        struct
+        {
+            uint32_t se;
+            uint64_t cycle;
+            uint64_t pc;
+        } pc_sample;
+    };
+    union
+    {
+        struct
+        {
+            int      device_id;
+            uint64_t queue_id;
+        };
+        struct
+        {
+            uint32_t process_id;
+            uint32_t thread_id;
+        };
+    };
+    union
+    {
+        size_t      bytes;
+        const char* kernel_name;
+    };
+};
+
+struct hipblasRoctracerProperties
+{
+    typedef void (*buffer_callback_t)(const char* begin, const char* end, void* arg);
+
+    uint32_t          mode;
+    size_t            buffer_size;
+    void*             alloc_fun;
+    void*             alloc_arg;
+    buffer_callback_t buffer_callback_fun;
+    void*             buffer_callback_arg;
+};
+
+// hip_api_data_t, with the arguments of the launch APIs whose grid and block are recorded:
+// hipLaunchKernel and hipExtLaunchKernel, which share their first arguments,
+// hipModuleLaunchKernel, and hipExtModuleLaunchKernel, whose sizes are in work items
+struct hipblasHipApiData
+{
+    uint64_t correlation_id;
+    uint32_t phase; // ACTIVITY_API_PHASE_ENTER = 0
+    union
+    {
+        struct
+        {
+            const void* function_address;
+            uint32_t    grid[3];
+            uint32_t    block[3];
+        } launch_kernel;
+        struct
+        {
+            void*    function;
+            uint32_t grid[3];
+            uint32_t block[3];
+        } module_launch_kernel;
+        struct
+        {
+            void*    function;
+            uint32_t global[3];
+            uint32_t local[3];
+        } ext_module_launch_kernel;
+    } args;
+};
+
+struct hipblasRoctracer
+{
+    typedef void (*api_callback_t)(uint32_t, uint32_t, const void*, void*);
+    typedef int (*op_code_t)(uint32_t, const char*, uint32_t*, uint32_t*);
+    typedef int (*enable_op_callback_t)(uint32_t, uint32_t, api_callback_t, void*);
+    typedef int (*disable_op_callback_t)(uint32_t, uint32_t);
+    typedef int (*open_pool_t)(const hipblasRoctracerProperties*);
+    typedef int (*domain_t)(uint32_t);
+    typedef int (*void_t)();
+    typedef int (*next_record_t)(const hipblasRoctracerRecord*, const hipblasRoctracerRecord**);
+
+    op_code_t             op_code                 = nullptr;
+    enable_op_callback_t  enable_op_callback      = nullptr;
+    disable_op_callback_t disable_op_callback     = nullptr;
+    open_pool_t           open_pool               = nullptr;
+    domain_t              enable_domain_activity  = nullptr;
+    domain_t              disable_domain_activity = nullptr;
+    void_t                flush_activity          = nullptr;
+    void_t                close_pool              = nullptr;
+    next_record_t         next_record             = nullptr;
+    uint32_t              launch_ops[5]; // UINT32_MAX for an API the release does not have
+
+    hipblasRoctracer()
+    {
+        std::fill(launch_ops, launch_ops + 5, UINT32_MAX);
+
+        void* lib = dlopen("libroctracer64.so.4", RTLD_NOW);
+        if(!lib)
+            lib = dlopen("libroctracer64.so.1", RTLD_NOW);
+        if(!lib)
+            return;
+        op_code                 = (op_code_t)dlsym(lib, "roctracer_op_code");
+        enable_op_callback      = (enable_op_callback_t)dlsym(lib, "roctracer_enable_op_callback");
+        disable_op_callback
+            = (disable_op_callback_t)dlsym(lib, "roctracer_disable_op_callback");
+        enable_domain_activity  = (domain_t)dlsym(lib, "roctracer_enable_domain_activity");
+        disable_domain_activity = (domain_t)dlsym(lib, "roctracer_disable_domain_activity");
+        flush_activity          = (void_t)dlsym(lib, "roctracer_flush_activity");
+        close_pool              = (void_t)dlsym(lib, "roctracer_close_pool");
+        next_record             = (next_record_t)dlsym(lib, "roctracer_next_record");
+        if(!op_code || !enable_op_callback || !disable_op_callback || !enable_domain_activity
+           || !disable_domain_activity || !flush_activity || !close_pool || !next_record)
+            return;
+
+        // The op codes of the HIP APIs differ between releases, so they are looked up by name
+        const char* names[5] = {"hipLaunchKernel",
+                                "hipExtLaunchKernel",
+                                "hipLaunchCooperativeKernel",
+                                "hipModuleLaunchKernel",
+                                "hipExtModuleLaunchKernel"};
+        for(int i = 0; i < 5; i++)
+        {
+            if(op_code(roctracer_hip_api, names[i], &launch_ops[i], nullptr) != 0)
+                launch_ops[i] = UINT32_MAX;
+        }
+        open_pool = (open_pool_t)dlsym(lib, "roctracer_open_pool");
+    }
+};
+
+static const hipblasRoctracer& hipblas_roctracer()
+{
+    static const hipblasRoctracer roctracer;
+    return roctracer;
+}
+
+// The grid and block of each launch, by correlation id, and the kernels of the activity records.
+// The callbacks run on the launching thread and the buffer callback on a thread of roctracer.
+struct hipblasTraceData
+{
+    std::mutex                                            mutex;
+    std::unordered_map<uint64_t, hipblasKernelRecord>     launches;
+    std::vector<std::pair<uint64_t, hipblasKernelRecord>> kernels; // by start time
+};
+
+static hipblasTraceData trace_data;
+
+static void hipblas_launch_callback(uint32_t domain, uint32_t op, const void* data, void* arg)
+{
+    const hipblasRoctracer& roctracer = hipblas_roctracer();
+    const auto*             api       = static_cast<const hipblasHipApiData*>(data);
+    if(api->phase != 0)
+        return;
+
+    // The ops of launch_ops are in the order of the names looked up: the first three take the
+    // grid and block as dim3, the module launches as sizes
+    int index = int(std::find(roctracer.launch_ops, roctracer.launch_ops + 5, op)
+                    - roctracer.launch_ops);
+
+    hipblasKernelRecord launch;
+    for(int i = 0; i < 3; i++)
+    {
+        if(index < 3)
+        {
+            launch.grid[i]  = api->args.launch_kernel.grid[i];
+            launch.block[i] = api->args.launch_kernel.block[i];
+        }
+        else if(index == 3)
+        {
+            launch.grid[i]  = api->args.module_launch_kernel.grid[i];
+            launch.block[i] = api->args.module_launch_kernel.block[i];
+        }
+        else if(index == 4)
+        {
+            uint32_t local  = std::max(1u, api->args.ext_module_launch_kernel.local[i]);
+            launch.grid[i]  = (api->args.ext_module_launch_kernel.global[i] + local - 1) / local;
+            launch.block[i] = local;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(trace_data.mutex);
+    trace_data.launches[api->correlation_id] = launch;
+}
+
+static void hipblas_activity_callback(const char* begin, const char* end, void* arg)
+{
+    using record_t = hipblasRoctracerRecord;
+
+    const hipblasRoctracer& roctracer = hipblas_roctracer();
+    const record_t*         record    = reinterpret_cast<const record_t*>(begin);
+    const record_t*         last      = reinterpret_cast<const record_t*>(end);
+
+    std::lock_guard<std::mutex> lock(trace_data.mutex);
+    while(record < last)
+    {
+        if(record->domain == roctracer_hip_ops && record->op == 0)
+        {
+            hipblasKernelRecord kernel;
+            auto                launch = trace_data.launches.find(record->correlation_id);
+            if(launch != trace_data.launches.end())
+                kernel = launch->second;
+            kernel.name = record->kernel_name ? record->kernel_name : "";
+            kernel.us   = (record->end_ns - record->begin_ns) * 1e-3;
+            trace_data.kernels.push_back({record->begin_ns, kernel});
+        }
+        if(roctracer.next_record(record, &record) != 0)
+            break;
+    }
+}
+#endif
+
+// Whether the activity pool of the tracers is open, which is once per process
+struct hipblasTracerState
+{
+    bool enabled = false;
+};
+
+hipblasKernelTracer::hipblasKernelTracer()
+    : m_state(std::make_unique<hipblasTracerState>())
+{
+#if !defined(WIN32) && defined(__HIP_PLATFORM_AMD__)
+    const hipblasRoctracer& roctracer = hipblas_roctracer();
+    if(!roctracer.open_pool)
+    {
+        hipblas_tracer_warning("--kernel_breakdown needs libroctracer64.so.4");
+        return;
+    }
+
+    static bool pool = [&] {
+        hipblasRoctracerProperties properties = {};
+        properties.buffer_size                = 1 << 20;
+        properties.buffer_callback_fun        = hipblas_activity_callback;
+        return roctracer.open_pool(&properties) == 0;
+    }();
+    if(!pool)
+        hipblas_tracer_warning("roctracer cannot open its activity pool");
+    m_state->enabled = pool;
+#else
+    hipblas_tracer_warning("--kernel_breakdown is only supported on AMD devices");
+#endif
+}
+
+hipblasKernelTracer::~hipblasKernelTracer() = default;
+
+void hipblasKernelTracer::start()
+{
+#if !defined(WIN32) && defined(__HIP_PLATFORM_AMD__)
+    if(!m_state->enabled)
+        return;
+
+    const hipblasRoctracer& roctracer = hipblas_roctracer();
+    {
+        std::lock_guard<std::mutex> lock(trace_data.mutex);
+        trace_data.launches.clear();
+        trace_data.kernels.clear();
+    }
+    for(uint32_t op : roctracer.launch_ops)
+    {
+        if(op != UINT32_MAX)
+            roctracer.enable_op_callback(roctracer_hip_api, op, hipblas_launch_callback, nullptr);
+    }
+    roctracer.enable_domain_activity(roctracer_hip_ops);
+#endif
+}
+
+std::vector<hipblasKernelRecord> hipblasKernelTracer::stop()
+{
+    std::vector<hipblasKernelRecord> kernels;
+#if !defined(WIN32) && defined(__HIP_PLATFORM_AMD__)
+    if(!m_state->enabled)
+        return kernels;
+
+    const hipblasRoctracer& roctracer = hipblas_roctracer();
+    roctracer.disable_domain_activity(roctracer_hip_ops);
+    for(uint32_t op : roctracer.launch_ops)
+    {
+        if(op != UINT32_MAX)
+            roctracer.disable_op_callback(roctracer_hip_api, op);
+    }
+    roctracer.flush_activity();
+
+    // In the order the kernels started on the device
+    std::lock_guard<std::mutex> lock(trace_data.mutex);
+    std::stable_sort(trace_data.kernels.begin(),
+                     trace_data.kernels.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    for(auto& kernel : trace_data.kernels)
+        kernels.push_back(std::move(kernel.second));
+    trace_data.kernels.clear();
+    trace_data.launches.clear();
+#endif
+    return kernels;
+}
+
+std::string hipblas_kernel_lines(const std::vector<hipblasKernelRecord>& kernels)
+{
+    // Kernel names hold commas, so they come last
+    std::stringstream lines;
+    double            total = 0;
+    for(const hipblasKernelRecord& kernel : kernels)
+        total += kernel.us;
+    lines << "hipblas-kernels: " << kernels.size() << " kernels, " << total << " us\n";
+    for(const hipblasKernelRecord& kernel : kernels)
+    {
+        lines << "  " << kernel.us << " us, grid " << kernel.grid[0] << "x" << kernel.grid[1]
+              << "x" << kernel.grid[2] << ", block " << kernel.block[0] << "x" << kernel.block[1]
+              << "x" << kernel.block[2] << ", " << kernel.name << "\n";
+    }
+    return lines.str();
+}
@@ -0,0 +1,242 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_check_device.hpp"
+#include "hipblas_datatype2string.hpp"
+#include "utility.h"
+#include <cmath>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+// Squared difference and reference, and largest absolute and relative difference, of a batch
+struct hipblas_check_sums
+{
+    double diff2, ref2, max_abs, max_rel;
+};
+
+// IEEE half and bfloat16 as stored by hipblasHalf and hipblasBfloat16
+struct hipblas_check_half
+{
+    uint16_t data;
+};
+
+struct hipblas_check_bfloat16
+{
+    uint16_t data;
+};
+
+__device__ void hipblas_check_load(const float& a, double& re, double& im)
+{
+    re = a;
+    im = 0;
+}
+
+__device__ void hipblas_check_load(const double& a, double& re, double& im)
+{
+    re = a;
+    im = 0;
+}
+
+__device__ void hipblas_check_load(const hipFloatComplex& a, double& re, double& im)
+{
+    re = hipCrealf(a);
+    im = hipCimagf(a);
+}
+
+__device__ void hipblas_check_load(const hipDoubleComplex& a, double& re, double& im)
+{
+    re = hipCreal(a);
+    im = hipCimag(a);
+}
+
+__device__ void hipblas_check_load(const hipblas_check_half& a, double& re, double& im)
+{
+    re = __half2float(__ushort_as_half(a.data));
+    im = 0;
+}
+
+__device__ void hipblas_check_load(const hipblas_check_bfloat16& a, double& re, double& im)
+{
+    re = __uint_as_float(uint32_t(a.data) << 16);
+    im = 0;
+}
+
+// Non-negative doubles order like their bits, so their maximum is an integer atomicMax
+__device__ void hipblas_check_max(double* address, double value)
+{
+    atomicMax((unsigned long long*)address, (unsigned long long)__double_as_longlong(value));
+}
+
+template <typename T, int BLOCK>
+__global__ void __launch_bounds__(BLOCK)
+    hipblas_check_device_kernel(const T*            ref,
+                                const T*            res,
+                                size_t              M,
+                                size_t              N,
+                                size_t              lda,
+                                hipblasStride       stride,
+                                size_t              batch_count,
+                                hipblas_check_sums* sums)
+{
+    __shared__ double shared[4][BLOCK];
+
+    // blockIdx.y strides over the batches and blockIdx.x over the elements of a batch
+    for(size_t b = blockIdx.y; b < batch_count; b += gridDim.y)
+    {
+        double diff2 = 0, ref2 = 0, max_abs = 0, max_rel = 0;
+        for(size_t e = size_t(blockIdx.x) * BLOCK + threadIdx.x; e < M * N;
+            e += size_t(BLOCK) * gridDim.x)
+        {
+            size_t offset = e % M + e / M * lda + b * stride;
+
+            double ref_re, ref_im, res_re, res_im;
+            hipblas_check_load(ref[offset], ref_re, ref_im);
+            hipblas_check_load(res[offset], res_re, res_im);
+
+            double diff_re = res_re - ref_re, diff_im = res_im - ref_im;
+            double diff    = diff_re * diff_re + diff_im * diff_im;
+            double norm    = ref_re * ref_re + ref_im * ref_im;
+            diff2 += diff;
+            ref2 += norm;
+            max_abs = fmax(max_abs, sqrt(diff));
+            max_rel = fmax(max_rel, norm ? sqrt(diff / norm) : sqrt(diff));
+        }
+
+        shared[0][threadIdx.x] = diff2;
+        shared[1][threadIdx.x] = ref2;
+        shared[2][threadIdx.x] = max_abs;
+        shared[3][threadIdx.x] = max_rel;
+        for(int s = BLOCK / 2; s > 0; s /= 2)
+        {
+            __syncthreads();
+            if(threadIdx.x < s)
+            {
+                shared[0][threadIdx.x] += shared[0][threadIdx.x + s];
+                shared[1][threadIdx.x] += shared[1][threadIdx.x + s];
+                shared[2][threadIdx.x] = fmax(shared[2][threadIdx.x], shared[2][threadIdx.x + s]);
+                shared[3][threadIdx.x] = fmax(shared[3][threadIdx.x], shared[3][threadIdx.x + s]);
+            }
+        }
+
+        if(threadIdx.x == 0)
+        {
+            atomicAdd(&sums[b].diff2, shared[0][0]);
+            atomicAdd(&sums[b].ref2, shared[1][0]);
+            hipblas_check_max(&sums[b].max_abs, shared[2][0]);
+            hipblas_check_max(&sums[b].max_rel, shared[3][0]);
+        }
+        __syncthreads();
+    }
+}
+
+template <typename T>
+static void hipblas_check_device_launch(size_t              M,
+                                        size_t              N,
+                                        size_t              lda,
+                                        hipblasStride       stride,
+                                        const void*         ref,
+                                        const void*         res,
+                                        size_t              batch_count,
+                                        hipblas_check_sums* sums)
+{
+    // At most 64K blocks of the elements in total, and 64K batches at once
+    constexpr int block    = 256;
+    size_t        blocks_y = std::min<size_t>(batch_count, 65535);
+    size_t        blocks_x = std::min<size_t>((M * N + block - 1) / block, 65536 / blocks_y);
+    hipLaunchKernelGGL((hipblas_check_device_kernel<T, block>),
+                       dim3(std::max<size_t>(blocks_x, 1), blocks_y),
+                       dim3(block),
+                       0,
+                       0,
+                       (const T*)ref,
+                       (const T*)res,
+                       M,
+                       N,
+                       lda,
+                       stride,
+                       batch_count,
+                       sums);
+    CHECK_HIP_ERROR(hipGetLastError());
+}
+
+hipblas_device_error hipblas_check_device(hipblasDatatype_t type,
+                                          size_t            M,
+                                          size_t            N,
+                                          size_t            lda,
+                                          hipblasStride     stride,
+                                          const void*       ref,
+                                          const void*       res,
+                                          size_t            batch_count)
+{
+    hipblas_device_error error;
+    if(!M || !N || !batch_count)
+        return error;
+
+    hipblas_check_sums* sums;
+    size_t              bytes = sizeof(hipblas_check_sums) * batch_count;
+    CHECK_HIP_ERROR(hipMalloc((void**)&sums, bytes));
+    CHECK_HIP_ERROR(hipMemset(sums, 0, bytes));
+
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+        hipblas_check_device_launch<hipblas_check_half>(
+            M, N, lda, stride, ref, res, batch_count, sums);
+        break;
+    case HIPBLAS_R_16B:
+        hipblas_check_device_launch<hipblas_check_bfloat16>(
+            M, N, lda, stride, ref, res, batch_count, sums);
+        break;
+    case HIPBLAS_R_32F:
+        hipblas_check_device_launch<float>(M, N, lda, stride, ref, res, batch_count, sums);
+        break;
+    case HIPBLAS_R_64F:
+        hipblas_check_device_launch<double>(M, N, lda, stride, ref, res, batch_count, sums);
+        break;
+    case HIPBLAS_C_32F:
+        hipblas_check_device_launch<hipFloatComplex>(
+            M, N, lda, stride, ref, res, batch_count, sums);
+        break;
+    case HIPBLAS_C_64F:
+        hipblas_check_device_launch<hipDoubleComplex>(
+            M, N, lda, stride, ref, res, batch_count, sums);
+        break;
+    default:
+        CHECK_HIP_ERROR(hipFree(sums));
+        throw std::invalid_argument(std::string("hipblas_check_device does not support ")
+                                    + hipblas_datatype2string(type));
+    }
+
+    std::vector<hipblas_check_sums> host(batch_count);
+    CHECK_HIP_ERROR(hipMemcpy(host.data(), sums, bytes, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipFree(sums));
+
+    for(auto& batch : host)
+    {
+        error.norm_error += std::sqrt(batch.diff2) / std::sqrt(batch.ref2);
+        error.max_abs = std::max(error.max_abs, batch.max_abs);
+        error.max_rel = std::max(error.max_rel, batch.max_rel);
+    }
+    return error;
+}
@@ -49,6 +49,8 @@ char hipblas2char_operation(hipblasOperation_t value)
         return 'T';
     case HIPBLAS_OP_C:
         return 'C';
+    case HIPBLAS_OP_CONJ:
+        return 'R';
     }
     return '\0';
 }
@@ -112,6 +114,9 @@ hipblasOperation_t char2hipblas_operation(char value)
         return HIPBLAS_OP_T;
     case 'c':
         return HIPBLAS_OP_C;
+    case 'R':
+    case 'r':
+        return HIPBLAS_OP_CONJ;
     }
     return HIPBLAS_OP_N;
 }
@@ -189,17 +194,18 @@ hipblasDatatype_t string2hipblas_datatype(const std::string& value)
 
 hipblasComputeType_t string2hipblas_computetype(const std::string& value)
 {
-    return value == "16f"           ? HIPBLAS_COMPUTE_16F :
-           value == "16f_pedantic"  ? HIPBLAS_COMPUTE_16F_PEDANTIC :
-           value == "32f"           ? HIPBLAS_COMPUTE_32F :
-           value == "32f_pedantic"  ? HIPBLAS_COMPUTE_32F_PEDANTIC :
-           value == "32f_fast_16f"  ? HIPBLAS_COMPUTE_32F_FAST_16F :
-           value == "32f_fast_16Bf" ? HIPBLAS_COMPUTE_32F_FAST_16BF :
-           value == "32f_fast_tf32" ? HIPBLAS_COMPUTE_32F_FAST_TF32 :
-           value == "64f"           ? HIPBLAS_COMPUTE_64F :
-           value == "64f_pedantic"  ? HIPBLAS_COMPUTE_64F_PEDANTIC :
-           value == "32i"           ? HIPBLAS_COMPUTE_32I :
-           value == "32i_pedantic"  ? HIPBLAS_COMPUTE_32I_PEDANTIC :
+    return value == "16f"             ? HIPBLAS_COMPUTE_16F :
+           value == "16f_pedantic"    ? HIPBLAS_COMPUTE_16F_PEDANTIC :
+           value == "32f"             ? HIPBLAS_COMPUTE_32F :
+           value == "32f_pedantic"    ? HIPBLAS_COMPUTE_32F_PEDANTIC :
+           value == "32f_fast_16f"    ? HIPBLAS_COMPUTE_32F_FAST_16F :
+           value == "32f_fast_16Bf"   ? HIPBLAS_COMPUTE_32F_FAST_16BF :
+           value == "32f_fast_tf32"   ? HIPBLAS_COMPUTE_32F_FAST_TF32 :
+           value == "64f"             ? HIPBLAS_COMPUTE_64F :
+           value == "64f_pedantic"    ? HIPBLAS_COMPUTE_64F_PEDANTIC :
+           value == "32i"             ? HIPBLAS_COMPUTE_32I :
+           value == "32i_pedantic"    ? HIPBLAS_COMPUTE_32I_PEDANTIC :
+           value == "32f_fast_16bfx3" ? HIPBLAS_COMPUTE_32F_FAST_16BFX3 :
            HIPBLAS_COMPUTE_32F; // Default
 }
 // clang-format on
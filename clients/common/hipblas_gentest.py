@@ -25,6 +25,7 @@ import sys
 import os
 import argparse
 import ctypes
+import struct
 from fnmatch import fnmatchcase
 try:  # Import either the C or pure-Python YAML parser
     from yaml import CLoader as Loader
@@ -44,6 +45,7 @@ INCLUDE_RE = re.compile(r'include\s*:\s*(.*)')
 
 args = {}
 testcases = set()
+index = {}
 datatypes = {}
 param = {}
 
@@ -52,6 +54,7 @@ def main():
     args.update(parse_args().__dict__)
     for doc in get_yaml_docs():
         process_doc(doc)
+    write_index(args['outfile'])
 
 
 def process_doc(doc):
@@ -447,9 +450,27 @@ def write_test(test):
 
     byt = bytes(param['Arguments'](*arg))
     if byt not in testcases:
+        index.setdefault(test['function'], []).append(len(testcases))
         testcases.add(byt)
         write_signature(args['outfile'])
         args['outfile'].write(byt)
+        args['record_size'] = len(byt)
+
+
+def write_index(out):
+    """Write the index of the records of each function, and the footer locating it"""
+    if 'signature_written' not in args:
+        return
+    size = args['record_size']
+    byt = bytearray()
+    for function, records in sorted(index.items()):
+        byt.extend(bytes(function, 'utf_8')[:63].ljust(64, b'\0'))
+        byt.extend(struct.pack('=Q', len(records)))
+        byt.extend(struct.pack('=%dQ' % len(records), *records))
+    # Offset of the index after the signature and the records, and number of records
+    byt.extend(struct.pack('=QQ', 8 + size + 8 + len(testcases) * size, len(testcases)))
+    byt.extend(bytes("HIPindex", 'utf_8'))
+    out.write(byt)
 
 
 def instantiate(test):
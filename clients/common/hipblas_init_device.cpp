@@ -0,0 +1,239 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_init_device.hpp"
+#include "utility.h"
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+// SplitMix64 of the seed and the offset of an element, so that the elements are independent
+__device__ uint64_t hipblas_init_hash(uint64_t seed, uint64_t offset)
+{
+    uint64_t z = seed + (offset + 1) * 0x9e3779b97f4a7c15ull;
+    z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z          = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+__device__ void hipblas_init_store(float* A, double re, double)
+{
+    *A = re;
+}
+
+__device__ void hipblas_init_store(double* A, double re, double)
+{
+    *A = re;
+}
+
+__device__ void hipblas_init_store(int8_t* A, double re, double)
+{
+    *A = re == re ? int8_t(re) : 0;
+}
+
+__device__ void hipblas_init_store(int32_t* A, double re, double)
+{
+    *A = re == re ? int32_t(re) : 0;
+}
+
+__device__ void hipblas_init_store(hipFloatComplex* A, double re, double im)
+{
+    *A = make_hipFloatComplex(re, im);
+}
+
+__device__ void hipblas_init_store(hipDoubleComplex* A, double re, double im)
+{
+    *A = make_hipDoubleComplex(re, im);
+}
+
+// IEEE half and bfloat16 as in float_to_half and float_to_bfloat16
+struct hipblas_init_half
+{
+    uint16_t data;
+};
+
+struct hipblas_init_bfloat16
+{
+    uint16_t data;
+};
+
+__device__ void hipblas_init_store(hipblas_init_half* A, double re, double)
+{
+    A->data = __half_as_ushort(__float2half(float(re)));
+}
+
+__device__ void hipblas_init_store(hipblas_init_bfloat16* A, double re, double)
+{
+    uint32_t u = __float_as_uint(float(re));
+    if(re != re)
+        u = 0x7fc00000;
+    else
+        u += 0x7fff + ((u >> 16) & 1); // round to nearest even
+    A->data = u >> 16;
+}
+
+template <typename T>
+__global__ void hipblas_init_device_kernel(T*                     A,
+                                           hipblas_initialization init,
+                                           size_t                 M,
+                                           size_t                 N,
+                                           size_t                 lda,
+                                           hipblasStride          stride,
+                                           size_t                 batch_count,
+                                           uint64_t               seed,
+                                           bool                   use_cos,
+                                           bool                   alternating_sign,
+                                           bool                   nan,
+                                           bool                   small,
+                                           double                 diagonal,
+                                           double                 off_diagonal)
+{
+    size_t total = M * N * batch_count;
+    for(size_t e = size_t(blockIdx.x) * blockDim.x + threadIdx.x; e < total;
+        e += size_t(blockDim.x) * gridDim.x)
+    {
+        size_t i      = e % M;
+        size_t j      = e / M % N;
+        size_t b      = e / (M * N);
+        size_t offset = i + j * lda + b * stride;
+
+        double re, im;
+        if(nan)
+        {
+            re = im = __builtin_nan("");
+        }
+        else if(init == hipblas_initialization::trig_float)
+        {
+            re = use_cos ? cos(double(offset)) : sin(double(offset));
+            im = 0;
+        }
+        else if(init == hipblas_initialization::hpl)
+        {
+            re = (hipblas_init_hash(seed, offset) >> 11) * 0x1.0p-53 - 0.5;
+            im = 0;
+        }
+        else
+        {
+            int range = small ? 3 : 10;
+            re        = double(hipblas_init_hash(seed, 2 * offset) % range + 1);
+            im        = double(hipblas_init_hash(seed, 2 * offset + 1) % range + 1);
+        }
+
+        if(alternating_sign && !nan && init != hipblas_initialization::trig_float
+           && !((i ^ j) & 1))
+        {
+            re = -re;
+            im = -im;
+        }
+        re += i == j ? diagonal : off_diagonal;
+
+        hipblas_init_store(A + offset, re, im);
+    }
+}
+
+template <typename T>
+static void hipblas_init_device_launch(void*                  A,
+                                       hipblas_initialization init,
+                                       size_t                 M,
+                                       size_t                 N,
+                                       size_t                 lda,
+                                       hipblasStride          stride,
+                                       size_t                 batch_count,
+                                       uint32_t               seed,
+                                       bool                   use_cos,
+                                       bool                   alternating_sign,
+                                       bool                   nan,
+                                       double                 diagonal,
+                                       double                 off_diagonal,
+                                       bool                   small = false)
+{
+    constexpr int block  = 256;
+    size_t        total  = M * N * batch_count;
+    int           blocks = int(std::min<size_t>((total + block - 1) / block, 65536));
+    hipLaunchKernelGGL(hipblas_init_device_kernel<T>,
+                       dim3(blocks),
+                       dim3(block),
+                       0,
+                       0,
+                       (T*)A,
+                       init,
+                       M,
+                       N,
+                       lda,
+                       stride,
+                       batch_count,
+                       seed,
+                       use_cos,
+                       alternating_sign,
+                       nan,
+                       small,
+                       diagonal,
+                       off_diagonal);
+    CHECK_HIP_ERROR(hipGetLastError());
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+}
+
+void hipblas_init_device(void*                  A,
+                         hipblasDatatype_t      type,
+                         hipblas_initialization init,
+                         size_t                 M,
+                         size_t                 N,
+                         size_t                 lda,
+                         hipblasStride          stride,
+                         size_t                 batch_count,
+                         uint32_t               seed,
+                         bool                   use_cos,
+                         bool                   alternating_sign,
+                         bool                   nan,
+                         double                 diagonal,
+                         double                 off_diagonal)
+{
+    if(!A || !M || !N || !batch_count)
+        return;
+
+#define HIPBLAS_INIT_DEVICE_ARGS                                                            \
+    A, init, M, N, lda, stride, batch_count, seed, use_cos, alternating_sign, nan, diagonal, \
+        off_diagonal
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+        return hipblas_init_device_launch<hipblas_init_half>(HIPBLAS_INIT_DEVICE_ARGS, true);
+    case HIPBLAS_R_16B:
+        return hipblas_init_device_launch<hipblas_init_bfloat16>(HIPBLAS_INIT_DEVICE_ARGS, true);
+    case HIPBLAS_R_32F:
+        return hipblas_init_device_launch<float>(HIPBLAS_INIT_DEVICE_ARGS);
+    case HIPBLAS_R_64F:
+        return hipblas_init_device_launch<double>(HIPBLAS_INIT_DEVICE_ARGS);
+    case HIPBLAS_C_32F:
+        return hipblas_init_device_launch<hipFloatComplex>(HIPBLAS_INIT_DEVICE_ARGS);
+    case HIPBLAS_C_64F:
+        return hipblas_init_device_launch<hipDoubleComplex>(HIPBLAS_INIT_DEVICE_ARGS);
+    case HIPBLAS_R_8I:
+        return hipblas_init_device_launch<int8_t>(HIPBLAS_INIT_DEVICE_ARGS);
+    case HIPBLAS_R_32I:
+        return hipblas_init_device_launch<int32_t>(HIPBLAS_INIT_DEVICE_ARGS);
+    default:
+        throw std::invalid_argument(std::string("hipblas_init_device does not support ")
+                                    + hipblas_datatype2string(type));
+    }
+#undef HIPBLAS_INIT_DEVICE_ARGS
+}
@@ -28,15 +28,74 @@
 #include <cstdlib>
 #include <cstring>
 #include <fcntl.h>
+#include <fstream>
 #include <iostream>
+#include <random>
+#include <regex>
 #include <string>
 #include <sys/types.h>
 
-// Parse YAML data
-static std::string hipblas_parse_yaml(const std::string& yaml)
+// FNV-1a hash of the bytes of a file, with the includes of YAML files expanded as
+// hipblas_gentest.py expands them. Returns false if a file or an include cannot be read.
+static bool hipblas_hash_file(uint64_t& key, const fs::path& path, bool yaml)
 {
-    std::string tmp     = hipblas_tempname();
-    auto        exepath = hipblas_exepath();
+    std::ifstream file(path, std::ios::binary);
+    if(!file)
+        return false;
+
+    static const std::regex include_re(R"(include\s*:\s*(.*))");
+    std::smatch             match;
+    for(std::string line; std::getline(file, line);)
+    {
+        if(yaml && line.rfind("include", 0) == 0 && std::regex_match(line, match, include_re))
+        {
+            if(!hipblas_hash_file(key, path.parent_path() / match[1].str(), true))
+                return false;
+            continue;
+        }
+        line += '\n';
+        for(unsigned char c : line)
+            key = (key ^ c) * 0x100000001b3;
+    }
+    return true;
+}
+
+// Path of the data expanded from yaml in the directory named by HIPBLAS_CLIENT_YAML_CACHE, keyed by
+// the contents of yaml, its includes, the template and the generator. Empty if it is not set.
+static std::string hipblas_yaml_cache_path(const std::string& yaml, const std::string& exepath)
+{
+    // Pipes such as /dev/stdin can only be read once, by hipblas_gentest.py
+    const char* cache_dir = std::getenv("HIPBLAS_CLIENT_YAML_CACHE");
+    if(!cache_dir || !*cache_dir || !fs::is_regular_file(yaml))
+        return "";
+
+    uint64_t key = 0xcbf29ce484222325; // FNV-1a offset basis
+#ifdef HIPBLAS_V2
+    key = (key ^ 2) * 0x100000001b3;
+#endif
+    if(!hipblas_hash_file(key, exepath + "hipblas_gentest.py", false)
+       || !hipblas_hash_file(key, exepath + "hipblas_template.yaml", true)
+       || !hipblas_hash_file(key, yaml, true))
+        return "";
+
+    char name[32];
+    snprintf(name, sizeof(name), "/%016llx.dat", (unsigned long long)key);
+    return cache_dir + std::string(name);
+}
+
+// Parse YAML data, returning the data file and whether it is temporary
+static std::string hipblas_parse_yaml(const std::string& yaml, bool& temporary)
+{
+    auto exepath = hipblas_exepath();
+
+    // Data in the cache was written completely before being renamed there
+    std::string cached = hipblas_yaml_cache_path(yaml, exepath);
+    temporary          = cached.empty();
+    if(!temporary && fs::exists(cached))
+        return cached;
+
+    std::string tmp = temporary ? hipblas_tempname()
+                                : cached + "." + std::to_string(std::random_device{}());
 #ifdef HIPBLAS_V2
     auto cmd = exepath + "hipblas_gentest.py --hipblas_v2 --template " + exepath
                + "hipblas_template.yaml -o " + tmp + " " + yaml;
@@ -56,20 +115,36 @@ static std::string hipblas_parse_yaml(const std::string& yaml)
         exit(EXIT_FAILURE);
 #endif
 
+    if(!temporary)
+    {
+        // On failure, use the new data once and leave the cache as it is
+        if(!std::rename(tmp.c_str(), cached.c_str()))
+            return cached;
+        temporary = true;
+    }
     return tmp;
 }
 
-// Parse --data and --yaml command-line arguments
+// Parse --data, --yaml and --data_filter command-line arguments
 bool hipblas_parse_data(int& argc, char** argv, const std::string& default_file)
 {
-    std::string filename;
+    std::string filename, filter;
     char**      argv_p = argv + 1;
     bool        help = false, yaml = false;
 
-    // Scan, process and remove any --yaml or --data options
+    // Scan, process and remove any --yaml, --data or --data_filter options
     for(int i = 1; argv[i]; ++i)
     {
-        if(!strcmp(argv[i], "--data") || !strcmp(argv[i], "--yaml"))
+        if(!strcmp(argv[i], "--data_filter"))
+        {
+            if(!argv[i + 1] || !argv[i + 1][0])
+            {
+                std::cerr << "The " << argv[i] << " option requires an argument" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            filter = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--data") || !strcmp(argv[i], "--yaml"))
         {
             if(!strcmp(argv[i], "--yaml"))
             {
@@ -97,7 +172,9 @@ bool hipblas_parse_data(int& argc, char** argv, const std::string& default_file)
             {
                 help = true;
                 std::cout << "\n"
-                          << argv[0] << " [ --data <path> | --yaml <path> ] <options> ...\n"
+                          << argv[0]
+                          << " [ --data <path> | --yaml <path> ] [ --data_filter <functions> ]"
+                             " <options> ...\n"
                           << std::endl;
             }
         }
@@ -112,12 +189,14 @@ bool hipblas_parse_data(int& argc, char** argv, const std::string& default_file)
     else if(filename == "")
         filename = default_file;
 
+    bool temporary = false;
     if(yaml)
-        filename = hipblas_parse_yaml(filename);
+        filename = hipblas_parse_yaml(filename, temporary);
 
     if(filename != "")
     {
-        HipBLAS_TestData::set_filename(filename, yaml);
+        HipBLAS_TestData::set_filename(filename, temporary);
+        HipBLAS_TestData::set_function_filter(filter);
         return true;
     }
 
@@ -9578,6 +9578,217 @@ hipblasStatus_t hipblasGeamStridedBatched(hipblasHandle_t             handle,
                                       batchCount);
 }
 
+// xtgemm
+template <>
+hipblasStatus_t hipblasXtGemm<float>(hipblasXtHandle_t  handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     size_t             m,
+                                     size_t             n,
+                                     size_t             k,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     size_t             lda,
+                                     const float*       B,
+                                     size_t             ldb,
+                                     const float*       beta,
+                                     float*             C,
+                                     size_t             ldc)
+{
+    return hipblasXtSgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm<double>(hipblasXtHandle_t  handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      size_t             m,
+                                      size_t             n,
+                                      size_t             k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      size_t             lda,
+                                      const double*      B,
+                                      size_t             ldb,
+                                      const double*      beta,
+                                      double*            C,
+                                      size_t             ldc)
+{
+    return hipblasXtDgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm<hipblasComplex>(hipblasXtHandle_t     handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              size_t                m,
+                                              size_t                n,
+                                              size_t                k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              size_t                lda,
+                                              const hipblasComplex* B,
+                                              size_t                ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              size_t                ldc)
+{
+    return hipblasXtCgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm<hipblasDoubleComplex>(hipblasXtHandle_t           handle,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    size_t                      m,
+                                                    size_t                      n,
+                                                    size_t                      k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    size_t                      lda,
+                                                    const hipblasDoubleComplex* B,
+                                                    size_t                      ldb,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    size_t                      ldc)
+{
+    return hipblasXtZgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// xtsyrk
+template <>
+hipblasStatus_t hipblasXtSyrk<float>(hipblasXtHandle_t  handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     size_t             n,
+                                     size_t             k,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     size_t             lda,
+                                     const float*       beta,
+                                     float*             C,
+                                     size_t             ldc)
+{
+    return hipblasXtSsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk<double>(hipblasXtHandle_t  handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      size_t             n,
+                                      size_t             k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      size_t             lda,
+                                      const double*      beta,
+                                      double*            C,
+                                      size_t             ldc)
+{
+    return hipblasXtDsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk<hipblasComplex>(hipblasXtHandle_t     handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              size_t                n,
+                                              size_t                k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              size_t                lda,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              size_t                ldc)
+{
+    return hipblasXtCsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk<hipblasDoubleComplex>(hipblasXtHandle_t           handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    size_t                      n,
+                                                    size_t                      k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    size_t                      lda,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    size_t                      ldc)
+{
+    return hipblasXtZsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+// xttrsm
+template <>
+hipblasStatus_t hipblasXtTrsm<float>(hipblasXtHandle_t  handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     size_t             m,
+                                     size_t             n,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     size_t             lda,
+                                     float*             B,
+                                     size_t             ldb)
+{
+    return hipblasXtStrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasXtTrsm<double>(hipblasXtHandle_t  handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      size_t             m,
+                                      size_t             n,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      size_t             lda,
+                                      double*            B,
+                                      size_t             ldb)
+{
+    return hipblasXtDtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasXtTrsm<hipblasComplex>(hipblasXtHandle_t     handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              size_t                m,
+                                              size_t                n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              size_t                lda,
+                                              hipblasComplex*       B,
+                                              size_t                ldb)
+{
+    return hipblasXtCtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasXtTrsm<hipblasDoubleComplex>(hipblasXtHandle_t           handle,
+                                                    hipblasSideMode_t           side,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasDiagType_t           diag,
+                                                    size_t                      m,
+                                                    size_t                      n,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    size_t                      lda,
+                                                    hipblasDoubleComplex*       B,
+                                                    size_t                      ldb)
+{
+    return hipblasXtZtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
 #ifdef __HIP_PLATFORM_SOLVER__
 
 // getrf
@@ -9983,6 +10194,132 @@ hipblasStatus_t hipblasGetriBatched<hipblasDoubleComplex>(hipblasHandle_t
     return hipblasZgetriBatched(handle, n, A, lda, ipiv, C, ldc, info, batchCount);
 }
 
+// getri_strided_batched
+template <>
+hipblasStatus_t hipblasGetriStridedBatched<float>(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  float*              A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  float*              C,
+                                                  const int           ldc,
+                                                  const hipblasStride strideC,
+                                                  int*                info,
+                                                  const int           batchCount)
+{
+    return hipblasSgetriStridedBatched(
+        handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetriStridedBatched<double>(hipblasHandle_t     handle,
+                                                   const int           n,
+                                                   double*             A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   int*                ipiv,
+                                                   const hipblasStride strideP,
+                                                   double*             C,
+                                                   const int           ldc,
+                                                   const hipblasStride strideC,
+                                                   int*                info,
+                                                   const int           batchCount)
+{
+    return hipblasDgetriStridedBatched(
+        handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetriStridedBatched<hipblasComplex>(hipblasHandle_t     handle,
+                                                           const int           n,
+                                                           hipblasComplex*     A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           int*                ipiv,
+                                                           const hipblasStride strideP,
+                                                           hipblasComplex*     C,
+                                                           const int           ldc,
+                                                           const hipblasStride strideC,
+                                                           int*                info,
+                                                           const int           batchCount)
+{
+    return hipblasCgetriStridedBatched(
+        handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetriStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                 const int             n,
+                                                                 hipblasDoubleComplex* A,
+                                                                 const int             lda,
+                                                                 const hipblasStride   strideA,
+                                                                 int*                  ipiv,
+                                                                 const hipblasStride   strideP,
+                                                                 hipblasDoubleComplex* C,
+                                                                 const int             ldc,
+                                                                 const hipblasStride   strideC,
+                                                                 int*                  info,
+                                                                 const int             batchCount)
+{
+    return hipblasZgetriStridedBatched(
+        handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, info, batchCount);
+}
+
+// matinv_batched
+template <>
+hipblasStatus_t hipblasMatinvBatched<float>(hipblasHandle_t    handle,
+                                            const int          n,
+                                            const float* const A[],
+                                            const int          lda,
+                                            float* const       Ainv[],
+                                            const int          lda_inv,
+                                            int*               info,
+                                            const int          batchCount)
+{
+    return hipblasSmatinvBatched(handle, n, A, lda, Ainv, lda_inv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasMatinvBatched<double>(hipblasHandle_t     handle,
+                                             const int           n,
+                                             const double* const A[],
+                                             const int           lda,
+                                             double* const       Ainv[],
+                                             const int           lda_inv,
+                                             int*                info,
+                                             const int           batchCount)
+{
+    return hipblasDmatinvBatched(handle, n, A, lda, Ainv, lda_inv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasMatinvBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                     const int                   n,
+                                                     const hipblasComplex* const A[],
+                                                     const int                   lda,
+                                                     hipblasComplex* const       Ainv[],
+                                                     const int                   lda_inv,
+                                                     int*                        info,
+                                                     const int                   batchCount)
+{
+    return hipblasCmatinvBatched(handle, n, A, lda, Ainv, lda_inv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasMatinvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                           const int                         n,
+                                                           const hipblasDoubleComplex* const A[],
+                                                           const int                         lda,
+                                                           hipblasDoubleComplex* const       Ainv[],
+                                                           const int                         lda_inv,
+                                                           int*                              info,
+                                                           const int                         batchCount)
+{
+    return hipblasZmatinvBatched(handle, n, A, lda, Ainv, lda_inv, info, batchCount);
+}
+
 // geqrf
 template <>
 hipblasStatus_t hipblasGeqrf<float>(hipblasHandle_t handle,
@@ -10369,758 +10706,3261 @@ hipblasStatus_t hipblasGelsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
         handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
 }
 
-#endif
+// geqrsBatched
+template <>
+hipblasStatus_t hipblasGeqrsBatched<float>(hipblasHandle_t handle,
+                                           const int       factorize,
+                                           const int       m,
+                                           const int       n,
+                                           const int       nrhs,
+                                           float* const    A[],
+                                           const int       lda,
+                                           float* const    tau[],
+                                           float* const    B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           const int       batchCount)
+{
+    return hipblasSgeqrsBatched(
+        handle, factorize, m, n, nrhs, A, lda, tau, B, ldb, info, batchCount);
+}
 
-/////////////
-// FORTRAN //
-/////////////
-// axpy
 template <>
-hipblasStatus_t hipblasAxpy<hipblasHalf, true>(hipblasHandle_t    handle,
-                                               int                n,
-                                               const hipblasHalf* alpha,
-                                               const hipblasHalf* x,
-                                               int                incx,
-                                               hipblasHalf*       y,
-                                               int                incy)
+hipblasStatus_t hipblasGeqrsBatched<double>(hipblasHandle_t handle,
+                                            const int       factorize,
+                                            const int       m,
+                                            const int       n,
+                                            const int       nrhs,
+                                            double* const   A[],
+                                            const int       lda,
+                                            double* const   tau[],
+                                            double* const   B[],
+                                            const int       ldb,
+                                            int*            info,
+                                            const int       batchCount)
 {
-    return hipblasHaxpyFortran(handle, n, alpha, x, incx, y, incy);
+    return hipblasDgeqrsBatched(
+        handle, factorize, m, n, nrhs, A, lda, tau, B, ldb, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasAxpy<float, true>(
-    hipblasHandle_t handle, int n, const float* alpha, const float* x, int incx, float* y, int incy)
+hipblasStatus_t hipblasGeqrsBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                    const int             factorize,
+                                                    const int             m,
+                                                    const int             n,
+                                                    const int             nrhs,
+                                                    hipblasComplex* const A[],
+                                                    const int             lda,
+                                                    hipblasComplex* const tau[],
+                                                    hipblasComplex* const B[],
+                                                    const int             ldb,
+                                                    int*                  info,
+                                                    const int             batchCount)
 {
-    return hipblasSaxpyFortran(handle, n, alpha, x, incx, y, incy);
+    return hipblasCgeqrsBatched(
+        handle, factorize, m, n, nrhs, A, lda, tau, B, ldb, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasAxpy<double, true>(hipblasHandle_t handle,
-                                          int             n,
-                                          const double*   alpha,
-                                          const double*   x,
-                                          int             incx,
-                                          double*         y,
-                                          int             incy)
+hipblasStatus_t hipblasGeqrsBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const int                   factorize,
+                                                          const int                   m,
+                                                          const int                   n,
+                                                          const int                   nrhs,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          hipblasDoubleComplex* const tau[],
+                                                          hipblasDoubleComplex* const B[],
+                                                          const int                   ldb,
+                                                          int*                        info,
+                                                          const int                   batchCount)
 {
-    return hipblasDaxpyFortran(handle, n, alpha, x, incx, y, incy);
+    return hipblasZgeqrsBatched(
+        handle, factorize, m, n, nrhs, A, lda, tau, B, ldb, info, batchCount);
 }
 
+// geqrsStridedBatched
 template <>
-hipblasStatus_t hipblasAxpy<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                  int                   n,
-                                                  const hipblasComplex* alpha,
-                                                  const hipblasComplex* x,
-                                                  int                   incx,
-                                                  hipblasComplex*       y,
-                                                  int                   incy)
+hipblasStatus_t hipblasGeqrsStridedBatched<float>(hipblasHandle_t     handle,
+                                                  const int           factorize,
+                                                  const int           m,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  float*              A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  float*              tau,
+                                                  const hipblasStride strideT,
+                                                  float*              B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount)
 {
-    return hipblasCaxpyFortran(handle, n, alpha, x, incx, y, incy);
+    return hipblasSgeqrsStridedBatched(handle,
+                                       factorize,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       tau,
+                                       strideT,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasAxpy<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                        int                         n,
-                                                        const hipblasDoubleComplex* alpha,
-                                                        const hipblasDoubleComplex* x,
-                                                        int                         incx,
-                                                        hipblasDoubleComplex*       y,
-                                                        int                         incy)
+hipblasStatus_t hipblasGeqrsStridedBatched<double>(hipblasHandle_t     handle,
+                                                   const int           factorize,
+                                                   const int           m,
+                                                   const int           n,
+                                                   const int           nrhs,
+                                                   double*             A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   double*             tau,
+                                                   const hipblasStride strideT,
+                                                   double*             B,
+                                                   const int           ldb,
+                                                   const hipblasStride strideB,
+                                                   int*                info,
+                                                   const int           batchCount)
 {
-    return hipblasZaxpyFortran(handle, n, alpha, x, incx, y, incy);
+    return hipblasDgeqrsStridedBatched(handle,
+                                       factorize,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       tau,
+                                       strideT,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
 }
 
-// axpy_batched
 template <>
-hipblasStatus_t hipblasAxpyBatched<hipblasHalf, true>(hipblasHandle_t          handle,
-                                                      int                      n,
-                                                      const hipblasHalf*       alpha,
-                                                      const hipblasHalf* const x[],
-                                                      int                      incx,
-                                                      hipblasHalf* const       y[],
-                                                      int                      incy,
-                                                      int                      batch_count)
+hipblasStatus_t hipblasGeqrsStridedBatched<hipblasComplex>(hipblasHandle_t     handle,
+                                                           const int           factorize,
+                                                           const int           m,
+                                                           const int           n,
+                                                           const int           nrhs,
+                                                           hipblasComplex*     A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           hipblasComplex*     tau,
+                                                           const hipblasStride strideT,
+                                                           hipblasComplex*     B,
+                                                           const int           ldb,
+                                                           const hipblasStride strideB,
+                                                           int*                info,
+                                                           const int           batchCount)
 {
-    return hipblasHaxpyBatchedFortran(handle, n, alpha, x, incx, y, incy, batch_count);
+    return hipblasCgeqrsStridedBatched(handle,
+                                       factorize,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       tau,
+                                       strideT,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasAxpyBatched<float, true>(hipblasHandle_t    handle,
-                                                int                n,
-                                                const float*       alpha,
-                                                const float* const x[],
-                                                int                incx,
-                                                float* const       y[],
-                                                int                incy,
-                                                int                batch_count)
+hipblasStatus_t hipblasGeqrsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                 const int             factorize,
+                                                                 const int             m,
+                                                                 const int             n,
+                                                                 const int             nrhs,
+                                                                 hipblasDoubleComplex* A,
+                                                                 const int             lda,
+                                                                 const hipblasStride   strideA,
+                                                                 hipblasDoubleComplex* tau,
+                                                                 const hipblasStride   strideT,
+                                                                 hipblasDoubleComplex* B,
+                                                                 const int             ldb,
+                                                                 const hipblasStride   strideB,
+                                                                 int*                  info,
+                                                                 const int             batchCount)
 {
-    return hipblasSaxpyBatchedFortran(handle, n, alpha, x, incx, y, incy, batch_count);
+    return hipblasZgeqrsStridedBatched(handle,
+                                       factorize,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       tau,
+                                       strideT,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
 }
 
+// gesvBatched
 template <>
-hipblasStatus_t hipblasAxpyBatched<double, true>(hipblasHandle_t     handle,
-                                                 int                 n,
-                                                 const double*       alpha,
-                                                 const double* const x[],
-                                                 int                 incx,
-                                                 double* const       y[],
-                                                 int                 incy,
-                                                 int                 batch_count)
+hipblasStatus_t hipblasGesvBatched<float>(hipblasHandle_t handle,
+                                          const int       n,
+                                          const int       nrhs,
+                                          float* const    A[],
+                                          const int       lda,
+                                          int*            ipiv,
+                                          float* const    B[],
+                                          const int       ldb,
+                                          int*            info,
+                                          const int       batchCount)
 {
-    return hipblasDaxpyBatchedFortran(handle, n, alpha, x, incx, y, incy, batch_count);
+    return hipblasSgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasAxpyBatched<hipblasComplex, true>(hipblasHandle_t             handle,
-                                                         int                         n,
-                                                         const hipblasComplex*       alpha,
-                                                         const hipblasComplex* const x[],
-                                                         int                         incx,
-                                                         hipblasComplex* const       y[],
-                                                         int                         incy,
-                                                         int                         batch_count)
+hipblasStatus_t hipblasGesvBatched<double>(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       nrhs,
+                                           double* const   A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           double* const   B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           const int       batchCount)
 {
-    return hipblasCaxpyBatchedFortran(handle, n, alpha, x, incx, y, incy, batch_count);
+    return hipblasDgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
 }
 
 template <>
-hipblasStatus_t
-    hipblasAxpyBatched<hipblasDoubleComplex, true>(hipblasHandle_t                   handle,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   hipblasDoubleComplex* const       y[],
-                                                   int                               incy,
-                                                   int                               batch_count)
+hipblasStatus_t hipblasGesvBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   const int             nrhs,
+                                                   hipblasComplex* const A[],
+                                                   const int             lda,
+                                                   int*                  ipiv,
+                                                   hipblasComplex* const B[],
+                                                   const int             ldb,
+                                                   int*                  info,
+                                                   const int             batchCount)
 {
-    return hipblasZaxpyBatchedFortran(handle, n, alpha, x, incx, y, incy, batch_count);
+    return hipblasCgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
 }
 
-// axpy_strided_batched
 template <>
-hipblasStatus_t hipblasAxpyStridedBatched<hipblasHalf, true>(hipblasHandle_t    handle,
-                                                             int                n,
-                                                             const hipblasHalf* alpha,
-                                                             const hipblasHalf* x,
-                                                             int                incx,
-                                                             hipblasStride      stridex,
-                                                             hipblasHalf*       y,
-                                                             int                incy,
-                                                             hipblasStride      stridey,
-                                                             int                batch_count)
+hipblasStatus_t hipblasGesvBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         const int                   n,
+                                                         const int                   nrhs,
+                                                         hipblasDoubleComplex* const A[],
+                                                         const int                   lda,
+                                                         int*                        ipiv,
+                                                         hipblasDoubleComplex* const B[],
+                                                         const int                   ldb,
+                                                         int*                        info,
+                                                         const int                   batchCount)
 {
-    return hipblasHaxpyStridedBatchedFortran(
-        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasZgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
 }
 
+// gesvStridedBatched
 template <>
-hipblasStatus_t hipblasAxpyStridedBatched<float, true>(hipblasHandle_t handle,
-                                                       int             n,
-                                                       const float*    alpha,
-                                                       const float*    x,
-                                                       int             incx,
-                                                       hipblasStride   stridex,
-                                                       float*          y,
-                                                       int             incy,
-                                                       hipblasStride   stridey,
-                                                       int             batch_count)
+hipblasStatus_t hipblasGesvStridedBatched<float>(hipblasHandle_t     handle,
+                                                 const int           n,
+                                                 const int           nrhs,
+                                                 float*              A,
+                                                 const int           lda,
+                                                 const hipblasStride strideA,
+                                                 int*                ipiv,
+                                                 const hipblasStride strideP,
+                                                 float*              B,
+                                                 const int           ldb,
+                                                 const hipblasStride strideB,
+                                                 int*                info,
+                                                 const int           batchCount)
 {
-    return hipblasSaxpyStridedBatchedFortran(
-        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasSgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasAxpyStridedBatched<double, true>(hipblasHandle_t handle,
-                                                        int             n,
-                                                        const double*   alpha,
-                                                        const double*   x,
-                                                        int             incx,
-                                                        hipblasStride   stridex,
-                                                        double*         y,
-                                                        int             incy,
-                                                        hipblasStride   stridey,
-                                                        int             batch_count)
+hipblasStatus_t hipblasGesvStridedBatched<double>(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  double*             A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  double*             B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount)
 {
-    return hipblasDaxpyStridedBatchedFortran(
-        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasDgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasAxpyStridedBatched<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                                int                   n,
-                                                                const hipblasComplex* alpha,
-                                                                const hipblasComplex* x,
-                                                                int                   incx,
-                                                                hipblasStride         stridex,
-                                                                hipblasComplex*       y,
-                                                                int                   incy,
-                                                                hipblasStride         stridey,
-                                                                int                   batch_count)
+hipblasStatus_t hipblasGesvStridedBatched<hipblasComplex>(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          const int           nrhs,
+                                                          hipblasComplex*     A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          int*                ipiv,
+                                                          const hipblasStride strideP,
+                                                          hipblasComplex*     B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          const int           batchCount)
 {
-    return hipblasCaxpyStridedBatchedFortran(
-        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasCgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
 }
 
 template <>
-hipblasStatus_t
-    hipblasAxpyStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          hipblasDoubleComplex*       y,
-                                                          int                         incy,
-                                                          hipblasStride               stridey,
-                                                          int                         batch_count)
+hipblasStatus_t hipblasGesvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                const int             n,
+                                                                const int             nrhs,
+                                                                hipblasDoubleComplex* A,
+                                                                const int             lda,
+                                                                const hipblasStride   strideA,
+                                                                int*                  ipiv,
+                                                                const hipblasStride   strideP,
+                                                                hipblasDoubleComplex* B,
+                                                                const int             ldb,
+                                                                const hipblasStride   strideB,
+                                                                int*                  info,
+                                                                const int             batchCount)
 {
-    return hipblasZaxpyStridedBatchedFortran(
-        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasZgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
 }
 
-// scal
+// potrf
 template <>
-hipblasStatus_t hipblasScal<float, float, true>(
-    hipblasHandle_t handle, int n, const float* alpha, float* x, int incx)
+hipblasStatus_t hipblasPotrf<float>(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    float*                  A,
+                                    const int               lda,
+                                    int*                    info)
 {
-    return hipblasSscalFortran(handle, n, alpha, x, incx);
+    return hipblasSpotrf(handle, uplo, n, A, lda, info);
 }
 
 template <>
-hipblasStatus_t hipblasScal<double, double, true>(
-    hipblasHandle_t handle, int n, const double* alpha, double* x, int incx)
+hipblasStatus_t hipblasPotrf<double>(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info)
 {
-    return hipblasDscalFortran(handle, n, alpha, x, incx);
+    return hipblasDpotrf(handle, uplo, n, A, lda, info);
 }
 
 template <>
-hipblasStatus_t hipblasScal<hipblasComplex, hipblasComplex, true>(
-    hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
+hipblasStatus_t hipblasPotrf<hipblasComplex>(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info)
 {
-    return hipblasCscalFortran(handle, n, alpha, x, incx);
+    return hipblasCpotrf(handle, uplo, n, A, lda, info);
 }
 
 template <>
-hipblasStatus_t hipblasScal<hipblasComplex, float, true>(
-    hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx)
+hipblasStatus_t hipblasPotrf<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   int*                    info)
 {
-    return hipblasCsscalFortran(handle, n, alpha, x, incx);
+    return hipblasZpotrf(handle, uplo, n, A, lda, info);
 }
 
+// potrfBatched
 template <>
-hipblasStatus_t
-    hipblasScal<hipblasDoubleComplex, hipblasDoubleComplex, true>(hipblasHandle_t handle,
-                                                                  int             n,
-                                                                  const hipblasDoubleComplex* alpha,
-                                                                  hipblasDoubleComplex*       x,
-                                                                  int                         incx)
+hipblasStatus_t hipblasPotrfBatched<float>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           float* const            A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount)
 {
-    return hipblasZscalFortran(handle, n, alpha, x, incx);
+    return hipblasSpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasScal<hipblasDoubleComplex, double, true>(
-    hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
+hipblasStatus_t hipblasPotrfBatched<double>(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount)
 {
-    return hipblasZdscalFortran(handle, n, alpha, x, incx);
+    return hipblasDpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
-// scal_batched
 template <>
-hipblasStatus_t hipblasScalBatched<float, float, true>(
-    hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batch_count)
+hipblasStatus_t hipblasPotrfBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount)
 {
-    return hipblasSscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+    return hipblasCpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasScalBatched<double, double, true>(hipblasHandle_t handle,
-                                                         int             n,
-                                                         const double*   alpha,
-                                                         double* const   x[],
-                                                         int             incx,
-                                                         int             batch_count)
+hipblasStatus_t hipblasPotrfBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const hipblasFillMode_t     uplo,
+                                                          const int                   n,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          int*                        info,
+                                                          const int                   batchCount)
 {
-    return hipblasDscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+    return hipblasZpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
+// potrfStridedBatched
 template <>
-hipblasStatus_t
-    hipblasScalBatched<hipblasComplex, hipblasComplex, true>(hipblasHandle_t       handle,
-                                                             int                   n,
-                                                             const hipblasComplex* alpha,
-                                                             hipblasComplex* const x[],
-                                                             int                   incx,
-                                                             int                   batch_count)
+hipblasStatus_t hipblasPotrfStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  int*                    info,
+                                                  const int               batchCount)
 {
-    return hipblasCscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+    return hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasScalBatched<hipblasDoubleComplex, hipblasDoubleComplex, true>(
-    hipblasHandle_t             handle,
-    int                         n,
-    const hipblasDoubleComplex* alpha,
-    hipblasDoubleComplex* const x[],
-    int                         incx,
-    int                         batch_count)
+hipblasStatus_t hipblasPotrfStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount)
 {
-    return hipblasZscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+    return hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasScalBatched<hipblasComplex, float, true>(hipblasHandle_t       handle,
-                                                                int                   n,
-                                                                const float*          alpha,
-                                                                hipblasComplex* const x[],
-                                                                int                   incx,
-                                                                int                   batch_count)
+hipblasStatus_t hipblasPotrfStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount)
 {
-    return hipblasCsscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+    return hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
 }
 
 template <>
-hipblasStatus_t
-    hipblasScalBatched<hipblasDoubleComplex, double, true>(hipblasHandle_t             handle,
-                                                           int                         n,
-                                                           const double*               alpha,
-                                                           hipblasDoubleComplex* const x[],
-                                                           int                         incx,
-                                                           int                         batch_count)
+hipblasStatus_t hipblasPotrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 hipblasDoubleComplex*   A,
+                                                                 const int               lda,
+                                                                 const hipblasStride     strideA,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
 {
-    return hipblasZdscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+    return hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
 }
 
-// scal_strided_batched
+// potrs
 template <>
-hipblasStatus_t hipblasScalStridedBatched<float, float, true>(hipblasHandle_t handle,
-                                                              int             n,
-                                                              const float*    alpha,
-                                                              float*          x,
-                                                              int             incx,
-                                                              hipblasStride   stridex,
-                                                              int             batch_count)
+hipblasStatus_t hipblasPotrs<float>(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    float*                  A,
+                                    const int               lda,
+                                    float*                  B,
+                                    const int               ldb,
+                                    int*                    info)
 {
-    return hipblasSscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
 template <>
-hipblasStatus_t hipblasScalStridedBatched<double, double, true>(hipblasHandle_t handle,
-                                                                int             n,
-                                                                const double*   alpha,
-                                                                double*         x,
-                                                                int             incx,
-                                                                hipblasStride   stridex,
-                                                                int             batch_count)
+hipblasStatus_t hipblasPotrs<double>(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double*                 A,
+                                     const int               lda,
+                                     double*                 B,
+                                     const int               ldb,
+                                     int*                    info)
 {
-    return hipblasDscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
 template <>
-hipblasStatus_t
-    hipblasScalStridedBatched<hipblasComplex, hipblasComplex, true>(hipblasHandle_t       handle,
-                                                                    int                   n,
-                                                                    const hipblasComplex* alpha,
-                                                                    hipblasComplex*       x,
-                                                                    int                   incx,
-                                                                    hipblasStride         stridex,
-                                                                    int batch_count)
+hipblasStatus_t hipblasPotrs<hipblasComplex>(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             hipblasComplex*         B,
+                                             const int               ldb,
+                                             int*                    info)
 {
-    return hipblasCscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
 template <>
-hipblasStatus_t hipblasScalStridedBatched<hipblasDoubleComplex, hipblasDoubleComplex, true>(
-    hipblasHandle_t             handle,
-    int                         n,
-    const hipblasDoubleComplex* alpha,
-    hipblasDoubleComplex*       x,
-    int                         incx,
-    hipblasStride               stridex,
-    int                         batch_count)
+hipblasStatus_t hipblasPotrs<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   hipblasDoubleComplex*   B,
+                                                   const int               ldb,
+                                                   int*                    info)
 {
-    return hipblasZscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
+// potrsBatched
 template <>
-hipblasStatus_t hipblasScalStridedBatched<hipblasComplex, float, true>(hipblasHandle_t handle,
-                                                                       int             n,
-                                                                       const float*    alpha,
-                                                                       hipblasComplex* x,
-                                                                       int             incx,
-                                                                       hipblasStride   stridex,
-                                                                       int             batch_count)
+hipblasStatus_t hipblasPotrsBatched<float>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           float* const            A[],
+                                           const int               lda,
+                                           float* const            B[],
+                                           const int               ldb,
+                                           int*                    info,
+                                           const int               batchCount)
 {
-    return hipblasCsscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
 }
 
 template <>
-hipblasStatus_t
-    hipblasScalStridedBatched<hipblasDoubleComplex, double, true>(hipblasHandle_t       handle,
-                                                                  int                   n,
-                                                                  const double*         alpha,
-                                                                  hipblasDoubleComplex* x,
-                                                                  int                   incx,
-                                                                  hipblasStride         stridex,
-                                                                  int                   batch_count)
+hipblasStatus_t hipblasPotrsBatched<double>(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double* const           A[],
+                                            const int               lda,
+                                            double* const           B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount)
 {
-    return hipblasZdscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
 }
 
-//swap
 template <>
-hipblasStatus_t
-    hipblasSwap<float, true>(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
+hipblasStatus_t hipblasPotrsBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    hipblasComplex* const   B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount)
 {
-    return hipblasSswapFortran(handle, n, x, incx, y, incy);
+    return hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSwap<double, true>(
-    hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy)
-{
-    return hipblasDswapFortran(handle, n, x, incx, y, incy);
-}
-
-template <>
-hipblasStatus_t hipblasSwap<hipblasComplex, true>(
-    hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
+hipblasStatus_t hipblasPotrsBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const hipblasFillMode_t     uplo,
+                                                          const int                   n,
+                                                          const int                   nrhs,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          hipblasDoubleComplex* const B[],
+                                                          const int                   ldb,
+                                                          int*                        info,
+                                                          const int                   batchCount)
 {
-    return hipblasCswapFortran(handle, n, x, incx, y, incy);
+    return hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
 }
 
+// potrsStridedBatched
 template <>
-hipblasStatus_t hipblasSwap<hipblasDoubleComplex, true>(hipblasHandle_t       handle,
-                                                        int                   n,
-                                                        hipblasDoubleComplex* x,
-                                                        int                   incx,
-                                                        hipblasDoubleComplex* y,
-                                                        int                   incy)
+hipblasStatus_t hipblasPotrsStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  const int               nrhs,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  float*                  B,
+                                                  const int               ldb,
+                                                  const hipblasStride     strideB,
+                                                  int*                    info,
+                                                  const int               batchCount)
 {
-    return hipblasZswapFortran(handle, n, x, incx, y, incy);
+    return hipblasSpotrsStridedBatched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
 }
 
-// swap_batched
 template <>
-hipblasStatus_t hipblasSwapBatched<float, true>(
-    hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batch_count)
+hipblasStatus_t hipblasPotrsStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   double*                 B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount)
 {
-    return hipblasSswapBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+    return hipblasDpotrsStridedBatched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSwapBatched<double, true>(
-    hipblasHandle_t handle, int n, double* x[], int incx, double* y[], int incy, int batch_count)
+hipblasStatus_t hipblasPotrsStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           hipblasComplex*         B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount)
 {
-    return hipblasDswapBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+    return hipblasCpotrsStridedBatched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSwapBatched<hipblasComplex, true>(hipblasHandle_t handle,
-                                                         int             n,
-                                                         hipblasComplex* x[],
-                                                         int             incx,
-                                                         hipblasComplex* y[],
-                                                         int             incy,
-                                                         int             batch_count)
+hipblasStatus_t hipblasPotrsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 const int               nrhs,
+                                                                 hipblasDoubleComplex*   A,
+                                                                 const int               lda,
+                                                                 const hipblasStride     strideA,
+                                                                 hipblasDoubleComplex*   B,
+                                                                 const int               ldb,
+                                                                 const hipblasStride     strideB,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
 {
-    return hipblasCswapBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+    return hipblasZpotrsStridedBatched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
 }
 
+// potri
 template <>
-hipblasStatus_t hipblasSwapBatched<hipblasDoubleComplex, true>(hipblasHandle_t       handle,
-                                                               int                   n,
-                                                               hipblasDoubleComplex* x[],
-                                                               int                   incx,
-                                                               hipblasDoubleComplex* y[],
-                                                               int                   incy,
-                                                               int                   batch_count)
+hipblasStatus_t hipblasPotri<float>(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    float*                  A,
+                                    const int               lda,
+                                    int*                    info)
 {
-    return hipblasZswapBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+    return hipblasSpotri(handle, uplo, n, A, lda, info);
 }
 
-// swap_strided_batched
 template <>
-hipblasStatus_t hipblasSwapStridedBatched<float, true>(hipblasHandle_t handle,
-                                                       int             n,
-                                                       float*          x,
-                                                       int             incx,
-                                                       hipblasStride   stridex,
-                                                       float*          y,
-                                                       int             incy,
-                                                       hipblasStride   stridey,
-                                                       int             batch_count)
+hipblasStatus_t hipblasPotri<double>(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info)
 {
-    return hipblasSswapStridedBatchedFortran(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasDpotri(handle, uplo, n, A, lda, info);
 }
 
 template <>
-hipblasStatus_t hipblasSwapStridedBatched<double, true>(hipblasHandle_t handle,
-                                                        int             n,
-                                                        double*         x,
-                                                        int             incx,
-                                                        hipblasStride   stridex,
-                                                        double*         y,
-                                                        int             incy,
-                                                        hipblasStride   stridey,
-                                                        int             batch_count)
+hipblasStatus_t hipblasPotri<hipblasComplex>(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info)
 {
-    return hipblasDswapStridedBatchedFortran(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasCpotri(handle, uplo, n, A, lda, info);
 }
 
 template <>
-hipblasStatus_t hipblasSwapStridedBatched<hipblasComplex, true>(hipblasHandle_t handle,
-                                                                int             n,
-                                                                hipblasComplex* x,
-                                                                int             incx,
-                                                                hipblasStride   stridex,
-                                                                hipblasComplex* y,
-                                                                int             incy,
-                                                                hipblasStride   stridey,
-                                                                int             batch_count)
+hipblasStatus_t hipblasPotri<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   int*                    info)
 {
-    return hipblasCswapStridedBatchedFortran(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasZpotri(handle, uplo, n, A, lda, info);
 }
 
+// potriBatched
 template <>
-hipblasStatus_t hipblasSwapStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t       handle,
-                                                                      int                   n,
-                                                                      hipblasDoubleComplex* x,
-                                                                      int                   incx,
-                                                                      hipblasStride         stridex,
-                                                                      hipblasDoubleComplex* y,
-                                                                      int                   incy,
-                                                                      hipblasStride         stridey,
-                                                                      int batch_count)
+hipblasStatus_t hipblasPotriBatched<float>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           float* const            A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount)
 {
-    return hipblasZswapStridedBatchedFortran(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasSpotriBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
-// copy
 template <>
-hipblasStatus_t hipblasCopy<float, true>(
-    hipblasHandle_t handle, int n, const float* x, int incx, float* y, int incy)
+hipblasStatus_t hipblasPotriBatched<double>(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount)
 {
-    return hipblasScopyFortran(handle, n, x, incx, y, incy);
+    return hipblasDpotriBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasCopy<double, true>(
-    hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy)
+hipblasStatus_t hipblasPotriBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount)
 {
-    return hipblasDcopyFortran(handle, n, x, incx, y, incy);
+    return hipblasCpotriBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasCopy<hipblasComplex, true>(
-    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
+hipblasStatus_t hipblasPotriBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const hipblasFillMode_t     uplo,
+                                                          const int                   n,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          int*                        info,
+                                                          const int                   batchCount)
 {
-    return hipblasCcopyFortran(handle, n, x, incx, y, incy);
+    return hipblasZpotriBatched(handle, uplo, n, A, lda, info, batchCount);
 }
 
+// potriStridedBatched
 template <>
-hipblasStatus_t hipblasCopy<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                        int                         n,
-                                                        const hipblasDoubleComplex* x,
-                                                        int                         incx,
-                                                        hipblasDoubleComplex*       y,
-                                                        int                         incy)
+hipblasStatus_t hipblasPotriStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  int*                    info,
+                                                  const int               batchCount)
 {
-    return hipblasZcopyFortran(handle, n, x, incx, y, incy);
+    return hipblasSpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
 }
 
-// copy_batched
 template <>
-hipblasStatus_t hipblasCopyBatched<float, true>(hipblasHandle_t    handle,
-                                                int                n,
-                                                const float* const x[],
-                                                int                incx,
-                                                float* const       y[],
-                                                int                incy,
-                                                int                batch_count)
+hipblasStatus_t hipblasPotriStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount)
 {
-    return hipblasScopyBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+    return hipblasDpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasCopyBatched<double, true>(hipblasHandle_t     handle,
-                                                 int                 n,
-                                                 const double* const x[],
-                                                 int                 incx,
-                                                 double* const       y[],
-                                                 int                 incy,
-                                                 int                 batch_count)
+hipblasStatus_t hipblasPotriStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount)
 {
-    return hipblasDcopyBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+    return hipblasCpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasCopyBatched<hipblasComplex, true>(hipblasHandle_t             handle,
-                                                         int                         n,
-                                                         const hipblasComplex* const x[],
-                                                         int                         incx,
-                                                         hipblasComplex* const       y[],
-                                                         int                         incy,
-                                                         int                         batch_count)
+hipblasStatus_t hipblasPotriStridedBatched<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 hipblasDoubleComplex*   A,
+                                                                 const int               lda,
+                                                                 const hipblasStride     strideA,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
 {
-    return hipblasCcopyBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+    return hipblasZpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
 }
 
+// geconBatched
 template <>
-hipblasStatus_t
-    hipblasCopyBatched<hipblasDoubleComplex, true>(hipblasHandle_t                   handle,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   hipblasDoubleComplex* const       y[],
-                                                   int                               incy,
-                                                   int                               batch_count)
+hipblasStatus_t hipblasGeconBatched<float, float>(hipblasHandle_t         handle,
+                                                  const hipblasNormType_t norm,
+                                                  const int               n,
+                                                  float* const            A[],
+                                                  const int               lda,
+                                                  const float*            anorm,
+                                                  float*                  rcond,
+                                                  int*                    info,
+                                                  const int               batchCount)
 {
-    return hipblasZcopyBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+    return hipblasSgeconBatched(handle, norm, n, A, lda, anorm, rcond, info, batchCount);
 }
 
-// copy_strided_batched
 template <>
-hipblasStatus_t hipblasCopyStridedBatched<float, true>(hipblasHandle_t handle,
-                                                       int             n,
-                                                       const float*    x,
-                                                       int             incx,
-                                                       hipblasStride   stridex,
-                                                       float*          y,
-                                                       int             incy,
-                                                       hipblasStride   stridey,
-                                                       int             batch_count)
+hipblasStatus_t hipblasGeconBatched<double, double>(hipblasHandle_t         handle,
+                                                    const hipblasNormType_t norm,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    const double*           anorm,
+                                                    double*                 rcond,
+                                                    int*                    info,
+                                                    const int               batchCount)
 {
-    return hipblasScopyStridedBatchedFortran(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasDgeconBatched(handle, norm, n, A, lda, anorm, rcond, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasCopyStridedBatched<double, true>(hipblasHandle_t handle,
-                                                        int             n,
-                                                        const double*   x,
-                                                        int             incx,
-                                                        hipblasStride   stridex,
-                                                        double*         y,
-                                                        int             incy,
-                                                        hipblasStride   stridey,
-                                                        int             batch_count)
+hipblasStatus_t hipblasGeconBatched<hipblasComplex, float>(hipblasHandle_t         handle,
+                                                           const hipblasNormType_t norm,
+                                                           const int               n,
+                                                           hipblasComplex* const   A[],
+                                                           const int               lda,
+                                                           const float*            anorm,
+                                                           float*                  rcond,
+                                                           int*                    info,
+                                                           const int               batchCount)
 {
-    return hipblasDcopyStridedBatchedFortran(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasCgeconBatched(handle, norm, n, A, lda, anorm, rcond, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasCopyStridedBatched<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                                int                   n,
-                                                                const hipblasComplex* x,
-                                                                int                   incx,
-                                                                hipblasStride         stridex,
-                                                                hipblasComplex*       y,
-                                                                int                   incy,
-                                                                hipblasStride         stridey,
-                                                                int                   batch_count)
+hipblasStatus_t
+    hipblasGeconBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                      const hipblasNormType_t     norm,
+                                                      const int                   n,
+                                                      hipblasDoubleComplex* const A[],
+                                                      const int                   lda,
+                                                      const double*               anorm,
+                                                      double*                     rcond,
+                                                      int*                        info,
+                                                      const int                   batchCount)
 {
-    return hipblasCcopyStridedBatchedFortran(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasZgeconBatched(handle, norm, n, A, lda, anorm, rcond, info, batchCount);
 }
 
+// geconStridedBatched
 template <>
-hipblasStatus_t hipblasCopyStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t handle,
-                                                                      int             n,
-                                                                      const hipblasDoubleComplex* x,
-                                                                      int                   incx,
-                                                                      hipblasStride         stridex,
-                                                                      hipblasDoubleComplex* y,
-                                                                      int                   incy,
-                                                                      hipblasStride         stridey,
-                                                                      int batch_count)
+hipblasStatus_t hipblasGeconStridedBatched<float, float>(hipblasHandle_t         handle,
+                                                         const hipblasNormType_t norm,
+                                                         const int               n,
+                                                         float*                  A,
+                                                         const int               lda,
+                                                         const hipblasStride     strideA,
+                                                         const float*            anorm,
+                                                         float*                  rcond,
+                                                         int*                    info,
+                                                         const int               batchCount)
 {
-    return hipblasZcopyStridedBatchedFortran(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasSgeconStridedBatched(
+        handle, norm, n, A, lda, strideA, anorm, rcond, info, batchCount);
 }
 
-// dot
 template <>
-hipblasStatus_t hipblasDot<hipblasHalf, true>(hipblasHandle_t    handle,
-                                              int                n,
-                                              const hipblasHalf* x,
-                                              int                incx,
-                                              const hipblasHalf* y,
-                                              int                incy,
-                                              hipblasHalf*       result)
+hipblasStatus_t hipblasGeconStridedBatched<double, double>(hipblasHandle_t         handle,
+                                                           const hipblasNormType_t norm,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           const double*           anorm,
+                                                           double*                 rcond,
+                                                           int*                    info,
+                                                           const int               batchCount)
 {
-    return hipblasHdotFortran(handle, n, x, incx, y, incy, result);
+    return hipblasDgeconStridedBatched(
+        handle, norm, n, A, lda, strideA, anorm, rcond, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasDot<hipblasBfloat16, true>(hipblasHandle_t        handle,
-                                                  int                    n,
-                                                  const hipblasBfloat16* x,
-                                                  int                    incx,
-                                                  const hipblasBfloat16* y,
-                                                  int                    incy,
-                                                  hipblasBfloat16*       result)
+hipblasStatus_t
+    hipblasGeconStridedBatched<hipblasComplex, float>(hipblasHandle_t         handle,
+                                                      const hipblasNormType_t norm,
+                                                      const int               n,
+                                                      hipblasComplex*         A,
+                                                      const int               lda,
+                                                      const hipblasStride     strideA,
+                                                      const float*            anorm,
+                                                      float*                  rcond,
+                                                      int*                    info,
+                                                      const int               batchCount)
 {
-    return hipblasBfdotFortran(handle, n, x, incx, y, incy, result);
+    return hipblasCgeconStridedBatched(
+        handle, norm, n, A, lda, strideA, anorm, rcond, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasDot<float, true>(hipblasHandle_t handle,
-                                        int             n,
-                                        const float*    x,
-                                        int             incx,
-                                        const float*    y,
-                                        int             incy,
-                                        float*          result)
+hipblasStatus_t
+    hipblasGeconStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t         handle,
+                                                             const hipblasNormType_t norm,
+                                                             const int               n,
+                                                             hipblasDoubleComplex*   A,
+                                                             const int               lda,
+                                                             const hipblasStride     strideA,
+                                                             const double*           anorm,
+                                                             double*                 rcond,
+                                                             int*                    info,
+                                                             const int               batchCount)
 {
-    return hipblasSdotFortran(handle, n, x, incx, y, incy, result);
+    return hipblasZgeconStridedBatched(
+        handle, norm, n, A, lda, strideA, anorm, rcond, info, batchCount);
 }
 
+// getrfStridedBatchedCompactPivot
 template <>
-hipblasStatus_t hipblasDot<double, true>(hipblasHandle_t handle,
-                                         int             n,
-                                         const double*   x,
-                                         int             incx,
-                                         const double*   y,
-                                         int             incy,
-                                         double*         result)
+hipblasStatus_t hipblasGetrfStridedBatchedCompactPivot<float>(hipblasHandle_t          handle,
+                                                              const int                n,
+                                                              float*                   A,
+                                                              const int                lda,
+                                                              const hipblasStride      strideA,
+                                                              void*                    ipiv,
+                                                              const hipblasPivotType_t pivotType,
+                                                              const hipblasStride      strideP,
+                                                              int*                     info,
+                                                              const int                batchCount)
 {
-    return hipblasDdotFortran(handle, n, x, incx, y, incy, result);
+    return hipblasSgetrfStridedBatchedCompactPivot(
+        handle, n, A, lda, strideA, ipiv, pivotType, strideP, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasDot<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                 int                   n,
-                                                 const hipblasComplex* x,
-                                                 int                   incx,
-                                                 const hipblasComplex* y,
-                                                 int                   incy,
-                                                 hipblasComplex*       result)
+hipblasStatus_t hipblasGetrfStridedBatchedCompactPivot<double>(hipblasHandle_t          handle,
+                                                               const int                n,
+                                                               double*                  A,
+                                                               const int                lda,
+                                                               const hipblasStride      strideA,
+                                                               void*                    ipiv,
+                                                               const hipblasPivotType_t pivotType,
+                                                               const hipblasStride      strideP,
+                                                               int*                     info,
+                                                               const int                batchCount)
 {
-    return hipblasCdotuFortran(handle, n, x, incx, y, incy, result);
+    return hipblasDgetrfStridedBatchedCompactPivot(
+        handle, n, A, lda, strideA, ipiv, pivotType, strideP, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasDot<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                       int                         n,
-                                                       const hipblasDoubleComplex* x,
-                                                       int                         incx,
-                                                       const hipblasDoubleComplex* y,
-                                                       int                         incy,
-                                                       hipblasDoubleComplex*       result)
+hipblasStatus_t
+    hipblasGetrfStridedBatchedCompactPivot<hipblasComplex>(hipblasHandle_t          handle,
+                                                           const int                n,
+                                                           hipblasComplex*          A,
+                                                           const int                lda,
+                                                           const hipblasStride      strideA,
+                                                           void*                    ipiv,
+                                                           const hipblasPivotType_t pivotType,
+                                                           const hipblasStride      strideP,
+                                                           int*                     info,
+                                                           const int                batchCount)
 {
-    return hipblasZdotuFortran(handle, n, x, incx, y, incy, result);
+    return hipblasCgetrfStridedBatchedCompactPivot(
+        handle, n, A, lda, strideA, ipiv, pivotType, strideP, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasDotc<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                  int                   n,
+hipblasStatus_t
+    hipblasGetrfStridedBatchedCompactPivot<hipblasDoubleComplex>(hipblasHandle_t          handle,
+                                                                 const int                n,
+                                                                 hipblasDoubleComplex*    A,
+                                                                 const int                lda,
+                                                                 const hipblasStride      strideA,
+                                                                 void*                    ipiv,
+                                                                 const hipblasPivotType_t pivotType,
+                                                                 const hipblasStride      strideP,
+                                                                 int*                     info,
+                                                                 const int                batchCount)
+{
+    return hipblasZgetrfStridedBatchedCompactPivot(
+        handle, n, A, lda, strideA, ipiv, pivotType, strideP, info, batchCount);
+}
+
+// getrsStridedBatchedCompactPivot
+template <>
+hipblasStatus_t hipblasGetrsStridedBatchedCompactPivot<float>(hipblasHandle_t          handle,
+                                                              const hipblasOperation_t trans,
+                                                              const int                n,
+                                                              const int                nrhs,
+                                                              float*                   A,
+                                                              const int                lda,
+                                                              const hipblasStride      strideA,
+                                                              const void*              ipiv,
+                                                              const hipblasPivotType_t pivotType,
+                                                              const hipblasStride      strideP,
+                                                              float*                   B,
+                                                              const int                ldb,
+                                                              const hipblasStride      strideB,
+                                                              int*                     info,
+                                                              const int                batchCount)
+{
+    return hipblasSgetrsStridedBatchedCompactPivot(handle,
+                                                   trans,
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   ipiv,
+                                                   pivotType,
+                                                   strideP,
+                                                   B,
+                                                   ldb,
+                                                   strideB,
+                                                   info,
+                                                   batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsStridedBatchedCompactPivot<double>(hipblasHandle_t          handle,
+                                                               const hipblasOperation_t trans,
+                                                               const int                n,
+                                                               const int                nrhs,
+                                                               double*                  A,
+                                                               const int                lda,
+                                                               const hipblasStride      strideA,
+                                                               const void*              ipiv,
+                                                               const hipblasPivotType_t pivotType,
+                                                               const hipblasStride      strideP,
+                                                               double*                  B,
+                                                               const int                ldb,
+                                                               const hipblasStride      strideB,
+                                                               int*                     info,
+                                                               const int                batchCount)
+{
+    return hipblasDgetrsStridedBatchedCompactPivot(handle,
+                                                   trans,
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   ipiv,
+                                                   pivotType,
+                                                   strideP,
+                                                   B,
+                                                   ldb,
+                                                   strideB,
+                                                   info,
+                                                   batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGetrsStridedBatchedCompactPivot<hipblasComplex>(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t trans,
+                                                           const int                n,
+                                                           const int                nrhs,
+                                                           hipblasComplex*          A,
+                                                           const int                lda,
+                                                           const hipblasStride      strideA,
+                                                           const void*              ipiv,
+                                                           const hipblasPivotType_t pivotType,
+                                                           const hipblasStride      strideP,
+                                                           hipblasComplex*          B,
+                                                           const int                ldb,
+                                                           const hipblasStride      strideB,
+                                                           int*                     info,
+                                                           const int                batchCount)
+{
+    return hipblasCgetrsStridedBatchedCompactPivot(handle,
+                                                   trans,
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   ipiv,
+                                                   pivotType,
+                                                   strideP,
+                                                   B,
+                                                   ldb,
+                                                   strideB,
+                                                   info,
+                                                   batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGetrsStridedBatchedCompactPivot<hipblasDoubleComplex>(hipblasHandle_t          handle,
+                                                                 const hipblasOperation_t trans,
+                                                                 const int                n,
+                                                                 const int                nrhs,
+                                                                 hipblasDoubleComplex*    A,
+                                                                 const int                lda,
+                                                                 const hipblasStride      strideA,
+                                                                 const void*              ipiv,
+                                                                 const hipblasPivotType_t pivotType,
+                                                                 const hipblasStride      strideP,
+                                                                 hipblasDoubleComplex*    B,
+                                                                 const int                ldb,
+                                                                 const hipblasStride      strideB,
+                                                                 int*                     info,
+                                                                 const int                batchCount)
+{
+    return hipblasZgetrsStridedBatchedCompactPivot(handle,
+                                                   trans,
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   ipiv,
+                                                   pivotType,
+                                                   strideP,
+                                                   B,
+                                                   ldb,
+                                                   strideB,
+                                                   info,
+                                                   batchCount);
+}
+
+// syevjBatched
+template <>
+hipblasStatus_t hipblasSyevjBatched<float, float>(hipblasHandle_t         handle,
+                                                  const hipblasEigMode_t  jobz,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  float* const            A[],
+                                                  const int               lda,
+                                                  const float             abstol,
+                                                  const int               maxSweeps,
+                                                  const int               sortEig,
+                                                  float*                  W,
+                                                  const hipblasStride     strideW,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasSsyevjBatched(
+        handle, jobz, uplo, n, A, lda, abstol, maxSweeps, sortEig, W, strideW, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyevjBatched<double, double>(hipblasHandle_t         handle,
+                                                    const hipblasEigMode_t  jobz,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    const double            abstol,
+                                                    const int               maxSweeps,
+                                                    const int               sortEig,
+                                                    double*                 W,
+                                                    const hipblasStride     strideW,
+                                                    int*                    info,
+                                                    const int               batchCount)
+{
+    return hipblasDsyevjBatched(
+        handle, jobz, uplo, n, A, lda, abstol, maxSweeps, sortEig, W, strideW, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyevjBatched<hipblasComplex, float>(hipblasHandle_t         handle,
+                                                           const hipblasEigMode_t  jobz,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex* const   A[],
+                                                           const int               lda,
+                                                           const float             abstol,
+                                                           const int               maxSweeps,
+                                                           const int               sortEig,
+                                                           float*                  W,
+                                                           const hipblasStride     strideW,
+                                                           int*                    info,
+                                                           const int               batchCount)
+{
+    return hipblasCheevjBatched(
+        handle, jobz, uplo, n, A, lda, abstol, maxSweeps, sortEig, W, strideW, info, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasSyevjBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                      const hipblasEigMode_t      jobz,
+                                                      const hipblasFillMode_t     uplo,
+                                                      const int                   n,
+                                                      hipblasDoubleComplex* const A[],
+                                                      const int                   lda,
+                                                      const double                abstol,
+                                                      const int                   maxSweeps,
+                                                      const int                   sortEig,
+                                                      double*                     W,
+                                                      const hipblasStride         strideW,
+                                                      int*                        info,
+                                                      const int                   batchCount)
+{
+    return hipblasZheevjBatched(
+        handle, jobz, uplo, n, A, lda, abstol, maxSweeps, sortEig, W, strideW, info, batchCount);
+}
+
+// syevjStridedBatched
+template <>
+hipblasStatus_t hipblasSyevjStridedBatched<float, float>(hipblasHandle_t         handle,
+                                                         const hipblasEigMode_t  jobz,
+                                                         const hipblasFillMode_t uplo,
+                                                         const int               n,
+                                                         float*                  A,
+                                                         const int               lda,
+                                                         const hipblasStride     strideA,
+                                                         const float             abstol,
+                                                         const int               maxSweeps,
+                                                         const int               sortEig,
+                                                         float*                  W,
+                                                         const hipblasStride     strideW,
+                                                         int*                    info,
+                                                         const int               batchCount)
+{
+    return hipblasSsyevjStridedBatched(handle,
+                                       jobz,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       abstol,
+                                       maxSweeps,
+                                       sortEig,
+                                       W,
+                                       strideW,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyevjStridedBatched<double, double>(hipblasHandle_t         handle,
+                                                           const hipblasEigMode_t  jobz,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           const double            abstol,
+                                                           const int               maxSweeps,
+                                                           const int               sortEig,
+                                                           double*                 W,
+                                                           const hipblasStride     strideW,
+                                                           int*                    info,
+                                                           const int               batchCount)
+{
+    return hipblasDsyevjStridedBatched(handle,
+                                       jobz,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       abstol,
+                                       maxSweeps,
+                                       sortEig,
+                                       W,
+                                       strideW,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasSyevjStridedBatched<hipblasComplex, float>(hipblasHandle_t         handle,
+                                                      const hipblasEigMode_t  jobz,
+                                                      const hipblasFillMode_t uplo,
+                                                      const int               n,
+                                                      hipblasComplex*         A,
+                                                      const int               lda,
+                                                      const hipblasStride     strideA,
+                                                      const float             abstol,
+                                                      const int               maxSweeps,
+                                                      const int               sortEig,
+                                                      float*                  W,
+                                                      const hipblasStride     strideW,
+                                                      int*                    info,
+                                                      const int               batchCount)
+{
+    return hipblasCheevjStridedBatched(handle,
+                                       jobz,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       abstol,
+                                       maxSweeps,
+                                       sortEig,
+                                       W,
+                                       strideW,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasSyevjStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t         handle,
+                                                             const hipblasEigMode_t  jobz,
+                                                             const hipblasFillMode_t uplo,
+                                                             const int               n,
+                                                             hipblasDoubleComplex*   A,
+                                                             const int               lda,
+                                                             const hipblasStride     strideA,
+                                                             const double            abstol,
+                                                             const int               maxSweeps,
+                                                             const int               sortEig,
+                                                             double*                 W,
+                                                             const hipblasStride     strideW,
+                                                             int*                    info,
+                                                             const int               batchCount)
+{
+    return hipblasZheevjStridedBatched(handle,
+                                       jobz,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       abstol,
+                                       maxSweeps,
+                                       sortEig,
+                                       W,
+                                       strideW,
+                                       info,
+                                       batchCount);
+}
+
+// gesvdjBatched
+template <>
+hipblasStatus_t hipblasGesvdjBatched<float, float>(hipblasHandle_t        handle,
+                                                   const hipblasEigMode_t jobz,
+                                                   const int              econ,
+                                                   const int              m,
+                                                   const int              n,
+                                                   float* const           A[],
+                                                   const int              lda,
+                                                   const float            abstol,
+                                                   const int              maxSweeps,
+                                                   float*                 S,
+                                                   const hipblasStride    strideS,
+                                                   float*                 U,
+                                                   const int              ldu,
+                                                   const hipblasStride    strideU,
+                                                   float*                 V,
+                                                   const int              ldv,
+                                                   const hipblasStride    strideV,
+                                                   int*                   info,
+                                                   const int              batchCount)
+{
+    return hipblasSgesvdjBatched(handle,
+                                 jobz,
+                                 econ,
+                                 m,
+                                 n,
+                                 A,
+                                 lda,
+                                 abstol,
+                                 maxSweeps,
+                                 S,
+                                 strideS,
+                                 U,
+                                 ldu,
+                                 strideU,
+                                 V,
+                                 ldv,
+                                 strideV,
+                                 info,
+                                 batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvdjBatched<double, double>(hipblasHandle_t        handle,
+                                                     const hipblasEigMode_t jobz,
+                                                     const int              econ,
+                                                     const int              m,
+                                                     const int              n,
+                                                     double* const          A[],
+                                                     const int              lda,
+                                                     const double           abstol,
+                                                     const int              maxSweeps,
+                                                     double*                S,
+                                                     const hipblasStride    strideS,
+                                                     double*                U,
+                                                     const int              ldu,
+                                                     const hipblasStride    strideU,
+                                                     double*                V,
+                                                     const int              ldv,
+                                                     const hipblasStride    strideV,
+                                                     int*                   info,
+                                                     const int              batchCount)
+{
+    return hipblasDgesvdjBatched(handle,
+                                 jobz,
+                                 econ,
+                                 m,
+                                 n,
+                                 A,
+                                 lda,
+                                 abstol,
+                                 maxSweeps,
+                                 S,
+                                 strideS,
+                                 U,
+                                 ldu,
+                                 strideU,
+                                 V,
+                                 ldv,
+                                 strideV,
+                                 info,
+                                 batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvdjBatched<hipblasComplex, float>(hipblasHandle_t        handle,
+                                                            const hipblasEigMode_t jobz,
+                                                            const int              econ,
+                                                            const int              m,
+                                                            const int              n,
+                                                            hipblasComplex* const  A[],
+                                                            const int              lda,
+                                                            const float            abstol,
+                                                            const int              maxSweeps,
+                                                            float*                 S,
+                                                            const hipblasStride    strideS,
+                                                            hipblasComplex*        U,
+                                                            const int              ldu,
+                                                            const hipblasStride    strideU,
+                                                            hipblasComplex*        V,
+                                                            const int              ldv,
+                                                            const hipblasStride    strideV,
+                                                            int*                   info,
+                                                            const int              batchCount)
+{
+    return hipblasCgesvdjBatched(handle,
+                                 jobz,
+                                 econ,
+                                 m,
+                                 n,
+                                 A,
+                                 lda,
+                                 abstol,
+                                 maxSweeps,
+                                 S,
+                                 strideS,
+                                 U,
+                                 ldu,
+                                 strideU,
+                                 V,
+                                 ldv,
+                                 strideV,
+                                 info,
+                                 batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGesvdjBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                       const hipblasEigMode_t      jobz,
+                                                       const int                   econ,
+                                                       const int                   m,
+                                                       const int                   n,
+                                                       hipblasDoubleComplex* const A[],
+                                                       const int                   lda,
+                                                       const double                abstol,
+                                                       const int                   maxSweeps,
+                                                       double*                     S,
+                                                       const hipblasStride         strideS,
+                                                       hipblasDoubleComplex*       U,
+                                                       const int                   ldu,
+                                                       const hipblasStride         strideU,
+                                                       hipblasDoubleComplex*       V,
+                                                       const int                   ldv,
+                                                       const hipblasStride         strideV,
+                                                       int*                        info,
+                                                       const int                   batchCount)
+{
+    return hipblasZgesvdjBatched(handle,
+                                 jobz,
+                                 econ,
+                                 m,
+                                 n,
+                                 A,
+                                 lda,
+                                 abstol,
+                                 maxSweeps,
+                                 S,
+                                 strideS,
+                                 U,
+                                 ldu,
+                                 strideU,
+                                 V,
+                                 ldv,
+                                 strideV,
+                                 info,
+                                 batchCount);
+}
+
+// gesvdjStridedBatched
+template <>
+hipblasStatus_t hipblasGesvdjStridedBatched<float, float>(hipblasHandle_t        handle,
+                                                          const hipblasEigMode_t jobz,
+                                                          const int              econ,
+                                                          const int              m,
+                                                          const int              n,
+                                                          float*                 A,
+                                                          const int              lda,
+                                                          const hipblasStride    strideA,
+                                                          const float            abstol,
+                                                          const int              maxSweeps,
+                                                          float*                 S,
+                                                          const hipblasStride    strideS,
+                                                          float*                 U,
+                                                          const int              ldu,
+                                                          const hipblasStride    strideU,
+                                                          float*                 V,
+                                                          const int              ldv,
+                                                          const hipblasStride    strideV,
+                                                          int*                   info,
+                                                          const int              batchCount)
+{
+    return hipblasSgesvdjStridedBatched(handle,
+                                        jobz,
+                                        econ,
+                                        m,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        maxSweeps,
+                                        S,
+                                        strideS,
+                                        U,
+                                        ldu,
+                                        strideU,
+                                        V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvdjStridedBatched<double, double>(hipblasHandle_t        handle,
+                                                            const hipblasEigMode_t jobz,
+                                                            const int              econ,
+                                                            const int              m,
+                                                            const int              n,
+                                                            double*                A,
+                                                            const int              lda,
+                                                            const hipblasStride    strideA,
+                                                            const double           abstol,
+                                                            const int              maxSweeps,
+                                                            double*                S,
+                                                            const hipblasStride    strideS,
+                                                            double*                U,
+                                                            const int              ldu,
+                                                            const hipblasStride    strideU,
+                                                            double*                V,
+                                                            const int              ldv,
+                                                            const hipblasStride    strideV,
+                                                            int*                   info,
+                                                            const int              batchCount)
+{
+    return hipblasDgesvdjStridedBatched(handle,
+                                        jobz,
+                                        econ,
+                                        m,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        maxSweeps,
+                                        S,
+                                        strideS,
+                                        U,
+                                        ldu,
+                                        strideU,
+                                        V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGesvdjStridedBatched<hipblasComplex, float>(hipblasHandle_t        handle,
+                                                       const hipblasEigMode_t jobz,
+                                                       const int              econ,
+                                                       const int              m,
+                                                       const int              n,
+                                                       hipblasComplex*        A,
+                                                       const int              lda,
+                                                       const hipblasStride    strideA,
+                                                       const float            abstol,
+                                                       const int              maxSweeps,
+                                                       float*                 S,
+                                                       const hipblasStride    strideS,
+                                                       hipblasComplex*        U,
+                                                       const int              ldu,
+                                                       const hipblasStride    strideU,
+                                                       hipblasComplex*        V,
+                                                       const int              ldv,
+                                                       const hipblasStride    strideV,
+                                                       int*                   info,
+                                                       const int              batchCount)
+{
+    return hipblasCgesvdjStridedBatched(handle,
+                                        jobz,
+                                        econ,
+                                        m,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        maxSweeps,
+                                        S,
+                                        strideS,
+                                        U,
+                                        ldu,
+                                        strideU,
+                                        V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGesvdjStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t        handle,
+                                                              const hipblasEigMode_t jobz,
+                                                              const int              econ,
+                                                              const int              m,
+                                                              const int              n,
+                                                              hipblasDoubleComplex*  A,
+                                                              const int              lda,
+                                                              const hipblasStride    strideA,
+                                                              const double           abstol,
+                                                              const int              maxSweeps,
+                                                              double*                S,
+                                                              const hipblasStride    strideS,
+                                                              hipblasDoubleComplex*  U,
+                                                              const int              ldu,
+                                                              const hipblasStride    strideU,
+                                                              hipblasDoubleComplex*  V,
+                                                              const int              ldv,
+                                                              const hipblasStride    strideV,
+                                                              int*                   info,
+                                                              const int              batchCount)
+{
+    return hipblasZgesvdjStridedBatched(handle,
+                                        jobz,
+                                        econ,
+                                        m,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        maxSweeps,
+                                        S,
+                                        strideS,
+                                        U,
+                                        ldu,
+                                        strideU,
+                                        V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+// gesvIR
+template <>
+hipblasStatus_t hipblasGesvIR<double>(hipblasHandle_t handle,
+                                      const int       n,
+                                      const int       nrhs,
+                                      double*         A,
+                                      const int       lda,
+                                      int*            ipiv,
+                                      double*         B,
+                                      const int       ldb,
+                                      double*         X,
+                                      const int       ldx,
+                                      int*            iter,
+                                      int*            info,
+                                      int*            deviceInfo)
+{
+    return hipblasDSgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo);
+}
+
+template <>
+hipblasStatus_t hipblasGesvIR<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                    const int             n,
+                                                    const int             nrhs,
+                                                    hipblasDoubleComplex* A,
+                                                    const int             lda,
+                                                    int*                  ipiv,
+                                                    hipblasDoubleComplex* B,
+                                                    const int             ldb,
+                                                    hipblasDoubleComplex* X,
+                                                    const int             ldx,
+                                                    int*                  iter,
+                                                    int*                  info,
+                                                    int*                  deviceInfo)
+{
+    return hipblasZCgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo);
+}
+
+// gesvIRBatched
+template <>
+hipblasStatus_t hipblasGesvIRBatched<double>(hipblasHandle_t handle,
+                                             const int       n,
+                                             const int       nrhs,
+                                             double* const   A[],
+                                             const int       lda,
+                                             int*            ipiv,
+                                             double* const   B[],
+                                             const int       ldb,
+                                             double* const   X[],
+                                             const int       ldx,
+                                             int*            iter,
+                                             int*            info,
+                                             int*            deviceInfo,
+                                             const int       batchCount)
+{
+    return hipblasDSgesvBatched(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvIRBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                           const int                   n,
+                                                           const int                   nrhs,
+                                                           hipblasDoubleComplex* const A[],
+                                                           const int                   lda,
+                                                           int*                        ipiv,
+                                                           hipblasDoubleComplex* const B[],
+                                                           const int                   ldb,
+                                                           hipblasDoubleComplex* const X[],
+                                                           const int                   ldx,
+                                                           int*                        iter,
+                                                           int*                        info,
+                                                           int*                        deviceInfo,
+                                                           const int                   batchCount)
+{
+    return hipblasZCgesvBatched(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo, batchCount);
+}
+
+// gesvIRStridedBatched
+template <>
+hipblasStatus_t hipblasGesvIRStridedBatched<double>(hipblasHandle_t     handle,
+                                                    const int           n,
+                                                    const int           nrhs,
+                                                    double*             A,
+                                                    const int           lda,
+                                                    const hipblasStride strideA,
+                                                    int*                ipiv,
+                                                    const hipblasStride strideP,
+                                                    double*             B,
+                                                    const int           ldb,
+                                                    const hipblasStride strideB,
+                                                    double*             X,
+                                                    const int           ldx,
+                                                    const hipblasStride strideX,
+                                                    int*                iter,
+                                                    int*                info,
+                                                    int*                deviceInfo,
+                                                    const int           batchCount)
+{
+    return hipblasDSgesvStridedBatched(handle,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       X,
+                                       ldx,
+                                       strideX,
+                                       iter,
+                                       info,
+                                       deviceInfo,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvIRStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                  const int             n,
+                                                                  const int             nrhs,
+                                                                  hipblasDoubleComplex* A,
+                                                                  const int             lda,
+                                                                  const hipblasStride   strideA,
+                                                                  int*                  ipiv,
+                                                                  const hipblasStride   strideP,
+                                                                  hipblasDoubleComplex* B,
+                                                                  const int             ldb,
+                                                                  const hipblasStride   strideB,
+                                                                  hipblasDoubleComplex* X,
+                                                                  const int             ldx,
+                                                                  const hipblasStride   strideX,
+                                                                  int*                  iter,
+                                                                  int*                  info,
+                                                                  int*                  deviceInfo,
+                                                                  const int             batchCount)
+{
+    return hipblasZCgesvStridedBatched(handle,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       X,
+                                       ldx,
+                                       strideX,
+                                       iter,
+                                       info,
+                                       deviceInfo,
+                                       batchCount);
+}
+
+#endif
+
+// gtsvStridedBatched
+template <>
+hipblasStatus_t hipblasGtsvStridedBatched<float>(hipblasHandle_t     handle,
+                                                 const int           n,
+                                                 const float*        dl,
+                                                 const float*        d,
+                                                 const float*        du,
+                                                 const hipblasStride strideA,
+                                                 float*              x,
+                                                 const hipblasStride strideX,
+                                                 const int           batchCount)
+{
+    return hipblasSgtsvStridedBatched(handle, n, dl, d, du, strideA, x, strideX, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGtsvStridedBatched<double>(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const double*       dl,
+                                                  const double*       d,
+                                                  const double*       du,
+                                                  const hipblasStride strideA,
+                                                  double*             x,
+                                                  const hipblasStride strideX,
+                                                  const int           batchCount)
+{
+    return hipblasDgtsvStridedBatched(handle, n, dl, d, du, strideA, x, strideX, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGtsvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          const int             n,
+                                                          const hipblasComplex* dl,
+                                                          const hipblasComplex* d,
+                                                          const hipblasComplex* du,
+                                                          const hipblasStride   strideA,
+                                                          hipblasComplex*       x,
+                                                          const hipblasStride   strideX,
+                                                          const int             batchCount)
+{
+    return hipblasCgtsvStridedBatched(handle, n, dl, d, du, strideA, x, strideX, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGtsvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                    const int                   n,
+                                                    const hipblasDoubleComplex* dl,
+                                                    const hipblasDoubleComplex* d,
+                                                    const hipblasDoubleComplex* du,
+                                                    const hipblasStride         strideA,
+                                                    hipblasDoubleComplex*       x,
+                                                    const hipblasStride         strideX,
+                                                    const int                   batchCount)
+{
+    return hipblasZgtsvStridedBatched(handle, n, dl, d, du, strideA, x, strideX, batchCount);
+}
+
+// gtsvInterleavedBatched
+template <>
+hipblasStatus_t hipblasGtsvInterleavedBatched<float>(hipblasHandle_t handle,
+                                                     const int       n,
+                                                     const float*    dl,
+                                                     const float*    d,
+                                                     const float*    du,
+                                                     float*          x,
+                                                     const int       batchCount)
+{
+    return hipblasSgtsvInterleavedBatched(handle, n, dl, d, du, x, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGtsvInterleavedBatched<double>(hipblasHandle_t handle,
+                                                      const int       n,
+                                                      const double*   dl,
+                                                      const double*   d,
+                                                      const double*   du,
+                                                      double*         x,
+                                                      const int       batchCount)
+{
+    return hipblasDgtsvInterleavedBatched(handle, n, dl, d, du, x, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGtsvInterleavedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                              const int             n,
+                                                              const hipblasComplex* dl,
+                                                              const hipblasComplex* d,
+                                                              const hipblasComplex* du,
+                                                              hipblasComplex*       x,
+                                                              const int             batchCount)
+{
+    return hipblasCgtsvInterleavedBatched(handle, n, dl, d, du, x, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGtsvInterleavedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                        const int                   n,
+                                                        const hipblasDoubleComplex* dl,
+                                                        const hipblasDoubleComplex* d,
+                                                        const hipblasDoubleComplex* du,
+                                                        hipblasDoubleComplex*       x,
+                                                        const int                   batchCount)
+{
+    return hipblasZgtsvInterleavedBatched(handle, n, dl, d, du, x, batchCount);
+}
+
+// gbsvBatched
+template <>
+hipblasStatus_t hipblasGbsvBatched<float>(hipblasHandle_t handle,
+                                          const int       n,
+                                          const int       kl,
+                                          const int       ku,
+                                          const int       nrhs,
+                                          float* const    AB[],
+                                          const int       ldab,
+                                          int*            ipiv,
+                                          float* const    B[],
+                                          const int       ldb,
+                                          int*            info,
+                                          const int       batchCount)
+{
+    return hipblasSgbsvBatched(handle, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGbsvBatched<double>(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       kl,
+                                           const int       ku,
+                                           const int       nrhs,
+                                           double* const   AB[],
+                                           const int       ldab,
+                                           int*            ipiv,
+                                           double* const   B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           const int       batchCount)
+{
+    return hipblasDgbsvBatched(handle, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGbsvBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   const int             kl,
+                                                   const int             ku,
+                                                   const int             nrhs,
+                                                   hipblasComplex* const AB[],
+                                                   const int             ldab,
+                                                   int*                  ipiv,
+                                                   hipblasComplex* const B[],
+                                                   const int             ldb,
+                                                   int*                  info,
+                                                   const int             batchCount)
+{
+    return hipblasCgbsvBatched(handle, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGbsvBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         const int                   n,
+                                                         const int                   kl,
+                                                         const int                   ku,
+                                                         const int                   nrhs,
+                                                         hipblasDoubleComplex* const AB[],
+                                                         const int                   ldab,
+                                                         int*                        ipiv,
+                                                         hipblasDoubleComplex* const B[],
+                                                         const int                   ldb,
+                                                         int*                        info,
+                                                         const int                   batchCount)
+{
+    return hipblasZgbsvBatched(handle, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb, info, batchCount);
+}
+
+// gbsvStridedBatched
+template <>
+hipblasStatus_t hipblasGbsvStridedBatched<float>(hipblasHandle_t     handle,
+                                                 const int           n,
+                                                 const int           kl,
+                                                 const int           ku,
+                                                 const int           nrhs,
+                                                 float*              AB,
+                                                 const int           ldab,
+                                                 const hipblasStride strideAB,
+                                                 int*                ipiv,
+                                                 const hipblasStride strideP,
+                                                 float*              B,
+                                                 const int           ldb,
+                                                 const hipblasStride strideB,
+                                                 int*                info,
+                                                 const int           batchCount)
+{
+    return hipblasSgbsvStridedBatched(handle,
+                                      n,
+                                      kl,
+                                      ku,
+                                      nrhs,
+                                      AB,
+                                      ldab,
+                                      strideAB,
+                                      ipiv,
+                                      strideP,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGbsvStridedBatched<double>(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           kl,
+                                                  const int           ku,
+                                                  const int           nrhs,
+                                                  double*             AB,
+                                                  const int           ldab,
+                                                  const hipblasStride strideAB,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  double*             B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount)
+{
+    return hipblasDgbsvStridedBatched(handle,
+                                      n,
+                                      kl,
+                                      ku,
+                                      nrhs,
+                                      AB,
+                                      ldab,
+                                      strideAB,
+                                      ipiv,
+                                      strideP,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGbsvStridedBatched<hipblasComplex>(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          const int           kl,
+                                                          const int           ku,
+                                                          const int           nrhs,
+                                                          hipblasComplex*     AB,
+                                                          const int           ldab,
+                                                          const hipblasStride strideAB,
+                                                          int*                ipiv,
+                                                          const hipblasStride strideP,
+                                                          hipblasComplex*     B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          const int           batchCount)
+{
+    return hipblasCgbsvStridedBatched(handle,
+                                      n,
+                                      kl,
+                                      ku,
+                                      nrhs,
+                                      AB,
+                                      ldab,
+                                      strideAB,
+                                      ipiv,
+                                      strideP,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGbsvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                const int             n,
+                                                                const int             kl,
+                                                                const int             ku,
+                                                                const int             nrhs,
+                                                                hipblasDoubleComplex* AB,
+                                                                const int             ldab,
+                                                                const hipblasStride   strideAB,
+                                                                int*                  ipiv,
+                                                                const hipblasStride   strideP,
+                                                                hipblasDoubleComplex* B,
+                                                                const int             ldb,
+                                                                const hipblasStride   strideB,
+                                                                int*                  info,
+                                                                const int             batchCount)
+{
+    return hipblasZgbsvStridedBatched(handle,
+                                      n,
+                                      kl,
+                                      ku,
+                                      nrhs,
+                                      AB,
+                                      ldab,
+                                      strideAB,
+                                      ipiv,
+                                      strideP,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      info,
+                                      batchCount);
+}
+
+// gemvOffsetBatched
+template <>
+hipblasStatus_t hipblasGemvOffsetBatched<float>(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                int                m,
+                                                int                n,
+                                                const float*       alpha,
+                                                const float*       A,
+                                                int                lda,
+                                                const uint32_t*    offsetsA,
+                                                const float*       x,
+                                                int                incx,
+                                                const uint32_t*    offsetsx,
+                                                const float*       beta,
+                                                float*             y,
+                                                int                incy,
+                                                const uint32_t*    offsetsy,
+                                                int                batchCount)
+{
+    return hipblasSgemvOffsetBatched(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     offsetsA,
+                                     x,
+                                     incx,
+                                     offsetsx,
+                                     beta,
+                                     y,
+                                     incy,
+                                     offsetsy,
+                                     batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemvOffsetBatched<double>(hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans,
+                                                 int                m,
+                                                 int                n,
+                                                 const double*      alpha,
+                                                 const double*      A,
+                                                 int                lda,
+                                                 const uint32_t*    offsetsA,
+                                                 const double*      x,
+                                                 int                incx,
+                                                 const uint32_t*    offsetsx,
+                                                 const double*      beta,
+                                                 double*            y,
+                                                 int                incy,
+                                                 const uint32_t*    offsetsy,
+                                                 int                batchCount)
+{
+    return hipblasDgemvOffsetBatched(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     offsetsA,
+                                     x,
+                                     incx,
+                                     offsetsx,
+                                     beta,
+                                     y,
+                                     incy,
+                                     offsetsy,
+                                     batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemvOffsetBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                         hipblasOperation_t    trans,
+                                                         int                   m,
+                                                         int                   n,
+                                                         const hipblasComplex* alpha,
+                                                         const hipblasComplex* A,
+                                                         int                   lda,
+                                                         const uint32_t*       offsetsA,
+                                                         const hipblasComplex* x,
+                                                         int                   incx,
+                                                         const uint32_t*       offsetsx,
+                                                         const hipblasComplex* beta,
+                                                         hipblasComplex*       y,
+                                                         int                   incy,
+                                                         const uint32_t*       offsetsy,
+                                                         int                   batchCount)
+{
+    return hipblasCgemvOffsetBatched(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     offsetsA,
+                                     x,
+                                     incx,
+                                     offsetsx,
+                                     beta,
+                                     y,
+                                     incy,
+                                     offsetsy,
+                                     batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGemvOffsetBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          trans,
+                                                   int                         m,
+                                                   int                         n,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   int                         lda,
+                                                   const uint32_t*             offsetsA,
+                                                   const hipblasDoubleComplex* x,
+                                                   int                         incx,
+                                                   const uint32_t*             offsetsx,
+                                                   const hipblasDoubleComplex* beta,
+                                                   hipblasDoubleComplex*       y,
+                                                   int                         incy,
+                                                   const uint32_t*             offsetsy,
+                                                   int                         batchCount)
+{
+    return hipblasZgemvOffsetBatched(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     offsetsA,
+                                     x,
+                                     incx,
+                                     offsetsx,
+                                     beta,
+                                     y,
+                                     incy,
+                                     offsetsy,
+                                     batchCount);
+}
+
+// gemmOffsetBatched
+template <>
+hipblasStatus_t hipblasGemmOffsetBatched<float>(hipblasHandle_t    handle,
+                                                hipblasOperation_t transA,
+                                                hipblasOperation_t transB,
+                                                int                m,
+                                                int                n,
+                                                int                k,
+                                                const float*       alpha,
+                                                const float*       A,
+                                                int                lda,
+                                                const uint32_t*    offsetsA,
+                                                const float*       B,
+                                                int                ldb,
+                                                const uint32_t*    offsetsB,
+                                                const float*       beta,
+                                                float*             C,
+                                                int                ldc,
+                                                const uint32_t*    offsetsC,
+                                                int                batchCount)
+{
+    return hipblasSgemmOffsetBatched(handle,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     offsetsA,
+                                     B,
+                                     ldb,
+                                     offsetsB,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     offsetsC,
+                                     batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmOffsetBatched<double>(hipblasHandle_t    handle,
+                                                 hipblasOperation_t transA,
+                                                 hipblasOperation_t transB,
+                                                 int                m,
+                                                 int                n,
+                                                 int                k,
+                                                 const double*      alpha,
+                                                 const double*      A,
+                                                 int                lda,
+                                                 const uint32_t*    offsetsA,
+                                                 const double*      B,
+                                                 int                ldb,
+                                                 const uint32_t*    offsetsB,
+                                                 const double*      beta,
+                                                 double*            C,
+                                                 int                ldc,
+                                                 const uint32_t*    offsetsC,
+                                                 int                batchCount)
+{
+    return hipblasDgemmOffsetBatched(handle,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     offsetsA,
+                                     B,
+                                     ldb,
+                                     offsetsB,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     offsetsC,
+                                     batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmOffsetBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                         hipblasOperation_t    transA,
+                                                         hipblasOperation_t    transB,
+                                                         int                   m,
+                                                         int                   n,
+                                                         int                   k,
+                                                         const hipblasComplex* alpha,
+                                                         const hipblasComplex* A,
+                                                         int                   lda,
+                                                         const uint32_t*       offsetsA,
+                                                         const hipblasComplex* B,
+                                                         int                   ldb,
+                                                         const uint32_t*       offsetsB,
+                                                         const hipblasComplex* beta,
+                                                         hipblasComplex*       C,
+                                                         int                   ldc,
+                                                         const uint32_t*       offsetsC,
+                                                         int                   batchCount)
+{
+    return hipblasCgemmOffsetBatched(handle,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     offsetsA,
+                                     B,
+                                     ldb,
+                                     offsetsB,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     offsetsC,
+                                     batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGemmOffsetBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasOperation_t          transB,
+                                                   int                         m,
+                                                   int                         n,
+                                                   int                         k,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   int                         lda,
+                                                   const uint32_t*             offsetsA,
+                                                   const hipblasDoubleComplex* B,
+                                                   int                         ldb,
+                                                   const uint32_t*             offsetsB,
+                                                   const hipblasDoubleComplex* beta,
+                                                   hipblasDoubleComplex*       C,
+                                                   int                         ldc,
+                                                   const uint32_t*             offsetsC,
+                                                   int                         batchCount)
+{
+    return hipblasZgemmOffsetBatched(handle,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     offsetsA,
+                                     B,
+                                     ldb,
+                                     offsetsB,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     offsetsC,
+                                     batchCount);
+}
+
+/////////////
+// FORTRAN //
+/////////////
+// axpy
+template <>
+hipblasStatus_t hipblasAxpy<hipblasHalf, true>(hipblasHandle_t    handle,
+                                               int                n,
+                                               const hipblasHalf* alpha,
+                                               const hipblasHalf* x,
+                                               int                incx,
+                                               hipblasHalf*       y,
+                                               int                incy)
+{
+    return hipblasHaxpyFortran(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy<float, true>(
+    hipblasHandle_t handle, int n, const float* alpha, const float* x, int incx, float* y, int incy)
+{
+    return hipblasSaxpyFortran(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy<double, true>(hipblasHandle_t handle,
+                                          int             n,
+                                          const double*   alpha,
+                                          const double*   x,
+                                          int             incx,
+                                          double*         y,
+                                          int             incy)
+{
+    return hipblasDaxpyFortran(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                  int                   n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int                   incx,
+                                                  hipblasComplex*       y,
+                                                  int                   incy)
+{
+    return hipblasCaxpyFortran(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                        int                         n,
+                                                        const hipblasDoubleComplex* alpha,
+                                                        const hipblasDoubleComplex* x,
+                                                        int                         incx,
+                                                        hipblasDoubleComplex*       y,
+                                                        int                         incy)
+{
+    return hipblasZaxpyFortran(handle, n, alpha, x, incx, y, incy);
+}
+
+// axpy_batched
+template <>
+hipblasStatus_t hipblasAxpyBatched<hipblasHalf, true>(hipblasHandle_t          handle,
+                                                      int                      n,
+                                                      const hipblasHalf*       alpha,
+                                                      const hipblasHalf* const x[],
+                                                      int                      incx,
+                                                      hipblasHalf* const       y[],
+                                                      int                      incy,
+                                                      int                      batch_count)
+{
+    return hipblasHaxpyBatchedFortran(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasAxpyBatched<float, true>(hipblasHandle_t    handle,
+                                                int                n,
+                                                const float*       alpha,
+                                                const float* const x[],
+                                                int                incx,
+                                                float* const       y[],
+                                                int                incy,
+                                                int                batch_count)
+{
+    return hipblasSaxpyBatchedFortran(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasAxpyBatched<double, true>(hipblasHandle_t     handle,
+                                                 int                 n,
+                                                 const double*       alpha,
+                                                 const double* const x[],
+                                                 int                 incx,
+                                                 double* const       y[],
+                                                 int                 incy,
+                                                 int                 batch_count)
+{
+    return hipblasDaxpyBatchedFortran(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasAxpyBatched<hipblasComplex, true>(hipblasHandle_t             handle,
+                                                         int                         n,
+                                                         const hipblasComplex*       alpha,
+                                                         const hipblasComplex* const x[],
+                                                         int                         incx,
+                                                         hipblasComplex* const       y[],
+                                                         int                         incy,
+                                                         int                         batch_count)
+{
+    return hipblasCaxpyBatchedFortran(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasAxpyBatched<hipblasDoubleComplex, true>(hipblasHandle_t                   handle,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   hipblasDoubleComplex* const       y[],
+                                                   int                               incy,
+                                                   int                               batch_count)
+{
+    return hipblasZaxpyBatchedFortran(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+
+// axpy_strided_batched
+template <>
+hipblasStatus_t hipblasAxpyStridedBatched<hipblasHalf, true>(hipblasHandle_t    handle,
+                                                             int                n,
+                                                             const hipblasHalf* alpha,
+                                                             const hipblasHalf* x,
+                                                             int                incx,
+                                                             hipblasStride      stridex,
+                                                             hipblasHalf*       y,
+                                                             int                incy,
+                                                             hipblasStride      stridey,
+                                                             int                batch_count)
+{
+    return hipblasHaxpyStridedBatchedFortran(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasAxpyStridedBatched<float, true>(hipblasHandle_t handle,
+                                                       int             n,
+                                                       const float*    alpha,
+                                                       const float*    x,
+                                                       int             incx,
+                                                       hipblasStride   stridex,
+                                                       float*          y,
+                                                       int             incy,
+                                                       hipblasStride   stridey,
+                                                       int             batch_count)
+{
+    return hipblasSaxpyStridedBatchedFortran(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasAxpyStridedBatched<double, true>(hipblasHandle_t handle,
+                                                        int             n,
+                                                        const double*   alpha,
+                                                        const double*   x,
+                                                        int             incx,
+                                                        hipblasStride   stridex,
+                                                        double*         y,
+                                                        int             incy,
+                                                        hipblasStride   stridey,
+                                                        int             batch_count)
+{
+    return hipblasDaxpyStridedBatchedFortran(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasAxpyStridedBatched<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                                int                   n,
+                                                                const hipblasComplex* alpha,
+                                                                const hipblasComplex* x,
+                                                                int                   incx,
+                                                                hipblasStride         stridex,
+                                                                hipblasComplex*       y,
+                                                                int                   incy,
+                                                                hipblasStride         stridey,
+                                                                int                   batch_count)
+{
+    return hipblasCaxpyStridedBatchedFortran(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasAxpyStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          hipblasDoubleComplex*       y,
+                                                          int                         incy,
+                                                          hipblasStride               stridey,
+                                                          int                         batch_count)
+{
+    return hipblasZaxpyStridedBatchedFortran(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+// scal
+template <>
+hipblasStatus_t hipblasScal<float, float, true>(
+    hipblasHandle_t handle, int n, const float* alpha, float* x, int incx)
+{
+    return hipblasSscalFortran(handle, n, alpha, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasScal<double, double, true>(
+    hipblasHandle_t handle, int n, const double* alpha, double* x, int incx)
+{
+    return hipblasDscalFortran(handle, n, alpha, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasScal<hipblasComplex, hipblasComplex, true>(
+    hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
+{
+    return hipblasCscalFortran(handle, n, alpha, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasScal<hipblasComplex, float, true>(
+    hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx)
+{
+    return hipblasCsscalFortran(handle, n, alpha, x, incx);
+}
+
+template <>
+hipblasStatus_t
+    hipblasScal<hipblasDoubleComplex, hipblasDoubleComplex, true>(hipblasHandle_t handle,
+                                                                  int             n,
+                                                                  const hipblasDoubleComplex* alpha,
+                                                                  hipblasDoubleComplex*       x,
+                                                                  int                         incx)
+{
+    return hipblasZscalFortran(handle, n, alpha, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasScal<hipblasDoubleComplex, double, true>(
+    hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
+{
+    return hipblasZdscalFortran(handle, n, alpha, x, incx);
+}
+
+// scal_batched
+template <>
+hipblasStatus_t hipblasScalBatched<float, float, true>(
+    hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batch_count)
+{
+    return hipblasSscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasScalBatched<double, double, true>(hipblasHandle_t handle,
+                                                         int             n,
+                                                         const double*   alpha,
+                                                         double* const   x[],
+                                                         int             incx,
+                                                         int             batch_count)
+{
+    return hipblasDscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasScalBatched<hipblasComplex, hipblasComplex, true>(hipblasHandle_t       handle,
+                                                             int                   n,
+                                                             const hipblasComplex* alpha,
+                                                             hipblasComplex* const x[],
+                                                             int                   incx,
+                                                             int                   batch_count)
+{
+    return hipblasCscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasScalBatched<hipblasDoubleComplex, hipblasDoubleComplex, true>(
+    hipblasHandle_t             handle,
+    int                         n,
+    const hipblasDoubleComplex* alpha,
+    hipblasDoubleComplex* const x[],
+    int                         incx,
+    int                         batch_count)
+{
+    return hipblasZscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasScalBatched<hipblasComplex, float, true>(hipblasHandle_t       handle,
+                                                                int                   n,
+                                                                const float*          alpha,
+                                                                hipblasComplex* const x[],
+                                                                int                   incx,
+                                                                int                   batch_count)
+{
+    return hipblasCsscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasScalBatched<hipblasDoubleComplex, double, true>(hipblasHandle_t             handle,
+                                                           int                         n,
+                                                           const double*               alpha,
+                                                           hipblasDoubleComplex* const x[],
+                                                           int                         incx,
+                                                           int                         batch_count)
+{
+    return hipblasZdscalBatchedFortran(handle, n, alpha, x, incx, batch_count);
+}
+
+// scal_strided_batched
+template <>
+hipblasStatus_t hipblasScalStridedBatched<float, float, true>(hipblasHandle_t handle,
+                                                              int             n,
+                                                              const float*    alpha,
+                                                              float*          x,
+                                                              int             incx,
+                                                              hipblasStride   stridex,
+                                                              int             batch_count)
+{
+    return hipblasSscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasScalStridedBatched<double, double, true>(hipblasHandle_t handle,
+                                                                int             n,
+                                                                const double*   alpha,
+                                                                double*         x,
+                                                                int             incx,
+                                                                hipblasStride   stridex,
+                                                                int             batch_count)
+{
+    return hipblasDscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasScalStridedBatched<hipblasComplex, hipblasComplex, true>(hipblasHandle_t       handle,
+                                                                    int                   n,
+                                                                    const hipblasComplex* alpha,
+                                                                    hipblasComplex*       x,
+                                                                    int                   incx,
+                                                                    hipblasStride         stridex,
+                                                                    int batch_count)
+{
+    return hipblasCscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasScalStridedBatched<hipblasDoubleComplex, hipblasDoubleComplex, true>(
+    hipblasHandle_t             handle,
+    int                         n,
+    const hipblasDoubleComplex* alpha,
+    hipblasDoubleComplex*       x,
+    int                         incx,
+    hipblasStride               stridex,
+    int                         batch_count)
+{
+    return hipblasZscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasScalStridedBatched<hipblasComplex, float, true>(hipblasHandle_t handle,
+                                                                       int             n,
+                                                                       const float*    alpha,
+                                                                       hipblasComplex* x,
+                                                                       int             incx,
+                                                                       hipblasStride   stridex,
+                                                                       int             batch_count)
+{
+    return hipblasCsscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasScalStridedBatched<hipblasDoubleComplex, double, true>(hipblasHandle_t       handle,
+                                                                  int                   n,
+                                                                  const double*         alpha,
+                                                                  hipblasDoubleComplex* x,
+                                                                  int                   incx,
+                                                                  hipblasStride         stridex,
+                                                                  int                   batch_count)
+{
+    return hipblasZdscalStridedBatchedFortran(handle, n, alpha, x, incx, stridex, batch_count);
+}
+
+//swap
+template <>
+hipblasStatus_t
+    hipblasSwap<float, true>(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
+{
+    return hipblasSswapFortran(handle, n, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasSwap<double, true>(
+    hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy)
+{
+    return hipblasDswapFortran(handle, n, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasSwap<hipblasComplex, true>(
+    hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
+{
+    return hipblasCswapFortran(handle, n, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasSwap<hipblasDoubleComplex, true>(hipblasHandle_t       handle,
+                                                        int                   n,
+                                                        hipblasDoubleComplex* x,
+                                                        int                   incx,
+                                                        hipblasDoubleComplex* y,
+                                                        int                   incy)
+{
+    return hipblasZswapFortran(handle, n, x, incx, y, incy);
+}
+
+// swap_batched
+template <>
+hipblasStatus_t hipblasSwapBatched<float, true>(
+    hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batch_count)
+{
+    return hipblasSswapBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSwapBatched<double, true>(
+    hipblasHandle_t handle, int n, double* x[], int incx, double* y[], int incy, int batch_count)
+{
+    return hipblasDswapBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSwapBatched<hipblasComplex, true>(hipblasHandle_t handle,
+                                                         int             n,
+                                                         hipblasComplex* x[],
+                                                         int             incx,
+                                                         hipblasComplex* y[],
+                                                         int             incy,
+                                                         int             batch_count)
+{
+    return hipblasCswapBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSwapBatched<hipblasDoubleComplex, true>(hipblasHandle_t       handle,
+                                                               int                   n,
+                                                               hipblasDoubleComplex* x[],
+                                                               int                   incx,
+                                                               hipblasDoubleComplex* y[],
+                                                               int                   incy,
+                                                               int                   batch_count)
+{
+    return hipblasZswapBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+}
+
+// swap_strided_batched
+template <>
+hipblasStatus_t hipblasSwapStridedBatched<float, true>(hipblasHandle_t handle,
+                                                       int             n,
+                                                       float*          x,
+                                                       int             incx,
+                                                       hipblasStride   stridex,
+                                                       float*          y,
+                                                       int             incy,
+                                                       hipblasStride   stridey,
+                                                       int             batch_count)
+{
+    return hipblasSswapStridedBatchedFortran(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSwapStridedBatched<double, true>(hipblasHandle_t handle,
+                                                        int             n,
+                                                        double*         x,
+                                                        int             incx,
+                                                        hipblasStride   stridex,
+                                                        double*         y,
+                                                        int             incy,
+                                                        hipblasStride   stridey,
+                                                        int             batch_count)
+{
+    return hipblasDswapStridedBatchedFortran(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSwapStridedBatched<hipblasComplex, true>(hipblasHandle_t handle,
+                                                                int             n,
+                                                                hipblasComplex* x,
+                                                                int             incx,
+                                                                hipblasStride   stridex,
+                                                                hipblasComplex* y,
+                                                                int             incy,
+                                                                hipblasStride   stridey,
+                                                                int             batch_count)
+{
+    return hipblasCswapStridedBatchedFortran(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSwapStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t       handle,
+                                                                      int                   n,
+                                                                      hipblasDoubleComplex* x,
+                                                                      int                   incx,
+                                                                      hipblasStride         stridex,
+                                                                      hipblasDoubleComplex* y,
+                                                                      int                   incy,
+                                                                      hipblasStride         stridey,
+                                                                      int batch_count)
+{
+    return hipblasZswapStridedBatchedFortran(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+// copy
+template <>
+hipblasStatus_t hipblasCopy<float, true>(
+    hipblasHandle_t handle, int n, const float* x, int incx, float* y, int incy)
+{
+    return hipblasScopyFortran(handle, n, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasCopy<double, true>(
+    hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy)
+{
+    return hipblasDcopyFortran(handle, n, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasCopy<hipblasComplex, true>(
+    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
+{
+    return hipblasCcopyFortran(handle, n, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasCopy<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                        int                         n,
+                                                        const hipblasDoubleComplex* x,
+                                                        int                         incx,
+                                                        hipblasDoubleComplex*       y,
+                                                        int                         incy)
+{
+    return hipblasZcopyFortran(handle, n, x, incx, y, incy);
+}
+
+// copy_batched
+template <>
+hipblasStatus_t hipblasCopyBatched<float, true>(hipblasHandle_t    handle,
+                                                int                n,
+                                                const float* const x[],
+                                                int                incx,
+                                                float* const       y[],
+                                                int                incy,
+                                                int                batch_count)
+{
+    return hipblasScopyBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasCopyBatched<double, true>(hipblasHandle_t     handle,
+                                                 int                 n,
+                                                 const double* const x[],
+                                                 int                 incx,
+                                                 double* const       y[],
+                                                 int                 incy,
+                                                 int                 batch_count)
+{
+    return hipblasDcopyBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasCopyBatched<hipblasComplex, true>(hipblasHandle_t             handle,
+                                                         int                         n,
+                                                         const hipblasComplex* const x[],
+                                                         int                         incx,
+                                                         hipblasComplex* const       y[],
+                                                         int                         incy,
+                                                         int                         batch_count)
+{
+    return hipblasCcopyBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasCopyBatched<hipblasDoubleComplex, true>(hipblasHandle_t                   handle,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   hipblasDoubleComplex* const       y[],
+                                                   int                               incy,
+                                                   int                               batch_count)
+{
+    return hipblasZcopyBatchedFortran(handle, n, x, incx, y, incy, batch_count);
+}
+
+// copy_strided_batched
+template <>
+hipblasStatus_t hipblasCopyStridedBatched<float, true>(hipblasHandle_t handle,
+                                                       int             n,
+                                                       const float*    x,
+                                                       int             incx,
+                                                       hipblasStride   stridex,
+                                                       float*          y,
+                                                       int             incy,
+                                                       hipblasStride   stridey,
+                                                       int             batch_count)
+{
+    return hipblasScopyStridedBatchedFortran(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasCopyStridedBatched<double, true>(hipblasHandle_t handle,
+                                                        int             n,
+                                                        const double*   x,
+                                                        int             incx,
+                                                        hipblasStride   stridex,
+                                                        double*         y,
+                                                        int             incy,
+                                                        hipblasStride   stridey,
+                                                        int             batch_count)
+{
+    return hipblasDcopyStridedBatchedFortran(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasCopyStridedBatched<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                                int                   n,
+                                                                const hipblasComplex* x,
+                                                                int                   incx,
+                                                                hipblasStride         stridex,
+                                                                hipblasComplex*       y,
+                                                                int                   incy,
+                                                                hipblasStride         stridey,
+                                                                int                   batch_count)
+{
+    return hipblasCcopyStridedBatchedFortran(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasCopyStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t handle,
+                                                                      int             n,
+                                                                      const hipblasDoubleComplex* x,
+                                                                      int                   incx,
+                                                                      hipblasStride         stridex,
+                                                                      hipblasDoubleComplex* y,
+                                                                      int                   incy,
+                                                                      hipblasStride         stridey,
+                                                                      int batch_count)
+{
+    return hipblasZcopyStridedBatchedFortran(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
+
+// dot
+template <>
+hipblasStatus_t hipblasDot<hipblasHalf, true>(hipblasHandle_t    handle,
+                                              int                n,
+                                              const hipblasHalf* x,
+                                              int                incx,
+                                              const hipblasHalf* y,
+                                              int                incy,
+                                              hipblasHalf*       result)
+{
+    return hipblasHdotFortran(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot<hipblasBfloat16, true>(hipblasHandle_t        handle,
+                                                  int                    n,
+                                                  const hipblasBfloat16* x,
+                                                  int                    incx,
+                                                  const hipblasBfloat16* y,
+                                                  int                    incy,
+                                                  hipblasBfloat16*       result)
+{
+    return hipblasBfdotFortran(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot<float, true>(hipblasHandle_t handle,
+                                        int             n,
+                                        const float*    x,
+                                        int             incx,
+                                        const float*    y,
+                                        int             incy,
+                                        float*          result)
+{
+    return hipblasSdotFortran(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot<double, true>(hipblasHandle_t handle,
+                                         int             n,
+                                         const double*   x,
+                                         int             incx,
+                                         const double*   y,
+                                         int             incy,
+                                         double*         result)
+{
+    return hipblasDdotFortran(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                 int                   n,
+                                                 const hipblasComplex* x,
+                                                 int                   incx,
+                                                 const hipblasComplex* y,
+                                                 int                   incy,
+                                                 hipblasComplex*       result)
+{
+    return hipblasCdotuFortran(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                       int                         n,
+                                                       const hipblasDoubleComplex* x,
+                                                       int                         incx,
+                                                       const hipblasDoubleComplex* y,
+                                                       int                         incy,
+                                                       hipblasDoubleComplex*       result)
+{
+    return hipblasZdotuFortran(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDotc<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                  int                   n,
                                                   const hipblasComplex* x,
                                                   int                   incx,
                                                   const hipblasComplex* y,
@@ -20662,161 +23502,784 @@ hipblasStatus_t hipblasGels<hipblasDoubleComplex, true>(hipblasHandle_t       ha
                                                         int*                  info,
                                                         int*                  deviceInfo)
 {
-    return hipblasZgelsFortran(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo);
+    return hipblasZgelsFortran(handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo);
+}
+
+// gelsBatched
+template <>
+hipblasStatus_t hipblasGelsBatched<float, true>(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                const int          m,
+                                                const int          n,
+                                                const int          nrhs,
+                                                float* const       A[],
+                                                const int          lda,
+                                                float* const       B[],
+                                                const int          ldb,
+                                                int*               info,
+                                                int*               deviceInfo,
+                                                const int          batchCount)
+{
+    return hipblasSgelsBatchedFortran(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsBatched<double, true>(hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans,
+                                                 const int          m,
+                                                 const int          n,
+                                                 const int          nrhs,
+                                                 double* const      A[],
+                                                 const int          lda,
+                                                 double* const      B[],
+                                                 const int          ldb,
+                                                 int*               info,
+                                                 int*               deviceInfo,
+                                                 const int          batchCount)
+{
+    return hipblasDgelsBatchedFortran(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsBatched<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                         hipblasOperation_t    trans,
+                                                         const int             m,
+                                                         const int             n,
+                                                         const int             nrhs,
+                                                         hipblasComplex* const A[],
+                                                         const int             lda,
+                                                         hipblasComplex* const B[],
+                                                         const int             ldb,
+                                                         int*                  info,
+                                                         int*                  deviceInfo,
+                                                         const int             batchCount)
+{
+    return hipblasCgelsBatchedFortran(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                               hipblasOperation_t          trans,
+                                                               const int                   m,
+                                                               const int                   n,
+                                                               const int                   nrhs,
+                                                               hipblasDoubleComplex* const A[],
+                                                               const int                   lda,
+                                                               hipblasDoubleComplex* const B[],
+                                                               const int                   ldb,
+                                                               int*                        info,
+                                                               int*      deviceInfo,
+                                                               const int batchCount)
+{
+    return hipblasZgelsBatchedFortran(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+}
+
+// gelsStridedBatched
+template <>
+hipblasStatus_t hipblasGelsStridedBatched<float, true>(hipblasHandle_t     handle,
+                                                       hipblasOperation_t  trans,
+                                                       const int           m,
+                                                       const int           n,
+                                                       const int           nrhs,
+                                                       float*              A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       float*              B,
+                                                       const int           ldb,
+                                                       const hipblasStride strideB,
+                                                       int*                info,
+                                                       int*                deviceInfo,
+                                                       const int           batchCount)
+{
+    return hipblasSgelsStridedBatchedFortran(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsStridedBatched<double, true>(hipblasHandle_t     handle,
+                                                        hipblasOperation_t  trans,
+                                                        const int           m,
+                                                        const int           n,
+                                                        const int           nrhs,
+                                                        double*             A,
+                                                        const int           lda,
+                                                        const hipblasStride strideA,
+                                                        double*             B,
+                                                        const int           ldb,
+                                                        const hipblasStride strideB,
+                                                        int*                info,
+                                                        int*                deviceInfo,
+                                                        const int           batchCount)
+{
+    return hipblasDgelsStridedBatchedFortran(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsStridedBatched<hipblasComplex, true>(hipblasHandle_t     handle,
+                                                                hipblasOperation_t  trans,
+                                                                const int           m,
+                                                                const int           n,
+                                                                const int           nrhs,
+                                                                hipblasComplex*     A,
+                                                                const int           lda,
+                                                                const hipblasStride strideA,
+                                                                hipblasComplex*     B,
+                                                                const int           ldb,
+                                                                const hipblasStride strideB,
+                                                                int*                info,
+                                                                int*                deviceInfo,
+                                                                const int           batchCount)
+{
+    return hipblasCgelsStridedBatchedFortran(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t       handle,
+                                                                      hipblasOperation_t    trans,
+                                                                      const int             m,
+                                                                      const int             n,
+                                                                      const int             nrhs,
+                                                                      hipblasDoubleComplex* A,
+                                                                      const int             lda,
+                                                                      const hipblasStride   strideA,
+                                                                      hipblasDoubleComplex* B,
+                                                                      const int             ldb,
+                                                                      const hipblasStride   strideB,
+                                                                      int*                  info,
+                                                                      int*      deviceInfo,
+                                                                      const int batchCount)
+{
+    return hipblasZgelsStridedBatchedFortran(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
 }
 
-// gelsBatched
+// gesvBatched
 template <>
-hipblasStatus_t hipblasGelsBatched<float, true>(hipblasHandle_t    handle,
-                                                hipblasOperation_t trans,
-                                                const int          m,
-                                                const int          n,
-                                                const int          nrhs,
-                                                float* const       A[],
-                                                const int          lda,
-                                                float* const       B[],
-                                                const int          ldb,
-                                                int*               info,
-                                                int*               deviceInfo,
-                                                const int          batchCount)
+hipblasStatus_t hipblasGesvBatched<float, true>(hipblasHandle_t handle,
+                                                const int       n,
+                                                const int       nrhs,
+                                                float* const    A[],
+                                                const int       lda,
+                                                int*            ipiv,
+                                                float* const    B[],
+                                                const int       ldb,
+                                                int*            info,
+                                                const int       batchCount)
 {
-    return hipblasSgelsBatchedFortran(
-        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+    return hipblasSgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGelsBatched<double, true>(hipblasHandle_t    handle,
-                                                 hipblasOperation_t trans,
-                                                 const int          m,
-                                                 const int          n,
-                                                 const int          nrhs,
-                                                 double* const      A[],
-                                                 const int          lda,
-                                                 double* const      B[],
-                                                 const int          ldb,
-                                                 int*               info,
-                                                 int*               deviceInfo,
-                                                 const int          batchCount)
+hipblasStatus_t hipblasGesvBatched<double, true>(hipblasHandle_t handle,
+                                                 const int       n,
+                                                 const int       nrhs,
+                                                 double* const   A[],
+                                                 const int       lda,
+                                                 int*            ipiv,
+                                                 double* const   B[],
+                                                 const int       ldb,
+                                                 int*            info,
+                                                 const int       batchCount)
 {
-    return hipblasDgelsBatchedFortran(
-        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+    return hipblasDgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGelsBatched<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                         hipblasOperation_t    trans,
-                                                         const int             m,
+hipblasStatus_t hipblasGesvBatched<hipblasComplex, true>(hipblasHandle_t       handle,
                                                          const int             n,
                                                          const int             nrhs,
                                                          hipblasComplex* const A[],
                                                          const int             lda,
+                                                         int*                  ipiv,
                                                          hipblasComplex* const B[],
                                                          const int             ldb,
                                                          int*                  info,
-                                                         int*                  deviceInfo,
                                                          const int             batchCount)
 {
-    return hipblasCgelsBatchedFortran(
-        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+    return hipblasCgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGelsBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                               hipblasOperation_t          trans,
-                                                               const int                   m,
+hipblasStatus_t hipblasGesvBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
                                                                const int                   n,
                                                                const int                   nrhs,
                                                                hipblasDoubleComplex* const A[],
                                                                const int                   lda,
+                                                               int*                        ipiv,
                                                                hipblasDoubleComplex* const B[],
                                                                const int                   ldb,
                                                                int*                        info,
-                                                               int*      deviceInfo,
                                                                const int batchCount)
 {
-    return hipblasZgelsBatchedFortran(
-        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
+    return hipblasZgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
 }
 
-// gelsStridedBatched
+// gesvStridedBatched
 template <>
-hipblasStatus_t hipblasGelsStridedBatched<float, true>(hipblasHandle_t     handle,
-                                                       hipblasOperation_t  trans,
-                                                       const int           m,
+hipblasStatus_t hipblasGesvStridedBatched<float, true>(hipblasHandle_t     handle,
                                                        const int           n,
                                                        const int           nrhs,
                                                        float*              A,
                                                        const int           lda,
                                                        const hipblasStride strideA,
+                                                       int*                ipiv,
+                                                       const hipblasStride strideP,
                                                        float*              B,
                                                        const int           ldb,
                                                        const hipblasStride strideB,
                                                        int*                info,
-                                                       int*                deviceInfo,
                                                        const int           batchCount)
 {
-    return hipblasSgelsStridedBatchedFortran(
-        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+    return hipblasSgesvStridedBatchedFortran(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGelsStridedBatched<double, true>(hipblasHandle_t     handle,
-                                                        hipblasOperation_t  trans,
-                                                        const int           m,
+hipblasStatus_t hipblasGesvStridedBatched<double, true>(hipblasHandle_t     handle,
                                                         const int           n,
                                                         const int           nrhs,
                                                         double*             A,
                                                         const int           lda,
                                                         const hipblasStride strideA,
+                                                        int*                ipiv,
+                                                        const hipblasStride strideP,
                                                         double*             B,
                                                         const int           ldb,
                                                         const hipblasStride strideB,
                                                         int*                info,
-                                                        int*                deviceInfo,
                                                         const int           batchCount)
 {
-    return hipblasDgelsStridedBatchedFortran(
-        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+    return hipblasDgesvStridedBatchedFortran(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGelsStridedBatched<hipblasComplex, true>(hipblasHandle_t     handle,
-                                                                hipblasOperation_t  trans,
-                                                                const int           m,
+hipblasStatus_t hipblasGesvStridedBatched<hipblasComplex, true>(hipblasHandle_t     handle,
                                                                 const int           n,
                                                                 const int           nrhs,
                                                                 hipblasComplex*     A,
                                                                 const int           lda,
                                                                 const hipblasStride strideA,
+                                                                int*                ipiv,
+                                                                const hipblasStride strideP,
                                                                 hipblasComplex*     B,
                                                                 const int           ldb,
                                                                 const hipblasStride strideB,
                                                                 int*                info,
-                                                                int*                deviceInfo,
                                                                 const int           batchCount)
 {
-    return hipblasCgelsStridedBatchedFortran(
-        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+    return hipblasCgesvStridedBatchedFortran(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGelsStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t       handle,
-                                                                      hipblasOperation_t    trans,
-                                                                      const int             m,
+hipblasStatus_t hipblasGesvStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t       handle,
                                                                       const int             n,
                                                                       const int             nrhs,
                                                                       hipblasDoubleComplex* A,
                                                                       const int             lda,
                                                                       const hipblasStride   strideA,
+                                                                      int*                  ipiv,
+                                                                      const hipblasStride   strideP,
                                                                       hipblasDoubleComplex* B,
                                                                       const int             ldb,
                                                                       const hipblasStride   strideB,
                                                                       int*                  info,
-                                                                      int*      deviceInfo,
                                                                       const int batchCount)
 {
-    return hipblasZgelsStridedBatchedFortran(
-        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+    return hipblasZgesvStridedBatchedFortran(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+// potrf
+template <>
+hipblasStatus_t hipblasPotrf<float, true>(hipblasHandle_t         handle,
+                                          const hipblasFillMode_t uplo,
+                                          const int               n,
+                                          float*                  A,
+                                          const int               lda,
+                                          int*                    info)
+{
+    return hipblasSpotrfFortran(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrf<double, true>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           double*                 A,
+                                           const int               lda,
+                                           int*                    info)
+{
+    return hipblasDpotrfFortran(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrf<hipblasComplex, true>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   int*                    info)
+{
+    return hipblasCpotrfFortran(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrf<hipblasDoubleComplex, true>(hipblasHandle_t         handle,
+                                                         const hipblasFillMode_t uplo,
+                                                         const int               n,
+                                                         hipblasDoubleComplex*   A,
+                                                         const int               lda,
+                                                         int*                    info)
+{
+    return hipblasZpotrfFortran(handle, uplo, n, A, lda, info);
+}
+
+// potrfBatched
+template <>
+hipblasStatus_t hipblasPotrfBatched<float, true>(hipblasHandle_t         handle,
+                                                 const hipblasFillMode_t uplo,
+                                                 const int               n,
+                                                 float* const            A[],
+                                                 const int               lda,
+                                                 int*                    info,
+                                                 const int               batchCount)
+{
+    return hipblasSpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfBatched<double, true>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  double* const           A[],
+                                                  const int               lda,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasDpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfBatched<hipblasComplex, true>(hipblasHandle_t         handle,
+                                                          const hipblasFillMode_t uplo,
+                                                          const int               n,
+                                                          hipblasComplex* const   A[],
+                                                          const int               lda,
+                                                          int*                    info,
+                                                          const int               batchCount)
+{
+    return hipblasCpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                                const hipblasFillMode_t     uplo,
+                                                                const int                   n,
+                                                                hipblasDoubleComplex* const A[],
+                                                                const int                   lda,
+                                                                int*                        info,
+                                                                const int batchCount)
+{
+    return hipblasZpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount);
+}
+
+// potrfStridedBatched
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<float, true>(hipblasHandle_t         handle,
+                                                        const hipblasFillMode_t uplo,
+                                                        const int               n,
+                                                        float*                  A,
+                                                        const int               lda,
+                                                        const hipblasStride     strideA,
+                                                        int*                    info,
+                                                        const int               batchCount)
+{
+    return hipblasSpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<double, true>(hipblasHandle_t         handle,
+                                                         const hipblasFillMode_t uplo,
+                                                         const int               n,
+                                                         double*                 A,
+                                                         const int               lda,
+                                                         const hipblasStride     strideA,
+                                                         int*                    info,
+                                                         const int               batchCount)
+{
+    return hipblasDpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<hipblasComplex, true>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 hipblasComplex*         A,
+                                                                 const int               lda,
+                                                                 const hipblasStride     strideA,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
+{
+    return hipblasCpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t handle,
+                                                                       const hipblasFillMode_t uplo,
+                                                                       const int               n,
+                                                                       hipblasDoubleComplex*   A,
+                                                                       const int               lda,
+                                                                       const hipblasStride strideA,
+                                                                       int*                    info,
+                                                                       const int batchCount)
+{
+    return hipblasZpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+// potrs
+template <>
+hipblasStatus_t hipblasPotrs<float, true>(hipblasHandle_t         handle,
+                                          const hipblasFillMode_t uplo,
+                                          const int               n,
+                                          const int               nrhs,
+                                          float*                  A,
+                                          const int               lda,
+                                          float*                  B,
+                                          const int               ldb,
+                                          int*                    info)
+{
+    return hipblasSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrs<double, true>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           double*                 A,
+                                           const int               lda,
+                                           double*                 B,
+                                           const int               ldb,
+                                           int*                    info)
+{
+    return hipblasDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrs<hipblasComplex, true>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   hipblasComplex*         B,
+                                                   const int               ldb,
+                                                   int*                    info)
+{
+    return hipblasCpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrs<hipblasDoubleComplex, true>(hipblasHandle_t         handle,
+                                                         const hipblasFillMode_t uplo,
+                                                         const int               n,
+                                                         const int               nrhs,
+                                                         hipblasDoubleComplex*   A,
+                                                         const int               lda,
+                                                         hipblasDoubleComplex*   B,
+                                                         const int               ldb,
+                                                         int*                    info)
+{
+    return hipblasZpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+// potrsBatched
+template <>
+hipblasStatus_t hipblasPotrsBatched<float, true>(hipblasHandle_t         handle,
+                                                 const hipblasFillMode_t uplo,
+                                                 const int               n,
+                                                 const int               nrhs,
+                                                 float* const            A[],
+                                                 const int               lda,
+                                                 float* const            B[],
+                                                 const int               ldb,
+                                                 int*                    info,
+                                                 const int               batchCount)
+{
+    return hipblasSpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsBatched<double, true>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  const int               nrhs,
+                                                  double* const           A[],
+                                                  const int               lda,
+                                                  double* const           B[],
+                                                  const int               ldb,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasDpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsBatched<hipblasComplex, true>(hipblasHandle_t         handle,
+                                                          const hipblasFillMode_t uplo,
+                                                          const int               n,
+                                                          const int               nrhs,
+                                                          hipblasComplex* const   A[],
+                                                          const int               lda,
+                                                          hipblasComplex* const   B[],
+                                                          const int               ldb,
+                                                          int*                    info,
+                                                          const int               batchCount)
+{
+    return hipblasCpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                                const hipblasFillMode_t     uplo,
+                                                                const int                   n,
+                                                                const int                   nrhs,
+                                                                hipblasDoubleComplex* const A[],
+                                                                const int                   lda,
+                                                                hipblasDoubleComplex* const B[],
+                                                                const int                   ldb,
+                                                                int*                        info,
+                                                                const int batchCount)
+{
+    return hipblasZpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+// potrsStridedBatched
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<float, true>(hipblasHandle_t         handle,
+                                                        const hipblasFillMode_t uplo,
+                                                        const int               n,
+                                                        const int               nrhs,
+                                                        float*                  A,
+                                                        const int               lda,
+                                                        const hipblasStride     strideA,
+                                                        float*                  B,
+                                                        const int               ldb,
+                                                        const hipblasStride     strideB,
+                                                        int*                    info,
+                                                        const int               batchCount)
+{
+    return hipblasSpotrsStridedBatchedFortran(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<double, true>(hipblasHandle_t         handle,
+                                                         const hipblasFillMode_t uplo,
+                                                         const int               n,
+                                                         const int               nrhs,
+                                                         double*                 A,
+                                                         const int               lda,
+                                                         const hipblasStride     strideA,
+                                                         double*                 B,
+                                                         const int               ldb,
+                                                         const hipblasStride     strideB,
+                                                         int*                    info,
+                                                         const int               batchCount)
+{
+    return hipblasDpotrsStridedBatchedFortran(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<hipblasComplex, true>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 const int               nrhs,
+                                                                 hipblasComplex*         A,
+                                                                 const int               lda,
+                                                                 const hipblasStride     strideA,
+                                                                 hipblasComplex*         B,
+                                                                 const int               ldb,
+                                                                 const hipblasStride     strideB,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
+{
+    return hipblasCpotrsStridedBatchedFortran(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t handle,
+                                                                       const hipblasFillMode_t uplo,
+                                                                       const int               n,
+                                                                       const int               nrhs,
+                                                                       hipblasDoubleComplex*   A,
+                                                                       const int               lda,
+                                                                       const hipblasStride strideA,
+                                                                       hipblasDoubleComplex*   B,
+                                                                       const int               ldb,
+                                                                       const hipblasStride strideB,
+                                                                       int*                    info,
+                                                                       const int batchCount)
+{
+    return hipblasZpotrsStridedBatchedFortran(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+// potri
+template <>
+hipblasStatus_t hipblasPotri<float, true>(hipblasHandle_t         handle,
+                                          const hipblasFillMode_t uplo,
+                                          const int               n,
+                                          float*                  A,
+                                          const int               lda,
+                                          int*                    info)
+{
+    return hipblasSpotriFortran(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotri<double, true>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           double*                 A,
+                                           const int               lda,
+                                           int*                    info)
+{
+    return hipblasDpotriFortran(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotri<hipblasComplex, true>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   int*                    info)
+{
+    return hipblasCpotriFortran(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotri<hipblasDoubleComplex, true>(hipblasHandle_t         handle,
+                                                         const hipblasFillMode_t uplo,
+                                                         const int               n,
+                                                         hipblasDoubleComplex*   A,
+                                                         const int               lda,
+                                                         int*                    info)
+{
+    return hipblasZpotriFortran(handle, uplo, n, A, lda, info);
+}
+
+// potriBatched
+template <>
+hipblasStatus_t hipblasPotriBatched<float, true>(hipblasHandle_t         handle,
+                                                 const hipblasFillMode_t uplo,
+                                                 const int               n,
+                                                 float* const            A[],
+                                                 const int               lda,
+                                                 int*                    info,
+                                                 const int               batchCount)
+{
+    return hipblasSpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriBatched<double, true>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  double* const           A[],
+                                                  const int               lda,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasDpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriBatched<hipblasComplex, true>(hipblasHandle_t         handle,
+                                                          const hipblasFillMode_t uplo,
+                                                          const int               n,
+                                                          hipblasComplex* const   A[],
+                                                          const int               lda,
+                                                          int*                    info,
+                                                          const int               batchCount)
+{
+    return hipblasCpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                                const hipblasFillMode_t     uplo,
+                                                                const int                   n,
+                                                                hipblasDoubleComplex* const A[],
+                                                                const int                   lda,
+                                                                int*                        info,
+                                                                const int batchCount)
+{
+    return hipblasZpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount);
+}
+
+// potriStridedBatched
+template <>
+hipblasStatus_t hipblasPotriStridedBatched<float, true>(hipblasHandle_t         handle,
+                                                        const hipblasFillMode_t uplo,
+                                                        const int               n,
+                                                        float*                  A,
+                                                        const int               lda,
+                                                        const hipblasStride     strideA,
+                                                        int*                    info,
+                                                        const int               batchCount)
+{
+    return hipblasSpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriStridedBatched<double, true>(hipblasHandle_t         handle,
+                                                         const hipblasFillMode_t uplo,
+                                                         const int               n,
+                                                         double*                 A,
+                                                         const int               lda,
+                                                         const hipblasStride     strideA,
+                                                         int*                    info,
+                                                         const int               batchCount)
+{
+    return hipblasDpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriStridedBatched<hipblasComplex, true>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 hipblasComplex*         A,
+                                                                 const int               lda,
+                                                                 const hipblasStride     strideA,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
+{
+    return hipblasCpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotriStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t handle,
+                                                                       const hipblasFillMode_t uplo,
+                                                                       const int               n,
+                                                                       hipblasDoubleComplex*   A,
+                                                                       const int               lda,
+                                                                       const hipblasStride strideA,
+                                                                       int*                    info,
+                                                                       const int batchCount)
+{
+    return hipblasZpotriStridedBatchedFortran(handle, uplo, n, A, lda, strideA, info, batchCount);
 }
 
 #endif
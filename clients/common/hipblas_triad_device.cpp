@@ -0,0 +1,43 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "device_bandwidth.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+__global__ void hipblas_triad_kernel(
+    double* a, const double* b, const double* c, double scalar, size_t n)
+{
+    for(size_t i = size_t(blockIdx.x) * blockDim.x + threadIdx.x; i < n;
+        i += size_t(blockDim.x) * gridDim.x)
+        a[i] = b[i] + scalar * c[i];
+}
+
+hipError_t hipblas_device_triad(
+    double* a, const double* b, const double* c, double scalar, size_t n, hipStream_t stream)
+{
+    constexpr int block  = 256;
+    int           blocks = int(std::min<size_t>((n + block - 1) / block, 65536));
+    hipLaunchKernelGGL(
+        hipblas_triad_kernel, dim3(blocks), dim3(block), 0, stream, a, b, c, scalar, n);
+    return hipGetLastError();
+}
@@ -0,0 +1,296 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "native_blas.hpp"
+#include <type_traits>
+
+#ifndef WIN32
+#include <dlfcn.h>
+#endif
+
+static bool compare_native = false;
+
+void hipblas_set_compare_native(bool compare)
+{
+    compare_native = compare;
+}
+
+bool hipblas_get_compare_native()
+{
+    return compare_native;
+}
+
+#ifndef WIN32
+// The symbol of each routine, by precision
+struct hipblasNativeNames
+{
+    const char* axpy;
+    const char* dot;
+    const char* nrm2;
+    const char* scal;
+    const char* gemv;
+    const char* ger;
+    const char* trsv;
+    const char* gemm;
+    const char* gemm_strided_batched;
+    const char* trsm;
+};
+
+#ifdef __HIP_PLATFORM_NVCC__
+static const char* const native_libraries[]
+    = {"libcublas.so.12", "libcublas.so.11", "libcublas.so"};
+
+static const hipblasNativeNames native_names[2] = {{"cublasSaxpy_v2",
+                                                    "cublasSdot_v2",
+                                                    "cublasSnrm2_v2",
+                                                    "cublasSscal_v2",
+                                                    "cublasSgemv_v2",
+                                                    "cublasSger_v2",
+                                                    "cublasStrsv_v2",
+                                                    "cublasSgemm_v2",
+                                                    "cublasSgemmStridedBatched",
+                                                    "cublasStrsm_v2"},
+                                                   {"cublasDaxpy_v2",
+                                                    "cublasDdot_v2",
+                                                    "cublasDnrm2_v2",
+                                                    "cublasDscal_v2",
+                                                    "cublasDgemv_v2",
+                                                    "cublasDger_v2",
+                                                    "cublasDtrsv_v2",
+                                                    "cublasDgemm_v2",
+                                                    "cublasDgemmStridedBatched",
+                                                    "cublasDtrsm_v2"}};
+
+// cublasGemmEx with CUDA_R_32F or CUDA_R_64F, CUBLAS_COMPUTE_32F or CUBLAS_COMPUTE_64F and
+// CUBLAS_GEMM_DEFAULT
+typedef int (*native_gemm_ex_t)(hipblasHandle_t,
+                                int,
+                                int,
+                                int,
+                                int,
+                                int,
+                                const void*,
+                                const void*,
+                                int,
+                                int,
+                                const void*,
+                                int,
+                                int,
+                                const void*,
+                                void*,
+                                int,
+                                int,
+                                int,
+                                int);
+
+static native_gemm_ex_t native_gemm_ex = nullptr;
+
+template <typename T>
+static int hipblas_native_gemm_ex(hipblasHandle_t handle,
+                                  int             m,
+                                  int             n,
+                                  int             k,
+                                  const T*        alpha,
+                                  const T*        A,
+                                  int             lda,
+                                  const T*        B,
+                                  int             ldb,
+                                  const T*        beta,
+                                  T*              C,
+                                  int             ldc)
+{
+    int type    = std::is_same<T, float>{} ? 0 : 1;
+    int compute = std::is_same<T, float>{} ? 68 : 70;
+    return native_gemm_ex(
+        handle, 0, 0, m, n, k, alpha, A, type, lda, B, type, ldb, beta, C, type, ldc, compute, -1);
+}
+#else
+static const char* const native_libraries[] = {"librocblas.so.4", "librocblas.so"};
+
+static const hipblasNativeNames native_names[2] = {{"rocblas_saxpy",
+                                                    "rocblas_sdot",
+                                                    "rocblas_snrm2",
+                                                    "rocblas_sscal",
+                                                    "rocblas_sgemv",
+                                                    "rocblas_sger",
+                                                    "rocblas_strsv",
+                                                    "rocblas_sgemm",
+                                                    "rocblas_sgemm_strided_batched",
+                                                    "rocblas_strsm"},
+                                                   {"rocblas_daxpy",
+                                                    "rocblas_ddot",
+                                                    "rocblas_dnrm2",
+                                                    "rocblas_dscal",
+                                                    "rocblas_dgemv",
+                                                    "rocblas_dger",
+                                                    "rocblas_dtrsv",
+                                                    "rocblas_dgemm",
+                                                    "rocblas_dgemm_strided_batched",
+                                                    "rocblas_dtrsm"}};
+
+// rocblas_gemm_ex with rocblas_datatype_f32_r or rocblas_datatype_f64_r as the data and compute
+// types, C as D, rocblas_gemm_algo_standard, solution 0 and no flags
+typedef int (*native_gemm_ex_t)(hipblasHandle_t,
+                                int,
+                                int,
+                                int,
+                                int,
+                                int,
+                                const void*,
+                                const void*,
+                                int,
+                                int,
+                                const void*,
+                                int,
+                                int,
+                                const void*,
+                                const void*,
+                                int,
+                                int,
+                                void*,
+                                int,
+                                int,
+                                int,
+                                int,
+                                int32_t,
+                                uint32_t);
+
+static native_gemm_ex_t native_gemm_ex = nullptr;
+
+template <typename T>
+static int hipblas_native_gemm_ex(hipblasHandle_t handle,
+                                  int             m,
+                                  int             n,
+                                  int             k,
+                                  const T*        alpha,
+                                  const T*        A,
+                                  int             lda,
+                                  const T*        B,
+                                  int             ldb,
+                                  const T*        beta,
+                                  T*              C,
+                                  int             ldc)
+{
+    int type = std::is_same<T, float>{} ? 151 : 152;
+    return native_gemm_ex(handle,
+                          111,
+                          111,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          A,
+                          type,
+                          lda,
+                          B,
+                          type,
+                          ldb,
+                          beta,
+                          C,
+                          type,
+                          ldc,
+                          C,
+                          type,
+                          ldc,
+                          type,
+                          0,
+                          0,
+                          0);
+}
+#endif
+
+static void* hipblas_native_library()
+{
+    static void* library = [] {
+        void* lib = nullptr;
+        for(const char* name : native_libraries)
+        {
+            if(!lib)
+                lib = dlopen(name, RTLD_NOW);
+        }
+        if(lib)
+            native_gemm_ex = (native_gemm_ex_t)dlsym(
+                lib,
+#ifdef __HIP_PLATFORM_NVCC__
+                "cublasGemmEx"
+#else
+                "rocblas_gemm_ex"
+#endif
+            );
+        return lib;
+    }();
+    return library;
+}
+
+template <typename T>
+static hipblasNativeBlas<T> hipblas_load_native_blas(bool& loaded)
+{
+    hipblasNativeBlas<T>      blas  = {};
+    void*                     lib   = hipblas_native_library();
+    const hipblasNativeNames& names = native_names[std::is_same<T, float>{} ? 0 : 1];
+    if(!lib || !native_gemm_ex)
+        return blas;
+
+#ifdef __HIP_PLATFORM_NVCC__
+    blas.op_n       = 0; // CUBLAS_OP_N
+    blas.fill_lower = 0; // CUBLAS_FILL_MODE_LOWER
+    blas.diag_unit  = 1; // CUBLAS_DIAG_UNIT
+    blas.side_left  = 0; // CUBLAS_SIDE_LEFT
+#else
+    blas.op_n       = 111; // rocblas_operation_none
+    blas.fill_lower = 122; // rocblas_fill_lower
+    blas.diag_unit  = 132; // rocblas_diagonal_unit
+    blas.side_left  = 141; // rocblas_side_left
+#endif
+    blas.axpy                 = (decltype(blas.axpy))dlsym(lib, names.axpy);
+    blas.dot                  = (decltype(blas.dot))dlsym(lib, names.dot);
+    blas.nrm2                 = (decltype(blas.nrm2))dlsym(lib, names.nrm2);
+    blas.scal                 = (decltype(blas.scal))dlsym(lib, names.scal);
+    blas.gemv                 = (decltype(blas.gemv))dlsym(lib, names.gemv);
+    blas.ger                  = (decltype(blas.ger))dlsym(lib, names.ger);
+    blas.trsv                 = (decltype(blas.trsv))dlsym(lib, names.trsv);
+    blas.gemm                 = (decltype(blas.gemm))dlsym(lib, names.gemm);
+    blas.gemm_strided_batched = (decltype(blas.gemm_strided_batched))dlsym(
+        lib, names.gemm_strided_batched);
+    blas.trsm    = (decltype(blas.trsm))dlsym(lib, names.trsm);
+    blas.gemm_ex = hipblas_native_gemm_ex<T>;
+    loaded       = blas.axpy && blas.dot && blas.nrm2 && blas.scal && blas.gemv && blas.ger
+             && blas.trsv && blas.gemm && blas.gemm_strided_batched && blas.trsm;
+    return blas;
+}
+#endif
+
+template <typename T>
+const hipblasNativeBlas<T>* hipblas_native_blas()
+{
+#ifndef WIN32
+    static bool                       loaded = false;
+    static const hipblasNativeBlas<T> blas   = hipblas_load_native_blas<T>(loaded);
+    return loaded ? &blas : nullptr;
+#else
+    return nullptr;
+#endif
+}
+
+template const hipblasNativeBlas<float>*  hipblas_native_blas<float>();
+template const hipblasNativeBlas<double>* hipblas_native_blas<double>();
@@ -43,6 +43,8 @@
 #define NEAR_CHECK(M, N, batch_count, lda, strideA, hCPU, hGPU, err, NEAR_ASSERT)    \
     do                                                                               \
     {                                                                                \
+        if(hipblas_identical(M, N, batch_count, lda, strideA, hCPU, hGPU))           \
+            break;                                                                   \
         for(size_t k = 0; k < batch_count; k++)                                      \
             for(size_t j = 0; j < N; j++)                                            \
                 for(size_t i = 0; i < M; i++)                                        \
@@ -61,6 +63,8 @@
 #define NEAR_CHECK_B(M, N, batch_count, lda, hCPU, hGPU, err, NEAR_ASSERT)            \
     do                                                                                \
     {                                                                                 \
+        if(hipblas_identical(M, N, batch_count, lda, hCPU, hGPU))                     \
+            break;                                                                    \
         for(size_t k = 0; k < batch_count; k++)                                       \
             for(size_t j = 0; j < N; j++)                                             \
                 for(size_t i = 0; i < M; i++)                                         \
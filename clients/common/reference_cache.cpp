@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "reference_cache.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+
+static const char* reference_cache_dir = std::getenv("HIPBLAS_CLIENT_REFERENCE_CACHE");
+
+hipblas_reference_cache::hipblas_reference_cache(const char* routine)
+    : key(0xcbf29ce484222325) // FNV-1a offset basis
+{
+    hash(routine, strlen(routine) + 1);
+}
+
+hipblas_reference_cache& hipblas_reference_cache::hash(const void* data, size_t bytes)
+{
+    if(!reference_cache_dir)
+        return *this;
+
+    // FNV-1a over the bytes and their count, so that adjacent buffers do not alias
+    const unsigned char* p = (const unsigned char*)data;
+    for(size_t i = 0; i < bytes; i++)
+        key = (key ^ p[i]) * 0x100000001b3;
+    for(size_t i = 0; i < sizeof(bytes); i++)
+        key = (key ^ ((bytes >> (8 * i)) & 0xff)) * 0x100000001b3;
+    return *this;
+}
+
+static std::string reference_cache_path(uint64_t key)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "/%016llx.ref", (unsigned long long)key);
+    return reference_cache_dir + std::string(name);
+}
+
+bool hipblas_reference_cache::load()
+{
+    if(!reference_cache_dir)
+        return false;
+
+    std::ifstream file(reference_cache_path(key), std::ios::binary);
+    if(!file)
+        return false;
+
+    size_t bytes = 0;
+    for(auto& output : outputs)
+        bytes += output.second;
+
+    // An entry of another size is a hash collision or a partial write, and is recomputed
+    file.seekg(0, std::ios::end);
+    if(!file || size_t(file.tellg()) != bytes)
+        return false;
+    file.seekg(0);
+
+    // Read into a copy, so the outputs stay untouched if the read fails
+    std::vector<char> data(bytes);
+    if(!file.read(data.data(), bytes))
+        return false;
+
+    const char* p = data.data();
+    for(auto& output : outputs)
+    {
+        memcpy(output.first, p, output.second);
+        p += output.second;
+    }
+    return true;
+}
+
+void hipblas_reference_cache::store()
+{
+    if(!reference_cache_dir)
+        return;
+
+    // Written to a file of a random name and renamed, so concurrent runs never read a partial entry
+    std::string path = reference_cache_path(key);
+    std::string temp = path + "." + std::to_string(std::random_device{}());
+    {
+        std::ofstream file(temp, std::ios::binary);
+        for(auto& output : outputs)
+            file.write((const char*)output.first, output.second);
+        if(!file)
+        {
+            file.close();
+            std::remove(temp.c_str());
+            return;
+        }
+    }
+    if(std::rename(temp.c_str(), path.c_str()))
+        std::remove(temp.c_str());
+}
@@ -42,6 +42,8 @@
 #define UNIT_CHECK(M, N, batch_count, lda, strideA, hCPU, hGPU, UNIT_ASSERT_EQ)      \
     do                                                                               \
     {                                                                                \
+        if(hipblas_identical(M, N, batch_count, lda, strideA, hCPU, hGPU))           \
+            break;                                                                   \
         for(size_t k = 0; k < batch_count; k++)                                      \
             for(size_t j = 0; j < N; j++)                                            \
                 for(size_t i = 0; i < M; i++)                                        \
@@ -59,6 +61,8 @@
 #define UNIT_CHECK_B(M, N, batch_count, lda, hCPU, hGPU, UNIT_ASSERT_EQ)            \
     do                                                                              \
     {                                                                               \
+        if(hipblas_identical(M, N, batch_count, lda, hCPU, hGPU))                   \
+            break;                                                                  \
         for(size_t k = 0; k < batch_count; k++)                                     \
             for(size_t j = 0; j < N; j++)                                           \
                 for(size_t i = 0; i < M; i++)                                       \
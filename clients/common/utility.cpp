@@ -30,12 +30,16 @@
 
 #include "hipblas.h"
 #include "utility.h"
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <new>
 #include <stdexcept>
 #include <stdlib.h>
+#include <utility>
 
 #ifdef WIN32
 #define strcasecmp(A, B) _stricmp(A, B)
@@ -178,9 +182,23 @@ std::string hipblas_tempname()
  * local handles *
  *****************/
 
+static bool handle_reuse = false;
+
+void hipblas_set_handle_reuse(bool reuse)
+{
+    handle_reuse = reuse;
+}
+
+bool hipblas_get_handle_reuse()
+{
+    return handle_reuse;
+}
+
 hipblasLocalHandle::hipblasLocalHandle()
+    : m_pooled(handle_reuse)
 {
-    auto status = hipblasCreate(&m_handle);
+    auto status
+        = m_pooled ? hipblasHandlePoolAcquire(&m_handle, nullptr) : hipblasCreate(&m_handle);
     if(status != HIPBLAS_STATUS_SUCCESS)
         throw std::runtime_error(hipblasStatusToString(status));
 }
@@ -197,24 +215,45 @@ hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
         status = hipblasSetAtomicsMode(m_handle, hipblasAtomicsMode_t(arg.atomics_mode));
     if(status == HIPBLAS_STATUS_SUCCESS)
     {
-        /*
         // If the test specifies user allocated workspace, allocate and use it
         if(arg.user_allocated_workspace)
         {
             if((hipMalloc)(&m_memory, arg.user_allocated_workspace) != hipSuccess)
                 throw std::bad_alloc();
-            status = rocblas_set_workspace(m_handle, m_memory, arg.user_allocated_workspace);
+            status = hipblasSetWorkspace(m_handle, m_memory, arg.user_allocated_workspace);
         }
-    */
     }
-    else
-    {
+
+    if(status == HIPBLAS_STATUS_SUCCESS && hipblas_get_bench_thread().stream)
+        status = hipblasSetStream(m_handle, hipblas_get_bench_thread().stream);
+    if(status == HIPBLAS_STATUS_SUCCESS
+       && hipblas_get_bench_thread().priority != HIPBLAS_STREAM_PRIORITY_DEFAULT)
+        status = hipblasSetStreamPriority(m_handle, hipblas_get_bench_thread().priority);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
         throw std::runtime_error(hipblasStatusToString(status));
-    }
 }
 
 hipblasLocalHandle::~hipblasLocalHandle()
 {
+    if(m_pooled)
+    {
+        // The stream set by the case may already be destroyed, so the pool orders the next user
+        // after the work of the case through the null stream, which waits for blocking streams
+        hipblasStatus_t status = hipblasSetStream(m_handle, nullptr);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasHandlePoolRelease(m_handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            printf("hipblasHandlePoolRelease error!\n");
+        }
+        if(m_memory)
+        {
+            CHECK_HIP_ERROR(hipFree(m_memory));
+        }
+        return;
+    }
+
     if(m_memory)
     {
         CHECK_HIP_ERROR(hipFree(m_memory));
@@ -226,6 +265,462 @@ hipblasLocalHandle::~hipblasLocalHandle()
     }
 }
 
+/****************
+ * event timers *
+ ****************/
+
+static bool                      timing_events     = false;
+static bool                      graph_replay      = false;
+static size_t                    flush_memory_size = 0;
+static thread_local hipblasTimes iteration_times;
+
+void hipblas_set_timing_events(bool events)
+{
+    timing_events = events;
+}
+
+bool hipblas_get_timing_events()
+{
+    return timing_events;
+}
+
+void hipblas_set_graph_replay(bool graph)
+{
+    graph_replay = graph;
+}
+
+bool hipblas_get_graph_replay()
+{
+    return graph_replay;
+}
+
+void hipblas_set_flush_memory_size(size_t bytes)
+{
+    flush_memory_size = bytes;
+}
+
+size_t hipblas_get_flush_memory_size()
+{
+    return flush_memory_size;
+}
+
+static bool                 timing_pointer_mode_set = false;
+static hipblasPointerMode_t timing_pointer_mode     = HIPBLAS_POINTER_MODE_HOST;
+
+void hipblas_set_timing_pointer_mode(bool set, hipblasPointerMode_t mode)
+{
+    timing_pointer_mode_set = set;
+    timing_pointer_mode     = mode;
+}
+
+bool hipblas_get_timing_pointer_mode_set()
+{
+    return timing_pointer_mode_set;
+}
+
+hipblasPointerMode_t hipblas_timing_pointer_mode(hipblasPointerMode_t preferred_mode)
+{
+    return timing_pointer_mode_set ? timing_pointer_mode : preferred_mode;
+}
+
+hipblasTimes hipblas_take_iteration_times()
+{
+    return std::exchange(iteration_times, {});
+}
+
+static thread_local hipblasBenchThread bench_thread;
+
+void hipblas_set_bench_thread(const hipblasBenchThread& thread)
+{
+    bench_thread = thread;
+}
+
+const hipblasBenchThread& hipblas_get_bench_thread()
+{
+    return bench_thread;
+}
+
+static std::mutex              concurrent_mutex;
+static hipblasConcurrentTotals concurrent_totals;
+
+void hipblas_add_concurrent_totals(double gflop, double gbyte, double start_us, double end_us)
+{
+    std::lock_guard<std::mutex> lock(concurrent_mutex);
+    hipblasConcurrentTotals&    totals = concurrent_totals;
+    if(!totals.tests || start_us < totals.start_us)
+        totals.start_us = start_us;
+    if(!totals.tests || end_us > totals.end_us)
+        totals.end_us = end_us;
+    totals.gflop += gflop;
+    totals.gbyte += gbyte;
+    totals.tests++;
+}
+
+hipblasConcurrentTotals hipblas_take_concurrent_totals()
+{
+    std::lock_guard<std::mutex> lock(concurrent_mutex);
+    return std::exchange(concurrent_totals, {});
+}
+
+static void hipblas_throw_on_error(hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        throw std::runtime_error(hipblasStatusToString(status));
+}
+
+hipblasEventTimer::hipblasEventTimer(const Arguments& arg, hipblasHandle_t handle)
+    : m_handle(handle)
+    , m_cold_iters(arg.cold_iters)
+    , m_iters(arg.iters)
+    , m_graph(graph_replay && arg.iters > 0)
+    , m_flush_size(flush_memory_size)
+{
+    iteration_times = {};
+    hipblas_throw_on_error(hipblasGetStream(handle, &m_stream));
+    hipblas_throw_on_error(hipblasGetPointerMode(handle, &iteration_times.pointer_mode));
+    if((timing_events || m_graph || m_flush_size) && arg.iters > 0)
+    {
+        m_start.resize(arg.iters);
+        m_stop.resize(arg.iters);
+        for(auto& event : m_start)
+            CHECK_HIP_ERROR(hipEventCreate(&event));
+        for(auto& event : m_stop)
+            CHECK_HIP_ERROR(hipEventCreate(&event));
+    }
+    if(m_flush_size)
+        CHECK_HIP_ERROR(hipMalloc(&m_flush, m_flush_size));
+    if(hipblas_get_telemetry() && arg.iters > 0)
+        m_telemetry = std::make_unique<hipblasTelemetrySampler>();
+    if(!hipblas_get_counters().empty() && arg.iters > 0)
+        m_counters = std::make_unique<hipblasCounterSession>();
+    if(hipblas_get_kernel_breakdown() && arg.iters > 0)
+        m_tracer = std::make_unique<hipblasKernelTracer>();
+}
+
+hipblasEventTimer::~hipblasEventTimer()
+{
+    // A call failed during capture
+    if(m_capture)
+    {
+        hipGraph_t graph = nullptr;
+        if(hipStreamEndCapture(m_capture, &graph) == hipSuccess && graph)
+            (void)hipGraphDestroy(graph);
+        (void)hipblasSetStream(m_handle, m_stream);
+        (void)hipStreamDestroy(m_capture);
+    }
+    for(auto event : m_start)
+        CHECK_HIP_ERROR(hipEventDestroy(event));
+    for(auto event : m_stop)
+        CHECK_HIP_ERROR(hipEventDestroy(event));
+    if(m_flush)
+        CHECK_HIP_ERROR(hipFree(m_flush));
+}
+
+int hipblasEventTimer::runs() const
+{
+    return m_cold_iters + (m_graph ? 2 : 1) * std::max(m_iters, 0) + (m_counters ? 1 : 0)
+           + (m_tracer ? 1 : 0);
+}
+
+void hipblasEventTimer::record(int iter)
+{
+    int hot = iter - m_cold_iters;
+    if(hot > 0 && hot <= int(m_stop.size()))
+        CHECK_HIP_ERROR(hipEventRecord(m_stop[hot - 1], m_stream));
+
+    if(hot == 0)
+    {
+        m_start_us = get_time_us_sync(m_stream);
+        if(m_telemetry)
+            m_telemetry->start();
+    }
+
+    // The calls after the timed ones are counted and traced in passes of their own, so that the
+    // profilers do not perturb their times, and without the flush, whose writes would be counted
+    // with them. The device is idle at the start and end of each.
+    int counted     = m_iters;
+    int traced      = counted + (m_counters ? 1 : 0);
+    int graph_first = traced + (m_tracer ? 1 : 0);
+    if(hot == m_iters && (m_counters || m_tracer))
+    {
+        m_end_us = get_time_us_sync(m_stream);
+        if(m_telemetry)
+            iteration_times.telemetry = m_telemetry->stop();
+    }
+    if(m_counters && hot == counted + 1)
+    {
+        CHECK_HIP_ERROR(hipStreamSynchronize(m_stream));
+        iteration_times.counters = m_counters->stop();
+    }
+    if(m_tracer && hot == traced + 1)
+    {
+        CHECK_HIP_ERROR(hipStreamSynchronize(m_stream));
+        iteration_times.kernels = m_tracer->stop();
+    }
+    if(m_counters && hot == counted)
+    {
+        m_counters->start();
+        return;
+    }
+    if(m_tracer && hot == traced)
+    {
+        m_tracer->start();
+        return;
+    }
+
+    // The next m_iters hot calls are captured on a stream of their own, as the null stream
+    // cannot be captured
+    if(m_graph && hot == graph_first)
+    {
+        if(!m_counters && !m_tracer)
+        {
+            m_end_us = get_time_us_sync(m_stream);
+            if(m_telemetry)
+                iteration_times.telemetry = m_telemetry->stop();
+        }
+        CHECK_HIP_ERROR(hipStreamCreate(&m_capture));
+        hipblas_throw_on_error(hipblasSetStream(m_handle, m_capture));
+        CHECK_HIP_ERROR(hipStreamBeginCapture(m_capture, hipStreamCaptureModeGlobal));
+    }
+    if(hot >= graph_first && m_graph)
+        return;
+
+    // Writing a buffer larger than the caches evicts the operands of the previous iteration
+    if(m_flush)
+        CHECK_HIP_ERROR(hipMemsetAsync(m_flush, iter & 0xff, m_flush_size, m_stream));
+
+    if(hot >= 0 && hot < int(m_start.size()))
+        CHECK_HIP_ERROR(hipEventRecord(m_start[hot], m_stream));
+}
+
+void hipblasEventTimer::stop()
+{
+    if(m_iters < 1)
+        return;
+
+    hipGraph_t graph = nullptr;
+    if(m_capture)
+    {
+        hipError_t status = hipStreamEndCapture(m_capture, &graph);
+        hipblas_throw_on_error(hipblasSetStream(m_handle, m_stream));
+        CHECK_HIP_ERROR(hipStreamDestroy(m_capture));
+        m_capture = nullptr;
+        if(status != hipSuccess)
+        {
+            fprintf(stderr, "hipblas-bench: graph capture failed: %s\n", hipGetErrorString(status));
+            (void)hipGetLastError();
+            graph = nullptr;
+        }
+    }
+    else if(m_counters || m_tracer)
+    {
+        // The last pass is still running
+        CHECK_HIP_ERROR(hipStreamSynchronize(m_stream));
+        if(m_tracer)
+            iteration_times.kernels = m_tracer->stop();
+        else
+            iteration_times.counters = m_counters->stop();
+    }
+    else
+    {
+        if(!m_stop.empty())
+            CHECK_HIP_ERROR(hipEventRecord(m_stop.back(), m_stream));
+        m_end_us = get_time_us_sync(m_stream);
+        if(m_telemetry)
+            iteration_times.telemetry = m_telemetry->stop();
+    }
+    iteration_times.start_us = m_start_us;
+    iteration_times.end_us   = m_end_us;
+    if(m_stop.empty())
+        return;
+    CHECK_HIP_ERROR(hipEventSynchronize(m_stop.back()));
+
+    // hipEventElapsedTime is in milliseconds
+    iteration_times.hot_us.resize(m_stop.size());
+    for(size_t i = 0; i < m_stop.size(); i++)
+    {
+        float ms;
+        CHECK_HIP_ERROR(hipEventElapsedTime(&ms, m_start[i], m_stop[i]));
+        iteration_times.hot_us[i] = ms * 1000.0;
+    }
+
+    if(!m_graph)
+        return;
+    iteration_times.graph_us = -1;
+
+    // The calls of a routine that does not run on the handle stream are not captured
+    size_t nodes = 0;
+    if(graph)
+        CHECK_HIP_ERROR(hipGraphGetNodes(graph, nullptr, &nodes));
+    if(nodes)
+    {
+        // One replay to upload the graph, then a timed one
+        hipGraphExec_t exec;
+        float          ms;
+        CHECK_HIP_ERROR(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+        CHECK_HIP_ERROR(hipGraphLaunch(exec, m_stream));
+        CHECK_HIP_ERROR(hipEventRecord(m_start[0], m_stream));
+        CHECK_HIP_ERROR(hipGraphLaunch(exec, m_stream));
+        CHECK_HIP_ERROR(hipEventRecord(m_stop[0], m_stream));
+        CHECK_HIP_ERROR(hipEventSynchronize(m_stop[0]));
+        CHECK_HIP_ERROR(hipEventElapsedTime(&ms, m_start[0], m_stop[0]));
+        CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+        iteration_times.graph_us = ms * 1000.0;
+    }
+    if(graph)
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+}
+
+/*****************************
+ * device memory of d_vector *
+ *****************************/
+
+// HIPBLAS_CLIENT_DEVICE_POOL=1 reuses device memory from the start of the process
+static bool hipblas_device_memory_reuse_env()
+{
+    const char* env = std::getenv("HIPBLAS_CLIENT_DEVICE_POOL");
+    return env && std::strtol(env, nullptr, 0);
+}
+
+// Blocks are keyed by device and size, so a block is only reused on the device it was allocated on
+using hipblas_device_block = std::pair<int, size_t>;
+
+static bool device_memory_reuse = hipblas_device_memory_reuse_env();
+
+static std::mutex                                 device_memory_mutex;
+static std::multimap<hipblas_device_block, void*> device_memory_free;
+static std::map<void*, hipblas_device_block>      device_memory_used;
+
+static void hipblas_device_memory_release()
+{
+    for(auto& block : device_memory_free)
+        CHECK_HIP_ERROR((hipFree)(block.second));
+    device_memory_free.clear();
+}
+
+bool hipblas_set_device_memory_reuse(bool reuse)
+{
+    std::lock_guard<std::mutex> lock(device_memory_mutex);
+    bool                        previous = device_memory_reuse;
+    device_memory_reuse                  = reuse;
+    if(!reuse)
+        hipblas_device_memory_release();
+    return previous;
+}
+
+hipError_t hipblas_device_malloc(void** ptr, size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(device_memory_mutex);
+    if(!device_memory_reuse)
+        return (hipMalloc)(ptr, bytes);
+
+    int        device;
+    hipError_t status = hipGetDevice(&device);
+    if(status != hipSuccess)
+        return status;
+
+    // Smallest free block of the device that fits
+    auto block = device_memory_free.lower_bound({device, bytes});
+    if(block != device_memory_free.end() && block->first.first == device)
+    {
+        *ptr                     = block->second;
+        device_memory_used[*ptr] = block->first;
+        device_memory_free.erase(block);
+        return hipSuccess;
+    }
+
+    status = (hipMalloc)(ptr, bytes);
+    if(status == hipErrorOutOfMemory && !device_memory_free.empty())
+    {
+        hipblas_device_memory_release();
+        status = (hipMalloc)(ptr, bytes);
+    }
+    if(status == hipSuccess)
+        device_memory_used[*ptr] = {device, bytes};
+    return status;
+}
+
+hipError_t hipblas_device_free(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(device_memory_mutex);
+    auto                        block = device_memory_used.find(ptr);
+    if(block == device_memory_used.end())
+        return (hipFree)(ptr);
+
+    if(device_memory_reuse)
+        device_memory_free.emplace(block->second, ptr);
+    else
+        CHECK_HIP_ERROR((hipFree)(ptr));
+    device_memory_used.erase(block);
+    return hipSuccess;
+}
+
+static size_t device_batch_alignment = 0;
+static bool   device_batch_shuffle   = false;
+
+void hipblas_set_device_batch_layout(size_t alignment, bool shuffle)
+{
+    if(alignment & (alignment - 1))
+        throw std::invalid_argument("The alignment of batch vectors must be a power of two");
+    device_batch_alignment = alignment;
+    device_batch_shuffle   = shuffle;
+}
+
+size_t hipblas_device_batch_alignment()
+{
+    return device_batch_alignment;
+}
+
+bool hipblas_device_batch_shuffle()
+{
+    return device_batch_shuffle;
+}
+
+static size_t device_pointer_offset = 0;
+
+void hipblas_set_device_pointer_offset(size_t offset)
+{
+    device_pointer_offset = offset;
+}
+
+size_t hipblas_device_pointer_offset()
+{
+    return device_pointer_offset;
+}
+
+/*****************************************
+ * host memory of host_vector and batches *
+ *****************************************/
+
+static bool host_memory_pinned = false;
+
+void hipblas_set_host_memory_pinned(bool pinned)
+{
+    host_memory_pinned = pinned;
+}
+
+bool hipblas_host_memory_pinned()
+{
+    return host_memory_pinned;
+}
+
+void* hipblas_host_malloc(size_t bytes, bool pinned)
+{
+    if(!pinned)
+        return malloc(bytes);
+
+    void* ptr;
+    return hipHostMalloc(&ptr, bytes, hipHostMallocDefault) == hipSuccess ? ptr : nullptr;
+}
+
+void hipblas_host_free(void* ptr, bool pinned)
+{
+    if(!pinned)
+        free(ptr);
+    else if(ptr)
+        CHECK_HIP_ERROR(hipHostFree(ptr));
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
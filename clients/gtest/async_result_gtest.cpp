@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_async_result.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+typedef std::tuple<int, int> async_result_tuple;
+
+const int N_range[] = {10, 1000, 7111};
+
+const int incx_range[] = {1, 2, -1};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 reductions into pinned host memory:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_async_result_arguments(async_result_tuple tup)
+{
+    Arguments arg;
+
+    arg.N    = std::get<0>(tup);
+    arg.incx = std::get<1>(tup);
+
+    arg.timing
+        = 0; // disable timing data print out. Not supposed to collect performance data in gtest
+
+    return arg;
+}
+
+class async_result_gtest : public ::TestWithParam<async_result_tuple>
+{
+protected:
+    async_result_gtest() {}
+    virtual ~async_result_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(async_result_gtest, async_result_float)
+{
+    Arguments arg = setup_async_result_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_async_result<float>(arg));
+}
+
+TEST_P(async_result_gtest, async_result_double)
+{
+    Arguments arg = setup_async_result_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_async_result<double>(arg));
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_async_result,
+                         async_result_gtest,
+                         Combine(ValuesIn(N_range), ValuesIn(incx_range)));
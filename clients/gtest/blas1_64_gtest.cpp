@@ -0,0 +1,93 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_blas1_64.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+typedef std::tuple<int, vector<int>> blas1_64_tuple;
+
+const int N_range[] = {-1, 10, 500, 7111};
+
+// vector of vector, each pair is a {incx, incy};
+const vector<vector<int>> incx_incy_range = {
+    {1, 1},
+    {1, 2},
+    {-1, -1},
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 ILP64 (_64) interfaces:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_blas1_64_arguments(blas1_64_tuple tup)
+{
+    Arguments   arg;
+    vector<int> incx_incy = std::get<1>(tup);
+
+    arg.N     = std::get<0>(tup);
+    arg.incx  = incx_incy[0];
+    arg.incy  = incx_incy[1];
+    arg.alpha = 2.0;
+
+    arg.timing
+        = 0; // disable timing data print out. Not supposed to collect performance data in gtest
+
+    return arg;
+}
+
+class blas1_64_gtest : public ::TestWithParam<blas1_64_tuple>
+{
+protected:
+    blas1_64_gtest() {}
+    virtual ~blas1_64_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(blas1_64_gtest, axpy_dot_iamax_float)
+{
+    Arguments       arg    = setup_blas1_64_arguments(GetParam());
+    hipblasStatus_t status = testing_blas1_64(arg);
+
+    // _64 interfaces report HIPBLAS_STATUS_NOT_SUPPORTED when the backend predates ILP64
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_blas1_64,
+                         blas1_64_gtest,
+                         Combine(ValuesIn(N_range), ValuesIn(incx_incy_range)));
@@ -0,0 +1,106 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_blas1_fused_ex.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+typedef std::tuple<int, vector<double>, vector<int>> blas1_fused_ex_tuple;
+
+// Up to 50000 the integer float dot products stay below 2^24, so they are exact
+const int N_range[] = {-1, 0, 10, 1000, 50000};
+
+// vector of vector, each pair is a {alpha, beta};
+const vector<vector<double>> alpha_beta_range = {
+    {2.0, 0.0},
+    {-1.0, 3.0},
+};
+
+// vector of vector, each pair is a {incx, incy};
+const vector<vector<int>> incx_incy_range = {
+    {1, 1},
+    {2, 3},
+    {-1, -2},
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     Fused BLAS-1: hipblasAxpyDotEx, hipblasDotDualEx, hipblasAxpbyNrm2Ex
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_blas1_fused_ex_arguments(blas1_fused_ex_tuple tup)
+{
+    Arguments      arg;
+    vector<double> alpha_beta = std::get<1>(tup);
+    vector<int>    incx_incy  = std::get<2>(tup);
+
+    arg.N     = std::get<0>(tup);
+    arg.alpha = alpha_beta[0];
+    arg.beta  = alpha_beta[1];
+    arg.incx  = incx_incy[0];
+    arg.incy  = incx_incy[1];
+
+    arg.timing
+        = 0; // disable timing data print out. Not supposed to collect performance data in gtest
+
+    return arg;
+}
+
+class blas1_fused_ex_gtest : public ::TestWithParam<blas1_fused_ex_tuple>
+{
+protected:
+    blas1_fused_ex_gtest() {}
+    virtual ~blas1_fused_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(blas1_fused_ex_gtest, fused_float)
+{
+    Arguments arg = setup_blas1_fused_ex_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_blas1_fused_ex<float>(arg));
+}
+
+TEST_P(blas1_fused_ex_gtest, fused_double)
+{
+    Arguments arg = setup_blas1_fused_ex_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_blas1_fused_ex<double>(arg));
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_blas1_fused_ex,
+                         blas1_fused_ex_gtest,
+                         Combine(ValuesIn(N_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(incx_incy_range)));
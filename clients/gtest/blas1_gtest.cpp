@@ -585,7 +585,7 @@ TEST_P(blas1_gtest, scal_float_complex_float)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
+#if !defined(__HIP_PLATFORM_NVCC__) || defined(HIPBLAS_BATCHED_LEVEL1)
 
 // scal_batched tests
 TEST_P(blas1_gtest, scal_batched_float)
@@ -1466,7 +1466,7 @@ TEST_P(blas1_gtest, nrm2_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
+#if !defined(__HIP_PLATFORM_NVCC__) || defined(HIPBLAS_BATCHED_LEVEL1)
 
 // nrm2_batched tests
 TEST_P(blas1_gtest, nrm2_batched_float)
@@ -2247,7 +2247,7 @@ TEST_P(blas1_gtest, amax_float_complex)
     EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
+#if !defined(__HIP_PLATFORM_NVCC__) || defined(HIPBLAS_BATCHED_LEVEL1)
 
 // amax_batched
 TEST_P(blas1_gtest, amax_batched_float)
@@ -2344,7 +2344,7 @@ TEST_P(blas1_gtest, amin_float_complex)
     EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
+#if !defined(__HIP_PLATFORM_NVCC__) || defined(HIPBLAS_BATCHED_LEVEL1)
 
 // amin_batched
 TEST_P(blas1_gtest, amin_batched_float)
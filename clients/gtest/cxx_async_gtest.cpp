@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_cxx_async.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// The size n of the square gemms and their scalars: n, alpha, beta
+typedef std::tuple<int, vector<double>> cxx_async_tuple;
+
+const vector<int> cxx_async_n_range = {1, 33, 256};
+
+const vector<vector<double>> cxx_async_alpha_beta_range = {{1.0, 0.0}, {2.0, -0.5}};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     C++ async API:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_cxx_async_arguments(cxx_async_tuple tup)
+{
+    int            n          = std::get<0>(tup);
+    vector<double> alpha_beta = std::get<1>(tup);
+
+    Arguments arg;
+    arg.N     = n;
+    arg.alpha = alpha_beta[0];
+    arg.beta  = alpha_beta[1];
+    return arg;
+}
+
+class cxx_async_gtest : public ::TestWithParam<cxx_async_tuple>
+{
+protected:
+    cxx_async_gtest() {}
+    virtual ~cxx_async_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(cxx_async_gtest, cxx_async_float)
+{
+    Arguments       arg    = setup_cxx_async_arguments(GetParam());
+    hipblasStatus_t status = testing_cxx_async<float>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+TEST_P(cxx_async_gtest, cxx_async_double)
+{
+    Arguments       arg    = setup_cxx_async_arguments(GetParam());
+    hipblasStatus_t status = testing_cxx_async<double>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasCxxAsync,
+                         cxx_async_gtest,
+                         Combine(ValuesIn(cxx_async_n_range),
+                                 ValuesIn(cxx_async_alpha_beta_range)));
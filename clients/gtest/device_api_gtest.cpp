@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_device_api.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// The scalars of the device API calls: alpha, beta
+typedef std::tuple<vector<double>> device_api_tuple;
+
+const vector<vector<double>> device_api_alpha_beta_range = {{1.0, 0.0}, {2.0, -0.5}};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS device_api:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_device_api_arguments(device_api_tuple tup)
+{
+    vector<double> alpha_beta = std::get<0>(tup);
+
+    Arguments arg;
+    arg.alpha = alpha_beta[0];
+    arg.beta  = alpha_beta[1];
+    return arg;
+}
+
+class device_api_gtest : public ::TestWithParam<device_api_tuple>
+{
+protected:
+    device_api_gtest() {}
+    virtual ~device_api_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(device_api_gtest, device_api_float)
+{
+    Arguments       arg    = setup_device_api_arguments(GetParam());
+    hipblasStatus_t status = testing_device_api<float>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+TEST_P(device_api_gtest, device_api_double)
+{
+    Arguments       arg    = setup_device_api_arguments(GetParam());
+    hipblasStatus_t status = testing_device_api<double>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_device_api,
+                         device_api_gtest,
+                         Combine(ValuesIn(device_api_alpha_beta_range)));
@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gbsv_strided_batched.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, vector<int>, double, int> gbsv_strided_batched_tuple;
+
+// {N, ldab, ldb}. ldab = 2 is only large enough for KL = KU = 0.
+const vector<vector<int>> matrix_size_range
+    = {{-1, 1, 1}, {10, 2, 10}, {10, 12, 10}, {32, 12, 40}, {100, 15, 100}};
+
+// {KL, KU}
+const vector<vector<int>> band_range = {{0, 0}, {1, 1}, {2, 3}, {4, 1}};
+
+const vector<double> stride_scale_range = {1.0, 2.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 2, 100};
+
+Arguments setup_gbsv_strided_batched_arguments(gbsv_strided_batched_tuple tup)
+{
+    vector<int> matrix_size  = std::get<0>(tup);
+    vector<int> band         = std::get<1>(tup);
+    double      stride_scale = std::get<2>(tup);
+    int         batch_count  = std::get<3>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.lda = matrix_size[1];
+    arg.ldb = matrix_size[2];
+    arg.KL  = band[0];
+    arg.KU  = band[1];
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class gbsv_strided_batched_gtest : public ::TestWithParam<gbsv_strided_batched_tuple>
+{
+protected:
+    gbsv_strided_batched_gtest() {}
+    virtual ~gbsv_strided_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST(gbsv_strided_batched_gtest_bad_arg, gbsv_strided_batched_gtest_bad_arg_test)
+{
+    Arguments arg;
+
+    EXPECT_EQ(testing_gbsv_strided_batched_bad_arg<float>(arg), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(testing_gbsv_strided_batched_bad_arg<double>(arg), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(testing_gbsv_strided_batched_bad_arg<hipblasComplex>(arg), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(testing_gbsv_strided_batched_bad_arg<hipblasDoubleComplex>(arg),
+              HIPBLAS_STATUS_SUCCESS);
+}
+
+TEST_P(gbsv_strided_batched_gtest, gbsv_strided_batched_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gbsv_strided_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gbsv_strided_batched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.KL < 0 || arg.KU < 0 || arg.lda < 2 * arg.KL + arg.KU + 1
+           || arg.ldb < arg.N || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(gbsv_strided_batched_gtest, gbsv_strided_batched_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gbsv_strided_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gbsv_strided_batched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.KL < 0 || arg.KU < 0 || arg.lda < 2 * arg.KL + arg.KU + 1
+           || arg.ldb < arg.N || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(gbsv_strided_batched_gtest, gbsv_strided_batched_gtest_float_complex)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gbsv_strided_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gbsv_strided_batched<hipblasComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.KL < 0 || arg.KU < 0 || arg.lda < 2 * arg.KL + arg.KU + 1
+           || arg.ldb < arg.N || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(gbsv_strided_batched_gtest, gbsv_strided_batched_gtest_double_complex)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gbsv_strided_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gbsv_strided_batched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.KL < 0 || arg.KU < 0 || arg.lda < 2 * arg.KL + arg.KU + 1
+           || arg.ldb < arg.N || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// The combinations are  { {N, ldab, ldb}, {KL, KU}, stride_scale, batch_count }
+
+INSTANTIATE_TEST_SUITE_P(hipblasGbsvStridedBatched,
+                         gbsv_strided_batched_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(band_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
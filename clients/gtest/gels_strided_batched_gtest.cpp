@@ -42,7 +42,9 @@ const vector<vector<int>> matrix_size_range
 
 const vector<char> trans_range = {
     'N',
-    'T',
+#ifndef __HIP_PLATFORM_NVCC__
+    'T', // cuBLAS only supports non-transpose
+#endif
 };
 
 const vector<double> stride_scale_range = {2.5};
@@ -95,8 +97,9 @@ protected:
     virtual void TearDown() {}
 };
 
+// Not doing bad_arg testing with cuBLAS backend for now
+// Error codes given by cuBLAS seem inaccurate.
 #ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(gels_strided_batched_gtest_bad_arg, gels_strided_batched_gtest_bad_arg_test)
 {
     Arguments arg;
@@ -107,6 +110,7 @@ TEST_P(gels_strided_batched_gtest_bad_arg, gels_strided_batched_gtest_bad_arg_te
     EXPECT_EQ(testing_gels_strided_batched_bad_arg<hipblasDoubleComplex>(arg),
               HIPBLAS_STATUS_SUCCESS);
 }
+#endif
 
 TEST_P(gels_strided_batched_gtest, gels_strided_batched_gtest_float)
 {
@@ -212,9 +216,8 @@ INSTANTIATE_TEST_SUITE_P(hipblasGelsStridedBatched,
                                  ValuesIn(stride_scale_range),
                                  ValuesIn(batch_count_range),
                                  ValuesIn(is_fortran)));
-
+#ifndef __HIP_PLATFORM_NVCC__
 INSTANTIATE_TEST_SUITE_P(hipblasGelsStridedBatchedBadArg,
                          gels_strided_batched_gtest_bad_arg,
                          Combine(ValuesIn(is_fortran)));
-
 #endif
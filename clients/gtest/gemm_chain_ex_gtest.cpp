@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_gemm_chain_ex.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>, int> gemm_chain_ex_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, K, P}; N above 256 is not fused
+const vector<vector<int>> matrix_size_range = {
+    {-1, 4, 4, 4},
+    {8, 0, 4, 5},
+    {10, 10, 10, 10},
+    {33, 64, 20, 9},
+    {20, 300, 16, 8},
+};
+
+// vector of vector, each pair is a {alpha, alphai, beta, betai};
+// add/delete this list in pairs, like {2.0, 3.0, 4.0, 5.0}
+const vector<vector<double>> alpha_beta_range = {
+    {1.0, 0.0, 0.0, 0.0},
+    {-0.5, 0.0, 2.0, 0.0},
+};
+
+// vector of vector, each pair is a {transA, transB};
+const vector<vector<char>> transA_transB_range = {{'N', 'N'}, {'T', 'N'}, {'N', 'T'}};
+
+const vector<int> batch_count_range = {1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS EX gemm_chain_ex:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_gemm_chain_ex_arguments(gemm_chain_ex_tuple tup)
+{
+    vector<int>    matrix_size   = std::get<0>(tup);
+    vector<double> alpha_beta    = std::get<1>(tup);
+    vector<char>   transA_transB = std::get<2>(tup);
+    int            batch_count   = std::get<3>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M    = matrix_size[0];
+    arg.N    = matrix_size[1];
+    arg.K    = matrix_size[2];
+    arg.cols = matrix_size[3];
+
+    // the first 2 elements of alpha_beta_range are always alpha, and the second 2 are always beta
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.transA = transA_transB[0];
+    arg.transB = transA_transB[1];
+
+    arg.batch_count = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class gemm_chain_ex_gtest : public ::TestWithParam<gemm_chain_ex_tuple>
+{
+protected:
+    gemm_chain_ex_gtest() {}
+    virtual ~gemm_chain_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+template <typename T>
+void testing_gemm_chain_ex_status(const Arguments& arg)
+{
+    hipblasStatus_t status = testing_gemm_chain_ex<T>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.cols < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(gemm_chain_ex_gtest, float)
+{
+    Arguments arg = setup_gemm_chain_ex_arguments(GetParam());
+    testing_gemm_chain_ex_status<float>(arg);
+}
+
+TEST_P(gemm_chain_ex_gtest, double)
+{
+    Arguments arg = setup_gemm_chain_ex_arguments(GetParam());
+    testing_gemm_chain_ex_status<double>(arg);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmChainEx,
+                         gemm_chain_ex_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(transA_transB_range),
+                                 ValuesIn(batch_count_range)));
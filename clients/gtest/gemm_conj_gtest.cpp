@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_conj.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, vector<char>, int> gemm_conj_tuple;
+
+// {M, N, K, lda, ldb, ldc}
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1, 1, 1, 1},
+    {3, 3, 3, 3, 3, 3},
+    {7, 5, 8, 8, 9, 7},
+    {33, 20, 17, 40, 40, 40},
+};
+
+// 'R' is HIPBLAS_OP_CONJ, on either operand or both
+const vector<vector<char>> transA_transB_range
+    = {{'R', 'N'}, {'R', 'T'}, {'R', 'C'}, {'N', 'R'}, {'C', 'R'}, {'R', 'R'}};
+
+const vector<int> batch_count_range = {-1, 0, 1, 3};
+
+Arguments setup_gemm_conj_arguments(gemm_conj_tuple tup)
+{
+    vector<int>  matrix_size   = std::get<0>(tup);
+    vector<char> transA_transB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    arg.alpha  = 2.0;
+    arg.alphai = 1.0;
+    arg.beta   = -1.0;
+    arg.betai  = 2.0;
+
+    arg.transA      = transA_transB[0];
+    arg.transB      = transA_transB[1];
+    arg.batch_count = std::get<2>(tup);
+    arg.timing      = 0;
+
+    return arg;
+}
+
+class gemm_conj_gtest : public ::TestWithParam<gemm_conj_tuple>
+{
+protected:
+    gemm_conj_gtest() {}
+    virtual ~gemm_conj_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// The leading dimensions are large enough for every operation, so only the negative sizes and
+// batch counts are rejected
+static void gemm_conj_check(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(gemm_conj_gtest, gemm_conj_gtest_float_complex)
+{
+    Arguments arg = setup_gemm_conj_arguments(GetParam());
+    gemm_conj_check(arg, testing_gemm_conj<hipblasComplex>(arg));
+}
+
+TEST_P(gemm_conj_gtest, gemm_conj_gtest_double_complex)
+{
+    Arguments arg = setup_gemm_conj_arguments(GetParam());
+    gemm_conj_check(arg, testing_gemm_conj<hipblasDoubleComplex>(arg));
+}
+
+// The combinations are  { {M, N, K, lda, ldb, ldc}, {transA, transB}, batch_count }
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmConj,
+                         gemm_conj_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(transA_transB_range),
+                                 ValuesIn(batch_count_range)));
@@ -383,6 +383,43 @@ TEST_P(gemm_ex_gtest, standard)
     }
 }
 
+// The complex sets also multiply a complex matrix by a real one, in each form of the call
+TEST_P(gemm_ex_gtest, mixed_complex)
+{
+    Arguments arg = setup_gemm_ex_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_ex_mixed_complex(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        EXPECT_TRUE(arg.M < 0 || arg.N < 0 || arg.K < 0
+                    || (arg.transA == 'N' ? arg.lda < arg.M : arg.lda < arg.K)
+                    || (arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+                    || arg.ldc < arg.M);
+        EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+    }
+}
+
+// Repeats the shape on one handle, so on the cuBLAS backend with HIPBLAS_GEMM_LT set every call
+// after the first runs the cached cuBLASLt heuristic
+TEST_P(gemm_ex_gtest, lt_cache)
+{
+    Arguments arg = setup_gemm_ex_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_ex_lt_cache(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        EXPECT_TRUE(arg.M < 0 || arg.N < 0 || arg.K < 0
+                    || (arg.transA == 'N' ? arg.lda < arg.M : arg.lda < arg.K)
+                    || (arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+                    || arg.ldc < arg.M);
+        EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+    }
+}
+
 class gemm_batch_ex_gtest : public ::TestWithParam<gemm_ex_tuple>
 {
 protected:
@@ -22,6 +22,7 @@
  * ************************************************************************ */
 
 #include "testing_gemm.hpp"
+#include "testing_gemm_planar.hpp"
 #include "utility.h"
 #include <math.h>
 #include <stdexcept>
@@ -279,6 +280,18 @@ TEST_P(gemm_gtest, gemm_gtest_double_complex)
     }
 }
 
+TEST_P(gemm_gtest, gemm_planar_gtest_float_complex)
+{
+    Arguments arg = setup_gemm_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_gemm_planar<hipblasComplex>(arg));
+}
+
+TEST_P(gemm_gtest, gemm_planar_gtest_double_complex)
+{
+    Arguments arg = setup_gemm_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_gemm_planar<hipblasDoubleComplex>(arg));
+}
+
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
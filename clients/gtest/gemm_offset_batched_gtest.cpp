@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_offset_batched.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, vector<char>, int> gemm_offset_batched_tuple;
+
+// {M, N, K, lda, ldb, ldc}, within the sizes run by the kernels reading the offsets and beyond,
+// where the offsets are expanded into pointer arrays
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1, 1, 1, 1},
+    {3, 3, 3, 3, 3, 3},
+    {7, 5, 8, 8, 9, 7},
+    {16, 12, 16, 16, 16, 16},
+    {33, 20, 17, 40, 40, 40},
+    {300, 4, 260, 300, 300, 300},
+};
+
+const vector<vector<char>> transA_transB_range = {{'N', 'N'}, {'N', 'T'}, {'C', 'N'}, {'T', 'C'}};
+
+const vector<int> batch_count_range = {-1, 0, 1, 2, 10};
+
+Arguments setup_gemm_offset_batched_arguments(gemm_offset_batched_tuple tup)
+{
+    vector<int>  matrix_size   = std::get<0>(tup);
+    vector<char> transA_transB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    arg.alpha  = 2.0;
+    arg.alphai = 1.0;
+    arg.beta   = -1.0;
+    arg.betai  = 2.0;
+
+    arg.transA      = transA_transB[0];
+    arg.transB      = transA_transB[1];
+    arg.batch_count = std::get<2>(tup);
+    arg.timing      = 0;
+
+    return arg;
+}
+
+class gemm_offset_batched_gtest : public ::TestWithParam<gemm_offset_batched_tuple>
+{
+protected:
+    gemm_offset_batched_gtest() {}
+    virtual ~gemm_offset_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// The leading dimensions are large enough for every transpose combination, so only the negative
+// sizes and batch counts are rejected
+static void gemm_offset_batched_check(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST(gemm_offset_batched_gtest_bad_arg, gemm_offset_batched_gtest_bad_arg_test)
+{
+    Arguments arg;
+
+    EXPECT_EQ(testing_gemm_offset_batched_bad_arg<float>(arg), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(testing_gemm_offset_batched_bad_arg<double>(arg), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(testing_gemm_offset_batched_bad_arg<hipblasComplex>(arg), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(testing_gemm_offset_batched_bad_arg<hipblasDoubleComplex>(arg),
+              HIPBLAS_STATUS_SUCCESS);
+}
+
+TEST_P(gemm_offset_batched_gtest, gemm_offset_batched_gtest_float)
+{
+    Arguments arg = setup_gemm_offset_batched_arguments(GetParam());
+    gemm_offset_batched_check(arg, testing_gemm_offset_batched<float>(arg));
+}
+
+TEST_P(gemm_offset_batched_gtest, gemm_offset_batched_gtest_double)
+{
+    Arguments arg = setup_gemm_offset_batched_arguments(GetParam());
+    gemm_offset_batched_check(arg, testing_gemm_offset_batched<double>(arg));
+}
+
+TEST_P(gemm_offset_batched_gtest, gemm_offset_batched_gtest_float_complex)
+{
+    Arguments arg = setup_gemm_offset_batched_arguments(GetParam());
+    gemm_offset_batched_check(arg, testing_gemm_offset_batched<hipblasComplex>(arg));
+}
+
+TEST_P(gemm_offset_batched_gtest, gemm_offset_batched_gtest_double_complex)
+{
+    Arguments arg = setup_gemm_offset_batched_arguments(GetParam());
+    gemm_offset_batched_check(arg, testing_gemm_offset_batched<hipblasDoubleComplex>(arg));
+}
+
+// The combinations are  { {M, N, K, lda, ldb, ldc}, {transA, transB}, batch_count }
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmOffsetBatched,
+                         gemm_offset_batched_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(transA_transB_range),
+                                 ValuesIn(batch_count_range)));
@@ -59,6 +59,9 @@ Representative sampling is sufficient, endless brute-force sampling is not neces
 // add/delete as a group, in batched gemm, the matrix is much smaller than standard gemm
 const vector<vector<int>> matrix_size_range = {
     // {-1, -1, -1, -1, 1, 1},
+    {3, 3, 3, 3, 3, 3},
+    {7, 5, 8, 8, 9, 7},
+    {16, 12, 16, 16, 16, 16},
     {32, 32, 32, 100, 100, 100},
     {64, 64, 64, 128, 128, 128},
     {128, 128, 128, 128, 128, 128},
@@ -311,6 +314,51 @@ TEST_P(gemm_strided_batched_gtest, hipblasDoubleComplex)
     }
 }
 
+// A or B shared by the batch with stride 0, checked for the valid problems only
+TEST_P(gemm_strided_batched_gtest, float_broadcast)
+{
+    Arguments arg = setup_gemm_strided_batched_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_gemm_strided_batched_broadcast<float>(arg));
+}
+
+TEST_P(gemm_strided_batched_gtest, hipblasComplex_broadcast)
+{
+    Arguments arg = setup_gemm_strided_batched_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_gemm_strided_batched_broadcast<hipblasComplex>(arg));
+}
+
+// The same problems through the views of hipblas_cxx.hpp
+TEST_P(gemm_strided_batched_gtest, float_cxx)
+{
+    Arguments arg = setup_gemm_strided_batched_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_gemm_strided_batched_cxx<float>(arg));
+}
+
+TEST_P(gemm_strided_batched_gtest, hipblasComplex_cxx)
+{
+    Arguments arg = setup_gemm_strided_batched_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_gemm_strided_batched_cxx<hipblasComplex>(arg));
+}
+
+// More problems than one backend call takes, run in chunks of 65535
+TEST(gemm_strided_batched_chunks, float)
+{
+    Arguments arg;
+    arg.M           = 2;
+    arg.N           = 3;
+    arg.K           = 2;
+    arg.lda         = 2;
+    arg.ldb         = 2;
+    arg.ldc         = 2;
+    arg.alpha       = 1.0;
+    arg.beta        = 2.0;
+    arg.batch_count = 2 * 65535 + 3;
+    arg.timing      = 0;
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_gemm_strided_batched<float>(arg));
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_gemm_strided_batched<hipblasDoubleComplex>(arg));
+}
+
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemmt.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>, int> gemmt_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {N, K, lda, ldb, ldc};
+const vector<vector<int>> matrix_size_range = {
+    {-1, -1, 1, 1, 1},
+    {0, 5, 5, 5, 1},
+    {10, 0, 10, 10, 10},
+    {10, 10, 10, 10, 10},
+    {33, 17, 40, 40, 41},
+    {100, 129, 130, 131, 102},
+};
+
+// vector of vector, each pair is a {alpha, alphai, beta, betai};
+// add/delete this list in pairs, like {2.0, 3.0, 4.0, 5.0}
+const vector<vector<double>> alpha_beta_range = {
+    {1.0, 0.0, 0.0, 0.0},
+    {-2.0, 1.0, 2.0, -1.0},
+};
+
+// vector of vector, each vector is a {uplo, transA, transB}; every pair of ops runs a different
+// mix of syrkx and geam
+const vector<vector<char>> uplo_trans_range = {
+    {'U', 'N', 'N'},
+    {'L', 'N', 'T'},
+    {'U', 'N', 'C'},
+    {'L', 'T', 'N'},
+    {'U', 'T', 'T'},
+    {'L', 'T', 'C'},
+    {'U', 'C', 'N'},
+    {'L', 'C', 'T'},
+    {'U', 'C', 'C'},
+    {'L', 'C', 'C'},
+};
+
+const vector<int> batch_count_range = {1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 gemmt:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_gemmt_arguments(gemmt_tuple tup)
+{
+    vector<int>    matrix_size = std::get<0>(tup);
+    vector<double> alpha_beta  = std::get<1>(tup);
+    vector<char>   modes       = std::get<2>(tup);
+    int            batch_count = std::get<3>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+    arg.ldc = matrix_size[4];
+
+    // the first 2 elements of alpha_beta_range are always alpha, and the second 2 are always beta
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.uplo   = modes[0];
+    arg.transA = modes[1];
+    arg.transB = modes[2];
+
+    arg.batch_count = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class gemmt_gtest : public ::TestWithParam<gemmt_tuple>
+{
+protected:
+    gemmt_gtest() {}
+    virtual ~gemmt_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+template <typename T>
+void testing_gemmt_status(const Arguments& arg)
+{
+    hipblasStatus_t status = testing_gemmt<T>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int rows_a = arg.transA == 'N' ? arg.N : arg.K;
+        int rows_b = arg.transB == 'N' ? arg.K : arg.N;
+        if(arg.N < 0 || arg.K < 0 || arg.lda < std::max(1, rows_a)
+           || arg.ldb < std::max(1, rows_b) || arg.ldc < std::max(1, arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(gemmt_gtest, float)
+{
+    Arguments arg = setup_gemmt_arguments(GetParam());
+    testing_gemmt_status<float>(arg);
+}
+
+TEST_P(gemmt_gtest, float_complex)
+{
+    Arguments arg = setup_gemmt_arguments(GetParam());
+    testing_gemmt_status<hipblasComplex>(arg);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmt,
+                         gemmt_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(uplo_trans_range),
+                                 ValuesIn(batch_count_range)));
@@ -235,6 +235,20 @@ TEST_P(gemv_strided_batched_gtest, gemv_gtest_float_complex)
     }
 }
 
+// A shared by the batch with stride 0, checked for the valid problems only
+TEST_P(gemv_strided_batched_gtest, gemv_gtest_float_broadcast)
+{
+    Arguments arg = setup_gemv_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_gemv_strided_batched_broadcast<float>(arg));
+}
+
+TEST_P(gemv_strided_batched_gtest, gemv_gtest_float_complex_broadcast)
+{
+    Arguments arg = setup_gemv_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS,
+              testing_gemv_strided_batched_broadcast<hipblasComplex>(arg));
+}
+
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_getrf_rect.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+typedef std::tuple<vector<int>, int> getrf_rect_tuple;
+
+// {M, N, lda}, with tall, wide and square matrices
+const vector<vector<int>> matrix_size_range
+    = {{-1, 10, 10}, {10, 10, 5}, {10, 10, 10}, {40, 10, 40}, {10, 40, 20}, {300, 100, 310}};
+
+const vector<int> batch_count_range = {0, 1, 5};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     Rectangular getrf, batched and strided batched:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_getrf_rect_arguments(getrf_rect_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.M           = matrix_size[0];
+    arg.N           = matrix_size[1];
+    arg.lda         = matrix_size[2];
+    arg.batch_count = std::get<1>(tup);
+
+    arg.timing
+        = 0; // disable timing data print out. Not supposed to collect performance data in gtest
+
+    return arg;
+}
+
+class getrf_rect_gtest : public ::TestWithParam<getrf_rect_tuple>
+{
+protected:
+    getrf_rect_gtest() {}
+    virtual ~getrf_rect_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(getrf_rect_gtest, getrf_rect_float)
+{
+    Arguments       arg    = setup_getrf_rect_arguments(GetParam());
+    hipblasStatus_t status = testing_getrf_rect(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < arg.M || arg.batch_count < 0)
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_getrf_rect,
+                         getrf_rect_gtest,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(batch_count_range)));
@@ -0,0 +1,100 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_getrs_shared_factor.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+typedef std::tuple<vector<int>, int, int> getrs_shared_factor_tuple;
+
+// {N, lda, ldb}
+const vector<vector<int>> matrix_size_range
+    = {{-1, 1, 1}, {10, 10, 10}, {10, 20, 30}, {200, 200, 210}};
+
+const vector<int> nrhs_range = {1, 7};
+
+const vector<int> batch_count_range = {0, 1, 3, 50};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     getrsStridedBatched with one LU factor shared by the batch:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_getrs_shared_factor_arguments(getrs_shared_factor_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.N           = matrix_size[0];
+    arg.lda         = matrix_size[1];
+    arg.ldb         = matrix_size[2];
+    arg.K           = std::get<1>(tup);
+    arg.batch_count = std::get<2>(tup);
+
+    arg.timing
+        = 0; // disable timing data print out. Not supposed to collect performance data in gtest
+
+    return arg;
+}
+
+class getrs_shared_factor_gtest : public ::TestWithParam<getrs_shared_factor_tuple>
+{
+protected:
+    getrs_shared_factor_gtest() {}
+    virtual ~getrs_shared_factor_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(getrs_shared_factor_gtest, getrs_shared_factor_float)
+{
+    Arguments       arg    = setup_getrs_shared_factor_arguments(GetParam());
+    hipblasStatus_t status = testing_getrs_shared_factor(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.lda < arg.N || arg.ldb < arg.N || arg.batch_count < 0)
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_getrs_shared_factor,
+                         getrs_shared_factor_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(nrhs_range),
+                                 ValuesIn(batch_count_range)));
@@ -25,11 +25,15 @@
 #include <condition_variable>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <functional>
 #include <future>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <mutex>
 #include <queue>
+#include <regex>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -38,6 +42,14 @@
 #include <utility>
 #include <vector>
 
+#ifndef WIN32
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char** environ;
+#endif
+
 #include "program_options.hpp"
 
 #include "argument_model.hpp"
@@ -280,6 +292,141 @@ static void hipblas_set_listener()
     listeners.Append(listener);
 }
 
+// Merges the gtest XML reports of the shards into one report, summing the counts and times of the
+// <testsuites> element and concatenating the test suites
+static void hipblas_merge_xml_reports(const std::vector<std::string>& reports,
+                                      const std::string&              out)
+{
+    static const char* counts[] = {"tests", "failures", "disabled", "errors", "time"};
+    double             totals[std::size(counts)]{};
+    std::string        header, suites;
+
+    for(auto& report : reports)
+    {
+        std::ifstream     ifs(report);
+        std::stringstream ss;
+        ss << ifs.rdbuf();
+        std::string xml   = ss.str();
+        size_t      begin = xml.find("<testsuites"), end = xml.rfind("</testsuites>");
+        if(begin == std::string::npos || end == std::string::npos)
+            continue;
+        size_t body = xml.find('>', begin) + 1;
+
+        std::string tag = xml.substr(begin, body - begin);
+        for(size_t i = 0; i < std::size(counts); i++)
+        {
+            std::smatch match;
+            std::regex  count(std::string(" ") + counts[i] + "=\"([^\"]*)\"");
+            if(std::regex_search(tag, match, count))
+                totals[i] += atof(match[1].str().c_str());
+        }
+        if(header.empty())
+            header = xml.substr(0, body);
+        suites += xml.substr(body, end - body);
+    }
+
+    for(size_t i = 0; i < std::size(counts); i++)
+    {
+        std::ostringstream value;
+        value << " " << counts[i] << "=\"" << std::setprecision(15) << totals[i] << "\"";
+        header = std::regex_replace(
+            header, std::regex(std::string(" ") + counts[i] + "=\"[^\"]*\""), value.str());
+    }
+
+    std::ofstream(out) << header << suites << "</testsuites>\n";
+}
+
+// Runs the tests in per_device child processes on each of devices devices, child i running gtest
+// shard i on device i % devices with HIPBLAS_TEST_DEVICE set. With several children per device, one
+// child runs the host reference and checks of its test while another runs its test on the device.
+// The output of each child is printed once all of them have finished, and their XML reports are
+// merged into the report requested with --gtest_output=xml:<path>.
+static int hipblas_run_shards(int argc, char** argv, int devices, int per_device)
+{
+#ifdef WIN32
+    std::cerr << "Error: --shard_devices and --pipeline are not supported on Windows" << std::endl;
+    return EXIT_FAILURE;
+#else
+    const int shards = devices * per_device;
+
+    std::string              xml_out, base = hipblas_tempname();
+    std::vector<std::string> args;
+    for(int i = 0; i < argc; i++)
+    {
+        if(!strncmp(argv[i], "--gtest_output=xml", 18))
+        {
+            xml_out = argv[i][18] == ':' ? argv[i] + 19 : "";
+            if(xml_out.empty() || xml_out.back() == '/')
+                xml_out += "test_detail.xml";
+        }
+        else
+            args.push_back(argv[i]);
+    }
+
+    std::vector<std::string> env;
+    for(char** e = environ; *e; e++)
+        if(strncmp(*e, "GTEST_SHARD_INDEX=", 18) && strncmp(*e, "GTEST_TOTAL_SHARDS=", 19)
+           && strncmp(*e, "HIPBLAS_TEST_DEVICE=", 20))
+            env.push_back(*e);
+    env.push_back("GTEST_TOTAL_SHARDS=" + std::to_string(shards));
+
+    std::vector<pid_t>       pids(shards, -1);
+    std::vector<std::string> logs, reports;
+    for(int i = 0; i < shards; i++)
+    {
+        logs.push_back(base + ".shard" + std::to_string(i) + ".log");
+        reports.push_back(base + ".shard" + std::to_string(i) + ".xml");
+
+        std::vector<std::string> shard_args = args, shard_env = env;
+        shard_args.push_back("--gtest_output=xml:" + reports[i]);
+        shard_env.push_back("GTEST_SHARD_INDEX=" + std::to_string(i));
+        shard_env.push_back("HIPBLAS_TEST_DEVICE=" + std::to_string(i % devices));
+
+        std::vector<char*> c_args, c_env;
+        for(auto& a : shard_args)
+            c_args.push_back(&a[0]);
+        for(auto& e : shard_env)
+            c_env.push_back(&e[0]);
+        c_args.push_back(nullptr);
+        c_env.push_back(nullptr);
+
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_addopen(
+            &actions, STDOUT_FILENO, logs[i].c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+        if(posix_spawnp(&pids[i], c_args[0], &actions, nullptr, c_args.data(), c_env.data()))
+        {
+            std::cerr << "Error: cannot start shard " << i << std::endl;
+            pids[i] = -1;
+        }
+        posix_spawn_file_actions_destroy(&actions);
+    }
+
+    int status = 0;
+    for(int i = 0; i < shards; i++)
+    {
+        int wstatus = 0;
+        if(pids[i] < 0 || waitpid(pids[i], &wstatus, 0) < 0 || !WIFEXITED(wstatus)
+           || WEXITSTATUS(wstatus))
+            status = EXIT_FAILURE;
+
+        std::cout << "[  SHARD   ] " << i << " device " << i % devices << std::endl
+                  << std::ifstream(logs[i]).rdbuf();
+        std::cout.clear();
+        std::remove(logs[i].c_str());
+    }
+
+    if(!xml_out.empty())
+        hipblas_merge_xml_reports(reports, xml_out);
+    for(auto& report : reports)
+        std::remove(report.c_str());
+    std::remove(base.c_str());
+
+    return status;
+#endif
+}
+
 /* =====================================================================
       Main function:
 =================================================================== */
@@ -295,7 +442,37 @@ int main(int argc, char** argv)
         std::cerr << "Error: No devices found" << std::endl;
         return EXIT_FAILURE;
     }
-    set_device(0); // use first device
+
+    // --shard_devices <n> runs the tests on the first n devices, or all of them if n <= 0, and
+    // --pipeline <n> runs n processes per device, 2 if n <= 0
+    int devices = 1, per_device = 1;
+    for(int i = 1; i < argc;)
+    {
+        bool shard_devices = !strcmp(argv[i], "--shard_devices");
+        if(!shard_devices && strcmp(argv[i], "--pipeline"))
+        {
+            i++;
+            continue;
+        }
+        int n_args = i + 1 < argc && strncmp(argv[i + 1], "--", 2) ? 2 : 1;
+        int n      = n_args == 2 ? atoi(argv[i + 1]) : 0;
+        if(shard_devices)
+            devices = n <= 0 || n > device_count ? device_count : n;
+        else
+            per_device = n <= 0 ? 2 : n;
+        std::copy(argv + i + n_args, argv + argc + 1, argv + i);
+        argc -= n_args;
+    }
+    if(devices * per_device > 1)
+        return hipblas_run_shards(argc, argv, devices, per_device);
+
+    // a shard uses the device given by the parent process, otherwise the first device
+    const char* shard_device = getenv("HIPBLAS_TEST_DEVICE");
+    set_device(shard_device ? atoi(shard_device) : 0);
+
+    // handles are reused between tests unless HIPBLAS_TEST_FRESH_HANDLES is set
+    const char* fresh_handles = getenv("HIPBLAS_TEST_FRESH_HANDLES");
+    hipblas_set_handle_reuse(!fresh_handles || !atoi(fresh_handles));
 
     bool datafile = hipblas_parse_data(argc, argv);
 
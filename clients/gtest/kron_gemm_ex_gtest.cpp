@@ -0,0 +1,136 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_kron_gemm_ex.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<int, vector<double>, vector<int>> kron_gemm_ex_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// the number p of columns of X and Y; the shapes of the factors are in the tester
+const vector<int> p_range = {-1, 0, 1, 7};
+
+// vector of vector, each pair is a {alpha, alphai, beta, betai};
+// add/delete this list in pairs, like {2.0, 3.0, 4.0, 5.0}
+const vector<vector<double>> alpha_beta_range = {
+    {1.0, 0.0, 0.0, 0.0},
+    {-0.5, 0.0, 2.0, 0.0},
+};
+
+// vector of vector, each pair is a {incx, incy} of the gemv
+const vector<vector<int>> incx_incy_range = {{1, 1}, {2, 3}};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS EX kron_gemm_ex:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_kron_gemm_ex_arguments(kron_gemm_ex_tuple tup)
+{
+    int            p          = std::get<0>(tup);
+    vector<double> alpha_beta = std::get<1>(tup);
+    vector<int>    incx_incy  = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.cols = p;
+
+    // the first 2 elements of alpha_beta_range are always alpha, and the second 2 are always beta
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.incx = incx_incy[0];
+    arg.incy = incx_incy[1];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class kron_gemm_ex_gtest : public ::TestWithParam<kron_gemm_ex_tuple>
+{
+protected:
+    kron_gemm_ex_gtest() {}
+    virtual ~kron_gemm_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+template <typename T>
+void testing_kron_gemm_ex_status(const Arguments& arg)
+{
+    hipblasStatus_t status = testing_kron_gemm_ex<T>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.cols < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(kron_gemm_ex_gtest, float)
+{
+    Arguments arg = setup_kron_gemm_ex_arguments(GetParam());
+    testing_kron_gemm_ex_status<float>(arg);
+}
+
+TEST_P(kron_gemm_ex_gtest, double)
+{
+    Arguments arg = setup_kron_gemm_ex_arguments(GetParam());
+    testing_kron_gemm_ex_status<double>(arg);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasKronGemmEx,
+                         kron_gemm_ex_gtest,
+                         Combine(ValuesIn(p_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(incx_incy_range)));
@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_level1_ex.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+typedef std::tuple<int, int, int> level1_ex_tuple;
+
+// Sizes below, at and above one work group of the reductions
+const int N_range[] = {-1, 0, 1, 10, 256, 1000};
+
+// Negative increments copy and swap from the last element, and reduce to 0
+const int incx_range[] = {1, 2, -1};
+
+const int batch_count_range[] = {1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS EX fp16 and bf16 copy, swap, asum, iamax and iamin:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_level1_ex_arguments(level1_ex_tuple tup)
+{
+    Arguments arg;
+
+    arg.N           = std::get<0>(tup);
+    arg.incx        = std::get<1>(tup);
+    arg.batch_count = std::get<2>(tup);
+
+    arg.timing
+        = 0; // disable timing data print out. Not supposed to collect performance data in gtest
+
+    return arg;
+}
+
+class level1_ex_gtest : public ::TestWithParam<level1_ex_tuple>
+{
+protected:
+    level1_ex_gtest() {}
+    virtual ~level1_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(level1_ex_gtest, level1_ex_half)
+{
+    Arguments       arg    = setup_level1_ex_arguments(GetParam());
+    hipblasStatus_t status = testing_level1_ex<hipblasHalf>(arg);
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+TEST_P(level1_ex_gtest, level1_ex_bfloat16)
+{
+    Arguments       arg    = setup_level1_ex_arguments(GetParam());
+    hipblasStatus_t status = testing_level1_ex<hipblasBfloat16>(arg);
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_level1_ex,
+                         level1_ex_gtest,
+                         Combine(ValuesIn(N_range),
+                                 ValuesIn(incx_range),
+                                 ValuesIn(batch_count_range)));
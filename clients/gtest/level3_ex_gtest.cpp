@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_level3_ex.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>, int> level3_ex_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, K, lda, ldb, ldc};
+// the sizes above 256 cover the blocking of the half and bfloat16 paths
+const vector<vector<int>> matrix_size_range = {
+    {-1, -1, -1, 1, 1, 1},
+    {10, 10, 10, 10, 10, 10},
+    {33, 17, 5, 40, 40, 41},
+    {300, 20, 7, 301, 300, 302},
+    {20, 300, 9, 301, 301, 300},
+};
+
+// vector of vector, each pair is a {alpha, alphai, beta, betai};
+// add/delete this list in pairs, like {2.0, 3.0, 4.0, 5.0}
+const vector<vector<double>> alpha_beta_range = {
+    {1.0, 0.0, 0.0, 0.0},
+    {-1.0, 0.0, 2.0, 0.0},
+};
+
+// vector of vector, each vector is a {side, uplo, transA, diag};
+const vector<vector<char>> side_uplo_trans_diag_range = {
+    {'L', 'L', 'N', 'N'},
+    {'R', 'L', 'T', 'U'},
+    {'L', 'U', 'T', 'N'},
+    {'R', 'U', 'N', 'U'},
+    {'L', 'U', 'N', 'U'},
+    {'R', 'U', 'T', 'N'},
+};
+
+const vector<int> batch_count_range = {1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS EX syrk_ex, syr2k_ex, trmm_ex, symm_ex:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_level3_ex_arguments(level3_ex_tuple tup)
+{
+    vector<int>    matrix_size = std::get<0>(tup);
+    vector<double> alpha_beta  = std::get<1>(tup);
+    vector<char>   modes       = std::get<2>(tup);
+    int            batch_count = std::get<3>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    // the first 2 elements of alpha_beta_range are always alpha, and the second 2 are always beta
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.side   = modes[0];
+    arg.uplo   = modes[1];
+    arg.transA = modes[2];
+    arg.diag   = modes[3];
+
+    arg.batch_count = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class level3_ex_gtest : public ::TestWithParam<level3_ex_tuple>
+{
+protected:
+    level3_ex_gtest() {}
+    virtual ~level3_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+void testing_level3_ex_status(const Arguments& arg)
+{
+    hipblasStatus_t status = testing_level3_ex(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int ld_min = std::max({1, arg.M, arg.N, arg.K});
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.lda < ld_min || arg.ldb < ld_min
+           || arg.ldc < ld_min)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(level3_ex_gtest, float)
+{
+    Arguments arg = setup_level3_ex_arguments(GetParam());
+    testing_level3_ex_status(arg);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasLevel3Ex,
+                         level3_ex_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(side_uplo_trans_diag_range),
+                                 ValuesIn(batch_count_range)));
@@ -0,0 +1,131 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_matinv_batched.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, int> matinv_batched_tuple;
+
+// {N, lda, lda_inv}, N <= 32 runs the Gauss-Jordan kernel and larger N getrf and getri
+const vector<vector<int>> matrix_size_range
+    = {{-1, 1, 1}, {1, 1, 1}, {10, 10, 10}, {17, 20, 30}, {32, 32, 40}, {33, 33, 33},
+       {100, 110, 100}};
+
+const vector<int> batch_count_range = {-1, 0, 1, 100};
+
+Arguments setup_matinv_batched_arguments(matinv_batched_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int         batch_count = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.lda = matrix_size[1];
+    arg.ldb = matrix_size[2];
+
+    arg.batch_count = batch_count;
+
+    arg.timing
+        = 0; // disable timing data print out. Not supposed to collect performance data in gtest
+
+    return arg;
+}
+
+class matinv_batched_gtest : public ::TestWithParam<matinv_batched_tuple>
+{
+protected:
+    matinv_batched_gtest() {}
+    virtual ~matinv_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(matinv_batched_gtest, matinv_batched_gtest_float)
+{
+    Arguments       arg    = setup_matinv_batched_arguments(GetParam());
+    hipblasStatus_t status = testing_matinv_batched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.lda < arg.N || arg.ldb < arg.N || arg.batch_count < 0)
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+TEST_P(matinv_batched_gtest, matinv_batched_gtest_double)
+{
+    Arguments       arg    = setup_matinv_batched_arguments(GetParam());
+    hipblasStatus_t status = testing_matinv_batched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.lda < arg.N || arg.ldb < arg.N || arg.batch_count < 0)
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+TEST_P(matinv_batched_gtest, matinv_batched_gtest_float_complex)
+{
+    Arguments       arg    = setup_matinv_batched_arguments(GetParam());
+    hipblasStatus_t status = testing_matinv_batched<hipblasComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.lda < arg.N || arg.ldb < arg.N || arg.batch_count < 0)
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+TEST_P(matinv_batched_gtest, matinv_batched_gtest_double_complex)
+{
+    Arguments       arg    = setup_matinv_batched_arguments(GetParam());
+    hipblasStatus_t status = testing_matinv_batched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.lda < arg.N || arg.ldb < arg.N || arg.batch_count < 0)
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasMatinvBatched,
+                         matinv_batched_gtest,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(batch_count_range)));
@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_packed_convert.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, char, int> packed_convert_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, KL, KU, lda};
+const vector<vector<int>> matrix_size_range = {
+    {-1, -1, 0, 0, 1},
+    {10, 10, -1, 0, 10},
+    {10, 20, 2, 3, 10},
+    {0, 0, 0, 0, 1},
+    {10, 10, 0, 0, 10},
+    {10, 10, 2, 3, 10},
+    {33, 17, 40, 5, 40},
+    {17, 33, 4, 40, 40},
+    {100, 64, 1, 0, 101},
+};
+
+// the uplo of tpttr and trttp
+const vector<char> uplo_range = {'U', 'L'};
+
+const vector<int> batch_count_range = {1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     tpttr, trttp, gbpack and gbunpack:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_packed_convert_arguments(packed_convert_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char        uplo        = std::get<1>(tup);
+    int         batch_count = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.KL  = matrix_size[2];
+    arg.KU  = matrix_size[3];
+    arg.lda = matrix_size[4];
+
+    arg.uplo = uplo;
+
+    arg.batch_count = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class packed_convert_gtest : public ::TestWithParam<packed_convert_tuple>
+{
+protected:
+    packed_convert_gtest() {}
+    virtual ~packed_convert_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+template <typename T>
+void testing_packed_convert_status(const Arguments& arg)
+{
+    hipblasStatus_t status = testing_packed_convert<T>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.KL < 0 || arg.KU < 0 || arg.lda < std::max(1, arg.M)
+           || arg.lda < std::max(1, arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(packed_convert_gtest, float)
+{
+    Arguments arg = setup_packed_convert_arguments(GetParam());
+    testing_packed_convert_status<float>(arg);
+}
+
+TEST_P(packed_convert_gtest, float_complex)
+{
+    Arguments arg = setup_packed_convert_arguments(GetParam());
+    testing_packed_convert_status<hipblasComplex>(arg);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasPackedConvert,
+                         packed_convert_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(uplo_range),
+                                 ValuesIn(batch_count_range)));
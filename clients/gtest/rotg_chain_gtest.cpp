@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_rotg_chain.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, int> rotg_chain_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {N, M, lda, incx};
+const vector<vector<int>> rotg_chain_size_range = {
+    {-1, 1, 1, 1},
+    {4, 3, 4, 1},
+    {4, 4, 3, 1},
+    {4, 4, 4, 0},
+    {0, 5, 1, 1},
+    {1, 1, 1, 1},
+    {8, 9, 8, 1},
+    {16, 16, 20, 2},
+    {33, 300, 40, 3},
+};
+
+const vector<int> batch_count_range = {1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     rotgChain:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_rotg_chain_arguments(rotg_chain_tuple tup)
+{
+    vector<int> size        = std::get<0>(tup);
+    int         batch_count = std::get<1>(tup);
+
+    Arguments arg;
+
+    // see the comments about rotg_chain_size_range above
+    arg.N    = size[0];
+    arg.M    = size[1];
+    arg.lda  = size[2];
+    arg.incx = size[3];
+
+    arg.batch_count = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class rotg_chain_gtest : public ::TestWithParam<rotg_chain_tuple>
+{
+protected:
+    rotg_chain_gtest() {}
+    virtual ~rotg_chain_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+template <typename T>
+void testing_rotg_chain_status(const Arguments& arg)
+{
+    hipblasStatus_t status = testing_rotg_chain<T>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.M < arg.N || arg.lda < std::max(1, arg.N) || arg.incx <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(rotg_chain_gtest, float)
+{
+    Arguments arg = setup_rotg_chain_arguments(GetParam());
+    testing_rotg_chain_status<float>(arg);
+}
+
+TEST_P(rotg_chain_gtest, double_complex)
+{
+    Arguments arg = setup_rotg_chain_arguments(GetParam());
+    testing_rotg_chain_status<hipblasDoubleComplex>(arg);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasRotgChain,
+                         rotg_chain_gtest,
+                         Combine(ValuesIn(rotg_chain_size_range), ValuesIn(batch_count_range)));
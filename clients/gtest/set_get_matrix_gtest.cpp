@@ -21,8 +21,11 @@
  *
  * ************************************************************************ */
 
+#include "testing_read_write_matrix_file.hpp"
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
+#include "testing_set_get_matrix_batched_async.hpp"
+#include "testing_set_get_matrix_strided_batched_async.hpp"
 #include "utility.h"
 #include <functional>
 #include <math.h>
@@ -85,6 +88,11 @@ const vector<vector<int>> lda_ldb_ldc_range = {{3, 3, 3},
                                                {5, 5, 4},
                                                {5, 5, 5}};
 
+// large enough to be copied in several chunks of the pinned staging ring
+const vector<vector<int>> rows_cols_large_range = {{1100, 1100}};
+
+const vector<vector<int>> lda_ldb_ldc_large_range = {{1100, 1100, 1100}, {1200, 1300, 1100}};
+
 const bool is_fortran[] = {false, true};
 
 /* ===============Google Unit Test==================================================== */
@@ -118,6 +126,9 @@ Arguments setup_set_get_matrix_arguments(set_get_matrix_tuple tup)
     arg.ldb = lda_ldb_ldc[1];
     arg.ldc = lda_ldb_ldc[2];
 
+    arg.batch_count  = 3;
+    arg.stride_scale = 1.5;
+
     return arg;
 }
 
@@ -180,6 +191,66 @@ TEST_P(set_matrix_get_matrix_gtest, async_float)
     }
 }
 
+TEST_P(set_matrix_get_matrix_gtest, batched_async_float)
+{
+    Arguments arg = setup_set_get_matrix_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_batched_async<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.rows < 0 || arg.cols <= 0 || arg.lda <= 0 || arg.ldb <= 0 || arg.ldc <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(set_matrix_get_matrix_gtest, strided_batched_async_float)
+{
+    Arguments arg = setup_set_get_matrix_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_strided_batched_async<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.rows < 0 || arg.cols <= 0 || arg.lda <= 0 || arg.ldb <= 0 || arg.ldc <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(set_matrix_get_matrix_gtest, file_float)
+{
+    Arguments arg = setup_set_get_matrix_arguments(GetParam());
+
+    hipblasStatus_t status = testing_read_write_matrix_file<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.rows < 0 || arg.cols <= 0 || arg.lda <= 0 || arg.ldb <= 0 || arg.ldc <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -190,3 +261,9 @@ INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_small,
                          Combine(ValuesIn(rows_cols_range),
                                  ValuesIn(lda_ldb_ldc_range),
                                  ValuesIn(is_fortran)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_large,
+                         set_matrix_get_matrix_gtest,
+                         Combine(ValuesIn(rows_cols_large_range),
+                                 ValuesIn(lda_ldb_ldc_large_range),
+                                 Values(false)));
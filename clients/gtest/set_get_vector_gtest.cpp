@@ -73,6 +73,11 @@ const vector<vector<int>> incx_incy_incd_range = {{1, 1, 1},
                                                   {3, 3, 1},
                                                   {3, 3, 3}};
 
+// large enough to be copied in several chunks of the pinned staging ring
+const int M_large_range[] = {1100000};
+
+const vector<vector<int>> incx_incy_incd_large_range = {{1, 1, 1}, {3, 2, 1}};
+
 const bool is_fortran[] = {false, true};
 
 /* ===============Google Unit Test==================================================== */
@@ -180,3 +185,9 @@ INSTANTIATE_TEST_SUITE_P(hipblas_auxiliary_small,
                          Combine(ValuesIn(M_range),
                                  ValuesIn(incx_incy_incd_range),
                                  ValuesIn(is_fortran)));
+
+INSTANTIATE_TEST_SUITE_P(hipblas_auxiliary_large,
+                         set_vector_get_vector_gtest,
+                         Combine(ValuesIn(M_large_range),
+                                 ValuesIn(incx_incy_incd_large_range),
+                                 Values(false)));
@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_small_level1.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+typedef std::tuple<int, double, vector<int>> small_level1_tuple;
+
+// Around the block size of the kernels and the largest n they take
+const int N_range[] = {1, 255, 256, 257, 1023, 1024, 1025};
+
+const double alpha_range[] = {2.0, 0.0};
+
+// {incx, incy}
+const vector<vector<int>> incx_incy_range = {{1, 1}, {2, 3}, {-1, 1}, {1, -2}, {-3, -1}};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-1 single launch kernels for small vectors:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_small_level1_arguments(small_level1_tuple tup)
+{
+    Arguments arg;
+
+    arg.N     = std::get<0>(tup);
+    arg.alpha = std::get<1>(tup);
+    arg.incx  = std::get<2>(tup)[0];
+    arg.incy  = std::get<2>(tup)[1];
+
+    arg.timing
+        = 0; // disable timing data print out. Not supposed to collect performance data in gtest
+
+    return arg;
+}
+
+class small_level1_gtest : public ::TestWithParam<small_level1_tuple>
+{
+protected:
+    small_level1_gtest() {}
+    virtual ~small_level1_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(small_level1_gtest, small_level1_float)
+{
+    Arguments arg = setup_small_level1_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_small_level1<float>(arg));
+}
+
+TEST_P(small_level1_gtest, small_level1_double)
+{
+    Arguments arg = setup_small_level1_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_small_level1<double>(arg));
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_small_level1,
+                         small_level1_gtest,
+                         Combine(ValuesIn(N_range),
+                                 ValuesIn(alpha_range),
+                                 ValuesIn(incx_incy_range)));
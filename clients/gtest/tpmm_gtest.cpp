@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_tpmm.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, double, vector<char>, int> tpmm_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, ldb}; the sizes past 128 take several panels of A
+const vector<vector<int>> matrix_size_range = {
+    {-1, -1, 1},
+    {10, 10, 2},
+    {0, 10, 1},
+    {10, 10, 10},
+    {33, 17, 40},
+    {200, 130, 201},
+    {129, 300, 130},
+};
+
+const vector<double> alpha_range = {1.0, -2.0};
+
+// vector of vector, each vector is a {side, uplo, transA, diag}
+const vector<vector<char>> side_uplo_trans_diag_range = {
+    {'L', 'U', 'N', 'N'},
+    {'L', 'L', 'T', 'U'},
+    {'L', 'U', 'C', 'N'},
+    {'L', 'L', 'N', 'N'},
+    {'R', 'U', 'N', 'U'},
+    {'R', 'L', 'T', 'N'},
+    {'R', 'U', 'C', 'N'},
+    {'R', 'L', 'N', 'U'},
+};
+
+const vector<int> batch_count_range = {1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 tpmm and tpsm:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_tpmm_arguments(tpmm_tuple tup)
+{
+    vector<int>  matrix_size = std::get<0>(tup);
+    double       alpha       = std::get<1>(tup);
+    vector<char> modes       = std::get<2>(tup);
+    int          batch_count = std::get<3>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.ldb = matrix_size[2];
+
+    arg.alpha  = alpha;
+    arg.alphai = 0;
+
+    arg.side   = modes[0];
+    arg.uplo   = modes[1];
+    arg.transA = modes[2];
+    arg.diag   = modes[3];
+
+    arg.batch_count = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class tpmm_gtest : public ::TestWithParam<tpmm_tuple>
+{
+protected:
+    tpmm_gtest() {}
+    virtual ~tpmm_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+template <typename T>
+void testing_tpmm_status(const Arguments& arg)
+{
+    hipblasStatus_t status = testing_tpmm<T>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < std::max(1, arg.M))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(tpmm_gtest, float)
+{
+    Arguments arg = setup_tpmm_arguments(GetParam());
+    testing_tpmm_status<float>(arg);
+}
+
+TEST_P(tpmm_gtest, float_complex)
+{
+    Arguments arg = setup_tpmm_arguments(GetParam());
+    testing_tpmm_status<hipblasComplex>(arg);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasTpmm,
+                         tpmm_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_range),
+                                 ValuesIn(side_uplo_trans_diag_range),
+                                 ValuesIn(batch_count_range)));
@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_transpose_ex.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+typedef std::tuple<vector<int>, int> transpose_ex_tuple;
+
+// {M, N, lda, ldc}. Sizes that are not multiples of the tile, and square ones, which are also
+// transposed in place when lda == ldc.
+const vector<vector<int>> matrix_size_range = {{-1, 10, 10, 10},
+                                               {10, 10, 9, 10},
+                                               {0, 10, 1, 10},
+                                               {10, 7, 10, 7},
+                                               {33, 65, 40, 70},
+                                               {100, 100, 100, 100},
+                                               {257, 129, 260, 130}};
+
+const int batch_count_range[] = {1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS EX transposes:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_transpose_ex_arguments(transpose_ex_tuple tup)
+{
+    Arguments arg;
+
+    vector<int> matrix_size = std::get<0>(tup);
+
+    arg.M           = matrix_size[0];
+    arg.N           = matrix_size[1];
+    arg.lda         = matrix_size[2];
+    arg.ldc         = matrix_size[3];
+    arg.batch_count = std::get<1>(tup);
+
+    arg.timing
+        = 0; // disable timing data print out. Not supposed to collect performance data in gtest
+
+    return arg;
+}
+
+class transpose_ex_gtest : public ::TestWithParam<transpose_ex_tuple>
+{
+protected:
+    transpose_ex_gtest() {}
+    virtual ~transpose_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(transpose_ex_gtest, transpose_ex_float)
+{
+    Arguments       arg    = setup_transpose_ex_arguments(GetParam());
+    hipblasStatus_t status = testing_transpose_ex<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < std::max(1, arg.M) || arg.ldc < std::max(1, arg.N))
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+TEST_P(transpose_ex_gtest, transpose_ex_double)
+{
+    Arguments       arg    = setup_transpose_ex_arguments(GetParam());
+    hipblasStatus_t status = testing_transpose_ex<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < std::max(1, arg.M) || arg.ldc < std::max(1, arg.N))
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_transpose_ex,
+                         transpose_ex_gtest,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(batch_count_range)));
@@ -280,6 +280,9 @@ TEST_P(trmm_bad_arg_gtest, trmm_strided_batched_bad_arg_gtest_test)
               HIPBLAS_STATUS_SUCCESS);
 }
 
+#endif
+
+// cuBLAS runs the batched forms one trmm at a time
 TEST_P(trmm_gtest, trmm_batched_gtest_float)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -388,8 +391,6 @@ TEST_P(trmm_gtest, trmm_strided_batched_gtest_double_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -223,6 +223,20 @@ TEST_P(trsm_ex_gtest, trsm_gtest_ex_double_complex)
     }
 }
 
+TEST_P(trsm_ex_gtest, trsm_prepare_gtest_float)
+{
+    Arguments arg    = setup_trsm_ex_arguments(GetParam());
+    arg.compute_type = HIPBLAS_R_32F;
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_trsm_prepare<float>(arg));
+}
+
+TEST_P(trsm_ex_gtest, trsm_prepare_gtest_double_complex)
+{
+    Arguments arg    = setup_trsm_ex_arguments(GetParam());
+    arg.compute_type = HIPBLAS_C_64F;
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_trsm_prepare<hipblasDoubleComplex>(arg));
+}
+
 TEST_P(trsm_ex_gtest, trsm_batched_ex_gtest_float)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -23,6 +23,7 @@
 
 #include "testing_trsm.hpp"
 #include "testing_trsm_batched.hpp"
+#include "testing_trsm_out_of_place.hpp"
 #include "testing_trsm_strided_batched.hpp"
 #include "utility.h"
 #include <math.h>
@@ -348,6 +349,32 @@ TEST_P(trsm_gtest, trsm_strided_batched_gtest_double_complex)
 
 #endif
 
+// A shared A runs on both backends when the batch merges into one trsm
+TEST_P(trsm_gtest, trsm_strided_batched_broadcast_gtest_float)
+{
+    Arguments arg = setup_trsm_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_trsm_strided_batched_broadcast<float>(arg));
+}
+
+TEST_P(trsm_gtest, trsm_strided_batched_broadcast_gtest_double_complex)
+{
+    Arguments arg = setup_trsm_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS,
+              testing_trsm_strided_batched_broadcast<hipblasDoubleComplex>(arg));
+}
+
+TEST_P(trsm_gtest, trsm_out_of_place_gtest_float)
+{
+    Arguments arg = setup_trsm_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_trsm_out_of_place<float>(arg));
+}
+
+TEST_P(trsm_gtest, trsm_out_of_place_gtest_double_complex)
+{
+    Arguments arg = setup_trsm_arguments(GetParam());
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_trsm_out_of_place<hipblasDoubleComplex>(arg));
+}
+
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
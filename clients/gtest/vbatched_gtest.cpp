@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_vbatched.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+typedef std::tuple<int, int> vbatched_tuple;
+
+// Smallest size of the problems, which grow with their index
+const int N_range[] = {-1, 0, 1, 31, 100};
+
+const int batch_count_range[] = {0, 1, 5, 13};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     Variable-size batched trsm, gemv and getrf:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_vbatched_arguments(vbatched_tuple tup)
+{
+    Arguments arg;
+
+    arg.N           = std::get<0>(tup);
+    arg.batch_count = std::get<1>(tup);
+
+    arg.timing
+        = 0; // disable timing data print out. Not supposed to collect performance data in gtest
+
+    return arg;
+}
+
+class vbatched_gtest : public ::TestWithParam<vbatched_tuple>
+{
+protected:
+    vbatched_gtest() {}
+    virtual ~vbatched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(vbatched_gtest, trsm_vbatched_float)
+{
+    Arguments       arg    = setup_vbatched_arguments(GetParam());
+    hipblasStatus_t status = testing_trsm_vbatched(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.batch_count < 0)
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+TEST_P(vbatched_gtest, gemv_vbatched_float)
+{
+    Arguments       arg    = setup_vbatched_arguments(GetParam());
+    hipblasStatus_t status = testing_gemv_vbatched(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.batch_count < 0)
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+#ifdef __HIP_PLATFORM_SOLVER__
+TEST_P(vbatched_gtest, getrf_vbatched_float)
+{
+    Arguments       arg    = setup_vbatched_arguments(GetParam());
+    hipblasStatus_t status = testing_getrf_vbatched(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.batch_count < 0)
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        else
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+#endif
+
+INSTANTIATE_TEST_SUITE_P(hipblas_vbatched,
+                         vbatched_gtest,
+                         Combine(ValuesIn(N_range), ValuesIn(batch_count_range)));
@@ -24,10 +24,16 @@
 #ifndef _ARGUMENT_MODEL_HPP_
 #define _ARGUMENT_MODEL_HPP_
 
+#include "device_bandwidth.hpp"
+#include "device_counters.hpp"
+#include "device_peak.hpp"
+#include "device_telemetry.hpp"
+#include "device_tracer.hpp"
 #include "hipblas_arguments.hpp"
 #include <algorithm>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 namespace ArgumentLogging
 {
@@ -41,6 +47,52 @@ bool ArgumentModel_get_log_function_name();
 void ArgumentModel_set_log_datatype(bool d);
 bool ArgumentModel_get_log_datatype();
 
+// With log_name_once, as in a size sweep, the name line is only printed when it changes
+void ArgumentModel_set_log_name_once(bool once);
+bool ArgumentModel_log_name_line(const std::string& names);
+
+// Leading columns of each line of the calling thread, such as the point of a layout sweep, empty
+// by default
+void ArgumentModel_set_log_prefix(const std::string& names, const std::string& values);
+
+const std::string& ArgumentModel_get_log_prefix_names();
+const std::string& ArgumentModel_get_log_prefix_values();
+
+// hipblas-us of the last timed test of the calling thread
+void   ArgumentModel_set_last_us(double us);
+double ArgumentModel_get_last_us();
+
+// Gflop of one call, all batches, of the last timed test of the calling thread, 0 if not counted
+void   ArgumentModel_set_last_gflop(double gflop);
+double ArgumentModel_get_last_gflop();
+
+// With log_quiet the tests of the calling thread only set the last hipblas-us, for the calibration
+// runs of hipblas-bench --time_budget_ms
+void ArgumentModel_set_log_quiet(bool quiet);
+bool ArgumentModel_get_log_quiet();
+
+// Structured records of hipblas-bench --output csv or json with the machine, all arguments and the
+// performance fields. They are buffered and written at exit to the file of --output_file, or to
+// stdout in place of the name and value lines. --output sqlite appends them instead to the results
+// table of the database of --output_file.
+void ArgumentModel_set_output(const std::string& format, const std::string& file);
+bool ArgumentModel_get_output();
+bool ArgumentModel_get_output_to_stdout();
+void ArgumentModel_flush_output();
+void ArgumentModel_log_record(const Arguments&   arg,
+                              const std::string& perf_names,
+                              const std::string& perf_values);
+
+// Latency histograms of hipblas-bench --histogram: the event times of the hot calls of each test
+// in log buckets, written to file with the machine, the arguments and the performance fields as
+// one JSON object per line
+void ArgumentModel_set_histogram(const std::string& file);
+bool ArgumentModel_get_histogram();
+void ArgumentModel_log_histogram(const Arguments&           arg,
+                                 const std::string&         perf_names,
+                                 const std::string&         perf_values,
+                                 const std::vector<double>& sorted_us);
+
 // ArgumentModel template has a variadic list of argument enums
 template <hipblas_argument... Args>
 class ArgumentModel
@@ -60,30 +112,160 @@ class ArgumentModel
     }
 
 public:
-    void log_perf(std::stringstream& name_line,
-                  std::stringstream& val_line,
-                  const Arguments&   arg,
-                  double             gpu_us,
-                  double             gflops,
-                  double             gbytes,
-                  double             norm1,
-                  double             norm2)
+    void log_perf(std::stringstream&   name_line,
+                  std::stringstream&   val_line,
+                  const Arguments&     arg,
+                  double               gpu_us,
+                  double               gflops,
+                  double               gbytes,
+                  double               norm1,
+                  double               norm2,
+                  std::string&         kernel_lines,
+                  std::vector<double>& hot_us)
     {
         bool has_batch_count = has(e_batch_count, Args...);
         int  batch_count     = has_batch_count ? arg.batch_count : 1;
         int  hot_calls       = arg.iters < 1 ? 1 : arg.iters;
 
+        // GPU time of each hot call from hipblasEventTimer, which excludes host launch gaps and
+        // cache flushes. The wall time includes the flushes, so they replace it when flushing.
+        // With --graph or --counters, the wall time of the loop includes the capture and replay or
+        // the counted call, so it is taken from the timer.
+        hipblasTimes         results = hipblas_take_iteration_times();
+        std::vector<double>& times   = results.hot_us;
+        if(!times.empty() && hipblas_get_flush_memory_size())
+        {
+            gpu_us = 0;
+            for(double t : times)
+                gpu_us += t;
+        }
+        else if(results.graph_us != 0 || !results.counters.empty())
+            gpu_us = results.end_us - results.start_us;
+
         // per/us to per/sec *10^6
         double hipblas_gflops = gflops * batch_count * hot_calls / gpu_us * 1e6;
         double hipblas_GBps   = gbytes * batch_count * hot_calls / gpu_us * 1e6;
 
+        // NA_value counts as no work
+        if(results.end_us > results.start_us)
+            hipblas_add_concurrent_totals(std::max(gflops, 0.0) * batch_count * hot_calls,
+                                          std::max(gbytes, 0.0) * batch_count * hot_calls,
+                                          results.start_us,
+                                          results.end_us);
+
         // append performance fields
-        if(name_line.rdbuf()->in_avail())
-            name_line << ",";
         name_line << "hipblas-Gflops,hipblas-GB/s,hipblas-us,";
-        if(val_line.rdbuf()->in_avail())
-            val_line << ",";
         val_line << hipblas_gflops << ", " << hipblas_GBps << ", " << gpu_us / hot_calls << ", ";
+        ArgumentModel_set_last_us(gpu_us / hot_calls);
+        ArgumentModel_set_last_gflop(std::max(gflops, 0.0) * batch_count);
+
+        if(!times.empty())
+        {
+            std::sort(times.begin(), times.end());
+            size_t n    = times.size();
+            double mean = 0, var = 0;
+            for(double t : times)
+                mean += t / n;
+            for(double t : times)
+                var += (t - mean) * (t - mean) / n;
+
+            // nearest-rank percentile
+            auto percentile = [&](double p) { return times[size_t(std::ceil(p * n)) - 1]; };
+
+            name_line << "hipblas-us-min,hipblas-us-median,hipblas-us-p90,hipblas-us-p99,"
+                         "hipblas-us-stddev,";
+            val_line << times[0] << ", " << (times[(n - 1) / 2] + times[n / 2]) / 2 << ", "
+                     << percentile(0.9) << ", " << percentile(0.99) << ", " << std::sqrt(var)
+                     << ", ";
+
+            // The tail of the histogram
+            if(ArgumentModel_get_histogram())
+            {
+                name_line << "hipblas-us-p99.9,hipblas-us-max,";
+                val_line << percentile(0.999) << ", " << times[n - 1] << ", ";
+                hot_us = times;
+            }
+        }
+
+        const hipblasBenchThread& bench_thread = hipblas_get_bench_thread();
+        if(bench_thread.thread >= 0)
+        {
+            name_line << "thread,stream,";
+            val_line << bench_thread.thread << ", " << bench_thread.stream_index << ", ";
+        }
+
+        if(hipblas_get_timing_pointer_mode_set())
+        {
+            name_line << "pointer_mode,";
+            val_line << (results.pointer_mode == HIPBLAS_POINTER_MODE_HOST ? "host" : "device")
+                     << ", ";
+        }
+
+        if(results.graph_us != 0)
+        {
+            double graph_us = results.graph_us / hot_calls;
+            name_line << "hipblas-graph-us,hipblas-launch-us,";
+            if(results.graph_us < 0)
+                val_line << ArgumentLogging::NA_value << ", " << ArgumentLogging::NA_value << ", ";
+            else
+                val_line << graph_us << ", " << gpu_us / hot_calls - graph_us << ", ";
+        }
+
+        // Roofline position against the peaks of the device for the A type of the problem
+        if(hipblas_get_efficiency())
+        {
+            double peak_gflops = hipblas_peak_gflops(arg.a_type);
+            double peak_GBps   = hipblas_peak_gbps();
+            auto   na_or       = [](bool known, double value) {
+                return known ? value : ArgumentLogging::NA_value;
+            };
+
+            name_line << "hipblas-%peak-Gflops,hipblas-%peak-GB/s,flop/byte,";
+            val_line << na_or(gflops >= 0 && peak_gflops > 0, 100 * hipblas_gflops / peak_gflops)
+                     << ", " << na_or(gbytes >= 0 && peak_GBps > 0, 100 * hipblas_GBps / peak_GBps)
+                     << ", " << na_or(gflops >= 0 && gbytes > 0, gflops / gbytes) << ", ";
+        }
+
+        // Bandwidth against that measured by --bandwidth on the same device
+        if(hipblas_get_bandwidth())
+        {
+            double measured_GBps = hipblas_measured_gbps();
+            name_line << "hipblas-%measured-GB/s,";
+            val_line << (gbytes >= 0 && measured_GBps > 0 ? 100 * hipblas_GBps / measured_GBps
+                                                          : ArgumentLogging::NA_value)
+                     << ", ";
+        }
+
+        // Device state averaged over the hot calls, NA_value where the driver does not report it
+        if(hipblas_get_telemetry())
+        {
+            const hipblasTelemetry& telemetry = results.telemetry;
+            auto                    na_or     = [](double value) {
+                return value >= 0 ? value : ArgumentLogging::NA_value;
+            };
+
+            name_line << "hipblas-power-W,hipblas-sclk-MHz,hipblas-mclk-MHz,hipblas-temp-C,"
+                         "hipblas-Gflops/W,";
+            val_line << na_or(telemetry.power_w) << ", " << na_or(telemetry.sclk_mhz) << ", "
+                     << na_or(telemetry.mclk_mhz) << ", " << na_or(telemetry.temp_c) << ", "
+                     << (gflops >= 0 && telemetry.power_w > 0 ? hipblas_gflops / telemetry.power_w
+                                                              : ArgumentLogging::NA_value)
+                     << ", ";
+        }
+
+        // Hardware counters of one call, counted after the timed ones
+        const std::vector<std::string>& counters = hipblas_get_counters();
+        for(size_t i = 0; i < counters.size(); i++)
+        {
+            name_line << "hipblas-" << counters[i] << ",";
+            val_line << (i < results.counters.size() && results.counters[i] >= 0
+                             ? results.counters[i]
+                             : ArgumentLogging::NA_value)
+                     << ", ";
+        }
+
+        if(hipblas_get_kernel_breakdown())
+            kernel_lines = hipblas_kernel_lines(results.kernels);
 
         if(arg.unit_check || arg.norm_check)
         {
@@ -110,6 +292,12 @@ public:
         std::stringstream name_list;
         std::stringstream value_list;
 
+        if(!ArgumentModel_get_log_prefix_names().empty())
+        {
+            name_list << ArgumentModel_get_log_prefix_names() << ",";
+            value_list << ArgumentModel_get_log_prefix_values() << ",";
+        }
+
         if(ArgumentModel_get_log_function_name())
         {
             auto delim = ",";
@@ -174,10 +362,43 @@ public:
         (void)(int[]){(ArgumentsHelper::apply<Args>{}()(print, arg, T{}), 0)...};
 #endif
 
+        std::stringstream   perf_names;
+        std::stringstream   perf_values;
+        std::string         kernel_lines;
+        std::vector<double> hot_us;
         if(arg.timing)
-            log_perf(name_list, value_list, arg, gpu_us, gflops, gpu_bytes, norm1, norm2);
+            log_perf(perf_names,
+                     perf_values,
+                     arg,
+                     gpu_us,
+                     gflops,
+                     gpu_bytes,
+                     norm1,
+                     norm2,
+                     kernel_lines,
+                     hot_us);
+
+        if(ArgumentModel_get_log_quiet())
+            return;
+        if(ArgumentModel_get_output())
+            ArgumentModel_log_record(arg, perf_names.str(), perf_values.str());
+        if(!hot_us.empty())
+            ArgumentModel_log_histogram(arg, perf_names.str(), perf_values.str(), hot_us);
+        if(ArgumentModel_get_output_to_stdout())
+            return;
 
-        str << name_list.str() << "\n" << value_list.str() << std::endl;
+        // One write, so that the lines of concurrent hipblas-bench threads do not interleave
+        std::string names  = name_list.str();
+        std::string values = value_list.str();
+        if(arg.timing)
+        {
+            names += (names.empty() ? "" : ",") + perf_names.str();
+            values += (values.empty() ? "" : ",") + perf_values.str();
+        }
+        std::string lines = values + "\n" + kernel_lines;
+        if(ArgumentModel_log_name_line(names))
+            lines = names + "\n" + lines;
+        str << lines << std::flush;
     }
 
     void test_name(const Arguments& arg, std::string& name)
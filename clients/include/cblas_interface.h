@@ -199,6 +199,35 @@ void cblas_symv(
 template <typename T>
 int cblas_potrf(char uplo, int m, T* A, int lda);
 
+// potrs
+template <typename T>
+int cblas_potrs(char uplo, int n, int nrhs, T* A, int lda, T* B, int ldb);
+
+// potri
+template <typename T>
+int cblas_potri(char uplo, int n, T* A, int lda);
+
+// syev and heev, rwork of 3 * n - 2 entries is only used by heev
+template <typename T, typename U>
+int cblas_syev(char jobz, char uplo, int n, T* A, int lda, U* W, T* work, int lwork, U* rwork);
+
+// gesvd, rwork of 5 * min(m, n) entries is only used by the complex precisions
+template <typename T, typename U>
+int cblas_gesvd(char jobu,
+                char jobvt,
+                int  m,
+                int  n,
+                T*   A,
+                int  lda,
+                U*   S,
+                T*   UU,
+                int  ldu,
+                T*   VT,
+                int  ldvt,
+                T*   work,
+                int  lwork,
+                U*   rwork);
+
 // tbmv
 template <typename T>
 void cblas_tbmv(hipblasFillMode_t  uplo,
@@ -456,6 +485,13 @@ int cblas_getrf(int m, int n, T* A, int lda, int* ipiv);
 template <typename T>
 int cblas_getrs(char trans, int n, int nrhs, T* A, int lda, int* ipiv, T* B, int ldb);
 
+// gecon of the getrf factors in A; the work arrays are allocated per call
+template <typename T, typename U>
+int cblas_gecon(char norm, int n, T* A, int lda, U anorm, U* rcond);
+
+template <typename T, typename U>
+U cblas_lange(char norm, int m, int n, T* A, int lda);
+
 template <typename T>
 int cblas_getri(int n, T* A, int lda, int* ipiv, T* work, int lwork);
 
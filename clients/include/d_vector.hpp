@@ -28,13 +28,48 @@
 #include <clocale>
 #include <cstdio>
 
+/* ============================================================================================ */
+/*! \brief  device memory of d_vector and of the pointer arrays of device_batch_vector. While
+            hipblas_set_device_memory_reuse(true), freed blocks stay allocated and serve later
+            allocations of at most their size on the same device, so a size sweep allocates its
+            largest problem once and a data file run reuses the memory of earlier tests. Reuse
+            starts enabled when HIPBLAS_CLIENT_DEVICE_POOL=1. Setting it returns the previous
+            mode. */
+bool       hipblas_set_device_memory_reuse(bool reuse);
+hipError_t hipblas_device_malloc(void** ptr, size_t bytes);
+hipError_t hipblas_device_free(void* ptr);
+
+/*! \brief  host memory of host_vector and host_batch_vector. While
+            hipblas_set_host_memory_pinned(true), new host vectors are allocated with hipHostMalloc,
+            so their copies to and from the device run as DMA instead of through pageable staging
+            buffers. A vector is freed the way it was allocated. */
+void  hipblas_set_host_memory_pinned(bool pinned);
+bool  hipblas_host_memory_pinned();
+void* hipblas_host_malloc(size_t bytes, bool pinned);
+void  hipblas_host_free(void* ptr, bool pinned);
+
+/*! \brief  layout of the vectors of device_batch_vector. With an alignment, all vectors of a
+            batch are carved from one allocation at slots of their size rounded up to that power of
+            two, in batch order or, with shuffle, in a fixed random order. With alignment 0, the
+            default, each vector is a separate allocation. */
+void   hipblas_set_device_batch_layout(size_t alignment, bool shuffle);
+size_t hipblas_device_batch_alignment();
+bool   hipblas_device_batch_shuffle();
+
+/*! \brief  offset in elements of each device vector from the start of its block, or of its slot
+            in a batch, which is allocated that much larger. It misaligns the base pointers of the
+            routines, as in hipblas-bench --ptr_offset_sweep. Vectors keep the offset they were
+            allocated with. */
+void   hipblas_set_device_pointer_offset(size_t offset);
+size_t hipblas_device_pointer_offset();
+
 /* ============================================================================================ */
 /*! \brief  base-class to allocate/deallocate device memory */
 template <typename T, size_t PAD, typename U>
 class d_vector
 {
 protected:
-    size_t size, bytes;
+    size_t size, bytes, offset;
 
     inline size_t nmemb() const noexcept
     {
@@ -45,7 +80,8 @@ protected:
     U guard[PAD];
     d_vector(size_t s)
         : size(s)
-        , bytes((s + PAD * 2) * sizeof(T))
+        , bytes((s + PAD * 2 + hipblas_device_pointer_offset()) * sizeof(T))
+        , offset(hipblas_device_pointer_offset())
     {
         // Initialize guard with random data
         if(PAD > 0)
@@ -56,66 +92,81 @@ protected:
 #else
     d_vector(size_t s)
         : size(s)
-        , bytes(s ? s * sizeof(T) : sizeof(T))
+        , bytes(((s ? s : 1) + hipblas_device_pointer_offset()) * sizeof(T))
+        , offset(hipblas_device_pointer_offset())
     {
     }
 #endif
 
-    T* device_vector_setup()
+    // Writes the guards around the vector of block d, returning the vector
+    T* device_vector_guard(T* d)
     {
-        T* d;
-        if((hipMalloc)(&d, bytes) != hipSuccess)
-        {
-            static char* lc = setlocale(LC_NUMERIC, "");
-            fprintf(stderr, "Error allocating %'zu bytes (%zu GB)\n", bytes, bytes >> 30);
-            d = nullptr;
-        }
+        d += offset;
 #ifdef GOOGLE_TEST
-        else
+        if(PAD > 0)
         {
-            if(PAD > 0)
-            {
-                // Copy guard to device memory before allocated memory
-                CHECK_HIP_ERROR(hipMemcpy(d, guard, sizeof(guard), hipMemcpyHostToDevice));
+            // Copy guard to device memory before allocated memory
+            CHECK_HIP_ERROR(hipMemcpy(d, guard, sizeof(guard), hipMemcpyHostToDevice));
 
-                // Point to allocated block
-                d += PAD;
+            // Point to allocated block
+            d += PAD;
 
-                // Copy guard to device memory after allocated memory
-                CHECK_HIP_ERROR(hipMemcpy(d + size, guard, sizeof(guard), hipMemcpyHostToDevice));
-            }
+            // Copy guard to device memory after allocated memory
+            CHECK_HIP_ERROR(hipMemcpy(d + size, guard, sizeof(guard), hipMemcpyHostToDevice));
         }
 #endif
         return d;
     }
 
-    void device_vector_teardown(T* d)
+    // Checks the guards around the vector d, returning its block
+    T* device_vector_check(T* d)
     {
-        if(d != nullptr)
-        {
 #ifdef GOOGLE_TEST
-            if(PAD > 0)
-            {
-                U host[PAD];
+        if(PAD > 0)
+        {
+            U host[PAD];
 
-                // Copy device memory after allocated memory to host
-                CHECK_HIP_ERROR(hipMemcpy(host, d + size, sizeof(guard), hipMemcpyDeviceToHost));
+            // Copy device memory after allocated memory to host
+            CHECK_HIP_ERROR(hipMemcpy(host, d + size, sizeof(guard), hipMemcpyDeviceToHost));
 
-                // Make sure no corruption has occurred
-                EXPECT_EQ(memcmp(host, guard, sizeof(guard)), 0);
+            // Make sure no corruption has occurred
+            EXPECT_EQ(memcmp(host, guard, sizeof(guard)), 0);
 
-                // Point to guard before allocated memory
-                d -= PAD;
+            // Point to guard before allocated memory
+            d -= PAD;
 
-                // Copy device memory after allocated memory to host
-                CHECK_HIP_ERROR(hipMemcpy(host, d, sizeof(guard), hipMemcpyDeviceToHost));
+            // Copy device memory after allocated memory to host
+            CHECK_HIP_ERROR(hipMemcpy(host, d, sizeof(guard), hipMemcpyDeviceToHost));
 
-                // Make sure no corruption has occurred
-                EXPECT_EQ(memcmp(host, guard, sizeof(guard)), 0);
-            }
+            // Make sure no corruption has occurred
+            EXPECT_EQ(memcmp(host, guard, sizeof(guard)), 0);
+        }
 #endif
+        return d - offset;
+    }
+
+    T* device_vector_setup()
+    {
+        T* d;
+        if(hipblas_device_malloc((void**)&d, bytes) != hipSuccess)
+        {
+            static char* lc = setlocale(LC_NUMERIC, "");
+            fprintf(stderr, "Error allocating %'zu bytes (%zu GB)\n", bytes, bytes >> 30);
+            d = nullptr;
+        }
+        else
+        {
+            d = device_vector_guard(d);
+        }
+        return d;
+    }
+
+    void device_vector_teardown(T* d)
+    {
+        if(d != nullptr)
+        {
             // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            CHECK_HIP_ERROR(hipblas_device_free(device_vector_check(d)));
         }
     }
 };
@@ -0,0 +1,80 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef _DEVICE_BANDWIDTH_HPP_
+#define _DEVICE_BANDWIDTH_HPP_
+
+#include "hipblas.h"
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Memory bandwidth of the device measured by hipblas-bench --bandwidth, STREAM style: a copy
+// b = a with hipMemcpyAsync and a triad a = b + s * c of double arrays of each size, timed with
+// hipEvents, best of bandwidth_reps. Each device is measured once per process; with a cache file
+// the measurements of a device, keyed by its arch, name and the sizes, are read from it, or
+// appended to it once taken. The memory-bound columns of the tests are then normalized against
+// the triad bandwidth of the largest size, which does not fit in the caches.
+constexpr int bandwidth_reps = 20;
+
+struct hipblasBandwidth
+{
+    size_t bytes; // of each array
+    double copy_gbps; // counting a read and a write of each element, < 0 if not measured
+    double triad_gbps; // counting two reads and a write, < 0 if not measured
+};
+
+void hipblas_set_bandwidth(bool bandwidth);
+bool hipblas_get_bandwidth();
+
+// Sizes in MiB of each array, default 1, 8, 64 and 512, and the cache file, none by default
+void hipblas_set_bandwidth_sizes(const std::vector<size_t>& mib);
+void hipblas_set_bandwidth_cache(const std::string& path);
+
+// Measurements of the current device by increasing size, one per size that fits in its memory
+const std::vector<hipblasBandwidth>& hipblas_device_bandwidth();
+
+// Triad GB/s of the largest size of the current device, or its copy GB/s without a triad kernel,
+// 0 if neither was measured
+double hipblas_measured_gbps();
+
+// Writes the measurements of the current device as csv lines
+void hipblas_print_bandwidth(std::ostream& str);
+
+#ifdef HIPBLAS_DEVICE_TRIAD
+// a = b + scalar * c on n elements on stream, from hipblas_triad_device.cpp
+hipError_t hipblas_device_triad(
+    double* a, const double* b, const double* c, double scalar, size_t n, hipStream_t stream);
+
+constexpr bool hipblas_device_triad_enabled = true;
+#else
+inline hipError_t
+    hipblas_device_triad(double*, const double*, const double*, double, size_t, hipStream_t)
+{
+    return hipErrorNotSupported;
+}
+
+constexpr bool hipblas_device_triad_enabled = false;
+#endif
+
+#endif
@@ -26,7 +26,11 @@
 
 // #include "d_vector.hpp"
 // #include "hipblas_vector.hpp"
+#include <algorithm>
 #include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
 
 //
 // Local declaration of the host strided batch vector.
@@ -251,6 +255,7 @@ private:
     int m_batch_count{};
     T** m_data{};
     T** m_device_data{};
+    T*  m_slab{};
 
     //!
     //! @brief Try to allocate the ressources.
@@ -261,19 +266,28 @@ private:
         bool success = false;
 
         success
-            = (hipSuccess == (hipMalloc)(&this->m_device_data, this->m_batch_count * sizeof(T*)));
+            = (hipSuccess
+               == hipblas_device_malloc((void**)&this->m_device_data,
+                                        this->m_batch_count * sizeof(T*)));
         if(success)
         {
             success = (nullptr != (this->m_data = (T**)calloc(this->m_batch_count, sizeof(T*))));
             if(success)
             {
-                for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
+                if(hipblas_device_batch_alignment())
                 {
-                    success
-                        = (nullptr != (this->m_data[batch_index] = this->device_vector_setup()));
-                    if(!success)
+                    success = this->try_initialize_slab();
+                }
+                else
+                {
+                    for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
                     {
-                        break;
+                        success = (nullptr
+                                   != (this->m_data[batch_index] = this->device_vector_setup()));
+                        if(!success)
+                        {
+                            break;
+                        }
                     }
                 }
 
@@ -290,6 +304,35 @@ private:
         return success;
     }
 
+    //!
+    //! @brief Carve the vectors from one allocation, see hipblas_set_device_batch_layout.
+    //! @return true if success false otherwise.
+    //!
+    bool try_initialize_slab()
+    {
+        size_t alignment = hipblas_device_batch_alignment();
+        size_t slot      = (this->bytes + alignment - 1) / alignment * alignment;
+        size_t count     = std::max(this->m_batch_count, 1);
+
+        if(hipSuccess != hipblas_device_malloc((void**)&this->m_slab, slot * count))
+        {
+            this->m_slab = nullptr;
+            return false;
+        }
+
+        std::vector<int> order(this->m_batch_count);
+        std::iota(order.begin(), order.end(), 0);
+        if(hipblas_device_batch_shuffle())
+            std::shuffle(order.begin(), order.end(), std::mt19937(this->m_batch_count));
+
+        for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
+        {
+            T* block = (T*)((char*)this->m_slab + slot * order[batch_index]);
+            this->m_data[batch_index] = this->device_vector_guard(block);
+        }
+        return true;
+    }
+
     //!
     //! @brief Free the ressources, as much as we can.
     //!
@@ -301,7 +344,10 @@ private:
             {
                 if(nullptr != this->m_data[batch_index])
                 {
-                    this->device_vector_teardown(this->m_data[batch_index]);
+                    if(this->m_slab)
+                        this->device_vector_check(this->m_data[batch_index]);
+                    else
+                        this->device_vector_teardown(this->m_data[batch_index]);
                     this->m_data[batch_index] = nullptr;
                 }
             }
@@ -310,11 +356,18 @@ private:
             this->m_data = nullptr;
         }
 
+        if(nullptr != this->m_slab)
+        {
+            auto tmp_slab = this->m_slab;
+            this->m_slab  = nullptr;
+            CHECK_HIP_ERROR(hipblas_device_free(tmp_slab));
+        }
+
         if(nullptr != this->m_device_data)
         {
             auto tmp_device_data = this->m_device_data;
             this->m_device_data  = nullptr;
-            CHECK_HIP_ERROR((hipFree)(tmp_device_data));
+            CHECK_HIP_ERROR(hipblas_device_free(tmp_device_data));
         }
     }
 };
@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef _DEVICE_COUNTERS_HPP_
+#define _DEVICE_COUNTERS_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Hardware counter columns of hipblas-bench --counters, a comma-separated list of rocprofiler
+// metrics such as L2CacheHit,FETCH_SIZE,WRITE_SIZE,VALUUtilization,MemUnitBusy
+void                            hipblas_set_counters(const std::string& list);
+const std::vector<std::string>& hipblas_get_counters();
+
+struct hipblasCounterState;
+
+// Counts the metrics of hipblas_get_counters() on the current device between start and stop, both
+// called with the device idle, so the values are those of the work enqueued in between and of
+// nothing else. AMD devices are counted with rocprofiler, loaded when the session opens; the
+// counters of NVIDIA devices are not collected. stop returns a value per metric, < 0 for one
+// that was not collected.
+class hipblasCounterSession
+{
+    std::unique_ptr<hipblasCounterState> m_state;
+
+public:
+    hipblasCounterSession();
+
+    ~hipblasCounterSession();
+
+    hipblasCounterSession(const hipblasCounterSession&) = delete;
+    hipblasCounterSession& operator=(const hipblasCounterSession&) = delete;
+
+    void start();
+
+    std::vector<double> stop();
+};
+
+#endif
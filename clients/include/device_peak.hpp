@@ -0,0 +1,50 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef _DEVICE_PEAK_HPP_
+#define _DEVICE_PEAK_HPP_
+
+#include "hipblas.h"
+#include <string>
+
+// Roofline columns of hipblas-bench --efficiency. The peaks of the current device come from a
+// table of flops per clock per compute unit for each arch, the clock rate and the memory bus, and
+// the file given to hipblas_load_peak_file overrides them.
+void hipblas_set_efficiency(bool efficiency);
+bool hipblas_get_efficiency();
+
+// Arch of a device, for example gfx90a or sm_80, without the gcnArchName target features
+std::string hipblas_device_arch(const hipDeviceProp_t& props);
+
+// Reads lines "<arch> <precision> <Gflop/s>" and "<arch> bandwidth <GB/s>", where arch is for
+// example gfx90a or sm_80 and precision is for example f32_r. Throws std::invalid_argument for a
+// line it cannot read.
+void hipblas_load_peak_file(const std::string& path);
+
+// Peak Gflop/s of the current device for data of type type, 0 if unknown
+double hipblas_peak_gflops(hipblasDatatype_t type);
+
+// Peak memory bandwidth of the current device in GB/s, 0 if unknown
+double hipblas_peak_gbps();
+
+#endif
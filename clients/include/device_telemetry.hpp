@@ -0,0 +1,75 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef _DEVICE_TELEMETRY_HPP_
+#define _DEVICE_TELEMETRY_HPP_
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+// Power, clock and temperature columns of hipblas-bench --telemetry
+void hipblas_set_telemetry(bool telemetry);
+bool hipblas_get_telemetry();
+
+// Averages of the device state over the samples taken between start and stop, < 0 for a value
+// the driver does not report
+struct hipblasTelemetry
+{
+    int    samples  = 0;
+    double power_w  = -1;
+    double sclk_mhz = -1;
+    double mclk_mhz = -1;
+    double temp_c   = -1;
+};
+
+// Samples the current device from a thread of its own every period_ms, and once at start and stop.
+// AMD devices are read from the amdgpu hwmon files of their PCI bus id, which is also what
+// rocm-smi reports, and NVIDIA devices through NVML, loaded when the sampler starts.
+class hipblasTelemetrySampler
+{
+    int               m_period_ms;
+    std::string       m_hwmon;
+    void*             m_nvml_device = nullptr;
+    std::atomic<bool> m_running{false};
+    std::thread       m_thread;
+    int               m_samples = 0;
+    double            m_sum[4]{}; // power in W, sclk and mclk in MHz, temperature in C
+    int               m_count[4]{};
+
+    void sample();
+
+public:
+    explicit hipblasTelemetrySampler(int period_ms = 10);
+
+    ~hipblasTelemetrySampler();
+
+    hipblasTelemetrySampler(const hipblasTelemetrySampler&) = delete;
+    hipblasTelemetrySampler& operator=(const hipblasTelemetrySampler&) = delete;
+
+    void start();
+
+    hipblasTelemetry stop();
+};
+
+#endif
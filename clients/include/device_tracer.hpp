@@ -0,0 +1,71 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef _DEVICE_TRACER_HPP_
+#define _DEVICE_TRACER_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Kernel lines of hipblas-bench --kernel_breakdown
+void hipblas_set_kernel_breakdown(bool breakdown);
+bool hipblas_get_kernel_breakdown();
+
+// A kernel launched between start and stop of a hipblasKernelTracer, with its grid and block in
+// work groups and work items, 0 where the launch API used is not known to the tracer
+struct hipblasKernelRecord
+{
+    std::string name;
+    unsigned    grid[3]  = {};
+    unsigned    block[3] = {};
+    double      us       = 0;
+};
+
+struct hipblasTracerState;
+
+// Traces the kernels launched on the device between start and stop, both called with the device
+// idle. AMD devices are traced with roctracer, loaded when the tracer is created: the activity
+// records give the name and duration of each kernel, and the callbacks of the HIP launch APIs its
+// grid and block, matched by correlation id. NVIDIA devices are not traced and stop returns no
+// kernels.
+class hipblasKernelTracer
+{
+    std::unique_ptr<hipblasTracerState> m_state;
+
+public:
+    hipblasKernelTracer();
+
+    ~hipblasKernelTracer();
+
+    hipblasKernelTracer(const hipblasKernelTracer&) = delete;
+    hipblasKernelTracer& operator=(const hipblasKernelTracer&) = delete;
+
+    void start();
+
+    std::vector<hipblasKernelRecord> stop();
+};
+
+// Lines of the kernels, in launch order, after the value line of a traced test
+std::string hipblas_kernel_lines(const std::vector<hipblasKernelRecord>& kernels);
+
+#endif
@@ -880,6 +880,63 @@ constexpr double getrs_gflop_count<hipblasDoubleComplex>(int n, int nrhs)
     return 4.0 * getrs_gflop_count<float>(n, nrhs);
 }
 
+/* \brief floating point counts of POTRF */
+template <typename T>
+constexpr double potrf_gflop_count(int n)
+{
+    return ((1.0 / 3.0) * n * n * n) / 1e9;
+}
+
+template <>
+constexpr double potrf_gflop_count<hipblasComplex>(int n)
+{
+    return 4.0 * potrf_gflop_count<float>(n);
+}
+
+template <>
+constexpr double potrf_gflop_count<hipblasDoubleComplex>(int n)
+{
+    return 4.0 * potrf_gflop_count<float>(n);
+}
+
+/* \brief floating point counts of POTRI */
+template <typename T>
+constexpr double potri_gflop_count(int n)
+{
+    return ((2.0 / 3.0) * n * n * n) / 1e9;
+}
+
+template <>
+constexpr double potri_gflop_count<hipblasComplex>(int n)
+{
+    return 4.0 * potri_gflop_count<float>(n);
+}
+
+template <>
+constexpr double potri_gflop_count<hipblasDoubleComplex>(int n)
+{
+    return 4.0 * potri_gflop_count<float>(n);
+}
+
+/* \brief floating point counts of POTRS */
+template <typename T>
+constexpr double potrs_gflop_count(int n, int nrhs)
+{
+    return (2.0 * n * n * nrhs) / 1e9;
+}
+
+template <>
+constexpr double potrs_gflop_count<hipblasComplex>(int n, int nrhs)
+{
+    return 4.0 * potrs_gflop_count<float>(n, nrhs);
+}
+
+template <>
+constexpr double potrs_gflop_count<hipblasDoubleComplex>(int n, int nrhs)
+{
+    return 4.0 * potrs_gflop_count<float>(n, nrhs);
+}
+
 /* \brief floating point counts of GELS */
 template <typename T>
 constexpr double gels_gflop_count(int m, int n)
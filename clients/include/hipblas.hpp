@@ -1883,6 +1883,50 @@ hipblasStatus_t hipblasTrsmStridedBatched(hipblasHandle_t    handle,
                                           hipblasStride      strideB,
                                           int                batch_count);
 
+// Xt gemm, syrk and trsm on several devices
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasXtGemm(hipblasXtHandle_t  handle,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              size_t             m,
+                              size_t             n,
+                              size_t             k,
+                              const T*           alpha,
+                              const T*           A,
+                              size_t             lda,
+                              const T*           B,
+                              size_t             ldb,
+                              const T*           beta,
+                              T*                 C,
+                              size_t             ldc);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasXtSyrk(hipblasXtHandle_t  handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              size_t             n,
+                              size_t             k,
+                              const T*           alpha,
+                              const T*           A,
+                              size_t             lda,
+                              const T*           beta,
+                              T*                 C,
+                              size_t             ldc);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasXtTrsm(hipblasXtHandle_t  handle,
+                              hipblasSideMode_t  side,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              hipblasDiagType_t  diag,
+                              size_t             m,
+                              size_t             n,
+                              const T*           alpha,
+                              const T*           A,
+                              size_t             lda,
+                              T*                 B,
+                              size_t             ldb);
+
 // getrf
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t
@@ -1962,6 +2006,31 @@ hipblasStatus_t hipblasGetriBatched(hipblasHandle_t handle,
                                     int*            info,
                                     const int       batchCount);
 
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGetriStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           T*                  A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           T*                  C,
+                                           const int           ldc,
+                                           const hipblasStride strideC,
+                                           int*                info,
+                                           const int           batchCount);
+
+// matinv
+template <typename T>
+hipblasStatus_t hipblasMatinvBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     const T* const  A[],
+                                     const int       lda,
+                                     T* const        Ainv[],
+                                     const int       lda_inv,
+                                     int*            info,
+                                     const int       batchCount);
+
 // geqrf
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGeqrf(
@@ -2033,6 +2102,432 @@ hipblasStatus_t hipblasGelsStridedBatched(hipblasHandle_t     handle,
                                           int*                deviceInfo,
                                           const int           batchCount);
 
+// geqrs
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGeqrsBatched(hipblasHandle_t handle,
+                                    const int       factorize,
+                                    const int       m,
+                                    const int       n,
+                                    const int       nrhs,
+                                    T* const        A[],
+                                    const int       lda,
+                                    T* const        tau[],
+                                    T* const        B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGeqrsStridedBatched(hipblasHandle_t     handle,
+                                           const int           factorize,
+                                           const int           m,
+                                           const int           n,
+                                           const int           nrhs,
+                                           T*                  A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           T*                  tau,
+                                           const hipblasStride strideT,
+                                           T*                  B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batchCount);
+
+// gesvBatched
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGesvBatched(hipblasHandle_t handle,
+                                   const int       n,
+                                   const int       nrhs,
+                                   T* const        A[],
+                                   const int       lda,
+                                   int*            ipiv,
+                                   T* const        B[],
+                                   const int       ldb,
+                                   int*            info,
+                                   const int       batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGesvStridedBatched(hipblasHandle_t     handle,
+                                          const int           n,
+                                          const int           nrhs,
+                                          T*                  A,
+                                          const int           lda,
+                                          const hipblasStride strideA,
+                                          int*                ipiv,
+                                          const hipblasStride strideP,
+                                          T*                  B,
+                                          const int           ldb,
+                                          const hipblasStride strideB,
+                                          int*                info,
+                                          const int           batchCount);
+
+// potrf
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrf(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             T*                      A,
+                             const int               lda,
+                             int*                    info);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrfBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T* const                A[],
+                                    const int               lda,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrfStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// potrs
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrs(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             const int               nrhs,
+                             T*                      A,
+                             const int               lda,
+                             T*                      B,
+                             const int               ldb,
+                             int*                    info);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrsBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    T* const                A[],
+                                    const int               lda,
+                                    T* const                B[],
+                                    const int               ldb,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrsStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           T*                      B,
+                                           const int               ldb,
+                                           const hipblasStride     strideB,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// potri
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotri(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             T*                      A,
+                             const int               lda,
+                             int*                    info);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotriBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T* const                A[],
+                                    const int               lda,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotriStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// gecon
+template <typename T, typename U, bool FORTRAN = false>
+hipblasStatus_t hipblasGeconBatched(hipblasHandle_t         handle,
+                                    const hipblasNormType_t norm,
+                                    const int               n,
+                                    T* const                A[],
+                                    const int               lda,
+                                    const U*                anorm,
+                                    U*                      rcond,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T, typename U, bool FORTRAN = false>
+hipblasStatus_t hipblasGeconStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasNormType_t norm,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           const U*                anorm,
+                                           U*                      rcond,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// getrf and getrs with compact pivots
+template <typename T>
+hipblasStatus_t hipblasGetrfStridedBatchedCompactPivot(hipblasHandle_t          handle,
+                                                       const int                n,
+                                                       T*                       A,
+                                                       const int                lda,
+                                                       const hipblasStride      strideA,
+                                                       void*                    ipiv,
+                                                       const hipblasPivotType_t pivotType,
+                                                       const hipblasStride      strideP,
+                                                       int*                     info,
+                                                       const int                batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGetrsStridedBatchedCompactPivot(hipblasHandle_t          handle,
+                                                       const hipblasOperation_t trans,
+                                                       const int                n,
+                                                       const int                nrhs,
+                                                       T*                       A,
+                                                       const int                lda,
+                                                       const hipblasStride      strideA,
+                                                       const void*              ipiv,
+                                                       const hipblasPivotType_t pivotType,
+                                                       const hipblasStride      strideP,
+                                                       T*                       B,
+                                                       const int                ldb,
+                                                       const hipblasStride      strideB,
+                                                       int*                     info,
+                                                       const int                batchCount);
+
+// gtsv and gbsv
+template <typename T>
+hipblasStatus_t hipblasGtsvStridedBatched(hipblasHandle_t     handle,
+                                          const int           n,
+                                          const T*            dl,
+                                          const T*            d,
+                                          const T*            du,
+                                          const hipblasStride strideA,
+                                          T*                  x,
+                                          const hipblasStride strideX,
+                                          const int           batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGtsvInterleavedBatched(hipblasHandle_t handle,
+                                              const int       n,
+                                              const T*        dl,
+                                              const T*        d,
+                                              const T*        du,
+                                              T*              x,
+                                              const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGbsvBatched(hipblasHandle_t handle,
+                                   const int       n,
+                                   const int       kl,
+                                   const int       ku,
+                                   const int       nrhs,
+                                   T* const        AB[],
+                                   const int       ldab,
+                                   int*            ipiv,
+                                   T* const        B[],
+                                   const int       ldb,
+                                   int*            info,
+                                   const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGbsvStridedBatched(hipblasHandle_t     handle,
+                                          const int           n,
+                                          const int           kl,
+                                          const int           ku,
+                                          const int           nrhs,
+                                          T*                  AB,
+                                          const int           ldab,
+                                          const hipblasStride strideAB,
+                                          int*                ipiv,
+                                          const hipblasStride strideP,
+                                          T*                  B,
+                                          const int           ldb,
+                                          const hipblasStride strideB,
+                                          int*                info,
+                                          const int           batchCount);
+
+// gemvOffsetBatched and gemmOffsetBatched
+template <typename T>
+hipblasStatus_t hipblasGemvOffsetBatched(hipblasHandle_t    handle,
+                                         hipblasOperation_t trans,
+                                         int                m,
+                                         int                n,
+                                         const T*           alpha,
+                                         const T*           A,
+                                         int                lda,
+                                         const uint32_t*    offsetsA,
+                                         const T*           x,
+                                         int                incx,
+                                         const uint32_t*    offsetsx,
+                                         const T*           beta,
+                                         T*                 y,
+                                         int                incy,
+                                         const uint32_t*    offsetsy,
+                                         int                batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGemmOffsetBatched(hipblasHandle_t    handle,
+                                         hipblasOperation_t transA,
+                                         hipblasOperation_t transB,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const T*           alpha,
+                                         const T*           A,
+                                         int                lda,
+                                         const uint32_t*    offsetsA,
+                                         const T*           B,
+                                         int                ldb,
+                                         const uint32_t*    offsetsB,
+                                         const T*           beta,
+                                         T*                 C,
+                                         int                ldc,
+                                         const uint32_t*    offsetsC,
+                                         int                batchCount);
+
+// syevj and heevj
+template <typename T, typename U, bool FORTRAN = false>
+hipblasStatus_t hipblasSyevjBatched(hipblasHandle_t         handle,
+                                    const hipblasEigMode_t  jobz,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T* const                A[],
+                                    const int               lda,
+                                    const U                 abstol,
+                                    const int               maxSweeps,
+                                    const int               sortEig,
+                                    U*                      W,
+                                    const hipblasStride     strideW,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T, typename U, bool FORTRAN = false>
+hipblasStatus_t hipblasSyevjStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasEigMode_t  jobz,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           const U                 abstol,
+                                           const int               maxSweeps,
+                                           const int               sortEig,
+                                           U*                      W,
+                                           const hipblasStride     strideW,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// gesvdj
+template <typename T, typename Tr, bool FORTRAN = false>
+hipblasStatus_t hipblasGesvdjBatched(hipblasHandle_t        handle,
+                                     const hipblasEigMode_t jobz,
+                                     const int              econ,
+                                     const int              m,
+                                     const int              n,
+                                     T* const               A[],
+                                     const int              lda,
+                                     const Tr               abstol,
+                                     const int              maxSweeps,
+                                     Tr*                    S,
+                                     const hipblasStride    strideS,
+                                     T*                     U,
+                                     const int              ldu,
+                                     const hipblasStride    strideU,
+                                     T*                     V,
+                                     const int              ldv,
+                                     const hipblasStride    strideV,
+                                     int*                   info,
+                                     const int              batchCount);
+
+template <typename T, typename Tr, bool FORTRAN = false>
+hipblasStatus_t hipblasGesvdjStridedBatched(hipblasHandle_t        handle,
+                                            const hipblasEigMode_t jobz,
+                                            const int              econ,
+                                            const int              m,
+                                            const int              n,
+                                            T*                     A,
+                                            const int              lda,
+                                            const hipblasStride    strideA,
+                                            const Tr               abstol,
+                                            const int              maxSweeps,
+                                            Tr*                    S,
+                                            const hipblasStride    strideS,
+                                            T*                     U,
+                                            const int              ldu,
+                                            const hipblasStride    strideU,
+                                            T*                     V,
+                                            const int              ldv,
+                                            const hipblasStride    strideV,
+                                            int*                   info,
+                                            const int              batchCount);
+// gesvIR, only double and hipblasDoubleComplex refined in single precision
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGesvIR(hipblasHandle_t handle,
+                              const int       n,
+                              const int       nrhs,
+                              T*              A,
+                              const int       lda,
+                              int*            ipiv,
+                              T*              B,
+                              const int       ldb,
+                              T*              X,
+                              const int       ldx,
+                              int*            iter,
+                              int*            info,
+                              int*            deviceInfo);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGesvIRBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     const int       nrhs,
+                                     T* const        A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     T* const        B[],
+                                     const int       ldb,
+                                     T* const        X[],
+                                     const int       ldx,
+                                     int*            iter,
+                                     int*            info,
+                                     int*            deviceInfo,
+                                     const int       batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGesvIRStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            const int           nrhs,
+                                            T*                  A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            T*                  B,
+                                            const int           ldb,
+                                            const hipblasStride strideB,
+                                            T*                  X,
+                                            const int           ldx,
+                                            const hipblasStride strideX,
+                                            int*                iter,
+                                            int*                info,
+                                            int*                deviceInfo,
+                                            const int           batchCount);
+
 // dgmm
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasDgmm(hipblasHandle_t   handle,
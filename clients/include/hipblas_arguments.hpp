@@ -153,6 +153,8 @@ struct Arguments
 
     hipblas_initialization initialization = hipblas_initialization::rand_int;
 
+    size_t user_allocated_workspace = 0;
+
     // clang-format off
 
 // Generic macro which operates over the list of arguments in order of declaration
@@ -213,7 +215,8 @@ struct Arguments
     OPER(name) SEP                   \
     OPER(category) SEP               \
     OPER(atomics_mode) SEP           \
-    OPER(initialization)
+    OPER(initialization) SEP         \
+    OPER(user_allocated_workspace)
 
     // clang-format on
 
@@ -0,0 +1,60 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstddef>
+#include <stdexcept>
+
+// Errors of a result against its reference, as reduced by hipblas_check_device
+struct hipblas_device_error
+{
+    double norm_error = 0; // Frobenius norm of the difference over that of the reference, summed
+    double max_abs    = 0; // largest absolute difference of an element
+    double max_rel    = 0; // largest difference relative to the reference element
+};
+
+#ifdef HIPBLAS_DEVICE_CHECK
+// Compares the M x N matrices of res, with leading dimension lda, stride and batch_count, to those
+// of ref on the device, and copies back only the sums and maxima of each batch. Like the host
+// norm_check_general, the relative Frobenius errors of the batches are summed.
+hipblas_device_error hipblas_check_device(hipblasDatatype_t type,
+                                          size_t            M,
+                                          size_t            N,
+                                          size_t            lda,
+                                          hipblasStride     stride,
+                                          const void*       ref,
+                                          const void*       res,
+                                          size_t            batch_count);
+
+constexpr bool hipblas_check_device_enabled = true;
+#else
+inline hipblas_device_error hipblas_check_device(
+    hipblasDatatype_t, size_t, size_t, size_t, hipblasStride, const void*, const void*, size_t)
+{
+    throw std::runtime_error("hipblas_check_device requires HIPBLAS_DEVICE_CHECK");
+}
+
+constexpr bool hipblas_check_device_enabled = false;
+#endif
@@ -1,5 +1,5 @@
 /* ************************************************************************
- * Copyright (C) 2018-2022 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2018-2023 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -24,7 +24,9 @@
 
 #include "hipblas_arguments.hpp"
 #include "test_cleanup.hpp"
+#include <algorithm>
 #include <cerrno>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -32,8 +34,17 @@
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -55,24 +66,203 @@ class HipBLAS_TestData
         return filename;
     }
 
+    // pattern of the functions to load, all of them if empty
+    static auto& function_filter()
+    {
+        static std::string function_filter;
+        return function_filter;
+    }
+
+    // Matches name against a pattern with * and ? wildcards
+    static bool wildcard_match(const char* pattern, const char* name)
+    {
+        if(!*pattern)
+            return !*name;
+        if(*pattern == '*')
+            return wildcard_match(pattern + 1, name)
+                   || (*name && wildcard_match(pattern, name + 1));
+        return *name && (*pattern == '?' || *pattern == *name)
+               && wildcard_match(pattern + 1, name + 1);
+    }
+
+    // Matches name against colon separated positive patterns, optionally followed by '-' and
+    // colon separated negative patterns, as --gtest_filter does
+    static bool filter_match(const std::string& filter, const std::string& name)
+    {
+        auto any_match = [&](const std::string& patterns) {
+            std::istringstream iss(patterns);
+            for(std::string pattern; std::getline(iss, pattern, ':');)
+                if(wildcard_match(pattern.c_str(), name.c_str()))
+                    return true;
+            return false;
+        };
+
+        size_t      dash     = filter.find('-');
+        std::string positive = filter.substr(0, dash);
+        return (positive.empty() || any_match(positive))
+               && (dash == std::string::npos || !any_match(filter.substr(dash + 1)));
+    }
+
+    // The data file, mapped into memory when it is a regular file, and its selected records.
+    // hipblas_gentest.py writes the signature, the records, and an index of the records of each
+    // function, so that a function filter touches only the records of those functions.
+    class data_file
+    {
+        static constexpr size_t signature_size = 8 + sizeof(Arguments) + 8;
+        static constexpr size_t footer_size    = 2 * sizeof(uint64_t) + 8;
+        static constexpr size_t name_size      = sizeof(Arguments::function);
+
+        const char*       data = nullptr;
+        size_t            size = 0;
+        void*             map  = nullptr;
+        std::vector<char> buffer;
+
+    public:
+        // Records in file order
+        std::vector<const char*> records;
+
+        data_file(const std::string& name, const std::string& filter)
+        {
+#ifndef WIN32
+            int         fd = open(name.c_str(), O_RDONLY);
+            struct stat st;
+            if(fd >= 0 && !fstat(fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0)
+            {
+                map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if(map == MAP_FAILED)
+                    map = nullptr;
+                else
+                {
+                    data = static_cast<const char*>(map);
+                    size = st.st_size;
+                }
+            }
+            if(fd >= 0)
+                close(fd);
+#endif
+            // Pipes such as /dev/stdin cannot be mapped and are read instead
+            if(!map)
+            {
+                std::ifstream ifs(name, std::ifstream::in | std::ifstream::binary);
+                if(ifs.fail())
+                {
+                    std::cerr << "Cannot open " << name << ": " << strerror(errno) << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                buffer.assign(std::istreambuf_iterator<char>(ifs),
+                              std::istreambuf_iterator<char>());
+                data = buffer.data();
+                size = buffer.size();
+            }
+
+            // Validate the data file format
+            std::istringstream signature(std::string(data, std::min(size, signature_size)));
+            Arguments::validate(signature);
+
+            // The footer holds the offset of the index and the number of records
+            uint64_t index = 0, count = (size - signature_size) / sizeof(Arguments);
+            if(size >= signature_size + footer_size && !memcmp(data + size - 8, "HIPindex", 8))
+            {
+                uint64_t footer[2];
+                memcpy(footer, data + size - footer_size, sizeof(footer));
+                if(footer[0] == signature_size + footer[1] * sizeof(Arguments)
+                   && footer[0] <= size - footer_size)
+                {
+                    index = footer[0];
+                    count = footer[1];
+                }
+            }
+
+            const char* first = data + signature_size;
+            if(filter.empty())
+            {
+                for(uint64_t i = 0; i < count; ++i)
+                    records.push_back(first + i * sizeof(Arguments));
+            }
+            else if(index)
+            {
+                // Each index entry is the function name, the number of its records and their
+                // positions in the file
+                std::vector<uint64_t> selected;
+                for(size_t ofs = index; ofs + name_size + sizeof(uint64_t) <= size - footer_size;)
+                {
+                    uint64_t n;
+                    memcpy(&n, data + ofs + name_size, sizeof(n));
+                    size_t ids = ofs + name_size + sizeof(n);
+                    if(n > (size - footer_size - ids) / sizeof(uint64_t))
+                        break;
+
+                    std::string function(data + ofs, strnlen(data + ofs, name_size));
+                    if(filter_match(filter, function))
+                    {
+                        size_t old = selected.size();
+                        selected.resize(old + n);
+                        memcpy(selected.data() + old, data + ids, n * sizeof(uint64_t));
+                    }
+                    ofs = ids + n * sizeof(uint64_t);
+                }
+                std::sort(selected.begin(), selected.end());
+                for(uint64_t i : selected)
+                    if(i < count)
+                        records.push_back(first + i * sizeof(Arguments));
+            }
+            else
+            {
+                // Without an index, every record is read for its function name
+                Arguments arg;
+                for(uint64_t i = 0; i < count; ++i)
+                {
+                    memcpy(&arg, first + i * sizeof(Arguments), sizeof(Arguments));
+                    std::string function(arg.function, strnlen(arg.function, name_size));
+                    if(filter_match(filter, function))
+                        records.push_back(first + i * sizeof(Arguments));
+                }
+            }
+        }
+
+        ~data_file()
+        {
+#ifndef WIN32
+            if(map)
+                munmap(map, size);
+#endif
+        }
+
+        data_file(const data_file&) = delete;
+        data_file& operator=(const data_file&) = delete;
+    };
+
     // filter iterator
-    class iterator : public std::istream_iterator<Arguments>
+    class iterator
     {
-        bool (*const filter)(const Arguments&) = nullptr;
+        using record_iterator = std::vector<const char*>::const_iterator;
+
+        record_iterator it{}, last{};
+        bool (*filter)(const Arguments&) = nullptr;
+        Arguments arg{};
 
-        // Skip entries for which filter is false
+        // Copy the current record, skipping entries for which filter is false
         void skip_filter()
         {
-            static auto endIter = std::istream_iterator<Arguments>{};
-            if(filter)
-                while(*this != endIter && !filter(**this))
-                    ++*static_cast<std::istream_iterator<Arguments>*>(this);
+            for(; it != last; ++it)
+            {
+                memcpy(&arg, *it, sizeof(arg));
+                if(!filter || filter(arg))
+                    break;
+            }
         }
 
     public:
-        // Constructor takes a filter and iterator
-        iterator(bool filter(const Arguments&), std::istream_iterator<Arguments> iter)
-            : std::istream_iterator<Arguments>(iter)
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = Arguments;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Arguments*;
+        using reference         = const Arguments&;
+
+        // Constructor takes a filter and the range of records
+        iterator(bool filter(const Arguments&), record_iterator first, record_iterator last)
+            : it(first)
+            , last(last)
             , filter(filter)
         {
             skip_filter();
@@ -81,18 +271,39 @@ class HipBLAS_TestData
         // Default end iterator and nullptr filter
         iterator() = default;
 
+        const Arguments& operator*() const
+        {
+            return arg;
+        }
+
+        const Arguments* operator->() const
+        {
+            return &arg;
+        }
+
         // Preincrement iterator operator with filtering
         iterator& operator++()
         {
-            ++*static_cast<std::istream_iterator<Arguments>*>(this);
+            ++it;
             skip_filter();
             return *this;
         }
 
         // We do not need a postincrement iterator operator
-        // We delete it here so that the base class's isn't silently called
         // To implement it, use "auto old = *this; ++*this; return old;"
         iterator operator++(int) = delete;
+
+        // All iterators past the last record compare equal to end()
+        bool operator==(const iterator& rhs) const
+        {
+            bool at_end = it == last, rhs_at_end = rhs.it == rhs.last;
+            return at_end || rhs_at_end ? at_end == rhs_at_end : it == rhs.it;
+        }
+
+        bool operator!=(const iterator& rhs) const
+        {
+            return !(*this == rhs);
+        }
     };
 
 public:
@@ -108,38 +319,31 @@ public:
         }
     }
 
+    // Load only the records of the functions matching a --gtest_filter style pattern
+    static void set_function_filter(std::string filter)
+    {
+        function_filter() = std::move(filter);
+    }
+
     // begin() iterator which accepts an optional filter.
     static iterator begin(bool filter(const Arguments&) = nullptr)
     {
-        static std::ifstream* ifs = nullptr;
+        static data_file* file = nullptr;
 
         // If this is the first time, or after test_cleanup::cleanup() has been called
-        if(!ifs)
+        if(!file)
         {
             std::string fileToOpen = filename();
             if(fileToOpen.empty())
                 return end();
 
-            // Allocate a std::ifstream and register it to be deleted during cleanup
-            ifs = test_cleanup::allocate(
-                &ifs, fileToOpen, std::ifstream::in | std::ifstream::binary);
-            if(!ifs || ifs->fail())
-            {
-                std::cerr << "Cannot open " << fileToOpen << ": " << strerror(errno) << std::endl;
-                exit(EXIT_FAILURE);
-            }
+            // Map the data file and register it to be unmapped during cleanup
+            file = test_cleanup::allocate(&file, fileToOpen, function_filter());
         }
 
-        // We re-seek the file back to position 0
-        ifs->clear();
-        ifs->seekg(0);
-
-        // Validate the data file format
-        Arguments::validate(*ifs);
-
         // We create a filter iterator which will choose only the test cases we want right now.
         // This is to preserve Gtest structure while not creating no-op tests which "always pass".
-        return iterator(filter, std::istream_iterator<Arguments>(*ifs));
+        return iterator(filter, file->records.cbegin(), file->records.cend());
     }
 
     // end() iterator
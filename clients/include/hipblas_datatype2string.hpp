@@ -171,6 +171,8 @@ inline constexpr auto hipblas_computetype2string(hipblasComputeType_t type)
         return "32i";
     case HIPBLAS_COMPUTE_32I_PEDANTIC:
         return "32i_pedantic";
+    case HIPBLAS_COMPUTE_32F_FAST_16BFX3:
+        return "32f_fast_16bfx3";
     default:
         return "invalid";
     }
@@ -7362,6 +7362,445 @@ hipblasStatus_t hipblasZgelsStridedBatchedFortran(hipblasHandle_t       handle,
                                                   int*                  info,
                                                   int*                  deviceInfo,
                                                   const int             batchCount);
+
+// gesvBatched
+hipblasStatus_t hipblasSgesvBatchedFortran(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       nrhs,
+                                           float* const    A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           float* const    B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           const int       batchCount);
+
+hipblasStatus_t hipblasDgesvBatchedFortran(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       nrhs,
+                                           double* const   A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           double* const   B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           const int       batchCount);
+
+hipblasStatus_t hipblasCgesvBatchedFortran(hipblasHandle_t       handle,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasComplex* const A[],
+                                           const int             lda,
+                                           int*                  ipiv,
+                                           hipblasComplex* const B[],
+                                           const int             ldb,
+                                           int*                  info,
+                                           const int             batchCount);
+
+hipblasStatus_t hipblasZgesvBatchedFortran(hipblasHandle_t             handle,
+                                           const int                   n,
+                                           const int                   nrhs,
+                                           hipblasDoubleComplex* const A[],
+                                           const int                   lda,
+                                           int*                        ipiv,
+                                           hipblasDoubleComplex* const B[],
+                                           const int                   ldb,
+                                           int*                        info,
+                                           const int                   batchCount);
+
+// gesvStridedBatched
+hipblasStatus_t hipblasSgesvStridedBatchedFortran(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  float*              A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  float*              B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount);
+
+hipblasStatus_t hipblasDgesvStridedBatchedFortran(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  double*             A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  double*             B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount);
+
+hipblasStatus_t hipblasCgesvStridedBatchedFortran(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  hipblasComplex*     A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  hipblasComplex*     B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount);
+
+hipblasStatus_t hipblasZgesvStridedBatchedFortran(hipblasHandle_t       handle,
+                                                  const int             n,
+                                                  const int             nrhs,
+                                                  hipblasDoubleComplex* A,
+                                                  const int             lda,
+                                                  const hipblasStride   strideA,
+                                                  int*                  ipiv,
+                                                  const hipblasStride   strideP,
+                                                  hipblasDoubleComplex* B,
+                                                  const int             ldb,
+                                                  const hipblasStride   strideB,
+                                                  int*                  info,
+                                                  const int             batchCount);
+
+// potrf
+hipblasStatus_t hipblasSpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float*                  A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     int*                    info);
+
+// potrfBatched
+hipblasStatus_t hipblasSpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float* const            A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasDpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasCpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            int*                        info,
+                                            const int                   batchCount);
+
+// potrfStridedBatched
+hipblasStatus_t hipblasSpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasDpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasCpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+// potrs
+hipblasStatus_t hipblasSpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     float*                  A,
+                                     const int               lda,
+                                     float*                  B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double*                 A,
+                                     const int               lda,
+                                     double*                 B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     hipblasComplex*         B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     hipblasDoubleComplex*   B,
+                                     const int               ldb,
+                                     int*                    info);
+
+// potrsBatched
+hipblasStatus_t hipblasSpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            float* const            A[],
+                                            const int               lda,
+                                            float* const            B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasDpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double* const           A[],
+                                            const int               lda,
+                                            double* const           B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasCpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            hipblasComplex* const   B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            const int                   nrhs,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            hipblasDoubleComplex* const B[],
+                                            const int                   ldb,
+                                            int*                        info,
+                                            const int                   batchCount);
+
+// potrsStridedBatched
+hipblasStatus_t hipblasSpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   float*                  B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasDpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   double*                 B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasCpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   hipblasComplex*         B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   hipblasDoubleComplex*   B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+// potri
+hipblasStatus_t hipblasSpotriFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float*                  A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDpotriFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCpotriFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZpotriFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     int*                    info);
+
+// potriBatched
+hipblasStatus_t hipblasSpotriBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float* const            A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasDpotriBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasCpotriBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasZpotriBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            int*                        info,
+                                            const int                   batchCount);
+
+// potriStridedBatched
+hipblasStatus_t hipblasSpotriStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasDpotriStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasCpotriStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasZpotriStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
 }
 
 #endif
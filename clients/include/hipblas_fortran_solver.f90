@@ -1121,3 +1121,890 @@ function hipblasZgelsStridedBatchedFortran(handle, trans, m, n, nrhs, A, &
         hipblasZgelsStridedBatched(handle, trans, m, n, nrhs, A, lda, strideA, &
     B, ldb, strideB, info, deviceInfo, batchCount)
 end function hipblasZgelsStridedBatchedFortran
+
+! gesvBatched
+function hipblasSgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, &
+    B, ldb, info, batchCount) &
+        bind(c, name = 'hipblasSgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSgesvBatchedFortran = &
+        hipblasSgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount)
+end function hipblasSgesvBatchedFortran
+
+function hipblasDgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, &
+    B, ldb, info, batchCount) &
+        bind(c, name = 'hipblasDgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDgesvBatchedFortran = &
+        hipblasDgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount)
+end function hipblasDgesvBatchedFortran
+
+function hipblasCgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, &
+    B, ldb, info, batchCount) &
+        bind(c, name = 'hipblasCgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCgesvBatchedFortran = &
+        hipblasCgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount)
+end function hipblasCgesvBatchedFortran
+
+function hipblasZgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, &
+    B, ldb, info, batchCount) &
+        bind(c, name = 'hipblasZgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZgesvBatchedFortran = &
+        hipblasZgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount)
+end function hipblasZgesvBatchedFortran
+
+! gesvStridedBatched
+function hipblasSgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, &
+    ipiv, strideP, B, ldb, strideB, info, batchCount) &
+        bind(c, name = 'hipblasSgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSgesvStridedBatchedFortran = &
+        hipblasSgesvStridedBatched(handle, n, nrhs, A, lda, strideA, &
+    ipiv, strideP, B, ldb, strideB, info, batchCount)
+end function hipblasSgesvStridedBatchedFortran
+
+function hipblasDgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, &
+    ipiv, strideP, B, ldb, strideB, info, batchCount) &
+        bind(c, name = 'hipblasDgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDgesvStridedBatchedFortran = &
+        hipblasDgesvStridedBatched(handle, n, nrhs, A, lda, strideA, &
+    ipiv, strideP, B, ldb, strideB, info, batchCount)
+end function hipblasDgesvStridedBatchedFortran
+
+function hipblasCgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, &
+    ipiv, strideP, B, ldb, strideB, info, batchCount) &
+        bind(c, name = 'hipblasCgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCgesvStridedBatchedFortran = &
+        hipblasCgesvStridedBatched(handle, n, nrhs, A, lda, strideA, &
+    ipiv, strideP, B, ldb, strideB, info, batchCount)
+end function hipblasCgesvStridedBatchedFortran
+
+function hipblasZgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, &
+    ipiv, strideP, B, ldb, strideB, info, batchCount) &
+        bind(c, name = 'hipblasZgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZgesvStridedBatchedFortran = &
+        hipblasZgesvStridedBatched(handle, n, nrhs, A, lda, strideA, &
+    ipiv, strideP, B, ldb, strideB, info, batchCount)
+end function hipblasZgesvStridedBatchedFortran
+
+! potrf
+function hipblasSpotrfFortran(handle, uplo, n, A, lda, info) &
+        bind(c, name = 'hipblasSpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasSpotrfFortran = &
+        hipblasSpotrf(handle, uplo, n, A, lda, info)
+end function hipblasSpotrfFortran
+
+function hipblasDpotrfFortran(handle, uplo, n, A, lda, info) &
+        bind(c, name = 'hipblasDpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasDpotrfFortran = &
+        hipblasDpotrf(handle, uplo, n, A, lda, info)
+end function hipblasDpotrfFortran
+
+function hipblasCpotrfFortran(handle, uplo, n, A, lda, info) &
+        bind(c, name = 'hipblasCpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasCpotrfFortran = &
+        hipblasCpotrf(handle, uplo, n, A, lda, info)
+end function hipblasCpotrfFortran
+
+function hipblasZpotrfFortran(handle, uplo, n, A, lda, info) &
+        bind(c, name = 'hipblasZpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasZpotrfFortran = &
+        hipblasZpotrf(handle, uplo, n, A, lda, info)
+end function hipblasZpotrfFortran
+
+! potrfBatched
+function hipblasSpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+        bind(c, name = 'hipblasSpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrfBatchedFortran = &
+        hipblasSpotrfBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasSpotrfBatchedFortran
+
+function hipblasDpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+        bind(c, name = 'hipblasDpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrfBatchedFortran = &
+        hipblasDpotrfBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasDpotrfBatchedFortran
+
+function hipblasCpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+        bind(c, name = 'hipblasCpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrfBatchedFortran = &
+        hipblasCpotrfBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasCpotrfBatchedFortran
+
+function hipblasZpotrfBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+        bind(c, name = 'hipblasZpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrfBatchedFortran = &
+        hipblasZpotrfBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasZpotrfBatchedFortran
+
+! potrfStridedBatched
+function hipblasSpotrfStridedBatchedFortran(handle, uplo, n, A, &
+    lda, strideA, info, batchCount) &
+        bind(c, name = 'hipblasSpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrfStridedBatchedFortran = &
+        hipblasSpotrfStridedBatched(handle, uplo, n, A, &
+    lda, strideA, info, batchCount)
+end function hipblasSpotrfStridedBatchedFortran
+
+function hipblasDpotrfStridedBatchedFortran(handle, uplo, n, A, &
+    lda, strideA, info, batchCount) &
+        bind(c, name = 'hipblasDpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrfStridedBatchedFortran = &
+        hipblasDpotrfStridedBatched(handle, uplo, n, A, &
+    lda, strideA, info, batchCount)
+end function hipblasDpotrfStridedBatchedFortran
+
+function hipblasCpotrfStridedBatchedFortran(handle, uplo, n, A, &
+    lda, strideA, info, batchCount) &
+        bind(c, name = 'hipblasCpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrfStridedBatchedFortran = &
+        hipblasCpotrfStridedBatched(handle, uplo, n, A, &
+    lda, strideA, info, batchCount)
+end function hipblasCpotrfStridedBatchedFortran
+
+function hipblasZpotrfStridedBatchedFortran(handle, uplo, n, A, &
+    lda, strideA, info, batchCount) &
+        bind(c, name = 'hipblasZpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrfStridedBatchedFortran = &
+        hipblasZpotrfStridedBatched(handle, uplo, n, A, &
+    lda, strideA, info, batchCount)
+end function hipblasZpotrfStridedBatchedFortran
+
+! potrs
+function hipblasSpotrsFortran(handle, uplo, n, nrhs, &
+    A, lda, B, ldb, info) &
+        bind(c, name = 'hipblasSpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasSpotrsFortran = &
+        hipblasSpotrs(handle, uplo, n, nrhs, &
+    A, lda, B, ldb, info)
+end function hipblasSpotrsFortran
+
+function hipblasDpotrsFortran(handle, uplo, n, nrhs, &
+    A, lda, B, ldb, info) &
+        bind(c, name = 'hipblasDpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasDpotrsFortran = &
+        hipblasDpotrs(handle, uplo, n, nrhs, &
+    A, lda, B, ldb, info)
+end function hipblasDpotrsFortran
+
+function hipblasCpotrsFortran(handle, uplo, n, nrhs, &
+    A, lda, B, ldb, info) &
+        bind(c, name = 'hipblasCpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasCpotrsFortran = &
+        hipblasCpotrs(handle, uplo, n, nrhs, &
+    A, lda, B, ldb, info)
+end function hipblasCpotrsFortran
+
+function hipblasZpotrsFortran(handle, uplo, n, nrhs, &
+    A, lda, B, ldb, info) &
+        bind(c, name = 'hipblasZpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasZpotrsFortran = &
+        hipblasZpotrs(handle, uplo, n, nrhs, &
+    A, lda, B, ldb, info)
+end function hipblasZpotrsFortran
+
+! potrsBatched
+function hipblasSpotrsBatchedFortran(handle, uplo, n, nrhs, A, &
+    lda, B, ldb, info, batchCount) &
+        bind(c, name = 'hipblasSpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrsBatchedFortran = &
+        hipblasSpotrsBatched(handle, uplo, n, nrhs, A, &
+    lda, B, ldb, info, batchCount)
+end function hipblasSpotrsBatchedFortran
+
+function hipblasDpotrsBatchedFortran(handle, uplo, n, nrhs, A, &
+    lda, B, ldb, info, batchCount) &
+        bind(c, name = 'hipblasDpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrsBatchedFortran = &
+        hipblasDpotrsBatched(handle, uplo, n, nrhs, A, &
+    lda, B, ldb, info, batchCount)
+end function hipblasDpotrsBatchedFortran
+
+function hipblasCpotrsBatchedFortran(handle, uplo, n, nrhs, A, &
+    lda, B, ldb, info, batchCount) &
+        bind(c, name = 'hipblasCpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrsBatchedFortran = &
+        hipblasCpotrsBatched(handle, uplo, n, nrhs, A, &
+    lda, B, ldb, info, batchCount)
+end function hipblasCpotrsBatchedFortran
+
+function hipblasZpotrsBatchedFortran(handle, uplo, n, nrhs, A, &
+    lda, B, ldb, info, batchCount) &
+        bind(c, name = 'hipblasZpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrsBatchedFortran = &
+        hipblasZpotrsBatched(handle, uplo, n, nrhs, A, &
+    lda, B, ldb, info, batchCount)
+end function hipblasZpotrsBatchedFortran
+
+! potrsStridedBatched
+function hipblasSpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+    strideA, B, ldb, strideB, info, batchCount) &
+        bind(c, name = 'hipblasSpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrsStridedBatchedFortran = &
+        hipblasSpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+    strideA, B, ldb, strideB, info, batchCount)
+end function hipblasSpotrsStridedBatchedFortran
+
+function hipblasDpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+    strideA, B, ldb, strideB, info, batchCount) &
+        bind(c, name = 'hipblasDpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrsStridedBatchedFortran = &
+        hipblasDpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+    strideA, B, ldb, strideB, info, batchCount)
+end function hipblasDpotrsStridedBatchedFortran
+
+function hipblasCpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+    strideA, B, ldb, strideB, info, batchCount) &
+        bind(c, name = 'hipblasCpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrsStridedBatchedFortran = &
+        hipblasCpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+    strideA, B, ldb, strideB, info, batchCount)
+end function hipblasCpotrsStridedBatchedFortran
+
+function hipblasZpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+    strideA, B, ldb, strideB, info, batchCount) &
+        bind(c, name = 'hipblasZpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrsStridedBatchedFortran = &
+        hipblasZpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+    strideA, B, ldb, strideB, info, batchCount)
+end function hipblasZpotrsStridedBatchedFortran
+
+! potri
+function hipblasSpotriFortran(handle, uplo, n, A, lda, info) &
+        bind(c, name = 'hipblasSpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasSpotriFortran = &
+        hipblasSpotri(handle, uplo, n, A, lda, info)
+end function hipblasSpotriFortran
+
+function hipblasDpotriFortran(handle, uplo, n, A, lda, info) &
+        bind(c, name = 'hipblasDpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasDpotriFortran = &
+        hipblasDpotri(handle, uplo, n, A, lda, info)
+end function hipblasDpotriFortran
+
+function hipblasCpotriFortran(handle, uplo, n, A, lda, info) &
+        bind(c, name = 'hipblasCpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasCpotriFortran = &
+        hipblasCpotri(handle, uplo, n, A, lda, info)
+end function hipblasCpotriFortran
+
+function hipblasZpotriFortran(handle, uplo, n, A, lda, info) &
+        bind(c, name = 'hipblasZpotriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasZpotriFortran = &
+        hipblasZpotri(handle, uplo, n, A, lda, info)
+end function hipblasZpotriFortran
+
+! potriBatched
+function hipblasSpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+        bind(c, name = 'hipblasSpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotriBatchedFortran = &
+        hipblasSpotriBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasSpotriBatchedFortran
+
+function hipblasDpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+        bind(c, name = 'hipblasDpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotriBatchedFortran = &
+        hipblasDpotriBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasDpotriBatchedFortran
+
+function hipblasCpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+        bind(c, name = 'hipblasCpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotriBatchedFortran = &
+        hipblasCpotriBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasCpotriBatchedFortran
+
+function hipblasZpotriBatchedFortran(handle, uplo, n, A, lda, info, batchCount) &
+        bind(c, name = 'hipblasZpotriBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotriBatchedFortran = &
+        hipblasZpotriBatched(handle, uplo, n, A, lda, info, batchCount)
+end function hipblasZpotriBatchedFortran
+
+! potriStridedBatched
+function hipblasSpotriStridedBatchedFortran(handle, uplo, n, A, &
+    lda, strideA, info, batchCount) &
+        bind(c, name = 'hipblasSpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotriStridedBatchedFortran = &
+        hipblasSpotriStridedBatched(handle, uplo, n, A, &
+    lda, strideA, info, batchCount)
+end function hipblasSpotriStridedBatchedFortran
+
+function hipblasDpotriStridedBatchedFortran(handle, uplo, n, A, &
+    lda, strideA, info, batchCount) &
+        bind(c, name = 'hipblasDpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotriStridedBatchedFortran = &
+        hipblasDpotriStridedBatched(handle, uplo, n, A, &
+    lda, strideA, info, batchCount)
+end function hipblasDpotriStridedBatchedFortran
+
+function hipblasCpotriStridedBatchedFortran(handle, uplo, n, A, &
+    lda, strideA, info, batchCount) &
+        bind(c, name = 'hipblasCpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotriStridedBatchedFortran = &
+        hipblasCpotriStridedBatched(handle, uplo, n, A, &
+    lda, strideA, info, batchCount)
+end function hipblasCpotriStridedBatchedFortran
+
+function hipblasZpotriStridedBatchedFortran(handle, uplo, n, A, &
+    lda, strideA, info, batchCount) &
+        bind(c, name = 'hipblasZpotriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotriStridedBatchedFortran = &
+        hipblasZpotriStridedBatched(handle, uplo, n, A, &
+    lda, strideA, info, batchCount)
+end function hipblasZpotriStridedBatchedFortran
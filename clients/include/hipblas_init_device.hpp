@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "hipblas_datatype2string.hpp"
+#include <cstdint>
+#include <stdexcept>
+
+// Element type of the device initialization, HIPBLAS_DATATYPE_INVALID if it has none
+template <typename T>
+constexpr hipblasDatatype_t hipblas_init_device_type = HIPBLAS_DATATYPE_INVALID;
+template <>
+constexpr hipblasDatatype_t hipblas_init_device_type<hipblasHalf> = HIPBLAS_R_16F;
+template <>
+constexpr hipblasDatatype_t hipblas_init_device_type<hipblasBfloat16> = HIPBLAS_R_16B;
+template <>
+constexpr hipblasDatatype_t hipblas_init_device_type<float> = HIPBLAS_R_32F;
+template <>
+constexpr hipblasDatatype_t hipblas_init_device_type<double> = HIPBLAS_R_64F;
+template <>
+constexpr hipblasDatatype_t hipblas_init_device_type<hipblasComplex> = HIPBLAS_C_32F;
+template <>
+constexpr hipblasDatatype_t hipblas_init_device_type<hipblasDoubleComplex> = HIPBLAS_C_64F;
+template <>
+constexpr hipblasDatatype_t hipblas_init_device_type<int8_t> = HIPBLAS_R_8I;
+template <>
+constexpr hipblasDatatype_t hipblas_init_device_type<int32_t> = HIPBLAS_R_32I;
+
+#ifdef HIPBLAS_DEVICE_INIT
+// Fills the M x N matrices of A, with leading dimension lda, stride and batch_count, on the device
+// with the distribution of init: integers in [1, 10] ([1, 3] for 16-bit types) for rand_int,
+// [-0.5, 0.5] for hpl, and the sin of the offset, or its cos with use_cos, for trig_float.
+// Adjacent elements alternate in sign with alternating_sign, and all are NaN with nan. The random
+// values are a hash of seed and the offset, so they are repeatable but not those of the host.
+// diagonal and off_diagonal are then added to the elements with i == j and i != j.
+void hipblas_init_device(void*                  A,
+                         hipblasDatatype_t      type,
+                         hipblas_initialization init,
+                         size_t                 M,
+                         size_t                 N,
+                         size_t                 lda,
+                         hipblasStride          stride,
+                         size_t                 batch_count,
+                         uint32_t               seed,
+                         bool                   use_cos,
+                         bool                   alternating_sign,
+                         bool                   nan,
+                         double                 diagonal     = 0,
+                         double                 off_diagonal = 0);
+
+constexpr bool hipblas_init_device_enabled = true;
+#else
+inline void hipblas_init_device(void*,
+                                hipblasDatatype_t,
+                                hipblas_initialization,
+                                size_t,
+                                size_t,
+                                size_t,
+                                hipblasStride,
+                                size_t,
+                                uint32_t,
+                                bool,
+                                bool,
+                                bool,
+                                double = 0,
+                                double = 0)
+{
+    throw std::runtime_error("hipblas_init_device requires HIPBLAS_DEVICE_INIT");
+}
+
+constexpr bool hipblas_init_device_enabled = false;
+#endif
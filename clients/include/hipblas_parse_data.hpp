@@ -26,7 +26,7 @@
 
 #include <string>
 
-// Parse --data and --yaml command-line arguments
+// Parse --data, --yaml and --data_filter command-line arguments
 bool hipblas_parse_data(int& argc, char** argv, const std::string& default_file = "");
 
 #endif
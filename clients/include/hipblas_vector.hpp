@@ -27,11 +27,13 @@
 #include "d_vector.hpp"
 #include "device_batch_vector.hpp"
 #include "hipblas.h"
+#include "hipblas_init_device.hpp"
 #include "host_batch_vector.hpp"
 #include "utility.h"
 #include <cinttypes>
 #include <cstdio>
 #include <locale.h>
+#include <new>
 #include <vector>
 
 //!
@@ -93,20 +95,65 @@ private:
     T* data;
 };
 
+//!
+//! @brief  Allocator of host_vector, pinned if hipblas_host_memory_pinned() when it is created.
+//!
+template <typename T>
+struct hipblas_host_allocator
+{
+    using value_type                             = T;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    bool pinned = hipblas_host_memory_pinned();
+
+    hipblas_host_allocator() = default;
+
+    template <typename U>
+    hipblas_host_allocator(const hipblas_host_allocator<U>& that)
+        : pinned(that.pinned)
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        T* ptr = (T*)hipblas_host_malloc(n * sizeof(T), pinned);
+        if(!ptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+
+    void deallocate(T* ptr, size_t)
+    {
+        hipblas_host_free(ptr, pinned);
+    }
+
+    template <typename U>
+    bool operator==(const hipblas_host_allocator<U>& that) const
+    {
+        return pinned == that.pinned;
+    }
+
+    template <typename U>
+    bool operator!=(const hipblas_host_allocator<U>& that) const
+    {
+        return pinned != that.pinned;
+    }
+};
+
 //!
 //! @brief  Pseudo-vector subclass which uses host memory.
 //!
 template <typename T>
-struct host_vector : std::vector<T>
+struct host_vector : std::vector<T, hipblas_host_allocator<T>>
 {
     // Inherit constructors
-    using std::vector<T>::vector;
+    using std::vector<T, hipblas_host_allocator<T>>::vector;
 
     //!
     //! @brief Constructor.
     //!
     host_vector(size_t n, ptrdiff_t inc)
-        : std::vector<T>(n * std::abs(inc))
+        : std::vector<T, hipblas_host_allocator<T>>(n * std::abs(inc))
         , m_n(n)
         , m_inc(inc)
     {
@@ -117,7 +164,7 @@ struct host_vector : std::vector<T>
     //!
     template <typename U, std::enable_if_t<std::is_convertible<U, T>{}, int> = 0>
     host_vector(const host_vector<U>& x)
-        : std::vector<T>(x.size())
+        : std::vector<T, hipblas_host_allocator<T>>(x.size())
         , m_n(x.size())
         , m_inc(1)
     {
@@ -204,6 +251,60 @@ private:
     ptrdiff_t m_inc = 0;
 };
 
+//!
+//! @brief Whether a test initializes its data on the host and copies it to the device. Only the
+//!        tests that verify results need host data when the client has device initialization.
+//! @param arg Specifies the argument class.
+//!
+inline bool hipblas_host_init(const Arguments& arg)
+{
+    return arg.unit_check || arg.norm_check || !hipblas_init_device_enabled;
+}
+
+//!
+//! @brief Initialize a device matrix on the device, with the distributions of the host matrix.
+//! @param dA The device matrix.
+//! @param arg Specifies the argument class.
+//! @param M Length of the device matrix.
+//! @param N Length of the device matrix.
+//! @param lda Leading dimension of the device matrix.
+//! @param stride_A Incement between the device matrix.
+//! @param batch_count number of instances in the batch.
+//! @param nan_init Initialize matrix with Nan's depending upon the hipblas_check_nan_init enum value.
+//! @param seedReset reset the seed if true, do not reset the seed otherwise. Use init_cos if seedReset is true else use init_sin.
+//! @param alternating_sign Initialize matrix so adjacent entries have alternating sign.
+//!
+template <typename T>
+inline void hipblas_init_matrix(device_vector<T>&      dA,
+                                const Arguments&       arg,
+                                size_t                 M,
+                                size_t                 N,
+                                size_t                 lda,
+                                hipblasStride          stride_A,
+                                int                    batch_count,
+                                hipblas_check_nan_init nan_init,
+                                bool                   seedReset        = false,
+                                bool                   alternating_sign = false)
+{
+    if(seedReset)
+        hipblas_seedrand();
+
+    bool nan = (nan_init == hipblas_client_alpha_sets_nan && hipblas_isnan(arg.alpha))
+               || (nan_init == hipblas_client_beta_sets_nan && hipblas_isnan(arg.beta));
+    hipblas_init_device(dA,
+                        hipblas_init_device_type<T>,
+                        arg.initialization,
+                        M,
+                        N,
+                        lda,
+                        stride_A,
+                        batch_count,
+                        hipblas_rng(),
+                        seedReset,
+                        alternating_sign,
+                        nan);
+}
+
 //!
 //! @brief Template for initializing a host (non_batched|batched|strided_batched)vector.
 //! @param that That vector.
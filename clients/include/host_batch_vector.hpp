@@ -217,6 +217,7 @@ private:
     int m_inc{};
     int m_batch_count{};
     T** m_data{};
+    bool m_pinned = hipblas_host_memory_pinned();
 
     bool try_initialize_memory()
     {
@@ -226,11 +227,14 @@ private:
             size_t nmemb = size_t(this->m_n) * std::abs(this->m_inc);
             for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
             {
-                success = (nullptr != (this->m_data[batch_index] = (T*)calloc(nmemb, sizeof(T))));
+                success = (nullptr
+                           != (this->m_data[batch_index]
+                               = (T*)hipblas_host_malloc(nmemb * sizeof(T), this->m_pinned)));
                 if(false == success)
                 {
                     break;
                 }
+                memset(this->m_data[batch_index], 0, nmemb * sizeof(T));
             }
         }
         return success;
@@ -244,7 +248,7 @@ private:
             {
                 if(nullptr != this->m_data[batch_index])
                 {
-                    free(this->m_data[batch_index]);
+                    hipblas_host_free(this->m_data[batch_index], this->m_pinned);
                     this->m_data[batch_index] = nullptr;
                 }
             }
@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef _NATIVE_BLAS_HPP_
+#define _NATIVE_BLAS_HPP_
+
+#include "hipblas.h"
+
+#include <cstdint>
+
+// Native columns of the host_overhead function of hipblas-bench --compare_native
+void hipblas_set_compare_native(bool compare);
+bool hipblas_get_compare_native();
+
+// The rocBLAS or cuBLAS routines of float or double under the hipBLAS routines timed by
+// host_overhead, called directly on the backend handle of a hipBLAS handle, which is the handle
+// itself, so they run on its stream and in its pointer mode. The library already loaded by
+// hipBLAS is opened again with dlopen, so the clients do not link it. The enums are the values of
+// the backend, and the calls return its status, 0 for success.
+template <typename T>
+struct hipblasNativeBlas
+{
+    int op_n;
+    int fill_lower;
+    int diag_unit;
+    int side_left;
+
+    int (*axpy)(hipblasHandle_t, int, const T*, const T*, int, T*, int);
+    int (*dot)(hipblasHandle_t, int, const T*, int, const T*, int, T*);
+    int (*nrm2)(hipblasHandle_t, int, const T*, int, T*);
+    int (*scal)(hipblasHandle_t, int, const T*, T*, int);
+    int (*gemv)(hipblasHandle_t,
+                int,
+                int,
+                int,
+                const T*,
+                const T*,
+                int,
+                const T*,
+                int,
+                const T*,
+                T*,
+                int);
+    int (*ger)(hipblasHandle_t, int, int, const T*, const T*, int, const T*, int, T*, int);
+    int (*trsv)(hipblasHandle_t, int, int, int, int, const T*, int, T*, int);
+    int (*gemm)(hipblasHandle_t,
+                int,
+                int,
+                int,
+                int,
+                int,
+                const T*,
+                const T*,
+                int,
+                const T*,
+                int,
+                const T*,
+                T*,
+                int);
+    int (*gemm_strided_batched)(hipblasHandle_t,
+                                int,
+                                int,
+                                int,
+                                int,
+                                int,
+                                const T*,
+                                const T*,
+                                int,
+                                int64_t,
+                                const T*,
+                                int,
+                                int64_t,
+                                const T*,
+                                T*,
+                                int,
+                                int64_t,
+                                int);
+    int (*trsm)(hipblasHandle_t, int, int, int, int, int, int, const T*, const T*, int, T*, int);
+
+    // Non-transposed gemm_ex of T with the compute type of T and the default algorithm, whose
+    // arguments differ between the backends
+    int (*gemm_ex)(hipblasHandle_t,
+                   int,
+                   int,
+                   int,
+                   const T*,
+                   const T*,
+                   int,
+                   const T*,
+                   int,
+                   const T*,
+                   T*,
+                   int);
+};
+
+// The routines of T, nullptr if the backend library or one of them cannot be loaded
+template <typename T>
+const hipblasNativeBlas<T>* hipblas_native_blas();
+
+#endif
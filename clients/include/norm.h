@@ -26,6 +26,7 @@
 #define _NORM_H
 
 #include "hipblas.h"
+#include "hipblas_check_device.hpp"
 #include "hipblas_vector.hpp"
 
 /* =====================================================================
@@ -124,6 +125,37 @@ double norm_check_general(
     return cumulative_error;
 }
 
+/* ============== Norm Check of a result on the device ============= */
+// Compares the result dGPU on the device to the reference hCPU on the host. When the client has
+// the device check kernels, a Frobenius norm check copies the reference to the device and reduces
+// there, otherwise the result is copied to the host and checked as above.
+template <typename T>
+double norm_check_general_device(char          norm_type,
+                                 int           M,
+                                 int           N,
+                                 int           lda,
+                                 hipblasStride stride_a,
+                                 T*            hCPU,
+                                 const T*      dGPU,
+                                 int           batch_count)
+{
+    size_t size = batch_count ? size_t(lda) * N + size_t(stride_a) * (batch_count - 1) : 0;
+
+    if(hipblas_check_device_enabled && (norm_type == 'F' || norm_type == 'f')
+       && hipblas_init_device_type<T> != HIPBLAS_DATATYPE_INVALID && !std::is_integral<T>{})
+    {
+        device_vector<T> dCPU(size);
+        CHECK_HIP_ERROR(hipMemcpy(dCPU, hCPU, sizeof(T) * size, hipMemcpyHostToDevice));
+        return hipblas_check_device(
+                   hipblas_init_device_type<T>, M, N, lda, stride_a, dCPU, dGPU, batch_count)
+            .norm_error;
+    }
+
+    host_vector<T> hGPU(size);
+    CHECK_HIP_ERROR(hipMemcpy(hGPU, dGPU, sizeof(T) * size, hipMemcpyDeviceToHost));
+    return norm_check_general(norm_type, M, N, lda, stride_a, hCPU, hGPU.data(), batch_count);
+}
+
 template <typename T, typename T_hpa>
 double norm_check_general(char                      norm_type,
                           int                       M,
@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef _REFERENCE_CACHE_HPP_
+#define _REFERENCE_CACHE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+// Cache of the results of host reference routines in the directory given by the environment
+// variable HIPBLAS_CLIENT_REFERENCE_CACHE, disabled when it is not set. An entry is keyed by a hash
+// of the routine name, the scalar arguments and the types and contents of the input buffers, so it
+// is only found again for the same inputs. Entries of another reference library must be removed by
+// hand.
+//
+//   hipblas_reference_cache("getrf").arg(M).arg(N).arg(lda).input(hA.data(), A_size)
+//       .output(hA.data(), A_size).output(hIpiv.data(), Ipiv_size)
+//       .run([&] { cblas_getrf(M, N, hA.data(), lda, hIpiv.data()); });
+class hipblas_reference_cache
+{
+public:
+    explicit hipblas_reference_cache(const char* routine);
+
+    // Adds a scalar argument to the key
+    template <typename T>
+    hipblas_reference_cache& arg(const T& value)
+    {
+        return hash(&value, sizeof(T));
+    }
+
+    // Adds the type and the n elements of an input buffer to the key, before run overwrites them
+    template <typename T>
+    hipblas_reference_cache& input(const T* data, size_t n)
+    {
+        const char* type = typeid(T).name();
+        return hash(type, strlen(type)).hash(data, n * sizeof(T));
+    }
+
+    // Adds a buffer of n elements written by the reference
+    template <typename T>
+    hipblas_reference_cache& output(T* data, size_t n)
+    {
+        outputs.emplace_back(data, n * sizeof(T));
+        return *this;
+    }
+
+    // Reads the outputs of the entry of the key, or calls compute and writes them to a new entry
+    template <typename F>
+    void run(F compute)
+    {
+        if(!load())
+        {
+            compute();
+            store();
+        }
+    }
+
+private:
+    uint64_t                              key;
+    std::vector<std::pair<void*, size_t>> outputs;
+
+    hipblas_reference_cache& hash(const void* data, size_t bytes);
+    bool                     load();
+    void                     store();
+};
+
+#endif
@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasAsyncResultModel = ArgumentModel<e_N, e_incx>;
+
+inline void testname_async_result(const Arguments& arg, std::string& name)
+{
+    hipblasAsyncResultModel{}.test_name(arg, name);
+}
+
+// Checks the reductions into pinned host memory against the CPU reference, and that the handle
+// stays in host pointer mode
+template <typename T>
+inline hipblasStatus_t testing_async_result(const Arguments& arg)
+{
+    int N    = arg.N;
+    int incx = arg.incx;
+
+    hipDataType type = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+
+    int    abs_incx = incx >= 0 ? incx : -incx;
+    size_t sizeX    = std::max(size_t(N) * abs_incx, size_t(1));
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasDotAsyncEx(
+            handle, N, nullptr, type, incx, nullptr, type, incx, nullptr, type, type, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    host_vector<T>   hx(sizeX);
+    device_vector<T> dx(sizeX);
+
+    hipblas_init_vector(hx, arg, N, abs_incx, 0, 1, hipblas_client_never_set_nan, true, true);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * sizeX, hipMemcpyHostToDevice));
+
+    // Pinned results: dot, nrm2, asum, iamax and iamin
+    T*         h_result;
+    int*       h_index;
+    hipEvent_t event;
+    CHECK_HIP_ERROR(hipHostMalloc((void**)&h_result, sizeof(T) * 3, hipHostMallocDefault));
+    CHECK_HIP_ERROR(hipHostMalloc((void**)&h_index, sizeof(int) * 2, hipHostMallocDefault));
+    CHECK_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasDotAsyncEx(handle,
+                                          N,
+                                          dx,
+                                          type,
+                                          incx,
+                                          dx,
+                                          type,
+                                          incx,
+                                          &h_result[0],
+                                          type,
+                                          type,
+                                          nullptr));
+    CHECK_HIPBLAS_ERROR(
+        hipblasNrm2AsyncEx(handle, N, dx, type, incx, &h_result[1], type, type, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasAsumAsyncEx(handle, N, dx, type, incx, &h_result[2], nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasIamaxAsyncEx(handle, N, dx, type, incx, &h_index[0], nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasIaminAsyncEx(handle, N, dx, type, incx, &h_index[1], event));
+
+    hipblasPointerMode_t pointer_mode;
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &pointer_mode));
+    EXPECT_EQ(HIPBLAS_POINTER_MODE_HOST, pointer_mode);
+
+    CHECK_HIP_ERROR(hipEventSynchronize(event));
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    T   cpu_result[3];
+    int cpu_index[2];
+    cblas_dot<T>(N, hx.data(), incx, hx.data(), incx, &cpu_result[0]);
+    cblas_nrm2<T>(N, hx.data(), incx, &cpu_result[1]);
+    cblas_asum<T>(N, hx.data(), incx, &cpu_result[2]);
+    cblas_iamax<T>(N, hx.data(), incx, &cpu_index[0]);
+    cblas_iamin<T>(N, hx.data(), incx, &cpu_index[1]);
+
+    if(arg.unit_check)
+    {
+        unit_check_general<T>(1, 1, 1, &cpu_result[0], &h_result[0]);
+        unit_check_nrm2<T>(cpu_result[1], h_result[1], N);
+        unit_check_general<T>(1, 1, 1, &cpu_result[2], &h_result[2]);
+        EXPECT_EQ(cpu_index[0], h_index[0]);
+        EXPECT_EQ(cpu_index[1], h_index[1]);
+    }
+
+    CHECK_HIP_ERROR(hipEventDestroy(event));
+    CHECK_HIP_ERROR(hipHostFree(h_index));
+    CHECK_HIP_ERROR(hipHostFree(h_result));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -138,16 +138,22 @@ inline hipblasStatus_t testing_axpy(const Arguments& arg)
     {
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        hipblasPointerMode_t mode    = hipblas_timing_pointer_mode(HIPBLAS_POINTER_MODE_DEVICE);
+        const T*             alpha_p = mode == HIPBLAS_POINTER_MODE_HOST ? &alpha : d_alpha;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+
+        hipblasEventTimer timer(arg, handle);
 
-        int runs = arg.cold_iters + arg.iters;
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
-            CHECK_HIPBLAS_ERROR(hipblasAxpyFn(handle, N, d_alpha, dx, incx, dy_device, incy));
+            CHECK_HIPBLAS_ERROR(hipblasAxpyFn(handle, N, alpha_p, dx, incx, dy_device, incy));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasAxpyModel{}.log_args<T>(std::cout,
@@ -149,11 +149,14 @@ inline hipblasStatus_t testing_axpy_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasAxpyBatchedFn(handle,
                                                      N,
@@ -164,6 +167,7 @@ inline hipblasStatus_t testing_axpy_batched(const Arguments& arg)
                                                      incy,
                                                      batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasAxpyBatchedModel{}.log_args<T>(std::cout,
@@ -192,11 +192,14 @@ inline hipblasStatus_t testing_axpy_strided_batched_ex_template(const Arguments&
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasAxpyStridedBatchedExFn(handle,
                                                               N,
@@ -213,6 +216,7 @@ inline hipblasStatus_t testing_axpy_strided_batched_ex_template(const Arguments&
                                                               batch_count,
                                                               executionType));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasAxpyStridedBatchedExModel{}.log_args<Ta>(std::cout,
@@ -0,0 +1,270 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasBatchScalarsModel = ArgumentModel<e_M, e_N, e_K, e_batch_count>;
+
+inline void testname_batch_scalars(const Arguments& arg, std::string& name)
+{
+    hipblasBatchScalarsModel{}.test_name(arg, name);
+}
+
+// Checks the scalar stride of the handle, then a float hipblasGemmStridedBatchedEx_v2 with
+// per-instance alpha and beta in device memory against one CPU gemm per instance. The scalars
+// are 2 elements apart, and one instance has beta = 0 over a C of NaNs, which must not be read.
+inline hipblasStatus_t testing_batch_scalars(const Arguments& arg)
+{
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+    hipblasStride      scalar_stride = -1;
+
+    // Argument checks
+    EXPECT_HIPBLAS_STATUS(hipblasGetBatchScalarStride(handle, &scalar_stride),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(scalar_stride, 0);
+    EXPECT_HIPBLAS_STATUS(hipblasSetBatchScalarStride(handle, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetBatchScalarStride(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(M < 0 || N < 0 || K < 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int           lda = std::max(1, M), ldb = std::max(1, K), ldc = std::max(1, M);
+    hipblasStride stride_A = hipblasStride(lda) * K;
+    hipblasStride stride_B = hipblasStride(ldb) * N;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+    hipblasStride stride_s = 2;
+    size_t        A_size   = stride_A * std::max(1, batch_count);
+    size_t        B_size   = stride_B * std::max(1, batch_count);
+    size_t        C_size   = stride_C * std::max(1, batch_count);
+    size_t        s_size   = stride_s * std::max(1, batch_count);
+
+    host_vector<float> hA(A_size), hB(B_size), hC(C_size), hC_gold(C_size), hC_gpu(C_size);
+    host_vector<float> halpha(s_size), hbeta(s_size);
+
+    hipblas_init_matrix(
+        hA, arg, M, K, lda, stride_A, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, ldb, stride_B, batch_count, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_never_set_nan);
+    for(size_t b = 0; b < size_t(batch_count); b++)
+    {
+        halpha[b * stride_s] = float(b % 3 + 1);
+        hbeta[b * stride_s]  = float(b % 2);
+        if(!hbeta[b * stride_s])
+            for(size_t i = 0; i < size_t(stride_C); i++)
+                hC[b * stride_C + i] = std::numeric_limits<float>::quiet_NaN();
+    }
+    hC_gold = hC;
+
+    device_vector<float> dA(A_size), dB(B_size), dC(C_size), dalpha(s_size), dbeta(s_size);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, halpha, sizeof(float) * s_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, hbeta, sizeof(float) * s_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchScalarStride(handle, stride_s));
+    CHECK_HIPBLAS_ERROR(hipblasGetBatchScalarStride(handle, &scalar_stride));
+    EXPECT_EQ(scalar_stride, stride_s);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedEx_v2(handle,
+                                                       HIPBLAS_OP_N,
+                                                       HIPBLAS_OP_N,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dalpha,
+                                                       dA,
+                                                       HIP_R_32F,
+                                                       lda,
+                                                       stride_A,
+                                                       dB,
+                                                       HIP_R_32F,
+                                                       ldb,
+                                                       stride_B,
+                                                       dbeta,
+                                                       dC,
+                                                       HIP_R_32F,
+                                                       ldc,
+                                                       stride_C,
+                                                       batch_count,
+                                                       HIPBLAS_COMPUTE_32F,
+                                                       HIPBLAS_GEMM_DEFAULT));
+    CHECK_HIP_ERROR(hipMemcpy(hC_gpu, dC, sizeof(float) * C_size, hipMemcpyDeviceToHost));
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    // beta = 0 replaces the NaNs of C, as the device must
+    for(size_t b = 0; b < size_t(batch_count); b++)
+    {
+        if(!hbeta[b * stride_s])
+            for(size_t i = 0; i < size_t(stride_C); i++)
+                hC_gold[b * stride_C + i] = 0;
+        cblas_gemm<float, float, float>(HIPBLAS_OP_N,
+                                        HIPBLAS_OP_N,
+                                        M,
+                                        N,
+                                        K,
+                                        halpha[b * stride_s],
+                                        hA.data() + b * stride_A,
+                                        lda,
+                                        hB.data() + b * stride_B,
+                                        ldb,
+                                        hbeta[b * stride_s],
+                                        hC_gold.data() + b * stride_C,
+                                        ldc);
+    }
+
+    if(arg.unit_check)
+        unit_check_general<float>(M, N, batch_count, ldc, stride_C, hC_gold.data(), hC_gpu.data());
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// A float hipblasSgemvStridedBatched, hipblasSaxpyStridedBatched and hipblasSscalStridedBatched
+// with per-instance scalars in device memory, against one CPU call per instance. As in
+// testing_batch_scalars, one instance has beta = 0 over a y of NaNs, axpy adds alpha_i times the
+// first min(M, N) entries of x_i to the gemv result, and scal then scales it by alpha_i.
+inline hipblasStatus_t testing_batch_scalars_gemv(const Arguments& arg)
+{
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = std::min(M, N);
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    if(M < 0 || N < 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int           lda      = std::max(1, M);
+    hipblasStride stride_A = hipblasStride(lda) * N;
+    hipblasStride stride_x = N;
+    hipblasStride stride_y = M;
+    hipblasStride stride_s = 2;
+    size_t        A_size   = stride_A * std::max(1, batch_count);
+    size_t        x_size   = stride_x * std::max(1, batch_count);
+    size_t        y_size   = stride_y * std::max(1, batch_count);
+    size_t        s_size   = stride_s * std::max(1, batch_count);
+
+    host_vector<float> hA(A_size), hx(x_size), hy(y_size), hy_gold(y_size), hy_gpu(y_size);
+    host_vector<float> halpha(s_size), hbeta(s_size);
+
+    hipblas_init_matrix(
+        hA, arg, M, N, lda, stride_A, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hx, arg, N, 1, stride_x, batch_count, hipblas_client_never_set_nan);
+    hipblas_init_vector(hy, arg, M, 1, stride_y, batch_count, hipblas_client_never_set_nan);
+    for(size_t b = 0; b < size_t(batch_count); b++)
+    {
+        halpha[b * stride_s] = float(b % 3 + 1);
+        hbeta[b * stride_s]  = float(b % 2);
+        if(!hbeta[b * stride_s])
+            for(size_t i = 0; i < size_t(stride_y); i++)
+                hy[b * stride_y + i] = std::numeric_limits<float>::quiet_NaN();
+    }
+    hy_gold = hy;
+
+    device_vector<float> dA(A_size), dx(x_size), dy(y_size), dalpha(s_size), dbeta(s_size);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * x_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, halpha, sizeof(float) * s_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, hbeta, sizeof(float) * s_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchScalarStride(handle, stride_s));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasSgemvStridedBatched(handle,
+                                                   HIPBLAS_OP_N,
+                                                   M,
+                                                   N,
+                                                   dalpha,
+                                                   dA,
+                                                   lda,
+                                                   stride_A,
+                                                   dx,
+                                                   1,
+                                                   stride_x,
+                                                   dbeta,
+                                                   dy,
+                                                   1,
+                                                   stride_y,
+                                                   batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasSaxpyStridedBatched(
+        handle, K, dalpha, dx, 1, stride_x, dy, 1, stride_y, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasSscalStridedBatched(handle, M, dalpha, dy, 1, stride_y, batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(hy_gpu, dy, sizeof(float) * y_size, hipMemcpyDeviceToHost));
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    // beta = 0 replaces the NaNs of y, as the device must
+    for(size_t b = 0; b < size_t(batch_count); b++)
+    {
+        if(!hbeta[b * stride_s])
+            for(size_t i = 0; i < size_t(stride_y); i++)
+                hy_gold[b * stride_y + i] = 0;
+        cblas_gemv<float>(HIPBLAS_OP_N,
+                          M,
+                          N,
+                          halpha[b * stride_s],
+                          hA.data() + b * stride_A,
+                          lda,
+                          hx.data() + b * stride_x,
+                          1,
+                          hbeta[b * stride_s],
+                          hy_gold.data() + b * stride_y,
+                          1);
+        cblas_axpy<float>(K,
+                          halpha[b * stride_s],
+                          hx.data() + b * stride_x,
+                          1,
+                          hy_gold.data() + b * stride_y,
+                          1);
+        cblas_scal<float>(M, halpha[b * stride_s], hy_gold.data() + b * stride_y, 1);
+    }
+
+    if(arg.unit_check)
+        unit_check_general<float>(1, M, batch_count, 1, stride_y, hy_gold.data(), hy_gpu.data());
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
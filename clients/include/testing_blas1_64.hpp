@@ -0,0 +1,108 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasBlas1_64Model = ArgumentModel<e_N, e_incx, e_incy>;
+
+inline void testname_blas1_64(const Arguments& arg, std::string& name)
+{
+    hipblasBlas1_64Model{}.test_name(arg, name);
+}
+
+// Checks the ILP64 (_64) Level-1 entry points against the CPU reference. Backends built
+// without ILP64 support report HIPBLAS_STATUS_NOT_SUPPORTED, which is passed back to the caller.
+inline hipblasStatus_t testing_blas1_64(const Arguments& arg)
+{
+    int64_t N    = arg.N;
+    int64_t incx = arg.incx;
+    int64_t incy = arg.incy;
+
+    int64_t abs_incx = incx < 0 ? -incx : incx;
+    int64_t abs_incy = incy < 0 ? -incy : incy;
+
+    hipblasLocalHandle handle(arg);
+
+    hipblasStatus_t status = hipblasSaxpy_64(handle, 0, nullptr, nullptr, incx, nullptr, incy);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+    CHECK_HIPBLAS_ERROR(status);
+
+    if(N <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    size_t sizeX = size_t(N) * abs_incx;
+    size_t sizeY = size_t(N) * abs_incy;
+
+    float alpha = arg.get_alpha<float>();
+
+    host_vector<float> hx(sizeX);
+    host_vector<float> hy(sizeY);
+    host_vector<float> hy_cpu(sizeY);
+
+    device_vector<float> dx(sizeX);
+    device_vector<float> dy(sizeY);
+
+    hipblas_init_vector(hx, arg, N, abs_incx, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hy, arg, N, abs_incy, 0, 1, hipblas_client_alpha_sets_nan, false);
+    hy_cpu = hy;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(float) * sizeY, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    float   dot_gpu, dot_cpu;
+    int64_t amax_gpu;
+    int     amax_cpu;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy_64(handle, N, &alpha, dx, incx, dy, incy));
+    CHECK_HIPBLAS_ERROR(hipblasSdot_64(handle, N, dx, incx, dy, incy, &dot_gpu));
+    CHECK_HIPBLAS_ERROR(hipblasIsamax_64(handle, N, dx, incx, &amax_gpu));
+
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(float) * sizeY, hipMemcpyDeviceToHost));
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    cblas_axpy<float>(N, alpha, hx.data(), incx, hy_cpu.data(), incy);
+    cblas_dot<float>(N, hx.data(), incx, hy_cpu.data(), incy, &dot_cpu);
+    cblas_iamax<float>(N, hx.data(), incx, &amax_cpu);
+
+    if(arg.unit_check)
+    {
+        unit_check_general<float>(1, N, abs_incy, hy_cpu.data(), hy.data());
+        unit_check_general<float>(1, 1, 1, &dot_cpu, &dot_gpu);
+        EXPECT_EQ(int64_t(amax_cpu), amax_gpu);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
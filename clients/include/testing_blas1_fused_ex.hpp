@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasBlas1FusedExModel = ArgumentModel<e_N, e_alpha, e_beta, e_incx, e_incy>;
+
+inline void testname_blas1_fused_ex(const Arguments& arg, std::string& name)
+{
+    hipblasBlas1FusedExModel{}.test_name(arg, name);
+}
+
+// Checks hipblasAxpyDotEx, hipblasDotDualEx and hipblasAxpbyNrm2Ex against the unfused CPU
+// reference in both pointer modes. x and z use incx, y uses incy. The inputs are small integers,
+// so the dot products are exact.
+template <typename T>
+inline hipblasStatus_t testing_blas1_fused_ex(const Arguments& arg)
+{
+    int N    = arg.N;
+    int incx = arg.incx;
+    int incy = arg.incy;
+
+    hipDataType type = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity checks
+    T h_result[2];
+    EXPECT_HIPBLAS_STATUS(hipblasAxpyDotEx(handle,
+                                           0,
+                                           &h_alpha,
+                                           type,
+                                           nullptr,
+                                           type,
+                                           1,
+                                           nullptr,
+                                           type,
+                                           1,
+                                           nullptr,
+                                           type,
+                                           1,
+                                           nullptr,
+                                           type,
+                                           type),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasDotDualEx(handle,
+                                           0,
+                                           nullptr,
+                                           type,
+                                           1,
+                                           nullptr,
+                                           HIP_R_16F,
+                                           1,
+                                           nullptr,
+                                           type,
+                                           1,
+                                           h_result,
+                                           type,
+                                           type),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(hipblasAxpbyNrm2Ex(handle,
+                                             10,
+                                             &h_alpha,
+                                             type,
+                                             nullptr,
+                                             type,
+                                             1,
+                                             &h_beta,
+                                             nullptr,
+                                             type,
+                                             1,
+                                             h_result,
+                                             type,
+                                             type),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(N <= 0)
+    {
+        // Quick return writes zero results
+        h_result[0] = h_result[1] = T(1);
+        CHECK_HIPBLAS_ERROR(hipblasDotDualEx(handle,
+                                             N,
+                                             nullptr,
+                                             type,
+                                             incx,
+                                             nullptr,
+                                             type,
+                                             incy,
+                                             nullptr,
+                                             type,
+                                             incx,
+                                             h_result,
+                                             type,
+                                             type));
+        EXPECT_EQ(T(0), h_result[0]);
+        EXPECT_EQ(T(0), h_result[1]);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int    abs_incx = incx >= 0 ? incx : -incx;
+    int    abs_incy = incy >= 0 ? incy : -incy;
+    size_t sizeX    = size_t(N) * abs_incx;
+    size_t sizeY    = size_t(N) * abs_incy;
+
+    host_vector<T> hx(sizeX);
+    host_vector<T> hy(sizeY);
+    host_vector<T> hz(sizeX);
+    host_vector<T> hy_gpu(sizeY);
+    host_vector<T> hy_cpu(sizeY);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy(sizeY);
+    device_vector<T> dz(sizeX);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    device_vector<T> d_result(2);
+
+    hipblas_init_vector(hx, arg, N, abs_incx, 0, 1, hipblas_client_alpha_sets_nan, true, true);
+    hipblas_init_vector(hy, arg, N, abs_incy, 0, 1, hipblas_client_alpha_sets_nan, false);
+    hipblas_init_vector(hz, arg, N, abs_incx, 0, 1, hipblas_client_never_set_nan, false, true);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dz, hz, sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    // y := alpha * x + y; result = y . z
+    host_vector<T> hy_axpy(hy);
+    T              cpu_axpy_dot;
+    cblas_axpy<T>(N, h_alpha, hx.data(), incx, hy_axpy.data(), incy);
+    cblas_dot<T>(N, hy_axpy.data(), incy, hz.data(), incx, &cpu_axpy_dot);
+
+    // result = {x . y, x . z}
+    T cpu_dot_dual[2];
+    cblas_dot<T>(N, hx.data(), incx, hy.data(), incy, &cpu_dot_dual[0]);
+    cblas_dot<T>(N, hx.data(), incx, hz.data(), incx, &cpu_dot_dual[1]);
+
+    // y := alpha * x + beta * y; result = ||y||
+    host_vector<T> hy_axpby(hy);
+    T              cpu_axpby_nrm2;
+    cblas_scal<T>(N, h_beta, hy_axpby.data(), abs_incy);
+    cblas_axpy<T>(N, h_alpha, hx.data(), incx, hy_axpby.data(), incy);
+    cblas_nrm2<T>(N, hy_axpby.data(), abs_incy, &cpu_axpby_nrm2);
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    for(bool device_mode : {false, true})
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+            handle, device_mode ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+        const T* alpha  = device_mode ? (const T*)d_alpha : &h_alpha;
+        const T* beta   = device_mode ? (const T*)d_beta : &h_beta;
+        T*       result = device_mode ? (T*)d_result : h_result;
+
+        auto get_result = [&](int count) {
+            if(device_mode)
+                CHECK_HIP_ERROR(
+                    hipMemcpy(h_result, d_result, sizeof(T) * count, hipMemcpyDeviceToHost));
+        };
+
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * sizeY, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasAxpyDotEx(handle,
+                                             N,
+                                             alpha,
+                                             type,
+                                             dx,
+                                             type,
+                                             incx,
+                                             dy,
+                                             type,
+                                             incy,
+                                             dz,
+                                             type,
+                                             incx,
+                                             result,
+                                             type,
+                                             type));
+        get_result(1);
+        CHECK_HIP_ERROR(hipMemcpy(hy_gpu, dy, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy_axpy.data(), hy_gpu.data());
+            unit_check_general<T>(1, 1, 1, &cpu_axpy_dot, h_result);
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * sizeY, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasDotDualEx(
+            handle, N, dx, type, incx, dy, type, incy, dz, type, incx, result, type, type));
+        get_result(2);
+        if(arg.unit_check)
+            unit_check_general<T>(1, 2, 1, cpu_dot_dual, h_result);
+
+        CHECK_HIPBLAS_ERROR(hipblasAxpbyNrm2Ex(
+            handle, N, alpha, type, dx, type, incx, beta, dy, type, incy, result, type, type));
+        get_result(1);
+        CHECK_HIP_ERROR(hipMemcpy(hy_gpu, dy, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy_axpby.data(), hy_gpu.data());
+            unit_check_nrm2<T>(cpu_axpby_nrm2, h_result[0], N);
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
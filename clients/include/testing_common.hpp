@@ -39,6 +39,7 @@
 #include "hipblas_vector.hpp"
 #include "near.h"
 #include "norm.h"
+#include "reference_cache.hpp"
 #include "unit.h"
 #include "utility.h"
 
@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasConvertExModel = ArgumentModel<e_N, e_batch_count>;
+
+inline void testname_convert_ex(const Arguments& arg, std::string& name)
+{
+    hipblasConvertExModel{}.test_name(arg, name);
+}
+
+// Checks float copies, scaled and saturated conversions to half, and conversions to int8 against
+// the CPU. The conversion kernels are optional, and without them only the copies are supported,
+// so HIPBLAS_STATUS_NOT_SUPPORTED skips the check of the conversions.
+inline hipblasStatus_t testing_convert_ex(const Arguments& arg)
+{
+    int N           = arg.N;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // Argument checks
+    EXPECT_HIPBLAS_STATUS(hipblasConvertEx(handle,
+                                           -1,
+                                           nullptr,
+                                           HIP_R_32F,
+                                           nullptr,
+                                           HIP_R_32F,
+                                           nullptr,
+                                           HIP_R_16F,
+                                           HIPBLAS_CONVERT_DEFAULT),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasConvertEx(handle,
+                                           N,
+                                           nullptr,
+                                           HIP_R_32F,
+                                           nullptr,
+                                           HIP_R_32F,
+                                           nullptr,
+                                           HIP_R_16F,
+                                           hipblasConvertMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    if(N < 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Quick return, with null vectors
+    EXPECT_HIPBLAS_STATUS(hipblasConvertStridedBatchedEx(handle,
+                                                         N,
+                                                         nullptr,
+                                                         HIP_R_32F,
+                                                         nullptr,
+                                                         HIP_R_32F,
+                                                         N,
+                                                         nullptr,
+                                                         HIP_R_16F,
+                                                         N,
+                                                         HIPBLAS_CONVERT_DEFAULT,
+                                                         0),
+                          HIPBLAS_STATUS_SUCCESS);
+    if(!N || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStride stride = N;
+    size_t        size   = size_t(N) * batch_count;
+
+    host_vector<float> hx(size);
+    hipblas_init_vector(
+        hx, arg, N, 1, stride, batch_count, hipblas_client_never_set_nan, true, true);
+
+    // Values beyond the range of half and int8
+    hx[0] = 1.0e6f;
+    if(size > 1)
+        hx[1] = -1000.5f;
+
+    device_vector<float> dx(size);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    // Unscaled copy
+    {
+        host_vector<float>   hy(size);
+        device_vector<float> dy(size);
+        CHECK_HIPBLAS_ERROR(hipblasConvertStridedBatchedEx(handle,
+                                                           N,
+                                                           nullptr,
+                                                           HIP_R_32F,
+                                                           dx,
+                                                           HIP_R_32F,
+                                                           stride,
+                                                           dy,
+                                                           HIP_R_32F,
+                                                           stride,
+                                                           HIPBLAS_CONVERT_DEFAULT,
+                                                           batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(float) * size, hipMemcpyDeviceToHost));
+        if(arg.unit_check)
+            unit_check_general<float>(1, N, batch_count, 1, stride, hx.data(), hy.data());
+    }
+
+    // Scaled by 2 into half, saturating
+    {
+        float                      alpha = 2;
+        host_vector<hipblasHalf>   hy(size);
+        device_vector<hipblasHalf> dy(size);
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        hipblasStatus_t status = hipblasConvertStridedBatchedEx(handle,
+                                                                N,
+                                                                &alpha,
+                                                                HIP_R_32F,
+                                                                dx,
+                                                                HIP_R_32F,
+                                                                stride,
+                                                                dy,
+                                                                HIP_R_16F,
+                                                                stride,
+                                                                HIPBLAS_CONVERT_SATURATE,
+                                                                batch_count);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(hipblasHalf) * size, hipMemcpyDeviceToHost));
+
+            host_vector<float> hy_cpu(size), hy_gpu(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                float value = std::min(std::max(alpha * hx[i], -65504.0f), 65504.0f);
+                hy_cpu[i]   = half_to_float(float_to_half(value));
+                hy_gpu[i]   = half_to_float(hy[i]);
+            }
+            if(arg.unit_check)
+                unit_check_general<float>(
+                    1, N, batch_count, 1, stride, hy_cpu.data(), hy_gpu.data());
+        }
+    }
+
+    // Into int8, which rounds to nearest even and saturates
+    {
+        host_vector<int8_t>   hy(size);
+        device_vector<int8_t> dy(size);
+        hipblasStatus_t       status = hipblasConvertEx(handle,
+                                                        int(size),
+                                                        nullptr,
+                                                        HIP_R_32F,
+                                                        dx,
+                                                        HIP_R_32F,
+                                                        dy,
+                                                        HIP_R_8I,
+                                                        HIPBLAS_CONVERT_DEFAULT);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(int8_t) * size, hipMemcpyDeviceToHost));
+
+            host_vector<int> hy_cpu(size), hy_gpu(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                hy_cpu[i] = int(std::min(std::max(std::nearbyint(hx[i]), -128.0f), 127.0f));
+                hy_gpu[i] = hy[i];
+            }
+            if(arg.unit_check)
+                unit_check_general<int>(1, size, 1, hy_cpu.data(), hy_gpu.data());
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
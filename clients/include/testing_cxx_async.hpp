@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "hipblas_async.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Starts a gemm on the stream of each handle, awaits them in turn and checks the status of a call
+// rejected before it is enqueued
+template <typename T>
+hipblas::task<hipblasStatus_t> cxx_async_gemms(hipblas::executor&            ex,
+                                               std::vector<hipblas::handle>& handles,
+                                               int                           n,
+                                               const T*                      alpha,
+                                               const std::vector<T*>&        A,
+                                               const T*                      beta,
+                                               const std::vector<T*>&        C)
+{
+    std::vector<hipblas::async_status> calls;
+    for(size_t i = 0; i < handles.size(); i++)
+        calls.push_back(hipblas::gemm_async(ex,
+                                            handles[i],
+                                            HIPBLAS_OP_N,
+                                            HIPBLAS_OP_T,
+                                            n,
+                                            n,
+                                            n,
+                                            alpha,
+                                            A[i],
+                                            n,
+                                            A[i],
+                                            n,
+                                            beta,
+                                            C[i],
+                                            n));
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(auto& call : calls)
+    {
+        hipblasStatus_t call_status = co_await call;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = call_status;
+    }
+
+    hipblasStatus_t invalid = co_await hipblas::gemm_async(ex,
+                                                           handles[0],
+                                                           HIPBLAS_OP_N,
+                                                           HIPBLAS_OP_N,
+                                                           -1,
+                                                           n,
+                                                           n,
+                                                           alpha,
+                                                           A[0],
+                                                           n,
+                                                           A[0],
+                                                           n,
+                                                           beta,
+                                                           C[0],
+                                                           n);
+    EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, invalid);
+    co_return status;
+}
+
+// Runs gemms on two handles with their own streams, resumed by a run_loop and by an executor
+// starting a thread per coroutine, and through future(), against cblas_gemm
+template <typename T>
+inline hipblasStatus_t testing_cxx_async(const Arguments& arg)
+{
+    int n       = arg.N;
+    int handles = 2;
+
+    if(n < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    T h_alpha = arg.get_alpha<T>(), h_beta = arg.get_beta<T>();
+
+    std::vector<hipStream_t>       streams(handles);
+    std::vector<hipblas::handle>   hipblas_handles;
+    std::vector<host_vector<T>>    hA(handles), hC(handles), hC_gold(handles);
+    std::vector<std::unique_ptr<device_vector<T>>> dA, dC;
+    std::vector<T*>                                pA, pC;
+    for(int i = 0; i < handles; i++)
+    {
+        CHECK_HIP_ERROR(hipStreamCreate(&streams[i]));
+        hipblas_handles.emplace_back(streams[i]);
+        hA[i].resize(size_t(n) * n);
+        hC[i].resize(size_t(n) * n);
+        hipblas_init_matrix(hA[i], arg, n, n, n, 0, 1, hipblas_client_never_set_nan, i == 0);
+        hipblas_init_matrix(hC[i], arg, n, n, n, 0, 1, hipblas_client_never_set_nan);
+        hC_gold[i] = hC[i];
+        cblas_gemm<T, T, T>(HIPBLAS_OP_N,
+                            HIPBLAS_OP_T,
+                            n,
+                            n,
+                            n,
+                            h_alpha,
+                            hA[i].data(),
+                            n,
+                            hA[i].data(),
+                            n,
+                            h_beta,
+                            hC_gold[i].data(),
+                            n);
+        dA.emplace_back(new device_vector<T>(std::max<size_t>(1, hA[i].size())));
+        dC.emplace_back(new device_vector<T>(std::max<size_t>(1, hC[i].size())));
+        pA.push_back(*dA[i]);
+        pC.push_back(*dC[i]);
+        CHECK_HIP_ERROR(hipMemcpy(pA[i], hA[i], sizeof(T) * hA[i].size(), hipMemcpyHostToDevice));
+    }
+
+    hipblas::run_loop loop;
+    auto              threads = hipblas::make_executor([](auto resume) {
+        std::thread(std::move(resume)).detach();
+    });
+
+    host_vector<T> hC_out(size_t(n) * n);
+    for(int pass = 0; pass < 3; pass++)
+    {
+        for(int i = 0; i < handles; i++)
+            CHECK_HIP_ERROR(
+                hipMemcpy(pC[i], hC[i], sizeof(T) * hC[i].size(), hipMemcpyHostToDevice));
+
+        if(pass < 2)
+        {
+            hipblas::executor& ex = pass == 0 ? static_cast<hipblas::executor&>(loop) : threads;
+            EXPECT_HIPBLAS_STATUS(
+                loop.run(cxx_async_gemms<T>(ex, hipblas_handles, n, &h_alpha, pA, &h_beta, pC)),
+                HIPBLAS_STATUS_SUCCESS);
+        }
+        else
+        {
+            auto call = hipblas::gemm_async(loop,
+                                            hipblas_handles[1],
+                                            HIPBLAS_OP_N,
+                                            HIPBLAS_OP_T,
+                                            n,
+                                            n,
+                                            n,
+                                            &h_alpha,
+                                            (const T*)pA[1],
+                                            n,
+                                            (const T*)pA[1],
+                                            n,
+                                            &h_beta,
+                                            pC[1],
+                                            n);
+            EXPECT_HIPBLAS_STATUS(call.future().get(), HIPBLAS_STATUS_SUCCESS);
+        }
+
+        // The data are small integers, so the results are exact
+        for(int i = pass < 2 ? 0 : 1; i < handles; i++)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(hC_out, pC[i], sizeof(T) * hC_out.size(), hipMemcpyDeviceToHost));
+            if(arg.unit_check)
+                unit_check_general<T>(n, n, n, hC_gold[i], hC_out);
+        }
+    }
+
+    hipblas_handles.clear();
+    for(hipStream_t stream : streams)
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return HIPBLAS_STATUS_SUCCESS;
+}
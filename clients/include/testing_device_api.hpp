@@ -0,0 +1,254 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas_device.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Tiles of the device API tests: 16 x 16 matrices shared by a work group of 256 threads, and
+// 4 x 4 matrices computed in the registers of one thread
+constexpr int device_api_tile    = 16;
+constexpr int device_api_threads = 256;
+constexpr int device_api_small   = 4;
+
+template <typename T>
+__global__ void device_api_level3_kernel(T alpha, T beta, const T* A, const T* B, T* C, T* X)
+{
+    namespace device = hipblas::device;
+    constexpr int n  = device_api_tile;
+    using gemm       = device::gemm<T, n, n, n, device::op::none, device::op::transpose>;
+    using trsm       = device::trsm<T, n, n, device::side::left, device::fill::lower>;
+
+    __shared__ T sA[n * n], sB[n * n], sC[n * n];
+    for(int e = threadIdx.x; e < n * n; e += device_api_threads)
+    {
+        sA[e] = A[e];
+        sB[e] = B[e];
+        sC[e] = C[e];
+    }
+    __syncthreads();
+    gemm::template run<device_api_threads>(threadIdx.x, alpha, sA, sB, beta, sC);
+    // trsm overwrites the B read by gemm
+    __syncthreads();
+    trsm::template run<device_api_threads>(threadIdx.x, alpha, sA, sB);
+    __syncthreads();
+    for(int e = threadIdx.x; e < n * n; e += device_api_threads)
+    {
+        C[e] = sC[e];
+        X[e] = sB[e];
+    }
+}
+
+template <typename T>
+__global__ void device_api_level2_kernel(T alpha, T beta, const T* A, const T* x, T* y, T* result)
+{
+    namespace device = hipblas::device;
+    constexpr int n  = device_api_tile;
+    using gemv       = device::gemv<T, n, n, device::op::transpose>;
+    using dot        = device::dot<T, n>;
+
+    __shared__ T sA[n * n], sx[n], scratch[device_api_threads];
+    for(int e = threadIdx.x; e < n * n; e += device_api_threads)
+        sA[e] = A[e];
+    if(threadIdx.x < n)
+        sx[threadIdx.x] = x[threadIdx.x];
+    __syncthreads();
+    gemv::template run<device_api_threads>(threadIdx.x, alpha, sA, sx, beta, y);
+    T sum = dot::template run<device_api_threads>(threadIdx.x, sx, sx, scratch);
+    if(threadIdx.x == 0)
+        *result = sum;
+}
+
+// One thread computes C = alpha A B + beta C in row-major order on arrays in its registers
+template <typename T>
+__global__ void device_api_registers_kernel(T alpha, T beta, const T* A, const T* B, T* C)
+{
+    namespace device = hipblas::device;
+    constexpr int n  = device_api_small;
+    using op         = device::op;
+    using gemm       = device::gemm<T, n, n, n, op::none, op::none, device::layout::row_major>;
+
+    T a[n * n], b[n * n], c[n * n];
+#pragma unroll
+    for(int e = 0; e < n * n; e++)
+    {
+        a[e] = A[e];
+        b[e] = B[e];
+        c[e] = C[e];
+    }
+    gemm::run(0, alpha, a, b, beta, c);
+#pragma unroll
+    for(int e = 0; e < n * n; e++)
+        C[e] = c[e];
+}
+
+inline void testname_device_api(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<e_a_type>{}.test_name(arg, name);
+}
+
+// Checks gemm, trsm, gemv and dot of hipblas_device.hpp on tiles shared by a work group, and
+// gemm in the registers of one thread, against the reference BLAS
+template <typename T>
+inline hipblasStatus_t testing_device_api(const Arguments& arg)
+{
+    constexpr int n = device_api_tile;
+    constexpr int s = device_api_small;
+
+    T      alpha     = arg.get_alpha<T>();
+    T      beta      = arg.get_beta<T>();
+    double tolerance = std::numeric_limits<T>::epsilon() * 40 * n;
+
+    host_vector<T> hA(n * n), hB(n * n), hC(n * n), hx(n);
+    host_vector<T> hC_gold(n * n), hX_gold(n * n), hy_gold(n), hresult_gold(1);
+    host_vector<T> hC_out(n * n), hX_out(n * n), hy_out(n), hresult_out(1);
+
+    hipblas_init<T>(hA, n, n, n);
+    hipblas_init<T>(hB, n, n, n);
+    hipblas_init<T>(hC, n, n, n);
+    hipblas_init<T>(hx, 1, n, 1);
+    // A well conditioned lower triangle for trsm
+    for(int i = 0; i < n; i++)
+        hA[i + i * n] += T(n);
+
+    device_vector<T> dA(n * n), dB(n * n), dC(n * n), dX(n * n), dx(n), dy(n), dresult(1);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * n * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * n * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * n * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dy, 0, sizeof(T) * n));
+
+    hipLaunchKernelGGL((device_api_level3_kernel<T>),
+                       dim3(1),
+                       dim3(device_api_threads),
+                       0,
+                       0,
+                       alpha,
+                       beta,
+                       (const T*)dA,
+                       (const T*)dB,
+                       (T*)dC,
+                       (T*)dX);
+    CHECK_HIP_ERROR(hipGetLastError());
+    hipLaunchKernelGGL((device_api_level2_kernel<T>),
+                       dim3(1),
+                       dim3(device_api_threads),
+                       0,
+                       0,
+                       alpha,
+                       T(0),
+                       (const T*)dA,
+                       (const T*)dx,
+                       (T*)dy,
+                       (T*)dresult);
+    CHECK_HIP_ERROR(hipGetLastError());
+    CHECK_HIP_ERROR(hipMemcpy(hC_out, dC, sizeof(T) * n * n, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hX_out, dX, sizeof(T) * n * n, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_out, dy, sizeof(T) * n, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hresult_out, dresult, sizeof(T), hipMemcpyDeviceToHost));
+
+    hC_gold = hC;
+    hX_gold = hB;
+    cblas_gemm<T>(HIPBLAS_OP_N,
+                  HIPBLAS_OP_T,
+                  n,
+                  n,
+                  n,
+                  alpha,
+                  hA.data(),
+                  n,
+                  hB.data(),
+                  n,
+                  beta,
+                  hC_gold.data(),
+                  n);
+    cblas_trsm<T>(HIPBLAS_SIDE_LEFT,
+                  HIPBLAS_FILL_MODE_LOWER,
+                  HIPBLAS_OP_N,
+                  HIPBLAS_DIAG_NON_UNIT,
+                  n,
+                  n,
+                  alpha,
+                  hA,
+                  n,
+                  hX_gold,
+                  n);
+    cblas_gemv<T>(HIPBLAS_OP_T, n, n, alpha, hA, n, hx, 1, T(0), hy_gold, 1);
+    cblas_dot<T>(n, hx, 1, hx, 1, hresult_gold);
+
+    if(arg.unit_check)
+    {
+        near_check_general<T>(n, n, n, hC_gold, hC_out, tolerance);
+        near_check_general<T>(n, n, n, hX_gold, hX_out, tolerance);
+        near_check_general<T>(1, n, 1, hy_gold, hy_out, tolerance);
+        near_check_general<T>(1, 1, 1, hresult_gold, hresult_out, tolerance * n);
+    }
+
+    // The registers of one thread, in row-major order: C^T = B^T A^T in column-major order
+    host_vector<T> hsA(s * s), hsB(s * s), hsC(s * s), hsC_gold(s * s), hsC_out(s * s);
+    hipblas_init<T>(hsA, s, s, s);
+    hipblas_init<T>(hsB, s, s, s);
+    hipblas_init<T>(hsC, s, s, s);
+
+    device_vector<T> dsA(s * s), dsB(s * s), dsC(s * s);
+    CHECK_HIP_ERROR(hipMemcpy(dsA, hsA, sizeof(T) * s * s, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dsB, hsB, sizeof(T) * s * s, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dsC, hsC, sizeof(T) * s * s, hipMemcpyHostToDevice));
+    hipLaunchKernelGGL((device_api_registers_kernel<T>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       0,
+                       alpha,
+                       beta,
+                       (const T*)dsA,
+                       (const T*)dsB,
+                       (T*)dsC);
+    CHECK_HIP_ERROR(hipGetLastError());
+    CHECK_HIP_ERROR(hipMemcpy(hsC_out, dsC, sizeof(T) * s * s, hipMemcpyDeviceToHost));
+
+    hsC_gold = hsC;
+    cblas_gemm<T>(HIPBLAS_OP_N,
+                  HIPBLAS_OP_N,
+                  s,
+                  s,
+                  s,
+                  alpha,
+                  hsB.data(),
+                  s,
+                  hsA.data(),
+                  s,
+                  beta,
+                  hsC_gold.data(),
+                  s);
+    if(arg.unit_check)
+        near_check_general<T>(s, s, s, hsC_gold, hsC_out, tolerance);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_dist(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+// The collectives need a communicator of several processes, which a single test process does not
+// have, so only the argument checks are tested. Without BUILD_WITH_RCCL creating a grid returns
+// HIPBLAS_STATUS_NOT_SUPPORTED.
+inline hipblasStatus_t testing_dist(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipblasDistGrid_t       grid = nullptr;
+    hipblasDistMatrixDesc_t desc = {64, 64, 16, 64};
+    int                     myrow, mycol;
+    int64_t                 rows, cols;
+    float                   alpha = 1.0f, beta = 0.0f;
+
+    hipblasStatus_t status = hipblasDistGridCreate(&grid, handle, nullptr, 1, 1);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return HIPBLAS_STATUS_SUCCESS;
+    EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasDistGridCreate(&grid, nullptr, nullptr, 1, 1),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(nullptr, grid);
+
+    EXPECT_HIPBLAS_STATUS(hipblasDistGridDestroy(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasDistGridCoords(nullptr, &myrow, &mycol),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasDistLocalSize(nullptr, &desc, &rows, &cols),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasDistSgemm(nullptr, &alpha, nullptr, &desc, nullptr, &desc, &beta, nullptr, &desc),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasDistStrsm(nullptr,
+                                           HIPBLAS_FILL_MODE_LOWER,
+                                           HIPBLAS_DIAG_NON_UNIT,
+                                           &alpha,
+                                           nullptr,
+                                           &desc,
+                                           nullptr,
+                                           &desc),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
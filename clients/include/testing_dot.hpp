@@ -144,16 +144,23 @@ inline hipblasStatus_t testing_dot(const Arguments& arg)
     {
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        hipblasPointerMode_t mode   = hipblas_timing_pointer_mode(HIPBLAS_POINTER_MODE_DEVICE);
+        bool                 host   = mode == HIPBLAS_POINTER_MODE_HOST;
+        T*                   result = host ? &h_hipblas_result_1 : d_hipblas_result;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+
+        hipblasEventTimer timer(arg, handle);
 
-        int runs = arg.cold_iters + arg.iters;
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
-            CHECK_HIPBLAS_ERROR((hipblasDotFn)(handle, N, dx, incx, dy, incy, d_hipblas_result));
+            CHECK_HIPBLAS_ERROR((hipblasDotFn)(handle, N, dx, incx, dy, incy, result));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasDotModel{}.log_args<T>(std::cout,
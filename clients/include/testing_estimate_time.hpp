@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_estimate_time(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_estimate_time(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipblasEstimateDesc_t desc = {};
+    hipblasEstimate_t     estimate;
+    desc.routine    = "hipblasSgemm";
+    desc.transA     = HIPBLAS_OP_N;
+    desc.transB     = HIPBLAS_OP_N;
+    desc.m          = 256;
+    desc.n          = 256;
+    desc.k          = 256;
+    desc.batchCount = 1;
+
+    EXPECT_HIPBLAS_STATUS(hipblasEstimateTime(handle, nullptr, &estimate),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasEstimateTime(handle, &desc, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasEstimateDesc_t bad = desc;
+    bad.routine               = "sgemm";
+    EXPECT_HIPBLAS_STATUS(hipblasEstimateTime(handle, &bad, &estimate),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    bad.routine = "hipblasSetStream";
+    EXPECT_HIPBLAS_STATUS(hipblasEstimateTime(handle, &bad, &estimate),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    bad.routine = desc.routine;
+    bad.m       = -1;
+    EXPECT_HIPBLAS_STATUS(hipblasEstimateTime(handle, &bad, &estimate),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // The flops and bytes are those of the perf counters; the time is modeled
+    CHECK_HIPBLAS_ERROR(hipblasEstimateTime(handle, &desc, &estimate));
+    EXPECT_EQ(2.0 * 256 * 256 * 256, estimate.flops);
+    EXPECT_EQ(4.0 * 3 * 256 * 256, estimate.bytes);
+    EXPECT_EQ(0, estimate.measured);
+    EXPECT_GT(estimate.seconds, 0.0);
+
+    // A batch does the work of its problems, and a larger problem takes no less time
+    hipblasEstimate_t batched, larger, wider;
+    desc.routine    = "hipblasSgemmStridedBatched";
+    desc.batchCount = 3;
+    CHECK_HIPBLAS_ERROR(hipblasEstimateTime(handle, &desc, &batched));
+    EXPECT_EQ(3 * estimate.flops, batched.flops);
+    EXPECT_EQ(3 * estimate.bytes, batched.bytes);
+    EXPECT_GE(batched.seconds, estimate.seconds);
+
+    desc.routine    = "hipblasSgemm";
+    desc.batchCount = 1;
+    desc.k          = 1024;
+    CHECK_HIPBLAS_ERROR(hipblasEstimateTime(handle, &desc, &larger));
+    EXPECT_GE(larger.seconds, estimate.seconds);
+
+    // double precision moves twice the bytes, at no greater rate
+    desc.routine = "hipblasDgemm";
+    CHECK_HIPBLAS_ERROR(hipblasEstimateTime(handle, &desc, &wider));
+    EXPECT_EQ(larger.flops, wider.flops);
+    EXPECT_EQ(2 * larger.bytes, wider.bytes);
+    EXPECT_GE(wider.seconds, larger.seconds);
+
+    // Level-1 routines are bound by the bytes they move
+    hipblasEstimateDesc_t axpy = {};
+    axpy.routine               = "hipblasSaxpy";
+    axpy.n                     = 1 << 20;
+    axpy.batchCount            = 1;
+    CHECK_HIPBLAS_ERROR(hipblasEstimateTime(handle, &axpy, &estimate));
+    EXPECT_EQ(2.0 * axpy.n, estimate.flops);
+    EXPECT_EQ(4.0 * 3 * axpy.n, estimate.bytes);
+
+    // A gemm timed by tuning is reported with its measured time
+    const int M = 64, N = 48, K = 32;
+    float     alpha = 1.0f, beta = 0.0f;
+
+    device_vector<float> dA(size_t(M) * K);
+    device_vector<float> dB(size_t(K) * N);
+    device_vector<float> dC(size_t(M) * N);
+
+    CHECK_HIP_ERROR(hipMemset(dA, 0, sizeof(float) * M * K));
+    CHECK_HIP_ERROR(hipMemset(dB, 0, sizeof(float) * K * N));
+    CHECK_HIP_ERROR(hipMemset(dC, 0, sizeof(float) * M * N));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmTuningMode(handle, HIPBLAS_GEMM_TUNING_ON));
+    CHECK_HIPBLAS_ERROR(hipblasGemmEx_v2(handle,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_N,
+                                         M,
+                                         N,
+                                         K,
+                                         &alpha,
+                                         dA,
+                                         HIP_R_32F,
+                                         M,
+                                         dB,
+                                         HIP_R_32F,
+                                         K,
+                                         &beta,
+                                         dC,
+                                         HIP_R_32F,
+                                         M,
+                                         HIPBLAS_COMPUTE_32F,
+                                         HIPBLAS_GEMM_DEFAULT));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmTuningMode(handle, HIPBLAS_GEMM_TUNING_OFF));
+
+    hipblasEstimateDesc_t gemm_ex = {};
+    gemm_ex.routine               = "hipblasGemmEx_v2";
+    gemm_ex.transA                = HIPBLAS_OP_N;
+    gemm_ex.transB                = HIPBLAS_OP_N;
+    gemm_ex.m                     = M;
+    gemm_ex.n                     = N;
+    gemm_ex.k                     = K;
+    gemm_ex.batchCount            = 1;
+    gemm_ex.aType                 = HIP_R_32F;
+    gemm_ex.bType                 = HIP_R_32F;
+    gemm_ex.cType                 = HIP_R_32F;
+    gemm_ex.computeType           = HIPBLAS_COMPUTE_32F;
+    CHECK_HIPBLAS_ERROR(hipblasEstimateTime(handle, &gemm_ex, &estimate));
+    EXPECT_EQ(1, estimate.measured);
+    EXPECT_GT(estimate.seconds, 0.0);
+    EXPECT_EQ(2.0 * M * N * K, estimate.flops);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,332 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGbsvStridedBatchedModel
+    = ArgumentModel<e_N, e_KL, e_KU, e_lda, e_ldb, e_stride_scale, e_batch_count>;
+
+inline void testname_gbsv_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGbsvStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gbsv_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasGbsvStridedBatchedFn = hipblasGbsvStridedBatched<T>;
+    auto hipblasGbsvBatchedFn        = hipblasGbsvBatched<T>;
+
+    hipblasLocalHandle  handle(arg);
+    const int           N           = 10;
+    const int           KL          = 2;
+    const int           KU          = 1;
+    const int           nrhs        = 1;
+    const int           ldab        = 2 * KL + KU + 1;
+    const int           ldb         = N;
+    const int           batch_count = 2;
+    const hipblasStride strideAB    = size_t(ldab) * N;
+    const hipblasStride strideP     = N;
+    const hipblasStride strideB     = size_t(ldb) * nrhs;
+
+    device_vector<T>   dAB(strideAB * batch_count);
+    device_vector<T>   dB(strideB * batch_count);
+    device_vector<int> dIpiv(strideP * batch_count);
+    device_vector<int> dInfo(batch_count);
+    device_vector<T*>  dAB_array(batch_count);
+    device_vector<T*>  dB_array(batch_count);
+
+    auto gbsv = [&](int n, int kl, int ku, T* AB, int ldab, int* ipiv, T* B, int ldb, int bc) {
+        return hipblasGbsvStridedBatchedFn(
+            handle, n, kl, ku, nrhs, AB, ldab, strideAB, ipiv, strideP, B, ldb, strideB, dInfo, bc);
+    };
+
+    EXPECT_HIPBLAS_STATUS(gbsv(-1, KL, KU, dAB, ldab, dIpiv, dB, ldb, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gbsv(N, -1, KU, dAB, ldab, dIpiv, dB, ldb, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gbsv(N, KL, -1, dAB, ldab, dIpiv, dB, ldb, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gbsv(N, KL, KU, dAB, ldab - 1, dIpiv, dB, ldb, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gbsv(N, KL, KU, dAB, ldab, dIpiv, dB, N - 1, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gbsv(N, KL, KU, nullptr, ldab, dIpiv, dB, ldb, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gbsv(N, KL, KU, dAB, ldab, nullptr, dB, ldb, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gbsv(N, KL, KU, dAB, ldab, dIpiv, nullptr, ldb, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gbsv(N, KL, KU, dAB, ldab, dIpiv, dB, ldb, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGbsvStridedBatchedFn(handle,
+                                                      N,
+                                                      KL,
+                                                      KU,
+                                                      nrhs,
+                                                      dAB,
+                                                      ldab,
+                                                      strideAB,
+                                                      dIpiv,
+                                                      strideP,
+                                                      dB,
+                                                      ldb,
+                                                      strideB,
+                                                      nullptr,
+                                                      batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGbsvBatchedFn(handle,
+                                               N,
+                                               KL,
+                                               KU,
+                                               nrhs,
+                                               nullptr,
+                                               ldab,
+                                               dIpiv,
+                                               dB_array,
+                                               ldb,
+                                               dInfo,
+                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGbsvBatchedFn(handle,
+                                               N,
+                                               KL,
+                                               KU,
+                                               nrhs,
+                                               dAB_array,
+                                               ldab,
+                                               dIpiv,
+                                               nullptr,
+                                               ldb,
+                                               dInfo,
+                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If batch_count == 0, nothing is computed
+    EXPECT_HIPBLAS_STATUS(gbsv(N, KL, KU, nullptr, ldab, nullptr, nullptr, ldb, 0),
+                          HIPBLAS_STATUS_SUCCESS);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Banded systems A_i X_i = B_i with known X_i are solved by the strided batched form, then by the
+// batched form on the same buffers, and both solutions are compared with X_i. B_i is formed by
+// gbmv on the band of A_i. The diagonal of the even A_i is made dominant, while the first
+// subdiagonal of the odd ones is, so that they are solved with row interchanges. Without
+// BUILD_WITH_BANDED_SOLVE the functions return HIPBLAS_STATUS_NOT_SUPPORTED and nothing is checked,
+// with it HIPBLAS_STATUS_NOT_SUPPORTED fails the test.
+template <typename T>
+inline hipblasStatus_t testing_gbsv_strided_batched(const Arguments& arg)
+{
+    using U                          = real_t<T>;
+    auto hipblasGbsvStridedBatchedFn = hipblasGbsvStridedBatched<T>;
+    auto hipblasGbsvBatchedFn        = hipblasGbsvBatched<T>;
+
+    int    N            = arg.N;
+    int    KL           = arg.KL;
+    int    KU           = arg.KU;
+    int    ldab         = arg.lda;
+    int    ldb          = arg.ldb;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+    int    nrhs         = 2;
+
+    hipblasStride strideAB  = size_t(ldab) * N * stride_scale;
+    hipblasStride strideB   = size_t(ldb) * nrhs * stride_scale;
+    hipblasStride strideP   = N;
+    size_t        AB_size   = strideAB * batch_count;
+    size_t        B_size    = strideB * batch_count;
+    size_t        Ipiv_size = strideP * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || KL < 0 || KU < 0 || ldab < 2 * KL + KU + 1 || ldb < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hAB(AB_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hX1(B_size);
+    host_vector<T>   hX2(B_size);
+    host_vector<int> hInfo(batch_count);
+    host_vector<T*>  hAB_array(batch_count);
+    host_vector<T*>  hB_array(batch_count);
+
+    device_vector<T>   dAB(AB_size);
+    device_vector<T>   dB(B_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(batch_count);
+    device_vector<T*>  dAB_array(batch_count);
+    device_vector<T*>  dB_array(batch_count);
+
+    double             gpu_time_used;
+    double             hipblas_error_strided = 0.0, hipblas_error_batched = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial data on CPU. Band row KL + KU of AB_b holds the diagonal of A_b.
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hABb = hAB.data() + b * strideAB;
+
+        hipblas_init<T>(hABb, ldab, N, ldab);
+        hipblas_init<T>(hX.data() + b * strideB, N, nrhs, ldb);
+        for(int j = 0; j < N; j++)
+        {
+            if(b % 2 == 0 || KL == 0)
+                hABb[KL + KU + j * size_t(ldab)] += 400;
+            else if(j < N - 1)
+                hABb[KL + KU + 1 + j * size_t(ldab)] += 400;
+        }
+        for(int k = 0; k < nrhs; k++)
+            cblas_gbmv<T>(HIPBLAS_OP_N,
+                          N,
+                          N,
+                          KL,
+                          KU,
+                          T(1),
+                          hABb + KL,
+                          ldab,
+                          hX.data() + b * strideB + k * size_t(ldb),
+                          1,
+                          T(0),
+                          hB.data() + b * strideB + k * size_t(ldb),
+                          1);
+
+        hAB_array[b] = dAB + b * strideAB;
+        hB_array[b]  = dB + b * strideB;
+    }
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAB_array, hAB_array, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB_array, hB_array, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIP_ERROR(hipMemcpy(dAB, hAB, AB_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+        hipblasStatus_t status = hipblasGbsvStridedBatchedFn(handle,
+                                                             N,
+                                                             KL,
+                                                             KU,
+                                                             nrhs,
+                                                             dAB,
+                                                             ldab,
+                                                             strideAB,
+                                                             dIpiv,
+                                                             strideP,
+                                                             dB,
+                                                             ldb,
+                                                             strideB,
+                                                             dInfo,
+                                                             batch_count);
+#ifndef HIPBLAS_BANDED_SOLVE
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+            return HIPBLAS_STATUS_SUCCESS;
+#endif
+        CHECK_HIPBLAS_ERROR(status);
+        CHECK_HIP_ERROR(hipMemcpy(hX1, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo, dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+        for(int b = 0; b < batch_count; b++)
+            EXPECT_EQ(hInfo[b], 0);
+
+        CHECK_HIP_ERROR(hipMemcpy(dAB, hAB, AB_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasGbsvBatchedFn(
+            handle, N, KL, KU, nrhs, dAB_array, ldab, dIpiv, dB_array, ldb, dInfo, batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hX2, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+
+        hipblas_error_strided = norm_check_general<T>(
+            'F', N, nrhs, ldb, strideB, hX.data(), hX1.data(), batch_count);
+        hipblas_error_batched = norm_check_general<T>(
+            'F', N, nrhs, ldb, strideB, hX.data(), hX2.data(), batch_count);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+
+            unit_check_error(hipblas_error_strided, tolerance);
+            unit_check_error(hipblas_error_batched, tolerance);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIP_ERROR(hipMemcpy(dAB, hAB, AB_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGbsvStridedBatchedFn(handle,
+                                                            N,
+                                                            KL,
+                                                            KU,
+                                                            nrhs,
+                                                            dAB,
+                                                            ldab,
+                                                            strideAB,
+                                                            dIpiv,
+                                                            strideP,
+                                                            dB,
+                                                            ldb,
+                                                            strideB,
+                                                            dInfo,
+                                                            batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGbsvStridedBatchedModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     ArgumentLogging::NA_value,
+                                                     ArgumentLogging::NA_value,
+                                                     hipblas_error_strided);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
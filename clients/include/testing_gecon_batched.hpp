@@ -0,0 +1,239 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGeconBatchedModel = ArgumentModel<e_N, e_lda, e_batch_count>;
+
+inline void testname_gecon_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGeconBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gecon_batched_bad_arg(const Arguments& arg)
+{
+    using U                    = real_t<T>;
+    auto hipblasGeconBatchedFn = hipblasGeconBatched<T, U>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N           = 10;
+    const int          lda         = 11;
+    const int          batch_count = 2;
+    const size_t       A_size      = size_t(lda) * N;
+    int                info        = 0;
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_vector<U>       dAnorm(batch_count);
+    device_vector<U>       dRcond(batch_count);
+
+    auto gecon
+        = [&](hipblasNormType_t norm, int n, T* const* A, int lda, U* anorm, U* rcond, int bc) {
+              return hipblasGeconBatchedFn(handle, norm, n, A, lda, anorm, rcond, &info, bc);
+          };
+
+    EXPECT_HIPBLAS_STATUS(
+        gecon(hipblasNormType_t(2), N, dA.ptr_on_device(), lda, dAnorm, dRcond, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -1);
+
+    EXPECT_HIPBLAS_STATUS(
+        gecon(HIPBLAS_NORM_ONE, -1, dA.ptr_on_device(), lda, dAnorm, dRcond, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -2);
+
+    EXPECT_HIPBLAS_STATUS(gecon(HIPBLAS_NORM_ONE, N, nullptr, lda, dAnorm, dRcond, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -3);
+
+    EXPECT_HIPBLAS_STATUS(
+        gecon(HIPBLAS_NORM_ONE, N, dA.ptr_on_device(), N - 1, dAnorm, dRcond, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -4);
+
+    EXPECT_HIPBLAS_STATUS(
+        gecon(HIPBLAS_NORM_ONE, N, dA.ptr_on_device(), lda, nullptr, dRcond, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -5);
+
+    EXPECT_HIPBLAS_STATUS(
+        gecon(HIPBLAS_NORM_ONE, N, dA.ptr_on_device(), lda, dAnorm, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -6);
+
+    EXPECT_HIPBLAS_STATUS(gecon(HIPBLAS_NORM_ONE, N, dA.ptr_on_device(), lda, dAnorm, dRcond, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -8);
+
+    // If batch_count == 0, nothing is computed
+    EXPECT_HIPBLAS_STATUS(gecon(HIPBLAS_NORM_ONE, N, nullptr, lda, nullptr, nullptr, 0),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(info, 0);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// The estimates are checked against LAPACK ?gecon on the same factors, for both norms. Without
+// BUILD_WITH_GECON the function returns HIPBLAS_STATUS_NOT_SUPPORTED and nothing is checked, with
+// it HIPBLAS_STATUS_NOT_SUPPORTED fails the test.
+template <typename T>
+inline hipblasStatus_t testing_gecon_batched(const Arguments& arg)
+{
+    using U                    = real_t<T>;
+    auto hipblasGeconBatchedFn = hipblasGeconBatched<T, U>;
+
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int batch_count = arg.batch_count;
+
+    size_t A_size = size_t(lda) * N;
+    int    info;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_vector<U>       hAnorm(batch_count);
+    host_vector<U>       hAnorm_one(batch_count);
+    host_vector<U>       hAnorm_inf(batch_count);
+    host_vector<U>       hRcond(batch_count);
+    host_vector<U>       hRcond_gold(batch_count);
+    host_vector<int>     hIpiv(N);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_vector<U>       dAnorm(batch_count);
+    device_vector<U>       dRcond(batch_count);
+
+    double             gpu_time_used, hipblas_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU, factorized with LAPACK after its norms are taken
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hipblas_init<T>(hA[b], N, N, lda);
+        hAnorm_one[b] = cblas_lange<T, U>('1', N, N, hA[b], lda);
+        hAnorm_inf[b] = cblas_lange<T, U>('I', N, N, hA[b], lda);
+        cblas_getrf<T>(N, N, hA[b], lda, hIpiv.data());
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(hipblasNormType_t norm : {HIPBLAS_NORM_ONE, HIPBLAS_NORM_INF})
+        {
+            hAnorm = norm == HIPBLAS_NORM_ONE ? hAnorm_one : hAnorm_inf;
+            CHECK_HIP_ERROR(
+                hipMemcpy(dAnorm, hAnorm, batch_count * sizeof(U), hipMemcpyHostToDevice));
+
+            /* =====================================================================
+                HIPBLAS
+            =================================================================== */
+            hipblasStatus_t status = hipblasGeconBatchedFn(
+                handle, norm, N, dA.ptr_on_device(), lda, dAnorm, dRcond, &info, batch_count);
+#ifndef HIPBLAS_GECON
+            if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+                return HIPBLAS_STATUS_SUCCESS;
+#endif
+            CHECK_HIPBLAS_ERROR(status);
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(hRcond, dRcond, batch_count * sizeof(U), hipMemcpyDeviceToHost));
+
+            /* =====================================================================
+               CPU LAPACK
+            =================================================================== */
+            char norm_c = norm == HIPBLAS_NORM_ONE ? '1' : 'I';
+            for(int b = 0; b < batch_count; b++)
+            {
+                cblas_gecon<T, U>(norm_c, N, hA[b], lda, hAnorm[b], &hRcond_gold[b]);
+                hipblas_error = std::max(
+                    hipblas_error,
+                    double(std::abs(hRcond[b] - hRcond_gold[b]) / hRcond_gold[b]));
+            }
+        }
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+
+            unit_check_error(hipblas_error, tolerance);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dAnorm, hAnorm_one, batch_count * sizeof(U), hipMemcpyHostToDevice));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGeconBatchedFn(handle,
+                                                      HIPBLAS_NORM_ONE,
+                                                      N,
+                                                      dA.ptr_on_device(),
+                                                      lda,
+                                                      dAnorm,
+                                                      dRcond,
+                                                      &info,
+                                                      batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGeconBatchedModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               ArgumentLogging::NA_value,
+                                               ArgumentLogging::NA_value,
+                                               hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -215,7 +215,21 @@ inline hipblasStatus_t testing_gels(const Arguments& arg)
         int            sizeW = std::max(1, std::min(M, N) + std::max(std::min(M, N), nrhs));
         host_vector<T> hW(sizeW);
 
-        info = cblas_gels(transc, M, N, nrhs, hA.data(), lda, hB.data(), ldb, hW.data(), sizeW);
+        hipblas_reference_cache("gels")
+            .arg(transc)
+            .arg(M)
+            .arg(N)
+            .arg(nrhs)
+            .arg(lda)
+            .arg(ldb)
+            .input(hA.data(), A_size)
+            .input(hB.data(), B_size)
+            .output(hB.data(), B_size)
+            .output(&info, 1)
+            .run([&] {
+                info = cblas_gels(
+                    transc, M, N, nrhs, hA.data(), lda, hB.data(), ldb, hW.data(), sizeW);
+            });
 
         hipblas_error
             = norm_check_general<T>('F', std::max(M, N), nrhs, ldb, hB.data(), hB_res.data());
@@ -241,15 +255,19 @@ inline hipblasStatus_t testing_gels(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasGelsFn(handle, trans, M, N, nrhs, dA, lda, dB, ldb, &info_input, dInfo));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGelsModel{}.log_args<T>(std::cout,
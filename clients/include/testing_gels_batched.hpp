@@ -305,11 +305,14 @@ inline hipblasStatus_t testing_gels_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGelsBatchedFn(handle,
                                                      trans,
@@ -324,6 +327,7 @@ inline hipblasStatus_t testing_gels_batched(const Arguments& arg)
                                                      dInfo,
                                                      batchCount));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGelsBatchedModel{}.log_args<T>(std::cout,
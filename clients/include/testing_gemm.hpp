@@ -94,12 +94,15 @@ inline hipblasStatus_t testing_gemm(const Arguments& arg)
     double             gpu_time_used, hipblas_error_host, hipblas_error_device;
     hipblasLocalHandle handle(arg);
 
+    // Host data only when verifying, otherwise the matrices are initialized on the device
+    bool host_init = hipblas_host_init(arg);
+
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
-    host_vector<T> hA(A_size);
-    host_vector<T> hB(B_size);
-    host_vector<T> hC_host(C_size);
-    host_vector<T> hC_device(C_size);
-    host_vector<T> hC_copy(C_size);
+    host_vector<T> hA(host_init ? A_size : 0);
+    host_vector<T> hB(host_init ? B_size : 0);
+    host_vector<T> hC_host(host_init ? C_size : 0);
+    host_vector<T> hC_device(host_init ? C_size : 0);
+    host_vector<T> hC_copy(host_init ? C_size : 0);
 
     device_vector<T> dA(A_size);
     device_vector<T> dB(B_size);
@@ -107,43 +110,36 @@ inline hipblasStatus_t testing_gemm(const Arguments& arg)
     device_vector<T> d_alpha(1);
     device_vector<T> d_beta(1);
 
-    // Initial Data on CPU
-    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
-    hipblas_init_matrix(
-        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
-    hipblas_init_matrix(hC_host, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
-
-    // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of CPU BLAS
-    hC_copy   = hC_host;
-    hC_device = hC_host;
-
-    // copy data from CPU to device, does not work for lda != A_row
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * lda * A_col, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * ldb * B_col, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * ldc * N, hipMemcpyHostToDevice));
+    if(host_init)
+    {
+        // Initial Data on CPU
+        hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+        hipblas_init_matrix(hC_host, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+
+        // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of
+        // CPU BLAS
+        hC_copy   = hC_host;
+        hC_device = hC_host;
+
+        // copy data from CPU to device, does not work for lda != A_row
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * lda * A_col, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * ldb * B_col, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * ldc * N, hipMemcpyHostToDevice));
+    }
+    else
+    {
+        hipblas_init_matrix(dA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            dB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+        hipblas_init_matrix(dC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    }
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
     if(arg.unit_check || arg.norm_check)
     {
-        /* =====================================================================
-            HIPBLAS
-        =================================================================== */
-        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-
-        // library interface
-        CHECK_HIPBLAS_ERROR(hipblasGemmFn(
-            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
-
-        // copy output from device to CPU
-        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
-
-        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * ldc * N, hipMemcpyHostToDevice));
-        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        CHECK_HIPBLAS_ERROR(hipblasGemmFn(
-            handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
-        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
-
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
@@ -161,18 +157,42 @@ inline hipblasStatus_t testing_gemm(const Arguments& arg)
                       hC_copy.data(),
                       ldc);
 
-        // enable unit check, notice unit check is not invasive, but norm check is,
-        // unit check and norm check can not be interchanged their order
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        // The norm check runs on the device result, so the result is only copied to the host
+        // for the unit check
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        // library interface
+        CHECK_HIPBLAS_ERROR(hipblasGemmFn(
+            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+
         if(arg.unit_check)
         {
+            CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
             unit_check_general<T>(M, N, ldc, hC_copy, hC_host);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host
+                = std::abs(norm_check_general_device<T>('F', M, N, ldc, 0, hC_copy, dC, 1));
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * ldc * N, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmFn(
+            handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+
+        if(arg.unit_check)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
             unit_check_general<T>(M, N, ldc, hC_copy, hC_device);
         }
         if(arg.norm_check)
         {
-            hipblas_error_host = std::abs(norm_check_general<T>('F', M, N, ldc, hC_copy, hC_host));
             hipblas_error_device
-                = std::abs(norm_check_general<T>('F', M, N, ldc, hC_copy, hC_device));
+                = std::abs(norm_check_general_device<T>('F', M, N, ldc, 0, hC_copy, dC, 1));
         }
 
     } // end of if unit/norm check
@@ -184,17 +204,24 @@ inline hipblasStatus_t testing_gemm(const Arguments& arg)
 
         // gemm has better performance in host mode. In rocBLAS in device mode
         // we need to copy alpha and beta to the host.
-        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        hipblasPointerMode_t mode  = hipblas_timing_pointer_mode(HIPBLAS_POINTER_MODE_HOST);
+        const T*             alpha = mode == HIPBLAS_POINTER_MODE_HOST ? &h_alpha : d_alpha;
+        const T*             beta  = mode == HIPBLAS_POINTER_MODE_HOST ? &h_beta : d_beta;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+
+        hipblasEventTimer timer(arg, handle);
 
-        int runs = arg.cold_iters + arg.iters;
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmFn(
-                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+                handle, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemmModel{}.log_args<T>(std::cout,
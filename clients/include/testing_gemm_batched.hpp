@@ -251,13 +251,19 @@ inline hipblasStatus_t testing_gemm_batched(const Arguments& arg)
 
         // gemm has better performance in host mode. In rocBLAS in device mode
         // we need to copy alpha and beta to the host.
-        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        hipblasPointerMode_t mode  = hipblas_timing_pointer_mode(HIPBLAS_POINTER_MODE_HOST);
+        const T*             alpha = mode == HIPBLAS_POINTER_MODE_HOST ? &h_alpha : d_alpha;
+        const T*             beta  = mode == HIPBLAS_POINTER_MODE_HOST ? &h_beta : d_beta;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+
+        hipblasEventTimer timer(arg, handle);
 
-        int runs = arg.cold_iters + arg.iters;
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
                                                      transA,
@@ -265,17 +271,18 @@ inline hipblasStatus_t testing_gemm_batched(const Arguments& arg)
                                                      M,
                                                      N,
                                                      K,
-                                                     &h_alpha,
+                                                     alpha,
                                                      (const T* const*)dA.ptr_on_device(),
                                                      lda,
                                                      (const T* const*)dB.ptr_on_device(),
                                                      ldb,
-                                                     &h_beta,
+                                                     beta,
                                                      dC.ptr_on_device(),
                                                      ldc,
                                                      batch_count));
         }
 
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemmBatchedModel{}.log_args<T>(std::cout,
@@ -251,11 +251,14 @@ inline hipblasStatus_t testing_gemm_batched_ex_template(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmBatchedExFn(handle,
                                                        transA,
@@ -282,6 +285,7 @@ inline hipblasStatus_t testing_gemm_batched_ex_template(const Arguments& arg)
 #endif
                                                        algo));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemmBatchedExModel{}.log_args<Tc>(std::cout,
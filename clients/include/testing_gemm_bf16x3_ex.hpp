@@ -0,0 +1,237 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmBf16x3ExModel = ArgumentModel<e_transA,
+                                               e_transB,
+                                               e_M,
+                                               e_N,
+                                               e_K,
+                                               e_lda,
+                                               e_ldb,
+                                               e_ldc,
+                                               e_batch_count>;
+
+inline void testname_gemm_bf16x3_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmBf16x3ExModel{}.test_name(arg, name);
+}
+
+// Checks HIPBLAS_COMPUTE_32F_FAST_16BFX3 of gemmEx and gemmStridedBatchedEx, and sgemm and
+// sgemmStridedBatched in HIPBLAS_FP32_EMULATED_BF16X3_MATH when the math mode is supported. The
+// inputs are random in [-1, 1], mostly not exact in bf16, and every element of C must be within
+// 2^-14 of the sum of the magnitudes of its terms of the product computed in double, which the
+// 8 bits of a plain bf16 gemm would miss.
+inline hipblasStatus_t testing_gemm_bf16x3_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    const hipblasStride stride_A = hipblasStride(lda) * A_col;
+    const hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    const hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    hipblasLocalHandle handle(arg);
+
+    float alpha = 1.5f, beta = -0.5f;
+
+    auto hipblasGemmBf16x3ExFn = [&](const float* A, const float* B, float* C) {
+        if(batch_count == 1)
+            return hipblasGemmEx_v2(handle,
+                                    transA,
+                                    transB,
+                                    M,
+                                    N,
+                                    K,
+                                    &alpha,
+                                    A,
+                                    HIP_R_32F,
+                                    lda,
+                                    B,
+                                    HIP_R_32F,
+                                    ldb,
+                                    &beta,
+                                    C,
+                                    HIP_R_32F,
+                                    ldc,
+                                    HIPBLAS_COMPUTE_32F_FAST_16BFX3,
+                                    HIPBLAS_GEMM_DEFAULT);
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              transA,
+                                              transB,
+                                              M,
+                                              N,
+                                              K,
+                                              &alpha,
+                                              A,
+                                              HIP_R_32F,
+                                              lda,
+                                              stride_A,
+                                              B,
+                                              HIP_R_32F,
+                                              ldb,
+                                              stride_B,
+                                              &beta,
+                                              C,
+                                              HIP_R_32F,
+                                              ldc,
+                                              stride_C,
+                                              batch_count,
+                                              HIPBLAS_COMPUTE_32F_FAST_16BFX3,
+                                              HIPBLAS_GEMM_DEFAULT);
+    };
+
+    auto hipblasSgemmFn = [&](const float* A, const float* B, float* C) {
+        if(batch_count == 1)
+            return hipblasSgemm(
+                handle, transA, transB, M, N, K, &alpha, A, lda, B, ldb, &beta, C, ldc);
+        return hipblasSgemmStridedBatched(handle,
+                                          transA,
+                                          transB,
+                                          M,
+                                          N,
+                                          K,
+                                          &alpha,
+                                          A,
+                                          lda,
+                                          stride_A,
+                                          B,
+                                          ldb,
+                                          stride_B,
+                                          &beta,
+                                          C,
+                                          ldc,
+                                          stride_C,
+                                          batch_count);
+    };
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+        return hipblasGemmBf16x3ExFn(nullptr, nullptr, nullptr);
+
+    const size_t size_A = stride_A * batch_count;
+    const size_t size_B = stride_B * batch_count;
+    const size_t size_C = stride_C * batch_count;
+
+    host_vector<float>  hA(size_A);
+    host_vector<float>  hB(size_B);
+    host_vector<float>  hC_init(size_C);
+    host_vector<float>  hC(size_C);
+    host_vector<double> hC_gold(size_C);
+    host_vector<double> hC_bound(size_C);
+
+    device_vector<float> dA(size_A);
+    device_vector<float> dB(size_B);
+    device_vector<float> dC(size_C);
+
+    srand(1);
+    auto random = []() { return float(rand()) / RAND_MAX * 2 - 1; };
+    for(auto& a : hA)
+        a = random();
+    for(auto& b : hB)
+        b = random();
+    for(auto& c : hC_init)
+        c = random();
+
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+            {
+                size_t c   = b * stride_C + i + size_t(j) * ldc;
+                double sum = 0, bound = 0;
+                for(int p = 0; p < K; p++)
+                {
+                    double a = hA[b * stride_A
+                                  + (transA == HIPBLAS_OP_N ? i + size_t(p) * lda
+                                                            : p + size_t(i) * lda)];
+                    double x = hB[b * stride_B
+                                  + (transB == HIPBLAS_OP_N ? p + size_t(j) * ldb
+                                                            : j + size_t(p) * ldb)];
+                    sum += a * x;
+                    bound += std::abs(a * x);
+                }
+                hC_gold[c]  = alpha * sum + beta * double(hC_init[c]);
+                hC_bound[c] = std::abs(alpha) * bound + std::abs(beta * double(hC_init[c]));
+            }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * size_B, hipMemcpyHostToDevice));
+
+    hipblasStatus_t math_status = hipblasSetMathMode(handle, HIPBLAS_FP32_EMULATED_BF16X3_MATH);
+    if(math_status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        CHECK_HIPBLAS_ERROR(math_status);
+
+    for(int form = 0; form < 2; form++)
+    {
+        if(form == 1 && math_status != HIPBLAS_STATUS_SUCCESS)
+            break;
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(float) * size_C, hipMemcpyHostToDevice));
+        if(form == 0)
+            CHECK_HIPBLAS_ERROR(hipblasGemmBf16x3ExFn(dA, dB, dC));
+        else
+            CHECK_HIPBLAS_ERROR(hipblasSgemmFn(dA, dB, dC));
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * size_C, hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+            for(int b = 0; b < batch_count; b++)
+                for(int j = 0; j < N; j++)
+                    for(int i = 0; i < M; i++)
+                    {
+                        size_t c = b * stride_C + i + size_t(j) * ldc;
+                        EXPECT_LE(std::abs(hC[c] - hC_gold[c]), hC_bound[c] / 16384)
+                            << "form " << form << " batch " << b << " at " << i << ", " << j;
+                    }
+    }
+
+    if(math_status == HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasMath_t mode;
+        CHECK_HIPBLAS_ERROR(hipblasGetMathMode(handle, &mode));
+        EXPECT_EQ(HIPBLAS_FP32_EMULATED_BF16X3_MATH, mode);
+        CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH));
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
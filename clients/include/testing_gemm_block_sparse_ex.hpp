@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Edge of the blocks of A. Block (i, j) is nonzero when j is a multiple of i + 1, so the block
+// rows run different numbers of waves, and block row 1 is empty so that its rows of C are only
+// scaled by beta.
+static constexpr int block_sparse_block_dim = 32;
+
+// Checks against gemm on the CPU of the dense A, in both pointer modes
+template <typename T>
+inline hipblasStatus_t testing_gemm_block_sparse_ex(const Arguments& arg)
+{
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    const int bd    = block_sparse_block_dim;
+    int       B_row = transB == HIPBLAS_OP_N ? K : N;
+    int       B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || M % bd || K % bd || ldb < std::max(1, B_row)
+       || ldc < std::max(1, M))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipDataType          data_type = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+    hipblasComputeType_t compute_type
+        = std::is_same_v<T, double> ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+    const int        block_rows = M / bd;
+    const int        block_cols = K / bd;
+    std::vector<int> row_ptr(block_rows + 1, 0), col_ind;
+    for(int i = 0; i < block_rows; i++)
+    {
+        for(int j = 0; j < block_cols; j++)
+            if(i != 1 && j % (i + 1) == 0)
+                col_ind.push_back(j);
+        row_ptr[i + 1] = col_ind.size();
+    }
+    const int nnzb = col_ind.size();
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    // The dense A is zero outside of the nonzero blocks
+    host_vector<T> hBlocks(size_t(bd) * bd * std::max(nnzb, 1));
+    host_vector<T> hA(size_t(std::max(M, 1)) * K);
+    host_vector<T> hB(size_t(ldb) * B_col);
+    host_vector<T> hC(size_t(ldc) * N);
+    host_vector<T> hC_gold(hC.size());
+    host_vector<T> hC_device(hC.size());
+
+    device_vector<T> dBlocks(hBlocks.size());
+    device_vector<T> dB(hB.size());
+    device_vector<T> dC(hC.size());
+    device_vector<T> d_alpha(1), d_beta(1);
+
+    hipblas_init_matrix(hBlocks,
+                        arg,
+                        bd,
+                        bd,
+                        bd,
+                        hipblasStride(bd) * bd,
+                        std::max(nnzb, 1),
+                        hipblas_client_alpha_sets_nan,
+                        true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+
+    for(int i = 0; i < block_rows; i++)
+        for(int b = row_ptr[i]; b < row_ptr[i + 1]; b++)
+            for(int jj = 0; jj < bd; jj++)
+                for(int ii = 0; ii < bd; ii++)
+                    hA[i * bd + ii + size_t(col_ind[b] * bd + jj) * std::max(M, 1)]
+                        = hBlocks[size_t(b) * bd * bd + ii + size_t(jj) * bd];
+
+    hC_gold = hC;
+    cblas_gemm<T, T, T>(HIPBLAS_OP_N,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA.data(),
+                        std::max(M, 1),
+                        hB.data(),
+                        ldb,
+                        h_beta,
+                        hC_gold.data(),
+                        ldc);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dBlocks, hBlocks, sizeof(T) * hBlocks.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    const double tol = std::max(K, 1) * (std::is_same_v<T, double> ? 1e-10 : 1e-3);
+
+    for(int device_mode = 0; device_mode < 2; device_mode++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+            handle, device_mode ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+
+        CHECK_HIPBLAS_ERROR(hipblasGemmBlockSparseEx(handle,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     bd,
+                                                     device_mode ? (T*)d_alpha : &h_alpha,
+                                                     dBlocks,
+                                                     data_type,
+                                                     row_ptr.data(),
+                                                     col_ind.data(),
+                                                     dB,
+                                                     data_type,
+                                                     ldb,
+                                                     device_mode ? (T*)d_beta : &h_beta,
+                                                     dC,
+                                                     data_type,
+                                                     ldc,
+                                                     compute_type));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+        if(arg.unit_check)
+            near_check_general<T>(M, N, ldc, hC_gold, hC_device, tol);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,228 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Reference activation of the intermediate, as in hipblasGemmEpilogueEx
+template <typename T>
+void gemm_chain_ex_reference(hipblasEpilogue_t epilogue, int M, int N, T* C, int ldc)
+{
+    for(int j = 0; j < N; j++)
+    {
+        for(int i = 0; i < M; i++)
+        {
+            double x = C[i + size_t(j) * ldc];
+            if(epilogue == HIPBLAS_EPILOGUE_RELU)
+                x = x > 0 ? x : 0;
+            else if(epilogue == HIPBLAS_EPILOGUE_GELU)
+                x = 0.5 * x * (1.0 + std::tanh(0.7978845608028654 * (x + 0.044715 * x * x * x)));
+            C[i + size_t(j) * ldc] = T(x);
+        }
+    }
+}
+
+// Checks every activation and op( E ), with the scalars on the host and on the device, against
+// two gemms on the CPU. arg.cols is the number p of columns of D.
+template <typename T>
+inline hipblasStatus_t testing_gemm_chain_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                P           = arg.cols;
+    int                batch_count = arg.batch_count;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || P < 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasGemmChainDesc_t desc;
+    desc.transA      = transA;
+    desc.transB      = transB;
+    desc.m           = M;
+    desc.n           = N;
+    desc.k           = K;
+    desc.p           = P;
+    desc.dataType    = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+    desc.lda         = std::max(1, A_row);
+    desc.strideA     = hipblasStride(desc.lda) * A_col;
+    desc.ldb         = std::max(1, B_row);
+    desc.strideB     = hipblasStride(desc.ldb) * B_col;
+    desc.lde         = std::max(N, P) + 1;
+    desc.strideE     = hipblasStride(desc.lde) * std::max(N, P);
+    desc.ldd         = M + 1;
+    desc.strideD     = hipblasStride(desc.ldd) * P;
+    desc.batchCount  = batch_count;
+    desc.computeType = std::is_same_v<T, double> ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T> hA(desc.strideA * batch_count);
+    host_vector<T> hB(desc.strideB * batch_count);
+    host_vector<T> hE(desc.strideE * batch_count);
+    host_vector<T> hD(desc.strideD * batch_count);
+    host_vector<T> hD_gold(desc.strideD * batch_count);
+    host_vector<T> hD_out(desc.strideD * batch_count);
+    host_vector<T> hT(size_t(M) * N);
+
+    device_vector<T> dA(hA.size());
+    device_vector<T> dB(hB.size());
+    device_vector<T> dE(hE.size());
+    device_vector<T> dD(hD.size());
+    device_vector<T> d_alpha1(1), d_alpha2(1), d_beta2(1);
+
+    // B has alternating signs so that the activations see negative inputs
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, desc.lda, desc.strideA, batch_count, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hB,
+                        arg,
+                        B_row,
+                        B_col,
+                        desc.ldb,
+                        desc.strideB,
+                        batch_count,
+                        hipblas_client_never_set_nan,
+                        false,
+                        true);
+    hipblas_init_matrix(hE,
+                        arg,
+                        desc.lde,
+                        std::max(N, P),
+                        desc.lde,
+                        desc.strideE,
+                        batch_count,
+                        hipblas_client_never_set_nan);
+    hipblas_init_matrix(
+        hD, arg, M, P, desc.ldd, desc.strideD, batch_count, hipblas_client_never_set_nan);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dE, hE, sizeof(T) * hE.size(), hipMemcpyHostToDevice));
+
+    T h_alpha1 = arg.get_alpha<T>(), h_alpha2 = T(0.5), h_beta2 = arg.get_beta<T>();
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha1, &h_alpha1, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha2, &h_alpha2, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta2, &h_beta2, sizeof(T), hipMemcpyHostToDevice));
+
+    desc.transE   = HIPBLAS_OP_N;
+    desc.epilogue = hipblasEpilogue_t(3);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGemmChainEx(handle, &desc, &h_alpha1, dA, dB, &h_alpha2, dE, &h_beta2, dD),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGemmChainEx(handle, nullptr, &h_alpha1, dA, dB, &h_alpha2, dE, &h_beta2, dD),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    const hipblasEpilogue_t epilogues[]
+        = {HIPBLAS_EPILOGUE_DEFAULT, HIPBLAS_EPILOGUE_RELU, HIPBLAS_EPILOGUE_GELU};
+    const hipblasOperation_t transEs[] = {HIPBLAS_OP_N, HIPBLAS_OP_T};
+
+    const double tol = std::max(K * N, 1) * (std::is_same_v<T, double> ? 1e-10 : 1e-3);
+
+    for(hipblasEpilogue_t epilogue : epilogues)
+    {
+        for(hipblasOperation_t transE : transEs)
+        {
+            desc.epilogue = epilogue;
+            desc.transE   = transE;
+
+            hD_gold = hD;
+            for(int b = 0; b < batch_count; b++)
+            {
+                cblas_gemm<T, T, T>(transA,
+                                    transB,
+                                    M,
+                                    N,
+                                    K,
+                                    h_alpha1,
+                                    hA.data() + b * desc.strideA,
+                                    desc.lda,
+                                    hB.data() + b * desc.strideB,
+                                    desc.ldb,
+                                    T(0),
+                                    hT.data(),
+                                    std::max(M, 1));
+                gemm_chain_ex_reference(epilogue, M, N, hT.data(), std::max(M, 1));
+                cblas_gemm<T, T, T>(HIPBLAS_OP_N,
+                                    transE,
+                                    M,
+                                    P,
+                                    N,
+                                    h_alpha2,
+                                    hT.data(),
+                                    std::max(M, 1),
+                                    hE.data() + b * desc.strideE,
+                                    desc.lde,
+                                    h_beta2,
+                                    hD_gold.data() + b * desc.strideD,
+                                    desc.ldd);
+            }
+
+            for(int device = 0; device < 2; device++)
+            {
+                CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+                    handle, device ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+                CHECK_HIP_ERROR(hipMemcpy(dD, hD, sizeof(T) * hD.size(), hipMemcpyHostToDevice));
+
+                CHECK_HIPBLAS_ERROR(hipblasGemmChainEx(handle,
+                                                       &desc,
+                                                       device ? (const T*)d_alpha1 : &h_alpha1,
+                                                       dA,
+                                                       dB,
+                                                       device ? (const T*)d_alpha2 : &h_alpha2,
+                                                       dE,
+                                                       device ? (const T*)d_beta2 : &h_beta2,
+                                                       dD));
+
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hD_out, dD, sizeof(T) * hD.size(), hipMemcpyDeviceToHost));
+                if(arg.unit_check)
+                    near_check_general<T>(M,
+                                          P,
+                                          batch_count,
+                                          desc.ldd,
+                                          desc.strideD,
+                                          hD_gold.data(),
+                                          hD_out.data(),
+                                          tol);
+            }
+        }
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    return HIPBLAS_STATUS_SUCCESS;
+}
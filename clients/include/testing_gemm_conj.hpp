@@ -0,0 +1,231 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGemmConjModel = ArgumentModel<e_transA,
+                                           e_transB,
+                                           e_M,
+                                           e_N,
+                                           e_K,
+                                           e_alpha,
+                                           e_lda,
+                                           e_ldb,
+                                           e_beta,
+                                           e_ldc,
+                                           e_batch_count>;
+
+inline void testname_gemm_conj(const Arguments& arg, std::string& name)
+{
+    hipblasGemmConjModel{}.test_name(arg, name);
+}
+
+// gemm and gemv with HIPBLAS_OP_CONJ ('R') in transA or transB, checked against the reference on
+// conjugated copies of the operands with HIPBLAS_OP_N
+template <typename T>
+inline hipblasStatus_t testing_gemm_conj(const Arguments& arg)
+{
+    auto hipblasGemmStridedBatchedFn = hipblasGemmStridedBatched<T>;
+    auto hipblasGemvStridedBatchedFn = hipblasGemvStridedBatched<T>;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // HIPBLAS_OP_CONJ keeps the shape of HIPBLAS_OP_N
+    bool conj_a = transA == HIPBLAS_OP_CONJ, conj_b = transB == HIPBLAS_OP_CONJ;
+    bool a_n = transA == HIPBLAS_OP_N || conj_a, b_n = transB == HIPBLAS_OP_N || conj_b;
+    int  A_row = a_n ? M : K;
+    int  A_col = a_n ? K : M;
+    int  B_row = b_n ? K : N;
+    int  B_col = b_n ? N : K;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < std::max(1, A_row) || ldb < std::max(1, B_row)
+       || ldc < std::max(1, M) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || K == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStride stride_A = size_t(lda) * A_col;
+    hipblasStride stride_B = size_t(ldb) * B_col;
+    hipblasStride stride_C = size_t(ldc) * N;
+    size_t        A_size   = stride_A * batch_count;
+    size_t        B_size   = stride_B * batch_count;
+    size_t        C_size   = stride_C * batch_count;
+
+    // The gemv runs on the same A_i, with x_i the first column of B_i and y_i the first column of
+    // C_i, where they are long enough
+    int  x_len = a_n ? A_col : A_row, y_len = a_n ? A_row : A_col;
+    bool gemv  = x_len <= B_row && y_len <= M;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size), hB(B_size), hA_ref(A_size), hB_ref(B_size);
+    host_vector<T> hC(C_size), hC_init(C_size), hC_gold(C_size), hY_gold(C_size);
+
+    device_vector<T> dA(A_size), dB(B_size), dC(C_size);
+    device_vector<T> d_alpha(1), d_beta(1);
+
+    double             hipblas_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial data on CPU
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(
+        hC_init, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+
+    auto conj_copy = [](const host_vector<T>& src, host_vector<T>& dst, bool conj) {
+        for(size_t i = 0; i < src.size(); i++)
+            dst[i] = conj ? T(src[i].real(), -src[i].imag()) : src[i];
+    };
+    conj_copy(hA, hA_ref, conj_a);
+    conj_copy(hB, hB_ref, conj_b);
+    hipblasOperation_t ref_transA = conj_a ? HIPBLAS_OP_N : transA;
+    hipblasOperation_t ref_transB = conj_b ? HIPBLAS_OP_N : transB;
+
+    hC_gold = hC_init;
+    hY_gold = hC_init;
+    for(int b = 0; b < batch_count; b++)
+    {
+        cblas_gemm<T>(ref_transA,
+                      ref_transB,
+                      M,
+                      N,
+                      K,
+                      h_alpha,
+                      hA_ref.data() + b * stride_A,
+                      lda,
+                      hB_ref.data() + b * stride_B,
+                      ldb,
+                      h_beta,
+                      hC_gold.data() + b * stride_C,
+                      ldc);
+        if(gemv)
+            cblas_gemv<T>(ref_transA,
+                          A_row,
+                          A_col,
+                          h_alpha,
+                          hA_ref.data() + b * stride_A,
+                          lda,
+                          hB.data() + b * stride_B,
+                          1,
+                          h_beta,
+                          hY_gold.data() + b * stride_C,
+                          1);
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        for(bool device_scalars : {false, true})
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+                handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+            const T* alpha = device_scalars ? (const T*)d_alpha : &h_alpha;
+            const T* beta  = device_scalars ? (const T*)d_beta : &h_beta;
+
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(T) * C_size, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            alpha,
+                                                            dA,
+                                                            lda,
+                                                            stride_A,
+                                                            dB,
+                                                            ldb,
+                                                            stride_B,
+                                                            beta,
+                                                            dC,
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count));
+            CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_gold, hC);
+            if(arg.norm_check)
+                hipblas_error = std::max(
+                    hipblas_error,
+                    norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC, batch_count));
+
+            if(!gemv)
+                continue;
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(T) * C_size, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
+                                                            transA,
+                                                            A_row,
+                                                            A_col,
+                                                            alpha,
+                                                            dA,
+                                                            lda,
+                                                            stride_A,
+                                                            dB,
+                                                            1,
+                                                            stride_B,
+                                                            beta,
+                                                            dC,
+                                                            1,
+                                                            stride_C,
+                                                            batch_count));
+            CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, batch_count, ldc, stride_C, hY_gold, hC);
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
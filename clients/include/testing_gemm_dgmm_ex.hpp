@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Checks both forms, with and without each diagonal, against gemm on the CPU on copies of A and B
+// scaled on the host, and that C is left unchanged.
+template <typename T>
+inline hipblasStatus_t testing_gemm_dgmm_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                ldd         = arg.ldd;
+    int                incx        = arg.incx;
+    int                batch_count = arg.batch_count;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M || incx <= 0
+       || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipDataType          data_type = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+    hipblasComputeType_t compute_type
+        = std::is_same_v<T, double> ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+    hipblasStride stride_A  = hipblasStride(lda) * A_col;
+    hipblasStride stride_B  = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C  = hipblasStride(ldc) * N;
+    hipblasStride stride_D  = hipblasStride(ldd) * N;
+    hipblasStride stride_xl = hipblasStride(M) * incx;
+    hipblasStride stride_xr = hipblasStride(N) * incx;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T> hA(stride_A * batch_count);
+    host_vector<T> hB(stride_B * batch_count);
+    host_vector<T> hC(stride_C * batch_count);
+    host_vector<T> hC_out(stride_C * batch_count);
+    host_vector<T> hD_gold(stride_D * batch_count);
+    host_vector<T> hD(stride_D * batch_count);
+    host_vector<T> hxl(stride_xl * batch_count);
+    host_vector<T> hxr(stride_xr * batch_count);
+
+    device_vector<T> dA(hA.size());
+    device_vector<T> dB(hB.size());
+    device_vector<T> dC(hC.size());
+    device_vector<T> dD(hD.size());
+    device_vector<T> dxl(hxl.size());
+    device_vector<T> dxr(hxr.size());
+
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hB,
+                        arg,
+                        B_row,
+                        B_col,
+                        ldb,
+                        stride_B,
+                        batch_count,
+                        hipblas_client_alpha_sets_nan,
+                        false,
+                        true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    hipblas_init_vector(hxl, arg, M, incx, stride_xl, batch_count, hipblas_client_never_set_nan);
+    hipblas_init_vector(
+        hxr, arg, N, incx, stride_xr, batch_count, hipblas_client_never_set_nan, false, true);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dxl, hxl, sizeof(T) * hxl.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dxr, hxr, sizeof(T) * hxr.size(), hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    const double tol = std::max(K, 1) * (std::is_same_v<T, double> ? 1e-10 : 1e-3);
+
+    for(int scaled = 0; scaled < 4; scaled++)
+    {
+        bool left = scaled & 1, right = scaled & 2;
+
+        // op( A ) and op( B ) scaled on the host
+        host_vector<T> hA_gold(hA), hB_gold(hB);
+        for(int b = 0; b < batch_count; b++)
+        {
+            for(int i = 0; left && i < M; i++)
+                for(int l = 0; l < K; l++)
+                    hA_gold[b * stride_A + (transA == HIPBLAS_OP_N ? i + size_t(l) * lda
+                                                                   : l + size_t(i) * lda)]
+                        *= hxl[b * stride_xl + size_t(i) * incx];
+            for(int j = 0; right && j < N; j++)
+                for(int l = 0; l < K; l++)
+                    hB_gold[b * stride_B + (transB == HIPBLAS_OP_N ? l + size_t(j) * ldb
+                                                                   : j + size_t(l) * ldb)]
+                        *= hxr[b * stride_xr + size_t(j) * incx];
+        }
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                    hD_gold[b * stride_D + i + size_t(j) * ldd]
+                        = hC[b * stride_C + i + size_t(j) * ldc];
+            cblas_gemm<T, T, T>(transA,
+                                transB,
+                                M,
+                                N,
+                                K,
+                                h_alpha,
+                                hA_gold.data() + b * stride_A,
+                                lda,
+                                hB_gold.data() + b * stride_B,
+                                ldb,
+                                h_beta,
+                                hD_gold.data() + b * stride_D,
+                                ldd);
+        }
+
+        for(int form = 0; form < 2; form++)
+        {
+            int batches = form == 0 ? std::min(batch_count, 1) : batch_count;
+
+            CHECK_HIP_ERROR(hipMemset(dD, 0, sizeof(T) * hD.size()));
+            if(form == 0)
+                CHECK_HIPBLAS_ERROR(hipblasGemmDgmmEx(handle,
+                                                      transA,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      &h_alpha,
+                                                      left ? (const T*)dxl : nullptr,
+                                                      incx,
+                                                      dA,
+                                                      data_type,
+                                                      lda,
+                                                      dB,
+                                                      data_type,
+                                                      ldb,
+                                                      right ? (const T*)dxr : nullptr,
+                                                      incx,
+                                                      &h_beta,
+                                                      dC,
+                                                      data_type,
+                                                      ldc,
+                                                      dD,
+                                                      ldd,
+                                                      compute_type));
+            else
+                CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedDgmmEx(handle,
+                                                                    transA,
+                                                                    transB,
+                                                                    M,
+                                                                    N,
+                                                                    K,
+                                                                    &h_alpha,
+                                                                    left ? (const T*)dxl : nullptr,
+                                                                    incx,
+                                                                    stride_xl,
+                                                                    dA,
+                                                                    data_type,
+                                                                    lda,
+                                                                    stride_A,
+                                                                    dB,
+                                                                    data_type,
+                                                                    ldb,
+                                                                    stride_B,
+                                                                    right ? (const T*)dxr : nullptr,
+                                                                    incx,
+                                                                    stride_xr,
+                                                                    &h_beta,
+                                                                    dC,
+                                                                    data_type,
+                                                                    ldc,
+                                                                    stride_C,
+                                                                    dD,
+                                                                    ldd,
+                                                                    stride_D,
+                                                                    batches,
+                                                                    compute_type));
+
+            CHECK_HIP_ERROR(hipMemcpy(hD, dD, sizeof(T) * hD.size(), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hC_out, dC, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+            if(arg.unit_check)
+            {
+                near_check_general<T>(M, N, batches, ldd, stride_D, hD_gold, hD, tol);
+                unit_check_general<T>(M, N, batches, ldc, stride_C, hC, hC_out);
+            }
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
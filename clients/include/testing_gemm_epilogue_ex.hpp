@@ -0,0 +1,341 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmEpilogueExModel
+    = ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc>;
+
+inline void testname_gemm_epilogue_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmEpilogueExModel{}.test_name(arg, name);
+}
+
+// Reference epilogue, applied to the result of cblas_gemm
+template <typename T>
+void gemm_epilogue_ex_reference(hipblasEpilogue_t epilogue,
+                                int               M,
+                                int               N,
+                                T*                C,
+                                int               ldc,
+                                const T*          bias,
+                                T*                aux)
+{
+    for(int j = 0; j < N; j++)
+    {
+        for(int i = 0; i < M; i++)
+        {
+            double x = C[i + size_t(j) * ldc];
+            if(epilogue & HIPBLAS_EPILOGUE_BIAS)
+                x += bias[i];
+            aux[i + size_t(j) * ldc] = T(x);
+
+            if(epilogue & HIPBLAS_EPILOGUE_RELU)
+                x = x > 0 ? x : 0;
+            else if(epilogue & HIPBLAS_EPILOGUE_GELU)
+                x = 0.5 * x * (1.0 + std::tanh(0.7978845608028654 * (x + 0.044715 * x * x * x)));
+
+            C[i + size_t(j) * ldc] = T(x);
+        }
+    }
+}
+
+// Reference reduction of the M x N matrix C
+template <typename T>
+void gemm_epilogue_reduction_reference(
+    hipblasEpilogueReduction_t reduction, int M, int N, const T* C, int ldc, T* reduce)
+{
+    bool by_column = reduction >= HIPBLAS_EPILOGUE_REDUCTION_COLUMN_SUM;
+    for(int r = 0; r < (by_column ? N : M); r++)
+    {
+        double acc = -HUGE_VAL;
+        if(reduction != HIPBLAS_EPILOGUE_REDUCTION_ROW_MAX
+           && reduction != HIPBLAS_EPILOGUE_REDUCTION_COLUMN_MAX)
+            acc = 0;
+        for(int e = 0; e < (by_column ? M : N); e++)
+        {
+            double x = by_column ? C[e + size_t(r) * ldc] : C[r + size_t(e) * ldc];
+            if(reduction == HIPBLAS_EPILOGUE_REDUCTION_ROW_MAX
+               || reduction == HIPBLAS_EPILOGUE_REDUCTION_COLUMN_MAX)
+                acc = std::max(acc, x);
+            else if(reduction == HIPBLAS_EPILOGUE_REDUCTION_ROW_SUM_SQUARES
+                    || reduction == HIPBLAS_EPILOGUE_REDUCTION_COLUMN_SUM_SQUARES)
+                acc += x * x;
+            else
+                acc += x;
+        }
+        reduce[r] = T(acc);
+    }
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_epilogue_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M   = arg.M;
+    int N   = arg.N;
+    int K   = arg.K;
+    int lda = arg.lda;
+    int ldb = arg.ldb;
+    int ldc = arg.ldc;
+
+    hipDataType          data_type = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+    hipblasComputeType_t compute_type
+        = std::is_same_v<T, double> ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    const size_t size_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC(size_C);
+    host_vector<T> hC_init(size_C);
+    host_vector<T> hC_gold(size_C);
+    host_vector<T> hAux(size_C);
+    host_vector<T> hAux_gold(size_C);
+    host_vector<T> hBias(M);
+    host_vector<T> hReduce(std::max(M, N));
+    host_vector<T> hReduce_gold(std::max(M, N));
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> dC(size_C);
+    device_vector<T> dAux(size_C);
+    device_vector<T> dBias(M);
+    device_vector<T> dReduce(std::max(M, N));
+
+    hipblasLocalHandle handle(arg);
+
+    // B and the bias have alternating signs so that the activations see negative inputs
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC_init, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    hipblas_init_vector(hBias, arg, M, 1, 0, 1, hipblas_client_never_set_nan, false, true);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBias, hBias, sizeof(T) * M, hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    auto hipblasGemmEpilogueExFn = [&](hipblasEpilogue_t epilogue, const void* bias, void* aux) {
+        return hipblasGemmEpilogueEx(handle,
+                                     transA,
+                                     transB,
+                                     M,
+                                     N,
+                                     K,
+                                     &h_alpha,
+                                     dA,
+                                     data_type,
+                                     lda,
+                                     dB,
+                                     data_type,
+                                     ldb,
+                                     &h_beta,
+                                     dC,
+                                     data_type,
+                                     ldc,
+                                     compute_type,
+                                     epilogue,
+                                     bias,
+                                     aux,
+                                     ldc);
+    };
+
+    if(M > 0 && N > 0)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemmEpilogueExFn(HIPBLAS_EPILOGUE_BIAS, nullptr, dAux),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGemmEpilogueExFn(HIPBLAS_EPILOGUE_GELU_AUX, dBias, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+    EXPECT_HIPBLAS_STATUS(hipblasGemmEpilogueExFn(hipblasEpilogue_t(3), dBias, dAux),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    const hipblasEpilogue_t epilogues[] = {HIPBLAS_EPILOGUE_DEFAULT,
+                                           HIPBLAS_EPILOGUE_RELU,
+                                           HIPBLAS_EPILOGUE_BIAS,
+                                           HIPBLAS_EPILOGUE_RELU_BIAS,
+                                           HIPBLAS_EPILOGUE_GELU,
+                                           HIPBLAS_EPILOGUE_GELU_BIAS,
+                                           HIPBLAS_EPILOGUE_GELU_AUX,
+                                           HIPBLAS_EPILOGUE_GELU_AUX_BIAS};
+
+    const double tol = K * (std::is_same_v<T, double> ? 1e-10 : 1e-3);
+
+    for(hipblasEpilogue_t epilogue : epilogues)
+    {
+        bool has_aux = (epilogue & HIPBLAS_EPILOGUE_GELU_AUX) == HIPBLAS_EPILOGUE_GELU_AUX;
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasGemmEpilogueExFn(epilogue, dBias, dAux));
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hAux, dAux, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        hC_gold = hC_init;
+        cblas_gemm<T, T, T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hA.data(),
+                            lda,
+                            hB.data(),
+                            ldb,
+                            h_beta,
+                            hC_gold.data(),
+                            ldc);
+        gemm_epilogue_ex_reference(
+            epilogue, M, N, hC_gold.data(), ldc, hBias.data(), hAux_gold.data());
+
+        if(arg.unit_check)
+        {
+            near_check_general<T>(M, N, ldc, hC_gold.data(), hC.data(), tol);
+            if(has_aux)
+                near_check_general<T>(M, N, ldc, hAux_gold.data(), hAux.data(), tol);
+        }
+    }
+
+    // The reductions of hipblasGemmEpilogueReductionEx, of C after the epilogue
+    auto hipblasGemmEpilogueReductionExFn = [&](hipblasEpilogue_t          epilogue,
+                                                hipblasEpilogueReduction_t reduction,
+                                                void*                      reduce) {
+        return hipblasGemmEpilogueReductionEx(handle,
+                                              transA,
+                                              transB,
+                                              M,
+                                              N,
+                                              K,
+                                              &h_alpha,
+                                              dA,
+                                              data_type,
+                                              lda,
+                                              dB,
+                                              data_type,
+                                              ldb,
+                                              &h_beta,
+                                              dC,
+                                              data_type,
+                                              ldc,
+                                              compute_type,
+                                              epilogue,
+                                              dBias,
+                                              dAux,
+                                              ldc,
+                                              reduction,
+                                              reduce);
+    };
+
+    if(M > 0 && N > 0)
+        EXPECT_HIPBLAS_STATUS(hipblasGemmEpilogueReductionExFn(HIPBLAS_EPILOGUE_DEFAULT,
+                                                               HIPBLAS_EPILOGUE_REDUCTION_ROW_SUM,
+                                                               nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmEpilogueReductionExFn(
+                              HIPBLAS_EPILOGUE_DEFAULT, hipblasEpilogueReduction_t(4), dReduce),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    const hipblasEpilogueReduction_t reductions[]
+        = {HIPBLAS_EPILOGUE_REDUCTION_ROW_SUM,
+           HIPBLAS_EPILOGUE_REDUCTION_ROW_SUM_SQUARES,
+           HIPBLAS_EPILOGUE_REDUCTION_ROW_MAX,
+           HIPBLAS_EPILOGUE_REDUCTION_COLUMN_SUM,
+           HIPBLAS_EPILOGUE_REDUCTION_COLUMN_SUM_SQUARES,
+           HIPBLAS_EPILOGUE_REDUCTION_COLUMN_MAX};
+
+    for(hipblasEpilogue_t epilogue : {HIPBLAS_EPILOGUE_DEFAULT, HIPBLAS_EPILOGUE_GELU_BIAS})
+    {
+        for(hipblasEpilogueReduction_t reduction : reductions)
+        {
+            int  size_reduce = reduction >= HIPBLAS_EPILOGUE_REDUCTION_COLUMN_SUM ? N : M;
+            bool squares     = reduction == HIPBLAS_EPILOGUE_REDUCTION_ROW_SUM_SQUARES
+                           || reduction == HIPBLAS_EPILOGUE_REDUCTION_COLUMN_SUM_SQUARES;
+
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(T) * size_C, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasGemmEpilogueReductionExFn(epilogue, reduction, dReduce));
+            CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(
+                hReduce, dReduce, sizeof(T) * size_reduce, hipMemcpyDeviceToHost));
+
+            hC_gold = hC_init;
+            cblas_gemm<T, T, T>(transA,
+                                transB,
+                                M,
+                                N,
+                                K,
+                                h_alpha,
+                                hA.data(),
+                                lda,
+                                hB.data(),
+                                ldb,
+                                h_beta,
+                                hC_gold.data(),
+                                ldc);
+            gemm_epilogue_ex_reference(
+                epilogue, M, N, hC_gold.data(), ldc, hBias.data(), hAux_gold.data());
+
+            // The reference reduces the gpu result, so only the order of the sums differs
+            gemm_epilogue_reduction_reference(
+                reduction, M, N, hC.data(), ldc, hReduce_gold.data());
+
+            if(arg.unit_check)
+            {
+                near_check_general<T>(M, N, ldc, hC_gold.data(), hC.data(), tol);
+                for(int r = 0; r < size_reduce; r++)
+                {
+                    double scale = std::max(1.0, std::abs(double(hReduce_gold[r])));
+                    EXPECT_NEAR(hReduce_gold[r], hReduce[r], scale * (squares ? 2 : 1) * tol);
+                }
+            }
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
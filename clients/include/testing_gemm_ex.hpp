@@ -90,12 +90,15 @@ inline hipblasStatus_t testing_gemm_ex_template(const Arguments& arg)
     const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
     const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
 
+    // Host data only when verifying, otherwise the matrices are initialized on the device
+    bool host_init = hipblas_host_init(arg);
+
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
-    host_vector<Ta> hA(size_A);
-    host_vector<Tb> hB(size_B);
-    host_vector<Tc> hC_host(size_C);
-    host_vector<Tc> hC_device(size_C);
-    host_vector<Tc> hC_gold(size_C);
+    host_vector<Ta> hA(host_init ? size_A : 0);
+    host_vector<Tb> hB(host_init ? size_B : 0);
+    host_vector<Tc> hC_host(host_init ? size_C : 0);
+    host_vector<Tc> hC_device(host_init ? size_C : 0);
+    host_vector<Tc> hC_gold(host_init ? size_C : 0);
 
     device_vector<Ta>  dA(size_A);
     device_vector<Tb>  dB(size_B);
@@ -106,20 +109,30 @@ inline hipblasStatus_t testing_gemm_ex_template(const Arguments& arg)
     double             gpu_time_used, hipblas_error_host, hipblas_error_device;
     hipblasLocalHandle handle(arg);
 
-    // Initial Data on CPU
-    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
-    hipblas_init_matrix(
-        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
-    hipblas_init_matrix(hC_host, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    if(host_init)
+    {
+        // Initial Data on CPU
+        hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+        hipblas_init_matrix(hC_host, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
 
-    hC_gold = hC_device = hC_host;
+        hC_gold = hC_device = hC_host;
 
-    // copy data from CPU to device
+        // copy data from CPU to device
 
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * size_A, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Tb) * size_B, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Tb) * size_B, hipMemcpyHostToDevice));
 
-    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+    }
+    else
+    {
+        hipblas_init_matrix(dA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            dB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+        hipblas_init_matrix(dC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    }
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
 
@@ -228,11 +241,14 @@ inline hipblasStatus_t testing_gemm_ex_template(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmExFn(handle,
                                                 transA,
@@ -258,6 +274,7 @@ inline hipblasStatus_t testing_gemm_ex_template(const Arguments& arg)
 #endif
                                                 algo));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemmExModel{}.log_args<Tc>(std::cout,
@@ -416,3 +433,352 @@ inline hipblasStatus_t testing_gemm_ex(const Arguments& arg)
 }
 
 #endif
+
+// A complex matrix times a real one, through each form of the call, with the scalars in host and
+// in device memory, against the real operand expanded to complex
+template <typename T>
+inline hipblasStatus_t testing_gemm_ex_mixed_complex_template(const Arguments& arg)
+{
+    using R = real_t<T>;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    const int batch_count = 2;
+
+    bool                 single       = std::is_same<T, hipblasComplex>{};
+    hipDataType          c_type       = single ? HIP_C_32F : HIP_C_64F;
+    hipDataType          r_type       = single ? HIP_R_32F : HIP_R_64F;
+    hipblasComputeType_t compute_type = single ? HIPBLAS_COMPUTE_32F : HIPBLAS_COMPUTE_64F;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    hipblasLocalHandle handle(arg);
+
+    for(int a_complex = 0; a_complex < 2; a_complex++)
+    {
+        int           X_row    = a_complex ? A_row : B_row;
+        int           X_col    = a_complex ? A_col : B_col;
+        int           ldx      = a_complex ? lda : ldb;
+        hipblasStride stride_X = a_complex ? stride_A : stride_B;
+        int           Y_row    = a_complex ? B_row : A_row;
+        int           Y_col    = a_complex ? B_col : A_col;
+        int           ldy      = a_complex ? ldb : lda;
+        hipblasStride stride_Y = a_complex ? stride_B : stride_A;
+
+        // X is the complex operand and Y the real one, Y_expanded is Y as complex
+        host_vector<T> hX(stride_X * batch_count);
+        host_vector<R> hY(stride_Y * batch_count);
+        host_vector<T> hY_expanded(stride_Y * batch_count);
+        host_vector<T> hC(stride_C * batch_count);
+        host_vector<T> hC_init(stride_C * batch_count);
+        host_vector<T> hC_gold(stride_C * batch_count);
+
+        device_vector<T>     dX(hX.size());
+        device_vector<R>     dY(hY.size());
+        device_vector<T>     dC(hC.size());
+        device_vector<T>     d_alpha(1);
+        device_vector<T>     d_beta(1);
+        device_vector<void*> dX_array(batch_count);
+        device_vector<void*> dY_array(batch_count);
+        device_vector<void*> dC_array(batch_count);
+
+        hipblas_init_matrix(
+            hX, arg, X_row, X_col, ldx, stride_X, batch_count, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            hY, arg, Y_row, Y_col, ldy, stride_Y, batch_count, hipblas_client_alpha_sets_nan);
+        hipblas_init_matrix(
+            hC_init, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+        for(size_t i = 0; i < hY.size(); i++)
+            hY_expanded[i] = T(hY[i]);
+
+        hC_gold = hC_init;
+        for(int b = 0; b < batch_count; b++)
+        {
+            const T* hA = a_complex ? hX.data() + b * stride_X : hY_expanded.data() + b * stride_Y;
+            const T* hB = a_complex ? hY_expanded.data() + b * stride_Y : hX.data() + b * stride_X;
+            cblas_gemm<T, T, T>(transA,
+                                transB,
+                                M,
+                                N,
+                                K,
+                                h_alpha,
+                                hA,
+                                lda,
+                                hB,
+                                ldb,
+                                h_beta,
+                                hC_gold.data() + b * stride_C,
+                                ldc);
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(dX, hX, sizeof(T) * hX.size(), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dY, hY, sizeof(R) * hY.size(), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(
+            hipblasFillPointerArray(handle, dX_array, dX, sizeof(T), stride_X, batch_count));
+        CHECK_HIPBLAS_ERROR(
+            hipblasFillPointerArray(handle, dY_array, dY, sizeof(R), stride_Y, batch_count));
+        CHECK_HIPBLAS_ERROR(
+            hipblasFillPointerArray(handle, dC_array, dC, sizeof(T), stride_C, batch_count));
+
+        const void*  dA       = a_complex ? (const void*)dX : (const void*)dY;
+        const void*  dB       = a_complex ? (const void*)dY : (const void*)dX;
+        const void** dA_array = (const void**)(a_complex ? (void**)dX_array : (void**)dY_array);
+        const void** dB_array = (const void**)(a_complex ? (void**)dY_array : (void**)dX_array);
+        hipDataType  a_type   = a_complex ? c_type : r_type;
+        hipDataType  b_type   = a_complex ? r_type : c_type;
+
+        for(int device_scalars = 0; device_scalars < 2; device_scalars++)
+        {
+            const T* alpha = device_scalars ? (const T*)d_alpha : &h_alpha;
+            const T* beta  = device_scalars ? (const T*)d_beta : &h_beta;
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+                handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+
+            for(int form = 0; form < 3; form++)
+            {
+                int batches = form == 0 ? 1 : batch_count;
+
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dC, hC_init, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+                if(form == 0)
+                    CHECK_HIPBLAS_ERROR(hipblasGemmEx_v2(handle,
+                                                         transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         alpha,
+                                                         dA,
+                                                         a_type,
+                                                         lda,
+                                                         dB,
+                                                         b_type,
+                                                         ldb,
+                                                         beta,
+                                                         dC,
+                                                         c_type,
+                                                         ldc,
+                                                         compute_type,
+                                                         HIPBLAS_GEMM_DEFAULT));
+                else if(form == 1)
+                    CHECK_HIPBLAS_ERROR(hipblasGemmBatchedEx_v2(handle,
+                                                                transA,
+                                                                transB,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                alpha,
+                                                                dA_array,
+                                                                a_type,
+                                                                lda,
+                                                                dB_array,
+                                                                b_type,
+                                                                ldb,
+                                                                beta,
+                                                                dC_array,
+                                                                c_type,
+                                                                ldc,
+                                                                batches,
+                                                                compute_type,
+                                                                HIPBLAS_GEMM_DEFAULT));
+                else
+                    CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedEx_v2(handle,
+                                                                       transA,
+                                                                       transB,
+                                                                       M,
+                                                                       N,
+                                                                       K,
+                                                                       alpha,
+                                                                       dA,
+                                                                       a_type,
+                                                                       lda,
+                                                                       stride_A,
+                                                                       dB,
+                                                                       b_type,
+                                                                       ldb,
+                                                                       stride_B,
+                                                                       beta,
+                                                                       dC,
+                                                                       c_type,
+                                                                       ldc,
+                                                                       stride_C,
+                                                                       batches,
+                                                                       compute_type,
+                                                                       HIPBLAS_GEMM_DEFAULT));
+                CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+
+                if(arg.unit_check)
+                    unit_check_general<T>(M, N, batches, ldc, stride_C, hC_gold, hC);
+            }
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_gemm_ex_mixed_complex(const Arguments& arg)
+{
+    if(arg.c_type == HIPBLAS_C_32F)
+        return testing_gemm_ex_mixed_complex_template<hipblasComplex>(arg);
+    else if(arg.c_type == HIPBLAS_C_64F)
+        return testing_gemm_ex_mixed_complex_template<hipblasDoubleComplex>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Repeats one real gemm shape on a handle, alternating between two sets of operands and between
+// host and device scalars. With HIPBLAS_GEMM_LT set on the cuBLAS backend the first call picks the
+// cuBLASLt heuristic and every later call runs the one cached for the shape, so each result checks
+// that the cached entry holds nothing tied to the operands or pointer mode of the call that made it.
+template <typename T>
+inline hipblasStatus_t testing_gemm_ex_lt_cache_template(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    const int sets  = 2;
+    const int calls = 4;
+
+    bool                 single       = std::is_same<T, float>{};
+    hipDataType          type         = single ? HIP_R_32F : HIP_R_64F;
+    hipblasComputeType_t compute_type = single ? HIPBLAS_COMPUTE_32F : HIPBLAS_COMPUTE_64F;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    hipblasLocalHandle handle(arg);
+
+    // each set is one batch of the host and device buffers
+    host_vector<T> hA(stride_A * sets);
+    host_vector<T> hB(stride_B * sets);
+    host_vector<T> hC(stride_C * sets);
+    host_vector<T> hC_init(stride_C * sets);
+    host_vector<T> hC_gold(stride_C * sets);
+
+    device_vector<T> dA(hA.size());
+    device_vector<T> dB(hB.size());
+    device_vector<T> dC(hC.size());
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, sets, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hB, arg, B_row, B_col, ldb, stride_B, sets, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(hC_init, arg, M, N, ldc, stride_C, sets, hipblas_client_beta_sets_nan);
+
+    hC_gold = hC_init;
+    for(int s = 0; s < sets; s++)
+        cblas_gemm<T, T, T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hA.data() + s * stride_A,
+                            lda,
+                            hB.data() + s * stride_B,
+                            ldb,
+                            h_beta,
+                            hC_gold.data() + s * stride_C,
+                            ldc);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    for(int call = 0; call < calls; call++)
+    {
+        int  s              = call % sets;
+        bool device_scalars = call / sets;
+
+        const T* alpha = device_scalars ? (const T*)d_alpha : &h_alpha;
+        const T* beta  = device_scalars ? (const T*)d_beta : &h_beta;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+            handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasGemmEx_v2(handle,
+                                             transA,
+                                             transB,
+                                             M,
+                                             N,
+                                             K,
+                                             alpha,
+                                             (T*)dA + s * stride_A,
+                                             type,
+                                             lda,
+                                             (T*)dB + s * stride_B,
+                                             type,
+                                             ldb,
+                                             beta,
+                                             (T*)dC + s * stride_C,
+                                             type,
+                                             ldc,
+                                             compute_type,
+                                             HIPBLAS_GEMM_DEFAULT));
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+            unit_check_general<T>(
+                M, N, ldc, hC_gold.data() + s * stride_C, hC.data() + s * stride_C);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_gemm_ex_lt_cache(const Arguments& arg)
+{
+    if(arg.a_type != arg.b_type || arg.a_type != arg.c_type || arg.a_type != arg.compute_type)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(arg.a_type == HIPBLAS_R_32F)
+        return testing_gemm_ex_lt_cache_template<float>(arg);
+    else if(arg.a_type == HIPBLAS_R_64F)
+        return testing_gemm_ex_lt_cache_template<double>(arg);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,292 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// A combination of hipblasGemmEx types timed by gemm_ex_frontier. A and B have ab_type, and
+// slices > 0 runs the fp64 gemm with hipblasSetGemmFp64Emulation using that many int8 slices.
+struct hipblas_gemm_ex_frontier_case
+{
+    const char*          ab_name;
+    const char*          c_name;
+    hipDataType          ab_type;
+    hipDataType          c_type;
+    hipblasComputeType_t compute_type;
+    int                  slices;
+};
+
+// Result of a case, with negative times and errors when the call failed
+struct hipblas_gemm_ex_frontier_result
+{
+    hipblasStatus_t status    = HIPBLAS_STATUS_SUCCESS;
+    double          us        = -1;
+    double          abs_error = -1;
+    double          rel_error = -1;
+};
+
+inline size_t hipblas_frontier_type_size(hipDataType type)
+{
+    return type == HIP_R_16F || type == HIP_R_16BF ? 2 : type == HIP_R_32F ? 4 : 8;
+}
+
+// Copies the values of h to d as elements of type, rounded to nearest
+inline void hipblas_frontier_upload(const std::vector<double>& h, hipDataType type, void* d)
+{
+    std::vector<char> bytes(h.size() * hipblas_frontier_type_size(type));
+    for(size_t i = 0; i < h.size(); i++)
+    {
+        if(type == HIP_R_16F)
+            reinterpret_cast<hipblasHalf*>(bytes.data())[i] = float_to_half(float(h[i]));
+        else if(type == HIP_R_16BF)
+            reinterpret_cast<hipblasBfloat16*>(bytes.data())[i] = float_to_bfloat16(float(h[i]));
+        else if(type == HIP_R_32F)
+            reinterpret_cast<float*>(bytes.data())[i] = float(h[i]);
+        else
+            reinterpret_cast<double*>(bytes.data())[i] = h[i];
+    }
+    CHECK_HIP_ERROR(hipMemcpy(d, bytes.data(), bytes.size(), hipMemcpyHostToDevice));
+}
+
+// Copies the elements of type of d to h as doubles
+inline void hipblas_frontier_download(const void* d, hipDataType type, std::vector<double>& h)
+{
+    std::vector<char> bytes(h.size() * hipblas_frontier_type_size(type));
+    CHECK_HIP_ERROR(hipMemcpy(bytes.data(), d, bytes.size(), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < h.size(); i++)
+    {
+        if(type == HIP_R_16F)
+            h[i] = half_to_float(reinterpret_cast<const hipblasHalf*>(bytes.data())[i]);
+        else if(type == HIP_R_16BF)
+            h[i] = bfloat16_to_float(reinterpret_cast<const hipblasBfloat16*>(bytes.data())[i]);
+        else if(type == HIP_R_32F)
+            h[i] = reinterpret_cast<const float*>(bytes.data())[i];
+        else
+            h[i] = reinterpret_cast<const double*>(bytes.data())[i];
+    }
+}
+
+// Runs hipblasGemmEx on the matrices of arg, initialized in precision T, with every real
+// combination of types of hipblasInternalGemmExTypes and the emulated compute types, and prints
+// for each its time and its errors against hipblasDgemm on the same matrices. The maximum error
+// is that of the elements and the relative error that of the Frobenius norm. A case is on the
+// frontier when no other case is both faster and has a smaller relative error.
+template <typename T>
+inline hipblasStatus_t testing_gemm_ex_frontier(const Arguments& arg)
+{
+    if(!arg.timing)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    static const hipblas_gemm_ex_frontier_case cases[] = {
+        {"f16_r", "f16_r", HIP_R_16F, HIP_R_16F, HIPBLAS_COMPUTE_16F, 0},
+        {"f16_r", "f16_r", HIP_R_16F, HIP_R_16F, HIPBLAS_COMPUTE_32F, 0},
+        {"f16_r", "f32_r", HIP_R_16F, HIP_R_32F, HIPBLAS_COMPUTE_32F, 0},
+        {"bf16_r", "bf16_r", HIP_R_16BF, HIP_R_16BF, HIPBLAS_COMPUTE_32F, 0},
+        {"bf16_r", "f32_r", HIP_R_16BF, HIP_R_32F, HIPBLAS_COMPUTE_32F, 0},
+        {"f32_r", "f32_r", HIP_R_32F, HIP_R_32F, HIPBLAS_COMPUTE_32F_FAST_16F, 0},
+        {"f32_r", "f32_r", HIP_R_32F, HIP_R_32F, HIPBLAS_COMPUTE_32F_FAST_16BF, 0},
+        {"f32_r", "f32_r", HIP_R_32F, HIP_R_32F, HIPBLAS_COMPUTE_32F_FAST_TF32, 0},
+        {"f32_r", "f32_r", HIP_R_32F, HIP_R_32F, HIPBLAS_COMPUTE_32F_FAST_16BFX3, 0},
+        {"f32_r", "f32_r", HIP_R_32F, HIP_R_32F, HIPBLAS_COMPUTE_32F, 0},
+        {"f64_r", "f64_r", HIP_R_64F, HIP_R_64F, HIPBLAS_COMPUTE_64F, 4},
+        {"f64_r", "f64_r", HIP_R_64F, HIP_R_64F, HIPBLAS_COMPUTE_64F, 8},
+        {"f64_r", "f64_r", HIP_R_64F, HIP_R_64F, HIPBLAS_COMPUTE_64F, 0},
+    };
+    constexpr size_t n_cases = sizeof(cases) / sizeof(cases[0]);
+
+    size_t size_A = size_t(lda) * A_col;
+    size_t size_B = size_t(ldb) * B_col;
+    size_t size_C = size_t(ldc) * N;
+
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC(size_C);
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_never_set_nan);
+
+    std::vector<double> A(hA.begin(), hA.end());
+    std::vector<double> B(hB.begin(), hB.end());
+    std::vector<double> C(hC.begin(), hC.end());
+    std::vector<double> C_ref(size_C), C_out(size_C);
+
+    // Storage of the largest type for every case
+    device_vector<double> dA(size_A);
+    device_vector<double> dB(size_B);
+    device_vector<double> dC(size_C);
+
+    hipblasLocalHandle handle(arg);
+    hipStream_t        stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    double alpha = arg.get_alpha<double>();
+    double beta  = arg.get_beta<double>();
+
+    // The fp64 reference
+    hipblas_frontier_upload(A, HIP_R_64F, dA);
+    hipblas_frontier_upload(B, HIP_R_64F, dB);
+    hipblas_frontier_upload(C, HIP_R_64F, dC);
+    CHECK_HIPBLAS_ERROR(hipblasGemm<double>(
+        handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc));
+    hipblas_frontier_download(dC, HIP_R_64F, C_ref);
+
+    double ref_norm = 0;
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < M; i++)
+            ref_norm += C_ref[i + size_t(j) * ldc] * C_ref[i + size_t(j) * ldc];
+    ref_norm = std::sqrt(ref_norm);
+
+    hipblas_gemm_ex_frontier_result results[n_cases];
+    for(size_t c = 0; c < n_cases; c++)
+    {
+        const hipblas_gemm_ex_frontier_case& test   = cases[c];
+        hipblas_gemm_ex_frontier_result&     result = results[c];
+
+        // The scalars have the type of the compute type
+        hipblasHalf alpha_h = float_to_half(float(alpha)), beta_h = float_to_half(float(beta));
+        float       alpha_s = float(alpha), beta_s = float(beta);
+        const void* alpha_p = &alpha_s;
+        const void* beta_p  = &beta_s;
+        if(test.compute_type == HIPBLAS_COMPUTE_16F)
+        {
+            alpha_p = &alpha_h;
+            beta_p  = &beta_h;
+        }
+        else if(test.compute_type == HIPBLAS_COMPUTE_64F)
+        {
+            alpha_p = &alpha;
+            beta_p  = &beta;
+        }
+
+        hipblas_frontier_upload(A, test.ab_type, dA);
+        hipblas_frontier_upload(B, test.ab_type, dB);
+        hipblas_frontier_upload(C, test.c_type, dC);
+
+        if(test.slices)
+            result.status = hipblasSetGemmFp64Emulation(
+                handle, HIPBLAS_GEMM_FP64_EMULATION_INT8, test.slices);
+
+        auto gemm_ex = [&] {
+            return hipblasGemmEx_v2(handle,
+                                    transA,
+                                    transB,
+                                    M,
+                                    N,
+                                    K,
+                                    alpha_p,
+                                    dA,
+                                    test.ab_type,
+                                    lda,
+                                    dB,
+                                    test.ab_type,
+                                    ldb,
+                                    beta_p,
+                                    dC,
+                                    test.c_type,
+                                    ldc,
+                                    test.compute_type,
+                                    HIPBLAS_GEMM_DEFAULT);
+        };
+
+        if(result.status == HIPBLAS_STATUS_SUCCESS)
+            result.status = gemm_ex();
+        if(result.status == HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_frontier_download(dC, test.c_type, C_out);
+
+            double diff_norm = 0;
+            result.abs_error = 0;
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                {
+                    double diff      = C_out[i + size_t(j) * ldc] - C_ref[i + size_t(j) * ldc];
+                    result.abs_error = std::max(result.abs_error, std::abs(diff));
+                    diff_norm += diff * diff;
+                }
+            result.rel_error = ref_norm ? std::sqrt(diff_norm) / ref_norm : std::sqrt(diff_norm);
+
+            for(int iter = 1; iter < arg.cold_iters; iter++)
+                CHECK_HIPBLAS_ERROR(gemm_ex());
+
+            int    iters         = std::max(1, arg.iters);
+            double gpu_time_used = get_time_us_sync(stream);
+            for(int iter = 0; iter < iters; iter++)
+                CHECK_HIPBLAS_ERROR(gemm_ex());
+            result.us = (get_time_us_sync(stream) - gpu_time_used) / iters;
+        }
+
+        if(test.slices)
+            CHECK_HIPBLAS_ERROR(
+                hipblasSetGemmFp64Emulation(handle, HIPBLAS_GEMM_FP64_EMULATION_OFF, 0));
+    }
+
+    std::cout << "transA,transB,M,N,K,a_type,c_type,compute_type,fp64_emulation_slices,status,"
+                 "hipblas-Gflops,hipblas-us,max-error,relative-error,frontier"
+              << std::endl;
+    for(size_t c = 0; c < n_cases; c++)
+    {
+        const hipblas_gemm_ex_frontier_result& result = results[c];
+
+        bool ok       = result.status == HIPBLAS_STATUS_SUCCESS;
+        bool frontier = ok;
+        for(size_t other = 0; other < n_cases && frontier; other++)
+            frontier = results[other].status != HIPBLAS_STATUS_SUCCESS
+                       || !(results[other].us < result.us
+                            && results[other].rel_error < result.rel_error);
+
+        double gflops = ok && result.us > 0 ? gemm_gflop_count<double>(M, N, K) / result.us * 1e6
+                                             : -1;
+        std::cout << arg.transA << "," << arg.transB << "," << M << "," << N << "," << K << ","
+                  << cases[c].ab_name << "," << cases[c].c_name << ","
+                  << hipblas_computetype2string(cases[c].compute_type) << "," << cases[c].slices
+                  << "," << hipblasStatusToString(result.status) << "," << gflops << ","
+                  << result.us << "," << result.abs_error << "," << result.rel_error << ","
+                  << frontier << std::endl;
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,193 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExSolutionsModel
+    = ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc>;
+
+inline void testname_gemm_ex_solutions(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExSolutionsModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_ex_solutions(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M   = arg.M;
+    int N   = arg.N;
+    int K   = arg.K;
+    int lda = arg.lda;
+    int ldb = arg.ldb;
+    int ldc = arg.ldc;
+
+    hipDataType          data_type = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+    hipblasComputeType_t compute_type
+        = std::is_same_v<T, double> ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    const size_t size_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC(size_C);
+    host_vector<T> hC_init(size_C);
+    host_vector<T> hC_gold(size_C);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> dC(size_C);
+
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC_init, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+
+    hC_gold = hC_init;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    auto hipblasGemmExGetSolutionsFn = [&](uint32_t flags, int* list, int* size) {
+        return hipblasGemmExGetSolutions(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         &h_alpha,
+                                         dA,
+                                         data_type,
+                                         lda,
+                                         dB,
+                                         data_type,
+                                         ldb,
+                                         &h_beta,
+                                         dC,
+                                         data_type,
+                                         ldc,
+                                         compute_type,
+                                         flags,
+                                         list,
+                                         size);
+    };
+
+    auto hipblasGemmExWithSolutionFn = [&](int solution_index, uint32_t flags) {
+        return hipblasGemmExWithSolution(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         &h_alpha,
+                                         dA,
+                                         data_type,
+                                         lda,
+                                         dB,
+                                         data_type,
+                                         ldb,
+                                         &h_beta,
+                                         dC,
+                                         data_type,
+                                         ldc,
+                                         compute_type,
+                                         solution_index,
+                                         flags);
+    };
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmExGetSolutionsFn(HIPBLAS_GEMM_FLAGS_NONE, nullptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Query the number of solutions, then the solutions themselves
+    int size = 0;
+    CHECK_HIPBLAS_ERROR(hipblasGemmExGetSolutionsFn(HIPBLAS_GEMM_FLAGS_NONE, nullptr, &size));
+
+    std::vector<int> solutions(size);
+    CHECK_HIPBLAS_ERROR(
+        hipblasGemmExGetSolutionsFn(HIPBLAS_GEMM_FLAGS_NONE, solutions.data(), &size));
+
+    // The default (0) and the first few listed solutions must all give the reference result
+    std::vector<int> tested = {0};
+    for(int i = 0; i < size && i < 3; i++)
+        tested.push_back(solutions[i]);
+
+    cblas_gemm<T, T, T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA.data(),
+                        lda,
+                        hB.data(),
+                        ldb,
+                        h_beta,
+                        hC_gold.data(),
+                        ldc);
+
+    for(int solution_index : tested)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasGemmExWithSolutionFn(solution_index, HIPBLAS_GEMM_FLAGS_NONE));
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, ldc, hC_gold.data(), hC.data());
+    }
+
+    // An index that is not a solution is rejected when asked to check it
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGemmExWithSolutionFn(1 << 30, HIPBLAS_GEMM_FLAGS_CHECK_SOLUTION_INDEX),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,317 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmGroupedBatchedExModel = ArgumentModel<e_transA,
+                                                       e_transB,
+                                                       e_M,
+                                                       e_N,
+                                                       e_K,
+                                                       e_alpha,
+                                                       e_lda,
+                                                       e_ldb,
+                                                       e_beta,
+                                                       e_ldc,
+                                                       e_batch_count>;
+
+inline void testname_gemm_grouped_batched_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmGroupedBatchedExModel{}.test_name(arg, name);
+}
+
+// hipDataType and hipblasComputeType_t matching the client types
+template <typename T>
+constexpr hipDataType hipblas_grouped_datatype = HIP_R_32F;
+template <>
+constexpr hipDataType hipblas_grouped_datatype<hipblasHalf> = HIP_R_16F;
+template <>
+constexpr hipDataType hipblas_grouped_datatype<hipblasBfloat16> = HIP_R_16BF;
+template <>
+constexpr hipDataType hipblas_grouped_datatype<double> = HIP_R_64F;
+template <>
+constexpr hipDataType hipblas_grouped_datatype<int8_t> = HIP_R_8I;
+template <>
+constexpr hipDataType hipblas_grouped_datatype<int32_t> = HIP_R_32I;
+template <>
+constexpr hipDataType hipblas_grouped_datatype<hipblasComplex> = HIP_C_32F;
+template <>
+constexpr hipDataType hipblas_grouped_datatype<hipblasDoubleComplex> = HIP_C_64F;
+
+template <typename T>
+constexpr hipblasComputeType_t hipblas_grouped_compute_type = HIPBLAS_COMPUTE_32F;
+template <>
+constexpr hipblasComputeType_t hipblas_grouped_compute_type<hipblasHalf> = HIPBLAS_COMPUTE_16F;
+template <>
+constexpr hipblasComputeType_t hipblas_grouped_compute_type<double> = HIPBLAS_COMPUTE_64F;
+template <>
+constexpr hipblasComputeType_t hipblas_grouped_compute_type<int32_t> = HIPBLAS_COMPUTE_32I;
+template <>
+constexpr hipblasComputeType_t hipblas_grouped_compute_type<hipblasDoubleComplex>
+    = HIPBLAS_COMPUTE_64F;
+
+template <typename Ta, typename Tb = Ta, typename Tc = Tb, typename Tex = Tc>
+inline hipblasStatus_t testing_gemm_grouped_batched_ex_template(const Arguments& arg)
+{
+    // Group g multiplies (M + g) x (K + g) by (K + g) x (N + g) matrices, batch_count times
+    const int group_count = 3;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M = arg.M;
+    int N = arg.N;
+    int K = arg.K;
+
+    int lda = arg.lda;
+    int ldb = arg.ldb;
+    int ldc = arg.ldc;
+
+    int batch_count = arg.batch_count;
+
+    hipDataType          a_type       = hipblas_grouped_datatype<Ta>;
+    hipDataType          b_type       = hipblas_grouped_datatype<Tb>;
+    hipDataType          c_type       = hipblas_grouped_datatype<Tc>;
+    hipblasComputeType_t compute_type = hipblas_grouped_compute_type<Tex>;
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    std::vector<hipblasOperation_t> transA_array(group_count, transA);
+    std::vector<hipblasOperation_t> transB_array(group_count, transB);
+    std::vector<int>                M_array(group_count);
+    std::vector<int>                N_array(group_count);
+    std::vector<int>                K_array(group_count);
+    std::vector<int>                lda_array(group_count);
+    std::vector<int>                ldb_array(group_count);
+    std::vector<int>                ldc_array(group_count);
+    std::vector<int>                group_size(group_count, batch_count);
+    std::vector<Tex>                h_alpha_array(group_count, h_alpha_Tex);
+    std::vector<Tex>                h_beta_array(group_count, h_beta_Tex);
+
+    for(int g = 0; g < group_count; g++)
+    {
+        M_array[g]   = M + g;
+        N_array[g]   = N + g;
+        K_array[g]   = K + g;
+        lda_array[g] = lda + g;
+        ldb_array[g] = ldb + g;
+        ldc_array[g] = ldc + g;
+    }
+
+    // The last group is the largest, every problem is allocated with its size
+    const int    last        = group_count - 1;
+    const int    total_count = group_count * batch_count;
+    const size_t size_A      = static_cast<size_t>(lda_array[last]) * (A_col + last);
+    const size_t size_B      = static_cast<size_t>(ldb_array[last]) * (B_col + last);
+    const size_t size_C      = static_cast<size_t>(ldc_array[last]) * N_array[last];
+
+    device_batch_vector<Ta> dA(size_A, 1, total_count);
+    device_batch_vector<Tb> dB(size_B, 1, total_count);
+    device_batch_vector<Tc> dC(size_C, 1, total_count);
+    device_vector<Tex>      d_alpha(group_count);
+    device_vector<Tex>      d_beta(group_count);
+
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dC.memcheck());
+
+    host_batch_vector<Ta> hA(size_A, 1, total_count);
+    host_batch_vector<Tb> hB(size_B, 1, total_count);
+    host_batch_vector<Tc> hC_host(size_C, 1, total_count);
+    host_batch_vector<Tc> hC_device(size_C, 1, total_count);
+    host_batch_vector<Tc> hC_gold(size_C, 1, total_count);
+
+    double             gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_vector(hA, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hB, arg, hipblas_client_alpha_sets_nan);
+    hipblas_init_vector(hC_host, arg, hipblas_client_beta_sets_nan);
+
+    hC_device.copy_from(hC_host);
+    hC_gold.copy_from(hC_host);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+    CHECK_HIP_ERROR(hipMemcpy(
+        d_alpha, h_alpha_array.data(), sizeof(Tex) * group_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(d_beta, h_beta_array.data(), sizeof(Tex) * group_count, hipMemcpyHostToDevice));
+
+    auto hipblasGemmGroupedBatchedExFn = [&](const void* alpha, const void* beta) {
+        return hipblasGemmGroupedBatchedEx(handle,
+                                           transA_array.data(),
+                                           transB_array.data(),
+                                           M_array.data(),
+                                           N_array.data(),
+                                           K_array.data(),
+                                           alpha,
+                                           (const void**)(Ta**)dA.ptr_on_device(),
+                                           a_type,
+                                           lda_array.data(),
+                                           (const void**)(Tb**)dB.ptr_on_device(),
+                                           b_type,
+                                           ldb_array.data(),
+                                           beta,
+                                           (void**)(Tc**)dC.ptr_on_device(),
+                                           c_type,
+                                           ldc_array.data(),
+                                           group_count,
+                                           group_size.data(),
+                                           compute_type);
+    };
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(
+            hipblasGemmGroupedBatchedExFn(h_alpha_array.data(), h_beta_array.data()));
+
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+#ifndef __HIP_PLATFORM_NVCC__
+        // cuBLAS grouped gemm only supports host scalars
+        CHECK_HIP_ERROR(dC.transfer_from(hC_device));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmGroupedBatchedExFn(d_alpha, d_beta));
+
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+#else
+        hC_device.copy_from(hC_host);
+#endif
+
+        // CPU BLAS
+        for(int g = 0, b = 0; g < group_count; g++)
+        {
+            for(int i = 0; i < group_size[g]; i++, b++)
+            {
+                cblas_gemm<Ta, Tc, Tex>(transA,
+                                        transB,
+                                        M_array[g],
+                                        N_array[g],
+                                        K_array[g],
+                                        h_alpha_Tex,
+                                        hA[b],
+                                        lda_array[g],
+                                        hB[b],
+                                        ldb_array[g],
+                                        h_beta_Tex,
+                                        hC_gold[b],
+                                        ldc_array[g]);
+
+                if(unit_check)
+                {
+                    unit_check_general<Tc>(
+                        M_array[g], N_array[g], ldc_array[g], hC_gold[b], hC_host[b]);
+                    unit_check_general<Tc>(
+                        M_array[g], N_array[g], ldc_array[g], hC_gold[b], hC_device[b]);
+                }
+
+                if(norm_check)
+                {
+                    hipblas_error_host = std::max(
+                        hipblas_error_host,
+                        norm_check_general<Tc>(
+                            'F', M_array[g], N_array[g], ldc_array[g], hC_gold[b], hC_host[b]));
+                    hipblas_error_device = std::max(
+                        hipblas_error_device,
+                        norm_check_general<Tc>(
+                            'F', M_array[g], N_array[g], ldc_array[g], hC_gold[b], hC_device[b]));
+                }
+            }
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(
+                hipblasGemmGroupedBatchedExFn(h_alpha_array.data(), h_beta_array.data()));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        double gflops = 0, gbytes = 0;
+        for(int g = 0; g < group_count; g++)
+        {
+            gflops += group_size[g] * gemm_gflop_count<Tex>(M_array[g], N_array[g], K_array[g]);
+            gbytes += group_size[g] * gemm_gbyte_count<Tex>(M_array[g], N_array[g], K_array[g]);
+        }
+
+        hipblasGemmGroupedBatchedExModel{}.log_args<Tc>(std::cout,
+                                                        arg,
+                                                        gpu_time_used,
+                                                        gflops,
+                                                        gbytes,
+                                                        hipblas_error_host,
+                                                        hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_grouped_batched_ex(const Arguments& arg)
+{
+    return testing_gemm_grouped_batched_ex_template<T>(arg);
+}
@@ -0,0 +1,371 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGemmOffsetBatchedModel = ArgumentModel<e_transA,
+                                                    e_transB,
+                                                    e_M,
+                                                    e_N,
+                                                    e_K,
+                                                    e_alpha,
+                                                    e_lda,
+                                                    e_ldb,
+                                                    e_beta,
+                                                    e_ldc,
+                                                    e_batch_count>;
+
+inline void testname_gemm_offset_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGemmOffsetBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_offset_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasGemmOffsetBatchedFn = hipblasGemmOffsetBatched<T>;
+    auto hipblasGemvOffsetBatchedFn = hipblasGemvOffsetBatched<T>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N           = 10;
+    const int          batch_count = 2;
+    const T            alpha = 1, beta = 0;
+
+    device_vector<T>        dA(N * N * batch_count);
+    device_vector<T>        dx(N * batch_count);
+    device_vector<uint32_t> dOffsets(batch_count);
+
+    // gemm of N by N matrices and gemv of an N by N matrix, with the arguments checked here
+    auto gemm = [&](hipblasHandle_t    h,
+                    hipblasOperation_t transA,
+                    int                m,
+                    int                lda,
+                    const uint32_t*    offsetsB,
+                    const uint32_t*    offsetsC,
+                    int                batch_count) {
+        return hipblasGemmOffsetBatchedFn(h,
+                                          transA,
+                                          HIPBLAS_OP_N,
+                                          m,
+                                          N,
+                                          N,
+                                          &alpha,
+                                          dA,
+                                          lda,
+                                          dOffsets,
+                                          dA,
+                                          N,
+                                          offsetsB,
+                                          &beta,
+                                          dA,
+                                          N,
+                                          offsetsC,
+                                          batch_count);
+    };
+    auto gemv = [&](int m, int incx, const uint32_t* offsetsy) {
+        return hipblasGemvOffsetBatchedFn(handle,
+                                          HIPBLAS_OP_N,
+                                          m,
+                                          N,
+                                          &alpha,
+                                          dA,
+                                          N,
+                                          dOffsets,
+                                          dx,
+                                          incx,
+                                          dOffsets,
+                                          &beta,
+                                          dx,
+                                          1,
+                                          offsetsy,
+                                          batch_count);
+    };
+
+    EXPECT_HIPBLAS_STATUS(gemm(nullptr, HIPBLAS_OP_N, N, N, dOffsets, dOffsets, batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        gemm(handle, hipblasOperation_t(-1), N, N, dOffsets, dOffsets, batch_count),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(gemm(handle, HIPBLAS_OP_N, -1, N, dOffsets, dOffsets, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gemm(handle, HIPBLAS_OP_N, N, N - 1, dOffsets, dOffsets, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gemm(handle, HIPBLAS_OP_N, N, N, nullptr, dOffsets, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gemm(handle, HIPBLAS_OP_N, N, N, dOffsets, nullptr, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gemm(handle, HIPBLAS_OP_N, N, N, dOffsets, dOffsets, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(gemv(N, 0, dOffsets), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gemv(N, 1, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If m, n or batch_count is 0, nothing is computed
+    EXPECT_HIPBLAS_STATUS(gemm(handle, HIPBLAS_OP_N, N, N, nullptr, nullptr, 0),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(gemv(0, 1, nullptr), HIPBLAS_STATUS_SUCCESS);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// The matrices of the batch sit in one buffer per operand in another order than the batch: A_i in
+// slot batch_count - 1 - i, B_i in slot i and C_i in slot i + 1, wrapping around, so the results
+// are only right when the offsets are followed. gemv then runs on the same buffers, with x_i the
+// first column of op( B_i ) and y_i the first column of C_i. Without BUILD_WITH_OFFSET_BATCHED the
+// functions return HIPBLAS_STATUS_NOT_SUPPORTED and nothing is checked, with it
+// HIPBLAS_STATUS_NOT_SUPPORTED fails the test.
+template <typename T>
+inline hipblasStatus_t testing_gemm_offset_batched(const Arguments& arg)
+{
+    auto hipblasGemmOffsetBatchedFn = hipblasGemmOffsetBatched<T>;
+    auto hipblasGemvOffsetBatchedFn = hipblasGemvOffsetBatched<T>;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < std::max(1, A_row) || ldb < std::max(1, B_row)
+       || ldc < std::max(1, M) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || K == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStride stride_A = size_t(lda) * A_col;
+    hipblasStride stride_B = size_t(ldb) * B_col;
+    hipblasStride stride_C = size_t(ldc) * N;
+    size_t        A_size   = stride_A * batch_count;
+    size_t        B_size   = stride_B * batch_count;
+    size_t        C_size   = stride_C * batch_count;
+
+    // x_i is a column of B_i, or a row with transB
+    int incx = transB == HIPBLAS_OP_N ? 1 : ldb;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>        hA(A_size), hB(B_size), hC(C_size), hC_init(C_size);
+    host_vector<T>        hC_gold(C_size), hY_gold(C_size);
+    host_vector<uint32_t> hOffsetsA(batch_count), hOffsetsB(batch_count), hOffsetsC(batch_count);
+
+    device_vector<T>        dA(A_size), dB(B_size), dC(C_size);
+    device_vector<T>        d_alpha(1), d_beta(1);
+    device_vector<uint32_t> dOffsetsA(batch_count), dOffsetsB(batch_count);
+    device_vector<uint32_t> dOffsetsC(batch_count);
+
+    double             gpu_time_used, hipblas_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial data on CPU
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(
+        hC_init, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    for(int i = 0; i < batch_count; i++)
+    {
+        hOffsetsA[i] = uint32_t(stride_A * (batch_count - 1 - i));
+        hOffsetsB[i] = uint32_t(stride_B * i);
+        hOffsetsC[i] = uint32_t(stride_C * ((i + 1) % batch_count));
+    }
+
+    hC_gold = hC_init;
+    hY_gold = hC_init;
+    for(int i = 0; i < batch_count; i++)
+    {
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      h_alpha,
+                      hA.data() + hOffsetsA[i],
+                      lda,
+                      hB.data() + hOffsetsB[i],
+                      ldb,
+                      h_beta,
+                      hC_gold.data() + hOffsetsC[i],
+                      ldc);
+        cblas_gemv<T>(transA,
+                      A_row,
+                      A_col,
+                      h_alpha,
+                      hA.data() + hOffsetsA[i],
+                      lda,
+                      hB.data() + hOffsetsB[i],
+                      incx,
+                      h_beta,
+                      hY_gold.data() + hOffsetsC[i],
+                      1);
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dOffsetsA, hOffsetsA, sizeof(uint32_t) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dOffsetsB, hOffsetsB, sizeof(uint32_t) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dOffsetsC, hOffsetsC, sizeof(uint32_t) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        for(bool device_scalars : {false, true})
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+                handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+            const T* alpha = device_scalars ? (const T*)d_alpha : &h_alpha;
+            const T* beta  = device_scalars ? (const T*)d_beta : &h_beta;
+
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(T) * C_size, hipMemcpyHostToDevice));
+            hipblasStatus_t status = hipblasGemmOffsetBatchedFn(handle,
+                                                                transA,
+                                                                transB,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                alpha,
+                                                                dA,
+                                                                lda,
+                                                                dOffsetsA,
+                                                                dB,
+                                                                ldb,
+                                                                dOffsetsB,
+                                                                beta,
+                                                                dC,
+                                                                ldc,
+                                                                dOffsetsC,
+                                                                batch_count);
+#ifndef HIPBLAS_OFFSET_BATCHED
+            if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+                return HIPBLAS_STATUS_SUCCESS;
+#endif
+            CHECK_HIPBLAS_ERROR(status);
+            CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_gold, hC);
+            if(arg.norm_check)
+                hipblas_error = std::max(
+                    hipblas_error,
+                    norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC, batch_count));
+
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(T) * C_size, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasGemvOffsetBatchedFn(handle,
+                                                           transA,
+                                                           A_row,
+                                                           A_col,
+                                                           alpha,
+                                                           dA,
+                                                           lda,
+                                                           dOffsetsA,
+                                                           dB,
+                                                           incx,
+                                                           dOffsetsB,
+                                                           beta,
+                                                           dC,
+                                                           1,
+                                                           dOffsetsC,
+                                                           batch_count));
+            CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, batch_count, ldc, stride_C, hY_gold, hC);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmOffsetBatchedFn(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           &h_alpha,
+                                                           dA,
+                                                           lda,
+                                                           dOffsetsA,
+                                                           dB,
+                                                           ldb,
+                                                           dOffsetsB,
+                                                           &h_beta,
+                                                           dC,
+                                                           ldc,
+                                                           dOffsetsC,
+                                                           batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmOffsetBatchedModel{}.log_args<T>(std::cout,
+                                                    arg,
+                                                    gpu_time_used,
+                                                    gemm_gflop_count<T>(M, N, K),
+                                                    gemm_gbyte_count<T>(M, N, K),
+                                                    hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmOutOfCoreExModel
+    = ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc>;
+
+inline void testname_gemm_out_of_core_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmOutOfCoreExModel{}.test_name(arg, name);
+}
+
+// A, B and C stay in host memory, the library streams them through the device
+template <typename T>
+inline hipblasStatus_t testing_gemm_out_of_core_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M   = arg.M;
+    int N   = arg.N;
+    int K   = arg.K;
+    int lda = arg.lda;
+    int ldb = arg.ldb;
+    int ldc = arg.ldc;
+
+    hipDataType          data_type = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+    hipblasComputeType_t compute_type
+        = std::is_same_v<T, double> ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    auto hipblasGemmOutOfCoreExFn = [&](const T* A, const T* B, T* C) {
+        return hipblasGemmOutOfCoreEx(handle,
+                                      transA,
+                                      transB,
+                                      M,
+                                      N,
+                                      K,
+                                      &h_alpha,
+                                      A,
+                                      data_type,
+                                      lda,
+                                      B,
+                                      data_type,
+                                      ldb,
+                                      &h_beta,
+                                      C,
+                                      data_type,
+                                      ldc,
+                                      compute_type);
+    };
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return hipblasGemmOutOfCoreExFn(nullptr, nullptr, nullptr);
+    }
+
+    const size_t size_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC(size_C);
+    host_vector<T> hC_gold(size_C);
+
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    hC_gold = hC;
+
+    if(M > 0 && N > 0)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemmOutOfCoreExFn(hA, hB, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        if(K > 0)
+            EXPECT_HIPBLAS_STATUS(hipblasGemmOutOfCoreExFn(nullptr, hB, hC),
+                                  HIPBLAS_STATUS_INVALID_VALUE);
+    }
+
+    // The device pointer mode of the handle is restored
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasGemmOutOfCoreExFn(hA, hB, hC));
+
+    hipblasPointerMode_t mode;
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_POINTER_MODE_DEVICE, mode);
+
+    cblas_gemm<T, T, T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA.data(),
+                        lda,
+                        hB.data(),
+                        ldb,
+                        h_beta,
+                        hC_gold.data(),
+                        ldc);
+
+    if(arg.unit_check)
+    {
+        const double tol = K * (std::is_same_v<T, double> ? 1e-10 : 1e-3);
+        near_check_general<T>(M, N, ldc, hC_gold.data(), hC.data(), tol);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
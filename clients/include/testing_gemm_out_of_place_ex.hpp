@@ -0,0 +1,282 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Checks the three forms against gemm on the CPU, and that C is left unchanged. For float, the
+// strided form also writes a bfloat16 D, rounded on the CPU from the float result; it needs the
+// conversion kernels, so HIPBLAS_STATUS_NOT_SUPPORTED skips that check.
+template <typename T>
+inline hipblasStatus_t testing_gemm_out_of_place_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                ldd         = arg.ldd;
+    int                batch_count = arg.batch_count;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M
+       || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipDataType          data_type = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+    hipblasComputeType_t compute_type
+        = std::is_same_v<T, double> ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+    hipblasStride stride_D = hipblasStride(ldd) * N;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T> hA(stride_A * batch_count);
+    host_vector<T> hB(stride_B * batch_count);
+    host_vector<T> hC(stride_C * batch_count);
+    host_vector<T> hC_out(stride_C * batch_count);
+    host_vector<T> hD_gold(stride_D * batch_count);
+    host_vector<T> hD(stride_D * batch_count);
+
+    device_vector<T>  dA(hA.size());
+    device_vector<T>  dB(hB.size());
+    device_vector<T>  dC(hC.size());
+    device_vector<T>  dD(hD.size());
+    device_vector<T*> dA_array(batch_count), dB_array(batch_count);
+    device_vector<T*> dC_array(batch_count), dD_array(batch_count);
+
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hB,
+                        arg,
+                        B_row,
+                        B_col,
+                        ldb,
+                        stride_B,
+                        batch_count,
+                        hipblas_client_alpha_sets_nan,
+                        false,
+                        true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dA_array, dA, sizeof(T), stride_A, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dB_array, dB, sizeof(T), stride_B, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dC_array, dC, sizeof(T), stride_C, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dD_array, dD, sizeof(T), stride_D, batch_count));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                hD_gold[b * stride_D + i + size_t(j) * ldd]
+                    = hC[b * stride_C + i + size_t(j) * ldc];
+        cblas_gemm<T, T, T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hA.data() + b * stride_A,
+                            lda,
+                            hB.data() + b * stride_B,
+                            ldb,
+                            h_beta,
+                            hD_gold.data() + b * stride_D,
+                            ldd);
+    }
+
+    const double tol = std::max(K, 1) * (std::is_same_v<T, double> ? 1e-10 : 1e-3);
+
+    for(int form = 0; form < 3; form++)
+    {
+        int batches = form == 0 ? std::min(batch_count, 1) : batch_count;
+
+        CHECK_HIP_ERROR(hipMemset(dD, 0, sizeof(T) * hD.size()));
+        if(form == 0)
+            CHECK_HIPBLAS_ERROR(hipblasGemmOutOfPlaceEx(handle,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        &h_alpha,
+                                                        dA,
+                                                        data_type,
+                                                        lda,
+                                                        dB,
+                                                        data_type,
+                                                        ldb,
+                                                        &h_beta,
+                                                        dC,
+                                                        data_type,
+                                                        ldc,
+                                                        dD,
+                                                        data_type,
+                                                        ldd,
+                                                        compute_type,
+                                                        HIPBLAS_GEMM_DEFAULT));
+        else if(form == 1)
+            CHECK_HIPBLAS_ERROR(hipblasGemmBatchedOutOfPlaceEx(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               &h_alpha,
+                                                               (const void**)(T**)dA_array,
+                                                               data_type,
+                                                               lda,
+                                                               (const void**)(T**)dB_array,
+                                                               data_type,
+                                                               ldb,
+                                                               &h_beta,
+                                                               (const void**)(T**)dC_array,
+                                                               data_type,
+                                                               ldc,
+                                                               (void**)(T**)dD_array,
+                                                               data_type,
+                                                               ldd,
+                                                               batches,
+                                                               compute_type,
+                                                               HIPBLAS_GEMM_DEFAULT));
+        else
+            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedOutOfPlaceEx(handle,
+                                                                      transA,
+                                                                      transB,
+                                                                      M,
+                                                                      N,
+                                                                      K,
+                                                                      &h_alpha,
+                                                                      dA,
+                                                                      data_type,
+                                                                      lda,
+                                                                      stride_A,
+                                                                      dB,
+                                                                      data_type,
+                                                                      ldb,
+                                                                      stride_B,
+                                                                      &h_beta,
+                                                                      dC,
+                                                                      data_type,
+                                                                      ldc,
+                                                                      stride_C,
+                                                                      dD,
+                                                                      data_type,
+                                                                      ldd,
+                                                                      stride_D,
+                                                                      batches,
+                                                                      compute_type,
+                                                                      HIPBLAS_GEMM_DEFAULT));
+
+        CHECK_HIP_ERROR(hipMemcpy(hD, dD, sizeof(T) * hD.size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_out, dC, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+        if(arg.unit_check)
+        {
+            near_check_general<T>(M, N, batches, ldd, stride_D, hD_gold, hD, tol);
+            unit_check_general<T>(M, N, batches, ldc, stride_C, hC, hC_out);
+        }
+    }
+
+    if constexpr(std::is_same_v<T, float>)
+    {
+        host_vector<hipblasBfloat16>   hD_bf16(hD.size());
+        device_vector<hipblasBfloat16> dD_bf16(hD.size());
+        CHECK_HIP_ERROR(hipMemset(dD_bf16, 0, sizeof(hipblasBfloat16) * hD.size()));
+
+        hipblasStatus_t status = hipblasGemmStridedBatchedOutOfPlaceEx(handle,
+                                                                       transA,
+                                                                       transB,
+                                                                       M,
+                                                                       N,
+                                                                       K,
+                                                                       &h_alpha,
+                                                                       dA,
+                                                                       data_type,
+                                                                       lda,
+                                                                       stride_A,
+                                                                       dB,
+                                                                       data_type,
+                                                                       ldb,
+                                                                       stride_B,
+                                                                       &h_beta,
+                                                                       dC,
+                                                                       data_type,
+                                                                       ldc,
+                                                                       stride_C,
+                                                                       dD_bf16,
+                                                                       HIP_R_16BF,
+                                                                       ldd,
+                                                                       stride_D,
+                                                                       batch_count,
+                                                                       compute_type,
+                                                                       HIPBLAS_GEMM_DEFAULT);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            CHECK_HIP_ERROR(hipMemcpy(
+                hD_bf16, dD_bf16, sizeof(hipblasBfloat16) * hD.size(), hipMemcpyDeviceToHost));
+
+            host_vector<float> hD_rounded(hD.size()), hD_gpu(hD.size());
+            for(size_t i = 0; i < hD.size(); i++)
+            {
+                hD_rounded[i] = bfloat16_to_float(float_to_bfloat16(hD_gold[i]));
+                hD_gpu[i]     = bfloat16_to_float(hD_bf16[i]);
+            }
+            double error = norm_check_general<float>(
+                'F', M, N, ldd, stride_D, hD_rounded, hD_gpu, batch_count);
+            if(arg.unit_check)
+                unit_check_error(error, 1e-2);
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
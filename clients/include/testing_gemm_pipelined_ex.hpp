@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmPipelinedExModel = ArgumentModel<e_transA,
+                                                  e_transB,
+                                                  e_M,
+                                                  e_N,
+                                                  e_K,
+                                                  e_alpha,
+                                                  e_lda,
+                                                  e_ldb,
+                                                  e_beta,
+                                                  e_ldc,
+                                                  e_batch_count>;
+
+inline void testname_gemm_pipelined_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmPipelinedExModel{}.test_name(arg, name);
+}
+
+// batch_count problems with A, B and C in host memory, the odd ones pinned
+template <typename T>
+inline hipblasStatus_t testing_gemm_pipelined_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    hipDataType          data_type = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+    hipblasComputeType_t compute_type
+        = std::is_same_v<T, double> ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    hipblasGemmHostProblem_t problem{
+        transA, transB, M, N, K, &h_alpha, nullptr, lda, nullptr, ldb, &h_beta, nullptr, ldc};
+
+    auto hipblasGemmPipelinedExFn
+        = [&](const hipblasGemmHostProblem_t* problems, int count, hipEvent_t done) {
+              return hipblasGemmPipelinedEx(
+                  handle, count, problems, data_type, data_type, data_type, compute_type, done);
+          };
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return batch_count < 0 ? hipblasGemmPipelinedExFn(&problem, batch_count, nullptr)
+                               : hipblasGemmPipelinedExFn(&problem, 1, nullptr);
+    }
+
+    const size_t size_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+
+    host_vector<T> hA(size_A * batch_count);
+    host_vector<T> hB(size_B * batch_count);
+    host_vector<T> hC(size_C * batch_count);
+    host_vector<T> hC_init(size_C * batch_count);
+    host_vector<T> hC_gold(size_C * batch_count);
+
+    size_t size_pinned = std::max(size_t(1), (size_A + size_B + size_C) * batch_count);
+    T*     pinned;
+    CHECK_HIP_ERROR(hipHostMalloc((void**)&pinned, sizeof(T) * size_pinned));
+    T* pA = pinned;
+    T* pB = pA + size_A * batch_count;
+    T* pC = pB + size_B * batch_count;
+
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, size_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, size_B, batch_count, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(hC_init, arg, M, N, ldc, size_C, batch_count, hipblas_client_beta_sets_nan);
+    hC_gold = hC_init;
+
+    std::copy(hA.begin(), hA.end(), pA);
+    std::copy(hB.begin(), hB.end(), pB);
+
+    std::vector<hipblasGemmHostProblem_t> problems(batch_count, problem);
+    for(int b = 0; b < batch_count; b++)
+    {
+        bool pin      = b % 2;
+        problems[b].A = (pin ? pA : hA.data()) + b * size_A;
+        problems[b].B = (pin ? pB : hB.data()) + b * size_B;
+        problems[b].C = (pin ? pC : hC.data()) + b * size_C;
+    }
+
+    for(int b = 0; b < batch_count; b++)
+        cblas_gemm<T, T, T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hA.data() + b * size_A,
+                            lda,
+                            hB.data() + b * size_B,
+                            ldb,
+                            h_beta,
+                            hC_gold.data() + b * size_C,
+                            ldc);
+
+    if(batch_count && M > 0 && N > 0)
+    {
+        hipblasGemmHostProblem_t bad = problems[0];
+        bad.C                        = nullptr;
+        EXPECT_HIPBLAS_STATUS(hipblasGemmPipelinedExFn(&bad, 1, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGemmPipelinedExFn(nullptr, 1, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+
+    hipEvent_t done;
+    CHECK_HIP_ERROR(hipEventCreateWithFlags(&done, hipEventDisableTiming));
+
+    // Once waiting for the results and once signalling done; the device pointer mode of the
+    // handle is restored
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    for(int call = 0; call < 2; call++)
+    {
+        hC = hC_init;
+        std::copy(hC_init.begin(), hC_init.end(), pC);
+
+        CHECK_HIPBLAS_ERROR(
+            hipblasGemmPipelinedExFn(problems.data(), batch_count, call ? done : nullptr));
+        if(call)
+            CHECK_HIP_ERROR(hipEventSynchronize(done));
+
+        for(int b = 1; b < batch_count; b += 2)
+            std::copy(pC + b * size_C, pC + (b + 1) * size_C, hC.data() + b * size_C);
+
+        if(arg.unit_check)
+        {
+            const double tol = K * (std::is_same_v<T, double> ? 1e-10 : 1e-3);
+            near_check_general<T>(M, N, batch_count, ldc, size_C, hC_gold.data(), hC.data(), tol);
+        }
+    }
+
+    hipblasPointerMode_t mode;
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_POINTER_MODE_DEVICE, mode);
+
+    CHECK_HIP_ERROR(hipEventDestroy(done));
+    CHECK_HIP_ERROR(hipHostFree(pinned));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,271 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmPlanModel = ArgumentModel<e_transA,
+                                           e_transB,
+                                           e_M,
+                                           e_N,
+                                           e_K,
+                                           e_alpha,
+                                           e_lda,
+                                           e_ldb,
+                                           e_beta,
+                                           e_ldc,
+                                           e_batch_count>;
+
+inline void testname_gemm_plan(const Arguments& arg, std::string& name)
+{
+    hipblasGemmPlanModel{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_gemm_plan_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    hipblasGemmPlan_t  plan = nullptr;
+    hipblasGemmDesc_t  desc = {HIPBLAS_OP_N,
+                               HIPBLAS_OP_N,
+                               100,
+                               100,
+                               100,
+                               HIP_R_32F,
+                               100,
+                               0,
+                               HIP_R_32F,
+                               100,
+                               0,
+                               HIP_R_32F,
+                               100,
+                               0,
+                               1,
+                               HIPBLAS_COMPUTE_32F,
+                               HIPBLAS_GEMM_DEFAULT};
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanCreate(&plan, nullptr, &desc),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanCreate(nullptr, handle, &desc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanCreate(&plan, handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasGemmDesc_t bad_desc = desc;
+    bad_desc.lda               = 99;
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanCreate(&plan, handle, &bad_desc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    bad_desc            = desc;
+    bad_desc.batchCount = -1;
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanCreate(&plan, handle, &bad_desc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGemmPlanExecute(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPlanDestroy(nullptr), HIPBLAS_STATUS_SUCCESS);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_gemm_plan(const Arguments& arg)
+{
+    using T = float;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblasStride stride_A = size_t(lda) * A_col;
+    hipblasStride stride_B = size_t(ldb) * B_col;
+    hipblasStride stride_C = size_t(ldc) * N;
+    size_t        A_size   = stride_A * batch_count;
+    size_t        B_size   = stride_B * batch_count;
+    size_t        C_size   = stride_C * batch_count;
+
+    double             hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+    host_vector<T> hC_gold(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hB,
+                        arg,
+                        B_row,
+                        B_col,
+                        ldb,
+                        stride_B,
+                        batch_count,
+                        hipblas_client_alpha_sets_nan,
+                        false,
+                        true);
+    hipblas_init_matrix(
+        hC_gold, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_gold, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    hipblasGemmDesc_t desc = {transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              HIP_R_32F,
+                              lda,
+                              stride_A,
+                              HIP_R_32F,
+                              ldb,
+                              stride_B,
+                              HIP_R_32F,
+                              ldc,
+                              stride_C,
+                              batch_count,
+                              HIPBLAS_COMPUTE_32F,
+                              HIPBLAS_GEMM_DEFAULT};
+
+    hipblasGemmPlan_t plan;
+    CHECK_HIPBLAS_ERROR(hipblasGemmPlanCreate(&plan, handle, &desc));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmPlanExecute(plan, &h_alpha, dA, dB, &h_beta, dC));
+        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_gold, sizeof(T) * C_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmPlanExecute(plan, d_alpha, dA, dB, d_beta, dC));
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA.data() + stride_A * b,
+                          lda,
+                          hB.data() + stride_B * b,
+                          ldb,
+                          h_beta,
+                          hC_gold.data() + stride_C * b,
+                          ldc);
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_gold, hC_host);
+            unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host = std::abs(
+                norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC_host, batch_count));
+            hipblas_error_device = std::abs(
+                norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC_device, batch_count));
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        hipblasEventTimer timer(arg, handle);
+
+        double gpu_time_used;
+        int    runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmPlanExecute(plan, &h_alpha, dA, dB, &h_beta, dC));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmPlanModel{}.log_args<T>(std::cout,
+                                           arg,
+                                           gpu_time_used,
+                                           gemm_gflop_count<T>(M, N, K) * batch_count,
+                                           gemm_gbyte_count<T>(M, N, K) * batch_count,
+                                           hipblas_error_host,
+                                           hipblas_error_device);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasGemmPlanDestroy(plan));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
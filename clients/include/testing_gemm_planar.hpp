@@ -0,0 +1,275 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+struct hipblas_gemm_planar_functions;
+
+template <>
+struct hipblas_gemm_planar_functions<hipblasComplex>
+{
+    static constexpr auto gemm               = hipblasCgemmPlanar;
+    static constexpr auto gemmBatched        = hipblasCgemmPlanarBatched;
+    static constexpr auto gemmStridedBatched = hipblasCgemmPlanarStridedBatched;
+};
+
+template <>
+struct hipblas_gemm_planar_functions<hipblasDoubleComplex>
+{
+    static constexpr auto gemm               = hipblasZgemmPlanar;
+    static constexpr auto gemmBatched        = hipblasZgemmPlanarBatched;
+    static constexpr auto gemmStridedBatched = hipblasZgemmPlanarStridedBatched;
+};
+
+// Checks each form against gemm on the CPU on the interleaved matrices, with the scalars of arg
+// and with their imaginary parts dropped, and with the scalars on the host and on the device.
+template <typename T>
+inline hipblasStatus_t testing_gemm_planar(const Arguments& arg)
+{
+    using F = hipblas_gemm_planar_functions<T>;
+    using R = real_t<T>;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = 2;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!M || !N)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStride stride_A = hipblasStride(lda) * A_col;
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T> hA(stride_A * batch_count);
+    host_vector<T> hB(stride_B * batch_count);
+    host_vector<T> hC(stride_C * batch_count);
+    host_vector<T> hC_gold(stride_C * batch_count);
+    host_vector<T> hC_out(stride_C * batch_count);
+    host_vector<R> hAr(hA.size()), hAi(hA.size());
+    host_vector<R> hBr(hB.size()), hBi(hB.size());
+    host_vector<R> hCr(hC.size()), hCi(hC.size());
+
+    device_vector<R>  dAr(hA.size()), dAi(hA.size());
+    device_vector<R>  dBr(hB.size()), dBi(hB.size());
+    device_vector<R>  dCr(hC.size()), dCi(hC.size());
+    device_vector<R*> dAr_array(batch_count), dAi_array(batch_count);
+    device_vector<R*> dBr_array(batch_count), dBi_array(batch_count);
+    device_vector<R*> dCr_array(batch_count), dCi_array(batch_count);
+    device_vector<T>  d_alpha(1);
+    device_vector<T>  d_beta(1);
+
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB,
+                        arg,
+                        B_row,
+                        B_col,
+                        ldb,
+                        stride_B,
+                        batch_count,
+                        hipblas_client_never_set_nan,
+                        false,
+                        true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_never_set_nan);
+
+    for(size_t i = 0; i < hA.size(); i++)
+    {
+        hAr[i] = hA[i].real();
+        hAi[i] = hA[i].imag();
+    }
+    for(size_t i = 0; i < hB.size(); i++)
+    {
+        hBr[i] = hB[i].real();
+        hBi[i] = hB[i].imag();
+    }
+    for(size_t i = 0; i < hC.size(); i++)
+    {
+        hCr[i] = hC[i].real();
+        hCi[i] = hC[i].imag();
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dAr, hAr, sizeof(R) * hAr.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAi, hAi, sizeof(R) * hAi.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBr, hBr, sizeof(R) * hBr.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBi, hBi, sizeof(R) * hBi.size(), hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dAr_array, dAr, sizeof(R), stride_A, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dAi_array, dAi, sizeof(R), stride_A, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dBr_array, dBr, sizeof(R), stride_B, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dBi_array, dBi, sizeof(R), stride_B, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dCr_array, dCr, sizeof(R), stride_C, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dCi_array, dCi, sizeof(R), stride_C, batch_count));
+
+    R      eps       = std::numeric_limits<R>::epsilon();
+    double tolerance = eps * 40 * std::max(K, 1);
+
+    for(int real_scalars = 0; real_scalars < 2; real_scalars++)
+    {
+        T h_alpha = arg.get_alpha<T>();
+        T h_beta  = arg.get_beta<T>();
+        if(real_scalars)
+        {
+            h_alpha = T(h_alpha.real());
+            h_beta  = T(h_beta.real());
+        }
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        hC_gold = hC;
+        for(int b = 0; b < batch_count; b++)
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA.data() + b * stride_A,
+                          lda,
+                          hB.data() + b * stride_B,
+                          ldb,
+                          h_beta,
+                          hC_gold.data() + b * stride_C,
+                          ldc);
+
+        for(int device = 0; device < 2; device++)
+        {
+            const T* alpha = device ? (const T*)d_alpha : &h_alpha;
+            const T* beta  = device ? (const T*)d_beta : &h_beta;
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+                handle, device ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+
+            for(int form = 0; form < 3; form++)
+            {
+                int batches = form == 0 ? 1 : batch_count;
+
+                CHECK_HIP_ERROR(hipMemcpy(dCr, hCr, sizeof(R) * hCr.size(), hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dCi, hCi, sizeof(R) * hCi.size(), hipMemcpyHostToDevice));
+
+                if(form == 0)
+                    CHECK_HIPBLAS_ERROR(F::gemm(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                alpha,
+                                                dAr,
+                                                dAi,
+                                                lda,
+                                                dBr,
+                                                dBi,
+                                                ldb,
+                                                beta,
+                                                dCr,
+                                                dCi,
+                                                ldc));
+                else if(form == 1)
+                    CHECK_HIPBLAS_ERROR(F::gemmBatched(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       alpha,
+                                                       dAr_array,
+                                                       dAi_array,
+                                                       lda,
+                                                       dBr_array,
+                                                       dBi_array,
+                                                       ldb,
+                                                       beta,
+                                                       dCr_array,
+                                                       dCi_array,
+                                                       ldc,
+                                                       batches));
+                else
+                    CHECK_HIPBLAS_ERROR(F::gemmStridedBatched(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              alpha,
+                                                              dAr,
+                                                              dAi,
+                                                              lda,
+                                                              stride_A,
+                                                              dBr,
+                                                              dBi,
+                                                              ldb,
+                                                              stride_B,
+                                                              beta,
+                                                              dCr,
+                                                              dCi,
+                                                              ldc,
+                                                              stride_C,
+                                                              batches));
+
+                host_vector<R> hCr_out(hCr.size()), hCi_out(hCi.size());
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hCr_out, dCr, sizeof(R) * hCr.size(), hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hCi_out, dCi, sizeof(R) * hCi.size(), hipMemcpyDeviceToHost));
+                for(size_t i = 0; i < hC_out.size(); i++)
+                    hC_out[i] = T(hCr_out[i], hCi_out[i]);
+
+                if(arg.unit_check)
+                    unit_check_error(
+                        norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC_out, batches),
+                        tolerance);
+            }
+        }
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,403 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmQuantizedExModel = ArgumentModel<e_transA,
+                                                  e_transB,
+                                                  e_M,
+                                                  e_N,
+                                                  e_K,
+                                                  e_lda,
+                                                  e_ldb,
+                                                  e_ldc,
+                                                  e_batch_count>;
+
+inline void testname_gemm_quantized_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmQuantizedExModel{}.test_name(arg, name);
+}
+
+// Every scale mode is checked into int8, fp16 and fp32. The inputs and scale factors are small
+// enough for the scaled accumulators to be exact in fp32, so the results match exactly. Without
+// BUILD_WITH_GEMM_QUANTIZED the function returns HIPBLAS_STATUS_NOT_SUPPORTED and nothing is
+// checked, with it HIPBLAS_STATUS_NOT_SUPPORTED fails the test.
+inline hipblasStatus_t testing_gemm_quantized_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    const hipblasStride stride_A = hipblasStride(lda) * A_col;
+    const hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    const hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    hipblasLocalHandle handle(arg);
+
+    auto hipblasGemmQuantizedExFn = [&](const int8_t*           A,
+                                        const int8_t*           B,
+                                        hipblasQuantScaleMode_t mode,
+                                        const float*            scale,
+                                        void*                   C,
+                                        hipDataType             c_type) {
+        if(batch_count == 1)
+            return hipblasGemmQuantizedEx(
+                handle, transA, transB, M, N, K, A, lda, B, ldb, mode, scale, C, c_type, ldc);
+        return hipblasGemmStridedBatchedQuantizedEx(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    A,
+                                                    lda,
+                                                    stride_A,
+                                                    B,
+                                                    ldb,
+                                                    stride_B,
+                                                    mode,
+                                                    scale,
+                                                    C,
+                                                    c_type,
+                                                    ldc,
+                                                    stride_C,
+                                                    batch_count);
+    };
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return hipblasGemmQuantizedExFn(
+            nullptr, nullptr, HIPBLAS_QUANT_SCALE_TENSOR, nullptr, nullptr, HIP_R_8I);
+    }
+
+    const size_t size_A     = stride_A * batch_count;
+    const size_t size_B     = stride_B * batch_count;
+    const size_t size_C     = stride_C * batch_count;
+    const size_t size_scale = std::max(1, std::max(M, N));
+
+    host_vector<int8_t> hA(size_A);
+    host_vector<int8_t> hB(size_B);
+    host_vector<float>  h_scale(size_scale);
+    host_vector<float>  hC_gold(size_C);
+    host_vector<float>  hC(size_C);
+    host_vector<char>   hC_out(size_C * sizeof(float));
+    host_vector<char>   hC_init(size_C * sizeof(float));
+
+    device_vector<int8_t> dA(size_A);
+    device_vector<int8_t> dB(size_B);
+    device_vector<float>  d_scale(size_scale);
+    device_vector<char>   dC(size_C * sizeof(float));
+
+    srand(1);
+    for(auto& a : hA)
+        a = int8_t(rand() % 17 - 8);
+    for(auto& b : hB)
+        b = int8_t(rand() % 17 - 8);
+    for(auto& s : h_scale)
+        s = float(rand() % 8 + 1) / 16;
+    for(auto& c : hC_init)
+        c = char(rand());
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(int8_t) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(int8_t) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_scale, h_scale, sizeof(float) * size_scale, hipMemcpyHostToDevice));
+
+    // Only int8, fp16 and fp32 results are supported
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGemmQuantizedExFn(dA, dB, HIPBLAS_QUANT_SCALE_TENSOR, d_scale, dC, HIP_R_32I),
+        HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    const hipblasQuantScaleMode_t modes[]
+        = {HIPBLAS_QUANT_SCALE_TENSOR, HIPBLAS_QUANT_SCALE_ROW, HIPBLAS_QUANT_SCALE_COLUMN};
+    const hipDataType c_types[] = {HIP_R_8I, HIP_R_16F, HIP_R_32F};
+
+    for(hipblasQuantScaleMode_t mode : modes)
+    {
+        for(hipDataType c_type : c_types)
+        {
+            size_t c_size = c_type == HIP_R_8I ? 1 : c_type == HIP_R_16F ? 2 : 4;
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, c_size * size_C, hipMemcpyHostToDevice));
+
+            hipblasStatus_t status = hipblasGemmQuantizedExFn(dA, dB, mode, d_scale, dC, c_type);
+#ifndef HIPBLAS_GEMM_QUANTIZED
+            if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+                return HIPBLAS_STATUS_SUCCESS;
+#endif
+            CHECK_HIPBLAS_ERROR(status);
+            CHECK_HIP_ERROR(hipMemcpy(hC_out, dC, c_size * size_C, hipMemcpyDeviceToHost));
+
+            for(int b = 0; b < batch_count; b++)
+            {
+                for(int j = 0; j < N; j++)
+                {
+                    for(int i = 0; i < M; i++)
+                    {
+                        int32_t acc = 0;
+                        for(int l = 0; l < K; l++)
+                        {
+                            int8_t a = transA == HIPBLAS_OP_N ? hA[b * stride_A + i + l * lda]
+                                                              : hA[b * stride_A + l + i * lda];
+                            int8_t x = transB == HIPBLAS_OP_N ? hB[b * stride_B + l + j * ldb]
+                                                              : hB[b * stride_B + j + l * ldb];
+                            acc += int32_t(a) * x;
+                        }
+                        float s = mode == HIPBLAS_QUANT_SCALE_ROW      ? h_scale[i]
+                                  : mode == HIPBLAS_QUANT_SCALE_COLUMN ? h_scale[j]
+                                                                       : h_scale[0];
+                        float  v   = float(acc) * s;
+                        size_t idx = b * stride_C + i + size_t(j) * ldc;
+                        if(c_type == HIP_R_8I)
+                        {
+                            hC_gold[idx] = std::nearbyint(std::min(std::max(v, -128.0f), 127.0f));
+                            hC[idx]      = ((const int8_t*)hC_out.data())[idx];
+                        }
+                        else if(c_type == HIP_R_16F)
+                        {
+                            hC_gold[idx] = half_to_float(float_to_half(v));
+                            hC[idx]      = half_to_float(((const hipblasHalf*)hC_out.data())[idx]);
+                        }
+                        else
+                        {
+                            hC_gold[idx] = v;
+                            hC[idx]      = ((const float*)hC_out.data())[idx];
+                        }
+                    }
+                }
+            }
+            if(arg.unit_check)
+                unit_check_general<float>(M, N, batch_count, ldc, stride_C, hC_gold, hC);
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Every weight type is checked with fp16 activations into fp32, with zero points for the
+// unsigned types only. The weights, scale factors, zero points and activations are small enough
+// for the dequantized weights to be exact in fp16 and the products and sums exact in fp32, so the
+// results match exactly. Without BUILD_WITH_GEMM_QUANTIZED the function returns
+// HIPBLAS_STATUS_NOT_SUPPORTED and nothing is checked, with it HIPBLAS_STATUS_NOT_SUPPORTED fails
+// the test.
+inline hipblasStatus_t testing_gemm_weight_only_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    // Groups of 32 weights along K, a partial group for K = 10
+    const int group_size = 32;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    const hipblasStride stride_A     = hipblasStride(lda) * A_col;
+    const hipblasStride stride_B     = hipblasStride(ldb) * B_col;
+    const hipblasStride stride_C     = hipblasStride(ldc) * N;
+    const hipblasStride stride_scale = hipblasStride(M) * ((K + group_size - 1) / group_size);
+
+    const float alpha = 1, beta = 0;
+
+    hipblasLocalHandle handle(arg);
+
+    auto hipblasGemmWeightOnlyExFn = [&](const void*         A,
+                                         hipblasWeightType_t a_type,
+                                         const hipblasHalf*  scale,
+                                         const hipblasHalf*  zero,
+                                         const hipblasHalf*  B,
+                                         float*              C) {
+        if(batch_count == 1)
+            return hipblasGemmWeightOnlyEx(handle,
+                                           transA,
+                                           transB,
+                                           M,
+                                           N,
+                                           K,
+                                           &alpha,
+                                           A,
+                                           a_type,
+                                           lda,
+                                           scale,
+                                           zero,
+                                           group_size,
+                                           B,
+                                           HIP_R_16F,
+                                           ldb,
+                                           &beta,
+                                           C,
+                                           HIP_R_32F,
+                                           ldc);
+        return hipblasGemmStridedBatchedWeightOnlyEx(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &alpha,
+                                                     A,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     scale,
+                                                     zero,
+                                                     group_size,
+                                                     stride_scale,
+                                                     B,
+                                                     HIP_R_16F,
+                                                     ldb,
+                                                     stride_B,
+                                                     &beta,
+                                                     C,
+                                                     HIP_R_32F,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count);
+    };
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return hipblasGemmWeightOnlyExFn(
+            nullptr, HIPBLAS_WEIGHT_INT8, nullptr, nullptr, nullptr, nullptr);
+    }
+
+    const size_t size_A     = stride_A * batch_count;
+    const size_t size_B     = stride_B * batch_count;
+    const size_t size_C     = stride_C * batch_count;
+    const size_t size_scale = stride_scale * batch_count;
+
+    // The weights as integers, packed into the bytes of hA_packed as given by the weight type
+    host_vector<int>         hA(size_A);
+    host_vector<uint8_t>     hA_packed(size_A);
+    host_vector<hipblasHalf> hB(size_B);
+    host_vector<hipblasHalf> h_scale(size_scale);
+    host_vector<hipblasHalf> h_zero(size_scale);
+    host_vector<float>       hC_gold(size_C);
+    host_vector<float>       hC(size_C);
+
+    device_vector<uint8_t>     dA(size_A);
+    device_vector<hipblasHalf> dB(size_B);
+    device_vector<hipblasHalf> d_scale(size_scale);
+    device_vector<hipblasHalf> d_zero(size_scale);
+    device_vector<float>       dC(size_C);
+
+    srand(1);
+    for(auto& b : hB)
+        b = float_to_half(float(rand() % 17 - 8));
+    for(auto& s : h_scale)
+        s = float_to_half(float(rand() % 8 + 1) / 16);
+    for(auto& z : h_zero)
+        z = float_to_half(float(rand() % 16));
+
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(hipblasHalf) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(d_scale, h_scale, sizeof(hipblasHalf) * size_scale, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(d_zero, h_zero, sizeof(hipblasHalf) * size_scale, hipMemcpyHostToDevice));
+
+    const hipblasWeightType_t a_types[] = {
+        HIPBLAS_WEIGHT_INT8, HIPBLAS_WEIGHT_UINT8, HIPBLAS_WEIGHT_INT4, HIPBLAS_WEIGHT_UINT4};
+
+    for(hipblasWeightType_t a_type : a_types)
+    {
+        bool four_bit  = a_type == HIPBLAS_WEIGHT_INT4 || a_type == HIPBLAS_WEIGHT_UINT4;
+        bool is_signed = a_type == HIPBLAS_WEIGHT_INT8 || a_type == HIPBLAS_WEIGHT_INT4;
+
+        std::fill(hA_packed.begin(), hA_packed.end(), 0);
+        for(size_t e = 0; e < size_A; e++)
+        {
+            hA[e] = is_signed ? rand() % 16 - 8 : rand() % 16;
+            if(four_bit)
+                hA_packed[e / 2] |= uint8_t((hA[e] & 15) << (e % 2 * 4));
+            else
+                hA_packed[e] = uint8_t(hA[e]);
+        }
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA_packed, size_A, hipMemcpyHostToDevice));
+
+        const hipblasHalf* zero = is_signed ? nullptr : (const hipblasHalf*)d_zero;
+
+        hipblasStatus_t status = hipblasGemmWeightOnlyExFn(dA, a_type, d_scale, zero, dB, dC);
+#ifndef HIPBLAS_GEMM_QUANTIZED
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+            return HIPBLAS_STATUS_SUCCESS;
+#endif
+        CHECK_HIPBLAS_ERROR(status);
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * size_C, hipMemcpyDeviceToHost));
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                for(int i = 0; i < M; i++)
+                {
+                    float sum = 0;
+                    for(int l = 0; l < K; l++)
+                    {
+                        size_t g = b * stride_scale + i + size_t(l / group_size) * M;
+                        int    q = transA == HIPBLAS_OP_N ? hA[b * stride_A + i + l * lda]
+                                                          : hA[b * stride_A + l + i * lda];
+                        float  z = zero ? half_to_float(h_zero[g]) : 0;
+                        float  a = (q - z) * half_to_float(h_scale[g]);
+                        float  x = half_to_float(transB == HIPBLAS_OP_N
+                                                    ? hB[b * stride_B + l + j * ldb]
+                                                    : hB[b * stride_B + j + l * ldb]);
+                        sum += a * x;
+                    }
+                    hC_gold[b * stride_C + i + size_t(j) * ldc] = sum;
+                }
+            }
+        }
+        if(arg.unit_check)
+            unit_check_general<float>(M, N, batch_count, ldc, stride_C, hC_gold, hC);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmScaledExModel = ArgumentModel<e_transA,
+                                               e_transB,
+                                               e_M,
+                                               e_N,
+                                               e_K,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_beta,
+                                               e_ldc,
+                                               e_batch_count>;
+
+inline void testname_gemm_scaled_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmScaledExModel{}.test_name(arg, name);
+}
+
+// FP8 formats the test inputs are encoded in
+struct hipblas_fp8_format
+{
+    hipDataType type;
+    int         exponent_bits;
+    int         bias;
+};
+
+// The inputs are multiples of 0.5 in [-1, 1], exact in every FP8 format
+inline uint8_t hipblas_fp8_encode(float value, const hipblas_fp8_format& format)
+{
+    if(value == 0)
+        return 0;
+    int   mantissa_bits = 7 - format.exponent_bits;
+    int   exponent;
+    float fraction = std::frexp(std::abs(value), &exponent) * 2 - 1;
+    return uint8_t((value < 0 ? 0x80 : 0) | ((exponent - 1 + format.bias) << mantissa_bits)
+                   | int(fraction * (1 << mantissa_bits)));
+}
+
+inline std::vector<hipblas_fp8_format> hipblas_fp8_formats()
+{
+    std::vector<hipblas_fp8_format> formats;
+#if defined(__HIP_PLATFORM_AMD__) && HIP_VERSION >= 60000000
+    formats.push_back({HIP_R_8F_E4M3_FNUZ, 4, 8});
+    formats.push_back({HIP_R_8F_E5M2_FNUZ, 5, 16});
+#endif
+#if HIP_VERSION >= 60200000
+    formats.push_back({HIP_R_8F_E4M3, 4, 7});
+    formats.push_back({HIP_R_8F_E5M2, 5, 15});
+#endif
+    return formats;
+}
+
+// Float inputs are passed to hipblasGemmEx. FP8 inputs return HIPBLAS_STATUS_NOT_SUPPORTED
+// without a hipBLASLt or cuBLASLt kernel for the problem, and such formats are skipped.
+inline hipblasStatus_t testing_gemm_scaled_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    const hipblasStride stride_A = hipblasStride(lda) * A_col;
+    const hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    const hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    hipblasLocalHandle handle(arg);
+
+    auto hipblasGemmScaledExFn = [&](hipDataType  ab_type,
+                                     const void*  A,
+                                     const float* scale_A,
+                                     const void*  B,
+                                     const float* scale_B,
+                                     float*       C) {
+        if(batch_count == 1)
+            return hipblasGemmScaledEx(handle,
+                                       transA,
+                                       transB,
+                                       M,
+                                       N,
+                                       K,
+                                       &h_alpha,
+                                       A,
+                                       ab_type,
+                                       lda,
+                                       scale_A,
+                                       B,
+                                       ab_type,
+                                       ldb,
+                                       scale_B,
+                                       &h_beta,
+                                       C,
+                                       HIP_R_32F,
+                                       ldc,
+                                       HIPBLAS_COMPUTE_32F);
+        return hipblasGemmStridedBatchedScaledEx(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 &h_alpha,
+                                                 A,
+                                                 ab_type,
+                                                 lda,
+                                                 stride_A,
+                                                 scale_A,
+                                                 B,
+                                                 ab_type,
+                                                 ldb,
+                                                 stride_B,
+                                                 scale_B,
+                                                 &h_beta,
+                                                 C,
+                                                 HIP_R_32F,
+                                                 ldc,
+                                                 stride_C,
+                                                 batch_count,
+                                                 HIPBLAS_COMPUTE_32F);
+    };
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        std::vector<hipblas_fp8_format> formats = hipblas_fp8_formats();
+        hipDataType                     ab_type = formats.empty() ? HIP_R_32F : formats[0].type;
+        return hipblasGemmScaledExFn(ab_type, nullptr, nullptr, nullptr, nullptr, nullptr);
+    }
+
+    const size_t size_A = stride_A * batch_count;
+    const size_t size_B = stride_B * batch_count;
+    const size_t size_C = stride_C * batch_count;
+
+    host_vector<float>   hA(size_A);
+    host_vector<float>   hB(size_B);
+    host_vector<float>   hC(size_C);
+    host_vector<float>   hC_gold(size_C);
+    host_vector<float>   hC_init(size_C);
+    host_vector<uint8_t> hA_fp8(size_A);
+    host_vector<uint8_t> hB_fp8(size_B);
+
+    device_vector<float>   dA(size_A);
+    device_vector<float>   dB(size_B);
+    device_vector<float>   dC(size_C);
+    device_vector<uint8_t> dA_fp8(size_A);
+    device_vector<uint8_t> dB_fp8(size_B);
+    device_vector<float>   d_scale(2);
+
+    srand(1);
+    for(auto& a : hA)
+        a = float(rand() % 5 - 2) / 2;
+    for(auto& b : hB)
+        b = float(rand() % 5 - 2) / 2;
+    for(auto& c : hC_init)
+        c = float(rand() % 5 - 2);
+
+    const float h_scale[2] = {2.0f, 4.0f};
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_scale, h_scale, sizeof(h_scale), hipMemcpyHostToDevice));
+
+    // Scale factors only apply to FP8 inputs
+    EXPECT_HIPBLAS_STATUS(hipblasGemmScaledExFn(HIP_R_32F, dA, d_scale, dB, nullptr, dC),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    auto check = [&](float scale) {
+        hC_gold = hC_init;
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_gemm<float, float, float>(transA,
+                                            transB,
+                                            M,
+                                            N,
+                                            K,
+                                            h_alpha * scale,
+                                            hA.data() + b * stride_A,
+                                            lda,
+                                            hB.data() + b * stride_B,
+                                            ldb,
+                                            h_beta,
+                                            hC_gold.data() + b * stride_C,
+                                            ldc);
+        }
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * size_C, hipMemcpyDeviceToHost));
+        if(arg.unit_check)
+            near_check_general<float>(M, N, batch_count, ldc, stride_C, hC_gold, hC, K * 1e-5);
+    };
+
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(float) * size_C, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasGemmScaledExFn(HIP_R_32F, dA, nullptr, dB, nullptr, dC));
+    check(1.0f);
+
+    for(const hipblas_fp8_format& format : hipblas_fp8_formats())
+    {
+        for(size_t i = 0; i < size_A; i++)
+            hA_fp8[i] = hipblas_fp8_encode(hA[i], format);
+        for(size_t i = 0; i < size_B; i++)
+            hB_fp8[i] = hipblas_fp8_encode(hB[i], format);
+        CHECK_HIP_ERROR(hipMemcpy(dA_fp8, hA_fp8, size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB_fp8, hB_fp8, size_B, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(float) * size_C, hipMemcpyHostToDevice));
+
+        hipblasStatus_t status
+            = hipblasGemmScaledExFn(format.type, dA_fp8, d_scale, dB_fp8, d_scale + 1, dC);
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+            continue;
+        CHECK_HIPBLAS_ERROR(status);
+        check(h_scale[0] * h_scale[1]);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -27,6 +27,7 @@
 #include <typeinfo>
 #include <vector>
 
+#include "hipblas_cxx.hpp"
 #include "hipblas_unique_ptr.hpp"
 #include "testing_common.hpp"
 
@@ -108,12 +109,15 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
     size_t        B_size   = stride_B * batch_count;
     size_t        C_size   = stride_C * batch_count;
 
+    // Host data only when verifying, otherwise the matrices are initialized on the device
+    bool host_init = hipblas_host_init(arg);
+
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
-    host_vector<T> hA(A_size);
-    host_vector<T> hB(B_size);
-    host_vector<T> hC_host(C_size);
-    host_vector<T> hC_device(C_size);
-    host_vector<T> hC_copy(C_size);
+    host_vector<T> hA(host_init ? A_size : 0);
+    host_vector<T> hB(host_init ? B_size : 0);
+    host_vector<T> hC_host(host_init ? C_size : 0);
+    host_vector<T> hC_device(host_init ? C_size : 0);
+    host_vector<T> hC_copy(host_init ? C_size : 0);
 
     device_vector<T> dA(A_size);
     device_vector<T> dB(B_size);
@@ -121,22 +125,35 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
     device_vector<T> d_alpha(1);
     device_vector<T> d_beta(1);
 
-    // Initial Data on CPU
-    hipblas_init_matrix(
-        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
-    hipblas_init_matrix(
-        hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
-    hipblas_init_matrix(
-        hC_host, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    if(host_init)
+    {
+        // Initial Data on CPU
+        hipblas_init_matrix(
+            hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+        hipblas_init_matrix(
+            hC_host, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
 
-    // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of CPU BLAS
-    hC_copy   = hC_host;
-    hC_device = hC_host;
+        // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of
+        // CPU BLAS
+        hC_copy   = hC_host;
+        hC_device = hC_host;
 
-    // copy data from CPU to device, does not work for lda != A_row
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
+        // copy data from CPU to device, does not work for lda != A_row
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    }
+    else
+    {
+        hipblas_init_matrix(
+            dA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            dB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+        hipblas_init_matrix(
+            dC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    }
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
@@ -148,6 +165,29 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
     =================================================================== */
     if(arg.unit_check || arg.norm_check)
     {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        for(int i = 0; i < batch_count; i++)
+        {
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA.data() + stride_A * i,
+                          lda,
+                          hB.data() + stride_B * i,
+                          ldb,
+                          h_beta,
+                          hC_copy.data() + stride_C * i,
+                          ldc);
+        }
+
+        // The norm check runs on the device result, so the result is only copied to the host
+        // for the unit check, in host mode and then in device mode
+
         // host mode
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
@@ -171,8 +211,16 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
                                                         stride_C,
                                                         batch_count));
 
-        // copy output from device to CPU
-        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+        if(arg.unit_check)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+            unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_copy, hC_host);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host = norm_check_general_device<T>(
+                'F', M, N, ldc, stride_C, hC_copy, dC, batch_count);
+        }
 
         // device mode
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
@@ -195,41 +243,16 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
                                                         ldc,
                                                         stride_C,
                                                         batch_count));
-        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
-
-        /* =====================================================================
-                    CPU BLAS
-        =================================================================== */
-        for(int i = 0; i < batch_count; i++)
-        {
-            cblas_gemm<T>(transA,
-                          transB,
-                          M,
-                          N,
-                          K,
-                          h_alpha,
-                          hA.data() + stride_A * i,
-                          lda,
-                          hB.data() + stride_B * i,
-                          ldb,
-                          h_beta,
-                          hC_copy.data() + stride_C * i,
-                          ldc);
-        }
 
-        // enable unit check, notice unit check is not invasive, but norm check is,
-        // unit check and norm check can not be interchanged their order
         if(arg.unit_check)
         {
-            unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_copy, hC_host);
+            CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
             unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_copy, hC_device);
         }
         if(arg.norm_check)
         {
-            hipblas_error_host
-                = norm_check_general<T>('F', M, N, ldc, stride_C, hC_copy, hC_host, batch_count);
-            hipblas_error_device
-                = norm_check_general<T>('F', M, N, ldc, stride_C, hC_copy, hC_device, batch_count);
+            hipblas_error_device = norm_check_general_device<T>(
+                'F', M, N, ldc, stride_C, hC_copy, dC, batch_count);
         }
     }
 
@@ -240,13 +263,19 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
 
         // gemm has better performance in host mode. In rocBLAS in device mode
         // we need to copy alpha and beta to the host.
-        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        hipblasPointerMode_t mode  = hipblas_timing_pointer_mode(HIPBLAS_POINTER_MODE_HOST);
+        const T*             alpha = mode == HIPBLAS_POINTER_MODE_HOST ? &h_alpha : d_alpha;
+        const T*             beta  = mode == HIPBLAS_POINTER_MODE_HOST ? &h_beta : d_beta;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
                                                             transA,
@@ -254,19 +283,20 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
                                                             M,
                                                             N,
                                                             K,
-                                                            &h_alpha,
+                                                            alpha,
                                                             dA,
                                                             lda,
                                                             stride_A,
                                                             dB,
                                                             ldb,
                                                             stride_B,
-                                                            &h_beta,
+                                                            beta,
                                                             dC,
                                                             ldc,
                                                             stride_C,
                                                             batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemmStridedBatchedModel{}.log_args<T>(std::cout,
@@ -280,3 +310,203 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
 
     return HIPBLAS_STATUS_SUCCESS;
 }
+
+// Multiplies a batch by an A or a B shared with stride 0, with the other operands laid out so
+// that hipBLAS may run the batch as one larger gemm: a contiguous batch of B and C with a shared
+// A, and the A_i and C_i of a shared B as the rows of one matrix. Each instance is checked against
+// the CPU.
+template <typename T>
+inline hipblasStatus_t testing_gemm_strided_batched_broadcast(const Arguments& arg)
+{
+    bool FORTRAN = arg.fortran;
+    auto hipblasGemmStridedBatchedFn
+        = FORTRAN ? hipblasGemmStridedBatched<T, true> : hipblasGemmStridedBatched<T, false>;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Only valid problems, which the other tests check the arguments of
+    if(M <= 0 || N <= 0 || K <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    for(bool shared_B : {false, true})
+    {
+        int           lda      = arg.lda;
+        int           ldb      = arg.ldb;
+        int           ldc      = arg.ldc;
+        hipblasStride stride_A = 0;
+        hipblasStride stride_B = 0;
+        hipblasStride stride_C = size_t(ldc) * N;
+        if(shared_B)
+        {
+            if(transA == HIPBLAS_OP_N)
+            {
+                lda      = std::max(lda, M * batch_count);
+                stride_A = M;
+            }
+            else
+                stride_A = size_t(lda) * M;
+            ldc      = std::max(ldc, M * batch_count);
+            stride_C = M;
+        }
+        else
+            stride_B = size_t(ldb) * B_col;
+
+        size_t A_size = stride_A * (batch_count - 1) + size_t(lda) * A_col;
+        size_t B_size = stride_B * (batch_count - 1) + size_t(ldb) * B_col;
+        size_t C_size = stride_C * (batch_count - 1) + size_t(ldc) * N;
+
+        host_vector<T> hA(A_size), hB(B_size), hC(C_size), hC_gold(C_size);
+        hipblas_init_matrix(
+            hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+        hipblas_init_matrix(
+            hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+        hC_gold = hC;
+
+        device_vector<T> dA(A_size), dB(B_size), dC(C_size);
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        &h_alpha,
+                                                        dA,
+                                                        lda,
+                                                        stride_A,
+                                                        dB,
+                                                        ldb,
+                                                        stride_B,
+                                                        &h_beta,
+                                                        dC,
+                                                        ldc,
+                                                        stride_C,
+                                                        batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        for(int i = 0; i < batch_count; i++)
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA.data() + stride_A * i,
+                          lda,
+                          hB.data() + stride_B * i,
+                          ldb,
+                          h_beta,
+                          hC_gold.data() + stride_C * i,
+                          ldc);
+
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_gold, hC);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_strided_batched_cxx(const Arguments& arg)
+{
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Only valid problems, which the other tests check the arguments of
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+    if(M <= 0 || N <= 0 || K <= 0 || batch_count <= 0 || lda < A_row || ldb < B_row || ldc < M)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStride stride_A = size_t(lda) * A_col;
+    hipblasStride stride_B = size_t(ldb) * B_col;
+    hipblasStride stride_C = size_t(ldc) * N;
+    size_t        A_size   = stride_A * batch_count;
+    size_t        B_size   = stride_B * batch_count;
+    size_t        C_size   = stride_C * batch_count;
+
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    host_vector<T> hA(A_size), hB(B_size), hC(C_size), hC_gold(C_size);
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    hC_gold = hC;
+
+    device_vector<T> dA(A_size), dB(B_size), dC(C_size);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+    // The views carry the sizes, so the C++ interface takes them from A and C
+    auto A = hipblas::make_matrix_batch((const T*)dA, A_row, A_col, lda, stride_A, batch_count);
+    auto B = hipblas::make_matrix_batch((const T*)dB, B_row, B_col, ldb, stride_B, batch_count);
+    auto C = hipblas::make_matrix_batch((T*)dC, M, N, ldc, stride_C, batch_count);
+
+    // Operands which do not agree are rejected before calling hipBLAS
+    auto C_rows  = hipblas::make_matrix_batch((T*)dC, M + 1, N, ldc, stride_C, batch_count);
+    auto C_count = hipblas::make_matrix_batch((T*)dC, M, N, ldc, stride_C, batch_count + 1);
+    EXPECT_HIPBLAS_STATUS(hipblas::gemm(handle, transA, transB, &h_alpha, A, B, &h_beta, C_rows),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas::gemm(handle, transA, transB, &h_alpha, A, B, &h_beta, C_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblas::gemm(handle, transA, transB, &h_alpha, A, B, &h_beta, C));
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+    for(int i = 0; i < batch_count; i++)
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      h_alpha,
+                      hA.data() + stride_A * i,
+                      lda,
+                      hB.data() + stride_B * i,
+                      ldb,
+                      h_beta,
+                      hC_gold.data() + stride_C * i,
+                      ldc);
+
+    if(arg.unit_check)
+        unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_gold, hC);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
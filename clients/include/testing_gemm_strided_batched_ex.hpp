@@ -121,27 +121,42 @@ inline hipblasStatus_t testing_gemm_strided_batched_ex_template(const Arguments&
     double             gpu_time_used, hipblas_error_host, hipblas_error_device;
     hipblasLocalHandle handle(arg);
 
+    // Host data only when verifying, otherwise the matrices are initialized on the device
+    bool host_init = hipblas_host_init(arg);
+
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
-    host_vector<Ta> hA(size_A);
-    host_vector<Tb> hB(size_B);
-    host_vector<Tc> hC_host(size_C);
-    host_vector<Tc> hC_device(size_C);
-    host_vector<Tc> hC_gold(size_C);
-
-    // Initial Data on CPU
-    hipblas_init_matrix(
-        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
-    hipblas_init_matrix(
-        hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
-    hipblas_init_matrix(
-        hC_host, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
-    hC_gold = hC_device = hC_host;
-
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * size_A, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Tb) * size_B, hipMemcpyHostToDevice));
-
-    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+    host_vector<Ta> hA(host_init ? size_A : 0);
+    host_vector<Tb> hB(host_init ? size_B : 0);
+    host_vector<Tc> hC_host(host_init ? size_C : 0);
+    host_vector<Tc> hC_device(host_init ? size_C : 0);
+    host_vector<Tc> hC_gold(host_init ? size_C : 0);
+
+    if(host_init)
+    {
+        // Initial Data on CPU
+        hipblas_init_matrix(
+            hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+        hipblas_init_matrix(
+            hC_host, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+        hC_gold = hC_device = hC_host;
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Tb) * size_B, hipMemcpyHostToDevice));
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+    }
+    else
+    {
+        hipblas_init_matrix(
+            dA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            dB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+        hipblas_init_matrix(
+            dC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    }
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
 
@@ -262,11 +277,14 @@ inline hipblasStatus_t testing_gemm_strided_batched_ex_template(const Arguments&
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExFn(handle,
                                                               transA,
@@ -296,6 +314,7 @@ inline hipblasStatus_t testing_gemm_strided_batched_ex_template(const Arguments&
 #endif
                                                               algo));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemmStridedBatchedExModel{}.log_args<Tc>(std::cout,
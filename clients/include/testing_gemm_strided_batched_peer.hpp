@@ -0,0 +1,219 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmStridedBatchedPeerModel = ArgumentModel<e_transA,
+                                                         e_transB,
+                                                         e_M,
+                                                         e_N,
+                                                         e_K,
+                                                         e_alpha,
+                                                         e_lda,
+                                                         e_ldb,
+                                                         e_beta,
+                                                         e_ldc,
+                                                         e_batch_count>;
+
+inline void testname_gemm_strided_batched_peer(const Arguments& arg, std::string& name)
+{
+    hipblasGemmStridedBatchedPeerModel{}.test_name(arg, name);
+}
+
+template <typename T>
+struct hipblas_gemm_peer_functions;
+
+template <>
+struct hipblas_gemm_peer_functions<float>
+{
+    static constexpr auto gemmStridedBatchedPeer = hipblasSgemmStridedBatchedPeer;
+};
+
+template <>
+struct hipblas_gemm_peer_functions<hipblasComplex>
+{
+    static constexpr auto gemmStridedBatchedPeer = hipblasCgemmStridedBatchedPeer;
+};
+
+// A and B are put on the last device and copied back with hipblasCopyMatrixPeer, and the gemm is
+// checked against the CPU for a strided and a broadcast A. With one device the peer is the
+// current device.
+template <typename T>
+inline hipblasStatus_t testing_gemm_strided_batched_peer(const Arguments& arg)
+{
+    using F = hipblas_gemm_peer_functions<T>;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int device, device_count;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+    int peer = device_count - 1;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || batch_count < 0 || lda < std::max(1, A_row)
+       || ldb < std::max(1, B_row) || ldc < std::max(1, M))
+    {
+        return F::gemmStridedBatchedPeer(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         &h_alpha,
+                                         nullptr,
+                                         lda,
+                                         0,
+                                         nullptr,
+                                         ldb,
+                                         0,
+                                         peer,
+                                         &h_beta,
+                                         nullptr,
+                                         ldc,
+                                         0,
+                                         batch_count);
+    }
+
+    const hipblasStride stride_A = hipblasStride(lda) * A_col;
+    const hipblasStride stride_B = hipblasStride(ldb) * B_col;
+    const hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    const int    batches = std::max(batch_count, 1);
+    const size_t size_A  = std::max(stride_A * batches, hipblasStride(1));
+    const size_t size_B  = std::max(stride_B * batches, hipblasStride(1));
+    const size_t size_C  = std::max(stride_C * batches, hipblasStride(1));
+
+    host_vector<T> hA(size_A);
+    host_vector<T> hA_copy(size_A);
+    host_vector<T> hA_gold(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC(size_C);
+    host_vector<T> hC_gold(size_C);
+    host_vector<T> hC_result(size_C);
+
+    srand(1);
+    hipblas_init<T>(hA);
+    hipblas_init<T>(hB);
+    hipblas_init<T>(hC);
+
+    // A and B live on the peer, C and the copy of A on the current device
+    CHECK_HIP_ERROR(hipSetDevice(peer));
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipSetDevice(device));
+
+    device_vector<T> dA_copy(size_A);
+    device_vector<T> dC(size_C);
+
+    // The rows of A past A_row stay unset in the copy, so only the matrix is compared
+    CHECK_HIP_ERROR(hipMemset(dA_copy, 0, sizeof(T) * size_A));
+    for(size_t i = 0; i < size_A; i++)
+        hA_gold[i] = i % lda < size_t(A_row) && i < size_t(stride_A) * batches ? hA[i] : T(0);
+    CHECK_HIPBLAS_ERROR(hipblasCopyMatrixPeer(
+        A_row, A_col * batches, sizeof(T), dA, lda, peer, dA_copy, lda, device));
+    CHECK_HIP_ERROR(hipMemcpy(hA_copy, dA_copy, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    if(arg.unit_check)
+        unit_check_general<T>(1, size_A, 1, hA_gold.data(), hA_copy.data());
+
+    // The relative norm of the error is not defined for empty matrices
+    real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+    double    tolerance = eps * 40 * std::max(K, 1);
+    bool      check     = arg.unit_check && M && N && batch_count;
+
+    for(hipblasStride strideA : {stride_A, hipblasStride(0)})
+    {
+        hC_gold = hC;
+        for(int b = 0; b < batch_count; b++)
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA.data() + b * strideA,
+                          lda,
+                          hB.data() + b * stride_B,
+                          ldb,
+                          h_beta,
+                          hC_gold.data() + b * stride_C,
+                          ldc);
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(F::gemmStridedBatchedPeer(handle,
+                                                      transA,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      &h_alpha,
+                                                      dA,
+                                                      lda,
+                                                      strideA,
+                                                      dB,
+                                                      ldb,
+                                                      stride_B,
+                                                      peer,
+                                                      &h_beta,
+                                                      dC,
+                                                      ldc,
+                                                      stride_C,
+                                                      batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hC_result, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+
+        if(check)
+            unit_check_error(
+                norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC_result, batch_count),
+                tolerance);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,266 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmtModel = ArgumentModel<e_uplo,
+                                        e_transA,
+                                        e_transB,
+                                        e_N,
+                                        e_K,
+                                        e_alpha,
+                                        e_lda,
+                                        e_ldb,
+                                        e_beta,
+                                        e_ldc,
+                                        e_batch_count>;
+
+inline void testname_gemmt(const Arguments& arg, std::string& name)
+{
+    hipblasGemmtModel{}.test_name(arg, name);
+}
+
+template <typename T>
+struct hipblas_gemmt_functions;
+
+template <>
+struct hipblas_gemmt_functions<float>
+{
+    static constexpr auto gemmt               = hipblasSgemmt;
+    static constexpr auto gemmtBatched        = hipblasSgemmtBatched;
+    static constexpr auto gemmtStridedBatched = hipblasSgemmtStridedBatched;
+};
+
+template <>
+struct hipblas_gemmt_functions<hipblasComplex>
+{
+    static constexpr auto gemmt               = hipblasCgemmt;
+    static constexpr auto gemmtBatched        = hipblasCgemmtBatched;
+    static constexpr auto gemmtStridedBatched = hipblasCgemmtStridedBatched;
+};
+
+// Checks the uplo triangle of each form against the full gemm on the CPU, and that the other
+// triangle keeps its initial values. The plain and batched forms run in host pointer mode and the
+// strided batched form in device pointer mode.
+template <typename T>
+inline hipblasStatus_t testing_gemmt(const Arguments& arg)
+{
+    using F = hipblas_gemmt_functions<T>;
+
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    if(N < 0 || K < 0 || batch_count < 0 || lda < std::max(1, transA == HIPBLAS_OP_N ? N : K)
+       || ldb < std::max(1, transB == HIPBLAS_OP_N ? K : N) || ldc < std::max(1, N))
+    {
+        return F::gemmt(handle,
+                        uplo,
+                        transA,
+                        transB,
+                        N,
+                        K,
+                        &h_alpha,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        ldb,
+                        &h_beta,
+                        nullptr,
+                        ldc);
+    }
+
+    const hipblasStride stride_A = hipblasStride(lda) * (transA == HIPBLAS_OP_N ? K : N);
+    const hipblasStride stride_B = hipblasStride(ldb) * (transB == HIPBLAS_OP_N ? N : K);
+    const hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    // The plain form runs on the first matrices even when batch_count is 0
+    const int    batches = std::max(batch_count, 1);
+    const size_t size_A  = std::max(stride_A * batches, hipblasStride(1));
+    const size_t size_B  = std::max(stride_B * batches, hipblasStride(1));
+    const size_t size_C  = std::max(stride_C * batches, hipblasStride(1));
+
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+    host_vector<T> hC_init(size_C);
+    host_vector<T> hC_full(size_C);
+    host_vector<T> hC_gold(size_C);
+    host_vector<T> hC(size_C);
+
+    srand(1);
+    hipblas_init<T>(hA);
+    hipblas_init<T>(hB);
+    hipblas_init<T>(hC_init);
+
+    hC_full = hC_init;
+    hC_gold = hC_init;
+    for(int b = 0; b < batch_count; b++)
+    {
+        cblas_gemm<T>(transA,
+                      transB,
+                      N,
+                      N,
+                      K,
+                      h_alpha,
+                      hA.data() + b * stride_A,
+                      lda,
+                      hB.data() + b * stride_B,
+                      ldb,
+                      h_beta,
+                      hC_full.data() + b * stride_C,
+                      ldc);
+        for(int j = 0; j < N; j++)
+        {
+            int i_begin = uplo == HIPBLAS_FILL_MODE_UPPER ? 0 : j;
+            int i_end   = uplo == HIPBLAS_FILL_MODE_UPPER ? j + 1 : N;
+            for(int i = i_begin; i < i_end; i++)
+                hC_gold[b * stride_C + i + size_t(j) * ldc]
+                    = hC_full[b * stride_C + i + size_t(j) * ldc];
+        }
+    }
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    device_vector<T> dC(size_C);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // The batched form runs on copies of the matrices in batch vectors
+    host_batch_vector<T>   hA_batch(std::max(stride_A, hipblasStride(1)), 1, batch_count);
+    host_batch_vector<T>   hB_batch(std::max(stride_B, hipblasStride(1)), 1, batch_count);
+    host_batch_vector<T>   hC_batch(std::max(stride_C, hipblasStride(1)), 1, batch_count);
+    host_batch_vector<T>   hC_gold_batch(std::max(stride_C, hipblasStride(1)), 1, batch_count);
+    device_batch_vector<T> dA_batch(std::max(stride_A, hipblasStride(1)), 1, batch_count);
+    device_batch_vector<T> dB_batch(std::max(stride_B, hipblasStride(1)), 1, batch_count);
+    device_batch_vector<T> dC_batch(std::max(stride_C, hipblasStride(1)), 1, batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        std::copy(hA.data() + b * stride_A, hA.data() + (b + 1) * stride_A, hA_batch[b]);
+        std::copy(hB.data() + b * stride_B, hB.data() + (b + 1) * stride_B, hB_batch[b]);
+        std::copy(hC_init.data() + b * stride_C, hC_init.data() + (b + 1) * stride_C, hC_batch[b]);
+        std::copy(
+            hC_gold.data() + b * stride_C, hC_gold.data() + (b + 1) * stride_C, hC_gold_batch[b]);
+    }
+    CHECK_HIP_ERROR(dA_batch.transfer_from(hA_batch));
+    CHECK_HIP_ERROR(dB_batch.transfer_from(hB_batch));
+    CHECK_HIP_ERROR(dC_batch.transfer_from(hC_batch));
+
+    // Resets dC to the initial C, then compares the batch_check first matrices of C with the gold
+    // after fn
+    auto run = [&](auto fn, int batch_check) {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(T) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(fn());
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+        if(arg.unit_check)
+            unit_check_general<T>(N, N, batch_check, ldc, stride_C, hC_gold, hC);
+        return HIPBLAS_STATUS_SUCCESS;
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(run(
+        [&]() {
+            return F::gemmt(handle,
+                            uplo,
+                            transA,
+                            transB,
+                            N,
+                            K,
+                            &h_alpha,
+                            dA,
+                            lda,
+                            dB,
+                            ldb,
+                            &h_beta,
+                            dC,
+                            ldc);
+        },
+        std::min(batch_count, 1)));
+    CHECK_HIPBLAS_ERROR(F::gemmtBatched(handle,
+                                        uplo,
+                                        transA,
+                                        transB,
+                                        N,
+                                        K,
+                                        &h_alpha,
+                                        dA_batch.ptr_on_device(),
+                                        lda,
+                                        dB_batch.ptr_on_device(),
+                                        ldb,
+                                        &h_beta,
+                                        dC_batch.ptr_on_device(),
+                                        ldc,
+                                        batch_count));
+    CHECK_HIP_ERROR(hC_batch.transfer_from(dC_batch));
+    if(arg.unit_check)
+        unit_check_general<T>(N, N, batch_count, ldc, hC_gold_batch, hC_batch);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(run(
+        [&]() {
+            return F::gemmtStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          transB,
+                                          N,
+                                          K,
+                                          d_alpha,
+                                          dA,
+                                          lda,
+                                          stride_A,
+                                          dB,
+                                          ldb,
+                                          stride_B,
+                                          d_beta,
+                                          dC,
+                                          ldc,
+                                          stride_C,
+                                          batch_count);
+        },
+        batch_count));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -168,20 +168,27 @@ inline hipblasStatus_t testing_gemv(const Arguments& arg)
     {
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        hipblasPointerMode_t mode  = hipblas_timing_pointer_mode(HIPBLAS_POINTER_MODE_DEVICE);
+        const T*             alpha = mode == HIPBLAS_POINTER_MODE_HOST ? &h_alpha : d_alpha;
+        const T*             beta  = mode == HIPBLAS_POINTER_MODE_HOST ? &h_beta : d_beta;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
         CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(
-                hipblasGemvFn(handle, transA, M, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
+                hipblasGemvFn(handle, transA, M, N, alpha, dA, lda, dx, incx, beta, dy, incy));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemvModel{}.log_args<T>(std::cout,
@@ -0,0 +1,218 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemvExModel
+    = ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy, e_batch_count>;
+
+inline void testname_gemv_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemvExModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline T hipblas_gemv_ex_convert(float value)
+{
+    if constexpr(std::is_same<T, hipblasHalf>{})
+        return float_to_half(value);
+    else if constexpr(std::is_same<T, hipblasBfloat16>{})
+        return float_to_bfloat16(value);
+    else
+        return T(value);
+}
+
+template <typename T>
+inline float hipblas_gemv_ex_to_float(T value)
+{
+    if constexpr(std::is_same<T, hipblasHalf>{})
+        return half_to_float(value);
+    else if constexpr(std::is_same<T, hipblasBfloat16>{})
+        return bfloat16_to_float(value);
+    else
+        return float(value);
+}
+
+// The inputs are in {-1, 0, 1} and y is initialized to integers, so every result is an integer
+// exact in half and bfloat16 and the half and bfloat16 paths are checked exactly against float.
+// Type combinations a backend cannot run return HIPBLAS_STATUS_NOT_SUPPORTED and are skipped.
+inline hipblasStatus_t testing_gemv_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int incx        = arg.incx;
+    int incy        = arg.incy;
+    int batch_count = arg.batch_count;
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    int dim_x = transA == HIPBLAS_OP_N ? N : M;
+    int dim_y = transA == HIPBLAS_OP_N ? M : N;
+
+    hipblasLocalHandle handle(arg);
+
+    auto hipblasGemvExFn = [&](hipDataType   io_type,
+                               const void*   A,
+                               const void*   x,
+                               hipDataType   y_type,
+                               void*         y,
+                               hipblasStride stride_A,
+                               hipblasStride stride_x,
+                               hipblasStride stride_y) {
+        if(batch_count == 1)
+            return hipblasGemvEx(handle,
+                                 transA,
+                                 M,
+                                 N,
+                                 &h_alpha,
+                                 A,
+                                 io_type,
+                                 lda,
+                                 x,
+                                 io_type,
+                                 incx,
+                                 &h_beta,
+                                 y,
+                                 y_type,
+                                 incy,
+                                 HIPBLAS_COMPUTE_32F);
+        return hipblasGemvStridedBatchedEx(handle,
+                                           transA,
+                                           M,
+                                           N,
+                                           &h_alpha,
+                                           A,
+                                           io_type,
+                                           lda,
+                                           stride_A,
+                                           x,
+                                           io_type,
+                                           incx,
+                                           stride_x,
+                                           &h_beta,
+                                           y,
+                                           y_type,
+                                           incy,
+                                           stride_y,
+                                           batch_count,
+                                           HIPBLAS_COMPUTE_32F);
+    };
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy || batch_count < 0)
+    {
+        return hipblasGemvExFn(HIP_R_32F, nullptr, nullptr, HIP_R_32F, nullptr, 0, 0, 0);
+    }
+
+    const hipblasStride stride_A = hipblasStride(lda) * N;
+    const hipblasStride stride_x = hipblasStride(dim_x) * std::abs(incx);
+    const hipblasStride stride_y = hipblasStride(dim_y) * std::abs(incy);
+
+    const size_t size_A = stride_A * batch_count;
+    const size_t size_x = stride_x * batch_count;
+    const size_t size_y = stride_y * batch_count;
+
+    host_vector<float> hA(size_A);
+    host_vector<float> hx(size_x);
+    host_vector<float> hy_init(size_y);
+    host_vector<float> hy_gold(size_y);
+    host_vector<float> hy(size_y);
+
+    srand(1);
+    for(auto& a : hA)
+        a = float(rand() % 3 - 1);
+    for(auto& x : hx)
+        x = float(rand() % 3 - 1);
+    for(auto& y : hy_init)
+        y = float(rand() % 5 - 2);
+
+    hy_gold = hy_init;
+    for(int b = 0; b < batch_count; b++)
+    {
+        cblas_gemv<float>(transA,
+                          M,
+                          N,
+                          h_alpha,
+                          hA.data() + b * stride_A,
+                          lda,
+                          hx.data() + b * stride_x,
+                          incx,
+                          h_beta,
+                          hy_gold.data() + b * stride_y,
+                          incy);
+    }
+
+    auto check = [&](auto ti, auto to, hipDataType io_type, hipDataType y_type) {
+        using Ti = decltype(ti);
+        using To = decltype(to);
+
+        host_vector<Ti> hA_typed(size_A);
+        host_vector<Ti> hx_typed(size_x);
+        host_vector<To> hy_typed(size_y);
+        for(size_t i = 0; i < size_A; i++)
+            hA_typed[i] = hipblas_gemv_ex_convert<Ti>(hA[i]);
+        for(size_t i = 0; i < size_x; i++)
+            hx_typed[i] = hipblas_gemv_ex_convert<Ti>(hx[i]);
+        for(size_t i = 0; i < size_y; i++)
+            hy_typed[i] = hipblas_gemv_ex_convert<To>(hy_init[i]);
+
+        device_vector<Ti> dA(size_A);
+        device_vector<Ti> dx(size_x);
+        device_vector<To> dy(size_y);
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA_typed, sizeof(Ti) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx_typed, sizeof(Ti) * size_x, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy_typed, sizeof(To) * size_y, hipMemcpyHostToDevice));
+
+        hipblasStatus_t status
+            = hipblasGemvExFn(io_type, dA, dx, y_type, dy, stride_A, stride_x, stride_y);
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+            return HIPBLAS_STATUS_SUCCESS;
+        CHECK_HIPBLAS_ERROR(status);
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_typed, dy, sizeof(To) * size_y, hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size_y; i++)
+            hy[i] = hipblas_gemv_ex_to_float(hy_typed[i]);
+        if(arg.unit_check)
+            unit_check_general<float>(1, dim_y, batch_count, std::abs(incy), stride_y, hy_gold, hy);
+        return HIPBLAS_STATUS_SUCCESS;
+    };
+
+    CHECK_HIPBLAS_ERROR(check(float{}, float{}, HIP_R_32F, HIP_R_32F));
+    CHECK_HIPBLAS_ERROR(check(hipblasHalf{}, hipblasHalf{}, HIP_R_16F, HIP_R_16F));
+    CHECK_HIPBLAS_ERROR(check(hipblasHalf{}, float{}, HIP_R_16F, HIP_R_32F));
+    CHECK_HIPBLAS_ERROR(check(hipblasBfloat16{}, hipblasBfloat16{}, HIP_R_16BF, HIP_R_16BF));
+    CHECK_HIPBLAS_ERROR(check(hipblasBfloat16{}, float{}, HIP_R_16BF, HIP_R_32F));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -250,13 +250,16 @@ inline hipblasStatus_t testing_gemv_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            timer.record(iter);
             CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
                                                             transA,
                                                             M,
@@ -275,6 +278,7 @@ inline hipblasStatus_t testing_gemv_strided_batched(const Arguments& arg)
                                                             batch_count));
         }
 
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemvStridedBatchedModel{}.log_args<T>(std::cout,
@@ -288,3 +292,97 @@ inline hipblasStatus_t testing_gemv_strided_batched(const Arguments& arg)
 
     return HIPBLAS_STATUS_SUCCESS;
 }
+
+// Multiplies a batch of vectors by an A shared with stride 0, with the x_i and y_i laid out so
+// that hipBLAS may run the batch as one gemm: the x_i as the columns of a matrix, and as its rows,
+// with contiguous y_i. Each instance is checked against the CPU.
+template <typename T>
+inline hipblasStatus_t testing_gemv_strided_batched_broadcast(const Arguments& arg)
+{
+    bool FORTRAN = arg.fortran;
+    auto hipblasGemvStridedBatchedFn
+        = FORTRAN ? hipblasGemvStridedBatched<T, true> : hipblasGemvStridedBatched<T, false>;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                lda         = arg.lda;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Only valid problems, which the other tests check the arguments of
+    if(M <= 0 || N <= 0 || lda < M || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    int dim_x = transA == HIPBLAS_OP_N ? N : M;
+    int dim_y = transA == HIPBLAS_OP_N ? M : N;
+
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    host_vector<T> hA(size_t(lda) * N);
+    hipblas_init_matrix(hA, arg, M, N, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    device_vector<T> dA(hA.size());
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+
+    for(bool x_rows : {false, true})
+    {
+        int           incx     = x_rows ? batch_count : 1;
+        hipblasStride stride_x = x_rows ? 1 : dim_x;
+        hipblasStride stride_y = dim_y;
+        size_t        X_size   = size_t(dim_x) * batch_count;
+        size_t        Y_size   = size_t(dim_y) * batch_count;
+
+        host_vector<T> hx(X_size), hy(Y_size), hy_gold(Y_size);
+        if(x_rows)
+            hipblas_init_matrix(
+                hx, arg, batch_count, dim_x, incx, 0, 1, hipblas_client_alpha_sets_nan);
+        else
+            hipblas_init_matrix(
+                hx, arg, dim_x, batch_count, dim_x, 0, 1, hipblas_client_alpha_sets_nan);
+        hipblas_init_matrix(hy, arg, dim_y, batch_count, dim_y, 0, 1, hipblas_client_beta_sets_nan);
+        hy_gold = hy;
+
+        device_vector<T> dx(X_size), dy(Y_size);
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * X_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * Y_size, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
+                                                        transA,
+                                                        M,
+                                                        N,
+                                                        &h_alpha,
+                                                        dA,
+                                                        lda,
+                                                        0,
+                                                        dx,
+                                                        incx,
+                                                        stride_x,
+                                                        &h_beta,
+                                                        dy,
+                                                        1,
+                                                        stride_y,
+                                                        batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
+
+        for(int b = 0; b < batch_count; b++)
+            cblas_gemv<T>(transA,
+                          M,
+                          N,
+                          h_alpha,
+                          hA.data(),
+                          lda,
+                          hx.data() + b * stride_x,
+                          incx,
+                          h_beta,
+                          hy_gold.data() + b * stride_y,
+                          1);
+
+        if(arg.unit_check)
+            unit_check_general<T>(1, dim_y, batch_count, 1, stride_y, hy_gold, hy);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
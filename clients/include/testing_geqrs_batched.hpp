@@ -0,0 +1,313 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGeqrsBatchedModel = ArgumentModel<e_M, e_N, e_K, e_lda, e_ldb, e_batch_count>;
+
+inline void testname_geqrs_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGeqrsBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_geqrs_batched_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    const int          M          = 102;
+    const int          N          = 101;
+    const int          nrhs       = 10;
+    const int          lda        = 103;
+    const int          ldb        = 104;
+    const int          batchCount = 2;
+    int                info       = 0;
+
+    device_batch_vector<T> dA(size_t(lda) * N, 1, batchCount);
+    device_batch_vector<T> dTau(N, 1, batchCount);
+    device_batch_vector<T> dB(size_t(ldb) * nrhs, 1, batchCount);
+
+    T* const* dAp   = dA.ptr_on_device();
+    T* const* dTaup = dTau.ptr_on_device();
+    T* const* dBp   = dB.ptr_on_device();
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(
+            handle, 1, M, N, nrhs, dAp, lda, dTaup, dBp, ldb, nullptr, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(
+            handle, 1, -1, N, nrhs, dAp, lda, dTaup, dBp, ldb, &info, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    // n > m is not supported
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(
+            handle, 1, N - 1, N, nrhs, dAp, lda, dTaup, dBp, ldb, &info, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(handle, 1, M, N, -1, dAp, lda, dTaup, dBp, ldb, &info, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(
+            handle, 1, M, N, nrhs, nullptr, lda, dTaup, dBp, ldb, &info, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(
+            handle, 1, M, N, nrhs, dAp, M - 1, dTaup, dBp, ldb, &info, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(
+            handle, 1, M, N, nrhs, dAp, lda, nullptr, dBp, ldb, &info, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-7, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(
+            handle, 1, M, N, nrhs, dAp, lda, dTaup, nullptr, ldb, &info, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(
+            handle, 1, M, N, nrhs, dAp, lda, dTaup, dBp, M - 1, &info, batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-9, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(handle, 1, M, N, nrhs, dAp, lda, dTaup, dBp, ldb, &info, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-11, info);
+
+    // If N == 0, A and tau can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(
+            handle, 1, M, 0, nrhs, nullptr, lda, nullptr, dBp, ldb, &info, batchCount),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // If nrhs == 0, B can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(
+            handle, 0, M, N, 0, dAp, lda, dTaup, nullptr, ldb, &info, batchCount),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // If batchCount == 0, nothing is accessed
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsBatched<T>(handle, 1, M, N, nrhs, dAp, lda, dTaup, dBp, ldb, &info, 0),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_geqrs_batched(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    int M          = arg.M;
+    int N          = arg.N;
+    int nrhs       = arg.K;
+    int lda        = arg.lda;
+    int ldb        = arg.ldb;
+    int batchCount = arg.batch_count;
+
+    size_t A_size   = size_t(lda) * N;
+    size_t tau_size = std::max(1, N);
+    size_t B_size   = size_t(ldb) * nrhs;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || N > M || nrhs < 0 || lda < M || ldb < M || batchCount < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batchCount == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batchCount);
+    host_batch_vector<T> hA_ref(A_size, 1, batchCount);
+    host_batch_vector<T> hB(B_size, 1, batchCount);
+    host_batch_vector<T> hB_res(B_size, 1, batchCount);
+    int                  info;
+
+    device_batch_vector<T> dA(A_size, 1, batchCount);
+    device_batch_vector<T> dTau(tau_size, 1, batchCount);
+    device_batch_vector<T> dB(B_size, 1, batchCount);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA, hB on CPU
+    hipblas_init<T>(hA, true);
+    hipblas_init<T>(hB);
+
+    // scale A to avoid singularities
+    for(int b = 0; b < batchCount; b++)
+    {
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        int            sizeW = std::max(1, N + std::max(N, nrhs));
+        host_vector<T> hW(sizeW);
+        double         eps       = std::numeric_limits<U>::epsilon();
+        double         tolerance = N * eps * 100;
+        int            zero      = 0;
+
+        hipblas_error = 0.0;
+
+        // The first call factors A, the second reuses the factorization for new right-hand sides
+        for(int factorize = 1; factorize >= 0; factorize--)
+        {
+            if(!factorize)
+            {
+                hipblas_init<T>(hB);
+                CHECK_HIP_ERROR(dB.transfer_from(hB));
+            }
+
+            /* =====================================================================
+                HIPBLAS
+            =================================================================== */
+            CHECK_HIPBLAS_ERROR(hipblasGeqrsBatched<T>(handle,
+                                                       factorize,
+                                                       M,
+                                                       N,
+                                                       nrhs,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       dTau.ptr_on_device(),
+                                                       dB.ptr_on_device(),
+                                                       ldb,
+                                                       &info,
+                                                       batchCount));
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hB_res.transfer_from(dB));
+
+            /* =====================================================================
+               CPU LAPACK
+            =================================================================== */
+            hA_ref.copy_from(hA);
+            for(int b = 0; b < batchCount; b++)
+            {
+                cblas_gels('N', M, N, nrhs, hA_ref[b], lda, hB[b], ldb, hW.data(), sizeW);
+            }
+
+            hipblas_error += norm_check_general<T>('F', N, nrhs, ldb, hB, hB_res, batchCount);
+
+            if(arg.unit_check)
+                unit_check_general(1, 1, 1, &zero, &info);
+        }
+
+        if(arg.unit_check)
+            unit_check_error(hipblas_error, tolerance);
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasEventTimer timer(arg, handle);
+
+        // Time the solves reusing the factorization, which is what geqrs adds to gels
+        CHECK_HIPBLAS_ERROR(hipblasGeqrsBatched<T>(handle,
+                                                   1,
+                                                   M,
+                                                   N,
+                                                   0,
+                                                   dA.ptr_on_device(),
+                                                   lda,
+                                                   dTau.ptr_on_device(),
+                                                   dB.ptr_on_device(),
+                                                   ldb,
+                                                   &info,
+                                                   batchCount));
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGeqrsBatched<T>(handle,
+                                                       0,
+                                                       M,
+                                                       N,
+                                                       nrhs,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       dTau.ptr_on_device(),
+                                                       dB.ptr_on_device(),
+                                                       ldb,
+                                                       &info,
+                                                       batchCount));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGeqrsBatchedModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               ArgumentLogging::NA_value,
+                                               ArgumentLogging::NA_value,
+                                               hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,484 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGeqrsStridedBatchedModel
+    = ArgumentModel<e_M, e_N, e_K, e_lda, e_ldb, e_stride_scale, e_batch_count>;
+
+inline void testname_geqrs_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGeqrsStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_geqrs_strided_batched_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    const int          M          = 102;
+    const int          N          = 101;
+    const int          nrhs       = 10;
+    const int          lda        = 103;
+    const int          ldb        = 104;
+    const int          batchCount = 2;
+    int                info       = 0;
+
+    const hipblasStride strideA = size_t(lda) * N;
+    const hipblasStride strideT = N;
+    const hipblasStride strideB = size_t(ldb) * nrhs;
+
+    device_vector<T> dA(strideA * batchCount);
+    device_vector<T> dTau(strideT * batchCount);
+    device_vector<T> dB(strideB * batchCount);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      1,
+                                      M,
+                                      N,
+                                      nrhs,
+                                      dA,
+                                      lda,
+                                      strideA,
+                                      dTau,
+                                      strideT,
+                                      dB,
+                                      ldb,
+                                      strideB,
+                                      nullptr,
+                                      batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      1,
+                                      -1,
+                                      N,
+                                      nrhs,
+                                      dA,
+                                      lda,
+                                      strideA,
+                                      dTau,
+                                      strideT,
+                                      dB,
+                                      ldb,
+                                      strideB,
+                                      &info,
+                                      batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    // n > m is not supported
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      1,
+                                      N - 1,
+                                      N,
+                                      nrhs,
+                                      dA,
+                                      lda,
+                                      strideA,
+                                      dTau,
+                                      strideT,
+                                      dB,
+                                      ldb,
+                                      strideB,
+                                      &info,
+                                      batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      1,
+                                      M,
+                                      N,
+                                      -1,
+                                      dA,
+                                      lda,
+                                      strideA,
+                                      dTau,
+                                      strideT,
+                                      dB,
+                                      ldb,
+                                      strideB,
+                                      &info,
+                                      batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      1,
+                                      M,
+                                      N,
+                                      nrhs,
+                                      nullptr,
+                                      lda,
+                                      strideA,
+                                      dTau,
+                                      strideT,
+                                      dB,
+                                      ldb,
+                                      strideB,
+                                      &info,
+                                      batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      1,
+                                      M,
+                                      N,
+                                      nrhs,
+                                      dA,
+                                      M - 1,
+                                      strideA,
+                                      dTau,
+                                      strideT,
+                                      dB,
+                                      ldb,
+                                      strideB,
+                                      &info,
+                                      batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      1,
+                                      M,
+                                      N,
+                                      nrhs,
+                                      dA,
+                                      lda,
+                                      strideA,
+                                      nullptr,
+                                      strideT,
+                                      dB,
+                                      ldb,
+                                      strideB,
+                                      &info,
+                                      batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      1,
+                                      M,
+                                      N,
+                                      nrhs,
+                                      dA,
+                                      lda,
+                                      strideA,
+                                      dTau,
+                                      strideT,
+                                      nullptr,
+                                      ldb,
+                                      strideB,
+                                      &info,
+                                      batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-10, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      1,
+                                      M,
+                                      N,
+                                      nrhs,
+                                      dA,
+                                      lda,
+                                      strideA,
+                                      dTau,
+                                      strideT,
+                                      dB,
+                                      M - 1,
+                                      strideB,
+                                      &info,
+                                      batchCount),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-11, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(
+            handle, 1, M, N, nrhs, dA, lda, strideA, dTau, strideT, dB, ldb, strideB, &info, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-15, info);
+
+    // If N == 0, A and tau can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      1,
+                                      M,
+                                      0,
+                                      nrhs,
+                                      nullptr,
+                                      lda,
+                                      strideA,
+                                      nullptr,
+                                      strideT,
+                                      dB,
+                                      ldb,
+                                      strideB,
+                                      &info,
+                                      batchCount),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // If nrhs == 0, B can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(handle,
+                                      0,
+                                      M,
+                                      N,
+                                      0,
+                                      dA,
+                                      lda,
+                                      strideA,
+                                      dTau,
+                                      strideT,
+                                      nullptr,
+                                      ldb,
+                                      strideB,
+                                      &info,
+                                      batchCount),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // If batchCount == 0, nothing is accessed
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGeqrsStridedBatched<T>(
+            handle, 1, M, N, nrhs, dA, lda, strideA, dTau, strideT, dB, ldb, strideB, &info, 0),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_geqrs_strided_batched(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    int    M            = arg.M;
+    int    N            = arg.N;
+    int    nrhs         = arg.K;
+    int    lda          = arg.lda;
+    int    ldb          = arg.ldb;
+    int    batchCount   = arg.batch_count;
+    double stride_scale = arg.stride_scale;
+
+    hipblasStride strideA  = size_t(lda) * N * stride_scale;
+    hipblasStride strideT  = std::max(1, N) * stride_scale;
+    hipblasStride strideB  = size_t(ldb) * nrhs * stride_scale;
+    size_t        A_size   = strideA * batchCount;
+    size_t        tau_size = strideT * batchCount;
+    size_t        B_size   = strideB * batchCount;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || N > M || nrhs < 0 || lda < M || ldb < M || batchCount < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batchCount == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_ref(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB_res(B_size);
+    int            info;
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dTau(tau_size);
+    device_vector<T> dB(B_size);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA, hB on CPU
+    hipblas_init<T>(hA, M, N, lda, strideA, batchCount);
+    hipblas_init<T>(hB, M, nrhs, ldb, strideB, batchCount);
+
+    // scale A to avoid singularities
+    for(int b = 0; b < batchCount; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hAb[i + j * lda] += 400;
+                else
+                    hAb[i + j * lda] -= 4;
+            }
+        }
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        int            sizeW = std::max(1, N + std::max(N, nrhs));
+        host_vector<T> hW(sizeW);
+        double         eps       = std::numeric_limits<U>::epsilon();
+        double         tolerance = N * eps * 100;
+        int            zero      = 0;
+
+        hipblas_error = 0.0;
+
+        // The first call factors A, the second reuses the factorization for new right-hand sides
+        for(int factorize = 1; factorize >= 0; factorize--)
+        {
+            if(!factorize)
+            {
+                hipblas_init<T>(hB, M, nrhs, ldb, strideB, batchCount);
+                CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+            }
+
+            /* =====================================================================
+                HIPBLAS
+            =================================================================== */
+            CHECK_HIPBLAS_ERROR(hipblasGeqrsStridedBatched<T>(handle,
+                                                              factorize,
+                                                              M,
+                                                              N,
+                                                              nrhs,
+                                                              dA,
+                                                              lda,
+                                                              strideA,
+                                                              dTau,
+                                                              strideT,
+                                                              dB,
+                                                              ldb,
+                                                              strideB,
+                                                              &info,
+                                                              batchCount));
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hipMemcpy(hB_res, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+
+            /* =====================================================================
+               CPU LAPACK
+            =================================================================== */
+            hA_ref = hA;
+            for(int b = 0; b < batchCount; b++)
+            {
+                cblas_gels('N',
+                           M,
+                           N,
+                           nrhs,
+                           hA_ref.data() + b * strideA,
+                           lda,
+                           hB.data() + b * strideB,
+                           ldb,
+                           hW.data(),
+                           sizeW);
+            }
+
+            hipblas_error += norm_check_general<T>(
+                'F', N, nrhs, ldb, strideB, hB.data(), hB_res.data(), batchCount);
+
+            if(arg.unit_check)
+                unit_check_general(1, 1, 1, &zero, &info);
+        }
+
+        if(arg.unit_check)
+            unit_check_error(hipblas_error, tolerance);
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasEventTimer timer(arg, handle);
+
+        // Time the solves reusing the factorization, which is what geqrs adds to gels
+        CHECK_HIPBLAS_ERROR(hipblasGeqrsStridedBatched<T>(handle,
+                                                          1,
+                                                          M,
+                                                          N,
+                                                          0,
+                                                          dA,
+                                                          lda,
+                                                          strideA,
+                                                          dTau,
+                                                          strideT,
+                                                          dB,
+                                                          ldb,
+                                                          strideB,
+                                                          &info,
+                                                          batchCount));
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGeqrsStridedBatched<T>(handle,
+                                                              0,
+                                                              M,
+                                                              N,
+                                                              nrhs,
+                                                              dA,
+                                                              lda,
+                                                              strideA,
+                                                              dTau,
+                                                              strideT,
+                                                              dB,
+                                                              ldb,
+                                                              strideB,
+                                                              &info,
+                                                              batchCount));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGeqrsStridedBatchedModel{}.log_args<T>(std::cout,
+                                                      arg,
+                                                      gpu_time_used,
+                                                      ArgumentLogging::NA_value,
+                                                      ArgumentLogging::NA_value,
+                                                      hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,328 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvIRStridedBatchedModel
+    = ArgumentModel<e_N, e_lda, e_ldb, e_ldc, e_stride_scale, e_batch_count>;
+
+inline void testname_gesv_ir_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGesvIRStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gesv_ir_strided_batched_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle  handle(arg);
+    const int           N           = 100;
+    const int           nrhs        = 1;
+    const int           lda         = 101;
+    const int           ldb         = 102;
+    const int           ldx         = 103;
+    const int           batch_count = 2;
+    const hipblasStride strideA     = size_t(lda) * N;
+    const hipblasStride strideP     = N;
+    const hipblasStride strideB     = ldb;
+    const hipblasStride strideX     = ldx;
+
+    device_vector<T>   dA(strideA * batch_count);
+    device_vector<T>   dB(strideB * batch_count);
+    device_vector<T>   dX(strideX * batch_count);
+    device_vector<int> dIpiv(strideP * batch_count);
+    device_vector<int> dInfo(batch_count);
+    host_vector<int>   hIter(batch_count);
+    int                info = 0;
+
+    // B is valid in every call, the other arguments vary
+    auto gesv = [&](int  n,
+                    T*   A,
+                    int  lda_,
+                    int* ipiv,
+                    T*   X,
+                    int  ldx_,
+                    int* iter,
+                    int* info_,
+                    int* deviceInfo,
+                    int  batch_count_) {
+        return hipblasGesvIRStridedBatched<T>(handle,
+                                              n,
+                                              nrhs,
+                                              A,
+                                              lda_,
+                                              strideA,
+                                              ipiv,
+                                              strideP,
+                                              dB,
+                                              ldb,
+                                              strideB,
+                                              X,
+                                              ldx_,
+                                              strideX,
+                                              iter,
+                                              info_,
+                                              deviceInfo,
+                                              batch_count_);
+    };
+    int* it = hIter.data();
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, dA, lda, dIpiv, dX, ldx, it, nullptr, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(gesv(-1, dA, lda, dIpiv, dX, ldx, it, &info, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, nullptr, lda, dIpiv, dX, ldx, it, &info, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, dA, N - 1, dIpiv, dX, ldx, it, &info, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, dA, lda, nullptr, dX, ldx, it, &info, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, dA, lda, dIpiv, nullptr, ldx, it, &info, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-11, info);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, dA, lda, dIpiv, dX, N - 1, it, &info, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-12, info);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, dA, lda, dIpiv, dX, ldx, nullptr, &info, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-14, info);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, dA, lda, dIpiv, dX, ldx, it, &info, nullptr, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-16, info);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, dA, lda, dIpiv, dX, ldx, it, &info, dInfo, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-17, info);
+
+    // If N == 0, A, X, and ipiv can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        gesv(0, nullptr, lda, nullptr, nullptr, ldx, it, &info, dInfo, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // If batch_count == 0, all pointers can be nullptr
+    EXPECT_HIPBLAS_STATUS(gesv(N, nullptr, lda, nullptr, nullptr, ldx, nullptr, &info, nullptr, 0),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gesv_ir_strided_batched(const Arguments& arg)
+{
+    int    N            = arg.N;
+    int    lda          = arg.lda;
+    int    ldb          = arg.ldb;
+    int    ldx          = arg.ldc;
+    int    batch_count  = arg.batch_count;
+    double stride_scale = arg.stride_scale;
+
+    hipblasStride strideA = size_t(lda) * N * stride_scale;
+    hipblasStride strideB = size_t(ldb) * 1 * stride_scale;
+    hipblasStride strideX = size_t(ldx) * 1 * stride_scale;
+    hipblasStride strideP = size_t(N) * stride_scale;
+
+    size_t A_size    = strideA * batch_count;
+    size_t B_size    = strideB * batch_count;
+    size_t X_size    = strideX * batch_count;
+    size_t Ipiv_size = strideP * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || ldx < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hX1(X_size);
+    host_vector<int> hIter(batch_count);
+    host_vector<int> hInfo(batch_count);
+    int              info;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(X_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA, hX on CPU
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        T* hXb = hX.data() + b * strideB;
+        T* hBb = hB.data() + b * strideB;
+
+        hipblas_init<T>(hAb, N, N, lda);
+        hipblas_init<T>(hXb, N, 1, ldb);
+
+        // scale A to avoid singularities
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hAb[i + j * lda] += 400;
+                else
+                    hAb[i + j * lda] -= 4;
+            }
+        }
+
+        // Calculate hB = hA*hX;
+        cblas_gemm<T>(op, op, N, 1, N, (T)1, hAb, lda, hXb, ldb, (T)0, hBb, ldb);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGesvIRStridedBatched<T>(handle,
+                                                           N,
+                                                           1,
+                                                           dA,
+                                                           lda,
+                                                           strideA,
+                                                           dIpiv,
+                                                           strideP,
+                                                           dB,
+                                                           ldb,
+                                                           strideB,
+                                                           dX,
+                                                           ldx,
+                                                           strideX,
+                                                           hIter.data(),
+                                                           &info,
+                                                           dInfo,
+                                                           batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hX1, dX, X_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        // The solutions are refined to double precision accuracy
+        hipblas_error = 0.0;
+        for(int b = 0; b < batch_count; b++)
+        {
+            double err = norm_check_general<T>(
+                'F', N, 1, ldb, hX.data() + b * strideB, hX1.data() + b * strideX);
+            hipblas_error = std::max(hipblas_error, err);
+        }
+
+        if(arg.unit_check)
+        {
+            double eps       = std::numeric_limits<double>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+            for(int b = 0; b < batch_count; b++)
+            {
+                unit_check_general(1, 1, 1, &zero, hInfo.data() + b);
+                if(N)
+                    EXPECT_GE(hIter[b], 0);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int it = 0; it < runs; it++)
+        {
+            if(it == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(it);
+
+            CHECK_HIPBLAS_ERROR(hipblasGesvIRStridedBatched<T>(handle,
+                                                               N,
+                                                               1,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               hIter.data(),
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvIRStridedBatchedModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            getrf_gflop_count<T>(N, N) + getrs_gflop_count<T>(N, 1),
+            ArgumentLogging::NA_value,
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
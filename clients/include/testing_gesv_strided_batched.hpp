@@ -0,0 +1,299 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvStridedBatchedModel
+    = ArgumentModel<e_N, e_lda, e_ldb, e_stride_scale, e_batch_count>;
+
+inline void testname_gesv_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGesvStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline void setup_gesv_strided_batched_testing(host_vector<T>& hA,
+                                               host_vector<T>& hB,
+                                               host_vector<T>& hX,
+                                               int             N,
+                                               int             lda,
+                                               int             ldb,
+                                               hipblasStride   strideA,
+                                               hipblasStride   strideB,
+                                               int             batch_count)
+{
+    // Initial hA, hB, hX on CPU
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        T* hXb = hX.data() + b * strideB;
+        T* hBb = hB.data() + b * strideB;
+
+        hipblas_init<T>(hAb, N, N, lda);
+        hipblas_init<T>(hXb, N, 1, ldb);
+
+        // scale A to avoid singularities
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hAb[i + j * lda] += 400;
+                else
+                    hAb[i + j * lda] -= 4;
+            }
+        }
+
+        // Calculate hB = hA*hX;
+        cblas_gemm<T>(op, op, N, 1, N, (T)1, hAb, lda, hXb, ldb, (T)0, hBb, ldb);
+    }
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gesv_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasGesvStridedBatchedFn
+        = arg.fortran ? hipblasGesvStridedBatched<T, true> : hipblasGesvStridedBatched<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N           = 100;
+    const int          nrhs        = 1;
+    const int          lda         = 101;
+    const int          ldb         = 102;
+    const int          batch_count = 2;
+    hipblasStride      strideA     = size_t(lda) * N;
+    hipblasStride      strideB     = size_t(ldb) * 1;
+    hipblasStride      strideP     = size_t(N);
+    size_t             A_size      = strideA * batch_count;
+    size_t             B_size      = strideB * batch_count;
+    size_t             Ipiv_size   = strideP * batch_count;
+
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hX(B_size);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(batch_count);
+
+    auto gesv = [&](int n, int nrhs, T* A, int lda, int* ipiv, T* B, int ldb, int* info, int bc) {
+        return hipblasGesvStridedBatchedFn(
+            handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, bc);
+    };
+
+    // Need initialization code because even with bad params we call roc/cu-solver
+    // so want to give reasonable data
+    setup_gesv_strided_batched_testing(hA, hB, hX, N, lda, ldb, strideA, strideB, batch_count);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    // invalid arguments are only reported through the returned status
+    EXPECT_HIPBLAS_STATUS(gesv(-1, nrhs, dA, lda, dIpiv, dB, ldb, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, -1, dA, lda, dIpiv, dB, ldb, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, nrhs, nullptr, lda, dIpiv, dB, ldb, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, nrhs, dA, N - 1, dIpiv, dB, ldb, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, nrhs, dA, lda, nullptr, dB, ldb, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, nrhs, dA, lda, dIpiv, nullptr, ldb, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, nrhs, dA, lda, dIpiv, dB, N - 1, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, nrhs, dA, lda, dIpiv, dB, ldb, nullptr, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(gesv(N, nrhs, dA, lda, dIpiv, dB, ldb, dInfo, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A, B, and ipiv can be nullptr
+    EXPECT_HIPBLAS_STATUS(gesv(0, nrhs, nullptr, lda, nullptr, nullptr, ldb, dInfo, batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
+
+    // if nrhs == 0, B can be nullptr
+    EXPECT_HIPBLAS_STATUS(gesv(N, 0, dA, lda, dIpiv, nullptr, ldb, dInfo, batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gesv_strided_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.fortran;
+    auto hipblasGesvStridedBatchedFn
+        = FORTRAN ? hipblasGesvStridedBatched<T, true> : hipblasGesvStridedBatched<T, false>;
+
+    int    N            = arg.N;
+    int    lda          = arg.lda;
+    int    ldb          = arg.ldb;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    hipblasStride strideA   = size_t(lda) * N * stride_scale;
+    hipblasStride strideB   = size_t(ldb) * 1 * stride_scale;
+    hipblasStride strideP   = size_t(N) * stride_scale;
+    size_t        A_size    = strideA * batch_count;
+    size_t        B_size    = strideB * batch_count;
+    size_t        Ipiv_size = strideP * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hB1(B_size);
+    host_vector<int> hIpiv(Ipiv_size);
+    host_vector<int> hInfo(batch_count);
+    host_vector<int> hInfo1(batch_count);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    setup_gesv_strided_batched_testing(hA, hB, hX, N, lda, ldb, strideA, strideB, batch_count);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGesvStridedBatchedFn(handle,
+                                                        N,
+                                                        1,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dInfo,
+                                                        batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hB1.data(), dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            T*   hAb    = hA.data() + b * strideA;
+            int* hIpivb = hIpiv.data() + b * strideP;
+
+            hInfo[b] = cblas_getrf<T>(N, N, hAb, lda, hIpivb);
+            cblas_getrs('N', N, 1, hAb, lda, hIpivb, hB.data() + b * strideB, ldb);
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, 1, ldb, strideB, hB, hB1, batch_count);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, batch_count, 1, hInfo.data(), hInfo1.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGesvStridedBatchedFn(handle,
+                                                            N,
+                                                            1,
+                                                            dA,
+                                                            lda,
+                                                            strideA,
+                                                            dIpiv,
+                                                            strideP,
+                                                            dB,
+                                                            ldb,
+                                                            strideB,
+                                                            dInfo,
+                                                            batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvStridedBatchedModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     getrf_gflop_count<T>(N, N)
+                                                         + getrs_gflop_count<T>(N, 1),
+                                                     ArgumentLogging::NA_value,
+                                                     hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,317 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvdjBatchedModel = ArgumentModel<e_M, e_N, e_lda, e_batch_count>;
+
+inline void testname_gesvdj_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGesvdjBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gesvdj_batched_bad_arg(const Arguments& arg)
+{
+    using U                     = real_t<T>;
+    auto hipblasGesvdjBatchedFn = hipblasGesvdjBatched<T, U>;
+
+    hipblasLocalHandle     handle(arg);
+    const int              M           = 11;
+    const int              N           = 10;
+    const int              lda         = 12;
+    const int              batch_count = 2;
+    const size_t           A_size      = size_t(lda) * N;
+    const hipblasStride    strideS     = N;
+    const hipblasStride    strideU     = size_t(M) * M;
+    const hipblasStride    strideV     = size_t(N) * N;
+    const hipblasEigMode_t jobz        = HIPBLAS_EIG_MODE_VECTOR;
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_vector<U>       dS(strideS * batch_count);
+    device_vector<T>       dU(strideU * batch_count);
+    device_vector<T>       dV(strideV * batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    auto gesvdj = [&](int m, int n, int lda, int ldu, int ldv, int sweeps, int bc) {
+        return hipblasGesvdjBatchedFn(handle,
+                                      jobz,
+                                      0,
+                                      m,
+                                      n,
+                                      dA.ptr_on_device(),
+                                      lda,
+                                      0,
+                                      sweeps,
+                                      dS,
+                                      strideS,
+                                      dU,
+                                      ldu,
+                                      strideU,
+                                      dV,
+                                      ldv,
+                                      strideV,
+                                      dInfo,
+                                      bc);
+    };
+
+    EXPECT_HIPBLAS_STATUS(gesvdj(-1, N, lda, M, N, 100, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gesvdj(M, -1, lda, M, N, 100, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gesvdj(M, N, M - 1, M, N, 100, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gesvdj(M, N, lda, M - 1, N, 100, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gesvdj(M, N, lda, M, N - 1, 100, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gesvdj(M, N, lda, M, N, 0, batch_count), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(gesvdj(M, N, lda, M, N, 100, -1), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If M == 0, N == 0 or batch_count == 0, nothing is computed
+    EXPECT_HIPBLAS_STATUS(gesvdj(0, N, lda, M, N, 100, batch_count), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(gesvdj(M, 0, lda, M, N, 100, batch_count), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(gesvdj(M, N, lda, M, N, 100, 0), HIPBLAS_STATUS_SUCCESS);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gesvdj_batched(const Arguments& arg)
+{
+    using U                     = real_t<T>;
+    auto hipblasGesvdjBatchedFn = hipblasGesvdjBatched<T, U>;
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = std::min(M, N);
+    int lda         = arg.lda;
+    int ldu         = std::max(1, M);
+    int ldv         = std::max(1, N);
+    int batch_count = arg.batch_count;
+
+    size_t        A_size  = size_t(lda) * N;
+    hipblasStride strideS = K;
+    hipblasStride strideU = size_t(ldu) * M;
+    hipblasStride strideV = size_t(ldv) * N;
+    size_t        S_size  = strideS * batch_count;
+    size_t        U_size  = strideU * batch_count;
+    size_t        V_size  = strideV * batch_count;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || lda < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_vector<U>       hS(S_size);
+    host_vector<U>       hS1(S_size);
+    host_vector<T>       hU1(U_size);
+    host_vector<T>       hV1(V_size);
+    host_vector<T>       hAV(size_t(M) * K);
+    host_vector<T>       hUS(size_t(M) * K);
+    host_vector<int>     hInfo1(batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_vector<U>       dS(S_size);
+    device_vector<T>       dU(U_size);
+    device_vector<T>       dV(V_size);
+    device_vector<int>     dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+        hipblas_init<T>(hA[b], M, N, lda);
+
+    int econ = 1;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        int            lwork = std::max(1, 5 * std::max(M, N));
+        host_vector<T> work(lwork);
+        host_vector<U> rwork(std::max(1, 5 * K));
+        host_vector<T> hA_ref(A_size);
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            std::copy(hA[b], hA[b] + A_size, hA_ref.begin());
+            cblas_gesvd<T, U>('N',
+                              'N',
+                              M,
+                              N,
+                              hA_ref.data(),
+                              lda,
+                              hS.data() + b * strideS,
+                              nullptr,
+                              1,
+                              nullptr,
+                              1,
+                              work.data(),
+                              lwork,
+                              rwork.data());
+        }
+
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        // The singular vectors are checked through the residual A V - U S, as their signs or
+        // phases may differ from LAPACK. The first K columns are checked in both modes.
+        hipblas_error = 0.0;
+        for(int mode = econ; mode >= 0; mode--)
+        {
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIPBLAS_ERROR(hipblasGesvdjBatchedFn(handle,
+                                                       HIPBLAS_EIG_MODE_VECTOR,
+                                                       mode,
+                                                       M,
+                                                       N,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       0,
+                                                       100,
+                                                       dS,
+                                                       strideS,
+                                                       dU,
+                                                       ldu,
+                                                       strideU,
+                                                       dV,
+                                                       ldv,
+                                                       strideV,
+                                                       dInfo,
+                                                       batch_count));
+
+            // Copy output from device to CPU
+            CHECK_HIP_ERROR(hipMemcpy(hS1, dS, S_size * sizeof(U), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hU1, dU, U_size * sizeof(T), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hV1, dV, V_size * sizeof(T), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(
+                hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+            for(int b = 0; b < batch_count; b++)
+            {
+                T* hUb = hU1.data() + b * strideU;
+                U* hSb = hS1.data() + b * strideS;
+
+                cblas_gemm<T>(HIPBLAS_OP_N,
+                              HIPBLAS_OP_N,
+                              M,
+                              K,
+                              N,
+                              T(1),
+                              hA[b],
+                              lda,
+                              hV1.data() + b * strideV,
+                              ldv,
+                              T(0),
+                              hAV.data(),
+                              M);
+                for(int j = 0; j < K; j++)
+                    for(int i = 0; i < M; i++)
+                        hUS[i + j * M] = hUb[i + j * ldu] * T(hSb[j]);
+
+                hipblas_error += norm_check_general<T>('F', M, K, M, hUS.data(), hAV.data());
+            }
+            hipblas_error += norm_check_general<U>(
+                'F', K, 1, K, strideS, hS.data(), hS1.data(), batch_count);
+
+            if(arg.unit_check)
+            {
+                host_vector<int> hInfo(batch_count, 0);
+                unit_check_general(1, batch_count, 1, hInfo.data(), hInfo1.data());
+            }
+        }
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = std::max(M, N) * eps * 100;
+
+            unit_check_error(hipblas_error, tolerance);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGesvdjBatchedFn(handle,
+                                                       HIPBLAS_EIG_MODE_VECTOR,
+                                                       econ,
+                                                       M,
+                                                       N,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       0,
+                                                       100,
+                                                       dS,
+                                                       strideS,
+                                                       dU,
+                                                       ldu,
+                                                       strideU,
+                                                       dV,
+                                                       ldv,
+                                                       strideV,
+                                                       dInfo,
+                                                       batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvdjBatchedModel{}.log_args<T>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                ArgumentLogging::NA_value,
+                                                ArgumentLogging::NA_value,
+                                                hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -106,7 +106,15 @@ inline hipblasStatus_t testing_getrf(const Arguments& arg)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
-        hInfo[0] = cblas_getrf(M, N, hA.data(), lda, hIpiv.data());
+        hipblas_reference_cache("getrf")
+            .arg(M)
+            .arg(N)
+            .arg(lda)
+            .input(hA.data(), A_size)
+            .output(hA.data(), A_size)
+            .output(hIpiv.data(), Ipiv_size)
+            .output(hInfo.data(), 1)
+            .run([&] { hInfo[0] = cblas_getrf(M, N, hA.data(), lda, hIpiv.data()); });
 
         hipblas_error = norm_check_general<T>('F', M, N, lda, hA, hA1);
         if(arg.unit_check)
@@ -123,14 +131,18 @@ inline hipblasStatus_t testing_getrf(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrfFn(handle, N, dA, lda, dIpiv, dInfo));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGetrfModel{}.log_args<T>(std::cout,
@@ -77,24 +77,47 @@ inline hipblasStatus_t testing_getrf_batched(const Arguments& arg)
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
 
-    // Initial hA on CPU
-    hipblas_init(hA, true);
-    for(int b = 0; b < batch_count; b++)
+    if(hipblas_host_init(arg))
     {
-        // scale A to avoid singularities
-        for(int i = 0; i < M; i++)
+        // Initial hA on CPU
+        hipblas_init(hA, true);
+        for(int b = 0; b < batch_count; b++)
         {
-            for(int j = 0; j < N; j++)
+            // scale A to avoid singularities
+            for(int i = 0; i < M; i++)
             {
-                if(i == j)
-                    hA[b][i + j * lda] += 400;
-                else
-                    hA[b][i + j * lda] -= 4;
+                for(int j = 0; j < N; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
             }
         }
-    }
 
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+    else
+    {
+        // The same distribution and scaling on the device, without the host copies
+        hipblas_seedrand();
+        for(int b = 0; b < batch_count; b++)
+            hipblas_init_device(dA[b],
+                                hipblas_init_device_type<T>,
+                                hipblas_initialization::rand_int,
+                                M,
+                                N,
+                                lda,
+                                0,
+                                1,
+                                hipblas_rng(),
+                                false,
+                                false,
+                                false,
+                                400,
+                                -4);
+    }
     CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(int)));
     CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
 
@@ -136,15 +159,19 @@ inline hipblasStatus_t testing_getrf_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrfBatchedFn(
                 handle, N, dA.ptr_on_device(), lda, dIpiv, dInfo, batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGetrfBatchedModel{}.log_args<T>(std::cout,
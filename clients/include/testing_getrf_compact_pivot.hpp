@@ -0,0 +1,322 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGetrfCompactPivotModel = ArgumentModel<e_N, e_lda, e_ldb, e_batch_count>;
+
+inline void testname_getrf_compact_pivot(const Arguments& arg, std::string& name)
+{
+    hipblasGetrfCompactPivotModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_getrf_compact_pivot_bad_arg(const Arguments& arg)
+{
+    auto hipblasGetrfFn = hipblasGetrfStridedBatchedCompactPivot<T>;
+    auto hipblasGetrsFn = hipblasGetrsStridedBatchedCompactPivot<T>;
+
+    hipblasLocalHandle  handle(arg);
+    const int           N           = 300;
+    const int           lda         = 300;
+    const int           batch_count = 2;
+    const hipblasStride strideA     = size_t(lda) * N;
+    int                 info        = 0;
+
+    device_vector<T>       dA(strideA * batch_count);
+    device_vector<T>       dB(strideA * batch_count);
+    device_vector<int16_t> dIpiv(N * batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrfFn(handle,
+                                         N,
+                                         dA,
+                                         lda,
+                                         strideA,
+                                         dIpiv,
+                                         hipblasPivotType_t(3),
+                                         N,
+                                         dInfo,
+                                         batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    // 8 bit indices hold pivots up to 255
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfFn(
+            handle, N, dA, lda, strideA, dIpiv, HIPBLAS_PIVOT_8U, N, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle,
+                                         HIPBLAS_OP_N,
+                                         N,
+                                         1,
+                                         dA,
+                                         lda,
+                                         strideA,
+                                         dIpiv,
+                                         HIPBLAS_PIVOT_8U,
+                                         N,
+                                         dB,
+                                         lda,
+                                         strideA,
+                                         &info,
+                                         batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -8);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfFn(
+            handle, N, nullptr, lda, strideA, dIpiv, HIPBLAS_PIVOT_16U, N, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle,
+                                         HIPBLAS_OP_N,
+                                         N,
+                                         1,
+                                         dA,
+                                         lda,
+                                         strideA,
+                                         nullptr,
+                                         HIPBLAS_PIVOT_16U,
+                                         N,
+                                         dB,
+                                         lda,
+                                         strideA,
+                                         &info,
+                                         batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -7);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle,
+                                         HIPBLAS_OP_N,
+                                         N,
+                                         1,
+                                         dA,
+                                         lda,
+                                         strideA,
+                                         dIpiv,
+                                         HIPBLAS_PIVOT_16U,
+                                         N,
+                                         dB,
+                                         lda,
+                                         strideA,
+                                         &info,
+                                         -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(info, -14);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// The factors and the widened pivots of getrfStridedBatchedCompactPivot are checked against LAPACK
+// getrf for each compact pivot type that can hold N, and getrsStridedBatchedCompactPivot with
+// those pivots against LAPACK getrs. N <= 32 runs the small kernel and larger N the narrowing of
+// the backend pivots. Without BUILD_WITH_SMALL_LU the functions return
+// HIPBLAS_STATUS_NOT_SUPPORTED and nothing is checked, with it HIPBLAS_STATUS_NOT_SUPPORTED fails
+// the test.
+template <typename T>
+inline hipblasStatus_t testing_getrf_compact_pivot(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    auto hipblasGetrfFn = hipblasGetrfStridedBatchedCompactPivot<T>;
+    auto hipblasGetrsFn = hipblasGetrsStridedBatchedCompactPivot<T>;
+
+    int N           = arg.N;
+    int nrhs        = 3;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int batch_count = arg.batch_count;
+
+    if(N < 0 || lda < std::max(1, N) || ldb < std::max(1, N) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(N == 0 || batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStride strideA = size_t(lda) * N;
+    hipblasStride strideB = size_t(ldb) * nrhs;
+    hipblasStride strideP = N;
+    size_t        A_size  = strideA * batch_count;
+    size_t        B_size  = strideB * batch_count;
+    size_t        P_size  = strideP * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>       hA(A_size), hA_gold(A_size), hA_result(A_size);
+    host_vector<T>       hB(B_size), hB_gold(B_size), hB_result(B_size);
+    host_vector<int>     hIpiv_gold(P_size), hInfo(batch_count);
+    host_vector<uint8_t> hIpiv_bytes(P_size * sizeof(uint16_t));
+
+    device_vector<T>       dA(A_size), dB(B_size);
+    device_vector<uint8_t> dIpiv(P_size * sizeof(uint16_t));
+    device_vector<int>     dInfo(batch_count);
+
+    hipblasLocalHandle handle(arg);
+
+    // Diagonally dominant matrices, so the pivots are unambiguous
+    srand(1);
+    hipblas_init<T>(hA, N, N, lda, strideA, batch_count);
+    hipblas_init<T>(hB, N, nrhs, ldb, strideB, batch_count);
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < N; i++)
+            {
+                if(i == j)
+                    hA[i + j * lda + b * strideA] += 400;
+                else
+                    hA[i + j * lda + b * strideA] -= 4;
+            }
+
+    /* =====================================================================
+       CPU LAPACK
+    =================================================================== */
+    hA_gold = hA;
+    hB_gold = hB;
+    for(int b = 0; b < batch_count; b++)
+    {
+        cblas_getrf<T>(N, N, hA_gold.data() + b * strideA, lda, hIpiv_gold.data() + b * strideP);
+        cblas_getrs<T>('N',
+                       N,
+                       nrhs,
+                       hA_gold.data() + b * strideA,
+                       lda,
+                       hIpiv_gold.data() + b * strideP,
+                       hB_gold.data() + b * strideB,
+                       ldb);
+    }
+
+    double hipblas_error = 0.0;
+    for(hipblasPivotType_t pivot_type : {HIPBLAS_PIVOT_16U, HIPBLAS_PIVOT_8U})
+    {
+        if(pivot_type == HIPBLAS_PIVOT_8U && N > 255)
+            continue;
+        size_t bytes = pivot_type == HIPBLAS_PIVOT_8U ? 1 : 2;
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        hipblasStatus_t status = hipblasGetrfFn(
+            handle, N, dA, lda, strideA, dIpiv, pivot_type, strideP, dInfo, batch_count);
+#ifndef HIPBLAS_SMALL_LU
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+            return HIPBLAS_STATUS_SUCCESS;
+#endif
+        CHECK_HIPBLAS_ERROR(status);
+
+        int info = -1;
+        CHECK_HIPBLAS_ERROR(hipblasGetrsFn(handle,
+                                           HIPBLAS_OP_N,
+                                           N,
+                                           nrhs,
+                                           dA,
+                                           lda,
+                                           strideA,
+                                           dIpiv,
+                                           pivot_type,
+                                           strideP,
+                                           dB,
+                                           ldb,
+                                           strideB,
+                                           &info,
+                                           batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA_result, dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hB_result, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hIpiv_bytes, dIpiv, P_size * bytes, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo, dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        hipblas_error = std::max(
+            hipblas_error,
+            norm_check_general<T>('F', N, N, lda, strideA, hA_gold, hA_result, batch_count));
+        hipblas_error = std::max(
+            hipblas_error,
+            norm_check_general<T>('F', N, nrhs, ldb, strideB, hB_gold, hB_result, batch_count));
+
+        if(arg.unit_check)
+        {
+            for(size_t i = 0; i < P_size; i++)
+            {
+                int pivot
+                    = bytes == 1 ? hIpiv_bytes[i] : ((const uint16_t*)hIpiv_bytes.data())[i];
+                EXPECT_EQ(hIpiv_gold[i], pivot);
+            }
+            for(int b = 0; b < batch_count; b++)
+                EXPECT_EQ(0, hInfo[b]);
+            EXPECT_EQ(0, info);
+        }
+    }
+
+    if(arg.unit_check)
+    {
+        U      eps       = std::numeric_limits<U>::epsilon();
+        double tolerance = eps * 2000;
+
+        unit_check_error(hipblas_error, tolerance);
+    }
+
+    if(arg.timing)
+    {
+        double      gpu_time_used;
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGetrfFn(handle,
+                                               N,
+                                               dA,
+                                               lda,
+                                               strideA,
+                                               dIpiv,
+                                               HIPBLAS_PIVOT_16U,
+                                               strideP,
+                                               dInfo,
+                                               batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGetrfCompactPivotModel{}.log_args<T>(std::cout,
+                                                    arg,
+                                                    gpu_time_used,
+                                                    getrf_gflop_count<T>(N, N),
+                                                    ArgumentLogging::NA_value,
+                                                    hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGetrfRectModel = ArgumentModel<e_M, e_N, e_lda, e_batch_count>;
+
+inline void testname_getrf_rect(const Arguments& arg, std::string& name)
+{
+    hipblasGetrfRectModel{}.test_name(arg, name);
+}
+
+// LU factorizations of batch_count diagonally dominant m by n matrices with getrfRect,
+// getrfRectBatched and getrfRectStridedBatched, against LAPACK
+inline hipblasStatus_t testing_getrf_rect(const Arguments& arg)
+{
+    int M           = arg.M;
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    if(M < 0 || N < 0 || lda < std::max(1, M) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    int           K        = std::min(M, N);
+    hipblasStride stride_A = size_t(lda) * N;
+    hipblasStride stride_P = K;
+    size_t        A_size   = stride_A * batch_count;
+    size_t        P_size   = std::max(size_t(1), size_t(stride_P) * batch_count);
+
+    host_vector<float> hA(A_size), hA_gold(A_size), hA_res(A_size);
+    host_vector<int>   hIpiv(P_size), hIpiv_gold(P_size);
+    host_vector<int>   hInfo(batch_count), hInfo_gold(batch_count);
+    hipblas_init<float>(hA, M, N, lda, stride_A, batch_count);
+    for(int b = 0; b < batch_count; b++)
+        for(int i = 0; i < K; i++)
+            hA[b * stride_A + i + size_t(i) * lda] += 400;
+    hA_gold = hA;
+
+    for(int b = 0; b < batch_count; b++)
+        hInfo_gold[b] = cblas_getrf(
+            M, N, hA_gold.data() + b * stride_A, lda, hIpiv_gold.data() + b * stride_P);
+
+    auto check = [&]() {
+        if(!arg.unit_check)
+            return;
+        double tolerance = std::numeric_limits<float>::epsilon() * 2000;
+        for(int b = 0; b < batch_count; b++)
+        {
+            double error = norm_check_general<float>(
+                'F', M, N, lda, hA_gold.data() + b * stride_A, hA_res.data() + b * stride_A);
+            unit_check_error(error, tolerance);
+        }
+        unit_check_general<int>(1, K * batch_count, 1, hIpiv_gold.data(), hIpiv.data());
+        unit_check_general<int>(1, batch_count, 1, hInfo_gold.data(), hInfo.data());
+    };
+
+    device_vector<float> dA(A_size);
+    device_vector<int>   dIpiv(P_size), dInfo(batch_count);
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * A_size, hipMemcpyHostToDevice));
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIPBLAS_ERROR(hipblasSgetrfRect(
+            handle, M, N, dA + b * stride_A, lda, dIpiv + b * stride_P, dInfo + b));
+    CHECK_HIP_ERROR(hipMemcpy(hA_res, dA, sizeof(float) * A_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hIpiv, dIpiv, sizeof(int) * P_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hInfo, dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+    check();
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSgetrfRectStridedBatched(
+        handle, M, N, dA, lda, stride_A, dIpiv, stride_P, dInfo, batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(hA_res, dA, sizeof(float) * A_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hIpiv, dIpiv, sizeof(int) * P_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hInfo, dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+    check();
+
+    // The batched form reads the same matrices through an array of pointers into dA
+    host_vector<float*> hA_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+        hA_array[b] = dA + b * stride_A;
+    device_vector<float*> dA_array(batch_count);
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA_array, hA_array, sizeof(float*) * batch_count, hipMemcpyHostToDevice));
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(
+        hipblasSgetrfRectBatched(handle, M, N, dA_array, lda, dIpiv, dInfo, batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(hA_res, dA, sizeof(float) * A_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hIpiv, dIpiv, sizeof(int) * P_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hInfo, dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+    check();
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
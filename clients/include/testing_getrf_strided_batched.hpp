@@ -64,9 +64,12 @@ inline hipblasStatus_t testing_getrf_strided_batched(const Arguments& arg)
         return HIPBLAS_STATUS_SUCCESS;
     }
 
+    // Host data only when verifying, otherwise A is initialized on the device
+    bool host_init = hipblas_host_init(arg);
+
     // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
-    host_vector<T>   hA(A_size);
-    host_vector<T>   hA1(A_size);
+    host_vector<T>   hA(host_init ? A_size : 0);
+    host_vector<T>   hA1(host_init ? A_size : 0);
     host_vector<int> hIpiv(Ipiv_size);
     host_vector<int> hIpiv1(Ipiv_size);
     host_vector<int> hInfo(batch_count);
@@ -79,29 +82,50 @@ inline hipblasStatus_t testing_getrf_strided_batched(const Arguments& arg)
     double             gpu_time_used, hipblas_error;
     hipblasLocalHandle handle(arg);
 
-    // Initial hA on CPU
-    srand(1);
-    for(int b = 0; b < batch_count; b++)
+    if(host_init)
     {
-        T* hAb = hA.data() + b * strideA;
+        // Initial hA on CPU
+        srand(1);
+        for(int b = 0; b < batch_count; b++)
+        {
+            T* hAb = hA.data() + b * strideA;
 
-        hipblas_init<T>(hAb, M, N, lda);
+            hipblas_init<T>(hAb, M, N, lda);
 
-        // scale A to avoid singularities
-        for(int i = 0; i < M; i++)
-        {
-            for(int j = 0; j < N; j++)
+            // scale A to avoid singularities
+            for(int i = 0; i < M; i++)
             {
-                if(i == j)
-                    hAb[i + j * lda] += 400;
-                else
-                    hAb[i + j * lda] -= 4;
+                for(int j = 0; j < N; j++)
+                {
+                    if(i == j)
+                        hAb[i + j * lda] += 400;
+                    else
+                        hAb[i + j * lda] -= 4;
+                }
             }
         }
-    }
 
-    // Copy data from CPU to device
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    }
+    else
+    {
+        // The same distribution and scaling on the device
+        hipblas_init_device(dA,
+                            hipblas_init_device_type<T>,
+                            hipblas_initialization::rand_int,
+                            M,
+                            N,
+                            lda,
+                            strideA,
+                            batch_count,
+                            1,
+                            false,
+                            false,
+                            false,
+                            400,
+                            -4);
+    }
     CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(int)));
     CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
 
@@ -144,15 +168,19 @@ inline hipblasStatus_t testing_getrf_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrfStridedBatchedFn(
                 handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGetrfStridedBatchedModel{}.log_args<T>(std::cout,
@@ -139,10 +139,6 @@ inline hipblasStatus_t testing_getrs_bad_arg(const Arguments& arg)
                           HIPBLAS_STATUS_INVALID_VALUE);
     EXPECT_EQ(-5, info);
 
-    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, nrhs, dA, lda, nullptr, dB, ldb, &info),
-                          HIPBLAS_STATUS_INVALID_VALUE);
-    EXPECT_EQ(-6, info);
-
     EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, nrhs, dA, lda, dIpiv, nullptr, ldb, &info),
                           HIPBLAS_STATUS_INVALID_VALUE);
     EXPECT_EQ(-7, info);
@@ -162,6 +158,15 @@ inline hipblasStatus_t testing_getrs_bad_arg(const Arguments& arg)
                           HIPBLAS_STATUS_SUCCESS);
     EXPECT_EQ(0, info);
 
+    // A null ipiv solves without pivoting, and still checks the other arguments
+    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, nrhs, dA, lda, nullptr, dB, N - 1, &info),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrsFn(handle, op, N, nrhs, dA, lda, nullptr, dB, ldb, &info),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -191,9 +196,10 @@ inline hipblasStatus_t testing_getrs(const Arguments& arg)
     host_vector<T>   hX(B_size);
     host_vector<T>   hB(B_size);
     host_vector<T>   hB1(B_size);
+    host_vector<T>   hB2(B_size);
     host_vector<int> hIpiv(Ipiv_size);
     host_vector<int> hIpiv1(Ipiv_size);
-    int              info;
+    int              info, info_npvt = 0;
 
     device_vector<T>   dA(A_size);
     device_vector<T>   dB(B_size);
@@ -217,12 +223,28 @@ inline hipblasStatus_t testing_getrs(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(hB1, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(hIpiv1, dIpiv, Ipiv_size * sizeof(int), hipMemcpyDeviceToHost));
 
+        // The diagonally dominant A usually needs no row interchanges, and then its factors also
+        // solve without pivoting
+        bool no_interchanges = true;
+        for(int i = 0; i < N; i++)
+            no_interchanges = no_interchanges && hIpiv[i] == i + 1;
+        if(no_interchanges)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(
+                hipblasGetrsFn(handle, op, N, 1, dA, lda, nullptr, dB, ldb, &info_npvt));
+            CHECK_HIP_ERROR(hipMemcpy(hB2, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+        }
+
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
         cblas_getrs('N', N, 1, hA.data(), lda, hIpiv.data(), hB.data(), ldb);
 
         hipblas_error = norm_check_general<T>('F', N, 1, ldb, hB.data(), hB1.data());
+        if(no_interchanges)
+            hipblas_error = std::max(
+                hipblas_error, norm_check_general<T>('F', N, 1, ldb, hB.data(), hB2.data()));
 
         if(arg.unit_check)
         {
@@ -232,6 +254,7 @@ inline hipblasStatus_t testing_getrs(const Arguments& arg)
 
             unit_check_error(hipblas_error, tolerance);
             unit_check_general(1, 1, 1, &zero, &info);
+            unit_check_general(1, 1, 1, &zero, &info_npvt);
         }
     }
 
@@ -240,14 +263,18 @@ inline hipblasStatus_t testing_getrs(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrsFn(handle, op, N, 1, dA, lda, dIpiv, dB, ldb, &info));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGetrsModel{}.log_args<T>(std::cout,
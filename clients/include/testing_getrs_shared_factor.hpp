@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGetrsSharedFactorModel = ArgumentModel<e_N, e_lda, e_ldb, e_batch_count>;
+
+inline void testname_getrs_shared_factor(const Arguments& arg, std::string& name)
+{
+    hipblasGetrsSharedFactorModel{}.test_name(arg, name);
+}
+
+// getrsStridedBatched of batch_count right hand side blocks of arg.K columns against one LU
+// factor, with strideA = 0 and strideP = 0, against LAPACK solving the blocks one at a time
+inline hipblasStatus_t testing_getrs_shared_factor(const Arguments& arg)
+{
+    int N           = arg.N;
+    int nrhs        = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    if(N < 0 || nrhs < 0 || lda < std::max(1, N) || ldb < std::max(1, N) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batch_count || !N)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStride stride_B = size_t(ldb) * nrhs;
+    size_t        A_size   = size_t(lda) * N;
+    size_t        B_size   = std::max(size_t(1), size_t(stride_B) * batch_count);
+
+    host_vector<float> hA(A_size), hB(B_size), hB_gold(B_size);
+    host_vector<int>   hIpiv(N);
+    hipblas_init<float>(hA, N, N, lda);
+    hipblas_init<float>(hB, N, nrhs, ldb, stride_B, batch_count);
+    for(int i = 0; i < N; i++)
+        hA[i + size_t(i) * lda] += 400;
+    cblas_getrf(N, N, hA.data(), lda, hIpiv.data());
+    hB_gold = hB;
+
+    device_vector<float> dA(A_size), dB(B_size);
+    device_vector<int>   dIpiv(N);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpiv, sizeof(int) * N, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    int info = -1;
+    CHECK_HIPBLAS_ERROR(hipblasSgetrsStridedBatched(handle,
+                                                    HIPBLAS_OP_N,
+                                                    N,
+                                                    nrhs,
+                                                    dA,
+                                                    lda,
+                                                    0,
+                                                    dIpiv,
+                                                    0,
+                                                    dB,
+                                                    ldb,
+                                                    stride_B,
+                                                    &info,
+                                                    batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(hB, dB, sizeof(float) * B_size, hipMemcpyDeviceToHost));
+
+    /* =====================================================================
+           CPU LAPACK
+    =================================================================== */
+    for(int b = 0; b < batch_count; b++)
+        cblas_getrs<float>(
+            'N', N, nrhs, hA.data(), lda, hIpiv.data(), hB_gold.data() + b * stride_B, ldb);
+
+    if(arg.unit_check)
+    {
+        double tolerance = N * std::numeric_limits<float>::epsilon() * 100;
+        for(int b = 0; b < batch_count; b++)
+        {
+            double error = norm_check_general<float>(
+                'F', N, nrhs, ldb, hB_gold.data() + b * stride_B, hB.data() + b * stride_B);
+            unit_check_error(error, tolerance);
+        }
+        EXPECT_EQ(0, info);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
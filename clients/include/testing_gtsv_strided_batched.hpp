@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGtsvStridedBatchedModel = ArgumentModel<e_N, e_stride_scale, e_batch_count>;
+
+inline void testname_gtsv_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGtsvStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gtsv_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasGtsvStridedBatchedFn     = hipblasGtsvStridedBatched<T>;
+    auto hipblasGtsvInterleavedBatchedFn = hipblasGtsvInterleavedBatched<T>;
+
+    hipblasLocalHandle  handle(arg);
+    const int           N           = 10;
+    const int           batch_count = 2;
+    const hipblasStride stride      = N;
+
+    device_vector<T> dDL(stride * batch_count);
+    device_vector<T> dD(stride * batch_count);
+    device_vector<T> dDU(stride * batch_count);
+    device_vector<T> dX(stride * batch_count);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvStridedBatchedFn(nullptr, N, dDL, dD, dDU, stride, dX, stride, batch_count),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvStridedBatchedFn(handle, -1, dDL, dD, dDU, stride, dX, stride, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvStridedBatchedFn(handle, N, dDL, dD, dDU, N - 1, dX, stride, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvStridedBatchedFn(handle, N, dDL, dD, dDU, stride, dX, N - 1, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvStridedBatchedFn(handle, N, dDL, nullptr, dDU, stride, dX, stride, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvStridedBatchedFn(handle, N, dDL, dD, dDU, stride, nullptr, stride, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvStridedBatchedFn(handle, N, dDL, dD, dDU, stride, dX, stride, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvInterleavedBatchedFn(handle, -1, dDL, dD, dDU, dX, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvInterleavedBatchedFn(handle, N, nullptr, dD, dDU, dX, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGtsvInterleavedBatchedFn(handle, N, dDL, dD, dDU, dX, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If n == 0 or batch_count == 0, nothing is computed
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvStridedBatchedFn(handle, 0, nullptr, nullptr, nullptr, 0, nullptr, 0, 1),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGtsvInterleavedBatchedFn(handle, N, nullptr, nullptr, nullptr, nullptr, 0),
+        HIPBLAS_STATUS_SUCCESS);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Diagonally dominant systems T_i x_i = b_i with known x_i are solved in the strided layout, then
+// in the interleaved one, and both solutions are compared with x_i. b_i is formed by gbmv on the
+// band storage of T_i. Without BUILD_WITH_BANDED_SOLVE the functions return
+// HIPBLAS_STATUS_NOT_SUPPORTED and nothing is checked, with it HIPBLAS_STATUS_NOT_SUPPORTED fails
+// the test.
+template <typename T>
+inline hipblasStatus_t testing_gtsv_strided_batched(const Arguments& arg)
+{
+    using U                              = real_t<T>;
+    auto hipblasGtsvStridedBatchedFn     = hipblasGtsvStridedBatched<T>;
+    auto hipblasGtsvInterleavedBatchedFn = hipblasGtsvInterleavedBatched<T>;
+
+    int    N            = arg.N;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    hipblasStride stride = size_t(N) * stride_scale;
+    size_t        size   = stride * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hDL(size), hD(size), hDU(size);
+    host_vector<T> hX(size), hB(size), hX1(size), hX2(size);
+    host_vector<T> hBand(3 * size_t(N));
+    host_vector<T> hDL_i(size_t(N) * batch_count), hD_i(size_t(N) * batch_count);
+    host_vector<T> hDU_i(size_t(N) * batch_count), hX_i(size_t(N) * batch_count);
+
+    device_vector<T> dDL(size), dD(size), dDU(size), dX(size);
+    device_vector<T> dDL_i(size_t(N) * batch_count), dD_i(size_t(N) * batch_count);
+    device_vector<T> dDU_i(size_t(N) * batch_count), dX_i(size_t(N) * batch_count);
+
+    double             gpu_time_used;
+    double             hipblas_error_strided = 0.0, hipblas_error_interleaved = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial data on CPU, with the diagonal of each T_i dominant
+    srand(1);
+    hipblas_init<T>(hDL.data(), N, batch_count, stride);
+    hipblas_init<T>(hD.data(), N, batch_count, stride);
+    hipblas_init<T>(hDU.data(), N, batch_count, stride);
+    hipblas_init<T>(hX.data(), N, batch_count, stride);
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            size_t k = j + b * stride;
+            hD[k] += 400;
+
+            // Band storage of T_b for gbmv, with the superdiagonal in row 0
+            hBand[3 * j]     = j > 0 ? hDU[k - 1] : T(0);
+            hBand[3 * j + 1] = hD[k];
+            hBand[3 * j + 2] = j < N - 1 ? hDL[k + 1] : T(0);
+
+            size_t ki = size_t(j) * batch_count + b;
+            hDL_i[ki] = hDL[k];
+            hD_i[ki]  = hD[k];
+            hDU_i[ki] = hDU[k];
+        }
+        cblas_gbmv<T>(HIPBLAS_OP_N,
+                      N,
+                      N,
+                      1,
+                      1,
+                      T(1),
+                      hBand.data(),
+                      3,
+                      hX.data() + b * stride,
+                      1,
+                      T(0),
+                      hB.data() + b * stride,
+                      1);
+        for(int j = 0; j < N; j++)
+            hX_i[size_t(j) * batch_count + b] = hB[j + b * stride];
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dDL, hDL, size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dD, hD, size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dDU, hDU, size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dDL_i, hDL_i, hDL_i.size() * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dD_i, hD_i, hD_i.size() * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dDU_i, hDU_i, hDU_i.size() * sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIP_ERROR(hipMemcpy(dX, hB, size * sizeof(T), hipMemcpyHostToDevice));
+        hipblasStatus_t status = hipblasGtsvStridedBatchedFn(
+            handle, N, dDL, dD, dDU, stride, dX, stride, batch_count);
+#ifndef HIPBLAS_BANDED_SOLVE
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+            return HIPBLAS_STATUS_SUCCESS;
+#endif
+        CHECK_HIPBLAS_ERROR(status);
+        CHECK_HIP_ERROR(hipMemcpy(hX1, dX, size * sizeof(T), hipMemcpyDeviceToHost));
+
+        CHECK_HIP_ERROR(hipMemcpy(dX_i, hX_i, hX_i.size() * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(
+            hipblasGtsvInterleavedBatchedFn(handle, N, dDL_i, dD_i, dDU_i, dX_i, batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hX_i, dX_i, hX_i.size() * sizeof(T), hipMemcpyDeviceToHost));
+        for(int b = 0; b < batch_count; b++)
+            for(int j = 0; j < N; j++)
+                hX2[j + b * stride] = hX_i[size_t(j) * batch_count + b];
+
+        hipblas_error_strided
+            = norm_check_general<T>('F', N, 1, N, stride, hX.data(), hX1.data(), batch_count);
+        hipblas_error_interleaved
+            = norm_check_general<T>('F', N, 1, N, stride, hX.data(), hX2.data(), batch_count);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+
+            unit_check_error(hipblas_error_strided, tolerance);
+            unit_check_error(hipblas_error_interleaved, tolerance);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIP_ERROR(hipMemcpy(dX, hB, size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasGtsvStridedBatchedFn(
+                handle, N, dDL, dD, dDU, stride, dX, stride, batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGtsvStridedBatchedModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     ArgumentLogging::NA_value,
+                                                     ArgumentLogging::NA_value,
+                                                     hipblas_error_strided);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
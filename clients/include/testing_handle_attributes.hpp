@@ -0,0 +1,183 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_handle_attributes(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_handle_attributes(const Arguments& arg)
+{
+    hipblasHandleAttributes_t defaults, attributes, handle_attributes;
+    hipblasHandle_t           handle;
+    hipStream_t               stream;
+    int                       device, device_count, current;
+
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetDefaultHandleAttributes(nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasGetDefaultHandleAttributes(&defaults));
+    EXPECT_EQ(-1, defaults.device);
+    EXPECT_EQ(HIPBLAS_NUMA_NODE_ANY, defaults.numaNode);
+    EXPECT_EQ(hipStream_t(0), defaults.stream);
+    EXPECT_EQ(nullptr, defaults.workspace);
+    EXPECT_EQ(size_t(0), defaults.workspaceSizeInBytes);
+    EXPECT_EQ(nullptr, defaults.cuMask);
+    EXPECT_EQ(0, defaults.cuMaskSize);
+
+    // A handle from hipblasCreate has the default attributes, apart from its stream
+    {
+        hipblasLocalHandle local_handle(arg);
+        CHECK_HIPBLAS_ERROR(hipblasGetHandleAttributes(local_handle, &handle_attributes));
+        EXPECT_EQ(-1, handle_attributes.device);
+        EXPECT_EQ(HIPBLAS_NUMA_NODE_ANY, handle_attributes.numaNode);
+        EXPECT_EQ(nullptr, handle_attributes.workspace);
+        EXPECT_HIPBLAS_STATUS(hipblasGetHandleAttributes(local_handle, nullptr),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+    EXPECT_HIPBLAS_STATUS(hipblasGetHandleAttributes(nullptr, &handle_attributes),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCreateWithAttributes(nullptr, &defaults),
+                          HIPBLAS_STATUS_HANDLE_IS_NULLPTR);
+    EXPECT_HIPBLAS_STATUS(hipblasCreateWithAttributes(&handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    attributes        = defaults;
+    attributes.device = device_count;
+    EXPECT_HIPBLAS_STATUS(hipblasCreateWithAttributes(&handle, &attributes),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    attributes          = defaults;
+    attributes.numaNode = -3;
+    EXPECT_HIPBLAS_STATUS(hipblasCreateWithAttributes(&handle, &attributes),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    attributes.numaNode = 1 << 20;
+    EXPECT_HIPBLAS_STATUS(hipblasCreateWithAttributes(&handle, &attributes),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    attributes                      = defaults;
+    attributes.workspaceSizeInBytes = 1024;
+    EXPECT_HIPBLAS_STATUS(hipblasCreateWithAttributes(&handle, &attributes),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    attributes            = defaults;
+    attributes.cuMaskSize = 1;
+    EXPECT_HIPBLAS_STATUS(hipblasCreateWithAttributes(&handle, &attributes),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A handle on the last device, with its host memory on the node of the device
+    const size_t        workspace_size = size_t(4) << 20;
+    device_vector<char> workspace(workspace_size);
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    attributes                      = defaults;
+    attributes.device               = device_count - 1;
+    attributes.numaNode             = HIPBLAS_NUMA_NODE_DEVICE;
+    attributes.stream               = stream;
+    attributes.workspace            = workspace;
+    attributes.workspaceSizeInBytes = workspace_size;
+    if(attributes.device != device)
+    {
+        // The stream and workspace belong to the current device
+        attributes.stream               = 0;
+        attributes.workspace            = nullptr;
+        attributes.workspaceSizeInBytes = 0;
+    }
+    CHECK_HIPBLAS_ERROR(hipblasCreateWithAttributes(&handle, &attributes));
+    CHECK_HIP_ERROR(hipGetDevice(&current));
+    EXPECT_EQ(device, current);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleAttributes(handle, &handle_attributes));
+    EXPECT_EQ(attributes.device, handle_attributes.device);
+    EXPECT_TRUE(handle_attributes.numaNode >= 0
+                || handle_attributes.numaNode == HIPBLAS_NUMA_NODE_ANY);
+    EXPECT_EQ(attributes.stream, handle_attributes.stream);
+    EXPECT_EQ(attributes.workspace, handle_attributes.workspace);
+    EXPECT_EQ(attributes.workspaceSizeInBytes, handle_attributes.workspaceSizeInBytes);
+    CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+
+    // Strided host data goes through the staging buffers placed on the node
+    attributes.device = device;
+    attributes.stream = stream;
+    CHECK_HIPBLAS_ERROR(hipblasCreateWithAttributes(&handle, &attributes));
+
+    const int            M = 300, N = 200, lda = 320;
+    host_vector<float>   hA(size_t(lda) * N), hA_copy(size_t(lda) * N);
+    device_vector<float> dA(size_t(M) * N);
+
+    hipblas_init_matrix(hA, arg, M, N, lda, 0, 1, hipblas_client_never_set_nan, true);
+    CHECK_HIPBLAS_ERROR(hipblasSetMatrix(M, N, sizeof(float), hA, lda, dA, M));
+    CHECK_HIPBLAS_ERROR(hipblasGetMatrix(M, N, sizeof(float), dA, M, hA_copy, lda));
+
+    if(arg.unit_check)
+        unit_check_general<float>(M, N, lda, hA.data(), hA_copy.data());
+
+    CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+
+    // A handle restricted to CU 0 without a stream runs on a stream of the library with the mask
+    const uint32_t cu_mask = 1;
+    attributes             = defaults;
+    attributes.cuMask      = &cu_mask;
+    attributes.cuMaskSize  = 1;
+#ifdef __HIP_PLATFORM_NVCC__
+    EXPECT_HIPBLAS_STATUS(hipblasCreateWithAttributes(&handle, &attributes),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+#else
+    CHECK_HIPBLAS_ERROR(hipblasCreateWithAttributes(&handle, &attributes));
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleAttributes(handle, &handle_attributes));
+    EXPECT_NE(hipStream_t(0), handle_attributes.stream);
+    EXPECT_EQ(1, handle_attributes.cuMaskSize);
+    EXPECT_NE(nullptr, handle_attributes.cuMask);
+    if(handle_attributes.cuMask)
+        EXPECT_EQ(cu_mask, handle_attributes.cuMask[0]);
+
+    const float alpha = 2.0f;
+    hA_copy           = hA;
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, M, &alpha, dA, 1));
+    CHECK_HIP_ERROR(hipStreamSynchronize(handle_attributes.stream));
+    CHECK_HIP_ERROR(hipMemcpy(hA_copy, dA, sizeof(float) * M, hipMemcpyDeviceToHost));
+    for(int i = 0; i < M; i++)
+        hA[i] *= alpha;
+
+    if(arg.unit_check)
+        unit_check_general<float>(1, M, 1, hA.data(), hA_copy.data());
+    CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+#endif
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_handle_pool(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_handle_pool(const Arguments& arg)
+{
+    hipblasHandle_t      created, handle, handle2;
+    hipStream_t          stream, stream2, handle_stream;
+    hipblasPointerMode_t pointer_mode;
+    hipblasMath_t        math_mode;
+
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolAcquire(nullptr, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolRelease(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // Only handles taken from the pool can be released to it. hipblasLocalHandle may come from
+    // the pool, so the handle is created here.
+    CHECK_HIPBLAS_ERROR(hipblasCreate(&created));
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolRelease(created), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasDestroy(created));
+
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIP_ERROR(hipStreamCreate(&stream2));
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(&handle, stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &handle_stream));
+    EXPECT_EQ(stream, handle_stream);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, HIPBLAS_XF32_XDL_MATH));
+
+    // A scal queued before the release is still ordered before the next user of the handle
+    const int          N     = 1000;
+    float              alpha = 2.0f;
+    host_vector<float> hx(N), hx_gold(N);
+
+    device_vector<float> dx(N);
+    device_vector<float> d_alpha(1);
+
+    hipblas_init_vector(hx, arg, N, 1, 0, 1, hipblas_client_never_set_nan, true);
+    for(int i = 0; i < N; i++)
+        hx_gold[i] = alpha * alpha * hx[i];
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, N, d_alpha, dx, 1));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(handle));
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolRelease(handle), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // The released handle is reused with the state of a new handle
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(&handle2, stream2));
+    EXPECT_EQ(handle, handle2);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle2, &handle_stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle2, &pointer_mode));
+    CHECK_HIPBLAS_ERROR(hipblasGetMathMode(handle2, &math_mode));
+    EXPECT_EQ(stream2, handle_stream);
+    EXPECT_EQ(HIPBLAS_POINTER_MODE_HOST, pointer_mode);
+    EXPECT_EQ(HIPBLAS_DEFAULT_MATH, math_mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle2, N, &alpha, dx, 1));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream2));
+    CHECK_HIP_ERROR(hipMemcpy(hx, dx, sizeof(float) * N, hipMemcpyDeviceToHost));
+
+    if(arg.unit_check)
+        unit_check_general<float>(1, N, 1, hx_gold.data(), hx.data());
+
+    // hipblasDestroyAsync returns a pool handle to the pool
+    CHECK_HIPBLAS_ERROR(hipblasDestroyAsync(handle2));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(&handle, stream2));
+    EXPECT_EQ(handle, handle2);
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(handle));
+
+    // A scal queued before hipblasDestroyAsync runs even though the stream is destroyed at once
+    EXPECT_HIPBLAS_STATUS(hipblasDestroyAsync(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipStream_t stream3;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream3));
+    CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream3));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, N, &alpha, dx, 1));
+    CHECK_HIPBLAS_ERROR(hipblasDestroyAsync(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream3));
+
+    for(int i = 0; i < N; i++)
+        hx_gold[i] *= alpha;
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolClear());
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    CHECK_HIP_ERROR(hipMemcpy(hx, dx, sizeof(float) * N, hipMemcpyDeviceToHost));
+
+    if(arg.unit_check)
+        unit_check_general<float>(1, N, 1, hx_gold.data(), hx.data());
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream2));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -225,11 +225,14 @@ inline hipblasStatus_t testing_hbmv_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasHbmvStridedBatchedFn(handle,
                                                             uplo,
@@ -248,6 +251,7 @@ inline hipblasStatus_t testing_hbmv_strided_batched(const Arguments& arg)
                                                             stride_y,
                                                             batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasHbmvStridedBatchedModel{}.log_args<T>(std::cout,
@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <functional>
+#include <iostream>
+#include <type_traits>
+
+#include "native_blas.hpp"
+#include "testing_common.hpp"
+
+// Host time per call of a set of routines on problems of size arg.N, and of a call with an invalid
+// enum, which returns through the exception path. The calls are made back to back in device
+// pointer mode and the stream is synchronized once after each routine, so with N == 0 no kernel
+// runs and the time is that of the hipBLAS and backend host path.
+template <typename T>
+inline hipblasStatus_t testing_host_overhead(const Arguments& arg)
+{
+    if(!arg.timing)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    int         N     = arg.N;
+    int         ld    = std::max(1, N);
+    int         calls = std::max(1, arg.iters);
+    hipDataType type  = std::is_same_v<T, float> ? HIP_R_32F : HIP_R_64F;
+
+    hipblasComputeType_t compute_type
+        = std::is_same_v<T, float> ? HIPBLAS_COMPUTE_32F : HIPBLAS_COMPUTE_64F;
+
+    device_vector<T> dA(size_t(ld) * ld);
+    device_vector<T> dB(size_t(ld) * ld);
+    device_vector<T> dC(size_t(ld) * ld);
+    device_vector<T> dx(ld);
+    device_vector<T> dy(ld);
+    device_vector<T> d_scalars(3);
+
+    hipblasLocalHandle handle(arg);
+    hipStream_t        stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    const T h_scalars[3] = {1, 0, 0};
+    CHECK_HIP_ERROR(hipMemcpy(d_scalars, h_scalars, sizeof(h_scalars), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dA, 0, sizeof(T) * ld * ld));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+    const T*                 alpha  = d_scalars;
+    const T*                 beta   = d_scalars + 1;
+    T*                       result = d_scalars + 2;
+    const hipblasOperation_t N_op   = HIPBLAS_OP_N;
+    const hipblasFillMode_t  lower  = HIPBLAS_FILL_MODE_LOWER;
+    const hipblasDiagType_t  unit   = HIPBLAS_DIAG_UNIT; // trsv and trsm never divide by A
+
+    // With --compare_native each routine is also timed through the backend routine under it
+    const hipblasNativeBlas<T>* native  = nullptr;
+    bool                        compare = hipblas_get_compare_native();
+    if(compare)
+    {
+        native = hipblas_native_blas<T>();
+        if(!native)
+            std::cerr << "hipblas-bench: the backend library cannot be loaded, the native "
+                         "columns are -1"
+                      << std::endl;
+    }
+
+    std::cout << "function,N,calls,hipblas-ns/call";
+    if(compare)
+        std::cout << ",native-ns/call,hipblas-overhead-ns/call";
+    std::cout << std::endl;
+
+    auto time_loop = [&](auto&& call) {
+        double host_time_used = get_time_us_sync(stream);
+        for(int iter = 0; iter < calls; iter++)
+            (void)call();
+        return (get_time_us_sync(stream) - host_time_used) * 1000 / calls;
+    };
+
+    // native_call returns the status of the backend, 0 for success; calls without one report -1
+    auto time_calls = [&](const char*                 name,
+                          hipblasStatus_t             expected,
+                          auto&&                      call,
+                          const std::function<int()>& native_call = nullptr) {
+        hipblasStatus_t status = expected;
+        for(int iter = 0; iter < std::max(1, arg.cold_iters) && status == expected; iter++)
+            status = call();
+        if(status != expected)
+        {
+            std::cerr << name << ": " << hipblasStatusToString(status) << std::endl;
+            return status;
+        }
+
+        bool timed_native  = compare && native && native_call;
+        int  native_status = 0;
+        for(int iter = 0; timed_native && iter < std::max(1, arg.cold_iters) && !native_status;
+            iter++)
+            native_status = native_call();
+        if(native_status)
+        {
+            std::cerr << name << ": native status " << native_status << std::endl;
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+
+        double hipblas_ns = time_loop(call);
+        std::cout << name << "," << N << "," << calls << "," << hipblas_ns;
+        if(compare)
+        {
+            double native_ns = timed_native ? time_loop(native_call) : -1;
+            std::cout << "," << native_ns << "," << (timed_native ? hipblas_ns - native_ns : -1);
+        }
+        std::cout << std::endl;
+        return HIPBLAS_STATUS_SUCCESS;
+    };
+
+    // The native calls take the handle as the backend handle and the enums of the backend
+    const int n_op   = native ? native->op_n : 0;
+    const int n_fill = native ? native->fill_lower : 0;
+    const int n_diag = native ? native->diag_unit : 0;
+    const int n_side = native ? native->side_left : 0;
+
+    const hipblasStatus_t success = HIPBLAS_STATUS_SUCCESS;
+
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "axpy",
+        success,
+        [&] { return hipblasAxpy<T>(handle, N, alpha, dx, 1, dy, 1); },
+        [&] { return native->axpy(handle, N, alpha, dx, 1, dy, 1); }));
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "dot",
+        success,
+        [&] { return hipblasDot<T>(handle, N, dx, 1, dy, 1, result); },
+        [&] { return native->dot(handle, N, dx, 1, dy, 1, result); }));
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "nrm2",
+        success,
+        [&] { return hipblasNrm2<T, T>(handle, N, dx, 1, result); },
+        [&] { return native->nrm2(handle, N, dx, 1, result); }));
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "scal",
+        success,
+        [&] { return hipblasScal<T>(handle, N, alpha, dx, 1); },
+        [&] { return native->scal(handle, N, alpha, dx, 1); }));
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "gemv",
+        success,
+        [&] { return hipblasGemv<T>(handle, N_op, N, N, alpha, dA, ld, dx, 1, beta, dy, 1); },
+        [&] { return native->gemv(handle, n_op, N, N, alpha, dA, ld, dx, 1, beta, dy, 1); }));
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "ger",
+        success,
+        [&] { return hipblasGer<T, false>(handle, N, N, alpha, dx, 1, dy, 1, dA, ld); },
+        [&] { return native->ger(handle, N, N, alpha, dx, 1, dy, 1, dA, ld); }));
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "trsv",
+        success,
+        [&] { return hipblasTrsv<T>(handle, lower, N_op, unit, N, dA, ld, dx, 1); },
+        [&] { return native->trsv(handle, n_fill, n_op, n_diag, N, dA, ld, dx, 1); }));
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "gemm",
+        success,
+        [&] {
+            return hipblasGemm<T>(
+                handle, N_op, N_op, N, N, N, alpha, dA, ld, dB, ld, beta, dC, ld);
+        },
+        [&] {
+            return native->gemm(handle, n_op, n_op, N, N, N, alpha, dA, ld, dB, ld, beta, dC, ld);
+        }));
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "gemm_strided_batched",
+        success,
+        [&] {
+            return hipblasGemmStridedBatched<T>(
+                handle, N_op, N_op, N, N, N, alpha, dA, ld, 0, dB, ld, 0, beta, dC, ld, 0, 1);
+        },
+        [&] {
+            return native->gemm_strided_batched(
+                handle, n_op, n_op, N, N, N, alpha, dA, ld, 0, dB, ld, 0, beta, dC, ld, 0, 1);
+        }));
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "gemm_ex",
+        success,
+        [&] {
+            return hipblasGemmEx_v2(handle,
+                                    N_op,
+                                    N_op,
+                                    N,
+                                    N,
+                                    N,
+                                    alpha,
+                                    dA,
+                                    type,
+                                    ld,
+                                    dB,
+                                    type,
+                                    ld,
+                                    beta,
+                                    dC,
+                                    type,
+                                    ld,
+                                    compute_type,
+                                    HIPBLAS_GEMM_DEFAULT);
+        },
+        [&] { return native->gemm_ex(handle, N, N, N, alpha, dA, ld, dB, ld, beta, dC, ld); }));
+    CHECK_HIPBLAS_ERROR(time_calls(
+        "trsm",
+        success,
+        [&] {
+            return hipblasTrsm<T>(
+                handle, HIPBLAS_SIDE_LEFT, lower, N_op, unit, N, N, alpha, dA, ld, dB, ld);
+        },
+        [&] {
+            return native->trsm(
+                handle, n_side, n_fill, n_op, n_diag, N, N, alpha, dA, ld, dB, ld);
+        }));
+    CHECK_HIPBLAS_ERROR(time_calls("gemv_invalid_enum", HIPBLAS_STATUS_INVALID_ENUM, [&] {
+        return hipblasGemv<T>(
+            handle, hipblasOperation_t(0), N, N, alpha, dA, ld, dx, 1, beta, dy, 1);
+    }));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_info_summary(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_info_summary(const Arguments& arg)
+{
+    hipblasInfoSummary_t* current = nullptr;
+    hipblasInfoSummary_t  summary{-1, -1, -1};
+    hipblasLocalHandle    handle(arg);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetInfoSummary(handle, &current));
+    EXPECT_EQ(nullptr, current);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetInfoSummary(handle, &summary));
+    CHECK_HIPBLAS_ERROR(hipblasGetInfoSummary(handle, &current));
+    EXPECT_EQ(&summary, current);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetInfoSummary(handle, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasGetInfoSummary(handle, &current));
+    EXPECT_EQ(nullptr, current);
+
+    const int          batch_count        = 4;
+    const int          hInfo[batch_count] = {0, 2, 0, 3};
+    device_vector<int> dInfo(batch_count);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetInfoSummary(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasInfoSummaryAsync(nullptr, dInfo, batch_count, &summary),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasInfoSummaryAsync(handle, dInfo, -1, &summary),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasInfoSummaryAsync(handle, nullptr, batch_count, &summary),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasInfoSummaryAsync(handle, dInfo, batch_count, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    // Summarize known info values
+    CHECK_HIP_ERROR(hipMemcpy(dInfo, hInfo, sizeof(hInfo), hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasInfoSummaryAsync(handle, dInfo, batch_count, &summary));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    EXPECT_EQ(1, summary.anyFailed);
+    EXPECT_EQ(1, summary.firstFailed);
+    EXPECT_EQ(2, summary.failureCount);
+
+    // An empty batch has no failures
+    CHECK_HIPBLAS_ERROR(hipblasInfoSummaryAsync(handle, nullptr, 0, &summary));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    EXPECT_EQ(0, summary.anyFailed);
+    EXPECT_EQ(-1, summary.firstFailed);
+    EXPECT_EQ(0, summary.failureCount);
+
+    // The handle summary follows each batched factorization, here of singular 1x1 matrices
+    const float          hA[batch_count] = {1.0f, 0.0f, 2.0f, 0.0f};
+    device_vector<float> dA(batch_count);
+    device_vector<int>   dIpiv(batch_count);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(hA), hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSetInfoSummary(handle, &summary));
+
+    hipblasStatus_t status
+        = hipblasSgetrfStridedBatched(handle, 1, dA, 1, 1, dIpiv, 1, dInfo, batch_count);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(1, summary.anyFailed);
+        EXPECT_EQ(1, summary.firstFailed);
+        EXPECT_EQ(2, summary.failureCount);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetInfoSummary(handle, nullptr));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,286 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Forms the Kronecker product of the factors, M by N with leading dimension M
+template <typename T>
+void kron_gemm_ex_reference(const std::vector<int>&            m,
+                            const std::vector<int>&            n,
+                            const std::vector<host_vector<T>>& hA,
+                            host_vector<T>&                    hK)
+{
+    int M = 1, N = 1;
+    hK.assign(1, T(1));
+    for(size_t f = 0; f < m.size(); f++)
+    {
+        host_vector<T> next(size_t(M) * m[f] * N * n[f]);
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                for(int jf = 0; jf < n[f]; jf++)
+                    for(int i_f = 0; i_f < m[f]; i_f++)
+                        next[(i * m[f] + i_f) + size_t(j * n[f] + jf) * M * m[f]]
+                            = hK[i + size_t(j) * M] * hA[f][i_f + size_t(jf) * m[f]];
+        M *= m[f];
+        N *= n[f];
+        hK = next;
+    }
+}
+
+// Checks hipblasKronGemmEx and hipblasKronGemvEx, with the scalars on the host and on the device,
+// against a gemm with the formed product for factors of mixed shapes. arg.cols is the number p
+// of columns of X and Y, arg.incx and arg.incy the increments of the gemv.
+template <typename T>
+inline hipblasStatus_t testing_kron_gemm_ex(const Arguments& arg)
+{
+    int P    = arg.cols;
+    int incx = arg.incx;
+    int incy = arg.incy;
+
+    // check here to prevent undefined memory allocation error
+    if(P < 0 || incx <= 0 || incy <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipDataType          data_type    = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+    hipblasComputeType_t compute_type
+        = std::is_same_v<T, double> ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+
+    hipblasLocalHandle handle(arg);
+
+    T h_alpha = arg.get_alpha<T>(), h_beta = arg.get_beta<T>();
+    device_vector<T> d_alpha(1), d_beta(1);
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    int m0 = 2, n0 = 3, lda0 = 2;
+    EXPECT_HIPBLAS_STATUS(hipblasKronGemmEx(nullptr,
+                                            1,
+                                            &m0,
+                                            &n0,
+                                            nullptr,
+                                            &lda0,
+                                            &h_alpha,
+                                            nullptr,
+                                            n0,
+                                            &h_beta,
+                                            nullptr,
+                                            m0,
+                                            P,
+                                            data_type,
+                                            compute_type),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasKronGemmEx(handle,
+                                            0,
+                                            &m0,
+                                            &n0,
+                                            nullptr,
+                                            &lda0,
+                                            &h_alpha,
+                                            nullptr,
+                                            n0,
+                                            &h_beta,
+                                            nullptr,
+                                            m0,
+                                            P,
+                                            data_type,
+                                            compute_type),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasKronGemvEx(handle,
+                                            1,
+                                            &m0,
+                                            &n0,
+                                            nullptr,
+                                            &lda0,
+                                            &h_alpha,
+                                            nullptr,
+                                            -1,
+                                            &h_beta,
+                                            nullptr,
+                                            1,
+                                            data_type,
+                                            compute_type),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // each list holds the {m, n} of the factors; the last one has an empty product of columns
+    const std::vector<std::vector<std::pair<int, int>>> factor_lists = {
+        {{3, 4}},
+        {{2, 3}, {4, 2}},
+        {{3, 2}, {2, 3}, {4, 5}},
+        {{2, 2}, {3, 1}, {1, 3}, {2, 4}},
+        {{3, 0}, {2, 2}},
+    };
+
+    for(const auto& factor_list : factor_lists)
+    {
+        int              factors = int(factor_list.size());
+        std::vector<int> m(factors), n(factors), lda(factors);
+        int              M = 1, N = 1;
+        for(int f = 0; f < factors; f++)
+        {
+            m[f]   = factor_list[f].first;
+            n[f]   = factor_list[f].second;
+            lda[f] = m[f] + f;
+            M *= m[f];
+            N *= n[f];
+        }
+        int ldx = N + 1;
+        int ldy = M + 2;
+
+        // the host copies are packed for the reference, the device copies have leading
+        // dimensions lda[f] and lie back to back in one buffer
+        std::vector<host_vector<T>> hA(factors);
+        std::vector<size_t>         offset(factors + 1, 0);
+        for(int f = 0; f < factors; f++)
+            offset[f + 1] = offset[f] + size_t(lda[f]) * n[f];
+
+        host_vector<T>   hA_ld(offset[factors]);
+        device_vector<T> dA(std::max<size_t>(1, hA_ld.size()));
+        std::vector<const void*> A(factors);
+        for(int f = 0; f < factors; f++)
+        {
+            // A has alternating signs so that the stages see negative inputs
+            hA[f].resize(size_t(m[f]) * n[f]);
+            hipblas_init_matrix(
+                hA[f], arg, m[f], n[f], m[f], 0, 1, hipblas_client_never_set_nan, false, true);
+            for(int j = 0; j < n[f]; j++)
+                for(int i = 0; i < m[f]; i++)
+                    hA_ld[offset[f] + i + size_t(j) * lda[f]] = hA[f][i + size_t(j) * m[f]];
+            A[f] = (T*)dA + offset[f];
+        }
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA_ld, sizeof(T) * hA_ld.size(), hipMemcpyHostToDevice));
+
+        host_vector<T> hK;
+        kron_gemm_ex_reference(m, n, hA, hK);
+
+        host_vector<T> hX(size_t(ldx) * P);
+        host_vector<T> hY(size_t(ldy) * P);
+        host_vector<T> hY_gold(hY.size());
+        host_vector<T> hY_out(hY.size());
+        hipblas_init_matrix(hX, arg, N, P, ldx, 0, 1, hipblas_client_never_set_nan);
+        hipblas_init_matrix(hY, arg, M, P, ldy, 0, 1, hipblas_client_never_set_nan);
+
+        device_vector<T> dX(std::max<size_t>(1, hX.size()));
+        device_vector<T> dY(std::max<size_t>(1, hY.size()));
+        CHECK_HIP_ERROR(hipMemcpy(dX, hX, sizeof(T) * hX.size(), hipMemcpyHostToDevice));
+
+        hY_gold = hY;
+        cblas_gemm<T, T, T>(HIPBLAS_OP_N,
+                            HIPBLAS_OP_N,
+                            M,
+                            P,
+                            N,
+                            h_alpha,
+                            hK.data(),
+                            std::max(M, 1),
+                            hX.data(),
+                            ldx,
+                            h_beta,
+                            hY_gold.data(),
+                            ldy);
+
+        // the gemv reads column 0 of X and Y with the increments
+        host_vector<T> hx(size_t(std::max(N, 1)) * incx);
+        host_vector<T> hy(size_t(std::max(M, 1)) * incy);
+        host_vector<T> hy_gold(hy.size());
+        host_vector<T> hy_out(hy.size());
+        hipblas_init_vector(hx, arg, N, incx, 0, 1, hipblas_client_never_set_nan);
+        hipblas_init_vector(hy, arg, M, incy, 0, 1, hipblas_client_never_set_nan);
+
+        device_vector<T> dx(hx.size());
+        device_vector<T> dy(hy.size());
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * hx.size(), hipMemcpyHostToDevice));
+
+        hy_gold = hy;
+        cblas_gemv<T>(HIPBLAS_OP_N,
+                      M,
+                      N,
+                      h_alpha,
+                      hK.data(),
+                      std::max(M, 1),
+                      hx.data(),
+                      incx,
+                      h_beta,
+                      hy_gold.data(),
+                      incy);
+
+        for(int device = 0; device < 2; device++)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+                handle, device ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+            const T* alpha = device ? (const T*)d_alpha : &h_alpha;
+            const T* beta  = device ? (const T*)d_beta : &h_beta;
+
+            CHECK_HIP_ERROR(hipMemcpy(dY, hY, sizeof(T) * hY.size(), hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasKronGemmEx(handle,
+                                                  factors,
+                                                  m.data(),
+                                                  n.data(),
+                                                  A.data(),
+                                                  lda.data(),
+                                                  alpha,
+                                                  dX,
+                                                  ldx,
+                                                  beta,
+                                                  dY,
+                                                  ldy,
+                                                  P,
+                                                  data_type,
+                                                  compute_type));
+            CHECK_HIP_ERROR(hipMemcpy(hY_out, dY, sizeof(T) * hY.size(), hipMemcpyDeviceToHost));
+
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * hy.size(), hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasKronGemvEx(handle,
+                                                  factors,
+                                                  m.data(),
+                                                  n.data(),
+                                                  A.data(),
+                                                  lda.data(),
+                                                  alpha,
+                                                  dx,
+                                                  incx,
+                                                  beta,
+                                                  dy,
+                                                  incy,
+                                                  data_type,
+                                                  compute_type));
+            CHECK_HIP_ERROR(hipMemcpy(hy_out, dy, sizeof(T) * hy.size(), hipMemcpyDeviceToHost));
+
+            // the data are small integers, so every partial sum is exact
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(M, P, ldy, hY_gold, hY_out);
+                unit_check_general<T>(1, M, incy, hy_gold, hy_out);
+            }
+        }
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    return HIPBLAS_STATUS_SUCCESS;
+}
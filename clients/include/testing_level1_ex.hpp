@@ -0,0 +1,342 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasLevel1ExModel = ArgumentModel<e_N, e_incx, e_batch_count>;
+
+inline void testname_level1_ex(const Arguments& arg, std::string& name)
+{
+    hipblasLevel1ExModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline T hipblas_level1_ex_convert(float value)
+{
+    if constexpr(std::is_same<T, hipblasHalf>{})
+        return float_to_half(value);
+    else
+        return float_to_bfloat16(value);
+}
+
+template <typename T>
+inline float hipblas_level1_ex_to_float(T value)
+{
+    if constexpr(std::is_same<T, hipblasHalf>{})
+        return half_to_float(value);
+    else
+        return bfloat16_to_float(value);
+}
+
+// Offset of element j of a vector of N elements, which runs from its last element when incx < 0
+inline size_t hipblas_level1_ex_offset(int j, int N, int incx)
+{
+    return incx < 0 ? size_t(N - 1 - j) * -incx : size_t(j) * incx;
+}
+
+// With BUILD_WITH_LEVEL1_EX every fp16 and bf16 call is supported
+#ifdef HIPBLAS_LEVEL1_EX
+constexpr bool hipblas_level1_ex_kernels = true;
+#else
+constexpr bool hipblas_level1_ex_kernels = false;
+#endif
+
+// Copies, swaps, reduces and normalizes strided batches of hipblasHalf or hipblasBfloat16, whose
+// integer values are exact in both, and checks them against float on the CPU. The fp16 and bf16
+// kernels are optional, and without them only contiguous copies are supported, so
+// HIPBLAS_STATUS_NOT_SUPPORTED skips a check. With them it fails the check.
+template <typename T>
+inline hipblasStatus_t testing_level1_ex(const Arguments& arg)
+{
+    int N           = arg.N;
+    int incx        = arg.incx;
+    int batch_count = arg.batch_count;
+
+    hipDataType type = std::is_same<T, hipblasHalf>{} ? HIP_R_16F : HIP_R_16BF;
+
+    hipblasLocalHandle handle(arg);
+
+    // Argument checks
+    EXPECT_HIPBLAS_STATUS(hipblasCopyEx(handle, N, nullptr, type, incx, nullptr, HIP_R_32F, 1),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasAsumEx(handle, N, nullptr, type, incx, nullptr, HIP_R_32F, HIP_R_64F),
+        HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasNormalizeEx(handle, N, nullptr, type, incx, nullptr, nullptr, type, HIP_R_64F),
+        HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // Quick return, with null vectors
+    EXPECT_HIPBLAS_STATUS(
+        hipblasIamaxStridedBatchedEx(handle, N, nullptr, type, incx, N, 0, nullptr),
+        HIPBLAS_STATUS_SUCCESS);
+    if(N <= 0 || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    int           abs_incx = incx >= 0 ? incx : -incx;
+    hipblasStride stridex  = hipblasStride(N) * abs_incx;
+    hipblasStride stridey  = N;
+    size_t        sizeX    = size_t(stridex) * batch_count;
+    size_t        sizeY    = size_t(stridey) * batch_count;
+
+    host_vector<float> hx_float(sizeX), hy_float(sizeY);
+    hipblas_init_vector(
+        hx_float, arg, N, abs_incx, stridex, batch_count, hipblas_client_never_set_nan, true, true);
+    hipblas_init_vector(
+        hy_float, arg, N, 1, stridey, batch_count, hipblas_client_never_set_nan, false, true);
+
+    host_vector<T> hx(sizeX), hy(sizeY);
+    for(size_t i = 0; i < sizeX; i++)
+        hx[i] = hipblas_level1_ex_convert<T>(hx_float[i]);
+    for(size_t i = 0; i < sizeY; i++)
+        hy[i] = hipblas_level1_ex_convert<T>(hy_float[i]);
+
+    device_vector<T> dx(sizeX), dy(sizeY), dz(sizeY);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * sizeY, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    // Copy of x into contiguous vectors, reversing it for negative incx
+    {
+        host_vector<T>  hz(sizeY);
+        hipblasStatus_t status = hipblasCopyStridedBatchedEx(
+            handle, N, dx, type, incx, stridex, dz, type, 1, stridey, batch_count);
+        if(hipblas_level1_ex_kernels || status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            CHECK_HIP_ERROR(hipMemcpy(hz, dz, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+            host_vector<float> hz_cpu(sizeY), hz_gpu(sizeY);
+            for(int b = 0; b < batch_count; b++)
+                for(int j = 0; j < N; j++)
+                {
+                    size_t i  = b * stridey + j;
+                    hz_cpu[i] = hx_float[b * stridex + hipblas_level1_ex_offset(j, N, incx)];
+                    hz_gpu[i] = hipblas_level1_ex_to_float(hz[i]);
+                }
+            if(arg.unit_check)
+                unit_check_general<float>(
+                    1, N, batch_count, 1, stridey, hz_cpu.data(), hz_gpu.data());
+        }
+    }
+
+    // Sums of magnitudes in float into host memory, and in T into device memory
+    {
+        host_vector<float> hsum(batch_count), hsum_cpu(batch_count);
+        for(int b = 0; b < batch_count; b++)
+        {
+            hsum_cpu[b] = 0;
+            for(int j = 0; incx > 0 && j < N; j++)
+                hsum_cpu[b] += std::abs(hx_float[b * stridex + size_t(j) * incx]);
+        }
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        hipblasStatus_t status = hipblasAsumStridedBatchedEx(
+            handle, N, dx, type, incx, stridex, batch_count, hsum, HIP_R_32F, HIP_R_32F);
+        if(hipblas_level1_ex_kernels || status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            if(arg.unit_check)
+                unit_check_general<float>(1, batch_count, 1, hsum_cpu.data(), hsum.data());
+
+            host_vector<T>   hsum_t(batch_count);
+            device_vector<T> dsum_t(batch_count);
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+            CHECK_HIPBLAS_ERROR(hipblasAsumStridedBatchedEx(
+                handle, N, dx, type, incx, stridex, batch_count, dsum_t, type, HIP_R_32F));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hsum_t, dsum_t, sizeof(T) * batch_count, hipMemcpyDeviceToHost));
+            for(int b = 0; b < batch_count; b++)
+            {
+                hsum_cpu[b] = hipblas_level1_ex_to_float(
+                    hipblas_level1_ex_convert<T>(hsum_cpu[b]));
+                hsum[b]     = hipblas_level1_ex_to_float(hsum_t[b]);
+            }
+            if(arg.unit_check)
+                unit_check_general<float>(1, batch_count, 1, hsum_cpu.data(), hsum.data());
+        }
+    }
+
+    // First indices of the largest and smallest magnitudes, 0 for incx <= 0, and their elements
+    {
+        host_vector<int> hamax(batch_count), hamin(batch_count);
+        host_vector<int> hamax_cpu(batch_count), hamin_cpu(batch_count);
+        for(int b = 0; b < batch_count; b++)
+        {
+            hamax_cpu[b] = hamin_cpu[b] = 0;
+            for(int j = 0; incx > 0 && j < N; j++)
+            {
+                auto magnitude = [&](int k) {
+                    return std::abs(hx_float[b * stridex + size_t(k) * incx]);
+                };
+                if(!hamax_cpu[b] || magnitude(j) > magnitude(hamax_cpu[b] - 1))
+                    hamax_cpu[b] = j + 1;
+                if(!hamin_cpu[b] || magnitude(j) < magnitude(hamin_cpu[b] - 1))
+                    hamin_cpu[b] = j + 1;
+            }
+        }
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        hipblasStatus_t status = hipblasIamaxStridedBatchedEx(
+            handle, N, dx, type, incx, stridex, batch_count, hamax);
+        if(hipblas_level1_ex_kernels || status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            CHECK_HIPBLAS_ERROR(hipblasIaminStridedBatchedEx(
+                handle, N, dx, type, incx, stridex, batch_count, hamin));
+            if(arg.unit_check)
+            {
+                unit_check_general<int>(1, batch_count, 1, hamax_cpu.data(), hamax.data());
+                unit_check_general<int>(1, batch_count, 1, hamin_cpu.data(), hamin.data());
+            }
+        }
+
+        // The same indices with their elements, and with their magnitudes in device memory
+        host_vector<int> hindex(batch_count);
+        host_vector<T>   hvalue(batch_count);
+        status = hipblasIamaxValueStridedBatchedEx(
+            handle, N, dx, type, incx, stridex, batch_count, hindex, hvalue, 0);
+        if(hipblas_level1_ex_kernels || status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+
+            host_vector<float> hvalue_cpu(batch_count), hvalue_gpu(batch_count);
+            for(int b = 0; b < batch_count; b++)
+            {
+                hvalue_cpu[b]
+                    = hamax_cpu[b] ? hx_float[b * stridex + size_t(hamax_cpu[b] - 1) * incx] : 0;
+                hvalue_gpu[b] = hipblas_level1_ex_to_float(hvalue[b]);
+            }
+            if(arg.unit_check)
+            {
+                unit_check_general<int>(1, batch_count, 1, hamax_cpu.data(), hindex.data());
+                unit_check_general<float>(1, batch_count, 1, hvalue_cpu.data(), hvalue_gpu.data());
+            }
+
+            device_vector<int> dindex(batch_count);
+            device_vector<T>   dvalue(batch_count);
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+            CHECK_HIPBLAS_ERROR(hipblasIaminValueStridedBatchedEx(
+                handle, N, dx, type, incx, stridex, batch_count, dindex, dvalue, 1));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hindex, dindex, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hvalue, dvalue, sizeof(T) * batch_count, hipMemcpyDeviceToHost));
+            for(int b = 0; b < batch_count; b++)
+            {
+                float element
+                    = hamin_cpu[b] ? hx_float[b * stridex + size_t(hamin_cpu[b] - 1) * incx] : 0;
+                hvalue_cpu[b] = std::abs(element);
+                hvalue_gpu[b] = hipblas_level1_ex_to_float(hvalue[b]);
+            }
+            if(arg.unit_check)
+            {
+                unit_check_general<int>(1, batch_count, 1, hamin_cpu.data(), hindex.data());
+                unit_check_general<float>(1, batch_count, 1, hvalue_cpu.data(), hvalue_gpu.data());
+            }
+        }
+    }
+
+    // Norms in float and x scaled by them in one pass, on a copy of x, leaving x unchanged for
+    // incx <= 0. The scaled elements are rounded to T, so they are compared to 1e-2.
+    {
+        host_vector<float> hnorm(batch_count), hnorm_cpu(batch_count);
+        host_vector<float> hn_cpu(sizeX), hn_gpu(sizeX);
+        for(int b = 0; b < batch_count; b++)
+        {
+            double sum = 0;
+            for(int j = 0; incx > 0 && j < N; j++)
+                sum += double(hx_float[b * stridex + size_t(j) * incx])
+                       * hx_float[b * stridex + size_t(j) * incx];
+            hnorm_cpu[b] = float(std::sqrt(sum));
+        }
+        for(size_t i = 0; i < sizeX; i++)
+        {
+            float norm = incx > 0 ? hnorm_cpu[i / stridex] : 0;
+            hn_cpu[i]  = hx_float[i] / (norm > 0 ? norm : 1);
+        }
+
+        float            epsilon = 1e-6f;
+        host_vector<T>   hn(sizeX);
+        device_vector<T> dn(sizeX);
+        CHECK_HIP_ERROR(hipMemcpy(dn, hx, sizeof(T) * sizeX, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        hipblasStatus_t status = hipblasNormalizeStridedBatchedEx(
+            handle, N, dn, type, incx, stridex, batch_count, &epsilon, hnorm, HIP_R_32F, HIP_R_32F);
+        if(hipblas_level1_ex_kernels || status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            CHECK_HIP_ERROR(hipMemcpy(hn, dn, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < sizeX; i++)
+                hn_gpu[i] = hipblas_level1_ex_to_float(hn[i]);
+            if(arg.unit_check)
+            {
+                for(int b = 0; b < batch_count; b++)
+                    near_check_general<float>(
+                        1, 1, 1, &hnorm_cpu[b], &hnorm[b], 1e-5 * (1 + hnorm_cpu[b]));
+                near_check_general<float>(1, sizeX, 1, hn_cpu.data(), hn_gpu.data(), 1e-2);
+            }
+        }
+    }
+
+    // Swap of x and y, which interchanges them element by element in BLAS order
+    {
+        hipblasStatus_t status = hipblasSwapStridedBatchedEx(
+            handle, N, dx, type, incx, stridex, dy, type, 1, stridey, batch_count);
+        if(hipblas_level1_ex_kernels || status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            host_vector<T> hx_swapped(sizeX), hy_swapped(sizeY);
+            CHECK_HIP_ERROR(hipMemcpy(hx_swapped, dx, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hy_swapped, dy, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+            host_vector<float> hx_cpu(sizeY), hx_gpu(sizeY), hy_gpu(sizeY);
+            for(int b = 0; b < batch_count; b++)
+                for(int j = 0; j < N; j++)
+                {
+                    size_t i  = b * stridey + j;
+                    size_t ix = b * stridex + hipblas_level1_ex_offset(j, N, incx);
+                    hx_cpu[i] = hx_float[ix];
+                    hx_gpu[i] = hipblas_level1_ex_to_float(hx_swapped[ix]);
+                    hy_gpu[i] = hipblas_level1_ex_to_float(hy_swapped[i]);
+                }
+            if(arg.unit_check)
+            {
+                unit_check_general<float>(
+                    1, N, batch_count, 1, stridey, hy_float.data(), hx_gpu.data());
+                unit_check_general<float>(
+                    1, N, batch_count, 1, stridey, hx_cpu.data(), hy_gpu.data());
+            }
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
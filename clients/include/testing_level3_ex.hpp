@@ -0,0 +1,378 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+#include "testing_gemv_ex.hpp"
+
+/* ============================================================================================ */
+
+using hipblasLevel3ExModel = ArgumentModel<e_side,
+                                           e_uplo,
+                                           e_transA,
+                                           e_diag,
+                                           e_M,
+                                           e_N,
+                                           e_K,
+                                           e_alpha,
+                                           e_lda,
+                                           e_ldb,
+                                           e_beta,
+                                           e_ldc,
+                                           e_batch_count>;
+
+inline void testname_level3_ex(const Arguments& arg, std::string& name)
+{
+    hipblasLevel3ExModel{}.test_name(arg, name);
+}
+
+// Runs syrkEx and syr2kEx on the N by N C with inner dimension K, and trmmEx and symmEx on the M
+// by N C. As in testing_gemv_ex the inputs are in {-1, 0, 1} and C is initialized to integers, so
+// the half and bfloat16 paths are checked exactly against float, including the triangle of C that
+// syrkEx and syr2kEx do not reference. Type combinations a backend cannot run return
+// HIPBLAS_STATUS_NOT_SUPPORTED and are skipped.
+inline hipblasStatus_t testing_level3_ex(const Arguments& arg)
+{
+    hipblasSideMode_t  side   = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(arg.diag);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    int ld_min = std::max({1, M, N, K});
+    if(M < 0 || N < 0 || K < 0 || lda < ld_min || ldb < ld_min || ldc < ld_min
+       || batch_count < 0)
+    {
+        return hipblasSyrkEx(handle,
+                             uplo,
+                             transA,
+                             N,
+                             K,
+                             &h_alpha,
+                             nullptr,
+                             HIP_R_32F,
+                             lda,
+                             &h_beta,
+                             nullptr,
+                             HIP_R_32F,
+                             ldc,
+                             HIPBLAS_COMPUTE_32F);
+    }
+
+    const hipblasStride stride_A = hipblasStride(lda) * std::max({M, N, K});
+    const hipblasStride stride_B = hipblasStride(ldb) * std::max(N, K);
+    const hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    const size_t size_A = stride_A * batch_count;
+    const size_t size_B = stride_B * batch_count;
+    const size_t size_C = stride_C * batch_count;
+
+    host_vector<float> hA(size_A);
+    host_vector<float> hB(size_B);
+    host_vector<float> hC_init(size_C);
+    host_vector<float> hC(size_C);
+    host_vector<float> hsyrk_gold(size_C);
+    host_vector<float> hsyr2k_gold(size_C);
+    host_vector<float> htrmm_gold(size_C);
+    host_vector<float> hsymm_gold(size_C);
+
+    srand(1);
+    for(auto& a : hA)
+        a = float(rand() % 3 - 1);
+    for(auto& b : hB)
+        b = float(rand() % 3 - 1);
+    for(auto& c : hC_init)
+        c = float(rand() % 5 - 2);
+
+    hsyrk_gold  = hC_init;
+    hsyr2k_gold = hC_init;
+    hsymm_gold  = hC_init;
+    for(int b = 0; b < batch_count; b++)
+    {
+        float* A = hA.data() + b * stride_A;
+        float* B = hB.data() + b * stride_B;
+        cblas_syrk<float>(
+            uplo, transA, N, K, h_alpha, A, lda, h_beta, hsyrk_gold.data() + b * stride_C, ldc);
+        cblas_syr2k<float>(uplo,
+                           transA,
+                           N,
+                           K,
+                           h_alpha,
+                           A,
+                           lda,
+                           B,
+                           ldb,
+                           h_beta,
+                           hsyr2k_gold.data() + b * stride_C,
+                           ldc);
+        cblas_symm<float>(side,
+                          uplo,
+                          M,
+                          N,
+                          h_alpha,
+                          A,
+                          lda,
+                          B,
+                          ldb,
+                          h_beta,
+                          hsymm_gold.data() + b * stride_C,
+                          ldc);
+
+        // trmm is in place on B, so it runs on B copied to the layout of C
+        float* C = htrmm_gold.data() + b * stride_C;
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                C[i + size_t(j) * ldc] = B[i + size_t(j) * ldb];
+        cblas_trmm<float>(side, uplo, transA, diag, M, N, h_alpha, A, lda, C, ldc);
+    }
+
+    auto check = [&](auto ti, auto to, hipDataType io_type, hipDataType c_type) {
+        using Ti = decltype(ti);
+        using To = decltype(to);
+
+        host_vector<Ti> hA_typed(size_A);
+        host_vector<Ti> hB_typed(size_B);
+        host_vector<To> hC_typed(size_C);
+        for(size_t i = 0; i < size_A; i++)
+            hA_typed[i] = hipblas_gemv_ex_convert<Ti>(hA[i]);
+        for(size_t i = 0; i < size_B; i++)
+            hB_typed[i] = hipblas_gemv_ex_convert<Ti>(hB[i]);
+
+        device_vector<Ti> dA(size_A);
+        device_vector<Ti> dB(size_B);
+        device_vector<To> dC(size_C);
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA_typed, sizeof(Ti) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB_typed, sizeof(Ti) * size_B, hipMemcpyHostToDevice));
+
+        // Resets dC to the initial C, then compares it with gold after fn unless it is not
+        // supported
+        auto run = [&](auto fn, int rows, host_vector<float>& gold) {
+            for(size_t i = 0; i < size_C; i++)
+                hC_typed[i] = hipblas_gemv_ex_convert<To>(hC_init[i]);
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_typed, sizeof(To) * size_C, hipMemcpyHostToDevice));
+
+            hipblasStatus_t status = fn();
+            if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+                return HIPBLAS_STATUS_SUCCESS;
+            CHECK_HIPBLAS_ERROR(status);
+
+            CHECK_HIP_ERROR(hipMemcpy(hC_typed, dC, sizeof(To) * size_C, hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < size_C; i++)
+                hC[i] = hipblas_gemv_ex_to_float(hC_typed[i]);
+            if(arg.unit_check)
+                unit_check_general<float>(rows, N, batch_count, ldc, stride_C, gold, hC);
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+
+        auto syrk = [&]() {
+            if(batch_count == 1)
+                return hipblasSyrkEx(handle,
+                                     uplo,
+                                     transA,
+                                     N,
+                                     K,
+                                     &h_alpha,
+                                     dA,
+                                     io_type,
+                                     lda,
+                                     &h_beta,
+                                     dC,
+                                     c_type,
+                                     ldc,
+                                     HIPBLAS_COMPUTE_32F);
+            return hipblasSyrkStridedBatchedEx(handle,
+                                               uplo,
+                                               transA,
+                                               N,
+                                               K,
+                                               &h_alpha,
+                                               dA,
+                                               io_type,
+                                               lda,
+                                               stride_A,
+                                               &h_beta,
+                                               dC,
+                                               c_type,
+                                               ldc,
+                                               stride_C,
+                                               batch_count,
+                                               HIPBLAS_COMPUTE_32F);
+        };
+        auto syr2k = [&]() {
+            if(batch_count == 1)
+                return hipblasSyr2kEx(handle,
+                                      uplo,
+                                      transA,
+                                      N,
+                                      K,
+                                      &h_alpha,
+                                      dA,
+                                      io_type,
+                                      lda,
+                                      dB,
+                                      io_type,
+                                      ldb,
+                                      &h_beta,
+                                      dC,
+                                      c_type,
+                                      ldc,
+                                      HIPBLAS_COMPUTE_32F);
+            return hipblasSyr2kStridedBatchedEx(handle,
+                                                uplo,
+                                                transA,
+                                                N,
+                                                K,
+                                                &h_alpha,
+                                                dA,
+                                                io_type,
+                                                lda,
+                                                stride_A,
+                                                dB,
+                                                io_type,
+                                                ldb,
+                                                stride_B,
+                                                &h_beta,
+                                                dC,
+                                                c_type,
+                                                ldc,
+                                                stride_C,
+                                                batch_count,
+                                                HIPBLAS_COMPUTE_32F);
+        };
+        auto trmm = [&]() {
+            if(batch_count == 1)
+                return hipblasTrmmEx(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     M,
+                                     N,
+                                     &h_alpha,
+                                     dA,
+                                     io_type,
+                                     lda,
+                                     dB,
+                                     io_type,
+                                     ldb,
+                                     dC,
+                                     c_type,
+                                     ldc,
+                                     HIPBLAS_COMPUTE_32F);
+            return hipblasTrmmStridedBatchedEx(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               M,
+                                               N,
+                                               &h_alpha,
+                                               dA,
+                                               io_type,
+                                               lda,
+                                               stride_A,
+                                               dB,
+                                               io_type,
+                                               ldb,
+                                               stride_B,
+                                               dC,
+                                               c_type,
+                                               ldc,
+                                               stride_C,
+                                               batch_count,
+                                               HIPBLAS_COMPUTE_32F);
+        };
+        auto symm = [&]() {
+            if(batch_count == 1)
+                return hipblasSymmEx(handle,
+                                     side,
+                                     uplo,
+                                     M,
+                                     N,
+                                     &h_alpha,
+                                     dA,
+                                     io_type,
+                                     lda,
+                                     dB,
+                                     io_type,
+                                     ldb,
+                                     &h_beta,
+                                     dC,
+                                     c_type,
+                                     ldc,
+                                     HIPBLAS_COMPUTE_32F);
+            return hipblasSymmStridedBatchedEx(handle,
+                                               side,
+                                               uplo,
+                                               M,
+                                               N,
+                                               &h_alpha,
+                                               dA,
+                                               io_type,
+                                               lda,
+                                               stride_A,
+                                               dB,
+                                               io_type,
+                                               ldb,
+                                               stride_B,
+                                               &h_beta,
+                                               dC,
+                                               c_type,
+                                               ldc,
+                                               stride_C,
+                                               batch_count,
+                                               HIPBLAS_COMPUTE_32F);
+        };
+
+        CHECK_HIPBLAS_ERROR(run(syrk, N, hsyrk_gold));
+        CHECK_HIPBLAS_ERROR(run(syr2k, N, hsyr2k_gold));
+        CHECK_HIPBLAS_ERROR(run(trmm, M, htrmm_gold));
+        CHECK_HIPBLAS_ERROR(run(symm, M, hsymm_gold));
+        return HIPBLAS_STATUS_SUCCESS;
+    };
+
+    CHECK_HIPBLAS_ERROR(check(float{}, float{}, HIP_R_32F, HIP_R_32F));
+    CHECK_HIPBLAS_ERROR(check(hipblasHalf{}, hipblasHalf{}, HIP_R_16F, HIP_R_16F));
+    CHECK_HIPBLAS_ERROR(check(hipblasHalf{}, float{}, HIP_R_16F, HIP_R_32F));
+    CHECK_HIPBLAS_ERROR(check(hipblasBfloat16{}, hipblasBfloat16{}, HIP_R_16BF, HIP_R_16BF));
+    CHECK_HIPBLAS_ERROR(check(hipblasBfloat16{}, float{}, HIP_R_16BF, HIP_R_32F));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,193 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasMatinvBatchedModel = ArgumentModel<e_N, e_lda, e_ldb, e_batch_count>;
+
+inline void testname_matinv_batched(const Arguments& arg, std::string& name)
+{
+    hipblasMatinvBatchedModel{}.test_name(arg, name);
+}
+
+// The inverses are checked against LAPACK getrf and getri, with lda_inv = arg.ldb, and A must be
+// left as it was. N <= 32 runs the Gauss-Jordan kernel or cuBLAS and larger N getrf and getri on
+// copies. Without BUILD_WITH_SMALL_LU the function may return HIPBLAS_STATUS_NOT_SUPPORTED, and
+// nothing is checked, with it HIPBLAS_STATUS_NOT_SUPPORTED fails the test.
+template <typename T>
+inline hipblasStatus_t testing_matinv_batched(const Arguments& arg)
+{
+    using U                     = real_t<T>;
+    auto hipblasMatinvBatchedFn = hipblasMatinvBatched<T>;
+
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int lda_inv     = arg.ldb;
+    int batch_count = arg.batch_count;
+
+    size_t A_size    = size_t(lda) * N;
+    size_t Ainv_size = size_t(lda_inv) * N;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < std::max(1, N) || lda_inv < std::max(1, N) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hA_result(A_size, 1, batch_count);
+    host_batch_vector<T> hAinv(Ainv_size, 1, batch_count);
+    host_vector<int>     hIpiv(N);
+    host_vector<int>     hInfo(batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dAinv(Ainv_size, 1, batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU, scaled to avoid singularities
+    hipblas_init(hA, true);
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < N; i++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemset(dInfo, -1, batch_count * sizeof(int)));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        hipblasStatus_t status = hipblasMatinvBatchedFn(handle,
+                                                        N,
+                                                        dA.ptr_on_device(),
+                                                        lda,
+                                                        dAinv.ptr_on_device(),
+                                                        lda_inv,
+                                                        dInfo,
+                                                        batch_count);
+#ifndef HIPBLAS_SMALL_LU
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+            return HIPBLAS_STATUS_SUCCESS;
+#endif
+        CHECK_HIPBLAS_ERROR(status);
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hA_result.transfer_from(dA));
+        CHECK_HIP_ERROR(hAinv.transfer_from(dAinv));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(N, N, lda, hA[b], hA_result[b]);
+                EXPECT_EQ(0, hInfo[b]);
+            }
+
+            cblas_getrf(N, N, hA[b], lda, hIpiv.data());
+
+            // Workspace query
+            host_vector<T> work(1);
+            cblas_getri(N, hA[b], lda, hIpiv.data(), work.data(), -1);
+            int lwork = type2int(work[0]);
+
+            // Perform inversion
+            work = host_vector<T>(lwork);
+            cblas_getri(N, hA[b], lda, hIpiv.data(), work.data(), lwork);
+
+            // The inverse in the leading dimension of the result
+            host_vector<T> hAinv_gold(Ainv_size);
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < N; i++)
+                    hAinv_gold[i + size_t(j) * lda_inv] = hA[b][i + size_t(j) * lda];
+
+            hipblas_error = std::max(
+                hipblas_error,
+                norm_check_general<T>('F', N, N, lda_inv, hAinv_gold.data(), hAinv[b]));
+        }
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+            unit_check_error(hipblas_error, tolerance);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasMatinvBatchedFn(handle,
+                                                       N,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       dAinv.ptr_on_device(),
+                                                       lda_inv,
+                                                       dInfo,
+                                                       batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        double gflops = getrf_gflop_count<T>(N, N) + getri_gflop_count<T>(N);
+        hipblasMatinvBatchedModel{}.log_args<T>(
+            std::cout, arg, gpu_time_used, gflops, ArgumentLogging::NA_value, hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,308 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasPackedConvertModel = ArgumentModel<e_uplo, e_M, e_N, e_KL, e_KU, e_lda, e_batch_count>;
+
+inline void testname_packed_convert(const Arguments& arg, std::string& name)
+{
+    hipblasPackedConvertModel{}.test_name(arg, name);
+}
+
+template <typename T>
+struct hipblas_packed_functions;
+
+template <>
+struct hipblas_packed_functions<float>
+{
+    static constexpr auto tpttr                  = hipblasStpttr;
+    static constexpr auto tpttrBatched           = hipblasStpttrBatched;
+    static constexpr auto tpttrStridedBatched    = hipblasStpttrStridedBatched;
+    static constexpr auto trttp                  = hipblasStrttp;
+    static constexpr auto trttpBatched           = hipblasStrttpBatched;
+    static constexpr auto trttpStridedBatched    = hipblasStrttpStridedBatched;
+    static constexpr auto gbpack                 = hipblasSgbpack;
+    static constexpr auto gbpackBatched          = hipblasSgbpackBatched;
+    static constexpr auto gbpackStridedBatched   = hipblasSgbpackStridedBatched;
+    static constexpr auto gbunpack               = hipblasSgbunpack;
+    static constexpr auto gbunpackBatched        = hipblasSgbunpackBatched;
+    static constexpr auto gbunpackStridedBatched = hipblasSgbunpackStridedBatched;
+};
+
+template <>
+struct hipblas_packed_functions<hipblasComplex>
+{
+    static constexpr auto tpttr                  = hipblasCtpttr;
+    static constexpr auto tpttrBatched           = hipblasCtpttrBatched;
+    static constexpr auto tpttrStridedBatched    = hipblasCtpttrStridedBatched;
+    static constexpr auto trttp                  = hipblasCtrttp;
+    static constexpr auto trttpBatched           = hipblasCtrttpBatched;
+    static constexpr auto trttpStridedBatched    = hipblasCtrttpStridedBatched;
+    static constexpr auto gbpack                 = hipblasCgbpack;
+    static constexpr auto gbpackBatched          = hipblasCgbpackBatched;
+    static constexpr auto gbpackStridedBatched   = hipblasCgbpackStridedBatched;
+    static constexpr auto gbunpack               = hipblasCgbunpack;
+    static constexpr auto gbunpackBatched        = hipblasCgbunpackBatched;
+    static constexpr auto gbunpackStridedBatched = hipblasCgbunpackStridedBatched;
+};
+
+// Runs the plain, strided batched and batched forms of one conversion from hSrc into a destination
+// starting as hDst_init, and compares the rows x cols matrices of the destination with hDst_gold.
+template <typename T, typename Plain, typename Batched, typename Strided>
+inline hipblasStatus_t testing_packed_convert_forms(const Arguments& arg,
+                                                    host_vector<T>&  hSrc,
+                                                    hipblasStride    stride_src,
+                                                    host_vector<T>&  hDst_init,
+                                                    host_vector<T>&  hDst_gold,
+                                                    int              rows,
+                                                    int              cols,
+                                                    int              ld_dst,
+                                                    hipblasStride    stride_dst,
+                                                    int              batch_count,
+                                                    Plain            plain,
+                                                    Batched          batched,
+                                                    Strided          strided)
+{
+    device_vector<T> dSrc(hSrc.size());
+    device_vector<T> dDst(hDst_init.size());
+    host_vector<T>   hDst(hDst_init.size());
+    CHECK_HIP_ERROR(hipMemcpy(dSrc, hSrc, sizeof(T) * hSrc.size(), hipMemcpyHostToDevice));
+
+    // Resets dDst to the initial destination, then compares the batch_check first matrices of it
+    // with the gold after fn
+    auto run = [&](auto fn, int batch_check) {
+        CHECK_HIP_ERROR(hipMemcpy(dDst, hDst_init, sizeof(T) * hDst.size(), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(fn());
+        CHECK_HIP_ERROR(hipMemcpy(hDst, dDst, sizeof(T) * hDst.size(), hipMemcpyDeviceToHost));
+        if(arg.unit_check)
+            unit_check_general<T>(rows, cols, batch_check, ld_dst, stride_dst, hDst_gold, hDst);
+        return HIPBLAS_STATUS_SUCCESS;
+    };
+
+    CHECK_HIPBLAS_ERROR(run([&]() { return plain(dSrc, dDst); }, std::min(batch_count, 1)));
+    CHECK_HIPBLAS_ERROR(run([&]() { return strided(dSrc, dDst); }, batch_count));
+
+    // The batched form runs on copies of the matrices in batch vectors
+    const hipblasStride    n_src = std::max(stride_src, hipblasStride(1));
+    const hipblasStride    n_dst = std::max(stride_dst, hipblasStride(1));
+    host_batch_vector<T>   hSrc_batch(n_src, 1, batch_count);
+    host_batch_vector<T>   hDst_batch(n_dst, 1, batch_count);
+    host_batch_vector<T>   hDst_gold_batch(n_dst, 1, batch_count);
+    device_batch_vector<T> dSrc_batch(n_src, 1, batch_count);
+    device_batch_vector<T> dDst_batch(n_dst, 1, batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        std::copy(hSrc.data() + b * stride_src, hSrc.data() + (b + 1) * stride_src, hSrc_batch[b]);
+        std::copy(hDst_init.data() + b * stride_dst,
+                  hDst_init.data() + (b + 1) * stride_dst,
+                  hDst_batch[b]);
+        std::copy(hDst_gold.data() + b * stride_dst,
+                  hDst_gold.data() + (b + 1) * stride_dst,
+                  hDst_gold_batch[b]);
+    }
+    CHECK_HIP_ERROR(dSrc_batch.transfer_from(hSrc_batch));
+    CHECK_HIP_ERROR(dDst_batch.transfer_from(hDst_batch));
+    CHECK_HIPBLAS_ERROR(batched(dSrc_batch.ptr_on_device(), dDst_batch.ptr_on_device()));
+    CHECK_HIP_ERROR(hDst_batch.transfer_from(dDst_batch));
+    if(arg.unit_check)
+        unit_check_general<T>(rows, cols, batch_count, ld_dst, hDst_gold_batch, hDst_batch);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Packs the uplo triangle of N x N matrices and the KL, KU band of M x N matrices on the CPU,
+// then checks trttp and gbpack against the packing and tpttr and gbunpack with it as the source.
+// The full matrices share lda, and ldab is KL + KU + 1.
+template <typename T>
+inline hipblasStatus_t testing_packed_convert(const Arguments& arg)
+{
+    using F = hipblas_packed_functions<T>;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int KL          = arg.KL;
+    int KU          = arg.KU;
+    int lda         = arg.lda;
+    int ldab        = KL + KU + 1;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    if(N < 0 || batch_count < 0 || lda < std::max(1, N))
+    {
+        return F::trttpStridedBatched(handle, uplo, N, nullptr, lda, 0, nullptr, 0, batch_count);
+    }
+    if(M < 0 || KL < 0 || KU < 0 || lda < std::max(1, M))
+    {
+        return F::gbpackStridedBatched(
+            handle, M, N, KL, KU, nullptr, lda, 0, nullptr, ldab, 0, batch_count);
+    }
+
+    const hipblasStride stride_A  = hipblasStride(lda) * N;
+    const hipblasStride stride_AP = hipblasStride(N) * (N + 1) / 2;
+    const hipblasStride stride_AB = hipblasStride(ldab) * N;
+
+    // The plain forms run on the first matrices even when batch_count is 0
+    const int    batches = std::max(batch_count, 1);
+    const size_t size_A  = std::max(stride_A * batches, hipblasStride(1));
+    const size_t size_AP = std::max(stride_AP * batches, hipblasStride(1));
+    const size_t size_AB = std::max(stride_AB * batches, hipblasStride(1));
+
+    host_vector<T> hA(size_A);
+    host_vector<T> hA_init(size_A);
+    host_vector<T> hA_tp_gold(size_A);
+    host_vector<T> hA_gb_gold(size_A);
+    host_vector<T> hAP_init(size_AP);
+    host_vector<T> hAP_gold(size_AP);
+    host_vector<T> hAB_init(size_AB);
+    host_vector<T> hAB_gold(size_AB);
+
+    srand(1);
+    hipblas_init<T>(hA);
+    hipblas_init<T>(hA_init);
+    hipblas_init<T>(hAP_init);
+    hipblas_init<T>(hAB_init);
+
+    hA_tp_gold = hA_init;
+    hA_gb_gold = hA_init;
+    hAP_gold   = hAP_init;
+    hAB_gold   = hAB_init;
+    for(int b = 0; b < batches; b++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            int    i_begin = uplo == HIPBLAS_FILL_MODE_UPPER ? 0 : j;
+            int    i_end   = uplo == HIPBLAS_FILL_MODE_UPPER ? j + 1 : N;
+            size_t offset  = uplo == HIPBLAS_FILL_MODE_UPPER ? size_t(j) * (j + 1) / 2
+                                                             : size_t(j) * (2 * N - j + 1) / 2;
+            for(int i = i_begin; i < i_end; i++)
+            {
+                size_t a = b * stride_A + i + size_t(j) * lda;
+
+                hAP_gold[b * stride_AP + offset + i - i_begin] = hA[a];
+                hA_tp_gold[a]                                  = hA[a];
+            }
+
+            for(int i = std::max(0, j - KU); i < std::min(M, j + KL + 1); i++)
+            {
+                size_t a = b * stride_A + i + size_t(j) * lda;
+
+                hAB_gold[b * stride_AB + KU + i - j + size_t(j) * ldab] = hA[a];
+                hA_gb_gold[a]                                           = hA[a];
+            }
+        }
+    }
+
+    CHECK_HIPBLAS_ERROR(testing_packed_convert_forms<T>(
+        arg,
+        hA,
+        stride_A,
+        hAP_init,
+        hAP_gold,
+        stride_AP,
+        1,
+        std::max(stride_AP, hipblasStride(1)),
+        stride_AP,
+        batch_count,
+        [&](const T* A, T* AP) { return F::trttp(handle, uplo, N, A, lda, AP); },
+        [&](const T* const* A, T* const* AP) {
+            return F::trttpBatched(handle, uplo, N, A, lda, AP, batch_count);
+        },
+        [&](const T* A, T* AP) {
+            return F::trttpStridedBatched(
+                handle, uplo, N, A, lda, stride_A, AP, stride_AP, batch_count);
+        }));
+
+    CHECK_HIPBLAS_ERROR(testing_packed_convert_forms<T>(
+        arg,
+        hAP_gold,
+        stride_AP,
+        hA_init,
+        hA_tp_gold,
+        N,
+        N,
+        lda,
+        stride_A,
+        batch_count,
+        [&](const T* AP, T* A) { return F::tpttr(handle, uplo, N, AP, A, lda); },
+        [&](const T* const* AP, T* const* A) {
+            return F::tpttrBatched(handle, uplo, N, AP, A, lda, batch_count);
+        },
+        [&](const T* AP, T* A) {
+            return F::tpttrStridedBatched(
+                handle, uplo, N, AP, stride_AP, A, lda, stride_A, batch_count);
+        }));
+
+    CHECK_HIPBLAS_ERROR(testing_packed_convert_forms<T>(
+        arg,
+        hA,
+        stride_A,
+        hAB_init,
+        hAB_gold,
+        ldab,
+        N,
+        ldab,
+        stride_AB,
+        batch_count,
+        [&](const T* A, T* AB) { return F::gbpack(handle, M, N, KL, KU, A, lda, AB, ldab); },
+        [&](const T* const* A, T* const* AB) {
+            return F::gbpackBatched(handle, M, N, KL, KU, A, lda, AB, ldab, batch_count);
+        },
+        [&](const T* A, T* AB) {
+            return F::gbpackStridedBatched(
+                handle, M, N, KL, KU, A, lda, stride_A, AB, ldab, stride_AB, batch_count);
+        }));
+
+    CHECK_HIPBLAS_ERROR(testing_packed_convert_forms<T>(
+        arg,
+        hAB_gold,
+        stride_AB,
+        hA_init,
+        hA_gb_gold,
+        M,
+        N,
+        lda,
+        stride_A,
+        batch_count,
+        [&](const T* AB, T* A) { return F::gbunpack(handle, M, N, KL, KU, AB, ldab, A, lda); },
+        [&](const T* const* AB, T* const* A) {
+            return F::gbunpackBatched(handle, M, N, KL, KU, AB, ldab, A, lda, batch_count);
+        },
+        [&](const T* AB, T* A) {
+            return F::gbunpackStridedBatched(
+                handle, M, N, KL, KU, AB, ldab, stride_AB, A, lda, stride_A, batch_count);
+        }));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,296 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasPotrsBatchedModel = ArgumentModel<e_uplo, e_N, e_lda, e_ldb, e_batch_count>;
+
+inline void testname_potrs_batched(const Arguments& arg, std::string& name)
+{
+    hipblasPotrsBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t setup_potrs_batched_testing(host_batch_vector<T>&   hA,
+                                                   host_batch_vector<T>&   hB,
+                                                   host_batch_vector<T>&   hX,
+                                                   device_batch_vector<T>& dA,
+                                                   device_batch_vector<T>& dB,
+                                                   char                    uplo,
+                                                   int                     N,
+                                                   int                     lda,
+                                                   int                     ldb,
+                                                   int                     batch_count)
+{
+    host_vector<T> hAAT(size_t(N) * lda);
+
+    // Initial hA, hB, hX on CPU
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hipblas_init<T>(hA[b], N, N, lda);
+        hipblas_init<T>(hX[b], N, 1, ldb);
+        prepare_positive_definite(hA[b], lda, hAAT.data(), N);
+
+        // Calculate hB = hA*hX;
+        cblas_gemm<T>(op, op, N, 1, N, (T)1, hA[b], lda, hX[b], ldb, (T)0, hB[b], ldb);
+
+        // Cholesky factorize hA on the CPU
+        int info = cblas_potrf<T>(uplo, N, hA[b], lda);
+        if(info != 0)
+        {
+            std::cerr << "Cholesky decomposition failed" << std::endl;
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_potrs_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasPotrsBatchedFn
+        = arg.fortran ? hipblasPotrsBatched<T, true> : hipblasPotrsBatched<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N           = 100;
+    const int          nrhs        = 1;
+    const int          lda         = 101;
+    const int          ldb         = 102;
+    const int          batch_count = 2;
+    const size_t       A_size      = size_t(N) * lda;
+    const size_t       B_size      = ldb;
+
+    const hipblasFillMode_t uplo = HIPBLAS_FILL_MODE_UPPER;
+
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hB(B_size, 1, batch_count);
+    host_batch_vector<T> hX(B_size, 1, batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dB(B_size, 1, batch_count);
+    int                    info = 0;
+
+    T* const* dAp = dA.ptr_on_device();
+    T* const* dBp = dB.ptr_on_device();
+
+    // Need initialization code because even with bad params we call rocSOLVER
+    // so want to give reasonable data
+    EXPECT_HIPBLAS_STATUS(
+        setup_potrs_batched_testing(hA, hB, hX, dA, dB, 'U', N, lda, ldb, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(handle, uplo, N, nrhs, dAp, lda, dBp, ldb, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(
+            handle, HIPBLAS_FILL_MODE_FULL, N, nrhs, dAp, lda, dBp, ldb, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(handle, uplo, -1, nrhs, dAp, lda, dBp, ldb, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(handle, uplo, N, -1, dAp, lda, dBp, ldb, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(handle, uplo, N, nrhs, nullptr, lda, dBp, ldb, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(handle, uplo, N, nrhs, dAp, N - 1, dBp, ldb, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(handle, uplo, N, nrhs, dAp, lda, nullptr, ldb, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(handle, uplo, N, nrhs, dAp, lda, dBp, N - 1, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-7, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(handle, uplo, N, nrhs, dAp, lda, dBp, ldb, &info, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-9, info);
+
+    // If N == 0, A and B can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(
+            handle, uplo, 0, nrhs, nullptr, lda, nullptr, ldb, &info, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // if nrhs == 0, B can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsBatchedFn(handle, uplo, N, 0, dAp, lda, nullptr, ldb, &info, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_potrs_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.fortran;
+    auto hipblasPotrsBatchedFn
+        = FORTRAN ? hipblasPotrsBatched<T, true> : hipblasPotrsBatched<T, false>;
+
+    hipblasFillMode_t uplo        = char2hipblas_fill(arg.uplo);
+    int               N           = arg.N;
+    int               lda         = arg.lda;
+    int               ldb         = arg.ldb;
+    int               batch_count = arg.batch_count;
+
+    size_t A_size = size_t(lda) * N;
+    size_t B_size = ldb * 1;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hX(B_size, 1, batch_count);
+    host_batch_vector<T> hB(B_size, 1, batch_count);
+    host_batch_vector<T> hB1(B_size, 1, batch_count);
+    int                  info;
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dB(B_size, 1, batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(
+        setup_potrs_batched_testing(hA, hB, hX, dA, dB, arg.uplo, N, lda, ldb, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasPotrsBatchedFn(handle,
+                                                  uplo,
+                                                  N,
+                                                  1,
+                                                  dA.ptr_on_device(),
+                                                  lda,
+                                                  dB.ptr_on_device(),
+                                                  ldb,
+                                                  &info,
+                                                  batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hB1.transfer_from(dB));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_potrs(arg.uplo, N, 1, hA[b], lda, hB[b], ldb);
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, 1, ldb, hB, hB1, batch_count);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasPotrsBatchedFn(handle,
+                                                      uplo,
+                                                      N,
+                                                      1,
+                                                      dA.ptr_on_device(),
+                                                      lda,
+                                                      dB.ptr_on_device(),
+                                                      ldb,
+                                                      &info,
+                                                      batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasPotrsBatchedModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               potrs_gflop_count<T>(N, 1),
+                                               ArgumentLogging::NA_value,
+                                               hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,322 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasPotrsStridedBatchedModel
+    = ArgumentModel<e_uplo, e_N, e_lda, e_ldb, e_stride_scale, e_batch_count>;
+
+inline void testname_potrs_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasPotrsStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t setup_potrs_strided_batched_testing(host_vector<T>&   hA,
+                                                           host_vector<T>&   hB,
+                                                           host_vector<T>&   hX,
+                                                           device_vector<T>& dA,
+                                                           device_vector<T>& dB,
+                                                           char              uplo,
+                                                           int               N,
+                                                           int               lda,
+                                                           int               ldb,
+                                                           hipblasStride     strideA,
+                                                           hipblasStride     strideB,
+                                                           int               batch_count)
+{
+    const size_t A_size = strideA * batch_count;
+    const size_t B_size = strideB * batch_count;
+
+    host_vector<T> hAAT(size_t(N) * lda);
+
+    // Initial hA, hB, hX on CPU
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        T* hXb = hX.data() + b * strideB;
+        T* hBb = hB.data() + b * strideB;
+
+        hipblas_init<T>(hAb, N, N, lda);
+        hipblas_init<T>(hXb, N, 1, ldb);
+        prepare_positive_definite(hAb, lda, hAAT.data(), N);
+
+        // Calculate hB = hA*hX;
+        cblas_gemm<T>(op, op, N, 1, N, (T)1, hAb, lda, hXb, ldb, (T)0, hBb, ldb);
+
+        // Cholesky factorize hA on the CPU
+        int info = cblas_potrf<T>(uplo, N, hAb, lda);
+        if(info != 0)
+        {
+            std::cerr << "Cholesky decomposition failed" << std::endl;
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_potrs_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasPotrsStridedBatchedFn
+        = arg.fortran ? hipblasPotrsStridedBatched<T, true> : hipblasPotrsStridedBatched<T, false>;
+
+    hipblasLocalHandle  handle(arg);
+    const int           N           = 100;
+    const int           nrhs        = 1;
+    const int           lda         = 101;
+    const int           ldb         = 102;
+    const int           batch_count = 2;
+    const hipblasStride strideA     = size_t(lda) * N;
+    const hipblasStride strideB     = size_t(ldb) * nrhs;
+    const size_t        A_size      = strideA * batch_count;
+    const size_t        B_size      = strideB * batch_count;
+
+    const hipblasFillMode_t uplo = HIPBLAS_FILL_MODE_UPPER;
+
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hX(B_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    int              info = 0;
+
+    // Need initialization code because even with bad params we call rocSOLVER
+    // so want to give reasonable data
+    EXPECT_HIPBLAS_STATUS(
+        setup_potrs_strided_batched_testing(
+            hA, hB, hX, dA, dB, 'U', N, lda, ldb, strideA, strideB, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, lda, strideA, dB, ldb, strideB, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasPotrsStridedBatchedFn(handle,
+                                                       HIPBLAS_FILL_MODE_FULL,
+                                                       N,
+                                                       nrhs,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dB,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, -1, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, -1, dA, lda, strideA, dB, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, nullptr, lda, strideA, dB, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, N - 1, strideA, dB, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, lda, strideA, nullptr, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-7, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, lda, strideA, dB, N - 1, strideB, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-11, info);
+
+    // If N == 0, A and B can be nullptr
+    EXPECT_HIPBLAS_STATUS(hipblasPotrsStridedBatchedFn(handle,
+                                                       uplo,
+                                                       0,
+                                                       nrhs,
+                                                       nullptr,
+                                                       lda,
+                                                       strideA,
+                                                       nullptr,
+                                                       ldb,
+                                                       strideB,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    // if nrhs == 0, B can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, 0, dA, lda, strideA, nullptr, ldb, strideB, &info, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_potrs_strided_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.fortran;
+    auto hipblasPotrsStridedBatchedFn
+        = FORTRAN ? hipblasPotrsStridedBatched<T, true> : hipblasPotrsStridedBatched<T, false>;
+
+    hipblasFillMode_t uplo         = char2hipblas_fill(arg.uplo);
+    int               N            = arg.N;
+    int               lda          = arg.lda;
+    int               ldb          = arg.ldb;
+    double            stride_scale = arg.stride_scale;
+    int               batch_count  = arg.batch_count;
+
+    hipblasStride strideA = size_t(lda) * N * stride_scale;
+    hipblasStride strideB = size_t(ldb) * 1 * stride_scale;
+    size_t        A_size  = strideA * batch_count;
+    size_t        B_size  = strideB * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hX(B_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB1(B_size);
+    int            info;
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(
+        setup_potrs_strided_batched_testing(
+            hA, hB, hX, dA, dB, arg.uplo, N, lda, ldb, strideA, strideB, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasPotrsStridedBatchedFn(
+            handle, uplo, N, 1, dA, lda, strideA, dB, ldb, strideB, &info, batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hB1, dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_potrs(
+                arg.uplo, N, 1, hA.data() + b * strideA, lda, hB.data() + b * strideB, ldb);
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, 1, ldb, strideB, hB, hB1, batch_count);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasPotrsStridedBatchedFn(
+                handle, uplo, N, 1, dA, lda, strideA, dB, ldb, strideB, &info, batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasPotrsStridedBatchedModel{}.log_args<T>(std::cout,
+                                                      arg,
+                                                      gpu_time_used,
+                                                      potrs_gflop_count<T>(N, 1),
+                                                      ArgumentLogging::NA_value,
+                                                      hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
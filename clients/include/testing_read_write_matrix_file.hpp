@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Writes batch_count matrices of the device to a temporary file with leading dimension ldb and
+// reads them back. The file is checked with pread and the device copy read back.
+template <typename T>
+inline hipblasStatus_t testing_read_write_matrix_file(const Arguments& arg)
+{
+    int rows        = arg.rows;
+    int cols        = arg.cols;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    double stride_scale = arg.stride_scale;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || ldc <= 0 || batch_count <= 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+#ifdef __linux__
+    hipblasStride stride_a = size_t(lda) * cols * stride_scale;
+    hipblasStride stride_b = size_t(ldb) * cols * stride_scale;
+    hipblasStride stride_c = size_t(ldc) * cols * stride_scale;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> ha(stride_a * batch_count);
+    host_vector<T> hb(stride_b * batch_count);
+    host_vector<T> hb_ref(stride_b * batch_count);
+    host_vector<T> hc(stride_c * batch_count);
+    host_vector<T> hc_ref(stride_c * batch_count);
+
+    device_vector<T> da(stride_c * batch_count);
+    device_vector<T> dc(stride_c * batch_count);
+
+    hipblasLocalHandle handle(arg);
+
+    hipStream_t stream;
+    hipblasGetStream(handle, &stream);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(ha, rows, cols, lda, stride_a, batch_count);
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < cols; j++)
+            for(int i = 0; i < rows; i++)
+            {
+                hb_ref[i + j * size_t(ldb) + b * stride_b] = ha[i + j * size_t(lda) + b * stride_a];
+                hc_ref[i + j * size_t(ldc) + b * stride_c] = ha[i + j * size_t(lda) + b * stride_a];
+            }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetMatrixStridedBatchedAsync(
+        rows, cols, sizeof(T), (T*)ha, lda, stride_a, (T*)da, ldc, stride_c, batch_count, stream));
+    CHECK_HIP_ERROR(hipMemset(dc, 0, sizeof(T) * stride_c * batch_count));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // The file is removed once it is closed
+    char name[] = "/tmp/hipblas_matrix_file_XXXXXX";
+    int  fd     = mkstemp(name);
+    if(fd < 0)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    unlink(name);
+
+    int64_t offset = 4 * sizeof(T);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWriteMatrixToFile(
+                              rows, cols, sizeof(T), da, ldc, stride_c, -1, 0, ldb, 0, 1, stream),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasReadMatrixFromFile(
+                              rows, cols, sizeof(T), fd, 0, rows - 1, 0, dc, ldc, 0, 1, stream),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    hipblasStatus_t status = hipblasWriteMatrixToFile(rows,
+                                                      cols,
+                                                      sizeof(T),
+                                                      (T*)da,
+                                                      ldc,
+                                                      stride_c,
+                                                      fd,
+                                                      offset,
+                                                      ldb,
+                                                      stride_b,
+                                                      batch_count,
+                                                      stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasReadMatrixFromFile(rows,
+                                           cols,
+                                           sizeof(T),
+                                           fd,
+                                           offset,
+                                           ldb,
+                                           stride_b,
+                                           (T*)dc,
+                                           ldc,
+                                           stride_c,
+                                           batch_count,
+                                           stream);
+
+    // The file holds the matrices written, up to the end of the last one
+    size_t  file_elements = rows && cols ? (batch_count - 1) * stride_b + (cols - 1) * size_t(ldb)
+                                              + rows
+                                         : 0;
+    char*   file_data     = reinterpret_cast<char*>((T*)hb);
+    size_t  file_bytes    = file_elements * sizeof(T);
+    ssize_t done          = 0;
+    while(status == HIPBLAS_STATUS_SUCCESS && file_bytes
+          && (done = pread(fd, file_data, file_bytes, offset)) > 0)
+    {
+        file_data += done;
+        file_bytes -= done;
+        offset += done;
+    }
+    close(fd);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    EXPECT_EQ(file_bytes, size_t(0));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hc, dc, sizeof(T) * stride_c * batch_count, hipMemcpyDeviceToHost));
+
+    if(arg.unit_check)
+    {
+        unit_check_general<T>(rows, cols, batch_count, ldb, stride_b, hb, hb_ref);
+        unit_check_general<T>(rows, cols, batch_count, ldc, stride_c, hc, hc_ref);
+    }
+#endif
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
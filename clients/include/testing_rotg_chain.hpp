@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasRotgChainModel = ArgumentModel<e_N, e_M, e_lda, e_incx, e_batch_count>;
+
+inline void testname_rotg_chain(const Arguments& arg, std::string& name)
+{
+    hipblasRotgChainModel{}.test_name(arg, name);
+}
+
+template <typename T>
+struct hipblas_rotg_chain_functions;
+
+template <>
+struct hipblas_rotg_chain_functions<float>
+{
+    static constexpr auto rotgChain               = hipblasSrotgChain;
+    static constexpr auto rotgChainBatched        = hipblasSrotgChainBatched;
+    static constexpr auto rotgChainStridedBatched = hipblasSrotgChainStridedBatched;
+};
+
+template <>
+struct hipblas_rotg_chain_functions<double>
+{
+    static constexpr auto rotgChain               = hipblasDrotgChain;
+    static constexpr auto rotgChainBatched        = hipblasDrotgChainBatched;
+    static constexpr auto rotgChainStridedBatched = hipblasDrotgChainStridedBatched;
+};
+
+template <>
+struct hipblas_rotg_chain_functions<hipblasComplex>
+{
+    static constexpr auto rotgChain               = hipblasCrotgChain;
+    static constexpr auto rotgChainBatched        = hipblasCrotgChainBatched;
+    static constexpr auto rotgChainStridedBatched = hipblasCrotgChainStridedBatched;
+};
+
+template <>
+struct hipblas_rotg_chain_functions<hipblasDoubleComplex>
+{
+    static constexpr auto rotgChain               = hipblasZrotgChain;
+    static constexpr auto rotgChainBatched        = hipblasZrotgChainBatched;
+    static constexpr auto rotgChainStridedBatched = hipblasZrotgChainStridedBatched;
+};
+
+// Checks every form against rotg and rot of each rotation in turn on the CPU, with N rotations of
+// the N x M matrices A and the vectors x of M elements
+template <typename T>
+inline hipblasStatus_t testing_rotg_chain(const Arguments& arg)
+{
+    using F = hipblas_rotg_chain_functions<T>;
+    using U = real_t<T>;
+
+    int N           = arg.N;
+    int M           = arg.M;
+    int lda         = arg.lda;
+    int incx        = arg.incx;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    if(N < 0 || M < N || lda < std::max(1, N) || incx <= 0 || batch_count < 0)
+    {
+        return F::rotgChainStridedBatched(
+            handle, N, M, nullptr, lda, 0, nullptr, incx, 0, nullptr, 0, nullptr, 0, batch_count);
+    }
+
+    const hipblasStride stride_A = hipblasStride(lda) * M;
+    const hipblasStride stride_x = hipblasStride(incx) * M;
+    const hipblasStride stride_c = N;
+
+    // The plain form runs on the first instance even when batch_count is 0
+    const int    batches = std::max(batch_count, 1);
+    const size_t size_A  = std::max(stride_A * batches, hipblasStride(1));
+    const size_t size_x  = std::max(stride_x * batches, hipblasStride(1));
+    const size_t size_c  = std::max(stride_c * batches, hipblasStride(1));
+
+    host_vector<T> hA(size_A);
+    host_vector<T> hx(size_x);
+    host_vector<T> hA_gold(size_A);
+    host_vector<T> hx_gold(size_x);
+    host_vector<U> hc_gold(size_c);
+    host_vector<T> hs_gold(size_c);
+    host_vector<T> hA_out(size_A);
+    host_vector<T> hx_out(size_x);
+    host_vector<U> hc_out(size_c);
+    host_vector<T> hs_out(size_c);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx(size_x);
+    device_vector<U> dc(size_c);
+    device_vector<T> ds(size_c);
+
+    srand(1);
+    hipblas_init<T>(hA);
+    hipblas_init<T>(hx);
+
+    hA_gold = hA;
+    hx_gold = hx;
+    for(int b = 0; b < batches; b++)
+    {
+        for(int k = 0; k < N; k++)
+        {
+            T* row = hA_gold.data() + b * stride_A + k + size_t(k) * lda;
+            T* x_k = hx_gold.data() + b * stride_x + size_t(k) * incx;
+            U* c_k = hc_gold.data() + b * stride_c + k;
+            T* s_k = hs_gold.data() + b * stride_c + k;
+            cblas_rotg<T, U>(row, x_k, c_k, s_k);
+            if(k + 1 < M)
+                cblas_rot<T, U>(M - k - 1, row + lda, lda, x_k + incx, incx, *c_k, *s_k);
+        }
+    }
+
+    U      eps       = std::numeric_limits<U>::epsilon();
+    double tolerance = eps * 40 * std::max(M, 1);
+
+    // Compares the batch_check first instances of the outputs with the gold
+    auto check = [&](int batch_check) {
+        if(!arg.unit_check || !N)
+            return;
+        unit_check_error(
+            norm_check_general<T>('F', lda, M, lda, stride_A, hA_gold, hA_out, batch_check),
+            tolerance);
+        unit_check_error(
+            norm_check_general<T>('F', 1, M, incx, stride_x, hx_gold, hx_out, batch_check),
+            tolerance);
+        unit_check_error(
+            norm_check_general<U>('F', 1, N, 1, stride_c, hc_gold, hc_out, batch_check),
+            tolerance);
+        unit_check_error(
+            norm_check_general<T>('F', 1, N, 1, stride_c, hs_gold, hs_out, batch_check),
+            tolerance);
+    };
+
+    auto run = [&](auto fn, int batch_check) {
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * size_x, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(fn());
+        CHECK_HIP_ERROR(hipMemcpy(hA_out, dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hx_out, dx, sizeof(T) * size_x, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hc_out, dc, sizeof(U) * size_c, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hs_out, ds, sizeof(T) * size_c, hipMemcpyDeviceToHost));
+        check(batch_check);
+        return HIPBLAS_STATUS_SUCCESS;
+    };
+
+    // c and s are on the device whatever the pointer mode
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(run([&]() { return F::rotgChain(handle, N, M, dA, lda, dx, incx, dc, ds); },
+                            std::min(batch_count, 1)));
+    CHECK_HIPBLAS_ERROR(run(
+        [&]() {
+            return F::rotgChainStridedBatched(handle,
+                                              N,
+                                              M,
+                                              dA,
+                                              lda,
+                                              stride_A,
+                                              dx,
+                                              incx,
+                                              stride_x,
+                                              dc,
+                                              stride_c,
+                                              ds,
+                                              stride_c,
+                                              batch_count);
+        },
+        batch_count));
+
+    // The batched form runs on copies of the instances in batch vectors
+    host_batch_vector<T>   hA_batch(stride_A, 1, batch_count);
+    host_batch_vector<T>   hx_batch(stride_x, 1, batch_count);
+    host_batch_vector<U>   hc_batch(std::max(N, 1), 1, batch_count);
+    host_batch_vector<T>   hs_batch(std::max(N, 1), 1, batch_count);
+    device_batch_vector<T> dA_batch(stride_A, 1, batch_count);
+    device_batch_vector<T> dx_batch(stride_x, 1, batch_count);
+    device_batch_vector<U> dc_batch(std::max(N, 1), 1, batch_count);
+    device_batch_vector<T> ds_batch(std::max(N, 1), 1, batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        std::copy(hA.data() + b * stride_A, hA.data() + (b + 1) * stride_A, hA_batch[b]);
+        std::copy(hx.data() + b * stride_x, hx.data() + (b + 1) * stride_x, hx_batch[b]);
+    }
+    CHECK_HIP_ERROR(dA_batch.transfer_from(hA_batch));
+    CHECK_HIP_ERROR(dx_batch.transfer_from(hx_batch));
+    CHECK_HIPBLAS_ERROR(F::rotgChainBatched(handle,
+                                            N,
+                                            M,
+                                            dA_batch.ptr_on_device(),
+                                            lda,
+                                            dx_batch.ptr_on_device(),
+                                            incx,
+                                            dc_batch.ptr_on_device(),
+                                            ds_batch.ptr_on_device(),
+                                            batch_count));
+    CHECK_HIP_ERROR(hA_batch.transfer_from(dA_batch));
+    CHECK_HIP_ERROR(hx_batch.transfer_from(dx_batch));
+    CHECK_HIP_ERROR(hc_batch.transfer_from(dc_batch));
+    CHECK_HIP_ERROR(hs_batch.transfer_from(ds_batch));
+    for(int b = 0; b < batch_count; b++)
+    {
+        std::copy(hA_batch[b], hA_batch[b] + stride_A, hA_out.data() + b * stride_A);
+        std::copy(hx_batch[b], hx_batch[b] + stride_x, hx_out.data() + b * stride_x);
+        std::copy(hc_batch[b], hc_batch[b] + N, hc_out.data() + b * stride_c);
+        std::copy(hs_batch[b], hs_batch[b] + N, hs_out.data() + b * stride_c);
+    }
+    check(batch_count);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
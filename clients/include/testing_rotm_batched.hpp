@@ -153,11 +153,14 @@ inline hipblasStatus_t testing_rotm_batched(const Arguments& arg)
         CHECK_HIP_ERROR(dy.transfer_from(hy));
         CHECK_HIP_ERROR(dparam.transfer_from(hparam));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasRotmBatchedFn(handle,
                                                      N,
@@ -168,6 +171,7 @@ inline hipblasStatus_t testing_rotm_batched(const Arguments& arg)
                                                      dparam.ptr_on_device(),
                                                      batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasRotmBatchedModel{}.log_args<T>(std::cout,
@@ -181,11 +181,14 @@ inline hipblasStatus_t testing_rotm_strided_batched(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * size_y, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(dparam, hparam, sizeof(T) * size_param, hipMemcpyHostToDevice));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR((hipblasRotmStridedBatchedFn(handle,
                                                              N,
@@ -199,6 +202,7 @@ inline hipblasStatus_t testing_rotm_strided_batched(const Arguments& arg)
                                                              stride_param,
                                                              batch_count)));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasRotmStridedBatchedModel{}.log_args<T>(std::cout,
@@ -182,11 +182,14 @@ inline hipblasStatus_t testing_rotmg_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasRotmgBatchedFn(handle,
                                                       dd1.ptr_on_device(),
@@ -196,6 +199,7 @@ inline hipblasStatus_t testing_rotmg_batched(const Arguments& arg)
                                                       dparams.ptr_on_device(),
                                                       batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasRotmgBatchedModel{}.log_args<T>(std::cout,
@@ -153,11 +153,14 @@ inline hipblasStatus_t testing_scal_strided_batched_ex_template(const Arguments&
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasScalStridedBatchedExFn(handle,
                                                               N,
@@ -170,6 +173,7 @@ inline hipblasStatus_t testing_scal_strided_batched_ex_template(const Arguments&
                                                               batch_count,
                                                               executionType));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasScalStridedBatchedExModel{}.log_args<Tx>(std::cout,
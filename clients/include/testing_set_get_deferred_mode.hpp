@@ -0,0 +1,255 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_deferred_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_deferred_mode(const Arguments& arg)
+{
+    hipblasDeferredMode_t mode;
+    hipblasLocalHandle    handle(arg);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetDeferredMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_DEFERRED_MODE_OFF, mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetDeferredMode(handle, HIPBLAS_DEFERRED_MODE_ON));
+    CHECK_HIPBLAS_ERROR(hipblasGetDeferredMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_DEFERRED_MODE_ON, mode);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetDeferredMode(handle, hipblasDeferredMode_t(3)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetDeferredMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasFlush(handle));
+
+    // B independent axpy and gemv calls on slices of one buffer, which are batched, then axpy
+    // calls on the first y, which must run after those queued before them. The inputs are small
+    // integers, so every sum is exact and the results match.
+    const int M = 33, N = 17, B = 12;
+    float     alpha = 2.0f, beta = 3.0f;
+
+    host_vector<float> hA(size_t(M) * N * B);
+    host_vector<float> hx(size_t(N) * B);
+    host_vector<float> hy(size_t(M) * B);
+    host_vector<float> hy_init(size_t(M) * B);
+    host_vector<float> hy_gold(size_t(M) * B);
+
+    device_vector<float> dA(size_t(M) * N * B);
+    device_vector<float> dx(size_t(N) * B);
+    device_vector<float> dy(size_t(M) * B);
+    device_vector<float> d_alpha(1), d_beta(1);
+
+    hipblas_init_matrix(hA, arg, M, N * B, M, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hx, arg, N * B, 1, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_vector(hy_init, arg, M * B, 1, 0, 1, hipblas_client_never_set_nan);
+
+    hy_gold = hy_init;
+    for(int b = 0; b < B; b++)
+        cblas_gemv<float>(HIPBLAS_OP_N,
+                          M,
+                          N,
+                          alpha,
+                          hA.data() + size_t(M) * N * b,
+                          M,
+                          hx.data() + N * b,
+                          1,
+                          beta,
+                          hy_gold.data() + M * b,
+                          1);
+    for(int b = 0; b < B; b++)
+        cblas_axpy<float>(N, alpha, hx.data() + N * b, 1, hy_gold.data() + M * b, 1);
+    for(int b = 1; b < B; b++)
+        cblas_axpy<float>(N, alpha, hx.data() + N * b, 1, hy_gold.data(), 1);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M * N * B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N * B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+    for(bool device_scalars : {false, true})
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+            handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+        const float* a = device_scalars ? (float*)d_alpha : &alpha;
+        const float* c = device_scalars ? (float*)d_beta : &beta;
+
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy_init, sizeof(float) * M * B, hipMemcpyHostToDevice));
+        for(int b = 0; b < B; b++)
+            CHECK_HIPBLAS_ERROR(hipblasSgemv(handle,
+                                             HIPBLAS_OP_N,
+                                             M,
+                                             N,
+                                             a,
+                                             dA + size_t(M) * N * b,
+                                             M,
+                                             dx + N * b,
+                                             1,
+                                             c,
+                                             dy + M * b,
+                                             1));
+        for(int b = 0; b < B; b++)
+            CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, a, dx + N * b, 1, dy + M * b, 1));
+        for(int b = 1; b < B; b++)
+            CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, a, dx + N * b, 1, dy, 1));
+        CHECK_HIPBLAS_ERROR(hipblasFlush(handle));
+        CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(float) * M * B, hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+            unit_check_general<float>(M, B, M, hy_gold.data(), hy.data());
+    }
+
+    // B ger calls updating the first A, which run as one rank-B gemm
+    host_vector<float> hA_gold(hA);
+    host_vector<float> hA_result(size_t(M) * N);
+    for(int b = 0; b < B; b++)
+        cblas_ger<float>(
+            M, N, alpha, hy_init.data() + M * b, 1, hx.data() + N * b, 1, hA_gold.data(), M);
+
+    for(bool device_scalars : {false, true})
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+            handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+        const float* a = device_scalars ? (float*)d_alpha : &alpha;
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M * N, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy_init, sizeof(float) * M * B, hipMemcpyHostToDevice));
+        for(int b = 0; b < B; b++)
+            CHECK_HIPBLAS_ERROR(hipblasSger(handle, M, N, a, dy + M * b, 1, dx + N * b, 1, dA, M));
+        CHECK_HIPBLAS_ERROR(hipblasFlush(handle));
+        CHECK_HIP_ERROR(hipMemcpy(hA_result, dA, sizeof(float) * M * N, hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+            unit_check_general<float>(M, N, M, hA_gold.data(), hA_result.data());
+    }
+
+    // In HIPBLAS_DEFERRED_MODE_PERSISTENT, a gemm, a gemv reading its result, an axpy and a trsv
+    // in place, each small, are posted to the persistent kernel, which runs them in order. The
+    // triangular matrix has ones below the diagonal, so the solve is exact too. Without
+    // BUILD_WITH_PERSISTENT the mode is not supported, with it the mode must be set.
+    hipblasStatus_t persistent_status
+        = hipblasSetDeferredMode(handle, HIPBLAS_DEFERRED_MODE_PERSISTENT);
+#ifdef HIPBLAS_PERSISTENT
+    CHECK_HIPBLAS_ERROR(persistent_status);
+#endif
+    if(persistent_status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        CHECK_HIPBLAS_ERROR(persistent_status);
+        CHECK_HIPBLAS_ERROR(hipblasGetDeferredMode(handle, &mode));
+        EXPECT_EQ(HIPBLAS_DEFERRED_MODE_PERSISTENT, mode);
+
+        const int          P = 8;
+        host_vector<float> hC(size_t(P) * P);
+        host_vector<float> hC_init(size_t(P) * P);
+        host_vector<float> hC_gold(size_t(P) * P);
+        host_vector<float> hL(size_t(P) * P);
+
+        device_vector<float> dC(size_t(P) * P);
+        device_vector<float> dL(size_t(P) * P);
+
+        hipblas_init_matrix(hC_init, arg, P, P, P, 0, 1, hipblas_client_never_set_nan);
+        for(int j = 0; j < P; j++)
+            for(int i = 0; i < P; i++)
+                hL[i + size_t(P) * j] = i == j + 1 ? 1.0f : i < j ? 7.0f : 0.0f;
+
+        hC_gold = hC_init;
+        hy_gold = hy_init;
+        cblas_gemm<float>(HIPBLAS_OP_N,
+                          HIPBLAS_OP_N,
+                          P,
+                          P,
+                          P,
+                          alpha,
+                          hA.data(),
+                          M,
+                          hA.data() + size_t(M) * N,
+                          M,
+                          beta,
+                          hC_gold.data(),
+                          P);
+        cblas_gemv<float>(
+            HIPBLAS_OP_N, P, P, alpha, hC_gold.data(), P, hx.data(), 1, beta, hy_gold.data(), 1);
+        cblas_axpy<float>(P, alpha, hx.data(), 1, hy_gold.data(), 1);
+        for(int i = 1; i < P; i++)
+            hy_gold[i] -= hy_gold[i - 1];
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M * N * B, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dL, hL, sizeof(float) * P * P, hipMemcpyHostToDevice));
+
+        for(bool device_scalars : {false, true})
+        {
+            // The second pass runs on a new persistent kernel, started after
+            // HIPBLAS_DEFERRED_MODE_ON stopped the first
+            if(device_scalars)
+            {
+                CHECK_HIPBLAS_ERROR(hipblasSetDeferredMode(handle, HIPBLAS_DEFERRED_MODE_ON));
+                CHECK_HIPBLAS_ERROR(hipblasGetDeferredMode(handle, &mode));
+                EXPECT_EQ(HIPBLAS_DEFERRED_MODE_ON, mode);
+                CHECK_HIPBLAS_ERROR(
+                    hipblasSetDeferredMode(handle, HIPBLAS_DEFERRED_MODE_PERSISTENT));
+                CHECK_HIPBLAS_ERROR(hipblasGetDeferredMode(handle, &mode));
+                EXPECT_EQ(HIPBLAS_DEFERRED_MODE_PERSISTENT, mode);
+            }
+
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+                handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+            const float* a = device_scalars ? (float*)d_alpha : &alpha;
+            const float* c = device_scalars ? (float*)d_beta : &beta;
+
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(float) * P * P, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy_init, sizeof(float) * P, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasSgemm(
+                handle, HIPBLAS_OP_N, HIPBLAS_OP_N, P, P, P, a, dA, M, dA + M * N, M, c, dC, P));
+            CHECK_HIPBLAS_ERROR(
+                hipblasSgemv(handle, HIPBLAS_OP_N, P, P, a, dC, P, dx, 1, c, dy, 1));
+            CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, P, a, dx, 1, dy, 1));
+            CHECK_HIPBLAS_ERROR(hipblasStrsv(
+                handle, HIPBLAS_FILL_MODE_LOWER, HIPBLAS_OP_N, HIPBLAS_DIAG_UNIT, P, dL, P, dy, 1));
+            CHECK_HIPBLAS_ERROR(hipblasFlush(handle));
+            CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * P * P, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(float) * P, hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<float>(P, P, P, hC_gold.data(), hC.data());
+                unit_check_general<float>(P, 1, P, hy_gold.data(), hy.data());
+            }
+        }
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetDeferredMode(handle, HIPBLAS_DEFERRED_MODE_OFF));
+    CHECK_HIPBLAS_ERROR(hipblasGetDeferredMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_DEFERRED_MODE_OFF, mode);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
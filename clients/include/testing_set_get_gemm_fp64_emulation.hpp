@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_gemm_fp64_emulation(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_gemm_fp64_emulation(const Arguments& arg)
+{
+    hipblasGemmFp64EmulationMode_t mode;
+    int                            slices;
+    hipblasLocalHandle             handle(arg);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmFp64Emulation(handle, &mode, &slices));
+    EXPECT_EQ(HIPBLAS_GEMM_FP64_EMULATION_OFF, mode);
+    EXPECT_EQ(0, slices);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSetGemmFp64Emulation(handle, hipblasGemmFp64EmulationMode_t(2), 8),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmFp64Emulation(handle, HIPBLAS_GEMM_FP64_EMULATION_INT8, 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmFp64Emulation(handle, HIPBLAS_GEMM_FP64_EMULATION_INT8, 17),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetGemmFp64Emulation(handle, nullptr, &slices),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Without BUILD_WITH_GEMM_FP64_EMULATION only the off mode is accepted, with it the int8 mode
+    // must be set
+    hipblasStatus_t status
+        = hipblasSetGemmFp64Emulation(handle, HIPBLAS_GEMM_FP64_EMULATION_INT8, 8);
+#ifndef HIPBLAS_GEMM_FP64_EMULATION
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasGetGemmFp64Emulation(handle, &mode, &slices));
+        EXPECT_EQ(HIPBLAS_GEMM_FP64_EMULATION_OFF, mode);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+#endif
+    CHECK_HIPBLAS_ERROR(status);
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmFp64Emulation(handle, &mode, &slices));
+    EXPECT_EQ(HIPBLAS_GEMM_FP64_EMULATION_INT8, mode);
+    EXPECT_EQ(8, slices);
+
+    // Eight slices keep 56 bits of every element, so the emulated product of random doubles is
+    // within a few ulps of native fp64 times the growth of the sums.
+    const int M = 67, N = 45, K = 300;
+    double    alpha = 1.5, beta = -0.5;
+
+    host_vector<double> hA(size_t(K) * M);
+    host_vector<double> hB(size_t(K) * N);
+    host_vector<double> hC(size_t(M) * N);
+    host_vector<double> hC_init(size_t(M) * N);
+    host_vector<double> hC_gold(size_t(M) * N);
+
+    device_vector<double> dA(size_t(K) * M);
+    device_vector<double> dB(size_t(K) * N);
+    device_vector<double> dC(size_t(M) * N);
+
+    hipblas_init_matrix(hA, arg, K, M, K, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_matrix(hC_init, arg, M, N, M, 0, 1, hipblas_client_never_set_nan);
+
+    hC_gold = hC_init;
+    cblas_gemm<double>(HIPBLAS_OP_T,
+                       HIPBLAS_OP_N,
+                       M,
+                       N,
+                       K,
+                       alpha,
+                       hA.data(),
+                       K,
+                       hB.data(),
+                       K,
+                       beta,
+                       hC_gold.data(),
+                       M);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(double) * K * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(double) * K * N, hipMemcpyHostToDevice));
+
+    double tolerance = std::numeric_limits<double>::epsilon() * 40 * K;
+    for(int form = 0; form < 2; form++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(double) * M * N, hipMemcpyHostToDevice));
+        if(form == 0)
+            CHECK_HIPBLAS_ERROR(hipblasDgemm(
+                handle, HIPBLAS_OP_T, HIPBLAS_OP_N, M, N, K, &alpha, dA, K, dB, K, &beta, dC, M));
+        else
+            CHECK_HIPBLAS_ERROR(hipblasGemmEx_v2(handle,
+                                                 HIPBLAS_OP_T,
+                                                 HIPBLAS_OP_N,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 &alpha,
+                                                 dA,
+                                                 HIP_R_64F,
+                                                 K,
+                                                 dB,
+                                                 HIP_R_64F,
+                                                 K,
+                                                 &beta,
+                                                 dC,
+                                                 HIP_R_64F,
+                                                 M,
+                                                 HIPBLAS_COMPUTE_64F,
+                                                 HIPBLAS_GEMM_DEFAULT));
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(double) * M * N, hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+            unit_check_error(norm_check_general<double>('F', M, N, M, hC_gold, hC), tolerance);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmFp64Emulation(handle, HIPBLAS_GEMM_FP64_EMULATION_OFF, 0));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmFp64Emulation(handle, &mode, &slices));
+    EXPECT_EQ(HIPBLAS_GEMM_FP64_EMULATION_OFF, mode);
+    EXPECT_EQ(0, slices);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
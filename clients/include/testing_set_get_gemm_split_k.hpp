@@ -0,0 +1,227 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_gemm_split_k(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_gemm_split_k(const Arguments& arg)
+{
+    hipblasGemmSplitKMode_t mode;
+    int                     factor;
+    hipblasLocalHandle      handle(arg);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmSplitK(handle, &mode, &factor));
+    EXPECT_EQ(HIPBLAS_GEMM_SPLIT_K_AUTO, mode);
+    EXPECT_EQ(0, factor);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmSplitK(handle, HIPBLAS_GEMM_SPLIT_K_ON, 5));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmSplitK(handle, &mode, &factor));
+    EXPECT_EQ(HIPBLAS_GEMM_SPLIT_K_ON, mode);
+    EXPECT_EQ(5, factor);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmSplitK(handle, HIPBLAS_GEMM_SPLIT_K_OFF, 5));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmSplitK(handle, &mode, &factor));
+    EXPECT_EQ(HIPBLAS_GEMM_SPLIT_K_OFF, mode);
+    EXPECT_EQ(0, factor);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmSplitK(handle, hipblasGemmSplitKMode_t(3), 0),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmSplitK(handle, HIPBLAS_GEMM_SPLIT_K_ON, 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmSplitK(handle, HIPBLAS_GEMM_SPLIT_K_ON, 65),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetGemmSplitK(handle, nullptr, &factor),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A skinny problem whose k is not a multiple of the slices, split by every mode but the
+    // last. The inputs are small integers, so every sum is exact and the results match.
+    const int M = 40, N = 24, K = 20011;
+    float     alpha = 2.0f, beta = 3.0f;
+
+    host_vector<float> hA(size_t(M) * K);
+    host_vector<float> hB(size_t(K) * N);
+    host_vector<float> hC(size_t(M) * N);
+    host_vector<float> hC_init(size_t(M) * N);
+    host_vector<float> hC_gold(size_t(M) * N);
+
+    device_vector<float> dA(size_t(M) * K);
+    device_vector<float> dB(size_t(K) * N);
+    device_vector<float> dC(size_t(M) * N);
+    device_vector<float> d_alpha(1), d_beta(1);
+
+    hipblas_init_matrix(hA, arg, M, K, M, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_matrix(hC_init, arg, M, N, M, 0, 1, hipblas_client_never_set_nan);
+
+    hC_gold = hC_init;
+    cblas_gemm<float, float, float>(HIPBLAS_OP_N,
+                                    HIPBLAS_OP_N,
+                                    M,
+                                    N,
+                                    K,
+                                    alpha,
+                                    hA.data(),
+                                    M,
+                                    hB.data(),
+                                    K,
+                                    beta,
+                                    hC_gold.data(),
+                                    M);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * K * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+    const hipblasGemmSplitKMode_t modes[]   = {HIPBLAS_GEMM_SPLIT_K_ON,
+                                               HIPBLAS_GEMM_SPLIT_K_ON,
+                                               HIPBLAS_GEMM_SPLIT_K_AUTO,
+                                               HIPBLAS_GEMM_SPLIT_K_OFF};
+    const int                     factors[] = {5, 64, 0, 0};
+
+    for(int i = 0; i < 4; i++)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetGemmSplitK(handle, modes[i], factors[i]));
+        for(bool device_scalars : {false, true})
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+                handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(float) * M * N, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasGemmEx_v2(handle,
+                                                 HIPBLAS_OP_N,
+                                                 HIPBLAS_OP_N,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 device_scalars ? (float*)d_alpha : &alpha,
+                                                 dA,
+                                                 HIP_R_32F,
+                                                 M,
+                                                 dB,
+                                                 HIP_R_32F,
+                                                 K,
+                                                 device_scalars ? (float*)d_beta : &beta,
+                                                 dC,
+                                                 HIP_R_32F,
+                                                 M,
+                                                 HIPBLAS_COMPUTE_32F,
+                                                 HIPBLAS_GEMM_DEFAULT));
+            CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * M * N, hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+                unit_check_general<float>(M, N, M, hC_gold.data(), hC.data());
+        }
+    }
+
+    // The Gram matrices of a tall and skinny matrix, A**T * A with syrk and B * B**H with herk,
+    // split by every mode but the last. Only their triangle of C is written.
+    const int          n = N, k = K;
+    host_vector<float> hG(size_t(n) * n), hG_init(size_t(n) * n), hG_gold(size_t(n) * n);
+    host_vector<hipblasComplex> hZ(size_t(n) * k), hH(size_t(n) * n), hH_init(size_t(n) * n),
+        hH_gold(size_t(n) * n);
+    device_vector<float>          dG(size_t(n) * n);
+    device_vector<hipblasComplex> dZ(size_t(n) * k), dH(size_t(n) * n);
+
+    hipblas_init_matrix(hZ, arg, n, k, n, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hG_init, arg, n, n, n, 0, 1, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hH_init, arg, n, n, n, 0, 1, hipblas_client_never_set_nan);
+
+    // A is the first n columns of the k by M matrix B
+    hG_gold = hG_init;
+    hH_gold = hH_init;
+    cblas_syrk<float>(
+        HIPBLAS_FILL_MODE_UPPER, HIPBLAS_OP_T, n, k, alpha, hB.data(), K, beta, hG_gold.data(), n);
+    cblas_herk<hipblasComplex, float>(HIPBLAS_FILL_MODE_LOWER,
+                                      HIPBLAS_OP_N,
+                                      n,
+                                      k,
+                                      alpha,
+                                      hZ.data(),
+                                      n,
+                                      beta,
+                                      hH_gold.data(),
+                                      n);
+
+    CHECK_HIP_ERROR(hipMemcpy(dZ, hZ, sizeof(hipblasComplex) * n * k, hipMemcpyHostToDevice));
+
+    for(int i = 0; i < 4; i++)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetGemmSplitK(handle, modes[i], factors[i]));
+        for(bool device_scalars : {false, true})
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+                handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+            const float* p_alpha = device_scalars ? (const float*)d_alpha : &alpha;
+            const float* p_beta  = device_scalars ? (const float*)d_beta : &beta;
+
+            CHECK_HIP_ERROR(hipMemcpy(dG, hG_init, sizeof(float) * n * n, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(
+                hipMemcpy(dH, hH_init, sizeof(hipblasComplex) * n * n, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasSsyrk(handle,
+                                             HIPBLAS_FILL_MODE_UPPER,
+                                             HIPBLAS_OP_T,
+                                             n,
+                                             k,
+                                             p_alpha,
+                                             dB,
+                                             K,
+                                             p_beta,
+                                             dG,
+                                             n));
+            CHECK_HIPBLAS_ERROR(hipblasCherk(handle,
+                                             HIPBLAS_FILL_MODE_LOWER,
+                                             HIPBLAS_OP_N,
+                                             n,
+                                             k,
+                                             p_alpha,
+                                             dZ,
+                                             n,
+                                             p_beta,
+                                             dH,
+                                             n));
+            CHECK_HIP_ERROR(hipMemcpy(hG, dG, sizeof(float) * n * n, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hH, dH, sizeof(hipblasComplex) * n * n, hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<float>(n, n, n, hG_gold.data(), hG.data());
+                unit_check_general<hipblasComplex>(n, n, n, hH_gold.data(), hH.data());
+            }
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
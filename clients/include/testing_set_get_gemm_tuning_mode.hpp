@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_gemm_tuning_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_gemm_tuning_mode(const Arguments& arg)
+{
+    hipblasGemmTuningMode_t mode;
+    hipblasLocalHandle      handle(arg);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmTuningMode(handle, HIPBLAS_GEMM_TUNING_OFF));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmTuningMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_GEMM_TUNING_OFF, mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmTuningMode(handle, HIPBLAS_GEMM_TUNING_ON));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmTuningMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_GEMM_TUNING_ON, mode);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmTuningMode(handle, hipblasGemmTuningMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetGemmTuningMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // The first call tunes the problem and the second uses the stored solution; both must
+    // leave the same result as the reference in C
+    const int M = 128, N = 96, K = 64;
+    float     alpha = 1.0f, beta = 2.0f;
+
+    host_vector<float> hA(size_t(M) * K);
+    host_vector<float> hB(size_t(K) * N);
+    host_vector<float> hC(size_t(M) * N);
+    host_vector<float> hC_init(size_t(M) * N);
+    host_vector<float> hC_gold(size_t(M) * N);
+
+    device_vector<float> dA(size_t(M) * K);
+    device_vector<float> dB(size_t(K) * N);
+    device_vector<float> dC(size_t(M) * N);
+
+    hipblas_init_matrix(hA, arg, M, K, M, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_matrix(hC_init, arg, M, N, M, 0, 1, hipblas_client_never_set_nan);
+
+    hC_gold = hC_init;
+    cblas_gemm<float, float, float>(HIPBLAS_OP_N,
+                                    HIPBLAS_OP_N,
+                                    M,
+                                    N,
+                                    K,
+                                    alpha,
+                                    hA.data(),
+                                    M,
+                                    hB.data(),
+                                    K,
+                                    beta,
+                                    hC_gold.data(),
+                                    M);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * K * N, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    for(int call = 0; call < 2; call++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(float) * M * N, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasGemmEx_v2(handle,
+                                             HIPBLAS_OP_N,
+                                             HIPBLAS_OP_N,
+                                             M,
+                                             N,
+                                             K,
+                                             &alpha,
+                                             dA,
+                                             HIP_R_32F,
+                                             M,
+                                             dB,
+                                             HIP_R_32F,
+                                             K,
+                                             &beta,
+                                             dC,
+                                             HIP_R_32F,
+                                             M,
+                                             HIPBLAS_COMPUTE_32F,
+                                             HIPBLAS_GEMM_DEFAULT));
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * M * N, hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+            unit_check_general<float>(M, N, M, hC_gold.data(), hC.data());
+    }
+
+    // gemv is tuned per shape bucket the same way; the first column of B and C act as x and y
+    host_vector<float> hy_gold(M);
+    host_vector<float> hy(M);
+    for(int i = 0; i < M; i++)
+        hy_gold[i] = hC_init[i];
+    cblas_gemv<float>(
+        HIPBLAS_OP_N, M, K, alpha, hA.data(), M, hB.data(), 1, beta, hy_gold.data(), 1);
+
+    for(int call = 0; call < 2; call++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_init, sizeof(float) * M, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(
+            hipblasSgemv(handle, HIPBLAS_OP_N, M, K, &alpha, dA, M, dB, 1, &beta, dC, 1));
+        CHECK_HIP_ERROR(hipMemcpy(hy, dC, sizeof(float) * M, hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+            unit_check_general<float>(1, M, 1, hy_gold.data(), hy.data());
+    }
+
+    // The table round-trips through a file
+    const char* path = "hipblas_gemm_tuning_test.txt";
+    CHECK_HIPBLAS_ERROR(hipblasSaveGemmTuning(path));
+    CHECK_HIPBLAS_ERROR(hipblasLoadGemmTuning(path));
+
+    // A tuning profile keeps a section per architecture and backend version, of which only those
+    // of the current device apply, and is never written over another file
+    const char* profile = "hipblas_tuning_profile_test.txt";
+    std::remove(profile);
+    CHECK_HIPBLAS_ERROR(hipblasExportTuningProfile(profile));
+    CHECK_HIPBLAS_ERROR(hipblasImportTuningProfile(profile));
+    EXPECT_HIPBLAS_STATUS(hipblasExportTuningProfile(path), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasImportTuningProfile(path), HIPBLAS_STATUS_INVALID_VALUE);
+    std::remove(path);
+
+    int             device;
+    hipDeviceProp_t prop;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&prop, device));
+    std::string arch = prop.gcnArchName;
+    if(arch.empty())
+        arch = "sm_" + std::to_string(prop.major) + std::to_string(prop.minor);
+
+    {
+        std::ofstream file(profile, std::ios::app);
+        file << "arch not_a_device other_backend\nsplit_k 2 8\n"
+             << "arch " << arch << " other_backend\nsplit_k 2 4\nnot_a_setting 1\n";
+    }
+    CHECK_HIPBLAS_ERROR(hipblasImportTuningProfile(profile));
+
+    hipblasGemmSplitKMode_t split_k_mode;
+    int                     split_k_factor;
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmSplitK(handle, &split_k_mode, &split_k_factor));
+    EXPECT_EQ(HIPBLAS_GEMM_SPLIT_K_ON, split_k_mode);
+    EXPECT_EQ(4, split_k_factor);
+
+    {
+        std::ofstream file(profile);
+        file << "hipblas_tuning_profile 1\narch " << arch << " other_backend\nsplit_k 0 0\n";
+    }
+    CHECK_HIPBLAS_ERROR(hipblasImportTuningProfile(profile));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmSplitK(handle, &split_k_mode, &split_k_factor));
+    EXPECT_EQ(HIPBLAS_GEMM_SPLIT_K_AUTO, split_k_mode);
+    std::remove(profile);
+
+    EXPECT_HIPBLAS_STATUS(hipblasLoadGemmTuning(path), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSaveGemmTuning(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasImportTuningProfile(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasExportTuningProfile(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmTuningMode(handle, HIPBLAS_GEMM_TUNING_OFF));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
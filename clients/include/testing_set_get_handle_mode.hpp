@@ -0,0 +1,280 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_handle_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_handle_mode(const Arguments& arg)
+{
+    hipblasHandleMode_t mode;
+    hipStream_t         handle_stream, stream;
+    hipblasLocalHandle  handle(arg);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &handle_stream));
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_HANDLE_MODE_DEFAULT, mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetHandleMode(handle, HIPBLAS_HANDLE_MODE_SHARED));
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_HANDLE_MODE_SHARED, mode);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetHandleMode(handle, hipblasHandleMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetHandleMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspace(handle, nullptr, 0), HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // Each thread runs its own sgemm on its own stream through the one shared handle
+    const int num_threads = 4;
+    const int M = 64, N = 48, K = 32;
+    float     alpha = 1.0f, beta = 0.0f;
+
+    host_vector<float> hA(size_t(M) * K);
+    host_vector<float> hB(size_t(K) * N);
+    host_vector<float> hC_gold(size_t(M) * N);
+
+    hipblas_init_matrix(hA, arg, M, K, M, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_never_set_nan, false, true);
+
+    cblas_gemm<float>(HIPBLAS_OP_N,
+                      HIPBLAS_OP_N,
+                      M,
+                      N,
+                      K,
+                      alpha,
+                      hA.data(),
+                      M,
+                      hB.data(),
+                      K,
+                      beta,
+                      hC_gold.data(),
+                      M);
+
+    device_vector<float> dA(size_t(M) * K);
+    device_vector<float> dB(size_t(K) * N);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * K * N, hipMemcpyHostToDevice));
+
+    // The C matrix of thread i starts at i * size_C
+    const size_t       size_C = size_t(M) * N;
+    host_vector<float> hC(size_C * num_threads);
+
+    device_vector<float> dC(size_C * num_threads);
+
+    std::vector<hipStream_t>     streams(num_threads);
+    std::vector<hipStream_t>     thread_streams(num_threads);
+    std::vector<hipblasStatus_t> statuses(num_threads, HIPBLAS_STATUS_SUCCESS);
+    for(int i = 0; i < num_threads; i++)
+        CHECK_HIP_ERROR(hipStreamCreate(&streams[i]));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    std::vector<std::thread> threads;
+    for(int i = 0; i < num_threads; i++)
+        threads.emplace_back([&, i]() {
+            hipblasStatus_t status = hipblasSetStream(handle, streams[i]);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasSgemm(handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      M,
+                                      N,
+                                      K,
+                                      &alpha,
+                                      dA,
+                                      M,
+                                      dB,
+                                      K,
+                                      &beta,
+                                      dC + i * size_C,
+                                      M);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGetStream(handle, &thread_streams[i]);
+            if(status == HIPBLAS_STATUS_SUCCESS && hipStreamSynchronize(streams[i]) != hipSuccess)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            statuses[i] = status;
+        });
+    for(auto& t : threads)
+        t.join();
+
+    // The streams set by the threads are not seen by the others
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    EXPECT_EQ(handle_stream, stream);
+
+    for(int i = 0; i < num_threads; i++)
+    {
+        CHECK_HIPBLAS_ERROR(statuses[i]);
+        EXPECT_EQ(streams[i], thread_streams[i]);
+
+        CHECK_HIP_ERROR(hipStreamDestroy(streams[i]));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * size_C * num_threads, hipMemcpyDeviceToHost));
+    if(arg.unit_check)
+        for(int i = 0; i < num_threads; i++)
+            unit_check_general<float>(M, N, M, hC_gold.data(), hC.data() + i * size_C);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetHandleMode(handle, HIPBLAS_HANDLE_MODE_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_HANDLE_MODE_DEFAULT, mode);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// One thread alternates the stream and pointer mode of a shared handle between gemms, and the
+// handle keeps its own stream and workspace once it is no longer shared
+inline hipblasStatus_t testing_handle_mode_stream_switch(const Arguments& arg)
+{
+    const size_t        workspace_size = 1 << 22;
+    device_vector<char> workspace(workspace_size);
+    hipblasLocalHandle  handle(arg);
+    hipStream_t         handle_stream, stream;
+
+    const int M = 64, N = 48, K = 32;
+    const int calls = 6;
+    float     beta  = 0.0f;
+
+    host_vector<float> hA(size_t(M) * K);
+    host_vector<float> hB(size_t(K) * N);
+    host_vector<float> h_alpha(calls);
+    for(int i = 0; i < calls; i++)
+        h_alpha[i] = float(i + 1);
+
+    hipblas_init_matrix(hA, arg, M, K, M, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_never_set_nan, false, true);
+
+    // The C matrix of call i starts at i * size_C
+    const size_t       size_C = size_t(M) * N;
+    host_vector<float> hC(size_C * calls);
+    host_vector<float> hC_gold(size_C * calls);
+    for(int i = 0; i < calls; i++)
+        cblas_gemm<float>(HIPBLAS_OP_N,
+                          HIPBLAS_OP_N,
+                          M,
+                          N,
+                          K,
+                          h_alpha[i],
+                          hA.data(),
+                          M,
+                          hB.data(),
+                          K,
+                          beta,
+                          hC_gold.data() + i * size_C,
+                          M);
+
+    device_vector<float> dA(size_t(M) * K);
+    device_vector<float> dB(size_t(K) * N);
+    device_vector<float> dC(size_C * calls);
+    device_vector<float> d_alpha(calls);
+    device_vector<float> d_beta(1);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * K * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, h_alpha, sizeof(float) * calls, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &handle_stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace, workspace_size));
+    CHECK_HIPBLAS_ERROR(hipblasSetHandleMode(handle, HIPBLAS_HANDLE_MODE_SHARED));
+
+    // The same stream twice in a row, then back and forth, with the pointer mode changing on
+    // every other call
+    hipStream_t streams[2];
+    for(auto& s : streams)
+        CHECK_HIP_ERROR(hipStreamCreate(&s));
+    const int order[calls] = {0, 0, 1, 0, 1, 1};
+
+    for(int i = 0; i < calls; i++)
+    {
+        bool device = i % 2;
+        CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, streams[order[i]]));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(
+            handle, device ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasSgemm(handle,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_N,
+                                         M,
+                                         N,
+                                         K,
+                                         device ? d_alpha + i : &h_alpha[i],
+                                         dA,
+                                         M,
+                                         dB,
+                                         K,
+                                         device ? (float*)d_beta : &beta,
+                                         dC + i * size_C,
+                                         M));
+
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        EXPECT_EQ(streams[order[i]], stream);
+    }
+
+    for(auto& s : streams)
+        CHECK_HIP_ERROR(hipStreamSynchronize(s));
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * size_C * calls, hipMemcpyDeviceToHost));
+    if(arg.unit_check)
+        for(int i = 0; i < calls; i++)
+            unit_check_general<float>(
+                M, N, M, hC_gold.data() + i * size_C, hC.data() + i * size_C);
+
+    // Back to a plain handle, none of the streams set while it was shared is left on it, and the
+    // workspace given before is still the one its calls use
+    CHECK_HIPBLAS_ERROR(hipblasSetHandleMode(handle, HIPBLAS_HANDLE_MODE_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    EXPECT_EQ(handle_stream, stream);
+
+    size_t  size, current, peak;
+    int64_t grow_count;
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+    EXPECT_EQ(workspace_size, size);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &h_alpha[0], dA, M, dB, K, &beta, dC, M));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceStats(handle, &current, &peak, &grow_count));
+    EXPECT_EQ(workspace_size, current);
+    EXPECT_EQ(0, grow_count);
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(handle_stream));
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * size_C, hipMemcpyDeviceToHost));
+    if(arg.unit_check)
+        unit_check_general<float>(M, N, M, hC_gold.data(), hC.data());
+
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+    for(auto& s : streams)
+        CHECK_HIP_ERROR(hipStreamDestroy(s));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
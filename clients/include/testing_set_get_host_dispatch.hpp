@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_host_dispatch(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_host_dispatch(const Arguments& arg)
+{
+    hipblasHostDispatchMode_t mode;
+    int64_t                   threshold;
+    hipblasLocalHandle        handle(arg);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetHostDispatch(handle, &mode));
+    EXPECT_EQ(HIPBLAS_HOST_DISPATCH_OFF, mode);
+    if(!getenv("HIPBLAS_HOST_DISPATCH_THRESHOLDS"))
+    {
+        CHECK_HIPBLAS_ERROR(
+            hipblasGetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_GEMV, &threshold));
+        EXPECT_EQ(16384, threshold);
+    }
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetHostDispatch(handle, hipblasHostDispatchMode_t(3)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetHostDispatch(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasSetHostDispatchThreshold(handle, hipblasHostDispatchRoutine_t(4), 100),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasSetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_DOT, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_DOT, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetHostDispatch(handle, HIPBLAS_HOST_DISPATCH_DETECT));
+    CHECK_HIPBLAS_ERROR(hipblasGetHostDispatch(handle, &mode));
+    EXPECT_EQ(HIPBLAS_HOST_DISPATCH_DETECT, mode);
+    CHECK_HIPBLAS_ERROR(
+        hipblasSetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_GEMM, 100000));
+    CHECK_HIPBLAS_ERROR(
+        hipblasGetHostDispatchThreshold(handle, HIPBLAS_HOST_DISPATCH_GEMM, &threshold));
+    EXPECT_EQ(100000, threshold);
+
+    // Calls on host memory within the thresholds run on the host, and on device memory on the
+    // device; both give the reference result
+    const int M = 23, N = 17, K = 31;
+    float     alpha = 1.5f, beta = -0.5f;
+
+    host_vector<float> hA(size_t(M) * K);
+    host_vector<float> hB(size_t(K) * N);
+    host_vector<float> hC(size_t(M) * N);
+    host_vector<float> hx(K);
+    host_vector<float> hy(M);
+
+    hipblas_init_matrix(hA, arg, M, K, M, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_matrix(hC, arg, M, N, M, 0, 1, hipblas_client_never_set_nan);
+    hipblas_init_vector(hx, arg, K, 1, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_vector(hy, arg, M, 1, 0, 1, hipblas_client_never_set_nan);
+
+    host_vector<float> hC_gold = hC;
+    host_vector<float> hy_gold = hy;
+    float              dot_gold;
+    cblas_gemm<float>(
+        HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, alpha, hA, M, hB, K, beta, hC_gold.data(), M);
+    cblas_gemv<float>(HIPBLAS_OP_N, M, K, alpha, hA, M, hx, 1, beta, hy_gold, 1);
+    cblas_dot<float>(K, hA, M, hx, -1, &dot_gold);
+
+    device_vector<float> dA(hA.size());
+    device_vector<float> dB(hB.size());
+    device_vector<float> dC(hC.size());
+    device_vector<float> dx(hx.size());
+    device_vector<float> dy(hy.size());
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * hx.size(), hipMemcpyHostToDevice));
+
+    double tolerance = std::numeric_limits<float>::epsilon() * 40 * K;
+    for(int device = 0; device < 2; device++)
+    {
+        host_vector<float> hC_out = hC;
+        host_vector<float> hy_out = hy;
+        float              dot;
+        if(device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * hy.size(), hipMemcpyHostToDevice));
+        }
+        float* A = device ? (float*)dA : hA.data();
+        float* B = device ? (float*)dB : hB.data();
+        float* C = device ? (float*)dC : hC_out.data();
+        float* x = device ? (float*)dx : hx.data();
+        float* y = device ? (float*)dy : hy_out.data();
+
+        CHECK_HIPBLAS_ERROR(hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, A, M, B, K, &beta, C, M));
+        CHECK_HIPBLAS_ERROR(
+            hipblasSgemv(handle, HIPBLAS_OP_N, M, K, &alpha, A, M, x, 1, &beta, y, 1));
+        CHECK_HIPBLAS_ERROR(hipblasSdot(handle, K, A, M, x, -1, &dot));
+        if(device)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(hC_out, dC, sizeof(float) * hC.size(), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hy_out, dy, sizeof(float) * hy.size(), hipMemcpyDeviceToHost));
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_error(norm_check_general<float>('F', M, N, M, hC_gold, hC_out), tolerance);
+            unit_check_error(norm_check_general<float>('F', 1, M, 1, hy_gold, hy_out), tolerance);
+            unit_check_error(norm_check_general<float>('F', 1, 1, 1, &dot_gold, &dot), tolerance);
+        }
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetHostDispatch(handle, HIPBLAS_HOST_DISPATCH_OFF));
+    CHECK_HIPBLAS_ERROR(hipblasGetHostDispatch(handle, &mode));
+    EXPECT_EQ(HIPBLAS_HOST_DISPATCH_OFF, mode);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
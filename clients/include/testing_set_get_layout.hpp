@@ -0,0 +1,347 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_layout(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+// Runs sgemm, sgemv and strsm on a row-major handle and checks them against row-major loops, then
+// checks that routines with no row-major form return HIPBLAS_STATUS_NOT_SUPPORTED on it
+inline hipblasStatus_t testing_set_get_layout(const Arguments& arg)
+{
+    const int M = 16, N = 12, K = 8;
+    float     alpha = 2.0f, beta = 3.0f, one = 1.0f;
+
+    hipblasLocalHandle handle(arg);
+    hipblasLayout_t    layout;
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetLayout(handle, &layout));
+    EXPECT_EQ(HIPBLAS_COL_MAJOR, layout);
+    CHECK_HIPBLAS_ERROR(hipblasSetLayout(handle, HIPBLAS_ROW_MAJOR));
+    CHECK_HIPBLAS_ERROR(hipblasGetLayout(handle, &layout));
+    EXPECT_EQ(HIPBLAS_ROW_MAJOR, layout);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetLayout(handle, hipblasLayout_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetLayout(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetLayout(nullptr, HIPBLAS_ROW_MAJOR),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // Row-major A is M by K, B is N by K and used transposed, C is M by N and x has K elements
+    host_vector<float> hA(M * K);
+    host_vector<float> hB(N * K);
+    host_vector<float> hC(M * N);
+    host_vector<float> hC_gold(M * N);
+    host_vector<float> hx(K);
+    host_vector<float> hy(M);
+    host_vector<float> hy_gold(M);
+    host_vector<float> hT(M * M);
+    host_vector<float> hX(M * N);
+
+    device_vector<float> dA(M * K);
+    device_vector<float> dB(N * K);
+    device_vector<float> dC(M * N);
+    device_vector<float> dx(K);
+    device_vector<float> dy(M);
+    device_vector<float> dT(M * M);
+
+    hipblas_init_matrix(hA, arg, K, M, K, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hC, arg, N, M, N, 0, 1, hipblas_client_never_set_nan);
+    hipblas_init_vector(hx, arg, K, 1, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_vector(hy, arg, M, 1, 0, 1, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hT, arg, M, M, M, 0, 1, hipblas_client_never_set_nan);
+
+    // C := alpha * A * B^T + beta * C and y := alpha * A * x + beta * y
+    for(int i = 0; i < M; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            float sum = 0;
+            for(int l = 0; l < K; l++)
+                sum += hA[i * K + l] * hB[j * K + l];
+            hC_gold[i * N + j] = alpha * sum + beta * hC[i * N + j];
+        }
+
+        float sum = 0;
+        for(int j = 0; j < K; j++)
+            sum += hA[i * K + j] * hx[j];
+        hy_gold[i] = alpha * sum + beta * hy[i];
+    }
+
+    // Lower triangular T with a dominant diagonal, so that the solve is well conditioned
+    for(int i = 0; i < M; i++)
+        hT[i * M + i] += 10.0f * M;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * hx.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * hy.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dT, hT, sizeof(float) * hT.size(), hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_T, M, N, K, &alpha, dA, K, dB, K, &beta, dC, N));
+    CHECK_HIPBLAS_ERROR(
+        hipblasSgemv(handle, HIPBLAS_OP_N, M, K, &alpha, dA, K, dx, 1, &beta, dy, 1));
+
+    host_vector<float> hC_out(M * N);
+    host_vector<float> hy_out(M);
+    CHECK_HIP_ERROR(hipMemcpy(hC_out, dC, sizeof(float) * hC_out.size(), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_out, dy, sizeof(float) * hy_out.size(), hipMemcpyDeviceToHost));
+
+    // Solve T * X = C for the row-major M by N C computed above
+    CHECK_HIPBLAS_ERROR(hipblasStrsm(handle,
+                                     HIPBLAS_SIDE_LEFT,
+                                     HIPBLAS_FILL_MODE_LOWER,
+                                     HIPBLAS_OP_N,
+                                     HIPBLAS_DIAG_NON_UNIT,
+                                     M,
+                                     N,
+                                     &one,
+                                     dT,
+                                     M,
+                                     dC,
+                                     N));
+    CHECK_HIP_ERROR(hipMemcpy(hX, dC, sizeof(float) * hX.size(), hipMemcpyDeviceToHost));
+
+    // Largest residual of T * X - C, relative to the largest element of C
+    double residual = 0, largest = 0;
+    for(int i = 0; i < M; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            double sum = 0;
+            for(int l = 0; l <= i; l++)
+                sum += double(hT[i * M + l]) * hX[l * N + j];
+            residual = std::max(residual, std::abs(sum - hC_gold[i * N + j]));
+            largest  = std::max(largest, std::abs(double(hC_gold[i * N + j])));
+        }
+    }
+
+    if(arg.unit_check)
+    {
+        unit_check_general<float>(1, M * N, 1, hC_gold.data(), hC_out.data());
+        unit_check_general<float>(1, M, 1, hy_gold.data(), hy_out.data());
+        unit_check_error(residual / largest, M * double(std::numeric_limits<float>::epsilon()));
+    }
+
+    // Routines with no row-major form refuse the handle without touching their operands, while
+    // the Level-1 routines run as usual
+    float result;
+    EXPECT_HIPBLAS_STATUS(hipblasSsyrk(handle,
+                                       HIPBLAS_FILL_MODE_LOWER,
+                                       HIPBLAS_OP_N,
+                                       M,
+                                       K,
+                                       &alpha,
+                                       dA,
+                                       K,
+                                       &beta,
+                                       dT,
+                                       M),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasStrmv(
+            handle, HIPBLAS_FILL_MODE_LOWER, HIPBLAS_OP_N, HIPBLAS_DIAG_NON_UNIT, M, dT, M, dy, 1),
+        HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(hipblasSger(handle, K, M, &alpha, dx, 1, dy, 1, dA, K),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    CHECK_HIPBLAS_ERROR(hipblasSnrm2(handle, M, dy, 1, &result));
+
+    host_vector<float> hA_out(M * K);
+    host_vector<float> hT_out(M * M);
+    CHECK_HIP_ERROR(hipMemcpy(hy_out, dy, sizeof(float) * hy_out.size(), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hA_out, dA, sizeof(float) * hA_out.size(), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hT_out, dT, sizeof(float) * hT_out.size(), hipMemcpyDeviceToHost));
+
+    if(arg.unit_check)
+    {
+        unit_check_general<float>(1, M, 1, hy_gold.data(), hy_out.data());
+        unit_check_general<float>(1, M * K, 1, hA.data(), hA_out.data());
+        unit_check_general<float>(1, M * M, 1, hT.data(), hT_out.data());
+    }
+
+    // The handle is column-major again after setting HIPBLAS_COL_MAJOR
+    CHECK_HIPBLAS_ERROR(hipblasSetLayout(handle, HIPBLAS_COL_MAJOR));
+    CHECK_HIPBLAS_ERROR(hipblasGetLayout(handle, &layout));
+    EXPECT_EQ(HIPBLAS_COL_MAJOR, layout);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Runs sgemm and sgemv strided batched on a row-major handle over more problems than one backend
+// call takes, so that they are split into chunks, and checks them against row-major loops
+inline hipblasStatus_t testing_layout_chunks(const Arguments& arg)
+{
+    const int M = 3, N = 2, K = 2;
+    const int batch_count = 65535 + 2;
+    float     alpha = 2.0f, beta = 3.0f;
+
+    hipblasStride stride_A = M * K, stride_B = K * N, stride_C = M * N;
+
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetLayout(handle, HIPBLAS_ROW_MAJOR));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // Row-major A is M by K, B is K by N, C is M by N, x has K elements and y M
+    host_vector<float> hA(stride_A * batch_count);
+    host_vector<float> hB(stride_B * batch_count);
+    host_vector<float> hC(stride_C * batch_count);
+    host_vector<float> hC_gold(stride_C * batch_count);
+    host_vector<float> hC_out(stride_C * batch_count);
+    host_vector<float> hx(K * batch_count);
+    host_vector<float> hy(M * batch_count);
+    host_vector<float> hy_gold(M * batch_count);
+    host_vector<float> hy_out(M * batch_count);
+
+    device_vector<float> dA(hA.size());
+    device_vector<float> dB(hB.size());
+    device_vector<float> dC(hC.size());
+    device_vector<float> dx(hx.size());
+    device_vector<float> dy(hy.size());
+
+    hipblas_init_matrix(
+        hA, arg, K, M, K, stride_A, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, N, K, N, stride_B, batch_count, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hC, arg, N, M, N, stride_C, batch_count, hipblas_client_never_set_nan);
+    hipblas_init_vector(hx, arg, K, 1, K, batch_count, hipblas_client_never_set_nan);
+    hipblas_init_vector(hy, arg, M, 1, M, batch_count, hipblas_client_never_set_nan);
+
+    // C := alpha * A * B + beta * C and y := alpha * A * x + beta * y for every problem
+    for(int b = 0; b < batch_count; b++)
+    {
+        const float* A = hA.data() + b * stride_A;
+        const float* B = hB.data() + b * stride_B;
+        const float* x = hx.data() + b * K;
+        float*       C = hC.data() + b * stride_C;
+        for(int i = 0; i < M; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                float sum = 0;
+                for(int l = 0; l < K; l++)
+                    sum += A[i * K + l] * B[l * N + j];
+                hC_gold[b * stride_C + i * N + j] = alpha * sum + beta * C[i * N + j];
+            }
+
+            float sum = 0;
+            for(int l = 0; l < K; l++)
+                sum += A[i * K + l] * x[l];
+            hy_gold[b * M + i] = alpha * sum + beta * hy[b * M + i];
+        }
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * hx.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * hy.size(), hipMemcpyHostToDevice));
+
+    for(int ex = 0; ex < 2; ex++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+        if(ex)
+            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedEx_v2(handle,
+                                                               HIPBLAS_OP_N,
+                                                               HIPBLAS_OP_N,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               &alpha,
+                                                               dA,
+                                                               HIP_R_32F,
+                                                               K,
+                                                               stride_A,
+                                                               dB,
+                                                               HIP_R_32F,
+                                                               N,
+                                                               stride_B,
+                                                               &beta,
+                                                               dC,
+                                                               HIP_R_32F,
+                                                               N,
+                                                               stride_C,
+                                                               batch_count,
+                                                               HIPBLAS_COMPUTE_32F,
+                                                               HIPBLAS_GEMM_DEFAULT));
+        else
+            CHECK_HIPBLAS_ERROR(hipblasSgemmStridedBatched(handle,
+                                                           HIPBLAS_OP_N,
+                                                           HIPBLAS_OP_N,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           &alpha,
+                                                           dA,
+                                                           K,
+                                                           stride_A,
+                                                           dB,
+                                                           N,
+                                                           stride_B,
+                                                           &beta,
+                                                           dC,
+                                                           N,
+                                                           stride_C,
+                                                           batch_count));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_out, dC, sizeof(float) * hC_out.size(), hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+            unit_check_general<float>(1, hC_gold.size(), 1, hC_gold.data(), hC_out.data());
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSgemvStridedBatched(handle,
+                                                   HIPBLAS_OP_N,
+                                                   M,
+                                                   K,
+                                                   &alpha,
+                                                   dA,
+                                                   K,
+                                                   stride_A,
+                                                   dx,
+                                                   1,
+                                                   K,
+                                                   &beta,
+                                                   dy,
+                                                   1,
+                                                   M,
+                                                   batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(hy_out, dy, sizeof(float) * hy_out.size(), hipMemcpyDeviceToHost));
+
+    if(arg.unit_check)
+        unit_check_general<float>(1, hy_gold.size(), 1, hy_gold.data(), hy_out.data());
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_managed_prefetch(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_managed_prefetch(const Arguments& arg)
+{
+    hipblasManagedPrefetchMode_t mode;
+    hipblasLocalHandle           handle(arg);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetManagedPrefetch(handle, &mode));
+    EXPECT_EQ(HIPBLAS_MANAGED_PREFETCH_OFF, mode);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetManagedPrefetch(handle, hipblasManagedPrefetchMode_t(3)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetManagedPrefetch(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetManagedPrefetch(handle, HIPBLAS_MANAGED_PREFETCH_INPUTS_OUTPUTS));
+    CHECK_HIPBLAS_ERROR(hipblasGetManagedPrefetch(handle, &mode));
+    EXPECT_EQ(HIPBLAS_MANAGED_PREFETCH_INPUTS_OUTPUTS, mode);
+
+    // Operands in managed memory give the reference result once prefetched, read on the host
+    // after the stream is synchronized
+    const int M = 65, N = 33, K = 47;
+    float     alpha = 1.5f, beta = -0.5f;
+    float*    A;
+    float*    B;
+    float*    C;
+    if(hipMallocManaged((void**)&A, sizeof(float) * M * K) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        CHECK_HIPBLAS_ERROR(hipblasSetManagedPrefetch(handle, HIPBLAS_MANAGED_PREFETCH_OFF));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    CHECK_HIP_ERROR(hipMallocManaged((void**)&B, sizeof(float) * K * N));
+    CHECK_HIP_ERROR(hipMallocManaged((void**)&C, sizeof(float) * M * N));
+
+    host_vector<float> hA(size_t(M) * K);
+    host_vector<float> hB(size_t(K) * N);
+    host_vector<float> hC_gold(size_t(M) * N);
+    hipblas_init_matrix(hA, arg, M, K, M, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_matrix(hC_gold, arg, M, N, M, 0, 1, hipblas_client_never_set_nan);
+    std::copy(hA.begin(), hA.end(), A);
+    std::copy(hB.begin(), hB.end(), B);
+    std::copy(hC_gold.begin(), hC_gold.end(), C);
+
+    cblas_gemm<float>(
+        HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, alpha, hA, M, hB, K, beta, hC_gold.data(), M);
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, A, M, B, K, &beta, C, M));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    double tolerance = std::numeric_limits<float>::epsilon() * 40 * K;
+    if(arg.unit_check)
+        unit_check_error(norm_check_general<float>('F', M, N, M, hC_gold.data(), C), tolerance);
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(B));
+    CHECK_HIP_ERROR(hipFree(C));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetManagedPrefetch(handle, HIPBLAS_MANAGED_PREFETCH_OFF));
+    CHECK_HIPBLAS_ERROR(hipblasGetManagedPrefetch(handle, &mode));
+    EXPECT_EQ(HIPBLAS_MANAGED_PREFETCH_OFF, mode);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
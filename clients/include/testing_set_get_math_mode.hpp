@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_math_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_math_mode(const Arguments& arg)
+{
+    hipblasMath_t      mode;
+    hipblasLocalHandle handle(arg);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, HIPBLAS_XF32_XDL_MATH));
+    CHECK_HIPBLAS_ERROR(hipblasGetMathMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_XF32_XDL_MATH, mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH));
+    CHECK_HIPBLAS_ERROR(hipblasGetMathMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_DEFAULT_MATH, mode);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetMathMode(handle, hipblasMath_t(5)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetMathMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Small integers are exact in xf32 and TF32, so sgemm in reduced-precision math still
+    // matches the reference exactly
+    const int M = 128, N = 96, K = 64;
+    float     alpha = 2.0f, beta = 1.0f;
+
+    host_vector<float> hA(size_t(M) * K);
+    host_vector<float> hB(size_t(K) * N);
+    host_vector<float> hC(size_t(M) * N);
+    host_vector<float> hC_gold(size_t(M) * N);
+
+    device_vector<float> dA(size_t(M) * K);
+    device_vector<float> dB(size_t(K) * N);
+    device_vector<float> dC(size_t(M) * N);
+
+    hipblas_init_matrix(hA, arg, M, K, M, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_matrix(hC_gold, arg, M, N, M, 0, 1, hipblas_client_never_set_nan);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * K * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_gold, sizeof(float) * M * N, hipMemcpyHostToDevice));
+
+    cblas_gemm<float>(HIPBLAS_OP_N,
+                      HIPBLAS_OP_N,
+                      M,
+                      N,
+                      K,
+                      alpha,
+                      hA.data(),
+                      M,
+                      hB.data(),
+                      K,
+                      beta,
+                      hC_gold.data(),
+                      M);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, HIPBLAS_XF32_XDL_MATH));
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, dA, M, dB, K, &beta, dC, M));
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * M * N, hipMemcpyDeviceToHost));
+
+    if(arg.unit_check)
+        unit_check_general<float>(M, N, M, hC_gold.data(), hC.data());
+
+    CHECK_HIPBLAS_ERROR(hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
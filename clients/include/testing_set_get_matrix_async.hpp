@@ -128,17 +128,21 @@ inline hipblasStatus_t testing_set_get_matrix_async(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasSetMatrixAsyncFn(
                 rows, cols, sizeof(T), (void*)ha, lda, (void*)dc, ldc, stream));
             CHECK_HIPBLAS_ERROR(hipblasGetMatrixAsyncFn(
                 rows, cols, sizeof(T), (void*)dc, ldc, (void*)hb, ldb, stream));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasSetGetMatrixAsyncModel{}.log_args<T>(std::cout,
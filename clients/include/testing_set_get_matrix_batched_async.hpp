@@ -0,0 +1,199 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasSetGetMatrixBatchedAsyncModel
+    = ArgumentModel<e_M, e_N, e_lda, e_ldb, e_ldc, e_batch_count>;
+
+inline void testname_set_get_matrix_batched_async(const Arguments& arg, std::string& name)
+{
+    hipblasSetGetMatrixBatchedAsyncModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_set_get_matrix_batched_async(const Arguments& arg)
+{
+    int rows        = arg.rows;
+    int cols        = arg.cols;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || ldc <= 0 || batch_count <= 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // The matrices of each batch are kept in one allocation, with a gap of one column between the
+    // device matrices
+    hipblasStride stride_a = size_t(lda) * cols;
+    hipblasStride stride_b = size_t(ldb) * cols;
+    hipblasStride stride_c = size_t(ldc) * (cols + 1);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> ha(stride_a * batch_count);
+    host_vector<T> hb(stride_b * batch_count);
+    host_vector<T> hb_ref(stride_b * batch_count);
+    host_vector<T> hc(stride_c * batch_count);
+
+    device_vector<T> dc(stride_c * batch_count);
+
+    double             hipblas_error = 0.0, gpu_time_used = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    hipStream_t stream;
+    hipblasGetStream(handle, &stream);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(ha, rows, cols, lda, stride_a, batch_count);
+    hipblas_init<T>(hb, rows, cols, ldb, stride_b, batch_count);
+    hb_ref = hb;
+    for(size_t i = 0; i < stride_c * batch_count; i++)
+    {
+        hc[i] = 100 + i;
+    };
+    CHECK_HIP_ERROR(
+        hipMemcpy(dc, hc.data(), sizeof(T) * stride_c * batch_count, hipMemcpyHostToDevice));
+
+    // Arrays of matrix pointers, in host memory
+    std::vector<const void*> ha_array(batch_count), dc_const_array(batch_count);
+    std::vector<void*>       hb_array(batch_count), dc_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        ha_array[b]       = ha.data() + b * stride_a;
+        hb_array[b]       = hb.data() + b * stride_b;
+        dc_array[b]       = (T*)dc + b * stride_c;
+        dc_const_array[b] = dc_array[b];
+    }
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasSetMatrixBatchedAsync(rows,
+                                                     cols,
+                                                     sizeof(T),
+                                                     ha_array.data(),
+                                                     lda,
+                                                     dc_array.data(),
+                                                     ldc,
+                                                     batch_count,
+                                                     stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetMatrixBatchedAsync(rows,
+                                                     cols,
+                                                     sizeof(T),
+                                                     dc_const_array.data(),
+                                                     ldc,
+                                                     hb_array.data(),
+                                                     ldb,
+                                                     batch_count,
+                                                     stream));
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+
+        // reference calculation
+        for(int b = 0; b < batch_count; b++)
+        {
+            for(int i1 = 0; i1 < rows; i1++)
+            {
+                for(int i2 = 0; i2 < cols; i2++)
+                {
+                    hb_ref[i1 + i2 * ldb + b * stride_b] = ha[i1 + i2 * lda + b * stride_a];
+                }
+            }
+        }
+
+        // enable unit check, notice unit check is not invasive, but norm check is,
+        // unit check and norm check can not be interchanged their order
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(rows, cols, batch_count, ldb, stride_b, hb, hb_ref);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error
+                = norm_check_general<T>('F', rows, cols, ldb, stride_b, hb, hb_ref, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasSetMatrixBatchedAsync(rows,
+                                                             cols,
+                                                             sizeof(T),
+                                                             ha_array.data(),
+                                                             lda,
+                                                             dc_array.data(),
+                                                             ldc,
+                                                             batch_count,
+                                                             stream));
+            CHECK_HIPBLAS_ERROR(hipblasGetMatrixBatchedAsync(rows,
+                                                             cols,
+                                                             sizeof(T),
+                                                             dc_const_array.data(),
+                                                             ldc,
+                                                             hb_array.data(),
+                                                             ldb,
+                                                             batch_count,
+                                                             stream));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasSetGetMatrixBatchedAsyncModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            set_get_matrix_gbyte_count<T>(rows, cols) * batch_count,
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,164 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_operand_cache(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_operand_cache(const Arguments& arg)
+{
+    size_t             bytes;
+    hipblasLocalHandle handle(arg);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetOperandCacheLimit(handle, &bytes));
+    EXPECT_EQ(size_t(0), bytes);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetOperandCacheLimit(handle, size_t(1) << 24));
+    CHECK_HIPBLAS_ERROR(hipblasGetOperandCacheLimit(handle, &bytes));
+    EXPECT_EQ(size_t(1) << 24, bytes);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetOperandCacheLimit(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasRegisterOperand(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetOperandCacheLimit(nullptr, 0), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // Transposed gemv and gemm calls on registered operands, each run twice so the second reads
+    // the copy when it was found faster, then again after A changes and is invalidated, and under
+    // a limit too small for any copy. The
+    // inputs are small integers, so every sum is exact and the results match in either layout.
+    const int M = 67, N = 45, K = 29;
+    float     alpha = 2.0f, beta = 3.0f;
+
+    host_vector<float> hA(size_t(M) * K);
+    host_vector<float> hB(size_t(K) * N);
+    host_vector<float> hC(size_t(M) * N);
+    host_vector<float> hC_init(size_t(M) * N);
+    host_vector<float> hC_gold(size_t(M) * N);
+    host_vector<float> hx(M);
+    host_vector<float> hy(K);
+    host_vector<float> hy_init(K);
+    host_vector<float> hy_gold(K);
+
+    device_vector<float> dA(size_t(M) * K);
+    device_vector<float> dB(size_t(K) * N);
+    device_vector<float> dC(size_t(M) * N);
+    device_vector<float> dx(M);
+    device_vector<float> dy(K);
+
+    hipblas_init_matrix(hA, arg, K, M, K, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, N, K, N, 0, 1, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hC_init, arg, M, N, M, 0, 1, hipblas_client_never_set_nan);
+    hipblas_init_vector(hx, arg, M, 1, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_vector(hy_init, arg, K, 1, 0, 1, hipblas_client_never_set_nan);
+
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * K * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * M, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasRegisterOperand(handle, dA));
+    CHECK_HIPBLAS_ERROR(hipblasRegisterOperand(handle, dB));
+    CHECK_HIPBLAS_ERROR(hipblasRegisterOperand(handle, dA));
+
+    for(int pass = 0; pass < 3; pass++)
+    {
+        // A is stored M x K for gemv and K x M for the gemm
+        if(pass == 1)
+        {
+            for(size_t i = 0; i < hA.size(); i++)
+                hA[i] = hA[i] > 0 ? hA[i] - 1.0f : hA[i] + 1.0f;
+            CHECK_HIPBLAS_ERROR(hipblasInvalidateOperand(handle, dA));
+        }
+
+        // With a limit too small for any copy, the calls run as issued
+        if(pass == 2)
+            CHECK_HIPBLAS_ERROR(hipblasSetOperandCacheLimit(handle, 16));
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M * K, hipMemcpyHostToDevice));
+
+        hy_gold = hy_init;
+        cblas_gemv<float>(
+            HIPBLAS_OP_T, M, K, alpha, hA.data(), M, hx.data(), 1, beta, hy_gold.data(), 1);
+        hC_gold = hC_init;
+        cblas_gemm<float>(HIPBLAS_OP_T,
+                          HIPBLAS_OP_T,
+                          M,
+                          N,
+                          K,
+                          alpha,
+                          hA.data(),
+                          K,
+                          hB.data(),
+                          N,
+                          beta,
+                          hC_gold.data(),
+                          M);
+
+        for(int call = 0; call < 2; call++)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy_init, sizeof(float) * K, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(
+                hipMemcpy(dC, hC_init, sizeof(float) * M * N, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(
+                hipblasSgemv(handle, HIPBLAS_OP_T, M, K, &alpha, dA, M, dx, 1, &beta, dy, 1));
+            CHECK_HIPBLAS_ERROR(hipblasSgemm(handle,
+                                             HIPBLAS_OP_T,
+                                             HIPBLAS_OP_T,
+                                             M,
+                                             N,
+                                             K,
+                                             &alpha,
+                                             dA,
+                                             K,
+                                             dB,
+                                             N,
+                                             &beta,
+                                             dC,
+                                             M));
+            CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(float) * K, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * M * N, hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<float>(K, 1, K, hy_gold.data(), hy.data());
+                unit_check_general<float>(M, N, M, hC_gold.data(), hC.data());
+            }
+        }
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasInvalidateOperand(handle, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasUnregisterOperand(handle, dA));
+    CHECK_HIPBLAS_ERROR(hipblasUnregisterOperand(handle, dB));
+    CHECK_HIPBLAS_ERROR(hipblasSetOperandCacheLimit(handle, 0));
+    CHECK_HIPBLAS_ERROR(hipblasGetOperandCacheLimit(handle, &bytes));
+    EXPECT_EQ(size_t(0), bytes);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
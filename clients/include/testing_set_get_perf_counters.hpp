@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_perf_counters(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_perf_counters(const Arguments& arg)
+{
+    hipblasPerfCounter_t counters[4];
+    int                  count = 4;
+    hipblasLocalHandle   handle(arg);
+
+    // Nothing is counted until counters are set
+    CHECK_HIPBLAS_ERROR(hipblasGetPerfCounters(handle, counters, &count));
+    EXPECT_EQ(0, count);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetPerfCounters(handle, hipblasPerfCountersMode_t(3), 1),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasSetPerfCounters(handle, HIPBLAS_PERF_COUNTERS_TIMED, 0),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetPerfCounters(handle, counters, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    const int M = 64, N = 48, K = 32;
+    float     alpha = 1.0f, beta = 0.0f;
+
+    device_vector<float> dA(size_t(M) * K);
+    device_vector<float> dB(size_t(K) * N);
+    device_vector<float> dC(size_t(M) * N);
+    device_vector<float> dx(N);
+
+    CHECK_HIP_ERROR(hipMemset(dA, 0, sizeof(float) * M * K));
+    CHECK_HIP_ERROR(hipMemset(dB, 0, sizeof(float) * K * N));
+    CHECK_HIP_ERROR(hipMemset(dx, 0, sizeof(float) * N));
+
+    // Time every other call: the first and third gemm and the first axpy
+    CHECK_HIPBLAS_ERROR(hipblasSetPerfCounters(handle, HIPBLAS_PERF_COUNTERS_TIMED, 2));
+    for(int i = 0; i < 3; i++)
+        CHECK_HIPBLAS_ERROR(hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, dA, M, dB, K, &beta, dC, M));
+    for(int i = 0; i < 2; i++)
+        CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, &alpha, dx, 1, dC, 1));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    // Only the number of routines is queried without an array
+    CHECK_HIPBLAS_ERROR(hipblasGetPerfCounters(handle, nullptr, &count));
+    EXPECT_EQ(2, count);
+
+    count = 4;
+    CHECK_HIPBLAS_ERROR(hipblasGetPerfCounters(handle, counters, &count));
+    EXPECT_EQ(2, count);
+    if(count != 2)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    EXPECT_EQ(0, std::strcmp(counters[0].routine, "hipblasSgemm"));
+    EXPECT_EQ(3u, counters[0].calls);
+    EXPECT_EQ(3.0 * 2 * M * N * K, counters[0].flops);
+    EXPECT_EQ(3.0 * sizeof(float) * (M * K + K * N + M * N), counters[0].bytes);
+    EXPECT_EQ(2u, counters[0].timedCalls);
+    EXPECT_GT(counters[0].timeUs, 0);
+
+    EXPECT_EQ(0, std::strcmp(counters[1].routine, "hipblasSaxpy"));
+    EXPECT_EQ(2u, counters[1].calls);
+    EXPECT_EQ(2.0 * 2 * N, counters[1].flops);
+    EXPECT_EQ(1u, counters[1].timedCalls);
+
+    // Calls are no longer counted when off, and the counters are kept until reset
+    CHECK_HIPBLAS_ERROR(hipblasSetPerfCounters(handle, HIPBLAS_PERF_COUNTERS_OFF, 0));
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, &alpha, dx, 1, dC, 1));
+    count = 4;
+    CHECK_HIPBLAS_ERROR(hipblasGetPerfCounters(handle, counters, &count));
+    EXPECT_EQ(2, count);
+    EXPECT_EQ(2u, counters[1].calls);
+
+    CHECK_HIPBLAS_ERROR(hipblasResetPerfCounters(handle));
+    count = 4;
+    CHECK_HIPBLAS_ERROR(hipblasGetPerfCounters(handle, counters, &count));
+    EXPECT_EQ(0, count);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_pointer_array_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_pointer_array_mode(const Arguments& arg)
+{
+    const int           M = 16, N = 12, K = 8, batch_count = 10;
+    const hipblasStride stride_A = M * K, stride_B = K * N, stride_C = M * N;
+    float               alpha = 2.0f, beta = 3.0f;
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<float> hA(stride_A * batch_count);
+    host_vector<float> hB(stride_B * batch_count);
+    host_vector<float> hC(stride_C * batch_count);
+    host_vector<float> hC_gold(stride_C * batch_count);
+
+    device_vector<float>      dA(stride_A * batch_count);
+    device_vector<float>      dB(stride_B * batch_count);
+    device_vector<float>      dC(stride_C * batch_count);
+    std::vector<float*>       hA_array(batch_count), hB_array(batch_count), hC_array(batch_count);
+    hipblasPointerArrayMode_t mode;
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA_array[b] = dA + b * stride_A;
+        hB_array[b] = dB + b * stride_B;
+        hC_array[b] = dC + b * stride_C;
+    }
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerArrayMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_POINTER_ARRAY_MODE_DEVICE, mode);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerArrayMode(handle, HIPBLAS_POINTER_ARRAY_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerArrayMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_POINTER_ARRAY_MODE_HOST, mode);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetPointerArrayMode(handle, (hipblasPointerArrayMode_t)2),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetPointerArrayMode(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetPointerArrayMode(nullptr, HIPBLAS_POINTER_ARRAY_MODE_HOST),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblas_init_matrix(
+        hA, arg, M, K, M, stride_A, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, stride_B, batch_count, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hC, arg, M, N, M, stride_C, batch_count, hipblas_client_never_set_nan);
+    hC_gold = hC;
+
+    // Each call applies the gemm once more, so the reference runs it for every call
+    const int calls = 3;
+    for(int call = 0; call < calls; call++)
+        for(int b = 0; b < batch_count; b++)
+            cblas_gemm<float, float, float>(HIPBLAS_OP_N,
+                                            HIPBLAS_OP_T,
+                                            M,
+                                            N,
+                                            K,
+                                            alpha,
+                                            hA.data() + b * stride_A,
+                                            M,
+                                            hB.data() + b * stride_B,
+                                            N,
+                                            beta,
+                                            hC_gold.data() + b * stride_C,
+                                            M);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // The host arrays are passed directly, and C's array is overwritten right after each call
+    // returns, before its upload is known to have run
+    for(int call = 0; call < calls; call++)
+    {
+        std::vector<float*> hC_call = hC_array;
+        CHECK_HIPBLAS_ERROR(hipblasSgemmBatched(handle,
+                                                HIPBLAS_OP_N,
+                                                HIPBLAS_OP_T,
+                                                M,
+                                                N,
+                                                K,
+                                                &alpha,
+                                                hA_array.data(),
+                                                M,
+                                                hB_array.data(),
+                                                N,
+                                                &beta,
+                                                hC_call.data(),
+                                                M,
+                                                batch_count));
+        std::fill(hC_call.begin(), hC_call.end(), nullptr);
+    }
+
+    host_vector<float> hC_out(stride_C * batch_count);
+    CHECK_HIP_ERROR(hipMemcpy(hC_out, dC, sizeof(float) * hC_out.size(), hipMemcpyDeviceToHost));
+
+    if(arg.unit_check)
+        unit_check_general<float>(M, N, batch_count, M, stride_C, hC_gold, hC_out);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerArrayMode(handle, HIPBLAS_POINTER_ARRAY_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerArrayMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_POINTER_ARRAY_MODE_DEVICE, mode);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
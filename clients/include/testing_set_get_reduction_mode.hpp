@@ -0,0 +1,195 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_reduction_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_reduction_mode(const Arguments& arg)
+{
+    hipblasReductionMode_t mode;
+    hipblasAtomicsMode_t   atomics_mode;
+    hipblasLocalHandle     handle(arg);
+
+    // Make sure set()/get() functions work, and that the atomics mode is kept while reproducible
+    CHECK_HIPBLAS_ERROR(hipblasGetReductionMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_REDUCTION_DEFAULT, mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetAtomicsMode(handle, HIPBLAS_ATOMICS_ALLOWED));
+    CHECK_HIPBLAS_ERROR(hipblasSetReductionMode(handle, HIPBLAS_REDUCTION_REPRODUCIBLE));
+    CHECK_HIPBLAS_ERROR(hipblasGetReductionMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_REDUCTION_REPRODUCIBLE, mode);
+    CHECK_HIPBLAS_ERROR(hipblasGetAtomicsMode(handle, &atomics_mode));
+    EXPECT_EQ(HIPBLAS_ATOMICS_NOT_ALLOWED, atomics_mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetReductionMode(handle, HIPBLAS_REDUCTION_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetReductionMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_REDUCTION_DEFAULT, mode);
+    CHECK_HIPBLAS_ERROR(hipblasGetAtomicsMode(handle, &atomics_mode));
+    EXPECT_EQ(HIPBLAS_ATOMICS_ALLOWED, atomics_mode);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetReductionMode(handle, hipblasReductionMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetReductionMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Each routine runs twice in the reproducible mode; both runs must give the same bits and be
+    // near the reference
+    CHECK_HIPBLAS_ERROR(hipblasSetReductionMode(handle, HIPBLAS_REDUCTION_REPRODUCIBLE));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    const int N         = 1000;
+    float     alpha     = 1.5f, beta = 0.5f;
+    double    tolerance = std::numeric_limits<float>::epsilon() * 4 * N;
+
+    host_vector<float> hA(size_t(N) * N);
+    host_vector<float> hx(N);
+    host_vector<float> hy(N);
+    host_vector<float> hy_gold(N);
+    host_vector<float> hy_out[2] = {host_vector<float>(N), host_vector<float>(N)};
+
+    device_vector<float> dA(size_t(N) * N);
+    device_vector<float> dx(N);
+    device_vector<float> dy(N);
+
+    hipblas_init_matrix(hA, arg, N, N, N, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hx, arg, N, 1, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_vector(hy, arg, N, 1, 0, 1, hipblas_client_never_set_nan);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * N * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+
+    // dot and nrm2
+    float dot_gold, nrm2_gold, dot_out[2], nrm2_out[2];
+    cblas_dot<float>(N, hx.data(), 1, hy.data(), 1, &dot_gold);
+    cblas_nrm2<float, float>(N, hx.data(), 1, &nrm2_gold);
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * N, hipMemcpyHostToDevice));
+    for(int call = 0; call < 2; call++)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSdot(handle, N, dx, 1, dy, 1, &dot_out[call]));
+        CHECK_HIPBLAS_ERROR(hipblasSnrm2(handle, N, dx, 1, &nrm2_out[call]));
+    }
+    EXPECT_EQ(0, std::memcmp(&dot_out[0], &dot_out[1], sizeof(float)));
+    EXPECT_EQ(0, std::memcmp(&nrm2_out[0], &nrm2_out[1], sizeof(float)));
+    if(arg.unit_check)
+    {
+        near_check_general<float>(1, 1, 1, &dot_gold, &dot_out[0], tolerance * std::abs(dot_gold));
+        near_check_general<float>(
+            1, 1, 1, &nrm2_gold, &nrm2_out[0], tolerance * std::abs(nrm2_gold));
+    }
+
+    // gemv with the transpose, and symv
+    for(int routine = 0; routine < 2; routine++)
+    {
+        hy_gold = hy;
+        if(routine == 0)
+            cblas_gemv<float>(
+                HIPBLAS_OP_T, N, N, alpha, hA.data(), N, hx.data(), 1, beta, hy_gold.data(), 1);
+        else
+            cblas_symv<float>(HIPBLAS_FILL_MODE_UPPER,
+                              N,
+                              alpha,
+                              hA.data(),
+                              N,
+                              hx.data(),
+                              1,
+                              beta,
+                              hy_gold.data(),
+                              1);
+
+        for(int call = 0; call < 2; call++)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * N, hipMemcpyHostToDevice));
+            if(routine == 0)
+                CHECK_HIPBLAS_ERROR(
+                    hipblasSgemv(handle, HIPBLAS_OP_T, N, N, &alpha, dA, N, dx, 1, &beta, dy, 1));
+            else
+                CHECK_HIPBLAS_ERROR(hipblasSsymv(
+                    handle, HIPBLAS_FILL_MODE_UPPER, N, &alpha, dA, N, dx, 1, &beta, dy, 1));
+            CHECK_HIP_ERROR(hipMemcpy(hy_out[call], dy, sizeof(float) * N, hipMemcpyDeviceToHost));
+        }
+
+        EXPECT_EQ(0, std::memcmp(hy_out[0].data(), hy_out[1].data(), sizeof(float) * N));
+        if(arg.unit_check)
+            near_check_general<float>(1, N, 1, hy_gold.data(), hy_out[0].data(), tolerance * 4);
+    }
+
+    // hemv on the lower triangle
+    using T = hipblasDoubleComplex;
+    T      zalpha(1.5, -0.5), zbeta(0.5, 0.25);
+    double ztolerance = std::numeric_limits<double>::epsilon() * 4 * N;
+
+    host_vector<T> hzA(size_t(N) * N);
+    host_vector<T> hzx(N);
+    host_vector<T> hzy(N);
+    host_vector<T> hzy_gold(N);
+    host_vector<T> hzy_out[2] = {host_vector<T>(N), host_vector<T>(N)};
+
+    device_vector<T> dzA(size_t(N) * N);
+    device_vector<T> dzx(N);
+    device_vector<T> dzy(N);
+
+    hipblas_init_matrix(hzA, arg, N, N, N, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hzx, arg, N, 1, 0, 1, hipblas_client_never_set_nan, false, true);
+    hipblas_init_vector(hzy, arg, N, 1, 0, 1, hipblas_client_never_set_nan);
+
+    hzy_gold = hzy;
+    cblas_hemv<T>(HIPBLAS_FILL_MODE_LOWER,
+                  N,
+                  zalpha,
+                  hzA.data(),
+                  N,
+                  hzx.data(),
+                  1,
+                  zbeta,
+                  hzy_gold.data(),
+                  1);
+
+    CHECK_HIP_ERROR(hipMemcpy(dzA, hzA, sizeof(T) * N * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dzx, hzx, sizeof(T) * N, hipMemcpyHostToDevice));
+    for(int call = 0; call < 2; call++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dzy, hzy, sizeof(T) * N, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasZhemv(
+            handle, HIPBLAS_FILL_MODE_LOWER, N, &zalpha, dzA, N, dzx, 1, &zbeta, dzy, 1));
+        CHECK_HIP_ERROR(hipMemcpy(hzy_out[call], dzy, sizeof(T) * N, hipMemcpyDeviceToHost));
+    }
+
+    EXPECT_EQ(0, std::memcmp(hzy_out[0].data(), hzy_out[1].data(), sizeof(T) * N));
+    if(arg.unit_check)
+        near_check_general<T>(1, N, 1, hzy_gold.data(), hzy_out[0].data(), ztolerance * 4);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetReductionMode(handle, HIPBLAS_REDUCTION_DEFAULT));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+struct stream_capture_trsm_shapes
+{
+    const int*   sizes;
+    const float* alpha;
+    float*       dA;
+    float*       dB;
+};
+
+inline hipblasStatus_t stream_capture_trsm_shape(hipblasHandle_t handle, int index, void* userData)
+{
+    auto* shapes = static_cast<stream_capture_trsm_shapes*>(userData);
+    int   M      = shapes->sizes[index];
+    return hipblasStrsm(handle,
+                        HIPBLAS_SIDE_LEFT,
+                        HIPBLAS_FILL_MODE_LOWER,
+                        HIPBLAS_OP_N,
+                        HIPBLAS_DIAG_NON_UNIT,
+                        M,
+                        M,
+                        shapes->alpha,
+                        shapes->dA,
+                        M,
+                        shapes->dB,
+                        M);
+}
+
+inline void testname_set_get_stream_capture_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_stream_capture_mode(const Arguments& arg)
+{
+    hipblasStreamCaptureMode_t mode;
+    hipblasLocalHandle         handle(arg);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamCaptureMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_STREAM_CAPTURE_MODE_DEFAULT, mode);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetStreamCaptureMode(handle, HIPBLAS_STREAM_CAPTURE_MODE_SAFE));
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamCaptureMode(handle, &mode));
+
+    EXPECT_EQ(HIPBLAS_STREAM_CAPTURE_MODE_SAFE, mode);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetStreamCaptureMode(handle, hipblasStreamCaptureMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasPrewarmWorkspace(handle, 1, nullptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Reserve workspace for every shape, then capture the largest one
+    const int   sizes[] = {64, 256, 600};
+    const int   max_M   = 600;
+    const float alpha   = 1.0f;
+
+    device_vector<float> dA(size_t(max_M) * max_M);
+    device_vector<float> dB(size_t(max_M) * max_M);
+
+    stream_capture_trsm_shapes shapes{sizes, &alpha, dA, dB};
+    CHECK_HIPBLAS_ERROR(hipblasPrewarmWorkspace(handle, 3, stream_capture_trsm_shape, &shapes));
+
+    hipStream_t stream;
+    hipGraph_t  graph;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    hipblasStatus_t status = stream_capture_trsm_shape(handle, 2, &shapes);
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+
+    EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+
+#ifndef __HIP_PLATFORM_NVCC__
+    // Any routine, not only trsm, is refused while rocBLAS may still grow the workspace
+    hipblasLocalHandle growing_handle(arg);
+    CHECK_HIPBLAS_ERROR(
+        hipblasSetStreamCaptureMode(growing_handle, HIPBLAS_STREAM_CAPTURE_MODE_SAFE));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(growing_handle, stream));
+
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    status = hipblasSaxpy(growing_handle, max_M, &alpha, dA, 1, dB, 1);
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+
+    EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_WORKSPACE_TOO_SMALL);
+
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(growing_handle, nullptr));
+#endif
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,210 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_stream_pool_size(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_stream_pool_size(const Arguments& arg)
+{
+    int                size = -1;
+    hipblasLocalHandle handle(arg);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamPoolSize(handle, &size));
+    EXPECT_EQ(0, size);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetStreamPoolSize(handle, 4));
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamPoolSize(handle, &size));
+    EXPECT_EQ(4, size);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetStreamPoolSize(handle, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetStreamPoolSize(handle, 33), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetStreamPoolSize(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetStreamPoolSize(nullptr, 4), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // A new priority recreates the pool at the same size
+    hipblasStreamPriority_t priority;
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamPriority(handle, &priority));
+    EXPECT_EQ(HIPBLAS_STREAM_PRIORITY_DEFAULT, priority);
+    CHECK_HIPBLAS_ERROR(hipblasSetStreamPriority(handle, HIPBLAS_STREAM_PRIORITY_LATENCY));
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamPriority(handle, &priority));
+    EXPECT_EQ(HIPBLAS_STREAM_PRIORITY_LATENCY, priority);
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamPoolSize(handle, &size));
+    EXPECT_EQ(4, size);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetStreamPriority(handle, hipblasStreamPriority_t(3)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetStreamPriority(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A CU mask recreates the pool at the same size as well, here on the first half of the CUs
+    int      mask_size = 0;
+    uint32_t mask[4]   = {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu};
+    CHECK_HIPBLAS_ERROR(hipblasGetComputeUnitMask(handle, &mask_size, nullptr));
+    EXPECT_EQ(0, mask_size);
+
+    hipDeviceProp_t props;
+    int             device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&props, device));
+
+    std::vector<uint32_t> cu_mask((props.multiProcessorCount + 31) / 32);
+    for(int cu = 0; cu < std::max(1, props.multiProcessorCount / 2); cu++)
+        cu_mask[cu / 32] |= 1u << (cu % 32);
+
+#ifdef __HIP_PLATFORM_NVCC__
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputeUnitMask(handle, int(cu_mask.size()), cu_mask.data()),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+#else
+    CHECK_HIPBLAS_ERROR(hipblasSetComputeUnitMask(handle, int(cu_mask.size()), cu_mask.data()));
+    mask_size = 4;
+    CHECK_HIPBLAS_ERROR(hipblasGetComputeUnitMask(handle, &mask_size, mask));
+    EXPECT_EQ(int(cu_mask.size()), mask_size);
+    for(int i = 0; i < 4; i++)
+        EXPECT_EQ(i < mask_size ? cu_mask[i] : 0u, mask[i]);
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamPoolSize(handle, &size));
+    EXPECT_EQ(4, size);
+#endif
+
+    const uint32_t no_cus = 0;
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputeUnitMask(handle, 1, &no_cus),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputeUnitMask(handle, 1, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetComputeUnitMask(handle, -1, mask),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetComputeUnitMask(handle, nullptr, mask),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A batch of small gemms split across the pool streams matches the reference
+    const int           M = 8, N = 8, K = 8, batch_count = 1000;
+    const hipblasStride stride_A = M * K, stride_B = K * N, stride_C = M * N;
+    float               alpha = 1.0f, beta = 2.0f;
+
+    host_vector<float> hA(stride_A * batch_count);
+    host_vector<float> hB(stride_B * batch_count);
+    host_vector<float> hC(stride_C * batch_count);
+    host_vector<float> hC_gold(stride_C * batch_count);
+
+    device_vector<float> dA(stride_A * batch_count);
+    device_vector<float> dB(stride_B * batch_count);
+    device_vector<float> dC(stride_C * batch_count);
+
+    hipblas_init_matrix(
+        hA, arg, M, K, M, stride_A, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, stride_B, batch_count, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hC, arg, M, N, M, stride_C, batch_count, hipblas_client_never_set_nan);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSgemmStridedBatched(handle,
+                                                   HIPBLAS_OP_N,
+                                                   HIPBLAS_OP_N,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   &alpha,
+                                                   dA,
+                                                   M,
+                                                   stride_A,
+                                                   dB,
+                                                   K,
+                                                   stride_B,
+                                                   &beta,
+                                                   dC,
+                                                   M,
+                                                   stride_C,
+                                                   batch_count));
+
+    // The copy is ordered after every chunk on the handle stream
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    CHECK_HIP_ERROR(hipMemcpyAsync(
+        hC, dC, sizeof(float) * hC.size(), hipMemcpyDeviceToHost, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    for(int b = 0; b < batch_count; b++)
+        cblas_gemm<float, float, float>(HIPBLAS_OP_N,
+                                        HIPBLAS_OP_N,
+                                        M,
+                                        N,
+                                        K,
+                                        alpha,
+                                        hA.data() + b * stride_A,
+                                        M,
+                                        hB.data() + b * stride_B,
+                                        K,
+                                        beta,
+                                        hC_gold.data() + b * stride_C,
+                                        M);
+
+    if(arg.unit_check)
+        unit_check_general<float>(M, N, batch_count, M, stride_C, hC_gold, hC);
+
+    // The info summary covers the whole batch when a factorization is split, here of 1x1
+    // matrices that are singular at 100 and 700
+    hipblasInfoSummary_t summary{-1, -1, -1};
+    host_vector<float>   hF(batch_count);
+    device_vector<float> dF(batch_count);
+    device_vector<int>   dIpiv(batch_count);
+    device_vector<int>   dInfo(batch_count);
+
+    for(int b = 0; b < batch_count; b++)
+        hF[b] = b == 100 || b == 700 ? 0.0f : 1.0f;
+    CHECK_HIP_ERROR(hipMemcpy(dF, hF, sizeof(float) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSetInfoSummary(handle, &summary));
+
+    hipblasStatus_t status
+        = hipblasSgetrfStridedBatched(handle, 1, dF, 1, 1, dIpiv, 1, dInfo, batch_count);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(1, summary.anyFailed);
+        EXPECT_EQ(100, summary.firstFailed);
+        EXPECT_EQ(2, summary.failureCount);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetInfoSummary(handle, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasSetStreamPoolSize(handle, 0));
+    CHECK_HIPBLAS_ERROR(hipblasGetStreamPoolSize(handle, &size));
+    EXPECT_EQ(0, size);
+    CHECK_HIPBLAS_ERROR(hipblasSetStreamPriority(handle, HIPBLAS_STREAM_PRIORITY_DEFAULT));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
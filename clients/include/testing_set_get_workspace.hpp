@@ -0,0 +1,274 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_workspace(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_workspace(const Arguments& arg)
+{
+    const size_t        workspace_size = 1 << 20;
+    device_vector<char> workspace(workspace_size);
+
+    size_t             size = 0;
+    hipblasLocalHandle handle(arg);
+
+    // Invalid pointer for size query
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceSize(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace, workspace_size));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+
+    EXPECT_EQ(workspace_size, size);
+
+#ifdef __HIP_PLATFORM_NVCC__
+    EXPECT_HIPBLAS_STATUS(hipblasStartWorkspaceSizeQuery(handle), HIPBLAS_STATUS_NOT_SUPPORTED);
+#else
+    // Querying while a user workspace is set
+    CHECK_HIPBLAS_ERROR(hipblasStartWorkspaceSizeQuery(handle));
+    CHECK_HIPBLAS_ERROR(hipblasStopWorkspaceSizeQuery(handle, &size));
+    EXPECT_HIPBLAS_STATUS(hipblasStopWorkspaceSizeQuery(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+#endif
+
+    // Return workspace management to the library
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_workspace_stats(const Arguments& arg)
+{
+    size_t             current, peak;
+    int64_t            grow_count;
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceStats(handle, nullptr, &peak, &grow_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceStats(handle, &current, &peak, &grow_count));
+    EXPECT_GE(peak, current);
+    EXPECT_GE(grow_count, 0);
+
+#ifdef __HIP_PLATFORM_NVCC__
+    EXPECT_EQ(0, grow_count);
+    EXPECT_HIPBLAS_STATUS(hipblasShrinkWorkspace(handle, 0), HIPBLAS_STATUS_NOT_SUPPORTED);
+#else
+    // Shrinking keeps the peak
+    size_t  shrunk, shrunk_peak;
+    int64_t shrunk_grow_count;
+    CHECK_HIPBLAS_ERROR(hipblasShrinkWorkspace(handle, current / 2));
+    CHECK_HIPBLAS_ERROR(
+        hipblasGetWorkspaceStats(handle, &shrunk, &shrunk_peak, &shrunk_grow_count));
+    EXPECT_LE(shrunk, current);
+    EXPECT_EQ(peak, shrunk_peak);
+    EXPECT_EQ(grow_count, shrunk_grow_count);
+
+    // Workspace provided through hipblasSetWorkspace is not shrunk
+    const size_t        workspace_size = 1 << 20;
+    device_vector<char> workspace(workspace_size);
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace, workspace_size));
+    EXPECT_HIPBLAS_STATUS(hipblasShrinkWorkspace(handle, 0), HIPBLAS_STATUS_NOT_SUPPORTED);
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+#endif
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_workspace_stream(const Arguments& arg)
+{
+    const size_t        workspace_size = 1 << 22;
+    device_vector<char> workspace(workspace_size);
+    hipblasLocalHandle  handle(arg);
+    hipStream_t         stream;
+
+    // A gemm with a deep k, as the backends run with a workspace, on the new stream
+    const int M = 64, N = 64, K = 8192;
+    float     alpha = 1.0f, beta = 0.0f;
+
+    host_vector<float> hA(size_t(M) * K);
+    host_vector<float> hB(size_t(K) * N);
+    host_vector<float> hC(size_t(M) * N);
+    host_vector<float> hC_gold(size_t(M) * N);
+
+    device_vector<float> dA(size_t(M) * K);
+    device_vector<float> dB(size_t(K) * N);
+    device_vector<float> dC(size_t(M) * N);
+
+    hipblas_init_matrix(hA, arg, M, K, M, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_never_set_nan, false, true);
+    cblas_gemm<float, float, float>(HIPBLAS_OP_N,
+                                    HIPBLAS_OP_N,
+                                    M,
+                                    N,
+                                    K,
+                                    alpha,
+                                    hA.data(),
+                                    M,
+                                    hB.data(),
+                                    K,
+                                    beta,
+                                    hC_gold.data(),
+                                    M);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * K * N, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // Changing the stream keeps the workspace given through hipblasSetWorkspace, which cuBLAS
+    // would otherwise drop for its own
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace, workspace_size));
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+
+    size_t  size, current, peak;
+    int64_t grow_count;
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceStats(handle, &current, &peak, &grow_count));
+    EXPECT_EQ(workspace_size, size);
+    EXPECT_EQ(workspace_size, current);
+
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, dA, M, dB, K, &beta, dC, M));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceStats(handle, &current, &peak, &grow_count));
+    EXPECT_EQ(workspace_size, current);
+    EXPECT_EQ(0, grow_count);
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * M * N, hipMemcpyDeviceToHost));
+    if(arg.unit_check)
+        near_check_general<float>(M, N, M, hC_gold.data(), hC.data(), K * 1e-6);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// trsm with a unit diagonal on zero matrices, run through the workspace cache of the handle
+inline hipblasStatus_t testing_workspace_cache_trsm(hipblasHandle_t handle, int M, int N)
+{
+    const float          alpha = 1.0f;
+    device_vector<float> dA(size_t(M) * M);
+    device_vector<float> dB(size_t(M) * N);
+    CHECK_HIP_ERROR(hipMemset(dA, 0, sizeof(float) * M * M));
+    CHECK_HIP_ERROR(hipMemset(dB, 0, sizeof(float) * M * N));
+
+    return hipblasStrsm(handle,
+                        HIPBLAS_SIDE_LEFT,
+                        HIPBLAS_FILL_MODE_LOWER,
+                        HIPBLAS_OP_N,
+                        HIPBLAS_DIAG_UNIT,
+                        M,
+                        N,
+                        &alpha,
+                        dA,
+                        M,
+                        dB,
+                        M);
+}
+
+inline hipblasStatus_t testing_workspace_cache(const Arguments& arg)
+{
+#ifndef __HIP_PLATFORM_NVCC__
+    const int small_M = 256, small_N = 64, large_M = 2048, large_N = 1024;
+
+    // The handle is created and destroyed here, a pooled hipblasLocalHandle is never destroyed
+    hipblasHandle_t handle;
+    size_t          current, peak;
+    int64_t         grow_count;
+    CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // Workspace each shape needs
+    size_t small_size, large_size;
+    CHECK_HIPBLAS_ERROR(hipblasStartWorkspaceSizeQuery(handle));
+    CHECK_HIPBLAS_ERROR(testing_workspace_cache_trsm(handle, small_M, small_N));
+    CHECK_HIPBLAS_ERROR(hipblasStopWorkspaceSizeQuery(handle, &small_size));
+    CHECK_HIPBLAS_ERROR(hipblasStartWorkspaceSizeQuery(handle));
+    CHECK_HIPBLAS_ERROR(testing_workspace_cache_trsm(handle, large_M, large_N));
+    CHECK_HIPBLAS_ERROR(hipblasStopWorkspaceSizeQuery(handle, &large_size));
+    EXPECT_GT(small_size, 0);
+    EXPECT_GT(large_size, small_size);
+
+    // Fix the workspace below what the small shape needs, so hipBLAS grows it on demand
+    CHECK_HIPBLAS_ERROR(hipblasPrewarmWorkspace(handle, 0, nullptr, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasShrinkWorkspace(handle, small_size / 2));
+
+    size_t  start_size, start_peak;
+    int64_t start_grow_count;
+    CHECK_HIPBLAS_ERROR(
+        hipblasGetWorkspaceStats(handle, &start_size, &start_peak, &start_grow_count));
+
+    CHECK_HIPBLAS_ERROR(testing_workspace_cache_trsm(handle, small_M, small_N));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceStats(handle, &current, &peak, &grow_count));
+    EXPECT_GE(current, small_size);
+    EXPECT_EQ(start_grow_count + (start_size < small_size), grow_count);
+
+    // The same shape again reuses the workspace
+    size_t  small_current = current;
+    int64_t small_grow    = grow_count;
+    CHECK_HIPBLAS_ERROR(testing_workspace_cache_trsm(handle, small_M, small_N));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &current));
+    EXPECT_EQ(small_current, current);
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceStats(handle, &current, &peak, &grow_count));
+    EXPECT_EQ(small_grow, grow_count);
+
+    // A bigger shape grows it, once
+    CHECK_HIPBLAS_ERROR(testing_workspace_cache_trsm(handle, large_M, large_N));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceStats(handle, &current, &peak, &grow_count));
+    EXPECT_GE(current, large_size);
+    EXPECT_GE(peak, large_size);
+    EXPECT_EQ(small_grow + (small_current < large_size), grow_count);
+
+    size_t  large_current = current;
+    int64_t large_grow    = grow_count;
+    CHECK_HIPBLAS_ERROR(testing_workspace_cache_trsm(handle, large_M, large_N));
+    CHECK_HIPBLAS_ERROR(testing_workspace_cache_trsm(handle, small_M, small_N));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceStats(handle, &current, &peak, &grow_count));
+    EXPECT_EQ(large_current, current);
+    EXPECT_EQ(large_grow, grow_count);
+
+    // hipblasDestroy releases the cache, a new handle starts without its sizes and stats
+    CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+    CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceStats(handle, &current, &peak, &grow_count));
+    EXPECT_EQ(0, grow_count);
+    EXPECT_EQ(current, peak);
+    CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+#endif
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_workspace_alloc(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_workspace_alloc(const Arguments& arg)
+{
+    hipblasWorkspaceAlloc_t alloc;
+    hipMemPool_t            pool = nullptr, default_pool;
+    hipblasLocalHandle      handle(arg);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceAlloc(handle, &alloc, &pool));
+    EXPECT_EQ(HIPBLAS_WORKSPACE_ALLOC_DEFAULT, alloc);
+    EXPECT_EQ(nullptr, pool);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspaceAlloc(handle, hipblasWorkspaceAlloc_t(2), nullptr),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceAlloc(handle, nullptr, &pool),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Make sure set()/get() functions work
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipDeviceGetDefaultMemPool(&default_pool, device));
+    CHECK_HIPBLAS_ERROR(
+        hipblasSetWorkspaceAlloc(handle, HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED, default_pool));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceAlloc(handle, &alloc, &pool));
+    EXPECT_EQ(HIPBLAS_WORKSPACE_ALLOC_STREAM_ORDERED, alloc);
+    EXPECT_EQ(default_pool, pool);
+
+    // A trsm large enough to grow the workspace, with it from the pool on a stream
+    const int   M     = 600;
+    const float alpha = 1.0f;
+
+    host_vector<float> hA(size_t(M) * M), hB(size_t(M) * M), hB_gold(size_t(M) * M);
+    hipblas_init_matrix(hA, arg, M, M, M, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, M, M, M, 0, 1, hipblas_client_never_set_nan);
+    // Diagonally dominant A for a well conditioned solve
+    for(int i = 0; i < M; i++)
+        hA[i + size_t(i) * M] += 400;
+    hB_gold = hB;
+
+    device_vector<float> dA(hA.size()), dB(hB.size());
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+
+    CHECK_HIPBLAS_ERROR(hipblasStrsm(handle,
+                                     HIPBLAS_SIDE_LEFT,
+                                     HIPBLAS_FILL_MODE_LOWER,
+                                     HIPBLAS_OP_N,
+                                     HIPBLAS_DIAG_NON_UNIT,
+                                     M,
+                                     M,
+                                     &alpha,
+                                     dA,
+                                     M,
+                                     dB,
+                                     M));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipMemcpy(hB, dB, sizeof(float) * hB.size(), hipMemcpyDeviceToHost));
+
+    cblas_trsm<float>(HIPBLAS_SIDE_LEFT,
+                      HIPBLAS_FILL_MODE_LOWER,
+                      HIPBLAS_OP_N,
+                      HIPBLAS_DIAG_NON_UNIT,
+                      M,
+                      M,
+                      alpha,
+                      hA,
+                      M,
+                      hB_gold,
+                      M);
+
+    if(arg.unit_check)
+    {
+        double tolerance = std::numeric_limits<float>::epsilon() * 40 * M;
+        near_check_general<float>(M, M, M, hB_gold, hB, tolerance);
+    }
+
+    // Return workspace allocation to the library
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspaceAlloc(handle, HIPBLAS_WORKSPACE_ALLOC_DEFAULT, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceAlloc(handle, &alloc, &pool));
+    EXPECT_EQ(HIPBLAS_WORKSPACE_ALLOC_DEFAULT, alloc);
+    EXPECT_EQ(nullptr, pool);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
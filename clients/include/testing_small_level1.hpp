@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasSmallLevel1Model = ArgumentModel<e_N, e_alpha, e_incx, e_incy>;
+
+inline void testname_small_level1(const Arguments& arg, std::string& name)
+{
+    hipblasSmallLevel1Model{}.test_name(arg, name);
+}
+
+// Checks axpy, scal, copy and dot against the CPU reference at the sizes the single launch kernels
+// of BUILD_WITH_SMALL_LEVEL1 take, up to 1024 elements, and just past them, with negative
+// increments and with the scalars and the dot result in device memory as well as on the host
+template <typename T>
+inline hipblasStatus_t testing_small_level1(const Arguments& arg)
+{
+    int N       = arg.N;
+    int incx    = arg.incx;
+    int incy    = arg.incy;
+    T   h_alpha = arg.get_alpha<T>();
+
+    int    abs_incx = incx >= 0 ? incx : -incx;
+    int    abs_incy = incy >= 0 ? incy : -incy;
+    size_t sizeX    = std::max(size_t(N) * abs_incx, size_t(1));
+    size_t sizeY    = std::max(size_t(N) * abs_incy, size_t(1));
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T> hx(sizeX);
+    host_vector<T> hy(sizeY);
+    host_vector<T> hy_cpu(sizeY);
+    host_vector<T> hy_gpu(sizeY);
+    host_vector<T> hx_cpu(sizeX);
+    host_vector<T> hx_gpu(sizeX);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy(sizeY);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_result(1);
+
+    hipblas_init_vector(hx, arg, N, abs_incx, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hy, arg, N, abs_incy, 0, 1, hipblas_client_never_set_nan, false);
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    for(auto pointer_mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+    {
+        bool     device = pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+        const T* alpha  = device ? (const T*)d_alpha : &h_alpha;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, pointer_mode));
+
+        // axpy
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * sizeX, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * sizeY, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasAxpy<T>(handle, N, alpha, dx, incx, dy, incy));
+        CHECK_HIP_ERROR(hipMemcpy(hy_gpu, dy, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+        hy_cpu = hy;
+        cblas_axpy<T>(N, h_alpha, hx.data(), incx, hy_cpu.data(), incy);
+        if(arg.unit_check)
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_gpu.data());
+
+        // scal, which leaves x as it is for a negative incx
+        CHECK_HIPBLAS_ERROR(hipblasScal<T>(handle, N, alpha, dx, incx));
+        CHECK_HIP_ERROR(hipMemcpy(hx_gpu, dx, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+
+        hx_cpu = hx;
+        cblas_scal<T, T>(N, h_alpha, hx_cpu.data(), incx);
+        if(arg.unit_check)
+            unit_check_general<T>(1, N, abs_incx, hx_cpu.data(), hx_gpu.data());
+
+        // copy
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * sizeX, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * sizeY, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasCopy<T>(handle, N, dx, incx, dy, incy));
+        CHECK_HIP_ERROR(hipMemcpy(hy_gpu, dy, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+        hy_cpu = hy;
+        cblas_copy<T>(N, hx.data(), incx, hy_cpu.data(), incy);
+        if(arg.unit_check)
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_gpu.data());
+
+        // dot, where only a device result takes the single launch kernel
+        T cpu_result, gpu_result;
+        if(device)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasDot<T>(handle, N, dx, incx, dy, incy, d_result));
+            CHECK_HIP_ERROR(hipMemcpy(&gpu_result, d_result, sizeof(T), hipMemcpyDeviceToHost));
+        }
+        else
+            CHECK_HIPBLAS_ERROR(hipblasDot<T>(handle, N, dx, incx, dy, incy, &gpu_result));
+
+        cblas_dot<T>(N, hx.data(), incx, hy_cpu.data(), incy, &cpu_result);
+        if(arg.unit_check)
+            unit_check_general<T>(1, 1, 1, &cpu_result, &gpu_result);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
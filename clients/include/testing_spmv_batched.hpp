@@ -171,13 +171,16 @@ inline hipblasStatus_t testing_spmv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            timer.record(iter);
             CHECK_HIPBLAS_ERROR(hipblasSpmvBatchedFn(handle,
                                                      uplo,
                                                      M,
@@ -190,6 +193,7 @@ inline hipblasStatus_t testing_spmv_batched(const Arguments& arg)
                                                      incy,
                                                      batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasSpmvBatchedModel{}.log_args<T>(std::cout,
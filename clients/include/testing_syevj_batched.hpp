@@ -0,0 +1,261 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasSyevjBatchedModel = ArgumentModel<e_uplo, e_N, e_lda, e_batch_count>;
+
+inline void testname_syevj_batched(const Arguments& arg, std::string& name)
+{
+    hipblasSyevjBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_syevj_batched_bad_arg(const Arguments& arg)
+{
+    using U                    = real_t<T>;
+    auto hipblasSyevjBatchedFn = hipblasSyevjBatched<T, U>;
+
+    hipblasLocalHandle      handle(arg);
+    const int               N           = 10;
+    const int               lda         = 11;
+    const int               batch_count = 2;
+    const size_t            A_size      = size_t(lda) * N;
+    const hipblasStride     strideW     = N;
+    const hipblasEigMode_t  jobz        = HIPBLAS_EIG_MODE_VECTOR;
+    const hipblasFillMode_t uplo        = HIPBLAS_FILL_MODE_UPPER;
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_vector<U>       dW(strideW * batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    auto syevj = [&](int n, T* const* A, int lda, int sweeps, U* W, int* info, int bc) {
+        return hipblasSyevjBatchedFn(
+            handle, jobz, uplo, n, A, lda, 0, sweeps, 1, W, strideW, info, bc);
+    };
+
+    EXPECT_HIPBLAS_STATUS(syevj(-1, dA.ptr_on_device(), lda, 100, dW, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(syevj(N, dA.ptr_on_device(), N - 1, 100, dW, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(syevj(N, dA.ptr_on_device(), lda, 0, dW, dInfo, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(syevj(N, dA.ptr_on_device(), lda, 100, dW, dInfo, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0 or batch_count == 0, nothing is computed
+    EXPECT_HIPBLAS_STATUS(syevj(0, dA.ptr_on_device(), lda, 100, dW, dInfo, batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_HIPBLAS_STATUS(syevj(N, dA.ptr_on_device(), lda, 100, dW, dInfo, 0),
+                          HIPBLAS_STATUS_SUCCESS);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_syevj_batched(const Arguments& arg)
+{
+    using U                    = real_t<T>;
+    auto hipblasSyevjBatchedFn = hipblasSyevjBatched<T, U>;
+
+    hipblasFillMode_t uplo        = char2hipblas_fill(arg.uplo);
+    int               N           = arg.N;
+    int               lda         = arg.lda;
+    int               batch_count = arg.batch_count;
+
+    size_t        A_size  = size_t(lda) * N;
+    hipblasStride strideW = N;
+    size_t        W_size  = strideW * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hV(A_size, 1, batch_count);
+    host_vector<T>       hAV(A_size);
+    host_vector<T>       hVW(A_size);
+    host_vector<U>       hW(W_size);
+    host_vector<U>       hW1(W_size);
+    host_vector<int>     hInfo1(batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_vector<U>       dW(W_size);
+    device_vector<int>     dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU, symmetric (Hermitian) positive definite
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hipblas_init<T>(hA[b], N, N, lda);
+        prepare_positive_definite(hA[b], lda, hAV.data(), N);
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSyevjBatchedFn(handle,
+                                                  HIPBLAS_EIG_MODE_VECTOR,
+                                                  uplo,
+                                                  N,
+                                                  dA.ptr_on_device(),
+                                                  lda,
+                                                  0,
+                                                  100,
+                                                  1,
+                                                  dW,
+                                                  strideW,
+                                                  dInfo,
+                                                  batch_count));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hV.transfer_from(dA));
+        CHECK_HIP_ERROR(hipMemcpy(hW1, dW, W_size * sizeof(U), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        // The eigenvectors are checked through the residual A V - V diag(W), as their signs or
+        // phases may differ from LAPACK
+        int            lwork = std::max(1, 3 * N);
+        host_vector<T> work(lwork);
+        host_vector<U> rwork(std::max(1, 3 * N - 2));
+        host_vector<T> hA_ref(A_size);
+
+        hipblas_error = 0.0;
+        for(int b = 0; b < batch_count; b++)
+        {
+            U* hWb = hW1.data() + b * strideW;
+
+            std::copy(hA[b], hA[b] + A_size, hA_ref.begin());
+            cblas_syev<T, U>('N',
+                             arg.uplo,
+                             N,
+                             hA_ref.data(),
+                             lda,
+                             hW.data() + b * strideW,
+                             work.data(),
+                             lwork,
+                             rwork.data());
+
+            cblas_gemm<T>(HIPBLAS_OP_N,
+                          HIPBLAS_OP_N,
+                          N,
+                          N,
+                          N,
+                          T(1),
+                          hA[b],
+                          lda,
+                          hV[b],
+                          lda,
+                          T(0),
+                          hAV.data(),
+                          lda);
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < N; i++)
+                    hVW[i + j * lda] = hV[b][i + j * lda] * T(hWb[j]);
+
+            hipblas_error += norm_check_general<T>('F', N, N, lda, hVW.data(), hAV.data());
+        }
+        hipblas_error
+            += norm_check_general<U>('F', N, 1, N, strideW, hW.data(), hW1.data(), batch_count);
+
+        if(arg.unit_check)
+        {
+            U                eps       = std::numeric_limits<U>::epsilon();
+            double           tolerance = N * eps * 100;
+            host_vector<int> hInfo(batch_count, 0);
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, batch_count, 1, hInfo.data(), hInfo1.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
+
+            CHECK_HIPBLAS_ERROR(hipblasSyevjBatchedFn(handle,
+                                                      HIPBLAS_EIG_MODE_VECTOR,
+                                                      uplo,
+                                                      N,
+                                                      dA.ptr_on_device(),
+                                                      lda,
+                                                      0,
+                                                      100,
+                                                      1,
+                                                      dW,
+                                                      strideW,
+                                                      dInfo,
+                                                      batch_count));
+        }
+        timer.stop();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasSyevjBatchedModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               ArgumentLogging::NA_value,
+                                               ArgumentLogging::NA_value,
+                                               hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -142,11 +142,14 @@ inline hipblasStatus_t testing_tbmv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTbmvBatchedFn(handle,
                                                      uplo,
@@ -160,6 +163,7 @@ inline hipblasStatus_t testing_tbmv_batched(const Arguments& arg)
                                                      incx,
                                                      batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasTbmvBatchedModel{}.log_args<T>(std::cout,
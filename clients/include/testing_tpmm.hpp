@@ -0,0 +1,294 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTpmmModel
+    = ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_alpha, e_ldb, e_batch_count>;
+
+inline void testname_tpmm(const Arguments& arg, std::string& name)
+{
+    hipblasTpmmModel{}.test_name(arg, name);
+}
+
+template <typename T>
+struct hipblas_tpmm_functions;
+
+template <>
+struct hipblas_tpmm_functions<float>
+{
+    static constexpr auto tpmm               = hipblasStpmm;
+    static constexpr auto tpmmBatched        = hipblasStpmmBatched;
+    static constexpr auto tpmmStridedBatched = hipblasStpmmStridedBatched;
+    static constexpr auto tpsm               = hipblasStpsm;
+    static constexpr auto tpsmBatched        = hipblasStpsmBatched;
+    static constexpr auto tpsmStridedBatched = hipblasStpsmStridedBatched;
+};
+
+template <>
+struct hipblas_tpmm_functions<hipblasComplex>
+{
+    static constexpr auto tpmm               = hipblasCtpmm;
+    static constexpr auto tpmmBatched        = hipblasCtpmmBatched;
+    static constexpr auto tpmmStridedBatched = hipblasCtpmmStridedBatched;
+    static constexpr auto tpsm               = hipblasCtpsm;
+    static constexpr auto tpsmBatched        = hipblasCtpsmBatched;
+    static constexpr auto tpsmStridedBatched = hipblasCtpsmStridedBatched;
+};
+
+// Checks tpmm against trmm on the CPU with the unpacked A, and tpsm with a right hand side made by
+// trmm from a known solution, for each form. The plain and batched forms run in host pointer
+// mode and the strided batched form in device pointer mode.
+template <typename T>
+inline hipblasStatus_t testing_tpmm(const Arguments& arg)
+{
+    using F = hipblas_tpmm_functions<T>;
+
+    hipblasSideMode_t  side   = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(arg.diag);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int ldb         = arg.ldb;
+    int batch_count = arg.batch_count;
+    int K           = side == HIPBLAS_SIDE_LEFT ? M : N;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || batch_count < 0 || ldb < std::max(1, M))
+    {
+        return F::tpmmStridedBatched(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     M,
+                                     N,
+                                     &h_alpha,
+                                     nullptr,
+                                     0,
+                                     nullptr,
+                                     ldb,
+                                     0,
+                                     batch_count);
+    }
+
+    const hipblasStride stride_A  = hipblasStride(K) * K;
+    const hipblasStride stride_AP = hipblasStride(K) * (K + 1) / 2;
+    const hipblasStride stride_B  = hipblasStride(ldb) * N;
+
+    // The plain forms run on the first matrices even when batch_count is 0
+    const int    batches = std::max(batch_count, 1);
+    const size_t size_A  = std::max(stride_A * batches, hipblasStride(1));
+    const size_t size_AP = std::max(stride_AP * batches, hipblasStride(1));
+    const size_t size_B  = std::max(stride_B * batches, hipblasStride(1));
+
+    host_vector<T> hA(size_A);
+    host_vector<T> hAP(size_AP);
+    host_vector<T> hB(size_B);
+    host_vector<T> hB_mm_gold(size_B);
+    host_vector<T> hB_sm(size_B);
+    host_vector<T> hB_result(size_B);
+
+    srand(1);
+    hipblas_init<T>(hA);
+    hipblas_init<T>(hB);
+
+    // A is made diagonally dominant so that the solves are well conditioned, then packed
+    for(int b = 0; b < batches; b++)
+    {
+        for(int j = 0; j < K; j++)
+        {
+            hA[b * stride_A + j + size_t(j) * K] += T(10 * K);
+
+            int    i_begin = uplo == HIPBLAS_FILL_MODE_UPPER ? 0 : j;
+            int    i_end   = uplo == HIPBLAS_FILL_MODE_UPPER ? j + 1 : K;
+            size_t offset  = uplo == HIPBLAS_FILL_MODE_UPPER ? size_t(j) * (j + 1) / 2
+                                                             : size_t(j) * (2 * K - j + 1) / 2;
+            for(int i = i_begin; i < i_end; i++)
+                hAP[b * stride_AP + offset + i - i_begin] = hA[b * stride_A + i + size_t(j) * K];
+        }
+    }
+
+    // hB_sm is the right hand side of tpsm whose solution is hB
+    hB_mm_gold = hB;
+    hB_sm      = hB;
+    for(int b = 0; b < batches; b++)
+    {
+        cblas_trmm<T>(side,
+                      uplo,
+                      transA,
+                      diag,
+                      M,
+                      N,
+                      h_alpha,
+                      hA.data() + b * stride_A,
+                      K,
+                      hB_mm_gold.data() + b * stride_B,
+                      ldb);
+        cblas_trmm<T>(side,
+                      uplo,
+                      transA,
+                      diag,
+                      M,
+                      N,
+                      T(1.0) / h_alpha,
+                      hA.data() + b * stride_A,
+                      K,
+                      hB_sm.data() + b * stride_B,
+                      ldb);
+    }
+
+    device_vector<T> dAP(size_AP);
+    device_vector<T> dB(size_B);
+    device_vector<T> d_alpha(1);
+    CHECK_HIP_ERROR(hipMemcpy(dAP, hAP, sizeof(T) * size_AP, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // The relative norm of the error is not defined for empty matrices
+    real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+    double    tolerance = eps * 40 * K;
+    bool      check     = arg.unit_check && M && N;
+
+    // Copies hB_in to dB, then compares the batch_check first matrices of B with the gold after fn
+    auto run = [&](auto fn, host_vector<T>& hB_in, host_vector<T>& hB_gold, int batch_check) {
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB_in, sizeof(T) * size_B, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(fn());
+        CHECK_HIP_ERROR(hipMemcpy(hB_result, dB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+        if(check && batch_check)
+            unit_check_error(
+                norm_check_general<T>('F', M, N, ldb, stride_B, hB_gold, hB_result, batch_check),
+                tolerance);
+        return HIPBLAS_STATUS_SUCCESS;
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(run(
+        [&]() { return F::tpmm(handle, side, uplo, transA, diag, M, N, &h_alpha, dAP, dB, ldb); },
+        hB,
+        hB_mm_gold,
+        std::min(batch_count, 1)));
+    CHECK_HIPBLAS_ERROR(run(
+        [&]() { return F::tpsm(handle, side, uplo, transA, diag, M, N, &h_alpha, dAP, dB, ldb); },
+        hB_sm,
+        hB,
+        std::min(batch_count, 1)));
+
+    // The batched forms run on copies of the matrices in batch vectors
+    host_batch_vector<T>   hAP_batch(std::max(stride_AP, hipblasStride(1)), 1, batch_count);
+    host_batch_vector<T>   hB_batch(std::max(stride_B, hipblasStride(1)), 1, batch_count);
+    host_batch_vector<T>   hB_gold_batch(std::max(stride_B, hipblasStride(1)), 1, batch_count);
+    device_batch_vector<T> dAP_batch(std::max(stride_AP, hipblasStride(1)), 1, batch_count);
+    device_batch_vector<T> dB_batch(std::max(stride_B, hipblasStride(1)), 1, batch_count);
+    for(int b = 0; b < batch_count; b++)
+        std::copy(hAP.data() + b * stride_AP, hAP.data() + (b + 1) * stride_AP, hAP_batch[b]);
+    CHECK_HIP_ERROR(dAP_batch.transfer_from(hAP_batch));
+
+    for(int solve = 0; solve < 2; solve++)
+    {
+        host_vector<T>& hB_in   = solve ? hB_sm : hB;
+        host_vector<T>& hB_gold = solve ? hB : hB_mm_gold;
+        for(int b = 0; b < batch_count; b++)
+        {
+            std::copy(hB_in.data() + b * stride_B, hB_in.data() + (b + 1) * stride_B, hB_batch[b]);
+            std::copy(hB_gold.data() + b * stride_B,
+                      hB_gold.data() + (b + 1) * stride_B,
+                      hB_gold_batch[b]);
+        }
+        CHECK_HIP_ERROR(dB_batch.transfer_from(hB_batch));
+        auto fn = solve ? F::tpsmBatched : F::tpmmBatched;
+        CHECK_HIPBLAS_ERROR(fn(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               M,
+                               N,
+                               &h_alpha,
+                               dAP_batch.ptr_on_device(),
+                               dB_batch.ptr_on_device(),
+                               ldb,
+                               batch_count));
+        CHECK_HIP_ERROR(hB_batch.transfer_from(dB_batch));
+        if(check)
+            unit_check_error(
+                norm_check_general<T>('F', M, N, ldb, hB_gold_batch, hB_batch, batch_count),
+                tolerance);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(run(
+        [&]() {
+            return F::tpmmStridedBatched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         M,
+                                         N,
+                                         d_alpha,
+                                         dAP,
+                                         stride_AP,
+                                         dB,
+                                         ldb,
+                                         stride_B,
+                                         batch_count);
+        },
+        hB,
+        hB_mm_gold,
+        batch_count));
+    CHECK_HIPBLAS_ERROR(run(
+        [&]() {
+            return F::tpsmStridedBatched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         M,
+                                         N,
+                                         d_alpha,
+                                         dAP,
+                                         stride_AP,
+                                         dB,
+                                         ldb,
+                                         stride_B,
+                                         batch_count);
+        },
+        hB_sm,
+        hB,
+        batch_count));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
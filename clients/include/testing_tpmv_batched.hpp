@@ -133,11 +133,14 @@ inline hipblasStatus_t testing_tpmv_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTpmvBatchedFn(handle,
                                                      uplo,
@@ -149,6 +152,7 @@ inline hipblasStatus_t testing_tpmv_batched(const Arguments& arg)
                                                      incx,
                                                      batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
 
         hipblasTpmvBatchedModel{}.log_args<T>(std::cout,
@@ -0,0 +1,203 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTransposeExModel = ArgumentModel<e_M, e_N, e_lda, e_ldc, e_batch_count>;
+
+inline void testname_transpose_ex(const Arguments& arg, std::string& name)
+{
+    hipblasTransposeExModel{}.test_name(arg, name);
+}
+
+// C_b := A_b^T on the CPU
+template <typename T>
+inline void hipblas_transpose_ex_reference(int           M,
+                                           int           N,
+                                           const T*      A,
+                                           int           lda,
+                                           hipblasStride stride_A,
+                                           T*            C,
+                                           int           ldc,
+                                           hipblasStride stride_C,
+                                           int           batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                C[j + i * size_t(ldc) + b * stride_C] = A[i + j * size_t(lda) + b * stride_A];
+}
+
+// Checks the out-of-place, in-place and converting transposes against the CPU. The transpose
+// kernels are optional, and without them only out-of-place float and double transposes are
+// supported, so HIPBLAS_STATUS_NOT_SUPPORTED skips the check of a call.
+template <typename T>
+inline hipblasStatus_t testing_transpose_ex(const Arguments& arg)
+{
+    int M           = arg.M;
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int ldc         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    hipDataType type = std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+
+    hipblasLocalHandle handle(arg);
+
+    // Argument checks
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTransposeEx(handle, M, N, nullptr, type, M - 1, nullptr, type, ldc),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTransposeEx(handle, M, N, nullptr, type, lda, nullptr, type, N - 1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTransposeStridedBatchedEx(
+            handle, M, N, nullptr, type, lda, 0, nullptr, type, ldc, 0, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(M < 0 || N < 0 || lda < std::max(1, M) || ldc < std::max(1, N) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Quick return, with null matrices
+    EXPECT_HIPBLAS_STATUS(
+        hipblasTransposeStridedBatchedEx(
+            handle, M, N, nullptr, type, lda, 0, nullptr, type, ldc, 0, 0),
+        HIPBLAS_STATUS_SUCCESS);
+    if(!M || !N || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStride stride_A = size_t(lda) * N;
+    hipblasStride stride_C = size_t(ldc) * M;
+    size_t        size_A   = stride_A * batch_count;
+    size_t        size_C   = stride_C * batch_count;
+
+    host_vector<T>   hA(size_A);
+    host_vector<T>   hC(size_C);
+    host_vector<T>   hC_cpu(size_C);
+    device_vector<T> dA(size_A);
+    device_vector<T> dC(size_C);
+
+    hipblas_init_matrix(
+        hA, arg, M, N, lda, stride_A, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(
+        hC, arg, N, M, ldc, stride_C, batch_count, hipblas_client_never_set_nan, false);
+    hC_cpu = hC;
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * size_C, hipMemcpyHostToDevice));
+    hipblas_transpose_ex_reference(
+        M, N, hA.data(), lda, stride_A, hC_cpu.data(), ldc, stride_C, batch_count);
+
+    // Only a square A can be transposed in place
+    if(M != N)
+        EXPECT_HIPBLAS_STATUS(hipblasTransposeEx(handle, M, N, dA, type, lda, dA, type, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    // Out of place, first matrix only and then all of them
+    CHECK_HIPBLAS_ERROR(hipblasTransposeEx(handle, M, N, dA, type, lda, dC, type, ldc));
+    host_vector<T> hC_gpu(size_C);
+    CHECK_HIP_ERROR(hipMemcpy(hC_gpu, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+    if(arg.unit_check)
+        unit_check_general<T>(N, M, ldc, hC_cpu.data(), hC_gpu.data());
+
+    hipblasStatus_t status = hipblasTransposeStridedBatchedEx(
+        handle, M, N, dA, type, lda, stride_A, dC, type, ldc, stride_C, batch_count);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipMemcpy(hC_gpu, dC, sizeof(T) * size_C, hipMemcpyDeviceToHost));
+        if(arg.unit_check)
+            unit_check_general<T>(N, M, batch_count, ldc, stride_C, hC_cpu.data(), hC_gpu.data());
+    }
+
+    // In place
+    if(M == N && lda == ldc)
+    {
+        status = hipblasTransposeStridedBatchedEx(
+            handle, M, N, dA, type, lda, stride_A, dA, type, lda, stride_A, batch_count);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            CHECK_HIP_ERROR(hipMemcpy(hC_gpu, dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+            if(arg.unit_check)
+                unit_check_general<T>(
+                    N, M, batch_count, ldc, stride_C, hC_cpu.data(), hC_gpu.data());
+            CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+        }
+    }
+
+    // float to half and bfloat16, compared as float with the rounding of the client conversions
+    if constexpr(std::is_same_v<T, float>)
+    {
+        host_vector<hipblasHalf>       hC_half(size_C);
+        host_vector<hipblasBfloat16>   hC_bf16(size_C);
+        device_vector<hipblasHalf>     dC_half(size_C);
+        device_vector<hipblasBfloat16> dC_bf16(size_C);
+        host_vector<float>             hC_rounded(size_C);
+
+        status = hipblasTransposeStridedBatchedEx(
+            handle, M, N, dA, type, lda, stride_A, dC_half, HIP_R_16F, ldc, stride_C, batch_count);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            CHECK_HIP_ERROR(hipMemcpy(
+                hC_half, dC_half, sizeof(hipblasHalf) * size_C, hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < size_C; i++)
+            {
+                hC_rounded[i] = half_to_float(float_to_half(hC_cpu[i]));
+                hC_gpu[i]     = half_to_float(hC_half[i]);
+            }
+            if(arg.unit_check)
+                unit_check_general<float>(
+                    N, M, batch_count, ldc, stride_C, hC_rounded.data(), hC_gpu.data());
+        }
+
+        status = hipblasTransposeStridedBatchedEx(
+            handle, M, N, dA, type, lda, stride_A, dC_bf16, HIP_R_16BF, ldc, stride_C, batch_count);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_SUCCESS);
+            CHECK_HIP_ERROR(hipMemcpy(
+                hC_bf16, dC_bf16, sizeof(hipblasBfloat16) * size_C, hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < size_C; i++)
+            {
+                hC_rounded[i] = bfloat16_to_float(float_to_bfloat16(hC_cpu[i]));
+                hC_gpu[i]     = bfloat16_to_float(hC_bf16[i]);
+            }
+            if(arg.unit_check)
+                unit_check_general<float>(
+                    N, M, batch_count, ldc, stride_C, hC_rounded.data(), hC_gpu.data());
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -91,7 +91,14 @@ inline hipblasStatus_t testing_trsm(const Arguments& arg)
     }
     // proprocess the matrix to avoid ill-conditioned matrix
     std::vector<int> ipiv(K);
-    cblas_getrf(K, K, hA.data(), lda, ipiv.data());
+    hipblas_reference_cache("getrf")
+        .arg(K)
+        .arg(K)
+        .arg(lda)
+        .input(hA.data(), A_size)
+        .output(hA.data(), A_size)
+        .output(ipiv.data(), K)
+        .run([&] { cblas_getrf(K, K, hA.data(), lda, ipiv.data()); });
     for(int i = 0; i < K; i++)
     {
         for(int j = i; j < K; j++)
@@ -116,8 +123,23 @@ inline hipblasStatus_t testing_trsm(const Arguments& arg)
     hB_gold = hB_host; // original solution hX
 
     // Calculate hB = hA*hX;
-    cblas_trmm<T>(
-        side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA, lda, hB_host, ldb);
+    hipblas_reference_cache("trmm")
+        .arg(side)
+        .arg(uplo)
+        .arg(transA)
+        .arg(diag)
+        .arg(M)
+        .arg(N)
+        .arg(h_alpha)
+        .arg(lda)
+        .arg(ldb)
+        .input(hA.data(), A_size)
+        .input(hB_host.data(), B_size)
+        .output(hB_host.data(), B_size)
+        .run([&] {
+            cblas_trmm<T>(
+                side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA, lda, hB_host, ldb);
+        });
 
     hB_device = hB_host;
 
@@ -170,15 +192,19 @@ inline hipblasStatus_t testing_trsm(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasTrsmFn(handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasTrsmModel{}.log_args<T>(std::cout,
@@ -272,13 +272,16 @@ inline hipblasStatus_t testing_trsm_batched_ex(const Arguments& arg)
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
                                                        side,
@@ -297,6 +300,7 @@ inline hipblasStatus_t testing_trsm_batched_ex(const Arguments& arg)
                                                        TRSM_BLOCK * K,
                                                        arg.compute_type));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasTrsmBatchedExModel{}.log_args<T>(std::cout,
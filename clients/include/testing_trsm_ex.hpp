@@ -243,11 +243,14 @@ inline hipblasStatus_t testing_trsm_ex(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsmExFn(handle,
                                                 side,
@@ -265,6 +268,7 @@ inline hipblasStatus_t testing_trsm_ex(const Arguments& arg)
                                                 TRSM_BLOCK * K,
                                                 arg.compute_type));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasTrsmExModel{}.log_args<T>(std::cout,
@@ -278,3 +282,125 @@ inline hipblasStatus_t testing_trsm_ex(const Arguments& arg)
 
     return HIPBLAS_STATUS_SUCCESS;
 }
+
+// Solves against an A with a factor from hipblasTrsmPrepare, through the typed trsm and through
+// hipblasTrsmEx without an invA, then again after A is overwritten and the factor updated.
+template <typename T>
+inline hipblasStatus_t testing_trsm_prepare(const Arguments& arg)
+{
+    bool FORTRAN       = arg.fortran;
+    auto hipblasTrsmFn = FORTRAN ? hipblasTrsm<T, true> : hipblasTrsm<T, false>;
+
+    hipblasSideMode_t  side   = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(arg.diag);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    int    K      = (side == HIPBLAS_SIDE_LEFT ? M : N);
+    size_t A_size = size_t(lda) * K;
+    size_t B_size = size_t(ldb) * N;
+
+    // Only valid problems, which the other tests check the arguments of
+    if(M <= 0 || N <= 0 || lda < K || ldb < M)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipDataType compute_type = std::is_same_v<T, float>            ? HIP_R_32F
+                               : std::is_same_v<T, double>         ? HIP_R_64F
+                               : std::is_same_v<T, hipblasComplex> ? HIP_C_32F
+                                                                   : HIP_C_64F;
+
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB_init(B_size);
+    host_vector<T> hB_gold(B_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    hipblasTrsmFactor_t factor = nullptr;
+    for(int update = 0; update < 2; update++)
+    {
+        // A well conditioned triangular A, from the factors of a random matrix
+        hipblas_init_matrix(hA, arg, K, K, lda, 0, 1, hipblas_client_never_set_nan, true);
+        host_vector<int> ipiv(K);
+        cblas_getrf(K, K, hA.data(), lda, ipiv.data());
+        for(int i = 0; i < K; i++)
+        {
+            for(int j = i; j < K; j++)
+            {
+                hA[i + j * lda] = hA[j + i * lda];
+                if(diag == HIPBLAS_DIAG_UNIT && i == j)
+                    hA[i + j * lda] = 1.0;
+            }
+        }
+        hipblas_init_matrix(hB_init, arg, M, N, ldb, 0, 1, hipblas_client_never_set_nan);
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+        if(!update)
+        {
+            CHECK_HIPBLAS_ERROR(
+                hipblasTrsmPrepare(handle, uplo, diag, K, dA, lda, compute_type, &factor));
+
+            hipblasTrsmFactor_t other;
+            EXPECT_HIPBLAS_STATUS(
+                hipblasTrsmPrepare(handle, uplo, diag, K, dA, lda, compute_type, &other),
+                HIPBLAS_STATUS_INVALID_VALUE);
+        }
+        else
+            CHECK_HIPBLAS_ERROR(hipblasTrsmFactorUpdate(handle, factor));
+
+        const void* invA;
+        int         invA_size;
+        CHECK_HIPBLAS_ERROR(hipblasTrsmFactorGetInvA(factor, &invA, &invA_size));
+        EXPECT_EQ(invA_size, TRSM_BLOCK * K);
+
+        hB_gold = hB_init;
+        cblas_trsm<T>(
+            side, uplo, transA, diag, M, N, h_alpha, (const T*)hA.data(), lda, hB_gold.data(), ldb);
+
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 40 * M;
+
+        for(bool ex : {false, true})
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dB, hB_init, sizeof(T) * B_size, hipMemcpyHostToDevice));
+            if(ex)
+                CHECK_HIPBLAS_ERROR(hipblasTrsmEx(handle,
+                                                  side,
+                                                  uplo,
+                                                  transA,
+                                                  diag,
+                                                  M,
+                                                  N,
+                                                  &h_alpha,
+                                                  dA,
+                                                  lda,
+                                                  dB,
+                                                  ldb,
+                                                  nullptr,
+                                                  0,
+                                                  arg.compute_type));
+            else
+                CHECK_HIPBLAS_ERROR(hipblasTrsmFn(
+                    handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb));
+            CHECK_HIP_ERROR(hipMemcpy(hB, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+                unit_check_error(norm_check_general<T>('F', M, N, ldb, hB_gold, hB), tolerance);
+        }
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasTrsmFactorDestroy(factor));
+    CHECK_HIPBLAS_ERROR(hipblasTrsmFactorDestroy(nullptr));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,239 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+struct hipblas_trsm_out_of_place_functions;
+
+template <>
+struct hipblas_trsm_out_of_place_functions<float>
+{
+    static constexpr auto trsm               = hipblasStrsmOutOfPlace;
+    static constexpr auto trsmBatched        = hipblasStrsmBatchedOutOfPlace;
+    static constexpr auto trsmStridedBatched = hipblasStrsmStridedBatchedOutOfPlace;
+};
+
+template <>
+struct hipblas_trsm_out_of_place_functions<hipblasDoubleComplex>
+{
+    static constexpr auto trsm               = hipblasZtrsmOutOfPlace;
+    static constexpr auto trsmBatched        = hipblasZtrsmBatchedOutOfPlace;
+    static constexpr auto trsmStridedBatched = hipblasZtrsmStridedBatchedOutOfPlace;
+};
+
+// Checks each form against trsm on the CPU, with C wider than B, that B keeps its values, and
+// the plain form with C == B, which solves in place.
+template <typename T>
+inline hipblasStatus_t testing_trsm_out_of_place(const Arguments& arg)
+{
+    using F = hipblas_trsm_out_of_place_functions<T>;
+
+    hipblasSideMode_t  side        = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag        = char2hipblas_diagonal(arg.diag);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldb + 1;
+    int                batch_count = std::max(arg.batch_count, 1);
+
+    T h_alpha = arg.get_alpha<T>();
+
+    int K = (side == HIPBLAS_SIDE_LEFT ? M : N);
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || lda < std::max(1, K) || ldb < std::max(1, M))
+    {
+        EXPECT_HIPBLAS_STATUS(F::trsm(handle,
+                                      side,
+                                      uplo,
+                                      transA,
+                                      diag,
+                                      M,
+                                      N,
+                                      &h_alpha,
+                                      nullptr,
+                                      lda,
+                                      nullptr,
+                                      ldb,
+                                      nullptr,
+                                      ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    if(!M || !N)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStride stride_A = hipblasStride(lda) * K;
+    hipblasStride stride_B = hipblasStride(ldb) * N;
+    hipblasStride stride_C = hipblasStride(ldc) * N;
+
+    host_vector<T> hA(stride_A * batch_count);
+    host_vector<T> hB(stride_B * batch_count);
+    host_vector<T> hB_out(stride_B * batch_count);
+    host_vector<T> hC(stride_C * batch_count);
+    host_vector<T> hC_gold(stride_C * batch_count);
+
+    device_vector<T>  dA(hA.size());
+    device_vector<T>  dB(hB.size());
+    device_vector<T>  dC(hC.size());
+    device_vector<T*> dA_array(batch_count);
+    device_vector<T*> dB_array(batch_count);
+    device_vector<T*> dC_array(batch_count);
+
+    // Well conditioned triangular A_i, from the factors of random matrices
+    hipblas_init_matrix(
+        hA, arg, K, K, lda, stride_A, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, M, N, ldb, stride_B, batch_count, hipblas_client_never_set_nan);
+    for(int b = 0; b < batch_count; b++)
+    {
+        T*               hAb = hA.data() + b * stride_A;
+        std::vector<int> ipiv(K);
+        cblas_getrf(K, K, hAb, lda, ipiv.data());
+        for(int i = 0; i < K; i++)
+        {
+            for(int j = i; j < K; j++)
+            {
+                hAb[i + j * lda] = hAb[j + i * lda];
+                if(diag == HIPBLAS_DIAG_UNIT && i == j)
+                    hAb[i + j * lda] = 1.0;
+            }
+        }
+
+        // Only the first M rows of C_i are checked
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < M; i++)
+                hC_gold[b * stride_C + i + j * ldc] = hB[b * stride_B + i + j * ldb];
+        }
+        cblas_trsm<T>(side,
+                      uplo,
+                      transA,
+                      diag,
+                      M,
+                      N,
+                      h_alpha,
+                      (const T*)hAb,
+                      lda,
+                      hC_gold.data() + b * stride_C,
+                      ldc);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dA_array, dA, sizeof(T), stride_A, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dB_array, dB, sizeof(T), stride_B, batch_count));
+    CHECK_HIPBLAS_ERROR(
+        hipblasFillPointerArray(handle, dC_array, dC, sizeof(T), stride_C, batch_count));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+    double    tolerance = eps * 40 * M;
+
+    for(int form = 0; form < 4; form++)
+    {
+        int batches = form == 0 || form == 3 ? 1 : batch_count;
+
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemset(dC, 0, sizeof(T) * hC.size()));
+
+        if(form == 0)
+            CHECK_HIPBLAS_ERROR(F::trsm(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb, dC, ldc));
+        else if(form == 1)
+            CHECK_HIPBLAS_ERROR(F::trsmBatched(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               M,
+                                               N,
+                                               &h_alpha,
+                                               dA_array,
+                                               lda,
+                                               dB_array,
+                                               ldb,
+                                               dC_array,
+                                               ldc,
+                                               batches));
+        else if(form == 2)
+            CHECK_HIPBLAS_ERROR(F::trsmStridedBatched(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      M,
+                                                      N,
+                                                      &h_alpha,
+                                                      dA,
+                                                      lda,
+                                                      stride_A,
+                                                      dB,
+                                                      ldb,
+                                                      stride_B,
+                                                      dC,
+                                                      ldc,
+                                                      stride_C,
+                                                      batches));
+        else
+            // In place, C is B
+            CHECK_HIPBLAS_ERROR(F::trsm(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, dA, lda, dB, ldb, dB, ldb));
+
+        CHECK_HIP_ERROR(hipMemcpy(hB_out, dB, sizeof(T) * hB.size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+
+        if(form == 3)
+        {
+            // The solution is in B; lay it out as C for the check
+            for(int j = 0; j < N; j++)
+            {
+                for(int i = 0; i < M; i++)
+                    hC[i + j * ldc] = hB_out[i + j * ldb];
+            }
+        }
+
+        if(arg.unit_check)
+        {
+            if(form != 3)
+                unit_check_general<T>(M, N, batches, ldb, stride_B, hB, hB_out);
+            unit_check_error(norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC, batches),
+                             tolerance);
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
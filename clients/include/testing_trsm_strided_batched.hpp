@@ -238,13 +238,16 @@ inline hipblasStatus_t testing_trsm_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
+        hipblasEventTimer timer(arg, handle);
+
+        int runs = timer.runs();
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == arg.cold_iters)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            timer.record(iter);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedFn(handle,
                                                             side,
@@ -262,6 +265,7 @@ inline hipblasStatus_t testing_trsm_strided_batched(const Arguments& arg)
                                                             strideB,
                                                             batch_count));
         }
+        timer.stop();
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasTrsmStridedBatchedModel{}.log_args<T>(std::cout,
@@ -275,3 +279,121 @@ inline hipblasStatus_t testing_trsm_strided_batched(const Arguments& arg)
 
     return HIPBLAS_STATUS_SUCCESS;
 }
+
+// Solves a batch against one A shared with stride 0, once with the B_i laid out so that hipBLAS
+// may run the batch as one wider trsm, the columns of one matrix on the left and its rows on the
+// right, and once with a gap between the B_i, for which the rocBLAS backend inverts the diagonal
+// blocks of A once for the batch. Each instance is checked against the CPU.
+template <typename T>
+inline hipblasStatus_t testing_trsm_strided_batched_broadcast(const Arguments& arg)
+{
+    bool FORTRAN = arg.fortran;
+    auto hipblasTrsmStridedBatchedFn
+        = FORTRAN ? hipblasTrsmStridedBatched<T, true> : hipblasTrsmStridedBatched<T, false>;
+
+    hipblasSideMode_t  side        = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag        = char2hipblas_diagonal(arg.diag);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                lda         = arg.lda;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    int K = (side == HIPBLAS_SIDE_LEFT ? M : N);
+
+    // Only valid problems, which the other tests check the arguments of
+    if(M <= 0 || N <= 0 || batch_count <= 0 || lda < K || arg.ldb < M)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // A well conditioned triangular A, from the factors of a random matrix
+    host_vector<T> hA(size_t(lda) * K);
+    hipblas_init_matrix(hA, arg, K, K, lda, 0, 1, hipblas_client_never_set_nan, true);
+    std::vector<int> ipiv(K);
+    cblas_getrf(K, K, hA.data(), lda, ipiv.data());
+    for(int i = 0; i < K; i++)
+    {
+        for(int j = i; j < K; j++)
+        {
+            hA[i + j * lda] = hA[j + i * lda];
+            if(diag == HIPBLAS_DIAG_UNIT && i == j)
+                hA[i + j * lda] = 1.0;
+        }
+    }
+
+    device_vector<T> dA(hA.size());
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+
+    for(bool gap : {false, true})
+    {
+#ifdef __HIP_PLATFORM_NVCC__
+        // cuBLAS has no strided batched trsm, only the merged batch runs there
+        if(gap)
+            continue;
+#endif
+        int           ldb      = arg.ldb;
+        hipblasStride stride_B = size_t(ldb) * N;
+        if(gap)
+            stride_B += ldb;
+        else if(side == HIPBLAS_SIDE_RIGHT)
+        {
+            ldb      = std::max(ldb, M * batch_count);
+            stride_B = M;
+        }
+        size_t B_size = stride_B * (batch_count - 1) + size_t(ldb) * N;
+
+        host_vector<T> hB(B_size), hB_gold(B_size);
+        hipblas_init_matrix(
+            hB, arg, M, N, ldb, stride_B, batch_count, hipblas_client_never_set_nan);
+        hB_gold = hB;
+
+        device_vector<T> dB(B_size);
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedFn(handle,
+                                                        side,
+                                                        uplo,
+                                                        transA,
+                                                        diag,
+                                                        M,
+                                                        N,
+                                                        &h_alpha,
+                                                        dA,
+                                                        lda,
+                                                        0,
+                                                        dB,
+                                                        ldb,
+                                                        stride_B,
+                                                        batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hB, dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+        for(int b = 0; b < batch_count; b++)
+            cblas_trsm<T>(side,
+                          uplo,
+                          transA,
+                          diag,
+                          M,
+                          N,
+                          h_alpha,
+                          (const T*)hA.data(),
+                          lda,
+                          hB_gold.data() + b * stride_B,
+                          ldb);
+
+        if(arg.unit_check)
+        {
+            real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+            double    tolerance = eps * 40 * M;
+            double    error
+                = norm_check_general<T>('F', M, N, ldb, stride_B, hB_gold, hB, batch_count);
+            unit_check_error(error, tolerance);
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
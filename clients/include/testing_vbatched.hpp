@@ -0,0 +1,330 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasVbatchedModel = ArgumentModel<e_N, e_batch_count>;
+
+inline void testname_vbatched(const Arguments& arg, std::string& name)
+{
+    hipblasVbatchedModel{}.test_name(arg, name);
+}
+
+// Sizes of a vbatched test: three sizes around arg.N, so the bins hold several problems, and an
+// empty problem every fourth one. size holds the largest matrix, and is the size of each entry
+// of the batch vectors.
+struct hipblasVbatchedSizes
+{
+    host_vector<int> m, n, lda;
+    size_t           size = 1;
+
+    hipblasVbatchedSizes(int N, int batch_count)
+        : m(batch_count)
+        , n(batch_count)
+        , lda(batch_count)
+    {
+        for(int i = 0; i < batch_count; i++)
+        {
+            m[i]   = i % 4 == 3 ? 0 : N + (i % 3) * 5;
+            n[i]   = N + (i % 2) * 3;
+            lda[i] = m[i] + 1;
+            size   = std::max(size, size_t(lda[i]) * std::max(m[i], n[i]));
+        }
+    }
+};
+
+// Copy of the batch_count entries of a host batch vector
+template <typename T>
+inline void hipblas_copy_batch(host_batch_vector<T>&       to,
+                               const host_batch_vector<T>& from,
+                               size_t                      size,
+                               int                         batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        std::copy(from[b], from[b] + size, to[b]);
+}
+
+// Lower triangular solves from the left, with A_i made diagonally dominant, against the CPU
+inline hipblasStatus_t testing_trsm_vbatched(const Arguments& arg)
+{
+    int N           = arg.N;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasStrsmVbatched(handle,
+                                               HIPBLAS_SIDE_LEFT,
+                                               HIPBLAS_FILL_MODE_LOWER,
+                                               HIPBLAS_OP_N,
+                                               HIPBLAS_DIAG_NON_UNIT,
+                                               nullptr,
+                                               nullptr,
+                                               nullptr,
+                                               nullptr,
+                                               nullptr,
+                                               nullptr,
+                                               nullptr,
+                                               -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(N < 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // A_i is m_i by m_i and B_i is m_i by n_i, with the same leading dimension
+    hipblasVbatchedSizes sizes(N, batch_count);
+    size_t               size = sizes.size;
+
+    host_batch_vector<float> hA(size, 1, batch_count);
+    host_batch_vector<float> hB(size, 1, batch_count);
+    host_batch_vector<float> hB_gold(size, 1, batch_count);
+    hipblas_init(hA, true);
+    hipblas_init(hB);
+    for(int b = 0; b < batch_count; b++)
+        for(int i = 0; i < sizes.m[b]; i++)
+            hA[b][i + size_t(i) * sizes.lda[b]] += 4 * sizes.m[b];
+    hipblas_copy_batch(hB_gold, hB, size, batch_count);
+
+    device_batch_vector<float> dA(size, 1, batch_count);
+    device_batch_vector<float> dB(size, 1, batch_count);
+    device_vector<int>         dm(batch_count), dn(batch_count), dlda(batch_count);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(dm, sizes.m, sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, sizes.n, sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dlda, sizes.lda, sizeof(int) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    float alpha = 2;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasStrsmVbatched(handle,
+                                             HIPBLAS_SIDE_LEFT,
+                                             HIPBLAS_FILL_MODE_LOWER,
+                                             HIPBLAS_OP_N,
+                                             HIPBLAS_DIAG_NON_UNIT,
+                                             dm,
+                                             dn,
+                                             &alpha,
+                                             dA.ptr_on_device(),
+                                             dlda,
+                                             dB.ptr_on_device(),
+                                             dlda,
+                                             batch_count));
+    CHECK_HIP_ERROR(hB.transfer_from(dB));
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    for(int b = 0; b < batch_count; b++)
+    {
+        if(!sizes.m[b])
+            continue;
+        cblas_trsm<float>(HIPBLAS_SIDE_LEFT,
+                          HIPBLAS_FILL_MODE_LOWER,
+                          HIPBLAS_OP_N,
+                          HIPBLAS_DIAG_NON_UNIT,
+                          sizes.m[b],
+                          sizes.n[b],
+                          alpha,
+                          hA[b],
+                          sizes.lda[b],
+                          hB_gold[b],
+                          sizes.lda[b]);
+
+        if(arg.unit_check)
+        {
+            float  eps       = std::numeric_limits<float>::epsilon();
+            double tolerance = eps * 40 * sizes.m[b];
+            double error     = norm_check_general<float>(
+                'F', sizes.m[b], sizes.n[b], sizes.lda[b], hB_gold[b], hB[b]);
+            unit_check_error(error, tolerance);
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// y_i := alpha * A_i x_i + beta * y_i on integer data, so the results match the CPU exactly
+inline hipblasStatus_t testing_gemv_vbatched(const Arguments& arg)
+{
+    int N           = arg.N;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    if(N < 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // A_i is m_i by n_i, and x_i and y_i have increment 1
+    hipblasVbatchedSizes sizes(N, batch_count);
+    size_t               size = sizes.size;
+    host_vector<int>     inc(batch_count, 1);
+
+    host_batch_vector<float> hA(size, 1, batch_count);
+    host_batch_vector<float> hx(size, 1, batch_count);
+    host_batch_vector<float> hy(size, 1, batch_count);
+    host_batch_vector<float> hy_gold(size, 1, batch_count);
+    hipblas_init(hA, true);
+    hipblas_init(hx);
+    hipblas_init(hy);
+    hipblas_copy_batch(hy_gold, hy, size, batch_count);
+
+    device_batch_vector<float> dA(size, 1, batch_count);
+    device_batch_vector<float> dx(size, 1, batch_count);
+    device_batch_vector<float> dy(size, 1, batch_count);
+    device_vector<int>         dm(batch_count), dn(batch_count), dlda(batch_count);
+    device_vector<int>         dinc(batch_count);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(hipMemcpy(dm, sizes.m, sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, sizes.n, sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dlda, sizes.lda, sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dinc, inc, sizeof(int) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    float alpha = 2, beta = -1;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSgemvVbatched(handle,
+                                             HIPBLAS_OP_N,
+                                             dm,
+                                             dn,
+                                             &alpha,
+                                             dA.ptr_on_device(),
+                                             dlda,
+                                             dx.ptr_on_device(),
+                                             dinc,
+                                             &beta,
+                                             dy.ptr_on_device(),
+                                             dinc,
+                                             batch_count));
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    for(int b = 0; b < batch_count; b++)
+    {
+        if(!sizes.m[b])
+            continue;
+        cblas_gemv<float>(HIPBLAS_OP_N,
+                          sizes.m[b],
+                          sizes.n[b],
+                          alpha,
+                          hA[b],
+                          sizes.lda[b],
+                          hx[b],
+                          1,
+                          beta,
+                          hy_gold[b],
+                          1);
+        if(arg.unit_check)
+            unit_check_general<float>(1, sizes.m[b], 1, hy_gold[b], hy[b]);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+#ifdef __HIP_PLATFORM_SOLVER__
+// LU factorizations of m_i by m_i diagonally dominant matrices, against LAPACK
+inline hipblasStatus_t testing_getrf_vbatched(const Arguments& arg)
+{
+    int N           = arg.N;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    if(N < 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasVbatchedSizes sizes(N, batch_count);
+    size_t               size = sizes.size;
+
+    host_batch_vector<float> hA(size, 1, batch_count);
+    host_batch_vector<float> hA_gold(size, 1, batch_count);
+    host_batch_vector<int>   hIpiv(size, 1, batch_count);
+    host_batch_vector<int>   hIpiv_gold(size, 1, batch_count);
+    host_vector<int>         hInfo(batch_count), hInfo_gold(batch_count);
+    hipblas_init(hA, true);
+    for(int b = 0; b < batch_count; b++)
+        for(int i = 0; i < sizes.m[b]; i++)
+            hA[b][i + size_t(i) * sizes.lda[b]] += 400;
+    hipblas_copy_batch(hA_gold, hA, size, batch_count);
+
+    device_batch_vector<float> dA(size, 1, batch_count);
+    device_batch_vector<int>   dIpiv(size, 1, batch_count);
+    device_vector<int>         dInfo(batch_count), dn(batch_count), dlda(batch_count);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemcpy(dn, sizes.m, sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dlda, sizes.lda, sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dInfo, -1, sizeof(int) * batch_count));
+
+    /* =====================================================================
+                HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasSgetrfVbatched(
+        handle, dn, dA.ptr_on_device(), dlda, dIpiv.ptr_on_device(), dInfo, batch_count));
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpiv.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hipMemcpy(hInfo, dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+    /* =====================================================================
+           CPU LAPACK
+    =================================================================== */
+    for(int b = 0; b < batch_count; b++)
+    {
+        int n = sizes.m[b];
+        if(!n)
+            continue;
+        hInfo_gold[b] = cblas_getrf(n, n, hA_gold[b], sizes.lda[b], hIpiv_gold[b]);
+
+        if(arg.unit_check)
+        {
+            double tolerance = std::numeric_limits<float>::epsilon() * 2000;
+            double error
+                = norm_check_general<float>('F', n, n, sizes.lda[b], hA_gold[b], hA[b]);
+            unit_check_error(error, tolerance);
+            unit_check_general<int>(1, n, 1, hIpiv_gold[b], hIpiv[b]);
+        }
+    }
+    if(arg.unit_check)
+        unit_check_general<int>(1, batch_count, 1, hInfo_gold.data(), hInfo.data());
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+#endif
@@ -0,0 +1,112 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_warmup(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_warmup(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipblasWarmupDesc_t descs[3] = {};
+    descs[0].routine             = HIPBLAS_WARMUP_GEMM_EX;
+    descs[0].transA              = HIPBLAS_OP_N;
+    descs[0].transB              = HIPBLAS_OP_T;
+    descs[0].m                   = 128;
+    descs[0].n                   = 64;
+    descs[0].k                   = 32;
+    descs[0].aType               = HIP_R_32F;
+    descs[0].bType               = HIP_R_32F;
+    descs[0].cType               = HIP_R_32F;
+    descs[0].computeType         = HIPBLAS_COMPUTE_32F;
+    descs[0].batchCount          = 1;
+
+    descs[1]            = descs[0];
+    descs[1].batchCount = 4;
+
+    descs[2].routine    = HIPBLAS_WARMUP_TRSM;
+    descs[2].transA     = HIPBLAS_OP_N;
+    descs[2].side       = HIPBLAS_SIDE_LEFT;
+    descs[2].uplo       = HIPBLAS_FILL_MODE_LOWER;
+    descs[2].diag       = HIPBLAS_DIAG_NON_UNIT;
+    descs[2].m          = 96;
+    descs[2].n          = 48;
+    descs[2].aType      = HIP_R_64F;
+    descs[2].batchCount = 1;
+
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(nullptr, 3, descs), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, -1, descs), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, 1, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasWarmupDesc_t bad = descs[0];
+    bad.routine             = hipblasWarmupRoutine_t(2);
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, 1, &bad), HIPBLAS_STATUS_INVALID_ENUM);
+    bad            = descs[0];
+    bad.batchCount = 0;
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, 1, &bad), HIPBLAS_STATUS_INVALID_VALUE);
+    bad       = descs[2];
+    bad.aType = HIP_R_16F;
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, 1, &bad), HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // Warming up leaves the pointer mode of the handle as it was
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasWarmup(handle, 0, nullptr));
+    CHECK_HIPBLAS_ERROR(hipblasWarmup(handle, 3, descs));
+    hipblasPointerMode_t mode;
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_POINTER_MODE_DEVICE, mode);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetLayout(handle, HIPBLAS_ROW_MAJOR));
+    CHECK_HIPBLAS_ERROR(hipblasWarmup(handle, 3, descs));
+    CHECK_HIPBLAS_ERROR(hipblasSetLayout(handle, HIPBLAS_COL_MAJOR));
+
+    // Warming up is not supported while the stream of the handle is captured
+    hipStream_t stream;
+    hipGraph_t  graph;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    hipblasStatus_t status = hipblasWarmup(handle, 3, descs);
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+
+    EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_xt(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_xt_bad_arg(const Arguments& arg)
+{
+    hipblasXtHandle_t handle;
+    int               block_dim = 0;
+    const int         bad_id    = -1;
+
+    EXPECT_HIPBLAS_STATUS(hipblasXtCreate(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasXtCreate(&handle));
+
+    CHECK_HIPBLAS_ERROR(hipblasXtGetBlockDim(handle, &block_dim));
+    EXPECT_EQ(2048, block_dim);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXtSetBlockDim(handle, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasXtGetBlockDim(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasXtDeviceSelect(handle, 0, &bad_id), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasXtDeviceSelect(handle, 1, &bad_id), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasXtDeviceSelect(handle, 1, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasXtDestroy(handle));
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// gemm, syrk and trsm on host matrices spanning several tiles, compared with CPU BLAS
+template <typename T>
+inline hipblasStatus_t testing_xt(const Arguments& arg)
+{
+    using U = real_t<T>;
+
+    const int M = 200, N = 150, K = 130, block_dim = 64;
+    const int lda = M, ldb = K, ldc = M;
+
+    host_vector<T> hA(size_t(lda) * K);
+    host_vector<T> hB(size_t(ldb) * N);
+    host_vector<T> hC(size_t(ldc) * N);
+    host_vector<T> hC_gold(size_t(ldc) * N);
+
+    T h_alpha = 2;
+    T h_beta  = 3;
+
+    hipblasXtHandle_t handle;
+    CHECK_HIPBLAS_ERROR(hipblasXtCreate(&handle));
+    CHECK_HIPBLAS_ERROR(hipblasXtSetBlockDim(handle, block_dim));
+
+    // Make sure set()/get() functions work
+    int block_dim_get = 0;
+    CHECK_HIPBLAS_ERROR(hipblasXtGetBlockDim(handle, &block_dim_get));
+    EXPECT_EQ(block_dim, block_dim_get);
+
+    hipblas_init(hA, true);
+    hipblas_init(hB);
+    hipblas_init(hC);
+    hC_gold = hC;
+
+    // gemm, integer data gives exact results
+    CHECK_HIPBLAS_ERROR(hipblasXtGemm<T>(handle,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_N,
+                                         M,
+                                         N,
+                                         K,
+                                         &h_alpha,
+                                         hA,
+                                         lda,
+                                         hB,
+                                         ldb,
+                                         &h_beta,
+                                         hC,
+                                         ldc));
+    cblas_gemm<T>(HIPBLAS_OP_N,
+                  HIPBLAS_OP_N,
+                  M,
+                  N,
+                  K,
+                  h_alpha,
+                  hA.data(),
+                  lda,
+                  hB.data(),
+                  ldb,
+                  h_beta,
+                  hC_gold.data(),
+                  ldc);
+
+    if(arg.unit_check)
+        unit_check_general<T>(M, N, ldc, hC_gold, hC);
+
+    // syrk of the first N rows of A into the lower triangle of C
+    hC_gold = hC;
+    CHECK_HIPBLAS_ERROR(hipblasXtSyrk<T>(handle,
+                                         HIPBLAS_FILL_MODE_LOWER,
+                                         HIPBLAS_OP_N,
+                                         N,
+                                         K,
+                                         &h_alpha,
+                                         hA,
+                                         lda,
+                                         &h_beta,
+                                         hC,
+                                         ldc));
+    cblas_syrk<T>(
+        HIPBLAS_FILL_MODE_LOWER, HIPBLAS_OP_N, N, K, h_alpha, hA, lda, h_beta, hC_gold, ldc);
+
+    if(arg.unit_check)
+        unit_check_general<T>(N, N, ldc, hC_gold, hC);
+
+    // trsm with the well conditioned lower triangle of an LU factorization, solving for a known X
+    std::vector<int> ipiv(M);
+    host_vector<T>   hT(size_t(lda) * M);
+    host_vector<T>   hX(size_t(ldc) * N);
+
+    hipblas_init(hT);
+    hipblas_init(hX);
+    cblas_getrf(M, M, hT.data(), lda, ipiv.data());
+    for(int i = 0; i < M; i++)
+        hT[i + i * lda] = 1;
+
+    hC = hX;
+    cblas_trmm<T>(HIPBLAS_SIDE_LEFT,
+                  HIPBLAS_FILL_MODE_LOWER,
+                  HIPBLAS_OP_N,
+                  HIPBLAS_DIAG_UNIT,
+                  M,
+                  N,
+                  T(1.0) / h_alpha,
+                  (const T*)hT,
+                  lda,
+                  hC,
+                  ldc);
+    CHECK_HIPBLAS_ERROR(hipblasXtTrsm<T>(handle,
+                                         HIPBLAS_SIDE_LEFT,
+                                         HIPBLAS_FILL_MODE_LOWER,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_DIAG_UNIT,
+                                         M,
+                                         N,
+                                         &h_alpha,
+                                         hT,
+                                         lda,
+                                         hC,
+                                         ldc));
+
+    if(arg.unit_check)
+    {
+        U      eps       = std::numeric_limits<U>::epsilon();
+        double tolerance = eps * 40 * M;
+
+        unit_check_error(norm_check_general<T>('F', M, N, ldc, hX, hC), tolerance);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasXtDestroy(handle));
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -29,11 +29,16 @@
 #ifdef __cplusplus
 #include "cblas_interface.h"
 #include "complex.hpp"
+#include "device_counters.hpp"
+#include "device_telemetry.hpp"
+#include "device_tracer.hpp"
 #include "hipblas_datatype2string.hpp"
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <immintrin.h>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <type_traits>
 #include <vector>
@@ -256,6 +261,13 @@ public:
         return static_cast<signed char>(std::uniform_int_distribution<int>{}(hipblas_rng));
     }
 
+    // Random pointer, for the guards of device pointer arrays
+    template <typename T>
+    explicit operator T*()
+    {
+        return reinterpret_cast<T*>(std::uniform_int_distribution<uintptr_t>{}(hipblas_rng));
+    }
+
     // Random NaN double
     explicit operator double()
     {
@@ -446,9 +458,9 @@ inline hipblasBfloat16 random_hpl_generator()
 /*! \brief  matrix/vector initialization: */
 // for vector x (M=1, N=lengthX, lda=incx);
 // for complex number, the real/imag part would be initialized with the same value
-template <typename T>
+template <typename T, typename Alloc>
 void hipblas_init(
-    std::vector<T>& A, int M, int N, int lda, hipblasStride stride = 0, int batch_count = 1)
+    std::vector<T, Alloc>& A, int M, int N, int lda, hipblasStride stride = 0, int batch_count = 1)
 {
     for(int b = 0; b < batch_count; b++)
         for(int i = 0; i < M; ++i)
@@ -465,8 +477,8 @@ void hipblas_init(T* A, int M, int N, int lda, hipblasStride stride = 0, int bat
                 A[i + j * lda + b * stride] = random_generator<T>();
 }
 
-template <typename T>
-void hipblas_init_alternating_sign(std::vector<T>& A, int M, int N, int lda)
+template <typename T, typename Alloc>
+void hipblas_init_alternating_sign(std::vector<T, Alloc>& A, int M, int N, int lda)
 {
     // Initialize matrix so adjacent entries have alternating sign.
     // In gemm if either A or B are initialized with alernating
@@ -483,9 +495,9 @@ void hipblas_init_alternating_sign(std::vector<T>& A, int M, int N, int lda)
                 A[i + j * lda] = random_generator_negative<T>();
 }
 
-template <typename T>
+template <typename T, typename Alloc>
 void hipblas_init_alternating_sign(
-    std::vector<T>& A, int M, int N, int lda, hipblasStride stride, int batch_count)
+    std::vector<T, Alloc>& A, int M, int N, int lda, hipblasStride stride, int batch_count)
 {
     // Initialize matrix so adjacent entries have alternating sign.
     // In gemm if either A or B are initialized with alernating
@@ -521,17 +533,25 @@ void hipblas_init_hpl_alternating_sign(
         }
 }
 
-template <typename T>
-void hipblas_init_hpl_alternating_sign(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+template <typename T, typename Alloc>
+void hipblas_init_hpl_alternating_sign(std::vector<T, Alloc>& A,
+                                       size_t                 M,
+                                       size_t                 N,
+                                       size_t                 lda,
+                                       size_t                 stride = 0,
+                                       size_t                 batch_count = 1)
 {
     hipblas_init_hpl_alternating_sign(A.data(), M, N, lda, stride, batch_count);
 }
 
 // Initialize vector with HPL-like random values
-template <typename T>
-void hipblas_init_hpl(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+template <typename T, typename Alloc>
+void hipblas_init_hpl(std::vector<T, Alloc>& A,
+                      size_t                 M,
+                      size_t                 N,
+                      size_t                 lda,
+                      size_t                 stride = 0,
+                      size_t                 batch_count = 1)
 {
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
         for(size_t i = 0; i < M; ++i)
@@ -563,9 +583,9 @@ inline void
         }
 }
 
-template <typename T>
+template <typename T, typename Alloc>
 inline void hipblas_init_cos(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count)
+    std::vector<T, Alloc>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count)
 {
     hipblas_init_cos(A.data(), M, N, lda, stride, batch_count);
 }
@@ -584,9 +604,9 @@ inline void
         }
 }
 
-template <typename T>
+template <typename T, typename Alloc>
 inline void hipblas_init_sin(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count)
+    std::vector<T, Alloc>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count)
 {
     hipblas_init_sin(A.data(), M, N, lda, stride, batch_count);
 }
@@ -643,8 +663,8 @@ inline void hipblas_init_sin<hipblasBfloat16>(std::vector<hipblasBfloat16>& A,
 
 /*! \brief  symmetric matrix initialization: */
 // for real matrix only
-template <typename T>
-void hipblas_init_symmetric(std::vector<T>& A, int N, int lda)
+template <typename T, typename Alloc>
+void hipblas_init_symmetric(std::vector<T, Alloc>& A, int N, int lda)
 {
     for(int i = 0; i < N; ++i)
         for(int j = 0; j <= i; ++j)
@@ -656,9 +676,9 @@ void hipblas_init_symmetric(std::vector<T>& A, int N, int lda)
 }
 
 /*! \brief symmetric matrix initialization for strided_batched matricies: */
-template <typename T>
+template <typename T, typename Alloc>
 void hipblas_init_symmetric(
-    std::vector<T>& A, int N, int lda, hipblasStride strideA, int batch_count)
+    std::vector<T, Alloc>& A, int N, int lda, hipblasStride strideA, int batch_count)
 {
     for(int b = 0; b < batch_count; b++)
         for(int off = b * strideA, i = 0; i < N; ++i)
@@ -673,8 +693,8 @@ void hipblas_init_symmetric(
 /*! \brief  hermitian matrix initialization: */
 // for complex matrix only, the real/imag part would be initialized with the same value
 // except the diagonal elment must be real
-template <typename T>
-void hipblas_init_hermitian(std::vector<T>& A, int N, int lda)
+template <typename T, typename Alloc>
+void hipblas_init_hermitian(std::vector<T, Alloc>& A, int N, int lda)
 {
     for(int i = 0; i < N; ++i)
         for(int j = 0; j <= i; ++j)
@@ -694,9 +714,13 @@ inline void hipblas_init_nan(T* A, size_t N)
         A[i] = T(hipblas_nan_rng());
 }
 
-template <typename T>
-inline void hipblass_init_nan(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
+template <typename T, typename Alloc>
+inline void hipblass_init_nan(std::vector<T, Alloc>& A,
+                              size_t                 M,
+                              size_t                 N,
+                              size_t                 lda,
+                              size_t                 stride = 0,
+                              size_t                 batch_count = 1)
 {
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
         for(size_t i = 0; i < M; ++i)
@@ -805,13 +829,13 @@ void make_unit_diagonal(hipblasFillMode_t uplo, T* hA, int lda, int N)
 }
 
 /* ============================================================================================= */
-/*! \brief For testing purposes, prepares matrix hA for a triangular solve.                      *
- *         Makes hA strictly diagonal dominant (SPD), then calculates Cholesky factorization     *
- *         of hA.                                                                                */
+/*! \brief For testing purposes, makes matrix hA symmetric (Hermitian) positive definite.        *
+ *         hA is replaced by hA * hA ^ H with a strictly dominant diagonal. AAT is scratch       *
+ *         of the size of hA.                                                                    */
 template <typename T>
-void prepare_triangular_solve(T* hA, int lda, T* AAT, int N, char char_uplo)
+void prepare_positive_definite(T* hA, int lda, T* AAT, int N)
 {
-    //  calculate AAT = hA * hA ^ T
+    //  calculate AAT = hA * hA ^ H
     cblas_gemm<T>(HIPBLAS_OP_N, HIPBLAS_OP_C, N, N, N, T(1.0), hA, lda, hA, lda, T(0.0), AAT, lda);
 
     //  copy AAT into hA, make hA strictly diagonal dominant, and therefore SPD
@@ -825,6 +849,17 @@ void prepare_triangular_solve(T* hA, int lda, T* AAT, int N, char char_uplo)
         }
         hA[i + i * lda] = t;
     }
+}
+
+/* ============================================================================================= */
+/*! \brief For testing purposes, prepares matrix hA for a triangular solve.                      *
+ *         Makes hA strictly diagonal dominant (SPD), then calculates Cholesky factorization     *
+ *         of hA.                                                                                */
+template <typename T>
+void prepare_triangular_solve(T* hA, int lda, T* AAT, int N, char char_uplo)
+{
+    prepare_positive_definite(hA, lda, AAT, N);
+
     //  calculate Cholesky factorization of SPD matrix hA
     cblas_potrf<T>(char_uplo, N, hA, lda);
 }
@@ -841,11 +876,44 @@ char type2char();
 template <typename T>
 int type2int(T val);
 
+/* ============================================================================================ */
+/*! \brief  true if the M x N matrices of the batches are equal bit for bit. The unit and near
+            checks pass those with one memcmp per column instead of an assert per element. */
+template <typename T>
+bool hipblas_identical(size_t        M,
+                       size_t        N,
+                       size_t        batch_count,
+                       size_t        lda,
+                       hipblasStride stride,
+                       const T*      hCPU,
+                       const T*      hGPU)
+{
+    for(size_t k = 0; k < batch_count; k++)
+        for(size_t j = 0; j < N; j++)
+            if(M && memcmp(hCPU + j * lda + k * stride, hGPU + j * lda + k * stride, M * sizeof(T)))
+                return false;
+    return true;
+}
+
+// Batched matrices, as arrays of pointers or of host_vector
+template <typename TB>
+bool hipblas_identical(size_t M, size_t N, size_t batch_count, size_t lda, TB hCPU, TB hGPU)
+{
+    for(size_t k = 0; k < batch_count; k++)
+        for(size_t j = 0; j < N; j++)
+            if(M && memcmp(&hCPU[k][j * lda], &hGPU[k][j * lda], M * sizeof(hCPU[k][0])))
+                return false;
+    return true;
+}
+
 /* ============================================================================================ */
 /*! \brief  Debugging purpose, print out CPU and GPU result matrix, not valid in complex number  */
-template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
-void print_matrix(
-    const std::vector<T>& CPU_result, const std::vector<T>& GPU_result, int m, int n, int lda)
+template <typename T, typename Alloc, std::enable_if_t<!is_complex<T>, int> = 0>
+void print_matrix(const std::vector<T, Alloc>& CPU_result,
+                  const std::vector<T, Alloc>& GPU_result,
+                  int                          m,
+                  int                          n,
+                  int                          lda)
 {
     for(int i = 0; i < m; i++)
         for(int j = 0; j < n; j++)
@@ -857,9 +925,12 @@ void print_matrix(
 }
 
 /*! \brief  Debugging purpose, print out CPU and GPU result matrix, valid for complex number  */
-template <typename T, std::enable_if_t<+is_complex<T>, int> = 0>
-void print_matrix(
-    const std::vector<T>& CPU_result, const std::vector<T>& GPU_result, int m, int n, int lda)
+template <typename T, typename Alloc, std::enable_if_t<+is_complex<T>, int> = 0>
+void print_matrix(const std::vector<T, Alloc>& CPU_result,
+                  const std::vector<T, Alloc>& GPU_result,
+                  int                          m,
+                  int                          n,
+                  int                          lda)
 {
     for(int i = 0; i < m; i++)
         for(int j = 0; j < n; j++)
@@ -983,11 +1054,18 @@ double get_time_us_sync(hipStream_t stream);
 struct Arguments;
 
 /* ============================================================================================ */
-/*! \brief  local handle which is automatically created and destroyed  */
+/*! \brief  local handle which is automatically created and destroyed. With handle reuse, the
+ *          default of hipblas-test and hipblas-bench, it is taken from the library handle pool of
+ *          the current device and returned to it instead, with its state reset, so the cases do
+ *          not pay for creating a handle and its workspace. */
+void hipblas_set_handle_reuse(bool reuse);
+bool hipblas_get_handle_reuse();
+
 class hipblasLocalHandle
 {
     hipblasHandle_t m_handle;
     void*           m_memory = nullptr;
+    bool            m_pooled = false;
 
 public:
     hipblasLocalHandle();
@@ -1012,6 +1090,115 @@ public:
     }
 };
 
+/* ============================================================================================ */
+/*! \brief  GPU timer of each hot iteration of a timing loop, enabled with hipblas-bench
+ *          --timing_events, --flush_memory_size or --graph. record(iter) is called at the start of
+ *          each of the runs() iterations: it records the stop event of the previous hot iteration,
+ *          overwrites the flush buffer when there is one, then records the start event of a hot
+ *          iteration. After the timed ones, runs() adds one call counted by the hardware counters
+ *          with --counters, one traced call with --kernel_breakdown, and with --graph, arg.iters
+ *          iterations captured into a HIP graph.
+ *          stop() waits for the events, replays the graph and keeps the times until
+ *          hipblas_take_iteration_times is called. */
+void hipblas_set_timing_events(bool events);
+bool hipblas_get_timing_events();
+
+void hipblas_set_graph_replay(bool graph);
+bool hipblas_get_graph_replay();
+
+// Bytes overwritten on the stream before each iteration, 0 for none
+void   hipblas_set_flush_memory_size(size_t bytes);
+size_t hipblas_get_flush_memory_size();
+
+// Pointer mode of hipblas-bench --pointer_mode host or device. The timing loops that time either
+// mode run in it, and the others in the mode they prefer; with it set the output includes the
+// mode of each timer.
+void                 hipblas_set_timing_pointer_mode(bool set, hipblasPointerMode_t mode);
+bool                 hipblas_get_timing_pointer_mode_set();
+hipblasPointerMode_t hipblas_timing_pointer_mode(hipblasPointerMode_t preferred_mode);
+
+// Times in microseconds of the hot iterations of the last hipblasEventTimer
+struct hipblasTimes
+{
+    std::vector<double>              hot_us; // each eager hot call, between its events
+    double                           start_us = 0; // wall clock at the start and end of the eager
+    double                           end_us   = 0; // hot calls
+    double                           graph_us = 0; // with --graph, one replay, < 0 if none
+    hipblasTelemetry                 telemetry; // with --telemetry, between start_us and end_us
+    std::vector<double>              counters; // with --counters, < 0 if not collected
+    std::vector<hipblasKernelRecord> kernels; // with --kernel_breakdown, of the traced call
+    hipblasPointerMode_t             pointer_mode = HIPBLAS_POINTER_MODE_HOST; // of the handle
+};
+
+// Returns the times kept by the last hipblasEventTimer::stop and clears them
+hipblasTimes hipblas_take_iteration_times();
+
+// Thread of hipblas-bench --threads running on one device. hipblasLocalHandle sets stream, when
+// not null, and priority, when not the default, on the handles it creates, and log_perf adds the
+// indices to the output.
+struct hipblasBenchThread
+{
+    int                     thread       = -1;
+    int                     stream_index = -1;
+    hipStream_t             stream       = nullptr;
+    hipblasStreamPriority_t priority     = HIPBLAS_STREAM_PRIORITY_DEFAULT;
+};
+
+void                      hipblas_set_bench_thread(const hipblasBenchThread& bench_thread);
+const hipblasBenchThread& hipblas_get_bench_thread();
+
+// Work of the hot loops logged by all threads, and the wall clock from the first start to the
+// last end
+struct hipblasConcurrentTotals
+{
+    int    tests    = 0;
+    double gflop    = 0;
+    double gbyte    = 0;
+    double start_us = 0;
+    double end_us   = 0;
+};
+
+void hipblas_add_concurrent_totals(double gflop, double gbyte, double start_us, double end_us);
+
+// Returns the totals added since the last call and clears them
+hipblasConcurrentTotals hipblas_take_concurrent_totals();
+
+class hipblasEventTimer
+{
+    hipblasHandle_t         m_handle;
+    hipStream_t             m_stream;
+    hipStream_t             m_capture = nullptr;
+    int                     m_cold_iters;
+    int                     m_iters;
+    bool                    m_graph;
+    double                  m_start_us = 0;
+    double                  m_end_us   = 0;
+    size_t                  m_flush_size;
+    void*                   m_flush = nullptr;
+    std::vector<hipEvent_t> m_start;
+    std::vector<hipEvent_t> m_stop;
+
+    std::unique_ptr<hipblasTelemetrySampler> m_telemetry;
+    std::unique_ptr<hipblasCounterSession>   m_counters;
+    std::unique_ptr<hipblasKernelTracer>     m_tracer;
+
+public:
+    hipblasEventTimer(const Arguments& arg, hipblasHandle_t handle);
+
+    ~hipblasEventTimer();
+
+    hipblasEventTimer(const hipblasEventTimer&) = delete;
+    hipblasEventTimer(hipblasEventTimer&&)      = delete;
+    hipblasEventTimer& operator=(const hipblasEventTimer&) = delete;
+    hipblasEventTimer& operator=(hipblasEventTimer&&) = delete;
+
+    int runs() const;
+
+    void record(int iter);
+
+    void stop();
+};
+
 #include "hipblas_arguments.hpp"
 
 #endif // __cplusplus
@@ -0,0 +1,581 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPBLAS_ASYNC_HPP
+#define HIPBLAS_ASYNC_HPP
+
+#include "hipblas_cxx.hpp"
+
+#include <hip/hip_runtime_api.h>
+
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#if __cplusplus < 202002L && (!defined(_MSVC_LANG) || _MSVC_LANG < 202002L)
+#error "hipblas_async.hpp requires C++20"
+#endif
+
+/*!\file
+ * \brief hipblas_async.hpp adds C++20 coroutines to the interface of hipblas_cxx.hpp. The _async
+ *  functions enqueue their call on the stream of the handle at once, like the functions they
+ *  wrap, and return an awaitable completed by a HIP host function enqueued behind the call:
+ *
+ *  - co_await resumes the coroutine through an executor once the stream has run the call, so no
+ *    host thread blocks on hipStreamSynchronize. The host function itself only posts the
+ *    coroutine to the executor, as host functions must not call HIP.
+ *  - future() returns a std::future of the status for code that is not a coroutine.
+ *
+ *  run_loop is an executor driving the coroutines of one host thread, and any thread pool becomes
+ *  one by wrapping its submit function in make_executor. As the calls are enqueued before they
+ *  are awaited, one coroutine keeps the streams of several handles, on one device or many, busy
+ *  by starting a call on each and then awaiting them in turn.
+ */
+
+namespace hipblas
+{
+    /* ===========================================================================
+     *   Executors
+     * ===========================================================================
+     */
+
+    /*! \brief Resumes the coroutines whose awaited work is done. post is called from the
+     *  threads of the HIP runtime and must not run the coroutine itself. */
+    class executor
+    {
+    public:
+        virtual ~executor() = default;
+
+        virtual void post(std::coroutine_handle<> coroutine) = 0;
+    };
+
+    /*! \brief Executor posting each coroutine to submit, a callable taking a callable without
+     *  arguments, such as the submit function of a thread pool. */
+    template <typename Submit>
+    class function_executor : public executor
+    {
+    public:
+        explicit function_executor(Submit submit)
+            : submit_(std::move(submit))
+        {
+        }
+
+        void post(std::coroutine_handle<> coroutine) override
+        {
+            submit_([coroutine]() { coroutine.resume(); });
+        }
+
+    private:
+        Submit submit_;
+    };
+
+    template <typename Submit>
+    function_executor<Submit> make_executor(Submit submit)
+    {
+        return function_executor<Submit>(std::move(submit));
+    }
+
+    template <typename T = void>
+    class task;
+
+    /*! \brief Executor resuming the coroutines on the thread calling run. */
+    class run_loop : public executor
+    {
+    public:
+        void post(std::coroutine_handle<> coroutine) override
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queue_.push_back(coroutine);
+            }
+            ready_.notify_one();
+        }
+
+        /*! \brief Starts t and resumes the coroutines posted to the loop until t is done, then
+         *  returns its result or rethrows its exception. t may also be resumed by other
+         *  executors. */
+        template <typename T>
+        T run(task<T> t);
+
+    private:
+        struct waiter;
+
+        // Called by the coroutine awaiting the task of run when it is done
+        void finish(bool& finished)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                finished = true;
+            }
+            ready_.notify_one();
+        }
+
+        std::mutex                          mutex_;
+        std::condition_variable             ready_;
+        std::deque<std::coroutine_handle<>> queue_;
+    };
+
+    /* ===========================================================================
+     *   Task
+     * ===========================================================================
+     */
+
+    namespace detail
+    {
+        // A task starts when it is awaited or run, and resumes its awaiter when it returns
+        struct task_promise_base
+        {
+            struct final_awaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                template <typename Promise>
+                std::coroutine_handle<>
+                    await_suspend(std::coroutine_handle<Promise> coroutine) const noexcept
+                {
+                    return coroutine.promise().continuation;
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            final_awaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() noexcept
+            {
+                error = std::current_exception();
+            }
+
+            std::coroutine_handle<> continuation = std::noop_coroutine();
+            std::exception_ptr      error;
+        };
+
+        template <typename T>
+        struct task_promise : task_promise_base
+        {
+            task<T> get_return_object() noexcept;
+
+            void return_value(T value)
+            {
+                result.emplace(std::move(value));
+            }
+
+            T take()
+            {
+                if(error)
+                    std::rethrow_exception(error);
+                return std::move(*result);
+            }
+
+            std::optional<T> result;
+        };
+
+        template <>
+        struct task_promise<void> : task_promise_base
+        {
+            task<void> get_return_object() noexcept;
+
+            void return_void() noexcept {}
+
+            void take()
+            {
+                if(error)
+                    std::rethrow_exception(error);
+            }
+        };
+    }
+
+    /*! \brief Coroutine returning T, started when it is awaited or given to run_loop::run. */
+    template <typename T>
+    class task
+    {
+    public:
+        using promise_type = detail::task_promise<T>;
+
+        explicit task(std::coroutine_handle<promise_type> coroutine) noexcept
+            : coroutine_(coroutine)
+        {
+        }
+
+        task(const task&) = delete;
+        task& operator=(const task&) = delete;
+
+        task(task&& other) noexcept
+            : coroutine_(std::exchange(other.coroutine_, nullptr))
+        {
+        }
+
+        task& operator=(task&& other) noexcept
+        {
+            std::swap(coroutine_, other.coroutine_);
+            return *this;
+        }
+
+        ~task()
+        {
+            if(coroutine_)
+                coroutine_.destroy();
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+        {
+            coroutine_.promise().continuation = awaiter;
+            return coroutine_;
+        }
+
+        T await_resume()
+        {
+            return coroutine_.promise().take();
+        }
+
+    private:
+        friend class run_loop;
+
+        std::coroutine_handle<promise_type> coroutine_;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        task<T> task_promise<T>::get_return_object() noexcept
+        {
+            return task<T>(std::coroutine_handle<task_promise<T>>::from_promise(*this));
+        }
+
+        inline task<void> task_promise<void>::get_return_object() noexcept
+        {
+            return task<void>(std::coroutine_handle<task_promise<void>>::from_promise(*this));
+        }
+    }
+
+    // Coroutine of run_loop::run starting the task and telling the loop when it is done, on
+    // whichever thread resumes it
+    struct run_loop::waiter
+    {
+        struct promise_type
+        {
+            run_loop* loop     = nullptr;
+            bool*     finished = nullptr;
+
+            struct final_awaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                void await_suspend(std::coroutine_handle<promise_type> coroutine) const noexcept
+                {
+                    coroutine.promise().loop->finish(*coroutine.promise().finished);
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            waiter get_return_object() noexcept
+            {
+                return waiter{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            final_awaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void return_void() noexcept {}
+
+            void unhandled_exception() noexcept
+            {
+                std::terminate();
+            }
+        };
+
+        // Starts the task without taking its result, which run takes
+        template <typename T>
+        struct start
+        {
+            task<T>& t;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> coroutine) noexcept
+            {
+                return t.await_suspend(coroutine);
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        template <typename T>
+        static waiter await(task<T>& t)
+        {
+            co_await start<T>{t};
+        }
+
+        std::coroutine_handle<promise_type> coroutine;
+
+        ~waiter()
+        {
+            if(coroutine)
+                coroutine.destroy();
+        }
+    };
+
+    template <typename T>
+    T run_loop::run(task<T> t)
+    {
+        bool   finished = false;
+        waiter w        = waiter::await(t);
+        w.coroutine.promise().loop     = this;
+        w.coroutine.promise().finished = &finished;
+        post(w.coroutine);
+
+        for(;;)
+        {
+            std::coroutine_handle<> coroutine;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [&]() { return finished || !queue_.empty(); });
+                if(finished)
+                    break;
+                coroutine = queue_.front();
+                queue_.pop_front();
+            }
+            coroutine.resume();
+        }
+        return t.await_resume();
+    }
+
+    /* ===========================================================================
+     *   Awaitable completion of a call
+     * ===========================================================================
+     */
+
+    namespace detail
+    {
+        // Shared by an awaitable and the host function completing it
+        struct completion_state
+        {
+            std::mutex                                  mutex;
+            bool                                        done      = false;
+            executor*                                   ex        = nullptr;
+            std::coroutine_handle<>                     coroutine = nullptr;
+            std::promise<hipblasStatus_t>               promise;
+            std::optional<std::future<hipblasStatus_t>> future;
+
+            // Called from the host function: resume the awaiter, if any, through its executor
+            void complete()
+            {
+                promise.set_value(HIPBLAS_STATUS_SUCCESS);
+                std::coroutine_handle<> waiting;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    done    = true;
+                    waiting = std::exchange(coroutine, nullptr);
+                }
+                if(waiting)
+                    ex->post(waiting);
+            }
+        };
+
+        inline void complete_host_function(void* data)
+        {
+            auto* state = static_cast<std::shared_ptr<completion_state>*>(data);
+            (*state)->complete();
+            delete state;
+        }
+    }
+
+    /*! \brief Awaitable status of work enqueued on a stream. co_await gives the status of the
+     *  call once the stream has run it, HIPBLAS_STATUS_EXECUTION_FAILED when the host function
+     *  could not be enqueued and HIPBLAS_STATUS_NOT_SUPPORTED while the stream is captured. A
+     *  call that failed is not awaited. */
+    class [[nodiscard]] async_status
+    {
+    public:
+        /*! \brief Completes when the work enqueued on stream so far is done, if status is
+         *  HIPBLAS_STATUS_SUCCESS, and at once otherwise. */
+        async_status(executor& ex, hipStream_t stream, hipblasStatus_t status)
+            : status_(status)
+        {
+            if(status_ != HIPBLAS_STATUS_SUCCESS)
+                return;
+
+            // Work being captured into a graph does not run now
+            hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+            if(hipStreamIsCapturing(stream, &capture) != hipSuccess)
+                status_ = HIPBLAS_STATUS_EXECUTION_FAILED;
+            else if(capture != hipStreamCaptureStatusNone)
+                status_ = HIPBLAS_STATUS_NOT_SUPPORTED;
+            if(status_ != HIPBLAS_STATUS_SUCCESS)
+                return;
+
+            state_     = std::make_shared<detail::completion_state>();
+            state_->ex = &ex;
+            state_->future.emplace(state_->promise.get_future());
+            auto* data = new std::shared_ptr<detail::completion_state>(state_);
+            if(hipLaunchHostFunc(stream, detail::complete_host_function, data) != hipSuccess)
+            {
+                delete data;
+                state_.reset();
+                status_ = HIPBLAS_STATUS_EXECUTION_FAILED;
+            }
+        }
+
+        async_status(const async_status&) = delete;
+        async_status& operator=(const async_status&) = delete;
+        async_status(async_status&&)                 = default;
+        async_status& operator=(async_status&&) = default;
+
+        bool await_ready() const
+        {
+            if(!state_)
+                return true;
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            return state_->done;
+        }
+
+        bool await_suspend(std::coroutine_handle<> coroutine)
+        {
+            // The coroutine may be resumed, and this awaitable destroyed, before this returns
+            std::shared_ptr<detail::completion_state> state = state_;
+            std::lock_guard<std::mutex>               lock(state->mutex);
+            if(state->done)
+                return false;
+            state->coroutine = coroutine;
+            return true;
+        }
+
+        hipblasStatus_t await_resume() const noexcept
+        {
+            return status_;
+        }
+
+        /*! \brief Future of the status, ready with it once the stream has run the call. Can be
+         *  taken once. */
+        std::future<hipblasStatus_t> future()
+        {
+            if(state_ && state_->future)
+            {
+                std::future<hipblasStatus_t> f = std::move(*state_->future);
+                state_->future.reset();
+                return f;
+            }
+            std::promise<hipblasStatus_t> ready;
+            ready.set_value(status_);
+            return ready.get_future();
+        }
+
+    private:
+        hipblasStatus_t                           status_;
+        std::shared_ptr<detail::completion_state> state_;
+    };
+
+    /*! \brief Completes when the work enqueued on the stream of handle so far is done. */
+    inline async_status synchronize_async(executor& ex, hipblasHandle_t handle)
+    {
+        hipStream_t     stream = nullptr;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        return async_status(ex, stream, status);
+    }
+
+    /*! \brief Awaitable of status, the result of a call just enqueued on the stream of handle,
+     *  as in co_await hipblas::async(ex, handle, hipblasSaxpy(handle, ...)). */
+    inline async_status async(executor& ex, hipblasHandle_t handle, hipblasStatus_t status)
+    {
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return async_status(ex, nullptr, status);
+        return synchronize_async(ex, handle);
+    }
+
+    /* ===========================================================================
+     *   Asynchronous forms of the functions of hipblas_cxx.hpp
+     * ===========================================================================
+     */
+
+    /*! \brief The functions below take the arguments of the function of hipblas_cxx.hpp they are
+     *  named after, pointers or views, and enqueue it at once. The scalars must outlive the
+     *  enqueue only, as in the C API; the operands must outlive the completion. */
+    template <typename... Args>
+    inline async_status axpy_async(executor& ex, hipblasHandle_t handle, Args&&... args)
+    {
+        return async(ex, handle, axpy(handle, std::forward<Args>(args)...));
+    }
+
+    template <typename... Args>
+    inline async_status scal_async(executor& ex, hipblasHandle_t handle, Args&&... args)
+    {
+        return async(ex, handle, scal(handle, std::forward<Args>(args)...));
+    }
+
+    template <typename... Args>
+    inline async_status gemv_async(executor& ex, hipblasHandle_t handle, Args&&... args)
+    {
+        return async(ex, handle, gemv(handle, std::forward<Args>(args)...));
+    }
+
+    template <typename... Args>
+    inline async_status gemm_async(executor& ex, hipblasHandle_t handle, Args&&... args)
+    {
+        return async(ex, handle, gemm(handle, std::forward<Args>(args)...));
+    }
+
+    template <typename... Args>
+    inline async_status
+        gemm_strided_batched_async(executor& ex, hipblasHandle_t handle, Args&&... args)
+    {
+        return async(ex, handle, gemm_strided_batched(handle, std::forward<Args>(args)...));
+    }
+}
+
+#endif // HIPBLAS_ASYNC_HPP
@@ -0,0 +1,1262 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPBLAS_CXX_HPP
+#define HIPBLAS_CXX_HPP
+
+#include "hipblas.h"
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus < 201703L && (!defined(_MSVC_LANG) || _MSVC_LANG < 201703L)
+#error "hipblas_cxx.hpp requires C++17"
+#endif
+
+/*!\file
+ * \brief hipblas_cxx.hpp provides a header-only C++17 interface over the hipBLAS C functions.
+ *  The functions of namespace hipblas take the element type T as a template parameter and
+ *  select the C function at compile time, so they cost nothing over calling it directly:
+ *
+ *  - float, double, hipblasComplex and hipblasDoubleComplex call the S, D, C and Z functions.
+ *  - hipblasHalf calls the H functions, or the Ex functions with HIP_R_32F computation where
+ *    there is no H function.
+ *  - hipblasBfloat16 calls the Bf or Ex functions with float scalars and HIP_R_32F or
+ *    HIPBLAS_COMPUTE_32F computation.
+ *
+ *  Types without a matching C function fail to compile. The view overloads take vector_view,
+ *  matrix_view and their strided batch forms, which carry the sizes, increment or leading
+ *  dimension and stride of each operand, derive the sizes of the call from them and return
+ *  HIPBLAS_STATUS_INVALID_VALUE when the operands do not agree. As in the C API, matrices are
+ *  column major.
+ */
+
+namespace hipblas
+{
+    namespace detail
+    {
+        template <typename T>
+        inline constexpr bool dependent_false = false;
+
+        template <typename T>
+        struct scalar
+        {
+            using type = T;
+        };
+
+        template <>
+        struct scalar<hipblasBfloat16>
+        {
+            using type = float;
+        };
+    }
+
+    /*! \brief Type of alpha and beta for elements of type T: float for hipblasBfloat16, T
+     *  otherwise. */
+    template <typename T>
+    using scalar_type = typename detail::scalar<T>::type;
+
+    /* ===========================================================================
+     *   Errors and RAII guards
+     * ===========================================================================
+     */
+
+    /*! \brief Exception thrown by the guards below when a hipBLAS call fails. */
+    class status_error : public std::runtime_error
+    {
+    public:
+        explicit status_error(hipblasStatus_t status)
+            : std::runtime_error(hipblasStatusToString(status))
+            , status_(status)
+        {
+        }
+
+        hipblasStatus_t status() const noexcept
+        {
+            return status_;
+        }
+
+    private:
+        hipblasStatus_t status_;
+    };
+
+    /*! \brief Throws status_error unless status is HIPBLAS_STATUS_SUCCESS. */
+    inline void check(hipblasStatus_t status)
+    {
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw status_error(status);
+    }
+
+    /*! \brief Owns a hipblasHandle_t, created by the constructor and destroyed by the
+     *  destructor. Converts to hipblasHandle_t, so it can be passed to every hipBLAS function. */
+    class handle
+    {
+    public:
+        handle()
+        {
+            check(hipblasCreate(&handle_));
+        }
+
+        explicit handle(hipStream_t stream)
+            : handle()
+        {
+            check(hipblasSetStream(handle_, stream));
+        }
+
+        handle(const handle&) = delete;
+        handle& operator=(const handle&) = delete;
+
+        handle(handle&& other) noexcept
+            : handle_(other.handle_)
+        {
+            other.handle_ = nullptr;
+        }
+
+        handle& operator=(handle&& other) noexcept
+        {
+            std::swap(handle_, other.handle_);
+            return *this;
+        }
+
+        ~handle()
+        {
+            if(handle_)
+                hipblasDestroy(handle_);
+        }
+
+        hipblasHandle_t get() const noexcept
+        {
+            return handle_;
+        }
+
+        operator hipblasHandle_t() const noexcept
+        {
+            return handle_;
+        }
+
+    private:
+        hipblasHandle_t handle_ = nullptr;
+    };
+
+    /*! \brief Sets the stream of a handle for the lifetime of the guard and restores the
+     *  previous stream when it is destroyed. */
+    class stream_guard
+    {
+    public:
+        stream_guard(hipblasHandle_t handle, hipStream_t stream)
+            : handle_(handle)
+        {
+            check(hipblasGetStream(handle_, &previous_));
+            check(hipblasSetStream(handle_, stream));
+        }
+
+        stream_guard(const stream_guard&) = delete;
+        stream_guard& operator=(const stream_guard&) = delete;
+
+        ~stream_guard()
+        {
+            hipblasSetStream(handle_, previous_);
+        }
+
+    private:
+        hipblasHandle_t handle_;
+        hipStream_t     previous_ = nullptr;
+    };
+
+    /*! \brief Sets the pointer mode of a handle for the lifetime of the guard and restores the
+     *  previous mode when it is destroyed. */
+    class pointer_mode_guard
+    {
+    public:
+        pointer_mode_guard(hipblasHandle_t handle, hipblasPointerMode_t mode)
+            : handle_(handle)
+        {
+            check(hipblasGetPointerMode(handle_, &previous_));
+            check(hipblasSetPointerMode(handle_, mode));
+        }
+
+        pointer_mode_guard(const pointer_mode_guard&) = delete;
+        pointer_mode_guard& operator=(const pointer_mode_guard&) = delete;
+
+        ~pointer_mode_guard()
+        {
+            hipblasSetPointerMode(handle_, previous_);
+        }
+
+    private:
+        hipblasHandle_t      handle_;
+        hipblasPointerMode_t previous_ = HIPBLAS_POINTER_MODE_HOST;
+    };
+
+    /* ===========================================================================
+     *   Views
+     * ===========================================================================
+     */
+
+    /*! \brief n elements of device memory, inc apart. */
+    template <typename T>
+    struct vector_view
+    {
+        T*  data;
+        int n;
+        int inc;
+    };
+
+    /*! \brief rows x cols column major matrix in device memory with leading dimension ld. */
+    template <typename T>
+    struct matrix_view
+    {
+        T*  data;
+        int rows;
+        int cols;
+        int ld;
+    };
+
+    /*! \brief batch_count vectors of n elements, inc apart, which start stride elements apart. */
+    template <typename T>
+    struct strided_vector_batch
+    {
+        T*            data;
+        int           n;
+        int           inc;
+        hipblasStride stride;
+        int           batch_count;
+    };
+
+    /*! \brief batch_count rows x cols matrices with leading dimension ld, which start stride
+     *  elements apart. */
+    template <typename T>
+    struct strided_matrix_batch
+    {
+        T*            data;
+        int           rows;
+        int           cols;
+        int           ld;
+        hipblasStride stride;
+        int           batch_count;
+    };
+
+    /*! \brief Vector of n elements, inc apart. */
+    template <typename T>
+    constexpr vector_view<T> make_vector(T* data, int n, int inc = 1)
+    {
+        return {data, n, inc};
+    }
+
+    /*! \brief Contiguous rows x cols matrix, with ld = rows. */
+    template <typename T>
+    constexpr matrix_view<T> make_matrix(T* data, int rows, int cols)
+    {
+        return {data, rows, cols, rows};
+    }
+
+    template <typename T>
+    constexpr matrix_view<T> make_matrix(T* data, int rows, int cols, int ld)
+    {
+        return {data, rows, cols, ld};
+    }
+
+    /*! \brief batch_count contiguous vectors of n elements stored one after the other, with
+     *  stride = n. */
+    template <typename T>
+    constexpr strided_vector_batch<T> make_vector_batch(T* data, int n, int batch_count)
+    {
+        return {data, n, 1, n, batch_count};
+    }
+
+    /*! \brief batch_count contiguous rows x cols matrices stored one after the other, with
+     *  ld = rows and stride = rows * cols. */
+    template <typename T>
+    constexpr strided_matrix_batch<T>
+        make_matrix_batch(T* data, int rows, int cols, int batch_count)
+    {
+        return {data, rows, cols, rows, hipblasStride(rows) * cols, batch_count};
+    }
+
+    /*! \brief batch_count rows x cols matrices with leading dimension ld, stride elements
+     *  apart. A stride of 0 shares one matrix between the batch. */
+    template <typename T>
+    constexpr strided_matrix_batch<T> make_matrix_batch(
+        T* data, int rows, int cols, int ld, hipblasStride stride, int batch_count)
+    {
+        return {data, rows, cols, ld, stride, batch_count};
+    }
+
+    namespace detail
+    {
+        // Rows and columns of op(A) for a matrix_view or strided_matrix_batch A
+        template <typename M>
+        constexpr int op_rows(hipblasOperation_t trans, const M& A)
+        {
+            return trans == HIPBLAS_OP_N ? A.rows : A.cols;
+        }
+
+        template <typename M>
+        constexpr int op_cols(hipblasOperation_t trans, const M& A)
+        {
+            return trans == HIPBLAS_OP_N ? A.cols : A.rows;
+        }
+
+        template <typename U, typename T>
+        inline constexpr bool same_element = std::is_same_v<std::remove_const_t<U>, T>;
+    }
+
+    /* ===========================================================================
+     *   Level 1
+     * ===========================================================================
+     */
+
+    /*! \brief y := alpha * x + y */
+    template <typename T>
+    inline hipblasStatus_t axpy(hipblasHandle_t       handle,
+                                int                   n,
+                                const scalar_type<T>* alpha,
+                                const T*              x,
+                                int                   incx,
+                                T*                    y,
+                                int                   incy)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSaxpy(handle, n, alpha, x, incx, y, incy);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDaxpy(handle, n, alpha, x, incx, y, incy);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCaxpy(handle, n, alpha, x, incx, y, incy);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZaxpy(handle, n, alpha, x, incx, y, incy);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasHaxpy(handle, n, alpha, x, incx, y, incy);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasAxpyEx_v2(
+                handle, n, alpha, HIP_R_32F, x, HIP_R_16BF, incx, y, HIP_R_16BF, incy, HIP_R_32F);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::axpy: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t axpy_batched(hipblasHandle_t       handle,
+                                        int                   n,
+                                        const scalar_type<T>* alpha,
+                                        const T* const        x[],
+                                        int                   incx,
+                                        T* const              y[],
+                                        int                   incy,
+                                        int                   batch_count)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSaxpyBatched(handle, n, alpha, x, incx, y, incy, batch_count);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDaxpyBatched(handle, n, alpha, x, incx, y, incy, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCaxpyBatched(handle, n, alpha, x, incx, y, incy, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZaxpyBatched(handle, n, alpha, x, incx, y, incy, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasHaxpyBatched(handle, n, alpha, x, incx, y, incy, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasAxpyBatchedEx_v2(handle,
+                                           n,
+                                           alpha,
+                                           HIP_R_32F,
+                                           x,
+                                           HIP_R_16BF,
+                                           incx,
+                                           (void*)y,
+                                           HIP_R_16BF,
+                                           incy,
+                                           batch_count,
+                                           HIP_R_32F);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::axpy_batched: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t axpy_strided_batched(hipblasHandle_t       handle,
+                                                int                   n,
+                                                const scalar_type<T>* alpha,
+                                                const T*              x,
+                                                int                   incx,
+                                                hipblasStride         stridex,
+                                                T*                    y,
+                                                int                   incy,
+                                                hipblasStride         stridey,
+                                                int                   batch_count)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSaxpyStridedBatched(
+                handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDaxpyStridedBatched(
+                handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCaxpyStridedBatched(
+                handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZaxpyStridedBatched(
+                handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasHaxpyStridedBatched(
+                handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasAxpyStridedBatchedEx_v2(handle,
+                                                  n,
+                                                  alpha,
+                                                  HIP_R_32F,
+                                                  x,
+                                                  HIP_R_16BF,
+                                                  incx,
+                                                  stridex,
+                                                  y,
+                                                  HIP_R_16BF,
+                                                  incy,
+                                                  stridey,
+                                                  batch_count,
+                                                  HIP_R_32F);
+        else
+            static_assert(detail::dependent_false<T>,
+                          "hipblas::axpy_strided_batched: unsupported type");
+    }
+
+    /*! \brief y := alpha * x + y over views of the same length. */
+    template <typename U, typename T>
+    inline hipblasStatus_t axpy(hipblasHandle_t       handle,
+                                const scalar_type<T>* alpha,
+                                const vector_view<U>& x,
+                                const vector_view<T>& y)
+    {
+        static_assert(detail::same_element<U, T>, "hipblas::axpy: x and y differ in type");
+        if(x.n != y.n)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return axpy<T>(handle, y.n, alpha, x.data, x.inc, y.data, y.inc);
+    }
+
+    template <typename U, typename T>
+    inline hipblasStatus_t axpy(hipblasHandle_t                handle,
+                                const scalar_type<T>*          alpha,
+                                const strided_vector_batch<U>& x,
+                                const strided_vector_batch<T>& y)
+    {
+        static_assert(detail::same_element<U, T>, "hipblas::axpy: x and y differ in type");
+        if(x.n != y.n || x.batch_count != y.batch_count)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return axpy_strided_batched<T>(
+            handle, y.n, alpha, x.data, x.inc, x.stride, y.data, y.inc, y.stride, y.batch_count);
+    }
+
+    /*! \brief x := alpha * x */
+    template <typename T>
+    inline hipblasStatus_t
+        scal(hipblasHandle_t handle, int n, const scalar_type<T>* alpha, T* x, int incx)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSscal(handle, n, alpha, x, incx);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDscal(handle, n, alpha, x, incx);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCscal(handle, n, alpha, x, incx);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZscal(handle, n, alpha, x, incx);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasScalEx_v2(handle, n, alpha, HIP_R_16F, x, HIP_R_16F, incx, HIP_R_32F);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasScalEx_v2(handle, n, alpha, HIP_R_32F, x, HIP_R_16BF, incx, HIP_R_32F);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::scal: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t scal_batched(hipblasHandle_t       handle,
+                                        int                   n,
+                                        const scalar_type<T>* alpha,
+                                        T* const              x[],
+                                        int                   incx,
+                                        int                   batch_count)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSscalBatched(handle, n, alpha, x, incx, batch_count);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDscalBatched(handle, n, alpha, x, incx, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCscalBatched(handle, n, alpha, x, incx, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZscalBatched(handle, n, alpha, x, incx, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasScalBatchedEx_v2(
+                handle, n, alpha, HIP_R_16F, (void*)x, HIP_R_16F, incx, batch_count, HIP_R_32F);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasScalBatchedEx_v2(
+                handle, n, alpha, HIP_R_32F, (void*)x, HIP_R_16BF, incx, batch_count, HIP_R_32F);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::scal_batched: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t scal_strided_batched(hipblasHandle_t       handle,
+                                                int                   n,
+                                                const scalar_type<T>* alpha,
+                                                T*                    x,
+                                                int                   incx,
+                                                hipblasStride         stridex,
+                                                int                   batch_count)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasScalStridedBatchedEx_v2(
+                handle, n, alpha, HIP_R_16F, x, HIP_R_16F, incx, stridex, batch_count, HIP_R_32F);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasScalStridedBatchedEx_v2(
+                handle, n, alpha, HIP_R_32F, x, HIP_R_16BF, incx, stridex, batch_count, HIP_R_32F);
+        else
+            static_assert(detail::dependent_false<T>,
+                          "hipblas::scal_strided_batched: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t
+        scal(hipblasHandle_t handle, const scalar_type<T>* alpha, const vector_view<T>& x)
+    {
+        return scal<T>(handle, x.n, alpha, x.data, x.inc);
+    }
+
+    template <typename T>
+    inline hipblasStatus_t scal(hipblasHandle_t                handle,
+                                const scalar_type<T>*          alpha,
+                                const strided_vector_batch<T>& x)
+    {
+        return scal_strided_batched<T>(handle, x.n, alpha, x.data, x.inc, x.stride, x.batch_count);
+    }
+
+    /*! \brief result := x^T * y, without conjugating complex x. */
+    template <typename T>
+    inline hipblasStatus_t
+        dot(hipblasHandle_t handle, int n, const T* x, int incx, const T* y, int incy, T* result)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSdot(handle, n, x, incx, y, incy, result);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDdot(handle, n, x, incx, y, incy, result);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCdotu(handle, n, x, incx, y, incy, result);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZdotu(handle, n, x, incx, y, incy, result);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasHdot(handle, n, x, incx, y, incy, result);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasBfdot(handle, n, x, incx, y, incy, result);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::dot: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t dot_batched(hipblasHandle_t handle,
+                                       int             n,
+                                       const T* const  x[],
+                                       int             incx,
+                                       const T* const  y[],
+                                       int             incy,
+                                       int             batch_count,
+                                       T*              result)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSdotBatched(handle, n, x, incx, y, incy, batch_count, result);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDdotBatched(handle, n, x, incx, y, incy, batch_count, result);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCdotuBatched(handle, n, x, incx, y, incy, batch_count, result);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZdotuBatched(handle, n, x, incx, y, incy, batch_count, result);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasHdotBatched(handle, n, x, incx, y, incy, batch_count, result);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasBfdotBatched(handle, n, x, incx, y, incy, batch_count, result);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::dot_batched: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t dot_strided_batched(hipblasHandle_t handle,
+                                               int             n,
+                                               const T*        x,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               const T*        y,
+                                               int             incy,
+                                               hipblasStride   stridey,
+                                               int             batch_count,
+                                               T*              result)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSdotStridedBatched(
+                handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDdotStridedBatched(
+                handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCdotuStridedBatched(
+                handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZdotuStridedBatched(
+                handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasHdotStridedBatched(
+                handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasBfdotStridedBatched(
+                handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+        else
+            static_assert(detail::dependent_false<T>,
+                          "hipblas::dot_strided_batched: unsupported type");
+    }
+
+    /*! \brief result := x^H * y, which is dot for real types. */
+    template <typename T>
+    inline hipblasStatus_t
+        dotc(hipblasHandle_t handle, int n, const T* x, int incx, const T* y, int incy, T* result)
+    {
+        if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCdotc(handle, n, x, incx, y, incy, result);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZdotc(handle, n, x, incx, y, incy, result);
+        else
+            return dot<T>(handle, n, x, incx, y, incy, result);
+    }
+
+    template <typename T>
+    inline hipblasStatus_t dotc_batched(hipblasHandle_t handle,
+                                        int             n,
+                                        const T* const  x[],
+                                        int             incx,
+                                        const T* const  y[],
+                                        int             incy,
+                                        int             batch_count,
+                                        T*              result)
+    {
+        if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCdotcBatched(handle, n, x, incx, y, incy, batch_count, result);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZdotcBatched(handle, n, x, incx, y, incy, batch_count, result);
+        else
+            return dot_batched<T>(handle, n, x, incx, y, incy, batch_count, result);
+    }
+
+    template <typename T>
+    inline hipblasStatus_t dotc_strided_batched(hipblasHandle_t handle,
+                                                int             n,
+                                                const T*        x,
+                                                int             incx,
+                                                hipblasStride   stridex,
+                                                const T*        y,
+                                                int             incy,
+                                                hipblasStride   stridey,
+                                                int             batch_count,
+                                                T*              result)
+    {
+        if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCdotcStridedBatched(
+                handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZdotcStridedBatched(
+                handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+        else
+            return dot_strided_batched<T>(
+                handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    }
+
+    /*! \brief result := x^T * y over views of the same length. result holds one element, or
+     *  batch_count for the strided batch form. */
+    template <typename U, typename V, typename T>
+    inline hipblasStatus_t
+        dot(hipblasHandle_t handle, const vector_view<U>& x, const vector_view<V>& y, T* result)
+    {
+        static_assert(detail::same_element<U, T> && detail::same_element<V, T>,
+                      "hipblas::dot: x, y and result differ in type");
+        if(x.n != y.n)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return dot<T>(handle, x.n, x.data, x.inc, y.data, y.inc, result);
+    }
+
+    template <typename U, typename V, typename T>
+    inline hipblasStatus_t dot(hipblasHandle_t                handle,
+                               const strided_vector_batch<U>& x,
+                               const strided_vector_batch<V>& y,
+                               T*                             result)
+    {
+        static_assert(detail::same_element<U, T> && detail::same_element<V, T>,
+                      "hipblas::dot: x, y and result differ in type");
+        if(x.n != y.n || x.batch_count != y.batch_count)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return dot_strided_batched<T>(
+            handle, x.n, x.data, x.inc, x.stride, y.data, y.inc, y.stride, x.batch_count, result);
+    }
+
+    /* ===========================================================================
+     *   Level 2
+     * ===========================================================================
+     */
+
+    /*! \brief y := alpha * op(A) * x + beta * y, for float, double and complex types. */
+    template <typename T>
+    inline hipblasStatus_t gemv(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                m,
+                                int                n,
+                                const T*           alpha,
+                                const T*           A,
+                                int                lda,
+                                const T*           x,
+                                int                incx,
+                                const T*           beta,
+                                T*                 y,
+                                int                incy)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::gemv: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t gemv_batched(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const T*           alpha,
+                                        const T* const     A[],
+                                        int                lda,
+                                        const T* const     x[],
+                                        int                incx,
+                                        const T*           beta,
+                                        T* const           y[],
+                                        int                incy,
+                                        int                batch_count)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSgemvBatched(
+                handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDgemvBatched(
+                handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCgemvBatched(
+                handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZgemvBatched(
+                handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::gemv_batched: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t gemv_strided_batched(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                int                m,
+                                                int                n,
+                                                const T*           alpha,
+                                                const T*           A,
+                                                int                lda,
+                                                hipblasStride      strideA,
+                                                const T*           x,
+                                                int                incx,
+                                                hipblasStride      stridex,
+                                                const T*           beta,
+                                                T*                 y,
+                                                int                incy,
+                                                hipblasStride      stridey,
+                                                int                batch_count)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSgemvStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              strideA,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              beta,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              batch_count);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDgemvStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              strideA,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              beta,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              batch_count);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCgemvStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              strideA,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              beta,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              batch_count);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZgemvStridedBatched(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              strideA,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              beta,
+                                              y,
+                                              incy,
+                                              stridey,
+                                              batch_count);
+        else
+            static_assert(detail::dependent_false<T>,
+                          "hipblas::gemv_strided_batched: unsupported type");
+    }
+
+    /*! \brief y := alpha * op(A) * x + beta * y, with m and n taken from A. x and y must have
+     *  the lengths of the columns and rows of op(A). */
+    template <typename U, typename V, typename T>
+    inline hipblasStatus_t gemv(hipblasHandle_t       handle,
+                                hipblasOperation_t    trans,
+                                const T*              alpha,
+                                const matrix_view<U>& A,
+                                const vector_view<V>& x,
+                                const T*              beta,
+                                const vector_view<T>& y)
+    {
+        static_assert(detail::same_element<U, T> && detail::same_element<V, T>,
+                      "hipblas::gemv: A, x and y differ in type");
+        if(x.n != detail::op_cols(trans, A) || y.n != detail::op_rows(trans, A))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return gemv<T>(
+            handle, trans, A.rows, A.cols, alpha, A.data, A.ld, x.data, x.inc, beta, y.data, y.inc);
+    }
+
+    template <typename U, typename V, typename T>
+    inline hipblasStatus_t gemv(hipblasHandle_t                handle,
+                                hipblasOperation_t             trans,
+                                const T*                       alpha,
+                                const strided_matrix_batch<U>& A,
+                                const strided_vector_batch<V>& x,
+                                const T*                       beta,
+                                const strided_vector_batch<T>& y)
+    {
+        static_assert(detail::same_element<U, T> && detail::same_element<V, T>,
+                      "hipblas::gemv: A, x and y differ in type");
+        if(x.n != detail::op_cols(trans, A) || y.n != detail::op_rows(trans, A)
+           || A.batch_count != y.batch_count || x.batch_count != y.batch_count)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return gemv_strided_batched<T>(handle,
+                                       trans,
+                                       A.rows,
+                                       A.cols,
+                                       alpha,
+                                       A.data,
+                                       A.ld,
+                                       A.stride,
+                                       x.data,
+                                       x.inc,
+                                       x.stride,
+                                       beta,
+                                       y.data,
+                                       y.inc,
+                                       y.stride,
+                                       y.batch_count);
+    }
+
+    /* ===========================================================================
+     *   Level 3
+     * ===========================================================================
+     */
+
+    /*! \brief C := alpha * op(A) * op(B) + beta * C */
+    template <typename T>
+    inline hipblasStatus_t gemm(hipblasHandle_t       handle,
+                                hipblasOperation_t    transA,
+                                hipblasOperation_t    transB,
+                                int                   m,
+                                int                   n,
+                                int                   k,
+                                const scalar_type<T>* alpha,
+                                const T*              A,
+                                int                   lda,
+                                const T*              B,
+                                int                   ldb,
+                                const scalar_type<T>* beta,
+                                T*                    C,
+                                int                   ldc)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSgemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDgemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCgemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZgemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasHgemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasGemmEx_v2(handle,
+                                    transA,
+                                    transB,
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    A,
+                                    HIP_R_16BF,
+                                    lda,
+                                    B,
+                                    HIP_R_16BF,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    HIP_R_16BF,
+                                    ldc,
+                                    HIPBLAS_COMPUTE_32F,
+                                    HIPBLAS_GEMM_DEFAULT);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::gemm: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t gemm_batched(hipblasHandle_t       handle,
+                                        hipblasOperation_t    transA,
+                                        hipblasOperation_t    transB,
+                                        int                   m,
+                                        int                   n,
+                                        int                   k,
+                                        const scalar_type<T>* alpha,
+                                        const T* const        A[],
+                                        int                   lda,
+                                        const T* const        B[],
+                                        int                   ldb,
+                                        const scalar_type<T>* beta,
+                                        T* const              C[],
+                                        int                   ldc,
+                                        int                   batch_count)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSgemmBatched(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDgemmBatched(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCgemmBatched(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZgemmBatched(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasHgemmBatched(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasGemmBatchedEx_v2(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           (const void**)A,
+                                           HIP_R_16BF,
+                                           lda,
+                                           (const void**)B,
+                                           HIP_R_16BF,
+                                           ldb,
+                                           beta,
+                                           (void**)C,
+                                           HIP_R_16BF,
+                                           ldc,
+                                           batch_count,
+                                           HIPBLAS_COMPUTE_32F,
+                                           HIPBLAS_GEMM_DEFAULT);
+        else
+            static_assert(detail::dependent_false<T>, "hipblas::gemm_batched: unsupported type");
+    }
+
+    template <typename T>
+    inline hipblasStatus_t gemm_strided_batched(hipblasHandle_t       handle,
+                                                hipblasOperation_t    transA,
+                                                hipblasOperation_t    transB,
+                                                int                   m,
+                                                int                   n,
+                                                int                   k,
+                                                const scalar_type<T>* alpha,
+                                                const T*              A,
+                                                int                   lda,
+                                                hipblasStride         strideA,
+                                                const T*              B,
+                                                int                   ldb,
+                                                hipblasStride         strideB,
+                                                const scalar_type<T>* beta,
+                                                T*                    C,
+                                                int                   ldc,
+                                                hipblasStride         strideC,
+                                                int                   batch_count)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            return hipblasSgemmStridedBatched(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              strideC,
+                                              batch_count);
+        else if constexpr(std::is_same_v<T, double>)
+            return hipblasDgemmStridedBatched(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              strideC,
+                                              batch_count);
+        else if constexpr(std::is_same_v<T, hipblasComplex>)
+            return hipblasCgemmStridedBatched(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              strideC,
+                                              batch_count);
+        else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+            return hipblasZgemmStridedBatched(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              strideC,
+                                              batch_count);
+        else if constexpr(std::is_same_v<T, hipblasHalf>)
+            return hipblasHgemmStridedBatched(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              strideC,
+                                              batch_count);
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return hipblasGemmStridedBatchedEx_v2(handle,
+                                                  transA,
+                                                  transB,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  HIP_R_16BF,
+                                                  lda,
+                                                  strideA,
+                                                  B,
+                                                  HIP_R_16BF,
+                                                  ldb,
+                                                  strideB,
+                                                  beta,
+                                                  C,
+                                                  HIP_R_16BF,
+                                                  ldc,
+                                                  strideC,
+                                                  batch_count,
+                                                  HIPBLAS_COMPUTE_32F,
+                                                  HIPBLAS_GEMM_DEFAULT);
+        else
+            static_assert(detail::dependent_false<T>,
+                          "hipblas::gemm_strided_batched: unsupported type");
+    }
+
+    /*! \brief C := alpha * op(A) * op(B) + beta * C, with m and n taken from C and k from
+     *  op(A). op(B) must be k x n. */
+    template <typename U, typename V, typename T>
+    inline hipblasStatus_t gemm(hipblasHandle_t       handle,
+                                hipblasOperation_t    transA,
+                                hipblasOperation_t    transB,
+                                const scalar_type<T>* alpha,
+                                const matrix_view<U>& A,
+                                const matrix_view<V>& B,
+                                const scalar_type<T>* beta,
+                                const matrix_view<T>& C)
+    {
+        static_assert(detail::same_element<U, T> && detail::same_element<V, T>,
+                      "hipblas::gemm: A, B and C differ in type");
+        int k = detail::op_cols(transA, A);
+        if(detail::op_rows(transA, A) != C.rows || detail::op_rows(transB, B) != k
+           || detail::op_cols(transB, B) != C.cols)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return gemm<T>(handle,
+                       transA,
+                       transB,
+                       C.rows,
+                       C.cols,
+                       k,
+                       alpha,
+                       A.data,
+                       A.ld,
+                       B.data,
+                       B.ld,
+                       beta,
+                       C.data,
+                       C.ld);
+    }
+
+    /*! \brief The strided batched form of the above. A or B may share one matrix between the
+     *  batch with a stride of 0, which hipBLAS runs as one larger gemm where it can. */
+    template <typename U, typename V, typename T>
+    inline hipblasStatus_t gemm(hipblasHandle_t                handle,
+                                hipblasOperation_t             transA,
+                                hipblasOperation_t             transB,
+                                const scalar_type<T>*          alpha,
+                                const strided_matrix_batch<U>& A,
+                                const strided_matrix_batch<V>& B,
+                                const scalar_type<T>*          beta,
+                                const strided_matrix_batch<T>& C)
+    {
+        static_assert(detail::same_element<U, T> && detail::same_element<V, T>,
+                      "hipblas::gemm: A, B and C differ in type");
+        int k = detail::op_cols(transA, A);
+        if(detail::op_rows(transA, A) != C.rows || detail::op_rows(transB, B) != k
+           || detail::op_cols(transB, B) != C.cols || A.batch_count != C.batch_count
+           || B.batch_count != C.batch_count)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return gemm_strided_batched<T>(handle,
+                                       transA,
+                                       transB,
+                                       C.rows,
+                                       C.cols,
+                                       k,
+                                       alpha,
+                                       A.data,
+                                       A.ld,
+                                       A.stride,
+                                       B.data,
+                                       B.ld,
+                                       B.stride,
+                                       beta,
+                                       C.data,
+                                       C.ld,
+                                       C.stride,
+                                       C.batch_count);
+    }
+}
+
+#endif // HIPBLAS_CXX_HPP
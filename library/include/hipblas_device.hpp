@@ -0,0 +1,496 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPBLAS_DEVICE_HPP
+#define HIPBLAS_DEVICE_HPP
+
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+
+#include <type_traits>
+
+#if __cplusplus < 201703L && (!defined(_MSVC_LANG) || _MSVC_LANG < 201703L)
+#error "hipblas_device.hpp requires C++17"
+#endif
+
+/*!\file
+ * \brief hipblas_device.hpp provides header-only BLAS primitives called from device code on
+ *  small matrices in registers, LDS or global memory, for kernels fusing BLAS steps with their
+ *  own work. Each primitive is a class template of namespace hipblas::device whose sizes,
+ *  layout and operations are template parameters, so every loop has a compile-time trip count
+ *  and is unrolled: gemm, gemv, trsm and dot.
+ *
+ *  The element type is float, double, hipFloatComplex or hipDoubleComplex, whose layout is that
+ *  of hipblasComplex and hipblasDoubleComplex. The matrices are in column-major or row-major
+ *  order with a compile-time leading dimension, packed by default.
+ *
+ *  Threads is the number of threads sharing a call. Each of them calls run() with its rank in
+ *  0, ..., Threads - 1 and computes its share of the result; with Threads = 1 one thread
+ *  computes it all, and arrays local to the thread stay in registers. gemm, gemv and trsm do not
+ *  synchronize: the caller synchronizes the threads before and after a shared call. dot with
+ *  Threads > 1 reduces through LDS and synchronizes the work group, so Threads must be the size
+ *  of the work group. The primitives are built by hipcc for AMD and NVIDIA devices alike.
+ *
+ *  \code{.cpp}
+ *  __global__ void kernel(const float* A, const float* B, float* C)
+ *  {
+ *      using gemm = hipblas::device::gemm<float, 16, 16, 16>;
+ *      __shared__ float sA[16 * 16], sB[16 * 16], sC[16 * 16];
+ *      // ... load sA and sB
+ *      __syncthreads();
+ *      gemm::run<256>(threadIdx.x, 1.0f, sA, sB, 0.0f, sC);
+ *      __syncthreads();
+ *      // ... use sC
+ *  }
+ *  \endcode
+ */
+
+namespace hipblas
+{
+    namespace device
+    {
+        /*! \brief Storage order of a matrix. */
+        enum class layout
+        {
+            col_major,
+            row_major
+        };
+
+        /*! \brief Operation applied to a matrix operand. */
+        enum class op
+        {
+            none,
+            transpose,
+            conjugate_transpose
+        };
+
+        /*! \brief Triangle of a triangular matrix that is referenced. */
+        enum class fill
+        {
+            lower,
+            upper
+        };
+
+        /*! \brief Whether the diagonal of a triangular matrix is referenced or taken as one. */
+        enum class diagonal
+        {
+            non_unit,
+            unit
+        };
+
+        /*! \brief Side of the triangular matrix of trsm. */
+        enum class side
+        {
+            left,
+            right
+        };
+
+        namespace detail
+        {
+            template <typename T>
+            inline constexpr bool supported
+                = std::is_same_v<T, float> || std::is_same_v<T, double>
+                  || std::is_same_v<T, hipFloatComplex> || std::is_same_v<T, hipDoubleComplex>;
+
+            // Arithmetic of the element types, through the hip_complex.h functions, as the
+            // complex types have no operators on NVIDIA devices
+            __host__ __device__ inline float add(float a, float b)
+            {
+                return a + b;
+            }
+
+            __host__ __device__ inline double add(double a, double b)
+            {
+                return a + b;
+            }
+
+            __host__ __device__ inline hipFloatComplex add(hipFloatComplex a, hipFloatComplex b)
+            {
+                return hipCaddf(a, b);
+            }
+
+            __host__ __device__ inline hipDoubleComplex add(hipDoubleComplex a, hipDoubleComplex b)
+            {
+                return hipCadd(a, b);
+            }
+
+            __host__ __device__ inline float sub(float a, float b)
+            {
+                return a - b;
+            }
+
+            __host__ __device__ inline double sub(double a, double b)
+            {
+                return a - b;
+            }
+
+            __host__ __device__ inline hipFloatComplex sub(hipFloatComplex a, hipFloatComplex b)
+            {
+                return hipCsubf(a, b);
+            }
+
+            __host__ __device__ inline hipDoubleComplex sub(hipDoubleComplex a, hipDoubleComplex b)
+            {
+                return hipCsub(a, b);
+            }
+
+            __host__ __device__ inline float mul(float a, float b)
+            {
+                return a * b;
+            }
+
+            __host__ __device__ inline double mul(double a, double b)
+            {
+                return a * b;
+            }
+
+            __host__ __device__ inline hipFloatComplex mul(hipFloatComplex a, hipFloatComplex b)
+            {
+                return hipCmulf(a, b);
+            }
+
+            __host__ __device__ inline hipDoubleComplex mul(hipDoubleComplex a, hipDoubleComplex b)
+            {
+                return hipCmul(a, b);
+            }
+
+            __host__ __device__ inline float div(float a, float b)
+            {
+                return a / b;
+            }
+
+            __host__ __device__ inline double div(double a, double b)
+            {
+                return a / b;
+            }
+
+            __host__ __device__ inline hipFloatComplex div(hipFloatComplex a, hipFloatComplex b)
+            {
+                return hipCdivf(a, b);
+            }
+
+            __host__ __device__ inline hipDoubleComplex div(hipDoubleComplex a, hipDoubleComplex b)
+            {
+                return hipCdiv(a, b);
+            }
+
+            __host__ __device__ inline float conj(float a)
+            {
+                return a;
+            }
+
+            __host__ __device__ inline double conj(double a)
+            {
+                return a;
+            }
+
+            __host__ __device__ inline hipFloatComplex conj(hipFloatComplex a)
+            {
+                return hipConjf(a);
+            }
+
+            __host__ __device__ inline hipDoubleComplex conj(hipDoubleComplex a)
+            {
+                return hipConj(a);
+            }
+
+            __host__ __device__ inline bool is_zero(float a)
+            {
+                return a == 0;
+            }
+
+            __host__ __device__ inline bool is_zero(double a)
+            {
+                return a == 0;
+            }
+
+            __host__ __device__ inline bool is_zero(hipFloatComplex a)
+            {
+                return hipCrealf(a) == 0 && hipCimagf(a) == 0;
+            }
+
+            __host__ __device__ inline bool is_zero(hipDoubleComplex a)
+            {
+                return hipCreal(a) == 0 && hipCimag(a) == 0;
+            }
+
+            template <typename T>
+            __host__ __device__ inline T zero()
+            {
+                return T{};
+            }
+
+            // Offset of element (i, j) of a Rows x Cols matrix, whose leading dimension is LD or,
+            // when LD is 0, that of the packed matrix
+            template <layout L, int Rows, int Cols, int LD>
+            struct matrix
+            {
+                static constexpr int ld = LD ? LD : (L == layout::col_major ? Rows : Cols);
+
+                static_assert(Rows >= 0 && Cols >= 0, "hipblas::device sizes must not be negative");
+                static_assert(ld >= (L == layout::col_major ? Rows : Cols),
+                              "hipblas::device leading dimension is too small");
+
+                __host__ __device__ static constexpr int at(int i, int j)
+                {
+                    return L == layout::col_major ? i + j * ld : i * ld + j;
+                }
+            };
+
+            // Element (i, l) of op(A), where A is stored as Rows x Cols
+            template <op Op, layout L, int Rows, int Cols, int LD, typename T>
+            __host__ __device__ inline T element(const T* A, int i, int l)
+            {
+                using M = matrix<L, Rows, Cols, LD>;
+                if constexpr(Op == op::none)
+                    return A[M::at(i, l)];
+                else if constexpr(Op == op::transpose)
+                    return A[M::at(l, i)];
+                else
+                    return conj(A[M::at(l, i)]);
+            }
+        }
+
+        /*! \brief C = alpha op(A) op(B) + beta C, with op(A) M x K, op(B) K x N and C M x N.
+         *  A is stored as M x K when OpA is op::none and K x M otherwise, B as K x N or N x K.
+         *  C is not read when beta is zero. The threads share the elements of C. */
+        template <typename T,
+                  int    M,
+                  int    N,
+                  int    K,
+                  op     OpA = op::none,
+                  op     OpB = op::none,
+                  layout L   = layout::col_major,
+                  int    LDA = 0,
+                  int    LDB = 0,
+                  int    LDC = 0>
+        struct gemm
+        {
+            static_assert(detail::supported<T>, "hipblas::device element type is not supported");
+
+            static constexpr int a_rows = OpA == op::none ? M : K;
+            static constexpr int a_cols = OpA == op::none ? K : M;
+            static constexpr int b_rows = OpB == op::none ? K : N;
+            static constexpr int b_cols = OpB == op::none ? N : K;
+
+            using matrix_a = detail::matrix<L, a_rows, a_cols, LDA>;
+            using matrix_b = detail::matrix<L, b_rows, b_cols, LDB>;
+            using matrix_c = detail::matrix<L, M, N, LDC>;
+
+            template <int Threads = 1>
+            __device__ static void run(int rank, T alpha, const T* A, const T* B, T beta, T* C)
+            {
+                static_assert(Threads > 0, "hipblas::device needs at least one thread");
+
+                const bool read_c = !detail::is_zero(beta);
+#pragma unroll
+                for(int e = rank; e < M * N; e += Threads)
+                {
+                    // Consecutive threads take consecutive elements of C in memory
+                    const int i = L == layout::col_major ? e % M : e / N;
+                    const int j = L == layout::col_major ? e / M : e % N;
+
+                    T sum = detail::zero<T>();
+#pragma unroll
+                    for(int l = 0; l < K; l++)
+                        sum = detail::add(
+                            sum,
+                            detail::mul(
+                                detail::element<OpA, L, a_rows, a_cols, LDA>(A, i, l),
+                                detail::element<OpB, L, b_rows, b_cols, LDB>(B, l, j)));
+
+                    T& c = C[matrix_c::at(i, j)];
+                    c    = read_c ? detail::add(detail::mul(alpha, sum), detail::mul(beta, c))
+                                  : detail::mul(alpha, sum);
+                }
+            }
+        };
+
+        /*! \brief y = alpha op(A) x + beta y, with A stored as M x N, and x and y contiguous
+         *  vectors of N and M elements for op::none, or of M and N elements otherwise. y is not
+         *  read when beta is zero. The threads share the elements of y. */
+        template <typename T,
+                  int    M,
+                  int    N,
+                  op     Op  = op::none,
+                  layout L   = layout::col_major,
+                  int    LDA = 0>
+        struct gemv
+        {
+            static_assert(detail::supported<T>, "hipblas::device element type is not supported");
+
+            static constexpr int x_size = Op == op::none ? N : M;
+            static constexpr int y_size = Op == op::none ? M : N;
+
+            template <int Threads = 1>
+            __device__ static void run(int rank, T alpha, const T* A, const T* x, T beta, T* y)
+            {
+                static_assert(Threads > 0, "hipblas::device needs at least one thread");
+
+                const bool read_y = !detail::is_zero(beta);
+#pragma unroll
+                for(int i = rank; i < y_size; i += Threads)
+                {
+                    T sum = detail::zero<T>();
+#pragma unroll
+                    for(int l = 0; l < x_size; l++)
+                        sum = detail::add(
+                            sum, detail::mul(detail::element<Op, L, M, N, LDA>(A, i, l), x[l]));
+
+                    y[i] = read_y ? detail::add(detail::mul(alpha, sum), detail::mul(beta, y[i]))
+                                  : detail::mul(alpha, sum);
+                }
+            }
+        };
+
+        /*! \brief Solves op(A) X = alpha B for side::left, or X op(A) = alpha B for side::right,
+         *  for the M x N matrix X, which overwrites B. A is triangular, M x M for side::left and
+         *  N x N for side::right, and only its Fill triangle is read. The threads share the
+         *  columns of B for side::left and its rows for side::right, and each solves its own. */
+        template <typename T,
+                  int      M,
+                  int      N,
+                  side     Side = side::left,
+                  fill     Fill = fill::lower,
+                  op       Op   = op::none,
+                  diagonal Diag = diagonal::non_unit,
+                  layout   L    = layout::col_major,
+                  int      LDA  = 0,
+                  int      LDB  = 0>
+        struct trsm
+        {
+            static_assert(detail::supported<T>, "hipblas::device element type is not supported");
+
+            static constexpr int a_size = Side == side::left ? M : N;
+
+            using matrix_b = detail::matrix<L, M, N, LDB>;
+
+            // op(A) is lower triangular when A is lower and not transposed, or upper and
+            // transposed
+            static constexpr bool lower = (Fill == fill::lower) == (Op == op::none);
+
+            template <int Threads = 1>
+            __device__ static void run(int rank, T alpha, const T* A, T* B)
+            {
+                static_assert(Threads > 0, "hipblas::device needs at least one thread");
+
+                if constexpr(Side == side::left)
+                {
+#pragma unroll
+                    for(int j = rank; j < N; j += Threads)
+#pragma unroll
+                        for(int s = 0; s < M; s++)
+                        {
+                            // Forward substitution for a lower op(A), backward for an upper one
+                            const int i   = lower ? s : M - 1 - s;
+                            T         sum = detail::mul(alpha, B[matrix_b::at(i, j)]);
+#pragma unroll
+                            for(int t = 0; t < s; t++)
+                            {
+                                const int l = lower ? t : M - 1 - t;
+                                sum         = detail::sub(
+                                    sum, detail::mul(a(A, i, l), B[matrix_b::at(l, j)]));
+                            }
+                            B[matrix_b::at(i, j)] = divide(sum, a(A, i, i));
+                        }
+                }
+                else
+                {
+#pragma unroll
+                    for(int i = rank; i < M; i += Threads)
+#pragma unroll
+                        for(int s = 0; s < N; s++)
+                        {
+                            // X(i, j) depends on the X(i, l) with op(A)(l, j) != 0 and l != j
+                            const int j   = lower ? N - 1 - s : s;
+                            T         sum = detail::mul(alpha, B[matrix_b::at(i, j)]);
+#pragma unroll
+                            for(int t = 0; t < s; t++)
+                            {
+                                const int l = lower ? N - 1 - t : t;
+                                sum         = detail::sub(
+                                    sum, detail::mul(B[matrix_b::at(i, l)], a(A, l, j)));
+                            }
+                            B[matrix_b::at(i, j)] = divide(sum, a(A, j, j));
+                        }
+                }
+            }
+
+        private:
+            __device__ static T a(const T* A, int i, int l)
+            {
+                return detail::element<Op, L, a_size, a_size, LDA>(A, i, l);
+            }
+
+            __device__ static T divide(T sum, T diag)
+            {
+                if constexpr(Diag == diagonal::unit)
+                    return sum;
+                else
+                    return detail::div(sum, diag);
+            }
+        };
+
+        /*! \brief Returns the sum of x[i] y[i] for i = 0, ..., N - 1, or of conj(x[i]) y[i] with
+         *  Conj, as dotc computes it, over contiguous vectors. With Threads > 1, a power of
+         *  two and the size of the work group, the threads share the elements, reduce their sums
+         *  in scratch, an LDS array of Threads elements, and all of them return the result. */
+        template <typename T, int N, bool Conj = false>
+        struct dot
+        {
+            static_assert(detail::supported<T>, "hipblas::device element type is not supported");
+
+            template <int Threads = 1>
+            __device__ static T run(int rank, const T* x, const T* y, T* scratch = nullptr)
+            {
+                static_assert(Threads > 0 && (Threads & (Threads - 1)) == 0,
+                              "hipblas::device dot needs a power of two of threads");
+
+                T sum = detail::zero<T>();
+#pragma unroll
+                for(int i = rank; i < N; i += Threads)
+                    sum = detail::add(sum, detail::mul(Conj ? detail::conj(x[i]) : x[i], y[i]));
+                if constexpr(Threads == 1)
+                    return sum;
+                else
+                {
+                    scratch[rank] = sum;
+                    __syncthreads();
+#pragma unroll
+                    for(int half = Threads / 2; half > 0; half /= 2)
+                    {
+                        if(rank < half)
+                            scratch[rank] = detail::add(scratch[rank], scratch[rank + half]);
+                        __syncthreads();
+                    }
+                    T result = scratch[0];
+                    __syncthreads();
+                    return result;
+                }
+            }
+        };
+    }
+}
+
+#endif // HIPBLAS_DEVICE_HPP
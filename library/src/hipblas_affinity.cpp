@@ -0,0 +1,307 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "affinity.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "shared_handle.hpp"
+#include "stream_pool.hpp"
+#include <cctype>
+#include <fstream>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// What hipblasCreateWithAttributes made a handle with, and the stream restricted to its CU mask
+// created for it when it was given none
+struct hipblasAffinity
+{
+    int                   device;
+    int                   node;
+    void*                 workspace;
+    size_t                workspace_size;
+    std::vector<uint32_t> cu_mask;
+    hipStream_t           stream = nullptr;
+};
+
+// The attributed handles, the node set for each device, and the pinned memory bound to a node
+// with its size
+static std::mutex                                           affinity_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasAffinity> affinity_handles;
+static std::unordered_map<int, int>                         affinity_devices;
+static std::unordered_map<void*, size_t>                    affinity_mappings;
+
+// Node the system reports for the PCI bus of device, or HIPBLAS_NUMA_NODE_ANY
+static int hipblasAffinityNodeOfDevice(int device)
+{
+#ifdef __linux__
+    char bus_id[64];
+    if(hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_NUMA_NODE_ANY;
+    }
+
+    std::string path = "/sys/bus/pci/devices/";
+    for(const char* c = bus_id; *c; c++)
+        path += char(std::tolower((unsigned char)*c));
+
+    std::ifstream file(path + "/numa_node");
+    int           node = -1;
+    if(file >> node && node >= 0)
+        return node;
+#endif
+    return HIPBLAS_NUMA_NODE_ANY;
+}
+
+// Whether node exists. Without Linux only node 0 does.
+static bool hipblasAffinityNodeExists(int node)
+{
+#ifdef __linux__
+    return std::ifstream("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist")
+        .good();
+#else
+    return node == 0;
+#endif
+}
+
+int hipblasAffinityDeviceNode(int device)
+{
+    std::lock_guard<std::mutex> lock(affinity_mutex);
+
+    auto it = affinity_devices.find(device);
+    return it == affinity_devices.end() ? HIPBLAS_NUMA_NODE_ANY : it->second;
+}
+
+hipError_t hipblasAffinityHostMalloc(void** ptr, size_t bytes, int node)
+{
+#ifdef __linux__
+    // Anonymous pages are only placed when first touched, so the mapping is bound to node before
+    // hipHostRegister pins it
+    void* map = MAP_FAILED;
+    if(node >= 0 && bytes)
+        map = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(map != MAP_FAILED)
+    {
+        // MPOL_BIND of <numaif.h>, which hipBLAS does not otherwise need
+        constexpr int    mpol_bind = 2;
+        constexpr size_t bits      = 8 * sizeof(unsigned long);
+
+        std::vector<unsigned long> mask(node / bits + 1);
+        mask[node / bits] = 1ul << (node % bits);
+        if(syscall(SYS_mbind, map, bytes, mpol_bind, mask.data(), mask.size() * bits + 1, 0) == 0
+           && hipHostRegister(map, bytes, hipHostRegisterDefault) == hipSuccess)
+        {
+            std::lock_guard<std::mutex> lock(affinity_mutex);
+            affinity_mappings[map] = bytes;
+            *ptr                   = map;
+            return hipSuccess;
+        }
+        (void)hipGetLastError();
+        munmap(map, bytes);
+    }
+#endif
+    return hipHostMalloc(ptr, bytes, hipHostMallocDefault);
+}
+
+hipError_t hipblasAffinityHostFree(void* ptr)
+{
+    size_t bytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(affinity_mutex);
+
+        auto it = affinity_mappings.find(ptr);
+        if(it != affinity_mappings.end())
+        {
+            bytes = it->second;
+            affinity_mappings.erase(it);
+        }
+    }
+#ifdef __linux__
+    if(bytes)
+    {
+        hipError_t status = hipHostUnregister(ptr);
+        munmap(ptr, bytes);
+        return status;
+    }
+#endif
+    return hipHostFree(ptr);
+}
+
+void hipblasAffinityErase(hipblasHandle_t handle)
+{
+    hipStream_t stream = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(affinity_mutex);
+
+        auto it = affinity_handles.find(handle);
+        if(it == affinity_handles.end())
+            return;
+        stream = it->second.stream;
+        affinity_handles.erase(it);
+    }
+    if(stream)
+        (void)hipStreamDestroy(stream);
+}
+
+extern "C" hipblasStatus_t hipblasCreateWithAttributes(hipblasHandle_t*                 handle,
+                                                       const hipblasHandleAttributes_t* attributes)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, attributes);
+    if(!handle)
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+    if(!attributes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int current, count;
+    if(hipGetDevice(&current) != hipSuccess || hipGetDeviceCount(&count) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    int device = attributes->device == -1 ? current : attributes->device;
+    int node   = attributes->numaNode;
+    if(device < 0 || device >= count
+       || (node < 0 && node != HIPBLAS_NUMA_NODE_DEVICE && node != HIPBLAS_NUMA_NODE_ANY)
+       || (node >= 0 && !hipblasAffinityNodeExists(node))
+       || (attributes->workspaceSizeInBytes && !attributes->workspace)
+       || attributes->cuMaskSize < 0 || (attributes->cuMaskSize && !attributes->cuMask))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(node == HIPBLAS_NUMA_NODE_DEVICE)
+        node = hipblasAffinityNodeOfDevice(device);
+
+    if(device != current && hipSetDevice(device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    hipStream_t     owned  = nullptr;
+    hipblasStatus_t status = hipblasCreate(handle);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        if(attributes->cuMaskSize)
+            status = hipblasSetComputeUnitMask(*handle, attributes->cuMaskSize, attributes->cuMask);
+        if(status == HIPBLAS_STATUS_SUCCESS && attributes->cuMaskSize && !attributes->stream
+           && hipblasInternalStreamCreate(*handle, &owned) != hipSuccess)
+        {
+            owned = nullptr;
+            (void)hipGetLastError();
+            status = HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetStream(*handle, owned ? owned : attributes->stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && attributes->workspace)
+            status = hipblasSetWorkspace(
+                *handle, attributes->workspace, attributes->workspaceSizeInBytes);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            (void)hipblasDestroy(*handle);
+            *handle = nullptr;
+            if(owned)
+                (void)hipStreamDestroy(owned);
+        }
+    }
+
+    if(device != current)
+        (void)hipSetDevice(current);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::lock_guard<std::mutex> lock(affinity_mutex);
+    if(node != HIPBLAS_NUMA_NODE_ANY)
+        affinity_devices[device] = node;
+    else if(affinity_devices.count(device))
+        node = affinity_devices[device];
+    affinity_handles[*handle]
+        = {device,
+           node,
+           attributes->workspace,
+           attributes->workspaceSizeInBytes,
+           std::vector<uint32_t>(attributes->cuMask, attributes->cuMask + attributes->cuMaskSize),
+           owned};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetDefaultHandleAttributes(hipblasHandleAttributes_t* attributes)
+try
+{
+    HIPBLAS_LAYER(nullptr, attributes);
+    if(!attributes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *attributes = {-1, HIPBLAS_NUMA_NODE_ANY, nullptr, nullptr, 0, nullptr, 0};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetHandleAttributes(hipblasHandle_t            handle,
+                                                      hipblasHandleAttributes_t* attributes)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, attributes);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!attributes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    *attributes = {-1, HIPBLAS_NUMA_NODE_ANY, stream, nullptr, 0, nullptr, 0};
+
+    std::lock_guard<std::mutex> lock(affinity_mutex);
+
+    auto it = affinity_handles.find(handle);
+    if(it != affinity_handles.end())
+    {
+        attributes->device               = it->second.device;
+        attributes->numaNode             = it->second.node;
+        attributes->workspace            = it->second.workspace;
+        attributes->workspaceSizeInBytes = it->second.workspace_size;
+        if(!it->second.cu_mask.empty())
+        {
+            attributes->cuMask     = it->second.cu_mask.data();
+            attributes->cuMaskSize = int(it->second.cu_mask.size());
+        }
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,214 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include <hip/hip_runtime_api.h>
+
+// Runs reduce in device pointer mode, so that it writes its result straight into pinned host
+// memory without synchronizing, then restores the pointer mode of handle and records event on
+// its stream
+template <typename Reduce>
+static hipblasStatus_t hipblasAsyncResult(hipblasHandle_t handle, hipEvent_t event, Reduce reduce)
+{
+    hipblasPointerMode_t pointer_mode;
+    hipStream_t          stream;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    status                  = reduce();
+    hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = restore;
+
+    if(status == HIPBLAS_STATUS_SUCCESS && event && hipEventRecord(event, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+
+extern "C" hipblasStatus_t hipblasDotAsyncEx(hipblasHandle_t handle,
+                                             int             n,
+                                             const void*     x,
+                                             hipDataType     xType,
+                                             int             incx,
+                                             const void*     y,
+                                             hipDataType     yType,
+                                             int             incy,
+                                             void*           result,
+                                             hipDataType     resultType,
+                                             hipDataType     executionType,
+                                             hipEvent_t      event)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, x, xType, incx, y, yType, incy, result, resultType, executionType, event);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!result)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasAsyncResult(handle, event, [&] {
+        return hipblasDotEx_v2(
+            handle, n, x, xType, incx, y, yType, incy, result, resultType, executionType);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasNrm2AsyncEx(hipblasHandle_t handle,
+                                              int             n,
+                                              const void*     x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              void*           result,
+                                              hipDataType     resultType,
+                                              hipDataType     executionType,
+                                              hipEvent_t      event)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, result, resultType, executionType, event);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!result)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasAsyncResult(handle, event, [&] {
+        return hipblasNrm2Ex_v2(handle, n, x, xType, incx, result, resultType, executionType);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasAsumAsyncEx(hipblasHandle_t handle,
+                                              int             n,
+                                              const void*     x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              void*           result,
+                                              hipEvent_t      event)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, result, event);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(xType != HIP_R_32F && xType != HIP_R_64F && xType != HIP_C_32F && xType != HIP_C_64F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!result)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasAsyncResult(handle, event, [&] {
+        switch(xType)
+        {
+        case HIP_R_32F:
+            return hipblasSasum(handle, n, (const float*)x, incx, (float*)result);
+        case HIP_R_64F:
+            return hipblasDasum(handle, n, (const double*)x, incx, (double*)result);
+        case HIP_C_32F:
+            return hipblasScasum(handle, n, (const hipblasComplex*)x, incx, (float*)result);
+        default:
+            return hipblasDzasum(handle, n, (const hipblasDoubleComplex*)x, incx, (double*)result);
+        }
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// iamax or iamin in the precision of xType
+template <bool MAX>
+static hipblasStatus_t hipblasIamaxIaminAsync(hipblasHandle_t handle,
+                                              int             n,
+                                              const void*     x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              int*            result,
+                                              hipEvent_t      event)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(xType != HIP_R_32F && xType != HIP_R_64F && xType != HIP_C_32F && xType != HIP_C_64F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!result)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasAsyncResult(handle, event, [&] {
+        switch(xType)
+        {
+        case HIP_R_32F:
+            return (MAX ? hipblasIsamax : hipblasIsamin)(handle, n, (const float*)x, incx, result);
+        case HIP_R_64F:
+            return (MAX ? hipblasIdamax : hipblasIdamin)(handle, n, (const double*)x, incx, result);
+        case HIP_C_32F:
+            return (MAX ? hipblasIcamax : hipblasIcamin)(
+                handle, n, (const hipblasComplex*)x, incx, result);
+        default:
+            return (MAX ? hipblasIzamax : hipblasIzamin)(
+                handle, n, (const hipblasDoubleComplex*)x, incx, result);
+        }
+    });
+}
+
+extern "C" hipblasStatus_t hipblasIamaxAsyncEx(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               int*            result,
+                                               hipEvent_t      event)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, result, event);
+    return hipblasIamaxIaminAsync<true>(handle, n, x, xType, incx, result, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIaminAsyncEx(hipblasHandle_t handle,
+                                               int             n,
+                                               const void*     x,
+                                               hipDataType     xType,
+                                               int             incx,
+                                               int*            result,
+                                               hipEvent_t      event)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, result, event);
+    return hipblasIamaxIaminAsync<false>(handle, n, x, xType, incx, result, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -42,6 +42,7 @@ extern "C" const char* hipblasStatusToString(hipblasStatus_t status)
         CASE(HIPBLAS_STATUS_HANDLE_IS_NULLPTR);
         CASE(HIPBLAS_STATUS_INVALID_ENUM);
         CASE(HIPBLAS_STATUS_UNKNOWN);
+        CASE(HIPBLAS_STATUS_WORKSPACE_TOO_SMALL);
     }
 #undef CASE
     // We don't use default: so that the compiler warns us if any valid enums are missing
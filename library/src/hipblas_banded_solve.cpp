@@ -0,0 +1,669 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "banded_solve.hpp"
+#include "exceptions.hpp"
+#include "info_summary.hpp"
+#include "layer.hpp"
+#include "pointer_array.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+// Batched tridiagonal and banded solvers of many small systems, with one work group or one thread
+// per system, which both backends share. The library solvers go through a general LU of each
+// system, while these keep the whole factorization of a system in registers or local memory.
+
+// Checks the arguments of both layouts of gtsv, then solves on the device
+template <typename T>
+static hipblasStatus_t hipblasGtsv(hipblasHandle_t handle,
+                                   int             n,
+                                   const T*        dl,
+                                   const T*        d,
+                                   const T*        du,
+                                   hipblasStride   strideA,
+                                   T*              x,
+                                   hipblasStride   strideX,
+                                   bool            interleaved,
+                                   int             batchCount)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!interleaved && (strideA < n || strideX < n))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!dl || !d || !du || !x)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_BANDED_SOLVE
+    return hipblasGtsvKernels(handle, n, dl, d, du, strideA, x, strideX, interleaved, batchCount);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// Checks the arguments of both forms of gbsv, where AB_array and B_array are the pointer arrays of
+// the batched form and null otherwise, then factors and solves on the device
+template <typename T>
+static hipblasStatus_t hipblasGbsv(hipblasHandle_t handle,
+                                   int             n,
+                                   int             kl,
+                                   int             ku,
+                                   int             nrhs,
+                                   T*              AB,
+                                   T* const*       AB_array,
+                                   int             ldab,
+                                   hipblasStride   strideAB,
+                                   int*            ipiv,
+                                   hipblasStride   strideP,
+                                   T*              B,
+                                   T* const*       B_array,
+                                   int             ldb,
+                                   hipblasStride   strideB,
+                                   int*            info,
+                                   int             batchCount,
+                                   bool            strided)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || kl < 0 || ku < 0 || nrhs < 0 || ldab < 2 * kl + ku + 1 || ldb < std::max(1, n)
+       || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batchCount && !info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batchCount && n && ((strided ? !AB : !AB_array) || !ipiv))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batchCount && n && nrhs && (strided ? !B : !B_array))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!n)
+        return hipMemsetAsync(info, 0, sizeof(int) * batchCount, stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_EXECUTION_FAILED;
+
+#ifdef HIPBLAS_BANDED_SOLVE
+    return hipblasGbsvKernels(handle,
+                              n,
+                              kl,
+                              ku,
+                              nrhs,
+                              AB,
+                              AB_array,
+                              ldab,
+                              strideAB,
+                              ipiv,
+                              strideP,
+                              B,
+                              B_array,
+                              ldb,
+                              strideB,
+                              info,
+                              batchCount);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasSgtsvStridedBatched(hipblasHandle_t     handle,
+                                                      const int           n,
+                                                      const float*        dl,
+                                                      const float*        d,
+                                                      const float*        du,
+                                                      const hipblasStride strideA,
+                                                      float*              x,
+                                                      const hipblasStride strideX,
+                                                      const int           batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, dl, d, du, strideA, x, strideX, batchCount);
+    return hipblasGtsv(handle, n, dl, d, du, strideA, x, strideX, false, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgtsvStridedBatched(hipblasHandle_t     handle,
+                                                      const int           n,
+                                                      const double*       dl,
+                                                      const double*       d,
+                                                      const double*       du,
+                                                      const hipblasStride strideA,
+                                                      double*             x,
+                                                      const hipblasStride strideX,
+                                                      const int           batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, dl, d, du, strideA, x, strideX, batchCount);
+    return hipblasGtsv(handle, n, dl, d, du, strideA, x, strideX, false, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgtsvStridedBatched(hipblasHandle_t       handle,
+                                                      const int             n,
+                                                      const hipblasComplex* dl,
+                                                      const hipblasComplex* d,
+                                                      const hipblasComplex* du,
+                                                      const hipblasStride   strideA,
+                                                      hipblasComplex*       x,
+                                                      const hipblasStride   strideX,
+                                                      const int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, dl, d, du, strideA, x, strideX, batchCount);
+    return hipblasGtsv(handle, n, dl, d, du, strideA, x, strideX, false, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgtsvStridedBatched(hipblasHandle_t             handle,
+                                                      const int                   n,
+                                                      const hipblasDoubleComplex* dl,
+                                                      const hipblasDoubleComplex* d,
+                                                      const hipblasDoubleComplex* du,
+                                                      const hipblasStride         strideA,
+                                                      hipblasDoubleComplex*       x,
+                                                      const hipblasStride         strideX,
+                                                      const int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, dl, d, du, strideA, x, strideX, batchCount);
+    return hipblasGtsv(handle, n, dl, d, du, strideA, x, strideX, false, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgtsvInterleavedBatched(hipblasHandle_t handle,
+                                                          const int       n,
+                                                          const float*    dl,
+                                                          const float*    d,
+                                                          const float*    du,
+                                                          float*          x,
+                                                          const int       batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, dl, d, du, x, batchCount);
+    return hipblasGtsv(handle, n, dl, d, du, 0, x, 0, true, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgtsvInterleavedBatched(hipblasHandle_t handle,
+                                                          const int       n,
+                                                          const double*   dl,
+                                                          const double*   d,
+                                                          const double*   du,
+                                                          double*         x,
+                                                          const int       batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, dl, d, du, x, batchCount);
+    return hipblasGtsv(handle, n, dl, d, du, 0, x, 0, true, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgtsvInterleavedBatched(hipblasHandle_t       handle,
+                                                          const int             n,
+                                                          const hipblasComplex* dl,
+                                                          const hipblasComplex* d,
+                                                          const hipblasComplex* du,
+                                                          hipblasComplex*       x,
+                                                          const int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, dl, d, du, x, batchCount);
+    return hipblasGtsv(handle, n, dl, d, du, 0, x, 0, true, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgtsvInterleavedBatched(hipblasHandle_t             handle,
+                                                          const int                   n,
+                                                          const hipblasDoubleComplex* dl,
+                                                          const hipblasDoubleComplex* d,
+                                                          const hipblasDoubleComplex* du,
+                                                          hipblasDoubleComplex*       x,
+                                                          const int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, dl, d, du, x, batchCount);
+    return hipblasGtsv(handle, n, dl, d, du, 0, x, 0, true, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgbsvBatched(hipblasHandle_t handle,
+                                               const int       n,
+                                               const int       kl,
+                                               const int       ku,
+                                               const int       nrhs,
+                                               float* const    AB[],
+                                               const int       ldab,
+                                               int*            ipiv,
+                                               float* const    B[],
+                                               const int       ldb,
+                                               int*            info,
+                                               const int       batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb, info, batchCount);
+    HIPBLAS_POINTER_ARRAYS(handle, batchCount, AB, B);
+    hipblasStatus_t status = hipblasGbsv<float>(handle,
+                                                n,
+                                                kl,
+                                                ku,
+                                                nrhs,
+                                                nullptr,
+                                                AB,
+                                                ldab,
+                                                0,
+                                                ipiv,
+                                                n,
+                                                nullptr,
+                                                B,
+                                                ldb,
+                                                0,
+                                                info,
+                                                batchCount,
+                                                false);
+    return hipblasInfoSummaryAfter(handle, info, batchCount, status);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgbsvBatched(hipblasHandle_t handle,
+                                               const int       n,
+                                               const int       kl,
+                                               const int       ku,
+                                               const int       nrhs,
+                                               double* const   AB[],
+                                               const int       ldab,
+                                               int*            ipiv,
+                                               double* const   B[],
+                                               const int       ldb,
+                                               int*            info,
+                                               const int       batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb, info, batchCount);
+    HIPBLAS_POINTER_ARRAYS(handle, batchCount, AB, B);
+    hipblasStatus_t status = hipblasGbsv<double>(handle,
+                                                 n,
+                                                 kl,
+                                                 ku,
+                                                 nrhs,
+                                                 nullptr,
+                                                 AB,
+                                                 ldab,
+                                                 0,
+                                                 ipiv,
+                                                 n,
+                                                 nullptr,
+                                                 B,
+                                                 ldb,
+                                                 0,
+                                                 info,
+                                                 batchCount,
+                                                 false);
+    return hipblasInfoSummaryAfter(handle, info, batchCount, status);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbsvBatched(hipblasHandle_t       handle,
+                                               const int             n,
+                                               const int             kl,
+                                               const int             ku,
+                                               const int             nrhs,
+                                               hipblasComplex* const AB[],
+                                               const int             ldab,
+                                               int*                  ipiv,
+                                               hipblasComplex* const B[],
+                                               const int             ldb,
+                                               int*                  info,
+                                               const int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb, info, batchCount);
+    HIPBLAS_POINTER_ARRAYS(handle, batchCount, AB, B);
+    hipblasStatus_t status = hipblasGbsv<hipblasComplex>(handle,
+                                                         n,
+                                                         kl,
+                                                         ku,
+                                                         nrhs,
+                                                         nullptr,
+                                                         AB,
+                                                         ldab,
+                                                         0,
+                                                         ipiv,
+                                                         n,
+                                                         nullptr,
+                                                         B,
+                                                         ldb,
+                                                         0,
+                                                         info,
+                                                         batchCount,
+                                                         false);
+    return hipblasInfoSummaryAfter(handle, info, batchCount, status);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbsvBatched(hipblasHandle_t             handle,
+                                               const int                   n,
+                                               const int                   kl,
+                                               const int                   ku,
+                                               const int                   nrhs,
+                                               hipblasDoubleComplex* const AB[],
+                                               const int                   ldab,
+                                               int*                        ipiv,
+                                               hipblasDoubleComplex* const B[],
+                                               const int                   ldb,
+                                               int*                        info,
+                                               const int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb, info, batchCount);
+    HIPBLAS_POINTER_ARRAYS(handle, batchCount, AB, B);
+    hipblasStatus_t status = hipblasGbsv<hipblasDoubleComplex>(handle,
+                                                               n,
+                                                               kl,
+                                                               ku,
+                                                               nrhs,
+                                                               nullptr,
+                                                               AB,
+                                                               ldab,
+                                                               0,
+                                                               ipiv,
+                                                               n,
+                                                               nullptr,
+                                                               B,
+                                                               ldb,
+                                                               0,
+                                                               info,
+                                                               batchCount,
+                                                               false);
+    return hipblasInfoSummaryAfter(handle, info, batchCount, status);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgbsvStridedBatched(hipblasHandle_t     handle,
+                                                      const int           n,
+                                                      const int           kl,
+                                                      const int           ku,
+                                                      const int           nrhs,
+                                                      float*              AB,
+                                                      const int           ldab,
+                                                      const hipblasStride strideAB,
+                                                      int*                ipiv,
+                                                      const hipblasStride strideP,
+                                                      float*              B,
+                                                      const int           ldb,
+                                                      const hipblasStride strideB,
+                                                      int*                info,
+                                                      const int           batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  n,
+                  kl,
+                  ku,
+                  nrhs,
+                  AB,
+                  ldab,
+                  strideAB,
+                  ipiv,
+                  strideP,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    hipblasStatus_t status = hipblasGbsv<float>(handle,
+                                                n,
+                                                kl,
+                                                ku,
+                                                nrhs,
+                                                AB,
+                                                nullptr,
+                                                ldab,
+                                                strideAB,
+                                                ipiv,
+                                                strideP,
+                                                B,
+                                                nullptr,
+                                                ldb,
+                                                strideB,
+                                                info,
+                                                batchCount,
+                                                true);
+    return hipblasInfoSummaryAfter(handle, info, batchCount, status);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgbsvStridedBatched(hipblasHandle_t     handle,
+                                                      const int           n,
+                                                      const int           kl,
+                                                      const int           ku,
+                                                      const int           nrhs,
+                                                      double*             AB,
+                                                      const int           ldab,
+                                                      const hipblasStride strideAB,
+                                                      int*                ipiv,
+                                                      const hipblasStride strideP,
+                                                      double*             B,
+                                                      const int           ldb,
+                                                      const hipblasStride strideB,
+                                                      int*                info,
+                                                      const int           batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  n,
+                  kl,
+                  ku,
+                  nrhs,
+                  AB,
+                  ldab,
+                  strideAB,
+                  ipiv,
+                  strideP,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    hipblasStatus_t status = hipblasGbsv<double>(handle,
+                                                 n,
+                                                 kl,
+                                                 ku,
+                                                 nrhs,
+                                                 AB,
+                                                 nullptr,
+                                                 ldab,
+                                                 strideAB,
+                                                 ipiv,
+                                                 strideP,
+                                                 B,
+                                                 nullptr,
+                                                 ldb,
+                                                 strideB,
+                                                 info,
+                                                 batchCount,
+                                                 true);
+    return hipblasInfoSummaryAfter(handle, info, batchCount, status);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbsvStridedBatched(hipblasHandle_t     handle,
+                                                      const int           n,
+                                                      const int           kl,
+                                                      const int           ku,
+                                                      const int           nrhs,
+                                                      hipblasComplex*     AB,
+                                                      const int           ldab,
+                                                      const hipblasStride strideAB,
+                                                      int*                ipiv,
+                                                      const hipblasStride strideP,
+                                                      hipblasComplex*     B,
+                                                      const int           ldb,
+                                                      const hipblasStride strideB,
+                                                      int*                info,
+                                                      const int           batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  n,
+                  kl,
+                  ku,
+                  nrhs,
+                  AB,
+                  ldab,
+                  strideAB,
+                  ipiv,
+                  strideP,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    hipblasStatus_t status = hipblasGbsv<hipblasComplex>(handle,
+                                                         n,
+                                                         kl,
+                                                         ku,
+                                                         nrhs,
+                                                         AB,
+                                                         nullptr,
+                                                         ldab,
+                                                         strideAB,
+                                                         ipiv,
+                                                         strideP,
+                                                         B,
+                                                         nullptr,
+                                                         ldb,
+                                                         strideB,
+                                                         info,
+                                                         batchCount,
+                                                         true);
+    return hipblasInfoSummaryAfter(handle, info, batchCount, status);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbsvStridedBatched(hipblasHandle_t       handle,
+                                                      const int             n,
+                                                      const int             kl,
+                                                      const int             ku,
+                                                      const int             nrhs,
+                                                      hipblasDoubleComplex* AB,
+                                                      const int             ldab,
+                                                      const hipblasStride   strideAB,
+                                                      int*                  ipiv,
+                                                      const hipblasStride   strideP,
+                                                      hipblasDoubleComplex* B,
+                                                      const int             ldb,
+                                                      const hipblasStride   strideB,
+                                                      int*                  info,
+                                                      const int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  n,
+                  kl,
+                  ku,
+                  nrhs,
+                  AB,
+                  ldab,
+                  strideAB,
+                  ipiv,
+                  strideP,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    hipblasStatus_t status = hipblasGbsv<hipblasDoubleComplex>(handle,
+                                                               n,
+                                                               kl,
+                                                               ku,
+                                                               nrhs,
+                                                               AB,
+                                                               nullptr,
+                                                               ldab,
+                                                               strideAB,
+                                                               ipiv,
+                                                               strideP,
+                                                               B,
+                                                               nullptr,
+                                                               ldb,
+                                                               strideB,
+                                                               info,
+                                                               batchCount,
+                                                               true);
+    return hipblasInfoSummaryAfter(handle, info, batchCount, status);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
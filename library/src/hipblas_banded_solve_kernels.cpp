@@ -0,0 +1,684 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "banded_solve.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+// Threads of the parallel cyclic reduction, one per equation of a system kept in local memory.
+// Larger systems are solved by the Thomas algorithm with one thread per system.
+constexpr int gtsv_pcr_threads = hipblas_gtsv_pcr_max_n;
+
+// Threads of a work group of the kernels with one thread per system
+constexpr int banded_threads = 128;
+
+// Largest grid. The work groups loop over the remaining systems.
+constexpr int banded_max_grid = 65535;
+
+// The complex types are only read and written, so both layouts of hipblasComplex map to this
+template <typename R>
+struct hipblasBandedComplex
+{
+    R x, y;
+
+    __device__ hipblasBandedComplex(R re = 0, R im = 0)
+        : x(re)
+        , y(im)
+    {
+    }
+};
+
+template <typename R>
+__device__ inline hipblasBandedComplex<R> operator+(hipblasBandedComplex<R> a,
+                                                    hipblasBandedComplex<R> b)
+{
+    return {a.x + b.x, a.y + b.y};
+}
+
+template <typename R>
+__device__ inline hipblasBandedComplex<R> operator-(hipblasBandedComplex<R> a,
+                                                    hipblasBandedComplex<R> b)
+{
+    return {a.x - b.x, a.y - b.y};
+}
+
+template <typename R>
+__device__ inline hipblasBandedComplex<R> operator-(hipblasBandedComplex<R> a)
+{
+    return {-a.x, -a.y};
+}
+
+template <typename R>
+__device__ inline hipblasBandedComplex<R> operator*(hipblasBandedComplex<R> a,
+                                                    hipblasBandedComplex<R> b)
+{
+    return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x};
+}
+
+template <typename R>
+__device__ inline hipblasBandedComplex<R> operator/(hipblasBandedComplex<R> a,
+                                                    hipblasBandedComplex<R> b)
+{
+    R den = b.x * b.x + b.y * b.y;
+    return {(a.x * b.x + a.y * b.y) / den, (a.y * b.x - a.x * b.y) / den};
+}
+
+// The magnitude LAPACK i?amax compares pivots by, |re| + |im| for a complex value
+template <typename R>
+__device__ inline R hipblasBandedAbs1(R a)
+{
+    return a < 0 ? -a : a;
+}
+
+template <typename R>
+__device__ inline R hipblasBandedAbs1(hipblasBandedComplex<R> a)
+{
+    return hipblasBandedAbs1(a.x) + hipblasBandedAbs1(a.y);
+}
+
+// Local memory of a work group holding count values of T, which may not have a trivial
+// constructor, so it is declared as doubles
+#define HIPBLAS_BANDED_LOCAL(T, name, count)                         \
+    __shared__ double name##_storage[(sizeof(T) * (count) + 7) / 8]; \
+    T*                name = (T*)name##_storage;
+
+// Parallel cyclic reduction of one system per work group, thread i holding equation i. Each step
+// eliminates the unknowns s away from every equation with its neighbours s above and below, which
+// couples the equations 2s apart, until after ceil(log2(n)) steps every equation holds only its
+// own unknown.
+template <typename T>
+__global__ void __launch_bounds__(gtsv_pcr_threads)
+    hipblasGtsvPcrKernel(int           n,
+                         const T*      dl,
+                         const T*      d,
+                         const T*      du,
+                         hipblasStride strideA,
+                         T*            x,
+                         hipblasStride strideX,
+                         int           batch_count)
+{
+    HIPBLAS_BANDED_LOCAL(T, sa, gtsv_pcr_threads)
+    HIPBLAS_BANDED_LOCAL(T, sb, gtsv_pcr_threads)
+    HIPBLAS_BANDED_LOCAL(T, sc, gtsv_pcr_threads)
+    HIPBLAS_BANDED_LOCAL(T, sx, gtsv_pcr_threads)
+
+    const int i = threadIdx.x;
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        const size_t offset_a = b * strideA;
+        T*           xb       = x + b * strideX;
+
+        if(i < n)
+        {
+            sa[i] = i > 0 ? dl[offset_a + i] : T(0);
+            sb[i] = d[offset_a + i];
+            sc[i] = i < n - 1 ? du[offset_a + i] : T(0);
+            sx[i] = xb[i];
+        }
+        __syncthreads();
+
+        for(int s = 1; s < n; s *= 2)
+        {
+            T a, bb, c, r;
+            if(i < n)
+            {
+                a  = T(0);
+                bb = sb[i];
+                c  = T(0);
+                r  = sx[i];
+                if(i - s >= 0)
+                {
+                    T alpha = -sa[i] / sb[i - s];
+                    a       = alpha * sa[i - s];
+                    bb      = bb + alpha * sc[i - s];
+                    r       = r + alpha * sx[i - s];
+                }
+                if(i + s < n)
+                {
+                    T gamma = -sc[i] / sb[i + s];
+                    c       = gamma * sc[i + s];
+                    bb      = bb + gamma * sa[i + s];
+                    r       = r + gamma * sx[i + s];
+                }
+            }
+            __syncthreads();
+
+            if(i < n)
+            {
+                sa[i] = a;
+                sb[i] = bb;
+                sc[i] = c;
+                sx[i] = r;
+            }
+            __syncthreads();
+        }
+
+        if(i < n)
+            xb[i] = sx[i] / sb[i];
+        __syncthreads();
+    }
+}
+
+// The Thomas algorithm with one thread per system, element j of system b being at
+// j * elem_stride + b * sys_stride of each array. The modified superdiagonal is kept in work,
+// interleaved so that its accesses are coalesced.
+template <typename T>
+__global__ void __launch_bounds__(banded_threads)
+    hipblasGtsvThomasKernel(int           n,
+                            const T*      dl,
+                            const T*      d,
+                            const T*      du,
+                            hipblasStride elem_stride_a,
+                            hipblasStride sys_stride_a,
+                            T*            x,
+                            hipblasStride elem_stride_x,
+                            hipblasStride sys_stride_x,
+                            T*            work,
+                            int           batch_count)
+{
+    for(size_t b = blockIdx.x * size_t(blockDim.x) + threadIdx.x; b < size_t(batch_count);
+        b += size_t(gridDim.x) * blockDim.x)
+    {
+        auto A = [&](const T* v, int j) { return v[j * elem_stride_a + b * sys_stride_a]; };
+        auto X = [&](int j) -> T& { return x[j * elem_stride_x + b * sys_stride_x]; };
+        auto W = [&](int j) -> T& { return work[j * size_t(batch_count) + b]; };
+
+        // Forward elimination, dividing every row by its pivot
+        T pivot = A(d, 0);
+        if(n > 1)
+            W(0) = A(du, 0) / pivot;
+        T previous = X(0) / pivot;
+        X(0)       = previous;
+        for(int j = 1; j < n; j++)
+        {
+            T l   = A(dl, j);
+            pivot = A(d, j) - l * W(j - 1);
+            if(j < n - 1)
+                W(j) = A(du, j) / pivot;
+            previous = (X(j) - l * previous) / pivot;
+            X(j)     = previous;
+        }
+
+        // Back substitution
+        for(int j = n - 2; j >= 0; j--)
+        {
+            previous = X(j) - W(j) * previous;
+            X(j)     = previous;
+        }
+    }
+}
+
+// LAPACK ?gbtf2 and ?gbtrs with one thread per system. Element (i, j) of the band of AB_b is at
+// AB_b[kv + i - j + j * ldab] with kv = kl + ku, and the kl rows above it receive the fill-in of
+// the row interchanges. B_b is only solved when the factorization found no zero pivot.
+template <typename T>
+__global__ void __launch_bounds__(banded_threads)
+    hipblasGbsvKernel(int           n,
+                      int           kl,
+                      int           ku,
+                      int           nrhs,
+                      T*            AB,
+                      T* const*     AB_array,
+                      int           ldab,
+                      hipblasStride strideAB,
+                      int*          ipiv,
+                      hipblasStride strideP,
+                      T*            B,
+                      T* const*     B_array,
+                      int           ldb,
+                      hipblasStride strideB,
+                      int*          info,
+                      int           batch_count)
+{
+    const int kv = kl + ku;
+    for(size_t b = blockIdx.x * size_t(blockDim.x) + threadIdx.x; b < size_t(batch_count);
+        b += size_t(gridDim.x) * blockDim.x)
+    {
+        T*   ABb = AB_array ? AB_array[b] : AB + b * strideAB;
+        T*   Bb  = B_array ? B_array[b] : B + b * strideB;
+        int* pb  = ipiv + b * strideP;
+
+        // Band row r of column j
+        auto E = [&](int r, int j) -> T& { return ABb[r + size_t(j) * ldab]; };
+
+        // The fill-in of the first columns, which no interchange has reached yet
+        for(int j = ku + 1; j < std::min(kv, n); j++)
+            for(int r = kv - j; r < kl; r++)
+                E(r, j) = T(0);
+
+        int first_zero = 0;
+        int ju         = 0;
+        for(int j = 0; j < n; j++)
+        {
+            if(j + kv < n)
+                for(int r = 0; r < kl; r++)
+                    E(r, j + kv) = T(0);
+
+            // The pivot among the km rows below the diagonal and the diagonal
+            const int km   = std::min(kl, n - 1 - j);
+            int       jp   = 0;
+            auto      best = hipblasBandedAbs1(E(kv, j));
+            for(int p = 1; p <= km; p++)
+            {
+                auto v = hipblasBandedAbs1(E(kv + p, j));
+                if(v > best)
+                {
+                    best = v;
+                    jp   = p;
+                }
+            }
+            pb[j] = j + jp + 1;
+
+            if(best == 0)
+            {
+                if(!first_zero)
+                    first_zero = j + 1;
+                continue;
+            }
+
+            // Row j and row j + jp of the columns j to ju, where the band row of a matrix row
+            // drops by one from one column to the next
+            ju = std::max(ju, std::min(j + ku + jp, n - 1));
+            if(jp)
+                for(int c = 0; c <= ju - j; c++)
+                {
+                    T swap                = E(kv + jp - c, j + c);
+                    E(kv + jp - c, j + c) = E(kv - c, j + c);
+                    E(kv - c, j + c)      = swap;
+                }
+
+            if(km)
+            {
+                T pivot = E(kv, j);
+                for(int r = 1; r <= km; r++)
+                    E(kv + r, j) = E(kv + r, j) / pivot;
+                for(int c = 1; c <= ju - j; c++)
+                {
+                    T u = E(kv - c, j + c);
+                    for(int r = 1; r <= km; r++)
+                        E(kv + r - c, j + c) = E(kv + r - c, j + c) - E(kv + r, j) * u;
+                }
+            }
+        }
+        info[b] = first_zero;
+        if(first_zero)
+            continue;
+
+        for(int k = 0; k < nrhs; k++)
+        {
+            T* xb = Bb + size_t(k) * ldb;
+
+            // L with the interchanges, then U, whose band is kv wide
+            for(int j = 0; j < n - 1 && kl; j++)
+            {
+                const int l = pb[j] - 1;
+                if(l != j)
+                {
+                    T swap = xb[l];
+                    xb[l]  = xb[j];
+                    xb[j]  = swap;
+                }
+                const int lm = std::min(kl, n - 1 - j);
+                for(int r = 1; r <= lm; r++)
+                    xb[j + r] = xb[j + r] - E(kv + r, j) * xb[j];
+            }
+            for(int j = n - 1; j >= 0; j--)
+            {
+                xb[j]        = xb[j] / E(kv, j);
+                const int um = std::min(j, kv);
+                for(int r = 1; r <= um; r++)
+                    xb[j - r] = xb[j - r] - E(kv - r, j) * xb[j];
+            }
+        }
+    }
+}
+
+template <typename T, typename Th>
+static hipblasStatus_t hipblasGtsvLaunch(hipblasHandle_t handle,
+                                         int             n,
+                                         const Th*       dl,
+                                         const Th*       d,
+                                         const Th*       du,
+                                         hipblasStride   strideA,
+                                         Th*             x,
+                                         hipblasStride   strideX,
+                                         bool            interleaved,
+                                         int             batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(!interleaved && n <= hipblas_gtsv_pcr_max_n)
+    {
+        // A whole number of wavefronts covering the equations
+        const int threads = (n + 63) / 64 * 64;
+        hipLaunchKernelGGL((hipblasGtsvPcrKernel<T>),
+                           dim3(std::min(batch_count, banded_max_grid)),
+                           dim3(threads),
+                           0,
+                           stream,
+                           n,
+                           (const T*)dl,
+                           (const T*)d,
+                           (const T*)du,
+                           strideA,
+                           (T*)x,
+                           strideX,
+                           batch_count);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    T* work;
+    if(hipMallocAsync((void**)&work, sizeof(T) * size_t(n) * batch_count, stream) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    const hipblasStride elem_stride_a = interleaved ? batch_count : 1;
+    const hipblasStride sys_stride_a  = interleaved ? 1 : strideA;
+    const hipblasStride elem_stride_x = interleaved ? batch_count : 1;
+    const hipblasStride sys_stride_x  = interleaved ? 1 : strideX;
+    const size_t        blocks        = (size_t(batch_count) + banded_threads - 1) / banded_threads;
+    hipLaunchKernelGGL((hipblasGtsvThomasKernel<T>),
+                       dim3(std::min(blocks, size_t(banded_max_grid))),
+                       dim3(banded_threads),
+                       0,
+                       stream,
+                       n,
+                       (const T*)dl,
+                       (const T*)d,
+                       (const T*)du,
+                       elem_stride_a,
+                       sys_stride_a,
+                       (T*)x,
+                       elem_stride_x,
+                       sys_stride_x,
+                       work,
+                       batch_count);
+    status = hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                             : HIPBLAS_STATUS_EXECUTION_FAILED;
+    (void)hipFreeAsync(work, stream);
+    return status;
+}
+
+template <typename T, typename Th>
+static hipblasStatus_t hipblasGbsvLaunch(hipblasHandle_t handle,
+                                         int             n,
+                                         int             kl,
+                                         int             ku,
+                                         int             nrhs,
+                                         Th*             AB,
+                                         Th* const*      AB_array,
+                                         int             ldab,
+                                         hipblasStride   strideAB,
+                                         int*            ipiv,
+                                         hipblasStride   strideP,
+                                         Th*             B,
+                                         Th* const*      B_array,
+                                         int             ldb,
+                                         hipblasStride   strideB,
+                                         int*            info,
+                                         int             batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    const size_t blocks = (size_t(batch_count) + banded_threads - 1) / banded_threads;
+    hipLaunchKernelGGL((hipblasGbsvKernel<T>),
+                       dim3(std::min(blocks, size_t(banded_max_grid))),
+                       dim3(banded_threads),
+                       0,
+                       stream,
+                       n,
+                       kl,
+                       ku,
+                       nrhs,
+                       (T*)AB,
+                       (T* const*)AB_array,
+                       ldab,
+                       strideAB,
+                       ipiv,
+                       strideP,
+                       (T*)B,
+                       (T* const*)B_array,
+                       ldb,
+                       strideB,
+                       info,
+                       batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasGtsvKernels(hipblasHandle_t handle,
+                                   int             n,
+                                   const float*    dl,
+                                   const float*    d,
+                                   const float*    du,
+                                   hipblasStride   strideA,
+                                   float*          x,
+                                   hipblasStride   strideX,
+                                   bool            interleaved,
+                                   int             batch_count)
+{
+    return hipblasGtsvLaunch<float>(
+        handle, n, dl, d, du, strideA, x, strideX, interleaved, batch_count);
+}
+
+hipblasStatus_t hipblasGtsvKernels(hipblasHandle_t handle,
+                                   int             n,
+                                   const double*   dl,
+                                   const double*   d,
+                                   const double*   du,
+                                   hipblasStride   strideA,
+                                   double*         x,
+                                   hipblasStride   strideX,
+                                   bool            interleaved,
+                                   int             batch_count)
+{
+    return hipblasGtsvLaunch<double>(
+        handle, n, dl, d, du, strideA, x, strideX, interleaved, batch_count);
+}
+
+hipblasStatus_t hipblasGtsvKernels(hipblasHandle_t       handle,
+                                   int                   n,
+                                   const hipblasComplex* dl,
+                                   const hipblasComplex* d,
+                                   const hipblasComplex* du,
+                                   hipblasStride         strideA,
+                                   hipblasComplex*       x,
+                                   hipblasStride         strideX,
+                                   bool                  interleaved,
+                                   int                   batch_count)
+{
+    return hipblasGtsvLaunch<hipblasBandedComplex<float>>(
+        handle, n, dl, d, du, strideA, x, strideX, interleaved, batch_count);
+}
+
+hipblasStatus_t hipblasGtsvKernels(hipblasHandle_t             handle,
+                                   int                         n,
+                                   const hipblasDoubleComplex* dl,
+                                   const hipblasDoubleComplex* d,
+                                   const hipblasDoubleComplex* du,
+                                   hipblasStride               strideA,
+                                   hipblasDoubleComplex*       x,
+                                   hipblasStride               strideX,
+                                   bool                        interleaved,
+                                   int                         batch_count)
+{
+    return hipblasGtsvLaunch<hipblasBandedComplex<double>>(
+        handle, n, dl, d, du, strideA, x, strideX, interleaved, batch_count);
+}
+
+hipblasStatus_t hipblasGbsvKernels(hipblasHandle_t handle,
+                                   int             n,
+                                   int             kl,
+                                   int             ku,
+                                   int             nrhs,
+                                   float*          AB,
+                                   float* const*   AB_array,
+                                   int             ldab,
+                                   hipblasStride   strideAB,
+                                   int*            ipiv,
+                                   hipblasStride   strideP,
+                                   float*          B,
+                                   float* const*   B_array,
+                                   int             ldb,
+                                   hipblasStride   strideB,
+                                   int*            info,
+                                   int             batch_count)
+{
+    return hipblasGbsvLaunch<float>(handle,
+                                    n,
+                                    kl,
+                                    ku,
+                                    nrhs,
+                                    AB,
+                                    AB_array,
+                                    ldab,
+                                    strideAB,
+                                    ipiv,
+                                    strideP,
+                                    B,
+                                    B_array,
+                                    ldb,
+                                    strideB,
+                                    info,
+                                    batch_count);
+}
+
+hipblasStatus_t hipblasGbsvKernels(hipblasHandle_t handle,
+                                   int             n,
+                                   int             kl,
+                                   int             ku,
+                                   int             nrhs,
+                                   double*         AB,
+                                   double* const*  AB_array,
+                                   int             ldab,
+                                   hipblasStride   strideAB,
+                                   int*            ipiv,
+                                   hipblasStride   strideP,
+                                   double*         B,
+                                   double* const*  B_array,
+                                   int             ldb,
+                                   hipblasStride   strideB,
+                                   int*            info,
+                                   int             batch_count)
+{
+    return hipblasGbsvLaunch<double>(handle,
+                                     n,
+                                     kl,
+                                     ku,
+                                     nrhs,
+                                     AB,
+                                     AB_array,
+                                     ldab,
+                                     strideAB,
+                                     ipiv,
+                                     strideP,
+                                     B,
+                                     B_array,
+                                     ldb,
+                                     strideB,
+                                     info,
+                                     batch_count);
+}
+
+hipblasStatus_t hipblasGbsvKernels(hipblasHandle_t        handle,
+                                   int                    n,
+                                   int                    kl,
+                                   int                    ku,
+                                   int                    nrhs,
+                                   hipblasComplex*        AB,
+                                   hipblasComplex* const* AB_array,
+                                   int                    ldab,
+                                   hipblasStride          strideAB,
+                                   int*                   ipiv,
+                                   hipblasStride          strideP,
+                                   hipblasComplex*        B,
+                                   hipblasComplex* const* B_array,
+                                   int                    ldb,
+                                   hipblasStride          strideB,
+                                   int*                   info,
+                                   int                    batch_count)
+{
+    return hipblasGbsvLaunch<hipblasBandedComplex<float>>(handle,
+                                                          n,
+                                                          kl,
+                                                          ku,
+                                                          nrhs,
+                                                          AB,
+                                                          AB_array,
+                                                          ldab,
+                                                          strideAB,
+                                                          ipiv,
+                                                          strideP,
+                                                          B,
+                                                          B_array,
+                                                          ldb,
+                                                          strideB,
+                                                          info,
+                                                          batch_count);
+}
+
+hipblasStatus_t hipblasGbsvKernels(hipblasHandle_t              handle,
+                                   int                          n,
+                                   int                          kl,
+                                   int                          ku,
+                                   int                          nrhs,
+                                   hipblasDoubleComplex*        AB,
+                                   hipblasDoubleComplex* const* AB_array,
+                                   int                          ldab,
+                                   hipblasStride                strideAB,
+                                   int*                         ipiv,
+                                   hipblasStride                strideP,
+                                   hipblasDoubleComplex*        B,
+                                   hipblasDoubleComplex* const* B_array,
+                                   int                          ldb,
+                                   hipblasStride                strideB,
+                                   int*                         info,
+                                   int                          batch_count)
+{
+    return hipblasGbsvLaunch<hipblasBandedComplex<double>>(handle,
+                                                           n,
+                                                           kl,
+                                                           ku,
+                                                           nrhs,
+                                                           AB,
+                                                           AB_array,
+                                                           ldab,
+                                                           strideAB,
+                                                           ipiv,
+                                                           strideP,
+                                                           B,
+                                                           B_array,
+                                                           ldb,
+                                                           strideB,
+                                                           info,
+                                                           batch_count);
+}
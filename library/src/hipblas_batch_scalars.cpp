@@ -0,0 +1,1106 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "batch_scalars.hpp"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "scratch.hpp"
+#include "shared_handle.hpp"
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+// The handles with a scalar stride. scalar_handles counts them, so batched calls skip the lock
+// while no handle has one.
+static std::mutex                                        scalar_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasStride> scalar_strides;
+static std::atomic<int>                                  scalar_handles{0};
+
+hipblasStride hipblasBatchScalarStride(hipblasHandle_t handle)
+{
+    if(!scalar_handles.load(std::memory_order_relaxed))
+        return 0;
+
+    hipblasStride stride = 0;
+    {
+        std::lock_guard<std::mutex> lock(scalar_mutex);
+        auto                        it = scalar_strides.find(handle);
+        if(it != scalar_strides.end())
+            stride = it->second;
+    }
+
+    hipblasPointerMode_t pointer_mode;
+    if(!stride || hipblasGetPointerMode(handle, &pointer_mode) != HIPBLAS_STATUS_SUCCESS
+       || pointer_mode != HIPBLAS_POINTER_MODE_DEVICE)
+        return 0;
+    return stride;
+}
+
+void hipblasBatchScalarStrideErase(hipblasHandle_t handle)
+{
+    if(!scalar_handles.load(std::memory_order_relaxed))
+        return;
+
+    std::lock_guard<std::mutex> lock(scalar_mutex);
+    scalar_handles -= int(scalar_strides.erase(handle));
+}
+
+extern "C" hipblasStatus_t hipblasSetBatchScalarStride(hipblasHandle_t handle, hipblasStride stride)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, stride);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(stride < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(scalar_mutex);
+    if(stride)
+    {
+        auto inserted = scalar_strides.insert_or_assign(handle, stride);
+        scalar_handles += int(inserted.second);
+    }
+    else
+        scalar_handles -= int(scalar_strides.erase(handle));
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetBatchScalarStride(hipblasHandle_t handle,
+                                                       hipblasStride*  stride)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, stride);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!stride)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(scalar_mutex);
+    auto                        it = scalar_strides.find(handle);
+    *stride                        = it == scalar_strides.end() ? 0 : it->second;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// Type of alpha and beta of a gemm computing in compute_type, complex for a complex c_type.
+// Returns false for an unknown compute_type.
+static bool hipblasBatchScalarType(hipblasComputeType_t compute_type,
+                                   hipDataType          c_type,
+                                   hipDataType&         scalar_type)
+{
+    bool complex = c_type == HIP_C_32F || c_type == HIP_C_64F;
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        scalar_type = HIP_R_16F;
+        return true;
+    case HIPBLAS_COMPUTE_32F:
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+    case HIPBLAS_COMPUTE_32F_FAST_16BFX3:
+        scalar_type = complex ? HIP_C_32F : HIP_R_32F;
+        return true;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        scalar_type = complex ? HIP_C_64F : HIP_R_64F;
+        return true;
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        scalar_type = HIP_R_32I;
+        return true;
+    }
+    return false;
+}
+
+#ifdef HIPBLAS_BATCH_SCALARS
+// W_i := op( A_i ) * op( B_i ) into a scratch buffer with host scalars, then one kernel applies
+// alpha_i and beta_i. Returns HIPBLAS_STATUS_NOT_SUPPORTED, without writing C, when the kernel or
+// the backend has no support for W of scalar_type.
+static hipblasStatus_t hipblasGemmBatchScalarsFused(hipblasHandle_t      handle,
+                                                    hipblasOperation_t   transa,
+                                                    hipblasOperation_t   transb,
+                                                    int                  m,
+                                                    int                  n,
+                                                    int                  k,
+                                                    const void*          alpha,
+                                                    const void*          A,
+                                                    const void* const*   A_array,
+                                                    hipDataType          a_type,
+                                                    int                  lda,
+                                                    hipblasStride        stride_A,
+                                                    const void*          B,
+                                                    const void* const*   B_array,
+                                                    hipDataType          b_type,
+                                                    int                  ldb,
+                                                    hipblasStride        stride_B,
+                                                    const void*          beta,
+                                                    void*                C,
+                                                    void* const*         C_array,
+                                                    hipDataType          c_type,
+                                                    int                  ldc,
+                                                    hipblasStride        stride_C,
+                                                    int                  batch_count,
+                                                    hipblasComputeType_t compute_type,
+                                                    hipblasGemmAlgo_t    algo,
+                                                    hipblasStride        stride_scalars,
+                                                    hipDataType          scalar_type)
+{
+    bool same_type = scalar_type == c_type
+                     && (c_type == HIP_R_32F || c_type == HIP_R_64F || c_type == HIP_C_32F
+                         || c_type == HIP_C_64F);
+    bool half_type = scalar_type == HIP_R_32F && (c_type == HIP_R_16F || c_type == HIP_R_16BF);
+    if(!same_type && !half_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // hipMalloc and hipFree are not allowed while the stream is captured
+    hipStream_t            stream;
+    hipblasPointerMode_t   pointer_mode;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipblasGetPointerMode(handle, &pointer_mode) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // The pointer array of the batched form, padded to 256 bytes, then the W_i
+    size_t w_stride    = hipblasDatatypeSize(scalar_type) * m * n;
+    size_t array_bytes = C_array ? (sizeof(void*) * batch_count + 255) / 256 * 256 : 0;
+
+    hipblasDeviceScratch scratch;
+    if(hipMalloc((void**)&scratch.base, array_bytes + w_stride * batch_count) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    void** W_array = (void**)scratch.base;
+    void*  W       = scratch.base + array_bytes;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    if(C_array)
+        status = hipblasBatchScalarsPointers(stream, W_array, W, w_stride, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        const float  one_f[2] = {1, 0}, zero_f[2] = {0, 0};
+        const double one_d[2] = {1, 0}, zero_d[2] = {0, 0};
+        bool         single   = scalar_type == HIP_R_32F || scalar_type == HIP_C_32F;
+        const void*  one      = single ? (const void*)one_f : (const void*)one_d;
+        const void*  zero     = single ? (const void*)zero_f : (const void*)zero_d;
+
+        if(C_array)
+            status = hipblasGemmBatchedEx_v2(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             one,
+                                             (const void**)A_array,
+                                             a_type,
+                                             lda,
+                                             (const void**)B_array,
+                                             b_type,
+                                             ldb,
+                                             zero,
+                                             W_array,
+                                             scalar_type,
+                                             m,
+                                             batch_count,
+                                             compute_type,
+                                             algo);
+        else
+            status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                    transa,
+                                                    transb,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    one,
+                                                    A,
+                                                    a_type,
+                                                    lda,
+                                                    stride_A,
+                                                    B,
+                                                    b_type,
+                                                    ldb,
+                                                    stride_B,
+                                                    zero,
+                                                    W,
+                                                    scalar_type,
+                                                    m,
+                                                    hipblasStride(m) * n,
+                                                    batch_count,
+                                                    compute_type,
+                                                    algo);
+
+        hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = restore;
+    }
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasBatchScalarsAxpby(stream,
+                                          m,
+                                          n,
+                                          alpha,
+                                          beta,
+                                          scalar_type,
+                                          stride_scalars,
+                                          W,
+                                          C,
+                                          C_array,
+                                          c_type,
+                                          ldc,
+                                          stride_C,
+                                          batch_count);
+
+    return status;
+}
+#endif
+
+hipblasStatus_t hipblasGemmBatchScalars(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A,
+                                        const void* const*   A_array,
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        hipblasStride        stride_A,
+                                        const void*          B,
+                                        const void* const*   B_array,
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        hipblasStride        stride_B,
+                                        const void*          beta,
+                                        void*                C,
+                                        void* const*         C_array,
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        hipblasStride        stride_C,
+                                        int                  batch_count,
+                                        hipblasComputeType_t compute_type,
+                                        hipblasGemmAlgo_t    algo,
+                                        hipblasStride        stride_scalars)
+{
+    hipDataType scalar_type;
+    if(!hipblasBatchScalarType(compute_type, c_type, scalar_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m <= 0 || n <= 0)
+        return m < 0 || n < 0 ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS;
+
+#ifdef HIPBLAS_BATCH_SCALARS
+    hipblasStatus_t status = hipblasGemmBatchScalarsFused(handle,
+                                                          transa,
+                                                          transb,
+                                                          m,
+                                                          n,
+                                                          k,
+                                                          alpha,
+                                                          A,
+                                                          A_array,
+                                                          a_type,
+                                                          lda,
+                                                          stride_A,
+                                                          B,
+                                                          B_array,
+                                                          b_type,
+                                                          ldb,
+                                                          stride_B,
+                                                          beta,
+                                                          C,
+                                                          C_array,
+                                                          c_type,
+                                                          ldc,
+                                                          stride_C,
+                                                          batch_count,
+                                                          compute_type,
+                                                          algo,
+                                                          stride_scalars,
+                                                          scalar_type);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+#endif
+
+    // One backend call per instance, with its scalars still in device memory
+    size_t a_size = hipblasDatatypeSize(a_type);
+    size_t b_size = hipblasDatatypeSize(b_type);
+    size_t c_size = hipblasDatatypeSize(c_type);
+    size_t s_size = hipblasDatatypeSize(scalar_type);
+    if(!a_size || !b_size || !c_size || !s_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasStatus_t loop_status = HIPBLAS_STATUS_SUCCESS;
+    for(int i = 0; i < batch_count && loop_status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        const void* alpha_i = (const char*)alpha + i * stride_scalars * s_size;
+        const void* beta_i  = (const char*)beta + i * stride_scalars * s_size;
+        if(C_array)
+            loop_status = hipblasGemmBatchedEx_v2(handle,
+                                                  transa,
+                                                  transb,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha_i,
+                                                  (const void**)A_array + i,
+                                                  a_type,
+                                                  lda,
+                                                  (const void**)B_array + i,
+                                                  b_type,
+                                                  ldb,
+                                                  beta_i,
+                                                  (void**)C_array + i,
+                                                  c_type,
+                                                  ldc,
+                                                  1,
+                                                  compute_type,
+                                                  algo);
+        else
+            loop_status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                         transa,
+                                                         transb,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha_i,
+                                                         (const char*)A + i * stride_A * a_size,
+                                                         a_type,
+                                                         lda,
+                                                         stride_A,
+                                                         (const char*)B + i * stride_B * b_size,
+                                                         b_type,
+                                                         ldb,
+                                                         stride_B,
+                                                         beta_i,
+                                                         (char*)C + i * stride_C * c_size,
+                                                         c_type,
+                                                         ldc,
+                                                         stride_C,
+                                                         1,
+                                                         compute_type,
+                                                         algo);
+    }
+    return loop_status;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasTrsmBatched(hipblasHandle_t    handle,
+                                          hipblasSideMode_t  side,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          hipblasDiagType_t  diag,
+                                          int                m,
+                                          int                n,
+                                          const T*           alpha,
+                                          const T* const     A[],
+                                          int                lda,
+                                          T* const           B[],
+                                          int                ldb,
+                                          int                batch_count)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasStrsmBatched(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDtrsmBatched(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCtrsmBatched(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    else
+        return hipblasZtrsmBatched(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblasTrsmBatchScalars(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const T*           alpha,
+                                        const T* const     A[],
+                                        int                lda,
+                                        T* const           B[],
+                                        int                ldb,
+                                        int                batch_count,
+                                        hipblasStride      stride_scalars)
+{
+    if(m <= 0 || n <= 0)
+        return m < 0 || n < 0 ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS;
+
+#ifdef HIPBLAS_BATCH_SCALARS
+    // B_i := alpha_i * B_i, then op( A_i )^-1 with alpha = 1
+    constexpr hipDataType type = std::is_same_v<T, float>            ? HIP_R_32F
+                                 : std::is_same_v<T, double>         ? HIP_R_64F
+                                 : std::is_same_v<T, hipblasComplex> ? HIP_C_32F
+                                                                     : HIP_C_64F;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t pointer_mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasBatchScalarsScale(
+            stream, m, n, alpha, type, stride_scalars, (void* const*)B, ldb, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    const T one = T(1);
+    status      = hipblasTrsmBatched<T>(
+        handle, side, uplo, transA, diag, m, n, &one, A, lda, B, ldb, batch_count);
+
+    hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+    return status == HIPBLAS_STATUS_SUCCESS ? restore : status;
+#else
+    // One backend call per instance, with its alpha still in device memory
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+        status = hipblasTrsmBatched<T>(handle,
+                                       side,
+                                       uplo,
+                                       transA,
+                                       diag,
+                                       m,
+                                       n,
+                                       alpha + i * stride_scalars,
+                                       A + i,
+                                       lda,
+                                       B + i,
+                                       ldb,
+                                       1);
+    return status;
+#endif
+}
+
+#define HIPBLAS_TRSM_BATCH_SCALARS(T)                                    \
+    template hipblasStatus_t hipblasTrsmBatchScalars(hipblasHandle_t,    \
+                                                     hipblasSideMode_t,  \
+                                                     hipblasFillMode_t,  \
+                                                     hipblasOperation_t, \
+                                                     hipblasDiagType_t,  \
+                                                     int,                \
+                                                     int,                \
+                                                     const T*,           \
+                                                     const T* const[],   \
+                                                     int,                \
+                                                     T* const[],         \
+                                                     int,                \
+                                                     int,                \
+                                                     hipblasStride);
+
+HIPBLAS_TRSM_BATCH_SCALARS(float)
+HIPBLAS_TRSM_BATCH_SCALARS(double)
+HIPBLAS_TRSM_BATCH_SCALARS(hipblasComplex)
+HIPBLAS_TRSM_BATCH_SCALARS(hipblasDoubleComplex)
+
+#undef HIPBLAS_TRSM_BATCH_SCALARS
+
+// Typed calls of scal, axpy and gemv for the per-instance paths
+template <typename T>
+static hipblasStatus_t hipblasScal(hipblasHandle_t handle, int n, const T* alpha, T* x, int incx)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSscal(handle, n, alpha, x, incx);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDscal(handle, n, alpha, x, incx);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCscal(handle, n, alpha, x, incx);
+    else
+        return hipblasZscal(handle, n, alpha, x, incx);
+}
+
+template <typename T>
+static hipblasStatus_t hipblasScalBatched(
+    hipblasHandle_t handle, int n, const T* alpha, T* const x[], int incx, int batch_count)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSscalBatched(handle, n, alpha, x, incx, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDscalBatched(handle, n, alpha, x, incx, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCscalBatched(handle, n, alpha, x, incx, batch_count);
+    else
+        return hipblasZscalBatched(handle, n, alpha, x, incx, batch_count);
+}
+
+template <typename T>
+static hipblasStatus_t hipblasAxpy(
+    hipblasHandle_t handle, int n, const T* alpha, const T* x, int incx, T* y, int incy)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSaxpy(handle, n, alpha, x, incx, y, incy);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDaxpy(handle, n, alpha, x, incx, y, incy);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCaxpy(handle, n, alpha, x, incx, y, incy);
+    else
+        return hipblasZaxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+template <typename T>
+static hipblasStatus_t hipblasAxpyBatched(hipblasHandle_t handle,
+                                          int             n,
+                                          const T*        alpha,
+                                          const T* const  x[],
+                                          int             incx,
+                                          T* const        y[],
+                                          int             incy,
+                                          int             batch_count)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSaxpyBatched(handle, n, alpha, x, incx, y, incy, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDaxpyBatched(handle, n, alpha, x, incx, y, incy, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCaxpyBatched(handle, n, alpha, x, incx, y, incy, batch_count);
+    else
+        return hipblasZaxpyBatched(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+
+template <typename T>
+static hipblasStatus_t hipblasGemv(hipblasHandle_t    handle,
+                                   hipblasOperation_t trans,
+                                   int                m,
+                                   int                n,
+                                   const T*           alpha,
+                                   const T*           A,
+                                   int                lda,
+                                   const T*           x,
+                                   int                incx,
+                                   const T*           beta,
+                                   T*                 y,
+                                   int                incy)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    else
+        return hipblasZgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <typename T>
+static hipblasStatus_t hipblasGemvBatched(hipblasHandle_t    handle,
+                                          hipblasOperation_t trans,
+                                          int                m,
+                                          int                n,
+                                          const T*           alpha,
+                                          const T* const     A[],
+                                          int                lda,
+                                          const T* const     x[],
+                                          int                incx,
+                                          const T*           beta,
+                                          T* const           y[],
+                                          int                incy,
+                                          int                batch_count)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgemvBatched(
+            handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgemvBatched(
+            handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgemvBatched(
+            handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    else
+        return hipblasZgemvBatched(
+            handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+template <typename T>
+static hipblasStatus_t hipblasGemvStridedBatched(hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans,
+                                                 int                m,
+                                                 int                n,
+                                                 const T*           alpha,
+                                                 const T*           A,
+                                                 int                lda,
+                                                 hipblasStride      stride_A,
+                                                 const T*           x,
+                                                 int                incx,
+                                                 hipblasStride      stride_x,
+                                                 const T*           beta,
+                                                 T*                 y,
+                                                 int                incy,
+                                                 hipblasStride      stride_y,
+                                                 int                batch_count)
+{
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          stride_A,
+                                          x,
+                                          incx,
+                                          stride_x,
+                                          beta,
+                                          y,
+                                          incy,
+                                          stride_y,
+                                          batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          stride_A,
+                                          x,
+                                          incx,
+                                          stride_x,
+                                          beta,
+                                          y,
+                                          incy,
+                                          stride_y,
+                                          batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          stride_A,
+                                          x,
+                                          incx,
+                                          stride_x,
+                                          beta,
+                                          y,
+                                          incy,
+                                          stride_y,
+                                          batch_count);
+    else
+        return hipblasZgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          stride_A,
+                                          x,
+                                          incx,
+                                          stride_x,
+                                          beta,
+                                          y,
+                                          incy,
+                                          stride_y,
+                                          batch_count);
+}
+
+template <typename T>
+static constexpr hipDataType hipblasBatchScalarsDatatype()
+{
+    return std::is_same_v<T, float>            ? HIP_R_32F
+           : std::is_same_v<T, double>         ? HIP_R_64F
+           : std::is_same_v<T, hipblasComplex> ? HIP_C_32F
+                                               : HIP_C_64F;
+}
+
+template <typename T>
+hipblasStatus_t hipblasScalBatchScalars(hipblasHandle_t handle,
+                                        int             n,
+                                        const T*        alpha,
+                                        T*              x,
+                                        T* const*       x_array,
+                                        int             incx,
+                                        hipblasStride   stride_x,
+                                        int             batch_count,
+                                        hipblasStride   stride_scalars)
+{
+    // As the backends, scal does nothing for a negative increment
+    if(n <= 0 || incx <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+#ifdef HIPBLAS_BATCH_SCALARS
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasBatchScalarsScaleVector(stream,
+                                                n,
+                                                alpha,
+                                                hipblasBatchScalarsDatatype<T>(),
+                                                stride_scalars,
+                                                x,
+                                                (void* const*)x_array,
+                                                incx,
+                                                stride_x,
+                                                batch_count);
+    return status;
+#else
+    // One backend call per instance, with its alpha still in device memory
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        const T* alpha_i = alpha + i * stride_scalars;
+        if(x_array)
+            status = hipblasScalBatched<T>(handle, n, alpha_i, x_array + i, incx, 1);
+        else
+            status = hipblasScal<T>(handle, n, alpha_i, x + i * stride_x, incx);
+    }
+    return status;
+#endif
+}
+
+template <typename T>
+hipblasStatus_t hipblasAxpyBatchScalars(hipblasHandle_t handle,
+                                        int             n,
+                                        const T*        alpha,
+                                        const T*        x,
+                                        const T* const* x_array,
+                                        int             incx,
+                                        hipblasStride   stride_x,
+                                        T*              y,
+                                        T* const*       y_array,
+                                        int             incy,
+                                        hipblasStride   stride_y,
+                                        int             batch_count,
+                                        hipblasStride   stride_scalars)
+{
+    if(n <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+#ifdef HIPBLAS_BATCH_SCALARS
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasBatchScalarsAxpbyVector(stream,
+                                                n,
+                                                alpha,
+                                                nullptr,
+                                                hipblasBatchScalarsDatatype<T>(),
+                                                stride_scalars,
+                                                x,
+                                                (const void* const*)x_array,
+                                                incx,
+                                                stride_x,
+                                                y,
+                                                (void* const*)y_array,
+                                                incy,
+                                                stride_y,
+                                                batch_count);
+    return status;
+#else
+    // One backend call per instance, with its alpha still in device memory
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        const T* alpha_i = alpha + i * stride_scalars;
+        if(x_array)
+            status = hipblasAxpyBatched<T>(
+                handle, n, alpha_i, x_array + i, incx, y_array + i, incy, 1);
+        else
+            status = hipblasAxpy<T>(
+                handle, n, alpha_i, x + i * stride_x, incx, y + i * stride_y, incy);
+    }
+    return status;
+#endif
+}
+
+#ifdef HIPBLAS_BATCH_SCALARS
+// W_i := op( A_i ) * x_i into a scratch buffer with host scalars, then one kernel applies alpha_i
+// and beta_i. Returns HIPBLAS_STATUS_NOT_SUPPORTED, without writing y, when the backend has no
+// batched gemv of this form.
+template <typename T>
+static hipblasStatus_t hipblasGemvBatchScalarsFused(hipblasHandle_t    handle,
+                                                    hipblasOperation_t trans,
+                                                    int                m,
+                                                    int                n,
+                                                    const T*           alpha,
+                                                    const T*           A,
+                                                    const T* const*    A_array,
+                                                    int                lda,
+                                                    hipblasStride      stride_A,
+                                                    const T*           x,
+                                                    const T* const*    x_array,
+                                                    int                incx,
+                                                    hipblasStride      stride_x,
+                                                    const T*           beta,
+                                                    T*                 y,
+                                                    T* const*          y_array,
+                                                    int                incy,
+                                                    hipblasStride      stride_y,
+                                                    int                batch_count,
+                                                    hipblasStride      stride_scalars)
+{
+    // hipMalloc and hipFree are not allowed while the stream is captured
+    hipStream_t            stream;
+    hipblasPointerMode_t   pointer_mode;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipblasGetPointerMode(handle, &pointer_mode) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // The pointer array of the batched form, padded to 256 bytes, then the W_i
+    int    y_length    = trans == HIPBLAS_OP_N ? m : n;
+    size_t array_bytes = y_array ? (sizeof(void*) * batch_count + 255) / 256 * 256 : 0;
+
+    hipblasDeviceScratch scratch;
+    if(hipMalloc((void**)&scratch.base, array_bytes + sizeof(T) * y_length * batch_count)
+       != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    T** W_array = (T**)scratch.base;
+    T*  W       = (T*)(scratch.base + array_bytes);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    if(y_array)
+        status = hipblasBatchScalarsPointers(
+            stream, (void**)W_array, W, sizeof(T) * y_length, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        const T one = T(1), zero = T(0);
+        if(y_array)
+            status = hipblasGemvBatched<T>(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           &one,
+                                           A_array,
+                                           lda,
+                                           x_array,
+                                           incx,
+                                           &zero,
+                                           W_array,
+                                           1,
+                                           batch_count);
+        else
+            status = hipblasGemvStridedBatched<T>(handle,
+                                                  trans,
+                                                  m,
+                                                  n,
+                                                  &one,
+                                                  A,
+                                                  lda,
+                                                  stride_A,
+                                                  x,
+                                                  incx,
+                                                  stride_x,
+                                                  &zero,
+                                                  W,
+                                                  1,
+                                                  y_length,
+                                                  batch_count);
+
+        hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = restore;
+    }
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasBatchScalarsAxpbyVector(stream,
+                                                y_length,
+                                                alpha,
+                                                beta,
+                                                hipblasBatchScalarsDatatype<T>(),
+                                                stride_scalars,
+                                                W,
+                                                nullptr,
+                                                1,
+                                                y_length,
+                                                y,
+                                                (void* const*)y_array,
+                                                incy,
+                                                stride_y,
+                                                batch_count);
+    return status;
+}
+#endif
+
+template <typename T>
+hipblasStatus_t hipblasGemvBatchScalars(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const T*           alpha,
+                                        const T*           A,
+                                        const T* const*    A_array,
+                                        int                lda,
+                                        hipblasStride      stride_A,
+                                        const T*           x,
+                                        const T* const*    x_array,
+                                        int                incx,
+                                        hipblasStride      stride_x,
+                                        const T*           beta,
+                                        T*                 y,
+                                        T* const*          y_array,
+                                        int                incy,
+                                        hipblasStride      stride_y,
+                                        int                batch_count,
+                                        hipblasStride      stride_scalars)
+{
+    if(m <= 0 || n <= 0)
+        return m < 0 || n < 0 ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS;
+    if(incy == 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_BATCH_SCALARS
+    hipblasStatus_t status = hipblasGemvBatchScalarsFused<T>(handle,
+                                                             trans,
+                                                             m,
+                                                             n,
+                                                             alpha,
+                                                             A,
+                                                             A_array,
+                                                             lda,
+                                                             stride_A,
+                                                             x,
+                                                             x_array,
+                                                             incx,
+                                                             stride_x,
+                                                             beta,
+                                                             y,
+                                                             y_array,
+                                                             incy,
+                                                             stride_y,
+                                                             batch_count,
+                                                             stride_scalars);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+#endif
+
+    // One backend call per instance, with its scalars still in device memory
+    hipblasStatus_t loop_status = HIPBLAS_STATUS_SUCCESS;
+    for(int i = 0; i < batch_count && loop_status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        const T* alpha_i = alpha + i * stride_scalars;
+        const T* beta_i  = beta + i * stride_scalars;
+        if(A_array)
+            loop_status = hipblasGemvBatched<T>(handle,
+                                                trans,
+                                                m,
+                                                n,
+                                                alpha_i,
+                                                A_array + i,
+                                                lda,
+                                                x_array + i,
+                                                incx,
+                                                beta_i,
+                                                y_array + i,
+                                                incy,
+                                                1);
+        else
+            loop_status = hipblasGemv<T>(handle,
+                                         trans,
+                                         m,
+                                         n,
+                                         alpha_i,
+                                         A + i * stride_A,
+                                         lda,
+                                         x + i * stride_x,
+                                         incx,
+                                         beta_i,
+                                         y + i * stride_y,
+                                         incy);
+    }
+    return loop_status;
+}
+
+#define HIPBLAS_LEVEL2_BATCH_SCALARS(T)                                                         \
+    template hipblasStatus_t hipblasScalBatchScalars(                                           \
+        hipblasHandle_t, int, const T*, T*, T* const*, int, hipblasStride, int, hipblasStride); \
+    template hipblasStatus_t hipblasAxpyBatchScalars(hipblasHandle_t,                           \
+                                                     int,                                       \
+                                                     const T*,                                  \
+                                                     const T*,                                  \
+                                                     const T* const*,                           \
+                                                     int,                                       \
+                                                     hipblasStride,                             \
+                                                     T*,                                        \
+                                                     T* const*,                                 \
+                                                     int,                                       \
+                                                     hipblasStride,                             \
+                                                     int,                                       \
+                                                     hipblasStride);                            \
+    template hipblasStatus_t hipblasGemvBatchScalars(hipblasHandle_t,                           \
+                                                     hipblasOperation_t,                        \
+                                                     int,                                       \
+                                                     int,                                       \
+                                                     const T*,                                  \
+                                                     const T*,                                  \
+                                                     const T* const*,                           \
+                                                     int,                                       \
+                                                     hipblasStride,                             \
+                                                     const T*,                                  \
+                                                     const T* const*,                           \
+                                                     int,                                       \
+                                                     hipblasStride,                             \
+                                                     const T*,                                  \
+                                                     T*,                                        \
+                                                     T* const*,                                 \
+                                                     int,                                       \
+                                                     hipblasStride,                             \
+                                                     int,                                       \
+                                                     hipblasStride);
+
+HIPBLAS_LEVEL2_BATCH_SCALARS(float)
+HIPBLAS_LEVEL2_BATCH_SCALARS(double)
+HIPBLAS_LEVEL2_BATCH_SCALARS(hipblasComplex)
+HIPBLAS_LEVEL2_BATCH_SCALARS(hipblasDoubleComplex)
+
+#undef HIPBLAS_LEVEL2_BATCH_SCALARS
@@ -0,0 +1,472 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "batch_scalars.hpp"
+#include "convert_device.hpp"
+#include <algorithm>
+#include <type_traits>
+
+// Threads of a work group, along a column. The work groups loop over the remaining columns and
+// instances beyond the largest grid.
+constexpr int batch_scalars_threads  = 256;
+constexpr int batch_scalars_max_grid = 65535;
+
+template <typename T>
+struct hipblasBatchScalarsComplex
+{
+    T x, y;
+};
+
+template <typename T>
+__device__ inline T hipblasBatchScalarsMul(T a, T b)
+{
+    return a * b;
+}
+
+template <typename T>
+__device__ inline hipblasBatchScalarsComplex<T>
+    hipblasBatchScalarsMul(hipblasBatchScalarsComplex<T> a, hipblasBatchScalarsComplex<T> b)
+{
+    return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x};
+}
+
+template <typename T>
+__device__ inline T hipblasBatchScalarsAdd(T a, T b)
+{
+    return a + b;
+}
+
+template <typename T>
+__device__ inline hipblasBatchScalarsComplex<T>
+    hipblasBatchScalarsAdd(hipblasBatchScalarsComplex<T> a, hipblasBatchScalarsComplex<T> b)
+{
+    return {a.x + b.x, a.y + b.y};
+}
+
+template <typename T>
+__device__ inline bool hipblasBatchScalarsIsZero(T a)
+{
+    return a == T(0);
+}
+
+template <typename T>
+__device__ inline bool hipblasBatchScalarsIsZero(hipblasBatchScalarsComplex<T> a)
+{
+    return a.x == T(0) && a.y == T(0);
+}
+
+__global__ void __launch_bounds__(batch_scalars_threads)
+    hipblasBatchScalarsPointersKernel(void** array, char* base, size_t stride, int batch_count)
+{
+    int i = blockIdx.x * batch_scalars_threads + threadIdx.x;
+    if(i < batch_count)
+        array[i] = base + i * stride;
+}
+
+// Work group (x, y, z) updates rows x * batch_scalars_threads onwards of column y of C_z
+template <typename Ts, typename Tc>
+__global__ void __launch_bounds__(batch_scalars_threads)
+    hipblasBatchScalarsAxpbyKernel(int           m,
+                                   int           n,
+                                   const Ts*     alpha,
+                                   const Ts*     beta,
+                                   hipblasStride stride_scalars,
+                                   const Ts*     W,
+                                   Tc*           C,
+                                   Tc* const*    C_array,
+                                   int           ldc,
+                                   hipblasStride stride_C,
+                                   int           batch_count)
+{
+    int i = blockIdx.x * batch_scalars_threads + threadIdx.x;
+    if(i >= m)
+        return;
+
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        Ts        a  = alpha[b * stride_scalars];
+        Ts        c  = beta[b * stride_scalars];
+        const Ts* w  = W + b * int64_t(m) * n;
+        Tc*       cb = C_array ? C_array[b] : C + b * stride_C;
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+        {
+            // op( A ) * op( B ) is not used when alpha is zero, nor C when beta is
+            Ts  r   = {};
+            Tc& cij = cb[i + int64_t(j) * ldc];
+            if(!hipblasBatchScalarsIsZero(a))
+                r = hipblasBatchScalarsMul(a, w[i + int64_t(j) * m]);
+            if(!hipblasBatchScalarsIsZero(c))
+                r = hipblasBatchScalarsAdd(
+                    r, hipblasBatchScalarsMul(c, hipblasDeviceCast<Ts>(cij)));
+            cij = hipblasDeviceCast<Tc>(r);
+        }
+    }
+}
+
+template <typename T>
+__global__ void __launch_bounds__(batch_scalars_threads)
+    hipblasBatchScalarsScaleKernel(int           m,
+                                   int           n,
+                                   const T*      alpha,
+                                   hipblasStride stride_scalars,
+                                   T* const*     B_array,
+                                   int           ldb,
+                                   int           batch_count)
+{
+    int i = blockIdx.x * batch_scalars_threads + threadIdx.x;
+    if(i >= m)
+        return;
+
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        T  a  = alpha[b * stride_scalars];
+        T* bb = B_array[b];
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+        {
+            T& bij = bb[i + int64_t(j) * ldb];
+            bij    = hipblasBatchScalarsIsZero(a) ? T{} : hipblasBatchScalarsMul(a, bij);
+        }
+    }
+}
+
+// Offset of entry i of a vector of n entries with increment inc, which starts at the last entry
+// for a negative increment
+__device__ inline int64_t hipblasBatchScalarsIndex(int i, int n, int inc)
+{
+    return inc < 0 ? int64_t(i - (n - 1)) * inc : int64_t(i) * inc;
+}
+
+// Work group (x, 0, z) updates entries x * batch_scalars_threads onwards of y_z
+template <typename T>
+__global__ void __launch_bounds__(batch_scalars_threads)
+    hipblasBatchScalarsAxpbyVectorKernel(int             n,
+                                         const T*        alpha,
+                                         const T*        beta,
+                                         hipblasStride   stride_scalars,
+                                         const T*        x,
+                                         const T* const* x_array,
+                                         int             incx,
+                                         hipblasStride   stride_x,
+                                         T*              y,
+                                         T* const*       y_array,
+                                         int             incy,
+                                         hipblasStride   stride_y,
+                                         int             batch_count)
+{
+    int i = blockIdx.x * batch_scalars_threads + threadIdx.x;
+    if(i >= n)
+        return;
+
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        T        a  = alpha[b * stride_scalars];
+        const T* xb = x_array ? x_array[b] : x + b * stride_x;
+        T*       yb = y_array ? y_array[b] : y + b * stride_y;
+        T&       yi = yb[hipblasBatchScalarsIndex(i, n, incy)];
+
+        // x is not used when alpha is zero, nor y when beta is
+        T r = {};
+        if(!hipblasBatchScalarsIsZero(a))
+            r = hipblasBatchScalarsMul(a, xb[hipblasBatchScalarsIndex(i, n, incx)]);
+        if(!beta)
+            r = hipblasBatchScalarsAdd(r, yi);
+        else if(!hipblasBatchScalarsIsZero(beta[b * stride_scalars]))
+            r = hipblasBatchScalarsAdd(r, hipblasBatchScalarsMul(beta[b * stride_scalars], yi));
+        yi = r;
+    }
+}
+
+template <typename T>
+__global__ void __launch_bounds__(batch_scalars_threads)
+    hipblasBatchScalarsScaleVectorKernel(int           n,
+                                         const T*      alpha,
+                                         hipblasStride stride_scalars,
+                                         T*            x,
+                                         T* const*     x_array,
+                                         int           incx,
+                                         hipblasStride stride_x,
+                                         int           batch_count)
+{
+    int i = blockIdx.x * batch_scalars_threads + threadIdx.x;
+    if(i >= n)
+        return;
+
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        T* xb = x_array ? x_array[b] : x + b * stride_x;
+        T& xi = xb[hipblasBatchScalarsIndex(i, n, incx)];
+        xi    = hipblasBatchScalarsMul(alpha[b * stride_scalars], xi);
+    }
+}
+
+static dim3 hipblasBatchScalarsGrid(int m, int n, int batch_count)
+{
+    return dim3((m + batch_scalars_threads - 1) / batch_scalars_threads,
+                std::min(n, batch_scalars_max_grid),
+                std::min(batch_count, batch_scalars_max_grid));
+}
+
+hipblasStatus_t hipblasBatchScalarsPointers(
+    hipStream_t stream, void** array, void* base, size_t stride, int batch_count)
+{
+    hipLaunchKernelGGL(hipblasBatchScalarsPointersKernel,
+                       dim3((batch_count + batch_scalars_threads - 1) / batch_scalars_threads),
+                       dim3(batch_scalars_threads),
+                       0,
+                       stream,
+                       array,
+                       (char*)base,
+                       stride,
+                       batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+template <typename Ts, typename Tc>
+static hipblasStatus_t hipblasBatchScalarsAxpbyLaunch(hipStream_t   stream,
+                                                      int           m,
+                                                      int           n,
+                                                      const void*   alpha,
+                                                      const void*   beta,
+                                                      hipblasStride stride_scalars,
+                                                      const void*   W,
+                                                      void*         C,
+                                                      void* const*  C_array,
+                                                      int           ldc,
+                                                      hipblasStride stride_C,
+                                                      int           batch_count)
+{
+    hipLaunchKernelGGL((hipblasBatchScalarsAxpbyKernel<Ts, Tc>),
+                       hipblasBatchScalarsGrid(m, n, batch_count),
+                       dim3(batch_scalars_threads),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       (const Ts*)alpha,
+                       (const Ts*)beta,
+                       stride_scalars,
+                       (const Ts*)W,
+                       (Tc*)C,
+                       (Tc* const*)C_array,
+                       ldc,
+                       stride_C,
+                       batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasBatchScalarsAxpby(hipStream_t   stream,
+                                         int           m,
+                                         int           n,
+                                         const void*   alpha,
+                                         const void*   beta,
+                                         hipDataType   scalar_type,
+                                         hipblasStride stride_scalars,
+                                         const void*   W,
+                                         void*         C,
+                                         void* const*  C_array,
+                                         hipDataType   c_type,
+                                         int           ldc,
+                                         hipblasStride stride_C,
+                                         int           batch_count)
+{
+    auto launch = [&](auto s, auto c) {
+        return hipblasBatchScalarsAxpbyLaunch<decltype(s), decltype(c)>(stream,
+                                                                        m,
+                                                                        n,
+                                                                        alpha,
+                                                                        beta,
+                                                                        stride_scalars,
+                                                                        W,
+                                                                        C,
+                                                                        C_array,
+                                                                        ldc,
+                                                                        stride_C,
+                                                                        batch_count);
+    };
+
+    if(scalar_type == HIP_R_32F && c_type == HIP_R_16F)
+        return launch(float(), __half());
+    if(scalar_type == HIP_R_32F && c_type == HIP_R_16BF)
+        return launch(float(), hipblasDeviceBfloat16());
+    if(scalar_type != c_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    switch(c_type)
+    {
+    case HIP_R_32F:
+        return launch(float(), float());
+    case HIP_R_64F:
+        return launch(double(), double());
+    case HIP_C_32F:
+        return launch(hipblasBatchScalarsComplex<float>(), hipblasBatchScalarsComplex<float>());
+    case HIP_C_64F:
+        return launch(hipblasBatchScalarsComplex<double>(), hipblasBatchScalarsComplex<double>());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+hipblasStatus_t hipblasBatchScalarsScale(hipStream_t   stream,
+                                         int           m,
+                                         int           n,
+                                         const void*   alpha,
+                                         hipDataType   type,
+                                         hipblasStride stride_scalars,
+                                         void* const*  B_array,
+                                         int           ldb,
+                                         int           batch_count)
+{
+    auto launch = [&](auto t) {
+        using T = decltype(t);
+        hipLaunchKernelGGL(hipblasBatchScalarsScaleKernel<T>,
+                           hipblasBatchScalarsGrid(m, n, batch_count),
+                           dim3(batch_scalars_threads),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           (const T*)alpha,
+                           stride_scalars,
+                           (T* const*)B_array,
+                           ldb,
+                           batch_count);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    };
+
+    switch(type)
+    {
+    case HIP_R_32F:
+        return launch(float());
+    case HIP_R_64F:
+        return launch(double());
+    case HIP_C_32F:
+        return launch(hipblasBatchScalarsComplex<float>());
+    case HIP_C_64F:
+        return launch(hipblasBatchScalarsComplex<double>());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+hipblasStatus_t hipblasBatchScalarsAxpbyVector(hipStream_t        stream,
+                                               int                n,
+                                               const void*        alpha,
+                                               const void*        beta,
+                                               hipDataType        type,
+                                               hipblasStride      stride_scalars,
+                                               const void*        x,
+                                               const void* const* x_array,
+                                               int                incx,
+                                               hipblasStride      stride_x,
+                                               void*              y,
+                                               void* const*       y_array,
+                                               int                incy,
+                                               hipblasStride      stride_y,
+                                               int                batch_count)
+{
+    auto launch = [&](auto t) {
+        using T = decltype(t);
+        hipLaunchKernelGGL(hipblasBatchScalarsAxpbyVectorKernel<T>,
+                           hipblasBatchScalarsGrid(n, 1, batch_count),
+                           dim3(batch_scalars_threads),
+                           0,
+                           stream,
+                           n,
+                           (const T*)alpha,
+                           (const T*)beta,
+                           stride_scalars,
+                           (const T*)x,
+                           (const T* const*)x_array,
+                           incx,
+                           stride_x,
+                           (T*)y,
+                           (T* const*)y_array,
+                           incy,
+                           stride_y,
+                           batch_count);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    };
+
+    switch(type)
+    {
+    case HIP_R_32F:
+        return launch(float());
+    case HIP_R_64F:
+        return launch(double());
+    case HIP_C_32F:
+        return launch(hipblasBatchScalarsComplex<float>());
+    case HIP_C_64F:
+        return launch(hipblasBatchScalarsComplex<double>());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+hipblasStatus_t hipblasBatchScalarsScaleVector(hipStream_t   stream,
+                                               int           n,
+                                               const void*   alpha,
+                                               hipDataType   type,
+                                               hipblasStride stride_scalars,
+                                               void*         x,
+                                               void* const*  x_array,
+                                               int           incx,
+                                               hipblasStride stride_x,
+                                               int           batch_count)
+{
+    auto launch = [&](auto t) {
+        using T = decltype(t);
+        hipLaunchKernelGGL(hipblasBatchScalarsScaleVectorKernel<T>,
+                           hipblasBatchScalarsGrid(n, 1, batch_count),
+                           dim3(batch_scalars_threads),
+                           0,
+                           stream,
+                           n,
+                           (const T*)alpha,
+                           stride_scalars,
+                           (T*)x,
+                           (T* const*)x_array,
+                           incx,
+                           stride_x,
+                           batch_count);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    };
+
+    switch(type)
+    {
+    case HIP_R_32F:
+        return launch(float());
+    case HIP_R_64F:
+        return launch(double());
+    case HIP_C_32F:
+        return launch(hipblasBatchScalarsComplex<float>());
+    case HIP_C_64F:
+        return launch(hipblasBatchScalarsComplex<double>());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
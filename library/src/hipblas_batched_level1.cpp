@@ -0,0 +1,568 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "batched_level1.hpp"
+#include <algorithm>
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+#include <mutex>
+#include <unordered_map>
+
+constexpr int batched_level1_block_size = 256;
+constexpr int batched_level1_max_blocks = 1 << 16;
+
+// Limit of the y dimension of a grid
+constexpr int batched_level1_max_batch_blocks = 65535;
+
+// Device type of a hipBLAS element type
+template <typename T>
+struct hipblasBatchedDevice
+{
+    using type = T;
+};
+
+template <>
+struct hipblasBatchedDevice<hipblasComplex>
+{
+    using type = hipFloatComplex;
+};
+
+template <>
+struct hipblasBatchedDevice<hipblasDoubleComplex>
+{
+    using type = hipDoubleComplex;
+};
+
+template <typename T>
+using hipblas_batched_device_t = typename hipblasBatchedDevice<T>::type;
+
+// Real type of a device element type
+template <typename T>
+struct hipblasBatchedReal
+{
+    using type = T;
+};
+
+template <>
+struct hipblasBatchedReal<hipFloatComplex>
+{
+    using type = float;
+};
+
+template <>
+struct hipblasBatchedReal<hipDoubleComplex>
+{
+    using type = double;
+};
+
+template <typename T>
+using hipblas_batched_real_t = typename hipblasBatchedReal<T>::type;
+
+// |Re(x)| + |Im(x)|, the magnitude iamax and iamin compare
+__device__ inline float hipblasBatchedAbs1(float x)
+{
+    return fabsf(x);
+}
+
+__device__ inline double hipblasBatchedAbs1(double x)
+{
+    return fabs(x);
+}
+
+__device__ inline float hipblasBatchedAbs1(hipFloatComplex x)
+{
+    return fabsf(x.x) + fabsf(x.y);
+}
+
+__device__ inline double hipblasBatchedAbs1(hipDoubleComplex x)
+{
+    return fabs(x.x) + fabs(x.y);
+}
+
+// |x|^2
+template <typename T>
+__device__ inline T hipblasBatchedAbs2(T x)
+{
+    return x * x;
+}
+
+__device__ inline float hipblasBatchedAbs2(hipFloatComplex x)
+{
+    return x.x * x.x + x.y * x.y;
+}
+
+__device__ inline double hipblasBatchedAbs2(hipDoubleComplex x)
+{
+    return x.x * x.x + x.y * x.y;
+}
+
+// alpha * x
+template <typename T>
+__device__ inline T hipblasBatchedScale(T alpha, T x)
+{
+    return alpha * x;
+}
+
+__device__ inline hipFloatComplex hipblasBatchedScale(hipFloatComplex alpha, hipFloatComplex x)
+{
+    return hipCmulf(alpha, x);
+}
+
+__device__ inline hipDoubleComplex hipblasBatchedScale(hipDoubleComplex alpha, hipDoubleComplex x)
+{
+    return hipCmul(alpha, x);
+}
+
+__device__ inline hipFloatComplex hipblasBatchedScale(float alpha, hipFloatComplex x)
+{
+    return make_hipFloatComplex(alpha * x.x, alpha * x.y);
+}
+
+__device__ inline hipDoubleComplex hipblasBatchedScale(double alpha, hipDoubleComplex x)
+{
+    return make_hipDoubleComplex(alpha * x.x, alpha * x.y);
+}
+
+// Vector b of a batched or strided batched call
+template <typename T>
+__device__ inline T* hipblasBatchedVector(T* const* x, int b, hipblasStride)
+{
+    return x[b];
+}
+
+template <typename T>
+__device__ inline T* hipblasBatchedVector(T* x, int b, hipblasStride stridex)
+{
+    return x + b * stridex;
+}
+
+// One work group per vector, striding over the batch. Each thread keeps the first best element
+// of its part of the vector, and ties in the reduction go to the lower index, so the result is
+// the first best element as in BLAS. The loop bound is uniform so every thread reaches the
+// barriers.
+template <bool AMIN, typename T, typename Tx>
+__global__ void __launch_bounds__(batched_level1_block_size)
+    hipblasBatchedIamaxKernel(
+        int n, Tx x, int incx, hipblasStride stridex, int batch_count, int* result)
+{
+    using Tr = hipblas_batched_real_t<T>;
+
+    __shared__ Tr  s_value[batched_level1_block_size];
+    __shared__ int s_index[batched_level1_block_size];
+
+    int tid = threadIdx.x;
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        const T* xb    = hipblasBatchedVector(x, b, stridex);
+        Tr       value = 0;
+        int      index = 0;
+        for(int i = tid; i < n; i += batched_level1_block_size)
+        {
+            Tr v = hipblasBatchedAbs1(xb[int64_t(i) * incx]);
+            if(!index || (AMIN ? v < value : v > value))
+            {
+                value = v;
+                index = i + 1;
+            }
+        }
+        s_value[tid] = value;
+        s_index[tid] = index;
+        __syncthreads();
+
+        for(int s = batched_level1_block_size / 2; s > 0; s /= 2)
+        {
+            if(tid < s && s_index[tid + s])
+            {
+                Tr   a = s_value[tid], c = s_value[tid + s];
+                bool better = AMIN ? c < a : c > a;
+                if(!s_index[tid] || better || (c == a && s_index[tid + s] < s_index[tid]))
+                {
+                    s_value[tid] = c;
+                    s_index[tid] = s_index[tid + s];
+                }
+            }
+            __syncthreads();
+        }
+
+        if(tid == 0)
+            result[b] = s_index[0];
+        __syncthreads();
+    }
+}
+
+// One work group per vector, striding over the batch, summing |x|^2 without scaling as rocBLAS
+template <typename T, typename Tx, typename Tr>
+__global__ void __launch_bounds__(batched_level1_block_size)
+    hipblasBatchedNrm2Kernel(
+        int n, Tx x, int incx, hipblasStride stridex, int batch_count, Tr* result)
+{
+    __shared__ Tr s_sum[batched_level1_block_size];
+
+    int tid = threadIdx.x;
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        const T* xb  = hipblasBatchedVector(x, b, stridex);
+        Tr       sum = 0;
+        for(int i = tid; i < n; i += batched_level1_block_size)
+            sum += hipblasBatchedAbs2(xb[int64_t(i) * incx]);
+        s_sum[tid] = sum;
+        __syncthreads();
+
+        for(int s = batched_level1_block_size / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                s_sum[tid] += s_sum[tid + s];
+            __syncthreads();
+        }
+
+        if(tid == 0)
+            result[b] = sqrt(s_sum[0]);
+        __syncthreads();
+    }
+}
+
+// blockIdx.x strides over the elements and blockIdx.y over the batch
+template <typename T, typename Tx, typename Ta>
+__global__ void __launch_bounds__(batched_level1_block_size)
+    hipblasBatchedScalKernel(int           n,
+                             const Ta*     alpha_device,
+                             Ta            alpha_host,
+                             Tx            x,
+                             int           incx,
+                             hipblasStride stridex,
+                             int           batch_count)
+{
+    Ta alpha = alpha_device ? *alpha_device : alpha_host;
+    for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+    {
+        T* xb = hipblasBatchedVector(x, b, stridex);
+        for(int i = blockIdx.x * batched_level1_block_size + threadIdx.x; i < n;
+            i += gridDim.x * batched_level1_block_size)
+            xb[int64_t(i) * incx] = hipblasBatchedScale(alpha, xb[int64_t(i) * incx]);
+    }
+}
+
+// Device buffers for the results of host pointer mode calls, kept per handle. They only grow,
+// and the calls using them wait for their results, so a buffer is free when the next call starts.
+struct hipblasBatchedBuffer
+{
+    void*  data  = nullptr;
+    size_t bytes = 0;
+};
+
+static std::mutex                                              batched_buffer_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasBatchedBuffer> batched_buffers;
+
+static void* hipblasBatchedBufferGet(hipblasHandle_t handle, size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(batched_buffer_mutex);
+
+    hipblasBatchedBuffer& buffer = batched_buffers[handle];
+    if(bytes > buffer.bytes)
+    {
+        if(buffer.data)
+            (void)hipFree(buffer.data);
+        buffer = {};
+        if(hipMalloc(&buffer.data, bytes) != hipSuccess)
+        {
+            buffer.data = nullptr;
+            return nullptr;
+        }
+        buffer.bytes = bytes;
+    }
+    return buffer.data;
+}
+
+void hipblasBatchedLevel1Erase(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(batched_buffer_mutex);
+
+    auto buffer = batched_buffers.find(handle);
+    if(buffer != batched_buffers.end())
+    {
+        if(buffer->second.data)
+            (void)hipFree(buffer->second.data);
+        batched_buffers.erase(buffer);
+    }
+}
+
+// Runs launch(stream, device_result) for the batch_count results at result, through the buffer of
+// handle in host pointer mode
+template <typename Tr, typename Launch>
+static hipblasStatus_t
+    hipblasBatchedReduce(hipblasHandle_t handle, int batch_count, Tr* result, Launch launch)
+{
+    hipblasPointerMode_t pointer_mode;
+    hipStream_t          stream;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    bool   host          = pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+    size_t bytes         = sizeof(Tr) * size_t(batch_count);
+    Tr*    device_result = host ? (Tr*)hipblasBatchedBufferGet(handle, bytes) : result;
+    if(!device_result)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    launch(stream, device_result);
+    if(hipGetLastError() != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    if(host
+       && (hipMemcpyAsync(result, device_result, bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess))
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+static int hipblasBatchedBlocks(int batch_count)
+{
+    return std::min(batch_count, batched_level1_max_blocks);
+}
+
+// Empty batches return at once. The results of empty vectors are 0, and x may then be null.
+template <typename T, typename Tx>
+static hipblasStatus_t hipblasBatchedIamaxTemplate(hipblasHandle_t handle,
+                                                   bool            amin,
+                                                   int             n,
+                                                   Tx              x,
+                                                   int             incx,
+                                                   hipblasStride   stridex,
+                                                   int             batch_count,
+                                                   int*            result)
+{
+    if(batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(n <= 0 || incx <= 0)
+        n = 0;
+    if(!result || (n && !x))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto kernel
+        = amin ? hipblasBatchedIamaxKernel<true, T, Tx> : hipblasBatchedIamaxKernel<false, T, Tx>;
+    auto launch = [&](hipStream_t stream, int* d_result) {
+        hipLaunchKernelGGL(kernel,
+                           dim3(hipblasBatchedBlocks(batch_count)),
+                           dim3(batched_level1_block_size),
+                           0,
+                           stream,
+                           n,
+                           x,
+                           incx,
+                           stridex,
+                           batch_count,
+                           d_result);
+    };
+    return hipblasBatchedReduce(handle, batch_count, result, launch);
+}
+
+template <typename T, typename Tx, typename Tr>
+static hipblasStatus_t hipblasBatchedNrm2Template(hipblasHandle_t handle,
+                                                  int             n,
+                                                  Tx              x,
+                                                  int             incx,
+                                                  hipblasStride   stridex,
+                                                  int             batch_count,
+                                                  Tr*             result)
+{
+    if(batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(n <= 0 || incx <= 0)
+        n = 0;
+    if(!result || (n && !x))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto launch = [&](hipStream_t stream, Tr* d_result) {
+        hipLaunchKernelGGL((hipblasBatchedNrm2Kernel<T, Tx, Tr>),
+                           dim3(hipblasBatchedBlocks(batch_count)),
+                           dim3(batched_level1_block_size),
+                           0,
+                           stream,
+                           n,
+                           x,
+                           incx,
+                           stridex,
+                           batch_count,
+                           d_result);
+    };
+    return hipblasBatchedReduce(handle, batch_count, result, launch);
+}
+
+template <typename T, typename Tx, typename Ta>
+static hipblasStatus_t hipblasBatchedScalTemplate(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const Ta*       alpha,
+                                                  Tx              x,
+                                                  int             incx,
+                                                  hipblasStride   stridex,
+                                                  int             batch_count)
+{
+    if(n <= 0 || incx <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !x)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasPointerMode_t pointer_mode;
+    hipStream_t          stream;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    bool      device       = pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+    const Ta* alpha_device = device ? alpha : nullptr;
+    Ta        alpha_host   = device ? Ta{} : *alpha;
+
+    int blocks_x = int(std::min<int64_t>((int64_t(n) + batched_level1_block_size - 1)
+                                             / batched_level1_block_size,
+                                         batched_level1_max_blocks));
+    int blocks_y = std::min(batch_count, batched_level1_max_batch_blocks);
+    hipLaunchKernelGGL((hipblasBatchedScalKernel<T, Tx, Ta>),
+                       dim3(blocks_x, blocks_y),
+                       dim3(batched_level1_block_size),
+                       0,
+                       stream,
+                       n,
+                       alpha_device,
+                       alpha_host,
+                       x,
+                       incx,
+                       stridex,
+                       batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+template <typename T>
+hipblasStatus_t hipblasBatchedIamax(hipblasHandle_t handle,
+                                    bool            amin,
+                                    int             n,
+                                    const T* const  x[],
+                                    int             incx,
+                                    int             batch_count,
+                                    int*            result)
+{
+    using Td = hipblas_batched_device_t<T>;
+    return hipblasBatchedIamaxTemplate<Td>(
+        handle, amin, n, (const Td* const*)x, incx, 0, batch_count, result);
+}
+
+template <typename T>
+hipblasStatus_t hipblasBatchedIamax(hipblasHandle_t handle,
+                                    bool            amin,
+                                    int             n,
+                                    const T*        x,
+                                    int             incx,
+                                    hipblasStride   stridex,
+                                    int             batch_count,
+                                    int*            result)
+{
+    using Td = hipblas_batched_device_t<T>;
+    return hipblasBatchedIamaxTemplate<Td>(
+        handle, amin, n, (const Td*)x, incx, stridex, batch_count, result);
+}
+
+template <typename T, typename Tr>
+hipblasStatus_t hipblasBatchedNrm2(hipblasHandle_t handle,
+                                   int             n,
+                                   const T* const  x[],
+                                   int             incx,
+                                   int             batch_count,
+                                   Tr*             result)
+{
+    using Td = hipblas_batched_device_t<T>;
+    return hipblasBatchedNrm2Template<Td>(
+        handle, n, (const Td* const*)x, incx, 0, batch_count, result);
+}
+
+template <typename T, typename Tr>
+hipblasStatus_t hipblasBatchedNrm2(hipblasHandle_t handle,
+                                   int             n,
+                                   const T*        x,
+                                   int             incx,
+                                   hipblasStride   stridex,
+                                   int             batch_count,
+                                   Tr*             result)
+{
+    using Td = hipblas_batched_device_t<T>;
+    return hipblasBatchedNrm2Template<Td>(
+        handle, n, (const Td*)x, incx, stridex, batch_count, result);
+}
+
+template <typename T, typename Ta>
+hipblasStatus_t hipblasBatchedScal(
+    hipblasHandle_t handle, int n, const Ta* alpha, T* const x[], int incx, int batch_count)
+{
+    using Td  = hipblas_batched_device_t<T>;
+    using Tad = hipblas_batched_device_t<Ta>;
+    return hipblasBatchedScalTemplate<Td>(
+        handle, n, (const Tad*)alpha, (Td* const*)x, incx, 0, batch_count);
+}
+
+template <typename T, typename Ta>
+hipblasStatus_t hipblasBatchedScal(hipblasHandle_t handle,
+                                   int             n,
+                                   const Ta*       alpha,
+                                   T*              x,
+                                   int             incx,
+                                   hipblasStride   stridex,
+                                   int             batch_count)
+{
+    using Td  = hipblas_batched_device_t<T>;
+    using Tad = hipblas_batched_device_t<Ta>;
+    return hipblasBatchedScalTemplate<Td>(
+        handle, n, (const Tad*)alpha, (Td*)x, incx, stridex, batch_count);
+}
+
+// The precisions of the cuBLAS batched Level-1 entry points
+#define HIPBLAS_BATCHED_IAMAX_NRM2(T, Tr)                                     \
+    template hipblasStatus_t hipblasBatchedIamax<T>(                          \
+        hipblasHandle_t, bool, int, const T* const[], int, int, int*);        \
+    template hipblasStatus_t hipblasBatchedIamax<T>(                          \
+        hipblasHandle_t, bool, int, const T*, int, hipblasStride, int, int*); \
+    template hipblasStatus_t hipblasBatchedNrm2<T, Tr>(                       \
+        hipblasHandle_t, int, const T* const[], int, int, Tr*);               \
+    template hipblasStatus_t hipblasBatchedNrm2<T, Tr>(                       \
+        hipblasHandle_t, int, const T*, int, hipblasStride, int, Tr*);
+
+#define HIPBLAS_BATCHED_SCAL(T, Ta)                                    \
+    template hipblasStatus_t hipblasBatchedScal<T, Ta>(                \
+        hipblasHandle_t, int, const Ta*, T* const[], int, int);        \
+    template hipblasStatus_t hipblasBatchedScal<T, Ta>(                \
+        hipblasHandle_t, int, const Ta*, T*, int, hipblasStride, int);
+
+HIPBLAS_BATCHED_IAMAX_NRM2(float, float)
+HIPBLAS_BATCHED_IAMAX_NRM2(double, double)
+HIPBLAS_BATCHED_IAMAX_NRM2(hipblasComplex, float)
+HIPBLAS_BATCHED_IAMAX_NRM2(hipblasDoubleComplex, double)
+
+HIPBLAS_BATCHED_SCAL(float, float)
+HIPBLAS_BATCHED_SCAL(double, double)
+HIPBLAS_BATCHED_SCAL(hipblasComplex, hipblasComplex)
+HIPBLAS_BATCHED_SCAL(hipblasComplex, float)
+HIPBLAS_BATCHED_SCAL(hipblasDoubleComplex, hipblasDoubleComplex)
+HIPBLAS_BATCHED_SCAL(hipblasDoubleComplex, double)
+
+#undef HIPBLAS_BATCHED_SCAL
+#undef HIPBLAS_BATCHED_IAMAX_NRM2
@@ -0,0 +1,549 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "conj_op.hpp"
+#include "batch_scalars.hpp"
+#include "pointer_mode.hpp"
+#include "scratch.hpp"
+#include <cstdlib>
+#include <hip/hip_runtime_api.h>
+
+// hipBLAS functions and real type of one complex precision
+template <typename T>
+struct hipblasConjOpTraits;
+
+template <>
+struct hipblasConjOpTraits<hipblasComplex>
+{
+    using real = float;
+
+    static constexpr auto scal               = hipblasSscal;
+    static constexpr auto scalStridedBatched = hipblasSscalStridedBatched;
+    static constexpr auto copy               = hipblasCcopy;
+    static constexpr auto copyStridedBatched = hipblasCcopyStridedBatched;
+    static constexpr auto geam               = hipblasCgeam;
+    static constexpr auto geamStridedBatched = hipblasCgeamStridedBatched;
+    static constexpr auto gemmStridedBatched = hipblasCgemmStridedBatched;
+    static constexpr auto gemvStridedBatched = hipblasCgemvStridedBatched;
+};
+
+template <>
+struct hipblasConjOpTraits<hipblasDoubleComplex>
+{
+    using real = double;
+
+    static constexpr auto scal               = hipblasDscal;
+    static constexpr auto scalStridedBatched = hipblasDscalStridedBatched;
+    static constexpr auto copy               = hipblasZcopy;
+    static constexpr auto copyStridedBatched = hipblasZcopyStridedBatched;
+    static constexpr auto geam               = hipblasZgeam;
+    static constexpr auto geamStridedBatched = hipblasZgeamStridedBatched;
+    static constexpr auto gemmStridedBatched = hipblasZgemmStridedBatched;
+    static constexpr auto gemvStridedBatched = hipblasZgemvStridedBatched;
+};
+
+// Runs strided() over a batch, or single(i) for each instance where the backend has no strided
+// batched form of the call
+template <typename Strided, typename Single>
+static hipblasStatus_t hipblasConjOpBatch(int batch_count, Strided&& strided, Single&& single)
+{
+    if(batch_count > 1)
+    {
+        hipblasStatus_t status = strided();
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+            return status;
+    }
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+        status = single(i);
+    return status;
+}
+
+// Stream and pointer mode of handle, and scratch of bytes on its stream
+static hipblasStatus_t hipblasConjOpSetup(hipblasHandle_t       handle,
+                                          size_t                bytes,
+                                          hipblasStreamScratch& scratch,
+                                          hipblasPointerMode_t& mode)
+{
+    hipblasStatus_t status = hipblasGetStream(handle, &scratch.stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(hipMallocAsync((void**)&scratch.base, bytes, scratch.stream) != hipSuccess)
+    {
+        scratch.base = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasGemmConjTemplate(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const T*           alpha,
+                                               const T*           A,
+                                               int                lda,
+                                               hipblasStride      stride_A,
+                                               const T*           B,
+                                               int                ldb,
+                                               hipblasStride      stride_B,
+                                               const T*           beta,
+                                               T*                 C,
+                                               int                ldc,
+                                               hipblasStride      stride_C,
+                                               int                batch_count)
+{
+    using traits = hipblasConjOpTraits<T>;
+
+    bool               conj_a = transa == HIPBLAS_OP_CONJ, conj_b = transb == HIPBLAS_OP_CONJ;
+    hipblasOperation_t ta = conj_a ? HIPBLAS_OP_N : transa, tb = conj_b ? HIPBLAS_OP_N : transb;
+
+    // Argument errors and quick returns, where the conjugated operands are not read, are those of
+    // HIPBLAS_OP_N
+    if(m <= 0 || n <= 0 || k <= 0 || batch_count <= 0 || ldc < m || !alpha || !beta || !C
+       || (conj_a && (lda < m || !A)) || (conj_b && (ldb < k || !B)))
+        return traits::gemmStridedBatched(handle,
+                                          ta,
+                                          tb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          stride_A,
+                                          B,
+                                          ldb,
+                                          stride_B,
+                                          beta,
+                                          C,
+                                          ldc,
+                                          stride_C,
+                                          batch_count);
+
+    // A^H is k x m and B^H is n x k, once for an operand shared by the batch
+    int           a_count  = conj_a ? (stride_A ? batch_count : 1) : 0;
+    int           b_count  = conj_b ? (stride_B ? batch_count : 1) : 0;
+    hipblasStride stride_X = stride_A ? hipblasStride(k) * m : 0;
+    hipblasStride stride_Y = stride_B ? hipblasStride(n) * k : 0;
+    size_t        x_bytes  = (sizeof(T) * k * m * a_count + 255) / 256 * 256;
+
+    hipblasStreamScratch scratch;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasConjOpSetup(
+        handle, x_bytes + sizeof(T) * n * k * b_count, scratch, mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    T* X = reinterpret_cast<T*>(scratch.base);
+    T* Y = reinterpret_cast<T*>(scratch.base + x_bytes);
+
+    hipblasPointerModeGuard pointer_mode{handle, mode};
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+    const T one(1), zero(0);
+
+    // Z_i = W_i^H for count instances of the rows x cols W_i
+    auto adjoint = [&](int           rows,
+                       int           cols,
+                       const T*      W,
+                       int           ldw,
+                       hipblasStride stride_w,
+                       T*            Z,
+                       hipblasStride stride_z,
+                       int           count) {
+        if(status != HIPBLAS_STATUS_SUCCESS || !count)
+            return;
+        status = hipblasConjOpBatch(
+            count,
+            [&]() {
+                return traits::geamStridedBatched(handle,
+                                                  HIPBLAS_OP_C,
+                                                  HIPBLAS_OP_N,
+                                                  cols,
+                                                  rows,
+                                                  &one,
+                                                  W,
+                                                  ldw,
+                                                  stride_w,
+                                                  &zero,
+                                                  Z,
+                                                  cols,
+                                                  stride_z,
+                                                  Z,
+                                                  cols,
+                                                  stride_z,
+                                                  count);
+            },
+            [&](int i) {
+                return traits::geam(handle,
+                                    HIPBLAS_OP_C,
+                                    HIPBLAS_OP_N,
+                                    cols,
+                                    rows,
+                                    &one,
+                                    W + i * stride_w,
+                                    ldw,
+                                    &zero,
+                                    Z + i * stride_z,
+                                    cols,
+                                    Z + i * stride_z,
+                                    cols);
+            });
+    };
+    adjoint(m, k, A, lda, stride_A, X, stride_X, a_count);
+    adjoint(k, n, B, ldb, stride_B, Y, stride_Y, b_count);
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return traits::gemmStridedBatched(handle,
+                                      conj_a ? HIPBLAS_OP_T : transa,
+                                      conj_b ? HIPBLAS_OP_T : transb,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      conj_a ? X : A,
+                                      conj_a ? k : lda,
+                                      conj_a ? stride_X : stride_A,
+                                      conj_b ? Y : B,
+                                      conj_b ? n : ldb,
+                                      conj_b ? stride_Y : stride_B,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      stride_C,
+                                      batch_count);
+}
+
+template <typename T>
+static hipblasStatus_t hipblasGemvConjTemplate(hipblasHandle_t handle,
+                                               int             m,
+                                               int             n,
+                                               const T*        alpha,
+                                               const T*        A,
+                                               int             lda,
+                                               hipblasStride   stride_A,
+                                               const T*        x,
+                                               int             incx,
+                                               hipblasStride   stride_x,
+                                               const T*        beta,
+                                               T*              y,
+                                               int             incy,
+                                               hipblasStride   stride_y,
+                                               int             batch_count)
+{
+    using traits = hipblasConjOpTraits<T>;
+    using R      = typename traits::real;
+
+    // Argument errors and quick returns are those of HIPBLAS_OP_N
+    if(m <= 0 || n <= 0 || batch_count <= 0 || lda < m || !incx || !incy || !alpha || !beta || !A
+       || !x || !y)
+        return traits::gemvStridedBatched(handle,
+                                          HIPBLAS_OP_N,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          stride_A,
+                                          x,
+                                          incx,
+                                          stride_x,
+                                          beta,
+                                          y,
+                                          incy,
+                                          stride_y,
+                                          batch_count);
+
+    // Per-instance scalars would each need conjugating
+    if(hipblasBatchScalarStride(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // The conjugated scalars, then conj( x_i ) with unit increment, once for an x shared by the
+    // batch
+    int           x_count   = stride_x ? batch_count : 1;
+    hipblasStride stride_xs = stride_x ? n : 0;
+
+    hipblasStreamScratch scratch;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status
+        = hipblasConjOpSetup(handle, sizeof(T) * (2 + size_t(n) * x_count), scratch, mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    T* scalars = reinterpret_cast<T*>(scratch.base);
+    T* xs      = scalars + 2;
+
+    hipblasPointerModeGuard pointer_mode{handle, mode};
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+    const R minus_one = -1;
+
+    // Negates the imaginary parts of count vectors of length len, read as real vectors
+    auto conjugate = [&](int len, T* v, int incv, hipblasStride stride_v, int count) {
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return;
+        R* imag = reinterpret_cast<R*>(v) + 1;
+        status  = hipblasConjOpBatch(
+            count,
+            [&]() {
+                return traits::scalStridedBatched(
+                    handle, len, &minus_one, imag, 2 * incv, 2 * stride_v, count);
+            },
+            [&](int i) {
+                return traits::scal(handle, len, &minus_one, imag + 2 * i * stride_v, 2 * incv);
+            });
+    };
+
+    conjugate(m, y, std::abs(incy), stride_y, batch_count);
+    bool y_conjugated = status == HIPBLAS_STATUS_SUCCESS;
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasConjOpBatch(
+            x_count,
+            [&]() {
+                return traits::copyStridedBatched(
+                    handle, n, x, incx, stride_x, xs, 1, stride_xs, x_count);
+            },
+            [&](int i) { return traits::copy(handle, n, x + i * stride_x, incx, xs + i * n, 1); });
+    conjugate(n, xs, 1, stride_xs, x_count);
+
+    T        h_alpha, h_beta;
+    const T* c_alpha = &h_alpha;
+    const T* c_beta  = &h_beta;
+    if(mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        h_alpha = T(alpha->real(), -alpha->imag());
+        h_beta  = T(beta->real(), -beta->imag());
+    }
+    else if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        auto copy_scalar = [&](T* dst, const T* src) {
+            return hipMemcpyAsync(dst, src, sizeof(T), hipMemcpyDeviceToDevice, scratch.stream)
+                   == hipSuccess;
+        };
+        if(!copy_scalar(scalars, alpha) || !copy_scalar(scalars + 1, beta))
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        conjugate(2, scalars, 1, 0, 1);
+        c_alpha = scalars;
+        c_beta  = scalars + 1;
+    }
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = traits::gemvStridedBatched(handle,
+                                            HIPBLAS_OP_N,
+                                            m,
+                                            n,
+                                            c_alpha,
+                                            A,
+                                            lda,
+                                            stride_A,
+                                            xs,
+                                            1,
+                                            stride_xs,
+                                            c_beta,
+                                            y,
+                                            incy,
+                                            stride_y,
+                                            batch_count);
+
+    // y is conjugated back after a later failure too
+    if(!y_conjugated)
+        return status;
+    hipblasStatus_t first_status = status;
+    status                       = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    conjugate(m, y, std::abs(incy), stride_y, batch_count);
+    return first_status != HIPBLAS_STATUS_SUCCESS ? first_status : status;
+}
+
+bool hipblasGemmConj(hipblasHandle_t       handle,
+                     hipblasOperation_t    transa,
+                     hipblasOperation_t    transb,
+                     int                   m,
+                     int                   n,
+                     int                   k,
+                     const hipblasComplex* alpha,
+                     const hipblasComplex* A,
+                     int                   lda,
+                     hipblasStride         stride_A,
+                     const hipblasComplex* B,
+                     int                   ldb,
+                     hipblasStride         stride_B,
+                     const hipblasComplex* beta,
+                     hipblasComplex*       C,
+                     int                   ldc,
+                     hipblasStride         stride_C,
+                     int                   batch_count,
+                     hipblasStatus_t&      status)
+{
+    if(transa != HIPBLAS_OP_CONJ && transb != HIPBLAS_OP_CONJ)
+        return false;
+    status = hipblasGemmConjTemplate(handle,
+                                     transa,
+                                     transb,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     stride_A,
+                                     B,
+                                     ldb,
+                                     stride_B,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     stride_C,
+                                     batch_count);
+    return true;
+}
+
+bool hipblasGemmConj(hipblasHandle_t             handle,
+                     hipblasOperation_t          transa,
+                     hipblasOperation_t          transb,
+                     int                         m,
+                     int                         n,
+                     int                         k,
+                     const hipblasDoubleComplex* alpha,
+                     const hipblasDoubleComplex* A,
+                     int                         lda,
+                     hipblasStride               stride_A,
+                     const hipblasDoubleComplex* B,
+                     int                         ldb,
+                     hipblasStride               stride_B,
+                     const hipblasDoubleComplex* beta,
+                     hipblasDoubleComplex*       C,
+                     int                         ldc,
+                     hipblasStride               stride_C,
+                     int                         batch_count,
+                     hipblasStatus_t&            status)
+{
+    if(transa != HIPBLAS_OP_CONJ && transb != HIPBLAS_OP_CONJ)
+        return false;
+    status = hipblasGemmConjTemplate(handle,
+                                     transa,
+                                     transb,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     stride_A,
+                                     B,
+                                     ldb,
+                                     stride_B,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     stride_C,
+                                     batch_count);
+    return true;
+}
+
+bool hipblasGemvConj(hipblasHandle_t       handle,
+                     hipblasOperation_t    trans,
+                     int                   m,
+                     int                   n,
+                     const hipblasComplex* alpha,
+                     const hipblasComplex* A,
+                     int                   lda,
+                     hipblasStride         stride_A,
+                     const hipblasComplex* x,
+                     int                   incx,
+                     hipblasStride         stride_x,
+                     const hipblasComplex* beta,
+                     hipblasComplex*       y,
+                     int                   incy,
+                     hipblasStride         stride_y,
+                     int                   batch_count,
+                     hipblasStatus_t&      status)
+{
+    if(trans != HIPBLAS_OP_CONJ)
+        return false;
+    status = hipblasGemvConjTemplate(handle,
+                                     m,
+                                     n,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     stride_A,
+                                     x,
+                                     incx,
+                                     stride_x,
+                                     beta,
+                                     y,
+                                     incy,
+                                     stride_y,
+                                     batch_count);
+    return true;
+}
+
+bool hipblasGemvConj(hipblasHandle_t             handle,
+                     hipblasOperation_t          trans,
+                     int                         m,
+                     int                         n,
+                     const hipblasDoubleComplex* alpha,
+                     const hipblasDoubleComplex* A,
+                     int                         lda,
+                     hipblasStride               stride_A,
+                     const hipblasDoubleComplex* x,
+                     int                         incx,
+                     hipblasStride               stride_x,
+                     const hipblasDoubleComplex* beta,
+                     hipblasDoubleComplex*       y,
+                     int                         incy,
+                     hipblasStride               stride_y,
+                     int                         batch_count,
+                     hipblasStatus_t&            status)
+{
+    if(trans != HIPBLAS_OP_CONJ)
+        return false;
+    status = hipblasGemvConjTemplate(handle,
+                                     m,
+                                     n,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     stride_A,
+                                     x,
+                                     incx,
+                                     stride_x,
+                                     beta,
+                                     y,
+                                     incy,
+                                     stride_y,
+                                     batch_count);
+    return true;
+}
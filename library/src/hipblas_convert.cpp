@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "convert.hpp"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include <hip/hip_runtime_api.h>
+
+// Checks the arguments of the three forms, where x_array and y_array are the pointer arrays of the
+// batched form and null otherwise, then runs the conversion kernels. Without them, unscaled
+// copies with xType == yType and HIPBLAS_CONVERT_DEFAULT run as asynchronous copies of the
+// non-batched and strided forms, and the others return HIPBLAS_STATUS_NOT_SUPPORTED.
+static hipblasStatus_t hipblasConvert(hipblasHandle_t      handle,
+                                      int                  n,
+                                      const void*          alpha,
+                                      hipDataType          alphaType,
+                                      const void*          x,
+                                      const void* const*   x_array,
+                                      hipDataType          xType,
+                                      hipblasStride        stridex,
+                                      void*                y,
+                                      void* const*         y_array,
+                                      hipDataType          yType,
+                                      hipblasStride        stridey,
+                                      hipblasConvertMode_t mode,
+                                      int                  batchCount)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(mode != HIPBLAS_CONVERT_DEFAULT && mode != HIPBLAS_CONVERT_SATURATE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(alpha && alphaType != HIP_R_32F && alphaType != HIP_R_64F)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    bool batched = x_array || y_array;
+    if(batched ? !x_array || !y_array : !x || !y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_CONVERT
+    return hipblasConvertKernels(handle,
+                                 n,
+                                 alpha,
+                                 alphaType,
+                                 x,
+                                 x_array,
+                                 xType,
+                                 stridex,
+                                 y,
+                                 y_array,
+                                 yType,
+                                 stridey,
+                                 batchCount,
+                                 mode == HIPBLAS_CONVERT_SATURATE);
+#else
+    size_t size = hipblasDatatypeElementSize(xType);
+    if(batched || alpha || xType != yType || mode != HIPBLAS_CONVERT_DEFAULT || !size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(batchCount > 1 && (stridex < n || stridey < n))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // One copy of batchCount rows of n elements, stridex and stridey apart
+    size_t     width   = size * n;
+    size_t     pitch_x = batchCount == 1 ? width : size * stridex;
+    size_t     pitch_y = batchCount == 1 ? width : size * stridey;
+    hipError_t error   = hipMemcpy2DAsync(
+        y, pitch_y, x, pitch_x, width, batchCount, hipMemcpyDeviceToDevice, stream);
+    return error == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasConvertEx(hipblasHandle_t      handle,
+                                            int                  n,
+                                            const void*          alpha,
+                                            hipDataType          alphaType,
+                                            const void*          x,
+                                            hipDataType          xType,
+                                            void*                y,
+                                            hipDataType          yType,
+                                            hipblasConvertMode_t mode)
+try
+{
+    HIPBLAS_LAYER(handle, n, alpha, alphaType, x, xType, y, yType, mode);
+    return hipblasConvert(
+        handle, n, alpha, alphaType, x, nullptr, xType, 0, y, nullptr, yType, 0, mode, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasConvertBatchedEx(hipblasHandle_t      handle,
+                                                   int                  n,
+                                                   const void*          alpha,
+                                                   hipDataType          alphaType,
+                                                   const void* const    x[],
+                                                   hipDataType          xType,
+                                                   void* const          y[],
+                                                   hipDataType          yType,
+                                                   hipblasConvertMode_t mode,
+                                                   int                  batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, alpha, alphaType, x, xType, y, yType, mode, batchCount);
+    return hipblasConvert(
+        handle, n, alpha, alphaType, nullptr, x, xType, 0, nullptr, y, yType, 0, mode, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasConvertStridedBatchedEx(hipblasHandle_t      handle,
+                                                          int                  n,
+                                                          const void*          alpha,
+                                                          hipDataType          alphaType,
+                                                          const void*          x,
+                                                          hipDataType          xType,
+                                                          hipblasStride        stridex,
+                                                          void*                y,
+                                                          hipDataType          yType,
+                                                          hipblasStride        stridey,
+                                                          hipblasConvertMode_t mode,
+                                                          int                  batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, alpha, alphaType, x, xType, stridex, y, yType, stridey, mode, batchCount);
+    return hipblasConvert(handle,
+                          n,
+                          alpha,
+                          alphaType,
+                          x,
+                          nullptr,
+                          xType,
+                          stridex,
+                          y,
+                          nullptr,
+                          yType,
+                          stridey,
+                          mode,
+                          batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,337 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "convert.hpp"
+#include "convert_device.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+// Threads of a work group, and consecutive elements converted by each thread
+constexpr int convert_threads = 256;
+constexpr int convert_vector  = 4;
+
+// Largest grid in y. The work groups loop over the remaining batches.
+constexpr int convert_max_grid = 65535;
+
+// Precision of the conversion of a Tx to a Ty: double when a 64-bit float or a 32-bit integer,
+// which float does not hold exactly, is involved
+template <typename T>
+constexpr bool hipblas_convert_needs_double
+    = std::is_same<T, double>{} || (std::is_integral<T>{} && sizeof(T) == 4);
+
+template <typename Tx, typename Ty>
+using hipblasConvertWork = std::conditional_t<hipblas_convert_needs_double<Tx>
+                                                  || hipblas_convert_needs_double<Ty>,
+                                              double,
+                                              float>;
+
+// Largest finite value of T, and its lowest value
+template <typename T>
+__device__ constexpr double hipblasConvertMax()
+{
+    if constexpr(std::is_same<T, __half>{})
+        return 65504.0;
+    else if constexpr(std::is_same<T, hipblasDeviceBfloat16>{})
+        return 3.38953138925153547590e38;
+    else if constexpr(std::is_same<T, float>{})
+        return FLT_MAX;
+    else if constexpr(std::is_same<T, double>{})
+        return DBL_MAX;
+    else
+        return double(std::numeric_limits<T>::max());
+}
+
+template <typename T>
+__device__ constexpr double hipblasConvertLowest()
+{
+    if constexpr(std::is_integral<T>{})
+        return double(std::numeric_limits<T>::lowest());
+    else
+        return -hipblasConvertMax<T>();
+}
+
+template <typename W, typename T>
+__device__ inline W hipblasConvertLoad(T a)
+{
+    if constexpr(std::is_same<T, __half>{} || std::is_same<T, hipblasDeviceBfloat16>{})
+        return hipblasDeviceToFloat(a);
+    else
+        return W(a);
+}
+
+// Integers round to nearest even and always saturate, with NaN becoming 0. Floating-point values
+// beyond the range of T saturate when saturate is set; NaN stays NaN.
+template <typename T, typename W>
+__device__ inline T hipblasConvertStore(W w, bool saturate)
+{
+    constexpr W max    = W(hipblasConvertMax<T>());
+    constexpr W lowest = W(hipblasConvertLowest<T>());
+
+    if constexpr(std::is_integral<T>{})
+    {
+        if(w != w)
+            return T(0);
+        w = std::rint(w);
+        return T(w > max ? max : w < lowest ? lowest : w);
+    }
+    else
+    {
+        if(saturate)
+            w = w > max ? max : w < lowest ? lowest : w;
+        if constexpr(std::is_same<T, float>{} || std::is_same<T, double>{})
+            return T(w);
+        else
+        {
+            T c;
+            hipblasDeviceFromFloat(float(w), c);
+            return c;
+        }
+    }
+}
+
+template <typename T>
+struct alignas(sizeof(T) * convert_vector) hipblasConvertVector
+{
+    T v[convert_vector];
+};
+
+// Work group (x, y) converts elements x * convert_threads * convert_vector onwards of the
+// batches from y on. alpha is a device pointer, of double when alpha_double is set, or null for
+// alpha_host. vectorized is only set when every x_b and y_b is aligned to hipblasConvertVector.
+template <typename Tx, typename Ty>
+__global__ void __launch_bounds__(convert_threads)
+    hipblasConvertKernel(int              n,
+                         const void*      alpha,
+                         bool             alpha_double,
+                         double           alpha_host,
+                         const Tx*        x,
+                         const Tx* const* x_array,
+                         hipblasStride    stride_x,
+                         Ty*              y,
+                         Ty* const*       y_array,
+                         hipblasStride    stride_y,
+                         int              batch_count,
+                         bool             saturate,
+                         bool             vectorized)
+{
+    using W = hipblasConvertWork<Tx, Ty>;
+
+    int64_t i0 = (int64_t(blockIdx.x) * convert_threads + threadIdx.x) * convert_vector;
+    if(i0 >= n)
+        return;
+
+    W a = W(alpha_host);
+    if(alpha)
+        a = alpha_double ? W(*(const double*)alpha) : W(*(const float*)alpha);
+
+    for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+    {
+        const Tx* xb = x_array ? x_array[b] : x + b * stride_x;
+        Ty*       yb = y_array ? y_array[b] : y + b * stride_y;
+
+        if(vectorized && i0 + convert_vector <= n)
+        {
+            hipblasConvertVector<Tx> xv = *(const hipblasConvertVector<Tx>*)(xb + i0);
+            hipblasConvertVector<Ty> yv;
+            for(int i = 0; i < convert_vector; i++)
+                yv.v[i] = hipblasConvertStore<Ty>(a * hipblasConvertLoad<W>(xv.v[i]), saturate);
+            *(hipblasConvertVector<Ty>*)(yb + i0) = yv;
+        }
+        else
+        {
+            for(int64_t i = i0; i < std::min(i0 + convert_vector, int64_t(n)); i++)
+                yb[i] = hipblasConvertStore<Ty>(a * hipblasConvertLoad<W>(xb[i]), saturate);
+        }
+    }
+}
+
+template <typename T>
+static bool hipblasConvertAligned(const void* p, hipblasStride stride)
+{
+    return uintptr_t(p) % alignof(hipblasConvertVector<T>) == 0 && stride % convert_vector == 0;
+}
+
+template <typename Tx, typename Ty>
+static hipblasStatus_t hipblasConvertLaunch(hipblasHandle_t    handle,
+                                            int                n,
+                                            const void*        alpha,
+                                            hipDataType        alpha_type,
+                                            const void*        x,
+                                            const void* const* x_array,
+                                            hipblasStride      stride_x,
+                                            void*              y,
+                                            void* const*       y_array,
+                                            hipblasStride      stride_y,
+                                            int                batch_count,
+                                            bool               saturate)
+{
+    hipStream_t          stream;
+    hipblasPointerMode_t pointer_mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Host scalars are passed by value, so that the launch does not read host memory later
+    bool   alpha_double = alpha_type == HIP_R_64F;
+    double alpha_host   = 1;
+    if(alpha && pointer_mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        alpha_host = alpha_double ? *(const double*)alpha : *(const float*)alpha;
+        alpha      = nullptr;
+    }
+
+    // The pointers of a batched call are on the device, so only strided calls are vectorized
+    bool vectorized = !x_array && hipblasConvertAligned<Tx>(x, stride_x)
+                      && hipblasConvertAligned<Ty>(y, stride_y);
+
+    int  per_block = convert_threads * convert_vector;
+    dim3 grid((n + per_block - 1) / per_block, std::min(batch_count, convert_max_grid));
+    dim3 threads(convert_threads);
+
+    hipLaunchKernelGGL((hipblasConvertKernel<Tx, Ty>),
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       n,
+                       alpha,
+                       alpha_double,
+                       alpha_host,
+                       (const Tx*)x,
+                       (const Tx* const*)x_array,
+                       stride_x,
+                       (Ty*)y,
+                       (Ty* const*)y_array,
+                       stride_y,
+                       batch_count,
+                       saturate,
+                       vectorized);
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// Calls f with a value of the element type of the real type, or of the components of the
+// complex type
+template <typename F>
+static hipblasStatus_t hipblasConvertType(hipDataType type, F f)
+{
+    switch(type)
+    {
+    case HIP_R_16F:
+    case HIP_C_16F:
+        return f(__half());
+    case HIP_R_16BF:
+    case HIP_C_16BF:
+        return f(hipblasDeviceBfloat16());
+    case HIP_R_32F:
+    case HIP_C_32F:
+        return f(float());
+    case HIP_R_64F:
+    case HIP_C_64F:
+        return f(double());
+    case HIP_R_8I:
+    case HIP_C_8I:
+        return f(int8_t());
+    case HIP_R_8U:
+    case HIP_C_8U:
+        return f(uint8_t());
+    case HIP_R_32I:
+    case HIP_C_32I:
+        return f(int32_t());
+    case HIP_R_32U:
+    case HIP_C_32U:
+        return f(uint32_t());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static bool hipblasConvertIsComplex(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_C_16F:
+    case HIP_C_16BF:
+    case HIP_C_32F:
+    case HIP_C_64F:
+    case HIP_C_8I:
+    case HIP_C_8U:
+    case HIP_C_32I:
+    case HIP_C_32U:
+        return true;
+    default:
+        return false;
+    }
+}
+
+hipblasStatus_t hipblasConvertKernels(hipblasHandle_t    handle,
+                                      int                n,
+                                      const void*        alpha,
+                                      hipDataType        alpha_type,
+                                      const void*        x,
+                                      const void* const* x_array,
+                                      hipDataType        x_type,
+                                      hipblasStride      stride_x,
+                                      void*              y,
+                                      void* const*       y_array,
+                                      hipDataType        y_type,
+                                      hipblasStride      stride_y,
+                                      int                batch_count,
+                                      bool               saturate)
+{
+    // A complex vector converts as the vector of its real and imaginary parts
+    bool complex = hipblasConvertIsComplex(x_type);
+    if(complex != hipblasConvertIsComplex(y_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(complex)
+    {
+        if(n > std::numeric_limits<int>::max() / 2)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        n *= 2;
+        stride_x *= 2;
+        stride_y *= 2;
+    }
+
+    return hipblasConvertType(x_type, [&](auto x_element) {
+        return hipblasConvertType(y_type, [&](auto y_element) {
+            return hipblasConvertLaunch<decltype(x_element), decltype(y_element)>(handle,
+                                                                                  n,
+                                                                                  alpha,
+                                                                                  alpha_type,
+                                                                                  x,
+                                                                                  x_array,
+                                                                                  stride_x,
+                                                                                  y,
+                                                                                  y_array,
+                                                                                  stride_y,
+                                                                                  batch_count,
+                                                                                  saturate);
+        });
+    });
+}
@@ -0,0 +1,1021 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "persistent.hpp"
+#include "shared_handle.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+std::atomic<int> hipblas_deferred_handles{0};
+thread_local int hipblas_deferred_depth = 0;
+
+// Most calls run by one batched call
+static constexpr size_t deferred_max_calls = 256;
+
+// Bytes from the first to past the last element an operand spans
+struct hipblasDeferredRange
+{
+    uintptr_t begin = 0;
+    uintptr_t end   = 0;
+
+    hipblasDeferredRange() = default;
+
+    hipblasDeferredRange(const void* p, size_t elements, size_t element_size)
+        : begin(uintptr_t(p))
+        , end(uintptr_t(p) + elements * element_size)
+    {
+    }
+
+    bool overlaps(const hipblasDeferredRange& other) const
+    {
+        return begin < other.end && other.begin < end;
+    }
+};
+
+struct hipblasDeferredEntry
+{
+    const void*          A;
+    const void*          x;
+    void*                y;
+    hipblasDeferredRange A_range;
+    hipblasDeferredRange x_range;
+    hipblasDeferredRange y_range;
+};
+
+// The calls queued on a handle share the arguments of the first, with the scalars by value in
+// host pointer mode. The pointer mode and stream cannot change while calls are queued, as
+// hipblasSetPointerMode and hipblasSetStream run the queue first. persistent is set in
+// HIPBLAS_DEFERRED_MODE_PERSISTENT, where nothing is queued.
+struct hipblasDeferredQueue
+{
+    hipblasDeferredCall               call{};
+    hipblasPointerMode_t              mode  = HIPBLAS_POINTER_MODE_HOST;
+    double                            alpha = 0;
+    double                            beta  = 0;
+    std::vector<hipblasDeferredEntry> entries;
+    hipblasStatus_t                   error      = HIPBLAS_STATUS_SUCCESS;
+    hipblasPersistentContext*         persistent = nullptr;
+
+    ~hipblasDeferredQueue()
+    {
+        hipblasPersistentDestroy(persistent);
+    }
+};
+
+static std::mutex                                                               deferred_mutex;
+static std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasDeferredQueue>> deferred_queues;
+
+// The queue of handle, nullptr when it is not in deferred mode. Only the thread using the handle
+// reads or changes the queue, the lock guards the map.
+static hipblasDeferredQueue* hipblasDeferredFind(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(deferred_mutex);
+    auto                        it = deferred_queues.find(handle);
+    return it != deferred_queues.end() ? it->second.get() : nullptr;
+}
+
+static bool hipblasDeferredGemvRoutine(hipblasDeferredRoutine routine)
+{
+    return routine == hipblas_deferred_sgemv || routine == hipblas_deferred_dgemv;
+}
+
+// ger, syr and her, which update A
+static bool hipblasDeferredRankRoutine(hipblasDeferredRoutine routine)
+{
+    return routine >= hipblas_deferred_sger && routine <= hipblas_deferred_zher;
+}
+
+static bool hipblasDeferredGerRoutine(hipblasDeferredRoutine routine)
+{
+    return routine == hipblas_deferred_sger || routine == hipblas_deferred_dger;
+}
+
+// Size of the scalars, which are real for her
+static size_t hipblasDeferredScalarSize(hipblasDeferredRoutine routine)
+{
+    switch(routine)
+    {
+    case hipblas_deferred_sgemv:
+    case hipblas_deferred_saxpy:
+    case hipblas_deferred_sger:
+    case hipblas_deferred_ssyr:
+    case hipblas_deferred_cher:
+    case hipblas_deferred_sgemm:
+    case hipblas_deferred_strsv:
+        return sizeof(float);
+    default:
+        return sizeof(double);
+    }
+}
+
+static size_t hipblasDeferredElementSize(hipblasDeferredRoutine routine)
+{
+    switch(routine)
+    {
+    case hipblas_deferred_cher:
+        return sizeof(hipblasComplex);
+    case hipblas_deferred_zher:
+        return sizeof(hipblasDoubleComplex);
+    default:
+        return hipblasDeferredScalarSize(routine);
+    }
+}
+
+static double hipblasDeferredScalar(hipblasDeferredRoutine routine, const void* scalar)
+{
+    if(!scalar)
+        return 0;
+    return hipblasDeferredScalarSize(routine) == sizeof(float) ? *(const float*)scalar
+                                                               : *(const double*)scalar;
+}
+
+// Calls with arguments the backend would reject or return early for are not queued, so they
+// report their status when they are made
+static bool hipblasDeferredValid(const hipblasDeferredCall& call)
+{
+    // gemm and trsv are only posted to the persistent kernel
+    if(call.routine >= hipblas_deferred_sgemm)
+        return false;
+    if(call.n <= 0 || !call.alpha || !call.x)
+        return false;
+
+    // The vectors of the rank-1 updates are gathered with unit increments, so negative
+    // increments, which run backwards, are not queued
+    if(hipblasDeferredRankRoutine(call.routine))
+    {
+        if(call.m <= 0 || call.lda < call.m || !call.A || call.incx <= 0)
+            return false;
+        if(hipblasDeferredGerRoutine(call.routine))
+            return call.y && call.incy > 0;
+        return call.uplo == HIPBLAS_FILL_MODE_UPPER || call.uplo == HIPBLAS_FILL_MODE_LOWER;
+    }
+
+    if(!call.y)
+        return false;
+    if(!hipblasDeferredGemvRoutine(call.routine))
+        return true;
+    return call.m > 0 && call.lda >= call.m && call.incx != 0 && call.incy != 0 && call.A
+           && call.beta
+           && (call.trans == HIPBLAS_OP_N || call.trans == HIPBLAS_OP_T
+               || call.trans == HIPBLAS_OP_C);
+}
+
+static hipblasDeferredEntry hipblasDeferredMakeEntry(const hipblasDeferredCall& call)
+{
+    size_t size = hipblasDeferredElementSize(call.routine);
+    size_t x_length = call.n, y_length = call.n;
+    hipblasDeferredEntry entry{call.A, call.x, call.y, {}, {}, {}};
+    if(hipblasDeferredRankRoutine(call.routine))
+    {
+        entry.A_range
+            = hipblasDeferredRange(call.A, size_t(call.lda) * (call.n - 1) + call.m, size);
+        entry.x_range = hipblasDeferredRange(call.x, (call.m - 1) * size_t(call.incx) + 1, size);
+        if(call.y)
+            entry.y_range
+                = hipblasDeferredRange(call.y, (call.n - 1) * size_t(call.incy) + 1, size);
+        return entry;
+    }
+    if(hipblasDeferredGemvRoutine(call.routine))
+    {
+        x_length = call.trans == HIPBLAS_OP_N ? call.n : call.m;
+        y_length = call.trans == HIPBLAS_OP_N ? call.m : call.n;
+        entry.A_range
+            = hipblasDeferredRange(call.A, size_t(call.lda) * (call.n - 1) + call.m, size);
+    }
+    entry.x_range = hipblasDeferredRange(call.x, (x_length - 1) * std::abs(call.incx) + 1, size);
+    entry.y_range = hipblasDeferredRange(call.y, (y_length - 1) * std::abs(call.incy) + 1, size);
+    return entry;
+}
+
+// Whether call may run in the same batch as the queued calls: the same arguments other than its
+// operands, and no operand of one call written by another. The rank-1 updates instead update
+// the same A, which their vectors do not overlap.
+static bool hipblasDeferredJoins(const hipblasDeferredQueue&  queue,
+                                 const hipblasDeferredCall&  call,
+                                 const hipblasDeferredEntry& entry)
+{
+    const hipblasDeferredCall& first = queue.call;
+    if(queue.entries.size() >= deferred_max_calls || call.routine != first.routine
+       || call.trans != first.trans || call.uplo != first.uplo || call.m != first.m
+       || call.n != first.n || call.lda != first.lda || call.incx != first.incx
+       || call.incy != first.incy)
+        return false;
+
+    if(queue.mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        if(hipblasDeferredScalar(call.routine, call.alpha) != queue.alpha
+           || hipblasDeferredScalar(call.routine, call.beta) != queue.beta)
+            return false;
+    }
+    else if(call.alpha != first.alpha || call.beta != first.beta)
+        return false;
+
+    if(hipblasDeferredRankRoutine(call.routine))
+    {
+        const hipblasDeferredRange& A_range = queue.entries[0].A_range;
+        return call.A == first.A && !entry.x_range.overlaps(A_range)
+               && !entry.y_range.overlaps(A_range);
+    }
+
+    for(const hipblasDeferredEntry& queued : queue.entries)
+        if(entry.y_range.overlaps(queued.A_range) || entry.y_range.overlaps(queued.x_range)
+           || entry.y_range.overlaps(queued.y_range) || entry.A_range.overlaps(queued.y_range)
+           || entry.x_range.overlaps(queued.y_range))
+            return false;
+    return true;
+}
+
+static hipblasStatus_t hipblasDeferredRunOne(hipblasHandle_t             handle,
+                                             const hipblasDeferredCall&  call,
+                                             const void*                 alpha,
+                                             const void*                 beta,
+                                             const hipblasDeferredEntry& entry)
+{
+    switch(call.routine)
+    {
+    case hipblas_deferred_sgemv:
+        return hipblasSgemv(handle,
+                            call.trans,
+                            call.m,
+                            call.n,
+                            (const float*)alpha,
+                            (const float*)entry.A,
+                            call.lda,
+                            (const float*)entry.x,
+                            call.incx,
+                            (const float*)beta,
+                            (float*)entry.y,
+                            call.incy);
+    case hipblas_deferred_dgemv:
+        return hipblasDgemv(handle,
+                            call.trans,
+                            call.m,
+                            call.n,
+                            (const double*)alpha,
+                            (const double*)entry.A,
+                            call.lda,
+                            (const double*)entry.x,
+                            call.incx,
+                            (const double*)beta,
+                            (double*)entry.y,
+                            call.incy);
+    case hipblas_deferred_saxpy:
+        return hipblasSaxpy(handle,
+                            call.n,
+                            (const float*)alpha,
+                            (const float*)entry.x,
+                            call.incx,
+                            (float*)entry.y,
+                            call.incy);
+    case hipblas_deferred_daxpy:
+        return hipblasDaxpy(handle,
+                            call.n,
+                            (const double*)alpha,
+                            (const double*)entry.x,
+                            call.incx,
+                            (double*)entry.y,
+                            call.incy);
+    case hipblas_deferred_sger:
+        return hipblasSger(handle,
+                           call.m,
+                           call.n,
+                           (const float*)alpha,
+                           (const float*)entry.x,
+                           call.incx,
+                           (const float*)entry.y,
+                           call.incy,
+                           (float*)entry.A,
+                           call.lda);
+    case hipblas_deferred_dger:
+        return hipblasDger(handle,
+                           call.m,
+                           call.n,
+                           (const double*)alpha,
+                           (const double*)entry.x,
+                           call.incx,
+                           (const double*)entry.y,
+                           call.incy,
+                           (double*)entry.A,
+                           call.lda);
+    case hipblas_deferred_ssyr:
+        return hipblasSsyr(handle,
+                           call.uplo,
+                           call.n,
+                           (const float*)alpha,
+                           (const float*)entry.x,
+                           call.incx,
+                           (float*)entry.A,
+                           call.lda);
+    case hipblas_deferred_dsyr:
+        return hipblasDsyr(handle,
+                           call.uplo,
+                           call.n,
+                           (const double*)alpha,
+                           (const double*)entry.x,
+                           call.incx,
+                           (double*)entry.A,
+                           call.lda);
+    case hipblas_deferred_cher:
+        return hipblasCher(handle,
+                           call.uplo,
+                           call.n,
+                           (const float*)alpha,
+                           (const hipblasComplex*)entry.x,
+                           call.incx,
+                           (hipblasComplex*)entry.A,
+                           call.lda);
+    case hipblas_deferred_zher:
+        return hipblasZher(handle,
+                           call.uplo,
+                           call.n,
+                           (const double*)alpha,
+                           (const hipblasDoubleComplex*)entry.x,
+                           call.incx,
+                           (hipblasDoubleComplex*)entry.A,
+                           call.lda);
+    }
+    return HIPBLAS_STATUS_INTERNAL_ERROR;
+}
+
+// Runs the batch with device arrays of the A, x and y pointers
+static hipblasStatus_t hipblasDeferredRunBatched(hipblasHandle_t            handle,
+                                                 const hipblasDeferredCall& call,
+                                                 const void*                alpha,
+                                                 const void*                beta,
+                                                 void* const*               A,
+                                                 void* const*               x,
+                                                 void* const*               y,
+                                                 int                        count)
+{
+    switch(call.routine)
+    {
+    case hipblas_deferred_sgemv:
+        return hipblasSgemvBatched(handle,
+                                   call.trans,
+                                   call.m,
+                                   call.n,
+                                   (const float*)alpha,
+                                   (const float* const*)A,
+                                   call.lda,
+                                   (const float* const*)x,
+                                   call.incx,
+                                   (const float*)beta,
+                                   (float* const*)y,
+                                   call.incy,
+                                   count);
+    case hipblas_deferred_dgemv:
+        return hipblasDgemvBatched(handle,
+                                   call.trans,
+                                   call.m,
+                                   call.n,
+                                   (const double*)alpha,
+                                   (const double* const*)A,
+                                   call.lda,
+                                   (const double* const*)x,
+                                   call.incx,
+                                   (const double*)beta,
+                                   (double* const*)y,
+                                   call.incy,
+                                   count);
+    case hipblas_deferred_saxpy:
+        return hipblasSaxpyBatched(handle,
+                                   call.n,
+                                   (const float*)alpha,
+                                   (const float* const*)x,
+                                   call.incx,
+                                   (float* const*)y,
+                                   call.incy,
+                                   count);
+    case hipblas_deferred_daxpy:
+        return hipblasDaxpyBatched(handle,
+                                   call.n,
+                                   (const double*)alpha,
+                                   (const double* const*)x,
+                                   call.incx,
+                                   (double* const*)y,
+                                   call.incy,
+                                   count);
+    default:
+        break;
+    }
+    return HIPBLAS_STATUS_INTERNAL_ERROR;
+}
+
+// Copies the count vectors of n elements at the device pointers in x, with increment incx, to
+// the contiguous vectors at the device pointers in y
+static hipblasStatus_t hipblasDeferredCopyBatched(hipblasHandle_t        handle,
+                                                  hipblasDeferredRoutine routine,
+                                                  int                    n,
+                                                  void* const*           x,
+                                                  int                    incx,
+                                                  void* const*           y,
+                                                  int                    count)
+{
+    switch(routine)
+    {
+    case hipblas_deferred_sger:
+    case hipblas_deferred_ssyr:
+        return hipblasScopyBatched(
+            handle, n, (const float* const*)x, incx, (float* const*)y, 1, count);
+    case hipblas_deferred_dger:
+    case hipblas_deferred_dsyr:
+        return hipblasDcopyBatched(
+            handle, n, (const double* const*)x, incx, (double* const*)y, 1, count);
+    case hipblas_deferred_cher:
+        return hipblasCcopyBatched(
+            handle, n, (const hipblasComplex* const*)x, incx, (hipblasComplex* const*)y, 1, count);
+    case hipblas_deferred_zher:
+        return hipblasZcopyBatched(handle,
+                                   n,
+                                   (const hipblasDoubleComplex* const*)x,
+                                   incx,
+                                   (hipblasDoubleComplex* const*)y,
+                                   1,
+                                   count);
+    default:
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+// Adds alpha X Y^T to A with gemm for ger, or alpha X X^T and alpha X X^H to the triangle of A
+// with syrk and herk for syr and her, where the k columns of X and Y are the queued vectors
+static hipblasStatus_t hipblasDeferredRankK(hipblasHandle_t            handle,
+                                            const hipblasDeferredCall& call,
+                                            const void*                alpha,
+                                            const void*                one,
+                                            const void*                X,
+                                            const void*                Y,
+                                            int                        k)
+{
+    switch(call.routine)
+    {
+    case hipblas_deferred_sger:
+        return hipblasSgemm(handle,
+                            HIPBLAS_OP_N,
+                            HIPBLAS_OP_T,
+                            call.m,
+                            call.n,
+                            k,
+                            (const float*)alpha,
+                            (const float*)X,
+                            call.m,
+                            (const float*)Y,
+                            call.n,
+                            (const float*)one,
+                            (float*)call.A,
+                            call.lda);
+    case hipblas_deferred_dger:
+        return hipblasDgemm(handle,
+                            HIPBLAS_OP_N,
+                            HIPBLAS_OP_T,
+                            call.m,
+                            call.n,
+                            k,
+                            (const double*)alpha,
+                            (const double*)X,
+                            call.m,
+                            (const double*)Y,
+                            call.n,
+                            (const double*)one,
+                            (double*)call.A,
+                            call.lda);
+    case hipblas_deferred_ssyr:
+        return hipblasSsyrk(handle,
+                            call.uplo,
+                            HIPBLAS_OP_N,
+                            call.n,
+                            k,
+                            (const float*)alpha,
+                            (const float*)X,
+                            call.n,
+                            (const float*)one,
+                            (float*)call.A,
+                            call.lda);
+    case hipblas_deferred_dsyr:
+        return hipblasDsyrk(handle,
+                            call.uplo,
+                            HIPBLAS_OP_N,
+                            call.n,
+                            k,
+                            (const double*)alpha,
+                            (const double*)X,
+                            call.n,
+                            (const double*)one,
+                            (double*)call.A,
+                            call.lda);
+    case hipblas_deferred_cher:
+        return hipblasCherk(handle,
+                            call.uplo,
+                            HIPBLAS_OP_N,
+                            call.n,
+                            k,
+                            (const float*)alpha,
+                            (const hipblasComplex*)X,
+                            call.n,
+                            (const float*)one,
+                            (hipblasComplex*)call.A,
+                            call.lda);
+    case hipblas_deferred_zher:
+        return hipblasZherk(handle,
+                            call.uplo,
+                            HIPBLAS_OP_N,
+                            call.n,
+                            k,
+                            (const double*)alpha,
+                            (const hipblasDoubleComplex*)X,
+                            call.n,
+                            (const double*)one,
+                            (hipblasDoubleComplex*)call.A,
+                            call.lda);
+    default:
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+// Runs the queued rank-1 updates of A as one rank-k update. The vectors are gathered into the
+// columns of X and Y in stream-ordered device memory by one batched copy each, from pointer
+// arrays that follow a one for the beta of A in device pointer mode. All the vectors are read
+// before A is written, as the calls after the first do not read A.
+static hipblasStatus_t hipblasDeferredRunRank(hipblasHandle_t             handle,
+                                              const hipblasDeferredQueue& queue,
+                                              hipStream_t                 stream,
+                                              const void*                 alpha)
+{
+    const hipblasDeferredCall& call  = queue.call;
+    const int                  count = int(queue.entries.size());
+    const int                  pairs = hipblasDeferredGerRoutine(call.routine) ? 2 : 1;
+    const size_t               size  = hipblasDeferredElementSize(call.routine);
+
+    // The one, then the source and destination pointers of the x and y copies, then X and Y
+    const size_t header   = 256;
+    const size_t uploaded = header + sizeof(void*) * 2 * pairs * count;
+    const size_t x_offset = (uploaded + 255) / 256 * 256;
+    const size_t x_bytes  = size * call.m * count;
+    const size_t bytes    = x_offset + x_bytes + (pairs == 2 ? size * call.n * count : 0);
+
+    char* device = nullptr;
+    if(hipMallocAsync((void**)&device, bytes, stream) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    const float  float_one  = 1;
+    const double double_one = 1;
+    const bool   real_float = hipblasDeferredScalarSize(call.routine) == sizeof(float);
+    const void*  host_one   = real_float ? (const void*)&float_one : (const void*)&double_one;
+
+    char*             X = device + x_offset;
+    char*             Y = X + x_bytes;
+    std::vector<char> host(uploaded);
+    std::memcpy(host.data(), host_one, real_float ? sizeof(float) : sizeof(double));
+
+    void** pointers = reinterpret_cast<void**>(host.data() + header);
+    for(int i = 0; i < count; i++)
+    {
+        pointers[i]         = const_cast<void*>(queue.entries[i].x);
+        pointers[count + i] = X + size * call.m * i;
+        if(pairs == 2)
+        {
+            pointers[2 * count + i] = queue.entries[i].y;
+            pointers[3 * count + i] = Y + size * call.n * i;
+        }
+    }
+
+    const void*     one             = queue.mode == HIPBLAS_POINTER_MODE_HOST ? host_one : device;
+    void**          device_pointers = reinterpret_cast<void**>(device + header);
+    hipblasStatus_t status          = HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(hipMemcpyAsync(device, host.data(), uploaded, hipMemcpyHostToDevice, stream) == hipSuccess)
+    {
+        status = hipblasDeferredCopyBatched(handle,
+                                            call.routine,
+                                            call.m,
+                                            device_pointers,
+                                            call.incx,
+                                            device_pointers + count,
+                                            count);
+        if(status == HIPBLAS_STATUS_SUCCESS && pairs == 2)
+            status = hipblasDeferredCopyBatched(handle,
+                                                call.routine,
+                                                call.n,
+                                                device_pointers + 2 * count,
+                                                call.incy,
+                                                device_pointers + 3 * count,
+                                                count);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDeferredRankK(handle, call, alpha, one, X, Y, count);
+    }
+    else
+        (void)hipGetLastError();
+    (void)hipFreeAsync(device, stream);
+    return status;
+}
+
+// Runs the queued calls as one batched call or rank-k update, or one by one while the stream is
+// being captured, as the pointer arrays are copied from host memory, or when the backend has no
+// batched routine
+static hipblasStatus_t hipblasDeferredRun(hipblasHandle_t handle, const hipblasDeferredQueue& queue)
+{
+    // The queued calls are column-major already
+    hipblasLayoutScope layout_scope(nullptr);
+
+    const hipblasDeferredCall& call  = queue.call;
+    const void*                alpha = call.alpha;
+    const void*                beta  = call.beta;
+    float                      host_scalars_s[2];
+    double                     host_scalars_d[2];
+    if(queue.mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        host_scalars_s[0] = float(queue.alpha);
+        host_scalars_s[1] = float(queue.beta);
+        host_scalars_d[0] = queue.alpha;
+        host_scalars_d[1] = queue.beta;
+        if(hipblasDeferredScalarSize(call.routine) == sizeof(float))
+        {
+            alpha = host_scalars_s;
+            beta  = host_scalars_s + 1;
+        }
+        else
+        {
+            alpha = host_scalars_d;
+            beta  = host_scalars_d + 1;
+        }
+    }
+
+    size_t                 count = queue.entries.size();
+    hipStream_t            stream;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    bool                   batched
+        = count > 1 && hipblasGetStream(handle, &stream) == HIPBLAS_STATUS_SUCCESS
+          && hipStreamIsCapturing(stream, &capture_status) == hipSuccess
+          && capture_status == hipStreamCaptureStatusNone;
+    if(batched && hipblasDeferredRankRoutine(call.routine))
+    {
+        hipblasStatus_t status = hipblasDeferredRunRank(handle, queue, stream, alpha);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+            return status;
+    }
+    else if(batched)
+    {
+        std::vector<const void*> pointers(3 * count);
+        for(size_t i = 0; i < count; i++)
+        {
+            pointers[i]             = queue.entries[i].A;
+            pointers[count + i]     = queue.entries[i].x;
+            pointers[2 * count + i] = queue.entries[i].y;
+        }
+
+        void** device = nullptr;
+        size_t bytes  = sizeof(void*) * pointers.size();
+        if(hipMallocAsync((void**)&device, bytes, stream) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            device = nullptr;
+        }
+        if(device)
+        {
+            hipblasStatus_t status = HIPBLAS_STATUS_INTERNAL_ERROR;
+            if(hipMemcpyAsync(device, pointers.data(), bytes, hipMemcpyHostToDevice, stream)
+               == hipSuccess)
+                status = hipblasDeferredRunBatched(handle,
+                                                   call,
+                                                   alpha,
+                                                   beta,
+                                                   device,
+                                                   device + count,
+                                                   device + 2 * count,
+                                                   int(count));
+            else
+                (void)hipGetLastError();
+            (void)hipFreeAsync(device, stream);
+            if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+                return status;
+        }
+    }
+
+    for(const hipblasDeferredEntry& entry : queue.entries)
+    {
+        hipblasStatus_t status = hipblasDeferredRunOne(handle, call, alpha, beta, entry);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+static void hipblasDeferredRunQueue(hipblasHandle_t handle, hipblasDeferredQueue& queue)
+{
+    if(queue.entries.empty())
+        return;
+
+    hipblasStatus_t status;
+    try
+    {
+        status = hipblasDeferredRun(handle, queue);
+    }
+    catch(...)
+    {
+        status = exception_to_hipblas_status();
+    }
+    queue.entries.clear();
+    if(queue.error == HIPBLAS_STATUS_SUCCESS)
+        queue.error = status;
+}
+
+// The descriptor of call for the persistent kernel, when it is small enough and has arguments
+// the backend would accept, so that errors are still reported by the call itself
+static bool hipblasDeferredPersistentOp(const hipblasDeferredCall& call, hipblasPersistentOp& op)
+{
+    auto valid_op = [](hipblasOperation_t trans) {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    };
+
+    op           = {};
+    op.is_double = hipblasDeferredScalarSize(call.routine) == sizeof(double);
+    op.transA    = call.trans == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    op.transB    = call.transB == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    op.m         = call.m;
+    op.n         = call.n;
+    op.k         = call.k;
+    op.lda       = call.lda;
+    op.ldb       = call.incx;
+    op.ldc       = call.incy;
+    op.A         = call.A;
+    op.B         = call.x;
+    op.C         = call.y;
+
+    switch(call.routine)
+    {
+    case hipblas_deferred_sgemm:
+    case hipblas_deferred_dgemm:
+        op.routine = hipblas_persistent_gemm;
+        return call.m > 0 && call.n > 0 && call.k > 0 && call.m <= hipblas_persistent_max_gemm
+               && call.n <= hipblas_persistent_max_gemm && call.k <= hipblas_persistent_max_gemm
+               && valid_op(call.trans) && valid_op(call.transB)
+               && call.lda >= (call.trans == HIPBLAS_OP_N ? call.m : call.k)
+               && call.incx >= (call.transB == HIPBLAS_OP_N ? call.k : call.n)
+               && call.incy >= call.m && call.alpha && call.beta && call.A && call.x && call.y;
+    case hipblas_deferred_sgemv:
+    case hipblas_deferred_dgemv:
+        op.routine = hipblas_persistent_gemv;
+        return call.m > 0 && call.n > 0 && call.m <= hipblas_persistent_max_gemv
+               && call.n <= hipblas_persistent_max_gemv && valid_op(call.trans)
+               && call.lda >= call.m && call.incx != 0 && call.incy != 0 && call.alpha
+               && call.beta && call.A && call.x && call.y;
+    case hipblas_deferred_saxpy:
+    case hipblas_deferred_daxpy:
+        op.routine = hipblas_persistent_axpy;
+        return call.n > 0 && call.n <= hipblas_persistent_max_axpy && call.incx != 0
+               && call.incy != 0 && call.alpha && call.x && call.y;
+    case hipblas_deferred_strsv:
+    case hipblas_deferred_dtrsv:
+        op.routine   = hipblas_persistent_trsv;
+        op.lower     = call.uplo == HIPBLAS_FILL_MODE_LOWER;
+        op.unit_diag = call.diag == HIPBLAS_DIAG_UNIT;
+        return call.m > 0 && call.m <= hipblas_persistent_max_trsv && valid_op(call.trans)
+               && (call.uplo == HIPBLAS_FILL_MODE_LOWER || call.uplo == HIPBLAS_FILL_MODE_UPPER)
+               && (call.diag == HIPBLAS_DIAG_UNIT || call.diag == HIPBLAS_DIAG_NON_UNIT)
+               && call.lda >= call.m && call.incy != 0 && call.A && call.y;
+    default:
+        return false;
+    }
+}
+
+// Waits for the calls posted to the persistent kernel, keeping an error for hipblasFlush
+static void hipblasDeferredDrain(hipblasDeferredQueue& queue)
+{
+    hipblasStatus_t status = hipblasPersistentDrain(queue.persistent);
+    if(queue.error == HIPBLAS_STATUS_SUCCESS)
+        queue.error = status;
+}
+
+// Posts call to the persistent kernel, or waits for the posted calls when call must run on the
+// stream after them: when it is too large, has invalid arguments, or the stream is being captured
+static bool hipblasDeferredPost(hipblasHandle_t            handle,
+                                hipblasDeferredQueue&      queue,
+                                const hipblasDeferredCall& call)
+{
+    hipblasPersistentOp    op;
+    hipStream_t            stream;
+    hipblasPointerMode_t   mode;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipblasDeferredPersistentOp(call, op)
+       && hipblasGetStream(handle, &stream) == HIPBLAS_STATUS_SUCCESS
+       && hipblasGetPointerMode(handle, &mode) == HIPBLAS_STATUS_SUCCESS
+       && hipStreamIsCapturing(stream, &capture_status) == hipSuccess
+       && capture_status == hipStreamCaptureStatusNone)
+    {
+        if(mode == HIPBLAS_POINTER_MODE_HOST)
+        {
+            op.alpha = hipblasDeferredScalar(call.routine, call.alpha);
+            op.beta  = hipblasDeferredScalar(call.routine, call.beta);
+        }
+        else
+        {
+            op.alpha_device = call.alpha;
+            op.beta_device  = call.beta;
+        }
+        if(hipblasPersistentPost(queue.persistent, stream, op) == HIPBLAS_STATUS_SUCCESS)
+            return true;
+    }
+    (void)hipGetLastError();
+    hipblasDeferredDrain(queue);
+    return false;
+}
+
+void hipblasDeferredFlush(hipblasHandle_t handle)
+{
+    // Called from the constructor of hipblasDeferredScope, which must not throw
+    try
+    {
+        hipblasDeferredQueue* queue = hipblasDeferredFind(handle);
+        if(queue && queue->persistent)
+            hipblasDeferredDrain(*queue);
+        else if(queue)
+            hipblasDeferredRunQueue(handle, *queue);
+    }
+    catch(...)
+    {
+    }
+}
+
+bool hipblasDeferredEnqueue(hipblasHandle_t handle, const hipblasDeferredCall& call)
+{
+    hipblasDeferredQueue* queue = hipblasDeferredFind(handle);
+    if(!queue)
+        return false;
+    if(queue->persistent)
+        return hipblasDeferredPost(handle, *queue, call);
+
+    if(!hipblasDeferredValid(call))
+    {
+        hipblasDeferredRunQueue(handle, *queue);
+        return false;
+    }
+
+    hipblasDeferredEntry entry = hipblasDeferredMakeEntry(call);
+    if(!queue->entries.empty() && hipblasDeferredJoins(*queue, call, entry))
+    {
+        queue->entries.push_back(entry);
+        return true;
+    }
+
+    hipblasDeferredRunQueue(handle, *queue);
+    if(hipblasGetPointerMode(handle, &queue->mode) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+    queue->call  = call;
+    queue->alpha = 0;
+    queue->beta  = 0;
+    if(queue->mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        queue->alpha = hipblasDeferredScalar(call.routine, call.alpha);
+        queue->beta  = hipblasDeferredScalar(call.routine, call.beta);
+    }
+    queue->entries.push_back(entry);
+    return true;
+}
+
+void hipblasDeferredErase(hipblasHandle_t handle)
+{
+    if(!hipblas_deferred_handles.load(std::memory_order_relaxed))
+        return;
+
+    std::lock_guard<std::mutex> lock(deferred_mutex);
+    hipblas_deferred_handles -= int(deferred_queues.erase(handle));
+}
+
+// Takes the first error of the calls run from the queue of handle since it was last taken
+static hipblasStatus_t hipblasDeferredError(hipblasHandle_t handle)
+{
+    hipblasDeferredQueue* queue = hipblasDeferredFind(handle);
+    if(!queue)
+        return HIPBLAS_STATUS_SUCCESS;
+    hipblasStatus_t error = queue->error;
+    queue->error          = HIPBLAS_STATUS_SUCCESS;
+    return error;
+}
+
+extern "C" hipblasStatus_t hipblasSetDeferredMode(hipblasHandle_t       handle,
+                                                  hipblasDeferredMode_t mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_DEFERRED_MODE_OFF && mode != HIPBLAS_DEFERRED_MODE_ON
+       && mode != HIPBLAS_DEFERRED_MODE_PERSISTENT)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    // The persistent kernel runs the posted calls after the work enqueued on this stream
+    hipStream_t stream = nullptr;
+    if(mode == HIPBLAS_DEFERRED_MODE_PERSISTENT)
+    {
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    // The queue ran, or the posted calls did, on entry
+    hipblasStatus_t             error = hipblasDeferredError(handle);
+    std::lock_guard<std::mutex> lock(deferred_mutex);
+    if(mode == HIPBLAS_DEFERRED_MODE_OFF)
+    {
+        hipblas_deferred_handles -= int(deferred_queues.erase(handle));
+        return error;
+    }
+
+    auto& queue = deferred_queues[handle];
+    bool  added = !queue;
+    if(added)
+    {
+        queue = std::make_unique<hipblasDeferredQueue>();
+        hipblas_deferred_handles++;
+    }
+    if(mode == HIPBLAS_DEFERRED_MODE_PERSISTENT && !queue->persistent)
+    {
+        hipblasStatus_t status = hipblasPersistentCreate(stream, &queue->persistent);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            // The handle stays in the mode it was in
+            if(added)
+                hipblas_deferred_handles -= int(deferred_queues.erase(handle));
+            return status;
+        }
+    }
+    else if(mode == HIPBLAS_DEFERRED_MODE_ON && queue->persistent)
+    {
+        hipblasPersistentDestroy(queue->persistent);
+        queue->persistent = nullptr;
+    }
+    return error;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetDeferredMode(hipblasHandle_t        handle,
+                                                  hipblasDeferredMode_t* mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasDeferredQueue* queue = hipblasDeferredFind(handle);
+    *mode                       = !queue               ? HIPBLAS_DEFERRED_MODE_OFF
+                                  : queue->persistent ? HIPBLAS_DEFERRED_MODE_PERSISTENT
+                                                      : HIPBLAS_DEFERRED_MODE_ON;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasFlush(hipblasHandle_t handle)
+try
+{
+    // The queue ran on entry
+    HIPBLAS_LAYER_HANDLE(handle);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    return hipblasDeferredError(handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
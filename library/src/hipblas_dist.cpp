@@ -0,0 +1,876 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "pointer_mode.hpp"
+#include "stream_pool.hpp"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#ifdef HIPBLAS_RCCL
+#ifdef __HIP_PLATFORM_NVCC__
+#include <nccl.h>
+#else
+#include <rccl/rccl.h>
+#endif
+#endif
+
+// Device buffers of a grid: two panels of A and two of B for gemm, and the diagonal block, the
+// panel of A and the block row of B for trsm. They grow to the largest call.
+static constexpr int dist_buffers = 4;
+
+// A hipblasDistGrid_t. Calls on one grid run one at a time.
+struct hipblasDistGrid
+{
+    std::mutex      mutex;
+    hipblasHandle_t handle                = nullptr;
+    int             nprow                 = 1;
+    int             npcol                 = 1;
+    int             myrow                 = 0;
+    int             mycol                 = 0;
+    hipStream_t     stream                = nullptr; // of the collectives
+    hipEvent_t      issued                = nullptr; // work on the handle stream before a call
+    hipEvent_t      received[2]           = {}; // collectives a local call waits for
+    hipEvent_t      consumed[2]           = {}; // local calls done with a buffer
+    void*           buffers[dist_buffers] = {};
+    size_t          sizes[dist_buffers]   = {};
+#ifdef HIPBLAS_RCCL
+    ncclComm_t row_comm = nullptr; // processes of the process row, ranked by process column
+    ncclComm_t col_comm = nullptr; // processes of the process column, ranked by process row
+#endif
+
+    ~hipblasDistGrid()
+    {
+        hipStream_t handle_stream = nullptr;
+        if(stream)
+            (void)hipStreamSynchronize(stream);
+        if(handle && hipblasGetStream(handle, &handle_stream) == HIPBLAS_STATUS_SUCCESS)
+            (void)hipStreamSynchronize(handle_stream);
+
+        for(void* buffer : buffers)
+        {
+            if(buffer)
+                (void)hipFree(buffer);
+        }
+        for(hipEvent_t event : {issued, received[0], received[1], consumed[0], consumed[1]})
+        {
+            if(event)
+                (void)hipEventDestroy(event);
+        }
+        if(stream)
+            (void)hipStreamDestroy(stream);
+#ifdef HIPBLAS_RCCL
+        if(row_comm)
+            (void)ncclCommDestroy(row_comm);
+        if(col_comm)
+            (void)ncclCommDestroy(col_comm);
+#endif
+    }
+};
+
+// Rows (or columns) of the local matrix of process iproc of nprocs for a dimension of n split
+// into blocks of nb, as NUMROC of ScaLAPACK
+static int64_t hipblasDistNumroc(int64_t n, int64_t nb, int iproc, int nprocs)
+{
+    int64_t blocks = n / nb;
+    int64_t local  = blocks / nprocs * nb;
+    int64_t extra  = blocks % nprocs;
+    if(iproc < extra)
+        local += nb;
+    else if(iproc == extra)
+        local += n % nb;
+    return local;
+}
+
+// Local sizes of desc on the calling process, false if desc is invalid or they do not fit in an int
+static bool hipblasDistLocal(const hipblasDistGrid*         grid,
+                             const hipblasDistMatrixDesc_t* desc,
+                             int64_t&                       rows,
+                             int64_t&                       cols)
+{
+    if(!desc || desc->m < 0 || desc->n < 0 || desc->nb < 1)
+        return false;
+
+    rows = hipblasDistNumroc(desc->m, desc->nb, grid->myrow, grid->nprow);
+    cols = hipblasDistNumroc(desc->n, desc->nb, grid->mycol, grid->npcol);
+    return desc->ld >= std::max<int64_t>(1, rows) && desc->ld <= INT_MAX && cols <= INT_MAX;
+}
+
+#ifdef HIPBLAS_RCCL
+
+static bool hipblasDistIsZero(float x)
+{
+    return x == 0;
+}
+
+static bool hipblasDistIsZero(double x)
+{
+    return x == 0;
+}
+
+static bool hipblasDistIsZero(const hipblasComplex& x)
+{
+    return x.real() == 0 && x.imag() == 0;
+}
+
+static bool hipblasDistIsZero(const hipblasDoubleComplex& x)
+{
+    return x.real() == 0 && x.imag() == 0;
+}
+
+// The local calls go through the hipBLAS functions of each precision, and complex panels are
+// broadcast as twice as many reals
+template <typename T>
+struct hipblasDistTraits;
+
+template <>
+struct hipblasDistTraits<float>
+{
+    static constexpr auto           gemm  = hipblasSgemm;
+    static constexpr auto           trsm  = hipblasStrsm;
+    static constexpr ncclDataType_t type  = ncclFloat;
+    static constexpr size_t         reals = 1;
+};
+
+template <>
+struct hipblasDistTraits<double>
+{
+    static constexpr auto           gemm  = hipblasDgemm;
+    static constexpr auto           trsm  = hipblasDtrsm;
+    static constexpr ncclDataType_t type  = ncclDouble;
+    static constexpr size_t         reals = 1;
+};
+
+template <>
+struct hipblasDistTraits<hipblasComplex>
+{
+    static constexpr auto           gemm  = hipblasCgemm;
+    static constexpr auto           trsm  = hipblasCtrsm;
+    static constexpr ncclDataType_t type  = ncclFloat;
+    static constexpr size_t         reals = 2;
+};
+
+template <>
+struct hipblasDistTraits<hipblasDoubleComplex>
+{
+    static constexpr auto           gemm  = hipblasZgemm;
+    static constexpr auto           trsm  = hipblasZtrsm;
+    static constexpr ncclDataType_t type  = ncclDouble;
+    static constexpr size_t         reals = 2;
+};
+
+static hipblasStatus_t hipblasDistStatus(hipError_t status)
+{
+    if(status == hipSuccess)
+        return HIPBLAS_STATUS_SUCCESS;
+    (void)hipGetLastError();
+    return HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+static hipblasStatus_t hipblasDistStatus(ncclResult_t status)
+{
+    return status == ncclSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
+
+// Grow buffer index of grid to size bytes. A buffer is only replaced once the work of the
+// previous calls using it completed.
+static hipblasStatus_t
+    hipblasDistReserve(hipblasDistGrid* grid, hipStream_t handle_stream, int index, size_t size)
+{
+    if(grid->sizes[index] >= size)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(grid->buffers[index])
+    {
+        if(hipStreamSynchronize(grid->stream) != hipSuccess
+           || hipStreamSynchronize(handle_stream) != hipSuccess)
+            return hipblasDistStatus(hipErrorUnknown);
+        (void)hipFree(grid->buffers[index]);
+    }
+    grid->buffers[index] = nullptr;
+    grid->sizes[index]   = 0;
+    if(hipMalloc(&grid->buffers[index], size) != hipSuccess)
+    {
+        grid->buffers[index] = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    grid->sizes[index] = size;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Copy the rows x cols block at src to dst on the device, ordered on stream
+template <typename T>
+static hipblasStatus_t hipblasDistCopy(T*          dst,
+                                       size_t      ld_dst,
+                                       const T*    src,
+                                       size_t      ld_src,
+                                       size_t      rows,
+                                       size_t      cols,
+                                       hipStream_t stream)
+{
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+    return hipblasDistStatus(hipMemcpy2DAsync(dst,
+                                              ld_dst * sizeof(T),
+                                              src,
+                                              ld_src * sizeof(T),
+                                              rows * sizeof(T),
+                                              cols,
+                                              hipMemcpyDeviceToDevice,
+                                              stream));
+}
+
+// Broadcast the count elements at buffer from rank root of comm, in place, on stream
+template <typename T>
+static hipblasStatus_t
+    hipblasDistBroadcast(T* buffer, size_t count, int root, ncclComm_t comm, hipStream_t stream)
+{
+    return hipblasDistStatus(ncclBroadcast(buffer,
+                                           buffer,
+                                           count * hipblasDistTraits<T>::reals,
+                                           hipblasDistTraits<T>::type,
+                                           root,
+                                           comm,
+                                           stream));
+}
+
+// Make waiter wait for the work enqueued so far on signaler
+static hipblasStatus_t hipblasDistWait(hipStream_t waiter, hipEvent_t event, hipStream_t signaler)
+{
+    hipError_t status = hipEventRecord(event, signaler);
+    if(status == hipSuccess)
+        status = hipStreamWaitEvent(waiter, event, 0);
+    return hipblasDistStatus(status);
+}
+
+// Handle stream and host pointer mode of a call on grid, with the collective stream waiting for
+// the work already enqueued on the handle stream
+static hipblasStatus_t hipblasDistBegin(hipblasDistGrid*                          grid,
+                                        hipStream_t&                              stream,
+                                        std::unique_ptr<hipblasPointerModeGuard>& restore)
+{
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(grid->handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(grid->handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    restore.reset(new hipblasPointerModeGuard{grid->handle, mode});
+    status = hipblasSetPointerMode(grid->handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasDistWait(grid->stream, grid->issued, stream);
+}
+
+// C = alpha A B + beta C by SUMMA. Step l broadcasts block column l of A along the process rows
+// and block row l of B along the process columns into the buffers of slot l % 2, and adds their
+// product to the local C. The collective stream only reuses a slot once the gemm of the step
+// before last consumed it, so the broadcasts of step l + 1 overlap the gemm of step l.
+template <typename T>
+static hipblasStatus_t hipblasDistGemm(hipblasDistGrid_t              grid,
+                                       const T*                       alpha,
+                                       const T*                       A,
+                                       const hipblasDistMatrixDesc_t* descA,
+                                       const T*                       B,
+                                       const hipblasDistMatrixDesc_t* descB,
+                                       const T*                       beta,
+                                       T*                             C,
+                                       const hipblasDistMatrixDesc_t* descC)
+{
+    if(!grid)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    int64_t a_rows, a_cols, b_rows, b_cols, c_rows, c_cols;
+    if(!hipblasDistLocal(grid, descA, a_rows, a_cols)
+       || !hipblasDistLocal(grid, descB, b_rows, b_cols)
+       || !hipblasDistLocal(grid, descC, c_rows, c_cols))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(descA->nb != descC->nb || descB->nb != descC->nb || descA->m != descC->m
+       || descB->n != descC->n || descA->n != descB->m)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!descC->m || !descC->n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || (c_rows && c_cols && !C) || (a_rows && a_cols && !A)
+       || (b_rows && b_cols && !B))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(grid->mutex);
+
+    hipStream_t                              stream;
+    std::unique_ptr<hipblasPointerModeGuard> restore;
+    hipblasStatus_t                          status = hipblasDistBegin(grid, stream, restore);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // With alpha == 0 only C is scaled
+    int64_t nb       = descC->nb;
+    int64_t k        = hipblasDistIsZero(*alpha) ? 0 : descA->n;
+    int64_t k_blocks = (k + nb - 1) / nb;
+    int     ldc      = int(descC->ld);
+    const T one(1);
+
+    if(!k_blocks)
+    {
+        if(!c_rows || !c_cols)
+            return HIPBLAS_STATUS_SUCCESS;
+        return hipblasDistTraits<T>::gemm(grid->handle,
+                                          HIPBLAS_OP_N,
+                                          HIPBLAS_OP_N,
+                                          int(c_rows),
+                                          int(c_cols),
+                                          0,
+                                          alpha,
+                                          C,
+                                          ldc,
+                                          C,
+                                          ldc,
+                                          beta,
+                                          C,
+                                          ldc);
+    }
+
+    size_t a_size = size_t(std::max<int64_t>(1, c_rows)) * nb * sizeof(T);
+    size_t b_size = size_t(nb) * std::max<int64_t>(1, c_cols) * sizeof(T);
+    for(int slot = 0; status == HIPBLAS_STATUS_SUCCESS && slot < 2; slot++)
+    {
+        status = hipblasDistReserve(grid, stream, slot, a_size);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistReserve(grid, stream, 2 + slot, b_size);
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    for(int64_t l = 0; l < k_blocks; l++)
+    {
+        int     slot    = int(l % 2);
+        int64_t w       = std::min(nb, k - l * nb);
+        int     pc      = int(l % grid->npcol);
+        int     pr      = int(l % grid->nprow);
+        T*      a_panel = static_cast<T*>(grid->buffers[slot]);
+        T*      b_panel = static_cast<T*>(grid->buffers[2 + slot]);
+
+        if(l >= 2)
+            status = hipblasDistStatus(hipStreamWaitEvent(grid->stream, grid->consumed[slot], 0));
+        if(status == HIPBLAS_STATUS_SUCCESS && grid->mycol == pc)
+            status = hipblasDistCopy(a_panel,
+                                     c_rows,
+                                     A + l / grid->npcol * nb * descA->ld,
+                                     descA->ld,
+                                     c_rows,
+                                     w,
+                                     grid->stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && grid->myrow == pr)
+            status = hipblasDistCopy(
+                b_panel, w, B + l / grid->nprow * nb, descB->ld, w, c_cols, grid->stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        status = hipblasDistStatus(ncclGroupStart());
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistBroadcast(a_panel, c_rows * w, pc, grid->row_comm, grid->stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistBroadcast(b_panel, w * c_cols, pr, grid->col_comm, grid->stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistStatus(ncclGroupEnd());
+        else
+            (void)ncclGroupEnd();
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistWait(stream, grid->received[slot], grid->stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && c_rows && c_cols)
+            status = hipblasDistTraits<T>::gemm(grid->handle,
+                                                HIPBLAS_OP_N,
+                                                HIPBLAS_OP_N,
+                                                int(c_rows),
+                                                int(c_cols),
+                                                int(w),
+                                                alpha,
+                                                a_panel,
+                                                int(std::max<int64_t>(1, c_rows)),
+                                                b_panel,
+                                                int(w),
+                                                l ? &one : beta,
+                                                C,
+                                                ldc);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistStatus(hipEventRecord(grid->consumed[slot], stream));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// A X = alpha B by blocked substitution over the block rows i of B, forward for lower A and
+// backward for upper A. Step s broadcasts the diagonal block of A along process row i mod nprow,
+// which solves its part of block row i, then broadcasts the solved block row along the process
+// columns. Meanwhile the block column of A below or above the diagonal is broadcast along the
+// process rows, and every process subtracts its product with the solved block row from its
+// remaining rows of B. The first step also scales the remaining rows by alpha.
+template <typename T>
+static hipblasStatus_t hipblasDistTrsm(hipblasDistGrid_t              grid,
+                                       hipblasFillMode_t              uplo,
+                                       hipblasDiagType_t              diag,
+                                       const T*                       alpha,
+                                       const T*                       A,
+                                       const hipblasDistMatrixDesc_t* descA,
+                                       T*                             B,
+                                       const hipblasDistMatrixDesc_t* descB)
+{
+    if(!grid)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPBLAS_FILL_MODE_LOWER && uplo != HIPBLAS_FILL_MODE_UPPER)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int64_t a_rows, a_cols, b_rows, b_cols;
+    if(!hipblasDistLocal(grid, descA, a_rows, a_cols)
+       || !hipblasDistLocal(grid, descB, b_rows, b_cols))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(descA->nb != descB->nb || descA->m != descA->n || descA->m != descB->m)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!descB->m || !descB->n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || (a_rows && a_cols && !A) || (b_rows && b_cols && !B))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(grid->mutex);
+
+    hipStream_t                              stream;
+    std::unique_ptr<hipblasPointerModeGuard> restore;
+    hipblasStatus_t                          status = hipblasDistBegin(grid, stream, restore);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int64_t m      = descB->m;
+    int64_t nb     = descB->nb;
+    int64_t blocks = (m + nb - 1) / nb;
+    bool    lower  = uplo == HIPBLAS_FILL_MODE_LOWER;
+    int     ldb    = int(descB->ld);
+    const T one(1);
+    const T minus_one(-1);
+
+    status = hipblasDistReserve(grid, stream, 0, size_t(nb) * nb * sizeof(T));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasDistReserve(
+            grid, stream, 1, size_t(std::max<int64_t>(1, a_rows)) * nb * sizeof(T));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasDistReserve(
+            grid, stream, 2, size_t(nb) * std::max<int64_t>(1, b_cols) * sizeof(T));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    T* diagonal = static_cast<T*>(grid->buffers[0]);
+    T* panel    = static_cast<T*>(grid->buffers[1]);
+    T* solved   = static_cast<T*>(grid->buffers[2]);
+
+    for(int64_t s = 0; s < blocks; s++)
+    {
+        int64_t  i          = lower ? s : blocks - 1 - s;
+        int64_t  w          = std::min(nb, m - i * nb);
+        int      pr         = int(i % grid->nprow);
+        int      pc         = int(i % grid->npcol);
+        int64_t  row        = i / grid->nprow * nb; // local row of block row i on process row pr
+        int64_t  col        = i / grid->npcol * nb; // local column of block column i on pc
+        const T* step_alpha = s ? &one : alpha;
+
+        // Local rows of the blocks after (lower) or before (upper) block i
+        int64_t first = lower ? hipblasDistNumroc((i + 1) * nb, nb, grid->myrow, grid->nprow) : 0;
+        int64_t rows  = lower ? b_rows - first
+                              : hipblasDistNumroc(i * nb, nb, grid->myrow, grid->nprow);
+
+        if(s)
+            status = hipblasDistStatus(hipStreamWaitEvent(grid->stream, grid->consumed[1], 0));
+
+        // The diagonal block, to the process row solving block row i
+        if(status == HIPBLAS_STATUS_SUCCESS && grid->myrow == pr)
+        {
+            if(grid->mycol == pc)
+                status = hipblasDistCopy(
+                    diagonal, w, A + row + col * descA->ld, descA->ld, w, w, grid->stream);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasDistBroadcast(diagonal, w * w, pc, grid->row_comm, grid->stream);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistStatus(hipEventRecord(grid->received[0], grid->stream));
+
+        // The block column of A, broadcast while block row i is solved
+        if(status == HIPBLAS_STATUS_SUCCESS && grid->mycol == pc)
+            status = hipblasDistCopy(panel,
+                                     std::max<int64_t>(1, rows),
+                                     A + first + col * descA->ld,
+                                     descA->ld,
+                                     rows,
+                                     w,
+                                     grid->stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistBroadcast(panel, rows * w, pc, grid->row_comm, grid->stream);
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistStatus(hipStreamWaitEvent(stream, grid->received[0], 0));
+        if(status == HIPBLAS_STATUS_SUCCESS && grid->myrow == pr && b_cols)
+            status = hipblasDistTraits<T>::trsm(grid->handle,
+                                                HIPBLAS_SIDE_LEFT,
+                                                uplo,
+                                                HIPBLAS_OP_N,
+                                                diag,
+                                                int(w),
+                                                int(b_cols),
+                                                step_alpha,
+                                                diagonal,
+                                                int(w),
+                                                B + row,
+                                                ldb);
+
+        // The solved block row, to every process row
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistWait(grid->stream, grid->consumed[0], stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && grid->myrow == pr)
+            status = hipblasDistCopy(solved, w, B + row, descB->ld, w, b_cols, grid->stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistBroadcast(solved, w * b_cols, pr, grid->col_comm, grid->stream);
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistWait(stream, grid->received[1], grid->stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && rows && b_cols)
+            status = hipblasDistTraits<T>::gemm(grid->handle,
+                                                HIPBLAS_OP_N,
+                                                HIPBLAS_OP_N,
+                                                int(rows),
+                                                int(b_cols),
+                                                int(w),
+                                                &minus_one,
+                                                panel,
+                                                int(rows),
+                                                solved,
+                                                int(w),
+                                                step_alpha,
+                                                B + first,
+                                                ldb);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasDistStatus(hipEventRecord(grid->consumed[1], stream));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+#else
+
+template <typename T>
+static hipblasStatus_t hipblasDistGemm(hipblasDistGrid_t              grid,
+                                       const T*                       alpha,
+                                       const T*                       A,
+                                       const hipblasDistMatrixDesc_t* descA,
+                                       const T*                       B,
+                                       const hipblasDistMatrixDesc_t* descB,
+                                       const T*                       beta,
+                                       T*                             C,
+                                       const hipblasDistMatrixDesc_t* descC)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasDistTrsm(hipblasDistGrid_t              grid,
+                                       hipblasFillMode_t              uplo,
+                                       hipblasDiagType_t              diag,
+                                       const T*                       alpha,
+                                       const T*                       A,
+                                       const hipblasDistMatrixDesc_t* descA,
+                                       T*                             B,
+                                       const hipblasDistMatrixDesc_t* descB)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+#endif
+
+extern "C" hipblasStatus_t hipblasDistGridCreate(
+    hipblasDistGrid_t* grid, hipblasHandle_t handle, void* comm, int nprow, int npcol)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, grid, comm, nprow, npcol);
+#ifdef HIPBLAS_RCCL
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!grid || !comm || nprow < 1 || npcol < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    ncclComm_t nccl_comm = static_cast<ncclComm_t>(comm);
+    int        size, rank;
+    if(ncclCommCount(nccl_comm, &size) != ncclSuccess
+       || ncclCommUserRank(nccl_comm, &rank) != ncclSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(int64_t(nprow) * npcol != size)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::unique_ptr<hipblasDistGrid> created(new hipblasDistGrid);
+    created->handle = handle;
+    created->nprow  = nprow;
+    created->npcol  = npcol;
+    created->myrow  = rank / npcol;
+    created->mycol  = rank % npcol;
+
+    // Collective over comm: every process splits both, in the same order
+    hipblasStatus_t status = hipblasDistStatus(
+        ncclCommSplit(nccl_comm, created->myrow, created->mycol, &created->row_comm, nullptr));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasDistStatus(
+            ncclCommSplit(nccl_comm, created->mycol, created->myrow, &created->col_comm, nullptr));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    status = hipblasDistStatus(hipblasInternalStreamCreate(handle, &created->stream));
+    for(hipEvent_t* event : {&created->issued,
+                             &created->received[0],
+                             &created->received[1],
+                             &created->consumed[0],
+                             &created->consumed[1]})
+    {
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && hipEventCreateWithFlags(event, hipEventDisableTiming) != hipSuccess)
+        {
+            *event = nullptr;
+            status = hipblasDistStatus(hipErrorUnknown);
+        }
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    *grid = created.release();
+    return HIPBLAS_STATUS_SUCCESS;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistGridDestroy(hipblasDistGrid_t grid)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid);
+    if(!grid)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    delete grid;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistGridCoords(hipblasDistGrid_t grid, int* myrow, int* mycol)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid, myrow, mycol);
+    if(!grid)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!myrow || !mycol)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *myrow = grid->myrow;
+    *mycol = grid->mycol;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistLocalSize(hipblasDistGrid_t              grid,
+                                                const hipblasDistMatrixDesc_t* desc,
+                                                int64_t*                       rows,
+                                                int64_t*                       cols)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid, desc, rows, cols);
+    if(!grid)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!desc || !rows || !cols || desc->m < 0 || desc->n < 0 || desc->nb < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *rows = hipblasDistNumroc(desc->m, desc->nb, grid->myrow, grid->nprow);
+    *cols = hipblasDistNumroc(desc->n, desc->nb, grid->mycol, grid->npcol);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistSgemm(hipblasDistGrid_t              grid,
+                                            const float*                   alpha,
+                                            const float*                   A,
+                                            const hipblasDistMatrixDesc_t* descA,
+                                            const float*                   B,
+                                            const hipblasDistMatrixDesc_t* descB,
+                                            const float*                   beta,
+                                            float*                         C,
+                                            const hipblasDistMatrixDesc_t* descC)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid, alpha, A, descA, B, descB, beta, C, descC);
+    return hipblasDistGemm(grid, alpha, A, descA, B, descB, beta, C, descC);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistDgemm(hipblasDistGrid_t              grid,
+                                            const double*                  alpha,
+                                            const double*                  A,
+                                            const hipblasDistMatrixDesc_t* descA,
+                                            const double*                  B,
+                                            const hipblasDistMatrixDesc_t* descB,
+                                            const double*                  beta,
+                                            double*                        C,
+                                            const hipblasDistMatrixDesc_t* descC)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid, alpha, A, descA, B, descB, beta, C, descC);
+    return hipblasDistGemm(grid, alpha, A, descA, B, descB, beta, C, descC);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistCgemm(hipblasDistGrid_t              grid,
+                                            const hipblasComplex*          alpha,
+                                            const hipblasComplex*          A,
+                                            const hipblasDistMatrixDesc_t* descA,
+                                            const hipblasComplex*          B,
+                                            const hipblasDistMatrixDesc_t* descB,
+                                            const hipblasComplex*          beta,
+                                            hipblasComplex*                C,
+                                            const hipblasDistMatrixDesc_t* descC)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid, alpha, A, descA, B, descB, beta, C, descC);
+    return hipblasDistGemm(grid, alpha, A, descA, B, descB, beta, C, descC);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistZgemm(hipblasDistGrid_t              grid,
+                                            const hipblasDoubleComplex*    alpha,
+                                            const hipblasDoubleComplex*    A,
+                                            const hipblasDistMatrixDesc_t* descA,
+                                            const hipblasDoubleComplex*    B,
+                                            const hipblasDistMatrixDesc_t* descB,
+                                            const hipblasDoubleComplex*    beta,
+                                            hipblasDoubleComplex*          C,
+                                            const hipblasDistMatrixDesc_t* descC)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid, alpha, A, descA, B, descB, beta, C, descC);
+    return hipblasDistGemm(grid, alpha, A, descA, B, descB, beta, C, descC);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistStrsm(hipblasDistGrid_t              grid,
+                                            hipblasFillMode_t              uplo,
+                                            hipblasDiagType_t              diag,
+                                            const float*                   alpha,
+                                            const float*                   A,
+                                            const hipblasDistMatrixDesc_t* descA,
+                                            float*                         B,
+                                            const hipblasDistMatrixDesc_t* descB)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid, uplo, diag, alpha, A, descA, B, descB);
+    return hipblasDistTrsm(grid, uplo, diag, alpha, A, descA, B, descB);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistDtrsm(hipblasDistGrid_t              grid,
+                                            hipblasFillMode_t              uplo,
+                                            hipblasDiagType_t              diag,
+                                            const double*                  alpha,
+                                            const double*                  A,
+                                            const hipblasDistMatrixDesc_t* descA,
+                                            double*                        B,
+                                            const hipblasDistMatrixDesc_t* descB)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid, uplo, diag, alpha, A, descA, B, descB);
+    return hipblasDistTrsm(grid, uplo, diag, alpha, A, descA, B, descB);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistCtrsm(hipblasDistGrid_t              grid,
+                                            hipblasFillMode_t              uplo,
+                                            hipblasDiagType_t              diag,
+                                            const hipblasComplex*          alpha,
+                                            const hipblasComplex*          A,
+                                            const hipblasDistMatrixDesc_t* descA,
+                                            hipblasComplex*                B,
+                                            const hipblasDistMatrixDesc_t* descB)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid, uplo, diag, alpha, A, descA, B, descB);
+    return hipblasDistTrsm(grid, uplo, diag, alpha, A, descA, B, descB);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDistZtrsm(hipblasDistGrid_t              grid,
+                                            hipblasFillMode_t              uplo,
+                                            hipblasDiagType_t              diag,
+                                            const hipblasDoubleComplex*    alpha,
+                                            const hipblasDoubleComplex*    A,
+                                            const hipblasDistMatrixDesc_t* descA,
+                                            hipblasDoubleComplex*          B,
+                                            const hipblasDistMatrixDesc_t* descB)
+try
+{
+    HIPBLAS_LAYER(nullptr, grid, uplo, diag, alpha, A, descA, B, descB);
+    return hipblasDistTrsm(grid, uplo, diag, alpha, A, descA, B, descB);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,213 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "gemm_tuning.hpp"
+#include "layer.hpp"
+#include "perf_counters.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Fractions of the peaks reached by the routines, and the latency of a launch in seconds
+static constexpr double estimate_compute_efficiency = 0.75;
+static constexpr double estimate_memory_efficiency  = 0.8;
+static constexpr double estimate_launch_latency     = 5e-6;
+
+// Peak rates of a device, in flops and bytes per second
+struct hipblasEstimatePeaks
+{
+    double fp64      = 0;
+    double fp32      = 0;
+    double fp16      = 0; // and bf16
+    double int8      = 0;
+    double bandwidth = 0;
+    bool   valid     = false;
+};
+
+static std::mutex                                    estimate_mutex;
+static std::unordered_map<int, hipblasEstimatePeaks> estimate_peaks;
+
+// Peaks of the current device, derived once per device. The vector rate is taken as 128 flops
+// per clock of a compute unit in fp32, 64 lanes doing a multiply-add, and the other datatypes
+// as multiples of it: CDNA devices and NVIDIA datacenter devices (compute capability x.0) run
+// fp64 at the fp32 rate or half of it, and the matrix units run fp16 and int8 faster.
+static hipblasEstimatePeaks hipblasEstimateDevicePeaks()
+{
+    int device = 0;
+    if(hipGetDevice(&device) != hipSuccess)
+        return hipblasEstimatePeaks();
+
+    {
+        std::lock_guard<std::mutex> lock(estimate_mutex);
+
+        auto peaks = estimate_peaks.find(device);
+        if(peaks != estimate_peaks.end())
+            return peaks->second;
+    }
+
+    hipDeviceProp_t      prop;
+    hipblasEstimatePeaks peaks;
+    if(hipGetDeviceProperties(&prop, device) == hipSuccess)
+    {
+        // clockRate and memoryClockRate are in kHz; memory transfers twice per clock
+        double fp32 = 128.0 * prop.multiProcessorCount * prop.clockRate * 1e3;
+
+        // gcnArchName is empty on NVIDIA devices
+        std::string arch   = prop.gcnArchName;
+        bool        nvidia = arch.empty();
+        bool        cdna   = false;
+        for(const char* prefix : {"gfx908", "gfx90a", "gfx94", "gfx95"})
+            cdna = cdna || !arch.compare(0, std::strlen(prefix), prefix);
+
+        peaks.fp32 = fp32;
+        if(cdna)
+            peaks.fp64 = arch.compare(0, 6, "gfx908") ? fp32 : fp32 / 2;
+        else if(nvidia)
+            peaks.fp64 = prop.major >= 6 && prop.minor == 0 ? fp32 / 2 : fp32 / 32;
+        else
+            peaks.fp64 = fp32 / 16;
+        peaks.fp16      = cdna || (nvidia && prop.major >= 7) ? fp32 * 8 : fp32 * 2;
+        peaks.int8      = peaks.fp16 * 2;
+        peaks.bandwidth = 2.0 * prop.memoryClockRate * 1e3 * (prop.memoryBusWidth / 8.0);
+        peaks.valid     = peaks.fp32 > 0 && peaks.bandwidth > 0;
+    }
+
+    std::lock_guard<std::mutex> lock(estimate_mutex);
+    estimate_peaks[device] = peaks;
+    return peaks;
+}
+
+// Peak rate of the datatype of a call. The precision letter of the entry point names it, and
+// the Ex routines take it from aType.
+static double hipblasEstimatePeakRate(const hipblasEstimatePeaks& peaks,
+                                      const std::string&          precision,
+                                      hipDataType                 type)
+{
+    if(precision == "f64_r" || precision == "f64_c")
+        return peaks.fp64;
+    if(precision == "f16_r")
+        return peaks.fp16;
+    if(!precision.empty())
+        return peaks.fp32;
+
+    switch(type)
+    {
+    case HIP_R_64F:
+    case HIP_C_64F:
+        return peaks.fp64;
+    case HIP_R_16F:
+    case HIP_R_16BF:
+    case HIP_C_16F:
+    case HIP_C_16BF:
+        return peaks.fp16;
+    case HIP_R_8I:
+    case HIP_R_8U:
+    case HIP_C_8I:
+    case HIP_R_8F_E4M3_FNUZ:
+    case HIP_R_8F_E5M2_FNUZ:
+        return peaks.int8;
+    default:
+        return peaks.fp32;
+    }
+}
+
+extern "C" hipblasStatus_t hipblasEstimateTime(hipblasHandle_t              handle,
+                                               const hipblasEstimateDesc_t* desc,
+                                               hipblasEstimate_t*           estimate)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, desc, estimate);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!desc || !estimate || !desc->routine
+       || std::strncmp(desc->routine, "hipblas", std::strlen("hipblas")))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(desc->m < 0 || desc->n < 0 || desc->k < 0 || desc->kl < 0 || desc->ku < 0
+       || desc->nrhs < 0 || desc->batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasPerfCounterSizes sizes;
+    sizes.m     = desc->m;
+    sizes.n     = desc->n;
+    sizes.k     = desc->k;
+    sizes.kl    = desc->kl;
+    sizes.ku    = desc->ku;
+    sizes.nrhs  = desc->nrhs;
+    sizes.batch = desc->batchCount;
+    sizes.trans = desc->transA;
+    sizes.side  = desc->side;
+    sizes.type  = desc->aType;
+    sizes.typed = true;
+
+    double flops = 0, bytes = 0;
+    if(!hipblasPerfCounterWork(desc->routine, sizes, flops, bytes))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    std::string function, precision;
+    hipblasLayerBenchFunction(desc->routine, function, precision);
+
+    estimate->flops    = flops;
+    estimate->bytes    = bytes;
+    estimate->measured = 0;
+
+    // Tuning keys hold the 32-bit sizes of hipblasGemmEx
+    constexpr int64_t int_max = std::numeric_limits<int>::max();
+    if(function == "gemm_ex" && desc->batchCount == 1 && desc->m <= int_max && desc->n <= int_max
+       && desc->k <= int_max)
+    {
+        std::string key = hipblasGemmTuningKey(desc->transA,
+                                               desc->transB,
+                                               int(desc->m),
+                                               int(desc->n),
+                                               int(desc->k),
+                                               desc->aType,
+                                               desc->bType,
+                                               desc->cType,
+                                               desc->computeType);
+        if(hipblasGemmTuningTime(key, estimate->seconds))
+        {
+            estimate->measured = 1;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+    }
+
+    hipblasEstimatePeaks peaks = hipblasEstimateDevicePeaks();
+    if(!peaks.valid)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    double rate    = hipblasEstimatePeakRate(peaks, precision, desc->aType);
+    double compute = flops / (rate * estimate_compute_efficiency);
+    double memory  = bytes / (peaks.bandwidth * estimate_memory_efficiency);
+
+    estimate->seconds = flops || bytes ? estimate_launch_latency + std::max(compute, memory) : 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,328 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "staging.hpp"
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#ifdef HIPBLAS_GDS
+#ifdef __HIP_PLATFORM_NVCC__
+#include <cufile.h>
+#else
+#include <hipfile.h>
+#endif
+#endif
+
+// A strided batch of rows x cols matrices in the file and on the device, with the batch folded
+// into the columns where the layout allows it
+struct hipblasFileLayout
+{
+    int64_t rows;
+    int64_t cols;
+    int64_t ld_file;
+    int64_t ld_device;
+    int64_t stride_file; // of the matrices left, in elements
+    int64_t stride_device;
+    int     batch_count;
+};
+
+// Packed matrices are single columns, and a batch of them is one matrix with the strides as
+// leading dimensions
+static hipblasFileLayout hipblasFileLayoutOf(int           rows,
+                                             int           cols,
+                                             int64_t       ld_file,
+                                             hipblasStride stride_file,
+                                             int           ld_device,
+                                             hipblasStride stride_device,
+                                             int           batch_count)
+{
+    hipblasFileLayout layout{
+        rows, cols, ld_file, ld_device, stride_file, stride_device, batch_count};
+    int64_t matrix = int64_t(rows) * cols;
+    if(ld_file != rows || ld_device != rows)
+        return layout;
+    if(batch_count == 1)
+        return {matrix, 1, matrix, matrix, 0, 0, 1};
+    if(stride_file >= matrix && stride_device >= matrix)
+        return {matrix, batch_count, stride_file, stride_device, 0, 0, 1};
+    return layout;
+}
+
+#ifdef HIPBLAS_GDS
+
+#ifdef __HIP_PLATFORM_NVCC__
+typedef CUfileHandle_t hipblasGdsHandle;
+#else
+typedef hipFileHandle_t hipblasGdsHandle;
+#endif
+
+// The driver is opened by the first transfer and kept until the process exits
+static bool hipblasGdsDriver()
+{
+    static std::once_flag once;
+    static bool           opened = false;
+    std::call_once(once, []() {
+#ifdef __HIP_PLATFORM_NVCC__
+        opened = cuFileDriverOpen().err == CU_FILE_SUCCESS;
+#else
+        opened = hipFileDriverOpen().err == hipFileSuccess;
+#endif
+    });
+    return opened;
+}
+
+static bool hipblasGdsRegister(int fd, hipblasGdsHandle& file)
+{
+#ifdef __HIP_PLATFORM_NVCC__
+    CUfileDescr_t descr = {};
+    descr.handle.fd     = fd;
+    descr.type          = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    return cuFileHandleRegister(&file, &descr).err == CU_FILE_SUCCESS;
+#else
+    hipFileDescr_t descr = {};
+    descr.handle.fd      = fd;
+    descr.type           = hipFileHandleTypeOpaqueFD;
+    return hipFileHandleRegister(&file, &descr).err == hipFileSuccess;
+#endif
+}
+
+static void hipblasGdsDeregister(hipblasGdsHandle file)
+{
+#ifdef __HIP_PLATFORM_NVCC__
+    cuFileHandleDeregister(file);
+#else
+    hipFileHandleDeregister(file);
+#endif
+}
+
+// Reads or writes all bytes between device and offset of file, retrying short transfers
+static bool hipblasGdsTransfer(
+    bool read, hipblasGdsHandle file, char* device, size_t bytes, int64_t offset)
+{
+    while(bytes)
+    {
+#ifdef __HIP_PLATFORM_NVCC__
+        ssize_t done = read ? cuFileRead(file, device, bytes, offset, 0)
+                            : cuFileWrite(file, device, bytes, offset, 0);
+#else
+        ssize_t done = read ? hipFileRead(file, device, bytes, offset, 0)
+                            : hipFileWrite(file, device, bytes, offset, 0);
+#endif
+        if(done <= 0)
+            return false;
+        device += done;
+        bytes -= done;
+        offset += done;
+    }
+    return true;
+}
+
+// Copies layout between fd and device without host memory, after the work on stream is done.
+// Returns HIPBLAS_STATUS_NOT_SUPPORTED, possibly after copying part of it, when the driver or the
+// file do not take direct transfers, and the caller then copies it all through the staging buffers.
+static hipblasStatus_t hipblasGdsCopy(bool                     to_device,
+                                      const hipblasFileLayout& layout,
+                                      int                      elem_size,
+                                      int                      fd,
+                                      int64_t                  offset,
+                                      char*                    device,
+                                      hipStream_t              stream)
+{
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone || !hipblasGdsDriver())
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasGdsHandle file;
+    if(!hipblasGdsRegister(fd, file))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(hipStreamSynchronize(stream) != hipSuccess)
+    {
+        hipblasGdsDeregister(file);
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    size_t size = elem_size;
+    bool   done = true;
+    for(int64_t b = 0; b < layout.batch_count && done; b++)
+        for(int64_t j = 0; j < layout.cols && done; j++)
+            done = hipblasGdsTransfer(
+                to_device,
+                file,
+                device + (b * layout.stride_device + j * layout.ld_device) * size,
+                layout.rows * size,
+                offset + (b * layout.stride_file + j * layout.ld_file) * int64_t(size));
+
+    hipblasGdsDeregister(file);
+    return done ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+#endif
+
+// Copies a strided batch between the file fd and device, directly with GPUDirect Storage when it
+// is built in and the file takes it, and otherwise through the pinned staging buffers
+static hipblasStatus_t hipblasFileCopy(bool          to_device,
+                                       int           rows,
+                                       int           cols,
+                                       int           elem_size,
+                                       int           fd,
+                                       int64_t       offset,
+                                       int64_t       ld_file,
+                                       hipblasStride stride_file,
+                                       void*         device,
+                                       int           ld_device,
+                                       hipblasStride stride_device,
+                                       int           batch_count,
+                                       hipStream_t   stream)
+{
+    if(rows < 0 || cols < 0 || elem_size <= 0 || fd < 0 || offset < 0 || ld_file <= 0
+       || ld_device <= 0 || ld_file < rows || ld_device < rows || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!rows || !cols || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!device)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasFileLayout layout = hipblasFileLayoutOf(
+        rows, cols, ld_file, stride_file, ld_device, stride_device, batch_count);
+    char* base = static_cast<char*>(device);
+
+#ifdef HIPBLAS_GDS
+    hipblasStatus_t status
+        = hipblasGdsCopy(to_device, layout, elem_size, fd, offset, base, stream);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+#endif
+
+    for(int64_t b = 0; b < layout.batch_count; b++)
+    {
+        hipblasStatus_t status
+            = hipblasStagedFileCopy(to_device,
+                                    layout.rows,
+                                    layout.cols,
+                                    elem_size,
+                                    fd,
+                                    offset + b * layout.stride_file * elem_size,
+                                    layout.ld_file,
+                                    base + b * layout.stride_device * elem_size,
+                                    layout.ld_device,
+                                    stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+extern "C" hipblasStatus_t hipblasReadMatrixFromFile(int           rows,
+                                                     int           cols,
+                                                     int           elemSize,
+                                                     int           fd,
+                                                     int64_t       fileOffset,
+                                                     int64_t       ldf,
+                                                     hipblasStride strideF,
+                                                     void*         BP,
+                                                     int           ldb,
+                                                     hipblasStride strideB,
+                                                     int           batchCount,
+                                                     hipStream_t   stream)
+try
+{
+    HIPBLAS_LAYER(nullptr,
+                  rows,
+                  cols,
+                  elemSize,
+                  fd,
+                  fileOffset,
+                  ldf,
+                  strideF,
+                  BP,
+                  ldb,
+                  strideB,
+                  batchCount,
+                  stream);
+    return hipblasFileCopy(true,
+                           rows,
+                           cols,
+                           elemSize,
+                           fd,
+                           fileOffset,
+                           ldf,
+                           strideF,
+                           BP,
+                           ldb,
+                           strideB,
+                           batchCount,
+                           stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasWriteMatrixToFile(int           rows,
+                                                    int           cols,
+                                                    int           elemSize,
+                                                    const void*   AP,
+                                                    int           lda,
+                                                    hipblasStride strideA,
+                                                    int           fd,
+                                                    int64_t       fileOffset,
+                                                    int64_t       ldf,
+                                                    hipblasStride strideF,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+try
+{
+    HIPBLAS_LAYER(nullptr,
+                  rows,
+                  cols,
+                  elemSize,
+                  AP,
+                  lda,
+                  strideA,
+                  fd,
+                  fileOffset,
+                  ldf,
+                  strideF,
+                  batchCount,
+                  stream);
+    return hipblasFileCopy(false,
+                           rows,
+                           cols,
+                           elemSize,
+                           fd,
+                           fileOffset,
+                           ldf,
+                           strideF,
+                           const_cast<void*>(AP),
+                           lda,
+                           strideA,
+                           batchCount,
+                           stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,285 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "fused_level1.hpp"
+#include "layer.hpp"
+#include <initializer_list>
+
+// The fused functions take float or double, with every argument of the type of the computation
+static bool hipblasFusedTypes(hipDataType executionType, std::initializer_list<hipDataType> types)
+{
+    if(executionType != HIP_R_32F && executionType != HIP_R_64F)
+        return false;
+    for(hipDataType type : types)
+        if(type != executionType)
+            return false;
+    return true;
+}
+
+#ifdef HIPBLAS_FUSED_LEVEL1
+template <typename T>
+static hipblasStatus_t hipblasAxpyDotExTemplate(hipblasHandle_t handle,
+                                                int             n,
+                                                const void*     alpha,
+                                                const void*     x,
+                                                int             incx,
+                                                void*           y,
+                                                int             incy,
+                                                const void*     z,
+                                                int             incz,
+                                                void*           result)
+{
+    return hipblasFusedAxpyDot(handle,
+                               n,
+                               (const T*)alpha,
+                               (const T*)x,
+                               incx,
+                               (T*)y,
+                               incy,
+                               (const T*)z,
+                               incz,
+                               (T*)result);
+}
+
+template <typename T>
+static hipblasStatus_t hipblasDotDualExTemplate(hipblasHandle_t handle,
+                                                int             n,
+                                                const void*     x,
+                                                int             incx,
+                                                const void*     y,
+                                                int             incy,
+                                                const void*     z,
+                                                int             incz,
+                                                void*           result)
+{
+    return hipblasFusedDotDual(
+        handle, n, (const T*)x, incx, (const T*)y, incy, (const T*)z, incz, (T*)result);
+}
+
+template <typename T>
+static hipblasStatus_t hipblasAxpbyNrm2ExTemplate(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const void*     alpha,
+                                                  const void*     x,
+                                                  int             incx,
+                                                  const void*     beta,
+                                                  void*           y,
+                                                  int             incy,
+                                                  void*           result)
+{
+    return hipblasFusedAxpbyNrm2(handle,
+                                 n,
+                                 (const T*)alpha,
+                                 (const T*)x,
+                                 incx,
+                                 (const T*)beta,
+                                 (T*)y,
+                                 incy,
+                                 (T*)result);
+}
+#endif
+
+extern "C" hipblasStatus_t hipblasAxpyDotEx(hipblasHandle_t handle,
+                                            int             n,
+                                            const void*     alpha,
+                                            hipDataType     alphaType,
+                                            const void*     x,
+                                            hipDataType     xType,
+                                            int             incx,
+                                            void*           y,
+                                            hipDataType     yType,
+                                            int             incy,
+                                            const void*     z,
+                                            hipDataType     zType,
+                                            int             incz,
+                                            void*           result,
+                                            hipDataType     resultType,
+                                            hipDataType     executionType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  n,
+                  alpha,
+                  alphaType,
+                  x,
+                  xType,
+                  incx,
+                  y,
+                  yType,
+                  incy,
+                  z,
+                  zType,
+                  incz,
+                  result,
+                  resultType,
+                  executionType);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblasFusedTypes(executionType, {alphaType, xType, yType, zType, resultType}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!result || (n > 0 && (!alpha || !x || !y || !z)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_FUSED_LEVEL1
+    auto fused = executionType == HIP_R_32F ? hipblasAxpyDotExTemplate<float>
+                                            : hipblasAxpyDotExTemplate<double>;
+    return fused(handle, n, alpha, x, incx, y, incy, z, incz, result);
+#else
+    // Without the fused kernels y is read and written by axpy and read again by dot
+    hipblasStatus_t status = hipblasAxpyEx_v2(
+        handle, n, alpha, alphaType, x, xType, incx, y, yType, incy, executionType);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasDotEx_v2(
+        handle, n, y, yType, incy, z, zType, incz, result, resultType, executionType);
+#endif
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDotDualEx(hipblasHandle_t handle,
+                                            int             n,
+                                            const void*     x,
+                                            hipDataType     xType,
+                                            int             incx,
+                                            const void*     y,
+                                            hipDataType     yType,
+                                            int             incy,
+                                            const void*     z,
+                                            hipDataType     zType,
+                                            int             incz,
+                                            void*           result,
+                                            hipDataType     resultType,
+                                            hipDataType     executionType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  n,
+                  x,
+                  xType,
+                  incx,
+                  y,
+                  yType,
+                  incy,
+                  z,
+                  zType,
+                  incz,
+                  result,
+                  resultType,
+                  executionType);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblasFusedTypes(executionType, {xType, yType, zType, resultType}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!result || (n > 0 && (!x || !y || !z)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_FUSED_LEVEL1
+    auto fused = executionType == HIP_R_32F ? hipblasDotDualExTemplate<float>
+                                            : hipblasDotDualExTemplate<double>;
+    return fused(handle, n, x, incx, y, incy, z, incz, result);
+#else
+    size_t          size   = executionType == HIP_R_32F ? sizeof(float) : sizeof(double);
+    hipblasStatus_t status = hipblasDotEx_v2(
+        handle, n, x, xType, incx, y, yType, incy, result, resultType, executionType);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasDotEx_v2(handle,
+                           n,
+                           x,
+                           xType,
+                           incx,
+                           z,
+                           zType,
+                           incz,
+                           (char*)result + size,
+                           resultType,
+                           executionType);
+#endif
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasAxpbyNrm2Ex(hipblasHandle_t handle,
+                                              int             n,
+                                              const void*     alpha,
+                                              hipDataType     alphaType,
+                                              const void*     x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              const void*     beta,
+                                              void*           y,
+                                              hipDataType     yType,
+                                              int             incy,
+                                              void*           result,
+                                              hipDataType     resultType,
+                                              hipDataType     executionType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  n,
+                  alpha,
+                  alphaType,
+                  x,
+                  xType,
+                  incx,
+                  beta,
+                  y,
+                  yType,
+                  incy,
+                  result,
+                  resultType,
+                  executionType);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblasFusedTypes(executionType, {alphaType, xType, yType, resultType}))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!result || (n > 0 && (!alpha || !x || !beta || !y)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_FUSED_LEVEL1
+    auto fused = executionType == HIP_R_32F ? hipblasAxpbyNrm2ExTemplate<float>
+                                            : hipblasAxpbyNrm2ExTemplate<double>;
+    return fused(handle, n, alpha, x, incx, beta, y, incy, result);
+#else
+    // scal and nrm2 do nothing for a negative increment, but neither depends on the order of y
+    int             abs_incy = incy < 0 ? -incy : incy;
+    hipblasStatus_t status
+        = hipblasScalEx_v2(handle, n, beta, alphaType, y, yType, abs_incy, executionType);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasAxpyEx_v2(
+            handle, n, alpha, alphaType, x, xType, incx, y, yType, incy, executionType);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasNrm2Ex_v2(handle, n, y, yType, abs_incy, result, resultType, executionType);
+#endif
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,373 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "fused_level1.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <mutex>
+#include <unordered_map>
+
+constexpr int fused_level1_block_size = 256;
+
+// Work groups of the first kernel, and so partial results of each result the second kernel adds
+constexpr int fused_level1_max_blocks = 1024;
+
+// Results of one call
+constexpr int fused_level1_max_results = 2;
+
+// Element i of a vector of n elements, counted from the end for negative increments as in BLAS
+__device__ inline int64_t hipblasFusedOffset(int64_t i, int n, int inc)
+{
+    return inc < 0 ? (i - (n - 1)) * inc : i * inc;
+}
+
+// Sum of value over the work group. The caller synchronizes before reusing s_sum.
+template <typename T>
+__device__ inline T hipblasFusedBlockSum(T value, T* s_sum)
+{
+    int tid    = threadIdx.x;
+    s_sum[tid] = value;
+    __syncthreads();
+
+    for(int s = fused_level1_block_size / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+            s_sum[tid] += s_sum[tid + s];
+        __syncthreads();
+    }
+    return s_sum[0];
+}
+
+// Scalar of a call, read on the device in device pointer mode
+template <typename T>
+__device__ inline T hipblasFusedScalar(const T* device, T host)
+{
+    return device ? *device : host;
+}
+
+template <typename T>
+__global__ void __launch_bounds__(fused_level1_block_size)
+    hipblasFusedAxpyDotKernel(int      n,
+                              const T* alpha_device,
+                              T        alpha_host,
+                              const T* x,
+                              int      incx,
+                              T*       y,
+                              int      incy,
+                              const T* z,
+                              int      incz,
+                              bool     z_is_y,
+                              T*       partial)
+{
+    __shared__ T s_sum[fused_level1_block_size];
+
+    T alpha = hipblasFusedScalar(alpha_device, alpha_host);
+    T sum   = 0;
+    for(int64_t i = int64_t(blockIdx.x) * fused_level1_block_size + threadIdx.x; i < n;
+        i += int64_t(gridDim.x) * fused_level1_block_size)
+    {
+        int64_t iy = hipblasFusedOffset(i, n, incy);
+        T       yi = alpha * x[hipblasFusedOffset(i, n, incx)] + y[iy];
+        y[iy]      = yi;
+        sum += yi * (z_is_y ? yi : z[hipblasFusedOffset(i, n, incz)]);
+    }
+
+    sum = hipblasFusedBlockSum(sum, s_sum);
+    if(threadIdx.x == 0)
+        partial[blockIdx.x] = sum;
+}
+
+template <typename T>
+__global__ void __launch_bounds__(fused_level1_block_size)
+    hipblasFusedDotDualKernel(int      n,
+                              const T* x,
+                              int      incx,
+                              const T* y,
+                              int      incy,
+                              const T* z,
+                              int      incz,
+                              bool     y_is_x,
+                              bool     z_is_x,
+                              T*       partial)
+{
+    __shared__ T s_sum_y[fused_level1_block_size];
+    __shared__ T s_sum_z[fused_level1_block_size];
+
+    T sum_y = 0, sum_z = 0;
+    for(int64_t i = int64_t(blockIdx.x) * fused_level1_block_size + threadIdx.x; i < n;
+        i += int64_t(gridDim.x) * fused_level1_block_size)
+    {
+        T xi = x[hipblasFusedOffset(i, n, incx)];
+        sum_y += xi * (y_is_x ? xi : y[hipblasFusedOffset(i, n, incy)]);
+        sum_z += xi * (z_is_x ? xi : z[hipblasFusedOffset(i, n, incz)]);
+    }
+
+    sum_y = hipblasFusedBlockSum(sum_y, s_sum_y);
+    sum_z = hipblasFusedBlockSum(sum_z, s_sum_z);
+    if(threadIdx.x == 0)
+    {
+        partial[blockIdx.x]             = sum_y;
+        partial[gridDim.x + blockIdx.x] = sum_z;
+    }
+}
+
+template <typename T>
+__global__ void __launch_bounds__(fused_level1_block_size)
+    hipblasFusedAxpbyNrm2Kernel(int      n,
+                                const T* alpha_device,
+                                T        alpha_host,
+                                const T* x,
+                                int      incx,
+                                const T* beta_device,
+                                T        beta_host,
+                                T*       y,
+                                int      incy,
+                                T*       partial)
+{
+    __shared__ T s_sum[fused_level1_block_size];
+
+    T alpha = hipblasFusedScalar(alpha_device, alpha_host);
+    T beta  = hipblasFusedScalar(beta_device, beta_host);
+    T sum   = 0;
+    for(int64_t i = int64_t(blockIdx.x) * fused_level1_block_size + threadIdx.x; i < n;
+        i += int64_t(gridDim.x) * fused_level1_block_size)
+    {
+        int64_t iy = hipblasFusedOffset(i, n, incy);
+        T       yi = alpha * x[hipblasFusedOffset(i, n, incx)] + beta * y[iy];
+        y[iy]      = yi;
+        sum += yi * yi;
+    }
+
+    sum = hipblasFusedBlockSum(sum, s_sum);
+    if(threadIdx.x == 0)
+        partial[blockIdx.x] = sum;
+}
+
+// Adds the blocks partial results of each of the count results in one work group, in a fixed
+// order so the results do not change from run to run. SQRT takes the square root for nrm2.
+template <bool SQRT, typename T>
+__global__ void __launch_bounds__(fused_level1_block_size)
+    hipblasFusedReduceKernel(int blocks, int count, const T* partial, T* result)
+{
+    __shared__ T s_sum[fused_level1_block_size];
+
+    for(int r = 0; r < count; r++)
+    {
+        T sum = 0;
+        for(int i = threadIdx.x; i < blocks; i += fused_level1_block_size)
+            sum += partial[r * blocks + i];
+
+        sum = hipblasFusedBlockSum(sum, s_sum);
+        if(threadIdx.x == 0)
+            result[r] = SQRT ? sqrt(sum) : sum;
+        __syncthreads();
+    }
+}
+
+// Device buffer of each handle, with the partial results followed by the results of host pointer
+// mode calls. It is sized for double and allocated on the first call.
+constexpr size_t fused_level1_buffer_size
+    = fused_level1_max_results * fused_level1_max_blocks + fused_level1_max_results;
+
+static std::mutex                                 fused_buffer_mutex;
+static std::unordered_map<hipblasHandle_t, void*> fused_buffers;
+
+static void* hipblasFusedBufferGet(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(fused_buffer_mutex);
+
+    void*& buffer = fused_buffers[handle];
+    if(!buffer && hipMalloc(&buffer, sizeof(double) * fused_level1_buffer_size) != hipSuccess)
+        buffer = nullptr;
+    return buffer;
+}
+
+void hipblasFusedLevel1Erase(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(fused_buffer_mutex);
+
+    auto buffer = fused_buffers.find(handle);
+    if(buffer != fused_buffers.end())
+    {
+        if(buffer->second)
+            (void)hipFree(buffer->second);
+        fused_buffers.erase(buffer);
+    }
+}
+
+static int hipblasFusedBlocks(int n)
+{
+    return n > 0 ? std::min((n - 1) / fused_level1_block_size + 1, fused_level1_max_blocks) : 0;
+}
+
+// Runs launch(stream, blocks, partial, host) for the first kernel, unless the vectors are empty,
+// then adds the count results into result, through the buffer of handle in host pointer mode
+template <bool SQRT, typename T, typename Launch>
+static hipblasStatus_t
+    hipblasFusedReduce(hipblasHandle_t handle, int n, int count, T* result, Launch launch)
+{
+    hipblasPointerMode_t pointer_mode;
+    hipStream_t          stream;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    T* partial = (T*)hipblasFusedBufferGet(handle);
+    if(!partial)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    bool host          = pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+    T*   host_result   = partial + fused_level1_max_results * fused_level1_max_blocks;
+    T*   device_result = host ? host_result : result;
+    int  blocks        = hipblasFusedBlocks(n);
+
+    if(blocks)
+        launch(stream, blocks, partial, host);
+    hipLaunchKernelGGL((hipblasFusedReduceKernel<SQRT, T>),
+                       dim3(1),
+                       dim3(fused_level1_block_size),
+                       0,
+                       stream,
+                       blocks,
+                       count,
+                       partial,
+                       device_result);
+    if(hipGetLastError() != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    size_t bytes = sizeof(T) * count;
+    if(host
+       && (hipMemcpyAsync(result, device_result, bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess))
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t hipblasFusedAxpyDot(hipblasHandle_t handle,
+                                    int             n,
+                                    const T*        alpha,
+                                    const T*        x,
+                                    int             incx,
+                                    T*              y,
+                                    int             incy,
+                                    const T*        z,
+                                    int             incz,
+                                    T*              result)
+{
+    auto launch = [&](hipStream_t stream, int blocks, T* partial, bool host) {
+        hipLaunchKernelGGL(hipblasFusedAxpyDotKernel<T>,
+                           dim3(blocks),
+                           dim3(fused_level1_block_size),
+                           0,
+                           stream,
+                           n,
+                           host ? nullptr : alpha,
+                           host ? *alpha : T(0),
+                           x,
+                           incx,
+                           y,
+                           incy,
+                           z,
+                           incz,
+                           z == y && incz == incy,
+                           partial);
+    };
+    return hipblasFusedReduce<false>(handle, n, 1, result, launch);
+}
+
+template <typename T>
+hipblasStatus_t hipblasFusedDotDual(hipblasHandle_t handle,
+                                    int             n,
+                                    const T*        x,
+                                    int             incx,
+                                    const T*        y,
+                                    int             incy,
+                                    const T*        z,
+                                    int             incz,
+                                    T*              result)
+{
+    auto launch = [&](hipStream_t stream, int blocks, T* partial, bool) {
+        hipLaunchKernelGGL(hipblasFusedDotDualKernel<T>,
+                           dim3(blocks),
+                           dim3(fused_level1_block_size),
+                           0,
+                           stream,
+                           n,
+                           x,
+                           incx,
+                           y,
+                           incy,
+                           z,
+                           incz,
+                           y == x && incy == incx,
+                           z == x && incz == incx,
+                           partial);
+    };
+    return hipblasFusedReduce<false>(handle, n, 2, result, launch);
+}
+
+template <typename T>
+hipblasStatus_t hipblasFusedAxpbyNrm2(hipblasHandle_t handle,
+                                      int             n,
+                                      const T*        alpha,
+                                      const T*        x,
+                                      int             incx,
+                                      const T*        beta,
+                                      T*              y,
+                                      int             incy,
+                                      T*              result)
+{
+    auto launch = [&](hipStream_t stream, int blocks, T* partial, bool host) {
+        hipLaunchKernelGGL(hipblasFusedAxpbyNrm2Kernel<T>,
+                           dim3(blocks),
+                           dim3(fused_level1_block_size),
+                           0,
+                           stream,
+                           n,
+                           host ? nullptr : alpha,
+                           host ? *alpha : T(0),
+                           x,
+                           incx,
+                           host ? nullptr : beta,
+                           host ? *beta : T(0),
+                           y,
+                           incy,
+                           partial);
+    };
+    return hipblasFusedReduce<true>(handle, n, 1, result, launch);
+}
+
+#define HIPBLAS_FUSED_LEVEL1_INSTANTIATE(T)                                         \
+    template hipblasStatus_t hipblasFusedAxpyDot(                                   \
+        hipblasHandle_t, int, const T*, const T*, int, T*, int, const T*, int, T*); \
+    template hipblasStatus_t hipblasFusedDotDual(                                   \
+        hipblasHandle_t, int, const T*, int, const T*, int, const T*, int, T*);     \
+    template hipblasStatus_t hipblasFusedAxpbyNrm2(                                 \
+        hipblasHandle_t, int, const T*, const T*, int, const T*, T*, int, T*);
+
+HIPBLAS_FUSED_LEVEL1_INSTANTIATE(float)
+HIPBLAS_FUSED_LEVEL1_INSTANTIATE(double)
+
+#undef HIPBLAS_FUSED_LEVEL1_INSTANTIATE
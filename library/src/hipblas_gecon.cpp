@@ -0,0 +1,249 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "gecon.hpp"
+#include "layer.hpp"
+#include <algorithm>
+
+// Checks the arguments of both forms, where A_array is the pointer array of the batched form and
+// null otherwise, then runs the estimate on the device. info is set as LAPACK ?gecon sets it,
+// with the positions of the strided batched form when strided.
+template <typename T, typename R>
+static hipblasStatus_t hipblasGecon(hipblasHandle_t   handle,
+                                    hipblasNormType_t norm,
+                                    int               n,
+                                    T*                A,
+                                    T* const*         A_array,
+                                    int               lda,
+                                    hipblasStride     strideA,
+                                    const R*          anorm,
+                                    R*                rcond,
+                                    int*              info,
+                                    int               batchCount,
+                                    bool              strided)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(norm != HIPBLAS_NORM_ONE && norm != HIPBLAS_NORM_INF)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if((strided ? A == NULL : A_array == NULL) && n && batchCount)
+        *info = -3;
+    else if(lda < std::max(1, n))
+        *info = -4;
+    else if(anorm == NULL && batchCount)
+        *info = strided ? -6 : -5;
+    else if(rcond == NULL && batchCount)
+        *info = strided ? -7 : -6;
+    else if(batchCount < 0)
+        *info = strided ? -9 : -8;
+    else
+        *info = 0;
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+#ifdef HIPBLAS_GECON
+    return hipblasGeconKernels(handle,
+                               norm == HIPBLAS_NORM_ONE,
+                               n,
+                               A,
+                               (const T* const*)A_array,
+                               lda,
+                               strideA,
+                               anorm,
+                               rcond,
+                               batchCount);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasSgeconBatched(hipblasHandle_t         handle,
+                                                const hipblasNormType_t norm,
+                                                const int               n,
+                                                float* const            A[],
+                                                const int               lda,
+                                                const float*            anorm,
+                                                float*                  rcond,
+                                                int*                    info,
+                                                const int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, norm, n, A, lda, anorm, rcond, info, batchCount);
+    return hipblasGecon<float>(
+        handle, norm, n, nullptr, A, lda, 0, anorm, rcond, info, batchCount, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgeconBatched(hipblasHandle_t         handle,
+                                                const hipblasNormType_t norm,
+                                                const int               n,
+                                                double* const           A[],
+                                                const int               lda,
+                                                const double*           anorm,
+                                                double*                 rcond,
+                                                int*                    info,
+                                                const int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, norm, n, A, lda, anorm, rcond, info, batchCount);
+    return hipblasGecon<double>(
+        handle, norm, n, nullptr, A, lda, 0, anorm, rcond, info, batchCount, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgeconBatched(hipblasHandle_t         handle,
+                                                const hipblasNormType_t norm,
+                                                const int               n,
+                                                hipblasComplex* const   A[],
+                                                const int               lda,
+                                                const float*            anorm,
+                                                float*                  rcond,
+                                                int*                    info,
+                                                const int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, norm, n, A, lda, anorm, rcond, info, batchCount);
+    return hipblasGecon<hipblasComplex>(
+        handle, norm, n, nullptr, A, lda, 0, anorm, rcond, info, batchCount, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgeconBatched(hipblasHandle_t             handle,
+                                                const hipblasNormType_t     norm,
+                                                const int                   n,
+                                                hipblasDoubleComplex* const A[],
+                                                const int                   lda,
+                                                const double*               anorm,
+                                                double*                     rcond,
+                                                int*                        info,
+                                                const int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, norm, n, A, lda, anorm, rcond, info, batchCount);
+    return hipblasGecon<hipblasDoubleComplex>(
+        handle, norm, n, nullptr, A, lda, 0, anorm, rcond, info, batchCount, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgeconStridedBatched(hipblasHandle_t         handle,
+                                                       const hipblasNormType_t norm,
+                                                       const int               n,
+                                                       float*                  A,
+                                                       const int               lda,
+                                                       const hipblasStride     strideA,
+                                                       const float*            anorm,
+                                                       float*                  rcond,
+                                                       int*                    info,
+                                                       const int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, norm, n, A, lda, strideA, anorm, rcond, info, batchCount);
+    return hipblasGecon<float>(
+        handle, norm, n, A, nullptr, lda, strideA, anorm, rcond, info, batchCount, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgeconStridedBatched(hipblasHandle_t         handle,
+                                                       const hipblasNormType_t norm,
+                                                       const int               n,
+                                                       double*                 A,
+                                                       const int               lda,
+                                                       const hipblasStride     strideA,
+                                                       const double*           anorm,
+                                                       double*                 rcond,
+                                                       int*                    info,
+                                                       const int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, norm, n, A, lda, strideA, anorm, rcond, info, batchCount);
+    return hipblasGecon<double>(
+        handle, norm, n, A, nullptr, lda, strideA, anorm, rcond, info, batchCount, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgeconStridedBatched(hipblasHandle_t         handle,
+                                                       const hipblasNormType_t norm,
+                                                       const int               n,
+                                                       hipblasComplex*         A,
+                                                       const int               lda,
+                                                       const hipblasStride     strideA,
+                                                       const float*            anorm,
+                                                       float*                  rcond,
+                                                       int*                    info,
+                                                       const int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, norm, n, A, lda, strideA, anorm, rcond, info, batchCount);
+    return hipblasGecon<hipblasComplex>(
+        handle, norm, n, A, nullptr, lda, strideA, anorm, rcond, info, batchCount, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgeconStridedBatched(hipblasHandle_t         handle,
+                                                       const hipblasNormType_t norm,
+                                                       const int               n,
+                                                       hipblasDoubleComplex*   A,
+                                                       const int               lda,
+                                                       const hipblasStride     strideA,
+                                                       const double*           anorm,
+                                                       double*                 rcond,
+                                                       int*                    info,
+                                                       const int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, norm, n, A, lda, strideA, anorm, rcond, info, batchCount);
+    return hipblasGecon<hipblasDoubleComplex>(
+        handle, norm, n, A, nullptr, lda, strideA, anorm, rcond, info, batchCount, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
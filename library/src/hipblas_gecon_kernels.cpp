@@ -0,0 +1,493 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gecon.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+// Largest work group, whose threads share the rows of the vectors of one estimate
+constexpr int gecon_threads = 256;
+
+// Largest grid. The work groups loop over the remaining matrices.
+constexpr int gecon_max_grid = 65535;
+
+// Vectors of one matrix up to this size are kept in local memory, larger ones in a scratch on the
+// device holding those of every work group, which limits the grid to gecon_scratch_bytes
+constexpr size_t gecon_shared_bytes  = 32768;
+constexpr size_t gecon_scratch_bytes = size_t(256) << 20;
+
+// Products of the inverse the estimate starts from, as ITMAX of LAPACK ?lacn2
+constexpr int gecon_max_iters = 5;
+
+// The complex types are only read and written, so both layouts of hipblasComplex map to this
+template <typename R>
+struct hipblasGeconComplex
+{
+    R x, y;
+
+    __device__ hipblasGeconComplex(R re = 0, R im = 0)
+        : x(re)
+        , y(im)
+    {
+    }
+};
+
+template <typename R>
+__device__ inline hipblasGeconComplex<R> operator-(hipblasGeconComplex<R> a,
+                                                   hipblasGeconComplex<R> b)
+{
+    return {a.x - b.x, a.y - b.y};
+}
+
+template <typename R>
+__device__ inline hipblasGeconComplex<R> operator*(hipblasGeconComplex<R> a,
+                                                   hipblasGeconComplex<R> b)
+{
+    return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x};
+}
+
+template <typename R>
+__device__ inline hipblasGeconComplex<R> operator/(hipblasGeconComplex<R> a,
+                                                   hipblasGeconComplex<R> b)
+{
+    R den = b.x * b.x + b.y * b.y;
+    return {(a.x * b.x + a.y * b.y) / den, (a.y * b.x - a.x * b.y) / den};
+}
+
+template <typename R>
+__device__ inline bool operator!=(hipblasGeconComplex<R> a, hipblasGeconComplex<R> b)
+{
+    return a.x != b.x || a.y != b.y;
+}
+
+template <typename R>
+__device__ inline R hipblasGeconAbs(R a)
+{
+    return a < 0 ? -a : a;
+}
+
+template <typename R>
+__device__ inline R hipblasGeconAbs(hipblasGeconComplex<R> a)
+{
+    return hypot(a.x, a.y);
+}
+
+template <typename R>
+__device__ inline R hipblasGeconConj(R a)
+{
+    return a;
+}
+
+template <typename R>
+__device__ inline hipblasGeconComplex<R> hipblasGeconConj(hipblasGeconComplex<R> a)
+{
+    return {a.x, -a.y};
+}
+
+__device__ inline float hipblasGeconSafeMin(float)
+{
+    return FLT_MIN;
+}
+
+__device__ inline double hipblasGeconSafeMin(double)
+{
+    return DBL_MIN;
+}
+
+// The sign vector of ?lacn2: +-1 for a real x, and x / |x| or 1 for a complex x
+template <typename R>
+__device__ inline R hipblasGeconSign(R a)
+{
+    return a >= 0 ? R(1) : R(-1);
+}
+
+template <typename R>
+__device__ inline hipblasGeconComplex<R> hipblasGeconSign(hipblasGeconComplex<R> a)
+{
+    R abs_a = hipblasGeconAbs(a);
+    return abs_a > hipblasGeconSafeMin(R(0)) ? hipblasGeconComplex<R>(a.x / abs_a, a.y / abs_a)
+                                              : hipblasGeconComplex<R>(1);
+}
+
+// The entry of the previous largest entry that dlacn2 compares, signed, and zlacn2 by magnitude
+template <typename R>
+__device__ inline R hipblasGeconLast(R a)
+{
+    return a;
+}
+
+template <typename R>
+__device__ inline R hipblasGeconLast(hipblasGeconComplex<R> a)
+{
+    return hipblasGeconAbs(a);
+}
+
+// Sum over the work group of the value of each thread. The threads are a power of two.
+template <typename R>
+__device__ R hipblasGeconSum(R value, R* red)
+{
+    red[threadIdx.x] = value;
+    __syncthreads();
+    for(int s = blockDim.x / 2; s > 0; s /= 2)
+    {
+        if(threadIdx.x < s)
+            red[threadIdx.x] += red[threadIdx.x + s];
+        __syncthreads();
+    }
+    R sum = red[0];
+    __syncthreads();
+    return sum;
+}
+
+template <typename T, typename R>
+__device__ R hipblasGeconAsum(const T* x, int n, R* red)
+{
+    R sum = 0;
+    for(int i = threadIdx.x; i < n; i += blockDim.x)
+        sum += hipblasGeconAbs(x[i]);
+    return hipblasGeconSum(sum, red);
+}
+
+// First index of the largest magnitude of x, as i?amax
+template <typename T, typename R>
+__device__ int hipblasGeconIamax(const T* x, int n, R* red, int* red_index)
+{
+    R   best  = -1;
+    int index = 0;
+    for(int i = threadIdx.x; i < n; i += blockDim.x)
+    {
+        R abs_x = hipblasGeconAbs(x[i]);
+        if(abs_x > best)
+        {
+            best  = abs_x;
+            index = i;
+        }
+    }
+    red[threadIdx.x]       = best;
+    red_index[threadIdx.x] = index;
+    __syncthreads();
+    for(int s = blockDim.x / 2; s > 0; s /= 2)
+    {
+        if(threadIdx.x < s)
+        {
+            R   other       = red[threadIdx.x + s];
+            int other_index = red_index[threadIdx.x + s];
+            if(other > red[threadIdx.x]
+               || (other == red[threadIdx.x] && other_index < red_index[threadIdx.x]))
+            {
+                red[threadIdx.x]       = other;
+                red_index[threadIdx.x] = other_index;
+            }
+        }
+        __syncthreads();
+    }
+    index = red_index[0];
+    __syncthreads();
+    return index;
+}
+
+// x := inv(A) x with A = L U, or x := inv(A)^H x when adjoint, where F holds the unit lower L and
+// the upper U of getrf. Every solve updates the rest of x by one column of its triangle at a
+// time, and divides by the diagonal of U once no column updates an entry any more.
+template <typename T>
+__device__ void hipblasGeconSolve(const T* F, int lda, int n, T* x, bool adjoint)
+{
+    __syncthreads();
+    if(!adjoint)
+    {
+        for(int j = 0; j < n - 1; j++)
+        {
+            T xj = x[j];
+            for(int i = j + 1 + threadIdx.x; i < n; i += blockDim.x)
+                x[i] = x[i] - F[i + size_t(j) * lda] * xj;
+            __syncthreads();
+        }
+        for(int j = n - 1; j > 0; j--)
+        {
+            T xj = x[j] / F[j + size_t(j) * lda];
+            for(int i = threadIdx.x; i < j; i += blockDim.x)
+                x[i] = x[i] - F[i + size_t(j) * lda] * xj;
+            __syncthreads();
+        }
+        for(int i = threadIdx.x; i < n; i += blockDim.x)
+            x[i] = x[i] / F[i + size_t(i) * lda];
+        __syncthreads();
+    }
+    else
+    {
+        // Row j of U and L is column j of U^H and L^H
+        for(int j = 0; j < n - 1; j++)
+        {
+            T xj = x[j] / hipblasGeconConj(F[j + size_t(j) * lda]);
+            for(int i = j + 1 + threadIdx.x; i < n; i += blockDim.x)
+                x[i] = x[i] - hipblasGeconConj(F[j + size_t(i) * lda]) * xj;
+            __syncthreads();
+        }
+        for(int i = threadIdx.x; i < n; i += blockDim.x)
+            x[i] = x[i] / hipblasGeconConj(F[i + size_t(i) * lda]);
+        __syncthreads();
+        for(int j = n - 1; j > 0; j--)
+        {
+            T xj = x[j];
+            for(int i = threadIdx.x; i < j; i += blockDim.x)
+                x[i] = x[i] - hipblasGeconConj(F[j + size_t(i) * lda]) * xj;
+            __syncthreads();
+        }
+    }
+}
+
+// The estimate of the 1-norm of inv(A), or of inv(A)^H for the infinity-norm of inv(A), of
+// LAPACK ?lacn2 with its reverse communication unrolled. signs keeps the sign vector of the real
+// estimate, whose repetition ends the iteration.
+template <typename T, typename R>
+__device__ R hipblasGeconEstimate(
+    const T* F, int lda, int n, bool one_norm, T* x, T* signs, R* red, int* red_index)
+{
+    constexpr bool real = std::is_same<T, R>::value;
+
+    for(int i = threadIdx.x; i < n; i += blockDim.x)
+        x[i] = T(R(1) / n);
+    hipblasGeconSolve(F, lda, n, x, !one_norm);
+    if(n == 1)
+        return hipblasGeconAbs(x[0]);
+
+    R est = hipblasGeconAsum(x, n, red);
+    for(int i = threadIdx.x; i < n; i += blockDim.x)
+    {
+        x[i] = hipblasGeconSign(x[i]);
+        if(real)
+            signs[i] = x[i];
+    }
+    hipblasGeconSolve(F, lda, n, x, one_norm);
+    int j = hipblasGeconIamax(x, n, red, red_index);
+
+    for(int iter = 2;; iter++)
+    {
+        for(int i = threadIdx.x; i < n; i += blockDim.x)
+            x[i] = T(i == j ? 1 : 0);
+        hipblasGeconSolve(F, lda, n, x, !one_norm);
+
+        R est_old = est;
+        est       = hipblasGeconAsum(x, n, red);
+        if(real)
+        {
+            R changed = 0;
+            for(int i = threadIdx.x; i < n; i += blockDim.x)
+                changed += hipblasGeconSign(x[i]) != signs[i];
+            if(hipblasGeconSum(changed, red) == 0)
+                break;
+        }
+        if(est <= est_old)
+            break;
+
+        for(int i = threadIdx.x; i < n; i += blockDim.x)
+        {
+            x[i] = hipblasGeconSign(x[i]);
+            if(real)
+                signs[i] = x[i];
+        }
+        hipblasGeconSolve(F, lda, n, x, one_norm);
+
+        // Every thread reads both entries before any overwrites x
+        int j_last = j;
+        j          = hipblasGeconIamax(x, n, red, red_index);
+        bool stuck = hipblasGeconLast(x[j_last]) == hipblasGeconAbs(x[j]);
+        __syncthreads();
+        if(stuck || iter >= gecon_max_iters)
+            break;
+    }
+
+    // The alternating vector catches matrices on which the iteration stalls
+    for(int i = threadIdx.x; i < n; i += blockDim.x)
+        x[i] = T((i % 2 ? -1 : 1) * (1 + R(i) / (n - 1)));
+    hipblasGeconSolve(F, lda, n, x, !one_norm);
+    R alternate = 2 * (hipblasGeconAsum(x, n, red) / (3 * n));
+    return alternate > est ? alternate : est;
+}
+
+// Work group b estimates matrices b, b + gridDim.x and so on. Its vectors are in local memory,
+// or at scratch + blockIdx.x * vectors * n when scratch is not null.
+template <typename T, typename R>
+__global__ void __launch_bounds__(gecon_threads)
+    hipblasGeconKernel(bool            one_norm,
+                       int             n,
+                       const T*        A,
+                       const T* const* A_array,
+                       int             lda,
+                       hipblasStride   strideA,
+                       const R*        anorm,
+                       R*              rcond,
+                       T*              scratch,
+                       int             batch_count)
+{
+    HIP_DYNAMIC_SHARED(double, gecon_local)
+    __shared__ R   red[gecon_threads];
+    __shared__ int red_index[gecon_threads];
+
+    constexpr int vectors = std::is_same<T, R>::value ? 2 : 1;
+    T* x = scratch ? scratch + size_t(blockIdx.x) * vectors * n : (T*)gecon_local;
+
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        const T* F = A_array ? A_array[b] : A + b * strideA;
+        R        a = anorm[b];
+
+        // As LAPACK ?gecon, rcond is 1 for an empty matrix and 0 for a zero norm, and an inverse
+        // whose norm is not finite is taken as singular
+        R result = 1;
+        if(n > 0)
+        {
+            R inverse = hipblasGeconEstimate(F, lda, n, one_norm, x, x + n, red, red_index);
+            if(a != a)
+                result = a;
+            else if(a == 0 || !(inverse > 0) || isinf(inverse))
+                result = 0;
+            else
+                result = (R(1) / inverse) / a;
+        }
+        if(threadIdx.x == 0)
+            rcond[b] = result;
+        __syncthreads();
+    }
+}
+
+template <typename T, typename R, typename Th>
+static hipblasStatus_t hipblasGeconLaunch(hipblasHandle_t  handle,
+                                          bool             one_norm,
+                                          int              n,
+                                          const Th*        A,
+                                          const Th* const* A_array,
+                                          int              lda,
+                                          hipblasStride    strideA,
+                                          const R*         anorm,
+                                          R*               rcond,
+                                          int              batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // A power of two of threads covering a column, at least a wavefront
+    int threads = 64;
+    while(threads < n && threads < gecon_threads)
+        threads *= 2;
+
+    constexpr int vectors = std::is_same<T, R>::value ? 2 : 1;
+    size_t        bytes   = sizeof(T) * vectors * n;
+    int           grid    = std::min(batch_count, gecon_max_grid);
+    T*            scratch = nullptr;
+    if(bytes > gecon_shared_bytes)
+    {
+        grid = int(std::min(size_t(grid), std::max(size_t(1), gecon_scratch_bytes / bytes)));
+        if(hipMallocAsync((void**)&scratch, bytes * grid, stream) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+    }
+
+    hipLaunchKernelGGL((hipblasGeconKernel<T, R>),
+                       dim3(grid),
+                       dim3(threads),
+                       scratch ? 0 : bytes,
+                       stream,
+                       one_norm,
+                       n,
+                       (const T*)A,
+                       (const T* const*)A_array,
+                       lda,
+                       strideA,
+                       anorm,
+                       rcond,
+                       scratch,
+                       batch_count);
+    status = hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                             : HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    if(scratch && hipFreeAsync(scratch, stream) != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    return status;
+}
+
+hipblasStatus_t hipblasGeconKernels(hipblasHandle_t     handle,
+                                    bool                one_norm,
+                                    int                 n,
+                                    const float*        A,
+                                    const float* const* A_array,
+                                    int                 lda,
+                                    hipblasStride       strideA,
+                                    const float*        anorm,
+                                    float*              rcond,
+                                    int                 batch_count)
+{
+    return hipblasGeconLaunch<float>(
+        handle, one_norm, n, A, A_array, lda, strideA, anorm, rcond, batch_count);
+}
+
+hipblasStatus_t hipblasGeconKernels(hipblasHandle_t      handle,
+                                    bool                 one_norm,
+                                    int                  n,
+                                    const double*        A,
+                                    const double* const* A_array,
+                                    int                  lda,
+                                    hipblasStride        strideA,
+                                    const double*        anorm,
+                                    double*              rcond,
+                                    int                  batch_count)
+{
+    return hipblasGeconLaunch<double>(
+        handle, one_norm, n, A, A_array, lda, strideA, anorm, rcond, batch_count);
+}
+
+hipblasStatus_t hipblasGeconKernels(hipblasHandle_t              handle,
+                                    bool                         one_norm,
+                                    int                          n,
+                                    const hipblasComplex*        A,
+                                    const hipblasComplex* const* A_array,
+                                    int                          lda,
+                                    hipblasStride                strideA,
+                                    const float*                 anorm,
+                                    float*                       rcond,
+                                    int                          batch_count)
+{
+    return hipblasGeconLaunch<hipblasGeconComplex<float>>(
+        handle, one_norm, n, A, A_array, lda, strideA, anorm, rcond, batch_count);
+}
+
+hipblasStatus_t hipblasGeconKernels(hipblasHandle_t                    handle,
+                                    bool                               one_norm,
+                                    int                                n,
+                                    const hipblasDoubleComplex*        A,
+                                    const hipblasDoubleComplex* const* A_array,
+                                    int                                lda,
+                                    hipblasStride                      strideA,
+                                    const double*                      anorm,
+                                    double*                            rcond,
+                                    int                                batch_count)
+{
+    return hipblasGeconLaunch<hipblasGeconComplex<double>>(
+        handle, one_norm, n, A, A_array, lda, strideA, anorm, rcond, batch_count);
+}
@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_3m.hpp"
+#include "pointer_mode.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+// Complex and real hipBLAS functions of one precision
+template <typename T>
+struct hipblasGemm3mTraits;
+
+template <>
+struct hipblasGemm3mTraits<hipblasComplex>
+{
+    using real = float;
+
+    static constexpr auto complex_gemm = hipblasCgemm;
+    static constexpr auto complex_geam = hipblasCgeam;
+    static constexpr auto gemm         = hipblasSgemm;
+    static constexpr auto geam         = hipblasSgeam;
+    static constexpr auto copy         = hipblasScopyStridedBatched;
+};
+
+template <>
+struct hipblasGemm3mTraits<hipblasDoubleComplex>
+{
+    using real = double;
+
+    static constexpr auto complex_gemm = hipblasZgemm;
+    static constexpr auto complex_geam = hipblasZgeam;
+    static constexpr auto gemm         = hipblasDgemm;
+    static constexpr auto geam         = hipblasDgeam;
+    static constexpr auto copy         = hipblasDcopyStridedBatched;
+};
+
+template <typename T>
+static hipblasStatus_t hipblasGemm3mTemplate(hipblasHandle_t    handle,
+                                             hipblasOperation_t transa,
+                                             hipblasOperation_t transb,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const T*           alpha,
+                                             const T*           A,
+                                             int                lda,
+                                             const T*           B,
+                                             int                ldb,
+                                             const T*           beta,
+                                             T*                 C,
+                                             int                ldc)
+{
+    using traits = hipblasGemm3mTraits<T>;
+    using R      = typename traits::real;
+
+    auto complex_gemm = [&]() {
+        return traits::complex_gemm(
+            handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    };
+
+    bool a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+    int  a_rows = a_n ? m : k, a_cols = a_n ? k : m;
+    int  b_rows = b_n ? k : n, b_cols = b_n ? n : k;
+    bool valid  = (a_n || transa == HIPBLAS_OP_T || transa == HIPBLAS_OP_C)
+                 && (b_n || transb == HIPBLAS_OP_T || transb == HIPBLAS_OP_C) && lda >= a_rows
+                 && ldb >= b_rows && ldc >= m && alpha && beta && A && B && C;
+    if(!valid || std::min({m, n, k}) < gemm_3m_min_size)
+        return complex_gemm();
+
+    hipStream_t            stream;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    hipblasStatus_t        status         = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return complex_gemm();
+
+    // Interleaved product P, then the real m x n products T1 = Ar*Br, T2 = Ai*Bi and
+    // T3 = (Ar + Ai)*(Br + Bi), then the parts and sums of A and of B
+    size_t a_size = size_t(a_rows) * a_cols, b_size = size_t(b_rows) * b_cols;
+    size_t c_size = size_t(m) * n;
+
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    if(scratch.allocate(sizeof(R) * (5 * c_size + 3 * a_size + 3 * b_size))
+       != HIPBLAS_STATUS_SUCCESS)
+        return complex_gemm();
+    R* P  = reinterpret_cast<R*>(scratch.base);
+    R* T1 = P + 2 * c_size;
+    R* T2 = T1 + c_size;
+    R* T3 = T2 + c_size;
+    R* Ar = T3 + c_size;
+    R* Ai = Ar + a_size;
+    R* As = Ai + a_size;
+    R* Br = As + a_size;
+    R* Bi = Br + b_size;
+    R* Bs = Bi + b_size;
+
+    hipblasPointerModeGuard pointer_mode{handle, HIPBLAS_POINTER_MODE_HOST};
+    status = hipblasGetPointerMode(handle, &pointer_mode.mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+    // A conjugated operand has its imaginary part negated, so the signs go into the sums and
+    // into the combination instead of an extra pass
+    const R one = 1, minus_one = -1, zero = 0;
+    const R a_sign = transa == HIPBLAS_OP_C ? -1 : 1;
+    const R b_sign = transb == HIPBLAS_OP_C ? -1 : 1;
+    const R t_sign = -a_sign * b_sign;
+
+    auto split = [&](const T* X, int rows, int cols, int ld, const R* sign, R* Xr, R* Xi, R* Xs) {
+        const R* x = reinterpret_cast<const R*>(X);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = traits::copy(handle, rows, x, 2, 2 * hipblasStride(ld), Xr, 1, rows, cols);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = traits::copy(handle, rows, x + 1, 2, 2 * hipblasStride(ld), Xi, 1, rows, cols);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = traits::geam(handle,
+                                  HIPBLAS_OP_N,
+                                  HIPBLAS_OP_N,
+                                  rows,
+                                  cols,
+                                  &one,
+                                  Xr,
+                                  rows,
+                                  sign,
+                                  Xi,
+                                  rows,
+                                  Xs,
+                                  rows);
+    };
+    split(A, a_rows, a_cols, lda, &a_sign, Ar, Ai, As);
+    split(B, b_rows, b_cols, ldb, &b_sign, Br, Bi, Bs);
+
+    hipblasOperation_t real_transa = a_n ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    hipblasOperation_t real_transb = b_n ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+
+    auto product = [&](const R* X, const R* Y, R* Z) {
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = traits::gemm(
+                handle, real_transa, real_transb, m, n, k, &one, X, a_rows, Y, b_rows, &zero, Z, m);
+    };
+    product(Ar, Br, T1);
+    product(Ai, Bi, T2);
+    product(As, Bs, T3);
+
+    // In place, Im = T3 - T1 + t_sign*T2 and Re = T1 + t_sign*T2
+    auto update = [&](R* Z, const R* sign, const R* X) {
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = traits::geam(
+                handle, HIPBLAS_OP_N, HIPBLAS_OP_N, m, n, &one, Z, m, sign, X, m, Z, m);
+    };
+    update(T3, &minus_one, T1);
+    update(T3, &t_sign, T2);
+    update(T1, &t_sign, T2);
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = traits::copy(handle, m, T1, 1, m, P, 2, 2 * hipblasStride(m), n);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = traits::copy(handle, m, T3, 1, m, P + 1, 2, 2 * hipblasStride(m), n);
+
+    // C = alpha*P + beta*C with the scalars of the caller
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, pointer_mode.mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = traits::complex_geam(handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      m,
+                                      n,
+                                      alpha,
+                                      reinterpret_cast<const T*>(P),
+                                      m,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      C,
+                                      ldc);
+    return status;
+}
+
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t       handle,
+                              hipblasOperation_t    transa,
+                              hipblasOperation_t    transb,
+                              int                   m,
+                              int                   n,
+                              int                   k,
+                              const hipblasComplex* alpha,
+                              const hipblasComplex* A,
+                              int                   lda,
+                              const hipblasComplex* B,
+                              int                   ldb,
+                              const hipblasComplex* beta,
+                              hipblasComplex*       C,
+                              int                   ldc)
+{
+    return hipblasGemm3mTemplate(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t             handle,
+                              hipblasOperation_t          transa,
+                              hipblasOperation_t          transb,
+                              int                         m,
+                              int                         n,
+                              int                         k,
+                              const hipblasDoubleComplex* alpha,
+                              const hipblasDoubleComplex* A,
+                              int                         lda,
+                              const hipblasDoubleComplex* B,
+                              int                         ldb,
+                              const hipblasDoubleComplex* beta,
+                              hipblasDoubleComplex*       C,
+                              int                         ldc)
+{
+    return hipblasGemm3mTemplate(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
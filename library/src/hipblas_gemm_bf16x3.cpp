@@ -0,0 +1,159 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_bf16x3.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <mutex>
+#include <unordered_set>
+
+// The handles in HIPBLAS_FP32_EMULATED_BF16X3_MATH
+static std::mutex                          bf16x3_mutex;
+static std::unordered_set<hipblasHandle_t> bf16x3_handles;
+
+bool hipblasGemmBf16x3Built()
+{
+#ifdef HIPBLAS_GEMM_BF16X3
+    return true;
+#else
+    return false;
+#endif
+}
+
+void hipblasGemmBf16x3SetMath(hipblasHandle_t handle, bool enable)
+{
+    std::lock_guard<std::mutex> lock(bf16x3_mutex);
+    if(enable)
+        bf16x3_handles.insert(handle);
+    else
+        bf16x3_handles.erase(handle);
+}
+
+bool hipblasGemmBf16x3Math(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(bf16x3_mutex);
+    return bf16x3_handles.count(handle) != 0;
+}
+
+void hipblasGemmBf16x3Erase(hipblasHandle_t handle)
+{
+    hipblasGemmBf16x3SetMath(handle, false);
+}
+
+bool hipblasGemmBf16x3(hipblasHandle_t    handle,
+                       hipblasOperation_t transa,
+                       hipblasOperation_t transb,
+                       int                m,
+                       int                n,
+                       int                k,
+                       const float*       alpha,
+                       const float*       A,
+                       int                lda,
+                       hipblasStride      stride_a,
+                       const float*       B,
+                       int                ldb,
+                       hipblasStride      stride_b,
+                       const float*       beta,
+                       float*             C,
+                       int                ldc,
+                       hipblasStride      stride_c,
+                       int                batch_count,
+                       hipblasStatus_t&   status)
+{
+#ifndef HIPBLAS_GEMM_BF16X3
+    return false;
+#else
+    // Invalid arguments are left to the backend, as are depths whose 3 k overflows
+    bool a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+    if(!handle || m <= 0 || n <= 0 || k <= 0 || batch_count <= 0 || !alpha || !beta || !A || !B
+       || !C || lda < std::max(1, a_n ? m : k) || ldb < std::max(1, b_n ? k : n) || ldc < m
+       || k > std::numeric_limits<int>::max() / 3)
+        return false;
+
+    hipStream_t            stream;
+    hipblasPointerMode_t   mode;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return false;
+
+    // With alpha == 0, A and B are not read
+    if(mode == HIPBLAS_POINTER_MODE_HOST && *alpha == 0)
+        return false;
+
+    // [Ahi Ahi Alo] and [Bhi; Blo; Bhi], stored as 3 k x m and 3 k x n column-major matrices
+    int           k3       = 3 * k;
+    hipblasStride stride_s = hipblasStride(k3) * m;
+    hipblasStride stride_t = hipblasStride(k3) * n;
+    size_t        a_bytes  = (sizeof(hipblasBfloat16) * stride_s * batch_count + 255) / 256 * 256;
+    size_t        bytes    = a_bytes + sizeof(hipblasBfloat16) * stride_t * batch_count;
+
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    if(hipMallocAsync((void**)&scratch.base, bytes, stream) != hipSuccess)
+    {
+        scratch.base = nullptr;
+        (void)hipGetLastError();
+        return false;
+    }
+    hipblasBfloat16* As = (hipblasBfloat16*)scratch.base;
+    hipblasBfloat16* Bs = (hipblasBfloat16*)(scratch.base + a_bytes);
+
+    // From here on the call is emulated and its status is returned. The rows of op( A ) are the
+    // columns of A with transa, and the columns of op( B ) those of B without transb. The gemm
+    // runs column-major, as a call made from within hipBLAS, with the scalars of the caller.
+    status = hipblasBf16x3Split(
+        stream, m, k, A, lda, stride_a, !a_n, false, batch_count, As, stride_s);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasBf16x3Split(
+            stream, n, k, B, ldb, stride_b, b_n, true, batch_count, Bs, stride_t);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                HIPBLAS_OP_T,
+                                                HIPBLAS_OP_N,
+                                                m,
+                                                n,
+                                                k3,
+                                                alpha,
+                                                As,
+                                                HIP_R_16BF,
+                                                k3,
+                                                stride_s,
+                                                Bs,
+                                                HIP_R_16BF,
+                                                k3,
+                                                stride_t,
+                                                beta,
+                                                C,
+                                                HIP_R_32F,
+                                                ldc,
+                                                stride_c,
+                                                batch_count,
+                                                HIPBLAS_COMPUTE_32F,
+                                                HIPBLAS_GEMM_DEFAULT);
+    return true;
+#endif
+}
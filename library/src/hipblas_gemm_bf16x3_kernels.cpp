@@ -0,0 +1,105 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "convert_device.hpp"
+#include "gemm_bf16x3.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+// Threads of a work group, each splitting one element per step of a grid-stride loop
+constexpr int bf16x3_threads = 256;
+
+// Largest grid in x for the elements and in y for the batches. The work groups loop over the rest.
+constexpr int bf16x3_max_grid = 65535;
+
+// The elements of a batch are taken in the order they are stored in X, so the reads are coalesced
+__global__ void __launch_bounds__(bf16x3_threads)
+    hipblasBf16x3SplitKernel(int                    lines,
+                             int                    k,
+                             const float*           X,
+                             int                    ld,
+                             hipblasStride          stride_x,
+                             bool                   contiguous,
+                             bool                   lo_second,
+                             int                    batch_count,
+                             hipblasDeviceBfloat16* out,
+                             hipblasStride          stride_out)
+{
+    const size_t count = size_t(lines) * k;
+    const size_t step  = size_t(gridDim.x) * bf16x3_threads;
+    for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+    {
+        const float*           x = X + b * stride_x;
+        hipblasDeviceBfloat16* y = out + b * stride_out;
+        for(size_t e = size_t(blockIdx.x) * bf16x3_threads + threadIdx.x; e < count; e += step)
+        {
+            size_t r = contiguous ? e / k : e % lines;
+            size_t q = contiguous ? e % k : e / lines;
+            float  a = x[contiguous ? q + r * ld : r + q * ld];
+
+            // An infinity or NaN is all in hi, so the products keep it
+            hipblasDeviceBfloat16 hi, lo;
+            hipblasDeviceFromFloat(a, hi);
+            float rest = hipblasDeviceToFloat(hi);
+            hipblasDeviceFromFloat(isfinite(rest) ? a - rest : 0.0f, lo);
+
+            hipblasDeviceBfloat16* line = y + r * 3 * k;
+            line[q]                     = hi;
+            line[k + q]                 = lo_second ? lo : hi;
+            line[2 * size_t(k) + q]     = lo_second ? hi : lo;
+        }
+    }
+}
+
+hipblasStatus_t hipblasBf16x3Split(hipStream_t      stream,
+                                   int              lines,
+                                   int              k,
+                                   const float*     X,
+                                   int              ld,
+                                   hipblasStride    stride_x,
+                                   bool             contiguous,
+                                   bool             lo_second,
+                                   int              batch_count,
+                                   hipblasBfloat16* out,
+                                   hipblasStride    stride_out)
+{
+    size_t blocks = (size_t(lines) * k + bf16x3_threads - 1) / bf16x3_threads;
+    dim3   grid(unsigned(std::min(blocks, size_t(bf16x3_max_grid))),
+              std::min(batch_count, bf16x3_max_grid));
+    hipLaunchKernelGGL(hipblasBf16x3SplitKernel,
+                       grid,
+                       dim3(bf16x3_threads),
+                       0,
+                       stream,
+                       lines,
+                       k,
+                       X,
+                       ld,
+                       stride_x,
+                       contiguous,
+                       lo_second,
+                       batch_count,
+                       (hipblasDeviceBfloat16*)out,
+                       stride_out);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
@@ -0,0 +1,311 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// Block-sparse times dense gemm. Only the nonzero blocks of A are multiplied: the block products
+// of a block row all update the same rows of C, so they run in waves, wave w holding the w-th
+// nonzero block of every block row that has one. Each wave is one batched gemm of blockDim x n x
+// blockDim problems, the first with beta and the others adding to C. The pointer arrays of all
+// waves are gathered into one device buffer, and the call returns once the stream is done with it.
+
+// Bytes ahead of the pointer arrays in the scratch, holding the one beta of the waves after the
+// first in device pointer mode
+static constexpr size_t block_sparse_one_bytes = 256;
+
+// Writes 1 in the scalar type of compute_type to one, which holds 16 bytes. The imaginary part of
+// a complex one is zero.
+static void hipblasBlockSparseOne(hipblasComputeType_t compute_type, char* one)
+{
+    const uint16_t half_one   = 0x3c00;
+    const float    float_one  = 1;
+    const double   double_one = 1;
+    const int32_t  int_one    = 1;
+
+    std::memset(one, 0, 16);
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        std::memcpy(one, &half_one, sizeof(half_one));
+        break;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        std::memcpy(one, &double_one, sizeof(double_one));
+        break;
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        std::memcpy(one, &int_one, sizeof(int_one));
+        break;
+    default:
+        std::memcpy(one, &float_one, sizeof(float_one));
+        break;
+    }
+}
+
+static hipblasStatus_t hipblasGemmBlockSparse(hipblasHandle_t      handle,
+                                              hipblasOperation_t   transB,
+                                              int                  m,
+                                              int                  n,
+                                              int                  k,
+                                              int                  block_dim,
+                                              const void*          alpha,
+                                              const void*          A,
+                                              hipDataType          a_type,
+                                              const int*           block_row_ptr,
+                                              const int*           block_col_ind,
+                                              const void*          B,
+                                              hipDataType          b_type,
+                                              int                  ldb,
+                                              const void*          beta,
+                                              void*                C,
+                                              hipDataType          c_type,
+                                              int                  ldc,
+                                              hipblasComputeType_t compute_type)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool b_n = transB == HIPBLAS_OP_N;
+    if(!b_n && transB != HIPBLAS_OP_T && transB != HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || k < 0 || block_dim < 1 || m % block_dim || k % block_dim
+       || ldb < std::max(1, b_n ? k : n) || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!hipblasDatatypeFloating(a_type) || !hipblasDatatypeFloating(b_type)
+       || !hipblasDatatypeFloating(c_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    size_t a_size = hipblasDatatypeSize(a_type);
+    size_t b_size = hipblasDatatypeSize(b_type);
+    size_t c_size = hipblasDatatypeSize(c_type);
+
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || !block_row_ptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Check the whole index before anything is launched
+    const int block_rows = m / block_dim;
+    const int block_cols = k / block_dim;
+    int       waves      = 0;
+    int       empty_rows = 0;
+    if(block_row_ptr[0] != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int i = 0; i < block_rows; i++)
+    {
+        int count = block_row_ptr[i + 1] - block_row_ptr[i];
+        if(count < 0 || count > block_cols)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        waves = std::max(waves, count);
+        empty_rows += !count;
+    }
+
+    const int nnzb = block_row_ptr[block_rows];
+    if(nnzb && (!A || !B || !block_col_ind))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int b = 0; b < nnzb; b++)
+        if(block_col_ind[b] < 0 || block_col_ind[b] >= block_cols)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The pointer arrays are uploaded from the host and the call waits for them
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // Pointers of A, B and C of every problem, the empty block rows first and then wave after
+    // wave, behind the one
+    const size_t problems   = size_t(nnzb) + empty_rows;
+    const size_t block_size = a_size * block_dim * block_dim;
+    const size_t c_row      = c_size * block_dim;
+    const size_t b_row      = b_size * block_dim * (b_n ? 1 : size_t(ldb));
+
+    std::vector<void*> host(block_sparse_one_bytes / sizeof(void*) + 3 * problems);
+    hipblasBlockSparseOne(compute_type, reinterpret_cast<char*>(host.data()));
+
+    void** a_host = host.data() + block_sparse_one_bytes / sizeof(void*);
+    void** b_host = a_host + problems;
+    void** c_host = b_host + problems;
+    size_t p      = 0;
+
+    // The empty block rows only scale C by beta, with k = 0, so A and B are not read
+    for(int i = 0; i < block_rows; i++)
+        if(block_row_ptr[i + 1] == block_row_ptr[i])
+        {
+            a_host[p] = b_host[p] = c_host[p] = static_cast<char*>(C) + c_row * i;
+            p++;
+        }
+
+    std::vector<int> wave_size(waves);
+    for(int w = 0; w < waves; w++)
+        for(int i = 0; i < block_rows; i++)
+        {
+            int b = block_row_ptr[i] + w;
+            if(b < block_row_ptr[i + 1])
+            {
+                a_host[p] = (void*)(static_cast<const char*>(A) + block_size * b);
+                b_host[p] = (void*)(static_cast<const char*>(B) + b_row * block_col_ind[b]);
+                c_host[p] = static_cast<char*>(C) + c_row * i;
+                wave_size[w]++;
+                p++;
+            }
+        }
+
+    hipblasDeviceScratch scratch;
+    if(hipMalloc((void**)&scratch.base, sizeof(void*) * host.size()) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    if(hipMemcpyAsync(
+           scratch.base, host.data(), sizeof(void*) * host.size(), hipMemcpyHostToDevice, stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    const void* one      = mode == HIPBLAS_POINTER_MODE_DEVICE ? (void*)scratch.base : host.data();
+    void**      a_device = reinterpret_cast<void**>(scratch.base + block_sparse_one_bytes);
+    void**      b_device = a_device + problems;
+    void**      c_device = b_device + problems;
+
+    auto batch = [&](size_t first, int count, int depth, const void* scalar_beta) {
+        return hipblasGemmBatchedEx_v2(handle,
+                                       HIPBLAS_OP_N,
+                                       transB,
+                                       block_dim,
+                                       n,
+                                       depth,
+                                       alpha,
+                                       (const void**)(a_device + first),
+                                       a_type,
+                                       block_dim,
+                                       (const void**)(b_device + first),
+                                       b_type,
+                                       ldb,
+                                       scalar_beta,
+                                       c_device + first,
+                                       c_type,
+                                       ldc,
+                                       count,
+                                       compute_type,
+                                       HIPBLAS_GEMM_DEFAULT);
+    };
+
+    p = 0;
+    if(empty_rows)
+    {
+        status = batch(p, empty_rows, 0, beta);
+        p += empty_rows;
+    }
+    for(int w = 0; w < waves && status == HIPBLAS_STATUS_SUCCESS; w++)
+    {
+        status = batch(p, wave_size[w], block_dim, w ? one : beta);
+        p += wave_size[w];
+    }
+
+    if(hipStreamSynchronize(stream) != hipSuccess && status == HIPBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+
+extern "C" hipblasStatus_t hipblasGemmBlockSparseEx(hipblasHandle_t      handle,
+                                                    hipblasOperation_t   transB,
+                                                    int                  m,
+                                                    int                  n,
+                                                    int                  k,
+                                                    int                  blockDim,
+                                                    const void*          alpha,
+                                                    const void*          A,
+                                                    hipDataType          aType,
+                                                    const int*           blockRowPtr,
+                                                    const int*           blockColInd,
+                                                    const void*          B,
+                                                    hipDataType          bType,
+                                                    int                  ldb,
+                                                    const void*          beta,
+                                                    void*                C,
+                                                    hipDataType          cType,
+                                                    int                  ldc,
+                                                    hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  blockDim,
+                  alpha,
+                  A,
+                  aType,
+                  blockRowPtr,
+                  blockColInd,
+                  B,
+                  bType,
+                  ldb,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  computeType);
+    return hipblasGemmBlockSparse(handle,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  blockDim,
+                                  alpha,
+                                  A,
+                                  aType,
+                                  blockRowPtr,
+                                  blockColInd,
+                                  B,
+                                  bType,
+                                  ldb,
+                                  beta,
+                                  C,
+                                  cType,
+                                  ldc,
+                                  computeType);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
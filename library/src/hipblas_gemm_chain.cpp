@@ -0,0 +1,227 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "gemm_chain.hpp"
+#include "layer.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+// Bytes ahead of the intermediates in the scratch, holding the zero beta of the first gemm in
+// device pointer mode. Zero bits are a zero of every scalar type.
+static constexpr size_t gemm_chain_zero_bytes = 256;
+
+static hipblasStatus_t hipblasGemmChainCheck(hipblasHandle_t               handle,
+                                             const hipblasGemmChainDesc_t* desc)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!desc)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    const hipblasGemmChainDesc_t& d = *desc;
+
+    bool a_n = d.transA == HIPBLAS_OP_N, b_n = d.transB == HIPBLAS_OP_N,
+         e_n = d.transE == HIPBLAS_OP_N;
+    if((!a_n && d.transA != HIPBLAS_OP_T && d.transA != HIPBLAS_OP_C)
+       || (!b_n && d.transB != HIPBLAS_OP_T && d.transB != HIPBLAS_OP_C)
+       || (!e_n && d.transE != HIPBLAS_OP_T && d.transE != HIPBLAS_OP_C)
+       || (d.epilogue != HIPBLAS_EPILOGUE_DEFAULT && d.epilogue != HIPBLAS_EPILOGUE_RELU
+           && d.epilogue != HIPBLAS_EPILOGUE_GELU))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    if(d.m < 0 || d.n < 0 || d.k < 0 || d.p < 0 || d.batchCount < 0
+       || d.lda < std::max(1, a_n ? d.m : d.k) || d.ldb < std::max(1, b_n ? d.k : d.n)
+       || d.lde < std::max(1, e_n ? d.n : d.p) || d.ldd < std::max(1, d.m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!hipblasDatatypeFloating(d.dataType) || hipblasDatatypeComplex(d.dataType))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+static hipblasStatus_t hipblasGemmChain(hipblasHandle_t               handle,
+                                        const hipblasGemmChainDesc_t* desc,
+                                        const void*                   alpha1,
+                                        const void*                   A,
+                                        const void*                   B,
+                                        const void*                   alpha2,
+                                        const void*                   E,
+                                        const void*                   beta2,
+                                        void*                         D)
+{
+    hipblasStatus_t status = hipblasGemmChainCheck(handle, desc);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    const hipblasGemmChainDesc_t& d = *desc;
+    if(!d.m || !d.p || !d.batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha1 || !alpha2 || !beta2 || !D || (d.n && !E) || (d.n && d.k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+#ifdef HIPBLAS_GEMM_CHAIN
+    status = hipblasGemmChainKernels(stream,
+                                     mode == HIPBLAS_POINTER_MODE_DEVICE,
+                                     d,
+                                     static_cast<const float*>(alpha1),
+                                     A,
+                                     B,
+                                     static_cast<const float*>(alpha2),
+                                     E,
+                                     static_cast<const float*>(beta2),
+                                     D);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+    status = HIPBLAS_STATUS_SUCCESS;
+#endif
+
+    // T_i, with leading dimension m, written by the first gemm and read by the second
+    size_t        size     = hipblasDatatypeSize(d.dataType);
+    hipblasStride stride_T = hipblasStride(d.m) * d.n;
+    bool          device   = mode == HIPBLAS_POINTER_MODE_DEVICE;
+    size_t        offset   = device ? gemm_chain_zero_bytes : 0;
+    size_t        bytes    = offset + size * stride_T * d.batchCount;
+
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    if(bytes && hipMallocAsync((void**)&scratch.base, bytes, stream) != hipSuccess)
+    {
+        scratch.base = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    if(device && hipMemsetAsync(scratch.base, 0, gemm_chain_zero_bytes, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    static const double zero_host[2] = {0, 0};
+    const void*         zero         = device ? static_cast<const void*>(scratch.base) : zero_host;
+    char*               T            = scratch.base + offset;
+
+    if(d.epilogue == HIPBLAS_EPILOGUE_DEFAULT)
+        status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                d.transA,
+                                                d.transB,
+                                                d.m,
+                                                d.n,
+                                                d.k,
+                                                alpha1,
+                                                A,
+                                                d.dataType,
+                                                d.lda,
+                                                d.strideA,
+                                                B,
+                                                d.dataType,
+                                                d.ldb,
+                                                d.strideB,
+                                                zero,
+                                                T,
+                                                d.dataType,
+                                                d.m,
+                                                stride_T,
+                                                d.batchCount,
+                                                d.computeType,
+                                                HIPBLAS_GEMM_DEFAULT);
+    else
+        for(int b = 0; b < d.batchCount && status == HIPBLAS_STATUS_SUCCESS; b++)
+            status = hipblasGemmEpilogueEx(handle,
+                                           d.transA,
+                                           d.transB,
+                                           d.m,
+                                           d.n,
+                                           d.k,
+                                           alpha1,
+                                           static_cast<const char*>(A) + size * b * d.strideA,
+                                           d.dataType,
+                                           d.lda,
+                                           static_cast<const char*>(B) + size * b * d.strideB,
+                                           d.dataType,
+                                           d.ldb,
+                                           zero,
+                                           T + size * b * stride_T,
+                                           d.dataType,
+                                           d.m,
+                                           d.computeType,
+                                           d.epilogue,
+                                           nullptr,
+                                           nullptr,
+                                           0);
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                HIPBLAS_OP_N,
+                                                d.transE,
+                                                d.m,
+                                                d.p,
+                                                d.n,
+                                                alpha2,
+                                                T,
+                                                d.dataType,
+                                                d.m,
+                                                stride_T,
+                                                E,
+                                                d.dataType,
+                                                d.lde,
+                                                d.strideE,
+                                                beta2,
+                                                D,
+                                                d.dataType,
+                                                d.ldd,
+                                                d.strideD,
+                                                d.batchCount,
+                                                d.computeType,
+                                                HIPBLAS_GEMM_DEFAULT);
+    return status;
+}
+
+extern "C" hipblasStatus_t hipblasGemmChainEx(hipblasHandle_t               handle,
+                                              const hipblasGemmChainDesc_t* desc,
+                                              const void*                   alpha1,
+                                              const void*                   A,
+                                              const void*                   B,
+                                              const void*                   alpha2,
+                                              const void*                   E,
+                                              const void*                   beta2,
+                                              void*                         D)
+try
+{
+    HIPBLAS_LAYER(handle, desc, alpha1, A, B, alpha2, E, beta2, D);
+    // The descriptor describes column-major matrices only
+    if(hipblasLayoutRowMajor())
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return hipblasGemmChain(handle, desc, alpha1, A, B, alpha2, E, beta2, D);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,261 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_chain.hpp"
+#include "convert_device.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+// Threads of a work group, and rows of T it forms
+constexpr int gemm_chain_threads = 256;
+constexpr int gemm_chain_rows    = 16;
+
+// Columns of op( A ) staged in shared memory at a time, one element per thread
+constexpr int gemm_chain_k_block = gemm_chain_threads / gemm_chain_rows;
+
+// Elements of the rows of T that one thread accumulates in registers
+constexpr int gemm_chain_elements = gemm_chain_rows * gemm_chain_max_n / gemm_chain_threads;
+
+// Largest grid in z. The work groups loop over the remaining chains.
+constexpr int gemm_chain_max_grid = 65535;
+
+// Element (i, j) of op( A )
+template <typename T>
+__device__ inline float hipblasGemmChainElement(const T* A, int lda, bool trans, int i, int j)
+{
+    return hipblasDeviceToFloat(trans ? A[j + size_t(i) * lda] : A[i + size_t(j) * lda]);
+}
+
+// Same approximation as hipblasGemmEpilogueEx
+__device__ inline float hipblasGemmChainAct(hipblasEpilogue_t epilogue, float x)
+{
+    if(epilogue == HIPBLAS_EPILOGUE_RELU)
+        return x > 0 ? x : 0;
+    if(epilogue == HIPBLAS_EPILOGUE_GELU)
+    {
+        const float sqrt_2_over_pi = 0.7978845608f;
+        return 0.5f * x * (1.0f + tanhf(sqrt_2_over_pi * (x + 0.044715f * x * x * x)));
+    }
+    return x;
+}
+
+// Work group (x, 0, z) forms rows x * gemm_chain_rows onwards of T_b in t and multiplies them by
+// op( E_b ) into the same rows of D_b, for b = z, z + gridDim.z, ... Element e of the rows of T,
+// in row e % gemm_chain_rows and column e / gemm_chain_rows, is accumulated by thread
+// e % gemm_chain_threads and stored in t[e].
+template <typename T>
+__global__ void __launch_bounds__(gemm_chain_threads)
+    hipblasGemmChainKernel(hipblasOperation_t transA,
+                           hipblasOperation_t transB,
+                           hipblasOperation_t transE,
+                           hipblasEpilogue_t  epilogue,
+                           int                m,
+                           int                n,
+                           int                k,
+                           int                p,
+                           const float*       alpha1_device,
+                           float              alpha1_host,
+                           const T*           A,
+                           int                lda,
+                           hipblasStride      stride_A,
+                           const T*           B,
+                           int                ldb,
+                           hipblasStride      stride_B,
+                           const float*       alpha2_device,
+                           float              alpha2_host,
+                           const T*           E,
+                           int                lde,
+                           hipblasStride      stride_E,
+                           const float*       beta2_device,
+                           float              beta2_host,
+                           T*                 D,
+                           int                ldd,
+                           hipblasStride      stride_D,
+                           int                batch_count)
+{
+    __shared__ float a_block[gemm_chain_k_block][gemm_chain_rows];
+    __shared__ float t[gemm_chain_max_n * gemm_chain_rows];
+
+    float alpha1 = alpha1_device ? *alpha1_device : alpha1_host;
+    float alpha2 = alpha2_device ? *alpha2_device : alpha2_host;
+    float beta2  = beta2_device ? *beta2_device : beta2_host;
+
+    bool ta = transA != HIPBLAS_OP_N, tb = transB != HIPBLAS_OP_N, te = transE != HIPBLAS_OP_N;
+
+    int row0 = blockIdx.x * gemm_chain_rows;
+    int tid  = threadIdx.x;
+    int size = gemm_chain_rows * n;
+
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        const T* A_b = A + b * stride_A;
+        const T* B_b = B + b * stride_B;
+        const T* E_b = E + b * stride_E;
+        T*       D_b = D + b * stride_D;
+
+        float acc[gemm_chain_elements];
+#pragma unroll
+        for(int e = 0; e < gemm_chain_elements; e++)
+            acc[e] = 0;
+
+        for(int l0 = 0; l0 < k; l0 += gemm_chain_k_block)
+        {
+            int i = tid % gemm_chain_rows, l = tid / gemm_chain_rows;
+
+            a_block[l][i] = row0 + i < m && l0 + l < k
+                                ? hipblasGemmChainElement(A_b, lda, ta, row0 + i, l0 + l)
+                                : 0;
+            __syncthreads();
+
+            int kb = min(gemm_chain_k_block, k - l0);
+#pragma unroll
+            for(int e = 0; e < gemm_chain_elements; e++)
+            {
+                int x = tid + e * gemm_chain_threads;
+                if(x < size)
+                {
+                    int   r   = x % gemm_chain_rows, j = x / gemm_chain_rows;
+                    float sum = acc[e];
+                    for(int l = 0; l < kb; l++)
+                        sum += a_block[l][r] * hipblasGemmChainElement(B_b, ldb, tb, l0 + l, j);
+                    acc[e] = sum;
+                }
+            }
+            __syncthreads();
+        }
+
+#pragma unroll
+        for(int e = 0; e < gemm_chain_elements; e++)
+        {
+            int x = tid + e * gemm_chain_threads;
+            if(x < size)
+                t[x] = hipblasDeviceToFloat(
+                    hipblasDeviceCast<T>(hipblasGemmChainAct(epilogue, alpha1 * acc[e])));
+        }
+        __syncthreads();
+
+        for(int x = tid; x < gemm_chain_rows * p; x += gemm_chain_threads)
+        {
+            int r = x % gemm_chain_rows, q = x / gemm_chain_rows;
+            if(row0 + r >= m)
+                continue;
+
+            float sum = 0;
+            for(int j = 0; j < n; j++)
+                sum += t[j * gemm_chain_rows + r] * hipblasGemmChainElement(E_b, lde, te, j, q);
+
+            T&    d = D_b[row0 + r + size_t(q) * ldd];
+            float v = alpha2 * sum;
+            if(beta2 != 0)
+                v += beta2 * hipblasDeviceToFloat(d);
+            hipblasDeviceFromFloat(v, d);
+        }
+
+        // t is formed again for the next chain
+        __syncthreads();
+    }
+}
+
+template <typename T>
+static hipblasStatus_t hipblasGemmChainLaunch(hipStream_t                   stream,
+                                              bool                          device_scalars,
+                                              const hipblasGemmChainDesc_t& desc,
+                                              const float*                  alpha1,
+                                              const void*                   A,
+                                              const void*                   B,
+                                              const float*                  alpha2,
+                                              const void*                   E,
+                                              const float*                  beta2,
+                                              void*                         D)
+{
+    dim3 grid((desc.m - 1) / gemm_chain_rows + 1,
+              1,
+              std::min(desc.batchCount, gemm_chain_max_grid));
+
+    hipLaunchKernelGGL(hipblasGemmChainKernel<T>,
+                       grid,
+                       dim3(gemm_chain_threads),
+                       0,
+                       stream,
+                       desc.transA,
+                       desc.transB,
+                       desc.transE,
+                       desc.epilogue,
+                       desc.m,
+                       desc.n,
+                       desc.k,
+                       desc.p,
+                       device_scalars ? alpha1 : nullptr,
+                       device_scalars ? 0.0f : *alpha1,
+                       (const T*)A,
+                       desc.lda,
+                       desc.strideA,
+                       (const T*)B,
+                       desc.ldb,
+                       desc.strideB,
+                       device_scalars ? alpha2 : nullptr,
+                       device_scalars ? 0.0f : *alpha2,
+                       (const T*)E,
+                       desc.lde,
+                       desc.strideE,
+                       device_scalars ? beta2 : nullptr,
+                       device_scalars ? 0.0f : *beta2,
+                       (T*)D,
+                       desc.ldd,
+                       desc.strideD,
+                       desc.batchCount);
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasGemmChainKernels(hipStream_t                   stream,
+                                        bool                          device_scalars,
+                                        const hipblasGemmChainDesc_t& desc,
+                                        const float*                  alpha1,
+                                        const void*                   A,
+                                        const void*                   B,
+                                        const float*                  alpha2,
+                                        const void*                   E,
+                                        const float*                  beta2,
+                                        void*                         D)
+{
+    if(desc.n <= 0 || desc.n > gemm_chain_max_n || desc.computeType != HIPBLAS_COMPUTE_32F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    auto launch = [&](auto element) {
+        return hipblasGemmChainLaunch<decltype(element)>(
+            stream, device_scalars, desc, alpha1, A, B, alpha2, E, beta2, D);
+    };
+
+    switch(desc.dataType)
+    {
+    case HIP_R_16F:
+        return launch(__half());
+    case HIP_R_16BF:
+        return launch(hipblasDeviceBfloat16());
+    case HIP_R_32F:
+        return launch(float());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
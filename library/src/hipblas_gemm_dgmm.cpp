@@ -0,0 +1,310 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_dgmm.hpp"
+#include "datatype.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+hipblasGemmDgmmOperands::~hipblasGemmDgmmOperands()
+{
+    if(scratch)
+        (void)hipFreeAsync(scratch, stream);
+}
+
+template <typename T>
+struct hipblasGemmDgmmFunctions;
+
+template <>
+struct hipblasGemmDgmmFunctions<float>
+{
+    static constexpr auto dgmm               = hipblasSdgmm;
+    static constexpr auto dgmmStridedBatched = hipblasSdgmmStridedBatched;
+};
+
+template <>
+struct hipblasGemmDgmmFunctions<double>
+{
+    static constexpr auto dgmm               = hipblasDdgmm;
+    static constexpr auto dgmmStridedBatched = hipblasDdgmmStridedBatched;
+};
+
+template <>
+struct hipblasGemmDgmmFunctions<hipblasComplex>
+{
+    static constexpr auto dgmm               = hipblasCdgmm;
+    static constexpr auto dgmmStridedBatched = hipblasCdgmmStridedBatched;
+};
+
+template <>
+struct hipblasGemmDgmmFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto dgmm               = hipblasZdgmm;
+    static constexpr auto dgmmStridedBatched = hipblasZdgmmStridedBatched;
+};
+
+// C_i = diag( x_i )*A_i for HIPBLAS_SIDE_LEFT or A_i*diag( x_i ) for HIPBLAS_SIDE_RIGHT, with one
+// strided batched dgmm where the backend has it
+template <typename T>
+static hipblasStatus_t hipblasGemmDgmmScale(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            int               m,
+                                            int               n,
+                                            const void*       A,
+                                            int               lda,
+                                            hipblasStride     stride_A,
+                                            const void*       x,
+                                            int               incx,
+                                            hipblasStride     stride_x,
+                                            void*             C,
+                                            int               ldc,
+                                            hipblasStride     stride_C,
+                                            int               batch_count)
+{
+    using F = hipblasGemmDgmmFunctions<T>;
+
+    const T* a = static_cast<const T*>(A);
+    const T* v = static_cast<const T*>(x);
+    T*       c = static_cast<T*>(C);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(batch_count > 1)
+        status = F::dgmmStridedBatched(
+            handle, side, m, n, a, lda, stride_A, v, incx, stride_x, c, ldc, stride_C, batch_count);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+
+    status = HIPBLAS_STATUS_SUCCESS;
+    for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+        status = F::dgmm(handle,
+                         side,
+                         m,
+                         n,
+                         a + i * stride_A,
+                         lda,
+                         v + i * stride_x,
+                         incx,
+                         c + i * stride_C,
+                         ldc);
+    return status;
+}
+
+// Copy of the rows x columns matrices X_i scaled on side by x_i, packed in scratch
+static hipblasStatus_t hipblasGemmDgmmScaleCopy(hipblasHandle_t   handle,
+                                                hipDataType       type,
+                                                hipblasSideMode_t side,
+                                                int               rows,
+                                                int               cols,
+                                                const void*       X,
+                                                int               ldx,
+                                                hipblasStride     stride_X,
+                                                const void*       x,
+                                                int               incx,
+                                                hipblasStride     stride_x,
+                                                void*             scratch,
+                                                int               batch_count)
+{
+    auto scale = [&](auto element) {
+        return hipblasGemmDgmmScale<decltype(element)>(handle,
+                                                       side,
+                                                       rows,
+                                                       cols,
+                                                       X,
+                                                       ldx,
+                                                       stride_X,
+                                                       x,
+                                                       incx,
+                                                       stride_x,
+                                                       scratch,
+                                                       std::max(rows, 1),
+                                                       hipblasStride(rows) * cols,
+                                                       batch_count);
+    };
+
+    switch(type)
+    {
+    case HIP_R_32F:
+        return scale(float());
+    case HIP_R_64F:
+        return scale(double());
+    case HIP_C_32F:
+        return scale(hipblasComplex());
+    case HIP_C_64F:
+        return scale(hipblasDoubleComplex());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+hipblasStatus_t hipblasGemmDgmmPrepare(hipblasHandle_t          handle,
+                                       hipblasOperation_t       transa,
+                                       hipblasOperation_t       transb,
+                                       int                      m,
+                                       int                      n,
+                                       int                      k,
+                                       const void*              x_left,
+                                       int                      incx_left,
+                                       hipblasStride            stride_x_left,
+                                       const void*              A,
+                                       hipDataType              a_type,
+                                       int                      lda,
+                                       hipblasStride            stride_A,
+                                       const void*              B,
+                                       hipDataType              b_type,
+                                       int                      ldb,
+                                       hipblasStride            stride_B,
+                                       const void*              x_right,
+                                       int                      incx_right,
+                                       hipblasStride            stride_x_right,
+                                       const void*              C,
+                                       hipDataType              c_type,
+                                       int                      ldc,
+                                       hipblasStride            stride_C,
+                                       const void*              D,
+                                       int                      ldd,
+                                       hipblasStride            stride_D,
+                                       int                      batch_count,
+                                       hipblasGemmDgmmOperands& operands)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+    if((!a_n && transa != HIPBLAS_OP_T && transa != HIPBLAS_OP_C)
+       || (!b_n && transb != HIPBLAS_OP_T && transb != HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int A_row = a_n ? m : k, A_col = a_n ? k : m;
+    int B_row = b_n ? k : n, B_col = b_n ? n : k;
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, A_row)
+       || ldb < std::max(1, B_row) || ldc < std::max(1, m) || ldd < std::max(1, m)
+       || (C && C == D && (ldc != ldd || stride_C != stride_D)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!hipblasDatatypeSize(c_type)
+       || (x_left && transa == HIPBLAS_OP_C && hipblasDatatypeComplex(a_type))
+       || (x_right && transb == HIPBLAS_OP_C && hipblasDatatypeComplex(b_type)))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    operands.A       = A;
+    operands.lda     = lda;
+    operands.strideA = stride_A;
+    operands.B       = B;
+    operands.ldb     = ldb;
+    operands.strideB = stride_B;
+
+    bool scale_a = x_left && m && k && batch_count;
+    bool scale_b = x_right && n && k && batch_count;
+    if(!scale_a && !scale_b)
+        return HIPBLAS_STATUS_SUCCESS;
+    if((scale_a && !A) || (scale_b && !B))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t a_size  = hipblasDatatypeSize(a_type);
+    size_t b_size  = hipblasDatatypeSize(b_type);
+    size_t a_bytes = scale_a ? (a_size * m * k * batch_count + 255) / 256 * 256 : 0;
+    size_t b_bytes = scale_b ? b_size * n * k * batch_count : 0;
+    if((scale_a && !a_size) || (scale_b && !b_size))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasStatus_t status = hipblasGetStream(handle, &operands.stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(hipMallocAsync((void**)&operands.scratch, a_bytes + b_bytes, operands.stream) != hipSuccess)
+    {
+        operands.scratch = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    // diag( x )*op( A ) scales the rows of A, or its columns when it is transposed, and
+    // op( B )*diag( x ) the columns of B, or its rows
+    if(scale_a)
+    {
+        status = hipblasGemmDgmmScaleCopy(handle,
+                                          a_type,
+                                          a_n ? HIPBLAS_SIDE_LEFT : HIPBLAS_SIDE_RIGHT,
+                                          A_row,
+                                          A_col,
+                                          A,
+                                          lda,
+                                          stride_A,
+                                          x_left,
+                                          incx_left,
+                                          stride_x_left,
+                                          operands.scratch,
+                                          batch_count);
+        operands.A       = operands.scratch;
+        operands.lda     = A_row;
+        operands.strideA = hipblasStride(A_row) * A_col;
+    }
+    if(scale_b && status == HIPBLAS_STATUS_SUCCESS)
+    {
+        status = hipblasGemmDgmmScaleCopy(handle,
+                                          b_type,
+                                          b_n ? HIPBLAS_SIDE_RIGHT : HIPBLAS_SIDE_LEFT,
+                                          B_row,
+                                          B_col,
+                                          B,
+                                          ldb,
+                                          stride_B,
+                                          x_right,
+                                          incx_right,
+                                          stride_x_right,
+                                          operands.scratch + a_bytes,
+                                          batch_count);
+        operands.B       = operands.scratch + a_bytes;
+        operands.ldb     = B_row;
+        operands.strideB = hipblasStride(B_row) * B_col;
+    }
+    return status;
+}
+
+hipblasStatus_t hipblasGemmDgmmCopyC(hipStream_t   stream,
+                                     hipDataType   c_type,
+                                     int           m,
+                                     int           n,
+                                     const void*   C,
+                                     int           ldc,
+                                     hipblasStride stride_C,
+                                     void*         D,
+                                     int           ldd,
+                                     hipblasStride stride_D,
+                                     int           batch_count)
+{
+    if(C == D || !m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    size_t size = hipblasDatatypeSize(c_type);
+    for(int i = 0; i < batch_count; i++)
+        if(hipMemcpy2DAsync(static_cast<char*>(D) + size * i * stride_D,
+                            size * ldd,
+                            static_cast<const char*>(C) + size * i * stride_C,
+                            size * ldc,
+                            size * m,
+                            n,
+                            hipMemcpyDeviceToDevice,
+                            stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
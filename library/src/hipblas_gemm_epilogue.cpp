@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_epilogue.hpp"
+#include "datatype.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+bool hipblasEpilogueHasBias(hipblasEpilogue_t epilogue)
+{
+    return epilogue & HIPBLAS_EPILOGUE_BIAS;
+}
+
+bool hipblasEpilogueHasAux(hipblasEpilogue_t epilogue)
+{
+    return (epilogue & HIPBLAS_EPILOGUE_GELU_AUX) == HIPBLAS_EPILOGUE_GELU_AUX;
+}
+
+hipblasStatus_t hipblasGemmEpilogueCheck(hipblasEpilogue_t epilogue,
+                                         int               m,
+                                         int               n,
+                                         hipDataType       c_type,
+                                         const void*       bias,
+                                         const void*       aux,
+                                         int               ldaux)
+{
+    switch(epilogue)
+    {
+    case HIPBLAS_EPILOGUE_DEFAULT:
+        return HIPBLAS_STATUS_SUCCESS;
+    case HIPBLAS_EPILOGUE_RELU:
+    case HIPBLAS_EPILOGUE_BIAS:
+    case HIPBLAS_EPILOGUE_RELU_BIAS:
+    case HIPBLAS_EPILOGUE_GELU:
+    case HIPBLAS_EPILOGUE_GELU_BIAS:
+    case HIPBLAS_EPILOGUE_GELU_AUX:
+    case HIPBLAS_EPILOGUE_GELU_AUX_BIAS:
+        break;
+    default:
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+
+    if(!hipblasDatatypeFloating(c_type) || hipblasDatatypeComplex(c_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(m <= 0 || n <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(hipblasEpilogueHasBias(epilogue) && !bias)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(hipblasEpilogueHasAux(epilogue) && (!aux || ldaux < m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t
+    hipblasEpilogueReductionCheck(hipblasEpilogueReduction_t reduction, int m, int n, void* reduce)
+{
+    switch(reduction)
+    {
+    case HIPBLAS_EPILOGUE_REDUCTION_NONE:
+        return HIPBLAS_STATUS_SUCCESS;
+    case HIPBLAS_EPILOGUE_REDUCTION_ROW_SUM:
+    case HIPBLAS_EPILOGUE_REDUCTION_ROW_SUM_SQUARES:
+    case HIPBLAS_EPILOGUE_REDUCTION_ROW_MAX:
+    case HIPBLAS_EPILOGUE_REDUCTION_COLUMN_SUM:
+    case HIPBLAS_EPILOGUE_REDUCTION_COLUMN_SUM_SQUARES:
+    case HIPBLAS_EPILOGUE_REDUCTION_COLUMN_MAX:
+        break;
+    default:
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+
+    if(m > 0 && n > 0 && !reduce)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+static double hipblasEpilogueHalfToDouble(uint16_t h)
+{
+    uint32_t sign = uint32_t(h & 0x8000) << 16;
+    uint32_t exp  = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    uint32_t bits;
+
+    if(exp == 0x1f)
+        bits = sign | 0x7f800000 | (mant << 13);
+    else if(exp)
+        bits = sign | ((exp + 112) << 23) | (mant << 13);
+    else if(!mant)
+        bits = sign;
+    else
+    {
+        // Subnormal half, normal float
+        exp = 113;
+        while(!(mant & 0x400))
+        {
+            mant <<= 1;
+            exp--;
+        }
+        bits = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+    }
+
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// Round to nearest even
+static uint16_t hipblasEpilogueDoubleToHalf(double x)
+{
+    float    f = float(x);
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+
+    uint16_t sign = (bits >> 16) & 0x8000;
+    uint32_t abs  = bits & 0x7fffffff;
+
+    if(abs > 0x7f800000)
+        return sign | 0x7e00;
+    if(abs >= 0x477ff000) // 65520 and above round to infinity
+        return sign | 0x7c00;
+    if(abs < 0x38800000) // below the smallest normal half
+    {
+        float a;
+        std::memcpy(&a, &abs, sizeof(a));
+        return sign | uint16_t(std::nearbyint(a * 16777216.0f));
+    }
+    return sign | uint16_t((abs + 0xfff + ((abs >> 13) & 1) - 0x38000000) >> 13);
+}
+
+static double hipblasEpilogueBfloat16ToDouble(uint16_t h)
+{
+    uint32_t bits = uint32_t(h) << 16;
+    float    f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// Round to nearest even
+static uint16_t hipblasEpilogueDoubleToBfloat16(double x)
+{
+    float    f = float(x);
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+
+    if((bits & 0x7fffffff) > 0x7f800000)
+        return uint16_t(bits >> 16) | 0x40;
+    return uint16_t((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+}
+
+static double hipblasEpilogueLoad(hipDataType type, const char* p)
+{
+    uint16_t h;
+    switch(type)
+    {
+    case HIP_R_16F:
+        std::memcpy(&h, p, sizeof(h));
+        return hipblasEpilogueHalfToDouble(h);
+    case HIP_R_16BF:
+        std::memcpy(&h, p, sizeof(h));
+        return hipblasEpilogueBfloat16ToDouble(h);
+    case HIP_R_32F:
+        float f;
+        std::memcpy(&f, p, sizeof(f));
+        return f;
+    default:
+        double d;
+        std::memcpy(&d, p, sizeof(d));
+        return d;
+    }
+}
+
+static void hipblasEpilogueStore(hipDataType type, char* p, double x)
+{
+    uint16_t h;
+    switch(type)
+    {
+    case HIP_R_16F:
+        h = hipblasEpilogueDoubleToHalf(x);
+        std::memcpy(p, &h, sizeof(h));
+        break;
+    case HIP_R_16BF:
+        h = hipblasEpilogueDoubleToBfloat16(x);
+        std::memcpy(p, &h, sizeof(h));
+        break;
+    case HIP_R_32F:
+    {
+        float f = float(x);
+        std::memcpy(p, &f, sizeof(f));
+        break;
+    }
+    default:
+        std::memcpy(p, &x, sizeof(x));
+        break;
+    }
+}
+
+// Same approximation as the cuBLASLt and hipBLASLt GELU epilogues
+static double hipblasEpilogueGelu(double x)
+{
+    const double sqrt_2_over_pi = 0.7978845608028654;
+    return 0.5 * x * (1.0 + std::tanh(sqrt_2_over_pi * (x + 0.044715 * x * x * x)));
+}
+
+hipblasStatus_t hipblasGemmEpilogueUnfused(hipStream_t                             stream,
+                                           const std::function<hipblasStatus_t()>& gemm,
+                                           hipblasEpilogue_t                       epilogue,
+                                           hipDataType                             c_type,
+                                           int                                     m,
+                                           int                                     n,
+                                           void*                                   C,
+                                           int                                     ldc,
+                                           const void*                             bias,
+                                           void*                                   aux,
+                                           int                                     ldaux,
+                                           hipblasEpilogueReduction_t              reduction,
+                                           void*                                   reduce)
+{
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasStatus_t status       = gemm();
+    bool            has_epilogue = epilogue != HIPBLAS_EPILOGUE_DEFAULT;
+    if(status != HIPBLAS_STATUS_SUCCESS || (!has_epilogue && !reduction) || m <= 0 || n <= 0)
+        return status;
+
+    bool   has_bias = hipblasEpilogueHasBias(epilogue);
+    bool   has_aux  = hipblasEpilogueHasAux(epilogue);
+    size_t size     = hipblasDatatypeSize(c_type);
+    size_t width    = size * m;
+
+    // The reduction of row i or column j, as selected by by_column, is kept in hreduce
+    bool                by_column = reduction & hipblas_epilogue_reduction_column;
+    int                 op        = reduction & ~hipblas_epilogue_reduction_column;
+    std::vector<double> hreduce(reduction ? (by_column ? n : m) : 0,
+                                op == HIPBLAS_EPILOGUE_REDUCTION_ROW_MAX ? -HUGE_VAL : 0.0);
+
+    // C is packed with leading dimension m on the host
+    std::vector<char> hC(width * n), hbias(has_bias ? width : 0), haux(has_aux ? width * n : 0);
+
+    if(hipMemcpy2DAsync(hC.data(), width, C, size * ldc, width, n, hipMemcpyDeviceToHost, stream)
+           != hipSuccess
+       || (has_bias
+           && hipMemcpyAsync(hbias.data(), bias, width, hipMemcpyDeviceToHost, stream)
+                  != hipSuccess)
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    for(size_t j = 0; j < size_t(n); j++)
+    {
+        for(size_t i = 0; i < size_t(m); i++)
+        {
+            char*  c = &hC[j * width + i * size];
+            double x = hipblasEpilogueLoad(c_type, c);
+
+            if(has_bias)
+                x += hipblasEpilogueLoad(c_type, &hbias[i * size]);
+            if(has_aux)
+                hipblasEpilogueStore(c_type, &haux[j * width + i * size], x);
+
+            if(epilogue & HIPBLAS_EPILOGUE_RELU)
+                x = x > 0 ? x : 0;
+            else if(epilogue & HIPBLAS_EPILOGUE_GELU)
+                x = hipblasEpilogueGelu(x);
+
+            if(has_epilogue)
+                hipblasEpilogueStore(c_type, c, x);
+            if(!reduction)
+                continue;
+
+            // The statistics are of the stored values
+            x         = hipblasEpilogueLoad(c_type, c);
+            double& r = hreduce[by_column ? j : i];
+            if(op == HIPBLAS_EPILOGUE_REDUCTION_ROW_MAX)
+                r = x > r || x != x ? x : r;
+            else
+                r += op == HIPBLAS_EPILOGUE_REDUCTION_ROW_SUM_SQUARES ? x * x : x;
+        }
+    }
+
+    // The reduction is float unless C is double
+    size_t            reduce_size = c_type == HIP_R_64F ? sizeof(double) : sizeof(float);
+    std::vector<char> hreduce_out(reduce_size * hreduce.size());
+    for(size_t i = 0; i < hreduce.size(); i++)
+        hipblasEpilogueStore(
+            c_type == HIP_R_64F ? HIP_R_64F : HIP_R_32F, &hreduce_out[i * reduce_size], hreduce[i]);
+
+    if((has_epilogue
+        && hipMemcpy2DAsync(
+               C, size * ldc, hC.data(), width, width, n, hipMemcpyHostToDevice, stream)
+               != hipSuccess)
+       || (has_aux
+           && hipMemcpy2DAsync(aux,
+                               size * ldaux,
+                               haux.data(),
+                               width,
+                               width,
+                               n,
+                               hipMemcpyHostToDevice,
+                               stream)
+                  != hipSuccess)
+       || (reduction
+           && hipMemcpyAsync(
+                  reduce, hreduce_out.data(), hreduce_out.size(), hipMemcpyHostToDevice, stream)
+                  != hipSuccess)
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
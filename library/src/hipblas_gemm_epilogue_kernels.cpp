@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_epilogue.hpp"
+#include "convert_device.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+// Threads of a work group
+constexpr int epilogue_reduction_threads = 256;
+
+// Largest grid of the column reduction. The work groups loop over the remaining columns.
+constexpr int epilogue_reduction_max_grid = 65535;
+
+// Elements are converted to float, or kept in double
+__device__ inline double hipblasEpilogueToAcc(double a)
+{
+    return a;
+}
+
+template <typename T>
+__device__ inline float hipblasEpilogueToAcc(T a)
+{
+    return hipblasDeviceToFloat(a);
+}
+
+__device__ inline void hipblasEpilogueFromAcc(double x, double& c)
+{
+    c = x;
+}
+
+template <typename T>
+__device__ inline void hipblasEpilogueFromAcc(float x, T& c)
+{
+    hipblasDeviceFromFloat(x, c);
+}
+
+// Applies the epilogue to element (i, j) of C and returns the stored result. Same approximation
+// as hipblasGemmEpilogueEx.
+template <typename T, typename Tr>
+__device__ inline Tr hipblasEpilogueElement(hipblasEpilogue_t epilogue,
+                                            T*                C,
+                                            int               ldc,
+                                            const T*          bias,
+                                            T*                aux,
+                                            int               ldaux,
+                                            int               i,
+                                            int               j)
+{
+    T& c = C[i + size_t(j) * ldc];
+    Tr x = hipblasEpilogueToAcc(c);
+    if(epilogue == HIPBLAS_EPILOGUE_DEFAULT)
+        return x;
+
+    if(epilogue & HIPBLAS_EPILOGUE_BIAS)
+        x += hipblasEpilogueToAcc(bias[i]);
+    if((epilogue & HIPBLAS_EPILOGUE_GELU_AUX) == HIPBLAS_EPILOGUE_GELU_AUX)
+        hipblasEpilogueFromAcc(x, aux[i + size_t(j) * ldaux]);
+
+    if(epilogue & HIPBLAS_EPILOGUE_RELU)
+        x = x > 0 ? x : 0;
+    else if(epilogue & HIPBLAS_EPILOGUE_GELU)
+    {
+        const Tr sqrt_2_over_pi = Tr(0.7978845608028654);
+        x = Tr(0.5) * x * (1 + tanh(sqrt_2_over_pi * (x + Tr(0.044715) * x * x * x)));
+    }
+
+    hipblasEpilogueFromAcc(x, c);
+    return hipblasEpilogueToAcc(c);
+}
+
+// Statistic op, a row reduction, of the elements seen so far and then x
+template <typename Tr>
+__device__ inline Tr hipblasEpilogueReduce(int op, Tr r, Tr x)
+{
+    if(op == HIPBLAS_EPILOGUE_REDUCTION_ROW_MAX)
+        return x > r || x != x ? x : r;
+    return r + (op == HIPBLAS_EPILOGUE_REDUCTION_ROW_SUM_SQUARES ? x * x : x);
+}
+
+// Statistic op of two parts
+template <typename Tr>
+__device__ inline Tr hipblasEpilogueMerge(int op, Tr r, Tr s)
+{
+    if(op == HIPBLAS_EPILOGUE_REDUCTION_ROW_MAX)
+        return s > r || s != s ? s : r;
+    return r + s;
+}
+
+template <typename Tr>
+__device__ inline Tr hipblasEpilogueReduceInit(int op)
+{
+    return op == HIPBLAS_EPILOGUE_REDUCTION_ROW_MAX ? Tr(-INFINITY) : Tr(0);
+}
+
+// Thread i applies the epilogue to row i and reduces it, reading the rows of a work group
+// column by column
+template <typename T, typename Tr>
+__global__ void __launch_bounds__(epilogue_reduction_threads)
+    hipblasEpilogueRowKernel(hipblasEpilogue_t epilogue,
+                             int               op,
+                             int               m,
+                             int               n,
+                             T*                C,
+                             int               ldc,
+                             const T*          bias,
+                             T*                aux,
+                             int               ldaux,
+                             Tr*               reduce)
+{
+    int i = blockIdx.x * epilogue_reduction_threads + threadIdx.x;
+    if(i >= m)
+        return;
+
+    Tr r = hipblasEpilogueReduceInit<Tr>(op);
+    for(int j = 0; j < n; j++)
+        r = hipblasEpilogueReduce(
+            op, r, hipblasEpilogueElement<T, Tr>(epilogue, C, ldc, bias, aux, ldaux, i, j));
+    reduce[i] = r;
+}
+
+// Work group x applies the epilogue to columns x, x + gridDim.x, ... and reduces each of them
+// through shared memory
+template <typename T, typename Tr>
+__global__ void __launch_bounds__(epilogue_reduction_threads)
+    hipblasEpilogueColumnKernel(hipblasEpilogue_t epilogue,
+                                int               op,
+                                int               m,
+                                int               n,
+                                T*                C,
+                                int               ldc,
+                                const T*          bias,
+                                T*                aux,
+                                int               ldaux,
+                                Tr*               reduce)
+{
+    __shared__ Tr part[epilogue_reduction_threads];
+
+    int tid = threadIdx.x;
+    for(int j = blockIdx.x; j < n; j += gridDim.x)
+    {
+        Tr r = hipblasEpilogueReduceInit<Tr>(op);
+        for(int i = tid; i < m; i += epilogue_reduction_threads)
+            r = hipblasEpilogueReduce(
+                op, r, hipblasEpilogueElement<T, Tr>(epilogue, C, ldc, bias, aux, ldaux, i, j));
+        part[tid] = r;
+        __syncthreads();
+
+        for(int s = epilogue_reduction_threads / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                part[tid] = hipblasEpilogueMerge(op, part[tid], part[tid + s]);
+            __syncthreads();
+        }
+        if(!tid)
+            reduce[j] = part[0];
+
+        // part is used again for the next column
+        __syncthreads();
+    }
+}
+
+template <typename T, typename Tr>
+static hipblasStatus_t hipblasEpilogueReductionLaunch(hipStream_t                stream,
+                                                      hipblasEpilogue_t          epilogue,
+                                                      int                        m,
+                                                      int                        n,
+                                                      void*                      C,
+                                                      int                        ldc,
+                                                      const void*                bias,
+                                                      void*                      aux,
+                                                      int                        ldaux,
+                                                      hipblasEpilogueReduction_t reduction,
+                                                      void*                      reduce)
+{
+    int op = reduction & ~hipblas_epilogue_reduction_column;
+    if(reduction & hipblas_epilogue_reduction_column)
+        hipLaunchKernelGGL(hipblasEpilogueColumnKernel<T, Tr>,
+                           dim3(std::min(n, epilogue_reduction_max_grid)),
+                           dim3(epilogue_reduction_threads),
+                           0,
+                           stream,
+                           epilogue,
+                           op,
+                           m,
+                           n,
+                           (T*)C,
+                           ldc,
+                           (const T*)bias,
+                           (T*)aux,
+                           ldaux,
+                           (Tr*)reduce);
+    else
+        hipLaunchKernelGGL(hipblasEpilogueRowKernel<T, Tr>,
+                           dim3((m - 1) / epilogue_reduction_threads + 1),
+                           dim3(epilogue_reduction_threads),
+                           0,
+                           stream,
+                           epilogue,
+                           op,
+                           m,
+                           n,
+                           (T*)C,
+                           ldc,
+                           (const T*)bias,
+                           (T*)aux,
+                           ldaux,
+                           (Tr*)reduce);
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasGemmEpilogueReductionKernels(hipStream_t                stream,
+                                                    hipblasEpilogue_t          epilogue,
+                                                    hipDataType                c_type,
+                                                    int                        m,
+                                                    int                        n,
+                                                    void*                      C,
+                                                    int                        ldc,
+                                                    const void*                bias,
+                                                    void*                      aux,
+                                                    int                        ldaux,
+                                                    hipblasEpilogueReduction_t reduction,
+                                                    void*                      reduce)
+{
+    auto launch = [&](auto element, auto acc) {
+        return hipblasEpilogueReductionLaunch<decltype(element), decltype(acc)>(
+            stream, epilogue, m, n, C, ldc, bias, aux, ldaux, reduction, reduce);
+    };
+
+    switch(c_type)
+    {
+    case HIP_R_16F:
+        return launch(__half(), float());
+    case HIP_R_16BF:
+        return launch(hipblasDeviceBfloat16(), float());
+    case HIP_R_32F:
+        return launch(float(), float());
+    case HIP_R_64F:
+        return launch(double(), double());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_fp64_emulation.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "scratch.hpp"
+#include "shared_handle.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <unordered_map>
+
+// Largest scratch of the int32 products of one gemm, in bytes. Fewer slices of op( B ) are
+// multiplied at once past it.
+static constexpr size_t fp64_emulation_max_product_bytes = size_t(256) << 20;
+
+struct hipblasGemmFp64EmulationSetting
+{
+    hipblasGemmFp64EmulationMode_t mode   = HIPBLAS_GEMM_FP64_EMULATION_OFF;
+    int                            slices = 0;
+};
+
+static std::mutex fp64_emulation_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasGemmFp64EmulationSetting>
+    fp64_emulation_settings;
+
+void hipblasGemmFp64EmulationErase(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(fp64_emulation_mutex);
+    fp64_emulation_settings.erase(handle);
+}
+
+bool hipblasGemmFp64Emulation(hipblasHandle_t    handle,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const double*      alpha,
+                              const double*      A,
+                              int                lda,
+                              const double*      B,
+                              int                ldb,
+                              const double*      beta,
+                              double*            C,
+                              int                ldc,
+                              hipblasStatus_t&   status)
+{
+#ifndef HIPBLAS_GEMM_FP64_EMULATION
+    return false;
+#else
+    // Invalid arguments are left to the backend
+    bool a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+    if(!handle || m <= 0 || n <= 0 || k <= 0 || !alpha || !beta || !A || !B || !C
+       || lda < std::max(1, a_n ? m : k) || ldb < std::max(1, b_n ? k : n) || ldc < m)
+        return false;
+
+    hipblasGemmFp64EmulationSetting setting;
+    {
+        std::lock_guard<std::mutex> lock(fp64_emulation_mutex);
+        auto                        it = fp64_emulation_settings.find(handle);
+        if(it != fp64_emulation_settings.end())
+            setting = it->second;
+    }
+    if(setting.mode != HIPBLAS_GEMM_FP64_EMULATION_INT8)
+        return false;
+
+    hipStream_t            stream;
+    hipblasPointerMode_t   mode;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return false;
+
+    // With alpha == 0, A and B are not read
+    if(mode == HIPBLAS_POINTER_MODE_HOST && *alpha == 0)
+        return false;
+
+    // int8 gemms need leading dimensions that are multiples of 4, so the slices are k x m and
+    // k x n with k rounded up, and the products m x n with m rounded up
+    int    slices = setting.slices;
+    int    kp     = (k + 3) / 4 * 4;
+    int    mp     = (m + 3) / 4 * 4;
+    size_t block  = sizeof(int32_t) * mp * n;
+    int    batch  = int(std::min(size_t(slices), fp64_emulation_max_product_bytes / block));
+    if(batch < 1)
+        return false;
+
+    // The exponents, the slices, the fp64 sum and the int32 products, each part 256-byte aligned
+    auto   align   = [](size_t bytes) { return (bytes + 255) / 256 * 256; };
+    size_t ea_size = align(sizeof(int) * m);
+    size_t eb_size = align(sizeof(int) * n);
+    size_t a_size  = align(size_t(slices) * kp * m);
+    size_t b_size  = align(size_t(slices) * kp * n);
+    size_t d_size  = align(sizeof(double) * m * n);
+    size_t bytes   = ea_size + eb_size + a_size + b_size + d_size + block * batch;
+
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    if(hipMallocAsync((void**)&scratch.base, bytes, stream) != hipSuccess)
+    {
+        scratch.base = nullptr;
+        (void)hipGetLastError();
+        return false;
+    }
+    int*     ea = (int*)scratch.base;
+    int*     eb = (int*)(scratch.base + ea_size);
+    int8_t*  As = (int8_t*)(scratch.base + ea_size + eb_size);
+    int8_t*  Bs = As + a_size;
+    double*  D  = (double*)(Bs + b_size);
+    int32_t* P  = (int32_t*)((char*)D + d_size);
+
+    // From here on the call is emulated and its status is returned. The rows of op( A ) are the
+    // columns of A with transa, and the columns of op( B ) those of B without transb.
+    status = hipblasFp64EmulationSplit(
+        stream, m, k, A, lda, !a_n, slices, As, kp, size_t(kp) * m, ea);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasFp64EmulationSplit(
+            stream, n, k, B, ldb, b_n, slices, Bs, kp, size_t(kp) * n, eb);
+    if(status == HIPBLAS_STATUS_SUCCESS
+       && hipMemsetAsync(D, 0, sizeof(double) * m * n, stream) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    // P := A_s^T [B_t0 ... B_t0+count-1] over a chunk of k, as the slices of op( B ) are
+    // consecutive blocks of n columns
+    const int32_t one = 1, zero = 0;
+    auto          products = [&](int s, int t0, int count, int k0, int depth) {
+        return hipblasGemmEx_v2(handle,
+                                HIPBLAS_OP_T,
+                                HIPBLAS_OP_N,
+                                m,
+                                n * count,
+                                depth,
+                                &one,
+                                As + size_t(kp) * m * s + k0,
+                                HIP_R_8I,
+                                kp,
+                                Bs + size_t(kp) * n * t0 + k0,
+                                HIP_R_8I,
+                                kp,
+                                &zero,
+                                P,
+                                HIP_R_32I,
+                                mp,
+                                HIPBLAS_COMPUTE_32I,
+                                HIPBLAS_GEMM_DEFAULT);
+    };
+
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    for(int k0 = 0; k0 < kp && status == HIPBLAS_STATUS_SUCCESS; k0 += fp64_emulation_max_k)
+    {
+        int depth = std::min(kp - k0, fp64_emulation_max_k);
+        for(int s = 0; s < slices && status == HIPBLAS_STATUS_SUCCESS; s++)
+            for(int t0 = 0; t0 < slices - s && status == HIPBLAS_STATUS_SUCCESS; t0 += batch)
+            {
+                int count = std::min(batch, slices - s - t0);
+                status    = products(s, t0, count, k0, depth);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasFp64EmulationAccumulate(
+                        stream, m, n, s, t0, count, P, mp, ea, eb, D);
+            }
+    }
+
+    hipblasStatus_t restore = hipblasSetPointerMode(handle, mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = restore;
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasFp64EmulationFinish(stream,
+                                            mode == HIPBLAS_POINTER_MODE_DEVICE,
+                                            m,
+                                            n,
+                                            alpha,
+                                            beta,
+                                            ea,
+                                            eb,
+                                            D,
+                                            C,
+                                            ldc);
+    return true;
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasSetGemmFp64Emulation(hipblasHandle_t                handle,
+                                                       hipblasGemmFp64EmulationMode_t mode,
+                                                       int                            slices)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode, slices);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_GEMM_FP64_EMULATION_OFF && mode != HIPBLAS_GEMM_FP64_EMULATION_INT8)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(mode == HIPBLAS_GEMM_FP64_EMULATION_INT8
+       && (slices < 2 || slices > fp64_emulation_max_slices))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+#ifndef HIPBLAS_GEMM_FP64_EMULATION
+    if(mode == HIPBLAS_GEMM_FP64_EMULATION_INT8)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+
+    std::lock_guard<std::mutex> lock(fp64_emulation_mutex);
+    fp64_emulation_settings[handle] = {mode, mode == HIPBLAS_GEMM_FP64_EMULATION_INT8 ? slices : 0};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetGemmFp64Emulation(hipblasHandle_t                 handle,
+                                                       hipblasGemmFp64EmulationMode_t* mode,
+                                                       int*                            slices)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode, slices);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode || !slices)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex>     lock(fp64_emulation_mutex);
+    auto                            it = fp64_emulation_settings.find(handle);
+    hipblasGemmFp64EmulationSetting setting;
+    if(it != fp64_emulation_settings.end())
+        setting = it->second;
+    *mode   = setting.mode;
+    *slices = setting.slices;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_fp64_emulation.hpp"
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime.h>
+
+// Threads of a work group. The split kernel gives each line to one work group, the others give
+// consecutive rows of one column to consecutive threads.
+constexpr int fp64_emulation_threads = 256;
+
+// Largest grid in x for the lines and in y for the columns. The work groups loop over the rest.
+constexpr int fp64_emulation_max_grid = 65535;
+
+__global__ void __launch_bounds__(fp64_emulation_threads)
+    hipblasFp64EmulationSplitKernel(int           lines,
+                                    int           len,
+                                    const double* X,
+                                    int           ld,
+                                    bool          contiguous,
+                                    int           slices,
+                                    int8_t*       out,
+                                    int           ld_out,
+                                    size_t        slice_stride,
+                                    int*          exps)
+{
+    __shared__ double largest[fp64_emulation_threads];
+
+    const int tid = threadIdx.x;
+    for(int r = blockIdx.x; r < lines; r += gridDim.x)
+    {
+        auto x = [&](int q) {
+            return contiguous ? X[q + size_t(r) * ld] : X[r + size_t(q) * ld];
+        };
+
+        // Largest magnitude of the line, by a tree, or NaN when v - v is not zero for an infinity
+        // or NaN of the line
+        double big = 0, bad = 0;
+        for(int q = tid; q < len; q += fp64_emulation_threads)
+        {
+            double v = x(q);
+            big      = fmax(big, fabs(v));
+            bad += v - v;
+        }
+        largest[tid] = isfinite(bad) ? big : NAN;
+        __syncthreads();
+        for(int half = fp64_emulation_threads / 2; half > 0; half /= 2)
+        {
+            if(tid < half)
+            {
+                double a = largest[tid], b = largest[tid + half];
+                largest[tid] = isnan(a) || isnan(b) ? NAN : fmax(a, b);
+            }
+            __syncthreads();
+        }
+        big = largest[0];
+        __syncthreads();
+
+        // |x| / 2^e < 1 for every element, as big = f 2^e with f in [0.5, 1)
+        bool finite = isfinite(big);
+        int  e      = 0;
+        if(finite && big > 0)
+            frexp(big, &e);
+        if(tid == 0)
+            exps[r] = finite ? e : fp64_emulation_nonfinite;
+
+        // Each slice takes the next fp64_emulation_bits bits of the fraction, truncated, so the
+        // remainder keeps its sign and stays below one in magnitude
+        int8_t* line = out + size_t(r) * ld_out;
+        for(int q = tid; q < ld_out; q += fp64_emulation_threads)
+        {
+            double v = finite && q < len ? ldexp(x(q), -e) : 0;
+            for(int s = 0; s < slices; s++)
+            {
+                v                          = ldexp(v, fp64_emulation_bits);
+                double digit               = trunc(v);
+                v                          = v - digit;
+                line[s * slice_stride + q] = int8_t(digit);
+            }
+        }
+    }
+}
+
+__global__ void __launch_bounds__(fp64_emulation_threads)
+    hipblasFp64EmulationAccumulateKernel(int            m,
+                                         int            n,
+                                         int            s,
+                                         int            t0,
+                                         int            count,
+                                         const int32_t* P,
+                                         int            ldp,
+                                         const int*     ea,
+                                         const int*     eb,
+                                         double*        D)
+{
+    int i = blockIdx.x * fp64_emulation_threads + threadIdx.x;
+    if(i >= m || ea[i] == fp64_emulation_nonfinite)
+        return;
+
+    for(int j = blockIdx.y; j < n; j += gridDim.y)
+    {
+        if(eb[j] == fp64_emulation_nonfinite)
+            continue;
+
+        // The products of slice s of op( A ) with count slices of op( B ), each by its weight
+        double sum = 0;
+        for(int t = 0; t < count; t++)
+            sum += ldexp(double(P[i + size_t(t * n + j) * ldp]),
+                         -fp64_emulation_bits * (t0 + t + 1));
+        D[i + size_t(j) * m] += ldexp(sum, ea[i] + eb[j] - fp64_emulation_bits * (s + 1));
+    }
+}
+
+__global__ void __launch_bounds__(fp64_emulation_threads)
+    hipblasFp64EmulationFinishKernel(int           m,
+                                     int           n,
+                                     const double* alpha_device,
+                                     double        alpha_host,
+                                     const double* beta_device,
+                                     double        beta_host,
+                                     const int*    ea,
+                                     const int*    eb,
+                                     const double* D,
+                                     double*       C,
+                                     int           ldc)
+{
+    int i = blockIdx.x * fp64_emulation_threads + threadIdx.x;
+    if(i >= m)
+        return;
+
+    double alpha = alpha_device ? *alpha_device : alpha_host;
+    double beta  = beta_device ? *beta_device : beta_host;
+    for(int j = blockIdx.y; j < n; j += gridDim.y)
+    {
+        double  d = ea[i] == fp64_emulation_nonfinite || eb[j] == fp64_emulation_nonfinite
+                        ? NAN
+                        : D[i + size_t(j) * m];
+        double& c = C[i + size_t(j) * ldc];
+        c         = beta == 0 ? alpha * d : alpha * d + beta * c;
+    }
+}
+
+static hipblasStatus_t hipblasFp64EmulationStatus()
+{
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasFp64EmulationSplit(hipStream_t   stream,
+                                          int           lines,
+                                          int           len,
+                                          const double* X,
+                                          int           ld,
+                                          bool          contiguous,
+                                          int           slices,
+                                          int8_t*       out,
+                                          int           ld_out,
+                                          size_t        slice_stride,
+                                          int*          exps)
+{
+    hipLaunchKernelGGL(hipblasFp64EmulationSplitKernel,
+                       dim3(std::min(lines, fp64_emulation_max_grid)),
+                       dim3(fp64_emulation_threads),
+                       0,
+                       stream,
+                       lines,
+                       len,
+                       X,
+                       ld,
+                       contiguous,
+                       slices,
+                       out,
+                       ld_out,
+                       slice_stride,
+                       exps);
+    return hipblasFp64EmulationStatus();
+}
+
+hipblasStatus_t hipblasFp64EmulationAccumulate(hipStream_t    stream,
+                                               int            m,
+                                               int            n,
+                                               int            s,
+                                               int            t0,
+                                               int            count,
+                                               const int32_t* P,
+                                               int            ldp,
+                                               const int*     ea,
+                                               const int*     eb,
+                                               double*        D)
+{
+    dim3 grid((m + fp64_emulation_threads - 1) / fp64_emulation_threads,
+              std::min(n, fp64_emulation_max_grid));
+
+    hipLaunchKernelGGL(hipblasFp64EmulationAccumulateKernel,
+                       grid,
+                       dim3(fp64_emulation_threads),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       s,
+                       t0,
+                       count,
+                       P,
+                       ldp,
+                       ea,
+                       eb,
+                       D);
+    return hipblasFp64EmulationStatus();
+}
+
+hipblasStatus_t hipblasFp64EmulationFinish(hipStream_t   stream,
+                                           bool          device_scalars,
+                                           int           m,
+                                           int           n,
+                                           const double* alpha,
+                                           const double* beta,
+                                           const int*    ea,
+                                           const int*    eb,
+                                           const double* D,
+                                           double*       C,
+                                           int           ldc)
+{
+    dim3 grid((m + fp64_emulation_threads - 1) / fp64_emulation_threads,
+              std::min(n, fp64_emulation_max_grid));
+
+    hipLaunchKernelGGL(hipblasFp64EmulationFinishKernel,
+                       grid,
+                       dim3(fp64_emulation_threads),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? 0.0 : *alpha,
+                       device_scalars ? beta : nullptr,
+                       device_scalars ? 0.0 : *beta,
+                       ea,
+                       eb,
+                       D,
+                       C,
+                       ldc);
+    return hipblasFp64EmulationStatus();
+}
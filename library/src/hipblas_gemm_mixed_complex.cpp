@@ -0,0 +1,623 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_mixed_complex.hpp"
+#include "pointer_mode.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <vector>
+
+// Complex hipBLAS functions and real type of one precision
+template <typename T>
+struct hipblasGemmMixedComplexTraits;
+
+template <>
+struct hipblasGemmMixedComplexTraits<hipblasComplex>
+{
+    using real = float;
+
+    static constexpr hipDataType real_type          = HIP_R_32F;
+    static constexpr auto        geam               = hipblasCgeam;
+    static constexpr auto        geamStridedBatched = hipblasCgeamStridedBatched;
+};
+
+template <>
+struct hipblasGemmMixedComplexTraits<hipblasDoubleComplex>
+{
+    using real = double;
+
+    static constexpr hipDataType real_type          = HIP_R_64F;
+    static constexpr auto        geam               = hipblasZgeam;
+    static constexpr auto        geamStridedBatched = hipblasZgeamStridedBatched;
+};
+
+// True, with a_complex set, when a_type and b_type are a complex and a real type of the precision
+// of the complex c_type
+static bool hipblasGemmMixedComplexTypes(hipDataType a_type,
+                                         hipDataType b_type,
+                                         hipDataType c_type,
+                                         bool&       a_complex)
+{
+    if(c_type != HIP_C_32F && c_type != HIP_C_64F)
+        return false;
+    hipDataType real_type = c_type == HIP_C_32F ? HIP_R_32F : HIP_R_64F;
+    a_complex             = a_type == c_type;
+    return (a_complex && b_type == real_type) || (a_type == real_type && b_type == c_type);
+}
+
+static hipblasStatus_t hipblasGemmMixedComplexCheck(hipblasHandle_t      handle,
+                                                    hipblasOperation_t   transa,
+                                                    hipblasOperation_t   transb,
+                                                    int                  m,
+                                                    int                  n,
+                                                    int                  k,
+                                                    int                  lda,
+                                                    int                  ldb,
+                                                    int                  ldc,
+                                                    int                  batch_count,
+                                                    hipDataType          c_type,
+                                                    hipblasComputeType_t compute_type)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+    if((!a_n && transa != HIPBLAS_OP_T && transa != HIPBLAS_OP_C)
+       || (!b_n && transb != HIPBLAS_OP_T && transb != HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_32F:
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+    case HIPBLAS_COMPUTE_32F_FAST_16BFX3:
+        if(c_type != HIP_C_32F)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        break;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        if(c_type != HIP_C_64F)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        break;
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, a_n ? m : k)
+       || ldb < std::max(1, b_n ? k : n) || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // The real views have twice the rows and leading dimensions of the complex operands
+    if(std::max({m, n, lda, ldb, ldc}) > std::numeric_limits<int>::max() / 2)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasGemmMixedComplexTemplate(hipblasHandle_t      handle,
+                                                       hipblasOperation_t   transa,
+                                                       hipblasOperation_t   transb,
+                                                       int                  m,
+                                                       int                  n,
+                                                       int                  k,
+                                                       const T*             alpha,
+                                                       const void*          A,
+                                                       int                  lda,
+                                                       hipblasStride        stride_A,
+                                                       const void*          B,
+                                                       int                  ldb,
+                                                       hipblasStride        stride_B,
+                                                       const T*             beta,
+                                                       T*                   C,
+                                                       int                  ldc,
+                                                       hipblasStride        stride_C,
+                                                       int                  batch_count,
+                                                       bool                 a_complex,
+                                                       hipblasComputeType_t compute_type)
+{
+    using traits = hipblasGemmMixedComplexTraits<T>;
+    using R      = typename traits::real;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // With real host scalars a complex A is multiplied straight into C
+    bool direct = a_complex && mode == HIPBLAS_POINTER_MODE_HOST && alpha->imag() == 0
+                  && beta->imag() == 0;
+
+    // Per instance, the transposed complex operand and the product, in elements of T
+    size_t t_size  = a_complex ? (transa != HIPBLAS_OP_N ? size_t(m) * k : 0)
+                               : (transb == HIPBLAS_OP_N ? size_t(n) * k : 0);
+    size_t w_size  = direct ? 0 : size_t(m) * n;
+    size_t t_bytes = (sizeof(T) * t_size * batch_count + 255) / 256 * 256;
+    size_t bytes   = t_bytes + sizeof(T) * w_size * batch_count;
+
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    if(bytes && hipMallocAsync((void**)&scratch.base, bytes, stream) != hipSuccess)
+    {
+        scratch.base = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    T* X = reinterpret_cast<T*>(scratch.base);
+    T* W = reinterpret_cast<T*>(scratch.base + t_bytes);
+
+    hipblasPointerModeGuard pointer_mode{handle, mode};
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+    const T one(1), zero(0);
+    const R real_one = 1, real_zero = 0;
+
+    // Z = a*op( Y ) + b*Z for each instance, with one strided batched geam where the backend has it
+    auto geam = [&](hipblasOperation_t op,
+                    int                rows,
+                    int                cols,
+                    const T*           a,
+                    const T*           Y,
+                    int                ldy,
+                    hipblasStride      stride_y,
+                    const T*           b,
+                    T*                 Z,
+                    int                ldz,
+                    hipblasStride      stride_z) {
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return;
+        if(batch_count > 1)
+        {
+            status = traits::geamStridedBatched(handle,
+                                                op,
+                                                HIPBLAS_OP_N,
+                                                rows,
+                                                cols,
+                                                a,
+                                                Y,
+                                                ldy,
+                                                stride_y,
+                                                b,
+                                                Z,
+                                                ldz,
+                                                stride_z,
+                                                Z,
+                                                ldz,
+                                                stride_z,
+                                                batch_count);
+            if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+                return;
+            status = HIPBLAS_STATUS_SUCCESS;
+        }
+        for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = traits::geam(handle,
+                                  op,
+                                  HIPBLAS_OP_N,
+                                  rows,
+                                  cols,
+                                  a,
+                                  Y + i * stride_y,
+                                  ldy,
+                                  b,
+                                  Z + i * stride_z,
+                                  ldz,
+                                  Z + i * stride_z,
+                                  ldz);
+    };
+
+    // Real gemm of depth k on the real views
+    auto gemm = [&](hipblasOperation_t ta,
+                    hipblasOperation_t tb,
+                    int                rows,
+                    int                cols,
+                    const R*           a,
+                    const void*        P,
+                    int                ldp,
+                    hipblasStride      stride_p,
+                    const void*        Q,
+                    int                ldq,
+                    hipblasStride      stride_q,
+                    const R*           b,
+                    void*              Z,
+                    int                ldz,
+                    hipblasStride      stride_z) {
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                    ta,
+                                                    tb,
+                                                    rows,
+                                                    cols,
+                                                    k,
+                                                    a,
+                                                    P,
+                                                    traits::real_type,
+                                                    ldp,
+                                                    stride_p,
+                                                    Q,
+                                                    traits::real_type,
+                                                    ldq,
+                                                    stride_q,
+                                                    b,
+                                                    Z,
+                                                    traits::real_type,
+                                                    ldz,
+                                                    stride_z,
+                                                    batch_count,
+                                                    compute_type,
+                                                    HIPBLAS_GEMM_DEFAULT);
+    };
+
+    hipblasStride      mk = hipblasStride(m) * k, nk = hipblasStride(n) * k;
+    hipblasStride      mn = hipblasStride(m) * n;
+    hipblasOperation_t op_w = HIPBLAS_OP_N;
+    if(a_complex)
+    {
+        // op( A ) as a real 2m x k matrix, so the real gemm forms op( A )*op( B ) interleaved
+        const void*   V        = A;
+        int           ldv      = lda;
+        hipblasStride stride_v = stride_A;
+        if(transa != HIPBLAS_OP_N)
+        {
+            geam(transa, m, k, &one, static_cast<const T*>(A), lda, stride_A, &zero, X, m, mk);
+            V        = X;
+            ldv      = m;
+            stride_v = mk;
+        }
+
+        if(direct)
+        {
+            const R real_alpha = alpha->real(), real_beta = beta->real();
+            gemm(HIPBLAS_OP_N,
+                 transb,
+                 2 * m,
+                 n,
+                 &real_alpha,
+                 V,
+                 2 * ldv,
+                 2 * stride_v,
+                 B,
+                 ldb,
+                 stride_B,
+                 &real_beta,
+                 C,
+                 2 * ldc,
+                 2 * stride_C);
+        }
+        else
+            gemm(HIPBLAS_OP_N,
+                 transb,
+                 2 * m,
+                 n,
+                 &real_one,
+                 V,
+                 2 * ldv,
+                 2 * stride_v,
+                 B,
+                 ldb,
+                 stride_B,
+                 &real_zero,
+                 W,
+                 2 * m,
+                 2 * mn);
+    }
+    else
+    {
+        // op( B )^T as a real 2n x k matrix, so the real gemm forms ( op( A )*op( B ) )^T
+        // interleaved, or its conjugate for op( B ) = B^H
+        const void*   V        = B;
+        int           ldv      = ldb;
+        hipblasStride stride_v = stride_B;
+        op_w                   = transb;
+        if(transb == HIPBLAS_OP_N)
+        {
+            geam(
+                HIPBLAS_OP_T, n, k, &one, static_cast<const T*>(B), ldb, stride_B, &zero, X, n, nk);
+            V        = X;
+            ldv      = n;
+            stride_v = nk;
+            op_w     = HIPBLAS_OP_T;
+        }
+
+        gemm(HIPBLAS_OP_N,
+             transa == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N,
+             2 * n,
+             m,
+             &real_one,
+             V,
+             2 * ldv,
+             2 * stride_v,
+             A,
+             lda,
+             stride_A,
+             &real_zero,
+             W,
+             2 * n,
+             2 * mn);
+    }
+
+    // C = alpha*op( W ) + beta*C with the scalars of the caller
+    if(!direct)
+    {
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(handle, mode);
+        geam(op_w, m, n, alpha, W, a_complex ? m : n, mn, beta, C, ldc, stride_C);
+    }
+    return status;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasGemmBatchedMixedComplexTemplate(hipblasHandle_t      handle,
+                                                              hipblasOperation_t   transa,
+                                                              hipblasOperation_t   transb,
+                                                              int                  m,
+                                                              int                  n,
+                                                              int                  k,
+                                                              const T*             alpha,
+                                                              const void*          A[],
+                                                              int                  lda,
+                                                              const void*          B[],
+                                                              int                  ldb,
+                                                              const T*             beta,
+                                                              void*                C[],
+                                                              int                  ldc,
+                                                              int                  batch_count,
+                                                              bool                 a_complex,
+                                                              hipblasComputeType_t compute_type)
+{
+    using traits = hipblasGemmMixedComplexTraits<T>;
+    using R      = typename traits::real;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Without scratch the arrays of the caller serve as the arrays of the real views
+    if(a_complex && transa == HIPBLAS_OP_N && mode == HIPBLAS_POINTER_MODE_HOST
+       && alpha->imag() == 0 && beta->imag() == 0)
+    {
+        const R real_alpha = alpha->real(), real_beta = beta->real();
+        return hipblasGemmBatchedEx_v2(handle,
+                                       HIPBLAS_OP_N,
+                                       transb,
+                                       2 * m,
+                                       n,
+                                       k,
+                                       &real_alpha,
+                                       A,
+                                       traits::real_type,
+                                       2 * lda,
+                                       B,
+                                       traits::real_type,
+                                       ldb,
+                                       &real_beta,
+                                       C,
+                                       traits::real_type,
+                                       2 * ldc,
+                                       batch_count,
+                                       compute_type,
+                                       HIPBLAS_GEMM_DEFAULT);
+    }
+
+    std::vector<const void*> A_host(batch_count), B_host(batch_count);
+    std::vector<void*>       C_host(batch_count);
+    size_t                   array_bytes = sizeof(void*) * batch_count;
+    if(hipMemcpyAsync(A_host.data(), A, array_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipMemcpyAsync(B_host.data(), B, array_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipMemcpyAsync(C_host.data(), C, array_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = hipblasGemmMixedComplexTemplate(handle,
+                                                 transa,
+                                                 transb,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 A_host[b],
+                                                 lda,
+                                                 0,
+                                                 B_host[b],
+                                                 ldb,
+                                                 0,
+                                                 beta,
+                                                 static_cast<T*>(C_host[b]),
+                                                 ldc,
+                                                 0,
+                                                 1,
+                                                 a_complex,
+                                                 compute_type);
+    return status;
+}
+
+bool hipblasGemmMixedComplex(hipblasHandle_t      handle,
+                             hipblasOperation_t   transa,
+                             hipblasOperation_t   transb,
+                             int                  m,
+                             int                  n,
+                             int                  k,
+                             const void*          alpha,
+                             const void*          A,
+                             hipDataType          a_type,
+                             int                  lda,
+                             hipblasStride        stride_A,
+                             const void*          B,
+                             hipDataType          b_type,
+                             int                  ldb,
+                             hipblasStride        stride_B,
+                             const void*          beta,
+                             void*                C,
+                             hipDataType          c_type,
+                             int                  ldc,
+                             hipblasStride        stride_C,
+                             int                  batch_count,
+                             hipblasComputeType_t compute_type,
+                             hipblasStatus_t&     status)
+{
+    bool a_complex;
+    if(!hipblasGemmMixedComplexTypes(a_type, b_type, c_type, a_complex))
+        return false;
+
+    status = hipblasGemmMixedComplexCheck(
+        handle, transa, transb, m, n, k, lda, ldb, ldc, batch_count, c_type, compute_type);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batch_count)
+        return true;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+    {
+        status = HIPBLAS_STATUS_INVALID_VALUE;
+        return true;
+    }
+
+    if(c_type == HIP_C_32F)
+        status = hipblasGemmMixedComplexTemplate(handle,
+                                                 transa,
+                                                 transb,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 static_cast<const hipblasComplex*>(alpha),
+                                                 A,
+                                                 lda,
+                                                 stride_A,
+                                                 B,
+                                                 ldb,
+                                                 stride_B,
+                                                 static_cast<const hipblasComplex*>(beta),
+                                                 static_cast<hipblasComplex*>(C),
+                                                 ldc,
+                                                 stride_C,
+                                                 batch_count,
+                                                 a_complex,
+                                                 compute_type);
+    else
+        status = hipblasGemmMixedComplexTemplate(handle,
+                                                 transa,
+                                                 transb,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 static_cast<const hipblasDoubleComplex*>(alpha),
+                                                 A,
+                                                 lda,
+                                                 stride_A,
+                                                 B,
+                                                 ldb,
+                                                 stride_B,
+                                                 static_cast<const hipblasDoubleComplex*>(beta),
+                                                 static_cast<hipblasDoubleComplex*>(C),
+                                                 ldc,
+                                                 stride_C,
+                                                 batch_count,
+                                                 a_complex,
+                                                 compute_type);
+    return true;
+}
+
+bool hipblasGemmBatchedMixedComplex(hipblasHandle_t      handle,
+                                    hipblasOperation_t   transa,
+                                    hipblasOperation_t   transb,
+                                    int                  m,
+                                    int                  n,
+                                    int                  k,
+                                    const void*          alpha,
+                                    const void*          A[],
+                                    hipDataType          a_type,
+                                    int                  lda,
+                                    const void*          B[],
+                                    hipDataType          b_type,
+                                    int                  ldb,
+                                    const void*          beta,
+                                    void*                C[],
+                                    hipDataType          c_type,
+                                    int                  ldc,
+                                    int                  batch_count,
+                                    hipblasComputeType_t compute_type,
+                                    hipblasStatus_t&     status)
+{
+    bool a_complex;
+    if(!hipblasGemmMixedComplexTypes(a_type, b_type, c_type, a_complex))
+        return false;
+
+    status = hipblasGemmMixedComplexCheck(
+        handle, transa, transb, m, n, k, lda, ldb, ldc, batch_count, c_type, compute_type);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batch_count)
+        return true;
+    if(!alpha || !beta || !A || !B || !C)
+    {
+        status = HIPBLAS_STATUS_INVALID_VALUE;
+        return true;
+    }
+
+    if(c_type == HIP_C_32F)
+        status = hipblasGemmBatchedMixedComplexTemplate(handle,
+                                                        transa,
+                                                        transb,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        static_cast<const hipblasComplex*>(alpha),
+                                                        A,
+                                                        lda,
+                                                        B,
+                                                        ldb,
+                                                        static_cast<const hipblasComplex*>(beta),
+                                                        C,
+                                                        ldc,
+                                                        batch_count,
+                                                        a_complex,
+                                                        compute_type);
+    else
+        status = hipblasGemmBatchedMixedComplexTemplate(
+            handle,
+            transa,
+            transb,
+            m,
+            n,
+            k,
+            static_cast<const hipblasDoubleComplex*>(alpha),
+            A,
+            lda,
+            B,
+            ldb,
+            static_cast<const hipblasDoubleComplex*>(beta),
+            C,
+            ldc,
+            batch_count,
+            a_complex,
+            compute_type);
+    return true;
+}
@@ -0,0 +1,650 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "pointer_mode.hpp"
+#include "stream_pool.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// Edge of the square tiles of C and depth of the panels of A and B streamed through the device.
+// Halved while the buffers do not fit in device memory.
+static constexpr int out_of_core_tile     = 4096;
+static constexpr int out_of_core_panel    = 2048;
+static constexpr int out_of_core_min_tile = 256;
+
+// Panels of A and B are double buffered, so the copy of the next panel overlaps the gemm of the
+// current one
+static constexpr int out_of_core_buffers = 2;
+
+// Copy stream, events and device buffers of one call, released when it returns. hipFree waits
+// for the device, so no gemm still reads the buffers.
+struct hipblasOutOfCoreResources
+{
+    hipStream_t copy                          = nullptr;
+    hipEvent_t  copied[out_of_core_buffers]   = {};
+    hipEvent_t  computed[out_of_core_buffers] = {};
+    char*       base                          = nullptr;
+
+    ~hipblasOutOfCoreResources()
+    {
+        if(base)
+            (void)hipFree(base);
+        for(int i = 0; i < out_of_core_buffers; i++)
+        {
+            if(copied[i])
+                (void)hipEventDestroy(copied[i]);
+            if(computed[i])
+                (void)hipEventDestroy(computed[i]);
+        }
+        if(copy)
+            (void)hipStreamDestroy(copy);
+    }
+};
+
+// Size of alpha and beta, which have the compute type, complex when C is. 0 if unknown.
+static size_t hipblasOutOfCoreScalarSize(hipblasComputeType_t compute_type, hipDataType c_type)
+{
+    bool complex = c_type == HIP_C_32F || c_type == HIP_C_64F;
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        return 2;
+    case HIPBLAS_COMPUTE_32F:
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+    case HIPBLAS_COMPUTE_32F_FAST_16BFX3:
+        return complex ? 8 : 4;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        return complex ? 16 : 8;
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+// Writes 1 in the scalar type of compute_type to one, which holds 16 bytes
+static void hipblasOutOfCoreOne(hipblasComputeType_t compute_type, char* one)
+{
+    const uint16_t half_one   = 0x3c00;
+    const float    float_one  = 1;
+    const double   double_one = 1;
+    const int32_t  int_one    = 1;
+
+    std::memset(one, 0, 16);
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        std::memcpy(one, &half_one, sizeof(half_one));
+        break;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        std::memcpy(one, &double_one, sizeof(double_one));
+        break;
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        std::memcpy(one, &int_one, sizeof(int_one));
+        break;
+    default:
+        std::memcpy(one, &float_one, sizeof(float_one));
+        break;
+    }
+}
+
+static bool hipblasOutOfCoreIsZero(const void* scalar, size_t size)
+{
+    const char zero[16] = {};
+    return std::memcmp(scalar, zero, size) == 0;
+}
+
+// Device buffers of hipblasGemmPipelinedEx. Problem i uses slot i % slots, which is refilled once
+// the result of problem i - slots is copied back. Fewer slots are used while they do not fit.
+static constexpr int    pipelined_slots = 3;
+static constexpr size_t pipelined_align = 256;
+
+// Copy streams, events and device buffers of one hipblasGemmPipelinedEx call. The buffers are
+// freed in order on the handle stream once it has joined the copy streams; after a failure the
+// copy streams still using them are synchronized first. Streams and events with pending work are
+// released once it is done.
+struct hipblasPipelinedResources
+{
+    hipStream_t stream                    = nullptr;
+    hipStream_t copy_in                   = nullptr;
+    hipStream_t copy_out                  = nullptr;
+    hipEvent_t  copied[pipelined_slots]   = {};
+    hipEvent_t  computed[pipelined_slots] = {};
+    hipEvent_t  written[pipelined_slots]  = {};
+    char*       base                      = nullptr;
+    bool        joined                    = false;
+
+    ~hipblasPipelinedResources()
+    {
+        if(base)
+        {
+            if(!joined)
+            {
+                if(copy_in)
+                    (void)hipStreamSynchronize(copy_in);
+                if(copy_out)
+                    (void)hipStreamSynchronize(copy_out);
+            }
+            (void)hipFreeAsync(base, stream);
+        }
+        for(int i = 0; i < pipelined_slots; i++)
+        {
+            if(copied[i])
+                (void)hipEventDestroy(copied[i]);
+            if(computed[i])
+                (void)hipEventDestroy(computed[i]);
+            if(written[i])
+                (void)hipEventDestroy(written[i]);
+        }
+        if(copy_in)
+            (void)hipStreamDestroy(copy_in);
+        if(copy_out)
+            (void)hipStreamDestroy(copy_out);
+        (void)hipGetLastError();
+    }
+};
+
+static size_t hipblasPipelinedAlign(size_t bytes)
+{
+    return (bytes + pipelined_align - 1) / pipelined_align * pipelined_align;
+}
+
+extern "C" hipblasStatus_t hipblasGemmOutOfCoreEx(hipblasHandle_t      handle,
+                                                  hipblasOperation_t   transA,
+                                                  hipblasOperation_t   transB,
+                                                  int                  m,
+                                                  int                  n,
+                                                  int                  k,
+                                                  const void*          alpha,
+                                                  const void*          A,
+                                                  hipDataType          aType,
+                                                  int                  lda,
+                                                  const void*          B,
+                                                  hipDataType          bType,
+                                                  int                  ldb,
+                                                  const void*          beta,
+                                                  void*                C,
+                                                  hipDataType          cType,
+                                                  int                  ldc,
+                                                  hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  B,
+                  bType,
+                  ldb,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  computeType);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool a_n = transA == HIPBLAS_OP_N, b_n = transB == HIPBLAS_OP_N;
+    if((!a_n && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+       || (!b_n && transB != HIPBLAS_OP_T && transB != HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(1, a_n ? m : k)
+       || ldb < std::max(1, b_n ? k : n) || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t a_size      = hipblasDatatypeSize(aType);
+    size_t b_size      = hipblasDatatypeSize(bType);
+    size_t c_size      = hipblasDatatypeSize(cType);
+    size_t scalar_size = hipblasOutOfCoreScalarSize(computeType, cType);
+    if(!a_size || !b_size || !c_size || !scalar_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // The transfers are steered from the host
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasPointerMode_t mode;
+    status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipblasPointerModeGuard restore{handle, mode};
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // With alpha == 0 only C is scaled
+    int  k_used = hipblasOutOfCoreIsZero(alpha, scalar_size) ? 0 : k;
+    bool load_c = !hipblasOutOfCoreIsZero(beta, scalar_size);
+    char one[16];
+    hipblasOutOfCoreOne(computeType, one);
+
+    hipblasOutOfCoreResources res;
+    if(hipblasInternalStreamCreate(handle, &res.copy) != hipSuccess)
+    {
+        res.copy = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    for(int i = 0; i < out_of_core_buffers; i++)
+    {
+        if(hipEventCreateWithFlags(&res.copied[i], hipEventDisableTiming) != hipSuccess
+           || hipEventCreateWithFlags(&res.computed[i], hipEventDisableTiming) != hipSuccess
+           || hipEventRecord(res.computed[i], stream) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+    }
+
+    // Tiles of tm x tn elements of C and panels of kp columns of op(A) and rows of op(B)
+    int    tile = out_of_core_tile, tm, tn, kp;
+    size_t a_panel, b_panel, c_tile;
+    while(true)
+    {
+        tm      = std::min(m, tile);
+        tn      = std::min(n, tile);
+        kp      = std::max(1, std::min(k_used, std::min(tile, out_of_core_panel)));
+        a_panel = a_size * tm * kp;
+        b_panel = b_size * kp * tn;
+        c_tile  = c_size * tm * tn;
+        if(hipMalloc(&res.base, out_of_core_buffers * (a_panel + b_panel) + c_tile) == hipSuccess)
+            break;
+        res.base = nullptr;
+        (void)hipGetLastError();
+        if(tile <= out_of_core_min_tile)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        tile /= 2;
+    }
+
+    char* dC     = res.base;
+    char* dA[2]  = {dC + c_tile, dC + c_tile + a_panel};
+    char* dB[2]  = {dA[1] + a_panel, dA[1] + a_panel + b_panel};
+    int   ld_a   = a_n ? tm : kp;
+    int   ld_b   = b_n ? kp : tn;
+    int   panels = std::max(1, (k_used + kp - 1) / kp);
+    int   used   = 0;
+
+    auto fail = [](hipError_t error) {
+        if(error == hipSuccess)
+            return false;
+        (void)hipGetLastError();
+        return true;
+    };
+
+    for(int j0 = 0; j0 < n && status == HIPBLAS_STATUS_SUCCESS; j0 += tn)
+    {
+        for(int i0 = 0; i0 < m && status == HIPBLAS_STATUS_SUCCESS; i0 += tm)
+        {
+            int         mb      = std::min(tm, m - i0);
+            int         nb      = std::min(tn, n - j0);
+            const char* C_tile  = static_cast<const char*>(C) + c_size * (i0 + size_t(j0) * ldc);
+            void*       C_write = static_cast<char*>(C) + c_size * (i0 + size_t(j0) * ldc);
+
+            // The copy stream is ordered after the previous tile was written back
+            if(load_c)
+                status = hipblasSetMatrixAsync(mb, nb, c_size, C_tile, ldc, dC, tm, res.copy);
+
+            for(int p = 0; p < panels && status == HIPBLAS_STATUS_SUCCESS; p++, used++)
+            {
+                int    s  = used % out_of_core_buffers;
+                int    k0 = p * kp, kb = std::min(kp, k_used - k0);
+                size_t a0 = a_n ? i0 + size_t(k0) * lda : k0 + size_t(i0) * lda;
+                size_t b0 = b_n ? k0 + size_t(j0) * ldb : j0 + size_t(k0) * ldb;
+
+                // Refill buffer s once the gemm that last read it is done
+                if(fail(hipStreamWaitEvent(res.copy, res.computed[s], 0)))
+                    status = HIPBLAS_STATUS_EXECUTION_FAILED;
+                if(status == HIPBLAS_STATUS_SUCCESS && kb)
+                    status = hipblasSetMatrixAsync(a_n ? mb : kb,
+                                                   a_n ? kb : mb,
+                                                   a_size,
+                                                   static_cast<const char*>(A) + a_size * a0,
+                                                   lda,
+                                                   dA[s],
+                                                   ld_a,
+                                                   res.copy);
+                if(status == HIPBLAS_STATUS_SUCCESS && kb)
+                    status = hipblasSetMatrixAsync(b_n ? kb : nb,
+                                                   b_n ? nb : kb,
+                                                   b_size,
+                                                   static_cast<const char*>(B) + b_size * b0,
+                                                   ldb,
+                                                   dB[s],
+                                                   ld_b,
+                                                   res.copy);
+                if(status == HIPBLAS_STATUS_SUCCESS
+                   && (fail(hipEventRecord(res.copied[s], res.copy))
+                       || fail(hipStreamWaitEvent(stream, res.copied[s], 0))))
+                    status = HIPBLAS_STATUS_EXECUTION_FAILED;
+
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasGemmEx_v2(handle,
+                                              transA,
+                                              transB,
+                                              mb,
+                                              nb,
+                                              kb,
+                                              alpha,
+                                              dA[s],
+                                              aType,
+                                              ld_a,
+                                              dB[s],
+                                              bType,
+                                              ld_b,
+                                              p ? one : beta,
+                                              dC,
+                                              cType,
+                                              tm,
+                                              computeType,
+                                              HIPBLAS_GEMM_DEFAULT);
+                if(status == HIPBLAS_STATUS_SUCCESS
+                   && fail(hipEventRecord(res.computed[s], stream)))
+                    status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            }
+
+            // Write the tile back once its last gemm is done
+            int last = (used + out_of_core_buffers - 1) % out_of_core_buffers;
+            if(status == HIPBLAS_STATUS_SUCCESS
+               && fail(hipStreamWaitEvent(res.copy, res.computed[last], 0)))
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGetMatrixAsync(mb, nb, c_size, dC, tm, C_write, ldc, res.copy);
+        }
+    }
+
+    if(fail(hipStreamSynchronize(res.copy)) && status == HIPBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmPipelinedEx(hipblasHandle_t                handle,
+                                                  int                            problemCount,
+                                                  const hipblasGemmHostProblem_t problems[],
+                                                  hipDataType                    aType,
+                                                  hipDataType                    bType,
+                                                  hipDataType                    cType,
+                                                  hipblasComputeType_t           computeType,
+                                                  hipEvent_t                     done)
+try
+{
+    HIPBLAS_LAYER(handle, problemCount, problems, aType, bType, cType, computeType, done);
+    // The problems describe column-major matrices only
+    if(hipblasLayoutRowMajor())
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(problemCount < 0 || (problemCount && !problems))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    for(int i = 0; i < problemCount; i++)
+    {
+        const hipblasGemmHostProblem_t& p = problems[i];
+
+        bool a_n = p.transA == HIPBLAS_OP_N, b_n = p.transB == HIPBLAS_OP_N;
+        if((!a_n && p.transA != HIPBLAS_OP_T && p.transA != HIPBLAS_OP_C)
+           || (!b_n && p.transB != HIPBLAS_OP_T && p.transB != HIPBLAS_OP_C))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(p.m < 0 || p.n < 0 || p.k < 0 || p.lda < std::max(1, a_n ? p.m : p.k)
+           || p.ldb < std::max(1, b_n ? p.k : p.n) || p.ldc < std::max(1, p.m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(p.m && p.n && (!p.alpha || !p.beta || !p.C || (p.k && (!p.A || !p.B))))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    size_t a_size      = hipblasDatatypeSize(aType);
+    size_t b_size      = hipblasDatatypeSize(bType);
+    size_t c_size      = hipblasDatatypeSize(cType);
+    size_t scalar_size = hipblasOutOfCoreScalarSize(computeType, cType);
+    if(!a_size || !b_size || !c_size || !scalar_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasPipelinedResources res;
+    hipblasStatus_t           status = hipblasGetStream(handle, &res.stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(res.stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    auto fail = [](hipError_t error) {
+        if(error == hipSuccess)
+            return false;
+        (void)hipGetLastError();
+        return true;
+    };
+
+    // The problems that do any work, and the largest slot they need, with op( A ), op( B ) and C
+    // packed
+    std::vector<int> active;
+    size_t           slot_bytes = 0;
+    for(int i = 0; i < problemCount; i++)
+    {
+        const hipblasGemmHostProblem_t& p = problems[i];
+        if(!p.m || !p.n)
+            continue;
+        active.push_back(i);
+        slot_bytes = std::max(slot_bytes,
+                              hipblasPipelinedAlign(a_size * p.m * p.k)
+                                  + hipblasPipelinedAlign(b_size * p.k * p.n)
+                                  + hipblasPipelinedAlign(c_size * p.m * p.n));
+    }
+    if(active.empty())
+        return done && fail(hipEventRecord(done, res.stream)) ? HIPBLAS_STATUS_EXECUTION_FAILED
+                                                              : HIPBLAS_STATUS_SUCCESS;
+
+    hipblasPointerMode_t mode;
+    status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipblasPointerModeGuard restore{handle, mode};
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(fail(hipblasInternalStreamCreate(handle, &res.copy_in)))
+    {
+        res.copy_in = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    if(fail(hipblasInternalStreamCreate(handle, &res.copy_out)))
+    {
+        res.copy_out = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    for(int i = 0; i < pipelined_slots; i++)
+    {
+        if(fail(hipEventCreateWithFlags(&res.copied[i], hipEventDisableTiming))
+           || fail(hipEventCreateWithFlags(&res.computed[i], hipEventDisableTiming))
+           || fail(hipEventCreateWithFlags(&res.written[i], hipEventDisableTiming)))
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    int slots = std::min(pipelined_slots, int(active.size()));
+    while(fail(hipMallocAsync((void**)&res.base, slots * slot_bytes, res.stream)))
+    {
+        res.base = nullptr;
+        if(slots == 1)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        slots--;
+    }
+
+    // The slots start free once the work already on the handle stream is done
+    for(int s = 0; s < slots; s++)
+        if(fail(hipEventRecord(res.written[s], res.stream)))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    // Copies C of the problem with the q-th active index back once its gemm is done
+    auto download = [&](size_t q) {
+        const hipblasGemmHostProblem_t& p  = problems[active[q]];
+        int                             s  = q % slots;
+        char*                           dC = res.base + s * slot_bytes
+                       + hipblasPipelinedAlign(a_size * p.m * p.k)
+                       + hipblasPipelinedAlign(b_size * p.k * p.n);
+
+        if(fail(hipStreamWaitEvent(res.copy_out, res.computed[s], 0)))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        hipblasStatus_t get_status
+            = hipblasGetMatrixAsync(p.m, p.n, c_size, dC, p.m, p.C, p.ldc, res.copy_out);
+        if(get_status == HIPBLAS_STATUS_SUCCESS
+           && fail(hipEventRecord(res.written[s], res.copy_out)))
+            get_status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        return get_status;
+    };
+
+    // C of each problem is copied back after the next gemm is queued, so the device stays busy
+    // while a staged download waits for its gemm. With one slot it is copied back before the
+    // slot is refilled.
+    size_t downloaded = 0;
+    for(size_t q = 0; q < active.size() && status == HIPBLAS_STATUS_SUCCESS; q++)
+    {
+        if(q >= size_t(slots) && downloaded <= q - slots)
+            status = download(downloaded++);
+
+        const hipblasGemmHostProblem_t& p   = problems[active[q]];
+        bool                            a_n = p.transA == HIPBLAS_OP_N;
+        bool                            b_n = p.transB == HIPBLAS_OP_N;
+        int                             s   = q % slots;
+
+        // With alpha == 0 only C is scaled
+        int   k_used = hipblasOutOfCoreIsZero(p.alpha, scalar_size) ? 0 : p.k;
+        bool  load_c = !hipblasOutOfCoreIsZero(p.beta, scalar_size);
+        int   ld_a   = std::max(1, a_n ? p.m : p.k);
+        int   ld_b   = std::max(1, b_n ? p.k : p.n);
+        char* dA     = res.base + s * slot_bytes;
+        char* dB     = dA + hipblasPipelinedAlign(a_size * p.m * p.k);
+        char* dC     = dB + hipblasPipelinedAlign(b_size * p.k * p.n);
+
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && fail(hipStreamWaitEvent(res.copy_in, res.written[s], 0)))
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        if(status == HIPBLAS_STATUS_SUCCESS && k_used)
+            status = hipblasSetMatrixAsync(a_n ? p.m : p.k,
+                                           a_n ? p.k : p.m,
+                                           a_size,
+                                           p.A,
+                                           p.lda,
+                                           dA,
+                                           ld_a,
+                                           res.copy_in);
+        if(status == HIPBLAS_STATUS_SUCCESS && k_used)
+            status = hipblasSetMatrixAsync(b_n ? p.k : p.n,
+                                           b_n ? p.n : p.k,
+                                           b_size,
+                                           p.B,
+                                           p.ldb,
+                                           dB,
+                                           ld_b,
+                                           res.copy_in);
+        if(status == HIPBLAS_STATUS_SUCCESS && load_c)
+            status = hipblasSetMatrixAsync(p.m, p.n, c_size, p.C, p.ldc, dC, p.m, res.copy_in);
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && (fail(hipEventRecord(res.copied[s], res.copy_in))
+               || fail(hipStreamWaitEvent(res.stream, res.copied[s], 0))))
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGemmEx_v2(handle,
+                                      p.transA,
+                                      p.transB,
+                                      p.m,
+                                      p.n,
+                                      k_used,
+                                      p.alpha,
+                                      dA,
+                                      aType,
+                                      ld_a,
+                                      dB,
+                                      bType,
+                                      ld_b,
+                                      p.beta,
+                                      dC,
+                                      cType,
+                                      p.m,
+                                      computeType,
+                                      HIPBLAS_GEMM_DEFAULT);
+        if(status == HIPBLAS_STATUS_SUCCESS && fail(hipEventRecord(res.computed[s], res.stream)))
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if(status == HIPBLAS_STATUS_SUCCESS && downloaded < q)
+            status = download(downloaded++);
+    }
+    while(status == HIPBLAS_STATUS_SUCCESS && downloaded < active.size())
+        status = download(downloaded++);
+
+    // Later work on the handle stream runs after the last download
+    int last = (active.size() - 1) % slots;
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        if(fail(hipStreamWaitEvent(res.stream, res.written[last], 0)))
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        else
+            res.joined = true;
+    }
+    if(status == HIPBLAS_STATUS_SUCCESS && done && fail(hipEventRecord(done, res.stream)))
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    if(status == HIPBLAS_STATUS_SUCCESS && !done
+       && fail(hipEventSynchronize(res.written[last])))
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,310 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_out_of_place.hpp"
+#include "datatype.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+hipblasStatus_t hipblasGemmOutOfPlaceCheck(hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           int                lda,
+                                           int                ldb,
+                                           const void*        C,
+                                           hipDataType        c_type,
+                                           int                ldc,
+                                           hipblasStride      stride_C,
+                                           const void*        D,
+                                           hipDataType        d_type,
+                                           int                ldd,
+                                           hipblasStride      stride_D,
+                                           int                batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+    if((!a_n && transa != HIPBLAS_OP_T && transa != HIPBLAS_OP_C)
+       || (!b_n && transb != HIPBLAS_OP_T && transb != HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, a_n ? m : k)
+       || ldb < std::max(1, b_n ? k : n) || ldc < std::max(1, m) || ldd < std::max(1, m)
+       || (C && C == D && (c_type != d_type || ldc != ldd || stride_C != stride_D)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!hipblasDatatypeSize(c_type) || !hipblasDatatypeSize(d_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// The strided batched form, and every instance of the batched one
+static hipblasStatus_t hipblasGemmOutOfPlaceStrided(hipblasHandle_t      handle,
+                                                    hipblasOperation_t   transa,
+                                                    hipblasOperation_t   transb,
+                                                    int                  m,
+                                                    int                  n,
+                                                    int                  k,
+                                                    const void*          alpha,
+                                                    const void*          A,
+                                                    hipDataType          a_type,
+                                                    int                  lda,
+                                                    hipblasStride        stride_A,
+                                                    const void*          B,
+                                                    hipDataType          b_type,
+                                                    int                  ldb,
+                                                    hipblasStride        stride_B,
+                                                    const void*          beta,
+                                                    const void*          C,
+                                                    hipDataType          c_type,
+                                                    int                  ldc,
+                                                    hipblasStride        stride_C,
+                                                    void*                D,
+                                                    hipDataType          d_type,
+                                                    int                  ldd,
+                                                    hipblasStride        stride_D,
+                                                    int                  batch_count,
+                                                    hipblasComputeType_t compute_type,
+                                                    hipblasGemmAlgo_t    algo)
+{
+    if(!C || !D)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    bool convert = d_type != c_type;
+#ifndef HIPBLAS_CONVERT
+    if(convert)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+
+    hipblasStreamScratch scratch;
+    hipblasStatus_t      status = hipblasGetStream(handle, &scratch.stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The matrices updated in place by the gemm: D, or packed copies of C in scratch
+    size_t        size     = hipblasDatatypeSize(c_type);
+    char*         T        = static_cast<char*>(D);
+    int           ldt      = ldd;
+    hipblasStride stride_T = stride_D;
+    if(convert)
+    {
+        if(hipMallocAsync((void**)&scratch.base, size * m * n * batch_count, scratch.stream)
+           != hipSuccess)
+        {
+            scratch.base = nullptr;
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        T        = scratch.base;
+        ldt      = m;
+        stride_T = hipblasStride(m) * n;
+    }
+
+    for(int i = 0; i < batch_count && C != T; i++)
+        if(hipMemcpy2DAsync(T + size * i * stride_T,
+                            size * ldt,
+                            static_cast<const char*>(C) + size * i * stride_C,
+                            size * ldc,
+                            size * m,
+                            n,
+                            hipMemcpyDeviceToDevice,
+                            scratch.stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    status = hipblasGemmStridedBatchedEx_v2(handle,
+                                            transa,
+                                            transb,
+                                            m,
+                                            n,
+                                            k,
+                                            alpha,
+                                            A,
+                                            a_type,
+                                            lda,
+                                            stride_A,
+                                            B,
+                                            b_type,
+                                            ldb,
+                                            stride_B,
+                                            beta,
+                                            T,
+                                            c_type,
+                                            ldt,
+                                            stride_T,
+                                            batch_count,
+                                            compute_type,
+                                            algo);
+
+    // Each column of T_i is one vector of the conversion to the columns of D_i
+    size_t d_size = hipblasDatatypeSize(d_type);
+    for(int i = 0; i < batch_count && convert && status == HIPBLAS_STATUS_SUCCESS; i++)
+        status = hipblasConvertStridedBatchedEx(handle,
+                                                m,
+                                                nullptr,
+                                                HIP_R_32F,
+                                                T + size * i * stride_T,
+                                                c_type,
+                                                ldt,
+                                                static_cast<char*>(D) + d_size * i * stride_D,
+                                                d_type,
+                                                ldd,
+                                                HIPBLAS_CONVERT_DEFAULT,
+                                                n);
+    return status;
+}
+
+hipblasStatus_t hipblasGemmOutOfPlaceEmulated(hipblasHandle_t      handle,
+                                              hipblasOperation_t   transa,
+                                              hipblasOperation_t   transb,
+                                              int                  m,
+                                              int                  n,
+                                              int                  k,
+                                              const void*          alpha,
+                                              const void*          A,
+                                              hipDataType          a_type,
+                                              int                  lda,
+                                              hipblasStride        stride_A,
+                                              const void*          B,
+                                              hipDataType          b_type,
+                                              int                  ldb,
+                                              hipblasStride        stride_B,
+                                              const void*          beta,
+                                              const void*          C,
+                                              hipDataType          c_type,
+                                              int                  ldc,
+                                              hipblasStride        stride_C,
+                                              void*                D,
+                                              hipDataType          d_type,
+                                              int                  ldd,
+                                              hipblasStride        stride_D,
+                                              int                  batch_count,
+                                              hipblasComputeType_t compute_type,
+                                              hipblasGemmAlgo_t    algo,
+                                              bool                 batched)
+{
+    hipblasStatus_t status = hipblasGemmOutOfPlaceCheck(handle,
+                                                        transa,
+                                                        transb,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        lda,
+                                                        ldb,
+                                                        C,
+                                                        c_type,
+                                                        ldc,
+                                                        stride_C,
+                                                        D,
+                                                        d_type,
+                                                        ldd,
+                                                        stride_D,
+                                                        batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batch_count)
+        return status;
+
+    if(!batched)
+        return hipblasGemmOutOfPlaceStrided(handle,
+                                            transa,
+                                            transb,
+                                            m,
+                                            n,
+                                            k,
+                                            alpha,
+                                            A,
+                                            a_type,
+                                            lda,
+                                            stride_A,
+                                            B,
+                                            b_type,
+                                            ldb,
+                                            stride_B,
+                                            beta,
+                                            C,
+                                            c_type,
+                                            ldc,
+                                            stride_C,
+                                            D,
+                                            d_type,
+                                            ldd,
+                                            stride_D,
+                                            batch_count,
+                                            compute_type,
+                                            algo);
+
+    if(!A || !B || !C || !D)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::vector<const void*> A_host(batch_count), B_host(batch_count), C_host(batch_count);
+    std::vector<void*>       D_host(batch_count);
+    size_t                   array_bytes = sizeof(void*) * batch_count;
+    if(hipMemcpyAsync(A_host.data(), A, array_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipMemcpyAsync(B_host.data(), B, array_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipMemcpyAsync(C_host.data(), C, array_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipMemcpyAsync(D_host.data(), D, array_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = hipblasGemmOutOfPlaceStrided(handle,
+                                              transa,
+                                              transb,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A_host[b],
+                                              a_type,
+                                              lda,
+                                              0,
+                                              B_host[b],
+                                              b_type,
+                                              ldb,
+                                              0,
+                                              beta,
+                                              C_host[b],
+                                              c_type,
+                                              ldc,
+                                              0,
+                                              D_host[b],
+                                              d_type,
+                                              ldd,
+                                              0,
+                                              1,
+                                              compute_type,
+                                              algo);
+    return status;
+}
@@ -0,0 +1,862 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "layout.hpp"
+#include "pointer_mode.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// Real hipBLAS functions of one precision
+template <typename R>
+struct hipblasGemmPlanarFunctions;
+
+template <>
+struct hipblasGemmPlanarFunctions<float>
+{
+    static constexpr auto gemmBatched        = hipblasSgemmBatched;
+    static constexpr auto gemmStridedBatched = hipblasSgemmStridedBatched;
+    static constexpr auto geam               = hipblasSgeam;
+    static constexpr auto geamStridedBatched = hipblasSgeamStridedBatched;
+};
+
+template <>
+struct hipblasGemmPlanarFunctions<double>
+{
+    static constexpr auto gemmBatched        = hipblasDgemmBatched;
+    static constexpr auto gemmStridedBatched = hipblasDgemmStridedBatched;
+    static constexpr auto geam               = hipblasDgeam;
+    static constexpr auto geamStridedBatched = hipblasDgeamStridedBatched;
+};
+
+static hipblasStatus_t hipblasGemmPlanarCheck(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              int                lda,
+                                              int                ldb,
+                                              int                ldc,
+                                              int                batchCount)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+    if((!a_n && transa != HIPBLAS_OP_T && transa != HIPBLAS_OP_C)
+       || (!b_n && transb != HIPBLAS_OP_T && transb != HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || lda < std::max(1, a_n ? m : k)
+       || ldb < std::max(1, b_n ? k : n) || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// alpha and beta in host memory, read back from the device in device pointer mode
+template <typename T>
+static hipblasStatus_t hipblasGemmPlanarScalars(hipblasHandle_t       handle,
+                                                const T*              alpha,
+                                                const T*              beta,
+                                                T&                    h_alpha,
+                                                T&                    h_beta,
+                                                hipStream_t&          stream,
+                                                hipblasPointerMode_t& mode)
+{
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        h_alpha = *alpha;
+        h_beta  = *beta;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    if(hipMemcpyAsync(&h_alpha, alpha, sizeof(T), hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipMemcpyAsync(&h_beta, beta, sizeof(T), hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// C_i := alpha*op( A_i )*op( B_i ) + beta*C_i on planar instances with host scalars, in host
+// pointer mode. op( A ) = op( Ar ) + i*sa*op( Ai ), with sa = -1 for HIPBLAS_OP_C, so the real
+// part of op( A )*op( B ) is op( Ar )*op( Br ) - sa*sb*op( Ai )*op( Bi ) and the imaginary part
+// sa*op( Ai )*op( Br ) + sb*op( Ar )*op( Bi ). With a real alpha these four real gemms accumulate
+// into C, and with a real beta too the first gemm of each part also applies beta. A complex
+// alpha forms the parts in scratch first and geam adds them into C, and a complex beta scales
+// C in place through a copy of Cr.
+template <typename R, typename T>
+static hipblasStatus_t hipblasGemmPlanarTemplate(hipblasHandle_t    handle,
+                                                 hipStream_t        stream,
+                                                 hipblasOperation_t transa,
+                                                 hipblasOperation_t transb,
+                                                 int                m,
+                                                 int                n,
+                                                 int                k,
+                                                 T                  alpha,
+                                                 const R*           Ar,
+                                                 const R*           Ai,
+                                                 int                lda,
+                                                 hipblasStride      strideA,
+                                                 const R*           Br,
+                                                 const R*           Bi,
+                                                 int                ldb,
+                                                 hipblasStride      strideB,
+                                                 T                  beta,
+                                                 R*                 Cr,
+                                                 R*                 Ci,
+                                                 int                ldc,
+                                                 hipblasStride      strideC,
+                                                 int                batchCount)
+{
+    using F = hipblasGemmPlanarFunctions<R>;
+
+    const R ar = alpha.real(), ai = alpha.imag(), br = beta.real(), bi = beta.imag();
+    const R one = 1, zero = 0;
+    const R sa = transa == HIPBLAS_OP_C ? -1 : 1, sb = transb == HIPBLAS_OP_C ? -1 : 1;
+
+    hipblasOperation_t ta = transa == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    hipblasOperation_t tb = transb == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+
+    bool product = k > 0 && (ar != 0 || ai != 0);
+    bool fold    = product && ai == 0 && bi == 0;
+
+    // Per instance, the copy of Cr for a complex beta, then the two parts of the product
+    hipblasStride mn      = hipblasStride(m) * n;
+    size_t        t_size  = !fold && bi != 0 ? mn : 0;
+    size_t        p_size  = product && ai != 0 ? 2 * mn : 0;
+    size_t        t_bytes = (sizeof(R) * t_size * batchCount + 255) / 256 * 256;
+    size_t        bytes   = t_bytes + sizeof(R) * p_size * batchCount;
+
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    if(bytes && hipMallocAsync((void**)&scratch.base, bytes, stream) != hipSuccess)
+    {
+        scratch.base = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    R* T_r = reinterpret_cast<R*>(scratch.base);
+    R* Pr  = reinterpret_cast<R*>(scratch.base + t_bytes);
+    R* Pi  = Pr + mn * batchCount;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Z_i = a*Y_i + b*Z_i, with one strided batched geam where the backend has it
+    auto geam = [&](const R*      a,
+                    const R*      Y,
+                    int           ldy,
+                    hipblasStride stride_y,
+                    const R*      b,
+                    R*            Z,
+                    int           ldz,
+                    hipblasStride stride_z) {
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return;
+        if(batchCount > 1)
+        {
+            status = F::geamStridedBatched(handle,
+                                           HIPBLAS_OP_N,
+                                           HIPBLAS_OP_N,
+                                           m,
+                                           n,
+                                           a,
+                                           Y,
+                                           ldy,
+                                           stride_y,
+                                           b,
+                                           Z,
+                                           ldz,
+                                           stride_z,
+                                           Z,
+                                           ldz,
+                                           stride_z,
+                                           batchCount);
+            if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+                return;
+            status = HIPBLAS_STATUS_SUCCESS;
+        }
+        for(int i = 0; i < batchCount && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = F::geam(handle,
+                             HIPBLAS_OP_N,
+                             HIPBLAS_OP_N,
+                             m,
+                             n,
+                             a,
+                             Y + i * stride_y,
+                             ldy,
+                             b,
+                             Z + i * stride_z,
+                             ldz,
+                             Z + i * stride_z,
+                             ldz);
+    };
+
+    // Z_i = a*op( X_i )*op( Y_i ) + b*Z_i
+    auto gemm = [&](R a, const R* X, const R* Y, R b, R* Z, int ldz, hipblasStride stride_z) {
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = F::gemmStridedBatched(handle,
+                                           ta,
+                                           tb,
+                                           m,
+                                           n,
+                                           k,
+                                           &a,
+                                           X,
+                                           lda,
+                                           strideA,
+                                           Y,
+                                           ldb,
+                                           strideB,
+                                           &b,
+                                           Z,
+                                           ldz,
+                                           stride_z,
+                                           batchCount);
+    };
+
+    // C = beta*C, unless the first gemms apply it
+    if(!fold && bi != 0)
+    {
+        const R minus_bi = -bi;
+        geam(&one, Cr, ldc, strideC, &zero, T_r, m, mn);
+        geam(&minus_bi, Ci, ldc, strideC, &br, Cr, ldc, strideC);
+        geam(&bi, T_r, m, mn, &br, Ci, ldc, strideC);
+    }
+    else if(!fold && br != 1)
+    {
+        geam(&zero, Cr, ldc, strideC, &br, Cr, ldc, strideC);
+        geam(&zero, Ci, ldc, strideC, &br, Ci, ldc, strideC);
+    }
+    if(!product)
+        return status;
+
+    if(ai == 0)
+    {
+        R b0 = fold ? br : 1;
+        gemm(ar, Ar, Br, b0, Cr, ldc, strideC);
+        gemm(-ar * sa * sb, Ai, Bi, 1, Cr, ldc, strideC);
+        gemm(ar * sa, Ai, Br, b0, Ci, ldc, strideC);
+        gemm(ar * sb, Ar, Bi, 1, Ci, ldc, strideC);
+        return status;
+    }
+
+    // P = op( A )*op( B ), then Cr += ar*Pr - ai*Pi and Ci += ai*Pr + ar*Pi
+    gemm(1, Ar, Br, 0, Pr, m, mn);
+    gemm(-sa * sb, Ai, Bi, 1, Pr, m, mn);
+    gemm(sa, Ai, Br, 0, Pi, m, mn);
+    gemm(sb, Ar, Bi, 1, Pi, m, mn);
+
+    const R minus_ai = -ai;
+    geam(&ar, Pr, m, mn, &one, Cr, ldc, strideC);
+    geam(&minus_ai, Pi, m, mn, &one, Cr, ldc, strideC);
+    geam(&ai, Pr, m, mn, &one, Ci, ldc, strideC);
+    geam(&ar, Pi, m, mn, &one, Ci, ldc, strideC);
+    return status;
+}
+
+template <typename R, typename T>
+static hipblasStatus_t hipblasGemmPlanar(hipblasHandle_t    handle,
+                                         hipblasOperation_t transa,
+                                         hipblasOperation_t transb,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const T*           alpha,
+                                         const R*           Ar,
+                                         const R*           Ai,
+                                         int                lda,
+                                         hipblasStride      strideA,
+                                         const R*           Br,
+                                         const R*           Bi,
+                                         int                ldb,
+                                         hipblasStride      strideB,
+                                         const T*           beta,
+                                         R*                 Cr,
+                                         R*                 Ci,
+                                         int                ldc,
+                                         hipblasStride      strideC,
+                                         int                batchCount)
+{
+    hipblasStatus_t status
+        = hipblasGemmPlanarCheck(handle, transa, transb, m, n, k, lda, ldb, ldc, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batchCount)
+        return status;
+    if(!alpha || !beta || !Cr || !Ci || (k && (!Ar || !Ai || !Br || !Bi)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    T                    h_alpha, h_beta;
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    status = hipblasGemmPlanarScalars(handle, alpha, beta, h_alpha, h_beta, stream, mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasPointerModeGuard pointer_mode{handle, mode};
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasGemmPlanarTemplate(handle,
+                                     stream,
+                                     transa,
+                                     transb,
+                                     m,
+                                     n,
+                                     k,
+                                     h_alpha,
+                                     Ar,
+                                     Ai,
+                                     lda,
+                                     strideA,
+                                     Br,
+                                     Bi,
+                                     ldb,
+                                     strideB,
+                                     h_beta,
+                                     Cr,
+                                     Ci,
+                                     ldc,
+                                     strideC,
+                                     batchCount);
+}
+
+// Real alpha and beta with k > 0 run as four batched real gemms on the pointer arrays of the
+// caller. Otherwise the arrays are read back and the instances run one at a time.
+template <typename R, typename T>
+static hipblasStatus_t hipblasGemmPlanarBatched(hipblasHandle_t    handle,
+                                                hipblasOperation_t transa,
+                                                hipblasOperation_t transb,
+                                                int                m,
+                                                int                n,
+                                                int                k,
+                                                const T*           alpha,
+                                                const R* const     Ar[],
+                                                const R* const     Ai[],
+                                                int                lda,
+                                                const R* const     Br[],
+                                                const R* const     Bi[],
+                                                int                ldb,
+                                                const T*           beta,
+                                                R* const           Cr[],
+                                                R* const           Ci[],
+                                                int                ldc,
+                                                int                batchCount)
+{
+    using F = hipblasGemmPlanarFunctions<R>;
+
+    hipblasStatus_t status
+        = hipblasGemmPlanarCheck(handle, transa, transb, m, n, k, lda, ldb, ldc, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batchCount)
+        return status;
+    if(!alpha || !beta || !Ar || !Ai || !Br || !Bi || !Cr || !Ci)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    T                    h_alpha, h_beta;
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    status = hipblasGemmPlanarScalars(handle, alpha, beta, h_alpha, h_beta, stream, mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasPointerModeGuard pointer_mode{handle, mode};
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    const R ar = h_alpha.real(), br = h_beta.real();
+    if(k > 0 && ar != 0 && h_alpha.imag() == 0 && h_beta.imag() == 0)
+    {
+        const R sa = transa == HIPBLAS_OP_C ? -1 : 1, sb = transb == HIPBLAS_OP_C ? -1 : 1;
+        const R one = 1;
+
+        hipblasOperation_t ta = transa == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+        hipblasOperation_t tb = transb == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+
+        auto gemm = [&](R a, const R* const X[], const R* const Y[], const R* b, R* const Z[]) {
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = F::gemmBatched(
+                    handle, ta, tb, m, n, k, &a, X, lda, Y, ldb, b, Z, ldc, batchCount);
+        };
+        gemm(ar, Ar, Br, &br, Cr);
+        gemm(-ar * sa * sb, Ai, Bi, &one, Cr);
+        gemm(ar * sa, Ai, Br, &br, Ci);
+        gemm(ar * sb, Ar, Bi, &one, Ci);
+        return status;
+    }
+
+    std::vector<const R*> A_host(2 * batchCount), B_host(2 * batchCount);
+    std::vector<R*>       C_host(2 * batchCount);
+    size_t                array_bytes = sizeof(R*) * batchCount;
+    auto read = [&](void* host, const void* device) {
+        return hipMemcpyAsync(host, device, array_bytes, hipMemcpyDeviceToHost, stream)
+               == hipSuccess;
+    };
+    if(!read(A_host.data(), Ar) || !read(A_host.data() + batchCount, Ai)
+       || !read(B_host.data(), Br) || !read(B_host.data() + batchCount, Bi)
+       || !read(C_host.data(), Cr) || !read(C_host.data() + batchCount, Ci)
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    for(int b = 0; b < batchCount && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = hipblasGemmPlanarTemplate(handle,
+                                           stream,
+                                           transa,
+                                           transb,
+                                           m,
+                                           n,
+                                           k,
+                                           h_alpha,
+                                           A_host[b],
+                                           A_host[batchCount + b],
+                                           lda,
+                                           0,
+                                           B_host[b],
+                                           B_host[batchCount + b],
+                                           ldb,
+                                           0,
+                                           h_beta,
+                                           C_host[b],
+                                           C_host[batchCount + b],
+                                           ldc,
+                                           0,
+                                           1);
+    return status;
+}
+
+extern "C" hipblasStatus_t hipblasCgemmPlanar(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transa,
+                                              hipblasOperation_t    transb,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const float*          Ar,
+                                              const float*          Ai,
+                                              int                   lda,
+                                              const float*          Br,
+                                              const float*          Bi,
+                                              int                   ldb,
+                                              const hipblasComplex* beta,
+                                              float*                Cr,
+                                              float*                Ci,
+                                              int                   ldc)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            Ar,
+                            Ai,
+                            lda,
+                            Br,
+                            Bi,
+                            ldb,
+                            beta,
+                            Cr,
+                            Ci,
+                            ldc);
+    hipblasLayoutGemm(transa, transb, m, n, std::tie(Ar, Ai, lda), std::tie(Br, Bi, ldb));
+    return hipblasGemmPlanar(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             Ar,
+                             Ai,
+                             lda,
+                             0,
+                             Br,
+                             Bi,
+                             ldb,
+                             0,
+                             beta,
+                             Cr,
+                             Ci,
+                             ldc,
+                             0,
+                             1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgemmPlanarBatched(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    transa,
+                                                     hipblasOperation_t    transb,
+                                                     int                   m,
+                                                     int                   n,
+                                                     int                   k,
+                                                     const hipblasComplex* alpha,
+                                                     const float* const    Ar[],
+                                                     const float* const    Ai[],
+                                                     int                   lda,
+                                                     const float* const    Br[],
+                                                     const float* const    Bi[],
+                                                     int                   ldb,
+                                                     const hipblasComplex* beta,
+                                                     float* const          Cr[],
+                                                     float* const          Ci[],
+                                                     int                   ldc,
+                                                     int                   batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            Ar,
+                            Ai,
+                            lda,
+                            Br,
+                            Bi,
+                            ldb,
+                            beta,
+                            Cr,
+                            Ci,
+                            ldc,
+                            batchCount);
+    hipblasLayoutGemm(
+        transa, transb, m, n, std::tie(Ar, Ai, lda), std::tie(Br, Bi, ldb));
+    return hipblasGemmPlanarBatched(handle,
+                                    transa,
+                                    transb,
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    Ar,
+                                    Ai,
+                                    lda,
+                                    Br,
+                                    Bi,
+                                    ldb,
+                                    beta,
+                                    Cr,
+                                    Ci,
+                                    ldc,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgemmPlanarStridedBatched(hipblasHandle_t       handle,
+                                                            hipblasOperation_t    transa,
+                                                            hipblasOperation_t    transb,
+                                                            int                   m,
+                                                            int                   n,
+                                                            int                   k,
+                                                            const hipblasComplex* alpha,
+                                                            const float*          Ar,
+                                                            const float*          Ai,
+                                                            int                   lda,
+                                                            hipblasStride         strideA,
+                                                            const float*          Br,
+                                                            const float*          Bi,
+                                                            int                   ldb,
+                                                            hipblasStride         strideB,
+                                                            const hipblasComplex* beta,
+                                                            float*                Cr,
+                                                            float*                Ci,
+                                                            int                   ldc,
+                                                            hipblasStride         strideC,
+                                                            int                   batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            Ar,
+                            Ai,
+                            lda,
+                            strideA,
+                            Br,
+                            Bi,
+                            ldb,
+                            strideB,
+                            beta,
+                            Cr,
+                            Ci,
+                            ldc,
+                            strideC,
+                            batchCount);
+    hipblasLayoutGemm(transa,
+                      transb,
+                      m,
+                      n,
+                      std::tie(Ar, Ai, lda, strideA),
+                      std::tie(Br, Bi, ldb, strideB));
+    return hipblasGemmPlanar(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             Ar,
+                             Ai,
+                             lda,
+                             strideA,
+                             Br,
+                             Bi,
+                             ldb,
+                             strideB,
+                             beta,
+                             Cr,
+                             Ci,
+                             ldc,
+                             strideC,
+                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgemmPlanar(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transa,
+                                              hipblasOperation_t          transb,
+                                              int                         m,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const double*               Ar,
+                                              const double*               Ai,
+                                              int                         lda,
+                                              const double*               Br,
+                                              const double*               Bi,
+                                              int                         ldb,
+                                              const hipblasDoubleComplex* beta,
+                                              double*                     Cr,
+                                              double*                     Ci,
+                                              int                         ldc)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            Ar,
+                            Ai,
+                            lda,
+                            Br,
+                            Bi,
+                            ldb,
+                            beta,
+                            Cr,
+                            Ci,
+                            ldc);
+    hipblasLayoutGemm(transa, transb, m, n, std::tie(Ar, Ai, lda), std::tie(Br, Bi, ldb));
+    return hipblasGemmPlanar(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             Ar,
+                             Ai,
+                             lda,
+                             0,
+                             Br,
+                             Bi,
+                             ldb,
+                             0,
+                             beta,
+                             Cr,
+                             Ci,
+                             ldc,
+                             0,
+                             1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgemmPlanarBatched(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transa,
+                                                     hipblasOperation_t          transb,
+                                                     int                         m,
+                                                     int                         n,
+                                                     int                         k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const double* const         Ar[],
+                                                     const double* const         Ai[],
+                                                     int                         lda,
+                                                     const double* const         Br[],
+                                                     const double* const         Bi[],
+                                                     int                         ldb,
+                                                     const hipblasDoubleComplex* beta,
+                                                     double* const               Cr[],
+                                                     double* const               Ci[],
+                                                     int                         ldc,
+                                                     int                         batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            Ar,
+                            Ai,
+                            lda,
+                            Br,
+                            Bi,
+                            ldb,
+                            beta,
+                            Cr,
+                            Ci,
+                            ldc,
+                            batchCount);
+    hipblasLayoutGemm(
+        transa, transb, m, n, std::tie(Ar, Ai, lda), std::tie(Br, Bi, ldb));
+    return hipblasGemmPlanarBatched(handle,
+                                    transa,
+                                    transb,
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    Ar,
+                                    Ai,
+                                    lda,
+                                    Br,
+                                    Bi,
+                                    ldb,
+                                    beta,
+                                    Cr,
+                                    Ci,
+                                    ldc,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgemmPlanarStridedBatched(hipblasHandle_t             handle,
+                                                            hipblasOperation_t          transa,
+                                                            hipblasOperation_t          transb,
+                                                            int                         m,
+                                                            int                         n,
+                                                            int                         k,
+                                                            const hipblasDoubleComplex* alpha,
+                                                            const double*               Ar,
+                                                            const double*               Ai,
+                                                            int                         lda,
+                                                            hipblasStride               strideA,
+                                                            const double*               Br,
+                                                            const double*               Bi,
+                                                            int                         ldb,
+                                                            hipblasStride               strideB,
+                                                            const hipblasDoubleComplex* beta,
+                                                            double*                     Cr,
+                                                            double*                     Ci,
+                                                            int                         ldc,
+                                                            hipblasStride               strideC,
+                                                            int                         batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            Ar,
+                            Ai,
+                            lda,
+                            strideA,
+                            Br,
+                            Bi,
+                            ldb,
+                            strideB,
+                            beta,
+                            Cr,
+                            Ci,
+                            ldc,
+                            strideC,
+                            batchCount);
+    hipblasLayoutGemm(transa,
+                      transb,
+                      m,
+                      n,
+                      std::tie(Ar, Ai, lda, strideA),
+                      std::tie(Br, Bi, ldb, strideB));
+    return hipblasGemmPlanar(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             Ar,
+                             Ai,
+                             lda,
+                             strideA,
+                             Br,
+                             Bi,
+                             ldb,
+                             strideB,
+                             beta,
+                             Cr,
+                             Ci,
+                             ldc,
+                             strideC,
+                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,572 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "gemm_quantized.hpp"
+#include "layer.hpp"
+#include "pointer_mode.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+// Bytes of the int32 accumulators of one panel of columns of C, small enough to be requantized
+// from cache right after the gemm wrote them
+static constexpr size_t quantized_panel_bytes = size_t(8) << 20;
+
+static hipblasStatus_t hipblasGemmQuantized(hipblasHandle_t         handle,
+                                            hipblasOperation_t      transA,
+                                            hipblasOperation_t      transB,
+                                            int                     m,
+                                            int                     n,
+                                            int                     k,
+                                            const void*             A,
+                                            int                     lda,
+                                            hipblasStride           strideA,
+                                            const void*             B,
+                                            int                     ldb,
+                                            hipblasStride           strideB,
+                                            hipblasQuantScaleMode_t scaleMode,
+                                            const float*            scale,
+                                            void*                   C,
+                                            hipDataType             cType,
+                                            int                     ldc,
+                                            hipblasStride           strideC,
+                                            int                     batchCount)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool a_n = transA == HIPBLAS_OP_N, b_n = transB == HIPBLAS_OP_N;
+    if((!a_n && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+       || (!b_n && transB != HIPBLAS_OP_T && transB != HIPBLAS_OP_C)
+       || (scaleMode != HIPBLAS_QUANT_SCALE_TENSOR && scaleMode != HIPBLAS_QUANT_SCALE_ROW
+           && scaleMode != HIPBLAS_QUANT_SCALE_COLUMN))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || lda < std::max(1, a_n ? m : k)
+       || ldb < std::max(1, b_n ? k : n) || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t c_size = cType == HIP_R_8I ? 1 : cType == HIP_R_16F ? 2 : cType == HIP_R_32F ? 4 : 0;
+    if(!c_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!scale || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_GEMM_QUANTIZED
+    // Every panel is requantized before the next gemm overwrites the accumulators
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasPointerMode_t mode;
+    status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipblasPointerModeGuard restore{handle, mode};
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Panels of cols columns of one matrix, or of all columns of batches matrices
+    size_t        column_bytes  = sizeof(int32_t) * m;
+    size_t        panel_cols    = std::max(size_t(1), quantized_panel_bytes / column_bytes);
+    size_t        panel_batches = std::max(size_t(1), panel_cols / n);
+    int           cols          = int(std::min(size_t(n), panel_cols));
+    int           batches       = int(std::min(size_t(batchCount), panel_batches));
+    hipblasStride stride_acc    = hipblasStride(m) * cols;
+
+    hipblasDeviceScratch acc;
+    if(hipMalloc(&acc.base, column_bytes * cols * batches) != hipSuccess)
+    {
+        acc.base = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    const int32_t one = 1, zero = 0;
+    for(int b0 = 0; b0 < batchCount && status == HIPBLAS_STATUS_SUCCESS; b0 += batches)
+    {
+        int bb = std::min(batches, batchCount - b0);
+        for(int j0 = 0; j0 < n && status == HIPBLAS_STATUS_SUCCESS; j0 += cols)
+        {
+            int    nb = std::min(cols, n - j0);
+            size_t b  = b0 * strideB + (b_n ? size_t(j0) * ldb : j0);
+            size_t c  = b0 * strideC + size_t(j0) * ldc;
+
+            status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                    transA,
+                                                    transB,
+                                                    m,
+                                                    nb,
+                                                    k,
+                                                    &one,
+                                                    static_cast<const int8_t*>(A) + b0 * strideA,
+                                                    HIP_R_8I,
+                                                    lda,
+                                                    strideA,
+                                                    static_cast<const int8_t*>(B) + b,
+                                                    HIP_R_8I,
+                                                    ldb,
+                                                    strideB,
+                                                    &zero,
+                                                    acc.base,
+                                                    HIP_R_32I,
+                                                    m,
+                                                    stride_acc,
+                                                    bb,
+                                                    HIPBLAS_COMPUTE_32I,
+                                                    HIPBLAS_GEMM_DEFAULT);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasQuantizeKernels(stream,
+                                                cType,
+                                                scaleMode,
+                                                m,
+                                                nb,
+                                                (const int32_t*)acc.base,
+                                                m,
+                                                stride_acc,
+                                                scale,
+                                                j0,
+                                                static_cast<char*>(C) + c_size * c,
+                                                ldc,
+                                                strideC,
+                                                bb);
+        }
+    }
+    return status;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasGemmQuantizedEx(hipblasHandle_t         handle,
+                                                  hipblasOperation_t      transA,
+                                                  hipblasOperation_t      transB,
+                                                  int                     m,
+                                                  int                     n,
+                                                  int                     k,
+                                                  const void*             A,
+                                                  int                     lda,
+                                                  const void*             B,
+                                                  int                     ldb,
+                                                  hipblasQuantScaleMode_t scaleMode,
+                                                  const float*            scale,
+                                                  void*                   C,
+                                                  hipDataType             cType,
+                                                  int                     ldc)
+try
+{
+    HIPBLAS_LAYER(handle, transA, transB, m, n, k, A, lda, B, ldb, scaleMode, scale, C, cType, ldc);
+    return hipblasGemmQuantized(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                A,
+                                lda,
+                                0,
+                                B,
+                                ldb,
+                                0,
+                                scaleMode,
+                                scale,
+                                C,
+                                cType,
+                                ldc,
+                                0,
+                                1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmStridedBatchedQuantizedEx(hipblasHandle_t         handle,
+                                                                hipblasOperation_t      transA,
+                                                                hipblasOperation_t      transB,
+                                                                int                     m,
+                                                                int                     n,
+                                                                int                     k,
+                                                                const void*             A,
+                                                                int                     lda,
+                                                                hipblasStride           strideA,
+                                                                const void*             B,
+                                                                int                     ldb,
+                                                                hipblasStride           strideB,
+                                                                hipblasQuantScaleMode_t scaleMode,
+                                                                const float*            scale,
+                                                                void*                   C,
+                                                                hipDataType             cType,
+                                                                int                     ldc,
+                                                                hipblasStride           strideC,
+                                                                int                     batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  A,
+                  lda,
+                  strideA,
+                  B,
+                  ldb,
+                  strideB,
+                  scaleMode,
+                  scale,
+                  C,
+                  cType,
+                  ldc,
+                  strideC,
+                  batchCount);
+    return hipblasGemmQuantized(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                A,
+                                lda,
+                                strideA,
+                                B,
+                                ldb,
+                                strideB,
+                                scaleMode,
+                                scale,
+                                C,
+                                cType,
+                                ldc,
+                                strideC,
+                                batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+static hipblasStatus_t hipblasGemmWeightOnly(hipblasHandle_t     handle,
+                                             hipblasOperation_t  transA,
+                                             hipblasOperation_t  transB,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             const float*        alpha,
+                                             const void*         A,
+                                             hipblasWeightType_t aType,
+                                             int                 lda,
+                                             hipblasStride       strideA,
+                                             const void*         scale,
+                                             const void*         zero,
+                                             int                 groupSize,
+                                             hipblasStride       strideScale,
+                                             const void*         B,
+                                             hipDataType         bType,
+                                             int                 ldb,
+                                             hipblasStride       strideB,
+                                             const float*        beta,
+                                             void*               C,
+                                             hipDataType         cType,
+                                             int                 ldc,
+                                             hipblasStride       strideC,
+                                             int                 batchCount)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool a_n = transA == HIPBLAS_OP_N, b_n = transB == HIPBLAS_OP_N;
+    if((!a_n && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+       || (!b_n && transB != HIPBLAS_OP_T && transB != HIPBLAS_OP_C)
+       || (aType != HIPBLAS_WEIGHT_INT8 && aType != HIPBLAS_WEIGHT_UINT8
+           && aType != HIPBLAS_WEIGHT_INT4 && aType != HIPBLAS_WEIGHT_UINT4))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || groupSize < 1
+       || lda < std::max(1, a_n ? m : k) || ldb < std::max(1, b_n ? k : n)
+       || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if((bType != HIP_R_16F && bType != HIP_R_16BF) || (cType != bType && cType != HIP_R_32F))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!A || !B || !scale)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_GEMM_QUANTIZED
+    // Every panel is multiplied before the next one overwrites it
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // Panels of rows rows of op( A ) of one matrix, or of all rows of batches matrices
+    size_t        b_size        = 2;
+    size_t        c_size        = cType == HIP_R_32F ? 4 : 2;
+    size_t        row_bytes     = b_size * std::max(k, 1);
+    size_t        panel_rows    = std::max(size_t(1), quantized_panel_bytes / row_bytes);
+    size_t        panel_batches = std::max(size_t(1), panel_rows / m);
+    int           rows          = int(std::min(size_t(m), panel_rows));
+    int           batches       = int(std::min(size_t(batchCount), panel_batches));
+    hipblasStride stride_panel  = hipblasStride(rows) * k;
+
+    hipblasDeviceScratch panel;
+    if(hipMalloc(&panel.base, row_bytes * rows * batches) != hipSuccess)
+    {
+        panel.base = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    for(int b0 = 0; b0 < batchCount && status == HIPBLAS_STATUS_SUCCESS; b0 += batches)
+    {
+        int         bb      = std::min(batches, batchCount - b0);
+        const char* scale_b = static_cast<const char*>(scale) + b_size * b0 * strideScale;
+        const char* zero_b  = static_cast<const char*>(zero) + b_size * b0 * strideScale;
+        const char* B_b     = static_cast<const char*>(B) + b_size * b0 * strideB;
+        for(int i0 = 0; i0 < m && status == HIPBLAS_STATUS_SUCCESS; i0 += rows)
+        {
+            int    mb = std::min(rows, m - i0);
+            size_t c  = b0 * strideC + i0;
+
+            if(k)
+                status = hipblasDequantizeKernels(stream,
+                                                  aType,
+                                                  bType,
+                                                  !a_n,
+                                                  mb,
+                                                  k,
+                                                  i0,
+                                                  A,
+                                                  int64_t(b0) * strideA,
+                                                  lda,
+                                                  strideA,
+                                                  scale_b,
+                                                  zero ? zero_b : nullptr,
+                                                  m,
+                                                  strideScale,
+                                                  groupSize,
+                                                  panel.base,
+                                                  stride_panel,
+                                                  bb);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                        a_n ? HIPBLAS_OP_N : HIPBLAS_OP_T,
+                                                        transB,
+                                                        mb,
+                                                        n,
+                                                        k,
+                                                        alpha,
+                                                        panel.base,
+                                                        bType,
+                                                        a_n ? mb : std::max(k, 1),
+                                                        stride_panel,
+                                                        B_b,
+                                                        bType,
+                                                        ldb,
+                                                        strideB,
+                                                        beta,
+                                                        static_cast<char*>(C) + c_size * c,
+                                                        cType,
+                                                        ldc,
+                                                        strideC,
+                                                        bb,
+                                                        HIPBLAS_COMPUTE_32F,
+                                                        HIPBLAS_GEMM_DEFAULT);
+        }
+    }
+    return status;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasGemmWeightOnlyEx(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  transA,
+                                                   hipblasOperation_t  transB,
+                                                   int                 m,
+                                                   int                 n,
+                                                   int                 k,
+                                                   const float*        alpha,
+                                                   const void*         A,
+                                                   hipblasWeightType_t aType,
+                                                   int                 lda,
+                                                   const void*         scale,
+                                                   const void*         zero,
+                                                   int                 groupSize,
+                                                   const void*         B,
+                                                   hipDataType         bType,
+                                                   int                 ldb,
+                                                   const float*        beta,
+                                                   void*               C,
+                                                   hipDataType         cType,
+                                                   int                 ldc)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  scale,
+                  zero,
+                  groupSize,
+                  B,
+                  bType,
+                  ldb,
+                  beta,
+                  C,
+                  cType,
+                  ldc);
+    return hipblasGemmWeightOnly(handle,
+                                 transA,
+                                 transB,
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 aType,
+                                 lda,
+                                 0,
+                                 scale,
+                                 zero,
+                                 groupSize,
+                                 0,
+                                 B,
+                                 bType,
+                                 ldb,
+                                 0,
+                                 beta,
+                                 C,
+                                 cType,
+                                 ldc,
+                                 0,
+                                 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGemmStridedBatchedWeightOnlyEx(hipblasHandle_t     handle,
+                                                                 hipblasOperation_t  transA,
+                                                                 hipblasOperation_t  transB,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 const float*        alpha,
+                                                                 const void*         A,
+                                                                 hipblasWeightType_t aType,
+                                                                 int                 lda,
+                                                                 hipblasStride       strideA,
+                                                                 const void*         scale,
+                                                                 const void*         zero,
+                                                                 int                 groupSize,
+                                                                 hipblasStride       strideScale,
+                                                                 const void*         B,
+                                                                 hipDataType         bType,
+                                                                 int                 ldb,
+                                                                 hipblasStride       strideB,
+                                                                 const float*        beta,
+                                                                 void*               C,
+                                                                 hipDataType         cType,
+                                                                 int                 ldc,
+                                                                 hipblasStride       strideC,
+                                                                 int                 batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  strideA,
+                  scale,
+                  zero,
+                  groupSize,
+                  strideScale,
+                  B,
+                  bType,
+                  ldb,
+                  strideB,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  strideC,
+                  batchCount);
+    return hipblasGemmWeightOnly(handle,
+                                 transA,
+                                 transB,
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 aType,
+                                 lda,
+                                 strideA,
+                                 scale,
+                                 zero,
+                                 groupSize,
+                                 strideScale,
+                                 B,
+                                 bType,
+                                 ldb,
+                                 strideB,
+                                 beta,
+                                 C,
+                                 cType,
+                                 ldc,
+                                 strideC,
+                                 batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
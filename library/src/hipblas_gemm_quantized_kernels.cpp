@@ -0,0 +1,293 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gemm_quantized.hpp"
+#include "convert_device.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <hip/hip_runtime.h>
+
+// Threads of a work group, which requantize consecutive rows of one column
+constexpr int quantize_threads = 256;
+
+// Largest grid in y and z. The work groups loop over the remaining columns and matrices.
+constexpr int quantize_max_grid = 65535;
+
+__device__ inline void hipblasQuantizeStore(float v, int8_t& c)
+{
+    c = int8_t(__float2int_rn(fminf(fmaxf(v, -128.0f), 127.0f)));
+}
+
+template <typename T>
+__device__ inline void hipblasQuantizeStore(float v, T& c)
+{
+    hipblasDeviceFromFloat(v, c);
+}
+
+// Work group (x, y) requantizes rows x * quantize_threads onwards of column y
+template <typename T>
+__global__ void __launch_bounds__(quantize_threads)
+    hipblasQuantizeKernel(hipblasQuantScaleMode_t mode,
+                          int                     m,
+                          int                     n,
+                          const int32_t*          acc,
+                          int                     ld_acc,
+                          hipblasStride           stride_acc,
+                          const float*            scale,
+                          int                     col0,
+                          T*                      C,
+                          int                     ldc,
+                          hipblasStride           stride_C,
+                          int                     batch_count)
+{
+    int i = blockIdx.x * quantize_threads + threadIdx.x;
+    if(i >= m)
+        return;
+
+    float row_scale = mode == HIPBLAS_QUANT_SCALE_ROW ? scale[i] : scale[0];
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        const int32_t* a = acc + b * stride_acc;
+        T*             c = C + b * stride_C;
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+        {
+            float s = mode == HIPBLAS_QUANT_SCALE_COLUMN ? scale[col0 + j] : row_scale;
+            hipblasQuantizeStore(float(a[i + size_t(j) * ld_acc]) * s, c[i + size_t(j) * ldc]);
+        }
+    }
+}
+
+template <typename T>
+static hipblasStatus_t hipblasQuantizeLaunch(hipStream_t             stream,
+                                             hipblasQuantScaleMode_t mode,
+                                             int                     m,
+                                             int                     n,
+                                             const int32_t*          acc,
+                                             int                     ld_acc,
+                                             hipblasStride           stride_acc,
+                                             const float*            scale,
+                                             int                     col0,
+                                             void*                   C,
+                                             int                     ldc,
+                                             hipblasStride           stride_C,
+                                             int                     batch_count)
+{
+    dim3 grid((m + quantize_threads - 1) / quantize_threads,
+              std::min(n, quantize_max_grid),
+              std::min(batch_count, quantize_max_grid));
+
+    hipLaunchKernelGGL(hipblasQuantizeKernel<T>,
+                       grid,
+                       dim3(quantize_threads),
+                       0,
+                       stream,
+                       mode,
+                       m,
+                       n,
+                       acc,
+                       ld_acc,
+                       stride_acc,
+                       scale,
+                       col0,
+                       (T*)C,
+                       ldc,
+                       stride_C,
+                       batch_count);
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasQuantizeKernels(hipStream_t             stream,
+                                       hipDataType             c_type,
+                                       hipblasQuantScaleMode_t mode,
+                                       int                     m,
+                                       int                     n,
+                                       const int32_t*          acc,
+                                       int                     ld_acc,
+                                       hipblasStride           stride_acc,
+                                       const float*            scale,
+                                       int                     col0,
+                                       void*                   C,
+                                       int                     ldc,
+                                       hipblasStride           stride_C,
+                                       int                     batch_count)
+{
+    auto launch = [&](auto element) {
+        return hipblasQuantizeLaunch<decltype(element)>(stream,
+                                                        mode,
+                                                        m,
+                                                        n,
+                                                        acc,
+                                                        ld_acc,
+                                                        stride_acc,
+                                                        scale,
+                                                        col0,
+                                                        C,
+                                                        ldc,
+                                                        stride_C,
+                                                        batch_count);
+    };
+
+    switch(c_type)
+    {
+    case HIP_R_8I:
+        return launch(int8_t());
+    case HIP_R_16F:
+        return launch(__half());
+    case HIP_R_32F:
+        return launch(float());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// Weight e of A as a float
+__device__ inline float hipblasDequantizeLoad(hipblasWeightType_t type, const uint8_t* A, int64_t e)
+{
+    switch(type)
+    {
+    case HIPBLAS_WEIGHT_INT8:
+        return float(int8_t(A[e]));
+    case HIPBLAS_WEIGHT_UINT8:
+        return float(A[e]);
+    default:
+    {
+        // The first weight of a byte is in its low nibble; (q ^ 8) - 8 sign-extends it
+        int q = (A[e >> 1] >> ((e & 1) * 4)) & 15;
+        return float(type == HIPBLAS_WEIGHT_INT4 ? (q ^ 8) - 8 : q);
+    }
+    }
+}
+
+// Work group (x, y) dequantizes elements x * quantize_threads onwards of column y of the panels,
+// in the orientation of A so that both the weights and the panel are read and written along
+// their leading dimension
+template <typename T>
+__global__ void __launch_bounds__(quantize_threads)
+    hipblasDequantizeKernel(hipblasWeightType_t type,
+                            bool                trans_a,
+                            int                 rows,
+                            int                 k,
+                            int                 row0,
+                            const uint8_t*      A,
+                            int64_t             a_offset,
+                            int                 lda,
+                            hipblasStride       stride_a,
+                            const T*            scale,
+                            const T*            zero,
+                            int                 ld_scale,
+                            hipblasStride       stride_scale,
+                            int                 group_size,
+                            T*                  panel,
+                            hipblasStride       stride_panel,
+                            int                 batch_count)
+{
+    int panel_rows = trans_a ? k : rows;
+    int panel_cols = trans_a ? rows : k;
+    int u          = blockIdx.x * quantize_threads + threadIdx.x;
+    if(u >= panel_rows)
+        return;
+
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        int64_t a_b = a_offset + b * stride_a + (trans_a ? int64_t(row0) * lda : row0);
+        for(int v = blockIdx.y; v < panel_cols; v += gridDim.y)
+        {
+            int    i = trans_a ? v : u;
+            int    p = trans_a ? u : v;
+            size_t g = b * stride_scale + (row0 + i) + size_t(p / group_size) * ld_scale;
+            float  q = hipblasDequantizeLoad(type, A, a_b + u + int64_t(v) * lda);
+            float  z = zero ? hipblasDeviceToFloat(zero[g]) : 0.0f;
+            hipblasDeviceFromFloat((q - z) * hipblasDeviceToFloat(scale[g]),
+                                   panel[b * stride_panel + u + size_t(v) * panel_rows]);
+        }
+    }
+}
+
+hipblasStatus_t hipblasDequantizeKernels(hipStream_t         stream,
+                                         hipblasWeightType_t a_type,
+                                         hipDataType         b_type,
+                                         bool                trans_a,
+                                         int                 rows,
+                                         int                 k,
+                                         int                 row0,
+                                         const void*         A,
+                                         int64_t             a_offset,
+                                         int                 lda,
+                                         hipblasStride       stride_a,
+                                         const void*         scale,
+                                         const void*         zero,
+                                         int                 ld_scale,
+                                         hipblasStride       stride_scale,
+                                         int                 group_size,
+                                         void*               panel,
+                                         hipblasStride       stride_panel,
+                                         int                 batch_count)
+{
+    auto launch = [&](auto element) {
+        using T = decltype(element);
+
+        int  panel_rows = trans_a ? k : rows;
+        int  panel_cols = trans_a ? rows : k;
+        dim3 grid((panel_rows + quantize_threads - 1) / quantize_threads,
+                  std::min(panel_cols, quantize_max_grid),
+                  std::min(batch_count, quantize_max_grid));
+
+        hipLaunchKernelGGL(hipblasDequantizeKernel<T>,
+                           grid,
+                           dim3(quantize_threads),
+                           0,
+                           stream,
+                           a_type,
+                           trans_a,
+                           rows,
+                           k,
+                           row0,
+                           (const uint8_t*)A,
+                           a_offset,
+                           lda,
+                           stride_a,
+                           (const T*)scale,
+                           (const T*)zero,
+                           ld_scale,
+                           stride_scale,
+                           group_size,
+                           (T*)panel,
+                           stride_panel,
+                           batch_count);
+
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    };
+
+    switch(b_type)
+    {
+    case HIP_R_16F:
+        return launch(__half());
+    case HIP_R_16BF:
+        return launch(hipblasDeviceBfloat16());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
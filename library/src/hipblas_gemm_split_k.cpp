@@ -0,0 +1,776 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_split_k.hpp"
+#include "batch_scalars.hpp"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "scratch.hpp"
+#include "shared_handle.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <unordered_map>
+
+// Most slices of k, and the thinnest slice the automatic mode makes
+static constexpr int split_k_max_factor = 64;
+static constexpr int split_k_min_depth  = 1024;
+
+// The automatic mode splits when C has fewer tiles of split_k_tile by split_k_tile elements than
+// the device has compute units, and k is at least split_k_min_ratio times m and n
+static constexpr int split_k_tile      = 128;
+static constexpr int split_k_min_ratio = 8;
+
+// Largest scratch of the partial matrices, in bytes. Fewer slices are made past it.
+static constexpr size_t split_k_max_bytes = size_t(256) << 20;
+
+// Slices are multiples of split_k_align deep, except the last one
+static constexpr int split_k_align = 16;
+
+// Largest n of a split syrk, herk or syrkx, whose identity matrix is copied from the ones
+static constexpr int split_k_max_ones = 256;
+
+struct hipblasGemmSplitKSetting
+{
+    hipblasGemmSplitKMode_t mode   = HIPBLAS_GEMM_SPLIT_K_AUTO;
+    int                     factor = 0;
+};
+
+static std::mutex                                                    split_k_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasGemmSplitKSetting> split_k_settings;
+
+// Setting of the handles that set none, which a tuning profile may change
+static hipblasGemmSplitKSetting split_k_default;
+
+// Ones of each partial type, copied to the device as the vector summing the partials, and as the
+// diagonal of the identity of a split syrk
+struct hipblasGemmSplitKOnes
+{
+    float  s[split_k_max_ones];
+    double d[split_k_max_ones];
+    float  c[2 * split_k_max_ones];
+    double z[2 * split_k_max_ones];
+
+    hipblasGemmSplitKOnes()
+    {
+        for(int i = 0; i < split_k_max_ones; i++)
+        {
+            s[i]         = 1;
+            d[i]         = 1;
+            c[2 * i]     = 1;
+            c[2 * i + 1] = 0;
+            z[2 * i]     = 1;
+            z[2 * i + 1] = 0;
+        }
+    }
+
+    const void* get(hipDataType type) const
+    {
+        return type == HIP_R_32F   ? (const void*)s
+               : type == HIP_R_64F ? (const void*)d
+               : type == HIP_C_32F ? (const void*)c
+                                   : (const void*)z;
+    }
+};
+
+static const hipblasGemmSplitKOnes split_k_ones;
+
+void hipblasGemmSplitKErase(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(split_k_mutex);
+    split_k_settings.erase(handle);
+}
+
+void hipblasGemmSplitKGetDefault(hipblasGemmSplitKMode_t& mode, int& factor)
+{
+    std::lock_guard<std::mutex> lock(split_k_mutex);
+    mode   = split_k_default.mode;
+    factor = split_k_default.factor;
+}
+
+bool hipblasGemmSplitKSetDefault(hipblasGemmSplitKMode_t mode, int factor)
+{
+    if(mode != HIPBLAS_GEMM_SPLIT_K_AUTO && mode != HIPBLAS_GEMM_SPLIT_K_OFF
+       && mode != HIPBLAS_GEMM_SPLIT_K_ON)
+        return false;
+    if(mode == HIPBLAS_GEMM_SPLIT_K_ON && (factor < 2 || factor > split_k_max_factor))
+        return false;
+
+    std::lock_guard<std::mutex> lock(split_k_mutex);
+    split_k_default = {mode, mode == HIPBLAS_GEMM_SPLIT_K_ON ? factor : 0};
+    return true;
+}
+
+// Type of the partial matrices, which is that of alpha and beta. Returns false for compute types
+// whose partials could not be summed without losing precision, and for C types the partials
+// cannot be summed into.
+static bool hipblasGemmSplitKType(hipblasComputeType_t compute_type,
+                                  hipDataType          c_type,
+                                  hipDataType&         partial_type)
+{
+    bool complex = c_type == HIP_C_32F || c_type == HIP_C_64F;
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_32F:
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+    case HIPBLAS_COMPUTE_32F_FAST_16BFX3:
+        partial_type = complex ? HIP_C_32F : HIP_R_32F;
+        break;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        partial_type = complex ? HIP_C_64F : HIP_R_64F;
+        break;
+    default:
+        return false;
+    }
+#ifdef HIPBLAS_BATCH_SCALARS
+    if(partial_type == HIP_R_32F && (c_type == HIP_R_16F || c_type == HIP_R_16BF))
+        return true;
+#endif
+    return c_type == partial_type;
+}
+
+// Number of slices of k, 1 when the gemm is not split
+static int hipblasGemmSplitKFactor(const hipblasGemmSplitKSetting& setting, int m, int n, int k)
+{
+    if(setting.mode == HIPBLAS_GEMM_SPLIT_K_OFF)
+        return 1;
+    if(setting.mode == HIPBLAS_GEMM_SPLIT_K_ON)
+        return std::min(setting.factor, k);
+
+    if(k < 2 * split_k_min_depth || k / split_k_min_ratio < std::max(m, n))
+        return 1;
+    int device, compute_units;
+    if(hipGetDevice(&device) != hipSuccess
+       || hipDeviceGetAttribute(&compute_units, hipDeviceAttributeMultiprocessorCount, device)
+              != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return 1;
+    }
+    int64_t tiles = int64_t((m + split_k_tile - 1) / split_k_tile)
+                    * ((n + split_k_tile - 1) / split_k_tile);
+    if(tiles >= compute_units)
+        return 1;
+    return std::min({int(compute_units / tiles), k / split_k_min_depth, split_k_max_factor});
+}
+
+bool hipblasGemmSplitK(hipblasHandle_t      handle,
+                       hipblasOperation_t   transa,
+                       hipblasOperation_t   transb,
+                       int                  m,
+                       int                  n,
+                       int                  k,
+                       const void*          alpha,
+                       const void*          A,
+                       hipDataType          a_type,
+                       int                  lda,
+                       const void*          B,
+                       hipDataType          b_type,
+                       int                  ldb,
+                       const void*          beta,
+                       void*                C,
+                       hipDataType          c_type,
+                       int                  ldc,
+                       hipblasComputeType_t compute_type,
+                       hipblasStatus_t&     status)
+{
+    // Invalid arguments are left to the backend
+    bool a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+    if(!handle || m <= 0 || n <= 0 || k < 2 || !alpha || !beta || !A || !B || !C
+       || lda < std::max(1, a_n ? m : k) || ldb < std::max(1, b_n ? k : n) || ldc < m)
+        return false;
+
+    hipblasGemmSplitKSetting setting;
+    {
+        std::lock_guard<std::mutex> lock(split_k_mutex);
+        auto                        it = split_k_settings.find(handle);
+        if(it != split_k_settings.end())
+            setting = it->second;
+        else
+            setting = split_k_default;
+    }
+
+    hipDataType partial_type;
+    size_t      a_size = hipblasDatatypeSize(a_type);
+    size_t      b_size = hipblasDatatypeSize(b_type);
+    if(!a_size || !b_size || !hipblasGemmSplitKType(compute_type, c_type, partial_type))
+        return false;
+    size_t p_size = hipblasDatatypeSize(partial_type);
+    size_t matrix = size_t(m) * n;
+
+    int factor = hipblasGemmSplitKFactor(setting, m, n, k);
+    factor     = int(std::min(size_t(factor), split_k_max_bytes / (p_size * matrix)));
+    if(factor < 2)
+        return false;
+
+    hipStream_t            stream;
+    hipblasPointerMode_t   mode;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return false;
+
+    // With alpha == 0, A and B are not read
+    static const double host_zero[2] = {0, 0};
+    if(mode == HIPBLAS_POINTER_MODE_HOST && !std::memcmp(alpha, host_zero, p_size))
+        return false;
+
+    // full slices of depth slice, then one of depth rest
+    int slice = (k + factor - 1) / factor;
+    slice     = std::min(k, (slice + split_k_align - 1) / split_k_align * split_k_align);
+    int full  = k / slice;
+    int rest  = k - full * slice;
+    int parts = full + (rest > 0);
+    if(parts < 2)
+        return false;
+
+    // The device scalars and ones, the sum of the partials when it is applied by a kernel, then
+    // the partials, each part 256-byte aligned
+    bool   fused      = c_type != partial_type;
+    size_t ones_bytes = (p_size * parts + 255) / 256 * 256;
+    size_t sum_bytes  = fused ? (p_size * matrix + 255) / 256 * 256 : 0;
+    size_t bytes      = 256 + ones_bytes + sum_bytes + p_size * matrix * parts;
+
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    if(hipMallocAsync((void**)&scratch.base, bytes, stream) != hipSuccess)
+    {
+        scratch.base = nullptr;
+        (void)hipGetLastError();
+        return false;
+    }
+    char* scalars = scratch.base;
+    char* ones    = scalars + 256;
+    char* sum     = ones + ones_bytes;
+    char* W       = sum + sum_bytes;
+
+    // From here on the call is split and its status is returned
+    status = HIPBLAS_STATUS_SUCCESS;
+    if(hipMemcpyAsync(
+           ones, split_k_ones.get(partial_type), p_size * parts, hipMemcpyHostToDevice, stream)
+       != hipSuccess)
+    {
+        (void)hipGetLastError();
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        return true;
+    }
+
+    // W_p := op( A ) * op( B ) over slice p of k
+    const float   one_f[2] = {1, 0}, zero_f[2] = {0, 0};
+    const double  one_d[2] = {1, 0}, zero_d[2] = {0, 0};
+    bool          single   = partial_type == HIP_R_32F || partial_type == HIP_C_32F;
+    const void*   one      = single ? (const void*)one_f : (const void*)one_d;
+    const void*   zero     = single ? (const void*)zero_f : (const void*)zero_d;
+    hipblasStride stride_A = a_n ? hipblasStride(slice) * lda : slice;
+    hipblasStride stride_B = b_n ? slice : hipblasStride(slice) * ldb;
+
+    auto partials = [&](int p0, int count, int depth) {
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              transa,
+                                              transb,
+                                              m,
+                                              n,
+                                              depth,
+                                              one,
+                                              static_cast<const char*>(A) + a_size * stride_A * p0,
+                                              a_type,
+                                              lda,
+                                              stride_A,
+                                              static_cast<const char*>(B) + b_size * stride_B * p0,
+                                              b_type,
+                                              ldb,
+                                              stride_B,
+                                              zero,
+                                              W + p_size * matrix * p0,
+                                              partial_type,
+                                              m,
+                                              hipblasStride(matrix),
+                                              count,
+                                              compute_type,
+                                              HIPBLAS_GEMM_DEFAULT);
+    };
+
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = partials(0, full, slice);
+    if(status == HIPBLAS_STATUS_SUCCESS && rest)
+        status = partials(full, 1, rest);
+
+    // sum := [W_0 ... W_parts-1] * ones, the partials as columns of m * n elements
+    if(status == HIPBLAS_STATUS_SUCCESS && fused)
+        status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                HIPBLAS_OP_N,
+                                                HIPBLAS_OP_N,
+                                                int(matrix),
+                                                1,
+                                                parts,
+                                                one,
+                                                W,
+                                                partial_type,
+                                                int(matrix),
+                                                0,
+                                                ones,
+                                                partial_type,
+                                                parts,
+                                                0,
+                                                zero,
+                                                sum,
+                                                partial_type,
+                                                int(matrix),
+                                                0,
+                                                1,
+                                                compute_type,
+                                                HIPBLAS_GEMM_DEFAULT);
+
+    hipblasStatus_t restore = hipblasSetPointerMode(handle, mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = restore;
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    if(!fused)
+    {
+        // C(:, j) := alpha * [W_0(:, j) ... W_parts-1(:, j)] * ones + beta * C(:, j), as a batch
+        // over the columns j of C
+        status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                HIPBLAS_OP_N,
+                                                HIPBLAS_OP_N,
+                                                m,
+                                                1,
+                                                parts,
+                                                alpha,
+                                                W,
+                                                partial_type,
+                                                int(matrix),
+                                                m,
+                                                ones,
+                                                partial_type,
+                                                parts,
+                                                0,
+                                                beta,
+                                                C,
+                                                c_type,
+                                                ldc,
+                                                ldc,
+                                                n,
+                                                compute_type,
+                                                HIPBLAS_GEMM_DEFAULT);
+        return true;
+    }
+
+#ifdef HIPBLAS_BATCH_SCALARS
+    // C := alpha * sum + beta * C in fp16 or bf16, with alpha and beta read from the device
+    if(mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        const float host_scalars[2] = {*(const float*)alpha, *(const float*)beta};
+        if(hipMemcpyAsync(
+               scalars, host_scalars, sizeof(host_scalars), hipMemcpyHostToDevice, stream)
+           != hipSuccess)
+        {
+            (void)hipGetLastError();
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+            return true;
+        }
+        alpha = scalars;
+        beta  = scalars + sizeof(float);
+    }
+    status = hipblasBatchScalarsAxpby(
+        stream, m, n, alpha, beta, partial_type, 0, sum, C, nullptr, c_type, ldc, 0, 1);
+#endif
+    return true;
+}
+
+// Set while a split syrk runs its own calls, which are not split again
+static thread_local bool split_k_syrk_active = false;
+
+bool hipblasSyrkSplitK(hipblasHandle_t    handle,
+                       hipblasFillMode_t  uplo,
+                       hipblasOperation_t trans,
+                       int                n,
+                       int                k,
+                       const void*        alpha,
+                       const void*        A,
+                       int                lda,
+                       const void*        B,
+                       int                ldb,
+                       const void*        beta,
+                       void*              C,
+                       int                ldc,
+                       hipDataType        type,
+                       bool               hermitian,
+                       hipblasStatus_t&   status)
+{
+    // Invalid arguments are left to the backend, as are a complex syrk with a conjugate
+    // transpose and a herk with a transpose
+    bool complex = type == HIP_C_32F || type == HIP_C_64F;
+    bool a_n     = trans == HIPBLAS_OP_N;
+    if(!B)
+        B = A, ldb = lda;
+    if(split_k_syrk_active || !handle || n <= 0 || n > split_k_max_ones || k < 2 || !alpha
+       || !beta || !A || !C || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+       || (!a_n && trans != (hermitian ? HIPBLAS_OP_C : HIPBLAS_OP_T)
+           && (complex || trans != HIPBLAS_OP_C))
+       || lda < std::max(1, a_n ? n : k) || ldb < std::max(1, a_n ? n : k) || ldc < n)
+        return false;
+
+    hipblasGemmSplitKSetting setting;
+    {
+        std::lock_guard<std::mutex> lock(split_k_mutex);
+        auto                        it = split_k_settings.find(handle);
+        if(it != split_k_settings.end())
+            setting = it->second;
+        else
+            setting = split_k_default;
+    }
+
+    size_t p_size = hipblasDatatypeSize(type);
+    size_t matrix = size_t(n) * n;
+    size_t bound  = (split_k_max_bytes - 2 * p_size * matrix) / (p_size * matrix);
+    int    factor = hipblasGemmSplitKFactor(setting, n, n, k);
+    factor        = int(std::min(size_t(factor), bound));
+    if(factor < 2)
+        return false;
+
+    hipStream_t            stream;
+    hipblasPointerMode_t   mode;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return false;
+
+    // With alpha == 0, A is not read
+    static const double host_zero[2] = {0, 0};
+    size_t alpha_size = hermitian ? p_size / 2 : p_size;
+    if(mode == HIPBLAS_POINTER_MODE_HOST && !std::memcmp(alpha, host_zero, alpha_size))
+        return false;
+
+    // full slices of depth slice, then one of depth rest
+    int slice = (k + factor - 1) / factor;
+    slice     = std::min(k, (slice + split_k_align - 1) / split_k_align * split_k_align);
+    int full  = k / slice;
+    int rest  = k - full * slice;
+    int parts = full + (rest > 0);
+    if(parts < 2)
+        return false;
+
+    // The device alpha of herkx and the ones, the identity, the sum of the partials, then the
+    // partials, each part 256-byte aligned
+    size_t ones_bytes   = (p_size * parts + 255) / 256 * 256;
+    size_t matrix_bytes = (p_size * matrix + 255) / 256 * 256;
+    size_t bytes        = 256 + ones_bytes + 2 * matrix_bytes + p_size * matrix * parts;
+
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    if(hipMallocAsync((void**)&scratch.base, bytes, stream) != hipSuccess)
+    {
+        scratch.base = nullptr;
+        (void)hipGetLastError();
+        return false;
+    }
+    char* scalars  = scratch.base;
+    char* ones     = scalars + 256;
+    char* identity = ones + ones_bytes;
+    char* sum      = identity + matrix_bytes;
+    char* W        = sum + matrix_bytes;
+
+    // From here on the call is split and its status is returned
+    split_k_syrk_active = true;
+    struct active_reset
+    {
+        ~active_reset()
+        {
+            split_k_syrk_active = false;
+        }
+    } active_reset;
+
+    // ones, and the identity of order n as zeros with ones copied to its diagonal
+    const void* host_ones = split_k_ones.get(type);
+    status                = HIPBLAS_STATUS_SUCCESS;
+    if(hipMemcpyAsync(ones, host_ones, p_size * parts, hipMemcpyHostToDevice, stream) != hipSuccess
+       || hipMemsetAsync(identity, 0, p_size * matrix, stream) != hipSuccess
+       || hipMemcpy2DAsync(identity,
+                           p_size * (n + 1),
+                           host_ones,
+                           p_size,
+                           p_size,
+                           n,
+                           hipMemcpyHostToDevice,
+                           stream)
+              != hipSuccess)
+    {
+        (void)hipGetLastError();
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        return true;
+    }
+
+    // W_p := op( A ) * op( B )**T or **H over slice p of k, the whole n by n matrix
+    const float          one_f[2] = {1, 0}, zero_f[2] = {0, 0};
+    const double         one_d[2] = {1, 0}, zero_d[2] = {0, 0};
+    bool                 single   = type == HIP_R_32F || type == HIP_C_32F;
+    const void*          one      = single ? (const void*)one_f : (const void*)one_d;
+    const void*          zero     = single ? (const void*)zero_f : (const void*)zero_d;
+    hipblasComputeType_t compute  = single ? HIPBLAS_COMPUTE_32F : HIPBLAS_COMPUTE_64F;
+    hipblasOperation_t   op_t     = hermitian ? HIPBLAS_OP_C : HIPBLAS_OP_T;
+    hipblasStride        stride_A = a_n ? hipblasStride(slice) * lda : slice;
+    hipblasStride        stride_B = a_n ? hipblasStride(slice) * ldb : slice;
+
+    auto partials = [&](int p0, int count, int depth) {
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              a_n ? HIPBLAS_OP_N : op_t,
+                                              a_n ? op_t : HIPBLAS_OP_N,
+                                              n,
+                                              n,
+                                              depth,
+                                              one,
+                                              static_cast<const char*>(A) + p_size * stride_A * p0,
+                                              type,
+                                              lda,
+                                              stride_A,
+                                              static_cast<const char*>(B) + p_size * stride_B * p0,
+                                              type,
+                                              ldb,
+                                              stride_B,
+                                              zero,
+                                              W + p_size * matrix * p0,
+                                              type,
+                                              n,
+                                              hipblasStride(matrix),
+                                              count,
+                                              compute,
+                                              HIPBLAS_GEMM_DEFAULT);
+    };
+
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = partials(0, full, slice);
+    if(status == HIPBLAS_STATUS_SUCCESS && rest)
+        status = partials(full, 1, rest);
+
+    // sum := [W_0 ... W_parts-1] * ones, the partials as columns of n * n elements
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                HIPBLAS_OP_N,
+                                                HIPBLAS_OP_N,
+                                                int(matrix),
+                                                1,
+                                                parts,
+                                                one,
+                                                W,
+                                                type,
+                                                int(matrix),
+                                                0,
+                                                ones,
+                                                type,
+                                                parts,
+                                                0,
+                                                zero,
+                                                sum,
+                                                type,
+                                                int(matrix),
+                                                0,
+                                                1,
+                                                compute,
+                                                HIPBLAS_GEMM_DEFAULT);
+
+    hipblasStatus_t restore = hipblasSetPointerMode(handle, mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = restore;
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    // The triangle of C := alpha * sum * I + beta * C. herkx takes a complex alpha, made of the
+    // real alpha of herk on the host or in the scratch on the device.
+    float       alpha_c[2] = {0, 0};
+    double      alpha_z[2] = {0, 0};
+    const void* alpha_x    = alpha;
+    if(hermitian && mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        if(single)
+            alpha_c[0] = *(const float*)alpha;
+        else
+            alpha_z[0] = *(const double*)alpha;
+        alpha_x = single ? (const void*)alpha_c : (const void*)alpha_z;
+    }
+    else if(hermitian)
+    {
+        if(hipMemsetAsync(scalars, 0, p_size, stream) != hipSuccess
+           || hipMemcpyAsync(scalars, alpha, p_size / 2, hipMemcpyDeviceToDevice, stream)
+                  != hipSuccess)
+        {
+            (void)hipGetLastError();
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+            return true;
+        }
+        alpha_x = scalars;
+    }
+
+    switch(type)
+    {
+    case HIP_R_32F:
+        status = hipblasSsyrkx(handle,
+                               uplo,
+                               HIPBLAS_OP_N,
+                               n,
+                               n,
+                               (const float*)alpha_x,
+                               (const float*)sum,
+                               n,
+                               (const float*)identity,
+                               n,
+                               (const float*)beta,
+                               (float*)C,
+                               ldc);
+        break;
+    case HIP_R_64F:
+        status = hipblasDsyrkx(handle,
+                               uplo,
+                               HIPBLAS_OP_N,
+                               n,
+                               n,
+                               (const double*)alpha_x,
+                               (const double*)sum,
+                               n,
+                               (const double*)identity,
+                               n,
+                               (const double*)beta,
+                               (double*)C,
+                               ldc);
+        break;
+    case HIP_C_32F:
+        status = hermitian ? hipblasCherkx(handle,
+                                           uplo,
+                                           HIPBLAS_OP_N,
+                                           n,
+                                           n,
+                                           (const hipblasComplex*)alpha_x,
+                                           (const hipblasComplex*)sum,
+                                           n,
+                                           (const hipblasComplex*)identity,
+                                           n,
+                                           (const float*)beta,
+                                           (hipblasComplex*)C,
+                                           ldc)
+                           : hipblasCsyrkx(handle,
+                                           uplo,
+                                           HIPBLAS_OP_N,
+                                           n,
+                                           n,
+                                           (const hipblasComplex*)alpha_x,
+                                           (const hipblasComplex*)sum,
+                                           n,
+                                           (const hipblasComplex*)identity,
+                                           n,
+                                           (const hipblasComplex*)beta,
+                                           (hipblasComplex*)C,
+                                           ldc);
+        break;
+    default:
+        status = hermitian ? hipblasZherkx(handle,
+                                           uplo,
+                                           HIPBLAS_OP_N,
+                                           n,
+                                           n,
+                                           (const hipblasDoubleComplex*)alpha_x,
+                                           (const hipblasDoubleComplex*)sum,
+                                           n,
+                                           (const hipblasDoubleComplex*)identity,
+                                           n,
+                                           (const double*)beta,
+                                           (hipblasDoubleComplex*)C,
+                                           ldc)
+                           : hipblasZsyrkx(handle,
+                                           uplo,
+                                           HIPBLAS_OP_N,
+                                           n,
+                                           n,
+                                           (const hipblasDoubleComplex*)alpha_x,
+                                           (const hipblasDoubleComplex*)sum,
+                                           n,
+                                           (const hipblasDoubleComplex*)identity,
+                                           n,
+                                           (const hipblasDoubleComplex*)beta,
+                                           (hipblasDoubleComplex*)C,
+                                           ldc);
+        break;
+    }
+    return true;
+}
+
+extern "C" hipblasStatus_t
+    hipblasSetGemmSplitK(hipblasHandle_t handle, hipblasGemmSplitKMode_t mode, int splitFactor)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode, splitFactor);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_GEMM_SPLIT_K_AUTO && mode != HIPBLAS_GEMM_SPLIT_K_OFF
+       && mode != HIPBLAS_GEMM_SPLIT_K_ON)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(mode == HIPBLAS_GEMM_SPLIT_K_ON && (splitFactor < 2 || splitFactor > split_k_max_factor))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(split_k_mutex);
+    split_k_settings[handle] = {mode, mode == HIPBLAS_GEMM_SPLIT_K_ON ? splitFactor : 0};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasGetGemmSplitK(hipblasHandle_t handle, hipblasGemmSplitKMode_t* mode, int* splitFactor)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode, splitFactor);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode || !splitFactor)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(split_k_mutex);
+    auto                        it      = split_k_settings.find(handle);
+    hipblasGemmSplitKSetting    setting = split_k_default;
+    if(it != split_k_settings.end())
+        setting = it->second;
+    *mode        = setting.mode;
+    *splitFactor = setting.factor;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,612 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_tuning.hpp"
+#include "exceptions.hpp"
+#include "gemm_split_k.hpp"
+#include "host_dispatch.hpp"
+#include "layer.hpp"
+#include "reproducible.hpp"
+#include "shared_handle.hpp"
+#include "small_level1.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+// Bumped whenever the layout of the tuning file changes
+static constexpr int gemm_tuning_file_version = 2;
+
+// Bumped whenever the layout of the tuning profile changes
+static constexpr int tuning_profile_version = 1;
+
+// Timed calls per candidate, after one warm-up call
+static constexpr int gemm_tuning_iters = 5;
+
+static std::mutex              gemm_tuning_mutex;
+static std::once_flag          gemm_tuning_init_flag;
+static std::string             gemm_tuning_backend_version;
+static std::string             gemm_tuning_file;
+static hipblasGemmTuningMode_t gemm_tuning_default_mode = HIPBLAS_GEMM_TUNING_OFF;
+static bool                    gemm_tuning_dirty        = false;
+
+static std::unordered_map<hipblasHandle_t, hipblasGemmTuningMode_t> gemm_tuning_modes;
+static std::unordered_map<std::string, int>                         gemm_tuned_solutions;
+static std::unordered_map<std::string, double>                      gemm_tuned_times;
+static std::unordered_map<int, std::string>                         gemm_tuning_archs;
+
+// Longest vector of the small Level-1 kernels, which a tuning profile may lower
+static std::atomic<int> small_level1_size{small_level1_max_size};
+
+// Add the entry of a line of the tuning file, the problem key followed by the solution index and
+// its time in seconds, keeping an entry already present. Requires gemm_tuning_mutex.
+static void hipblasGemmTuningAdd(const std::string& line)
+{
+    size_t time_split = line.rfind(' ');
+    if(time_split == std::string::npos || !time_split)
+        return;
+    size_t split = line.rfind(' ', time_split - 1);
+    if(split == std::string::npos)
+        return;
+
+    std::string key = line.substr(0, split);
+    if(gemm_tuned_solutions.emplace(key, std::atoi(&line[split + 1])).second)
+        gemm_tuned_times[key] = std::atof(&line[time_split + 1]);
+}
+
+// Add the entries of the file at path to the table, keeping entries already present. Returns
+// false if the file cannot be read or was written by another format or backend version.
+// Requires gemm_tuning_mutex.
+static bool hipblasGemmTuningRead(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string   magic, backend_version, line;
+    int           format = 0;
+
+    if(!(file >> magic >> format) || magic != "hipblas_gemm_tuning"
+       || format != gemm_tuning_file_version)
+        return false;
+
+    file >> std::ws;
+    if(!std::getline(file, backend_version) || backend_version != gemm_tuning_backend_version)
+        return false;
+
+    while(std::getline(file, line))
+        hipblasGemmTuningAdd(line);
+    return true;
+}
+
+// Move the file written at tmp_path to path
+static bool hipblasGemmTuningReplace(const std::string& tmp_path, const std::string& path)
+{
+    if(std::rename(tmp_path.c_str(), path.c_str()))
+    {
+        // rename() does not replace an existing file on Windows
+        std::remove(path.c_str());
+        if(std::rename(tmp_path.c_str(), path.c_str()))
+            return false;
+    }
+    return true;
+}
+
+// Write the whole table to path. Requires gemm_tuning_mutex.
+static bool hipblasGemmTuningWrite(const std::string& path)
+{
+    // Written next to the destination and renamed, so readers never see a partial file
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path);
+        file << "hipblas_gemm_tuning " << gemm_tuning_file_version << '\n'
+             << gemm_tuning_backend_version << '\n';
+        for(const auto& solution : gemm_tuned_solutions)
+        {
+            auto time = gemm_tuned_times.find(solution.first);
+            file << solution.first << ' ' << solution.second << ' '
+                 << (time == gemm_tuned_times.end() ? 0.0 : time->second) << '\n';
+        }
+        if(!file)
+            return false;
+    }
+
+    return hipblasGemmTuningReplace(tmp_path, path);
+}
+
+// Apply the section of arch of the tuning profile at path. Tuned entries are only added from the
+// section of the backend version too, as solution indices are specific to one build, and entries
+// already in the table are kept. Sections of other architectures and lines of unknown kinds are
+// skipped. Returns false if the file cannot be read or is not a profile. Requires
+// gemm_tuning_mutex.
+static bool hipblasTuningProfileRead(const std::string& path, const std::string& arch)
+{
+    std::ifstream file(path);
+    std::string   magic, line;
+    int           format = 0;
+
+    if(!(file >> magic >> format) || magic != "hipblas_tuning_profile"
+       || format != tuning_profile_version)
+        return false;
+    std::getline(file, line);
+
+    bool section_arch = false, section_backend = false;
+    while(std::getline(file, line))
+    {
+        std::istringstream fields(line);
+        std::string        kind;
+        if(!(fields >> kind))
+            continue;
+
+        if(kind == "arch")
+        {
+            std::string name, backend_version;
+            fields >> name >> std::ws;
+            std::getline(fields, backend_version);
+            section_arch    = name == arch;
+            section_backend = section_arch && backend_version == gemm_tuning_backend_version;
+        }
+        else if(!section_arch)
+            continue;
+        else if(kind == "tuned")
+        {
+            if(section_backend)
+                hipblasGemmTuningAdd(line.substr(kind.size() + 1));
+        }
+        else if(kind == "split_k")
+        {
+            int mode, factor;
+            if(fields >> mode >> factor)
+                hipblasGemmSplitKSetDefault(hipblasGemmSplitKMode_t(mode), factor);
+        }
+        else if(kind == "host_dispatch")
+        {
+            int     routine;
+            int64_t threshold;
+            if(fields >> routine >> threshold && routine >= HIPBLAS_HOST_DISPATCH_DOT
+               && routine <= HIPBLAS_HOST_DISPATCH_GEMM)
+                hipblasHostDispatchSetDefault(hipblasHostDispatchRoutine_t(routine), threshold);
+        }
+        else if(kind == "small_level1")
+        {
+            int size;
+            if(fields >> size && size >= 0)
+                small_level1_size = std::min(size, small_level1_max_size);
+        }
+    }
+    return true;
+}
+
+// Write the section of arch and the backend version to the tuning profile at path, keeping the
+// sections of other architectures and backend versions already in it. Returns false if path
+// cannot be written or holds something other than a profile. Requires gemm_tuning_mutex.
+static bool hipblasTuningProfileWrite(const std::string& path, const std::string& arch)
+{
+    std::string        header = "arch " + arch + ' ' + gemm_tuning_backend_version;
+    std::ostringstream kept;
+    {
+        std::ifstream file(path);
+        std::string   magic, line;
+        int           format = 0;
+        if(file >> magic >> format)
+        {
+            if(magic != "hipblas_tuning_profile" || format != tuning_profile_version)
+                return false;
+            std::getline(file, line);
+
+            bool keep = true;
+            while(std::getline(file, line))
+            {
+                if(!line.compare(0, 5, "arch "))
+                    keep = line != header;
+                if(keep)
+                    kept << line << '\n';
+            }
+        }
+    }
+
+    hipblasGemmSplitKMode_t split_k_mode;
+    int                     split_k_factor;
+    hipblasGemmSplitKGetDefault(split_k_mode, split_k_factor);
+
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path);
+        file << "hipblas_tuning_profile " << tuning_profile_version << '\n'
+             << kept.str() << header << '\n';
+
+        // The keys of the table start with the architecture they were tuned on
+        std::string prefix = arch + ' ';
+        for(const auto& solution : gemm_tuned_solutions)
+        {
+            if(solution.first.compare(0, prefix.size(), prefix))
+                continue;
+            auto time = gemm_tuned_times.find(solution.first);
+            file << "tuned " << solution.first << ' ' << solution.second << ' '
+                 << (time == gemm_tuned_times.end() ? 0.0 : time->second) << '\n';
+        }
+
+        file << "split_k " << int(split_k_mode) << ' ' << split_k_factor << '\n';
+        for(int routine = HIPBLAS_HOST_DISPATCH_DOT; routine <= HIPBLAS_HOST_DISPATCH_GEMM;
+            routine++)
+            file << "host_dispatch " << routine << ' '
+                 << hipblasHostDispatchGetDefault(hipblasHostDispatchRoutine_t(routine)) << '\n';
+        file << "small_level1 " << small_level1_size << '\n';
+        if(!file)
+            return false;
+    }
+    return hipblasGemmTuningReplace(tmp_path, path);
+}
+
+void hipblasGemmTuningInit(const std::string& backend_version)
+{
+    std::call_once(gemm_tuning_init_flag, [&]() {
+        // The profile section is that of the device current when the first handle is created
+        const char* profile = std::getenv("HIPBLAS_TUNING_PROFILE");
+        std::string arch    = profile && *profile ? hipblasGemmTuningArch() : "";
+
+        std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+        gemm_tuning_backend_version = backend_version;
+
+        const char* mode = std::getenv("HIPBLAS_GEMM_TUNING");
+        if(mode && std::atoi(mode))
+            gemm_tuning_default_mode = HIPBLAS_GEMM_TUNING_ON;
+
+        const char* file = std::getenv("HIPBLAS_GEMM_TUNING_FILE");
+        if(file && *file)
+        {
+            gemm_tuning_file = file;
+            hipblasGemmTuningRead(gemm_tuning_file);
+        }
+
+        // Solutions tuned on this node come first
+        if(!arch.empty())
+            hipblasTuningProfileRead(profile, arch);
+    });
+}
+
+int hipblasSmallLevel1Size()
+{
+    return small_level1_size.load(std::memory_order_relaxed);
+}
+
+void hipblasGemmTuningErase(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+    gemm_tuning_modes.erase(handle);
+
+    if(gemm_tuning_dirty && !gemm_tuning_file.empty())
+    {
+        // Keep solutions other processes saved since the file was loaded
+        hipblasGemmTuningRead(gemm_tuning_file);
+        gemm_tuning_dirty = !hipblasGemmTuningWrite(gemm_tuning_file);
+    }
+}
+
+bool hipblasGemmTuningEnabled(hipblasHandle_t handle)
+{
+    // The solution picked by timing may change from run to run
+    if(hipblasReductionReproducible(handle))
+        return false;
+
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+
+    auto mode = gemm_tuning_modes.find(handle);
+    return (mode == gemm_tuning_modes.end() ? gemm_tuning_default_mode : mode->second)
+           == HIPBLAS_GEMM_TUNING_ON;
+}
+
+// Architecture name of the current device, queried once per device
+std::string hipblasGemmTuningArch()
+{
+    int device = 0;
+    if(hipGetDevice(&device) != hipSuccess)
+        return "unknown";
+
+    {
+        std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+
+        auto arch = gemm_tuning_archs.find(device);
+        if(arch != gemm_tuning_archs.end())
+            return arch->second;
+    }
+
+    hipDeviceProp_t prop;
+    std::string     arch = "unknown";
+    if(hipGetDeviceProperties(&prop, device) == hipSuccess)
+    {
+        // gcnArchName is empty on NVIDIA devices, which are named by compute capability
+        arch = prop.gcnArchName;
+        if(arch.empty())
+            arch = "sm_" + std::to_string(prop.major) + std::to_string(prop.minor);
+    }
+
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+    gemm_tuning_archs[device] = arch;
+    return arch;
+}
+
+std::string hipblasGemmTuningKey(hipblasOperation_t   transA,
+                                 hipblasOperation_t   transB,
+                                 int                  m,
+                                 int                  n,
+                                 int                  k,
+                                 hipDataType          a_type,
+                                 hipDataType          b_type,
+                                 hipDataType          c_type,
+                                 hipblasComputeType_t compute_type)
+{
+    std::ostringstream key;
+    key << hipblasGemmTuningArch() << ' ' << int(transA) << ' ' << int(transB) << ' ' << m << ' '
+        << n << ' ' << k << ' ' << int(a_type) << ' ' << int(b_type) << ' ' << int(c_type) << ' '
+        << int(compute_type);
+    return key.str();
+}
+
+// Smallest power of two of at least n
+static int hipblasLevel2TuningBucket(int n)
+{
+    int bucket = 1;
+    while(bucket < n && bucket < (1 << 30))
+        bucket *= 2;
+    return bucket;
+}
+
+std::string hipblasLevel2TuningKey(const char* routine, hipblasOperation_t trans, int m, int n)
+{
+    std::ostringstream key;
+    key << hipblasGemmTuningArch() << ' ' << routine << ' ' << int(trans) << ' '
+        << hipblasLevel2TuningBucket(m) << ' ' << hipblasLevel2TuningBucket(n);
+    return key.str();
+}
+
+int hipblasGemmTuningSolution(const std::string&                                key,
+                              hipStream_t                                       stream,
+                              void*                                             C,
+                              size_t                                            C_size,
+                              const std::function<std::vector<int>()>&          candidates,
+                              const std::function<hipblasStatus_t(int, void*)>& run)
+{
+    {
+        std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+
+        auto solution = gemm_tuned_solutions.find(key);
+        if(solution != gemm_tuned_solutions.end())
+            return solution->second;
+    }
+
+    // Events and allocations are not allowed while the stream is captured
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(!C_size || hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return 0;
+
+    void*      C_scratch = nullptr;
+    hipEvent_t start = nullptr, stop = nullptr;
+    if(hipMalloc(&C_scratch, C_size) != hipSuccess)
+        return 0;
+
+    bool tuned = hipEventCreate(&start) == hipSuccess && hipEventCreate(&stop) == hipSuccess;
+
+    // The default is timed too, so a listed solution is only kept if it is faster
+    std::vector<int> indices = candidates();
+    indices.insert(indices.begin(), 0);
+
+    int   best      = 0;
+    float best_time = std::numeric_limits<float>::max();
+    for(size_t i = 0; tuned && i < indices.size(); i++)
+    {
+        // C is copied so that the beta term reads the caller's data
+        if(hipMemcpyAsync(C_scratch, C, C_size, hipMemcpyDeviceToDevice, stream) != hipSuccess)
+        {
+            tuned = false;
+            break;
+        }
+
+        // The warm-up call also skips candidates that reject the problem
+        if(run(indices[i], C_scratch) != HIPBLAS_STATUS_SUCCESS)
+            continue;
+
+        bool  timed = hipEventRecord(start, stream) == hipSuccess;
+        float time  = 0;
+        for(int iter = 0; timed && iter < gemm_tuning_iters; iter++)
+            timed = run(indices[i], C_scratch) == HIPBLAS_STATUS_SUCCESS;
+
+        timed = timed && hipEventRecord(stop, stream) == hipSuccess
+                && hipEventSynchronize(stop) == hipSuccess
+                && hipEventElapsedTime(&time, start, stop) == hipSuccess;
+        if(timed && time < best_time)
+        {
+            best      = indices[i];
+            best_time = time;
+        }
+    }
+
+    if(start)
+        (void)hipEventDestroy(start);
+    if(stop)
+        (void)hipEventDestroy(stop);
+    (void)hipFree(C_scratch);
+
+    if(!tuned)
+        return 0;
+
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+    gemm_tuned_solutions[key] = best;
+    gemm_tuning_dirty         = true;
+    if(best_time < std::numeric_limits<float>::max())
+        gemm_tuned_times[key] = best_time / gemm_tuning_iters / 1000.0;
+    return best;
+}
+
+bool hipblasGemmTuningLookup(const std::string& key, int& solution)
+{
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+
+    auto tuned = gemm_tuned_solutions.find(key);
+    if(tuned == gemm_tuned_solutions.end())
+        return false;
+
+    solution = tuned->second;
+    return true;
+}
+
+bool hipblasGemmTuningTime(const std::string& key, double& seconds)
+{
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+
+    auto time = gemm_tuned_times.find(key);
+    if(time == gemm_tuned_times.end() || !(time->second > 0))
+        return false;
+
+    seconds = time->second;
+    return true;
+}
+
+extern "C" hipblasStatus_t hipblasSetGemmTuningMode(hipblasHandle_t         handle,
+                                                    hipblasGemmTuningMode_t mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_GEMM_TUNING_OFF && mode != HIPBLAS_GEMM_TUNING_ON)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+    gemm_tuning_modes[handle] = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetGemmTuningMode(hipblasHandle_t          handle,
+                                                    hipblasGemmTuningMode_t* mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+
+    auto handle_mode = gemm_tuning_modes.find(handle);
+    *mode = handle_mode == gemm_tuning_modes.end() ? gemm_tuning_default_mode : handle_mode->second;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasLoadGemmTuning(const char* path)
+try
+{
+    HIPBLAS_LAYER(nullptr, path);
+    if(!path)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+
+    // The backend version is only known once a handle has been created
+    if(gemm_tuning_backend_version.empty())
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    return hipblasGemmTuningRead(path) ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INVALID_VALUE;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSaveGemmTuning(const char* path)
+try
+{
+    HIPBLAS_LAYER(nullptr, path);
+    if(!path)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+
+    if(gemm_tuning_backend_version.empty())
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    return hipblasGemmTuningWrite(path) ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INVALID_VALUE;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasImportTuningProfile(const char* path)
+try
+{
+    HIPBLAS_LAYER(nullptr, path);
+    if(!path)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::string arch = hipblasGemmTuningArch();
+
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+
+    if(gemm_tuning_backend_version.empty())
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    return hipblasTuningProfileRead(path, arch) ? HIPBLAS_STATUS_SUCCESS
+                                                : HIPBLAS_STATUS_INVALID_VALUE;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasExportTuningProfile(const char* path)
+try
+{
+    HIPBLAS_LAYER(nullptr, path);
+    if(!path)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::string arch = hipblasGemmTuningArch();
+
+    std::lock_guard<std::mutex> lock(gemm_tuning_mutex);
+
+    if(gemm_tuning_backend_version.empty())
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    return hipblasTuningProfileWrite(path, arch) ? HIPBLAS_STATUS_SUCCESS
+                                                 : HIPBLAS_STATUS_INVALID_VALUE;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,982 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <type_traits>
+#include <vector>
+
+// hipBLAS functions of each precision run by gemmt
+template <typename T>
+struct hipblasGemmtFunctions;
+
+template <>
+struct hipblasGemmtFunctions<float>
+{
+    static constexpr auto geam                = hipblasSgeam;
+    static constexpr auto geamBatched         = hipblasSgeamBatched;
+    static constexpr auto geamStridedBatched  = hipblasSgeamStridedBatched;
+    static constexpr auto syrkx               = hipblasSsyrkx;
+    static constexpr auto syrkxBatched        = hipblasSsyrkxBatched;
+    static constexpr auto syrkxStridedBatched = hipblasSsyrkxStridedBatched;
+};
+
+template <>
+struct hipblasGemmtFunctions<double>
+{
+    static constexpr auto geam                = hipblasDgeam;
+    static constexpr auto geamBatched         = hipblasDgeamBatched;
+    static constexpr auto geamStridedBatched  = hipblasDgeamStridedBatched;
+    static constexpr auto syrkx               = hipblasDsyrkx;
+    static constexpr auto syrkxBatched        = hipblasDsyrkxBatched;
+    static constexpr auto syrkxStridedBatched = hipblasDsyrkxStridedBatched;
+};
+
+template <>
+struct hipblasGemmtFunctions<hipblasComplex>
+{
+    static constexpr auto geam                = hipblasCgeam;
+    static constexpr auto geamBatched         = hipblasCgeamBatched;
+    static constexpr auto geamStridedBatched  = hipblasCgeamStridedBatched;
+    static constexpr auto syrkx               = hipblasCsyrkx;
+    static constexpr auto syrkxBatched        = hipblasCsyrkxBatched;
+    static constexpr auto syrkxStridedBatched = hipblasCsyrkxStridedBatched;
+};
+
+template <>
+struct hipblasGemmtFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto geam                = hipblasZgeam;
+    static constexpr auto geamBatched         = hipblasZgeamBatched;
+    static constexpr auto geamStridedBatched  = hipblasZgeamStridedBatched;
+    static constexpr auto syrkx               = hipblasZsyrkx;
+    static constexpr auto syrkxBatched        = hipblasZsyrkxBatched;
+    static constexpr auto syrkxStridedBatched = hipblasZsyrkxStridedBatched;
+};
+
+// Matrix of the three forms: ptr of the non-batched and strided batched forms, or array of the
+// device pointers of the batched form
+template <typename T>
+struct hipblasGemmtOperand
+{
+    const T*        ptr;
+    const T* const* array;
+    int             ld;
+    hipblasStride   stride;
+};
+
+// The uplo triangle of C := alpha op(A) op(B) + beta C runs as syrkx, which computes that triangle
+// of alpha op(A') op(B')^T + beta C with one op for A' and B' and does not rely on the product
+// being symmetric. With HIPBLAS_OP_N, A' = op(A) and B' = op(B)^T are n by k, and with
+// HIPBLAS_OP_T, A' = op(A)^T and B' = op(B) are k by n. transA and transB pick the op that reads
+// most of A' and B' in place; the others are transposed into scratch with geam first. The
+// conjugate of B, for HIPBLAS_OP_C on B of a complex A^H B^H, takes two geams.
+template <typename T>
+static hipblasStatus_t hipblasGemmt(hipblasHandle_t    handle,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                n,
+                                    int                k,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    const T* const*    A_array,
+                                    int                lda,
+                                    hipblasStride      strideA,
+                                    const T*           B,
+                                    const T* const*    B_array,
+                                    int                ldb,
+                                    hipblasStride      strideB,
+                                    const T*           beta,
+                                    T*                 C,
+                                    T* const*          C_array,
+                                    int                ldc,
+                                    hipblasStride      strideC,
+                                    int                batchCount,
+                                    bool               strided)
+{
+    using F = hipblasGemmtFunctions<T>;
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    auto valid_op = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    };
+    if((uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER) || !valid_op(transA)
+       || !valid_op(transB))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n < 0 || k < 0 || batchCount < 0 || lda < std::max(1, transA == HIPBLAS_OP_N ? n : k)
+       || ldb < std::max(1, transB == HIPBLAS_OP_N ? k : n) || ldc < std::max(1, n))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    bool batched = A_array || B_array || C_array;
+    if(!alpha || !beta || (batched ? !C_array : !C)
+       || (k && (batched ? !A_array || !B_array : !A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // HIPBLAS_OP_C is HIPBLAS_OP_T on real data
+    constexpr bool is_complex = !std::is_same<T, float>{} && !std::is_same<T, double>{};
+    if(!is_complex)
+    {
+        transA = transA == HIPBLAS_OP_C ? HIPBLAS_OP_T : transA;
+        transB = transB == HIPBLAS_OP_C ? HIPBLAS_OP_T : transB;
+    }
+
+    // With k = 0 syrkx only scales C, and reads neither A nor B
+    bool trans_t = k
+                   && ((transA == HIPBLAS_OP_T && transB != HIPBLAS_OP_T)
+                       || (transA == HIPBLAS_OP_N && transB == HIPBLAS_OP_C));
+    hipblasOperation_t trans = trans_t ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+
+    // Op turning A into A' and B into B', HIPBLAS_OP_N when they are read in place
+    hipblasOperation_t op_a = HIPBLAS_OP_N, op_b = HIPBLAS_OP_N;
+    bool               conj_b = false;
+    if(trans_t)
+    {
+        op_a = transA == HIPBLAS_OP_T ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+        op_b = transB;
+    }
+    else if(k)
+    {
+        op_a   = transA;
+        op_b   = transB == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+        conj_b = transB == HIPBLAS_OP_C;
+    }
+
+    hipblasGemmtOperand<T> Ap{A, A_array, k ? lda : std::max(1, n), strideA};
+    hipblasGemmtOperand<T> Bp{B, B_array, k ? ldb : std::max(1, n), strideB};
+
+    hipblasDeviceScratch scratch;
+    if(op_a != HIPBLAS_OP_N || op_b != HIPBLAS_OP_N || conj_b)
+    {
+        hipStream_t            stream;
+        hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+        hipblasStatus_t        status         = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(capture_status != hipStreamCaptureStatusNone)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // W[0] and W[1] hold A' and B' when they are transposed, and W[2] the conjugate transpose
+        // of B on the way to B'. The batched form also has their pointer arrays, after them.
+        int    rows      = trans_t ? k : n;
+        int    cols      = trans_t ? n : k;
+        bool   used[3]   = {op_a != HIPBLAS_OP_N, conj_b || op_b != HIPBLAS_OP_N, conj_b};
+        size_t bytes     = (sizeof(T) * rows * cols * batchCount + 255) / 256 * 256;
+        size_t offset[4] = {0};
+        for(int w = 0; w < 3; w++)
+            offset[w + 1] = offset[w] + (used[w] ? bytes : 0);
+        if(hipMalloc((void**)&scratch.base, offset[3] + (batched ? 3 * sizeof(T*) * batchCount : 0))
+           != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+
+        hipblasGemmtOperand<T> W[3];
+        T**                    arrays = (T**)(scratch.base + offset[3]);
+        for(int w = 0; w < 3; w++)
+        {
+            W[w].ptr    = (const T*)(scratch.base + offset[w]);
+            W[w].array  = batched ? arrays + w * batchCount : nullptr;
+            W[w].ld     = w == 2 ? cols : rows;
+            W[w].stride = hipblasStride(rows) * cols;
+        }
+        if(batched)
+        {
+            std::vector<T*> host(3 * batchCount);
+            for(int w = 0; w < 3; w++)
+                for(int b = 0; b < batchCount; b++)
+                    host[w * batchCount + b] = (T*)W[w].ptr + b * W[w].stride;
+            if(hipMemcpyAsync(
+                   arrays, host.data(), sizeof(T*) * host.size(), hipMemcpyHostToDevice, stream)
+                   != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        // Y := op(X), with Y rows_y by cols_y, in host pointer mode. geam takes Y as its B with
+        // beta = 0, as it allows for ldb == ldc and transb == HIPBLAS_OP_N.
+        const T one = 1, zero = 0;
+
+        auto transpose = [&](hipblasOperation_t            op,
+                             int                           rows_y,
+                             int                           cols_y,
+                             const hipblasGemmtOperand<T>& X,
+                             const hipblasGemmtOperand<T>& Y) {
+            T*        y       = (T*)Y.ptr;
+            T* const* y_array = (T* const*)Y.array;
+            if(batched)
+                return F::geamBatched(handle,
+                                      op,
+                                      HIPBLAS_OP_N,
+                                      rows_y,
+                                      cols_y,
+                                      &one,
+                                      X.array,
+                                      X.ld,
+                                      &zero,
+                                      Y.array,
+                                      Y.ld,
+                                      y_array,
+                                      Y.ld,
+                                      batchCount);
+            if(strided)
+                return F::geamStridedBatched(handle,
+                                             op,
+                                             HIPBLAS_OP_N,
+                                             rows_y,
+                                             cols_y,
+                                             &one,
+                                             X.ptr,
+                                             X.ld,
+                                             X.stride,
+                                             &zero,
+                                             y,
+                                             Y.ld,
+                                             Y.stride,
+                                             y,
+                                             Y.ld,
+                                             Y.stride,
+                                             batchCount);
+            return F::geam(handle,
+                           op,
+                           HIPBLAS_OP_N,
+                           rows_y,
+                           cols_y,
+                           &one,
+                           X.ptr,
+                           X.ld,
+                           &zero,
+                           y,
+                           Y.ld,
+                           y,
+                           Y.ld);
+        };
+
+        hipblasPointerMode_t pointer_mode;
+        status = hipblasGetPointerMode(handle, &pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(op_a != HIPBLAS_OP_N)
+        {
+            status = transpose(op_a, rows, cols, Ap, W[0]);
+            Ap     = W[0];
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS && conj_b)
+        {
+            // conj(B) = (B^H)^T
+            status = transpose(HIPBLAS_OP_C, cols, rows, Bp, W[2]);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = transpose(HIPBLAS_OP_T, rows, cols, W[2], W[1]);
+            Bp = W[1];
+        }
+        else if(status == HIPBLAS_STATUS_SUCCESS && op_b != HIPBLAS_OP_N)
+        {
+            status = transpose(op_b, rows, cols, Bp, W[1]);
+            Bp     = W[1];
+        }
+
+        hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+        if(status != HIPBLAS_STATUS_SUCCESS || restore != HIPBLAS_STATUS_SUCCESS)
+            return status != HIPBLAS_STATUS_SUCCESS ? status : restore;
+    }
+
+    if(batched)
+        return F::syrkxBatched(handle,
+                               uplo,
+                               trans,
+                               n,
+                               k,
+                               alpha,
+                               Ap.array,
+                               Ap.ld,
+                               Bp.array,
+                               Bp.ld,
+                               beta,
+                               C_array,
+                               ldc,
+                               batchCount);
+    if(strided)
+        return F::syrkxStridedBatched(handle,
+                                      uplo,
+                                      trans,
+                                      n,
+                                      k,
+                                      alpha,
+                                      Ap.ptr,
+                                      Ap.ld,
+                                      Ap.stride,
+                                      Bp.ptr,
+                                      Bp.ld,
+                                      Bp.stride,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+    return F::syrkx(handle, uplo, trans, n, k, alpha, Ap.ptr, Ap.ld, Bp.ptr, Bp.ld, beta, C, ldc);
+}
+
+extern "C" hipblasStatus_t hipblasSgemmt(hipblasHandle_t    handle,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         hipblasOperation_t transB,
+                                         int                n,
+                                         int                k,
+                                         const float*       alpha,
+                                         const float*       A,
+                                         int                lda,
+                                         const float*       B,
+                                         int                ldb,
+                                         const float*       beta,
+                                         float*             C,
+                                         int                ldc)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return hipblasGemmt<float>(handle,
+                               uplo,
+                               transA,
+                               transB,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               nullptr,
+                               lda,
+                               0,
+                               B,
+                               nullptr,
+                               ldb,
+                               0,
+                               beta,
+                               C,
+                               nullptr,
+                               ldc,
+                               0,
+                               1,
+                               false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgemmt(hipblasHandle_t    handle,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         hipblasOperation_t transB,
+                                         int                n,
+                                         int                k,
+                                         const double*      alpha,
+                                         const double*      A,
+                                         int                lda,
+                                         const double*      B,
+                                         int                ldb,
+                                         const double*      beta,
+                                         double*            C,
+                                         int                ldc)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return hipblasGemmt<double>(handle,
+                                uplo,
+                                transA,
+                                transB,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                nullptr,
+                                lda,
+                                0,
+                                B,
+                                nullptr,
+                                ldb,
+                                0,
+                                beta,
+                                C,
+                                nullptr,
+                                ldc,
+                                0,
+                                1,
+                                false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgemmt(hipblasHandle_t       handle,
+                                         hipblasFillMode_t     uplo,
+                                         hipblasOperation_t    transA,
+                                         hipblasOperation_t    transB,
+                                         int                   n,
+                                         int                   k,
+                                         const hipblasComplex* alpha,
+                                         const hipblasComplex* A,
+                                         int                   lda,
+                                         const hipblasComplex* B,
+                                         int                   ldb,
+                                         const hipblasComplex* beta,
+                                         hipblasComplex*       C,
+                                         int                   ldc)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return hipblasGemmt<hipblasComplex>(handle,
+                                        uplo,
+                                        transA,
+                                        transB,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        nullptr,
+                                        lda,
+                                        0,
+                                        B,
+                                        nullptr,
+                                        ldb,
+                                        0,
+                                        beta,
+                                        C,
+                                        nullptr,
+                                        ldc,
+                                        0,
+                                        1,
+                                        false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgemmt(hipblasHandle_t             handle,
+                                         hipblasFillMode_t           uplo,
+                                         hipblasOperation_t          transA,
+                                         hipblasOperation_t          transB,
+                                         int                         n,
+                                         int                         k,
+                                         const hipblasDoubleComplex* alpha,
+                                         const hipblasDoubleComplex* A,
+                                         int                         lda,
+                                         const hipblasDoubleComplex* B,
+                                         int                         ldb,
+                                         const hipblasDoubleComplex* beta,
+                                         hipblasDoubleComplex*       C,
+                                         int                         ldc)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return hipblasGemmt<hipblasDoubleComplex>(handle,
+                                              uplo,
+                                              transA,
+                                              transB,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              nullptr,
+                                              lda,
+                                              0,
+                                              B,
+                                              nullptr,
+                                              ldb,
+                                              0,
+                                              beta,
+                                              C,
+                                              nullptr,
+                                              ldc,
+                                              0,
+                                              1,
+                                              false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgemmtBatched(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                hipblasOperation_t transB,
+                                                int                n,
+                                                int                k,
+                                                const float*       alpha,
+                                                const float* const A[],
+                                                int                lda,
+                                                const float* const B[],
+                                                int                ldb,
+                                                const float*       beta,
+                                                float* const       C[],
+                                                int                ldc,
+                                                int                batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+    return hipblasGemmt<float>(handle,
+                               uplo,
+                               transA,
+                               transB,
+                               n,
+                               k,
+                               alpha,
+                               nullptr,
+                               A,
+                               lda,
+                               0,
+                               nullptr,
+                               B,
+                               ldb,
+                               0,
+                               beta,
+                               nullptr,
+                               C,
+                               ldc,
+                               0,
+                               batchCount,
+                               false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgemmtBatched(hipblasHandle_t     handle,
+                                                hipblasFillMode_t   uplo,
+                                                hipblasOperation_t  transA,
+                                                hipblasOperation_t  transB,
+                                                int                 n,
+                                                int                 k,
+                                                const double*       alpha,
+                                                const double* const A[],
+                                                int                 lda,
+                                                const double* const B[],
+                                                int                 ldb,
+                                                const double*       beta,
+                                                double* const       C[],
+                                                int                 ldc,
+                                                int                 batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+    return hipblasGemmt<double>(handle,
+                                uplo,
+                                transA,
+                                transB,
+                                n,
+                                k,
+                                alpha,
+                                nullptr,
+                                A,
+                                lda,
+                                0,
+                                nullptr,
+                                B,
+                                ldb,
+                                0,
+                                beta,
+                                nullptr,
+                                C,
+                                ldc,
+                                0,
+                                batchCount,
+                                false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgemmtBatched(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasOperation_t          transA,
+                                                hipblasOperation_t          transB,
+                                                int                         n,
+                                                int                         k,
+                                                const hipblasComplex*       alpha,
+                                                const hipblasComplex* const A[],
+                                                int                         lda,
+                                                const hipblasComplex* const B[],
+                                                int                         ldb,
+                                                const hipblasComplex*       beta,
+                                                hipblasComplex* const       C[],
+                                                int                         ldc,
+                                                int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+    return hipblasGemmt<hipblasComplex>(handle,
+                                        uplo,
+                                        transA,
+                                        transB,
+                                        n,
+                                        k,
+                                        alpha,
+                                        nullptr,
+                                        A,
+                                        lda,
+                                        0,
+                                        nullptr,
+                                        B,
+                                        ldb,
+                                        0,
+                                        beta,
+                                        nullptr,
+                                        C,
+                                        ldc,
+                                        0,
+                                        batchCount,
+                                        false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgemmtBatched(hipblasHandle_t                   handle,
+                                                hipblasFillMode_t                 uplo,
+                                                hipblasOperation_t                transA,
+                                                hipblasOperation_t                transB,
+                                                int                               n,
+                                                int                               k,
+                                                const hipblasDoubleComplex*       alpha,
+                                                const hipblasDoubleComplex* const A[],
+                                                int                               lda,
+                                                const hipblasDoubleComplex* const B[],
+                                                int                               ldb,
+                                                const hipblasDoubleComplex*       beta,
+                                                hipblasDoubleComplex* const       C[],
+                                                int                               ldc,
+                                                int                               batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+    return hipblasGemmt<hipblasDoubleComplex>(handle,
+                                              uplo,
+                                              transA,
+                                              transB,
+                                              n,
+                                              k,
+                                              alpha,
+                                              nullptr,
+                                              A,
+                                              lda,
+                                              0,
+                                              nullptr,
+                                              B,
+                                              ldb,
+                                              0,
+                                              beta,
+                                              nullptr,
+                                              C,
+                                              ldc,
+                                              0,
+                                              batchCount,
+                                              false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgemmtStridedBatched(hipblasHandle_t    handle,
+                                                       hipblasFillMode_t  uplo,
+                                                       hipblasOperation_t transA,
+                                                       hipblasOperation_t transB,
+                                                       int                n,
+                                                       int                k,
+                                                       const float*       alpha,
+                                                       const float*       A,
+                                                       int                lda,
+                                                       hipblasStride      strideA,
+                                                       const float*       B,
+                                                       int                ldb,
+                                                       hipblasStride      strideB,
+                                                       const float*       beta,
+                                                       float*             C,
+                                                       int                ldc,
+                                                       hipblasStride      strideC,
+                                                       int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  uplo,
+                  transA,
+                  transB,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  strideA,
+                  B,
+                  ldb,
+                  strideB,
+                  beta,
+                  C,
+                  ldc,
+                  strideC,
+                  batchCount);
+    return hipblasGemmt<float>(handle,
+                               uplo,
+                               transA,
+                               transB,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               nullptr,
+                               lda,
+                               strideA,
+                               B,
+                               nullptr,
+                               ldb,
+                               strideB,
+                               beta,
+                               C,
+                               nullptr,
+                               ldc,
+                               strideC,
+                               batchCount,
+                               true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgemmtStridedBatched(hipblasHandle_t    handle,
+                                                       hipblasFillMode_t  uplo,
+                                                       hipblasOperation_t transA,
+                                                       hipblasOperation_t transB,
+                                                       int                n,
+                                                       int                k,
+                                                       const double*      alpha,
+                                                       const double*      A,
+                                                       int                lda,
+                                                       hipblasStride      strideA,
+                                                       const double*      B,
+                                                       int                ldb,
+                                                       hipblasStride      strideB,
+                                                       const double*      beta,
+                                                       double*            C,
+                                                       int                ldc,
+                                                       hipblasStride      strideC,
+                                                       int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  uplo,
+                  transA,
+                  transB,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  strideA,
+                  B,
+                  ldb,
+                  strideB,
+                  beta,
+                  C,
+                  ldc,
+                  strideC,
+                  batchCount);
+    return hipblasGemmt<double>(handle,
+                                uplo,
+                                transA,
+                                transB,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                nullptr,
+                                lda,
+                                strideA,
+                                B,
+                                nullptr,
+                                ldb,
+                                strideB,
+                                beta,
+                                C,
+                                nullptr,
+                                ldc,
+                                strideC,
+                                batchCount,
+                                true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgemmtStridedBatched(hipblasHandle_t       handle,
+                                                       hipblasFillMode_t     uplo,
+                                                       hipblasOperation_t    transA,
+                                                       hipblasOperation_t    transB,
+                                                       int                   n,
+                                                       int                   k,
+                                                       const hipblasComplex* alpha,
+                                                       const hipblasComplex* A,
+                                                       int                   lda,
+                                                       hipblasStride         strideA,
+                                                       const hipblasComplex* B,
+                                                       int                   ldb,
+                                                       hipblasStride         strideB,
+                                                       const hipblasComplex* beta,
+                                                       hipblasComplex*       C,
+                                                       int                   ldc,
+                                                       hipblasStride         strideC,
+                                                       int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  uplo,
+                  transA,
+                  transB,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  strideA,
+                  B,
+                  ldb,
+                  strideB,
+                  beta,
+                  C,
+                  ldc,
+                  strideC,
+                  batchCount);
+    return hipblasGemmt<hipblasComplex>(handle,
+                                        uplo,
+                                        transA,
+                                        transB,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        nullptr,
+                                        lda,
+                                        strideA,
+                                        B,
+                                        nullptr,
+                                        ldb,
+                                        strideB,
+                                        beta,
+                                        C,
+                                        nullptr,
+                                        ldc,
+                                        strideC,
+                                        batchCount,
+                                        true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgemmtStridedBatched(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       hipblasOperation_t          transA,
+                                                       hipblasOperation_t          transB,
+                                                       int                         n,
+                                                       int                         k,
+                                                       const hipblasDoubleComplex* alpha,
+                                                       const hipblasDoubleComplex* A,
+                                                       int                         lda,
+                                                       hipblasStride               strideA,
+                                                       const hipblasDoubleComplex* B,
+                                                       int                         ldb,
+                                                       hipblasStride               strideB,
+                                                       const hipblasDoubleComplex* beta,
+                                                       hipblasDoubleComplex*       C,
+                                                       int                         ldc,
+                                                       hipblasStride               strideC,
+                                                       int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  uplo,
+                  transA,
+                  transB,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  strideA,
+                  B,
+                  ldb,
+                  strideB,
+                  beta,
+                  C,
+                  ldc,
+                  strideC,
+                  batchCount);
+    return hipblasGemmt<hipblasDoubleComplex>(handle,
+                                              uplo,
+                                              transA,
+                                              transB,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              nullptr,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              nullptr,
+                                              ldb,
+                                              strideB,
+                                              beta,
+                                              C,
+                                              nullptr,
+                                              ldc,
+                                              strideC,
+                                              batchCount,
+                                              true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,1088 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "info_summary.hpp"
+#include "layer.hpp"
+#include "pointer_mode.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <complex>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <vector>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+// Refinement steps before falling back to the full precision factorization, as in LAPACK dsgesv
+static constexpr int gesv_ir_max_iters = 30;
+
+// Negative iteration counts, as in LAPACK dsgesv
+static constexpr int gesv_ir_overflow     = -2;
+static constexpr int gesv_ir_factor_fail  = -3;
+static constexpr int gesv_ir_not_converge = -gesv_ir_max_iters - 1;
+
+// Precisions of the iterative refinement. The low precision factorization and solve and the full
+// precision residual and fallback go through the batched hipBLAS functions, so both backends
+// share this file.
+template <typename T>
+struct hipblasGesvIRTraits;
+
+template <>
+struct hipblasGesvIRTraits<double>
+{
+    using low = float;
+
+    static hipblasStatus_t
+        getrf_low(hipblasHandle_t handle, int n, low* const A[], int* ipiv, int* info, int batch)
+    {
+        return hipblasSgetrfBatched(handle, n, A, n, ipiv, info, batch);
+    }
+
+    static hipblasStatus_t getrs_low(hipblasHandle_t handle,
+                                     int             n,
+                                     int             nrhs,
+                                     low* const      A[],
+                                     const int*      ipiv,
+                                     low* const      B[],
+                                     int*            info,
+                                     int             batch)
+    {
+        return hipblasSgetrsBatched(handle, HIPBLAS_OP_N, n, nrhs, A, n, ipiv, B, n, info, batch);
+    }
+
+    static hipblasStatus_t getrf(
+        hipblasHandle_t handle, int n, double* const A[], int lda, int* ipiv, int* info, int batch)
+    {
+        return hipblasDgetrfBatched(handle, n, A, lda, ipiv, info, batch);
+    }
+
+    static hipblasStatus_t getrs(hipblasHandle_t handle,
+                                 int             n,
+                                 int             nrhs,
+                                 double* const   A[],
+                                 int             lda,
+                                 const int*      ipiv,
+                                 double* const   B[],
+                                 int             ldb,
+                                 int*            info,
+                                 int             batch)
+    {
+        return hipblasDgetrsBatched(
+            handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, info, batch);
+    }
+
+    // R = B - A * X, with R holding B on entry
+    static hipblasStatus_t residual(hipblasHandle_t     handle,
+                                    int                 n,
+                                    int                 nrhs,
+                                    const double* const A[],
+                                    int                 lda,
+                                    const double* const X[],
+                                    int                 ldx,
+                                    double* const       R[],
+                                    int                 batch)
+    {
+        const double alpha = -1, beta = 1;
+        return hipblasDgemmBatched(handle,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   n,
+                                   nrhs,
+                                   n,
+                                   &alpha,
+                                   A,
+                                   lda,
+                                   X,
+                                   ldx,
+                                   &beta,
+                                   R,
+                                   n,
+                                   batch);
+    }
+};
+
+template <>
+struct hipblasGesvIRTraits<std::complex<double>>
+{
+    using low  = std::complex<float>;
+    using T    = std::complex<double>;
+    using hlow = hipblasComplex;
+    using hT   = hipblasDoubleComplex;
+
+    static hipblasStatus_t
+        getrf_low(hipblasHandle_t handle, int n, low* const A[], int* ipiv, int* info, int batch)
+    {
+        return hipblasCgetrfBatched(
+            handle, n, reinterpret_cast<hlow* const*>(A), n, ipiv, info, batch);
+    }
+
+    static hipblasStatus_t getrs_low(hipblasHandle_t handle,
+                                     int             n,
+                                     int             nrhs,
+                                     low* const      A[],
+                                     const int*      ipiv,
+                                     low* const      B[],
+                                     int*            info,
+                                     int             batch)
+    {
+        return hipblasCgetrsBatched(handle,
+                                    HIPBLAS_OP_N,
+                                    n,
+                                    nrhs,
+                                    reinterpret_cast<hlow* const*>(A),
+                                    n,
+                                    ipiv,
+                                    reinterpret_cast<hlow* const*>(B),
+                                    n,
+                                    info,
+                                    batch);
+    }
+
+    static hipblasStatus_t
+        getrf(hipblasHandle_t handle, int n, T* const A[], int lda, int* ipiv, int* info, int batch)
+    {
+        return hipblasZgetrfBatched(
+            handle, n, reinterpret_cast<hT* const*>(A), lda, ipiv, info, batch);
+    }
+
+    static hipblasStatus_t getrs(hipblasHandle_t handle,
+                                 int             n,
+                                 int             nrhs,
+                                 T* const        A[],
+                                 int             lda,
+                                 const int*      ipiv,
+                                 T* const        B[],
+                                 int             ldb,
+                                 int*            info,
+                                 int             batch)
+    {
+        return hipblasZgetrsBatched(handle,
+                                    HIPBLAS_OP_N,
+                                    n,
+                                    nrhs,
+                                    reinterpret_cast<hT* const*>(A),
+                                    lda,
+                                    ipiv,
+                                    reinterpret_cast<hT* const*>(B),
+                                    ldb,
+                                    info,
+                                    batch);
+    }
+
+    static hipblasStatus_t residual(hipblasHandle_t handle,
+                                    int             n,
+                                    int             nrhs,
+                                    const T* const  A[],
+                                    int             lda,
+                                    const T* const  X[],
+                                    int             ldx,
+                                    T* const        R[],
+                                    int             batch)
+    {
+        const hT alpha(-1, 0), beta(1, 0);
+        return hipblasZgemmBatched(handle,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   n,
+                                   nrhs,
+                                   n,
+                                   &alpha,
+                                   reinterpret_cast<const hT* const*>(A),
+                                   lda,
+                                   reinterpret_cast<const hT* const*>(X),
+                                   ldx,
+                                   &beta,
+                                   reinterpret_cast<hT* const*>(R),
+                                   n,
+                                   batch);
+    }
+};
+
+// |x| as used by LAPACK to compare residual and solution, |re| + |im| for complex
+static double hipblasGesvIRAbs1(double x)
+{
+    return std::abs(x);
+}
+
+static double hipblasGesvIRAbs1(const std::complex<double>& x)
+{
+    return std::abs(x.real()) + std::abs(x.imag());
+}
+
+static bool hipblasGesvIRFits(double x)
+{
+    return !(x < -FLT_MAX || x > FLT_MAX);
+}
+
+static bool hipblasGesvIRFits(const std::complex<double>& x)
+{
+    return hipblasGesvIRFits(x.real()) && hipblasGesvIRFits(x.imag());
+}
+
+// Round the packed n x cols matrix x to the low precision. Returns false if an element is out of
+// its range.
+template <typename T, typename L>
+static bool hipblasGesvIRDemote(const T* x, L* y, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        if(!hipblasGesvIRFits(x[i]))
+            return false;
+        y[i] = static_cast<L>(x[i]);
+    }
+    return true;
+}
+
+// Whether every column of the residual r is below the column of x scaled by tolerance
+template <typename T>
+static bool hipblasGesvIRConverged(const T* r, const T* x, int n, int nrhs, double tolerance)
+{
+    for(int j = 0; j < nrhs; j++)
+    {
+        double r_max = 0, x_max = 0;
+        for(int i = 0; i < n; i++)
+        {
+            r_max = std::max(r_max, hipblasGesvIRAbs1(r[i + size_t(j) * n]));
+            x_max = std::max(x_max, hipblasGesvIRAbs1(x[i + size_t(j) * n]));
+        }
+        if(!(r_max <= x_max * tolerance))
+            return false;
+    }
+    return true;
+}
+
+// The stream of handle. Returns HIPBLAS_STATUS_NOT_SUPPORTED while it is being captured, as the
+// refinement is steered from the host.
+static hipblasStatus_t hipblasGesvIRStream(hipblasHandle_t handle, hipStream_t& stream)
+{
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Solves A_i X_i = B_i for each problem, given host arrays of the device pointers. iter and
+// device_info have one entry per problem, on the host and on the device.
+template <typename T>
+static hipblasStatus_t hipblasGesvIR(hipblasHandle_t         handle,
+                                     int                     n,
+                                     int                     nrhs,
+                                     const std::vector<T*>&  A,
+                                     int                     lda,
+                                     const std::vector<int*>& ipiv,
+                                     const std::vector<T*>&  B,
+                                     int                     ldb,
+                                     const std::vector<T*>&  X,
+                                     int                     ldx,
+                                     int*                    iter,
+                                     int*                    device_info)
+{
+    using traits = hipblasGesvIRTraits<T>;
+    using L      = typename traits::low;
+
+    // Only the info of the whole solve is summarized, not that of the hipBLAS calls making it up
+    hipblasInfoSummarySuspend suspend;
+
+    int             batch_count = A.size();
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGesvIRStream(handle, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::vector<int> info(batch_count, 0);
+    std::fill(iter, iter + batch_count, 0);
+    if(!n || !nrhs)
+        return hipMemcpyAsync(device_info,
+                              info.data(),
+                              sizeof(int) * batch_count,
+                              hipMemcpyHostToDevice,
+                              stream)
+                           == hipSuccess
+                       && hipStreamSynchronize(stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    hipblasPointerModeGuard pointer_mode{handle, HIPBLAS_POINTER_MODE_HOST};
+    status = hipblasGetPointerMode(handle, &pointer_mode.mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    size_t a_size    = size_t(n) * n;
+    size_t x_size    = size_t(n) * nrhs;
+    auto   align     = [](size_t bytes) { return (bytes + 255) / 256 * 256; };
+    size_t sa_bytes  = align(sizeof(L) * a_size * batch_count);
+    size_t sx_bytes  = align(sizeof(L) * x_size * batch_count);
+    size_t r_bytes   = align(sizeof(T) * x_size * batch_count);
+    size_t piv_bytes = align(sizeof(int) * n * batch_count);
+    size_t inf_bytes = align(sizeof(int) * batch_count);
+    size_t ptr_bytes = sizeof(void*) * 3 * batch_count;
+
+    hipblasDeviceScratch scratch;
+    if(hipMalloc((void**)&scratch.base,
+                 sa_bytes + sx_bytes + r_bytes + piv_bytes + inf_bytes + ptr_bytes)
+       != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    L*     dSA   = reinterpret_cast<L*>(scratch.base);
+    L*     dSX   = reinterpret_cast<L*>(scratch.base + sa_bytes);
+    T*     dR    = reinterpret_cast<T*>(scratch.base + sa_bytes + sx_bytes);
+    int*   dIpiv = reinterpret_cast<int*>(scratch.base + sa_bytes + sx_bytes + r_bytes);
+    int*   dInfo = reinterpret_cast<int*>(scratch.base + sa_bytes + sx_bytes + r_bytes + piv_bytes);
+    void** dPtrs = reinterpret_cast<void**>(scratch.base + sa_bytes + sx_bytes + r_bytes
+                                            + piv_bytes + inf_bytes);
+
+    // Host copies are packed with leading dimension n
+    auto download = [&](void* host, const void* device, int ld, size_t size, int cols) {
+        return hipMemcpy2DAsync(
+                   host, size * n, device, size * ld, size * n, cols, hipMemcpyDeviceToHost, stream)
+               == hipSuccess;
+    };
+    auto upload = [&](void* device, int ld, const void* host, size_t size, int cols) {
+        return hipMemcpy2DAsync(
+                   device, size * ld, host, size * n, size * n, cols, hipMemcpyHostToDevice, stream)
+               == hipSuccess;
+    };
+    auto upload_ptrs = [&](const std::vector<void*>& ptrs) {
+        return hipMemcpyAsync(
+                   dPtrs, ptrs.data(), sizeof(void*) * ptrs.size(), hipMemcpyHostToDevice, stream)
+               == hipSuccess;
+    };
+    auto sync = [&]() { return hipStreamSynchronize(stream) == hipSuccess; };
+
+    // Problems refined in low precision, in the order of dSA, dSX and dR
+    std::vector<int>    refined;
+    std::vector<double> tolerance;
+    std::vector<T>      hA(a_size), hB(x_size * batch_count), hX(x_size * batch_count);
+    std::vector<T>      hR(x_size * batch_count);
+    std::vector<L>      hSA(a_size), hSX(x_size * batch_count);
+
+    for(int i = 0; i < batch_count; i++)
+        if(!download(&hB[x_size * i], B[i], ldb, sizeof(T), nrhs))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    if(!sync())
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    const double eps = std::numeric_limits<double>::epsilon() * 0.5;
+    for(int i = 0; i < batch_count; i++)
+    {
+        int k = refined.size();
+        if(!hipblasGesvIRDemote(&hB[x_size * i], &hSX[x_size * k], x_size))
+        {
+            iter[i] = gesv_ir_overflow;
+            continue;
+        }
+
+        if(!download(hA.data(), A[i], lda, sizeof(T), n) || !sync())
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        if(!hipblasGesvIRDemote(hA.data(), hSA.data(), a_size))
+        {
+            iter[i] = gesv_ir_overflow;
+            continue;
+        }
+
+        // Infinity norm of A
+        std::vector<double> row_sums(n, 0);
+        for(size_t j = 0; j < a_size; j++)
+            row_sums[j % n] += std::abs(hA[j]);
+        double norm = *std::max_element(row_sums.begin(), row_sums.end());
+
+        if(hipMemcpyAsync(
+               dSA + a_size * k, hSA.data(), sizeof(L) * a_size, hipMemcpyHostToDevice, stream)
+               != hipSuccess
+           || !sync())
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        refined.push_back(i);
+        tolerance.push_back(norm * eps * std::sqrt(double(n)));
+    }
+
+    int nrefined = refined.size();
+    if(nrefined)
+    {
+        std::vector<void*> ptrs(2 * nrefined);
+        for(int k = 0; k < nrefined; k++)
+        {
+            ptrs[k]            = dSA + a_size * k;
+            ptrs[nrefined + k] = dSX + x_size * k;
+        }
+        std::vector<void*> gemm_ptrs(3 * nrefined);
+        for(int k = 0; k < nrefined; k++)
+        {
+            gemm_ptrs[k]                = A[refined[k]];
+            gemm_ptrs[nrefined + k]     = X[refined[k]];
+            gemm_ptrs[2 * nrefined + k] = dR + x_size * k;
+        }
+
+        L* const* dSA_ptrs = reinterpret_cast<L* const*>(dPtrs);
+        L* const* dSX_ptrs = reinterpret_cast<L* const*>(dPtrs + nrefined);
+        int       solve_info;
+
+        // Low precision factorization and first solution
+        if(!upload_ptrs(ptrs))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        status = traits::getrf_low(handle, n, dSA_ptrs, dIpiv, dInfo, nrefined);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = traits::getrs_low(
+                handle, n, nrhs, dSA_ptrs, dIpiv, dSX_ptrs, &solve_info, nrefined);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(hipMemcpyAsync(hSX.data(),
+                          dSX,
+                          sizeof(L) * x_size * nrefined,
+                          hipMemcpyDeviceToHost,
+                          stream)
+               != hipSuccess
+           || hipMemcpyAsync(
+                  info.data(), dInfo, sizeof(int) * nrefined, hipMemcpyDeviceToHost, stream)
+                  != hipSuccess
+           || !sync())
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        std::vector<bool> active(nrefined);
+        auto              any_active = [&]() {
+            return std::find(active.begin(), active.end(), true) != active.end();
+        };
+        for(int k = 0; k < nrefined; k++)
+        {
+            active[k] = !info[k];
+            if(!active[k])
+                iter[refined[k]] = gesv_ir_factor_fail;
+            for(size_t j = 0; j < x_size; j++)
+                hX[x_size * k + j] = static_cast<T>(hSX[x_size * k + j]);
+        }
+
+        for(int step = 0; any_active(); step++)
+        {
+            // R = B - A * X in full precision, then the correction solves A D = R in low
+            // precision and X += D
+            for(int k = 0; k < nrefined; k++)
+                if(!upload(X[refined[k]], ldx, &hX[x_size * k], sizeof(T), nrhs)
+                   || hipMemcpy2DAsync(dR + x_size * k,
+                                       sizeof(T) * n,
+                                       B[refined[k]],
+                                       sizeof(T) * ldb,
+                                       sizeof(T) * n,
+                                       nrhs,
+                                       hipMemcpyDeviceToDevice,
+                                       stream)
+                          != hipSuccess)
+                    return HIPBLAS_STATUS_EXECUTION_FAILED;
+            if(!upload_ptrs(gemm_ptrs))
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            status = traits::residual(handle,
+                                      n,
+                                      nrhs,
+                                      reinterpret_cast<const T* const*>(dPtrs),
+                                      lda,
+                                      reinterpret_cast<const T* const*>(dPtrs + nrefined),
+                                      ldx,
+                                      reinterpret_cast<T* const*>(dPtrs + 2 * nrefined),
+                                      nrefined);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(hipMemcpyAsync(hR.data(),
+                              dR,
+                              sizeof(T) * x_size * nrefined,
+                              hipMemcpyDeviceToHost,
+                              stream)
+                   != hipSuccess
+               || !sync())
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+            for(int k = 0; k < nrefined; k++)
+            {
+                if(active[k]
+                   && hipblasGesvIRConverged(
+                       &hR[x_size * k], &hX[x_size * k], n, nrhs, tolerance[k]))
+                {
+                    iter[refined[k]] = step;
+                    active[k]        = false;
+                }
+                else if(active[k]
+                        && (step == gesv_ir_max_iters
+                            || !hipblasGesvIRDemote(&hR[x_size * k], &hSX[x_size * k], x_size)))
+                {
+                    iter[refined[k]] = step == gesv_ir_max_iters ? gesv_ir_not_converge
+                                                                 : gesv_ir_overflow;
+                    active[k]        = false;
+                }
+
+                // Finished problems are solved again with a zero right hand side
+                if(!active[k])
+                    std::fill_n(&hSX[x_size * k], x_size, L(0));
+            }
+            if(!any_active())
+                break;
+
+            if(!upload_ptrs(ptrs)
+               || hipMemcpyAsync(dSX,
+                                 hSX.data(),
+                                 sizeof(L) * x_size * nrefined,
+                                 hipMemcpyHostToDevice,
+                                 stream)
+                      != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            status = traits::getrs_low(
+                handle, n, nrhs, dSA_ptrs, dIpiv, dSX_ptrs, &solve_info, nrefined);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(hipMemcpyAsync(hSX.data(),
+                              dSX,
+                              sizeof(L) * x_size * nrefined,
+                              hipMemcpyDeviceToHost,
+                              stream)
+                   != hipSuccess
+               || !sync())
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            for(int k = 0; k < nrefined; k++)
+                if(active[k])
+                    for(size_t j = 0; j < x_size; j++)
+                        hX[x_size * k + j] += static_cast<T>(hSX[x_size * k + j]);
+        }
+
+        // The pivots of the refined problems, before dIpiv is reused
+        for(int k = 0; k < nrefined; k++)
+            if(iter[refined[k]] >= 0
+               && hipMemcpyAsync(ipiv[refined[k]],
+                                 dIpiv + size_t(n) * k,
+                                 sizeof(int) * n,
+                                 hipMemcpyDeviceToDevice,
+                                 stream)
+                      != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Full precision factorization of A for the other problems, as in LAPACK dgesv
+    std::vector<int> fallback;
+    for(int i = 0; i < batch_count; i++)
+    {
+        info[i] = 0;
+        if(iter[i] < 0)
+            fallback.push_back(i);
+    }
+    int nfallback = fallback.size();
+    if(nfallback)
+    {
+        std::vector<void*> ptrs(2 * nfallback);
+        for(int k = 0; k < nfallback; k++)
+        {
+            int i               = fallback[k];
+            ptrs[k]             = A[i];
+            ptrs[nfallback + k] = X[i];
+            if(hipMemcpy2DAsync(X[i],
+                                sizeof(T) * ldx,
+                                B[i],
+                                sizeof(T) * ldb,
+                                sizeof(T) * n,
+                                nrhs,
+                                hipMemcpyDeviceToDevice,
+                                stream)
+               != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        T* const* dA_ptrs = reinterpret_cast<T* const*>(dPtrs);
+        T* const* dX_ptrs = reinterpret_cast<T* const*>(dPtrs + nfallback);
+        int       solve_info;
+        if(!upload_ptrs(ptrs))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        status = traits::getrf(handle, n, dA_ptrs, lda, dIpiv, dInfo, nfallback);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = traits::getrs(
+                handle, n, nrhs, dA_ptrs, lda, dIpiv, dX_ptrs, ldx, &solve_info, nfallback);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        std::vector<int> fallback_info(nfallback);
+        if(hipMemcpyAsync(fallback_info.data(),
+                          dInfo,
+                          sizeof(int) * nfallback,
+                          hipMemcpyDeviceToHost,
+                          stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        for(int k = 0; k < nfallback; k++)
+            if(hipMemcpyAsync(ipiv[fallback[k]],
+                              dIpiv + size_t(n) * k,
+                              sizeof(int) * n,
+                              hipMemcpyDeviceToDevice,
+                              stream)
+               != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+        if(!sync())
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        for(int k = 0; k < nfallback; k++)
+            info[fallback[k]] = fallback_info[k];
+    }
+
+    if(hipMemcpyAsync(
+           device_info, info.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice, stream)
+           != hipSuccess
+       || !sync())
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T, typename Th>
+static hipblasStatus_t hipblasGesvIRSingle(hipblasHandle_t handle,
+                                           int             n,
+                                           int             nrhs,
+                                           Th*             A,
+                                           int             lda,
+                                           int*            ipiv,
+                                           Th*             B,
+                                           int             ldb,
+                                           Th*             X,
+                                           int             ldx,
+                                           int*            iter,
+                                           int*            info,
+                                           int*            deviceInfo)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -1;
+    else if(nrhs < 0)
+        *info = -2;
+    else if(A == NULL && n)
+        *info = -3;
+    else if(lda < std::max(1, n))
+        *info = -4;
+    else if(ipiv == NULL && n)
+        *info = -5;
+    else if(B == NULL && n && nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(X == NULL && n && nrhs)
+        *info = -8;
+    else if(ldx < std::max(1, n))
+        *info = -9;
+    else if(iter == NULL)
+        *info = -10;
+    else if(deviceInfo == NULL)
+        *info = -12;
+    else
+        *info = 0;
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGesvIR<T>(handle,
+                            n,
+                            nrhs,
+                            {reinterpret_cast<T*>(A)},
+                            lda,
+                            {ipiv},
+                            {reinterpret_cast<T*>(B)},
+                            ldb,
+                            {reinterpret_cast<T*>(X)},
+                            ldx,
+                            iter,
+                            deviceInfo);
+}
+
+template <typename T, typename Th>
+static hipblasStatus_t hipblasGesvIRBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            int             nrhs,
+                                            Th* const       A[],
+                                            int             lda,
+                                            int*            ipiv,
+                                            Th* const       B[],
+                                            int             ldb,
+                                            Th* const       X[],
+                                            int             ldx,
+                                            int*            iter,
+                                            int*            info,
+                                            int*            deviceInfo,
+                                            int             batchCount)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -1;
+    else if(nrhs < 0)
+        *info = -2;
+    else if(A == NULL && n && batchCount)
+        *info = -3;
+    else if(lda < std::max(1, n))
+        *info = -4;
+    else if(ipiv == NULL && n && batchCount)
+        *info = -5;
+    else if(B == NULL && n && nrhs && batchCount)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(X == NULL && n && nrhs && batchCount)
+        *info = -8;
+    else if(ldx < std::max(1, n))
+        *info = -9;
+    else if(iter == NULL && batchCount)
+        *info = -10;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -13;
+    else
+        *info = 0;
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // The arrays of pointers are on the device
+    std::vector<T*>  hA(batchCount), hB(batchCount), hX(batchCount);
+    std::vector<int*> hIpiv(batchCount);
+    if(n && nrhs)
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGesvIRStream(handle, stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        size_t size = sizeof(T*) * batchCount;
+        if(hipMemcpyAsync(hA.data(), A, size, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipMemcpyAsync(hB.data(), B, size, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipMemcpyAsync(hX.data(), X, size, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        for(int i = 0; i < batchCount; i++)
+            hIpiv[i] = ipiv + size_t(n) * i;
+    }
+
+    hipblasStatus_t status
+        = hipblasGesvIR<T>(handle, n, nrhs, hA, lda, hIpiv, hB, ldb, hX, ldx, iter, deviceInfo);
+    return hipblasInfoSummaryAfter(handle, deviceInfo, batchCount, status);
+}
+
+template <typename T, typename Th>
+static hipblasStatus_t hipblasGesvIRStridedBatched(hipblasHandle_t handle,
+                                                   int             n,
+                                                   int             nrhs,
+                                                   Th*             A,
+                                                   int             lda,
+                                                   hipblasStride   strideA,
+                                                   int*            ipiv,
+                                                   hipblasStride   strideP,
+                                                   Th*             B,
+                                                   int             ldb,
+                                                   hipblasStride   strideB,
+                                                   Th*             X,
+                                                   int             ldx,
+                                                   hipblasStride   strideX,
+                                                   int*            iter,
+                                                   int*            info,
+                                                   int*            deviceInfo,
+                                                   int             batchCount)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -1;
+    else if(nrhs < 0)
+        *info = -2;
+    else if(A == NULL && n && batchCount)
+        *info = -3;
+    else if(lda < std::max(1, n))
+        *info = -4;
+    else if(ipiv == NULL && n && batchCount)
+        *info = -6;
+    else if(B == NULL && n && nrhs && batchCount)
+        *info = -8;
+    else if(ldb < std::max(1, n))
+        *info = -9;
+    else if(X == NULL && n && nrhs && batchCount)
+        *info = -11;
+    else if(ldx < std::max(1, n))
+        *info = -12;
+    else if(iter == NULL && batchCount)
+        *info = -14;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -16;
+    else if(batchCount < 0)
+        *info = -17;
+    else
+        *info = 0;
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::vector<T*>   hA(batchCount), hB(batchCount), hX(batchCount);
+    std::vector<int*> hIpiv(batchCount);
+    for(int i = 0; i < batchCount; i++)
+    {
+        hA[i]    = reinterpret_cast<T*>(A + strideA * i);
+        hB[i]    = reinterpret_cast<T*>(B + strideB * i);
+        hX[i]    = reinterpret_cast<T*>(X + strideX * i);
+        hIpiv[i] = ipiv + strideP * i;
+    }
+
+    hipblasStatus_t status
+        = hipblasGesvIR<T>(handle, n, nrhs, hA, lda, hIpiv, hB, ldb, hX, ldx, iter, deviceInfo);
+    return hipblasInfoSummaryAfter(handle, deviceInfo, batchCount, status);
+}
+
+extern "C" hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                                         const int       n,
+                                         const int       nrhs,
+                                         double*         A,
+                                         const int       lda,
+                                         int*            ipiv,
+                                         double*         B,
+                                         const int       ldb,
+                                         double*         X,
+                                         const int       ldx,
+                                         int*            iter,
+                                         int*            info,
+                                         int*            deviceInfo)
+try
+{
+    HIPBLAS_LAYER(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo);
+    return hipblasGesvIRSingle<double>(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZCgesv(hipblasHandle_t       handle,
+                                         const int             n,
+                                         const int             nrhs,
+                                         hipblasDoubleComplex* A,
+                                         const int             lda,
+                                         int*                  ipiv,
+                                         hipblasDoubleComplex* B,
+                                         const int             ldb,
+                                         hipblasDoubleComplex* X,
+                                         const int             ldx,
+                                         int*                  iter,
+                                         int*                  info,
+                                         int*                  deviceInfo)
+try
+{
+    HIPBLAS_LAYER(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo);
+    return hipblasGesvIRSingle<std::complex<double>>(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t handle,
+                                                const int       n,
+                                                const int       nrhs,
+                                                double* const   A[],
+                                                const int       lda,
+                                                int*            ipiv,
+                                                double* const   B[],
+                                                const int       ldb,
+                                                double* const   X[],
+                                                const int       ldx,
+                                                int*            iter,
+                                                int*            info,
+                                                int*            deviceInfo,
+                                                const int       batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo, batchCount);
+    return hipblasGesvIRBatched<double>(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t             handle,
+                                                const int                   n,
+                                                const int                   nrhs,
+                                                hipblasDoubleComplex* const A[],
+                                                const int                   lda,
+                                                int*                        ipiv,
+                                                hipblasDoubleComplex* const B[],
+                                                const int                   ldb,
+                                                hipblasDoubleComplex* const X[],
+                                                const int                   ldx,
+                                                int*                        iter,
+                                                int*                        info,
+                                                int*                        deviceInfo,
+                                                const int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo, batchCount);
+    return hipblasGesvIRBatched<std::complex<double>>(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       const int           nrhs,
+                                                       double*             A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       int*                ipiv,
+                                                       const hipblasStride strideP,
+                                                       double*             B,
+                                                       const int           ldb,
+                                                       const hipblasStride strideB,
+                                                       double*             X,
+                                                       const int           ldx,
+                                                       const hipblasStride strideX,
+                                                       int*                iter,
+                                                       int*                info,
+                                                       int*                deviceInfo,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  n,
+                  nrhs,
+                  A,
+                  lda,
+                  strideA,
+                  ipiv,
+                  strideP,
+                  B,
+                  ldb,
+                  strideB,
+                  X,
+                  ldx,
+                  strideX,
+                  iter,
+                  info,
+                  deviceInfo,
+                  batchCount);
+    return hipblasGesvIRStridedBatched<double>(handle,
+                                               n,
+                                               nrhs,
+                                               A,
+                                               lda,
+                                               strideA,
+                                               ipiv,
+                                               strideP,
+                                               B,
+                                               ldb,
+                                               strideB,
+                                               X,
+                                               ldx,
+                                               strideX,
+                                               iter,
+                                               info,
+                                               deviceInfo,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t       handle,
+                                                       const int             n,
+                                                       const int             nrhs,
+                                                       hipblasDoubleComplex* A,
+                                                       const int             lda,
+                                                       const hipblasStride   strideA,
+                                                       int*                  ipiv,
+                                                       const hipblasStride   strideP,
+                                                       hipblasDoubleComplex* B,
+                                                       const int             ldb,
+                                                       const hipblasStride   strideB,
+                                                       hipblasDoubleComplex* X,
+                                                       const int             ldx,
+                                                       const hipblasStride   strideX,
+                                                       int*                  iter,
+                                                       int*                  info,
+                                                       int*                  deviceInfo,
+                                                       const int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  n,
+                  nrhs,
+                  A,
+                  lda,
+                  strideA,
+                  ipiv,
+                  strideP,
+                  B,
+                  ldb,
+                  strideB,
+                  X,
+                  ldx,
+                  strideX,
+                  iter,
+                  info,
+                  deviceInfo,
+                  batchCount);
+    return hipblasGesvIRStridedBatched<std::complex<double>>(handle,
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             lda,
+                                                             strideA,
+                                                             ipiv,
+                                                             strideP,
+                                                             B,
+                                                             ldb,
+                                                             strideB,
+                                                             X,
+                                                             ldx,
+                                                             strideX,
+                                                             iter,
+                                                             info,
+                                                             deviceInfo,
+                                                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+#endif
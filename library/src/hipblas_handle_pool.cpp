@@ -0,0 +1,343 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "handle_pool.hpp"
+#include "batch_scalars.hpp"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "fused_level1.hpp"
+#include "gemm_bf16x3.hpp"
+#include "gemm_fp64_emulation.hpp"
+#include "gemm_split_k.hpp"
+#include "gemm_tuning.hpp"
+#include "host_dispatch.hpp"
+#include "info_summary.hpp"
+#include "layer.hpp"
+#include "layout.hpp"
+#include "managed_prefetch.hpp"
+#include "operand_cache.hpp"
+#include "perf_counters.hpp"
+#include "pointer_array.hpp"
+#include "reproducible.hpp"
+#include "shared_handle.hpp"
+#include "stream_pool.hpp"
+#include <condition_variable>
+#include <deque>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// A handle of the pool, the device it was created on and the event recorded on its stream when
+// it was last released
+struct hipblasHandlePoolEntry
+{
+    hipblasHandle_t handle = nullptr;
+    hipEvent_t      done   = nullptr;
+    int             device = 0;
+    bool            used   = false;
+};
+
+// The released handles of each device, most recently released last, and the acquired handles.
+// Handles are created, reset and destroyed outside the lock.
+static std::mutex handle_pool_mutex;
+
+static std::unordered_map<int, std::vector<hipblasHandlePoolEntry>> handle_pool_idle;
+static std::unordered_map<hipblasHandle_t, hipblasHandlePoolEntry>  handle_pool_acquired;
+
+static void hipblasHandlePoolDestroy(const hipblasHandlePoolEntry& entry)
+{
+    if(entry.handle)
+        (void)hipblasDestroy(entry.handle);
+    if(entry.done)
+        (void)hipEventDestroy(entry.done);
+}
+
+// Handles given to hipblasDestroyAsync, destroyed in the order they were given by a detached
+// thread once the event recorded on their stream completes, so the device synchronization and
+// frees of hipblasDestroy happen off the calling thread. pending counts the handles given and not
+// yet destroyed. The state is never freed, as the thread may outlive the static objects.
+struct hipblasHandleReclaimer
+{
+    std::mutex                         mutex;
+    std::condition_variable            retired_cv;
+    std::condition_variable            destroyed_cv;
+    std::deque<hipblasHandlePoolEntry> retired;
+    size_t                             pending = 0;
+};
+
+static hipblasHandleReclaimer& handle_reclaimer = *new hipblasHandleReclaimer;
+static std::once_flag          handle_reclaimer_started;
+
+static void hipblasHandleReclaimerRun()
+{
+    int current = -1;
+    for(;;)
+    {
+        hipblasHandlePoolEntry entry;
+        {
+            std::unique_lock<std::mutex> lock(handle_reclaimer.mutex);
+            handle_reclaimer.retired_cv.wait(lock,
+                                             [] { return !handle_reclaimer.retired.empty(); });
+            entry = handle_reclaimer.retired.front();
+            handle_reclaimer.retired.pop_front();
+        }
+
+        if(entry.device != current && hipSetDevice(entry.device) == hipSuccess)
+            current = entry.device;
+        if(hipEventSynchronize(entry.done) != hipSuccess)
+            (void)hipGetLastError();
+        hipblasHandlePoolDestroy(entry);
+
+        std::lock_guard<std::mutex> lock(handle_reclaimer.mutex);
+        if(--handle_reclaimer.pending == 0)
+            handle_reclaimer.destroyed_cv.notify_all();
+    }
+}
+
+extern "C" hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandle_t* handle, hipStream_t stream)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, stream);
+    if(!handle)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+
+    hipblasHandlePoolEntry entry;
+    {
+        std::lock_guard<std::mutex> lock(handle_pool_mutex);
+
+        auto idle = handle_pool_idle.find(device);
+        if(idle != handle_pool_idle.end() && !idle->second.empty())
+        {
+            entry = idle->second.back();
+            idle->second.pop_back();
+        }
+    }
+
+    if(!entry.handle)
+    {
+        entry.device = device;
+        if(hipEventCreateWithFlags(&entry.done, hipEventDisableTiming) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+
+        hipblasStatus_t status = hipblasCreate(&entry.handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            entry.handle = nullptr;
+            hipblasHandlePoolDestroy(entry);
+            return status;
+        }
+    }
+
+    // The workspace of the handle may still be in use by the work queued by its previous user
+    hipblasStatus_t status = hipblasSetStream(entry.handle, stream);
+    if(status == HIPBLAS_STATUS_SUCCESS && entry.used
+       && hipStreamWaitEvent(stream, entry.done, 0) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasHandlePoolDestroy(entry);
+        return status;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(handle_pool_mutex);
+        handle_pool_acquired.emplace(entry.handle, entry);
+    }
+    *handle = entry.handle;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasHandlePoolRelease(hipblasHandle_t handle)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasHandlePoolEntry entry;
+    {
+        std::lock_guard<std::mutex> lock(handle_pool_mutex);
+
+        auto acquired = handle_pool_acquired.find(handle);
+        if(acquired == handle_pool_acquired.end())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        entry = acquired->second;
+        handle_pool_acquired.erase(acquired);
+    }
+
+    // The settings kept by hipBLAS, then the backend state. A shared handle is made unshared
+    // first, so the stream below is the stream of the handle itself.
+    hipblasSharedHandleErase(handle);
+    hipblasGemmTuningErase(handle);
+    hipblasGemmSplitKErase(handle);
+    hipblasGemmFp64EmulationErase(handle);
+    hipblasGemmBf16x3Erase(handle);
+    hipblasHostDispatchErase(handle);
+    hipblasManagedPrefetchErase(handle);
+    hipblasReductionModeErase(handle);
+    hipblasPerfCountersErase(handle);
+    hipblasInfoSummaryErase(handle);
+    hipblasPointerArrayErase(handle);
+    hipblasLayoutErase(handle);
+    hipblasBatchScalarStrideErase(handle);
+    hipblasStreamPoolErase(handle);
+    hipblasDeferredErase(handle);
+    hipblasOperandCacheErase(handle);
+#ifdef HIPBLAS_FUSED_LEVEL1
+    hipblasFusedLevel1Erase(handle);
+#endif
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        if(hipEventRecord(entry.done, stream) == hipSuccess)
+            entry.used = true;
+        else
+        {
+            (void)hipGetLastError();
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+    }
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasHandleReset(handle);
+
+    // A handle left in an unknown state is not reused
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasHandlePoolDestroy(entry);
+        return status;
+    }
+
+    std::lock_guard<std::mutex> lock(handle_pool_mutex);
+    handle_pool_idle[entry.device].push_back(entry);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDestroyAsync(hipblasHandle_t handle)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool acquired;
+    {
+        std::lock_guard<std::mutex> lock(handle_pool_mutex);
+        acquired = handle_pool_acquired.count(handle) != 0;
+    }
+    if(acquired)
+        return hipblasHandlePoolRelease(handle);
+
+    int                    device;
+    hipStream_t            stream;
+    hipblasHandlePoolEntry entry;
+    entry.handle           = handle;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Without an event to wait for, the handle is destroyed here
+    if(hipGetDevice(&device) != hipSuccess
+       || hipEventCreateWithFlags(&entry.done, hipEventDisableTiming) != hipSuccess
+       || hipEventRecord(entry.done, stream) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        if(entry.done)
+            (void)hipEventDestroy(entry.done);
+        return hipblasDestroy(handle);
+    }
+    entry.device = device;
+
+    // The handle is unbound from the stream, which the caller may destroy before the event
+    // completes
+    status = hipblasSetStream(handle, nullptr);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        (void)hipEventDestroy(entry.done);
+        return status;
+    }
+
+    std::call_once(handle_reclaimer_started,
+                   [] { std::thread(hipblasHandleReclaimerRun).detach(); });
+    {
+        std::lock_guard<std::mutex> lock(handle_reclaimer.mutex);
+        handle_reclaimer.retired.push_back(entry);
+        handle_reclaimer.pending++;
+    }
+    handle_reclaimer.retired_cv.notify_one();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasHandlePoolClear()
+try
+{
+    HIPBLAS_LAYER(nullptr);
+
+    // The handles given to hipblasDestroyAsync are destroyed first
+    {
+        std::unique_lock<std::mutex> lock(handle_reclaimer.mutex);
+        handle_reclaimer.destroyed_cv.wait(lock, [] { return handle_reclaimer.pending == 0; });
+    }
+
+    std::unordered_map<int, std::vector<hipblasHandlePoolEntry>> idle;
+    {
+        std::lock_guard<std::mutex> lock(handle_pool_mutex);
+        idle.swap(handle_pool_idle);
+    }
+
+    for(auto& device : idle)
+        for(auto& entry : device.second)
+            hipblasHandlePoolDestroy(entry);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,554 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "host_dispatch.hpp"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "shared_handle.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <initializer_list>
+#include <mutex>
+#include <unordered_map>
+
+static constexpr int host_dispatch_routines = 4;
+
+static const char* const host_dispatch_names[host_dispatch_routines]
+    = {"dot", "axpy", "gemv", "gemm"};
+
+// Thresholds of the handles that set none, from HIPBLAS_HOST_DISPATCH_THRESHOLDS when given and
+// from a tuning profile otherwise. host_dispatch_defaults_env marks those the variable gave.
+static int64_t        host_dispatch_defaults[host_dispatch_routines] = {4096, 4096, 16384, 32768};
+static bool           host_dispatch_defaults_env[host_dispatch_routines] = {};
+static std::once_flag host_dispatch_defaults_flag;
+
+// A threshold of -1 is the default of its routine
+struct hipblasHostDispatchSetting
+{
+    hipblasHostDispatchMode_t mode = HIPBLAS_HOST_DISPATCH_OFF;
+    int64_t                   thresholds[host_dispatch_routines] = {-1, -1, -1, -1};
+};
+
+static std::mutex                                                      host_dispatch_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasHostDispatchSetting> host_dispatch_settings;
+
+// Number of handles whose mode is not HIPBLAS_HOST_DISPATCH_OFF, so calls skip the lookup while
+// there are none
+static std::atomic<int> host_dispatch_handles{0};
+
+static void hipblasHostDispatchReadDefaults()
+{
+    std::call_once(host_dispatch_defaults_flag, [] {
+        const char* env = std::getenv("HIPBLAS_HOST_DISPATCH_THRESHOLDS");
+        while(env && *env)
+        {
+            const char* end = std::strchr(env, ',');
+            size_t      len = end ? size_t(end - env) : std::strlen(env);
+            for(int r = 0; r < host_dispatch_routines; r++)
+            {
+                size_t name_len = std::strlen(host_dispatch_names[r]);
+                if(len > name_len && !std::strncmp(env, host_dispatch_names[r], name_len)
+                   && env[name_len] == '=')
+                {
+                    char*     last;
+                    long long value = std::strtoll(env + name_len + 1, &last, 10);
+                    if(last == env + len && last != env + name_len + 1 && value >= 0)
+                    {
+                        host_dispatch_defaults[r]     = value;
+                        host_dispatch_defaults_env[r] = true;
+                    }
+                }
+            }
+            env = end ? end + 1 : nullptr;
+        }
+    });
+}
+
+int64_t hipblasHostDispatchGetDefault(hipblasHostDispatchRoutine_t routine)
+{
+    hipblasHostDispatchReadDefaults();
+    std::lock_guard<std::mutex> lock(host_dispatch_mutex);
+    return host_dispatch_defaults[routine];
+}
+
+void hipblasHostDispatchSetDefault(hipblasHostDispatchRoutine_t routine, int64_t threshold)
+{
+    hipblasHostDispatchReadDefaults();
+    std::lock_guard<std::mutex> lock(host_dispatch_mutex);
+    if(!host_dispatch_defaults_env[routine] && threshold >= 0)
+        host_dispatch_defaults[routine] = threshold;
+}
+
+void hipblasHostDispatchErase(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(host_dispatch_mutex);
+    auto                        it = host_dispatch_settings.find(handle);
+    if(it == host_dispatch_settings.end())
+        return;
+    if(it->second.mode != HIPBLAS_HOST_DISPATCH_OFF)
+        host_dispatch_handles--;
+    host_dispatch_settings.erase(it);
+}
+
+// True with the operand in host memory, pageable or pinned. Pointers the runtime does not know
+// are pageable host memory.
+static bool hipblasHostDispatchOnHost(const void* ptr)
+{
+    hipPointerAttribute_t attributes;
+    if(hipPointerGetAttributes(&attributes, ptr) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return true;
+    }
+#if HIP_VERSION >= 60000000
+    return attributes.type == hipMemoryTypeHost || attributes.type == hipMemoryTypeUnregistered;
+#else
+    return attributes.memoryType == hipMemoryTypeHost;
+#endif
+}
+
+// Returns false when the call of size elements of routine runs on the device, and true when it
+// runs on the host, with status HIPBLAS_STATUS_SUCCESS once the stream of handle is synchronized
+static bool hipblasHostDispatchReady(hipblasHandle_t                    handle,
+                                     hipblasHostDispatchRoutine_t       routine,
+                                     int64_t                            size,
+                                     std::initializer_list<const void*> operands,
+                                     hipblasStatus_t&                   status)
+{
+    if(hipblas_deferred_depth != 1 || !host_dispatch_handles.load(std::memory_order_relaxed)
+       || hipblasSharedHandleIs(handle))
+        return false;
+
+    hipblasHostDispatchReadDefaults();
+
+    hipblasHostDispatchSetting setting;
+    int64_t                    threshold;
+    {
+        std::lock_guard<std::mutex> lock(host_dispatch_mutex);
+        auto                        it = host_dispatch_settings.find(handle);
+        if(it == host_dispatch_settings.end())
+            return false;
+        setting   = it->second;
+        threshold = setting.thresholds[routine];
+        if(threshold < 0)
+            threshold = host_dispatch_defaults[routine];
+    }
+    if(setting.mode == HIPBLAS_HOST_DISPATCH_OFF)
+        return false;
+
+    if(size > threshold)
+        return false;
+
+    hipStream_t            stream;
+    hipblasPointerMode_t   mode;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+       || mode != HIPBLAS_POINTER_MODE_HOST
+       || hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return false;
+
+    if(setting.mode == HIPBLAS_HOST_DISPATCH_DETECT)
+        for(const void* ptr : operands)
+            if(!hipblasHostDispatchOnHost(ptr))
+                return false;
+
+    // The calls queued on a deferred handle come first, then the work already on the stream
+    if(hipblasDeferredActive())
+        hipblasDeferredFlush(handle);
+    status = hipStreamSynchronize(stream) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                        : HIPBLAS_STATUS_EXECUTION_FAILED;
+    return true;
+}
+
+// First element of a vector of n elements with increment inc
+static inline int64_t hipblasHostDispatchStart(int n, int inc)
+{
+    return inc < 0 ? int64_t(1 - n) * inc : 0;
+}
+
+template <typename T>
+static bool hipblasHostDotTemplate(hipblasHandle_t  handle,
+                                   int              n,
+                                   const T*         x,
+                                   int              incx,
+                                   const T*         y,
+                                   int              incy,
+                                   T*               result,
+                                   hipblasStatus_t& status)
+{
+    if(!handle || n <= 0 || !x || !y || !result
+       || !hipblasHostDispatchReady(handle, HIPBLAS_HOST_DISPATCH_DOT, n, {x, y}, status))
+        return false;
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    T       sum = 0;
+    int64_t ix  = hipblasHostDispatchStart(n, incx);
+    int64_t iy  = hipblasHostDispatchStart(n, incy);
+    for(int i = 0; i < n; i++, ix += incx, iy += incy)
+        sum += x[ix] * y[iy];
+    *result = sum;
+    return true;
+}
+
+template <typename T>
+static bool hipblasHostAxpyTemplate(hipblasHandle_t  handle,
+                                    int              n,
+                                    const T*         alpha,
+                                    const T*         x,
+                                    int              incx,
+                                    T*               y,
+                                    int              incy,
+                                    hipblasStatus_t& status)
+{
+    if(!handle || n <= 0 || !alpha || !x || !y
+       || !hipblasHostDispatchReady(handle, HIPBLAS_HOST_DISPATCH_AXPY, n, {x, y}, status))
+        return false;
+    if(status != HIPBLAS_STATUS_SUCCESS || *alpha == 0)
+        return true;
+
+    int64_t ix = hipblasHostDispatchStart(n, incx);
+    int64_t iy = hipblasHostDispatchStart(n, incy);
+    for(int i = 0; i < n; i++, ix += incx, iy += incy)
+        y[iy] += *alpha * x[ix];
+    return true;
+}
+
+template <typename T>
+static bool hipblasHostGemvTemplate(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    int                m,
+                                    int                n,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    int                lda,
+                                    const T*           x,
+                                    int                incx,
+                                    const T*           beta,
+                                    T*                 y,
+                                    int                incy,
+                                    hipblasStatus_t&   status)
+{
+    if(!handle || (trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+       || m <= 0 || n <= 0 || lda < m || !incx || !incy || !alpha || !beta || !A || !x || !y
+       || !hipblasHostDispatchReady(
+           handle, HIPBLAS_HOST_DISPATCH_GEMV, int64_t(m) * n, {A, x, y}, status))
+        return false;
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    // y has m elements and x n with HIPBLAS_OP_N, the other way round otherwise
+    bool    op_n  = trans == HIPBLAS_OP_N;
+    int     y_len = op_n ? m : n;
+    int     x_len = op_n ? n : m;
+    int64_t iy    = hipblasHostDispatchStart(y_len, incy);
+    int64_t x0    = hipblasHostDispatchStart(x_len, incx);
+    for(int i = 0; i < y_len; i++, iy += incy)
+    {
+        T sum = 0;
+        if(*alpha != 0)
+        {
+            int64_t ix = x0;
+            for(int j = 0; j < x_len; j++, ix += incx)
+                sum += (op_n ? A[i + int64_t(j) * lda] : A[j + int64_t(i) * lda]) * x[ix];
+        }
+        y[iy] = *beta == 0 ? *alpha * sum : *alpha * sum + *beta * y[iy];
+    }
+    return true;
+}
+
+template <typename T>
+static bool hipblasHostGemmTemplate(hipblasHandle_t    handle,
+                                    hipblasOperation_t transa,
+                                    hipblasOperation_t transb,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    int                lda,
+                                    const T*           B,
+                                    int                ldb,
+                                    const T*           beta,
+                                    T*                 C,
+                                    int                ldc,
+                                    hipblasStatus_t&   status)
+{
+    auto valid = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    };
+    bool a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+    if(!handle || !valid(transa) || !valid(transb) || m <= 0 || n <= 0 || k <= 0
+       || lda < (a_n ? m : k) || ldb < (b_n ? k : n) || ldc < m || !alpha || !beta || !A || !B
+       || !C
+       || !hipblasHostDispatchReady(
+           handle, HIPBLAS_HOST_DISPATCH_GEMM, int64_t(m) * n * k, {A, B, C}, status))
+        return false;
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < m; i++)
+        {
+            T sum = 0;
+            if(*alpha != 0)
+                for(int l = 0; l < k; l++)
+                    sum += (a_n ? A[i + int64_t(l) * lda] : A[l + int64_t(i) * lda])
+                           * (b_n ? B[l + int64_t(j) * ldb] : B[j + int64_t(l) * ldb]);
+            T& c = C[i + int64_t(j) * ldc];
+            c    = *beta == 0 ? *alpha * sum : *alpha * sum + *beta * c;
+        }
+    return true;
+}
+
+bool hipblasHostDot(hipblasHandle_t  handle,
+                    int              n,
+                    const float*     x,
+                    int              incx,
+                    const float*     y,
+                    int              incy,
+                    float*           result,
+                    hipblasStatus_t& status)
+{
+    return hipblasHostDotTemplate(handle, n, x, incx, y, incy, result, status);
+}
+
+bool hipblasHostDot(hipblasHandle_t  handle,
+                    int              n,
+                    const double*    x,
+                    int              incx,
+                    const double*    y,
+                    int              incy,
+                    double*          result,
+                    hipblasStatus_t& status)
+{
+    return hipblasHostDotTemplate(handle, n, x, incx, y, incy, result, status);
+}
+
+bool hipblasHostAxpy(hipblasHandle_t  handle,
+                     int              n,
+                     const float*     alpha,
+                     const float*     x,
+                     int              incx,
+                     float*           y,
+                     int              incy,
+                     hipblasStatus_t& status)
+{
+    return hipblasHostAxpyTemplate(handle, n, alpha, x, incx, y, incy, status);
+}
+
+bool hipblasHostAxpy(hipblasHandle_t  handle,
+                     int              n,
+                     const double*    alpha,
+                     const double*    x,
+                     int              incx,
+                     double*          y,
+                     int              incy,
+                     hipblasStatus_t& status)
+{
+    return hipblasHostAxpyTemplate(handle, n, alpha, x, incx, y, incy, status);
+}
+
+bool hipblasHostGemv(hipblasHandle_t    handle,
+                     hipblasOperation_t trans,
+                     int                m,
+                     int                n,
+                     const float*       alpha,
+                     const float*       A,
+                     int                lda,
+                     const float*       x,
+                     int                incx,
+                     const float*       beta,
+                     float*             y,
+                     int                incy,
+                     hipblasStatus_t&   status)
+{
+    return hipblasHostGemvTemplate(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, status);
+}
+
+bool hipblasHostGemv(hipblasHandle_t    handle,
+                     hipblasOperation_t trans,
+                     int                m,
+                     int                n,
+                     const double*      alpha,
+                     const double*      A,
+                     int                lda,
+                     const double*      x,
+                     int                incx,
+                     const double*      beta,
+                     double*            y,
+                     int                incy,
+                     hipblasStatus_t&   status)
+{
+    return hipblasHostGemvTemplate(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, status);
+}
+
+bool hipblasHostGemm(hipblasHandle_t    handle,
+                     hipblasOperation_t transa,
+                     hipblasOperation_t transb,
+                     int                m,
+                     int                n,
+                     int                k,
+                     const float*       alpha,
+                     const float*       A,
+                     int                lda,
+                     const float*       B,
+                     int                ldb,
+                     const float*       beta,
+                     float*             C,
+                     int                ldc,
+                     hipblasStatus_t&   status)
+{
+    return hipblasHostGemmTemplate(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, status);
+}
+
+bool hipblasHostGemm(hipblasHandle_t    handle,
+                     hipblasOperation_t transa,
+                     hipblasOperation_t transb,
+                     int                m,
+                     int                n,
+                     int                k,
+                     const double*      alpha,
+                     const double*      A,
+                     int                lda,
+                     const double*      B,
+                     int                ldb,
+                     const double*      beta,
+                     double*            C,
+                     int                ldc,
+                     hipblasStatus_t&   status)
+{
+    return hipblasHostGemmTemplate(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, status);
+}
+
+extern "C" hipblasStatus_t hipblasSetHostDispatch(hipblasHandle_t           handle,
+                                                  hipblasHostDispatchMode_t mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_HOST_DISPATCH_OFF && mode != HIPBLAS_HOST_DISPATCH_DETECT
+       && mode != HIPBLAS_HOST_DISPATCH_HOST)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    std::lock_guard<std::mutex> lock(host_dispatch_mutex);
+
+    hipblasHostDispatchSetting& setting = host_dispatch_settings[handle];
+    host_dispatch_handles += (mode != HIPBLAS_HOST_DISPATCH_OFF)
+                             - (setting.mode != HIPBLAS_HOST_DISPATCH_OFF);
+    setting.mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetHostDispatch(hipblasHandle_t            handle,
+                                                  hipblasHostDispatchMode_t* mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(host_dispatch_mutex);
+
+    auto it = host_dispatch_settings.find(handle);
+    *mode   = it == host_dispatch_settings.end() ? HIPBLAS_HOST_DISPATCH_OFF : it->second.mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetHostDispatchThreshold(hipblasHandle_t              handle,
+                                                           hipblasHostDispatchRoutine_t routine,
+                                                           int64_t                      threshold)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, routine, threshold);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(routine < HIPBLAS_HOST_DISPATCH_DOT || routine > HIPBLAS_HOST_DISPATCH_GEMM)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(threshold < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(host_dispatch_mutex);
+    host_dispatch_settings[handle].thresholds[routine] = threshold;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetHostDispatchThreshold(hipblasHandle_t              handle,
+                                                           hipblasHostDispatchRoutine_t routine,
+                                                           int64_t*                     threshold)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, routine, threshold);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(routine < HIPBLAS_HOST_DISPATCH_DOT || routine > HIPBLAS_HOST_DISPATCH_GEMM)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(!threshold)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHostDispatchReadDefaults();
+
+    std::lock_guard<std::mutex> lock(host_dispatch_mutex);
+
+    auto it    = host_dispatch_settings.find(handle);
+    *threshold = it == host_dispatch_settings.end() || it->second.thresholds[routine] < 0
+                     ? host_dispatch_defaults[routine]
+                     : it->second.thresholds[routine];
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,277 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "info_summary.hpp"
+#include "affinity.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "shared_handle.hpp"
+#include <algorithm>
+#include <atomic>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Smallest pinned buffer, in info values, so short batches share buffers
+static constexpr int info_summary_min_capacity = 1024;
+
+// One summary in flight. The host function owns the job until it has written the summary. node is
+// the NUMA node info was allocated on.
+struct hipblasInfoSummaryJob
+{
+    int*                  info        = nullptr;
+    int                   capacity    = 0;
+    int                   node        = HIPBLAS_NUMA_NODE_ANY;
+    int                   batch_count = 0;
+    hipblasInfoSummary_t* summary     = nullptr;
+};
+
+// The summaries set with hipblasSetInfoSummary and the idle jobs, kept until the process exits.
+// info_summary_handles counts the handles with a summary, so calls on other handles skip the lock.
+static std::mutex                                                 info_summary_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasInfoSummary_t*> info_summaries;
+static std::vector<hipblasInfoSummaryJob*>                        info_summary_jobs;
+static std::atomic<int>                                           info_summary_handles{0};
+static thread_local int                                           info_summary_suspended = 0;
+
+hipblasInfoSummarySuspend::hipblasInfoSummarySuspend()
+{
+    info_summary_suspended++;
+}
+
+hipblasInfoSummarySuspend::~hipblasInfoSummarySuspend()
+{
+    info_summary_suspended--;
+}
+
+static void hipblasInfoSummaryJobRelease(hipblasInfoSummaryJob* job)
+{
+    std::lock_guard<std::mutex> lock(info_summary_mutex);
+    info_summary_jobs.push_back(job);
+}
+
+// An idle job whose buffer holds batch_count info values, on the NUMA node of the current device,
+// or nullptr if it cannot be allocated
+static hipblasInfoSummaryJob* hipblasInfoSummaryJobGet(int batch_count)
+{
+    int device;
+    int node = HIPBLAS_NUMA_NODE_ANY;
+    if(hipGetDevice(&device) == hipSuccess)
+        node = hipblasAffinityDeviceNode(device);
+    else
+        (void)hipGetLastError();
+
+    hipblasInfoSummaryJob* job = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(info_summary_mutex);
+
+        // Take a job whose buffer is large enough, otherwise the last one to grow it
+        size_t i = 0;
+        while(i + 1 < info_summary_jobs.size() && info_summary_jobs[i]->capacity < batch_count)
+            i++;
+        if(i < info_summary_jobs.size())
+        {
+            job = info_summary_jobs[i];
+            info_summary_jobs.erase(info_summary_jobs.begin() + i);
+        }
+    }
+    if(!job)
+        job = new hipblasInfoSummaryJob;
+
+    if(job->capacity < batch_count || job->node != node)
+    {
+        int capacity = std::max({batch_count, job->capacity, info_summary_min_capacity});
+        if(job->info)
+            (void)hipblasAffinityHostFree(job->info);
+        job->info     = nullptr;
+        job->capacity = 0;
+        job->node     = node;
+        if(hipblasAffinityHostMalloc((void**)&job->info, sizeof(int) * capacity, node)
+           != hipSuccess)
+        {
+            job->info = nullptr;
+            (void)hipGetLastError();
+            hipblasInfoSummaryJobRelease(job);
+            return nullptr;
+        }
+        job->capacity = capacity;
+    }
+    return job;
+}
+
+// Host function reducing the info values copied into the job
+static void hipblasInfoSummaryReduce(void* data)
+{
+    auto* job = static_cast<hipblasInfoSummaryJob*>(data);
+
+    hipblasInfoSummary_t summary = {0, -1, 0};
+    for(int i = 0; i < job->batch_count; i++)
+    {
+        if(job->info[i])
+        {
+            if(!summary.failureCount)
+                summary.firstFailed = i;
+            summary.failureCount++;
+        }
+    }
+    summary.anyFailed = summary.failureCount > 0;
+    *job->summary     = summary;
+
+    hipblasInfoSummaryJobRelease(job);
+}
+
+hipblasStatus_t hipblasInfoSummaryEnqueue(hipStream_t           stream,
+                                          const int*            info,
+                                          int                   batch_count,
+                                          hipblasInfoSummary_t* summary)
+{
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasInfoSummaryJob* job = hipblasInfoSummaryJobGet(batch_count);
+    if(!job)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    job->batch_count = batch_count;
+    job->summary     = summary;
+
+    size_t size = sizeof(int) * batch_count;
+    if(batch_count
+       && hipMemcpyAsync(job->info, info, size, hipMemcpyDeviceToHost, stream) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        hipblasInfoSummaryJobRelease(job);
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    if(hipLaunchHostFunc(stream, hipblasInfoSummaryReduce, job) != hipSuccess)
+    {
+        // The copy may still be writing the buffer
+        (void)hipGetLastError();
+        (void)hipStreamSynchronize(stream);
+        hipblasInfoSummaryJobRelease(job);
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasInfoSummaryAfter(hipblasHandle_t handle,
+                                        const int*      info,
+                                        int             batch_count,
+                                        hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS || info_summary_suspended
+       || !info_summary_handles.load(std::memory_order_relaxed))
+        return status;
+
+    hipblasInfoSummary_t* summary;
+    {
+        std::lock_guard<std::mutex> lock(info_summary_mutex);
+
+        auto entry = info_summaries.find(handle);
+        if(entry == info_summaries.end())
+            return status;
+        summary = entry->second;
+    }
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasInfoSummaryEnqueue(stream, info, batch_count, summary);
+    return status == HIPBLAS_STATUS_NOT_SUPPORTED ? HIPBLAS_STATUS_SUCCESS : status;
+}
+
+void hipblasInfoSummaryErase(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(info_summary_mutex);
+    info_summary_handles -= int(info_summaries.erase(handle));
+}
+
+extern "C" hipblasStatus_t hipblasInfoSummaryAsync(hipblasHandle_t       handle,
+                                                   const int*            info,
+                                                   int                   batchCount,
+                                                   hipblasInfoSummary_t* summary)
+try
+{
+    HIPBLAS_LAYER(handle, info, batchCount, summary);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batchCount < 0 || (!info && batchCount) || !summary)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasInfoSummaryEnqueue(stream, info, batchCount, summary);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetInfoSummary(hipblasHandle_t       handle,
+                                                 hipblasInfoSummary_t* summary)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, summary);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    std::lock_guard<std::mutex> lock(info_summary_mutex);
+    if(summary)
+        info_summary_handles += int(info_summaries.insert_or_assign(handle, summary).second);
+    else
+        info_summary_handles -= int(info_summaries.erase(handle));
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetInfoSummary(hipblasHandle_t        handle,
+                                                 hipblasInfoSummary_t** summary)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, summary);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!summary)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(info_summary_mutex);
+
+    auto entry = info_summaries.find(handle);
+    *summary   = entry == info_summaries.end() ? nullptr : entry->second;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,367 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "pointer_mode.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// 1 in the scalar type of compute_type, real or complex, in host memory
+static const void* hipblasKronOne(hipblasComputeType_t compute_type)
+{
+    static const uint16_t half_one      = 0x3c00;
+    static const float    float_one[2]  = {1, 0};
+    static const double   double_one[2] = {1, 0};
+
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        return &half_one;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        return double_one;
+    default:
+        return float_one;
+    }
+}
+
+// Checks the factors and sets the numbers of rows and columns of their product
+static hipblasStatus_t hipblasKronCheck(hipblasHandle_t handle,
+                                        int             factors,
+                                        const int*      m,
+                                        const int*      n,
+                                        const int*      lda,
+                                        int64_t&        rows,
+                                        int64_t&        cols)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(factors < 1 || !m || !n || !lda)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    rows = 1;
+    cols = 1;
+    for(int f = 0; f < factors; f++)
+        if(m[f] < 0 || n[f] < 0 || lda[f] < std::max(1, m[f]))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int f = 0; f < factors; f++)
+    {
+        if((m[f] && rows > INT64_MAX / m[f]) || (n[f] && cols > INT64_MAX / n[f]))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        rows *= m[f];
+        cols *= n[f];
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+static hipblasStatus_t hipblasKron(hipblasHandle_t      handle,
+                                   int                  factors,
+                                   const int*           m,
+                                   const int*           n,
+                                   const void* const*   A,
+                                   const int*           lda,
+                                   const void*          alpha,
+                                   const void*          X,
+                                   int64_t              ldx,
+                                   const void*          beta,
+                                   void*                Y,
+                                   int64_t              ldy,
+                                   int                  p,
+                                   hipDataType          data_type,
+                                   hipblasComputeType_t compute_type)
+{
+    int64_t         rows, cols;
+    hipblasStatus_t status = hipblasKronCheck(handle, factors, m, n, lda, rows, cols);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!A || p < 0 || ldx < std::max<int64_t>(1, cols) || ldy < std::max<int64_t>(1, rows))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t size = hipblasDatatypeFloating(data_type) ? hipblasDatatypeSize(data_type) : 0;
+    if(!size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!rows || !p)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !Y || (cols && !X))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Without columns the product is empty and Y = beta*Y
+    if(!cols)
+    {
+        if(rows > INT_MAX || ldy > INT_MAX)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return hipblasGemmEx_v2(handle,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_OP_N,
+                                int(rows),
+                                p,
+                                0,
+                                alpha,
+                                Y,
+                                data_type,
+                                int(ldy),
+                                Y,
+                                data_type,
+                                1,
+                                beta,
+                                Y,
+                                data_type,
+                                int(ldy),
+                                compute_type,
+                                HIPBLAS_GEMM_DEFAULT);
+    }
+    for(int f = 0; f < factors; f++)
+        if(!A[f])
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Stage f multiplies each column, a tensor with the index of n[f] fastest and rest[f] slices
+    // along it, by A_f, leaving rest[f] * m[f] elements with the index of m[f] slowest. The
+    // stages run from the last factor to the first.
+    std::vector<int64_t> rest(factors);
+    int64_t              len = cols, largest = 0;
+    for(int f = factors - 1; f >= 0; f--)
+    {
+        rest[f] = len / n[f];
+        len     = rest[f] * m[f];
+        if(rest[f] > INT_MAX)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(f)
+            largest = std::max(largest, len);
+    }
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The stages between alternate between two buffers of the largest intermediate
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    size_t buffer  = size * largest * p;
+    status         = scratch.allocate(buffer * std::min(factors - 1, 2));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasPointerModeGuard pointer_mode{handle, HIPBLAS_POINTER_MODE_HOST};
+    status = hipblasGetPointerMode(handle, &pointer_mode.mode);
+    if(status == HIPBLAS_STATUS_SUCCESS && factors > 1)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+    static const double zero[2]   = {0, 0};
+    const void*         one       = hipblasKronOne(compute_type);
+    const void*         in        = X;
+    hipblasStride       stride_in = ldx;
+
+    for(int f = factors - 1; f >= 0 && status == HIPBLAS_STATUS_SUCCESS; f--)
+    {
+        bool          last       = !f;
+        void*         out        = last ? Y : scratch.base + buffer * ((factors - 1 - f) % 2);
+        hipblasStride stride_out = last ? ldy : rest[f] * m[f];
+
+        // The caller's scalars, in the caller's pointer mode, go to the stage writing Y
+        if(last && factors > 1)
+            status = hipblasSetPointerMode(handle, pointer_mode.mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGemmStridedBatchedEx_v2(handle,
+                                                    HIPBLAS_OP_T,
+                                                    HIPBLAS_OP_T,
+                                                    int(rest[f]),
+                                                    m[f],
+                                                    n[f],
+                                                    last ? alpha : one,
+                                                    in,
+                                                    data_type,
+                                                    n[f],
+                                                    stride_in,
+                                                    A[f],
+                                                    data_type,
+                                                    lda[f],
+                                                    0,
+                                                    last ? beta : zero,
+                                                    out,
+                                                    data_type,
+                                                    int(rest[f]),
+                                                    stride_out,
+                                                    p,
+                                                    compute_type,
+                                                    HIPBLAS_GEMM_DEFAULT);
+        in        = out;
+        stride_in = stride_out;
+    }
+    return status;
+}
+
+extern "C" hipblasStatus_t hipblasKronGemmEx(hipblasHandle_t      handle,
+                                             int                  factors,
+                                             const int*           m,
+                                             const int*           n,
+                                             const void* const*   A,
+                                             const int*           lda,
+                                             const void*          alpha,
+                                             const void*          X,
+                                             int                  ldx,
+                                             const void*          beta,
+                                             void*                Y,
+                                             int                  ldy,
+                                             int                  p,
+                                             hipDataType          dataType,
+                                             hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  factors,
+                  m,
+                  n,
+                  A,
+                  lda,
+                  alpha,
+                  X,
+                  ldx,
+                  beta,
+                  Y,
+                  ldy,
+                  p,
+                  dataType,
+                  computeType);
+    return hipblasKron(
+        handle, factors, m, n, A, lda, alpha, X, ldx, beta, Y, ldy, p, dataType, computeType);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasKronGemvEx(hipblasHandle_t      handle,
+                                             int                  factors,
+                                             const int*           m,
+                                             const int*           n,
+                                             const void* const*   A,
+                                             const int*           lda,
+                                             const void*          alpha,
+                                             const void*          x,
+                                             int                  incx,
+                                             const void*          beta,
+                                             void*                y,
+                                             int                  incy,
+                                             hipDataType          dataType,
+                                             hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  factors,
+                  m,
+                  n,
+                  A,
+                  lda,
+                  alpha,
+                  x,
+                  incx,
+                  beta,
+                  y,
+                  incy,
+                  dataType,
+                  computeType);
+    // x and y are single columns of X and Y
+    int64_t         rows, cols;
+    hipblasStatus_t status = hipblasKronCheck(handle, factors, m, n, lda, rows, cols);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(incx <= 0 || incy <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t size = hipblasDatatypeFloating(dataType) ? hipblasDatatypeSize(dataType) : 0;
+    if(!size || (incx == 1 && incy == 1) || !rows || !x || !y || !alpha || !beta || !A)
+        return hipblasKron(handle,
+                           factors,
+                           m,
+                           n,
+                           A,
+                           lda,
+                           alpha,
+                           x,
+                           std::max<int64_t>(1, cols),
+                           beta,
+                           y,
+                           std::max<int64_t>(1, rows),
+                           1,
+                           dataType,
+                           computeType);
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // x and y are gathered into contiguous copies, and y is scattered back
+    bool                 gather_x = incx != 1, gather_y = incy != 1;
+    size_t               x_bytes  = gather_x ? size * cols : 0;
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    status         = scratch.allocate(x_bytes + (gather_y ? size * rows : 0));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    const void* xc = gather_x ? scratch.base : x;
+    void*       yc = gather_y ? scratch.base + x_bytes : y;
+    if((gather_x && cols
+        && hipMemcpy2DAsync(
+               scratch.base, size, x, size * incx, size, cols, hipMemcpyDeviceToDevice, stream)
+               != hipSuccess)
+       || (gather_y
+           && hipMemcpy2DAsync(
+                  yc, size, y, size * incy, size, rows, hipMemcpyDeviceToDevice, stream)
+                  != hipSuccess))
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    status = hipblasKron(handle,
+                         factors,
+                         m,
+                         n,
+                         A,
+                         lda,
+                         alpha,
+                         xc,
+                         std::max<int64_t>(1, cols),
+                         beta,
+                         yc,
+                         rows,
+                         1,
+                         dataType,
+                         computeType);
+    if(status == HIPBLAS_STATUS_SUCCESS && gather_y
+       && hipMemcpy2DAsync(y, size * incy, yc, size, size, rows, hipMemcpyDeviceToDevice, stream)
+              != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,818 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "layer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cfloat>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#ifdef HIPBLAS_MARKERS
+#ifdef __HIP_PLATFORM_NVCC__
+#include <nvtx3/nvToolsExt.h>
+#else
+#include <roctracer/roctx.h>
+#endif
+#endif
+
+static int hipblasLayerReadMode()
+{
+    int modes = hipblas_layer_mode_trace | hipblas_layer_mode_bench | hipblas_layer_mode_profile
+                | hipblas_layer_mode_replay | hipblas_layer_mode_histogram
+                | hipblas_layer_mode_summary;
+#ifdef HIPBLAS_MARKERS
+    modes |= hipblas_layer_mode_markers;
+#endif
+
+    const char* env = std::getenv("HIPBLAS_LAYER");
+    return env ? int(std::strtol(env, nullptr, 0)) & modes : hipblas_layer_mode_none;
+}
+
+const int hipblas_layer = hipblasLayerReadMode();
+
+thread_local int hipblas_layer_depth = 0;
+
+struct hipblasLayerEntry
+{
+    std::string trace; // routine(arguments)
+    std::string bench;
+    hipStream_t stream = nullptr;
+    hipEvent_t  start  = nullptr;
+    hipEvent_t  stop   = nullptr;
+    bool        timed  = false;
+
+    // replay mode
+    double      start_us     = 0; // host time since the first recorded call
+    hipStream_t call_stream  = nullptr;
+    bool        host_pointer = true;
+};
+
+// Written only by its thread. Once full, the oldest entries are overwritten.
+struct hipblasLayerRing
+{
+    std::vector<hipblasLayerEntry> entries;
+    std::atomic<size_t>            calls{0}; // the newest call is entries[(calls - 1) % size]
+};
+
+static std::mutex                                     layer_mutex;
+static std::once_flag                                 layer_dump_flag;
+static std::vector<std::shared_ptr<hipblasLayerRing>> layer_rings;
+
+static thread_local std::shared_ptr<hipblasLayerRing> layer_ring;
+
+// Calls of this thread by hipblas-bench command line, for the bench summary
+using hipblasLayerCounts = std::unordered_map<std::string, uint64_t>;
+
+static std::vector<std::shared_ptr<hipblasLayerCounts>> layer_counts;
+static thread_local std::shared_ptr<hipblasLayerCounts> layer_thread_counts;
+
+// Sampling of the histogram mode
+static long hipblasLayerReadLong(const char* name, long fallback)
+{
+    const char* env = std::getenv(name);
+    return env ? std::strtol(env, nullptr, 0) : fallback;
+}
+
+static const long layer_sample_interval
+    = std::max(1L, hipblasLayerReadLong("HIPBLAS_LAYER_SAMPLE_INTERVAL", 1));
+static const bool layer_sample_random = hipblasLayerReadLong("HIPBLAS_LAYER_SAMPLE_RANDOM", 0) != 0;
+static const long layer_histogram_interval
+    = hipblasLayerReadLong("HIPBLAS_LAYER_HISTOGRAM_INTERVAL", 0);
+
+// Timed calls whose events have not completed. Past it, calls are not timed until some complete.
+static constexpr size_t layer_histogram_max_pending = 1024;
+
+// Bucket b counts the times below 2^b microseconds that are not in an earlier bucket, and the
+// last bucket every longer time
+static constexpr int layer_histogram_buckets = 26;
+
+struct hipblasLayerHistogram
+{
+    uint64_t count                            = 0;
+    double   sum_us                           = 0;
+    double   min_us                           = DBL_MAX;
+    double   max_us                           = 0;
+    uint64_t buckets[layer_histogram_buckets] = {};
+};
+
+struct hipblasLayerSample
+{
+    std::string shape; // routine(sizes)
+    hipEvent_t  start = nullptr;
+    hipEvent_t  stop  = nullptr;
+};
+
+static std::mutex                                     layer_histogram_mutex;
+static std::map<std::string, hipblasLayerHistogram>   layer_histograms;
+static std::vector<hipblasLayerSample>                layer_samples; // waiting for their events
+static std::vector<std::pair<hipEvent_t, hipEvent_t>> layer_sample_events; // not recorded
+static std::chrono::steady_clock::time_point          layer_histogram_written
+    = std::chrono::steady_clock::now();
+
+// The call timed on this thread and its stream
+static thread_local hipblasLayerSample layer_sample;
+static thread_local hipStream_t        layer_sample_stream = nullptr;
+
+std::string hipblasLayerFormat(double value)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.8g", value);
+    return buf;
+}
+
+std::string hipblasLayerFormat(const void* value)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%p", value);
+    return buf;
+}
+
+// hipblas-bench names of the data types
+std::string hipblasLayerFormat(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_16F:
+        return "f16_r";
+    case HIP_R_16BF:
+        return "bf16_r";
+    case HIP_R_32F:
+        return "f32_r";
+    case HIP_R_64F:
+        return "f64_r";
+    case HIP_C_32F:
+        return "f32_c";
+    case HIP_C_64F:
+        return "f64_c";
+    case HIP_R_8I:
+        return "i8_r";
+    case HIP_R_32I:
+        return "i32_r";
+    default:
+        return std::to_string(int(type));
+    }
+}
+
+std::string hipblasLayerFormat(hipblasComputeType_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        return "f16_r";
+    case HIPBLAS_COMPUTE_32F:
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+    case HIPBLAS_COMPUTE_32F_FAST_16BFX3:
+        return "f32_r";
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        return "f64_r";
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        return "i32_r";
+    default:
+        return std::to_string(int(type));
+    }
+}
+
+std::string hipblasLayerComputeName(hipblasComputeType_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+        return "16f";
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        return "16f_pedantic";
+    case HIPBLAS_COMPUTE_32F:
+        return "32f";
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+        return "32f_pedantic";
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+        return "32f_fast_16f";
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+        return "32f_fast_16Bf";
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+        return "32f_fast_tf32";
+    case HIPBLAS_COMPUTE_32F_FAST_16BFX3:
+        return "32f_fast_16bfx3";
+    case HIPBLAS_COMPUTE_64F:
+        return "64f";
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        return "64f_pedantic";
+    case HIPBLAS_COMPUTE_32I:
+        return "32i";
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        return "32i_pedantic";
+    default:
+        return std::to_string(int(type));
+    }
+}
+
+std::vector<std::string> hipblasLayerNames(const char* names)
+{
+    std::vector<std::string> out(1);
+    for(const char* c = names; *c; c++)
+    {
+        if(*c == ',')
+            out.emplace_back();
+        else if(!std::isspace((unsigned char)*c))
+            out.back() += *c;
+    }
+    return out;
+}
+
+bool hipblasLayerHostScalars(hipblasHandle_t handle)
+{
+    hipblasPointerMode_t mode;
+    return handle && hipblasGetPointerMode(handle, &mode) == HIPBLAS_STATUS_SUCCESS
+           && mode == HIPBLAS_POINTER_MODE_HOST;
+}
+
+#ifdef HIPBLAS_MARKERS
+std::string hipblasLayerMarkerName(const char*                           func,
+                                   const std::vector<std::string>&       names,
+                                   const std::vector<hipblasLayerValue>& values)
+{
+    std::string name = func;
+    bool        first = true;
+    for(size_t i = 1; i < names.size(); i++)
+    {
+        const std::string& arg = names[i];
+        if(arg != "m" && arg != "n" && arg != "k" && arg != "batchCount" && arg != "batch_count"
+           && arg != "groupCount" && arg != "group_count")
+            continue;
+
+        name += first ? "(" : ", ";
+        name += arg + "=" + values[i - 1].value;
+        first = false;
+    }
+    if(!first)
+        name += ')';
+    return name;
+}
+
+void hipblasMarkerPush(const char* name)
+{
+#ifdef __HIP_PLATFORM_NVCC__
+    nvtxRangePushA(name);
+#else
+    roctxRangePushA(name);
+#endif
+}
+
+void hipblasMarkerPop()
+{
+#ifdef __HIP_PLATFORM_NVCC__
+    nvtxRangePop();
+#else
+    roctxRangePop();
+#endif
+}
+#endif
+
+// hipblas-bench -f and -r values of a routine, e.g. "gemm_strided_batched" and "f32_r" for
+// hipblasSgemmStridedBatched. The precision is empty for routines without a precision letter.
+void hipblasLayerBenchFunction(const char* func, std::string& function, std::string& precision)
+{
+    std::string name = func + std::strlen("hipblas");
+    for(const char* suffix : {"_64", "_v2"})
+    {
+        size_t len = std::strlen(suffix);
+        if(name.size() > len && !name.compare(name.size() - len, len, suffix))
+            name.resize(name.size() - len);
+    }
+
+    // Ex routines take their types as arguments, so hipblasDotEx is not a D precision of otEx
+    bool ex = name.size() > 2 && !name.compare(name.size() - 2, 2, "Ex");
+
+    const char* letters = "SDCZH";
+    const char* types[] = {"f32_r", "f64_r", "f32_c", "f64_c", "f16_r"};
+    size_t      start   = 0;
+    if(!ex && name.size() > 2 && name[0] == 'I' && std::islower(name[2])
+       && std::strchr(letters, std::toupper(name[1])))
+        start = 1;
+    if(!ex && name.size() > start + 1 && std::islower(name[start + 1])
+       && std::strchr(letters, std::toupper(name[start])))
+    {
+        precision = types[std::strchr(letters, std::toupper(name[start])) - letters];
+        start++;
+    }
+
+    function.clear();
+    for(size_t i = start; i < name.size(); i++)
+    {
+        if(std::isupper(name[i]))
+        {
+            if(!function.empty())
+                function += '_';
+            function += char(std::tolower(name[i]));
+        }
+        else
+            function += name[i];
+    }
+}
+
+// hipblas-bench option for an argument, or nullptr. Names are compared in lower case without
+// underscores, so lda, strideA and stride_A are all found.
+static const char* hipblasLayerBenchOption(const std::string& name)
+{
+    static const std::unordered_map<std::string, const char*> options = {
+        {"m", "-m"},
+        {"n", "-n"},
+        {"k", "-k"},
+        {"kl", "--kl"},
+        {"ku", "--ku"},
+        {"lda", "--lda"},
+        {"ldb", "--ldb"},
+        {"ldc", "--ldc"},
+        {"incx", "--incx"},
+        {"incy", "--incy"},
+        {"alpha", "--alpha"},
+        {"beta", "--beta"},
+        {"trans", "--transposeA"},
+        {"transa", "--transposeA"},
+        {"transb", "--transposeB"},
+        {"side", "--side"},
+        {"uplo", "--uplo"},
+        {"diag", "--diag"},
+        {"batchcount", "--batch_count"},
+        {"stridea", "--stride_a"},
+        {"strideb", "--stride_b"},
+        {"stridec", "--stride_c"},
+        {"stridex", "--stride_x"},
+        {"stridey", "--stride_y"},
+        {"atype", "--a_type"},
+        {"btype", "--b_type"},
+        {"ctype", "--c_type"},
+        {"computetype", "--compute_type"},
+        {"algo", "--algo"},
+        {"solutionindex", "--solution_index"},
+        {"flags", "--flags"},
+    };
+
+    std::string key;
+    for(char c : name)
+        if(c != '_')
+            key += char(std::tolower(c));
+
+    auto option = options.find(key);
+    return option == options.end() ? nullptr : option->second;
+}
+
+static std::string hipblasLayerBench(const char*                           func,
+                                     const std::vector<std::string>&       names,
+                                     const std::vector<hipblasLayerValue>& values)
+{
+    // Only calls with a problem size can be reproduced; this leaves out the handle setup
+    bool sized = false;
+    for(size_t i = 1; i < names.size(); i++)
+        sized = sized || names[i] == "m" || names[i] == "n";
+    if(!sized || !std::strncmp(func, "hipblasSet", 10) || !std::strncmp(func, "hipblasGet", 10))
+        return "";
+
+    std::string function, precision;
+    hipblasLayerBenchFunction(func, function, precision);
+
+    std::string bench = "./hipblas-bench -f " + function;
+    if(!precision.empty())
+        bench += " -r " + precision;
+
+    for(size_t i = 1; i < names.size(); i++)
+    {
+        const char*              option = hipblasLayerBenchOption(names[i]);
+        const hipblasLayerValue& value  = values[i - 1];
+        if(!option || value.bench.empty())
+            continue;
+
+        bench += std::string(" ") + option + " " + value.bench;
+        if(!value.imag.empty())
+            bench += std::string(" ") + option + "i " + value.imag;
+        // The compute type of gemm_ex built with HIPBLAS_V2, which f32_r alone does not tell
+        if(!value.compute.empty())
+            bench += " --compute_type_gemm " + value.compute;
+    }
+    return bench;
+}
+
+// Adds the samples whose events completed to their histograms, waiting for them all when wait
+// is set. layer_histogram_mutex is held.
+static void hipblasLayerHistogramCollect(bool wait)
+{
+    size_t kept = 0;
+    for(hipblasLayerSample& sample : layer_samples)
+    {
+        if(wait)
+            (void)hipEventSynchronize(sample.stop);
+
+        hipError_t status = hipEventQuery(sample.stop);
+        if(status == hipErrorNotReady)
+        {
+            std::swap(layer_samples[kept++], sample);
+            continue;
+        }
+
+        float ms = 0;
+        if(status == hipSuccess
+           && hipEventElapsedTime(&ms, sample.start, sample.stop) == hipSuccess)
+        {
+            hipblasLayerHistogram& histogram = layer_histograms[sample.shape];
+            double                 us        = ms * 1000.0;
+            int                    bucket    = 0;
+            while(bucket < layer_histogram_buckets - 1 && us >= double(int64_t(1) << bucket))
+                bucket++;
+
+            histogram.count++;
+            histogram.sum_us += us;
+            histogram.min_us = std::min(histogram.min_us, us);
+            histogram.max_us = std::max(histogram.max_us, us);
+            histogram.buckets[bucket]++;
+        }
+        layer_sample_events.emplace_back(sample.start, sample.stop);
+    }
+    layer_samples.resize(kept);
+}
+
+// Upper bound of the bucket holding the given fraction of the times, at most the longest time
+static double hipblasLayerHistogramQuantile(const hipblasLayerHistogram& histogram, double q)
+{
+    uint64_t rank = uint64_t(q * double(histogram.count - 1)) + 1;
+    uint64_t seen = 0;
+    for(int b = 0; b < layer_histogram_buckets - 1; b++)
+    {
+        seen += histogram.buckets[b];
+        if(seen >= rank)
+            return std::min(double(int64_t(1) << b), histogram.max_us);
+    }
+    return histogram.max_us;
+}
+
+// Writes every histogram to HIPBLAS_LAYER_HISTOGRAM_PATH, replacing what it held, or to out.
+// layer_histogram_mutex is held.
+static void hipblasLayerHistogramWrite(FILE* out)
+{
+    const char* path = std::getenv("HIPBLAS_LAYER_HISTOGRAM_PATH");
+    FILE*       file = path ? std::fopen(path, "w") : nullptr;
+    if(file)
+        out = file;
+
+    for(const auto& shape : layer_histograms)
+    {
+        const hipblasLayerHistogram& histogram = shape.second;
+
+        std::string buckets;
+        for(int b = 0; b < layer_histogram_buckets; b++)
+        {
+            if(!histogram.buckets[b])
+                continue;
+            if(!buckets.empty())
+                buckets += ',';
+            buckets += b < layer_histogram_buckets - 1 ? std::to_string(int64_t(1) << b) : "inf";
+            buckets += ':' + std::to_string(histogram.buckets[b]);
+        }
+
+        std::fprintf(out,
+                     "hipblas histogram: %s count=%llu mean_us=%.3f min_us=%.3f max_us=%.3f "
+                     "p50_us=%.3f p90_us=%.3f p99_us=%.3f buckets_us=%s\n",
+                     shape.first.c_str(),
+                     (unsigned long long)histogram.count,
+                     histogram.sum_us / double(histogram.count),
+                     histogram.min_us,
+                     histogram.max_us,
+                     hipblasLayerHistogramQuantile(histogram, 0.5),
+                     hipblasLayerHistogramQuantile(histogram, 0.9),
+                     hipblasLayerHistogramQuantile(histogram, 0.99),
+                     buckets.c_str());
+    }
+
+    if(file)
+        std::fclose(file);
+    else
+        std::fflush(out);
+}
+
+// Write every recorded call, oldest first, to HIPBLAS_LOG_PATH or stderr
+static void hipblasLayerDump()
+{
+    std::lock_guard<std::mutex> lock(layer_mutex);
+
+    const char* path = std::getenv("HIPBLAS_LOG_PATH");
+    FILE*       out  = path ? std::fopen(path, "w") : nullptr;
+    if(!out)
+        out = stderr;
+
+    for(size_t t = 0; t < layer_rings.size(); t++)
+    {
+        hipblasLayerRing& ring  = *layer_rings[t];
+        size_t            calls = ring.calls.load();
+        size_t            size  = ring.entries.size();
+        size_t            first = calls > size ? calls - size : 0;
+
+        if(first)
+            std::fprintf(out, "hipblas layer: thread %zu dropped %zu calls\n", t, first);
+
+        for(size_t c = first; c < calls; c++)
+        {
+            hipblasLayerEntry& entry = ring.entries[c % size];
+            if(hipblas_layer & hipblas_layer_mode_trace)
+                std::fprintf(out, "%s\n", entry.trace.c_str());
+            if((hipblas_layer & hipblas_layer_mode_bench) && !entry.bench.empty())
+                std::fprintf(out, "%s\n", entry.bench.c_str());
+            if((hipblas_layer & hipblas_layer_mode_replay) && !entry.bench.empty())
+                std::fprintf(out,
+                             "hipblas replay: start_us=%.3f thread=%zu stream=%p pointer_mode=%s "
+                             "%s\n",
+                             entry.start_us,
+                             t,
+                             (void*)entry.call_stream,
+                             entry.host_pointer ? "host" : "device",
+                             entry.bench.c_str());
+
+            float ms = 0;
+            if((hipblas_layer & hipblas_layer_mode_profile) && entry.timed
+               && hipEventSynchronize(entry.stop) == hipSuccess
+               && hipEventElapsedTime(&ms, entry.start, entry.stop) == hipSuccess)
+                std::fprintf(out, "%s time_us=%.3f\n", entry.trace.c_str(), ms * 1000.0);
+        }
+
+        for(hipblasLayerEntry& entry : ring.entries)
+        {
+            if(entry.start)
+                (void)hipEventDestroy(entry.start);
+            if(entry.stop)
+                (void)hipEventDestroy(entry.stop);
+            entry.start = entry.stop = nullptr;
+            entry.timed              = false;
+        }
+    }
+
+    if(hipblas_layer & hipblas_layer_mode_summary)
+    {
+        hipblasLayerCounts counts;
+        for(const auto& thread_counts : layer_counts)
+            for(const auto& command : *thread_counts)
+                counts[command.first] += command.second;
+
+        std::vector<std::pair<std::string, uint64_t>> commands(counts.begin(), counts.end());
+        std::sort(commands.begin(), commands.end(), [](const auto& a, const auto& b) {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        });
+        for(const auto& command : commands)
+            std::fprintf(out,
+                         "hipblas bench: count=%llu %s\n",
+                         (unsigned long long)command.second,
+                         command.first.c_str());
+    }
+
+    if(hipblas_layer & hipblas_layer_mode_histogram)
+    {
+        std::lock_guard<std::mutex> histogram_lock(layer_histogram_mutex);
+
+        hipblasLayerHistogramCollect(true);
+        hipblasLayerHistogramWrite(out);
+        for(auto& events : layer_sample_events)
+        {
+            (void)hipEventDestroy(events.first);
+            (void)hipEventDestroy(events.second);
+        }
+        layer_sample_events.clear();
+    }
+
+    if(out != stderr)
+        std::fclose(out);
+}
+
+// Registered after the first HIP call of the process, so it runs before HIP is torn down
+static void hipblasLayerRegisterDump()
+{
+    std::call_once(layer_dump_flag, [] { std::atexit(hipblasLayerDump); });
+}
+
+static hipblasLayerRing& hipblasLayerThreadRing()
+{
+    if(!layer_ring)
+    {
+        const char* env  = std::getenv("HIPBLAS_LAYER_BUFFER_SIZE");
+        long        size = env ? std::strtol(env, nullptr, 0) : 0;
+
+        layer_ring = std::make_shared<hipblasLayerRing>();
+        layer_ring->entries.resize(size > 0 ? size_t(size) : 4096);
+
+        std::lock_guard<std::mutex> lock(layer_mutex);
+        layer_rings.push_back(layer_ring);
+        hipblasLayerRegisterDump();
+    }
+    return *layer_ring;
+}
+
+hipblasLayerEntry* hipblasLayerBegin(hipblasHandle_t                       handle,
+                                     const char*                           func,
+                                     const std::vector<std::string>&       names,
+                                     const std::vector<hipblasLayerValue>& values)
+{
+    hipblasLayerRing&  ring  = hipblasLayerThreadRing();
+    size_t             call  = ring.calls.load(std::memory_order_relaxed);
+    hipblasLayerEntry& entry = ring.entries[call % ring.entries.size()];
+
+    entry.trace = func;
+    entry.trace += '(';
+    if(handle)
+        entry.trace += "handle=" + hipblasLayerFormat((const void*)handle);
+    for(size_t i = 1; i < names.size(); i++)
+    {
+        if(handle || i > 1)
+            entry.trace += ", ";
+        entry.trace += names[i] + "=" + values[i - 1].value;
+    }
+    entry.trace += ')';
+
+    entry.bench.clear();
+    if(hipblas_layer & (hipblas_layer_mode_bench | hipblas_layer_mode_replay))
+        entry.bench = hipblasLayerBench(func, names, values);
+
+    if(hipblas_layer & hipblas_layer_mode_replay)
+    {
+        static const auto origin = std::chrono::steady_clock::now();
+        entry.start_us
+            = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - origin)
+                  .count();
+        entry.call_stream  = nullptr;
+        entry.host_pointer = hipblasLayerHostScalars(handle);
+        if(handle)
+            (void)hipblasGetStream(handle, &entry.call_stream);
+    }
+
+    // Events are created once per entry and reused when the ring wraps. Nothing is timed while
+    // the stream is captured, as the events would become part of the graph.
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    entry.timed                           = false;
+    if((hipblas_layer & hipblas_layer_mode_profile) && handle
+       && hipblasGetStream(handle, &entry.stream) == HIPBLAS_STATUS_SUCCESS
+       && hipStreamIsCapturing(entry.stream, &capture_status) == hipSuccess
+       && capture_status == hipStreamCaptureStatusNone
+       && (entry.start || hipEventCreate(&entry.start) == hipSuccess)
+       && (entry.stop || hipEventCreate(&entry.stop) == hipSuccess))
+        entry.timed = hipEventRecord(entry.start, entry.stream) == hipSuccess;
+
+    ring.calls.store(call + 1, std::memory_order_release);
+    return &entry;
+}
+
+void hipblasLayerEnd(hipblasLayerEntry* entry)
+{
+    if(entry->timed)
+        entry->timed = hipEventRecord(entry->stop, entry->stream) == hipSuccess;
+}
+
+bool hipblasLayerSampled(const char* func)
+{
+    if(layer_sample_interval == 1)
+        return true;
+
+    if(layer_sample_random)
+    {
+        // xorshift64*, seeded per thread
+        static thread_local uint64_t state
+            = std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return (state * 0x2545F4914F6CDD1Dull >> 32) % uint64_t(layer_sample_interval) == 0;
+    }
+
+    static thread_local std::unordered_map<const char*, uint64_t> calls;
+    return calls[func]++ % uint64_t(layer_sample_interval) == 0;
+}
+
+bool hipblasLayerHistogramBegin(hipblasHandle_t                       handle,
+                                const char*                           func,
+                                const std::vector<std::string>&       names,
+                                const std::vector<hipblasLayerValue>& values)
+{
+    // Nothing is timed while the stream is captured, as the events would become part of the graph
+    hipStream_t            stream         = nullptr;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(!handle || hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return false;
+
+    // The shape is made of the arguments hipblas-bench takes, other than the scalars
+    std::string shape = func;
+    shape += '(';
+    for(size_t i = 1; i < names.size(); i++)
+    {
+        if(!hipblasLayerBenchOption(names[i]) || names[i] == "alpha" || names[i] == "beta")
+            continue;
+        if(shape.back() != '(')
+            shape += ", ";
+        shape += names[i] + "=" + values[i - 1].value;
+    }
+    shape += ')';
+
+    {
+        std::lock_guard<std::mutex> lock(layer_histogram_mutex);
+
+        hipblasLayerHistogramCollect(false);
+        if(layer_histogram_interval > 0)
+        {
+            auto now = std::chrono::steady_clock::now();
+            if(now - layer_histogram_written >= std::chrono::seconds(layer_histogram_interval))
+            {
+                hipblasLayerHistogramWrite(stderr);
+                layer_histogram_written = now;
+            }
+        }
+
+        if(layer_samples.size() >= layer_histogram_max_pending)
+            return false;
+
+        // Events are created once and reused
+        if(layer_sample_events.empty())
+        {
+            hipEvent_t start, stop;
+            if(hipEventCreate(&start) != hipSuccess)
+                return false;
+            if(hipEventCreate(&stop) != hipSuccess)
+            {
+                (void)hipEventDestroy(start);
+                return false;
+            }
+            layer_sample_events.emplace_back(start, stop);
+        }
+
+        layer_sample.start = layer_sample_events.back().first;
+        layer_sample.stop  = layer_sample_events.back().second;
+        layer_sample_events.pop_back();
+    }
+    hipblasLayerRegisterDump();
+
+    layer_sample.shape  = std::move(shape);
+    layer_sample_stream = stream;
+    if(hipEventRecord(layer_sample.start, stream) == hipSuccess)
+        return true;
+
+    std::lock_guard<std::mutex> lock(layer_histogram_mutex);
+    layer_sample_events.emplace_back(layer_sample.start, layer_sample.stop);
+    return false;
+}
+
+void hipblasLayerHistogramEnd()
+{
+    bool recorded = hipEventRecord(layer_sample.stop, layer_sample_stream) == hipSuccess;
+
+    std::lock_guard<std::mutex> lock(layer_histogram_mutex);
+    if(recorded)
+        layer_samples.push_back(std::move(layer_sample));
+    else
+        layer_sample_events.emplace_back(layer_sample.start, layer_sample.stop);
+}
+
+void hipblasLayerCount(const char*                           func,
+                       const std::vector<std::string>&       names,
+                       const std::vector<hipblasLayerValue>& values)
+{
+    std::string bench = hipblasLayerBench(func, names, values);
+    if(bench.empty())
+        return;
+
+    if(!layer_thread_counts)
+    {
+        layer_thread_counts = std::make_shared<hipblasLayerCounts>();
+
+        std::lock_guard<std::mutex> lock(layer_mutex);
+        layer_counts.push_back(layer_thread_counts);
+        hipblasLayerRegisterDump();
+    }
+    (*layer_thread_counts)[bench]++;
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "layout.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "shared_handle.hpp"
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+
+thread_local int  hipblas_layout_depth     = 0;
+thread_local bool hipblas_layout_row_major = false;
+
+// The row-major handles. layout_handles counts them, so calls on column-major handles skip the
+// lock while no handle is row-major.
+static std::mutex                          layout_mutex;
+static std::unordered_set<hipblasHandle_t> layout_row_major;
+static std::atomic<int>                    layout_handles{0};
+
+hipblasLayout_t hipblasLayoutGet(hipblasHandle_t handle)
+{
+    if(!layout_handles.load(std::memory_order_relaxed))
+        return HIPBLAS_COL_MAJOR;
+
+    std::lock_guard<std::mutex> lock(layout_mutex);
+    return layout_row_major.count(handle) ? HIPBLAS_ROW_MAJOR : HIPBLAS_COL_MAJOR;
+}
+
+void hipblasLayoutErase(hipblasHandle_t handle)
+{
+    if(!layout_handles.load(std::memory_order_relaxed))
+        return;
+
+    std::lock_guard<std::mutex> lock(layout_mutex);
+    layout_handles -= int(layout_row_major.erase(handle));
+}
+
+extern "C" hipblasStatus_t hipblasSetLayout(hipblasHandle_t handle, hipblasLayout_t layout)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, layout);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(layout != HIPBLAS_COL_MAJOR && layout != HIPBLAS_ROW_MAJOR)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    std::lock_guard<std::mutex> lock(layout_mutex);
+    if(layout == HIPBLAS_ROW_MAJOR)
+        layout_handles += int(layout_row_major.insert(handle).second);
+    else
+        layout_handles -= int(layout_row_major.erase(handle));
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetLayout(hipblasHandle_t handle, hipblasLayout_t* layout)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, layout);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!layout)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *layout = hipblasLayoutGet(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
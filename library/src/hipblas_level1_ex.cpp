@@ -0,0 +1,1059 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "level1_ex.hpp"
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// hipBLAS functions of each precision run by the Level-1 ex functions for the types of the
+// hipblasX functions, with Tr and resultType the type of the asum result. nrm2Strided and scal
+// are only run for the real types.
+template <typename T>
+struct hipblasLevel1ExFunctions;
+
+template <>
+struct hipblasLevel1ExFunctions<float>
+{
+    using Tr = float;
+
+    static constexpr hipDataType resultType   = HIP_R_32F;
+    static constexpr auto        copy         = hipblasScopy;
+    static constexpr auto        copyBatched  = hipblasScopyBatched;
+    static constexpr auto        copyStrided  = hipblasScopyStridedBatched;
+    static constexpr auto        swap         = hipblasSswap;
+    static constexpr auto        swapBatched  = hipblasSswapBatched;
+    static constexpr auto        swapStrided  = hipblasSswapStridedBatched;
+    static constexpr auto        asum         = hipblasSasum;
+    static constexpr auto        asumBatched  = hipblasSasumBatched;
+    static constexpr auto        asumStrided  = hipblasSasumStridedBatched;
+    static constexpr auto        iamax        = hipblasIsamax;
+    static constexpr auto        iamaxBatched = hipblasIsamaxBatched;
+    static constexpr auto        iamaxStrided = hipblasIsamaxStridedBatched;
+    static constexpr auto        iamin        = hipblasIsamin;
+    static constexpr auto        iaminBatched = hipblasIsaminBatched;
+    static constexpr auto        iaminStrided = hipblasIsaminStridedBatched;
+    static constexpr auto        nrm2Strided  = hipblasSnrm2StridedBatched;
+    static constexpr auto        scal         = hipblasSscal;
+};
+
+template <>
+struct hipblasLevel1ExFunctions<double>
+{
+    using Tr = double;
+
+    static constexpr hipDataType resultType   = HIP_R_64F;
+    static constexpr auto        copy         = hipblasDcopy;
+    static constexpr auto        copyBatched  = hipblasDcopyBatched;
+    static constexpr auto        copyStrided  = hipblasDcopyStridedBatched;
+    static constexpr auto        swap         = hipblasDswap;
+    static constexpr auto        swapBatched  = hipblasDswapBatched;
+    static constexpr auto        swapStrided  = hipblasDswapStridedBatched;
+    static constexpr auto        asum         = hipblasDasum;
+    static constexpr auto        asumBatched  = hipblasDasumBatched;
+    static constexpr auto        asumStrided  = hipblasDasumStridedBatched;
+    static constexpr auto        iamax        = hipblasIdamax;
+    static constexpr auto        iamaxBatched = hipblasIdamaxBatched;
+    static constexpr auto        iamaxStrided = hipblasIdamaxStridedBatched;
+    static constexpr auto        iamin        = hipblasIdamin;
+    static constexpr auto        iaminBatched = hipblasIdaminBatched;
+    static constexpr auto        iaminStrided = hipblasIdaminStridedBatched;
+    static constexpr auto        nrm2Strided  = hipblasDnrm2StridedBatched;
+    static constexpr auto        scal         = hipblasDscal;
+};
+
+template <>
+struct hipblasLevel1ExFunctions<hipblasComplex>
+{
+    using Tr = float;
+
+    static constexpr hipDataType resultType   = HIP_R_32F;
+    static constexpr auto        copy         = hipblasCcopy;
+    static constexpr auto        copyBatched  = hipblasCcopyBatched;
+    static constexpr auto        copyStrided  = hipblasCcopyStridedBatched;
+    static constexpr auto        swap         = hipblasCswap;
+    static constexpr auto        swapBatched  = hipblasCswapBatched;
+    static constexpr auto        swapStrided  = hipblasCswapStridedBatched;
+    static constexpr auto        asum         = hipblasScasum;
+    static constexpr auto        asumBatched  = hipblasScasumBatched;
+    static constexpr auto        asumStrided  = hipblasScasumStridedBatched;
+    static constexpr auto        iamax        = hipblasIcamax;
+    static constexpr auto        iamaxBatched = hipblasIcamaxBatched;
+    static constexpr auto        iamaxStrided = hipblasIcamaxStridedBatched;
+    static constexpr auto        iamin        = hipblasIcamin;
+    static constexpr auto        iaminBatched = hipblasIcaminBatched;
+    static constexpr auto        iaminStrided = hipblasIcaminStridedBatched;
+};
+
+template <>
+struct hipblasLevel1ExFunctions<hipblasDoubleComplex>
+{
+    using Tr = double;
+
+    static constexpr hipDataType resultType   = HIP_R_64F;
+    static constexpr auto        copy         = hipblasZcopy;
+    static constexpr auto        copyBatched  = hipblasZcopyBatched;
+    static constexpr auto        copyStrided  = hipblasZcopyStridedBatched;
+    static constexpr auto        swap         = hipblasZswap;
+    static constexpr auto        swapBatched  = hipblasZswapBatched;
+    static constexpr auto        swapStrided  = hipblasZswapStridedBatched;
+    static constexpr auto        asum         = hipblasDzasum;
+    static constexpr auto        asumBatched  = hipblasDzasumBatched;
+    static constexpr auto        asumStrided  = hipblasDzasumStridedBatched;
+    static constexpr auto        iamax        = hipblasIzamax;
+    static constexpr auto        iamaxBatched = hipblasIzamaxBatched;
+    static constexpr auto        iamaxStrided = hipblasIzamaxStridedBatched;
+    static constexpr auto        iamin        = hipblasIzamin;
+    static constexpr auto        iaminBatched = hipblasIzaminBatched;
+    static constexpr auto        iaminStrided = hipblasIzaminStridedBatched;
+};
+
+// Calls f with a value of the hipBLAS type of HIP_R_32F, HIP_R_64F, HIP_C_32F or HIP_C_64F
+template <typename F>
+static hipblasStatus_t hipblasLevel1ExType(hipDataType type, F f)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+        return f(float());
+    case HIP_R_64F:
+        return f(double());
+    case HIP_C_32F:
+        return f(hipblasComplex());
+    case HIP_C_64F:
+        return f(hipblasDoubleComplex());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static bool hipblasLevel1ExIsHalf(hipDataType type)
+{
+    return type == HIP_R_16F || type == HIP_R_16BF;
+}
+
+// Copies x to y, or swaps them, in the three forms, where x_array and y_array are the pointer
+// arrays of the batched form and null otherwise. fp16 and bf16 run the Level-1 ex kernels, and
+// without them contiguous copies of the non-batched and strided forms run as asynchronous copies.
+static hipblasStatus_t hipblasCopySwapEx(hipblasHandle_t    handle,
+                                         bool               swap,
+                                         int                n,
+                                         const void*        x,
+                                         const void* const* x_array,
+                                         hipDataType        xType,
+                                         int                incx,
+                                         hipblasStride      stridex,
+                                         void*              y,
+                                         void* const*       y_array,
+                                         hipDataType        yType,
+                                         int                incy,
+                                         hipblasStride      stridey,
+                                         int                batchCount,
+                                         bool               strided)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(xType != yType)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(!hipblasLevel1ExIsHalf(xType))
+        return hipblasLevel1ExType(xType, [&](auto element) {
+            using T = decltype(element);
+            using F = hipblasLevel1ExFunctions<T>;
+
+            T*        xs  = (T*)x;
+            T*        ys  = (T*)y;
+            T* const* xsa = (T* const*)x_array;
+            T* const* ysa = (T* const*)y_array;
+            if(x_array || y_array)
+            {
+                if(swap)
+                    return F::swapBatched(handle, n, xsa, incx, ysa, incy, batchCount);
+                return F::copyBatched(handle, n, xsa, incx, ysa, incy, batchCount);
+            }
+            if(strided)
+            {
+                if(swap)
+                    return F::swapStrided(
+                        handle, n, xs, incx, stridex, ys, incy, stridey, batchCount);
+                return F::copyStrided(handle, n, xs, incx, stridex, ys, incy, stridey, batchCount);
+            }
+            if(swap)
+                return F::swap(handle, n, xs, incx, ys, incy);
+            return F::copy(handle, n, xs, incx, ys, incy);
+        });
+
+    if(batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n <= 0 || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    bool batched = x_array || y_array;
+    if(batched ? !x_array || !y_array : !x || !y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_LEVEL1_EX
+    return hipblasLevel1ExCopyKernels(handle,
+                                      swap,
+                                      n,
+                                      x,
+                                      x_array,
+                                      incx,
+                                      stridex,
+                                      y,
+                                      y_array,
+                                      incy,
+                                      stridey,
+                                      batchCount);
+#else
+    if(swap || batched || incx != 1 || incy != 1)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(batchCount > 1 && (stridex < n || stridey < n))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // One copy of batchCount rows of n elements, stridex and stridey apart
+    size_t     width   = sizeof(uint16_t) * n;
+    size_t     pitch_x = batchCount == 1 ? width : sizeof(uint16_t) * stridex;
+    size_t     pitch_y = batchCount == 1 ? width : sizeof(uint16_t) * stridey;
+    hipError_t error   = hipMemcpy2DAsync(
+        y, pitch_y, x, pitch_x, width, batchCount, hipMemcpyDeviceToDevice, stream);
+    return error == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+#endif
+}
+
+// asum in the three forms, as hipblasCopySwapEx
+static hipblasStatus_t hipblasAsumExTemplate(hipblasHandle_t    handle,
+                                             int                n,
+                                             const void*        x,
+                                             const void* const* x_array,
+                                             hipDataType        xType,
+                                             int                incx,
+                                             hipblasStride      stridex,
+                                             int                batchCount,
+                                             void*              result,
+                                             hipDataType        resultType,
+                                             hipDataType        executionType,
+                                             bool               strided)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    if(!hipblasLevel1ExIsHalf(xType))
+        return hipblasLevel1ExType(xType, [&](auto element) {
+            using T  = decltype(element);
+            using F  = hipblasLevel1ExFunctions<T>;
+            using Tr = typename F::Tr;
+
+            if(resultType != F::resultType || executionType != F::resultType)
+                return HIPBLAS_STATUS_NOT_SUPPORTED;
+            if(x_array)
+                return F::asumBatched(
+                    handle, n, (const T* const*)x_array, incx, batchCount, (Tr*)result);
+            if(strided)
+                return F::asumStrided(
+                    handle, n, (const T*)x, incx, stridex, batchCount, (Tr*)result);
+            return F::asum(handle, n, (const T*)x, incx, (Tr*)result);
+        });
+
+    if(executionType != HIP_R_32F || (resultType != xType && resultType != HIP_R_32F))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!result)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_LEVEL1_EX
+    return hipblasLevel1ExAsumKernels(
+        handle, n, x, x_array, xType, incx, stridex, batchCount, result, resultType);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// iamax, or iamin when amin is set, in the three forms, as hipblasCopySwapEx
+static hipblasStatus_t hipblasIamaxExTemplate(hipblasHandle_t    handle,
+                                              bool               amin,
+                                              int                n,
+                                              const void*        x,
+                                              const void* const* x_array,
+                                              hipDataType        xType,
+                                              int                incx,
+                                              hipblasStride      stridex,
+                                              int                batchCount,
+                                              int*               result,
+                                              bool               strided)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    if(!hipblasLevel1ExIsHalf(xType))
+        return hipblasLevel1ExType(xType, [&](auto element) {
+            using T = decltype(element);
+            using F = hipblasLevel1ExFunctions<T>;
+
+            const T*        xs  = (const T*)x;
+            const T* const* xsa = (const T* const*)x_array;
+            if(x_array)
+                return (amin ? F::iaminBatched : F::iamaxBatched)(
+                    handle, n, xsa, incx, batchCount, result);
+            if(strided)
+                return (amin ? F::iaminStrided : F::iamaxStrided)(
+                    handle, n, xs, incx, stridex, batchCount, result);
+            return (amin ? F::iamin : F::iamax)(handle, n, xs, incx, result);
+        });
+
+    if(batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!result)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_LEVEL1_EX
+    return hipblasLevel1ExIamaxKernels(
+        handle, amin, n, x, x_array, xType, incx, stridex, batchCount, result);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// iamax or iamin of the strided form of the Value functions in host pointer mode without the
+// Level-1 ex kernels, followed by one copy of each selected element once the indices are back
+template <typename T>
+static hipblasStatus_t hipblasIamaxValueExTyped(hipblasHandle_t handle,
+                                                bool            amin,
+                                                int             n,
+                                                const T*        x,
+                                                int             incx,
+                                                hipblasStride   stridex,
+                                                int             batchCount,
+                                                int*            result,
+                                                T*              value,
+                                                bool            absolute)
+{
+    using F = hipblasLevel1ExFunctions<T>;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = (amin ? F::iaminStrided : F::iamaxStrided)(
+            handle, n, x, incx, stridex, batchCount, result);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    bool done = true;
+    for(int b = 0; b < batchCount && done; b++)
+    {
+        value[b] = 0;
+        if(result[b] > 0)
+            done = hipMemcpyAsync(value + b,
+                                  x + b * stridex + int64_t(result[b] - 1) * incx,
+                                  sizeof(T),
+                                  hipMemcpyDeviceToHost,
+                                  stream)
+                   == hipSuccess;
+    }
+    done = done && hipStreamSynchronize(stream) == hipSuccess;
+    for(int b = 0; b < batchCount && absolute; b++)
+        value[b] = std::abs(value[b]);
+    return done ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// iamax, or iamin when amin is set, with the selected elements, in the batched and strided forms,
+// as hipblasCopySwapEx. All the real types run the Level-1 ex kernels; without them fp32 and fp64
+// run hipblasIamaxValueExTyped for the strided form in host pointer mode.
+static hipblasStatus_t hipblasIamaxValueExTemplate(hipblasHandle_t    handle,
+                                                   bool               amin,
+                                                   int                n,
+                                                   const void*        x,
+                                                   const void* const* x_array,
+                                                   hipDataType        xType,
+                                                   int                incx,
+                                                   hipblasStride      stridex,
+                                                   int                batchCount,
+                                                   int*               result,
+                                                   void*              value,
+                                                   int                absolute)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblasLevel1ExIsHalf(xType) && xType != HIP_R_32F && xType != HIP_R_64F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!result || !value)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_LEVEL1_EX
+    return hipblasLevel1ExIamaxKernels(
+        handle, amin, n, x, x_array, xType, incx, stridex, batchCount, result, value, absolute);
+#else
+    hipblasPointerMode_t pointer_mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(x_array || pointer_mode != HIPBLAS_POINTER_MODE_HOST || hipblasLevel1ExIsHalf(xType))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(xType == HIP_R_64F)
+        return hipblasIamaxValueExTyped(handle,
+                                        amin,
+                                        n,
+                                        (const double*)x,
+                                        incx,
+                                        stridex,
+                                        batchCount,
+                                        result,
+                                        (double*)value,
+                                        absolute);
+    return hipblasIamaxValueExTyped(handle,
+                                    amin,
+                                    n,
+                                    (const float*)x,
+                                    incx,
+                                    stridex,
+                                    batchCount,
+                                    result,
+                                    (float*)value,
+                                    absolute);
+#endif
+}
+
+// nrm2 and scal of the non-batched and strided forms of hipblasNormalizeEx in host pointer mode
+// without the Level-1 ex kernels. The norms are read back before x is scaled.
+template <typename T>
+static hipblasStatus_t hipblasNormalizeExTyped(hipblasHandle_t handle,
+                                               int             n,
+                                               T*              x,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               int             batchCount,
+                                               T               epsilon,
+                                               T*              result)
+{
+    using F = hipblasLevel1ExFunctions<T>;
+
+    std::vector<T>  norms(batchCount);
+    hipblasStatus_t status = F::nrm2Strided(handle, n, x, incx, stridex, batchCount, norms.data());
+    for(int b = 0; b < batchCount && status == HIPBLAS_STATUS_SUCCESS; b++)
+    {
+        T guard = std::max(norms[b], epsilon);
+        if(n > 0 && incx > 0 && guard > 0)
+        {
+            T scale = T(1) / guard;
+            status  = F::scal(handle, n, &scale, x + b * stridex, incx);
+        }
+    }
+    if(status == HIPBLAS_STATUS_SUCCESS && result)
+        std::copy(norms.begin(), norms.end(), result);
+    return status;
+}
+
+// ||x|| and x / max(||x||, epsilon) in the three forms, as hipblasCopySwapEx. fp16, bf16 and
+// fp32 compute in float and fp64 in double, and all of them run the Level-1 ex kernels; without
+// them fp32 and fp64 run nrm2 and scal in host pointer mode for the non-batched and strided forms.
+static hipblasStatus_t hipblasNormalizeExTemplate(hipblasHandle_t handle,
+                                                  int             n,
+                                                  void*           x,
+                                                  void* const*    x_array,
+                                                  hipDataType     xType,
+                                                  int             incx,
+                                                  hipblasStride   stridex,
+                                                  int             batchCount,
+                                                  const void*     epsilon,
+                                                  void*           result,
+                                                  hipDataType     resultType,
+                                                  hipDataType     executionType)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipDataType computeType = xType == HIP_R_64F ? HIP_R_64F : HIP_R_32F;
+    if(!hipblasLevel1ExIsHalf(xType) && xType != HIP_R_32F && xType != HIP_R_64F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(executionType != computeType || (resultType != xType && resultType != computeType))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!epsilon)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_LEVEL1_EX
+    return hipblasLevel1ExNormalizeKernels(
+        handle, n, x, x_array, xType, incx, stridex, batchCount, epsilon, result, resultType);
+#else
+    hipblasPointerMode_t pointer_mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(x_array || pointer_mode != HIPBLAS_POINTER_MODE_HOST || hipblasLevel1ExIsHalf(xType))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(xType == HIP_R_64F)
+        return hipblasNormalizeExTyped(handle,
+                                       n,
+                                       (double*)x,
+                                       incx,
+                                       stridex,
+                                       batchCount,
+                                       *(const double*)epsilon,
+                                       (double*)result);
+    return hipblasNormalizeExTyped(
+        handle, n, (float*)x, incx, stridex, batchCount, *(const float*)epsilon, (float*)result);
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasCopyEx(hipblasHandle_t handle,
+                                         int             n,
+                                         const void*     x,
+                                         hipDataType     xType,
+                                         int             incx,
+                                         void*           y,
+                                         hipDataType     yType,
+                                         int             incy)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, y, yType, incy);
+    return hipblasCopySwapEx(
+        handle, false, n, x, nullptr, xType, incx, 0, y, nullptr, yType, incy, 0, 1, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCopyBatchedEx(hipblasHandle_t   handle,
+                                                int               n,
+                                                const void* const x[],
+                                                hipDataType       xType,
+                                                int               incx,
+                                                void* const       y[],
+                                                hipDataType       yType,
+                                                int               incy,
+                                                int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, y, yType, incy, batchCount);
+    return hipblasCopySwapEx(handle,
+                             false,
+                             n,
+                             nullptr,
+                             x,
+                             xType,
+                             incx,
+                             0,
+                             nullptr,
+                             y,
+                             yType,
+                             incy,
+                             0,
+                             batchCount,
+                             false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCopyStridedBatchedEx(hipblasHandle_t handle,
+                                                       int             n,
+                                                       const void*     x,
+                                                       hipDataType     xType,
+                                                       int             incx,
+                                                       hipblasStride   stridex,
+                                                       void*           y,
+                                                       hipDataType     yType,
+                                                       int             incy,
+                                                       hipblasStride   stridey,
+                                                       int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, stridex, y, yType, incy, stridey, batchCount);
+    return hipblasCopySwapEx(handle,
+                             false,
+                             n,
+                             x,
+                             nullptr,
+                             xType,
+                             incx,
+                             stridex,
+                             y,
+                             nullptr,
+                             yType,
+                             incy,
+                             stridey,
+                             batchCount,
+                             true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSwapEx(hipblasHandle_t handle,
+                                         int             n,
+                                         void*           x,
+                                         hipDataType     xType,
+                                         int             incx,
+                                         void*           y,
+                                         hipDataType     yType,
+                                         int             incy)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, y, yType, incy);
+    return hipblasCopySwapEx(
+        handle, true, n, x, nullptr, xType, incx, 0, y, nullptr, yType, incy, 0, 1, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSwapBatchedEx(hipblasHandle_t handle,
+                                                int             n,
+                                                void* const     x[],
+                                                hipDataType     xType,
+                                                int             incx,
+                                                void* const     y[],
+                                                hipDataType     yType,
+                                                int             incy,
+                                                int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, y, yType, incy, batchCount);
+    return hipblasCopySwapEx(handle,
+                             true,
+                             n,
+                             nullptr,
+                             x,
+                             xType,
+                             incx,
+                             0,
+                             nullptr,
+                             y,
+                             yType,
+                             incy,
+                             0,
+                             batchCount,
+                             false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSwapStridedBatchedEx(hipblasHandle_t handle,
+                                                       int             n,
+                                                       void*           x,
+                                                       hipDataType     xType,
+                                                       int             incx,
+                                                       hipblasStride   stridex,
+                                                       void*           y,
+                                                       hipDataType     yType,
+                                                       int             incy,
+                                                       hipblasStride   stridey,
+                                                       int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, stridex, y, yType, incy, stridey, batchCount);
+    return hipblasCopySwapEx(handle,
+                             true,
+                             n,
+                             x,
+                             nullptr,
+                             xType,
+                             incx,
+                             stridex,
+                             y,
+                             nullptr,
+                             yType,
+                             incy,
+                             stridey,
+                             batchCount,
+                             true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasAsumEx(hipblasHandle_t handle,
+                                         int             n,
+                                         const void*     x,
+                                         hipDataType     xType,
+                                         int             incx,
+                                         void*           result,
+                                         hipDataType     resultType,
+                                         hipDataType     executionType)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, result, resultType, executionType);
+    return hipblasAsumExTemplate(
+        handle, n, x, nullptr, xType, incx, 0, 1, result, resultType, executionType, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasAsumBatchedEx(hipblasHandle_t   handle,
+                                                int               n,
+                                                const void* const x[],
+                                                hipDataType       xType,
+                                                int               incx,
+                                                int               batchCount,
+                                                void*             result,
+                                                hipDataType       resultType,
+                                                hipDataType       executionType)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, batchCount, result, resultType, executionType);
+    return hipblasAsumExTemplate(handle,
+                                 n,
+                                 nullptr,
+                                 x,
+                                 xType,
+                                 incx,
+                                 0,
+                                 batchCount,
+                                 result,
+                                 resultType,
+                                 executionType,
+                                 false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasAsumStridedBatchedEx(hipblasHandle_t handle,
+                                                       int             n,
+                                                       const void*     x,
+                                                       hipDataType     xType,
+                                                       int             incx,
+                                                       hipblasStride   stridex,
+                                                       int             batchCount,
+                                                       void*           result,
+                                                       hipDataType     resultType,
+                                                       hipDataType     executionType)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, x, xType, incx, stridex, batchCount, result, resultType, executionType);
+    return hipblasAsumExTemplate(handle,
+                                 n,
+                                 x,
+                                 nullptr,
+                                 xType,
+                                 incx,
+                                 stridex,
+                                 batchCount,
+                                 result,
+                                 resultType,
+                                 executionType,
+                                 true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIamaxEx(
+    hipblasHandle_t handle, int n, const void* x, hipDataType xType, int incx, int* result)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, result);
+    return hipblasIamaxExTemplate(handle, false, n, x, nullptr, xType, incx, 0, 1, result, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIamaxBatchedEx(hipblasHandle_t   handle,
+                                                 int               n,
+                                                 const void* const x[],
+                                                 hipDataType       xType,
+                                                 int               incx,
+                                                 int               batchCount,
+                                                 int*              result)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, batchCount, result);
+    return hipblasIamaxExTemplate(
+        handle, false, n, nullptr, x, xType, incx, 0, batchCount, result, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIamaxStridedBatchedEx(hipblasHandle_t handle,
+                                                        int             n,
+                                                        const void*     x,
+                                                        hipDataType     xType,
+                                                        int             incx,
+                                                        hipblasStride   stridex,
+                                                        int             batchCount,
+                                                        int*            result)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, stridex, batchCount, result);
+    return hipblasIamaxExTemplate(
+        handle, false, n, x, nullptr, xType, incx, stridex, batchCount, result, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIaminEx(
+    hipblasHandle_t handle, int n, const void* x, hipDataType xType, int incx, int* result)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, result);
+    return hipblasIamaxExTemplate(handle, true, n, x, nullptr, xType, incx, 0, 1, result, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIaminBatchedEx(hipblasHandle_t   handle,
+                                                 int               n,
+                                                 const void* const x[],
+                                                 hipDataType       xType,
+                                                 int               incx,
+                                                 int               batchCount,
+                                                 int*              result)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, batchCount, result);
+    return hipblasIamaxExTemplate(
+        handle, true, n, nullptr, x, xType, incx, 0, batchCount, result, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIaminStridedBatchedEx(hipblasHandle_t handle,
+                                                        int             n,
+                                                        const void*     x,
+                                                        hipDataType     xType,
+                                                        int             incx,
+                                                        hipblasStride   stridex,
+                                                        int             batchCount,
+                                                        int*            result)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, stridex, batchCount, result);
+    return hipblasIamaxExTemplate(
+        handle, true, n, x, nullptr, xType, incx, stridex, batchCount, result, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasNormalizeEx(hipblasHandle_t handle,
+                                              int             n,
+                                              void*           x,
+                                              hipDataType     xType,
+                                              int             incx,
+                                              const void*     epsilon,
+                                              void*           result,
+                                              hipDataType     resultType,
+                                              hipDataType     executionType)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, epsilon, result, resultType, executionType);
+    return hipblasNormalizeExTemplate(
+        handle, n, x, nullptr, xType, incx, 0, 1, epsilon, result, resultType, executionType);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasNormalizeBatchedEx(hipblasHandle_t handle,
+                                                     int             n,
+                                                     void* const     x[],
+                                                     hipDataType     xType,
+                                                     int             incx,
+                                                     int             batchCount,
+                                                     const void*     epsilon,
+                                                     void*           result,
+                                                     hipDataType     resultType,
+                                                     hipDataType     executionType)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, x, xType, incx, batchCount, epsilon, result, resultType, executionType);
+    return hipblasNormalizeExTemplate(handle,
+                                      n,
+                                      nullptr,
+                                      x,
+                                      xType,
+                                      incx,
+                                      0,
+                                      batchCount,
+                                      epsilon,
+                                      result,
+                                      resultType,
+                                      executionType);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasNormalizeStridedBatchedEx(hipblasHandle_t handle,
+                                                            int             n,
+                                                            void*           x,
+                                                            hipDataType     xType,
+                                                            int             incx,
+                                                            hipblasStride   stridex,
+                                                            int             batchCount,
+                                                            const void*     epsilon,
+                                                            void*           result,
+                                                            hipDataType     resultType,
+                                                            hipDataType     executionType)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, x, xType, incx, stridex, batchCount, epsilon, result, resultType, executionType);
+    return hipblasNormalizeExTemplate(handle,
+                                      n,
+                                      x,
+                                      nullptr,
+                                      xType,
+                                      incx,
+                                      stridex,
+                                      batchCount,
+                                      epsilon,
+                                      result,
+                                      resultType,
+                                      executionType);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIamaxValueBatchedEx(hipblasHandle_t   handle,
+                                                      int               n,
+                                                      const void* const x[],
+                                                      hipDataType       xType,
+                                                      int               incx,
+                                                      int               batchCount,
+                                                      int*              result,
+                                                      void*             value,
+                                                      int               absolute)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, batchCount, result, value, absolute);
+    return hipblasIamaxValueExTemplate(
+        handle, false, n, nullptr, x, xType, incx, 0, batchCount, result, value, absolute);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIamaxValueStridedBatchedEx(hipblasHandle_t handle,
+                                                             int             n,
+                                                             const void*     x,
+                                                             hipDataType     xType,
+                                                             int             incx,
+                                                             hipblasStride   stridex,
+                                                             int             batchCount,
+                                                             int*            result,
+                                                             void*           value,
+                                                             int             absolute)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, stridex, batchCount, result, value, absolute);
+    return hipblasIamaxValueExTemplate(
+        handle, false, n, x, nullptr, xType, incx, stridex, batchCount, result, value, absolute);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIaminValueBatchedEx(hipblasHandle_t   handle,
+                                                      int               n,
+                                                      const void* const x[],
+                                                      hipDataType       xType,
+                                                      int               incx,
+                                                      int               batchCount,
+                                                      int*              result,
+                                                      void*             value,
+                                                      int               absolute)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, batchCount, result, value, absolute);
+    return hipblasIamaxValueExTemplate(
+        handle, true, n, nullptr, x, xType, incx, 0, batchCount, result, value, absolute);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasIaminValueStridedBatchedEx(hipblasHandle_t handle,
+                                                             int             n,
+                                                             const void*     x,
+                                                             hipDataType     xType,
+                                                             int             incx,
+                                                             hipblasStride   stridex,
+                                                             int             batchCount,
+                                                             int*            result,
+                                                             void*           value,
+                                                             int             absolute)
+try
+{
+    HIPBLAS_LAYER(handle, n, x, xType, incx, stridex, batchCount, result, value, absolute);
+    return hipblasIamaxValueExTemplate(
+        handle, true, n, x, nullptr, xType, incx, stridex, batchCount, result, value, absolute);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
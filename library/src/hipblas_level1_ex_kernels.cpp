@@ -0,0 +1,496 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "convert_device.hpp"
+#include "level1_ex.hpp"
+#include <algorithm>
+
+// Threads of a work group, and largest grid in the dimension striding over the batch
+constexpr int level1_ex_threads  = 256;
+constexpr int level1_ex_max_grid = 65535;
+
+// Offset of element i of a vector of n elements, which runs from its last element when inc < 0
+__device__ inline int64_t hipblasLevel1ExOffset(int64_t i, int n, int inc)
+{
+    return inc < 0 ? (i - (n - 1)) * inc : i * inc;
+}
+
+// Vector b of a batched or strided batched call
+template <typename T>
+__device__ inline T* hipblasLevel1ExVector(T* x, T* const* x_array, int b, hipblasStride stride_x)
+{
+    return x_array ? x_array[b] : x + b * stride_x;
+}
+
+// blockIdx.x strides over the elements and blockIdx.y over the batch. The elements move as their
+// 16 bits, so one kernel serves fp16 and bf16.
+__global__ void __launch_bounds__(level1_ex_threads)
+    hipblasLevel1ExCopyKernel(bool             swap,
+                              int              n,
+                              uint16_t*        x,
+                              uint16_t* const* x_array,
+                              int              incx,
+                              hipblasStride    stride_x,
+                              uint16_t*        y,
+                              uint16_t* const* y_array,
+                              int              incy,
+                              hipblasStride    stride_y,
+                              int              batch_count)
+{
+    int64_t i = int64_t(blockIdx.x) * level1_ex_threads + threadIdx.x;
+    if(i >= n)
+        return;
+
+    for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+    {
+        uint16_t* xi = hipblasLevel1ExVector(x, x_array, b, stride_x)
+                       + hipblasLevel1ExOffset(i, n, incx);
+        uint16_t* yi = hipblasLevel1ExVector(y, y_array, b, stride_y)
+                       + hipblasLevel1ExOffset(i, n, incy);
+        uint16_t  v  = *xi;
+        if(swap)
+            *xi = *yi;
+        *yi = v;
+    }
+}
+
+// One work group per vector, striding over the batch, summing in float
+template <typename T, typename Tr>
+__global__ void __launch_bounds__(level1_ex_threads)
+    hipblasLevel1ExAsumKernel(int             n,
+                              const T*        x,
+                              const T* const* x_array,
+                              int             incx,
+                              hipblasStride   stride_x,
+                              int             batch_count,
+                              Tr*             result)
+{
+    __shared__ float s_sum[level1_ex_threads];
+
+    int tid = threadIdx.x;
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        const T* xb  = hipblasLevel1ExVector(x, x_array, b, stride_x);
+        float    sum = 0;
+        for(int i = tid; i < n; i += level1_ex_threads)
+            sum += fabsf(hipblasDeviceToFloat(xb[int64_t(i) * incx]));
+        s_sum[tid] = sum;
+        __syncthreads();
+
+        for(int s = level1_ex_threads / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                s_sum[tid] += s_sum[tid + s];
+            __syncthreads();
+        }
+
+        if(tid == 0)
+            hipblasDeviceFromFloat(s_sum[0], result[b]);
+        __syncthreads();
+    }
+}
+
+// One work group per vector, striding over the batch. Each thread keeps the first best element
+// of its part of the vector, and ties in the reduction go to the lower index, so the result is
+// the first best element as in BLAS. The magnitudes are compared in Tc, and when value is not
+// null the best element, or its magnitude when absolute is set, is stored there as well.
+template <bool AMIN, typename T, typename Tc>
+__global__ void __launch_bounds__(level1_ex_threads)
+    hipblasLevel1ExIamaxKernel(int             n,
+                               const T*        x,
+                               const T* const* x_array,
+                               int             incx,
+                               hipblasStride   stride_x,
+                               int             batch_count,
+                               int*            result,
+                               T*              value,
+                               bool            absolute)
+{
+    __shared__ Tc  s_value[level1_ex_threads];
+    __shared__ int s_index[level1_ex_threads];
+
+    int tid = threadIdx.x;
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        const T* xb    = hipblasLevel1ExVector(x, x_array, b, stride_x);
+        Tc       best  = 0;
+        int      index = 0;
+        for(int i = tid; i < n; i += level1_ex_threads)
+        {
+            Tc v = hipblasDeviceCast<Tc>(xb[int64_t(i) * incx]);
+            v    = v < 0 ? -v : v;
+            if(!index || (AMIN ? v < best : v > best))
+            {
+                best  = v;
+                index = i + 1;
+            }
+        }
+        s_value[tid] = best;
+        s_index[tid] = index;
+        __syncthreads();
+
+        for(int s = level1_ex_threads / 2; s > 0; s /= 2)
+        {
+            if(tid < s && s_index[tid + s])
+            {
+                Tc   a = s_value[tid], c = s_value[tid + s];
+                bool better = AMIN ? c < a : c > a;
+                if(!s_index[tid] || better || (c == a && s_index[tid + s] < s_index[tid]))
+                {
+                    s_value[tid] = c;
+                    s_index[tid] = s_index[tid + s];
+                }
+            }
+            __syncthreads();
+        }
+
+        if(tid == 0)
+        {
+            result[b] = s_index[0];
+            // The best magnitude is 0 for empty vectors
+            if(value && (absolute || !s_index[0]))
+                value[b] = hipblasDeviceCast<T>(s_value[0]);
+            else if(value)
+                value[b] = xb[int64_t(s_index[0] - 1) * incx];
+        }
+        __syncthreads();
+    }
+}
+
+// One work group per vector, striding over the batch. The squares are summed in Tc, then each
+// thread scales the elements it read by the reciprocal of the norm, kept from epsilon and left at
+// 1 for a norm and epsilon of 0. epsilon is read from epsilon_device when that is not null.
+template <typename T, typename Tc, typename Tr>
+__global__ void __launch_bounds__(level1_ex_threads)
+    hipblasLevel1ExNormalizeKernel(int           n,
+                                   T*            x,
+                                   T* const*     x_array,
+                                   int           incx,
+                                   hipblasStride stride_x,
+                                   int           batch_count,
+                                   Tc            epsilon,
+                                   const Tc*     epsilon_device,
+                                   Tr*           result)
+{
+    __shared__ Tc s_sum[level1_ex_threads];
+
+    if(epsilon_device)
+        epsilon = *epsilon_device;
+
+    int tid = threadIdx.x;
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        T* xb  = hipblasLevel1ExVector(x, x_array, b, stride_x);
+        Tc sum = 0;
+        for(int i = tid; i < n; i += level1_ex_threads)
+        {
+            Tc v = hipblasDeviceCast<Tc>(xb[int64_t(i) * incx]);
+            sum += v * v;
+        }
+        s_sum[tid] = sum;
+        __syncthreads();
+
+        for(int s = level1_ex_threads / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                s_sum[tid] += s_sum[tid + s];
+            __syncthreads();
+        }
+
+        Tc norm  = sqrt(s_sum[0]);
+        Tc guard = norm > epsilon ? norm : epsilon;
+        Tc scale = guard > 0 ? Tc(1) / guard : Tc(1);
+        for(int i = tid; i < n; i += level1_ex_threads)
+        {
+            T& xi = xb[int64_t(i) * incx];
+            xi    = hipblasDeviceCast<T>(hipblasDeviceCast<Tc>(xi) * scale);
+        }
+
+        if(tid == 0 && result)
+            result[b] = hipblasDeviceCast<Tr>(norm);
+        __syncthreads();
+    }
+}
+
+// Runs launch(stream, device_result, device_value) for the batch_count results of size bytes at
+// result, and the batch_count values of value_size bytes at value when value_size is not 0,
+// through one device allocation in host pointer mode
+template <typename Launch>
+static hipblasStatus_t hipblasLevel1ExReduce(hipblasHandle_t handle,
+                                             int             batch_count,
+                                             size_t          size,
+                                             void*           result,
+                                             Launch          launch,
+                                             size_t          value_size = 0,
+                                             void*           value      = nullptr)
+{
+    hipblasPointerMode_t pointer_mode;
+    hipStream_t          stream;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The values follow the results, aligned to 16 bytes
+    bool   host          = pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+    size_t bytes         = size * size_t(batch_count);
+    size_t value_offset  = (bytes + 15) / 16 * 16;
+    size_t value_bytes   = value_size * size_t(batch_count);
+    void*  device_result = result;
+    if(host && hipMalloc(&device_result, value_offset + value_bytes) != hipSuccess)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    void* device_value = host && value_size ? (char*)device_result + value_offset : value;
+
+    launch(stream, device_result, device_value);
+    bool done = hipGetLastError() == hipSuccess;
+    if(host)
+    {
+        done = done
+               && hipMemcpyAsync(result, device_result, bytes, hipMemcpyDeviceToHost, stream)
+                      == hipSuccess
+               && (!value_size
+                   || hipMemcpyAsync(
+                          value, device_value, value_bytes, hipMemcpyDeviceToHost, stream)
+                          == hipSuccess)
+               && hipStreamSynchronize(stream) == hipSuccess;
+        (void)hipFree(device_result);
+    }
+    return done ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// Calls f with a value of the element type of HIP_R_16F or HIP_R_16BF
+template <typename F>
+static hipblasStatus_t hipblasLevel1ExHalfType(hipDataType type, F f)
+{
+    switch(type)
+    {
+    case HIP_R_16F:
+        return f(__half());
+    case HIP_R_16BF:
+        return f(hipblasDeviceBfloat16());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+hipblasStatus_t hipblasLevel1ExCopyKernels(hipblasHandle_t    handle,
+                                           bool               swap,
+                                           int                n,
+                                           const void*        x,
+                                           const void* const* x_array,
+                                           int                incx,
+                                           hipblasStride      stride_x,
+                                           void*              y,
+                                           void* const*       y_array,
+                                           int                incy,
+                                           hipblasStride      stride_y,
+                                           int                batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // x is only written by swaps, whose x is not const
+    dim3 grid((n + level1_ex_threads - 1) / level1_ex_threads,
+              std::min(batch_count, level1_ex_max_grid));
+    hipLaunchKernelGGL(hipblasLevel1ExCopyKernel,
+                       grid,
+                       dim3(level1_ex_threads),
+                       0,
+                       stream,
+                       swap,
+                       n,
+                       (uint16_t*)x,
+                       (uint16_t* const*)x_array,
+                       incx,
+                       stride_x,
+                       (uint16_t*)y,
+                       (uint16_t* const*)y_array,
+                       incy,
+                       stride_y,
+                       batch_count);
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasLevel1ExAsumKernels(hipblasHandle_t    handle,
+                                           int                n,
+                                           const void*        x,
+                                           const void* const* x_array,
+                                           hipDataType        x_type,
+                                           int                incx,
+                                           hipblasStride      stride_x,
+                                           int                batch_count,
+                                           void*              result,
+                                           hipDataType        result_type)
+{
+    if(n <= 0 || incx <= 0)
+        n = 0;
+    if(n && !x && !x_array)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasLevel1ExHalfType(x_type, [&](auto element) {
+        using T = decltype(element);
+
+        auto run = [&](auto result_element) {
+            using Tr    = decltype(result_element);
+            auto launch = [&](hipStream_t stream, void* d_result, void*) {
+                hipLaunchKernelGGL((hipblasLevel1ExAsumKernel<T, Tr>),
+                                   dim3(std::min(batch_count, level1_ex_max_grid)),
+                                   dim3(level1_ex_threads),
+                                   0,
+                                   stream,
+                                   n,
+                                   (const T*)x,
+                                   (const T* const*)x_array,
+                                   incx,
+                                   stride_x,
+                                   batch_count,
+                                   (Tr*)d_result);
+            };
+            return hipblasLevel1ExReduce(handle, batch_count, sizeof(Tr), result, launch);
+        };
+        return result_type == HIP_R_32F ? run(float()) : run(element);
+    });
+}
+
+hipblasStatus_t hipblasLevel1ExIamaxKernels(hipblasHandle_t    handle,
+                                            bool               amin,
+                                            int                n,
+                                            const void*        x,
+                                            const void* const* x_array,
+                                            hipDataType        x_type,
+                                            int                incx,
+                                            hipblasStride      stride_x,
+                                            int                batch_count,
+                                            int*               result,
+                                            void*              value,
+                                            bool               absolute)
+{
+    if(n <= 0 || incx <= 0)
+        n = 0;
+    if(n && !x && !x_array)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto run = [&](auto element, auto compute_element) {
+        using T  = decltype(element);
+        using Tc = decltype(compute_element);
+
+        auto kernel = amin ? hipblasLevel1ExIamaxKernel<true, T, Tc>
+                           : hipblasLevel1ExIamaxKernel<false, T, Tc>;
+        auto launch = [&](hipStream_t stream, void* d_result, void* d_value) {
+            hipLaunchKernelGGL(kernel,
+                               dim3(std::min(batch_count, level1_ex_max_grid)),
+                               dim3(level1_ex_threads),
+                               0,
+                               stream,
+                               n,
+                               (const T*)x,
+                               (const T* const*)x_array,
+                               incx,
+                               stride_x,
+                               batch_count,
+                               (int*)d_result,
+                               (T*)d_value,
+                               absolute);
+        };
+        return hipblasLevel1ExReduce(
+            handle, batch_count, sizeof(int), result, launch, value ? sizeof(T) : 0, value);
+    };
+
+    if(x_type == HIP_R_32F)
+        return run(float(), float());
+    if(x_type == HIP_R_64F)
+        return run(double(), double());
+    return hipblasLevel1ExHalfType(x_type, [&](auto element) { return run(element, float()); });
+}
+
+hipblasStatus_t hipblasLevel1ExNormalizeKernels(hipblasHandle_t handle,
+                                                int             n,
+                                                void*           x,
+                                                void* const*    x_array,
+                                                hipDataType     x_type,
+                                                int             incx,
+                                                hipblasStride   stride_x,
+                                                int             batch_count,
+                                                const void*     epsilon,
+                                                void*           result,
+                                                hipDataType     result_type)
+{
+    if(n <= 0 || incx <= 0)
+        n = 0;
+    if(n && !x && !x_array)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasPointerMode_t pointer_mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    bool host = pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+
+    auto run = [&](auto element, auto compute_element, auto result_element) {
+        using T  = decltype(element);
+        using Tc = decltype(compute_element);
+        using Tr = decltype(result_element);
+
+        Tc   epsilon_host = host ? *(const Tc*)epsilon : Tc(0);
+        auto launch       = [&](hipStream_t stream, void* d_result, void*) {
+            hipLaunchKernelGGL((hipblasLevel1ExNormalizeKernel<T, Tc, Tr>),
+                               dim3(std::min(batch_count, level1_ex_max_grid)),
+                               dim3(level1_ex_threads),
+                               0,
+                               stream,
+                               n,
+                               (T*)x,
+                               (T* const*)x_array,
+                               incx,
+                               stride_x,
+                               batch_count,
+                               epsilon_host,
+                               host ? nullptr : (const Tc*)epsilon,
+                               (Tr*)d_result);
+        };
+        if(result)
+            return hipblasLevel1ExReduce(handle, batch_count, sizeof(Tr), result, launch);
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        launch(stream, nullptr, nullptr);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    };
+
+    if(x_type == HIP_R_32F)
+        return run(float(), float(), float());
+    if(x_type == HIP_R_64F)
+        return run(double(), double(), double());
+    return hipblasLevel1ExHalfType(x_type, [&](auto element) {
+        return result_type == HIP_R_32F ? run(element, float(), float())
+                                        : run(element, float(), element);
+    });
+}
@@ -0,0 +1,1525 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "level3_ex.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+// Columns of C in one diagonal block of syrk and syr2k, and rows or columns of op(A) in one block
+// of trmm. The diagonal blocks are the only flops spent on the triangle that is not referenced.
+constexpr int level3_ex_block = 256;
+
+// Matrix of the three forms: ptr of the non-batched and strided batched forms, or array of the
+// device pointers of the batched form
+struct hipblasLevel3ExOperand
+{
+    const void*        ptr;
+    const void* const* array;
+    hipDataType        type;
+    int                ld;
+    hipblasStride      stride;
+};
+
+// hipBLAS functions of each precision of every type being the same
+template <typename T>
+struct hipblasLevel3ExFunctions;
+
+template <>
+struct hipblasLevel3ExFunctions<float>
+{
+    static constexpr auto syrk                = hipblasSsyrk;
+    static constexpr auto syrkBatched         = hipblasSsyrkBatched;
+    static constexpr auto syrkStridedBatched  = hipblasSsyrkStridedBatched;
+    static constexpr auto syr2k               = hipblasSsyr2k;
+    static constexpr auto syr2kBatched        = hipblasSsyr2kBatched;
+    static constexpr auto syr2kStridedBatched = hipblasSsyr2kStridedBatched;
+    static constexpr auto trmm                = hipblasStrmm;
+    static constexpr auto trmmBatched         = hipblasStrmmBatched;
+    static constexpr auto trmmStridedBatched  = hipblasStrmmStridedBatched;
+    static constexpr auto symm                = hipblasSsymm;
+    static constexpr auto symmBatched         = hipblasSsymmBatched;
+    static constexpr auto symmStridedBatched  = hipblasSsymmStridedBatched;
+};
+
+template <>
+struct hipblasLevel3ExFunctions<double>
+{
+    static constexpr auto syrk                = hipblasDsyrk;
+    static constexpr auto syrkBatched         = hipblasDsyrkBatched;
+    static constexpr auto syrkStridedBatched  = hipblasDsyrkStridedBatched;
+    static constexpr auto syr2k               = hipblasDsyr2k;
+    static constexpr auto syr2kBatched        = hipblasDsyr2kBatched;
+    static constexpr auto syr2kStridedBatched = hipblasDsyr2kStridedBatched;
+    static constexpr auto trmm                = hipblasDtrmm;
+    static constexpr auto trmmBatched         = hipblasDtrmmBatched;
+    static constexpr auto trmmStridedBatched  = hipblasDtrmmStridedBatched;
+    static constexpr auto symm                = hipblasDsymm;
+    static constexpr auto symmBatched         = hipblasDsymmBatched;
+    static constexpr auto symmStridedBatched  = hipblasDsymmStridedBatched;
+};
+
+template <>
+struct hipblasLevel3ExFunctions<hipblasComplex>
+{
+    static constexpr auto syrk                = hipblasCsyrk;
+    static constexpr auto syrkBatched         = hipblasCsyrkBatched;
+    static constexpr auto syrkStridedBatched  = hipblasCsyrkStridedBatched;
+    static constexpr auto syr2k               = hipblasCsyr2k;
+    static constexpr auto syr2kBatched        = hipblasCsyr2kBatched;
+    static constexpr auto syr2kStridedBatched = hipblasCsyr2kStridedBatched;
+    static constexpr auto trmm                = hipblasCtrmm;
+    static constexpr auto trmmBatched         = hipblasCtrmmBatched;
+    static constexpr auto trmmStridedBatched  = hipblasCtrmmStridedBatched;
+    static constexpr auto symm                = hipblasCsymm;
+    static constexpr auto symmBatched         = hipblasCsymmBatched;
+    static constexpr auto symmStridedBatched  = hipblasCsymmStridedBatched;
+};
+
+template <>
+struct hipblasLevel3ExFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto syrk                = hipblasZsyrk;
+    static constexpr auto syrkBatched         = hipblasZsyrkBatched;
+    static constexpr auto syrkStridedBatched  = hipblasZsyrkStridedBatched;
+    static constexpr auto syr2k               = hipblasZsyr2k;
+    static constexpr auto syr2kBatched        = hipblasZsyr2kBatched;
+    static constexpr auto syr2kStridedBatched = hipblasZsyr2kStridedBatched;
+    static constexpr auto trmm                = hipblasZtrmm;
+    static constexpr auto trmmBatched         = hipblasZtrmmBatched;
+    static constexpr auto trmmStridedBatched  = hipblasZtrmmStridedBatched;
+    static constexpr auto symm                = hipblasZsymm;
+    static constexpr auto symmBatched         = hipblasZsymmBatched;
+    static constexpr auto symmStridedBatched  = hipblasZsymmStridedBatched;
+};
+
+// Runs f with a value of the element type when aType, bType and cType are one of the types of
+// the hipblasX functions with its compute type. Returns false when they are not.
+template <typename F>
+static bool hipblasLevel3ExTyped(hipDataType          a_type,
+                                 hipDataType          b_type,
+                                 hipDataType          c_type,
+                                 hipblasComputeType_t compute_type,
+                                 hipblasStatus_t&     status,
+                                 F                    f)
+{
+    bool compute_32f
+        = compute_type == HIPBLAS_COMPUTE_32F || compute_type == HIPBLAS_COMPUTE_32F_PEDANTIC;
+    bool compute_64f
+        = compute_type == HIPBLAS_COMPUTE_64F || compute_type == HIPBLAS_COMPUTE_64F_PEDANTIC;
+    if(a_type != b_type || a_type != c_type)
+        return false;
+
+    if(a_type == HIP_R_32F && compute_32f)
+        status = f(float{});
+    else if(a_type == HIP_R_64F && compute_64f)
+        status = f(double{});
+    else if(a_type == HIP_C_32F && compute_32f)
+        status = f(hipblasComplex{});
+    else if(a_type == HIP_C_64F && compute_64f)
+        status = f(hipblasDoubleComplex{});
+    else
+        return false;
+    return true;
+}
+
+#ifdef HIPBLAS_LEVEL3_EX
+// fp16 or bf16 operands with C of their type or fp32, computed in fp32 through hipblasGemmEx
+static bool hipblasLevel3ExMixed(hipDataType          a_type,
+                                 hipDataType          b_type,
+                                 hipDataType          c_type,
+                                 hipblasComputeType_t compute_type)
+{
+    return (a_type == HIP_R_16F || a_type == HIP_R_16BF) && b_type == a_type
+           && (c_type == a_type || c_type == HIP_R_32F)
+           && (compute_type == HIPBLAS_COMPUTE_32F || compute_type == HIPBLAS_COMPUTE_32F_PEDANTIC);
+}
+
+static size_t hipblasLevel3ExElementSize(hipDataType type)
+{
+    return type == HIP_R_32F ? 4 : 2;
+}
+
+// State of one fp16 or bf16 call: the stream, one and zero in the pointer mode of the handle, and
+// the pointer arrays of the blocks of the gemms of the batched form
+struct hipblasLevel3ExCall
+{
+    hipblasHandle_t      handle;
+    hipStream_t          stream;
+    hipblasComputeType_t compute_type;
+    int                  batch_count;
+    bool                 strided;
+    bool                 batched;
+    const void*          one;
+    const void*          zero;
+    void**               pointers;
+    hipblasDeviceScratch scratch;
+
+    // Allocates work_bytes of scratch after the scalars and pointers, and returns its start
+    hipblasStatus_t init(size_t work_bytes, char*& work)
+    {
+        static const float host_scalars[2] = {1, 0};
+
+        hipblasPointerMode_t   mode;
+        hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+        hipblasStatus_t        status         = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(capture_status != hipStreamCaptureStatusNone)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // 256-byte aligned parts
+        size_t pointer_bytes = batched ? (3 * sizeof(void*) * batch_count + 255) / 256 * 256 : 0;
+        if(hipMalloc((void**)&scratch.base, 256 + pointer_bytes + work_bytes) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        pointers = (void**)(scratch.base + 256);
+        work     = scratch.base + 256 + pointer_bytes;
+
+        one  = &host_scalars[0];
+        zero = &host_scalars[1];
+        if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            if(hipMemcpyAsync(scratch.base,
+                              host_scalars,
+                              sizeof(host_scalars),
+                              hipMemcpyHostToDevice,
+                              stream)
+               != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            one  = scratch.base;
+            zero = scratch.base + sizeof(float);
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Offset of element (i, j) of X in bytes
+    static size_t offset(const hipblasLevel3ExOperand& X, int i, int j)
+    {
+        return (i + size_t(j) * X.ld) * hipblasLevel3ExElementSize(X.type);
+    }
+
+    // C(ci, cj) := alpha op(A(ai, aj)) op(B(bi, bj)) + beta C(ci, cj), with C(ci, cj) m by n
+    hipblasStatus_t gemm(hipblasOperation_t            transa,
+                         hipblasOperation_t            transb,
+                         int                           m,
+                         int                           n,
+                         int                           k,
+                         const void*                   alpha,
+                         const hipblasLevel3ExOperand& A,
+                         int                           ai,
+                         int                           aj,
+                         const hipblasLevel3ExOperand& B,
+                         int                           bi,
+                         int                           bj,
+                         const void*                   beta,
+                         const hipblasLevel3ExOperand& C,
+                         int                           ci,
+                         int                           cj)
+    {
+        if(!m || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        size_t a_offset = offset(A, ai, aj), b_offset = offset(B, bi, bj);
+        size_t c_offset = offset(C, ci, cj);
+        if(batched)
+        {
+            // The scratch operands are strided, so their pointers are made from their stride
+            const hipblasLevel3ExOperand* X[3]       = {&A, &B, &C};
+            size_t                        offsets[3] = {a_offset, b_offset, c_offset};
+            for(int i = 0; i < 3; i++)
+            {
+                hipblasStatus_t status = hipblasOffsetPointersKernel(
+                    stream,
+                    X[i]->array,
+                    X[i]->ptr,
+                    X[i]->stride * hipblasLevel3ExElementSize(X[i]->type),
+                    offsets[i],
+                    pointers + i * batch_count,
+                    batch_count);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+            }
+            return hipblasGemmBatchedEx_v2(handle,
+                                           transa,
+                                           transb,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           (const void**)pointers,
+                                           A.type,
+                                           A.ld,
+                                           (const void**)pointers + batch_count,
+                                           B.type,
+                                           B.ld,
+                                           beta,
+                                           pointers + 2 * batch_count,
+                                           C.type,
+                                           C.ld,
+                                           batch_count,
+                                           compute_type,
+                                           HIPBLAS_GEMM_DEFAULT);
+        }
+
+        const char* a = (const char*)A.ptr + a_offset;
+        const char* b = (const char*)B.ptr + b_offset;
+        char*       c = (char*)C.ptr + c_offset;
+        if(strided)
+            return hipblasGemmStridedBatchedEx_v2(handle,
+                                                  transa,
+                                                  transb,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  a,
+                                                  A.type,
+                                                  A.ld,
+                                                  A.stride,
+                                                  b,
+                                                  B.type,
+                                                  B.ld,
+                                                  B.stride,
+                                                  beta,
+                                                  c,
+                                                  C.type,
+                                                  C.ld,
+                                                  C.stride,
+                                                  batch_count,
+                                                  compute_type,
+                                                  HIPBLAS_GEMM_DEFAULT);
+        return hipblasGemmEx_v2(handle,
+                                transa,
+                                transb,
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                a,
+                                A.type,
+                                A.ld,
+                                b,
+                                B.type,
+                                B.ld,
+                                beta,
+                                c,
+                                C.type,
+                                C.ld,
+                                compute_type,
+                                HIPBLAS_GEMM_DEFAULT);
+    }
+
+    // Y(yi, yj) := the m by n X(xi, xj) as hipblasTriangleKernels
+    hipblasStatus_t triangle(hipblasFillMode_t             uplo,
+                             hipblasTriangleFill           fill,
+                             bool                          unit_diag,
+                             int                           m,
+                             int                           n,
+                             const hipblasLevel3ExOperand& X,
+                             int                           xi,
+                             int                           xj,
+                             const hipblasLevel3ExOperand& Y,
+                             int                           yi,
+                             int                           yj)
+    {
+        return hipblasTriangleKernels(stream,
+                                      X.type,
+                                      uplo,
+                                      fill,
+                                      unit_diag,
+                                      m,
+                                      n,
+                                      X.ptr,
+                                      X.array,
+                                      xi + size_t(xj) * X.ld,
+                                      X.ld,
+                                      X.stride,
+                                      (void*)Y.ptr,
+                                      (void* const*)Y.array,
+                                      yi + size_t(yj) * Y.ld,
+                                      Y.ld,
+                                      Y.stride,
+                                      batch_count);
+    }
+};
+#endif
+
+static bool hipblasLevel3ExNull(const hipblasLevel3ExOperand& X)
+{
+    return !X.ptr && !X.array;
+}
+
+// C := alpha op(A) op(B)^T + beta C, plus alpha op(B) op(A)^T for syr2k, on the uplo triangle of
+// C. The typed syrk and syr2k take B as given, and syrk passes A as B.
+static hipblasStatus_t hipblasLevel3ExRankK(hipblasHandle_t               handle,
+                                            bool                          syr2k,
+                                            hipblasFillMode_t             uplo,
+                                            hipblasOperation_t            trans,
+                                            int                           n,
+                                            int                           k,
+                                            const void*                   alpha,
+                                            const hipblasLevel3ExOperand& A,
+                                            const hipblasLevel3ExOperand& B,
+                                            const void*                   beta,
+                                            const hipblasLevel3ExOperand& C,
+                                            hipblasComputeType_t          compute_type,
+                                            int                           batch_count,
+                                            bool                          strided)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    bool trans_n = trans == HIPBLAS_OP_N;
+    if((uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+       || (!trans_n && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n < 0 || k < 0 || batch_count < 0 || A.ld < std::max(1, trans_n ? n : k)
+       || B.ld < std::max(1, trans_n ? n : k) || C.ld < std::max(1, n))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || hipblasLevel3ExNull(C)
+       || (k && (hipblasLevel3ExNull(A) || hipblasLevel3ExNull(B))))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    auto            typed  = [&](auto t) {
+        using T = decltype(t);
+        using F = hipblasLevel3ExFunctions<T>;
+        if(A.array && syr2k)
+            return F::syr2kBatched(handle,
+                                   uplo,
+                                   trans,
+                                   n,
+                                   k,
+                                   (const T*)alpha,
+                                   (const T* const*)A.array,
+                                   A.ld,
+                                   (const T* const*)B.array,
+                                   B.ld,
+                                   (const T*)beta,
+                                   (T* const*)C.array,
+                                   C.ld,
+                                   batch_count);
+        if(A.array)
+            return F::syrkBatched(handle,
+                                  uplo,
+                                  trans,
+                                  n,
+                                  k,
+                                  (const T*)alpha,
+                                  (const T* const*)A.array,
+                                  A.ld,
+                                  (const T*)beta,
+                                  (T* const*)C.array,
+                                  C.ld,
+                                  batch_count);
+        if(strided && syr2k)
+            return F::syr2kStridedBatched(handle,
+                                          uplo,
+                                          trans,
+                                          n,
+                                          k,
+                                          (const T*)alpha,
+                                          (const T*)A.ptr,
+                                          A.ld,
+                                          A.stride,
+                                          (const T*)B.ptr,
+                                          B.ld,
+                                          B.stride,
+                                          (const T*)beta,
+                                          (T*)C.ptr,
+                                          C.ld,
+                                          C.stride,
+                                          batch_count);
+        if(strided)
+            return F::syrkStridedBatched(handle,
+                                         uplo,
+                                         trans,
+                                         n,
+                                         k,
+                                         (const T*)alpha,
+                                         (const T*)A.ptr,
+                                         A.ld,
+                                         A.stride,
+                                         (const T*)beta,
+                                         (T*)C.ptr,
+                                         C.ld,
+                                         C.stride,
+                                         batch_count);
+        if(syr2k)
+            return F::syr2k(handle,
+                            uplo,
+                            trans,
+                            n,
+                            k,
+                            (const T*)alpha,
+                            (const T*)A.ptr,
+                            A.ld,
+                            (const T*)B.ptr,
+                            B.ld,
+                            (const T*)beta,
+                            (T*)C.ptr,
+                            C.ld);
+        return F::syrk(handle,
+                       uplo,
+                       trans,
+                       n,
+                       k,
+                       (const T*)alpha,
+                       (const T*)A.ptr,
+                       A.ld,
+                       (const T*)beta,
+                       (T*)C.ptr,
+                       C.ld);
+    };
+    if(hipblasLevel3ExTyped(A.type, B.type, C.type, compute_type, status, typed))
+        return status;
+
+#ifdef HIPBLAS_LEVEL3_EX
+    if(!hipblasLevel3ExMixed(A.type, B.type, C.type, compute_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // Only the diagonal blocks of C, through W, are computed in full
+    int                 nb = std::min(n, level3_ex_block);
+    char*               work;
+    hipblasLevel3ExCall call{handle, nullptr, compute_type, batch_count, strided, !!A.array};
+    status = call.init(size_t(nb) * nb * batch_count * hipblasLevel3ExElementSize(C.type), work);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipblasLevel3ExOperand W{work, nullptr, C.type, nb, hipblasStride(nb) * nb};
+
+    // X(xi, xj) := alpha op(P) op(Q)^T + beta_x X(xi, xj) on rows r of op(P) and c of op(Q)
+    auto product = [&](const hipblasLevel3ExOperand& P,
+                       const hipblasLevel3ExOperand& Q,
+                       int                           rows,
+                       int                           cols,
+                       int                           r,
+                       int                           c,
+                       const void*                   beta_x,
+                       const hipblasLevel3ExOperand& X,
+                       int                           xi,
+                       int                           xj) {
+        hipblasOperation_t trans_p = trans_n ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+        hipblasOperation_t trans_q = trans_n ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+        int                pi = trans_n ? r : 0, pj = trans_n ? 0 : r;
+        int                qi = trans_n ? c : 0, qj = trans_n ? 0 : c;
+        return call.gemm(
+            trans_p, trans_q, rows, cols, k, alpha, P, pi, pj, Q, qi, qj, beta_x, X, xi, xj);
+    };
+    auto update = [&](int                           rows,
+                      int                           cols,
+                      int                           r,
+                      int                           c,
+                      const hipblasLevel3ExOperand& X,
+                      int                           xi,
+                      int                           xj) {
+        hipblasStatus_t status = product(A, B, rows, cols, r, c, beta, X, xi, xj);
+        if(status == HIPBLAS_STATUS_SUCCESS && syr2k)
+            status = product(B, A, rows, cols, r, c, call.one, X, xi, xj);
+        return status;
+    };
+
+    bool lower = uplo == HIPBLAS_FILL_MODE_LOWER;
+    for(int j0 = 0; j0 < n && status == HIPBLAS_STATUS_SUCCESS; j0 += nb)
+    {
+        int jb = std::min(nb, n - j0);
+        int i0 = lower ? j0 + jb : 0;
+        int ib = lower ? n - j0 - jb : j0;
+
+        status = call.triangle(uplo, hipblasTriangleFill::keep, false, jb, jb, C, j0, j0, W, 0, 0);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = update(jb, jb, j0, j0, W, 0, 0);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status
+                = call.triangle(uplo, hipblasTriangleFill::keep, false, jb, jb, W, 0, 0, C, j0, j0);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = update(ib, jb, i0, j0, C, i0, j0);
+    }
+    return status;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// C := alpha op(A) B or alpha B op(A) with A triangular, which may be computed in place in B
+static hipblasStatus_t hipblasLevel3ExTrmm(hipblasHandle_t               handle,
+                                           hipblasSideMode_t             side,
+                                           hipblasFillMode_t             uplo,
+                                           hipblasOperation_t            transA,
+                                           hipblasDiagType_t             diag,
+                                           int                           m,
+                                           int                           n,
+                                           const void*                   alpha,
+                                           const hipblasLevel3ExOperand& A,
+                                           const hipblasLevel3ExOperand& B,
+                                           const hipblasLevel3ExOperand& C,
+                                           hipblasComputeType_t          compute_type,
+                                           int                           batch_count,
+                                           bool                          strided)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    bool left    = side == HIPBLAS_SIDE_LEFT;
+    bool trans_n = transA == HIPBLAS_OP_N;
+    int  ka      = left ? m : n;
+    if((!left && side != HIPBLAS_SIDE_RIGHT)
+       || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+       || (!trans_n && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+       || (diag != HIPBLAS_DIAG_UNIT && diag != HIPBLAS_DIAG_NON_UNIT))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m < 0 || n < 0 || batch_count < 0 || A.ld < std::max(1, ka) || B.ld < std::max(1, m)
+       || C.ld < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || hipblasLevel3ExNull(A) || hipblasLevel3ExNull(B) || hipblasLevel3ExNull(C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    auto            typed  = [&](auto t) {
+        using T = decltype(t);
+        using F = hipblasLevel3ExFunctions<T>;
+        if(A.array)
+            return F::trmmBatched(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  n,
+                                  (const T*)alpha,
+                                  (const T* const*)A.array,
+                                  A.ld,
+                                  (const T* const*)B.array,
+                                  B.ld,
+                                  (T* const*)C.array,
+                                  C.ld,
+                                  batch_count);
+        if(strided)
+            return F::trmmStridedBatched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         (const T*)alpha,
+                                         (const T*)A.ptr,
+                                         A.ld,
+                                         A.stride,
+                                         (const T*)B.ptr,
+                                         B.ld,
+                                         B.stride,
+                                         (T*)C.ptr,
+                                         C.ld,
+                                         C.stride,
+                                         batch_count);
+        return F::trmm(handle,
+                       side,
+                       uplo,
+                       transA,
+                       diag,
+                       m,
+                       n,
+                       (const T*)alpha,
+                       (const T*)A.ptr,
+                       A.ld,
+                       (const T*)B.ptr,
+                       B.ld,
+                       (T*)C.ptr,
+                       C.ld);
+    };
+    if(hipblasLevel3ExTyped(A.type, B.type, C.type, compute_type, status, typed))
+        return status;
+
+#ifdef HIPBLAS_LEVEL3_EX
+    if(!hipblasLevel3ExMixed(A.type, B.type, C.type, compute_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // A is expanded into W with zeros in its other triangle, and in place B is copied to WB
+    bool   in_place = A.array ? B.array == C.array : B.ptr == C.ptr;
+    size_t a_bytes  = size_t(ka) * ka * batch_count * hipblasLevel3ExElementSize(A.type);
+    size_t b_bytes  = in_place ? size_t(m) * n * batch_count * hipblasLevel3ExElementSize(B.type)
+                               : 0;
+    if(in_place && (B.ld != C.ld || B.type != C.type))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    char*               work;
+    hipblasLevel3ExCall call{handle, nullptr, compute_type, batch_count, strided, !!A.array};
+    status = call.init((a_bytes + 255) / 256 * 256 + b_bytes, work);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipblasLevel3ExOperand W{work, nullptr, A.type, ka, hipblasStride(ka) * ka};
+    hipblasLevel3ExOperand WB{
+        work + (a_bytes + 255) / 256 * 256, nullptr, B.type, m, hipblasStride(m) * n};
+
+    status = call.triangle(
+        uplo, hipblasTriangleFill::zero, diag == HIPBLAS_DIAG_UNIT, ka, ka, A, 0, 0, W, 0, 0);
+    if(status == HIPBLAS_STATUS_SUCCESS && in_place)
+        status = call.triangle(uplo, hipblasTriangleFill::copy, false, m, n, B, 0, 0, WB, 0, 0);
+    const hipblasLevel3ExOperand& X = in_place ? WB : B;
+
+    // Each block of rows or columns of C only takes the part of op(A) that is not zero
+    bool               lower   = (uplo == HIPBLAS_FILL_MODE_LOWER) == trans_n;
+    hipblasOperation_t trans_w = trans_n ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    for(int i0 = 0; i0 < ka && status == HIPBLAS_STATUS_SUCCESS; i0 += level3_ex_block)
+    {
+        int ib = std::min(level3_ex_block, ka - i0);
+        if(left)
+        {
+            // C(i0, 0) := alpha op(A)(i0, k0) B(k0, 0)
+            int k0 = lower ? 0 : i0;
+            int kb = lower ? i0 + ib : m - i0;
+            int wi = trans_n ? i0 : k0, wj = trans_n ? k0 : i0;
+            status = call.gemm(
+                trans_w, HIPBLAS_OP_N, ib, n, kb, alpha, W, wi, wj, X, k0, 0, call.zero, C, i0, 0);
+        }
+        else
+        {
+            // C(0, i0) := alpha B(0, k0) op(A)(k0, i0)
+            int k0 = lower ? i0 : 0;
+            int kb = lower ? n - i0 : i0 + ib;
+            int wi = trans_n ? k0 : i0, wj = trans_n ? i0 : k0;
+            status = call.gemm(
+                HIPBLAS_OP_N, trans_w, m, ib, kb, alpha, X, 0, k0, W, wi, wj, call.zero, C, 0, i0);
+        }
+    }
+    return status;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// C := alpha A B + beta C or alpha B A + beta C with A symmetric
+static hipblasStatus_t hipblasLevel3ExSymm(hipblasHandle_t               handle,
+                                           hipblasSideMode_t             side,
+                                           hipblasFillMode_t             uplo,
+                                           int                           m,
+                                           int                           n,
+                                           const void*                   alpha,
+                                           const hipblasLevel3ExOperand& A,
+                                           const hipblasLevel3ExOperand& B,
+                                           const void*                   beta,
+                                           const hipblasLevel3ExOperand& C,
+                                           hipblasComputeType_t          compute_type,
+                                           int                           batch_count,
+                                           bool                          strided)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    bool left = side == HIPBLAS_SIDE_LEFT;
+    int  ka   = left ? m : n;
+    if((!left && side != HIPBLAS_SIDE_RIGHT)
+       || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m < 0 || n < 0 || batch_count < 0 || A.ld < std::max(1, ka) || B.ld < std::max(1, m)
+       || C.ld < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || hipblasLevel3ExNull(A) || hipblasLevel3ExNull(B)
+       || hipblasLevel3ExNull(C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    auto            typed  = [&](auto t) {
+        using T = decltype(t);
+        using F = hipblasLevel3ExFunctions<T>;
+        if(A.array)
+            return F::symmBatched(handle,
+                                  side,
+                                  uplo,
+                                  m,
+                                  n,
+                                  (const T*)alpha,
+                                  (const T* const*)A.array,
+                                  A.ld,
+                                  (const T* const*)B.array,
+                                  B.ld,
+                                  (const T*)beta,
+                                  (T* const*)C.array,
+                                  C.ld,
+                                  batch_count);
+        if(strided)
+            return F::symmStridedBatched(handle,
+                                         side,
+                                         uplo,
+                                         m,
+                                         n,
+                                         (const T*)alpha,
+                                         (const T*)A.ptr,
+                                         A.ld,
+                                         A.stride,
+                                         (const T*)B.ptr,
+                                         B.ld,
+                                         B.stride,
+                                         (const T*)beta,
+                                         (T*)C.ptr,
+                                         C.ld,
+                                         C.stride,
+                                         batch_count);
+        return F::symm(handle,
+                       side,
+                       uplo,
+                       m,
+                       n,
+                       (const T*)alpha,
+                       (const T*)A.ptr,
+                       A.ld,
+                       (const T*)B.ptr,
+                       B.ld,
+                       (const T*)beta,
+                       (T*)C.ptr,
+                       C.ld);
+    };
+    if(hipblasLevel3ExTyped(A.type, B.type, C.type, compute_type, status, typed))
+        return status;
+
+#ifdef HIPBLAS_LEVEL3_EX
+    if(!hipblasLevel3ExMixed(A.type, B.type, C.type, compute_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // A is expanded into W with the mirror of its triangle, then one gemm
+    char*               work;
+    hipblasLevel3ExCall call{handle, nullptr, compute_type, batch_count, strided, !!A.array};
+    status = call.init(size_t(ka) * ka * batch_count * hipblasLevel3ExElementSize(A.type), work);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipblasLevel3ExOperand W{work, nullptr, A.type, ka, hipblasStride(ka) * ka};
+
+    status = call.triangle(uplo, hipblasTriangleFill::mirror, false, ka, ka, A, 0, 0, W, 0, 0);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return call.gemm(HIPBLAS_OP_N,
+                     HIPBLAS_OP_N,
+                     m,
+                     n,
+                     ka,
+                     alpha,
+                     left ? W : B,
+                     0,
+                     0,
+                     left ? B : W,
+                     0,
+                     0,
+                     beta,
+                     C,
+                     0,
+                     0);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasSyrkEx(hipblasHandle_t      handle,
+                                         hipblasFillMode_t    uplo,
+                                         hipblasOperation_t   transA,
+                                         int                  n,
+                                         int                  k,
+                                         const void*          alpha,
+                                         const void*          A,
+                                         hipDataType          aType,
+                                         int                  lda,
+                                         const void*          beta,
+                                         void*                C,
+                                         hipDataType          cType,
+                                         int                  ldc,
+                                         hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(
+        handle, uplo, transA, n, k, alpha, A, aType, lda, beta, C, cType, ldc, computeType);
+    return hipblasLevel3ExRankK(handle,
+                                false,
+                                uplo,
+                                transA,
+                                n,
+                                k,
+                                alpha,
+                                {A, nullptr, aType, lda, 0},
+                                {A, nullptr, aType, lda, 0},
+                                beta,
+                                {C, nullptr, cType, ldc, 0},
+                                computeType,
+                                1,
+                                false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSyrkBatchedEx(hipblasHandle_t      handle,
+                                                hipblasFillMode_t    uplo,
+                                                hipblasOperation_t   transA,
+                                                int                  n,
+                                                int                  k,
+                                                const void*          alpha,
+                                                const void* const    A[],
+                                                hipDataType          aType,
+                                                int                  lda,
+                                                const void*          beta,
+                                                void* const          C[],
+                                                hipDataType          cType,
+                                                int                  ldc,
+                                                int                  batchCount,
+                                                hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  uplo,
+                  transA,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  batchCount,
+                  computeType);
+    return hipblasLevel3ExRankK(handle,
+                                false,
+                                uplo,
+                                transA,
+                                n,
+                                k,
+                                alpha,
+                                {nullptr, A, aType, lda, 0},
+                                {nullptr, A, aType, lda, 0},
+                                beta,
+                                {nullptr, (const void* const*)C, cType, ldc, 0},
+                                computeType,
+                                batchCount,
+                                false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSyrkStridedBatchedEx(hipblasHandle_t      handle,
+                                                       hipblasFillMode_t    uplo,
+                                                       hipblasOperation_t   transA,
+                                                       int                  n,
+                                                       int                  k,
+                                                       const void*          alpha,
+                                                       const void*          A,
+                                                       hipDataType          aType,
+                                                       int                  lda,
+                                                       hipblasStride        strideA,
+                                                       const void*          beta,
+                                                       void*                C,
+                                                       hipDataType          cType,
+                                                       int                  ldc,
+                                                       hipblasStride        strideC,
+                                                       int                  batchCount,
+                                                       hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  uplo,
+                  transA,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  strideA,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  strideC,
+                  batchCount,
+                  computeType);
+    return hipblasLevel3ExRankK(handle,
+                                false,
+                                uplo,
+                                transA,
+                                n,
+                                k,
+                                alpha,
+                                {A, nullptr, aType, lda, strideA},
+                                {A, nullptr, aType, lda, strideA},
+                                beta,
+                                {C, nullptr, cType, ldc, strideC},
+                                computeType,
+                                batchCount,
+                                true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSyr2kEx(hipblasHandle_t      handle,
+                                          hipblasFillMode_t    uplo,
+                                          hipblasOperation_t   transA,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          aType,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          bType,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          cType,
+                                          int                  ldc,
+                                          hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  uplo,
+                  transA,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  B,
+                  bType,
+                  ldb,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  computeType);
+    return hipblasLevel3ExRankK(handle,
+                                true,
+                                uplo,
+                                transA,
+                                n,
+                                k,
+                                alpha,
+                                {A, nullptr, aType, lda, 0},
+                                {B, nullptr, bType, ldb, 0},
+                                beta,
+                                {C, nullptr, cType, ldc, 0},
+                                computeType,
+                                1,
+                                false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSyr2kBatchedEx(hipblasHandle_t      handle,
+                                                 hipblasFillMode_t    uplo,
+                                                 hipblasOperation_t   transA,
+                                                 int                  n,
+                                                 int                  k,
+                                                 const void*          alpha,
+                                                 const void* const    A[],
+                                                 hipDataType          aType,
+                                                 int                  lda,
+                                                 const void* const    B[],
+                                                 hipDataType          bType,
+                                                 int                  ldb,
+                                                 const void*          beta,
+                                                 void* const          C[],
+                                                 hipDataType          cType,
+                                                 int                  ldc,
+                                                 int                  batchCount,
+                                                 hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  uplo,
+                  transA,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  B,
+                  bType,
+                  ldb,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  batchCount,
+                  computeType);
+    return hipblasLevel3ExRankK(handle,
+                                true,
+                                uplo,
+                                transA,
+                                n,
+                                k,
+                                alpha,
+                                {nullptr, A, aType, lda, 0},
+                                {nullptr, B, bType, ldb, 0},
+                                beta,
+                                {nullptr, (const void* const*)C, cType, ldc, 0},
+                                computeType,
+                                batchCount,
+                                false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSyr2kStridedBatchedEx(hipblasHandle_t      handle,
+                                                        hipblasFillMode_t    uplo,
+                                                        hipblasOperation_t   transA,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        const void*          A,
+                                                        hipDataType          aType,
+                                                        int                  lda,
+                                                        hipblasStride        strideA,
+                                                        const void*          B,
+                                                        hipDataType          bType,
+                                                        int                  ldb,
+                                                        hipblasStride        strideB,
+                                                        const void*          beta,
+                                                        void*                C,
+                                                        hipDataType          cType,
+                                                        int                  ldc,
+                                                        hipblasStride        strideC,
+                                                        int                  batchCount,
+                                                        hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  uplo,
+                  transA,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  strideA,
+                  B,
+                  bType,
+                  ldb,
+                  strideB,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  strideC,
+                  batchCount,
+                  computeType);
+    return hipblasLevel3ExRankK(handle,
+                                true,
+                                uplo,
+                                transA,
+                                n,
+                                k,
+                                alpha,
+                                {A, nullptr, aType, lda, strideA},
+                                {B, nullptr, bType, ldb, strideB},
+                                beta,
+                                {C, nullptr, cType, ldc, strideC},
+                                computeType,
+                                batchCount,
+                                true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasTrmmEx(hipblasHandle_t      handle,
+                                         hipblasSideMode_t    side,
+                                         hipblasFillMode_t    uplo,
+                                         hipblasOperation_t   transA,
+                                         hipblasDiagType_t    diag,
+                                         int                  m,
+                                         int                  n,
+                                         const void*          alpha,
+                                         const void*          A,
+                                         hipDataType          aType,
+                                         int                  lda,
+                                         const void*          B,
+                                         hipDataType          bType,
+                                         int                  ldb,
+                                         void*                C,
+                                         hipDataType          cType,
+                                         int                  ldc,
+                                         hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  side,
+                  uplo,
+                  transA,
+                  diag,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  B,
+                  bType,
+                  ldb,
+                  C,
+                  cType,
+                  ldc,
+                  computeType);
+    return hipblasLevel3ExTrmm(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               {A, nullptr, aType, lda, 0},
+                               {B, nullptr, bType, ldb, 0},
+                               {C, nullptr, cType, ldc, 0},
+                               computeType,
+                               1,
+                               false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasTrmmBatchedEx(hipblasHandle_t      handle,
+                                                hipblasSideMode_t    side,
+                                                hipblasFillMode_t    uplo,
+                                                hipblasOperation_t   transA,
+                                                hipblasDiagType_t    diag,
+                                                int                  m,
+                                                int                  n,
+                                                const void*          alpha,
+                                                const void* const    A[],
+                                                hipDataType          aType,
+                                                int                  lda,
+                                                const void* const    B[],
+                                                hipDataType          bType,
+                                                int                  ldb,
+                                                void* const          C[],
+                                                hipDataType          cType,
+                                                int                  ldc,
+                                                int                  batchCount,
+                                                hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  side,
+                  uplo,
+                  transA,
+                  diag,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  B,
+                  bType,
+                  ldb,
+                  C,
+                  cType,
+                  ldc,
+                  batchCount,
+                  computeType);
+    return hipblasLevel3ExTrmm(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               {nullptr, A, aType, lda, 0},
+                               {nullptr, B, bType, ldb, 0},
+                               {nullptr, (const void* const*)C, cType, ldc, 0},
+                               computeType,
+                               batchCount,
+                               false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasTrmmStridedBatchedEx(hipblasHandle_t      handle,
+                                                       hipblasSideMode_t    side,
+                                                       hipblasFillMode_t    uplo,
+                                                       hipblasOperation_t   transA,
+                                                       hipblasDiagType_t    diag,
+                                                       int                  m,
+                                                       int                  n,
+                                                       const void*          alpha,
+                                                       const void*          A,
+                                                       hipDataType          aType,
+                                                       int                  lda,
+                                                       hipblasStride        strideA,
+                                                       const void*          B,
+                                                       hipDataType          bType,
+                                                       int                  ldb,
+                                                       hipblasStride        strideB,
+                                                       void*                C,
+                                                       hipDataType          cType,
+                                                       int                  ldc,
+                                                       hipblasStride        strideC,
+                                                       int                  batchCount,
+                                                       hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  side,
+                  uplo,
+                  transA,
+                  diag,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  strideA,
+                  B,
+                  bType,
+                  ldb,
+                  strideB,
+                  C,
+                  cType,
+                  ldc,
+                  strideC,
+                  batchCount,
+                  computeType);
+    return hipblasLevel3ExTrmm(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               {A, nullptr, aType, lda, strideA},
+                               {B, nullptr, bType, ldb, strideB},
+                               {C, nullptr, cType, ldc, strideC},
+                               computeType,
+                               batchCount,
+                               true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSymmEx(hipblasHandle_t      handle,
+                                         hipblasSideMode_t    side,
+                                         hipblasFillMode_t    uplo,
+                                         int                  m,
+                                         int                  n,
+                                         const void*          alpha,
+                                         const void*          A,
+                                         hipDataType          aType,
+                                         int                  lda,
+                                         const void*          B,
+                                         hipDataType          bType,
+                                         int                  ldb,
+                                         const void*          beta,
+                                         void*                C,
+                                         hipDataType          cType,
+                                         int                  ldc,
+                                         hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  side,
+                  uplo,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  B,
+                  bType,
+                  ldb,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  computeType);
+    return hipblasLevel3ExSymm(handle,
+                               side,
+                               uplo,
+                               m,
+                               n,
+                               alpha,
+                               {A, nullptr, aType, lda, 0},
+                               {B, nullptr, bType, ldb, 0},
+                               beta,
+                               {C, nullptr, cType, ldc, 0},
+                               computeType,
+                               1,
+                               false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSymmBatchedEx(hipblasHandle_t      handle,
+                                                hipblasSideMode_t    side,
+                                                hipblasFillMode_t    uplo,
+                                                int                  m,
+                                                int                  n,
+                                                const void*          alpha,
+                                                const void* const    A[],
+                                                hipDataType          aType,
+                                                int                  lda,
+                                                const void* const    B[],
+                                                hipDataType          bType,
+                                                int                  ldb,
+                                                const void*          beta,
+                                                void* const          C[],
+                                                hipDataType          cType,
+                                                int                  ldc,
+                                                int                  batchCount,
+                                                hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  side,
+                  uplo,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  B,
+                  bType,
+                  ldb,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  batchCount,
+                  computeType);
+    return hipblasLevel3ExSymm(handle,
+                               side,
+                               uplo,
+                               m,
+                               n,
+                               alpha,
+                               {nullptr, A, aType, lda, 0},
+                               {nullptr, B, bType, ldb, 0},
+                               beta,
+                               {nullptr, (const void* const*)C, cType, ldc, 0},
+                               computeType,
+                               batchCount,
+                               false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSymmStridedBatchedEx(hipblasHandle_t      handle,
+                                                       hipblasSideMode_t    side,
+                                                       hipblasFillMode_t    uplo,
+                                                       int                  m,
+                                                       int                  n,
+                                                       const void*          alpha,
+                                                       const void*          A,
+                                                       hipDataType          aType,
+                                                       int                  lda,
+                                                       hipblasStride        strideA,
+                                                       const void*          B,
+                                                       hipDataType          bType,
+                                                       int                  ldb,
+                                                       hipblasStride        strideB,
+                                                       const void*          beta,
+                                                       void*                C,
+                                                       hipDataType          cType,
+                                                       int                  ldc,
+                                                       hipblasStride        strideC,
+                                                       int                  batchCount,
+                                                       hipblasComputeType_t computeType)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  side,
+                  uplo,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  aType,
+                  lda,
+                  strideA,
+                  B,
+                  bType,
+                  ldb,
+                  strideB,
+                  beta,
+                  C,
+                  cType,
+                  ldc,
+                  strideC,
+                  batchCount,
+                  computeType);
+    return hipblasLevel3ExSymm(handle,
+                               side,
+                               uplo,
+                               m,
+                               n,
+                               alpha,
+                               {A, nullptr, aType, lda, strideA},
+                               {B, nullptr, bType, ldb, strideB},
+                               beta,
+                               {C, nullptr, cType, ldc, strideC},
+                               computeType,
+                               batchCount,
+                               true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,232 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "level3_ex.hpp"
+#include <algorithm>
+#include <cstdint>
+
+// Rows and columns of the tile of a work group, and rows of threads: each thread writes
+// triangle_tile / triangle_rows elements of a column of the tile
+constexpr int triangle_tile = 32;
+constexpr int triangle_rows = 8;
+
+// Largest grid in y and z. The work groups loop over the remaining column tiles and matrices.
+constexpr int triangle_max_grid = 65535;
+
+// Threads of a work group of hipblasOffsetPointers
+constexpr int offset_threads = 256;
+
+// Work group (x, y) writes the tile of Y at rows x * triangle_tile and columns y * triangle_tile.
+// The elements are moved as unsigned integers of their size, so one holds the bits of a one.
+template <typename T>
+__global__ void __launch_bounds__(triangle_tile* triangle_rows)
+    hipblasTriangleKernel(int                 m,
+                          int                 n,
+                          bool                upper,
+                          hipblasTriangleFill fill,
+                          bool                unit_diag,
+                          T                   one,
+                          const T*            X,
+                          const T* const*     X_array,
+                          size_t              offset_X,
+                          int                 ldx,
+                          hipblasStride       stride_X,
+                          T*                  Y,
+                          T* const*           Y_array,
+                          size_t              offset_Y,
+                          int                 ldy,
+                          hipblasStride       stride_Y,
+                          int                 batch_count)
+{
+    int i       = blockIdx.x * triangle_tile + threadIdx.x;
+    int n_tiles = (n + triangle_tile - 1) / triangle_tile;
+    if(i >= m)
+        return;
+
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        const T* x = (X_array ? X_array[b] : X + b * stride_X) + offset_X;
+        T*       y = (Y_array ? Y_array[b] : Y + b * stride_Y) + offset_Y;
+        for(int jt = blockIdx.y; jt < n_tiles; jt += gridDim.y)
+        {
+            int j_end = min(n, (jt + 1) * triangle_tile);
+            for(int j = jt * triangle_tile + threadIdx.y; j < j_end; j += triangle_rows)
+            {
+                bool inside = upper ? i <= j : i >= j;
+                if(unit_diag && i == j)
+                    y[i + size_t(j) * ldy] = one;
+                else if(inside || fill == hipblasTriangleFill::copy)
+                    y[i + size_t(j) * ldy] = x[i + size_t(j) * ldx];
+                else if(fill == hipblasTriangleFill::mirror)
+                    y[i + size_t(j) * ldy] = x[j + size_t(i) * ldx];
+                else if(fill == hipblasTriangleFill::zero)
+                    y[i + size_t(j) * ldy] = T(0);
+            }
+        }
+    }
+}
+
+__global__ void __launch_bounds__(offset_threads)
+    hipblasOffsetPointers(const char* const* in,
+                          const char*        base,
+                          size_t             stride_bytes,
+                          size_t             offset_bytes,
+                          char**             out,
+                          int                batch_count)
+{
+    int b = blockIdx.x * offset_threads + threadIdx.x;
+    if(b < batch_count)
+        out[b] = const_cast<char*>(in ? in[b] : base + b * stride_bytes) + offset_bytes;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasTriangleLaunch(hipStream_t         stream,
+                                             T                   one,
+                                             hipblasFillMode_t   uplo,
+                                             hipblasTriangleFill fill,
+                                             bool                unit_diag,
+                                             int                 m,
+                                             int                 n,
+                                             const void*         X,
+                                             const void* const*  X_array,
+                                             size_t              offset_X,
+                                             int                 ldx,
+                                             hipblasStride       stride_X,
+                                             void*               Y,
+                                             void* const*        Y_array,
+                                             size_t              offset_Y,
+                                             int                 ldy,
+                                             hipblasStride       stride_Y,
+                                             int                 batch_count)
+{
+    int  m_tiles = (m + triangle_tile - 1) / triangle_tile;
+    int  n_tiles = (n + triangle_tile - 1) / triangle_tile;
+    dim3 grid(
+        m_tiles, std::min(n_tiles, triangle_max_grid), std::min(batch_count, triangle_max_grid));
+    dim3 threads(triangle_tile, triangle_rows);
+
+    hipLaunchKernelGGL(hipblasTriangleKernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       uplo == HIPBLAS_FILL_MODE_UPPER,
+                       fill,
+                       unit_diag,
+                       one,
+                       (const T*)X,
+                       (const T* const*)X_array,
+                       offset_X,
+                       ldx,
+                       stride_X,
+                       (T*)Y,
+                       (T* const*)Y_array,
+                       offset_Y,
+                       ldy,
+                       stride_Y,
+                       batch_count);
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasTriangleKernels(hipStream_t         stream,
+                                       hipDataType         type,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasTriangleFill fill,
+                                       bool                unit_diag,
+                                       int                 m,
+                                       int                 n,
+                                       const void*         X,
+                                       const void* const*  X_array,
+                                       size_t              offset_X,
+                                       int                 ldx,
+                                       hipblasStride       stride_X,
+                                       void*               Y,
+                                       void* const*        Y_array,
+                                       size_t              offset_Y,
+                                       int                 ldy,
+                                       hipblasStride       stride_Y,
+                                       int                 batch_count)
+{
+    auto launch = [&](auto one) {
+        return hipblasTriangleLaunch(stream,
+                                     one,
+                                     uplo,
+                                     fill,
+                                     unit_diag,
+                                     m,
+                                     n,
+                                     X,
+                                     X_array,
+                                     offset_X,
+                                     ldx,
+                                     stride_X,
+                                     Y,
+                                     Y_array,
+                                     offset_Y,
+                                     ldy,
+                                     stride_Y,
+                                     batch_count);
+    };
+
+    switch(type)
+    {
+    case HIP_R_16F:
+        return launch(uint16_t(0x3c00));
+    case HIP_R_16BF:
+        return launch(uint16_t(0x3f80));
+    case HIP_R_32F:
+        return launch(uint32_t(0x3f800000));
+    case HIP_R_64F:
+        return launch(uint64_t(0x3ff0000000000000));
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+hipblasStatus_t hipblasOffsetPointersKernel(hipStream_t        stream,
+                                            const void* const* in,
+                                            const void*        base,
+                                            size_t             stride_bytes,
+                                            size_t             offset_bytes,
+                                            void**             out,
+                                            int                batch_count)
+{
+    hipLaunchKernelGGL(hipblasOffsetPointers,
+                       dim3((batch_count + offset_threads - 1) / offset_threads),
+                       dim3(offset_threads),
+                       0,
+                       stream,
+                       (const char* const*)in,
+                       (const char*)base,
+                       stride_bytes,
+                       offset_bytes,
+                       (char**)out,
+                       batch_count);
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
@@ -0,0 +1,344 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "lu_solve.hpp"
+#include <algorithm>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+// getrs with a null ipiv solves with the factors of a getrf without pivoting, which exists for
+// matrices that need no row interchanges, such as diagonally dominant ones. The two triangular
+// solves go through the hipBLAS trsm functions of each form, so both backends share this file.
+
+// hipBLAS functions of each precision run by the solve without pivoting
+template <typename T>
+struct hipblasLuSolveFunctions;
+
+template <>
+struct hipblasLuSolveFunctions<float>
+{
+    static constexpr auto trsm               = hipblasStrsm;
+    static constexpr auto trsmBatched        = hipblasStrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasStrsmStridedBatched;
+};
+
+template <>
+struct hipblasLuSolveFunctions<double>
+{
+    static constexpr auto trsm               = hipblasDtrsm;
+    static constexpr auto trsmBatched        = hipblasDtrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasDtrsmStridedBatched;
+};
+
+template <>
+struct hipblasLuSolveFunctions<hipblasComplex>
+{
+    static constexpr auto trsm               = hipblasCtrsm;
+    static constexpr auto trsmBatched        = hipblasCtrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasCtrsmStridedBatched;
+};
+
+template <>
+struct hipblasLuSolveFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto trsm               = hipblasZtrsm;
+    static constexpr auto trsmBatched        = hipblasZtrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasZtrsmStridedBatched;
+};
+
+// B := op(T)^-1 B for the triangle T of A selected by uplo and diag, in the form of the arrays
+template <typename T>
+static hipblasStatus_t hipblasLuSolveTriangle(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasDiagType_t  diag,
+                                              hipblasOperation_t trans,
+                                              int                n,
+                                              int                nrhs,
+                                              T*                 A,
+                                              T* const*          A_array,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              T*                 B,
+                                              T* const*          B_array,
+                                              int                ldb,
+                                              hipblasStride      strideB,
+                                              int                batch_count,
+                                              bool               strided)
+{
+    using F = hipblasLuSolveFunctions<T>;
+
+    const T one = 1;
+    if(strided)
+        return F::trsmStridedBatched(handle,
+                                     HIPBLAS_SIDE_LEFT,
+                                     uplo,
+                                     trans,
+                                     diag,
+                                     n,
+                                     nrhs,
+                                     &one,
+                                     A,
+                                     lda,
+                                     strideA,
+                                     B,
+                                     ldb,
+                                     strideB,
+                                     batch_count);
+    if(A_array)
+        return F::trsmBatched(handle,
+                              HIPBLAS_SIDE_LEFT,
+                              uplo,
+                              trans,
+                              diag,
+                              n,
+                              nrhs,
+                              &one,
+                              A_array,
+                              lda,
+                              B_array,
+                              ldb,
+                              batch_count);
+    return F::trsm(handle, HIPBLAS_SIDE_LEFT, uplo, trans, diag, n, nrhs, &one, A, lda, B, ldb);
+}
+
+template <typename T>
+static hipblasStatus_t hipblasGetrsNoPivotTemplate(hipblasHandle_t    handle,
+                                                   hipblasOperation_t trans,
+                                                   int                n,
+                                                   int                nrhs,
+                                                   T*                 A,
+                                                   T* const*          A_array,
+                                                   int                lda,
+                                                   hipblasStride      strideA,
+                                                   T*                 B,
+                                                   T* const*          B_array,
+                                                   int                ldb,
+                                                   hipblasStride      strideB,
+                                                   int*               info,
+                                                   int                batch_count,
+                                                   bool               strided)
+{
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // strideA and strideP shift the positions of B and ldb in the strided batched form
+    const int   s = strided ? 2 : 0;
+    const void* a = strided || !A_array ? (const void*)A : A_array;
+    const void* b = strided || !B_array ? (const void*)B : B_array;
+    if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(a == nullptr && n)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(b == nullptr && n * nrhs)
+        *info = -(7 + s);
+    else if(ldb < std::max(1, n))
+        *info = -(8 + s);
+    else if(batch_count < 0)
+        *info = strided ? -13 : -10;
+    else
+        *info = 0;
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !nrhs || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasPointerMode_t pointer_mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // A = L U with unit lower L, so op(A) X = B is L U X = B or U^T L^T X = B
+    const bool        no_trans = trans == HIPBLAS_OP_N;
+    hipblasFillMode_t first    = no_trans ? HIPBLAS_FILL_MODE_LOWER : HIPBLAS_FILL_MODE_UPPER;
+    hipblasFillMode_t second   = no_trans ? HIPBLAS_FILL_MODE_UPPER : HIPBLAS_FILL_MODE_LOWER;
+    for(hipblasFillMode_t uplo : {first, second})
+    {
+        hipblasDiagType_t diag
+            = uplo == HIPBLAS_FILL_MODE_LOWER ? HIPBLAS_DIAG_UNIT : HIPBLAS_DIAG_NON_UNIT;
+        status = hipblasLuSolveTriangle<T>(handle,
+                                           uplo,
+                                           diag,
+                                           trans,
+                                           n,
+                                           nrhs,
+                                           A,
+                                           A_array,
+                                           lda,
+                                           strideA,
+                                           B,
+                                           B_array,
+                                           ldb,
+                                           strideB,
+                                           batch_count,
+                                           strided);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+    }
+
+    hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+    return status == HIPBLAS_STATUS_SUCCESS ? restore : status;
+}
+
+hipblasStatus_t hipblasGetrsNoPivot(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    int                n,
+                                    int                nrhs,
+                                    float*             A,
+                                    float* const*      A_array,
+                                    int                lda,
+                                    hipblasStride      strideA,
+                                    float*             B,
+                                    float* const*      B_array,
+                                    int                ldb,
+                                    hipblasStride      strideB,
+                                    int*               info,
+                                    int                batch_count,
+                                    bool               strided)
+{
+    return hipblasGetrsNoPivotTemplate<float>(handle,
+                                              trans,
+                                              n,
+                                              nrhs,
+                                              A,
+                                              A_array,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              B_array,
+                                              ldb,
+                                              strideB,
+                                              info,
+                                              batch_count,
+                                              strided);
+}
+
+hipblasStatus_t hipblasGetrsNoPivot(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    int                n,
+                                    int                nrhs,
+                                    double*            A,
+                                    double* const*     A_array,
+                                    int                lda,
+                                    hipblasStride      strideA,
+                                    double*            B,
+                                    double* const*     B_array,
+                                    int                ldb,
+                                    hipblasStride      strideB,
+                                    int*               info,
+                                    int                batch_count,
+                                    bool               strided)
+{
+    return hipblasGetrsNoPivotTemplate<double>(handle,
+                                               trans,
+                                               n,
+                                               nrhs,
+                                               A,
+                                               A_array,
+                                               lda,
+                                               strideA,
+                                               B,
+                                               B_array,
+                                               ldb,
+                                               strideB,
+                                               info,
+                                               batch_count,
+                                               strided);
+}
+
+hipblasStatus_t hipblasGetrsNoPivot(hipblasHandle_t        handle,
+                                    hipblasOperation_t     trans,
+                                    int                    n,
+                                    int                    nrhs,
+                                    hipblasComplex*        A,
+                                    hipblasComplex* const* A_array,
+                                    int                    lda,
+                                    hipblasStride          strideA,
+                                    hipblasComplex*        B,
+                                    hipblasComplex* const* B_array,
+                                    int                    ldb,
+                                    hipblasStride          strideB,
+                                    int*                   info,
+                                    int                    batch_count,
+                                    bool                   strided)
+{
+    return hipblasGetrsNoPivotTemplate<hipblasComplex>(handle,
+                                                       trans,
+                                                       n,
+                                                       nrhs,
+                                                       A,
+                                                       A_array,
+                                                       lda,
+                                                       strideA,
+                                                       B,
+                                                       B_array,
+                                                       ldb,
+                                                       strideB,
+                                                       info,
+                                                       batch_count,
+                                                       strided);
+}
+
+hipblasStatus_t hipblasGetrsNoPivot(hipblasHandle_t              handle,
+                                    hipblasOperation_t           trans,
+                                    int                          n,
+                                    int                          nrhs,
+                                    hipblasDoubleComplex*        A,
+                                    hipblasDoubleComplex* const* A_array,
+                                    int                          lda,
+                                    hipblasStride                strideA,
+                                    hipblasDoubleComplex*        B,
+                                    hipblasDoubleComplex* const* B_array,
+                                    int                          ldb,
+                                    hipblasStride                strideB,
+                                    int*                         info,
+                                    int                          batch_count,
+                                    bool                         strided)
+{
+    return hipblasGetrsNoPivotTemplate<hipblasDoubleComplex>(handle,
+                                                             trans,
+                                                             n,
+                                                             nrhs,
+                                                             A,
+                                                             A_array,
+                                                             lda,
+                                                             strideA,
+                                                             B,
+                                                             B_array,
+                                                             ldb,
+                                                             strideB,
+                                                             info,
+                                                             batch_count,
+                                                             strided);
+}
+
+#endif
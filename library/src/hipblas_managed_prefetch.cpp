@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "managed_prefetch.hpp"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "shared_handle.hpp"
+#include <atomic>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <unordered_map>
+
+static std::mutex                                                        managed_prefetch_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasManagedPrefetchMode_t> managed_prefetch_modes;
+
+// Number of handles in a prefetch mode, so calls skip the lookup while there are none
+static std::atomic<int> managed_prefetch_handles{0};
+
+void hipblasManagedPrefetchErase(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(managed_prefetch_mutex);
+    if(managed_prefetch_modes.erase(handle))
+        managed_prefetch_handles--;
+}
+
+static bool hipblasManagedPrefetchIsManaged(const void* ptr)
+{
+    hipPointerAttribute_t attributes;
+    if(hipPointerGetAttributes(&attributes, ptr) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return false;
+    }
+#if HIP_VERSION >= 60000000
+    return attributes.type == hipMemoryTypeManaged;
+#else
+    return attributes.isManaged;
+#endif
+}
+
+hipblasManagedPrefetch::hipblasManagedPrefetch(hipblasHandle_t              handle,
+                                               std::initializer_list<range> inputs)
+{
+    if(hipblas_deferred_depth != 1 || !managed_prefetch_handles.load(std::memory_order_relaxed)
+       || !handle || hipblasSharedHandleIs(handle))
+        return;
+
+    hipblasManagedPrefetchMode_t mode;
+    {
+        std::lock_guard<std::mutex> lock(managed_prefetch_mutex);
+        auto                        it = managed_prefetch_modes.find(handle);
+        if(it == managed_prefetch_modes.end())
+            return;
+        mode = it->second;
+    }
+
+    int                    device;
+    hipStream_t            handle_stream;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipGetDevice(&device) != hipSuccess
+       || hipblasGetStream(handle, &handle_stream) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(handle_stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+    {
+        (void)hipGetLastError();
+        return;
+    }
+
+    // A failed prefetch only leaves the pages to migrate on faults
+    for(const range& input : inputs)
+        if(input.ptr && input.bytes && hipblasManagedPrefetchIsManaged(input.ptr)
+           && hipMemPrefetchAsync(input.ptr, input.bytes, device, handle_stream) != hipSuccess)
+            (void)hipGetLastError();
+
+    const range& last = *(inputs.end() - 1);
+    if(mode == HIPBLAS_MANAGED_PREFETCH_INPUTS_OUTPUTS && last.ptr && last.bytes
+       && hipblasManagedPrefetchIsManaged(last.ptr))
+    {
+        stream = handle_stream;
+        output = last;
+    }
+}
+
+hipblasManagedPrefetch::~hipblasManagedPrefetch()
+{
+    if(output.ptr
+       && hipMemPrefetchAsync(output.ptr, output.bytes, hipCpuDeviceId, stream) != hipSuccess)
+        (void)hipGetLastError();
+}
+
+extern "C" hipblasStatus_t hipblasSetManagedPrefetch(hipblasHandle_t              handle,
+                                                     hipblasManagedPrefetchMode_t mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_MANAGED_PREFETCH_OFF && mode != HIPBLAS_MANAGED_PREFETCH_INPUTS
+       && mode != HIPBLAS_MANAGED_PREFETCH_INPUTS_OUTPUTS)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    std::lock_guard<std::mutex> lock(managed_prefetch_mutex);
+    if(mode == HIPBLAS_MANAGED_PREFETCH_OFF)
+    {
+        if(managed_prefetch_modes.erase(handle))
+            managed_prefetch_handles--;
+    }
+    else if(managed_prefetch_modes.emplace(handle, mode).second)
+        managed_prefetch_handles++;
+    else
+        managed_prefetch_modes[handle] = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetManagedPrefetch(hipblasHandle_t               handle,
+                                                     hipblasManagedPrefetchMode_t* mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(managed_prefetch_mutex);
+
+    auto it = managed_prefetch_modes.find(handle);
+    *mode   = it == managed_prefetch_modes.end() ? HIPBLAS_MANAGED_PREFETCH_OFF : it->second;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,878 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "offset_batched.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <type_traits>
+
+// Batched gemm and gemv on operands addressed by 32 bit offsets from one base pointer each, which
+// both backends share. Small real problems run kernels reading the offsets; the others expand the
+// offsets into stream-ordered pointer arrays for the batched routines of the backend.
+
+static hipblasStatus_t hipblasGemmBatchedT(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const float*       alpha,
+                                           const float* const A[],
+                                           int                lda,
+                                           const float* const B[],
+                                           int                ldb,
+                                           const float*       beta,
+                                           float* const       C[],
+                                           int                ldc,
+                                           int                batchCount)
+{
+    return hipblasSgemmBatched(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+static hipblasStatus_t hipblasGemmBatchedT(hipblasHandle_t     handle,
+                                           hipblasOperation_t  transA,
+                                           hipblasOperation_t  transB,
+                                           int                 m,
+                                           int                 n,
+                                           int                 k,
+                                           const double*       alpha,
+                                           const double* const A[],
+                                           int                 lda,
+                                           const double* const B[],
+                                           int                 ldb,
+                                           const double*       beta,
+                                           double* const       C[],
+                                           int                 ldc,
+                                           int                 batchCount)
+{
+    return hipblasDgemmBatched(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+static hipblasStatus_t hipblasGemmBatchedT(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transA,
+                                           hipblasOperation_t          transB,
+                                           int                         m,
+                                           int                         n,
+                                           int                         k,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int                         lda,
+                                           const hipblasComplex* const B[],
+                                           int                         ldb,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       C[],
+                                           int                         ldc,
+                                           int                         batchCount)
+{
+    return hipblasCgemmBatched(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+static hipblasStatus_t hipblasGemmBatchedT(hipblasHandle_t                   handle,
+                                           hipblasOperation_t                transA,
+                                           hipblasOperation_t                transB,
+                                           int                               m,
+                                           int                               n,
+                                           int                               k,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int                               lda,
+                                           const hipblasDoubleComplex* const B[],
+                                           int                               ldb,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int                               ldc,
+                                           int                               batchCount)
+{
+    return hipblasZgemmBatched(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+static hipblasStatus_t hipblasGemvBatchedT(hipblasHandle_t    handle,
+                                           hipblasOperation_t trans,
+                                           int                m,
+                                           int                n,
+                                           const float*       alpha,
+                                           const float* const A[],
+                                           int                lda,
+                                           const float* const x[],
+                                           int                incx,
+                                           const float*       beta,
+                                           float* const       y[],
+                                           int                incy,
+                                           int                batchCount)
+{
+    return hipblasSgemvBatched(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+
+static hipblasStatus_t hipblasGemvBatchedT(hipblasHandle_t     handle,
+                                           hipblasOperation_t  trans,
+                                           int                 m,
+                                           int                 n,
+                                           const double*       alpha,
+                                           const double* const A[],
+                                           int                 lda,
+                                           const double* const x[],
+                                           int                 incx,
+                                           const double*       beta,
+                                           double* const       y[],
+                                           int                 incy,
+                                           int                 batchCount)
+{
+    return hipblasDgemvBatched(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+
+static hipblasStatus_t hipblasGemvBatchedT(hipblasHandle_t             handle,
+                                           hipblasOperation_t          trans,
+                                           int                         m,
+                                           int                         n,
+                                           const hipblasComplex*       alpha,
+                                           const hipblasComplex* const A[],
+                                           int                         lda,
+                                           const hipblasComplex* const x[],
+                                           int                         incx,
+                                           const hipblasComplex*       beta,
+                                           hipblasComplex* const       y[],
+                                           int                         incy,
+                                           int                         batchCount)
+{
+    return hipblasCgemvBatched(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+
+static hipblasStatus_t hipblasGemvBatchedT(hipblasHandle_t                   handle,
+                                           hipblasOperation_t                trans,
+                                           int                               m,
+                                           int                               n,
+                                           const hipblasDoubleComplex*       alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int                               lda,
+                                           const hipblasDoubleComplex* const x[],
+                                           int                               incx,
+                                           const hipblasDoubleComplex*       beta,
+                                           hipblasDoubleComplex* const       y[],
+                                           int                               incy,
+                                           int                               batchCount)
+{
+    return hipblasZgemvBatched(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+
+#ifdef HIPBLAS_OFFSET_BATCHED
+// Expands the offsets of the three operands into pointer arrays in stream-ordered device memory
+// and runs batched on them, then frees the arrays on the stream
+template <typename Batched>
+static hipblasStatus_t hipblasOffsetExpand(hipblasHandle_t            handle,
+                                           const hipblasOffsetOperand operands[3],
+                                           size_t                     element_size,
+                                           int                        batch_count,
+                                           Batched&&                  batched)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    void** pointers = nullptr;
+    if(hipMallocAsync((void**)&pointers, 3 * sizeof(void*) * size_t(batch_count), stream)
+       != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    status = hipblasOffsetPointers(stream, operands, element_size, batch_count, pointers);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = batched(pointers, pointers + batch_count, pointers + 2 * size_t(batch_count));
+    if(hipFreeAsync(pointers, stream) != hipSuccess)
+        (void)hipGetLastError();
+    return status;
+}
+#endif
+
+// Checks the arguments as gemmBatched does, then runs the kernel reading the offsets or expands
+// them for the backend
+template <typename T>
+static hipblasStatus_t hipblasGemmOffset(hipblasHandle_t    handle,
+                                         hipblasOperation_t transA,
+                                         hipblasOperation_t transB,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const T*           alpha,
+                                         const T*           A,
+                                         int                lda,
+                                         const uint32_t*    offsetsA,
+                                         const T*           B,
+                                         int                ldb,
+                                         const uint32_t*    offsetsB,
+                                         const T*           beta,
+                                         T*                 C,
+                                         int                ldc,
+                                         const uint32_t*    offsetsC,
+                                         int                batchCount)
+{
+    auto valid_op = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    };
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!valid_op(transA) || !valid_op(transB))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0
+       || lda < std::max(1, transA == HIPBLAS_OP_N ? m : k)
+       || ldb < std::max(1, transB == HIPBLAS_OP_N ? k : n) || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || !offsetsC || (k && (!A || !offsetsA || !B || !offsetsB)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_OFFSET_BATCHED
+    if constexpr(std::is_same<T, float>{} || std::is_same<T, double>{})
+    {
+        if(std::max({m, n, k}) <= hipblas_offset_gemm_max_size)
+        {
+            hipblasPointerMode_t mode;
+            hipStream_t          stream;
+            hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGetStream(handle, &stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            const bool device = mode == HIPBLAS_POINTER_MODE_DEVICE;
+            return hipblasOffsetGemmKernel(stream,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           device ? alpha : nullptr,
+                                           device ? T(0) : *alpha,
+                                           A,
+                                           lda,
+                                           offsetsA,
+                                           B,
+                                           ldb,
+                                           offsetsB,
+                                           device ? beta : nullptr,
+                                           device ? T(0) : *beta,
+                                           C,
+                                           ldc,
+                                           offsetsC,
+                                           batchCount);
+        }
+    }
+
+    const hipblasOffsetOperand operands[3]
+        = {{k ? A : nullptr, offsetsA}, {k ? B : nullptr, offsetsB}, {C, offsetsC}};
+    return hipblasOffsetExpand(
+        handle, operands, sizeof(T), batchCount, [&](void** pA, void** pB, void** pC) {
+            return hipblasGemmBatchedT(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       (const T* const*)pA,
+                                       lda,
+                                       (const T* const*)pB,
+                                       ldb,
+                                       beta,
+                                       (T* const*)pC,
+                                       ldc,
+                                       batchCount);
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// Checks the arguments as gemvBatched does, then runs the kernel reading the offsets or expands
+// them for the backend
+template <typename T>
+static hipblasStatus_t hipblasGemvOffset(hipblasHandle_t    handle,
+                                         hipblasOperation_t trans,
+                                         int                m,
+                                         int                n,
+                                         const T*           alpha,
+                                         const T*           A,
+                                         int                lda,
+                                         const uint32_t*    offsetsA,
+                                         const T*           x,
+                                         int                incx,
+                                         const uint32_t*    offsetsx,
+                                         const T*           beta,
+                                         T*                 y,
+                                         int                incy,
+                                         const uint32_t*    offsetsy,
+                                         int                batchCount)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || lda < std::max(1, m) || !incx || !incy || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !A || !offsetsA || !x || !offsetsx || !y || !offsetsy)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_OFFSET_BATCHED
+    if constexpr(std::is_same<T, float>{} || std::is_same<T, double>{})
+    {
+        if(std::max(m, n) <= hipblas_offset_gemv_max_size)
+        {
+            hipblasPointerMode_t mode;
+            hipStream_t          stream;
+            hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGetStream(handle, &stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            const bool device = mode == HIPBLAS_POINTER_MODE_DEVICE;
+            return hipblasOffsetGemvKernel(stream,
+                                           trans,
+                                           m,
+                                           n,
+                                           device ? alpha : nullptr,
+                                           device ? T(0) : *alpha,
+                                           A,
+                                           lda,
+                                           offsetsA,
+                                           x,
+                                           incx,
+                                           offsetsx,
+                                           device ? beta : nullptr,
+                                           device ? T(0) : *beta,
+                                           y,
+                                           incy,
+                                           offsetsy,
+                                           batchCount);
+        }
+    }
+
+    const hipblasOffsetOperand operands[3] = {{A, offsetsA}, {x, offsetsx}, {y, offsetsy}};
+    return hipblasOffsetExpand(
+        handle, operands, sizeof(T), batchCount, [&](void** pA, void** px, void** py) {
+            return hipblasGemvBatchedT(handle,
+                                       trans,
+                                       m,
+                                       n,
+                                       alpha,
+                                       (const T* const*)pA,
+                                       lda,
+                                       (const T* const*)px,
+                                       incx,
+                                       beta,
+                                       (T* const*)py,
+                                       incy,
+                                       batchCount);
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasSgemmOffsetBatched(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int                lda,
+                                                     const uint32_t*    offsetsA,
+                                                     const float*       B,
+                                                     int                ldb,
+                                                     const uint32_t*    offsetsB,
+                                                     const float*       beta,
+                                                     float*             C,
+                                                     int                ldc,
+                                                     const uint32_t*    offsetsC,
+                                                     int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  offsetsA,
+                  B,
+                  ldb,
+                  offsetsB,
+                  beta,
+                  C,
+                  ldc,
+                  offsetsC,
+                  batchCount);
+    return hipblasGemmOffset(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             lda,
+                             offsetsA,
+                             B,
+                             ldb,
+                             offsetsB,
+                             beta,
+                             C,
+                             ldc,
+                             offsetsC,
+                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgemmOffsetBatched(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int                lda,
+                                                     const uint32_t*    offsetsA,
+                                                     const double*      B,
+                                                     int                ldb,
+                                                     const uint32_t*    offsetsB,
+                                                     const double*      beta,
+                                                     double*            C,
+                                                     int                ldc,
+                                                     const uint32_t*    offsetsC,
+                                                     int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  offsetsA,
+                  B,
+                  ldb,
+                  offsetsB,
+                  beta,
+                  C,
+                  ldc,
+                  offsetsC,
+                  batchCount);
+    return hipblasGemmOffset(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             lda,
+                             offsetsA,
+                             B,
+                             ldb,
+                             offsetsB,
+                             beta,
+                             C,
+                             ldc,
+                             offsetsC,
+                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgemmOffsetBatched(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasOperation_t    transB,
+                                                     int                   m,
+                                                     int                   n,
+                                                     int                   k,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* A,
+                                                     int                   lda,
+                                                     const uint32_t*       offsetsA,
+                                                     const hipblasComplex* B,
+                                                     int                   ldb,
+                                                     const uint32_t*       offsetsB,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       C,
+                                                     int                   ldc,
+                                                     const uint32_t*       offsetsC,
+                                                     int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  offsetsA,
+                  B,
+                  ldb,
+                  offsetsB,
+                  beta,
+                  C,
+                  ldc,
+                  offsetsC,
+                  batchCount);
+    return hipblasGemmOffset(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             lda,
+                             offsetsA,
+                             B,
+                             ldb,
+                             offsetsB,
+                             beta,
+                             C,
+                             ldc,
+                             offsetsC,
+                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgemmOffsetBatched(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasOperation_t          transB,
+                                                     int                         m,
+                                                     int                         n,
+                                                     int                         k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     const uint32_t*             offsetsA,
+                                                     const hipblasDoubleComplex* B,
+                                                     int                         ldb,
+                                                     const uint32_t*             offsetsB,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       C,
+                                                     int                         ldc,
+                                                     const uint32_t*             offsetsC,
+                                                     int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  offsetsA,
+                  B,
+                  ldb,
+                  offsetsB,
+                  beta,
+                  C,
+                  ldc,
+                  offsetsC,
+                  batchCount);
+    return hipblasGemmOffset(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             lda,
+                             offsetsA,
+                             B,
+                             ldb,
+                             offsetsB,
+                             beta,
+                             C,
+                             ldc,
+                             offsetsC,
+                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgemvOffsetBatched(hipblasHandle_t    handle,
+                                                     hipblasOperation_t trans,
+                                                     int                m,
+                                                     int                n,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int                lda,
+                                                     const uint32_t*    offsetsA,
+                                                     const float*       x,
+                                                     int                incx,
+                                                     const uint32_t*    offsetsx,
+                                                     const float*       beta,
+                                                     float*             y,
+                                                     int                incy,
+                                                     const uint32_t*    offsetsy,
+                                                     int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  trans,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  lda,
+                  offsetsA,
+                  x,
+                  incx,
+                  offsetsx,
+                  beta,
+                  y,
+                  incy,
+                  offsetsy,
+                  batchCount);
+    return hipblasGemvOffset(handle,
+                             trans,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             lda,
+                             offsetsA,
+                             x,
+                             incx,
+                             offsetsx,
+                             beta,
+                             y,
+                             incy,
+                             offsetsy,
+                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgemvOffsetBatched(hipblasHandle_t    handle,
+                                                     hipblasOperation_t trans,
+                                                     int                m,
+                                                     int                n,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int                lda,
+                                                     const uint32_t*    offsetsA,
+                                                     const double*      x,
+                                                     int                incx,
+                                                     const uint32_t*    offsetsx,
+                                                     const double*      beta,
+                                                     double*            y,
+                                                     int                incy,
+                                                     const uint32_t*    offsetsy,
+                                                     int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  trans,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  lda,
+                  offsetsA,
+                  x,
+                  incx,
+                  offsetsx,
+                  beta,
+                  y,
+                  incy,
+                  offsetsy,
+                  batchCount);
+    return hipblasGemvOffset(handle,
+                             trans,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             lda,
+                             offsetsA,
+                             x,
+                             incx,
+                             offsetsx,
+                             beta,
+                             y,
+                             incy,
+                             offsetsy,
+                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgemvOffsetBatched(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    trans,
+                                                     int                   m,
+                                                     int                   n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* A,
+                                                     int                   lda,
+                                                     const uint32_t*       offsetsA,
+                                                     const hipblasComplex* x,
+                                                     int                   incx,
+                                                     const uint32_t*       offsetsx,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int                   incy,
+                                                     const uint32_t*       offsetsy,
+                                                     int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  trans,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  lda,
+                  offsetsA,
+                  x,
+                  incx,
+                  offsetsx,
+                  beta,
+                  y,
+                  incy,
+                  offsetsy,
+                  batchCount);
+    return hipblasGemvOffset(handle,
+                             trans,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             lda,
+                             offsetsA,
+                             x,
+                             incx,
+                             offsetsx,
+                             beta,
+                             y,
+                             incy,
+                             offsetsy,
+                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgemvOffsetBatched(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          trans,
+                                                     int                         m,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     const uint32_t*             offsetsA,
+                                                     const hipblasDoubleComplex* x,
+                                                     int                         incx,
+                                                     const uint32_t*             offsetsx,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int                         incy,
+                                                     const uint32_t*             offsetsy,
+                                                     int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  trans,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  lda,
+                  offsetsA,
+                  x,
+                  incx,
+                  offsetsx,
+                  beta,
+                  y,
+                  incy,
+                  offsetsy,
+                  batchCount);
+    return hipblasGemvOffset(handle,
+                             trans,
+                             m,
+                             n,
+                             alpha,
+                             A,
+                             lda,
+                             offsetsA,
+                             x,
+                             incx,
+                             offsetsx,
+                             beta,
+                             y,
+                             incy,
+                             offsetsy,
+                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
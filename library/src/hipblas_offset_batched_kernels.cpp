@@ -0,0 +1,442 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "offset_batched.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+constexpr int offset_threads  = 256;
+constexpr int offset_max_grid = 65535;
+
+static int hipblasOffsetGrid(int64_t count)
+{
+    return int(std::min<int64_t>((count + offset_threads - 1) / offset_threads, offset_max_grid));
+}
+
+// Index of element i of a vector of length len with increment inc, which starts from the end
+// when inc is negative
+__device__ inline int64_t hipblasOffsetIndex(int i, int inc, int len)
+{
+    return inc > 0 ? int64_t(i) * inc : int64_t(len - 1 - i) * -inc;
+}
+
+__global__ void __launch_bounds__(offset_threads)
+    hipblasOffsetPointersKernel(hipblasOffsetOperand a,
+                                hipblasOffsetOperand b,
+                                hipblasOffsetOperand c,
+                                size_t               element_size,
+                                int                  batch_count,
+                                void**               pointers)
+{
+    for(int i = blockIdx.x * offset_threads + threadIdx.x; i < batch_count;
+        i += gridDim.x * offset_threads)
+    {
+        pointers[i] = a.base ? (char*)a.base + a.offsets[i] * element_size : nullptr;
+        pointers[batch_count + i]
+            = b.base ? (char*)b.base + b.offsets[i] * element_size : nullptr;
+        pointers[2 * int64_t(batch_count) + i]
+            = c.base ? (char*)c.base + c.offsets[i] * element_size : nullptr;
+    }
+}
+
+hipblasStatus_t hipblasOffsetPointers(hipStream_t                stream,
+                                      const hipblasOffsetOperand operands[3],
+                                      size_t                     element_size,
+                                      int                        batch_count,
+                                      void**                     pointers)
+{
+    hipLaunchKernelGGL(hipblasOffsetPointersKernel,
+                       dim3(hipblasOffsetGrid(batch_count)),
+                       dim3(offset_threads),
+                       0,
+                       stream,
+                       operands[0],
+                       operands[1],
+                       operands[2],
+                       element_size,
+                       batch_count,
+                       pointers);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// One thread per element of every C_i. The m * n threads of a problem read the same three
+// offsets, which the cache serves after the first. A and B are not read when alpha is zero, nor
+// C when beta is.
+template <typename T>
+__global__ void __launch_bounds__(offset_threads)
+    hipblasOffsetGemmKernelT(bool            trans_a,
+                             bool            trans_b,
+                             int             m,
+                             int             n,
+                             int             k,
+                             const T*        alpha_device,
+                             T               alpha_host,
+                             const T*        A,
+                             int             lda,
+                             const uint32_t* offsetsA,
+                             const T*        B,
+                             int             ldb,
+                             const uint32_t* offsetsB,
+                             const T*        beta_device,
+                             T               beta_host,
+                             T*              C,
+                             int             ldc,
+                             const uint32_t* offsetsC,
+                             int             batch_count)
+{
+    T alpha = alpha_device ? *alpha_device : alpha_host;
+    T beta  = beta_device ? *beta_device : beta_host;
+
+    const int64_t size  = int64_t(m) * n;
+    const int64_t count = size * batch_count;
+    for(int64_t t = int64_t(blockIdx.x) * offset_threads + threadIdx.x; t < count;
+        t += int64_t(gridDim.x) * offset_threads)
+    {
+        int64_t batch = t / size;
+        int     i     = int(t % size % m);
+        int     j     = int(t % size / m);
+
+        T sum = 0;
+        if(alpha != 0)
+        {
+            const T* a = A + offsetsA[batch];
+            const T* b = B + offsetsB[batch];
+            for(int l = 0; l < k; l++)
+                sum += (trans_a ? a[l + int64_t(i) * lda] : a[i + int64_t(l) * lda])
+                       * (trans_b ? b[j + int64_t(l) * ldb] : b[l + int64_t(j) * ldb]);
+        }
+
+        T& c = C[offsetsC[batch] + i + int64_t(j) * ldc];
+        c    = beta == 0 ? alpha * sum : alpha * sum + beta * c;
+    }
+}
+
+// One thread per element of every y_i
+template <typename T>
+__global__ void __launch_bounds__(offset_threads)
+    hipblasOffsetGemvKernelT(bool            trans,
+                             int             m,
+                             int             n,
+                             const T*        alpha_device,
+                             T               alpha_host,
+                             const T*        A,
+                             int             lda,
+                             const uint32_t* offsetsA,
+                             const T*        x,
+                             int             incx,
+                             const uint32_t* offsetsx,
+                             const T*        beta_device,
+                             T               beta_host,
+                             T*              y,
+                             int             incy,
+                             const uint32_t* offsetsy,
+                             int             batch_count)
+{
+    T alpha = alpha_device ? *alpha_device : alpha_host;
+    T beta  = beta_device ? *beta_device : beta_host;
+
+    const int     rows  = trans ? n : m;
+    const int     cols  = trans ? m : n;
+    const int64_t count = int64_t(rows) * batch_count;
+    for(int64_t t = int64_t(blockIdx.x) * offset_threads + threadIdx.x; t < count;
+        t += int64_t(gridDim.x) * offset_threads)
+    {
+        int64_t batch = t / rows;
+        int     i     = int(t % rows);
+
+        T sum = 0;
+        if(alpha != 0)
+        {
+            const T* a  = A + offsetsA[batch];
+            const T* xb = x + offsetsx[batch];
+            for(int l = 0; l < cols; l++)
+                sum += (trans ? a[l + int64_t(i) * lda] : a[i + int64_t(l) * lda])
+                       * xb[hipblasOffsetIndex(l, incx, cols)];
+        }
+
+        T& yi = y[offsetsy[batch] + hipblasOffsetIndex(i, incy, rows)];
+        yi    = beta == 0 ? alpha * sum : alpha * sum + beta * yi;
+    }
+}
+
+template <typename T>
+static hipblasStatus_t hipblasOffsetGemmLaunch(hipStream_t        stream,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const T*           alpha_device,
+                                               T                  alpha_host,
+                                               const T*           A,
+                                               int                lda,
+                                               const uint32_t*    offsetsA,
+                                               const T*           B,
+                                               int                ldb,
+                                               const uint32_t*    offsetsB,
+                                               const T*           beta_device,
+                                               T                  beta_host,
+                                               T*                 C,
+                                               int                ldc,
+                                               const uint32_t*    offsetsC,
+                                               int                batch_count)
+{
+    hipLaunchKernelGGL(hipblasOffsetGemmKernelT<T>,
+                       dim3(hipblasOffsetGrid(int64_t(m) * n * batch_count)),
+                       dim3(offset_threads),
+                       0,
+                       stream,
+                       transA != HIPBLAS_OP_N,
+                       transB != HIPBLAS_OP_N,
+                       m,
+                       n,
+                       k,
+                       alpha_device,
+                       alpha_host,
+                       A,
+                       lda,
+                       offsetsA,
+                       B,
+                       ldb,
+                       offsetsB,
+                       beta_device,
+                       beta_host,
+                       C,
+                       ldc,
+                       offsetsC,
+                       batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasOffsetGemvLaunch(hipStream_t        stream,
+                                               hipblasOperation_t trans,
+                                               int                m,
+                                               int                n,
+                                               const T*           alpha_device,
+                                               T                  alpha_host,
+                                               const T*           A,
+                                               int                lda,
+                                               const uint32_t*    offsetsA,
+                                               const T*           x,
+                                               int                incx,
+                                               const uint32_t*    offsetsx,
+                                               const T*           beta_device,
+                                               T                  beta_host,
+                                               T*                 y,
+                                               int                incy,
+                                               const uint32_t*    offsetsy,
+                                               int                batch_count)
+{
+    const int rows = trans == HIPBLAS_OP_N ? m : n;
+    hipLaunchKernelGGL(hipblasOffsetGemvKernelT<T>,
+                       dim3(hipblasOffsetGrid(int64_t(rows) * batch_count)),
+                       dim3(offset_threads),
+                       0,
+                       stream,
+                       trans != HIPBLAS_OP_N,
+                       m,
+                       n,
+                       alpha_device,
+                       alpha_host,
+                       A,
+                       lda,
+                       offsetsA,
+                       x,
+                       incx,
+                       offsetsx,
+                       beta_device,
+                       beta_host,
+                       y,
+                       incy,
+                       offsetsy,
+                       batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasOffsetGemmKernel(hipStream_t        stream,
+                                        hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const float*       alpha_device,
+                                        float              alpha_host,
+                                        const float*       A,
+                                        int                lda,
+                                        const uint32_t*    offsetsA,
+                                        const float*       B,
+                                        int                ldb,
+                                        const uint32_t*    offsetsB,
+                                        const float*       beta_device,
+                                        float              beta_host,
+                                        float*             C,
+                                        int                ldc,
+                                        const uint32_t*    offsetsC,
+                                        int                batch_count)
+{
+    return hipblasOffsetGemmLaunch(stream,
+                                   transA,
+                                   transB,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha_device,
+                                   alpha_host,
+                                   A,
+                                   lda,
+                                   offsetsA,
+                                   B,
+                                   ldb,
+                                   offsetsB,
+                                   beta_device,
+                                   beta_host,
+                                   C,
+                                   ldc,
+                                   offsetsC,
+                                   batch_count);
+}
+
+hipblasStatus_t hipblasOffsetGemmKernel(hipStream_t        stream,
+                                        hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const double*      alpha_device,
+                                        double             alpha_host,
+                                        const double*      A,
+                                        int                lda,
+                                        const uint32_t*    offsetsA,
+                                        const double*      B,
+                                        int                ldb,
+                                        const uint32_t*    offsetsB,
+                                        const double*      beta_device,
+                                        double             beta_host,
+                                        double*            C,
+                                        int                ldc,
+                                        const uint32_t*    offsetsC,
+                                        int                batch_count)
+{
+    return hipblasOffsetGemmLaunch(stream,
+                                   transA,
+                                   transB,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha_device,
+                                   alpha_host,
+                                   A,
+                                   lda,
+                                   offsetsA,
+                                   B,
+                                   ldb,
+                                   offsetsB,
+                                   beta_device,
+                                   beta_host,
+                                   C,
+                                   ldc,
+                                   offsetsC,
+                                   batch_count);
+}
+
+hipblasStatus_t hipblasOffsetGemvKernel(hipStream_t        stream,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const float*       alpha_device,
+                                        float              alpha_host,
+                                        const float*       A,
+                                        int                lda,
+                                        const uint32_t*    offsetsA,
+                                        const float*       x,
+                                        int                incx,
+                                        const uint32_t*    offsetsx,
+                                        const float*       beta_device,
+                                        float              beta_host,
+                                        float*             y,
+                                        int                incy,
+                                        const uint32_t*    offsetsy,
+                                        int                batch_count)
+{
+    return hipblasOffsetGemvLaunch(stream,
+                                   trans,
+                                   m,
+                                   n,
+                                   alpha_device,
+                                   alpha_host,
+                                   A,
+                                   lda,
+                                   offsetsA,
+                                   x,
+                                   incx,
+                                   offsetsx,
+                                   beta_device,
+                                   beta_host,
+                                   y,
+                                   incy,
+                                   offsetsy,
+                                   batch_count);
+}
+
+hipblasStatus_t hipblasOffsetGemvKernel(hipStream_t        stream,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const double*      alpha_device,
+                                        double             alpha_host,
+                                        const double*      A,
+                                        int                lda,
+                                        const uint32_t*    offsetsA,
+                                        const double*      x,
+                                        int                incx,
+                                        const uint32_t*    offsetsx,
+                                        const double*      beta_device,
+                                        double             beta_host,
+                                        double*            y,
+                                        int                incy,
+                                        const uint32_t*    offsetsy,
+                                        int                batch_count)
+{
+    return hipblasOffsetGemvLaunch(stream,
+                                   trans,
+                                   m,
+                                   n,
+                                   alpha_device,
+                                   alpha_host,
+                                   A,
+                                   lda,
+                                   offsetsA,
+                                   x,
+                                   incx,
+                                   offsetsx,
+                                   beta_device,
+                                   beta_host,
+                                   y,
+                                   incy,
+                                   offsetsy,
+                                   batch_count);
+}
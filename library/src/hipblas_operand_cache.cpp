@@ -0,0 +1,625 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "operand_cache.hpp"
+#include "exceptions.hpp"
+#include "gemm_tuning.hpp"
+#include "layer.hpp"
+#include "shared_handle.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// hipBLAS functions and tuning names of one precision
+template <typename T>
+struct hipblasOperandCacheTraits;
+
+template <>
+struct hipblasOperandCacheTraits<float>
+{
+    static constexpr auto                 gemv         = hipblasSgemv;
+    static constexpr auto                 gemm         = hipblasSgemm;
+    static constexpr auto                 geam         = hipblasSgeam;
+    static constexpr const char*          gemv_name    = "sgemv_operand_cache";
+    static constexpr hipDataType          type         = HIP_R_32F;
+    static constexpr hipblasComputeType_t compute_type = HIPBLAS_COMPUTE_32F;
+};
+
+template <>
+struct hipblasOperandCacheTraits<double>
+{
+    static constexpr auto                 gemv         = hipblasDgemv;
+    static constexpr auto                 gemm         = hipblasDgemm;
+    static constexpr auto                 geam         = hipblasDgeam;
+    static constexpr const char*          gemv_name    = "dgemv_operand_cache";
+    static constexpr hipDataType          type         = HIP_R_64F;
+    static constexpr hipblasComputeType_t compute_type = HIPBLAS_COMPUTE_64F;
+};
+
+// A registered operand and its transposed copy, if any, made for the rows x cols operand with
+// leading dimension ld. last_use is the clock of the last call that read the copy.
+struct hipblasOperandCopy
+{
+    int      rows     = 0;
+    int      cols     = 0;
+    int      ld       = 0;
+    size_t   bytes    = 0;
+    void*    data     = nullptr;
+    uint64_t last_use = 0;
+};
+
+struct hipblasOperandCache
+{
+    size_t                                              limit = 0;
+    size_t                                              used  = 0;
+    uint64_t                                            clock = 0;
+    std::unordered_map<const void*, hipblasOperandCopy> operands;
+
+    // hipFree waits for the calls still reading the copy
+    void free_copy(hipblasOperandCopy& copy)
+    {
+        if(!copy.data)
+            return;
+        (void)hipFree(copy.data);
+        used -= copy.bytes;
+        copy.data  = nullptr;
+        copy.bytes = 0;
+    }
+
+    // Frees the least recently used copies, other than those read by the call at clock now, until
+    // bytes more fit within the limit
+    bool make_room(size_t bytes, uint64_t now)
+    {
+        if(bytes > limit)
+            return false;
+        while(used + bytes > limit)
+        {
+            hipblasOperandCopy* oldest = nullptr;
+            for(auto& operand : operands)
+                if(operand.second.data && operand.second.last_use < now
+                   && (!oldest || operand.second.last_use < oldest->last_use))
+                    oldest = &operand.second;
+            if(!oldest)
+                return false;
+            free_copy(*oldest);
+        }
+        return true;
+    }
+
+    ~hipblasOperandCache()
+    {
+        for(auto& operand : operands)
+            free_copy(operand.second);
+    }
+};
+
+// The caches of the handles with a registration or a limit. operand_cache_handles counts them, so
+// calls on other handles skip the lock.
+static std::mutex                                               operand_cache_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasOperandCache> operand_caches;
+std::atomic<int>                                                operand_cache_handles{0};
+
+// Set while the cache makes calls of its own, which skip it
+static thread_local bool operand_cache_active = false;
+
+struct hipblasOperandCacheScope
+{
+    hipblasOperandCacheScope()
+    {
+        operand_cache_active = true;
+    }
+
+    ~hipblasOperandCacheScope()
+    {
+        operand_cache_active = false;
+    }
+};
+
+// Cache of handle, made if needed, with operand_cache_mutex held
+static hipblasOperandCache& hipblasOperandCacheGet(hipblasHandle_t handle)
+{
+    auto cache = operand_caches.try_emplace(handle);
+    if(cache.second)
+        operand_cache_handles++;
+    return cache.first->second;
+}
+
+// Forgets the cache of handle once it has neither a limit nor a registration
+static void hipblasOperandCacheTrim(hipblasHandle_t handle)
+{
+    auto cache = operand_caches.find(handle);
+    if(cache != operand_caches.end() && !cache->second.limit && cache->second.operands.empty())
+    {
+        operand_caches.erase(cache);
+        operand_cache_handles--;
+    }
+}
+
+void hipblasOperandCacheErase(hipblasHandle_t handle)
+{
+    if(!operand_cache_handles.load(std::memory_order_relaxed))
+        return;
+
+    std::lock_guard<std::mutex> lock(operand_cache_mutex);
+
+    if(operand_caches.erase(handle))
+        operand_cache_handles--;
+}
+
+// Transposed copy, cols x rows with leading dimension cols, of the rows x cols operand A with
+// leading dimension ld, made on the handle stream by geam if needed. nullptr when A is not
+// registered, its copy does not fit, or the stream is being captured. operand_cache_mutex is held.
+template <typename T>
+static const T* hipblasOperandCacheCopy(hipblasHandle_t      handle,
+                                        hipStream_t          stream,
+                                        hipblasOperandCache& cache,
+                                        uint64_t             now,
+                                        const T*             A,
+                                        int                  rows,
+                                        int                  cols,
+                                        int                  ld)
+{
+    auto operand = cache.operands.find(A);
+    if(operand == cache.operands.end())
+        return nullptr;
+
+    hipblasOperandCopy& copy = operand->second;
+    copy.last_use            = now;
+    if(copy.data && copy.rows == rows && copy.cols == cols && copy.ld == ld)
+        return static_cast<const T*>(copy.data);
+
+    // Allocations are not allowed while the stream is captured
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return nullptr;
+
+    cache.free_copy(copy);
+    size_t bytes = sizeof(T) * rows * cols;
+    if(!cache.make_room(bytes, now))
+        return nullptr;
+    if(hipMalloc(&copy.data, bytes) != hipSuccess)
+    {
+        copy.data = nullptr;
+        (void)hipGetLastError();
+        return nullptr;
+    }
+    copy.rows  = rows;
+    copy.cols  = cols;
+    copy.ld    = ld;
+    copy.bytes = bytes;
+    cache.used += bytes;
+
+    T*                   data = static_cast<T*>(copy.data);
+    const T              one = 1, zero = 0;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        status = hipblasOperandCacheTraits<T>::geam(handle,
+                                                    HIPBLAS_OP_T,
+                                                    HIPBLAS_OP_N,
+                                                    cols,
+                                                    rows,
+                                                    &one,
+                                                    A,
+                                                    ld,
+                                                    &zero,
+                                                    data,
+                                                    cols,
+                                                    data,
+                                                    cols);
+        (void)hipblasSetPointerMode(handle, mode);
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        cache.free_copy(copy);
+        return nullptr;
+    }
+    return data;
+}
+
+// Frees the copies of operands once the call as issued was found faster for key
+static void hipblasOperandCacheDrop(hipblasHandle_t           handle,
+                                    const std::string&        key,
+                                    std::vector<const void*>& operands)
+{
+    int choice;
+    if(!hipblasGemmTuningLookup(key, choice))
+        return;
+
+    std::lock_guard<std::mutex> lock(operand_cache_mutex);
+
+    auto cache = operand_caches.find(handle);
+    if(cache == operand_caches.end())
+        return;
+    for(const void* A : operands)
+    {
+        auto operand = cache->second.operands.find(A);
+        if(operand != cache->second.operands.end())
+            cache->second.free_copy(operand->second);
+    }
+}
+
+template <typename T>
+static bool hipblasOperandCacheGemvTemplate(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            const T*           alpha,
+                                            const T*           A,
+                                            int                lda,
+                                            const T*           x,
+                                            int                incx,
+                                            const T*           beta,
+                                            T*                 y,
+                                            int                incy,
+                                            hipblasStatus_t&   status)
+{
+    using traits = hipblasOperandCacheTraits<T>;
+
+    // Argument errors are left to the call as issued
+    if(trans == HIPBLAS_OP_N || operand_cache_active
+       || !operand_cache_handles.load(std::memory_order_relaxed) || m <= 0 || n <= 0
+       || lda < m || !incx || !incy || !alpha || !beta || !A || !x || !y)
+        return false;
+
+    // A real HIPBLAS_OP_C is HIPBLAS_OP_T, so both share the buckets of the transpose
+    std::string key = hipblasLevel2TuningKey(traits::gemv_name, HIPBLAS_OP_T, m, n);
+    int         choice;
+    if(hipblasGemmTuningLookup(key, choice) && !choice)
+        return false;
+
+    hipStream_t stream;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+
+    hipblasOperandCacheScope scope;
+    const T*                 At = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(operand_cache_mutex);
+
+        auto cache = operand_caches.find(handle);
+        if(cache == operand_caches.end() || !cache->second.limit)
+            return false;
+        uint64_t now = ++cache->second.clock;
+        At           = hipblasOperandCacheCopy(handle, stream, cache->second, now, A, m, n, lda);
+    }
+    if(!At)
+        return false;
+
+    auto run = [&](int index, void* y_out) {
+        return index ? traits::gemv(
+                   handle, HIPBLAS_OP_N, n, m, alpha, At, n, x, incx, beta, (T*)y_out, incy)
+                     : traits::gemv(
+                         handle, trans, m, n, alpha, A, lda, x, incx, beta, (T*)y_out, incy);
+    };
+    auto candidates = []() { return std::vector<int>{1}; };
+
+    size_t y_size = ((size_t(n) - 1) * std::abs(incy) + 1) * sizeof(T);
+    if(!hipblasGemmTuningSolution(key, stream, y, y_size, candidates, run))
+    {
+        std::vector<const void*> operands = {A};
+        hipblasOperandCacheDrop(handle, key, operands);
+        return false;
+    }
+
+    status = run(1, y);
+    return true;
+}
+
+template <typename T>
+static bool hipblasOperandCacheGemmTemplate(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const T*           alpha,
+                                            const T*           A,
+                                            int                lda,
+                                            const T*           B,
+                                            int                ldb,
+                                            const T*           beta,
+                                            T*                 C,
+                                            int                ldc,
+                                            hipblasStatus_t&   status)
+{
+    using traits = hipblasOperandCacheTraits<T>;
+
+    // Argument errors are left to the call as issued
+    bool ta = transa != HIPBLAS_OP_N, tb = transb != HIPBLAS_OP_N;
+    if((!ta && !tb) || operand_cache_active
+       || !operand_cache_handles.load(std::memory_order_relaxed) || m <= 0 || n <= 0 || k <= 0
+       || lda < (ta ? k : m) || ldb < (tb ? n : k) || ldc < m || !alpha || !beta || !A || !B
+       || !C)
+        return false;
+
+    std::string key = "operand_cache "
+                      + hipblasGemmTuningKey(ta ? HIPBLAS_OP_T : HIPBLAS_OP_N,
+                                             tb ? HIPBLAS_OP_T : HIPBLAS_OP_N,
+                                             m,
+                                             n,
+                                             k,
+                                             traits::type,
+                                             traits::type,
+                                             traits::type,
+                                             traits::compute_type);
+    int choice;
+    if(hipblasGemmTuningLookup(key, choice) && !choice)
+        return false;
+
+    hipStream_t stream;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+
+    // A transposed A is stored k x m and a transposed B n x k
+    hipblasOperandCacheScope scope;
+    const T *                At = nullptr, *Bt = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(operand_cache_mutex);
+
+        auto cache = operand_caches.find(handle);
+        if(cache == operand_caches.end() || !cache->second.limit)
+            return false;
+        uint64_t now = ++cache->second.clock;
+        if(ta)
+            At = hipblasOperandCacheCopy(handle, stream, cache->second, now, A, k, m, lda);
+        if(tb)
+            Bt = hipblasOperandCacheCopy(handle, stream, cache->second, now, B, n, k, ldb);
+    }
+    if(!At && !Bt)
+        return false;
+
+    auto run = [&](int index, void* C_out) {
+        if(!index)
+            return traits::gemm(
+                handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, (T*)C_out, ldc);
+        return traits::gemm(handle,
+                            At ? HIPBLAS_OP_N : transa,
+                            Bt ? HIPBLAS_OP_N : transb,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            At ? At : A,
+                            At ? m : lda,
+                            Bt ? Bt : B,
+                            Bt ? k : ldb,
+                            beta,
+                            (T*)C_out,
+                            ldc);
+    };
+    auto candidates = []() { return std::vector<int>{1}; };
+
+    size_t C_size = (size_t(ldc) * (n - 1) + m) * sizeof(T);
+    if(!hipblasGemmTuningSolution(key, stream, C, C_size, candidates, run))
+    {
+        std::vector<const void*> operands = {A, B};
+        hipblasOperandCacheDrop(handle, key, operands);
+        return false;
+    }
+
+    status = run(1, C);
+    return true;
+}
+
+bool hipblasOperandCacheGemv(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             int                m,
+                             int                n,
+                             const float*       alpha,
+                             const float*       A,
+                             int                lda,
+                             const float*       x,
+                             int                incx,
+                             const float*       beta,
+                             float*             y,
+                             int                incy,
+                             hipblasStatus_t&   status)
+{
+    return hipblasOperandCacheGemvTemplate(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, status);
+}
+
+bool hipblasOperandCacheGemv(hipblasHandle_t    handle,
+                             hipblasOperation_t trans,
+                             int                m,
+                             int                n,
+                             const double*      alpha,
+                             const double*      A,
+                             int                lda,
+                             const double*      x,
+                             int                incx,
+                             const double*      beta,
+                             double*            y,
+                             int                incy,
+                             hipblasStatus_t&   status)
+{
+    return hipblasOperandCacheGemvTemplate(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, status);
+}
+
+bool hipblasOperandCacheGemm(hipblasHandle_t    handle,
+                             hipblasOperation_t transa,
+                             hipblasOperation_t transb,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const float*       alpha,
+                             const float*       A,
+                             int                lda,
+                             const float*       B,
+                             int                ldb,
+                             const float*       beta,
+                             float*             C,
+                             int                ldc,
+                             hipblasStatus_t&   status)
+{
+    return hipblasOperandCacheGemmTemplate(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, status);
+}
+
+bool hipblasOperandCacheGemm(hipblasHandle_t    handle,
+                             hipblasOperation_t transa,
+                             hipblasOperation_t transb,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const double*      alpha,
+                             const double*      A,
+                             int                lda,
+                             const double*      B,
+                             int                ldb,
+                             const double*      beta,
+                             double*            C,
+                             int                ldc,
+                             hipblasStatus_t&   status)
+{
+    return hipblasOperandCacheGemmTemplate(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, status);
+}
+
+extern "C" hipblasStatus_t hipblasSetOperandCacheLimit(hipblasHandle_t handle, size_t bytes)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, bytes);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    std::lock_guard<std::mutex> lock(operand_cache_mutex);
+
+    hipblasOperandCache& cache = hipblasOperandCacheGet(handle);
+    cache.limit                = bytes;
+    cache.make_room(0, ++cache.clock);
+    hipblasOperandCacheTrim(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetOperandCacheLimit(hipblasHandle_t handle, size_t* bytes)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, bytes);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!bytes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(operand_cache_mutex);
+
+    auto cache = operand_caches.find(handle);
+    *bytes     = cache == operand_caches.end() ? 0 : cache->second.limit;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasRegisterOperand(hipblasHandle_t handle, const void* A)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, A);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!A)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(operand_cache_mutex);
+
+    hipblasOperandCacheGet(handle).operands.try_emplace(A);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasUnregisterOperand(hipblasHandle_t handle, const void* A)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, A);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!A)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(operand_cache_mutex);
+
+    auto cache = operand_caches.find(handle);
+    if(cache == operand_caches.end())
+        return HIPBLAS_STATUS_SUCCESS;
+    auto operand = cache->second.operands.find(A);
+    if(operand != cache->second.operands.end())
+    {
+        cache->second.free_copy(operand->second);
+        cache->second.operands.erase(operand);
+    }
+    hipblasOperandCacheTrim(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasInvalidateOperand(hipblasHandle_t handle, const void* A)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, A);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    std::lock_guard<std::mutex> lock(operand_cache_mutex);
+
+    auto cache = operand_caches.find(handle);
+    if(cache == operand_caches.end())
+        return HIPBLAS_STATUS_SUCCESS;
+    for(auto& operand : cache->second.operands)
+        if(!A || operand.first == A)
+            cache->second.free_copy(operand.second);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,1720 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "packed.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+#ifndef HIPBLAS_PACKED
+// Without the kernels, the stored part of each column is one copy on the handle stream: a 2D copy
+// over all matrices of a strided batch whose matrices do not overlap, and one copy per matrix
+// otherwise. The device pointer arrays of the batched forms are first read back, which is not
+// possible while the stream is being captured.
+static hipblasStatus_t hipblasPackedCopies(hipblasHandle_t    handle,
+                                           hipblasPackedOp    op,
+                                           bool               upper,
+                                           int                m,
+                                           int                n,
+                                           int                kl,
+                                           int                ku,
+                                           const char*        src,
+                                           const void* const* src_array,
+                                           int                ld_src,
+                                           hipblasStride      stride_src,
+                                           char*              dst,
+                                           void* const*       dst_array,
+                                           int                ld_dst,
+                                           hipblasStride      stride_dst,
+                                           int                batch_count,
+                                           size_t             element_size)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::vector<const char*> src_b(batch_count);
+    std::vector<char*>       dst_b(batch_count);
+    if(src_array)
+    {
+        hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+        if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(capture_status != hipStreamCaptureStatusNone)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        size_t     bytes = sizeof(void*) * batch_count;
+        hipError_t error
+            = hipMemcpyAsync(src_b.data(), src_array, bytes, hipMemcpyDeviceToHost, stream);
+        if(error == hipSuccess)
+            error = hipMemcpyAsync(dst_b.data(), dst_array, bytes, hipMemcpyDeviceToHost, stream);
+        if(error != hipSuccess || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    else
+    {
+        for(int b = 0; b < batch_count; b++)
+        {
+            src_b[b] = src + b * stride_src * element_size;
+            dst_b[b] = dst + b * stride_dst * element_size;
+        }
+    }
+
+    bool   band    = op == hipblasPackedOp::gbpack || op == hipblasPackedOp::gbunpack;
+    bool   to_full = op == hipblasPackedOp::tpttr || op == hipblasPackedOp::gbunpack;
+    int    ld_full = to_full ? ld_dst : ld_src;
+    int    ld_band = to_full ? ld_src : ld_dst;
+    size_t pitch_s = stride_src * element_size;
+    size_t pitch_d = stride_dst * element_size;
+    bool   copy_2d = !src_array && batch_count > 1 && stride_src > 0 && stride_dst > 0;
+    for(int j = 0; j < n; j++)
+    {
+        int    first  = band ? std::max(0, j - ku) : upper ? 0 : j;
+        int    last   = band ? std::min(m - 1, j + kl) : upper ? j : n - 1;
+        size_t offset = band    ? size_t(j) * ld_band + ku + first - j
+                        : upper ? size_t(j) * (j + 1) / 2
+                                : size_t(j) * (2 * size_t(n) - j + 1) / 2;
+        if(first > last)
+            continue;
+
+        size_t full    = (first + size_t(j) * ld_full) * element_size;
+        size_t compact = offset * element_size;
+        size_t width   = size_t(last - first + 1) * element_size;
+        size_t s_off   = to_full ? compact : full;
+        size_t d_off   = to_full ? full : compact;
+
+        hipError_t error = hipSuccess;
+        if(copy_2d && pitch_s >= width && pitch_d >= width)
+            error = hipMemcpy2DAsync(dst + d_off,
+                                     pitch_d,
+                                     src + s_off,
+                                     pitch_s,
+                                     width,
+                                     batch_count,
+                                     hipMemcpyDeviceToDevice,
+                                     stream);
+        else
+            for(int b = 0; b < batch_count && error == hipSuccess; b++)
+                error = hipMemcpyAsync(
+                    dst_b[b] + d_off, src_b[b] + s_off, width, hipMemcpyDeviceToDevice, stream);
+        if(error != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+#endif
+
+// Checks the arguments of every form, where src_array and dst_array are the pointer arrays of the
+// batched forms and null otherwise, then runs the kernels or the copies. The packed forms pass m
+// = n, kl = ku = 0 and an ld of 0 for the packed array, and the band forms HIPBLAS_FILL_MODE_FULL.
+template <typename T>
+static hipblasStatus_t hipblasPacked(hipblasHandle_t   handle,
+                                     hipblasPackedOp   op,
+                                     hipblasFillMode_t uplo,
+                                     int               m,
+                                     int               n,
+                                     int               kl,
+                                     int               ku,
+                                     const T*          src,
+                                     const T* const*   src_array,
+                                     int               ld_src,
+                                     hipblasStride     stride_src,
+                                     T*                dst,
+                                     T* const*         dst_array,
+                                     int               ld_dst,
+                                     hipblasStride     stride_dst,
+                                     int               batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool band    = op == hipblasPackedOp::gbpack || op == hipblasPackedOp::gbunpack;
+    bool to_full = op == hipblasPackedOp::tpttr || op == hipblasPackedOp::gbunpack;
+    int  ld_full = to_full ? ld_dst : ld_src;
+    int  ld_band = to_full ? ld_src : ld_dst;
+    if(!band && uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m < 0 || n < 0 || kl < 0 || ku < 0 || batch_count < 0 || ld_full < std::max(1, m)
+       || (band && ld_band < kl + ku + 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    bool batched = src_array || dst_array;
+    if(batched ? !src_array || !dst_array : !src || !dst)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_PACKED
+    return hipblasPackedKernels(handle,
+                                op,
+                                uplo == HIPBLAS_FILL_MODE_UPPER,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                src,
+                                (const void* const*)src_array,
+                                ld_src,
+                                stride_src,
+                                dst,
+                                (void* const*)dst_array,
+                                ld_dst,
+                                stride_dst,
+                                batch_count,
+                                sizeof(T));
+#else
+    return hipblasPackedCopies(handle,
+                               op,
+                               uplo == HIPBLAS_FILL_MODE_UPPER,
+                               m,
+                               n,
+                               kl,
+                               ku,
+                               (const char*)src,
+                               (const void* const*)src_array,
+                               ld_src,
+                               stride_src,
+                               (char*)dst,
+                               (void* const*)dst_array,
+                               ld_dst,
+                               stride_dst,
+                               batch_count,
+                               sizeof(T));
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasStpttr(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               n,
+                                         const float*      AP,
+                                         float*            A,
+                                         int               lda)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, A, lda);
+    return hipblasPacked<float>(
+        handle, hipblasPackedOp::tpttr, uplo, n, n, 0, 0, AP, nullptr, 0, 0, A, nullptr, lda, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtpttr(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               n,
+                                         const double*     AP,
+                                         double*           A,
+                                         int               lda)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, A, lda);
+    return hipblasPacked<double>(
+        handle, hipblasPackedOp::tpttr, uplo, n, n, 0, 0, AP, nullptr, 0, 0, A, nullptr, lda, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtpttr(hipblasHandle_t       handle,
+                                         hipblasFillMode_t     uplo,
+                                         int                   n,
+                                         const hipblasComplex* AP,
+                                         hipblasComplex*       A,
+                                         int                   lda)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, A, lda);
+    return hipblasPacked<hipblasComplex>(
+        handle, hipblasPackedOp::tpttr, uplo, n, n, 0, 0, AP, nullptr, 0, 0, A, nullptr, lda, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtpttr(hipblasHandle_t             handle,
+                                         hipblasFillMode_t           uplo,
+                                         int                         n,
+                                         const hipblasDoubleComplex* AP,
+                                         hipblasDoubleComplex*       A,
+                                         int                         lda)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, A, lda);
+    return hipblasPacked<hipblasDoubleComplex>(
+        handle, hipblasPackedOp::tpttr, uplo, n, n, 0, 0, AP, nullptr, 0, 0, A, nullptr, lda, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStpttrBatched(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                int                n,
+                                                const float* const AP[],
+                                                float* const       A[],
+                                                int                lda,
+                                                int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, A, lda, batchCount);
+    return hipblasPacked<float>(handle,
+                                hipblasPackedOp::tpttr,
+                                uplo,
+                                n,
+                                n,
+                                0,
+                                0,
+                                nullptr,
+                                AP,
+                                0,
+                                0,
+                                nullptr,
+                                A,
+                                lda,
+                                0,
+                                batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtpttrBatched(hipblasHandle_t     handle,
+                                                hipblasFillMode_t   uplo,
+                                                int                 n,
+                                                const double* const AP[],
+                                                double* const       A[],
+                                                int                 lda,
+                                                int                 batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, A, lda, batchCount);
+    return hipblasPacked<double>(handle,
+                                 hipblasPackedOp::tpttr,
+                                 uplo,
+                                 n,
+                                 n,
+                                 0,
+                                 0,
+                                 nullptr,
+                                 AP,
+                                 0,
+                                 0,
+                                 nullptr,
+                                 A,
+                                 lda,
+                                 0,
+                                 batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtpttrBatched(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                int                         n,
+                                                const hipblasComplex* const AP[],
+                                                hipblasComplex* const       A[],
+                                                int                         lda,
+                                                int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, A, lda, batchCount);
+    return hipblasPacked<hipblasComplex>(handle,
+                                         hipblasPackedOp::tpttr,
+                                         uplo,
+                                         n,
+                                         n,
+                                         0,
+                                         0,
+                                         nullptr,
+                                         AP,
+                                         0,
+                                         0,
+                                         nullptr,
+                                         A,
+                                         lda,
+                                         0,
+                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtpttrBatched(hipblasHandle_t                   handle,
+                                                hipblasFillMode_t                 uplo,
+                                                int                               n,
+                                                const hipblasDoubleComplex* const AP[],
+                                                hipblasDoubleComplex* const       A[],
+                                                int                               lda,
+                                                int                               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, A, lda, batchCount);
+    return hipblasPacked<hipblasDoubleComplex>(handle,
+                                               hipblasPackedOp::tpttr,
+                                               uplo,
+                                               n,
+                                               n,
+                                               0,
+                                               0,
+                                               nullptr,
+                                               AP,
+                                               0,
+                                               0,
+                                               nullptr,
+                                               A,
+                                               lda,
+                                               0,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStpttrStridedBatched(hipblasHandle_t   handle,
+                                                       hipblasFillMode_t uplo,
+                                                       int               n,
+                                                       const float*      AP,
+                                                       hipblasStride     strideAP,
+                                                       float*            A,
+                                                       int               lda,
+                                                       hipblasStride     strideA,
+                                                       int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+    return hipblasPacked<float>(handle,
+                                hipblasPackedOp::tpttr,
+                                uplo,
+                                n,
+                                n,
+                                0,
+                                0,
+                                AP,
+                                nullptr,
+                                0,
+                                strideAP,
+                                A,
+                                nullptr,
+                                lda,
+                                strideA,
+                                batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtpttrStridedBatched(hipblasHandle_t   handle,
+                                                       hipblasFillMode_t uplo,
+                                                       int               n,
+                                                       const double*     AP,
+                                                       hipblasStride     strideAP,
+                                                       double*           A,
+                                                       int               lda,
+                                                       hipblasStride     strideA,
+                                                       int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+    return hipblasPacked<double>(handle,
+                                 hipblasPackedOp::tpttr,
+                                 uplo,
+                                 n,
+                                 n,
+                                 0,
+                                 0,
+                                 AP,
+                                 nullptr,
+                                 0,
+                                 strideAP,
+                                 A,
+                                 nullptr,
+                                 lda,
+                                 strideA,
+                                 batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtpttrStridedBatched(hipblasHandle_t       handle,
+                                                       hipblasFillMode_t     uplo,
+                                                       int                   n,
+                                                       const hipblasComplex* AP,
+                                                       hipblasStride         strideAP,
+                                                       hipblasComplex*       A,
+                                                       int                   lda,
+                                                       hipblasStride         strideA,
+                                                       int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+    return hipblasPacked<hipblasComplex>(handle,
+                                         hipblasPackedOp::tpttr,
+                                         uplo,
+                                         n,
+                                         n,
+                                         0,
+                                         0,
+                                         AP,
+                                         nullptr,
+                                         0,
+                                         strideAP,
+                                         A,
+                                         nullptr,
+                                         lda,
+                                         strideA,
+                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtpttrStridedBatched(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       int                         n,
+                                                       const hipblasDoubleComplex* AP,
+                                                       hipblasStride               strideAP,
+                                                       hipblasDoubleComplex*       A,
+                                                       int                         lda,
+                                                       hipblasStride               strideA,
+                                                       int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+    return hipblasPacked<hipblasDoubleComplex>(handle,
+                                               hipblasPackedOp::tpttr,
+                                               uplo,
+                                               n,
+                                               n,
+                                               0,
+                                               0,
+                                               AP,
+                                               nullptr,
+                                               0,
+                                               strideAP,
+                                               A,
+                                               nullptr,
+                                               lda,
+                                               strideA,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStrttp(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               n,
+                                         const float*      A,
+                                         int               lda,
+                                         float*            AP)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, AP);
+    return hipblasPacked<float>(
+        handle, hipblasPackedOp::trttp, uplo, n, n, 0, 0, A, nullptr, lda, 0, AP, nullptr, 0, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtrttp(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               n,
+                                         const double*     A,
+                                         int               lda,
+                                         double*           AP)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, AP);
+    return hipblasPacked<double>(
+        handle, hipblasPackedOp::trttp, uplo, n, n, 0, 0, A, nullptr, lda, 0, AP, nullptr, 0, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtrttp(hipblasHandle_t       handle,
+                                         hipblasFillMode_t     uplo,
+                                         int                   n,
+                                         const hipblasComplex* A,
+                                         int                   lda,
+                                         hipblasComplex*       AP)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, AP);
+    return hipblasPacked<hipblasComplex>(
+        handle, hipblasPackedOp::trttp, uplo, n, n, 0, 0, A, nullptr, lda, 0, AP, nullptr, 0, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtrttp(hipblasHandle_t             handle,
+                                         hipblasFillMode_t           uplo,
+                                         int                         n,
+                                         const hipblasDoubleComplex* A,
+                                         int                         lda,
+                                         hipblasDoubleComplex*       AP)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, AP);
+    return hipblasPacked<hipblasDoubleComplex>(
+        handle, hipblasPackedOp::trttp, uplo, n, n, 0, 0, A, nullptr, lda, 0, AP, nullptr, 0, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStrttpBatched(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                int                n,
+                                                const float* const A[],
+                                                int                lda,
+                                                float* const       AP[],
+                                                int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, AP, batchCount);
+    return hipblasPacked<float>(handle,
+                                hipblasPackedOp::trttp,
+                                uplo,
+                                n,
+                                n,
+                                0,
+                                0,
+                                nullptr,
+                                A,
+                                lda,
+                                0,
+                                nullptr,
+                                AP,
+                                0,
+                                0,
+                                batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtrttpBatched(hipblasHandle_t     handle,
+                                                hipblasFillMode_t   uplo,
+                                                int                 n,
+                                                const double* const A[],
+                                                int                 lda,
+                                                double* const       AP[],
+                                                int                 batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, AP, batchCount);
+    return hipblasPacked<double>(handle,
+                                 hipblasPackedOp::trttp,
+                                 uplo,
+                                 n,
+                                 n,
+                                 0,
+                                 0,
+                                 nullptr,
+                                 A,
+                                 lda,
+                                 0,
+                                 nullptr,
+                                 AP,
+                                 0,
+                                 0,
+                                 batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtrttpBatched(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                int                         n,
+                                                const hipblasComplex* const A[],
+                                                int                         lda,
+                                                hipblasComplex* const       AP[],
+                                                int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, AP, batchCount);
+    return hipblasPacked<hipblasComplex>(handle,
+                                         hipblasPackedOp::trttp,
+                                         uplo,
+                                         n,
+                                         n,
+                                         0,
+                                         0,
+                                         nullptr,
+                                         A,
+                                         lda,
+                                         0,
+                                         nullptr,
+                                         AP,
+                                         0,
+                                         0,
+                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtrttpBatched(hipblasHandle_t                   handle,
+                                                hipblasFillMode_t                 uplo,
+                                                int                               n,
+                                                const hipblasDoubleComplex* const A[],
+                                                int                               lda,
+                                                hipblasDoubleComplex* const       AP[],
+                                                int                               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, AP, batchCount);
+    return hipblasPacked<hipblasDoubleComplex>(handle,
+                                               hipblasPackedOp::trttp,
+                                               uplo,
+                                               n,
+                                               n,
+                                               0,
+                                               0,
+                                               nullptr,
+                                               A,
+                                               lda,
+                                               0,
+                                               nullptr,
+                                               AP,
+                                               0,
+                                               0,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStrttpStridedBatched(hipblasHandle_t   handle,
+                                                       hipblasFillMode_t uplo,
+                                                       int               n,
+                                                       const float*      A,
+                                                       int               lda,
+                                                       hipblasStride     strideA,
+                                                       float*            AP,
+                                                       hipblasStride     strideAP,
+                                                       int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+    return hipblasPacked<float>(handle,
+                                hipblasPackedOp::trttp,
+                                uplo,
+                                n,
+                                n,
+                                0,
+                                0,
+                                A,
+                                nullptr,
+                                lda,
+                                strideA,
+                                AP,
+                                nullptr,
+                                0,
+                                strideAP,
+                                batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtrttpStridedBatched(hipblasHandle_t   handle,
+                                                       hipblasFillMode_t uplo,
+                                                       int               n,
+                                                       const double*     A,
+                                                       int               lda,
+                                                       hipblasStride     strideA,
+                                                       double*           AP,
+                                                       hipblasStride     strideAP,
+                                                       int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+    return hipblasPacked<double>(handle,
+                                 hipblasPackedOp::trttp,
+                                 uplo,
+                                 n,
+                                 n,
+                                 0,
+                                 0,
+                                 A,
+                                 nullptr,
+                                 lda,
+                                 strideA,
+                                 AP,
+                                 nullptr,
+                                 0,
+                                 strideAP,
+                                 batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtrttpStridedBatched(hipblasHandle_t       handle,
+                                                       hipblasFillMode_t     uplo,
+                                                       int                   n,
+                                                       const hipblasComplex* A,
+                                                       int                   lda,
+                                                       hipblasStride         strideA,
+                                                       hipblasComplex*       AP,
+                                                       hipblasStride         strideAP,
+                                                       int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+    return hipblasPacked<hipblasComplex>(handle,
+                                         hipblasPackedOp::trttp,
+                                         uplo,
+                                         n,
+                                         n,
+                                         0,
+                                         0,
+                                         A,
+                                         nullptr,
+                                         lda,
+                                         strideA,
+                                         AP,
+                                         nullptr,
+                                         0,
+                                         strideAP,
+                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtrttpStridedBatched(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       int                         n,
+                                                       const hipblasDoubleComplex* A,
+                                                       int                         lda,
+                                                       hipblasStride               strideA,
+                                                       hipblasDoubleComplex*       AP,
+                                                       hipblasStride               strideAP,
+                                                       int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+    return hipblasPacked<hipblasDoubleComplex>(handle,
+                                               hipblasPackedOp::trttp,
+                                               uplo,
+                                               n,
+                                               n,
+                                               0,
+                                               0,
+                                               A,
+                                               nullptr,
+                                               lda,
+                                               strideA,
+                                               AP,
+                                               nullptr,
+                                               0,
+                                               strideAP,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgbpack(hipblasHandle_t handle,
+                                          int             m,
+                                          int             n,
+                                          int             kl,
+                                          int             ku,
+                                          const float*    A,
+                                          int             lda,
+                                          float*          AB,
+                                          int             ldab)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, AB, ldab);
+    return hipblasPacked<float>(handle,
+                                hipblasPackedOp::gbpack,
+                                HIPBLAS_FILL_MODE_FULL,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                A,
+                                nullptr,
+                                lda,
+                                0,
+                                AB,
+                                nullptr,
+                                ldab,
+                                0,
+                                1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgbpack(hipblasHandle_t handle,
+                                          int             m,
+                                          int             n,
+                                          int             kl,
+                                          int             ku,
+                                          const double*   A,
+                                          int             lda,
+                                          double*         AB,
+                                          int             ldab)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, AB, ldab);
+    return hipblasPacked<double>(handle,
+                                 hipblasPackedOp::gbpack,
+                                 HIPBLAS_FILL_MODE_FULL,
+                                 m,
+                                 n,
+                                 kl,
+                                 ku,
+                                 A,
+                                 nullptr,
+                                 lda,
+                                 0,
+                                 AB,
+                                 nullptr,
+                                 ldab,
+                                 0,
+                                 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbpack(hipblasHandle_t       handle,
+                                          int                   m,
+                                          int                   n,
+                                          int                   kl,
+                                          int                   ku,
+                                          const hipblasComplex* A,
+                                          int                   lda,
+                                          hipblasComplex*       AB,
+                                          int                   ldab)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, AB, ldab);
+    return hipblasPacked<hipblasComplex>(handle,
+                                         hipblasPackedOp::gbpack,
+                                         HIPBLAS_FILL_MODE_FULL,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         A,
+                                         nullptr,
+                                         lda,
+                                         0,
+                                         AB,
+                                         nullptr,
+                                         ldab,
+                                         0,
+                                         1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbpack(hipblasHandle_t             handle,
+                                          int                         m,
+                                          int                         n,
+                                          int                         kl,
+                                          int                         ku,
+                                          const hipblasDoubleComplex* A,
+                                          int                         lda,
+                                          hipblasDoubleComplex*       AB,
+                                          int                         ldab)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, AB, ldab);
+    return hipblasPacked<hipblasDoubleComplex>(handle,
+                                               hipblasPackedOp::gbpack,
+                                               HIPBLAS_FILL_MODE_FULL,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               A,
+                                               nullptr,
+                                               lda,
+                                               0,
+                                               AB,
+                                               nullptr,
+                                               ldab,
+                                               0,
+                                               1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgbpackBatched(hipblasHandle_t    handle,
+                                                 int                m,
+                                                 int                n,
+                                                 int                kl,
+                                                 int                ku,
+                                                 const float* const A[],
+                                                 int                lda,
+                                                 float* const       AB[],
+                                                 int                ldab,
+                                                 int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+    return hipblasPacked<float>(handle,
+                                hipblasPackedOp::gbpack,
+                                HIPBLAS_FILL_MODE_FULL,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                nullptr,
+                                A,
+                                lda,
+                                0,
+                                nullptr,
+                                AB,
+                                ldab,
+                                0,
+                                batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgbpackBatched(hipblasHandle_t     handle,
+                                                 int                 m,
+                                                 int                 n,
+                                                 int                 kl,
+                                                 int                 ku,
+                                                 const double* const A[],
+                                                 int                 lda,
+                                                 double* const       AB[],
+                                                 int                 ldab,
+                                                 int                 batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+    return hipblasPacked<double>(handle,
+                                 hipblasPackedOp::gbpack,
+                                 HIPBLAS_FILL_MODE_FULL,
+                                 m,
+                                 n,
+                                 kl,
+                                 ku,
+                                 nullptr,
+                                 A,
+                                 lda,
+                                 0,
+                                 nullptr,
+                                 AB,
+                                 ldab,
+                                 0,
+                                 batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbpackBatched(hipblasHandle_t             handle,
+                                                 int                         m,
+                                                 int                         n,
+                                                 int                         kl,
+                                                 int                         ku,
+                                                 const hipblasComplex* const A[],
+                                                 int                         lda,
+                                                 hipblasComplex* const       AB[],
+                                                 int                         ldab,
+                                                 int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+    return hipblasPacked<hipblasComplex>(handle,
+                                         hipblasPackedOp::gbpack,
+                                         HIPBLAS_FILL_MODE_FULL,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         nullptr,
+                                         A,
+                                         lda,
+                                         0,
+                                         nullptr,
+                                         AB,
+                                         ldab,
+                                         0,
+                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbpackBatched(hipblasHandle_t                   handle,
+                                                 int                               m,
+                                                 int                               n,
+                                                 int                               kl,
+                                                 int                               ku,
+                                                 const hipblasDoubleComplex* const A[],
+                                                 int                               lda,
+                                                 hipblasDoubleComplex* const       AB[],
+                                                 int                               ldab,
+                                                 int                               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+    return hipblasPacked<hipblasDoubleComplex>(handle,
+                                               hipblasPackedOp::gbpack,
+                                               HIPBLAS_FILL_MODE_FULL,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               nullptr,
+                                               A,
+                                               lda,
+                                               0,
+                                               nullptr,
+                                               AB,
+                                               ldab,
+                                               0,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgbpackStridedBatched(hipblasHandle_t handle,
+                                                        int             m,
+                                                        int             n,
+                                                        int             kl,
+                                                        int             ku,
+                                                        const float*    A,
+                                                        int             lda,
+                                                        hipblasStride   strideA,
+                                                        float*          AB,
+                                                        int             ldab,
+                                                        hipblasStride   strideAB,
+                                                        int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+    return hipblasPacked<float>(handle,
+                                hipblasPackedOp::gbpack,
+                                HIPBLAS_FILL_MODE_FULL,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                A,
+                                nullptr,
+                                lda,
+                                strideA,
+                                AB,
+                                nullptr,
+                                ldab,
+                                strideAB,
+                                batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgbpackStridedBatched(hipblasHandle_t handle,
+                                                        int             m,
+                                                        int             n,
+                                                        int             kl,
+                                                        int             ku,
+                                                        const double*   A,
+                                                        int             lda,
+                                                        hipblasStride   strideA,
+                                                        double*         AB,
+                                                        int             ldab,
+                                                        hipblasStride   strideAB,
+                                                        int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+    return hipblasPacked<double>(handle,
+                                 hipblasPackedOp::gbpack,
+                                 HIPBLAS_FILL_MODE_FULL,
+                                 m,
+                                 n,
+                                 kl,
+                                 ku,
+                                 A,
+                                 nullptr,
+                                 lda,
+                                 strideA,
+                                 AB,
+                                 nullptr,
+                                 ldab,
+                                 strideAB,
+                                 batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbpackStridedBatched(hipblasHandle_t       handle,
+                                                        int                   m,
+                                                        int                   n,
+                                                        int                   kl,
+                                                        int                   ku,
+                                                        const hipblasComplex* A,
+                                                        int                   lda,
+                                                        hipblasStride         strideA,
+                                                        hipblasComplex*       AB,
+                                                        int                   ldab,
+                                                        hipblasStride         strideAB,
+                                                        int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+    return hipblasPacked<hipblasComplex>(handle,
+                                         hipblasPackedOp::gbpack,
+                                         HIPBLAS_FILL_MODE_FULL,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         A,
+                                         nullptr,
+                                         lda,
+                                         strideA,
+                                         AB,
+                                         nullptr,
+                                         ldab,
+                                         strideAB,
+                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbpackStridedBatched(hipblasHandle_t             handle,
+                                                        int                         m,
+                                                        int                         n,
+                                                        int                         kl,
+                                                        int                         ku,
+                                                        const hipblasDoubleComplex* A,
+                                                        int                         lda,
+                                                        hipblasStride               strideA,
+                                                        hipblasDoubleComplex*       AB,
+                                                        int                         ldab,
+                                                        hipblasStride               strideAB,
+                                                        int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+    return hipblasPacked<hipblasDoubleComplex>(handle,
+                                               hipblasPackedOp::gbpack,
+                                               HIPBLAS_FILL_MODE_FULL,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               A,
+                                               nullptr,
+                                               lda,
+                                               strideA,
+                                               AB,
+                                               nullptr,
+                                               ldab,
+                                               strideAB,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgbunpack(hipblasHandle_t handle,
+                                            int             m,
+                                            int             n,
+                                            int             kl,
+                                            int             ku,
+                                            const float*    AB,
+                                            int             ldab,
+                                            float*          A,
+                                            int             lda)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, A, lda);
+    return hipblasPacked<float>(handle,
+                                hipblasPackedOp::gbunpack,
+                                HIPBLAS_FILL_MODE_FULL,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                AB,
+                                nullptr,
+                                ldab,
+                                0,
+                                A,
+                                nullptr,
+                                lda,
+                                0,
+                                1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgbunpack(hipblasHandle_t handle,
+                                            int             m,
+                                            int             n,
+                                            int             kl,
+                                            int             ku,
+                                            const double*   AB,
+                                            int             ldab,
+                                            double*         A,
+                                            int             lda)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, A, lda);
+    return hipblasPacked<double>(handle,
+                                 hipblasPackedOp::gbunpack,
+                                 HIPBLAS_FILL_MODE_FULL,
+                                 m,
+                                 n,
+                                 kl,
+                                 ku,
+                                 AB,
+                                 nullptr,
+                                 ldab,
+                                 0,
+                                 A,
+                                 nullptr,
+                                 lda,
+                                 0,
+                                 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbunpack(hipblasHandle_t       handle,
+                                            int                   m,
+                                            int                   n,
+                                            int                   kl,
+                                            int                   ku,
+                                            const hipblasComplex* AB,
+                                            int                   ldab,
+                                            hipblasComplex*       A,
+                                            int                   lda)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, A, lda);
+    return hipblasPacked<hipblasComplex>(handle,
+                                         hipblasPackedOp::gbunpack,
+                                         HIPBLAS_FILL_MODE_FULL,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         AB,
+                                         nullptr,
+                                         ldab,
+                                         0,
+                                         A,
+                                         nullptr,
+                                         lda,
+                                         0,
+                                         1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbunpack(hipblasHandle_t             handle,
+                                            int                         m,
+                                            int                         n,
+                                            int                         kl,
+                                            int                         ku,
+                                            const hipblasDoubleComplex* AB,
+                                            int                         ldab,
+                                            hipblasDoubleComplex*       A,
+                                            int                         lda)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, A, lda);
+    return hipblasPacked<hipblasDoubleComplex>(handle,
+                                               hipblasPackedOp::gbunpack,
+                                               HIPBLAS_FILL_MODE_FULL,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               AB,
+                                               nullptr,
+                                               ldab,
+                                               0,
+                                               A,
+                                               nullptr,
+                                               lda,
+                                               0,
+                                               1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgbunpackBatched(hipblasHandle_t    handle,
+                                                   int                m,
+                                                   int                n,
+                                                   int                kl,
+                                                   int                ku,
+                                                   const float* const AB[],
+                                                   int                ldab,
+                                                   float* const       A[],
+                                                   int                lda,
+                                                   int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+    return hipblasPacked<float>(handle,
+                                hipblasPackedOp::gbunpack,
+                                HIPBLAS_FILL_MODE_FULL,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                nullptr,
+                                AB,
+                                ldab,
+                                0,
+                                nullptr,
+                                A,
+                                lda,
+                                0,
+                                batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgbunpackBatched(hipblasHandle_t     handle,
+                                                   int                 m,
+                                                   int                 n,
+                                                   int                 kl,
+                                                   int                 ku,
+                                                   const double* const AB[],
+                                                   int                 ldab,
+                                                   double* const       A[],
+                                                   int                 lda,
+                                                   int                 batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+    return hipblasPacked<double>(handle,
+                                 hipblasPackedOp::gbunpack,
+                                 HIPBLAS_FILL_MODE_FULL,
+                                 m,
+                                 n,
+                                 kl,
+                                 ku,
+                                 nullptr,
+                                 AB,
+                                 ldab,
+                                 0,
+                                 nullptr,
+                                 A,
+                                 lda,
+                                 0,
+                                 batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbunpackBatched(hipblasHandle_t             handle,
+                                                   int                         m,
+                                                   int                         n,
+                                                   int                         kl,
+                                                   int                         ku,
+                                                   const hipblasComplex* const AB[],
+                                                   int                         ldab,
+                                                   hipblasComplex* const       A[],
+                                                   int                         lda,
+                                                   int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+    return hipblasPacked<hipblasComplex>(handle,
+                                         hipblasPackedOp::gbunpack,
+                                         HIPBLAS_FILL_MODE_FULL,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         nullptr,
+                                         AB,
+                                         ldab,
+                                         0,
+                                         nullptr,
+                                         A,
+                                         lda,
+                                         0,
+                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbunpackBatched(hipblasHandle_t                   handle,
+                                                   int                               m,
+                                                   int                               n,
+                                                   int                               kl,
+                                                   int                               ku,
+                                                   const hipblasDoubleComplex* const AB[],
+                                                   int                               ldab,
+                                                   hipblasDoubleComplex* const       A[],
+                                                   int                               lda,
+                                                   int                               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+    return hipblasPacked<hipblasDoubleComplex>(handle,
+                                               hipblasPackedOp::gbunpack,
+                                               HIPBLAS_FILL_MODE_FULL,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               nullptr,
+                                               AB,
+                                               ldab,
+                                               0,
+                                               nullptr,
+                                               A,
+                                               lda,
+                                               0,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgbunpackStridedBatched(hipblasHandle_t handle,
+                                                          int             m,
+                                                          int             n,
+                                                          int             kl,
+                                                          int             ku,
+                                                          const float*    AB,
+                                                          int             ldab,
+                                                          hipblasStride   strideAB,
+                                                          float*          A,
+                                                          int             lda,
+                                                          hipblasStride   strideA,
+                                                          int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+    return hipblasPacked<float>(handle,
+                                hipblasPackedOp::gbunpack,
+                                HIPBLAS_FILL_MODE_FULL,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                AB,
+                                nullptr,
+                                ldab,
+                                strideAB,
+                                A,
+                                nullptr,
+                                lda,
+                                strideA,
+                                batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgbunpackStridedBatched(hipblasHandle_t handle,
+                                                          int             m,
+                                                          int             n,
+                                                          int             kl,
+                                                          int             ku,
+                                                          const double*   AB,
+                                                          int             ldab,
+                                                          hipblasStride   strideAB,
+                                                          double*         A,
+                                                          int             lda,
+                                                          hipblasStride   strideA,
+                                                          int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+    return hipblasPacked<double>(handle,
+                                 hipblasPackedOp::gbunpack,
+                                 HIPBLAS_FILL_MODE_FULL,
+                                 m,
+                                 n,
+                                 kl,
+                                 ku,
+                                 AB,
+                                 nullptr,
+                                 ldab,
+                                 strideAB,
+                                 A,
+                                 nullptr,
+                                 lda,
+                                 strideA,
+                                 batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgbunpackStridedBatched(hipblasHandle_t       handle,
+                                                          int                   m,
+                                                          int                   n,
+                                                          int                   kl,
+                                                          int                   ku,
+                                                          const hipblasComplex* AB,
+                                                          int                   ldab,
+                                                          hipblasStride         strideAB,
+                                                          hipblasComplex*       A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+    return hipblasPacked<hipblasComplex>(handle,
+                                         hipblasPackedOp::gbunpack,
+                                         HIPBLAS_FILL_MODE_FULL,
+                                         m,
+                                         n,
+                                         kl,
+                                         ku,
+                                         AB,
+                                         nullptr,
+                                         ldab,
+                                         strideAB,
+                                         A,
+                                         nullptr,
+                                         lda,
+                                         strideA,
+                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgbunpackStridedBatched(hipblasHandle_t             handle,
+                                                          int                         m,
+                                                          int                         n,
+                                                          int                         kl,
+                                                          int                         ku,
+                                                          const hipblasDoubleComplex* AB,
+                                                          int                         ldab,
+                                                          hipblasStride               strideAB,
+                                                          hipblasDoubleComplex*       A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+    return hipblasPacked<hipblasDoubleComplex>(handle,
+                                               hipblasPackedOp::gbunpack,
+                                               HIPBLAS_FILL_MODE_FULL,
+                                               m,
+                                               n,
+                                               kl,
+                                               ku,
+                                               AB,
+                                               nullptr,
+                                               ldab,
+                                               strideAB,
+                                               A,
+                                               nullptr,
+                                               lda,
+                                               strideA,
+                                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "packed.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <hip/hip_runtime.h>
+
+// Threads of a work group, which copy consecutive rows of one column
+constexpr int packed_threads = 256;
+
+// Largest grid in y and z. The work groups loop over the remaining columns and matrices.
+constexpr int packed_max_grid = 65535;
+
+// The elements are only moved, so each precision is copied as words of its size
+template <int WORDS>
+struct hipblasPackedElement
+{
+    uint32_t word[WORDS];
+};
+
+// Work group (x, y) copies rows first + x * packed_threads onwards of the stored part of column y,
+// see packed.hpp for the positions of the columns
+template <typename T>
+__global__ void __launch_bounds__(packed_threads)
+    hipblasPackedKernel(hipblasPackedOp op,
+                        bool            upper,
+                        int             m,
+                        int             n,
+                        int             kl,
+                        int             ku,
+                        const T*        src,
+                        const T* const* src_array,
+                        int             ld_src,
+                        hipblasStride   stride_src,
+                        T*              dst,
+                        T* const*       dst_array,
+                        int             ld_dst,
+                        hipblasStride   stride_dst,
+                        int             batch_count)
+{
+    bool band    = op == hipblasPackedOp::gbpack || op == hipblasPackedOp::gbunpack;
+    bool to_full = op == hipblasPackedOp::tpttr || op == hipblasPackedOp::gbunpack;
+    int  ld_full = to_full ? ld_dst : ld_src;
+    int  ld_band = to_full ? ld_src : ld_dst;
+
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        const T* s = src_array ? src_array[b] : src + b * stride_src;
+        T*       d = dst_array ? dst_array[b] : dst + b * stride_dst;
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+        {
+            int    first  = band ? max(0, j - ku) : upper ? 0 : j;
+            int    last   = band ? min(m - 1, j + kl) : upper ? j : n - 1;
+            size_t offset = band    ? size_t(j) * ld_band + ku + first - j
+                            : upper ? size_t(j) * (j + 1) / 2
+                                    : size_t(j) * (2 * size_t(n) - j + 1) / 2;
+
+            int i = first + blockIdx.x * packed_threads + threadIdx.x;
+            if(i > last)
+                continue;
+
+            size_t full    = i + size_t(j) * ld_full;
+            size_t compact = offset + (i - first);
+            if(to_full)
+                d[full] = s[compact];
+            else
+                d[compact] = s[full];
+        }
+    }
+}
+
+template <typename T>
+static hipblasStatus_t hipblasPackedLaunch(hipblasHandle_t    handle,
+                                           hipblasPackedOp    op,
+                                           bool               upper,
+                                           int                m,
+                                           int                n,
+                                           int                kl,
+                                           int                ku,
+                                           const void*        src,
+                                           const void* const* src_array,
+                                           int                ld_src,
+                                           hipblasStride      stride_src,
+                                           void*              dst,
+                                           void* const*       dst_array,
+                                           int                ld_dst,
+                                           hipblasStride      stride_dst,
+                                           int                batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The longest stored column: n rows of a triangle, or kl + ku + 1 rows of a band
+    bool band = op == hipblasPackedOp::gbpack || op == hipblasPackedOp::gbunpack;
+    int  rows = band ? std::min(m, kl + ku + 1) : n;
+    dim3 grid((rows + packed_threads - 1) / packed_threads,
+              std::min(n, packed_max_grid),
+              std::min(batch_count, packed_max_grid));
+
+    hipLaunchKernelGGL(hipblasPackedKernel<T>,
+                       grid,
+                       dim3(packed_threads),
+                       0,
+                       stream,
+                       op,
+                       upper,
+                       m,
+                       n,
+                       kl,
+                       ku,
+                       (const T*)src,
+                       (const T* const*)src_array,
+                       ld_src,
+                       stride_src,
+                       (T*)dst,
+                       (T* const*)dst_array,
+                       ld_dst,
+                       stride_dst,
+                       batch_count);
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasPackedKernels(hipblasHandle_t    handle,
+                                     hipblasPackedOp    op,
+                                     bool               upper,
+                                     int                m,
+                                     int                n,
+                                     int                kl,
+                                     int                ku,
+                                     const void*        src,
+                                     const void* const* src_array,
+                                     int                ld_src,
+                                     hipblasStride      stride_src,
+                                     void*              dst,
+                                     void* const*       dst_array,
+                                     int                ld_dst,
+                                     hipblasStride      stride_dst,
+                                     int                batch_count,
+                                     size_t             element_size)
+{
+    auto launch = [&](auto element) {
+        return hipblasPackedLaunch<decltype(element)>(handle,
+                                                      op,
+                                                      upper,
+                                                      m,
+                                                      n,
+                                                      kl,
+                                                      ku,
+                                                      src,
+                                                      src_array,
+                                                      ld_src,
+                                                      stride_src,
+                                                      dst,
+                                                      dst_array,
+                                                      ld_dst,
+                                                      stride_dst,
+                                                      batch_count);
+    };
+
+    switch(element_size)
+    {
+    case 4:
+        return launch(hipblasPackedElement<1>());
+    case 8:
+        return launch(hipblasPackedElement<2>());
+    case 16:
+        return launch(hipblasPackedElement<4>());
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
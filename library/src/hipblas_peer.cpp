@@ -0,0 +1,732 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "stream_pool.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <mutex>
+#include <utility>
+
+// Device memory per staging buffer of a peer gemm. Each batch chunk is staged in one of two
+// buffers, so the copy of the next chunk overlaps the gemm of the current one.
+static constexpr size_t peer_buffer_bytes = size_t(64) << 20;
+static constexpr int    peer_buffers      = 2;
+
+// Whether device, which is current, can access the memory of peer. Access is enabled the first
+// time it is asked for and kept until the process exits.
+static bool hipblasPeerAccess(int device, int peer)
+{
+    static std::mutex                          access_mutex;
+    static std::map<std::pair<int, int>, bool> access;
+
+    std::lock_guard<std::mutex> lock(access_mutex);
+
+    auto it = access.find({device, peer});
+    if(it != access.end())
+        return it->second;
+
+    int  can     = 0;
+    bool enabled = hipDeviceCanAccessPeer(&can, device, peer) == hipSuccess && can;
+    if(enabled)
+    {
+        hipError_t error = hipDeviceEnablePeerAccess(peer, 0);
+        enabled          = error == hipSuccess || error == hipErrorPeerAccessAlreadyEnabled;
+    }
+    (void)hipGetLastError();
+    access[{device, peer}] = enabled;
+    return enabled;
+}
+
+// Copies the rows x cols matrix A on srcDevice to B on dstDevice on stream. Contiguous matrices
+// and matrices on devices with peer access take one copy, other matrices a copy per column.
+static hipblasStatus_t hipblasPeerCopy(int         rows,
+                                       int         cols,
+                                       int         elemSize,
+                                       const void* A,
+                                       int         lda,
+                                       int         srcDevice,
+                                       void*       B,
+                                       int         ldb,
+                                       int         dstDevice,
+                                       hipStream_t stream)
+{
+    int count;
+    if(hipGetDeviceCount(&count) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(rows < 0 || cols < 0 || elemSize <= 0 || lda <= 0 || ldb <= 0 || lda < rows || ldb < rows
+       || srcDevice < 0 || srcDevice >= count || dstDevice < 0 || dstDevice >= count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!A || !B)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    const char* src   = static_cast<const char*>(A);
+    char*       dst   = static_cast<char*>(B);
+    size_t      width = size_t(rows) * elemSize;
+    hipError_t  error = hipSuccess;
+    if(cols == 1 || (lda == rows && ldb == rows))
+        error = hipMemcpyPeerAsync(dst, dstDevice, src, srcDevice, width * cols, stream);
+    else if(srcDevice == dstDevice
+            || (device == srcDevice && hipblasPeerAccess(device, dstDevice))
+            || (device == dstDevice && hipblasPeerAccess(device, srcDevice)))
+        error = hipMemcpy2DAsync(dst,
+                                 size_t(ldb) * elemSize,
+                                 src,
+                                 size_t(lda) * elemSize,
+                                 width,
+                                 cols,
+                                 hipMemcpyDeviceToDevice,
+                                 stream);
+    else
+        for(int j = 0; j < cols && error == hipSuccess; j++)
+            error = hipMemcpyPeerAsync(dst + size_t(j) * ldb * elemSize,
+                                       dstDevice,
+                                       src + size_t(j) * lda * elemSize,
+                                       srcDevice,
+                                       width,
+                                       stream);
+    if(error == hipSuccess)
+        return HIPBLAS_STATUS_SUCCESS;
+    (void)hipGetLastError();
+    return HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+extern "C" hipblasStatus_t hipblasCopyMatrixPeer(int         rows,
+                                                 int         cols,
+                                                 int         elemSize,
+                                                 const void* A,
+                                                 int         lda,
+                                                 int         srcDevice,
+                                                 void*       B,
+                                                 int         ldb,
+                                                 int         dstDevice)
+try
+{
+    HIPBLAS_LAYER(nullptr, rows, cols, elemSize, A, lda, srcDevice, B, ldb, dstDevice);
+    hipblasStatus_t status
+        = hipblasPeerCopy(rows, cols, elemSize, A, lda, srcDevice, B, ldb, dstDevice, 0);
+    if(status == HIPBLAS_STATUS_SUCCESS && hipStreamSynchronize(0) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCopyMatrixPeerAsync(int         rows,
+                                                      int         cols,
+                                                      int         elemSize,
+                                                      const void* A,
+                                                      int         lda,
+                                                      int         srcDevice,
+                                                      void*       B,
+                                                      int         ldb,
+                                                      int         dstDevice,
+                                                      hipStream_t stream)
+try
+{
+    HIPBLAS_LAYER(nullptr, rows, cols, elemSize, A, lda, srcDevice, B, ldb, dstDevice, stream);
+    return hipblasPeerCopy(rows, cols, elemSize, A, lda, srcDevice, B, ldb, dstDevice, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCopyVectorPeer(int         n,
+                                                 int         elemSize,
+                                                 const void* x,
+                                                 int         incx,
+                                                 int         srcDevice,
+                                                 void*       y,
+                                                 int         incy,
+                                                 int         dstDevice)
+try
+{
+    HIPBLAS_LAYER(nullptr, n, elemSize, x, incx, srcDevice, y, incy, dstDevice);
+    if(n < 0 || incx <= 0 || incy <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblasStatus_t status
+        = hipblasPeerCopy(1, n, elemSize, x, incx, srcDevice, y, incy, dstDevice, 0);
+    if(status == HIPBLAS_STATUS_SUCCESS && hipStreamSynchronize(0) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCopyVectorPeerAsync(int         n,
+                                                      int         elemSize,
+                                                      const void* x,
+                                                      int         incx,
+                                                      int         srcDevice,
+                                                      void*       y,
+                                                      int         incy,
+                                                      int         dstDevice,
+                                                      hipStream_t stream)
+try
+{
+    HIPBLAS_LAYER(nullptr, n, elemSize, x, incx, srcDevice, y, incy, dstDevice, stream);
+    if(n < 0 || incx <= 0 || incy <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return hipblasPeerCopy(1, n, elemSize, x, incx, srcDevice, y, incy, dstDevice, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// hipBLAS functions of each precision run by the peer gemm
+template <typename T>
+struct hipblasPeerFunctions;
+
+template <>
+struct hipblasPeerFunctions<float>
+{
+    static constexpr auto gemmStridedBatched = hipblasSgemmStridedBatched;
+};
+
+template <>
+struct hipblasPeerFunctions<double>
+{
+    static constexpr auto gemmStridedBatched = hipblasDgemmStridedBatched;
+};
+
+template <>
+struct hipblasPeerFunctions<hipblasComplex>
+{
+    static constexpr auto gemmStridedBatched = hipblasCgemmStridedBatched;
+};
+
+template <>
+struct hipblasPeerFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto gemmStridedBatched = hipblasZgemmStridedBatched;
+};
+
+// Copy stream, events and device buffers of one staged gemm, released when it returns. hipFree
+// waits for the device, so no gemm still reads the buffers.
+struct hipblasPeerResources
+{
+    hipStream_t copy                   = nullptr;
+    hipEvent_t  copied[peer_buffers]   = {};
+    hipEvent_t  computed[peer_buffers] = {};
+    void*       base                   = nullptr;
+
+    ~hipblasPeerResources()
+    {
+        if(base)
+            (void)hipFree(base);
+        for(int i = 0; i < peer_buffers; i++)
+        {
+            if(copied[i])
+                (void)hipEventDestroy(copied[i]);
+            if(computed[i])
+                (void)hipEventDestroy(computed[i]);
+        }
+        if(copy)
+            (void)hipStreamDestroy(copy);
+    }
+};
+
+// C_i := alpha op(A_i) op(B_i) + beta C_i with A_i and B_i on peerDevice. When the current device
+// can access the peer, the gemm reads them in place. Otherwise chunks of the batch are copied
+// with hipMemcpyPeerAsync on a copy stream into two device buffers in turn, and the gemm of each
+// chunk waits for its copy, so the copy of the next chunk overlaps the gemm of the current one.
+template <typename T>
+static hipblasStatus_t hipblasGemmPeer(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const T*           alpha,
+                                       const T*           A,
+                                       int                lda,
+                                       hipblasStride      strideA,
+                                       const T*           B,
+                                       int                ldb,
+                                       hipblasStride      strideB,
+                                       int                peerDevice,
+                                       const T*           beta,
+                                       T*                 C,
+                                       int                ldc,
+                                       hipblasStride      strideC,
+                                       int                batchCount)
+{
+    using F = hipblasPeerFunctions<T>;
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    auto valid_op = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    };
+    if(!valid_op(transA) || !valid_op(transB))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int device, count;
+    if(hipGetDevice(&device) != hipSuccess || hipGetDeviceCount(&count) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    int rows_a = transA == HIPBLAS_OP_N ? m : k, cols_a = transA == HIPBLAS_OP_N ? k : m;
+    int rows_b = transB == HIPBLAS_OP_N ? k : n, cols_b = transB == HIPBLAS_OP_N ? n : k;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || lda < std::max(1, rows_a)
+       || ldb < std::max(1, rows_b) || ldc < std::max(1, m) || peerDevice < 0
+       || peerDevice >= count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Without products to stage, or with operands the device can read, this is one gemm
+    if(!m || !n || !k || !batchCount || peerDevice == device
+       || hipblasPeerAccess(device, peerDevice))
+        return F::gemmStridedBatched(handle,
+                                     transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     strideA,
+                                     B,
+                                     ldb,
+                                     strideB,
+                                     beta,
+                                     C,
+                                     ldc,
+                                     strideC,
+                                     batchCount);
+
+    // The copies are steered from the host
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    auto fail = [](hipError_t error) {
+        if(error == hipSuccess)
+            return false;
+        (void)hipGetLastError();
+        return true;
+    };
+
+    hipblasPeerResources res;
+    if(fail(hipblasInternalStreamCreate(handle, &res.copy)))
+    {
+        res.copy = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    for(int i = 0; i < peer_buffers; i++)
+    {
+        if(fail(hipEventCreateWithFlags(&res.copied[i], hipEventDisableTiming))
+           || fail(hipEventCreateWithFlags(&res.computed[i], hipEventDisableTiming))
+           || fail(hipEventRecord(res.computed[i], stream)))
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    // Each A_i and B_i is copied with its leading dimension, span elements into size elements of
+    // a buffer. An operand with stride 0 is copied once, outside the buffers.
+    size_t span_a = size_t(lda) * (cols_a - 1) + rows_a;
+    size_t span_b = size_t(ldb) * (cols_b - 1) + rows_b;
+    size_t size_a = strideA ? size_t(lda) * cols_a : 0;
+    size_t size_b = strideB ? size_t(ldb) * cols_b : 0;
+    size_t once   = (strideA ? 0 : span_a) + (strideB ? 0 : span_b);
+
+    // At least four chunks, fewer batches per chunk while the buffers do not fit
+    int chunk = std::max(1, (batchCount + 3) / 4);
+    if(size_a + size_b)
+        chunk = int(std::min<size_t>(
+            chunk, std::max<size_t>(1, peer_buffer_bytes / (sizeof(T) * (size_a + size_b)))));
+    while(true)
+    {
+        size_t elements = peer_buffers * chunk * (size_a + size_b) + once;
+        if(hipMalloc(&res.base, sizeof(T) * elements) == hipSuccess)
+            break;
+        res.base = nullptr;
+        (void)hipGetLastError();
+        if(chunk == 1)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        chunk = (chunk + 1) / 2;
+    }
+
+    T* base = static_cast<T*>(res.base);
+    T* dA[peer_buffers];
+    T* dB[peer_buffers];
+    for(int s = 0; s < peer_buffers; s++)
+    {
+        dA[s] = base + s * chunk * (size_a + size_b);
+        dB[s] = dA[s] + chunk * size_a;
+    }
+    T* dOnce = base + peer_buffers * chunk * (size_a + size_b);
+    if(!strideA)
+        std::fill(dA, dA + peer_buffers, dOnce);
+    if(!strideB)
+        std::fill(dB, dB + peer_buffers, dOnce + (strideA ? 0 : span_a));
+
+    // Copies the cb operands from b0 on, with one copy when they are contiguous
+    auto copy = [&](const T*      src,
+                    hipblasStride stride,
+                    size_t        span,
+                    size_t        size,
+                    T*            dst,
+                    int           b0,
+                    int           cb) {
+        hipError_t error = hipSuccess;
+        if(stride == hipblasStride(size))
+            error = hipMemcpyPeerAsync(dst,
+                                       device,
+                                       src + b0 * stride,
+                                       peerDevice,
+                                       sizeof(T) * (size * (cb - 1) + span),
+                                       res.copy);
+        for(int b = 0; b < cb && stride != hipblasStride(size) && error == hipSuccess; b++)
+            error = hipMemcpyPeerAsync(dst + b * size,
+                                       device,
+                                       src + (b0 + b) * stride,
+                                       peerDevice,
+                                       sizeof(T) * span,
+                                       res.copy);
+        return fail(error);
+    };
+
+    if((!strideA && copy(A, 0, span_a, 0, dA[0], 0, 1))
+       || (!strideB && copy(B, 0, span_b, 0, dB[0], 0, 1)))
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    for(int b0 = 0, c = 0; b0 < batchCount && status == HIPBLAS_STATUS_SUCCESS; b0 += chunk, c++)
+    {
+        int s  = c % peer_buffers;
+        int cb = std::min(chunk, batchCount - b0);
+
+        // Refill buffer s once the gemm that last read it is done
+        if(fail(hipStreamWaitEvent(res.copy, res.computed[s], 0))
+           || (strideA && copy(A, strideA, span_a, size_a, dA[s], b0, cb))
+           || (strideB && copy(B, strideB, span_b, size_b, dB[s], b0, cb))
+           || fail(hipEventRecord(res.copied[s], res.copy))
+           || fail(hipStreamWaitEvent(stream, res.copied[s], 0)))
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = F::gemmStridedBatched(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           dA[s],
+                                           lda,
+                                           hipblasStride(size_a),
+                                           dB[s],
+                                           ldb,
+                                           hipblasStride(size_b),
+                                           beta,
+                                           C + b0 * strideC,
+                                           ldc,
+                                           strideC,
+                                           cb);
+        if(status == HIPBLAS_STATUS_SUCCESS && fail(hipEventRecord(res.computed[s], stream)))
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    if(fail(hipStreamSynchronize(res.copy)) && status == HIPBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+
+extern "C" hipblasStatus_t hipblasSgemmStridedBatchedPeer(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transA,
+                                                          hipblasOperation_t transB,
+                                                          int                m,
+                                                          int                n,
+                                                          int                k,
+                                                          const float*       alpha,
+                                                          const float*       A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          const float*       B,
+                                                          int                ldb,
+                                                          hipblasStride      strideB,
+                                                          int                peerDevice,
+                                                          const float*       beta,
+                                                          float*             C,
+                                                          int                ldc,
+                                                          hipblasStride      strideC,
+                                                          int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  strideA,
+                  B,
+                  ldb,
+                  strideB,
+                  peerDevice,
+                  beta,
+                  C,
+                  ldc,
+                  strideC,
+                  batchCount);
+    return hipblasGemmPeer<float>(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  strideA,
+                                  B,
+                                  ldb,
+                                  strideB,
+                                  peerDevice,
+                                  beta,
+                                  C,
+                                  ldc,
+                                  strideC,
+                                  batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgemmStridedBatchedPeer(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transA,
+                                                          hipblasOperation_t transB,
+                                                          int                m,
+                                                          int                n,
+                                                          int                k,
+                                                          const double*      alpha,
+                                                          const double*      A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          const double*      B,
+                                                          int                ldb,
+                                                          hipblasStride      strideB,
+                                                          int                peerDevice,
+                                                          const double*      beta,
+                                                          double*            C,
+                                                          int                ldc,
+                                                          hipblasStride      strideC,
+                                                          int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  strideA,
+                  B,
+                  ldb,
+                  strideB,
+                  peerDevice,
+                  beta,
+                  C,
+                  ldc,
+                  strideC,
+                  batchCount);
+    return hipblasGemmPeer<double>(handle,
+                                   transA,
+                                   transB,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   lda,
+                                   strideA,
+                                   B,
+                                   ldb,
+                                   strideB,
+                                   peerDevice,
+                                   beta,
+                                   C,
+                                   ldc,
+                                   strideC,
+                                   batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgemmStridedBatchedPeer(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    transA,
+                                                          hipblasOperation_t    transB,
+                                                          int                   m,
+                                                          int                   n,
+                                                          int                   k,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          const hipblasComplex* B,
+                                                          int                   ldb,
+                                                          hipblasStride         strideB,
+                                                          int                   peerDevice,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       C,
+                                                          int                   ldc,
+                                                          hipblasStride         strideC,
+                                                          int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  strideA,
+                  B,
+                  ldb,
+                  strideB,
+                  peerDevice,
+                  beta,
+                  C,
+                  ldc,
+                  strideC,
+                  batchCount);
+    return hipblasGemmPeer<hipblasComplex>(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           A,
+                                           lda,
+                                           strideA,
+                                           B,
+                                           ldb,
+                                           strideB,
+                                           peerDevice,
+                                           beta,
+                                           C,
+                                           ldc,
+                                           strideC,
+                                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgemmStridedBatchedPeer(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasOperation_t          transB,
+                                                          int                         m,
+                                                          int                         n,
+                                                          int                         k,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          const hipblasDoubleComplex* B,
+                                                          int                         ldb,
+                                                          hipblasStride               strideB,
+                                                          int                         peerDevice,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       C,
+                                                          int                         ldc,
+                                                          hipblasStride               strideC,
+                                                          int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  strideA,
+                  B,
+                  ldb,
+                  strideB,
+                  peerDevice,
+                  beta,
+                  C,
+                  ldc,
+                  strideC,
+                  batchCount);
+    return hipblasGemmPeer<hipblasDoubleComplex>(handle,
+                                                 transA,
+                                                 transB,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 A,
+                                                 lda,
+                                                 strideA,
+                                                 B,
+                                                 ldb,
+                                                 strideB,
+                                                 peerDevice,
+                                                 beta,
+                                                 C,
+                                                 ldc,
+                                                 strideC,
+                                                 batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
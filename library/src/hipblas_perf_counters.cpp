@@ -0,0 +1,488 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "perf_counters.hpp"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+// Timed calls whose events have not completed. Past it, calls are not timed until some complete.
+static constexpr size_t perf_counter_max_pending = 256;
+
+std::atomic<int> hipblas_perf_counter_handles{0};
+
+thread_local int hipblas_perf_counter_depth = 0;
+
+struct hipblasPerfCounterRoutine
+{
+    const char* func = nullptr;
+    uint64_t    calls = 0;
+    double      flops = 0;
+    double      bytes = 0;
+    uint64_t    timed_calls = 0;
+    double      time_us     = 0;
+};
+
+struct hipblasPerfCounterState
+{
+    std::mutex                              mutex;
+    hipblasPerfCountersMode_t               mode     = HIPBLAS_PERF_COUNTERS_OFF;
+    int                                     interval = 1;
+    std::vector<hipblasPerfCounterRoutine>  routines;
+    std::unordered_map<const char*, size_t> index; // of routines, by the __func__ of the routine
+    std::vector<hipblasPerfCounterSample>   pending; // timed calls waiting for their events
+    std::vector<std::pair<hipEvent_t, hipEvent_t>> events; // not recorded
+
+    ~hipblasPerfCounterState()
+    {
+        for(hipblasPerfCounterSample& sample : pending)
+            events.emplace_back(sample.start, sample.stop);
+        for(auto& pair : events)
+        {
+            (void)hipEventDestroy(pair.first);
+            (void)hipEventDestroy(pair.second);
+        }
+    }
+};
+
+static std::shared_mutex perf_counter_mutex;
+static std::unordered_map<hipblasHandle_t, std::shared_ptr<hipblasPerfCounterState>>
+    perf_counter_states;
+
+void hipblasPerfCounterSize(hipblasPerfCounterSizes& sizes, const std::string& name, int64_t value)
+{
+    if(name == "m" || name == "rows")
+        sizes.m = value;
+    else if(name == "n" || name == "cols")
+        sizes.n = value;
+    else if(name == "k")
+        sizes.k = value;
+    else if(name == "kl")
+        sizes.kl = value;
+    else if(name == "ku")
+        sizes.ku = value;
+    else if(name == "nrhs")
+        sizes.nrhs = value;
+    else if(name == "batchCount" || name == "batch_count")
+        sizes.batch = value;
+}
+
+void hipblasPerfCounterSize(hipblasPerfCounterSizes& sizes,
+                            const std::string&       name,
+                            hipblasOperation_t       trans)
+{
+    if(name == "trans" || name == "transa" || name == "transA")
+        sizes.trans = trans;
+}
+
+void hipblasPerfCounterSize(hipblasPerfCounterSizes& sizes,
+                            const std::string&,
+                            hipblasSideMode_t side)
+{
+    sizes.side = side;
+}
+
+void hipblasPerfCounterSize(hipblasPerfCounterSizes& sizes,
+                            const std::string&       name,
+                            hipDataType              type)
+{
+    if(!sizes.typed
+       && (name == "a_type" || name == "aType" || name == "Atype" || name == "xType"
+           || name == "x_type"))
+    {
+        sizes.type  = type;
+        sizes.typed = true;
+    }
+}
+
+const std::vector<std::string>& hipblasPerfCounterNames(const char* names)
+{
+    static thread_local std::unordered_map<const char*, std::vector<std::string>> cache;
+
+    auto it = cache.find(names);
+    if(it == cache.end())
+        it = cache.emplace(names, hipblasLayerNames(names)).first;
+    return it->second;
+}
+
+std::shared_ptr<hipblasPerfCounterState> hipblasPerfCounterFind(hipblasHandle_t handle)
+{
+    std::shared_lock<std::shared_mutex> lock(perf_counter_mutex);
+
+    auto it = perf_counter_states.find(handle);
+    return it == perf_counter_states.end() ? nullptr : it->second;
+}
+
+static double hipblasPerfCounterTri(double n)
+{
+    return n * (n + 1) / 2;
+}
+
+bool hipblasPerfCounterWork(const char*                    func,
+                            const hipblasPerfCounterSizes& sizes,
+                            double&                        flops,
+                            double&                        bytes)
+{
+    std::string name, precision;
+    hipblasLayerBenchFunction(func, name, precision);
+    for(const char* suffix : {"_ex", "_async", "_strided_batched", "_batched", "3m"})
+    {
+        size_t len = std::strlen(suffix);
+        if(name.size() > len && !name.compare(name.size() - len, len, suffix))
+            name.resize(name.size() - len);
+    }
+
+    // hipblasCsscal, hipblasScnrm2 and the like name a second precision, of a real scalar or result
+    bool real_scalar = false;
+    if(name == "sscal" || name == "dscal" || name == "srot" || name == "drot" || name == "cnrm2"
+       || name == "znrm2" || name == "casum" || name == "zasum")
+    {
+        if(name[0] == 'c' || name[0] == 'z')
+            precision = name[0] == 'c' ? "f32_c" : "f64_c";
+        real_scalar = true;
+        name.erase(0, 1);
+    }
+
+    size_t elem    = 0;
+    bool   complex = false;
+    if(precision == "f32_r" || precision == "f64_r" || precision == "f16_r")
+        elem = precision == "f64_r" ? 8 : precision == "f32_r" ? 4 : 2;
+    else if(precision == "f32_c" || precision == "f64_c")
+    {
+        elem    = precision == "f64_c" ? 16 : 8;
+        complex = true;
+    }
+    else if(sizes.typed)
+    {
+        elem    = hipblasDatatypeElementSize(sizes.type);
+        complex = hipblasDatatypeComplex(sizes.type);
+    }
+
+    double m = double(sizes.m), n = double(sizes.n), k = double(sizes.k);
+    double ops = 0, elems = 0;
+
+    if(name == "axpy")
+        ops = 2 * n, elems = 3 * n;
+    else if(name == "dot" || name == "dotc" || name == "dotu")
+        ops = 2 * n, elems = 2 * n;
+    else if(name == "scal")
+        ops = n, elems = 2 * n;
+    else if(name == "nrm2")
+        ops = 2 * n, elems = n;
+    else if(name == "asum" || name == "amax" || name == "amin" || name == "iamax"
+            || name == "iamin")
+        ops = n, elems = n;
+    else if(name == "copy")
+        elems = 2 * n;
+    else if(name == "swap")
+        elems = 4 * n;
+    else if(name == "rot" || name == "rotm")
+        ops = 6 * n, elems = 4 * n;
+    else if(name == "gemv")
+        ops = 2 * m * n, elems = m * n + (sizes.trans == HIPBLAS_OP_N ? n + 2 * m : m + 2 * n);
+    else if(name == "gbmv")
+    {
+        double band = std::min(m, n) * double(sizes.kl + sizes.ku + 1);
+        ops = 2 * band, elems = band + m + n;
+    }
+    else if(name == "ger" || name == "geru" || name == "gerc")
+        ops = 2 * m * n, elems = 2 * m * n + m + n;
+    else if(name == "symv" || name == "hemv" || name == "spmv" || name == "hpmv")
+        ops = 2 * n * n, elems = hipblasPerfCounterTri(n) + 3 * n;
+    else if(name == "sbmv" || name == "hbmv")
+        ops = 2 * n * (2 * k + 1), elems = n * (k + 1) + 3 * n;
+    else if(name == "trmv" || name == "trsv" || name == "tpmv" || name == "tpsv")
+        ops = n * n, elems = hipblasPerfCounterTri(n) + 2 * n;
+    else if(name == "tbmv" || name == "tbsv")
+        ops = n * (2 * k + 1), elems = n * (k + 1) + 2 * n;
+    else if(name == "syr" || name == "her" || name == "spr" || name == "hpr")
+        ops = n * n, elems = 2 * hipblasPerfCounterTri(n) + n;
+    else if(name == "syr2" || name == "her2" || name == "spr2" || name == "hpr2")
+        ops = 2 * n * n, elems = 2 * hipblasPerfCounterTri(n) + 2 * n;
+    else if(name == "gemm")
+        ops = 2 * m * n * k, elems = m * k + n * k + m * n;
+    else if(name == "gemmt")
+        ops = 2 * k * hipblasPerfCounterTri(n), elems = 2 * n * k + hipblasPerfCounterTri(n);
+    else if(name == "symm" || name == "hemm")
+    {
+        double ka = sizes.side == HIPBLAS_SIDE_LEFT ? m : n;
+        ops = 2 * ka * m * n, elems = hipblasPerfCounterTri(ka) + 2 * m * n;
+    }
+    else if(name == "syrk" || name == "herk")
+        ops = k * n * (n + 1), elems = n * k + hipblasPerfCounterTri(n);
+    else if(name == "syr2k" || name == "her2k" || name == "syrkx" || name == "herkx")
+        ops = 2 * k * n * (n + 1), elems = 2 * n * k + hipblasPerfCounterTri(n);
+    else if(name == "trmm" || name == "trsm" || name == "tpmm" || name == "tpsm")
+    {
+        double ka = sizes.side == HIPBLAS_SIDE_LEFT ? m : n;
+        ops = ka * m * n, elems = hipblasPerfCounterTri(ka) + 2 * m * n;
+    }
+    else if(name == "geam")
+        ops = 3 * m * n, elems = 3 * m * n;
+    else if(name == "dgmm")
+        ops = m * n, elems = 2 * m * n + (sizes.side == HIPBLAS_SIDE_LEFT ? m : n);
+    else if(name == "getrf")
+        ops = 2 * n * n * n / 3, elems = 2 * n * n;
+    else if(name == "getrf_rect")
+    {
+        double mn = std::min(m, n), mx = std::max(m, n);
+        ops = mx * mn * mn - mn * mn * mn / 3, elems = 2 * m * n;
+    }
+    else if(name == "getrs" || name == "potrs")
+        ops = 2 * n * n * double(sizes.nrhs), elems = n * n + 2 * n * double(sizes.nrhs);
+    else if(name == "potrf")
+        ops = n * n * n / 3, elems = 2 * hipblasPerfCounterTri(n);
+    else if(name == "getri")
+        ops = 4 * n * n * n / 3, elems = 2 * n * n;
+    else if(name == "geqrf")
+        ops = 2 * m * n * n - 2 * n * n * n / 3, elems = 2 * m * n;
+    else
+        return false;
+
+    // A complex multiply-add is four real ones, except by a real scalar
+    if(complex)
+        ops *= real_scalar ? 2 : 4;
+
+    flops = ops * double(sizes.batch);
+    bytes = elems * double(elem) * double(sizes.batch);
+    return true;
+}
+
+// Adds the times of the timed calls whose events completed. The lock of state is held.
+static void hipblasPerfCounterCollect(hipblasPerfCounterState& state)
+{
+    size_t kept = 0;
+    for(hipblasPerfCounterSample& sample : state.pending)
+    {
+        hipError_t status = hipEventQuery(sample.stop);
+        if(status == hipErrorNotReady)
+        {
+            state.pending[kept++] = sample;
+            continue;
+        }
+
+        float ms = 0;
+        if(status == hipSuccess && sample.routine < state.routines.size()
+           && hipEventElapsedTime(&ms, sample.start, sample.stop) == hipSuccess)
+        {
+            state.routines[sample.routine].timed_calls++;
+            state.routines[sample.routine].time_us += ms * 1000.0;
+        }
+        state.events.emplace_back(sample.start, sample.stop);
+    }
+    state.pending.resize(kept);
+}
+
+bool hipblasPerfCounterBegin(hipblasPerfCounterState&       state,
+                             hipblasHandle_t                handle,
+                             const char*                    func,
+                             const hipblasPerfCounterSizes& sizes,
+                             hipblasPerfCounterSample&      sample)
+{
+    double flops = 0, bytes = 0;
+    hipblasPerfCounterWork(func, sizes, flops, bytes);
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if(state.mode == HIPBLAS_PERF_COUNTERS_OFF)
+        return false;
+
+    auto it = state.index.find(func);
+    if(it == state.index.end())
+    {
+        it = state.index.emplace(func, state.routines.size()).first;
+        state.routines.emplace_back();
+        state.routines.back().func = func;
+    }
+
+    hipblasPerfCounterRoutine& routine = state.routines[it->second];
+    bool sampled = state.mode == HIPBLAS_PERF_COUNTERS_TIMED && routine.calls % state.interval == 0;
+    routine.calls++;
+    routine.flops += flops;
+    routine.bytes += bytes;
+    if(!sampled)
+        return false;
+
+    hipblasPerfCounterCollect(state);
+
+    // Events recorded while the stream is captured would become part of the graph
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(state.pending.size() >= perf_counter_max_pending
+       || hipblasGetStream(handle, &sample.stream) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(sample.stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+        return false;
+
+    if(state.events.empty())
+    {
+        hipEvent_t start, stop;
+        if(hipEventCreate(&start) != hipSuccess)
+            return false;
+        if(hipEventCreate(&stop) != hipSuccess)
+        {
+            (void)hipEventDestroy(start);
+            return false;
+        }
+        state.events.emplace_back(start, stop);
+    }
+
+    sample.start   = state.events.back().first;
+    sample.stop    = state.events.back().second;
+    sample.routine = it->second;
+    if(hipEventRecord(sample.start, sample.stream) != hipSuccess)
+        return false;
+    state.events.pop_back();
+    return true;
+}
+
+void hipblasPerfCounterEnd(hipblasPerfCounterState& state, hipblasPerfCounterSample& sample)
+{
+    bool recorded = hipEventRecord(sample.stop, sample.stream) == hipSuccess;
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if(recorded)
+        state.pending.push_back(sample);
+    else
+        state.events.emplace_back(sample.start, sample.stop);
+}
+
+void hipblasPerfCountersErase(hipblasHandle_t handle)
+{
+    std::unique_lock<std::shared_mutex> lock(perf_counter_mutex);
+
+    auto it = perf_counter_states.find(handle);
+    if(it == perf_counter_states.end())
+        return;
+
+    {
+        std::lock_guard<std::mutex> state_lock(it->second->mutex);
+        if(it->second->mode != HIPBLAS_PERF_COUNTERS_OFF)
+            hipblas_perf_counter_handles--;
+    }
+    perf_counter_states.erase(it);
+}
+
+extern "C" hipblasStatus_t hipblasSetPerfCounters(hipblasHandle_t           handle,
+                                                  hipblasPerfCountersMode_t mode,
+                                                  int                       sampleInterval)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode, sampleInterval);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_PERF_COUNTERS_OFF && mode != HIPBLAS_PERF_COUNTERS_ON
+       && mode != HIPBLAS_PERF_COUNTERS_TIMED)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(mode == HIPBLAS_PERF_COUNTERS_TIMED && sampleInterval < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::unique_lock<std::shared_mutex> lock(perf_counter_mutex);
+
+    std::shared_ptr<hipblasPerfCounterState>& state = perf_counter_states[handle];
+    if(!state)
+        state = std::make_shared<hipblasPerfCounterState>();
+
+    std::lock_guard<std::mutex> state_lock(state->mutex);
+    if(state->mode == HIPBLAS_PERF_COUNTERS_OFF && mode != HIPBLAS_PERF_COUNTERS_OFF)
+        hipblas_perf_counter_handles++;
+    else if(state->mode != HIPBLAS_PERF_COUNTERS_OFF && mode == HIPBLAS_PERF_COUNTERS_OFF)
+        hipblas_perf_counter_handles--;
+    state->mode     = mode;
+    state->interval = mode == HIPBLAS_PERF_COUNTERS_TIMED ? sampleInterval : 1;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasGetPerfCounters(hipblasHandle_t handle, hipblasPerfCounter_t* counters, int* count)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, counters, count);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!count || (counters && *count < 0))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::shared_ptr<hipblasPerfCounterState> state = hipblasPerfCounterFind(handle);
+    if(!state)
+    {
+        *count = 0;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    hipblasPerfCounterCollect(*state);
+
+    size_t size = counters ? std::min(size_t(*count), state->routines.size()) : 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        const hipblasPerfCounterRoutine& routine = state->routines[i];
+        hipblasPerfCounter_t&            counter = counters[i];
+
+        std::strncpy(counter.routine, routine.func, sizeof(counter.routine) - 1);
+        counter.routine[sizeof(counter.routine) - 1] = '\0';
+        counter.calls                                = routine.calls;
+        counter.flops                                = routine.flops;
+        counter.bytes                                = routine.bytes;
+        counter.timedCalls                           = routine.timed_calls;
+        counter.timeUs                               = routine.time_us;
+    }
+    *count = int(state->routines.size());
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasResetPerfCounters(hipblasHandle_t handle)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    std::shared_ptr<hipblasPerfCounterState> state = hipblasPerfCounterFind(handle);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // Events still pending are recorded again only once they are taken by a later timed call
+    std::lock_guard<std::mutex> lock(state->mutex);
+    for(hipblasPerfCounterSample& sample : state->pending)
+        state->events.emplace_back(sample.start, sample.stop);
+    state->pending.clear();
+    state->routines.clear();
+    state->index.clear();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,156 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "persistent.hpp"
+#include <atomic>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <thread>
+
+struct hipblasPersistentContext
+{
+    hipblasPersistentRing* ring        = nullptr;
+    hipblasPersistentRing* device_ring = nullptr;
+    hipStream_t            stream      = nullptr;
+    uint64_t               head        = 0;
+
+    // Work may be enqueued on the handle stream, which the next post waits for
+    bool stream_pending = true;
+};
+
+static uint64_t hipblasPersistentTail(const hipblasPersistentContext* context)
+{
+    return *(volatile const uint64_t*)&context->ring->tail;
+}
+
+// Spins until the kernel has run the descriptors before head - count, returning an error when it
+// ended without running them
+static hipblasStatus_t hipblasPersistentWait(hipblasPersistentContext* context, uint64_t count)
+{
+    for(unsigned spins = 1; context->head - hipblasPersistentTail(context) > count; spins++)
+    {
+        // Checking the stream costs a call, so it is only done once in a while
+        if(spins % 1024 == 0)
+        {
+            if(hipStreamQuery(context->stream) != hipErrorNotReady)
+            {
+                (void)hipGetLastError();
+                return context->head - hipblasPersistentTail(context) > count
+                           ? HIPBLAS_STATUS_EXECUTION_FAILED
+                           : HIPBLAS_STATUS_SUCCESS;
+            }
+            std::this_thread::yield();
+        }
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasPersistentCreate(hipStream_t stream, hipblasPersistentContext** context)
+{
+#ifdef HIPBLAS_PERSISTENT
+    auto* c = new hipblasPersistentContext;
+    if(hipHostMalloc((void**)&c->ring,
+                     sizeof(hipblasPersistentRing),
+                     hipHostMallocMapped | hipHostMallocCoherent)
+       != hipSuccess)
+    {
+        (void)hipGetLastError();
+        delete c;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    memset(c->ring, 0, sizeof(hipblasPersistentRing));
+
+    // The kernel starts after the work enqueued on stream so far
+    hipEvent_t      ready  = nullptr;
+    hipblasStatus_t status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    if(hipHostGetDevicePointer((void**)&c->device_ring, c->ring, 0) == hipSuccess
+       && hipStreamCreateWithFlags(&c->stream, hipStreamNonBlocking) == hipSuccess
+       && hipEventCreateWithFlags(&ready, hipEventDisableTiming) == hipSuccess
+       && hipEventRecord(ready, stream) == hipSuccess
+       && hipStreamWaitEvent(c->stream, ready, 0) == hipSuccess)
+        status = hipblasPersistentLaunch(c->device_ring, c->stream);
+    else
+        (void)hipGetLastError();
+    if(ready)
+        (void)hipEventDestroy(ready);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(c->stream)
+            (void)hipStreamDestroy(c->stream);
+        (void)hipHostFree(c->ring);
+        delete c;
+        return status;
+    }
+    c->stream_pending = false;
+    *context          = c;
+    return HIPBLAS_STATUS_SUCCESS;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+hipblasStatus_t hipblasPersistentPost(hipblasPersistentContext*  context,
+                                      hipStream_t                stream,
+                                      const hipblasPersistentOp& op)
+{
+    if(context->stream_pending)
+    {
+        if(hipStreamSynchronize(stream) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+        context->stream_pending = false;
+    }
+
+    hipblasStatus_t status = hipblasPersistentWait(context, hipblas_persistent_capacity - 1);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The descriptor is complete before the kernel sees the new head
+    memcpy(&context->ring->ops[context->head % hipblas_persistent_capacity], &op, sizeof(op));
+    std::atomic_thread_fence(std::memory_order_release);
+    *(volatile uint64_t*)&context->ring->head = ++context->head;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasPersistentDrain(hipblasPersistentContext* context)
+{
+    hipblasStatus_t status = hipblasPersistentWait(context, 0);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    context->stream_pending = true;
+    return status;
+}
+
+void hipblasPersistentDestroy(hipblasPersistentContext* context)
+{
+    if(!context)
+        return;
+    (void)hipblasPersistentDrain(context);
+    *(volatile int32_t*)&context->ring->stop = 1;
+    (void)hipStreamSynchronize(context->stream);
+    (void)hipStreamDestroy(context->stream);
+    (void)hipHostFree(context->ring);
+    (void)hipGetLastError();
+    delete context;
+}
@@ -0,0 +1,197 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "persistent.hpp"
+#include <hip/hip_runtime.h>
+
+// Threads of the one work group of the persistent kernel
+constexpr int persistent_threads = 256;
+
+// Words of a descriptor, which the threads copy from host memory one each
+constexpr int persistent_op_words = sizeof(hipblasPersistentOp) / sizeof(uint64_t);
+static_assert(sizeof(hipblasPersistentOp) % sizeof(uint64_t) == 0);
+static_assert(persistent_op_words <= persistent_threads);
+
+// Offset of element i of a vector of n elements, which negative increments store backwards
+__device__ inline size_t hipblasPersistentIndex(int i, int n, int inc)
+{
+    return inc > 0 ? size_t(i) * inc : size_t(n - 1 - i) * -inc;
+}
+
+template <typename T>
+__device__ inline T hipblasPersistentScalar(double value, const void* device)
+{
+    return device ? *(const T*)device : T(value);
+}
+
+template <typename T>
+__device__ void hipblasPersistentGemm(const hipblasPersistentOp& op)
+{
+    const T* A     = (const T*)op.A;
+    const T* B     = (const T*)op.B;
+    T*       C     = (T*)op.C;
+    const T  alpha = hipblasPersistentScalar<T>(op.alpha, op.alpha_device);
+    const T  beta  = hipblasPersistentScalar<T>(op.beta, op.beta_device);
+
+    for(int e = threadIdx.x; e < op.m * op.n; e += blockDim.x)
+    {
+        const int i = e % op.m, j = e / op.m;
+        T         sum = 0;
+        for(int l = 0; l < op.k; l++)
+        {
+            T a = op.transA == HIPBLAS_OP_N ? A[i + size_t(l) * op.lda] : A[l + size_t(i) * op.lda];
+            T b = op.transB == HIPBLAS_OP_N ? B[l + size_t(j) * op.ldb] : B[j + size_t(l) * op.ldb];
+            sum += a * b;
+        }
+        T& c = C[i + size_t(j) * op.ldc];
+        c    = beta == T(0) ? alpha * sum : alpha * sum + beta * c;
+    }
+}
+
+template <typename T>
+__device__ void hipblasPersistentGemv(const hipblasPersistentOp& op)
+{
+    const T*  A     = (const T*)op.A;
+    const T*  x     = (const T*)op.B;
+    T*        y     = (T*)op.C;
+    const T   alpha = hipblasPersistentScalar<T>(op.alpha, op.alpha_device);
+    const T   beta  = hipblasPersistentScalar<T>(op.beta, op.beta_device);
+    const int rows  = op.transA == HIPBLAS_OP_N ? op.m : op.n;
+    const int cols  = op.transA == HIPBLAS_OP_N ? op.n : op.m;
+
+    for(int i = threadIdx.x; i < rows; i += blockDim.x)
+    {
+        T sum = 0;
+        for(int l = 0; l < cols; l++)
+        {
+            T a = op.transA == HIPBLAS_OP_N ? A[i + size_t(l) * op.lda] : A[l + size_t(i) * op.lda];
+            sum += a * x[hipblasPersistentIndex(l, cols, op.ldb)];
+        }
+        T& yi = y[hipblasPersistentIndex(i, rows, op.ldc)];
+        yi    = beta == T(0) ? alpha * sum : alpha * sum + beta * yi;
+    }
+}
+
+template <typename T>
+__device__ void hipblasPersistentAxpy(const hipblasPersistentOp& op)
+{
+    const T* x     = (const T*)op.B;
+    T*       y     = (T*)op.C;
+    const T  alpha = hipblasPersistentScalar<T>(op.alpha, op.alpha_device);
+
+    for(int i = threadIdx.x; i < op.n; i += blockDim.x)
+        y[hipblasPersistentIndex(i, op.n, op.ldc)]
+            += alpha * x[hipblasPersistentIndex(i, op.n, op.ldb)];
+}
+
+// Column by column, each step dividing by the diagonal and updating the remaining unknowns in
+// parallel. op(A) is lower triangular when A is lower and not transposed, or upper and transposed.
+template <typename T>
+__device__ void hipblasPersistentTrsv(const hipblasPersistentOp& op)
+{
+    const T*  A       = (const T*)op.A;
+    T*        x       = (T*)op.C;
+    const int m       = op.m;
+    const int inc     = op.ldc;
+    const int forward = op.lower == (op.transA == HIPBLAS_OP_N);
+
+    auto a = [&](int i, int j) {
+        return op.transA == HIPBLAS_OP_N ? A[i + size_t(j) * op.lda] : A[j + size_t(i) * op.lda];
+    };
+
+    for(int s = 0; s < m; s++)
+    {
+        const int j = forward ? s : m - 1 - s;
+        if(!op.unit_diag && threadIdx.x == 0)
+            x[hipblasPersistentIndex(j, m, inc)] /= a(j, j);
+        __syncthreads();
+
+        const T   xj    = x[hipblasPersistentIndex(j, m, inc)];
+        const int first = forward ? j + 1 : 0;
+        const int last  = forward ? m : j;
+        for(int i = first + threadIdx.x; i < last; i += blockDim.x)
+            x[hipblasPersistentIndex(i, m, inc)] -= a(i, j) * xj;
+        __syncthreads();
+    }
+}
+
+// Runs the posted descriptors in order until stop is set with none left. Thread 0 polls head in
+// host memory, then the work group copies the descriptor and runs it, and thread 0 publishes
+// tail once its writes are visible.
+__global__ void __launch_bounds__(persistent_threads)
+    hipblasPersistentKernel(hipblasPersistentRing* ring)
+{
+    __shared__ hipblasPersistentOp op;
+    __shared__ int                 done;
+
+    volatile uint64_t* head = &ring->head;
+    volatile int32_t*  stop = &ring->stop;
+
+    for(uint64_t next = 0;; next++)
+    {
+        if(threadIdx.x == 0)
+        {
+            while(*head == next && !*stop)
+                ;
+            done = *head == next;
+        }
+        __syncthreads();
+        if(done)
+            return;
+
+        __threadfence_system();
+        volatile uint64_t* posted
+            = (volatile uint64_t*)&ring->ops[next % hipblas_persistent_capacity];
+        if(threadIdx.x < persistent_op_words)
+            ((uint64_t*)&op)[threadIdx.x] = posted[threadIdx.x];
+        __syncthreads();
+
+        switch(op.routine)
+        {
+        case hipblas_persistent_gemm:
+            op.is_double ? hipblasPersistentGemm<double>(op) : hipblasPersistentGemm<float>(op);
+            break;
+        case hipblas_persistent_gemv:
+            op.is_double ? hipblasPersistentGemv<double>(op) : hipblasPersistentGemv<float>(op);
+            break;
+        case hipblas_persistent_axpy:
+            op.is_double ? hipblasPersistentAxpy<double>(op) : hipblasPersistentAxpy<float>(op);
+            break;
+        case hipblas_persistent_trsv:
+            op.is_double ? hipblasPersistentTrsv<double>(op) : hipblasPersistentTrsv<float>(op);
+            break;
+        }
+
+        // The results are visible to the host and later kernels before tail moves
+        __threadfence_system();
+        __syncthreads();
+        if(threadIdx.x == 0)
+            *(volatile uint64_t*)&ring->tail = next + 1;
+    }
+}
+
+hipblasStatus_t hipblasPersistentLaunch(hipblasPersistentRing* ring, hipStream_t stream)
+{
+    hipLaunchKernelGGL(hipblasPersistentKernel, dim3(1), dim3(persistent_threads), 0, stream, ring);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
@@ -0,0 +1,442 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "pointer_array.hpp"
+#include "affinity.hpp"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "shared_handle.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+struct hipblasPointerArray
+{
+    const void*   base;
+    hipblasStride stride;
+    int           batch_count;
+};
+
+using hipblasPointerArrays = std::unordered_map<const void*, hipblasPointerArray>;
+
+// The arrays registered on each handle. pointer_array_handles counts the handles with arrays, so
+// batched calls on other handles skip the lock.
+static std::mutex                                                pointer_array_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasPointerArrays> pointer_arrays;
+static std::atomic<int>                                          pointer_array_handles{0};
+
+bool hipblasPointerArraysStrided(hipblasHandle_t         handle,
+                                 int                     batch_count,
+                                 const void*             A,
+                                 const void*             B,
+                                 const void*             C,
+                                 hipblasStridedPointers* strided)
+{
+    if(!pointer_array_handles.load(std::memory_order_relaxed) || batch_count <= 0)
+        return false;
+
+    std::lock_guard<std::mutex> lock(pointer_array_mutex);
+
+    auto handle_arrays = pointer_arrays.find(handle);
+    if(handle_arrays == pointer_arrays.end())
+        return false;
+
+    auto& arrays = handle_arrays->second;
+    auto  a      = arrays.find(A);
+    auto  b      = arrays.find(B);
+    auto  c      = arrays.find(C);
+    if(a == arrays.end() || b == arrays.end() || c == arrays.end()
+       || a->second.batch_count < batch_count || b->second.batch_count < batch_count
+       || c->second.batch_count < batch_count)
+        return false;
+
+    *strided = {a->second.base,
+                a->second.stride,
+                b->second.base,
+                b->second.stride,
+                const_cast<void*>(c->second.base),
+                c->second.stride};
+    return true;
+}
+
+// A pinned buffer of the ring of a handle in host mode, its device copy, and the event recorded
+// after the upload from it
+struct hipblasPointerArraySlot
+{
+    void*      host   = nullptr;
+    void*      device = nullptr;
+    size_t     bytes  = 0;
+    hipEvent_t event  = nullptr;
+};
+
+// The slots are used in turn. A slot is written again once its event has completed, which a call
+// only waits for when the ring has come back to it within pointer_array_ring_size calls. stream is
+// the stream of the last upload, which a call on another stream waits for through fence before
+// it overwrites device copies that calls on that stream may still read.
+static constexpr size_t pointer_array_ring_size      = 16;
+static constexpr size_t pointer_array_slot_min_bytes = size_t(4) << 10;
+
+struct hipblasPointerArrayRing
+{
+    std::array<hipblasPointerArraySlot, pointer_array_ring_size> slots;
+    size_t                                                       next   = 0;
+    hipStream_t                                                  stream = nullptr;
+    hipEvent_t                                                   fence  = nullptr;
+
+    ~hipblasPointerArrayRing()
+    {
+        // hipFree waits for the calls still reading the device copies
+        for(hipblasPointerArraySlot& slot : slots)
+        {
+            if(slot.event)
+            {
+                (void)hipEventSynchronize(slot.event);
+                (void)hipEventDestroy(slot.event);
+            }
+            if(slot.host)
+                (void)hipblasAffinityHostFree(slot.host);
+            if(slot.device)
+                (void)hipFree(slot.device);
+        }
+        if(fence)
+            (void)hipEventDestroy(fence);
+    }
+};
+
+std::atomic<int> pointer_array_host_handles{0};
+
+static std::mutex pointer_array_ring_mutex;
+static std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasPointerArrayRing>>
+    pointer_array_rings;
+
+// Grows slot to at least bytes, with the pinned buffer on the NUMA node set for device. Its
+// previous upload has completed.
+static hipblasStatus_t
+    hipblasPointerArraySlotReserve(hipblasPointerArraySlot& slot, size_t bytes, int device)
+{
+    if(!slot.event && hipEventCreateWithFlags(&slot.event, hipEventDisableTiming) != hipSuccess)
+    {
+        slot.event = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    if(bytes <= slot.bytes)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // hipFree waits for the calls still reading the old device copy
+    if(slot.host)
+        (void)hipblasAffinityHostFree(slot.host);
+    if(slot.device)
+        (void)hipFree(slot.device);
+    slot.host   = nullptr;
+    slot.device = nullptr;
+    slot.bytes  = 0;
+
+    bytes = std::max(bytes, pointer_array_slot_min_bytes);
+    if(hipblasAffinityHostMalloc(&slot.host, bytes, hipblasAffinityDeviceNode(device))
+       != hipSuccess)
+    {
+        slot.host = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    if(hipMalloc(&slot.device, bytes) != hipSuccess)
+    {
+        slot.device = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    slot.bytes = bytes;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasPointerArraysUpload(hipblasHandle_t    handle,
+                                           int64_t            batch_count,
+                                           int                count,
+                                           const void* const* host,
+                                           const void**       device)
+{
+    for(int i = 0; i < count; i++)
+        device[i] = host[i];
+    if(hipblas_deferred_depth != 1 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::lock_guard<std::mutex> lock(pointer_array_ring_mutex);
+
+    auto entry = pointer_array_rings.find(handle);
+    if(entry == pointer_array_rings.end())
+        return HIPBLAS_STATUS_SUCCESS;
+    hipblasPointerArrayRing& ring = *entry->second;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // A captured copy would read the slot when the graph is launched
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int device_id;
+    if(hipGetDevice(&device_id) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    if(ring.stream && ring.stream != stream)
+    {
+        if(!ring.fence && hipEventCreateWithFlags(&ring.fence, hipEventDisableTiming) != hipSuccess)
+        {
+            ring.fence = nullptr;
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        if(hipEventRecord(ring.fence, ring.stream) != hipSuccess
+           || hipStreamWaitEvent(stream, ring.fence, 0) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    ring.stream = stream;
+
+    hipblasPointerArraySlot& slot = ring.slots[ring.next];
+    ring.next                     = (ring.next + 1) % pointer_array_ring_size;
+    if(slot.event && hipEventSynchronize(slot.event) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    size_t array_bytes = sizeof(void*) * size_t(batch_count);
+    status             = hipblasPointerArraySlotReserve(slot, array_bytes * count, device_id);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    for(int i = 0; i < count; i++)
+        if(host[i])
+            std::memcpy((char*)slot.host + i * array_bytes, host[i], array_bytes);
+    if(hipMemcpyAsync(slot.device, slot.host, array_bytes * count, hipMemcpyHostToDevice, stream)
+           != hipSuccess
+       || hipEventRecord(slot.event, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    for(int i = 0; i < count; i++)
+        if(host[i])
+            device[i] = (const char*)slot.device + i * array_bytes;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+void hipblasPointerArrayErase(hipblasHandle_t handle)
+{
+    if(pointer_array_host_handles.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(pointer_array_ring_mutex);
+        if(pointer_array_rings.erase(handle))
+            pointer_array_host_handles--;
+    }
+
+    if(!pointer_array_handles.load(std::memory_order_relaxed))
+        return;
+
+    std::lock_guard<std::mutex> lock(pointer_array_mutex);
+    if(pointer_arrays.erase(handle))
+        pointer_array_handles--;
+}
+
+extern "C" hipblasStatus_t hipblasSetPointerArrayMode(hipblasHandle_t           handle,
+                                                      hipblasPointerArrayMode_t mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_POINTER_ARRAY_MODE_DEVICE && mode != HIPBLAS_POINTER_ARRAY_MODE_HOST)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    std::lock_guard<std::mutex> lock(pointer_array_ring_mutex);
+
+    auto entry = pointer_array_rings.find(handle);
+    if(mode == HIPBLAS_POINTER_ARRAY_MODE_HOST && entry == pointer_array_rings.end())
+    {
+        pointer_array_rings.emplace(handle, std::make_unique<hipblasPointerArrayRing>());
+        pointer_array_host_handles++;
+    }
+    else if(mode == HIPBLAS_POINTER_ARRAY_MODE_DEVICE && entry != pointer_array_rings.end())
+    {
+        pointer_array_rings.erase(entry);
+        pointer_array_host_handles--;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetPointerArrayMode(hipblasHandle_t            handle,
+                                                      hipblasPointerArrayMode_t* mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(pointer_array_ring_mutex);
+
+    *mode = pointer_array_rings.count(handle) ? HIPBLAS_POINTER_ARRAY_MODE_HOST
+                                              : HIPBLAS_POINTER_ARRAY_MODE_DEVICE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetPointerArrayStride(hipblasHandle_t handle,
+                                                        const void*     pointerArray,
+                                                        const void*     base,
+                                                        hipblasStride   stride,
+                                                        int             batchCount)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, pointerArray, base, stride, batchCount);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!pointerArray || (base && batchCount <= 0))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(pointer_array_mutex);
+
+    auto handle_arrays = pointer_arrays.find(handle);
+    if(!base)
+    {
+        if(handle_arrays != pointer_arrays.end())
+        {
+            handle_arrays->second.erase(pointerArray);
+            if(handle_arrays->second.empty())
+            {
+                pointer_arrays.erase(handle_arrays);
+                pointer_array_handles--;
+            }
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    if(handle_arrays == pointer_arrays.end())
+    {
+        handle_arrays = pointer_arrays.emplace(handle, hipblasPointerArrays()).first;
+        pointer_array_handles++;
+    }
+    handle_arrays->second[pointerArray] = {base, stride, batchCount};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetPointerArrayStride(hipblasHandle_t handle,
+                                                        const void*     pointerArray,
+                                                        const void**    base,
+                                                        hipblasStride*  stride,
+                                                        int*            batchCount)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, pointerArray, base, stride, batchCount);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!pointerArray || !base || !stride || !batchCount)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(pointer_array_mutex);
+
+    *base       = nullptr;
+    *stride     = 0;
+    *batchCount = 0;
+
+    auto handle_arrays = pointer_arrays.find(handle);
+    if(handle_arrays == pointer_arrays.end())
+        return HIPBLAS_STATUS_SUCCESS;
+
+    auto array = handle_arrays->second.find(pointerArray);
+    if(array != handle_arrays->second.end())
+    {
+        *base       = array->second.base;
+        *stride     = array->second.stride;
+        *batchCount = array->second.batch_count;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasFillPointerArray(hipblasHandle_t handle,
+                                                   void*           pointerArray,
+                                                   const void*     base,
+                                                   size_t          elementSize,
+                                                   hipblasStride   stride,
+                                                   int             batchCount)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, pointerArray, base, elementSize, stride, batchCount);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!pointerArray || !base || !elementSize || batchCount <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The addresses are computed on the host, the data they point to is never read
+    std::vector<const char*> host(batchCount);
+    for(int b = 0; b < batchCount; b++)
+        host[b] = (const char*)base + b * stride * hipblasStride(elementSize);
+    if(hipMemcpyAsync(
+           pointerArray, host.data(), sizeof(void*) * host.size(), hipMemcpyHostToDevice, stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    return hipblasSetPointerArrayStride(handle, pointerArray, base, stride, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
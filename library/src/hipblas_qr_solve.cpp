@@ -0,0 +1,1146 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "qr_solve.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <type_traits>
+#include <vector>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+// Batched and strided batched ormqr, which neither backend has, run as one non-batched ormqr per
+// instance. geqrs solves least-squares problems with a QR factorization that it keeps in A and
+// tau, so later calls for new right-hand sides skip the factorization.
+
+// hipBLAS functions of each precision run by the QR solve
+template <typename T>
+struct hipblasQrSolveFunctions;
+
+template <>
+struct hipblasQrSolveFunctions<float>
+{
+    static constexpr auto ormqr               = hipblasSormqr;
+    static constexpr auto geqrfBatched        = hipblasSgeqrfBatched;
+    static constexpr auto geqrfStridedBatched = hipblasSgeqrfStridedBatched;
+    static constexpr auto trsmBatched         = hipblasStrsmBatched;
+    static constexpr auto trsmStridedBatched  = hipblasStrsmStridedBatched;
+};
+
+template <>
+struct hipblasQrSolveFunctions<double>
+{
+    static constexpr auto ormqr               = hipblasDormqr;
+    static constexpr auto geqrfBatched        = hipblasDgeqrfBatched;
+    static constexpr auto geqrfStridedBatched = hipblasDgeqrfStridedBatched;
+    static constexpr auto trsmBatched         = hipblasDtrsmBatched;
+    static constexpr auto trsmStridedBatched  = hipblasDtrsmStridedBatched;
+};
+
+template <>
+struct hipblasQrSolveFunctions<hipblasComplex>
+{
+    static constexpr auto ormqr               = hipblasCunmqr;
+    static constexpr auto geqrfBatched        = hipblasCgeqrfBatched;
+    static constexpr auto geqrfStridedBatched = hipblasCgeqrfStridedBatched;
+    static constexpr auto trsmBatched         = hipblasCtrsmBatched;
+    static constexpr auto trsmStridedBatched  = hipblasCtrsmStridedBatched;
+};
+
+template <>
+struct hipblasQrSolveFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto ormqr               = hipblasZunmqr;
+    static constexpr auto geqrfBatched        = hipblasZgeqrfBatched;
+    static constexpr auto geqrfStridedBatched = hipblasZgeqrfStridedBatched;
+    static constexpr auto trsmBatched         = hipblasZtrsmBatched;
+    static constexpr auto trsmStridedBatched  = hipblasZtrsmStridedBatched;
+};
+
+template <typename T>
+constexpr bool hipblasQrSolveComplex = !std::is_same<T, float>{} && !std::is_same<T, double>{};
+
+int hipblasOrmqrInfo(hipblasSideMode_t  side,
+                     hipblasOperation_t trans,
+                     int                m,
+                     int                n,
+                     int                k,
+                     const void*        A,
+                     int                lda,
+                     const void*        tau,
+                     const void*        C,
+                     int                ldc,
+                     bool               is_complex,
+                     bool               strided)
+{
+    const int s  = strided ? 1 : 0;
+    const int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+    if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        return -1;
+    if(trans != HIPBLAS_OP_N && trans != (is_complex ? HIPBLAS_OP_C : HIPBLAS_OP_T))
+        return -2;
+    if(m < 0)
+        return -3;
+    if(n < 0)
+        return -4;
+    if(k < 0 || k > nq)
+        return -5;
+    if(A == nullptr && nq && k)
+        return -6;
+    if(lda < std::max(1, nq))
+        return -7;
+    if(tau == nullptr && k)
+        return -(8 + s);
+    if(C == nullptr && m && n)
+        return -(9 + 2 * s);
+    if(ldc < std::max(1, m))
+        return -(10 + 2 * s);
+    return 0;
+}
+
+// ormqr on each instance, with the device pointer arrays of the batched form, or the base
+// pointers and strides of the strided batched form. The arrays are copied to the host, so the
+// batched form returns HIPBLAS_STATUS_NOT_SUPPORTED while the stream is being captured.
+template <typename T>
+static hipblasStatus_t hipblasOrmqrInstances(hipblasHandle_t    handle,
+                                             hipblasSideMode_t  side,
+                                             hipblasOperation_t trans,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             T*                 A,
+                                             T* const*          A_array,
+                                             int                lda,
+                                             hipblasStride      strideA,
+                                             T*                 tau,
+                                             T* const*          tau_array,
+                                             hipblasStride      strideT,
+                                             T*                 C,
+                                             T* const*          C_array,
+                                             int                ldc,
+                                             hipblasStride      strideC,
+                                             int*               info,
+                                             int                batch_count,
+                                             bool               strided)
+{
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(strided)
+        *info = hipblasOrmqrInfo(
+            side, trans, m, n, k, A, lda, tau, C, ldc, hipblasQrSolveComplex<T>, true);
+    else
+        *info = hipblasOrmqrInfo(side,
+                                 trans,
+                                 m,
+                                 n,
+                                 k,
+                                 A_array,
+                                 lda,
+                                 tau_array,
+                                 C_array,
+                                 ldc,
+                                 hipblasQrSolveComplex<T>,
+                                 false);
+    if(!*info && batch_count < 0)
+        *info = strided ? -15 : -12;
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !k || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::vector<T*> a(batch_count), t(batch_count), c(batch_count);
+    if(strided)
+    {
+        for(int i = 0; i < batch_count; i++)
+        {
+            a[i] = A + i * strideA;
+            t[i] = tau + i * strideT;
+            c[i] = C + i * strideC;
+        }
+    }
+    else
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+        if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(capture_status != hipStreamCaptureStatusNone)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        size_t bytes = sizeof(T*) * batch_count;
+        if(hipMemcpyAsync(a.data(), A_array, bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipMemcpyAsync(t.data(), tau_array, bytes, hipMemcpyDeviceToHost, stream)
+                  != hipSuccess
+           || hipMemcpyAsync(c.data(), C_array, bytes, hipMemcpyDeviceToHost, stream)
+                  != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    for(int i = 0; i < batch_count; i++)
+    {
+        hipblasStatus_t status = hipblasQrSolveFunctions<T>::ormqr(
+            handle, side, trans, m, n, k, a[i], lda, t[i], c[i], ldc, info);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// X = R \ (Q' B) in the first n rows of B, after factoring A with geqrf unless factorize is 0.
+// The arrays are those of hipblasOrmqrInstances.
+template <typename T>
+static hipblasStatus_t hipblasGeqrs(hipblasHandle_t handle,
+                                    int             factorize,
+                                    int             m,
+                                    int             n,
+                                    int             nrhs,
+                                    T*              A,
+                                    T* const*       A_array,
+                                    int             lda,
+                                    hipblasStride   strideA,
+                                    T*              tau,
+                                    T* const*       tau_array,
+                                    hipblasStride   strideT,
+                                    T*              B,
+                                    T* const*       B_array,
+                                    int             ldb,
+                                    hipblasStride   strideB,
+                                    int*            info,
+                                    int             batch_count,
+                                    bool            strided)
+{
+    using F = hipblasQrSolveFunctions<T>;
+
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    const int   s = strided ? 1 : 0;
+    const void* a = strided ? (const void*)A : A_array;
+    const void* t = strided ? (const void*)tau : tau_array;
+    const void* b = strided ? (const void*)B : B_array;
+    if(m < 0)
+        *info = -2;
+    else if(n < 0 || n > m)
+        *info = -3;
+    else if(nrhs < 0)
+        *info = -4;
+    else if(a == nullptr && n)
+        *info = -5;
+    else if(lda < std::max(1, m))
+        *info = -6;
+    else if(t == nullptr && n)
+        *info = -(7 + s);
+    else if(b == nullptr && m && nrhs)
+        *info = -(8 + 2 * s);
+    else if(ldb < std::max(1, m))
+        *info = -(9 + 2 * s);
+    else if(batch_count < 0)
+        *info = -(11 + 3 * s);
+    else
+        *info = 0;
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    int             step_info;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    if(factorize && strided)
+        status = F::geqrfStridedBatched(
+            handle, m, n, A, lda, strideA, tau, strideT, &step_info, batch_count);
+    else if(factorize)
+        status = F::geqrfBatched(handle, m, n, A_array, lda, tau_array, &step_info, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS || !nrhs)
+        return status;
+
+    status = hipblasOrmqrInstances<T>(handle,
+                                      HIPBLAS_SIDE_LEFT,
+                                      hipblasQrSolveComplex<T> ? HIPBLAS_OP_C : HIPBLAS_OP_T,
+                                      m,
+                                      nrhs,
+                                      n,
+                                      A,
+                                      A_array,
+                                      lda,
+                                      strideA,
+                                      tau,
+                                      tau_array,
+                                      strideT,
+                                      B,
+                                      B_array,
+                                      ldb,
+                                      strideB,
+                                      &step_info,
+                                      batch_count,
+                                      strided);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasPointerMode_t pointer_mode;
+    status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    const T one = 1;
+    if(strided)
+        status = F::trsmStridedBatched(handle,
+                                       HIPBLAS_SIDE_LEFT,
+                                       HIPBLAS_FILL_MODE_UPPER,
+                                       HIPBLAS_OP_N,
+                                       HIPBLAS_DIAG_NON_UNIT,
+                                       n,
+                                       nrhs,
+                                       &one,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       batch_count);
+    else
+        status = F::trsmBatched(handle,
+                                HIPBLAS_SIDE_LEFT,
+                                HIPBLAS_FILL_MODE_UPPER,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_DIAG_NON_UNIT,
+                                n,
+                                nrhs,
+                                &one,
+                                A_array,
+                                lda,
+                                B_array,
+                                ldb,
+                                batch_count);
+
+    hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+    return status == HIPBLAS_STATUS_SUCCESS ? restore : status;
+}
+
+extern "C" hipblasStatus_t hipblasSormqrBatched(hipblasHandle_t          handle,
+                                                const hipblasSideMode_t  side,
+                                                const hipblasOperation_t trans,
+                                                const int                m,
+                                                const int                n,
+                                                const int                k,
+                                                float* const             A[],
+                                                const int                lda,
+                                                float* const             tau[],
+                                                float* const             C[],
+                                                const int                ldc,
+                                                int*                     info,
+                                                const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, trans, m, n, k, A, lda, tau, C, ldc, info, batchCount);
+    return hipblasOrmqrInstances<float>(handle,
+                                        side,
+                                        trans,
+                                        m,
+                                        n,
+                                        k,
+                                        nullptr,
+                                        A,
+                                        lda,
+                                        0,
+                                        nullptr,
+                                        tau,
+                                        0,
+                                        nullptr,
+                                        C,
+                                        ldc,
+                                        0,
+                                        info,
+                                        batchCount,
+                                        false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDormqrBatched(hipblasHandle_t          handle,
+                                                const hipblasSideMode_t  side,
+                                                const hipblasOperation_t trans,
+                                                const int                m,
+                                                const int                n,
+                                                const int                k,
+                                                double* const            A[],
+                                                const int                lda,
+                                                double* const            tau[],
+                                                double* const            C[],
+                                                const int                ldc,
+                                                int*                     info,
+                                                const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, trans, m, n, k, A, lda, tau, C, ldc, info, batchCount);
+    return hipblasOrmqrInstances<double>(handle,
+                                         side,
+                                         trans,
+                                         m,
+                                         n,
+                                         k,
+                                         nullptr,
+                                         A,
+                                         lda,
+                                         0,
+                                         nullptr,
+                                         tau,
+                                         0,
+                                         nullptr,
+                                         C,
+                                         ldc,
+                                         0,
+                                         info,
+                                         batchCount,
+                                         false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCunmqrBatched(hipblasHandle_t          handle,
+                                                const hipblasSideMode_t  side,
+                                                const hipblasOperation_t trans,
+                                                const int                m,
+                                                const int                n,
+                                                const int                k,
+                                                hipblasComplex* const    A[],
+                                                const int                lda,
+                                                hipblasComplex* const    tau[],
+                                                hipblasComplex* const    C[],
+                                                const int                ldc,
+                                                int*                     info,
+                                                const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, trans, m, n, k, A, lda, tau, C, ldc, info, batchCount);
+    return hipblasOrmqrInstances<hipblasComplex>(handle,
+                                                 side,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 nullptr,
+                                                 A,
+                                                 lda,
+                                                 0,
+                                                 nullptr,
+                                                 tau,
+                                                 0,
+                                                 nullptr,
+                                                 C,
+                                                 ldc,
+                                                 0,
+                                                 info,
+                                                 batchCount,
+                                                 false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZunmqrBatched(hipblasHandle_t             handle,
+                                                const hipblasSideMode_t     side,
+                                                const hipblasOperation_t    trans,
+                                                const int                   m,
+                                                const int                   n,
+                                                const int                   k,
+                                                hipblasDoubleComplex* const A[],
+                                                const int                   lda,
+                                                hipblasDoubleComplex* const tau[],
+                                                hipblasDoubleComplex* const C[],
+                                                const int                   ldc,
+                                                int*                        info,
+                                                const int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, trans, m, n, k, A, lda, tau, C, ldc, info, batchCount);
+    return hipblasOrmqrInstances<hipblasDoubleComplex>(handle,
+                                                       side,
+                                                       trans,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       nullptr,
+                                                       A,
+                                                       lda,
+                                                       0,
+                                                       nullptr,
+                                                       tau,
+                                                       0,
+                                                       nullptr,
+                                                       C,
+                                                       ldc,
+                                                       0,
+                                                       info,
+                                                       batchCount,
+                                                       false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSormqrStridedBatched(hipblasHandle_t          handle,
+                                                       const hipblasSideMode_t  side,
+                                                       const hipblasOperation_t trans,
+                                                       const int                m,
+                                                       const int                n,
+                                                       const int                k,
+                                                       float*                   A,
+                                                       const int                lda,
+                                                       const hipblasStride      strideA,
+                                                       float*                   tau,
+                                                       const hipblasStride      strideT,
+                                                       float*                   C,
+                                                       const int                ldc,
+                                                       const hipblasStride      strideC,
+                                                       int*                     info,
+                                                       const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  side,
+                  trans,
+                  m,
+                  n,
+                  k,
+                  A,
+                  lda,
+                  strideA,
+                  tau,
+                  strideT,
+                  C,
+                  ldc,
+                  strideC,
+                  info,
+                  batchCount);
+    return hipblasOrmqrInstances<float>(handle,
+                                        side,
+                                        trans,
+                                        m,
+                                        n,
+                                        k,
+                                        A,
+                                        nullptr,
+                                        lda,
+                                        strideA,
+                                        tau,
+                                        nullptr,
+                                        strideT,
+                                        C,
+                                        nullptr,
+                                        ldc,
+                                        strideC,
+                                        info,
+                                        batchCount,
+                                        true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDormqrStridedBatched(hipblasHandle_t          handle,
+                                                       const hipblasSideMode_t  side,
+                                                       const hipblasOperation_t trans,
+                                                       const int                m,
+                                                       const int                n,
+                                                       const int                k,
+                                                       double*                  A,
+                                                       const int                lda,
+                                                       const hipblasStride      strideA,
+                                                       double*                  tau,
+                                                       const hipblasStride      strideT,
+                                                       double*                  C,
+                                                       const int                ldc,
+                                                       const hipblasStride      strideC,
+                                                       int*                     info,
+                                                       const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  side,
+                  trans,
+                  m,
+                  n,
+                  k,
+                  A,
+                  lda,
+                  strideA,
+                  tau,
+                  strideT,
+                  C,
+                  ldc,
+                  strideC,
+                  info,
+                  batchCount);
+    return hipblasOrmqrInstances<double>(handle,
+                                         side,
+                                         trans,
+                                         m,
+                                         n,
+                                         k,
+                                         A,
+                                         nullptr,
+                                         lda,
+                                         strideA,
+                                         tau,
+                                         nullptr,
+                                         strideT,
+                                         C,
+                                         nullptr,
+                                         ldc,
+                                         strideC,
+                                         info,
+                                         batchCount,
+                                         true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCunmqrStridedBatched(hipblasHandle_t          handle,
+                                                       const hipblasSideMode_t  side,
+                                                       const hipblasOperation_t trans,
+                                                       const int                m,
+                                                       const int                n,
+                                                       const int                k,
+                                                       hipblasComplex*          A,
+                                                       const int                lda,
+                                                       const hipblasStride      strideA,
+                                                       hipblasComplex*          tau,
+                                                       const hipblasStride      strideT,
+                                                       hipblasComplex*          C,
+                                                       const int                ldc,
+                                                       const hipblasStride      strideC,
+                                                       int*                     info,
+                                                       const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  side,
+                  trans,
+                  m,
+                  n,
+                  k,
+                  A,
+                  lda,
+                  strideA,
+                  tau,
+                  strideT,
+                  C,
+                  ldc,
+                  strideC,
+                  info,
+                  batchCount);
+    return hipblasOrmqrInstances<hipblasComplex>(handle,
+                                                 side,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 A,
+                                                 nullptr,
+                                                 lda,
+                                                 strideA,
+                                                 tau,
+                                                 nullptr,
+                                                 strideT,
+                                                 C,
+                                                 nullptr,
+                                                 ldc,
+                                                 strideC,
+                                                 info,
+                                                 batchCount,
+                                                 true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZunmqrStridedBatched(hipblasHandle_t          handle,
+                                                       const hipblasSideMode_t  side,
+                                                       const hipblasOperation_t trans,
+                                                       const int                m,
+                                                       const int                n,
+                                                       const int                k,
+                                                       hipblasDoubleComplex*    A,
+                                                       const int                lda,
+                                                       const hipblasStride      strideA,
+                                                       hipblasDoubleComplex*    tau,
+                                                       const hipblasStride      strideT,
+                                                       hipblasDoubleComplex*    C,
+                                                       const int                ldc,
+                                                       const hipblasStride      strideC,
+                                                       int*                     info,
+                                                       const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  side,
+                  trans,
+                  m,
+                  n,
+                  k,
+                  A,
+                  lda,
+                  strideA,
+                  tau,
+                  strideT,
+                  C,
+                  ldc,
+                  strideC,
+                  info,
+                  batchCount);
+    return hipblasOrmqrInstances<hipblasDoubleComplex>(handle,
+                                                       side,
+                                                       trans,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       A,
+                                                       nullptr,
+                                                       lda,
+                                                       strideA,
+                                                       tau,
+                                                       nullptr,
+                                                       strideT,
+                                                       C,
+                                                       nullptr,
+                                                       ldc,
+                                                       strideC,
+                                                       info,
+                                                       batchCount,
+                                                       true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgeqrsBatched(hipblasHandle_t handle,
+                                                const int       factorize,
+                                                const int       m,
+                                                const int       n,
+                                                const int       nrhs,
+                                                float* const    A[],
+                                                const int       lda,
+                                                float* const    tau[],
+                                                float* const    B[],
+                                                const int       ldb,
+                                                int*            info,
+                                                const int       batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, factorize, m, n, nrhs, A, lda, tau, B, ldb, info, batchCount);
+    return hipblasGeqrs<float>(handle,
+                               factorize,
+                               m,
+                               n,
+                               nrhs,
+                               nullptr,
+                               A,
+                               lda,
+                               0,
+                               nullptr,
+                               tau,
+                               0,
+                               nullptr,
+                               B,
+                               ldb,
+                               0,
+                               info,
+                               batchCount,
+                               false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgeqrsBatched(hipblasHandle_t handle,
+                                                const int       factorize,
+                                                const int       m,
+                                                const int       n,
+                                                const int       nrhs,
+                                                double* const   A[],
+                                                const int       lda,
+                                                double* const   tau[],
+                                                double* const   B[],
+                                                const int       ldb,
+                                                int*            info,
+                                                const int       batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, factorize, m, n, nrhs, A, lda, tau, B, ldb, info, batchCount);
+    return hipblasGeqrs<double>(handle,
+                                factorize,
+                                m,
+                                n,
+                                nrhs,
+                                nullptr,
+                                A,
+                                lda,
+                                0,
+                                nullptr,
+                                tau,
+                                0,
+                                nullptr,
+                                B,
+                                ldb,
+                                0,
+                                info,
+                                batchCount,
+                                false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgeqrsBatched(hipblasHandle_t       handle,
+                                                const int             factorize,
+                                                const int             m,
+                                                const int             n,
+                                                const int             nrhs,
+                                                hipblasComplex* const A[],
+                                                const int             lda,
+                                                hipblasComplex* const tau[],
+                                                hipblasComplex* const B[],
+                                                const int             ldb,
+                                                int*                  info,
+                                                const int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, factorize, m, n, nrhs, A, lda, tau, B, ldb, info, batchCount);
+    return hipblasGeqrs<hipblasComplex>(handle,
+                                        factorize,
+                                        m,
+                                        n,
+                                        nrhs,
+                                        nullptr,
+                                        A,
+                                        lda,
+                                        0,
+                                        nullptr,
+                                        tau,
+                                        0,
+                                        nullptr,
+                                        B,
+                                        ldb,
+                                        0,
+                                        info,
+                                        batchCount,
+                                        false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgeqrsBatched(hipblasHandle_t             handle,
+                                                const int                   factorize,
+                                                const int                   m,
+                                                const int                   n,
+                                                const int                   nrhs,
+                                                hipblasDoubleComplex* const A[],
+                                                const int                   lda,
+                                                hipblasDoubleComplex* const tau[],
+                                                hipblasDoubleComplex* const B[],
+                                                const int                   ldb,
+                                                int*                        info,
+                                                const int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, factorize, m, n, nrhs, A, lda, tau, B, ldb, info, batchCount);
+    return hipblasGeqrs<hipblasDoubleComplex>(handle,
+                                              factorize,
+                                              m,
+                                              n,
+                                              nrhs,
+                                              nullptr,
+                                              A,
+                                              lda,
+                                              0,
+                                              nullptr,
+                                              tau,
+                                              0,
+                                              nullptr,
+                                              B,
+                                              ldb,
+                                              0,
+                                              info,
+                                              batchCount,
+                                              false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgeqrsStridedBatched(hipblasHandle_t     handle,
+                                                       const int           factorize,
+                                                       const int           m,
+                                                       const int           n,
+                                                       const int           nrhs,
+                                                       float*              A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       float*              tau,
+                                                       const hipblasStride strideT,
+                                                       float*              B,
+                                                       const int           ldb,
+                                                       const hipblasStride strideB,
+                                                       int*                info,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  factorize,
+                  m,
+                  n,
+                  nrhs,
+                  A,
+                  lda,
+                  strideA,
+                  tau,
+                  strideT,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    return hipblasGeqrs<float>(handle,
+                               factorize,
+                               m,
+                               n,
+                               nrhs,
+                               A,
+                               nullptr,
+                               lda,
+                               strideA,
+                               tau,
+                               nullptr,
+                               strideT,
+                               B,
+                               nullptr,
+                               ldb,
+                               strideB,
+                               info,
+                               batchCount,
+                               true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgeqrsStridedBatched(hipblasHandle_t     handle,
+                                                       const int           factorize,
+                                                       const int           m,
+                                                       const int           n,
+                                                       const int           nrhs,
+                                                       double*             A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       double*             tau,
+                                                       const hipblasStride strideT,
+                                                       double*             B,
+                                                       const int           ldb,
+                                                       const hipblasStride strideB,
+                                                       int*                info,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  factorize,
+                  m,
+                  n,
+                  nrhs,
+                  A,
+                  lda,
+                  strideA,
+                  tau,
+                  strideT,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    return hipblasGeqrs<double>(handle,
+                                factorize,
+                                m,
+                                n,
+                                nrhs,
+                                A,
+                                nullptr,
+                                lda,
+                                strideA,
+                                tau,
+                                nullptr,
+                                strideT,
+                                B,
+                                nullptr,
+                                ldb,
+                                strideB,
+                                info,
+                                batchCount,
+                                true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgeqrsStridedBatched(hipblasHandle_t     handle,
+                                                       const int           factorize,
+                                                       const int           m,
+                                                       const int           n,
+                                                       const int           nrhs,
+                                                       hipblasComplex*     A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       hipblasComplex*     tau,
+                                                       const hipblasStride strideT,
+                                                       hipblasComplex*     B,
+                                                       const int           ldb,
+                                                       const hipblasStride strideB,
+                                                       int*                info,
+                                                       const int           batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  factorize,
+                  m,
+                  n,
+                  nrhs,
+                  A,
+                  lda,
+                  strideA,
+                  tau,
+                  strideT,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    return hipblasGeqrs<hipblasComplex>(handle,
+                                        factorize,
+                                        m,
+                                        n,
+                                        nrhs,
+                                        A,
+                                        nullptr,
+                                        lda,
+                                        strideA,
+                                        tau,
+                                        nullptr,
+                                        strideT,
+                                        B,
+                                        nullptr,
+                                        ldb,
+                                        strideB,
+                                        info,
+                                        batchCount,
+                                        true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgeqrsStridedBatched(hipblasHandle_t       handle,
+                                                       const int             factorize,
+                                                       const int             m,
+                                                       const int             n,
+                                                       const int             nrhs,
+                                                       hipblasDoubleComplex* A,
+                                                       const int             lda,
+                                                       const hipblasStride   strideA,
+                                                       hipblasDoubleComplex* tau,
+                                                       const hipblasStride   strideT,
+                                                       hipblasDoubleComplex* B,
+                                                       const int             ldb,
+                                                       const hipblasStride   strideB,
+                                                       int*                  info,
+                                                       const int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  factorize,
+                  m,
+                  n,
+                  nrhs,
+                  A,
+                  lda,
+                  strideA,
+                  tau,
+                  strideT,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    return hipblasGeqrs<hipblasDoubleComplex>(handle,
+                                              factorize,
+                                              m,
+                                              n,
+                                              nrhs,
+                                              A,
+                                              nullptr,
+                                              lda,
+                                              strideA,
+                                              tau,
+                                              nullptr,
+                                              strideT,
+                                              B,
+                                              nullptr,
+                                              ldb,
+                                              strideB,
+                                              info,
+                                              batchCount,
+                                              true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+#endif
@@ -0,0 +1,103 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "reproducible.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "shared_handle.hpp"
+#include <mutex>
+#include <unordered_map>
+
+// The atomics mode a handle had before it was made reproducible, restored with
+// HIPBLAS_REDUCTION_DEFAULT. Handles in the default mode have no entry.
+static std::mutex                                                reduction_mode_mutex;
+static std::unordered_map<hipblasHandle_t, hipblasAtomicsMode_t> reduction_mode_atomics;
+
+void hipblasReductionModeErase(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(reduction_mode_mutex);
+    reduction_mode_atomics.erase(handle);
+}
+
+bool hipblasReductionReproducible(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(reduction_mode_mutex);
+    return reduction_mode_atomics.count(handle) != 0;
+}
+
+extern "C" hipblasStatus_t hipblasSetReductionMode(hipblasHandle_t        handle,
+                                                   hipblasReductionMode_t mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_REDUCTION_DEFAULT && mode != HIPBLAS_REDUCTION_REPRODUCIBLE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    std::lock_guard<std::mutex> lock(reduction_mode_mutex);
+
+    auto            entry  = reduction_mode_atomics.find(handle);
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    if(mode == HIPBLAS_REDUCTION_REPRODUCIBLE && entry == reduction_mode_atomics.end())
+    {
+        hipblasAtomicsMode_t atomics_mode;
+        status = hipblasGetAtomicsMode(handle, &atomics_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetAtomicsMode(handle, HIPBLAS_ATOMICS_NOT_ALLOWED);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            reduction_mode_atomics[handle] = atomics_mode;
+    }
+    else if(mode == HIPBLAS_REDUCTION_DEFAULT && entry != reduction_mode_atomics.end())
+    {
+        status = hipblasSetAtomicsMode(handle, entry->second);
+        reduction_mode_atomics.erase(entry);
+    }
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetReductionMode(hipblasHandle_t         handle,
+                                                   hipblasReductionMode_t* mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasReductionReproducible(handle) ? HIPBLAS_REDUCTION_REPRODUCIBLE
+                                                 : HIPBLAS_REDUCTION_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,614 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "reproducible.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+constexpr int reproducible_block_size = 256;
+
+// Threads along the rows of A in the gemv, symv and hemv work groups; the others take columns
+constexpr int reproducible_rows = 64;
+constexpr int reproducible_cols = reproducible_block_size / reproducible_rows;
+
+// The complex types are only added, multiplied and conjugated, so both layouts of hipblasComplex
+// map to this
+template <typename R>
+struct hipblasReproducibleComplex
+{
+    R x, y;
+
+    __host__ __device__ hipblasReproducibleComplex(R re = 0, R im = 0)
+        : x(re)
+        , y(im)
+    {
+    }
+};
+
+template <typename R>
+__device__ inline hipblasReproducibleComplex<R> operator+(hipblasReproducibleComplex<R> a,
+                                                          hipblasReproducibleComplex<R> b)
+{
+    return hipblasReproducibleComplex<R>(a.x + b.x, a.y + b.y);
+}
+
+template <typename R>
+__device__ inline hipblasReproducibleComplex<R>& operator+=(hipblasReproducibleComplex<R>& a,
+                                                            hipblasReproducibleComplex<R>  b)
+{
+    return a = a + b;
+}
+
+template <typename R>
+__device__ inline hipblasReproducibleComplex<R> operator*(hipblasReproducibleComplex<R> a,
+                                                          hipblasReproducibleComplex<R> b)
+{
+    return hipblasReproducibleComplex<R>(a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x);
+}
+
+template <typename R>
+__device__ inline bool operator==(hipblasReproducibleComplex<R> a, hipblasReproducibleComplex<R> b)
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+template <typename T>
+__device__ inline T hipblasReproducibleConj(T a)
+{
+    return a;
+}
+
+template <typename R>
+__device__ inline hipblasReproducibleComplex<R>
+    hipblasReproducibleConj(hipblasReproducibleComplex<R> a)
+{
+    return hipblasReproducibleComplex<R>(a.x, -a.y);
+}
+
+// The diagonal of a Hermitian matrix is real, whatever its imaginary parts hold
+template <typename T>
+__device__ inline T hipblasReproducibleDiagonal(T a)
+{
+    return a;
+}
+
+template <typename R>
+__device__ inline hipblasReproducibleComplex<R>
+    hipblasReproducibleDiagonal(hipblasReproducibleComplex<R> a)
+{
+    return hipblasReproducibleComplex<R>(a.x);
+}
+
+// With a negative increment the vector starts at its last element, as in the reference BLAS
+template <typename T>
+static T* hipblasReproducibleStart(T* x, int n, int incx)
+{
+    return incx < 0 ? x - int64_t(n - 1) * incx : x;
+}
+
+// Sum of the COUNT values of s_sum, by a tree over the threads tid < COUNT / 2 of a group. Every
+// thread of the work group calls it, after s_sum is written and synchronized.
+template <int COUNT, typename T>
+__device__ inline T hipblasReproducibleTreeSum(T* s_sum, int tid)
+{
+    for(int half = COUNT / 2; half > 0; half /= 2)
+    {
+        if(tid < half)
+            s_sum[tid] += s_sum[tid + half];
+        __syncthreads();
+    }
+    return s_sum[0];
+}
+
+// y := alpha * sum + beta * y, without reading y when beta is zero
+template <typename T>
+__device__ void hipblasReproducibleStore(
+    T sum, const T* alpha_device, T alpha_host, const T* beta_device, T beta_host, T* y)
+{
+    T alpha = alpha_device ? *alpha_device : alpha_host;
+    T beta  = beta_device ? *beta_device : beta_host;
+    *y      = beta == T(0) ? alpha * sum : alpha * sum + beta * *y;
+}
+
+// partial[blockIdx.x] = sum over the elements of a grid-stride loop of x_i * y_i, or x_i * x_i
+// when y is null
+template <typename T>
+__global__ void __launch_bounds__(reproducible_block_size)
+    hipblasReproducibleDotKernel(int n, const T* x, int incx, const T* y, int incy, T* partial)
+{
+    __shared__ T s_sum[reproducible_block_size];
+
+    T sum = 0;
+    for(int64_t i = int64_t(blockIdx.x) * reproducible_block_size + threadIdx.x; i < n;
+        i += int64_t(gridDim.x) * reproducible_block_size)
+    {
+        T xi = x[i * incx];
+        sum += xi * (y ? y[i * incy] : xi);
+    }
+
+    s_sum[threadIdx.x] = sum;
+    __syncthreads();
+    sum = hipblasReproducibleTreeSum<reproducible_block_size>(s_sum, threadIdx.x);
+    if(threadIdx.x == 0)
+        partial[blockIdx.x] = sum;
+}
+
+// result = sum of the blocks partials, with its square root for nrm2
+template <bool SQRT, typename T>
+__global__ void __launch_bounds__(reproducible_block_size)
+    hipblasReproducibleSumKernel(int blocks, const T* partial, T* result)
+{
+    __shared__ T s_sum[reproducible_block_size];
+
+    s_sum[threadIdx.x] = threadIdx.x < blocks ? partial[threadIdx.x] : T(0);
+    __syncthreads();
+    T sum = hipblasReproducibleTreeSum<reproducible_block_size>(s_sum, threadIdx.x);
+    if(threadIdx.x == 0)
+        *result = SQRT ? sqrt(sum) : sum;
+}
+
+// y := alpha * A * x + beta * y. Each thread sums its row over every reproducible_cols columns,
+// and the sums of the threads sharing the row are added in order.
+template <typename T>
+__global__ void __launch_bounds__(reproducible_block_size)
+    hipblasReproducibleGemvNKernel(int      m,
+                                   int      n,
+                                   const T* alpha_device,
+                                   T        alpha_host,
+                                   const T* A,
+                                   int      lda,
+                                   const T* x,
+                                   int      incx,
+                                   const T* beta_device,
+                                   T        beta_host,
+                                   T*       y,
+                                   int      incy)
+{
+    __shared__ T partial[reproducible_cols][reproducible_rows];
+
+    int row = blockIdx.x * reproducible_rows + threadIdx.x;
+    T   sum = 0;
+    if(row < m)
+        for(int j = threadIdx.y; j < n; j += reproducible_cols)
+            sum += A[row + size_t(j) * lda] * x[int64_t(j) * incx];
+    partial[threadIdx.y][threadIdx.x] = sum;
+    __syncthreads();
+
+    if(threadIdx.y == 0 && row < m)
+    {
+        for(int j = 1; j < reproducible_cols; j++)
+            sum += partial[j][threadIdx.x];
+        hipblasReproducibleStore(
+            sum, alpha_device, alpha_host, beta_device, beta_host, y + int64_t(row) * incy);
+    }
+}
+
+// Element (col, i) of op( A ) for y_col := sum_i op( A )(col, i) * x_i: the transpose of a
+// general A when FILL is HIPBLAS_FILL_MODE_FULL, or else the symmetric or Hermitian matrix
+// stored in the FILL triangle
+template <hipblasFillMode_t FILL, bool HERMITIAN, typename T>
+__device__ inline T hipblasReproducibleElement(const T* A, int lda, int i, int col)
+{
+    if(FILL == HIPBLAS_FILL_MODE_FULL)
+        return A[i + size_t(col) * lda];
+    if(i == col)
+        return HERMITIAN ? hipblasReproducibleDiagonal(A[i + size_t(i) * lda])
+                         : A[i + size_t(i) * lda];
+
+    // Row col of the full matrix is its column col, conjugated when Hermitian
+    bool stored = FILL == HIPBLAS_FILL_MODE_UPPER ? i < col : i > col;
+    if(!stored)
+        return A[col + size_t(i) * lda];
+    T a = A[i + size_t(col) * lda];
+    return HERMITIAN ? hipblasReproducibleConj(a) : a;
+}
+
+// y_col := alpha * sum_i op( A )(col, i) * x_i + beta * y_col, with reproducible_rows threads
+// summing each of the reproducible_cols elements of y of a work group by a tree
+template <hipblasFillMode_t FILL, bool HERMITIAN, typename T>
+__global__ void __launch_bounds__(reproducible_block_size)
+    hipblasReproducibleColumnKernel(int      m,
+                                    int      n,
+                                    const T* alpha_device,
+                                    T        alpha_host,
+                                    const T* A,
+                                    int      lda,
+                                    const T* x,
+                                    int      incx,
+                                    const T* beta_device,
+                                    T        beta_host,
+                                    T*       y,
+                                    int      incy)
+{
+    __shared__ T partial[reproducible_cols][reproducible_rows];
+
+    int col = blockIdx.x * reproducible_cols + threadIdx.y;
+    T   sum = 0;
+    if(col < n)
+        for(int i = threadIdx.x; i < m; i += reproducible_rows)
+            sum += hipblasReproducibleElement<FILL, HERMITIAN>(A, lda, i, col)
+                   * x[int64_t(i) * incx];
+    partial[threadIdx.y][threadIdx.x] = sum;
+    __syncthreads();
+
+    sum = hipblasReproducibleTreeSum<reproducible_rows>(partial[threadIdx.y], threadIdx.x);
+    if(threadIdx.x == 0 && col < n)
+        hipblasReproducibleStore(
+            sum, alpha_device, alpha_host, beta_device, beta_host, y + int64_t(col) * incy);
+}
+
+// result = x^T y, or ||x||_2 when y is null
+template <bool SQRT, typename T>
+static hipblasStatus_t hipblasReproducibleReduce(hipStream_t stream,
+                                                 bool        device_scalars,
+                                                 int         n,
+                                                 const T*    x,
+                                                 int         incx,
+                                                 const T*    y,
+                                                 int         incy,
+                                                 T*          result)
+{
+    if(n <= 0 || !x || !result || (SQRT ? incx <= 0 : !y))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // The number of work groups depends on n alone, so the order of the sums does too
+    int blocks = std::min((n - 1) / reproducible_block_size + 1, reproducible_blocks);
+
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    if(hipMallocAsync((void**)&scratch.base, sizeof(T) * (reproducible_blocks + 1), stream)
+       != hipSuccess)
+    {
+        scratch.base = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    T* partial       = (T*)scratch.base;
+    T* device_result = device_scalars ? result : partial + reproducible_blocks;
+
+    hipLaunchKernelGGL(hipblasReproducibleDotKernel<T>,
+                       dim3(blocks),
+                       dim3(reproducible_block_size),
+                       0,
+                       stream,
+                       n,
+                       hipblasReproducibleStart(x, n, incx),
+                       incx,
+                       y ? hipblasReproducibleStart(y, n, incy) : nullptr,
+                       incy,
+                       partial);
+    hipLaunchKernelGGL((hipblasReproducibleSumKernel<SQRT, T>),
+                       dim3(1),
+                       dim3(reproducible_block_size),
+                       0,
+                       stream,
+                       blocks,
+                       partial,
+                       device_result);
+    if(hipGetLastError() != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    if(!device_scalars
+       && (hipMemcpyAsync(result, device_result, sizeof(T), hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess))
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Launches kernel over the y_length elements of y, y_per_block of them per work group
+template <typename T, typename Kernel>
+static hipblasStatus_t hipblasReproducibleLaunch(Kernel      kernel,
+                                                 int         y_per_block,
+                                                 hipStream_t stream,
+                                                 bool        device_scalars,
+                                                 int         m,
+                                                 int         n,
+                                                 int         x_length,
+                                                 int         y_length,
+                                                 const T*    alpha,
+                                                 const T*    A,
+                                                 int         lda,
+                                                 const T*    x,
+                                                 int         incx,
+                                                 const T*    beta,
+                                                 T*          y,
+                                                 int         incy)
+{
+    hipLaunchKernelGGL(kernel,
+                       dim3((y_length - 1) / y_per_block + 1),
+                       dim3(reproducible_rows, reproducible_cols),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? T(0) : *alpha,
+                       A,
+                       lda,
+                       hipblasReproducibleStart(x, x_length, incx),
+                       incx,
+                       device_scalars ? beta : nullptr,
+                       device_scalars ? T(0) : *beta,
+                       hipblasReproducibleStart(y, y_length, incy),
+                       incy);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasReproducibleGemvTemplate(hipStream_t        stream,
+                                                       bool               device_scalars,
+                                                       hipblasOperation_t trans,
+                                                       int                m,
+                                                       int                n,
+                                                       const T*           alpha,
+                                                       const T*           A,
+                                                       int                lda,
+                                                       const T*           x,
+                                                       int                incx,
+                                                       const T*           beta,
+                                                       T*                 y,
+                                                       int                incy)
+{
+    if(m <= 0 || n <= 0 || lda < m || incx == 0 || incy == 0 || !alpha || !A || !x || !beta || !y
+       || (trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(trans == HIPBLAS_OP_N)
+        return hipblasReproducibleLaunch(hipblasReproducibleGemvNKernel<T>,
+                                         reproducible_rows,
+                                         stream,
+                                         device_scalars,
+                                         m,
+                                         n,
+                                         n,
+                                         m,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         x,
+                                         incx,
+                                         beta,
+                                         y,
+                                         incy);
+    auto transposed = hipblasReproducibleColumnKernel<HIPBLAS_FILL_MODE_FULL, false, T>;
+    return hipblasReproducibleLaunch(transposed,
+                                     reproducible_cols,
+                                     stream,
+                                     device_scalars,
+                                     m,
+                                     n,
+                                     m,
+                                     n,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     x,
+                                     incx,
+                                     beta,
+                                     y,
+                                     incy);
+}
+
+template <bool HERMITIAN, typename T>
+static hipblasStatus_t hipblasReproducibleSymvTemplate(hipStream_t       stream,
+                                                       bool              device_scalars,
+                                                       hipblasFillMode_t uplo,
+                                                       int               n,
+                                                       const T*          alpha,
+                                                       const T*          A,
+                                                       int               lda,
+                                                       const T*          x,
+                                                       int               incx,
+                                                       const T*          beta,
+                                                       T*                y,
+                                                       int               incy)
+{
+    if(n <= 0 || lda < n || incx == 0 || incy == 0 || !alpha || !A || !x || !beta || !y
+       || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    auto kernel = uplo == HIPBLAS_FILL_MODE_UPPER
+                      ? hipblasReproducibleColumnKernel<HIPBLAS_FILL_MODE_UPPER, HERMITIAN, T>
+                      : hipblasReproducibleColumnKernel<HIPBLAS_FILL_MODE_LOWER, HERMITIAN, T>;
+    return hipblasReproducibleLaunch(kernel,
+                                     reproducible_cols,
+                                     stream,
+                                     device_scalars,
+                                     n,
+                                     n,
+                                     n,
+                                     n,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     x,
+                                     incx,
+                                     beta,
+                                     y,
+                                     incy);
+}
+
+hipblasStatus_t hipblasReproducibleDot(hipStream_t  stream,
+                                       bool         device_scalars,
+                                       int          n,
+                                       const float* x,
+                                       int          incx,
+                                       const float* y,
+                                       int          incy,
+                                       float*       result)
+{
+    return hipblasReproducibleReduce<false>(stream, device_scalars, n, x, incx, y, incy, result);
+}
+
+hipblasStatus_t hipblasReproducibleDot(hipStream_t   stream,
+                                       bool          device_scalars,
+                                       int           n,
+                                       const double* x,
+                                       int           incx,
+                                       const double* y,
+                                       int           incy,
+                                       double*       result)
+{
+    return hipblasReproducibleReduce<false>(stream, device_scalars, n, x, incx, y, incy, result);
+}
+
+hipblasStatus_t hipblasReproducibleNrm2(
+    hipStream_t stream, bool device_scalars, int n, const float* x, int incx, float* result)
+{
+    return hipblasReproducibleReduce<true>(
+        stream, device_scalars, n, x, incx, (const float*)nullptr, 0, result);
+}
+
+hipblasStatus_t hipblasReproducibleNrm2(
+    hipStream_t stream, bool device_scalars, int n, const double* x, int incx, double* result)
+{
+    return hipblasReproducibleReduce<true>(
+        stream, device_scalars, n, x, incx, (const double*)nullptr, 0, result);
+}
+
+hipblasStatus_t hipblasReproducibleGemv(hipStream_t        stream,
+                                        bool               device_scalars,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const float*       alpha,
+                                        const float*       A,
+                                        int                lda,
+                                        const float*       x,
+                                        int                incx,
+                                        const float*       beta,
+                                        float*             y,
+                                        int                incy)
+{
+    return hipblasReproducibleGemvTemplate(
+        stream, device_scalars, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+hipblasStatus_t hipblasReproducibleGemv(hipStream_t        stream,
+                                        bool               device_scalars,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const double*      alpha,
+                                        const double*      A,
+                                        int                lda,
+                                        const double*      x,
+                                        int                incx,
+                                        const double*      beta,
+                                        double*            y,
+                                        int                incy)
+{
+    return hipblasReproducibleGemvTemplate(
+        stream, device_scalars, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+hipblasStatus_t hipblasReproducibleSymv(hipStream_t       stream,
+                                        bool              device_scalars,
+                                        hipblasFillMode_t uplo,
+                                        int               n,
+                                        const float*      alpha,
+                                        const float*      A,
+                                        int               lda,
+                                        const float*      x,
+                                        int               incx,
+                                        const float*      beta,
+                                        float*            y,
+                                        int               incy)
+{
+    return hipblasReproducibleSymvTemplate<false>(
+        stream, device_scalars, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+hipblasStatus_t hipblasReproducibleSymv(hipStream_t       stream,
+                                        bool              device_scalars,
+                                        hipblasFillMode_t uplo,
+                                        int               n,
+                                        const double*     alpha,
+                                        const double*     A,
+                                        int               lda,
+                                        const double*     x,
+                                        int               incx,
+                                        const double*     beta,
+                                        double*           y,
+                                        int               incy)
+{
+    return hipblasReproducibleSymvTemplate<false>(
+        stream, device_scalars, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+hipblasStatus_t hipblasReproducibleHemv(hipStream_t           stream,
+                                        bool                  device_scalars,
+                                        hipblasFillMode_t     uplo,
+                                        int                   n,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* A,
+                                        int                   lda,
+                                        const hipblasComplex* x,
+                                        int                   incx,
+                                        const hipblasComplex* beta,
+                                        hipblasComplex*       y,
+                                        int                   incy)
+{
+    using C = hipblasReproducibleComplex<float>;
+    return hipblasReproducibleSymvTemplate<true>(stream,
+                                                 device_scalars,
+                                                 uplo,
+                                                 n,
+                                                 (const C*)alpha,
+                                                 (const C*)A,
+                                                 lda,
+                                                 (const C*)x,
+                                                 incx,
+                                                 (const C*)beta,
+                                                 (C*)y,
+                                                 incy);
+}
+
+hipblasStatus_t hipblasReproducibleHemv(hipStream_t                 stream,
+                                        bool                        device_scalars,
+                                        hipblasFillMode_t           uplo,
+                                        int                         n,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* A,
+                                        int                         lda,
+                                        const hipblasDoubleComplex* x,
+                                        int                         incx,
+                                        const hipblasDoubleComplex* beta,
+                                        hipblasDoubleComplex*       y,
+                                        int                         incy)
+{
+    using C = hipblasReproducibleComplex<double>;
+    return hipblasReproducibleSymvTemplate<true>(stream,
+                                                 device_scalars,
+                                                 uplo,
+                                                 n,
+                                                 (const C*)alpha,
+                                                 (const C*)A,
+                                                 lda,
+                                                 (const C*)x,
+                                                 incx,
+                                                 (const C*)beta,
+                                                 (C*)y,
+                                                 incy);
+}
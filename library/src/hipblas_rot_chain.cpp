@@ -0,0 +1,621 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "rot_chain.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+#ifndef HIPBLAS_ROT_CHAIN
+template <typename T>
+struct hipblasRotChainFunctions;
+
+template <>
+struct hipblasRotChainFunctions<float>
+{
+    static constexpr auto rotg = hipblasSrotg;
+    static constexpr auto rot  = hipblasSrot;
+};
+
+template <>
+struct hipblasRotChainFunctions<double>
+{
+    static constexpr auto rotg = hipblasDrotg;
+    static constexpr auto rot  = hipblasDrot;
+};
+
+template <>
+struct hipblasRotChainFunctions<hipblasComplex>
+{
+    static constexpr auto rotg = hipblasCrotg;
+    static constexpr auto rot  = hipblasCrot;
+};
+
+template <>
+struct hipblasRotChainFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto rotg = hipblasZrotg;
+    static constexpr auto rot  = hipblasZrot;
+};
+
+// Without the kernels, each rotation is a rotg and a rot of the rest of its row of A and of x on
+// the handle, in device pointer mode so that c and s stay on the device: 2 * n calls per
+// instance. The device pointer arrays of the batched form are first read back, which is not
+// possible while the stream is being captured.
+template <typename T, typename R>
+static hipblasStatus_t hipblasRotChainCalls(hipblasHandle_t handle,
+                                            int             n,
+                                            int             m,
+                                            T*              A,
+                                            T* const*       A_array,
+                                            int             lda,
+                                            hipblasStride   stride_A,
+                                            T*              x,
+                                            T* const*       x_array,
+                                            int             incx,
+                                            hipblasStride   stride_x,
+                                            R*              c,
+                                            R* const*       c_array,
+                                            hipblasStride   stride_c,
+                                            T*              s,
+                                            T* const*       s_array,
+                                            hipblasStride   stride_s,
+                                            int             batch_count)
+{
+    using F = hipblasRotChainFunctions<T>;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::vector<T*> A_b(batch_count);
+    std::vector<T*> x_b(batch_count);
+    std::vector<R*> c_b(batch_count);
+    std::vector<T*> s_b(batch_count);
+    if(A_array)
+    {
+        hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+        if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(capture_status != hipStreamCaptureStatusNone)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        size_t     bytes = sizeof(void*) * batch_count;
+        hipError_t error
+            = hipMemcpyAsync(A_b.data(), A_array, bytes, hipMemcpyDeviceToHost, stream);
+        if(error == hipSuccess)
+            error = hipMemcpyAsync(x_b.data(), x_array, bytes, hipMemcpyDeviceToHost, stream);
+        if(error == hipSuccess)
+            error = hipMemcpyAsync(c_b.data(), c_array, bytes, hipMemcpyDeviceToHost, stream);
+        if(error == hipSuccess)
+            error = hipMemcpyAsync(s_b.data(), s_array, bytes, hipMemcpyDeviceToHost, stream);
+        if(error != hipSuccess || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    else
+    {
+        for(int b = 0; b < batch_count; b++)
+        {
+            A_b[b] = A + b * stride_A;
+            x_b[b] = x + b * stride_x;
+            c_b[b] = c + b * stride_c;
+            s_b[b] = s + b * stride_s;
+        }
+    }
+
+    hipblasPointerMode_t mode;
+    status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+    {
+        for(int k = 0; k < n && status == HIPBLAS_STATUS_SUCCESS; k++)
+        {
+            T* row = A_b[b] + k + size_t(k) * lda;
+            T* x_k = x_b[b] + size_t(k) * incx;
+            status = F::rotg(handle, row, x_k, c_b[b] + k, s_b[b] + k);
+            if(status == HIPBLAS_STATUS_SUCCESS && k + 1 < m)
+                status = F::rot(
+                    handle, m - k - 1, row + lda, lda, x_k + incx, incx, c_b[b] + k, s_b[b] + k);
+        }
+    }
+
+    hipblasStatus_t restore = hipblasSetPointerMode(handle, mode);
+    return status != HIPBLAS_STATUS_SUCCESS ? status : restore;
+}
+#endif
+
+// Checks the arguments of every form, where the arrays are the pointer arrays of the batched form
+// and null otherwise, then runs the kernels or the rotg and rot calls
+template <typename T, typename R>
+static hipblasStatus_t hipblasRotChain(hipblasHandle_t handle,
+                                       int             n,
+                                       int             m,
+                                       T*              A,
+                                       T* const*       A_array,
+                                       int             lda,
+                                       hipblasStride   stride_A,
+                                       T*              x,
+                                       T* const*       x_array,
+                                       int             incx,
+                                       hipblasStride   stride_x,
+                                       R*              c,
+                                       R* const*       c_array,
+                                       hipblasStride   stride_c,
+                                       T*              s,
+                                       T* const*       s_array,
+                                       hipblasStride   stride_s,
+                                       int             batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || m < n || lda < std::max(1, n) || incx <= 0 || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    bool batched = A_array || x_array || c_array || s_array;
+    if(batched ? !A_array || !x_array || !c_array || !s_array : !A || !x || !c || !s)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_ROT_CHAIN
+    return hipblasRotChainKernels(handle,
+                                  n,
+                                  m,
+                                  A,
+                                  A_array,
+                                  lda,
+                                  stride_A,
+                                  x,
+                                  x_array,
+                                  incx,
+                                  stride_x,
+                                  c,
+                                  c_array,
+                                  stride_c,
+                                  s,
+                                  s_array,
+                                  stride_s,
+                                  batch_count);
+#else
+    return hipblasRotChainCalls(handle,
+                                n,
+                                m,
+                                A,
+                                A_array,
+                                lda,
+                                stride_A,
+                                x,
+                                x_array,
+                                incx,
+                                stride_x,
+                                c,
+                                c_array,
+                                stride_c,
+                                s,
+                                s_array,
+                                stride_s,
+                                batch_count);
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasSrotgChain(hipblasHandle_t handle,
+                                             int             n,
+                                             int             m,
+                                             float*          A,
+                                             int             lda,
+                                             float*          x,
+                                             int             incx,
+                                             float*          c,
+                                             float*          s)
+try
+{
+    HIPBLAS_LAYER(handle, n, m, A, lda, x, incx, c, s);
+    return hipblasRotChain<float, float>(
+        handle, n, m, A, nullptr, lda, 0, x, nullptr, incx, 0, c, nullptr, 0, s, nullptr, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDrotgChain(hipblasHandle_t handle,
+                                             int             n,
+                                             int             m,
+                                             double*         A,
+                                             int             lda,
+                                             double*         x,
+                                             int             incx,
+                                             double*         c,
+                                             double*         s)
+try
+{
+    HIPBLAS_LAYER(handle, n, m, A, lda, x, incx, c, s);
+    return hipblasRotChain<double, double>(
+        handle, n, m, A, nullptr, lda, 0, x, nullptr, incx, 0, c, nullptr, 0, s, nullptr, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCrotgChain(hipblasHandle_t handle,
+                                             int             n,
+                                             int             m,
+                                             hipblasComplex* A,
+                                             int             lda,
+                                             hipblasComplex* x,
+                                             int             incx,
+                                             float*          c,
+                                             hipblasComplex* s)
+try
+{
+    HIPBLAS_LAYER(handle, n, m, A, lda, x, incx, c, s);
+    return hipblasRotChain<hipblasComplex, float>(
+        handle, n, m, A, nullptr, lda, 0, x, nullptr, incx, 0, c, nullptr, 0, s, nullptr, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZrotgChain(hipblasHandle_t       handle,
+                                             int                   n,
+                                             int                   m,
+                                             hipblasDoubleComplex* A,
+                                             int                   lda,
+                                             hipblasDoubleComplex* x,
+                                             int                   incx,
+                                             double*               c,
+                                             hipblasDoubleComplex* s)
+try
+{
+    HIPBLAS_LAYER(handle, n, m, A, lda, x, incx, c, s);
+    return hipblasRotChain<hipblasDoubleComplex, double>(
+        handle, n, m, A, nullptr, lda, 0, x, nullptr, incx, 0, c, nullptr, 0, s, nullptr, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSrotgChainBatched(hipblasHandle_t handle,
+                                                    int             n,
+                                                    int             m,
+                                                    float* const    A[],
+                                                    int             lda,
+                                                    float* const    x[],
+                                                    int             incx,
+                                                    float* const    c[],
+                                                    float* const    s[],
+                                                    int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, m, A, lda, x, incx, c, s, batchCount);
+    return hipblasRotChain<float, float>(handle,
+                                         n,
+                                         m,
+                                         nullptr,
+                                         A,
+                                         lda,
+                                         0,
+                                         nullptr,
+                                         x,
+                                         incx,
+                                         0,
+                                         nullptr,
+                                         c,
+                                         0,
+                                         nullptr,
+                                         s,
+                                         0,
+                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDrotgChainBatched(hipblasHandle_t handle,
+                                                    int             n,
+                                                    int             m,
+                                                    double* const   A[],
+                                                    int             lda,
+                                                    double* const   x[],
+                                                    int             incx,
+                                                    double* const   c[],
+                                                    double* const   s[],
+                                                    int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, m, A, lda, x, incx, c, s, batchCount);
+    return hipblasRotChain<double, double>(handle,
+                                           n,
+                                           m,
+                                           nullptr,
+                                           A,
+                                           lda,
+                                           0,
+                                           nullptr,
+                                           x,
+                                           incx,
+                                           0,
+                                           nullptr,
+                                           c,
+                                           0,
+                                           nullptr,
+                                           s,
+                                           0,
+                                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCrotgChainBatched(hipblasHandle_t       handle,
+                                                    int                   n,
+                                                    int                   m,
+                                                    hipblasComplex* const A[],
+                                                    int                   lda,
+                                                    hipblasComplex* const x[],
+                                                    int                   incx,
+                                                    float* const          c[],
+                                                    hipblasComplex* const s[],
+                                                    int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, m, A, lda, x, incx, c, s, batchCount);
+    return hipblasRotChain<hipblasComplex, float>(handle,
+                                                  n,
+                                                  m,
+                                                  nullptr,
+                                                  A,
+                                                  lda,
+                                                  0,
+                                                  nullptr,
+                                                  x,
+                                                  incx,
+                                                  0,
+                                                  nullptr,
+                                                  c,
+                                                  0,
+                                                  nullptr,
+                                                  s,
+                                                  0,
+                                                  batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZrotgChainBatched(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    int                         m,
+                                                    hipblasDoubleComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasDoubleComplex* const x[],
+                                                    int                         incx,
+                                                    double* const               c[],
+                                                    hipblasDoubleComplex* const s[],
+                                                    int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, m, A, lda, x, incx, c, s, batchCount);
+    return hipblasRotChain<hipblasDoubleComplex, double>(handle,
+                                                         n,
+                                                         m,
+                                                         nullptr,
+                                                         A,
+                                                         lda,
+                                                         0,
+                                                         nullptr,
+                                                         x,
+                                                         incx,
+                                                         0,
+                                                         nullptr,
+                                                         c,
+                                                         0,
+                                                         nullptr,
+                                                         s,
+                                                         0,
+                                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSrotgChainStridedBatched(hipblasHandle_t handle,
+                                                           int             n,
+                                                           int             m,
+                                                           float*          A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           float*          x,
+                                                           int             incx,
+                                                           hipblasStride   stridex,
+                                                           float*          c,
+                                                           hipblasStride   stridec,
+                                                           float*          s,
+                                                           hipblasStride   strides,
+                                                           int             batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, m, A, lda, strideA, x, incx, stridex, c, stridec, s, strides, batchCount);
+    return hipblasRotChain<float, float>(handle,
+                                         n,
+                                         m,
+                                         A,
+                                         nullptr,
+                                         lda,
+                                         strideA,
+                                         x,
+                                         nullptr,
+                                         incx,
+                                         stridex,
+                                         c,
+                                         nullptr,
+                                         stridec,
+                                         s,
+                                         nullptr,
+                                         strides,
+                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDrotgChainStridedBatched(hipblasHandle_t handle,
+                                                           int             n,
+                                                           int             m,
+                                                           double*         A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           double*         x,
+                                                           int             incx,
+                                                           hipblasStride   stridex,
+                                                           double*         c,
+                                                           hipblasStride   stridec,
+                                                           double*         s,
+                                                           hipblasStride   strides,
+                                                           int             batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, m, A, lda, strideA, x, incx, stridex, c, stridec, s, strides, batchCount);
+    return hipblasRotChain<double, double>(handle,
+                                           n,
+                                           m,
+                                           A,
+                                           nullptr,
+                                           lda,
+                                           strideA,
+                                           x,
+                                           nullptr,
+                                           incx,
+                                           stridex,
+                                           c,
+                                           nullptr,
+                                           stridec,
+                                           s,
+                                           nullptr,
+                                           strides,
+                                           batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCrotgChainStridedBatched(hipblasHandle_t handle,
+                                                           int             n,
+                                                           int             m,
+                                                           hipblasComplex* A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           hipblasComplex* x,
+                                                           int             incx,
+                                                           hipblasStride   stridex,
+                                                           float*          c,
+                                                           hipblasStride   stridec,
+                                                           hipblasComplex* s,
+                                                           hipblasStride   strides,
+                                                           int             batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, m, A, lda, strideA, x, incx, stridex, c, stridec, s, strides, batchCount);
+    return hipblasRotChain<hipblasComplex, float>(handle,
+                                                  n,
+                                                  m,
+                                                  A,
+                                                  nullptr,
+                                                  lda,
+                                                  strideA,
+                                                  x,
+                                                  nullptr,
+                                                  incx,
+                                                  stridex,
+                                                  c,
+                                                  nullptr,
+                                                  stridec,
+                                                  s,
+                                                  nullptr,
+                                                  strides,
+                                                  batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZrotgChainStridedBatched(hipblasHandle_t       handle,
+                                                           int                   n,
+                                                           int                   m,
+                                                           hipblasDoubleComplex* A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           hipblasDoubleComplex* x,
+                                                           int                   incx,
+                                                           hipblasStride         stridex,
+                                                           double*               c,
+                                                           hipblasStride         stridec,
+                                                           hipblasDoubleComplex* s,
+                                                           hipblasStride         strides,
+                                                           int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, n, m, A, lda, strideA, x, incx, stridex, c, stridec, s, strides, batchCount);
+    return hipblasRotChain<hipblasDoubleComplex, double>(handle,
+                                                         n,
+                                                         m,
+                                                         A,
+                                                         nullptr,
+                                                         lda,
+                                                         strideA,
+                                                         x,
+                                                         nullptr,
+                                                         incx,
+                                                         stridex,
+                                                         c,
+                                                         nullptr,
+                                                         stridec,
+                                                         s,
+                                                         nullptr,
+                                                         strides,
+                                                         batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
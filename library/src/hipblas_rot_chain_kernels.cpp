@@ -0,0 +1,389 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rot_chain.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+// Largest work group, whose threads share the columns of the rows being rotated
+constexpr int rot_chain_threads = 256;
+
+// Largest grid. The work groups loop over the remaining instances.
+constexpr int rot_chain_max_grid = 65535;
+
+// Both layouts of hipblasComplex map to this
+template <typename R>
+struct hipblasRotChainComplex
+{
+    R x, y;
+};
+
+// rotg of (a, b) as the reference BLAS computes it: a is overwritten with r and b with z
+template <typename R>
+__device__ inline void hipblasRotChainGenerate(R& a, R& b, R& c, R& s)
+{
+    R anorm = fabs(a);
+    R bnorm = fabs(b);
+    R scale = anorm + bnorm;
+    if(scale == 0)
+    {
+        c = 1;
+        s = 0;
+        a = 0;
+        b = 0;
+        return;
+    }
+
+    R sa = a / scale;
+    R sb = b / scale;
+    R r  = scale * sqrt(sa * sa + sb * sb);
+    if((anorm > bnorm ? a : b) < 0)
+        r = -r;
+    c = a / r;
+    s = b / r;
+    a = r;
+    b = anorm > bnorm ? s : c != 0 ? R(1) / c : R(1);
+}
+
+// The complex rotg only overwrites a, with r
+template <typename R>
+__device__ inline void hipblasRotChainGenerate(hipblasRotChainComplex<R>&       a,
+                                               const hipblasRotChainComplex<R>& b,
+                                               R&                               c,
+                                               hipblasRotChainComplex<R>&       s)
+{
+    R anorm = hypot(a.x, a.y);
+    if(anorm == 0)
+    {
+        c = 0;
+        s = {1, 0};
+        a = b;
+        return;
+    }
+
+    // alpha = a / |a|, c = |a| / norm, s = alpha * conj(b) / norm and r = alpha * norm
+    R bnorm = hypot(b.x, b.y);
+    R scale = anorm + bnorm;
+    R sa    = anorm / scale;
+    R sb    = bnorm / scale;
+    R norm  = scale * sqrt(sa * sa + sb * sb);
+    R ax    = a.x / anorm;
+    R ay    = a.y / anorm;
+    c       = anorm / norm;
+    s       = {(ax * b.x + ay * b.y) / norm, (ay * b.x - ax * b.y) / norm};
+    a       = {ax * norm, ay * norm};
+}
+
+// (a, b) := (c * a + s * b, c * b - conj(s) * a)
+template <typename R>
+__device__ inline void hipblasRotChainApply(R c, R s, R& a, R& b)
+{
+    R t = c * a + s * b;
+    b   = c * b - s * a;
+    a   = t;
+}
+
+template <typename R>
+__device__ inline void hipblasRotChainApply(R                          c,
+                                            hipblasRotChainComplex<R>  s,
+                                            hipblasRotChainComplex<R>& a,
+                                            hipblasRotChainComplex<R>& b)
+{
+    hipblasRotChainComplex<R> t
+        = {c * a.x + s.x * b.x - s.y * b.y, c * a.y + s.x * b.y + s.y * b.x};
+    b = {c * b.x - s.x * a.x - s.y * a.y, c * b.y - s.x * a.y + s.y * a.x};
+    a = t;
+}
+
+// Instance b of a batched or strided batched call
+template <typename T>
+__device__ inline T* hipblasRotChainInstance(T* p, T* const* p_array, int b, hipblasStride stride)
+{
+    return p_array ? p_array[b] : p + b * stride;
+}
+
+// Work group b runs the chain of instance b. Rotation k only changes row k of A and the
+// elements k to m - 1 of x, so the next rotation can start once every thread has rotated its
+// columns.
+template <typename T, typename R>
+__global__ void __launch_bounds__(rot_chain_threads)
+    hipblasRotChainKernel(int           n,
+                          int           m,
+                          T*            A,
+                          T* const*     A_array,
+                          int           lda,
+                          hipblasStride stride_A,
+                          T*            x,
+                          T* const*     x_array,
+                          int           incx,
+                          hipblasStride stride_x,
+                          R*            c,
+                          R* const*     c_array,
+                          hipblasStride stride_c,
+                          T*            s,
+                          T* const*     s_array,
+                          hipblasStride stride_s,
+                          int           batch_count)
+{
+    __shared__ R c_k;
+    __shared__ T s_k;
+
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        T* A_b = hipblasRotChainInstance(A, A_array, b, stride_A);
+        T* x_b = hipblasRotChainInstance(x, x_array, b, stride_x);
+        R* c_b = hipblasRotChainInstance(c, c_array, b, stride_c);
+        T* s_b = hipblasRotChainInstance(s, s_array, b, stride_s);
+
+        for(int k = 0; k < n; k++)
+        {
+            T* row = A_b + k + size_t(k) * lda;
+            if(threadIdx.x == 0)
+            {
+                hipblasRotChainGenerate(row[0], x_b[size_t(k) * incx], c_k, s_k);
+                c_b[k] = c_k;
+                s_b[k] = s_k;
+            }
+            __syncthreads();
+
+            R c_j = c_k;
+            T s_j = s_k;
+            for(int j = k + 1 + threadIdx.x; j < m; j += blockDim.x)
+                hipblasRotChainApply(c_j, s_j, row[size_t(j - k) * lda], x_b[size_t(j) * incx]);
+            __syncthreads();
+        }
+    }
+}
+
+template <typename T, typename R, typename Th>
+static hipblasStatus_t hipblasRotChainLaunch(hipblasHandle_t handle,
+                                             int             n,
+                                             int             m,
+                                             Th*             A,
+                                             Th* const*      A_array,
+                                             int             lda,
+                                             hipblasStride   stride_A,
+                                             Th*             x,
+                                             Th* const*      x_array,
+                                             int             incx,
+                                             hipblasStride   stride_x,
+                                             R*              c,
+                                             R* const*       c_array,
+                                             hipblasStride   stride_c,
+                                             Th*             s,
+                                             Th* const*      s_array,
+                                             hipblasStride   stride_s,
+                                             int             batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // A power of two of threads covering the columns right of the first diagonal element, at
+    // least a wavefront
+    int threads = 64;
+    while(threads < m - 1 && threads < rot_chain_threads)
+        threads *= 2;
+
+    hipLaunchKernelGGL((hipblasRotChainKernel<T, R>),
+                       dim3(std::min(batch_count, rot_chain_max_grid)),
+                       dim3(threads),
+                       0,
+                       stream,
+                       n,
+                       m,
+                       (T*)A,
+                       (T* const*)A_array,
+                       lda,
+                       stride_A,
+                       (T*)x,
+                       (T* const*)x_array,
+                       incx,
+                       stride_x,
+                       c,
+                       c_array,
+                       stride_c,
+                       (T*)s,
+                       (T* const*)s_array,
+                       stride_s,
+                       batch_count);
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasRotChainKernels(hipblasHandle_t handle,
+                                       int             n,
+                                       int             m,
+                                       float*          A,
+                                       float* const*   A_array,
+                                       int             lda,
+                                       hipblasStride   stride_A,
+                                       float*          x,
+                                       float* const*   x_array,
+                                       int             incx,
+                                       hipblasStride   stride_x,
+                                       float*          c,
+                                       float* const*   c_array,
+                                       hipblasStride   stride_c,
+                                       float*          s,
+                                       float* const*   s_array,
+                                       hipblasStride   stride_s,
+                                       int             batch_count)
+{
+    return hipblasRotChainLaunch<float>(handle,
+                                        n,
+                                        m,
+                                        A,
+                                        A_array,
+                                        lda,
+                                        stride_A,
+                                        x,
+                                        x_array,
+                                        incx,
+                                        stride_x,
+                                        c,
+                                        c_array,
+                                        stride_c,
+                                        s,
+                                        s_array,
+                                        stride_s,
+                                        batch_count);
+}
+
+hipblasStatus_t hipblasRotChainKernels(hipblasHandle_t handle,
+                                       int             n,
+                                       int             m,
+                                       double*         A,
+                                       double* const*  A_array,
+                                       int             lda,
+                                       hipblasStride   stride_A,
+                                       double*         x,
+                                       double* const*  x_array,
+                                       int             incx,
+                                       hipblasStride   stride_x,
+                                       double*         c,
+                                       double* const*  c_array,
+                                       hipblasStride   stride_c,
+                                       double*         s,
+                                       double* const*  s_array,
+                                       hipblasStride   stride_s,
+                                       int             batch_count)
+{
+    return hipblasRotChainLaunch<double>(handle,
+                                         n,
+                                         m,
+                                         A,
+                                         A_array,
+                                         lda,
+                                         stride_A,
+                                         x,
+                                         x_array,
+                                         incx,
+                                         stride_x,
+                                         c,
+                                         c_array,
+                                         stride_c,
+                                         s,
+                                         s_array,
+                                         stride_s,
+                                         batch_count);
+}
+
+hipblasStatus_t hipblasRotChainKernels(hipblasHandle_t        handle,
+                                       int                    n,
+                                       int                    m,
+                                       hipblasComplex*        A,
+                                       hipblasComplex* const* A_array,
+                                       int                    lda,
+                                       hipblasStride          stride_A,
+                                       hipblasComplex*        x,
+                                       hipblasComplex* const* x_array,
+                                       int                    incx,
+                                       hipblasStride          stride_x,
+                                       float*                 c,
+                                       float* const*          c_array,
+                                       hipblasStride          stride_c,
+                                       hipblasComplex*        s,
+                                       hipblasComplex* const* s_array,
+                                       hipblasStride          stride_s,
+                                       int                    batch_count)
+{
+    return hipblasRotChainLaunch<hipblasRotChainComplex<float>>(handle,
+                                                                n,
+                                                                m,
+                                                                A,
+                                                                A_array,
+                                                                lda,
+                                                                stride_A,
+                                                                x,
+                                                                x_array,
+                                                                incx,
+                                                                stride_x,
+                                                                c,
+                                                                c_array,
+                                                                stride_c,
+                                                                s,
+                                                                s_array,
+                                                                stride_s,
+                                                                batch_count);
+}
+
+hipblasStatus_t hipblasRotChainKernels(hipblasHandle_t              handle,
+                                       int                          n,
+                                       int                          m,
+                                       hipblasDoubleComplex*        A,
+                                       hipblasDoubleComplex* const* A_array,
+                                       int                          lda,
+                                       hipblasStride                stride_A,
+                                       hipblasDoubleComplex*        x,
+                                       hipblasDoubleComplex* const* x_array,
+                                       int                          incx,
+                                       hipblasStride                stride_x,
+                                       double*                      c,
+                                       double* const*               c_array,
+                                       hipblasStride                stride_c,
+                                       hipblasDoubleComplex*        s,
+                                       hipblasDoubleComplex* const* s_array,
+                                       hipblasStride                stride_s,
+                                       int                          batch_count)
+{
+    return hipblasRotChainLaunch<hipblasRotChainComplex<double>>(handle,
+                                                                 n,
+                                                                 m,
+                                                                 A,
+                                                                 A_array,
+                                                                 lda,
+                                                                 stride_A,
+                                                                 x,
+                                                                 x_array,
+                                                                 incx,
+                                                                 stride_x,
+                                                                 c,
+                                                                 c_array,
+                                                                 stride_c,
+                                                                 s,
+                                                                 s_array,
+                                                                 stride_s,
+                                                                 batch_count);
+}
@@ -0,0 +1,309 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "shared_handle.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// The pool of a shared handle. Handles returned to the pool are kept whatever stream they last
+// ran on, so the pool is as large as the most calls that ran on the shared handle at once.
+struct hipblasSharedHandle
+{
+    hipblasHandle_t handle         = nullptr;
+    uint64_t        generation     = 0; // tells the streams set for an earlier shared handle apart
+    hipStream_t     default_stream = nullptr;
+
+    std::mutex                            mutex;
+    std::vector<hipblasSharedHandleEntry> free; // most recently returned last
+
+    ~hipblasSharedHandle()
+    {
+        for(auto& e : free)
+        {
+            if(e.handle)
+                (void)hipblasDestroy(e.handle);
+            if(e.done)
+                (void)hipEventDestroy(e.done);
+        }
+    }
+};
+
+std::atomic<int> hipblas_shared_handles{0};
+
+// The shared handles, released outside the lock as destroying a pool destroys handles
+static std::mutex shared_handle_mutex;
+static uint64_t   shared_handle_generation = 0;
+
+static std::unordered_map<hipblasHandle_t, std::shared_ptr<hipblasSharedHandle>> shared_handles;
+
+// Stream set by the thread for each shared handle, with the generation of the handle it was set for
+static thread_local std::unordered_map<hipblasHandle_t, std::pair<uint64_t, hipStream_t>>
+    shared_handle_streams;
+
+static std::shared_ptr<hipblasSharedHandle> hipblasSharedHandleGet(hipblasHandle_t handle)
+{
+    if(!hipblas_shared_handles.load(std::memory_order_relaxed))
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(shared_handle_mutex);
+
+    auto shared = shared_handles.find(handle);
+    return shared == shared_handles.end() ? nullptr : shared->second;
+}
+
+// Replace the pool of handle, returning the previous one
+static std::shared_ptr<hipblasSharedHandle>
+    hipblasSharedHandleExchange(hipblasHandle_t handle, std::shared_ptr<hipblasSharedHandle> shared)
+{
+    std::lock_guard<std::mutex> lock(shared_handle_mutex);
+
+    std::shared_ptr<hipblasSharedHandle> old;
+    if(shared)
+        shared->generation = ++shared_handle_generation;
+
+    auto it = shared_handles.find(handle);
+    if(it != shared_handles.end())
+    {
+        old = std::move(it->second);
+        if(shared)
+            it->second = std::move(shared);
+        else
+        {
+            shared_handles.erase(it);
+            hipblas_shared_handles--;
+        }
+    }
+    else if(shared)
+    {
+        shared_handles.emplace(handle, std::move(shared));
+        hipblas_shared_handles++;
+    }
+    return old;
+}
+
+// Stream of the calling thread on a shared handle
+static hipStream_t hipblasSharedHandleStream(const hipblasSharedHandle& shared)
+{
+    auto it = shared_handle_streams.find(shared.handle);
+    if(it != shared_handle_streams.end() && it->second.first == shared.generation)
+        return it->second.second;
+    return shared.default_stream;
+}
+
+void hipblasSharedHandleScope::acquire(hipblasHandle_t& handle)
+{
+    shared = hipblasSharedHandleGet(handle);
+    if(!shared)
+        return;
+
+    hipblasHandle_t parent = handle;
+    hipStream_t     stream = hipblasSharedHandleStream(*shared);
+    handle                 = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(shared->mutex);
+
+        // The most recent handle last used on the stream needs no wait
+        auto& free = shared->free;
+        if(!free.empty())
+        {
+            auto same = std::find_if(free.rbegin(), free.rend(), [&](const auto& e) {
+                return e.stream == stream;
+            });
+
+            auto it = same == free.rend() ? std::prev(free.end()) : std::prev(same.base());
+            entry   = *it;
+            free.erase(it);
+        }
+    }
+
+    if(!entry.handle)
+    {
+        if(hipEventCreateWithFlags(&entry.done, hipEventDisableTiming) != hipSuccess)
+        {
+            entry.done = nullptr;
+            (void)hipGetLastError();
+            return;
+        }
+        if(hipblasCreate(&entry.handle) != HIPBLAS_STATUS_SUCCESS)
+        {
+            entry.handle = nullptr;
+            return;
+        }
+    }
+
+    // The workspace of the handle may still be in use by its last call on the other stream
+    if(entry.stream != stream)
+    {
+        if(entry.used && hipStreamWaitEvent(stream, entry.done, 0) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return;
+        }
+        if(hipblasSetStream(entry.handle, stream) != HIPBLAS_STATUS_SUCCESS)
+            return;
+        entry.stream = stream;
+    }
+
+    // Only the modes that changed since the handle last ran are applied to it. A handle left
+    // half configured by a failure is configured in full on its next call.
+    hipblasPointerMode_t pointer_mode;
+    hipblasAtomicsMode_t atomics_mode;
+    hipblasMath_t        math_mode;
+    if(hipblasGetPointerMode(parent, &pointer_mode) != HIPBLAS_STATUS_SUCCESS
+       || hipblasGetAtomicsMode(parent, &atomics_mode) != HIPBLAS_STATUS_SUCCESS
+       || hipblasGetMathMode(parent, &math_mode) != HIPBLAS_STATUS_SUCCESS)
+        return;
+
+    bool all         = !entry.configured;
+    entry.configured = false;
+    if((all || entry.pointer_mode != pointer_mode)
+       && hipblasSetPointerMode(entry.handle, pointer_mode) != HIPBLAS_STATUS_SUCCESS)
+        return;
+    if((all || entry.atomics_mode != atomics_mode)
+       && hipblasSetAtomicsMode(entry.handle, atomics_mode) != HIPBLAS_STATUS_SUCCESS)
+        return;
+    if((all || entry.math_mode != math_mode)
+       && hipblasSetMathMode(entry.handle, math_mode) != HIPBLAS_STATUS_SUCCESS)
+        return;
+    entry.configured   = true;
+    entry.pointer_mode = pointer_mode;
+    entry.atomics_mode = atomics_mode;
+    entry.math_mode    = math_mode;
+
+    handle = entry.handle;
+}
+
+void hipblasSharedHandleScope::release()
+{
+    if(entry.handle)
+    {
+        if(hipEventRecord(entry.done, entry.stream) == hipSuccess)
+            entry.used = true;
+        else
+        {
+            // Without the event, the next call waits for nothing
+            (void)hipGetLastError();
+            (void)hipStreamSynchronize(entry.stream);
+            entry.used = false;
+        }
+
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        shared->free.push_back(entry);
+    }
+    else if(entry.done)
+        (void)hipEventDestroy(entry.done);
+
+    // Destroys the pool when the handle was destroyed or made unshared during the call
+    shared.reset();
+}
+
+bool hipblasSharedHandleIs(hipblasHandle_t handle)
+{
+    return hipblasSharedHandleGet(handle) != nullptr;
+}
+
+bool hipblasSharedHandleSetStream(hipblasHandle_t handle, hipStream_t stream)
+{
+    auto shared = hipblasSharedHandleGet(handle);
+    if(!shared)
+        return false;
+
+    shared_handle_streams[handle] = {shared->generation, stream};
+    return true;
+}
+
+bool hipblasSharedHandleGetStream(hipblasHandle_t handle, hipStream_t* stream)
+{
+    auto shared = hipblasSharedHandleGet(handle);
+    if(!shared)
+        return false;
+
+    if(stream)
+        *stream = hipblasSharedHandleStream(*shared);
+    return true;
+}
+
+void hipblasSharedHandleErase(hipblasHandle_t handle)
+{
+    if(hipblas_shared_handles.load(std::memory_order_relaxed))
+        hipblasSharedHandleExchange(handle, nullptr);
+}
+
+extern "C" hipblasStatus_t hipblasSetHandleMode(hipblasHandle_t handle, hipblasHandleMode_t mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_HANDLE_MODE_DEFAULT && mode != HIPBLAS_HANDLE_MODE_SHARED)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    if(mode == HIPBLAS_HANDLE_MODE_DEFAULT)
+    {
+        hipblasSharedHandleErase(handle);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // Threads that never set a stream keep running on the stream of the handle
+    auto shared    = std::make_shared<hipblasSharedHandle>();
+    shared->handle = handle;
+
+    hipblasStatus_t status = hipblasGetStream(handle, &shared->default_stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasSharedHandleExchange(handle, std::move(shared));
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetHandleMode(hipblasHandle_t handle, hipblasHandleMode_t* mode)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, mode);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasSharedHandleIs(handle) ? HIPBLAS_HANDLE_MODE_SHARED
+                                          : HIPBLAS_HANDLE_MODE_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
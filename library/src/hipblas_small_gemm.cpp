@@ -0,0 +1,306 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "small_gemm.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+constexpr int small_gemm_block_size = 256;
+constexpr int small_gemm_max_blocks = 1 << 16;
+
+// One thread per element of C and small_gemm_block_size / (DIM * DIM) problems per work group.
+// op( A ) and op( B ) are zero padded to DIM x DIM in shared memory, so the inner loop has a
+// fixed trip count. The work group strides over the batch; the loop bound is uniform so every
+// thread reaches the barriers.
+template <typename T, int DIM>
+__global__ void __launch_bounds__(small_gemm_block_size)
+    hipblasSmallGemmKernel(bool          trans_a,
+                           bool          trans_b,
+                           int           m,
+                           int           n,
+                           int           k,
+                           const T*      alpha_device,
+                           T             alpha_host,
+                           const T*      A,
+                           int           lda,
+                           hipblasStride stride_a,
+                           const T*      B,
+                           int           ldb,
+                           hipblasStride stride_b,
+                           const T*      beta_device,
+                           T             beta_host,
+                           T*            C,
+                           int           ldc,
+                           hipblasStride stride_c,
+                           int           batch_count)
+{
+    constexpr int problems = small_gemm_block_size / (DIM * DIM);
+
+    __shared__ T sA[problems][DIM][DIM];
+    __shared__ T sB[problems][DIM][DIM];
+
+    int local = threadIdx.x / (DIM * DIM);
+    int i     = threadIdx.x % DIM;
+    int j     = threadIdx.x / DIM % DIM;
+
+    T alpha = alpha_device ? *alpha_device : alpha_host;
+    T beta  = beta_device ? *beta_device : beta_host;
+
+    for(int64_t first = int64_t(blockIdx.x) * problems; first < batch_count;
+        first += int64_t(gridDim.x) * problems)
+    {
+        int64_t batch = first + local;
+        bool    valid = batch < batch_count;
+
+        // A and B are not referenced when alpha is zero
+        T a = 0, b = 0;
+        if(valid && alpha != 0)
+        {
+            if(i < m && j < k)
+                a = trans_a ? A[batch * stride_a + j + int64_t(i) * lda]
+                            : A[batch * stride_a + i + int64_t(j) * lda];
+            if(i < k && j < n)
+                b = trans_b ? B[batch * stride_b + j + int64_t(i) * ldb]
+                            : B[batch * stride_b + i + int64_t(j) * ldb];
+        }
+        sA[local][i][j] = a;
+        sB[local][i][j] = b;
+        __syncthreads();
+
+        T sum = 0;
+#pragma unroll
+        for(int l = 0; l < DIM; l++)
+            sum += sA[local][i][l] * sB[local][l][j];
+
+        if(valid && i < m && j < n)
+        {
+            T& c = C[batch * stride_c + i + int64_t(j) * ldc];
+            c    = beta == 0 ? alpha * sum : alpha * sum + beta * c;
+        }
+        __syncthreads();
+    }
+}
+
+template <typename T, int DIM>
+static hipblasStatus_t hipblasSmallGemmLaunch(hipStream_t   stream,
+                                              bool          trans_a,
+                                              bool          trans_b,
+                                              int           m,
+                                              int           n,
+                                              int           k,
+                                              const T*      alpha_device,
+                                              T             alpha_host,
+                                              const T*      A,
+                                              int           lda,
+                                              hipblasStride stride_a,
+                                              const T*      B,
+                                              int           ldb,
+                                              hipblasStride stride_b,
+                                              const T*      beta_device,
+                                              T             beta_host,
+                                              T*            C,
+                                              int           ldc,
+                                              hipblasStride stride_c,
+                                              int           batch_count)
+{
+    constexpr int problems = small_gemm_block_size / (DIM * DIM);
+
+    int blocks = int(std::min<int64_t>((int64_t(batch_count) + problems - 1) / problems,
+                                       small_gemm_max_blocks));
+    hipLaunchKernelGGL((hipblasSmallGemmKernel<T, DIM>),
+                       dim3(blocks),
+                       dim3(small_gemm_block_size),
+                       0,
+                       stream,
+                       trans_a,
+                       trans_b,
+                       m,
+                       n,
+                       k,
+                       alpha_device,
+                       alpha_host,
+                       A,
+                       lda,
+                       stride_a,
+                       B,
+                       ldb,
+                       stride_b,
+                       beta_device,
+                       beta_host,
+                       C,
+                       ldc,
+                       stride_c,
+                       batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasSmallGemmTemplate(hipblasHandle_t    handle,
+                                                hipblasOperation_t transa,
+                                                hipblasOperation_t transb,
+                                                int                m,
+                                                int                n,
+                                                int                k,
+                                                const T*           alpha,
+                                                const T*           A,
+                                                int                lda,
+                                                hipblasStride      stride_a,
+                                                const T*           B,
+                                                int                ldb,
+                                                hipblasStride      stride_b,
+                                                const T*           beta,
+                                                T*                 C,
+                                                int                ldc,
+                                                hipblasStride      stride_c,
+                                                int                batch_count)
+{
+    auto valid_op = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    };
+
+    // Empty problems, invalid arguments and larger sizes are left to the backend
+    bool trans_a = transa != HIPBLAS_OP_N, trans_b = transb != HIPBLAS_OP_N;
+    if(!valid_op(transa) || !valid_op(transb) || m <= 0 || n <= 0 || k < 0 || batch_count <= 0
+       || m > small_gemm_max_size || n > small_gemm_max_size || k > small_gemm_max_size
+       || lda < (trans_a ? k : m) || ldb < (trans_b ? n : k) || ldc < m || !alpha || !beta
+       || !C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasPointerMode_t pointer_mode;
+    hipStream_t          stream;
+    if(hipblasGetPointerMode(handle, &pointer_mode) != HIPBLAS_STATUS_SUCCESS
+       || hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // With a host alpha of zero A and B may be null
+    bool     device       = pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+    const T* alpha_device = device ? alpha : nullptr;
+    const T* beta_device  = device ? beta : nullptr;
+    T        alpha_host   = device ? T(0) : *alpha;
+    T        beta_host    = device ? T(0) : *beta;
+    if((device || alpha_host != 0) && k > 0 && (!A || !B))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int  dim    = std::max({m, n, k});
+    auto launch = dim <= 4   ? hipblasSmallGemmLaunch<T, 4>
+                  : dim <= 8 ? hipblasSmallGemmLaunch<T, 8>
+                             : hipblasSmallGemmLaunch<T, 16>;
+    return launch(stream,
+                  trans_a,
+                  trans_b,
+                  m,
+                  n,
+                  k,
+                  alpha_device,
+                  alpha_host,
+                  A,
+                  lda,
+                  stride_a,
+                  B,
+                  ldb,
+                  stride_b,
+                  beta_device,
+                  beta_host,
+                  C,
+                  ldc,
+                  stride_c,
+                  batch_count);
+}
+
+hipblasStatus_t hipblasSmallGemmStridedBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const float*       alpha,
+                                               const float*       A,
+                                               int                lda,
+                                               hipblasStride      stride_a,
+                                               const float*       B,
+                                               int                ldb,
+                                               hipblasStride      stride_b,
+                                               const float*       beta,
+                                               float*             C,
+                                               int                ldc,
+                                               hipblasStride      stride_c,
+                                               int                batch_count)
+{
+    return hipblasSmallGemmTemplate(handle,
+                                    transa,
+                                    transb,
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    A,
+                                    lda,
+                                    stride_a,
+                                    B,
+                                    ldb,
+                                    stride_b,
+                                    beta,
+                                    C,
+                                    ldc,
+                                    stride_c,
+                                    batch_count);
+}
+
+hipblasStatus_t hipblasSmallGemmStridedBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const double*      alpha,
+                                               const double*      A,
+                                               int                lda,
+                                               hipblasStride      stride_a,
+                                               const double*      B,
+                                               int                ldb,
+                                               hipblasStride      stride_b,
+                                               const double*      beta,
+                                               double*            C,
+                                               int                ldc,
+                                               hipblasStride      stride_c,
+                                               int                batch_count)
+{
+    return hipblasSmallGemmTemplate(handle,
+                                    transa,
+                                    transb,
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    A,
+                                    lda,
+                                    stride_a,
+                                    B,
+                                    ldb,
+                                    stride_b,
+                                    beta,
+                                    C,
+                                    ldc,
+                                    stride_c,
+                                    batch_count);
+}
@@ -0,0 +1,282 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "small_level1.hpp"
+#include <hip/hip_runtime.h>
+
+constexpr int small_level1_block_size = 256;
+
+// With a negative increment the vector starts at its last element, as in the reference BLAS
+template <typename T>
+static T* hipblasSmallLevel1Start(T* x, int n, int incx)
+{
+    return incx < 0 ? x - int64_t(n - 1) * incx : x;
+}
+
+static hipblasStatus_t hipblasSmallLevel1Launched()
+{
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+template <typename T>
+__global__ void __launch_bounds__(small_level1_block_size) hipblasSmallAxpyKernel(
+    int n, const T* alpha_device, T alpha_host, const T* x, int incx, T* y, int incy)
+{
+    int i = blockIdx.x * small_level1_block_size + threadIdx.x;
+    T   a = alpha_device ? *alpha_device : alpha_host;
+    if(i < n && a != 0)
+        y[int64_t(i) * incy] += a * x[int64_t(i) * incx];
+}
+
+template <typename T>
+__global__ void __launch_bounds__(small_level1_block_size)
+    hipblasSmallScalKernel(int n, const T* alpha_device, T alpha_host, T* x, int incx)
+{
+    int i = blockIdx.x * small_level1_block_size + threadIdx.x;
+    T   a = alpha_device ? *alpha_device : alpha_host;
+    if(i < n)
+        x[int64_t(i) * incx] *= a;
+}
+
+template <typename T>
+__global__ void __launch_bounds__(small_level1_block_size)
+    hipblasSmallCopyKernel(int n, const T* x, int incx, T* y, int incy)
+{
+    int i = blockIdx.x * small_level1_block_size + threadIdx.x;
+    if(i < n)
+        y[int64_t(i) * incy] = x[int64_t(i) * incx];
+}
+
+// One work group sums the products of the threads' elements in a fixed order, so the result
+// does not depend on scheduling
+template <typename T>
+__global__ void __launch_bounds__(small_level1_block_size)
+    hipblasSmallDotKernel(int n, const T* x, int incx, const T* y, int incy, T* result)
+{
+    __shared__ T partial[small_level1_block_size];
+
+    T sum = 0;
+    for(int i = threadIdx.x; i < n; i += small_level1_block_size)
+        sum += x[int64_t(i) * incx] * y[int64_t(i) * incy];
+    partial[threadIdx.x] = sum;
+    __syncthreads();
+
+    for(int half = small_level1_block_size / 2; half > 0; half /= 2)
+    {
+        if(threadIdx.x < half)
+            partial[threadIdx.x] += partial[threadIdx.x + half];
+        __syncthreads();
+    }
+
+    if(threadIdx.x == 0)
+        *result = partial[0];
+}
+
+// Whether the kernels take n elements, the tuned limit being checked by the caller
+static bool hipblasSmallLevel1Fits(int n)
+{
+    return n > 0 && n <= small_level1_max_size;
+}
+
+static int hipblasSmallLevel1Blocks(int n)
+{
+    return (n + small_level1_block_size - 1) / small_level1_block_size;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasSmallAxpyTemplate(hipStream_t stream,
+                                                bool        device_scalars,
+                                                int         n,
+                                                const T*    alpha,
+                                                const T*    x,
+                                                int         incx,
+                                                T*          y,
+                                                int         incy)
+{
+    // incy of zero makes every thread update one element, which the backend serializes
+    if(!hipblasSmallLevel1Fits(n) || incy == 0 || !alpha || !x || !y)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // A host alpha of zero leaves y as it is
+    T alpha_host = device_scalars ? T(0) : *alpha;
+    if(!device_scalars && alpha_host == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipLaunchKernelGGL(hipblasSmallAxpyKernel<T>,
+                       dim3(hipblasSmallLevel1Blocks(n)),
+                       dim3(small_level1_block_size),
+                       0,
+                       stream,
+                       n,
+                       device_scalars ? alpha : nullptr,
+                       alpha_host,
+                       hipblasSmallLevel1Start(x, n, incx),
+                       incx,
+                       hipblasSmallLevel1Start(y, n, incy),
+                       incy);
+    return hipblasSmallLevel1Launched();
+}
+
+template <typename T>
+static hipblasStatus_t hipblasSmallScalTemplate(
+    hipStream_t stream, bool device_scalars, int n, const T* alpha, T* x, int incx)
+{
+    // The backend returns without scaling for incx <= 0
+    if(!hipblasSmallLevel1Fits(n) || incx <= 0 || !alpha || !x)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    T alpha_host = device_scalars ? T(0) : *alpha;
+    if(!device_scalars && alpha_host == 1)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipLaunchKernelGGL(hipblasSmallScalKernel<T>,
+                       dim3(hipblasSmallLevel1Blocks(n)),
+                       dim3(small_level1_block_size),
+                       0,
+                       stream,
+                       n,
+                       device_scalars ? alpha : nullptr,
+                       alpha_host,
+                       x,
+                       incx);
+    return hipblasSmallLevel1Launched();
+}
+
+template <typename T>
+static hipblasStatus_t
+    hipblasSmallCopyTemplate(hipStream_t stream, int n, const T* x, int incx, T* y, int incy)
+{
+    if(!hipblasSmallLevel1Fits(n) || incy == 0 || !x || !y)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipLaunchKernelGGL(hipblasSmallCopyKernel<T>,
+                       dim3(hipblasSmallLevel1Blocks(n)),
+                       dim3(small_level1_block_size),
+                       0,
+                       stream,
+                       n,
+                       hipblasSmallLevel1Start(x, n, incx),
+                       incx,
+                       hipblasSmallLevel1Start(y, n, incy),
+                       incy);
+    return hipblasSmallLevel1Launched();
+}
+
+template <typename T>
+static hipblasStatus_t hipblasSmallDotTemplate(hipStream_t stream,
+                                               bool        device_scalars,
+                                               int         n,
+                                               const T*    x,
+                                               int         incx,
+                                               const T*    y,
+                                               int         incy,
+                                               T*          result)
+{
+    if(!device_scalars || !hipblasSmallLevel1Fits(n) || !x || !y || !result)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipLaunchKernelGGL(hipblasSmallDotKernel<T>,
+                       dim3(1),
+                       dim3(small_level1_block_size),
+                       0,
+                       stream,
+                       n,
+                       hipblasSmallLevel1Start(x, n, incx),
+                       incx,
+                       hipblasSmallLevel1Start(y, n, incy),
+                       incy,
+                       result);
+    return hipblasSmallLevel1Launched();
+}
+
+hipblasStatus_t hipblasSmallAxpy(hipStream_t  stream,
+                                 bool         device_scalars,
+                                 int          n,
+                                 const float* alpha,
+                                 const float* x,
+                                 int          incx,
+                                 float*       y,
+                                 int          incy)
+{
+    return hipblasSmallAxpyTemplate(stream, device_scalars, n, alpha, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasSmallAxpy(hipStream_t   stream,
+                                 bool          device_scalars,
+                                 int           n,
+                                 const double* alpha,
+                                 const double* x,
+                                 int           incx,
+                                 double*       y,
+                                 int           incy)
+{
+    return hipblasSmallAxpyTemplate(stream, device_scalars, n, alpha, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasSmallScal(
+    hipStream_t stream, bool device_scalars, int n, const float* alpha, float* x, int incx)
+{
+    return hipblasSmallScalTemplate(stream, device_scalars, n, alpha, x, incx);
+}
+
+hipblasStatus_t hipblasSmallScal(
+    hipStream_t stream, bool device_scalars, int n, const double* alpha, double* x, int incx)
+{
+    return hipblasSmallScalTemplate(stream, device_scalars, n, alpha, x, incx);
+}
+
+hipblasStatus_t
+    hipblasSmallCopy(hipStream_t stream, int n, const float* x, int incx, float* y, int incy)
+{
+    return hipblasSmallCopyTemplate(stream, n, x, incx, y, incy);
+}
+
+hipblasStatus_t
+    hipblasSmallCopy(hipStream_t stream, int n, const double* x, int incx, double* y, int incy)
+{
+    return hipblasSmallCopyTemplate(stream, n, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasSmallDot(hipStream_t  stream,
+                                bool         device_scalars,
+                                int          n,
+                                const float* x,
+                                int          incx,
+                                const float* y,
+                                int          incy,
+                                float*       result)
+{
+    return hipblasSmallDotTemplate(stream, device_scalars, n, x, incx, y, incy, result);
+}
+
+hipblasStatus_t hipblasSmallDot(hipStream_t   stream,
+                                bool          device_scalars,
+                                int           n,
+                                const double* x,
+                                int           incx,
+                                const double* y,
+                                int           incy,
+                                double*       result)
+{
+    return hipblasSmallDotTemplate(stream, device_scalars, n, x, incx, y, incy, result);
+}
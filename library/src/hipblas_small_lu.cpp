@@ -0,0 +1,975 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "info_summary.hpp"
+#include "layer.hpp"
+#include "scratch.hpp"
+#include "small_lu.hpp"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+// getrf and getrs with pivot indices of 8 or 16 bits, and matinvBatched. Matrices of order up to
+// hipblas_small_lu_max_n are factored and solved by the small LU kernels, which read and write
+// the compact indices directly, and inverted by Gauss-Jordan elimination. Larger ones go through
+// the batched hipBLAS getrf, getrs and getri of each form with 32-bit indices in stream-ordered
+// device memory, copied from or to the compact ones, so both backends share this file.
+
+// hipBLAS functions of each precision run with 32-bit pivot indices
+template <typename T>
+struct hipblasSmallLuFunctions;
+
+template <>
+struct hipblasSmallLuFunctions<float>
+{
+    static constexpr auto getrfBatched        = hipblasSgetrfBatched;
+    static constexpr auto getrfStridedBatched = hipblasSgetrfStridedBatched;
+    static constexpr auto getrsBatched        = hipblasSgetrsBatched;
+    static constexpr auto getrsStridedBatched = hipblasSgetrsStridedBatched;
+    static constexpr auto getriBatched        = hipblasSgetriBatched;
+};
+
+template <>
+struct hipblasSmallLuFunctions<double>
+{
+    static constexpr auto getrfBatched        = hipblasDgetrfBatched;
+    static constexpr auto getrfStridedBatched = hipblasDgetrfStridedBatched;
+    static constexpr auto getrsBatched        = hipblasDgetrsBatched;
+    static constexpr auto getrsStridedBatched = hipblasDgetrsStridedBatched;
+    static constexpr auto getriBatched        = hipblasDgetriBatched;
+};
+
+template <>
+struct hipblasSmallLuFunctions<hipblasComplex>
+{
+    static constexpr auto getrfBatched        = hipblasCgetrfBatched;
+    static constexpr auto getrfStridedBatched = hipblasCgetrfStridedBatched;
+    static constexpr auto getrsBatched        = hipblasCgetrsBatched;
+    static constexpr auto getrsStridedBatched = hipblasCgetrsStridedBatched;
+    static constexpr auto getriBatched        = hipblasCgetriBatched;
+};
+
+template <>
+struct hipblasSmallLuFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto getrfBatched        = hipblasZgetrfBatched;
+    static constexpr auto getrfStridedBatched = hipblasZgetrfStridedBatched;
+    static constexpr auto getrsBatched        = hipblasZgetrsBatched;
+    static constexpr auto getrsStridedBatched = hipblasZgetrsStridedBatched;
+    static constexpr auto getriBatched        = hipblasZgetriBatched;
+};
+
+static bool hipblasPivotTypeValid(hipblasPivotType_t pivot_type)
+{
+    return pivot_type == HIPBLAS_PIVOT_32I || pivot_type == HIPBLAS_PIVOT_16U
+           || pivot_type == HIPBLAS_PIVOT_8U;
+}
+
+static int hipblasPivotBytes(hipblasPivotType_t pivot_type)
+{
+    return pivot_type == HIPBLAS_PIVOT_8U ? 1 : pivot_type == HIPBLAS_PIVOT_16U ? 2 : 4;
+}
+
+// Largest order whose 1-based pivot indices the type holds
+static int hipblasPivotMaxN(hipblasPivotType_t pivot_type)
+{
+    return pivot_type == HIPBLAS_PIVOT_8U    ? 255
+           : pivot_type == HIPBLAS_PIVOT_16U ? 65535
+                                             : INT_MAX;
+}
+
+// Checks the arguments of both forms, where A_array is the pointer array of the batched form and
+// null otherwise, whose pivot vectors are strideP = n apart
+template <typename T>
+static hipblasStatus_t hipblasGetrfCompactPivot(hipblasHandle_t    handle,
+                                                int                n,
+                                                T*                 A,
+                                                T* const*          A_array,
+                                                int                lda,
+                                                hipblasStride      strideA,
+                                                void*              ipiv,
+                                                hipblasPivotType_t pivot_type,
+                                                hipblasStride      strideP,
+                                                int*               info,
+                                                int                batch_count,
+                                                bool               strided)
+{
+    using F = hipblasSmallLuFunctions<T>;
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!hipblasPivotTypeValid(pivot_type))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(n < 0 || lda < std::max(1, n) || batch_count < 0 || n > hipblasPivotMaxN(pivot_type))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count && (!info || (n && ((strided ? !A : !A_array) || !ipiv))))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(pivot_type == HIPBLAS_PIVOT_32I)
+        return strided ? F::getrfStridedBatched(
+                   handle, n, A, lda, strideA, (int*)ipiv, strideP, info, batch_count)
+                       : F::getrfBatched(handle, n, A_array, lda, (int*)ipiv, info, batch_count);
+
+#ifdef HIPBLAS_SMALL_LU
+    if(!batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    const int bytes = hipblasPivotBytes(pivot_type);
+    if(n <= hipblas_small_lu_max_n)
+        return hipblasSmallGetrfKernels(
+            handle, n, A, A_array, lda, strideA, ipiv, bytes, strideP, info, batch_count);
+
+    hipblasStreamScratch scratch;
+    hipblasStatus_t      status = hipblasGetStream(handle, &scratch.stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = scratch.allocate(sizeof(int) * size_t(n) * batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    int* pivots = (int*)scratch.base;
+    if(strided)
+        status = F::getrfStridedBatched(handle, n, A, lda, strideA, pivots, n, info, batch_count);
+    else
+        status = F::getrfBatched(handle, n, A_array, lda, pivots, info, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasPivotCopyKernels(handle, n, pivots, 4, n, ipiv, bytes, strideP, batch_count);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// Checks the arguments of both forms as getrs does, with the positions of the strided batched
+// form when strided
+template <typename T>
+static hipblasStatus_t hipblasGetrsCompactPivot(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                int                n,
+                                                int                nrhs,
+                                                T*                 A,
+                                                T* const*          A_array,
+                                                int                lda,
+                                                hipblasStride      strideA,
+                                                const void*        ipiv,
+                                                hipblasPivotType_t pivot_type,
+                                                hipblasStride      strideP,
+                                                T*                 B,
+                                                T* const*          B_array,
+                                                int                ldb,
+                                                hipblasStride      strideB,
+                                                int*               info,
+                                                int                batch_count,
+                                                bool               strided)
+{
+    using F = hipblasSmallLuFunctions<T>;
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(info == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // strideA shifts the positions after lda in the strided batched form, and strideP those
+    // after pivotType
+    const int s = strided ? 1 : 0;
+    if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if((strided ? !A : !A_array) && n && batch_count)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(!ipiv && n && batch_count)
+        *info = -(6 + s);
+    else if(!hipblasPivotTypeValid(pivot_type) || n > hipblasPivotMaxN(pivot_type))
+        *info = -(7 + s);
+    else if((strided ? !B : !B_array) && n && nrhs && batch_count)
+        *info = -(8 + 2 * s);
+    else if(ldb < std::max(1, n))
+        *info = -(9 + 2 * s);
+    else if(batch_count < 0)
+        *info = strided ? -14 : -11;
+    else
+        *info = 0;
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(pivot_type == HIPBLAS_PIVOT_32I)
+        return strided ? F::getrsStridedBatched(handle,
+                                                trans,
+                                                n,
+                                                nrhs,
+                                                A,
+                                                lda,
+                                                strideA,
+                                                (const int*)ipiv,
+                                                strideP,
+                                                B,
+                                                ldb,
+                                                strideB,
+                                                info,
+                                                batch_count)
+                       : F::getrsBatched(handle,
+                                         trans,
+                                         n,
+                                         nrhs,
+                                         A_array,
+                                         lda,
+                                         (const int*)ipiv,
+                                         B_array,
+                                         ldb,
+                                         info,
+                                         batch_count);
+
+#ifdef HIPBLAS_SMALL_LU
+    if(!n || !nrhs || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    const int bytes = hipblasPivotBytes(pivot_type);
+    if(n <= hipblas_small_lu_max_n)
+        return hipblasSmallGetrsKernels(handle,
+                                        trans,
+                                        n,
+                                        nrhs,
+                                        A,
+                                        (const T* const*)A_array,
+                                        lda,
+                                        strideA,
+                                        ipiv,
+                                        bytes,
+                                        strideP,
+                                        B,
+                                        B_array,
+                                        ldb,
+                                        strideB,
+                                        batch_count);
+
+    hipblasStreamScratch scratch;
+    hipblasStatus_t      status = hipblasGetStream(handle, &scratch.stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = scratch.allocate(sizeof(int) * size_t(n) * batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasPivotCopyKernels(
+            handle, n, ipiv, bytes, strideP, (int*)scratch.base, 4, n, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return strided ? F::getrsStridedBatched(handle,
+                                            trans,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            (int*)scratch.base,
+                                            n,
+                                            B,
+                                            ldb,
+                                            strideB,
+                                            info,
+                                            batch_count)
+                   : F::getrsBatched(handle,
+                                     trans,
+                                     n,
+                                     nrhs,
+                                     A_array,
+                                     lda,
+                                     (int*)scratch.base,
+                                     B_array,
+                                     ldb,
+                                     info,
+                                     batch_count);
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// Matrices above hipblas_small_lu_max_n are copied before getrf, which overwrites its input, and
+// getri writes their inverses from the copies
+template <typename T>
+static hipblasStatus_t hipblasMatinvBatchedTemplate(hipblasHandle_t handle,
+                                                    int             n,
+                                                    const T* const* A,
+                                                    int             lda,
+                                                    T* const*       Ainv,
+                                                    int             lda_inv,
+                                                    int*            info,
+                                                    int             batch_count)
+{
+    using F = hipblasSmallLuFunctions<T>;
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || lda_inv < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(batch_count && (!info || (n && (!A || !Ainv))))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!n)
+        return hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_EXECUTION_FAILED;
+
+#ifdef HIPBLAS_SMALL_LU
+    if(n <= hipblas_small_lu_max_n)
+        return hipblasSmallMatinvKernels(handle, n, A, lda, Ainv, lda_inv, info, batch_count);
+
+    // The pointers to the copies, then the copies and their pivots
+    const size_t         copies_offset = sizeof(T*) * batch_count;
+    const size_t         pivots_offset = copies_offset + sizeof(T) * size_t(n) * n * batch_count;
+    hipblasStreamScratch scratch;
+    status = hipblasGetStream(handle, &scratch.stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = scratch.allocate(pivots_offset + sizeof(int) * size_t(n) * batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    T**  copies = (T**)scratch.base;
+    int* pivots = (int*)(scratch.base + pivots_offset);
+
+    status = hipblasMatinvStageKernels(
+        handle, n, A, lda, (T*)(scratch.base + copies_offset), copies, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = F::getrfBatched(handle, n, copies, n, pivots, info, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = F::getriBatched(handle, n, copies, n, pivots, Ainv, lda_inv, info, batch_count);
+    return status;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasSgetrfBatchedCompactPivot(hipblasHandle_t          handle,
+                                                            const int                n,
+                                                            float* const             A[],
+                                                            const int                lda,
+                                                            void*                    ipiv,
+                                                            const hipblasPivotType_t pivotType,
+                                                            int*                     info,
+                                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, ipiv, pivotType, info, batchCount);
+    return hipblasGetrfCompactPivot<float>(
+        handle, n, nullptr, A, lda, 0, ipiv, pivotType, n, info, batchCount, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgetrfBatchedCompactPivot(hipblasHandle_t          handle,
+                                                            const int                n,
+                                                            double* const            A[],
+                                                            const int                lda,
+                                                            void*                    ipiv,
+                                                            const hipblasPivotType_t pivotType,
+                                                            int*                     info,
+                                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, ipiv, pivotType, info, batchCount);
+    return hipblasGetrfCompactPivot<double>(
+        handle, n, nullptr, A, lda, 0, ipiv, pivotType, n, info, batchCount, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgetrfBatchedCompactPivot(hipblasHandle_t          handle,
+                                                            const int                n,
+                                                            hipblasComplex* const    A[],
+                                                            const int                lda,
+                                                            void*                    ipiv,
+                                                            const hipblasPivotType_t pivotType,
+                                                            int*                     info,
+                                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, ipiv, pivotType, info, batchCount);
+    return hipblasGetrfCompactPivot<hipblasComplex>(
+        handle, n, nullptr, A, lda, 0, ipiv, pivotType, n, info, batchCount, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgetrfBatchedCompactPivot(hipblasHandle_t             handle,
+                                                            const int                   n,
+                                                            hipblasDoubleComplex* const A[],
+                                                            const int                   lda,
+                                                            void*                       ipiv,
+                                                            const hipblasPivotType_t    pivotType,
+                                                            int*                        info,
+                                                            const int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, ipiv, pivotType, info, batchCount);
+    return hipblasGetrfCompactPivot<hipblasDoubleComplex>(
+        handle, n, nullptr, A, lda, 0, ipiv, pivotType, n, info, batchCount, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasSgetrfStridedBatchedCompactPivot(hipblasHandle_t          handle,
+                                            const int                n,
+                                            float*                   A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            void*                    ipiv,
+                                            const hipblasPivotType_t pivotType,
+                                            const hipblasStride      strideP,
+                                            int*                     info,
+                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, strideA, ipiv, pivotType, strideP, info, batchCount);
+    return hipblasGetrfCompactPivot<float>(
+        handle, n, A, nullptr, lda, strideA, ipiv, pivotType, strideP, info, batchCount, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasDgetrfStridedBatchedCompactPivot(hipblasHandle_t          handle,
+                                            const int                n,
+                                            double*                  A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            void*                    ipiv,
+                                            const hipblasPivotType_t pivotType,
+                                            const hipblasStride      strideP,
+                                            int*                     info,
+                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, strideA, ipiv, pivotType, strideP, info, batchCount);
+    return hipblasGetrfCompactPivot<double>(
+        handle, n, A, nullptr, lda, strideA, ipiv, pivotType, strideP, info, batchCount, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasCgetrfStridedBatchedCompactPivot(hipblasHandle_t          handle,
+                                            const int                n,
+                                            hipblasComplex*          A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            void*                    ipiv,
+                                            const hipblasPivotType_t pivotType,
+                                            const hipblasStride      strideP,
+                                            int*                     info,
+                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, strideA, ipiv, pivotType, strideP, info, batchCount);
+    return hipblasGetrfCompactPivot<hipblasComplex>(
+        handle, n, A, nullptr, lda, strideA, ipiv, pivotType, strideP, info, batchCount, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasZgetrfStridedBatchedCompactPivot(hipblasHandle_t          handle,
+                                            const int                n,
+                                            hipblasDoubleComplex*    A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            void*                    ipiv,
+                                            const hipblasPivotType_t pivotType,
+                                            const hipblasStride      strideP,
+                                            int*                     info,
+                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, strideA, ipiv, pivotType, strideP, info, batchCount);
+    return hipblasGetrfCompactPivot<hipblasDoubleComplex>(
+        handle, n, A, nullptr, lda, strideA, ipiv, pivotType, strideP, info, batchCount, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgetrsBatchedCompactPivot(hipblasHandle_t          handle,
+                                                            const hipblasOperation_t trans,
+                                                            const int                n,
+                                                            const int                nrhs,
+                                                            float* const             A[],
+                                                            const int                lda,
+                                                            const void*              ipiv,
+                                                            const hipblasPivotType_t pivotType,
+                                                            float* const             B[],
+                                                            const int                ldb,
+                                                            int*                     info,
+                                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, trans, n, nrhs, A, lda, ipiv, pivotType, B, ldb, info, batchCount);
+    return hipblasGetrsCompactPivot<float>(handle,
+                                           trans,
+                                           n,
+                                           nrhs,
+                                           nullptr,
+                                           A,
+                                           lda,
+                                           0,
+                                           ipiv,
+                                           pivotType,
+                                           n,
+                                           nullptr,
+                                           B,
+                                           ldb,
+                                           0,
+                                           info,
+                                           batchCount,
+                                           false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgetrsBatchedCompactPivot(hipblasHandle_t          handle,
+                                                            const hipblasOperation_t trans,
+                                                            const int                n,
+                                                            const int                nrhs,
+                                                            double* const            A[],
+                                                            const int                lda,
+                                                            const void*              ipiv,
+                                                            const hipblasPivotType_t pivotType,
+                                                            double* const            B[],
+                                                            const int                ldb,
+                                                            int*                     info,
+                                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, trans, n, nrhs, A, lda, ipiv, pivotType, B, ldb, info, batchCount);
+    return hipblasGetrsCompactPivot<double>(handle,
+                                            trans,
+                                            n,
+                                            nrhs,
+                                            nullptr,
+                                            A,
+                                            lda,
+                                            0,
+                                            ipiv,
+                                            pivotType,
+                                            n,
+                                            nullptr,
+                                            B,
+                                            ldb,
+                                            0,
+                                            info,
+                                            batchCount,
+                                            false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgetrsBatchedCompactPivot(hipblasHandle_t          handle,
+                                                            const hipblasOperation_t trans,
+                                                            const int                n,
+                                                            const int                nrhs,
+                                                            hipblasComplex* const    A[],
+                                                            const int                lda,
+                                                            const void*              ipiv,
+                                                            const hipblasPivotType_t pivotType,
+                                                            hipblasComplex* const    B[],
+                                                            const int                ldb,
+                                                            int*                     info,
+                                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, trans, n, nrhs, A, lda, ipiv, pivotType, B, ldb, info, batchCount);
+    return hipblasGetrsCompactPivot<hipblasComplex>(handle,
+                                                    trans,
+                                                    n,
+                                                    nrhs,
+                                                    nullptr,
+                                                    A,
+                                                    lda,
+                                                    0,
+                                                    ipiv,
+                                                    pivotType,
+                                                    n,
+                                                    nullptr,
+                                                    B,
+                                                    ldb,
+                                                    0,
+                                                    info,
+                                                    batchCount,
+                                                    false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgetrsBatchedCompactPivot(hipblasHandle_t             handle,
+                                                            const hipblasOperation_t    trans,
+                                                            const int                   n,
+                                                            const int                   nrhs,
+                                                            hipblasDoubleComplex* const A[],
+                                                            const int                   lda,
+                                                            const void*                 ipiv,
+                                                            const hipblasPivotType_t    pivotType,
+                                                            hipblasDoubleComplex* const B[],
+                                                            const int                   ldb,
+                                                            int*                        info,
+                                                            const int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, trans, n, nrhs, A, lda, ipiv, pivotType, B, ldb, info, batchCount);
+    return hipblasGetrsCompactPivot<hipblasDoubleComplex>(handle,
+                                                          trans,
+                                                          n,
+                                                          nrhs,
+                                                          nullptr,
+                                                          A,
+                                                          lda,
+                                                          0,
+                                                          ipiv,
+                                                          pivotType,
+                                                          n,
+                                                          nullptr,
+                                                          B,
+                                                          ldb,
+                                                          0,
+                                                          info,
+                                                          batchCount,
+                                                          false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasSgetrsStridedBatchedCompactPivot(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            float*                   A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const void*              ipiv,
+                                            const hipblasPivotType_t pivotType,
+                                            const hipblasStride      strideP,
+                                            float*                   B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  trans,
+                  n,
+                  nrhs,
+                  A,
+                  lda,
+                  strideA,
+                  ipiv,
+                  pivotType,
+                  strideP,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    return hipblasGetrsCompactPivot<float>(handle,
+                                           trans,
+                                           n,
+                                           nrhs,
+                                           A,
+                                           nullptr,
+                                           lda,
+                                           strideA,
+                                           ipiv,
+                                           pivotType,
+                                           strideP,
+                                           B,
+                                           nullptr,
+                                           ldb,
+                                           strideB,
+                                           info,
+                                           batchCount,
+                                           true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasDgetrsStridedBatchedCompactPivot(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            double*                  A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const void*              ipiv,
+                                            const hipblasPivotType_t pivotType,
+                                            const hipblasStride      strideP,
+                                            double*                  B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  trans,
+                  n,
+                  nrhs,
+                  A,
+                  lda,
+                  strideA,
+                  ipiv,
+                  pivotType,
+                  strideP,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    return hipblasGetrsCompactPivot<double>(handle,
+                                            trans,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            nullptr,
+                                            lda,
+                                            strideA,
+                                            ipiv,
+                                            pivotType,
+                                            strideP,
+                                            B,
+                                            nullptr,
+                                            ldb,
+                                            strideB,
+                                            info,
+                                            batchCount,
+                                            true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasCgetrsStridedBatchedCompactPivot(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            hipblasComplex*          A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const void*              ipiv,
+                                            const hipblasPivotType_t pivotType,
+                                            const hipblasStride      strideP,
+                                            hipblasComplex*          B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  trans,
+                  n,
+                  nrhs,
+                  A,
+                  lda,
+                  strideA,
+                  ipiv,
+                  pivotType,
+                  strideP,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    return hipblasGetrsCompactPivot<hipblasComplex>(handle,
+                                                    trans,
+                                                    n,
+                                                    nrhs,
+                                                    A,
+                                                    nullptr,
+                                                    lda,
+                                                    strideA,
+                                                    ipiv,
+                                                    pivotType,
+                                                    strideP,
+                                                    B,
+                                                    nullptr,
+                                                    ldb,
+                                                    strideB,
+                                                    info,
+                                                    batchCount,
+                                                    true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasZgetrsStridedBatchedCompactPivot(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            hipblasDoubleComplex*    A,
+                                            const int                lda,
+                                            const hipblasStride      strideA,
+                                            const void*              ipiv,
+                                            const hipblasPivotType_t pivotType,
+                                            const hipblasStride      strideP,
+                                            hipblasDoubleComplex*    B,
+                                            const int                ldb,
+                                            const hipblasStride      strideB,
+                                            int*                     info,
+                                            const int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle,
+                  trans,
+                  n,
+                  nrhs,
+                  A,
+                  lda,
+                  strideA,
+                  ipiv,
+                  pivotType,
+                  strideP,
+                  B,
+                  ldb,
+                  strideB,
+                  info,
+                  batchCount);
+    return hipblasGetrsCompactPivot<hipblasDoubleComplex>(handle,
+                                                          trans,
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          nullptr,
+                                                          lda,
+                                                          strideA,
+                                                          ipiv,
+                                                          pivotType,
+                                                          strideP,
+                                                          B,
+                                                          nullptr,
+                                                          ldb,
+                                                          strideB,
+                                                          info,
+                                                          batchCount,
+                                                          true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasMatinvBatched(hipblasHandle_t     handle,
+                                     int                 n,
+                                     const float* const* A,
+                                     int                 lda,
+                                     float* const*       Ainv,
+                                     int                 lda_inv,
+                                     int*                info,
+                                     int                 batch_count)
+{
+    // Only the info of the inversion is summarized, not that of the getrf and getri making it up
+    hipblasInfoSummarySuspend suspend;
+    return hipblasMatinvBatchedTemplate(handle, n, A, lda, Ainv, lda_inv, info, batch_count);
+}
+
+hipblasStatus_t hipblasMatinvBatched(hipblasHandle_t      handle,
+                                     int                  n,
+                                     const double* const* A,
+                                     int                  lda,
+                                     double* const*       Ainv,
+                                     int                  lda_inv,
+                                     int*                 info,
+                                     int                  batch_count)
+{
+    // Only the info of the inversion is summarized, not that of the getrf and getri making it up
+    hipblasInfoSummarySuspend suspend;
+    return hipblasMatinvBatchedTemplate(handle, n, A, lda, Ainv, lda_inv, info, batch_count);
+}
+
+hipblasStatus_t hipblasMatinvBatched(hipblasHandle_t              handle,
+                                     int                          n,
+                                     const hipblasComplex* const* A,
+                                     int                          lda,
+                                     hipblasComplex* const*       Ainv,
+                                     int                          lda_inv,
+                                     int*                         info,
+                                     int                          batch_count)
+{
+    // Only the info of the inversion is summarized, not that of the getrf and getri making it up
+    hipblasInfoSummarySuspend suspend;
+    return hipblasMatinvBatchedTemplate(handle, n, A, lda, Ainv, lda_inv, info, batch_count);
+}
+
+hipblasStatus_t hipblasMatinvBatched(hipblasHandle_t                    handle,
+                                     int                                n,
+                                     const hipblasDoubleComplex* const* A,
+                                     int                                lda,
+                                     hipblasDoubleComplex* const*       Ainv,
+                                     int                                lda_inv,
+                                     int*                               info,
+                                     int                                batch_count)
+{
+    // Only the info of the inversion is summarized, not that of the getrf and getri making it up
+    hipblasInfoSummarySuspend suspend;
+    return hipblasMatinvBatchedTemplate(handle, n, A, lda, Ainv, lda_inv, info, batch_count);
+}
+
+#endif
@@ -0,0 +1,997 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "small_lu.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <hip/hip_runtime.h>
+
+// Threads of a work group: one per row of the matrix in the factorization, and one per column of
+// the right-hand sides in the solve
+constexpr int small_lu_threads = hipblas_small_lu_max_n;
+
+// Leading dimension of a matrix in local memory, padded against bank conflicts on its rows
+constexpr int small_lu_ld = hipblas_small_lu_max_n + 1;
+
+// Largest grid. The work groups loop over the remaining matrices.
+constexpr int small_lu_max_grid = 65535;
+
+// The complex types are only read and written, so both layouts of hipblasComplex map to this
+template <typename R>
+struct hipblasSmallLuComplex
+{
+    R x, y;
+
+    __device__ hipblasSmallLuComplex(R re = 0, R im = 0)
+        : x(re)
+        , y(im)
+    {
+    }
+};
+
+template <typename R>
+__device__ inline hipblasSmallLuComplex<R> operator-(hipblasSmallLuComplex<R> a,
+                                                     hipblasSmallLuComplex<R> b)
+{
+    return {a.x - b.x, a.y - b.y};
+}
+
+template <typename R>
+__device__ inline hipblasSmallLuComplex<R> operator*(hipblasSmallLuComplex<R> a,
+                                                     hipblasSmallLuComplex<R> b)
+{
+    return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x};
+}
+
+template <typename R>
+__device__ inline hipblasSmallLuComplex<R> operator/(hipblasSmallLuComplex<R> a,
+                                                     hipblasSmallLuComplex<R> b)
+{
+    R den = b.x * b.x + b.y * b.y;
+    return {(a.x * b.x + a.y * b.y) / den, (a.y * b.x - a.x * b.y) / den};
+}
+
+// The magnitude LAPACK i?amax compares pivots by, |re| + |im| for a complex value
+template <typename R>
+__device__ inline R hipblasSmallLuAbs1(R a)
+{
+    return a < 0 ? -a : a;
+}
+
+template <typename R>
+__device__ inline R hipblasSmallLuAbs1(hipblasSmallLuComplex<R> a)
+{
+    return hipblasSmallLuAbs1(a.x) + hipblasSmallLuAbs1(a.y);
+}
+
+template <typename R>
+__device__ inline R hipblasSmallLuConj(R a, bool)
+{
+    return a;
+}
+
+template <typename R>
+__device__ inline hipblasSmallLuComplex<R> hipblasSmallLuConj(hipblasSmallLuComplex<R> a,
+                                                              bool                     conj)
+{
+    return {a.x, conj ? -a.y : a.y};
+}
+
+// Local memory of a work group holding count values of T, which may not have a trivial
+// constructor, so it is declared as doubles
+#define HIPBLAS_SMALL_LU_LOCAL(T, name, count)                       \
+    __shared__ double name##_storage[(sizeof(T) * (count) + 7) / 8]; \
+    T*                name = (T*)name##_storage;
+
+template <typename T, typename P>
+__global__ void __launch_bounds__(small_lu_threads)
+    hipblasSmallGetrfKernel(int           n,
+                            T*            A,
+                            T* const*     A_array,
+                            int           lda,
+                            hipblasStride strideA,
+                            P*            ipiv,
+                            hipblasStride strideP,
+                            int*          info,
+                            int           batch_count)
+{
+    HIPBLAS_SMALL_LU_LOCAL(T, sA, small_lu_ld * hipblas_small_lu_max_n)
+    __shared__ int pivot;
+
+    const int t = threadIdx.x;
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        T* Ab = A_array ? A_array[b] : A + b * strideA;
+        P* pb = ipiv + b * strideP;
+
+        if(t < n)
+            for(int k = 0; k < n; k++)
+                sA[t + k * small_lu_ld] = Ab[t + size_t(k) * lda];
+        __syncthreads();
+
+        // Right-looking elimination as LAPACK ?getf2, thread t updating row t. A zero pivot is
+        // recorded and its column is left unscaled, and the factorization goes on.
+        int first_zero = 0;
+        for(int j = 0; j < n; j++)
+        {
+            if(t == 0)
+            {
+                int  p    = j;
+                auto best = hipblasSmallLuAbs1(sA[j + j * small_lu_ld]);
+                for(int i = j + 1; i < n; i++)
+                {
+                    auto v = hipblasSmallLuAbs1(sA[i + j * small_lu_ld]);
+                    if(v > best)
+                    {
+                        best = v;
+                        p    = i;
+                    }
+                }
+                pivot = p;
+                pb[j] = P(p + 1);
+                if(best == 0 && !first_zero)
+                    first_zero = j + 1;
+            }
+            __syncthreads();
+
+            int p = pivot;
+            if(p != j && t < n)
+            {
+                T swap                  = sA[j + t * small_lu_ld];
+                sA[j + t * small_lu_ld] = sA[p + t * small_lu_ld];
+                sA[p + t * small_lu_ld] = swap;
+            }
+            __syncthreads();
+
+            T d = sA[j + j * small_lu_ld];
+            if(hipblasSmallLuAbs1(d) != 0 && t > j && t < n)
+            {
+                T l                     = sA[t + j * small_lu_ld] / d;
+                sA[t + j * small_lu_ld] = l;
+                for(int k = j + 1; k < n; k++)
+                    sA[t + k * small_lu_ld]
+                        = sA[t + k * small_lu_ld] - l * sA[j + k * small_lu_ld];
+            }
+            __syncthreads();
+        }
+
+        if(t < n)
+            for(int k = 0; k < n; k++)
+                Ab[t + size_t(k) * lda] = sA[t + k * small_lu_ld];
+        if(t == 0)
+            info[b] = first_zero;
+        __syncthreads();
+    }
+}
+
+// Solves with small_lu_threads right-hand sides at a time, held in local memory by row, so that
+// thread t reads and writes column t without bank conflicts
+template <typename T, typename P>
+__global__ void __launch_bounds__(small_lu_threads)
+    hipblasSmallGetrsKernel(bool            trans,
+                            bool            conj,
+                            int             n,
+                            int             nrhs,
+                            const T*        A,
+                            const T* const* A_array,
+                            int             lda,
+                            hipblasStride   strideA,
+                            const P*        ipiv,
+                            hipblasStride   strideP,
+                            T*              B,
+                            T* const*       B_array,
+                            int             ldb,
+                            hipblasStride   strideB,
+                            int             batch_count)
+{
+    HIPBLAS_SMALL_LU_LOCAL(T, sA, small_lu_ld * hipblas_small_lu_max_n)
+    HIPBLAS_SMALL_LU_LOCAL(T, sB, small_lu_threads * hipblas_small_lu_max_n)
+    __shared__ int sP[hipblas_small_lu_max_n];
+
+    const int t = threadIdx.x;
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        const T* Ab = A_array ? A_array[b] : A + b * strideA;
+        T*       Bb = B_array ? B_array[b] : B + b * strideB;
+        const P* pb = ipiv + b * strideP;
+
+        for(int e = t; e < n * n; e += small_lu_threads)
+            sA[e % n + e / n * small_lu_ld] = Ab[e % n + size_t(e / n) * lda];
+        if(t < n)
+            sP[t] = int(pb[t]) - 1;
+
+        for(int c0 = 0; c0 < nrhs; c0 += small_lu_threads)
+        {
+            const int cols = nrhs - c0 < small_lu_threads ? nrhs - c0 : small_lu_threads;
+            for(int e = t; e < n * cols; e += small_lu_threads)
+                sB[e % n * small_lu_threads + e / n] = Bb[e % n + size_t(c0 + e / n) * ldb];
+            __syncthreads();
+
+            if(t < cols)
+            {
+                // X(i) is row i of the column, and L(i, j) the factor in row i and column j, of L
+                // below the diagonal and U on and above it
+                T*   x = sB + t;
+                auto X = [&](int i) -> T& { return x[i * small_lu_threads]; };
+                auto L = [&](int i, int j) { return sA[i + j * small_lu_ld]; };
+                if(!trans)
+                {
+                    // A = P L U, so x = U^-1 L^-1 P^T b
+                    for(int j = 0; j < n; j++)
+                        if(sP[j] != j)
+                        {
+                            T swap   = X(j);
+                            X(j)     = X(sP[j]);
+                            X(sP[j]) = swap;
+                        }
+                    for(int j = 0; j < n; j++)
+                        for(int i = j + 1; i < n; i++)
+                            X(i) = X(i) - L(i, j) * X(j);
+                    for(int j = n - 1; j >= 0; j--)
+                    {
+                        X(j) = X(j) / L(j, j);
+                        for(int i = 0; i < j; i++)
+                            X(i) = X(i) - L(i, j) * X(j);
+                    }
+                }
+                else
+                {
+                    // op(A) = op(U) op(L) P^T, so x = P op(L)^-1 op(U)^-1 b
+                    for(int j = 0; j < n; j++)
+                    {
+                        T s = X(j);
+                        for(int i = 0; i < j; i++)
+                            s = s - hipblasSmallLuConj(L(i, j), conj) * X(i);
+                        X(j) = s / hipblasSmallLuConj(L(j, j), conj);
+                    }
+                    for(int j = n - 1; j >= 0; j--)
+                    {
+                        T s = X(j);
+                        for(int i = j + 1; i < n; i++)
+                            s = s - hipblasSmallLuConj(L(i, j), conj) * X(i);
+                        X(j) = s;
+                    }
+                    for(int j = n - 1; j >= 0; j--)
+                        if(sP[j] != j)
+                        {
+                            T swap   = X(j);
+                            X(j)     = X(sP[j]);
+                            X(sP[j]) = swap;
+                        }
+                }
+            }
+            __syncthreads();
+
+            for(int e = t; e < n * cols; e += small_lu_threads)
+                Bb[e % n + size_t(c0 + e / n) * ldb] = sB[e % n * small_lu_threads + e / n];
+            __syncthreads();
+        }
+        __syncthreads();
+    }
+}
+
+template <typename S, typename D>
+__global__ void hipblasPivotCopyKernel(
+    int n, const S* src, hipblasStride strideS, D* dst, hipblasStride strideD, size_t count)
+{
+    for(size_t e = blockIdx.x * size_t(blockDim.x) + threadIdx.x; e < count;
+        e += size_t(gridDim.x) * blockDim.x)
+    {
+        size_t b = e / n, j = e % n;
+        dst[b * strideD + j] = D(src[b * strideS + j]);
+    }
+}
+
+template <typename T, typename Th>
+static hipblasStatus_t hipblasSmallGetrfLaunch(hipblasHandle_t handle,
+                                               int             n,
+                                               Th*             A,
+                                               Th* const*      A_array,
+                                               int             lda,
+                                               hipblasStride   strideA,
+                                               void*           ipiv,
+                                               int             pivot_bytes,
+                                               hipblasStride   strideP,
+                                               int*            info,
+                                               int             batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    dim3 grid(std::min(batch_count, small_lu_max_grid)), threads(small_lu_threads);
+    if(pivot_bytes == 1)
+        hipLaunchKernelGGL((hipblasSmallGetrfKernel<T, uint8_t>),
+                           grid,
+                           threads,
+                           0,
+                           stream,
+                           n,
+                           (T*)A,
+                           (T* const*)A_array,
+                           lda,
+                           strideA,
+                           (uint8_t*)ipiv,
+                           strideP,
+                           info,
+                           batch_count);
+    else if(pivot_bytes == 2)
+        hipLaunchKernelGGL((hipblasSmallGetrfKernel<T, uint16_t>),
+                           grid,
+                           threads,
+                           0,
+                           stream,
+                           n,
+                           (T*)A,
+                           (T* const*)A_array,
+                           lda,
+                           strideA,
+                           (uint16_t*)ipiv,
+                           strideP,
+                           info,
+                           batch_count);
+    else
+        hipLaunchKernelGGL((hipblasSmallGetrfKernel<T, int>),
+                           grid,
+                           threads,
+                           0,
+                           stream,
+                           n,
+                           (T*)A,
+                           (T* const*)A_array,
+                           lda,
+                           strideA,
+                           (int*)ipiv,
+                           strideP,
+                           info,
+                           batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+template <typename T, typename P, typename Th>
+static void hipblasSmallGetrsLaunchPivot(hipStream_t        stream,
+                                         hipblasOperation_t trans,
+                                         int                n,
+                                         int                nrhs,
+                                         const Th*          A,
+                                         const Th* const*   A_array,
+                                         int                lda,
+                                         hipblasStride      strideA,
+                                         const void*        ipiv,
+                                         hipblasStride      strideP,
+                                         Th*                B,
+                                         Th* const*         B_array,
+                                         int                ldb,
+                                         hipblasStride      strideB,
+                                         int                batch_count)
+{
+    hipLaunchKernelGGL((hipblasSmallGetrsKernel<T, P>),
+                       dim3(std::min(batch_count, small_lu_max_grid)),
+                       dim3(small_lu_threads),
+                       0,
+                       stream,
+                       trans != HIPBLAS_OP_N,
+                       trans == HIPBLAS_OP_C,
+                       n,
+                       nrhs,
+                       (const T*)A,
+                       (const T* const*)A_array,
+                       lda,
+                       strideA,
+                       (const P*)ipiv,
+                       strideP,
+                       (T*)B,
+                       (T* const*)B_array,
+                       ldb,
+                       strideB,
+                       batch_count);
+}
+
+template <typename T, typename Th>
+static hipblasStatus_t hipblasSmallGetrsLaunch(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                n,
+                                               int                nrhs,
+                                               const Th*          A,
+                                               const Th* const*   A_array,
+                                               int                lda,
+                                               hipblasStride      strideA,
+                                               const void*        ipiv,
+                                               int                pivot_bytes,
+                                               hipblasStride      strideP,
+                                               Th*                B,
+                                               Th* const*         B_array,
+                                               int                ldb,
+                                               hipblasStride      strideB,
+                                               int                batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    auto launch = pivot_bytes == 1   ? hipblasSmallGetrsLaunchPivot<T, uint8_t, Th>
+                  : pivot_bytes == 2 ? hipblasSmallGetrsLaunchPivot<T, uint16_t, Th>
+                                     : hipblasSmallGetrsLaunchPivot<T, int, Th>;
+    launch(stream,
+           trans,
+           n,
+           nrhs,
+           A,
+           A_array,
+           lda,
+           strideA,
+           ipiv,
+           strideP,
+           B,
+           B_array,
+           ldb,
+           strideB,
+           batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+template <typename S, typename D>
+static void hipblasPivotCopyLaunch(hipStream_t   stream,
+                                   int           n,
+                                   const void*   src,
+                                   hipblasStride strideS,
+                                   void*         dst,
+                                   hipblasStride strideD,
+                                   int           batch_count)
+{
+    constexpr int threads = 256;
+    size_t        count   = size_t(n) * batch_count;
+    size_t        blocks  = std::min((count + threads - 1) / threads, size_t(small_lu_max_grid));
+    hipLaunchKernelGGL((hipblasPivotCopyKernel<S, D>),
+                       dim3(blocks),
+                       dim3(threads),
+                       0,
+                       stream,
+                       n,
+                       (const S*)src,
+                       strideS,
+                       (D*)dst,
+                       strideD,
+                       count);
+}
+
+hipblasStatus_t hipblasPivotCopyKernels(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     src,
+                                        int             src_bytes,
+                                        hipblasStride   strideS,
+                                        void*           dst,
+                                        int             dst_bytes,
+                                        hipblasStride   strideD,
+                                        int             batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // One side is always the 32-bit pivots of the backend
+    if(src_bytes == 4 && dst_bytes == 1)
+        hipblasPivotCopyLaunch<int, uint8_t>(stream, n, src, strideS, dst, strideD, batch_count);
+    else if(src_bytes == 4 && dst_bytes == 2)
+        hipblasPivotCopyLaunch<int, uint16_t>(stream, n, src, strideS, dst, strideD, batch_count);
+    else if(src_bytes == 1 && dst_bytes == 4)
+        hipblasPivotCopyLaunch<uint8_t, int>(stream, n, src, strideS, dst, strideD, batch_count);
+    else if(src_bytes == 2 && dst_bytes == 4)
+        hipblasPivotCopyLaunch<uint16_t, int>(stream, n, src, strideS, dst, strideD, batch_count);
+    else
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasSmallGetrfKernels(hipblasHandle_t handle,
+                                         int             n,
+                                         float*          A,
+                                         float* const*   A_array,
+                                         int             lda,
+                                         hipblasStride   strideA,
+                                         void*           ipiv,
+                                         int             pivot_bytes,
+                                         hipblasStride   strideP,
+                                         int*            info,
+                                         int             batch_count)
+{
+    return hipblasSmallGetrfLaunch<float>(
+        handle, n, A, A_array, lda, strideA, ipiv, pivot_bytes, strideP, info, batch_count);
+}
+
+hipblasStatus_t hipblasSmallGetrfKernels(hipblasHandle_t handle,
+                                         int             n,
+                                         double*         A,
+                                         double* const*  A_array,
+                                         int             lda,
+                                         hipblasStride   strideA,
+                                         void*           ipiv,
+                                         int             pivot_bytes,
+                                         hipblasStride   strideP,
+                                         int*            info,
+                                         int             batch_count)
+{
+    return hipblasSmallGetrfLaunch<double>(
+        handle, n, A, A_array, lda, strideA, ipiv, pivot_bytes, strideP, info, batch_count);
+}
+
+hipblasStatus_t hipblasSmallGetrfKernels(hipblasHandle_t        handle,
+                                         int                    n,
+                                         hipblasComplex*        A,
+                                         hipblasComplex* const* A_array,
+                                         int                    lda,
+                                         hipblasStride          strideA,
+                                         void*                  ipiv,
+                                         int                    pivot_bytes,
+                                         hipblasStride          strideP,
+                                         int*                   info,
+                                         int                    batch_count)
+{
+    return hipblasSmallGetrfLaunch<hipblasSmallLuComplex<float>>(
+        handle, n, A, A_array, lda, strideA, ipiv, pivot_bytes, strideP, info, batch_count);
+}
+
+hipblasStatus_t hipblasSmallGetrfKernels(hipblasHandle_t              handle,
+                                         int                          n,
+                                         hipblasDoubleComplex*        A,
+                                         hipblasDoubleComplex* const* A_array,
+                                         int                          lda,
+                                         hipblasStride                strideA,
+                                         void*                        ipiv,
+                                         int                          pivot_bytes,
+                                         hipblasStride                strideP,
+                                         int*                         info,
+                                         int                          batch_count)
+{
+    return hipblasSmallGetrfLaunch<hipblasSmallLuComplex<double>>(
+        handle, n, A, A_array, lda, strideA, ipiv, pivot_bytes, strideP, info, batch_count);
+}
+
+hipblasStatus_t hipblasSmallGetrsKernels(hipblasHandle_t     handle,
+                                         hipblasOperation_t  trans,
+                                         int                 n,
+                                         int                 nrhs,
+                                         const float*        A,
+                                         const float* const* A_array,
+                                         int                 lda,
+                                         hipblasStride       strideA,
+                                         const void*         ipiv,
+                                         int                 pivot_bytes,
+                                         hipblasStride       strideP,
+                                         float*              B,
+                                         float* const*       B_array,
+                                         int                 ldb,
+                                         hipblasStride       strideB,
+                                         int                 batch_count)
+{
+    return hipblasSmallGetrsLaunch<float>(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          A,
+                                          A_array,
+                                          lda,
+                                          strideA,
+                                          ipiv,
+                                          pivot_bytes,
+                                          strideP,
+                                          B,
+                                          B_array,
+                                          ldb,
+                                          strideB,
+                                          batch_count);
+}
+
+hipblasStatus_t hipblasSmallGetrsKernels(hipblasHandle_t      handle,
+                                         hipblasOperation_t   trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         const double*        A,
+                                         const double* const* A_array,
+                                         int                  lda,
+                                         hipblasStride        strideA,
+                                         const void*          ipiv,
+                                         int                  pivot_bytes,
+                                         hipblasStride        strideP,
+                                         double*              B,
+                                         double* const*       B_array,
+                                         int                  ldb,
+                                         hipblasStride        strideB,
+                                         int                  batch_count)
+{
+    return hipblasSmallGetrsLaunch<double>(handle,
+                                           trans,
+                                           n,
+                                           nrhs,
+                                           A,
+                                           A_array,
+                                           lda,
+                                           strideA,
+                                           ipiv,
+                                           pivot_bytes,
+                                           strideP,
+                                           B,
+                                           B_array,
+                                           ldb,
+                                           strideB,
+                                           batch_count);
+}
+
+hipblasStatus_t hipblasSmallGetrsKernels(hipblasHandle_t              handle,
+                                         hipblasOperation_t           trans,
+                                         int                          n,
+                                         int                          nrhs,
+                                         const hipblasComplex*        A,
+                                         const hipblasComplex* const* A_array,
+                                         int                          lda,
+                                         hipblasStride                strideA,
+                                         const void*                  ipiv,
+                                         int                          pivot_bytes,
+                                         hipblasStride                strideP,
+                                         hipblasComplex*              B,
+                                         hipblasComplex* const*       B_array,
+                                         int                          ldb,
+                                         hipblasStride                strideB,
+                                         int                          batch_count)
+{
+    return hipblasSmallGetrsLaunch<hipblasSmallLuComplex<float>>(handle,
+                                                                 trans,
+                                                                 n,
+                                                                 nrhs,
+                                                                 A,
+                                                                 A_array,
+                                                                 lda,
+                                                                 strideA,
+                                                                 ipiv,
+                                                                 pivot_bytes,
+                                                                 strideP,
+                                                                 B,
+                                                                 B_array,
+                                                                 ldb,
+                                                                 strideB,
+                                                                 batch_count);
+}
+
+hipblasStatus_t hipblasSmallGetrsKernels(hipblasHandle_t                    handle,
+                                         hipblasOperation_t                 trans,
+                                         int                                n,
+                                         int                                nrhs,
+                                         const hipblasDoubleComplex*        A,
+                                         const hipblasDoubleComplex* const* A_array,
+                                         int                                lda,
+                                         hipblasStride                      strideA,
+                                         const void*                        ipiv,
+                                         int                                pivot_bytes,
+                                         hipblasStride                      strideP,
+                                         hipblasDoubleComplex*              B,
+                                         hipblasDoubleComplex* const*       B_array,
+                                         int                                ldb,
+                                         hipblasStride                      strideB,
+                                         int                                batch_count)
+{
+    return hipblasSmallGetrsLaunch<hipblasSmallLuComplex<double>>(handle,
+                                                                  trans,
+                                                                  n,
+                                                                  nrhs,
+                                                                  A,
+                                                                  A_array,
+                                                                  lda,
+                                                                  strideA,
+                                                                  ipiv,
+                                                                  pivot_bytes,
+                                                                  strideP,
+                                                                  B,
+                                                                  B_array,
+                                                                  ldb,
+                                                                  strideB,
+                                                                  batch_count);
+}
+
+// Gauss-Jordan inversion with partial pivoting as the Numerical Recipes gaussj, with row
+// interchanges only. Thread t holds row t and then column t of the matrix in local memory. The
+// inverse of P A is formed in place, and its columns are swapped back in reverse order of the
+// interchanges at the end, giving A^-1.
+template <typename T>
+__global__ void __launch_bounds__(small_lu_threads)
+    hipblasSmallMatinvKernel(int             n,
+                             const T* const* A_array,
+                             int             lda,
+                             T* const*       Ainv_array,
+                             int             lda_inv,
+                             int*            info,
+                             int             batch_count)
+{
+    HIPBLAS_SMALL_LU_LOCAL(T, sA, small_lu_ld * hipblas_small_lu_max_n)
+    __shared__ int sP[hipblas_small_lu_max_n];
+    __shared__ int first_zero;
+
+    const int t = threadIdx.x;
+    for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+    {
+        const T* Ab    = A_array[b];
+        T*       Ainvb = Ainv_array[b];
+
+        if(t < n)
+            for(int k = 0; k < n; k++)
+                sA[t + k * small_lu_ld] = Ab[t + size_t(k) * lda];
+        if(t == 0)
+            first_zero = 0;
+        __syncthreads();
+
+        for(int j = 0; j < n; j++)
+        {
+            if(t == 0)
+            {
+                int  p    = j;
+                auto best = hipblasSmallLuAbs1(sA[j + j * small_lu_ld]);
+                for(int i = j + 1; i < n; i++)
+                {
+                    auto v = hipblasSmallLuAbs1(sA[i + j * small_lu_ld]);
+                    if(v > best)
+                    {
+                        best = v;
+                        p    = i;
+                    }
+                }
+                sP[j] = p;
+                if(best == 0 && !first_zero)
+                    first_zero = j + 1;
+            }
+            __syncthreads();
+
+            int p = sP[j];
+            if(p != j && t < n)
+            {
+                T swap                  = sA[j + t * small_lu_ld];
+                sA[j + t * small_lu_ld] = sA[p + t * small_lu_ld];
+                sA[p + t * small_lu_ld] = swap;
+            }
+            __syncthreads();
+
+            // A zero pivot leaves the step out. info reports it and the result is not an inverse.
+            T d = sA[j + j * small_lu_ld];
+            if(hipblasSmallLuAbs1(d) == 0)
+                continue;
+            __syncthreads();
+
+            // Row j divided by the pivot, with the pivot itself replaced by 1 / d
+            if(t < n)
+                sA[j + t * small_lu_ld] = (t == j ? T(1) : sA[j + t * small_lu_ld]) * (T(1) / d);
+            __syncthreads();
+
+            // The other rows minus f times row j, f being their element in column j, which is set
+            // to 0 first so that it ends as -f / d
+            if(t < n && t != j)
+            {
+                T f                     = sA[t + j * small_lu_ld];
+                sA[t + j * small_lu_ld] = T(0);
+                for(int k = 0; k < n; k++)
+                    sA[t + k * small_lu_ld]
+                        = sA[t + k * small_lu_ld] - f * sA[j + k * small_lu_ld];
+            }
+            __syncthreads();
+        }
+
+        if(t < n)
+            for(int j = n - 1; j >= 0; j--)
+                if(sP[j] != j)
+                {
+                    T swap                      = sA[t + j * small_lu_ld];
+                    sA[t + j * small_lu_ld]     = sA[t + sP[j] * small_lu_ld];
+                    sA[t + sP[j] * small_lu_ld] = swap;
+                }
+
+        if(t < n)
+            for(int k = 0; k < n; k++)
+                Ainvb[t + size_t(k) * lda_inv] = sA[t + k * small_lu_ld];
+        if(t == 0)
+            info[b] = first_zero;
+        __syncthreads();
+    }
+}
+
+// Copies the n-by-n matrices of A_array one after the other into W, and points W_array at them
+template <typename T>
+__global__ void hipblasMatinvStageKernel(
+    int n, const T* const* A_array, int lda, T* W, T** W_array, int batch_count)
+{
+    const size_t count = size_t(n) * n;
+    for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+    {
+        const T* Ab = A_array[b];
+        T*       Wb = W + b * count;
+        if(blockIdx.x == 0 && threadIdx.x == 0)
+            W_array[b] = Wb;
+        for(size_t e = blockIdx.x * size_t(blockDim.x) + threadIdx.x; e < count;
+            e += size_t(gridDim.x) * blockDim.x)
+            Wb[e] = Ab[e % n + e / n * lda];
+    }
+}
+
+template <typename T, typename Th>
+static hipblasStatus_t hipblasSmallMatinvLaunch(hipblasHandle_t  handle,
+                                                int              n,
+                                                const Th* const* A_array,
+                                                int              lda,
+                                                Th* const*       Ainv_array,
+                                                int              lda_inv,
+                                                int*             info,
+                                                int              batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipLaunchKernelGGL((hipblasSmallMatinvKernel<T>),
+                       dim3(std::min(batch_count, small_lu_max_grid)),
+                       dim3(small_lu_threads),
+                       0,
+                       stream,
+                       n,
+                       (const T* const*)A_array,
+                       lda,
+                       (T* const*)Ainv_array,
+                       lda_inv,
+                       info,
+                       batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasMatinvStageLaunch(hipblasHandle_t handle,
+                                                int             n,
+                                                const T* const* A_array,
+                                                int             lda,
+                                                T*              W,
+                                                T**             W_array,
+                                                int             batch_count)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    constexpr int threads = 256;
+    size_t        count   = size_t(n) * n;
+    dim3          grid(std::min((count + threads - 1) / threads, size_t(64)),
+              std::min(batch_count, small_lu_max_grid));
+    hipLaunchKernelGGL((hipblasMatinvStageKernel<T>),
+                       grid,
+                       dim3(threads),
+                       0,
+                       stream,
+                       n,
+                       A_array,
+                       lda,
+                       W,
+                       W_array,
+                       batch_count);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasSmallMatinvKernels(hipblasHandle_t     handle,
+                                          int                 n,
+                                          const float* const* A_array,
+                                          int                 lda,
+                                          float* const*       Ainv_array,
+                                          int                 lda_inv,
+                                          int*                info,
+                                          int                 batch_count)
+{
+    return hipblasSmallMatinvLaunch<float>(
+        handle, n, A_array, lda, Ainv_array, lda_inv, info, batch_count);
+}
+
+hipblasStatus_t hipblasSmallMatinvKernels(hipblasHandle_t      handle,
+                                          int                  n,
+                                          const double* const* A_array,
+                                          int                  lda,
+                                          double* const*       Ainv_array,
+                                          int                  lda_inv,
+                                          int*                 info,
+                                          int                  batch_count)
+{
+    return hipblasSmallMatinvLaunch<double>(
+        handle, n, A_array, lda, Ainv_array, lda_inv, info, batch_count);
+}
+
+hipblasStatus_t hipblasSmallMatinvKernels(hipblasHandle_t              handle,
+                                          int                          n,
+                                          const hipblasComplex* const* A_array,
+                                          int                          lda,
+                                          hipblasComplex* const*       Ainv_array,
+                                          int                          lda_inv,
+                                          int*                         info,
+                                          int                          batch_count)
+{
+    return hipblasSmallMatinvLaunch<hipblasSmallLuComplex<float>>(
+        handle, n, A_array, lda, Ainv_array, lda_inv, info, batch_count);
+}
+
+hipblasStatus_t hipblasSmallMatinvKernels(hipblasHandle_t                    handle,
+                                          int                                n,
+                                          const hipblasDoubleComplex* const* A_array,
+                                          int                                lda,
+                                          hipblasDoubleComplex* const*       Ainv_array,
+                                          int                                lda_inv,
+                                          int*                               info,
+                                          int                                batch_count)
+{
+    return hipblasSmallMatinvLaunch<hipblasSmallLuComplex<double>>(
+        handle, n, A_array, lda, Ainv_array, lda_inv, info, batch_count);
+}
+
+hipblasStatus_t hipblasMatinvStageKernels(hipblasHandle_t     handle,
+                                          int                 n,
+                                          const float* const* A_array,
+                                          int                 lda,
+                                          float*              W,
+                                          float**             W_array,
+                                          int                 batch_count)
+{
+    return hipblasMatinvStageLaunch(handle, n, A_array, lda, W, W_array, batch_count);
+}
+
+hipblasStatus_t hipblasMatinvStageKernels(hipblasHandle_t      handle,
+                                          int                  n,
+                                          const double* const* A_array,
+                                          int                  lda,
+                                          double*              W,
+                                          double**             W_array,
+                                          int                  batch_count)
+{
+    return hipblasMatinvStageLaunch(handle, n, A_array, lda, W, W_array, batch_count);
+}
+
+hipblasStatus_t hipblasMatinvStageKernels(hipblasHandle_t              handle,
+                                          int                          n,
+                                          const hipblasComplex* const* A_array,
+                                          int                          lda,
+                                          hipblasComplex*              W,
+                                          hipblasComplex**             W_array,
+                                          int                          batch_count)
+{
+    return hipblasMatinvStageLaunch(handle, n, A_array, lda, W, W_array, batch_count);
+}
+
+hipblasStatus_t hipblasMatinvStageKernels(hipblasHandle_t                    handle,
+                                          int                                n,
+                                          const hipblasDoubleComplex* const* A_array,
+                                          int                                lda,
+                                          hipblasDoubleComplex*              W,
+                                          hipblasDoubleComplex**             W_array,
+                                          int                                batch_count)
+{
+    return hipblasMatinvStageLaunch(handle, n, A_array, lda, W, W_array, batch_count);
+}
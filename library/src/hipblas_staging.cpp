@@ -0,0 +1,787 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "staging.hpp"
+#include "affinity.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+// Pinned buffers per device. Host data smaller than hipblas_staging_min_bytes is only staged when
+// it is strided.
+static constexpr size_t hipblas_staging_slot_bytes = size_t(4) << 20;
+static constexpr int    hipblas_staging_slots      = 3;
+static constexpr size_t hipblas_staging_min_bytes  = size_t(64) << 10;
+
+// node is the NUMA node the buffers were allocated on
+struct hipblasStagingRing
+{
+    std::mutex mutex;
+    int        device                         = 0;
+    int        node                           = HIPBLAS_NUMA_NODE_ANY;
+    void*      buffers[hipblas_staging_slots] = {};
+    hipEvent_t copied[hipblas_staging_slots]  = {};
+    bool       ready                          = false;
+};
+
+// The ring of device, created on first use and kept until the process exits
+static hipblasStagingRing& hipblasStagingRingGet(int device)
+{
+    static std::mutex                                                   rings_mutex;
+    static std::unordered_map<int, std::unique_ptr<hipblasStagingRing>> rings;
+
+    std::lock_guard<std::mutex> lock(rings_mutex);
+
+    auto& ring = rings[device];
+    if(!ring)
+    {
+        ring.reset(new hipblasStagingRing);
+        ring->device = device;
+    }
+    return *ring;
+}
+
+// Allocates the buffers and events of ring, with its mutex held, on the NUMA node set for its
+// device. Buffers on another node are freed once their last transfer is done. A failed allocation
+// is retried by the next transfer.
+static bool hipblasStagingRingInit(hipblasStagingRing& ring)
+{
+    int node = hipblasAffinityDeviceNode(ring.device);
+    if(node != ring.node)
+    {
+        for(int i = 0; i < hipblas_staging_slots; i++)
+        {
+            if(!ring.buffers[i])
+                continue;
+            if(ring.copied[i] && hipEventSynchronize(ring.copied[i]) != hipSuccess)
+            {
+                (void)hipGetLastError();
+                return false;
+            }
+            (void)hipblasAffinityHostFree(ring.buffers[i]);
+            ring.buffers[i] = nullptr;
+        }
+        ring.node  = node;
+        ring.ready = false;
+    }
+
+    for(int i = 0; i < hipblas_staging_slots && !ring.ready; i++)
+    {
+        if(!ring.buffers[i]
+           && hipblasAffinityHostMalloc(&ring.buffers[i], hipblas_staging_slot_bytes, ring.node)
+                  != hipSuccess)
+        {
+            ring.buffers[i] = nullptr;
+            (void)hipGetLastError();
+            return false;
+        }
+        if(!ring.copied[i]
+           && hipEventCreateWithFlags(&ring.copied[i], hipEventDisableTiming) != hipSuccess)
+        {
+            ring.copied[i] = nullptr;
+            (void)hipGetLastError();
+            return false;
+        }
+        ring.ready = i == hipblas_staging_slots - 1;
+    }
+    return ring.ready;
+}
+
+// The ring of the current device. Returns HIPBLAS_STATUS_NOT_SUPPORTED while stream is being
+// captured, as the transfers synchronize with the host.
+static hipblasStatus_t hipblasStagingRingFor(hipStream_t stream, hipblasStagingRing*& ring)
+{
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    ring = &hipblasStagingRingGet(device);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// The backends copy strided host data element by element or column by column, packed pinned data
+// is already copied at full speed and packed pageable data only gains once it is large.
+static bool hipblasStagingUseful(
+    size_t rows, size_t cols, size_t elem_size, const void* host, size_t ld_host)
+{
+    if(cols > 1 && ld_host != rows)
+        return true;
+    if(rows * cols * elem_size < hipblas_staging_min_bytes)
+        return false;
+
+    unsigned int flags;
+    if(hipHostGetFlags(&flags, const_cast<void*>(host)) == hipSuccess)
+        return false;
+    (void)hipGetLastError();
+    return true;
+}
+
+// Pipelined copy of a rows x cols column major matrix on the device through the slots of ring,
+// whose mutex is held, in blocks that fit one slot. Blocks hold whole columns unless a single
+// column is larger than a slot. host_io(buffer, row, col, nrows, ncols) fills the slot buffer with
+// the block, its columns nrows apart, before it is copied to the device, or empties it after it
+// is copied from the device, and returns false on failure.
+template <typename HostIO>
+static hipblasStatus_t hipblasStagedBlocks(hipblasStagingRing& ring,
+                                           bool                to_device,
+                                           size_t              rows,
+                                           size_t              cols,
+                                           size_t              size,
+                                           char*               device,
+                                           size_t              ld_device,
+                                           hipStream_t         stream,
+                                           HostIO              host_io)
+{
+    size_t block_rows  = std::min(rows, hipblas_staging_slot_bytes / size);
+    size_t block_cols  = block_rows == rows
+                             ? std::min(cols, hipblas_staging_slot_bytes / (rows * size))
+                             : 1;
+    size_t row_blocks  = (rows + block_rows - 1) / block_rows;
+    size_t blocks      = row_blocks * ((cols + block_cols - 1) / block_cols);
+    size_t dev_pitch   = ld_device * size;
+    auto   block_shape = [&](size_t b, size_t& row, size_t& col, size_t& nrows, size_t& ncols) {
+        row   = b % row_blocks * block_rows;
+        col   = b / row_blocks * block_cols;
+        nrows = std::min(block_rows, rows - row);
+        ncols = std::min(block_cols, cols - col);
+    };
+
+    // Empties the slot of block b once its copy from the device is done
+    auto unpack = [&](size_t b) {
+        size_t row, col, nrows, ncols;
+        block_shape(b, row, col, nrows, ncols);
+        int slot = b % hipblas_staging_slots;
+        if(hipEventSynchronize(ring.copied[slot]) != hipSuccess)
+            return false;
+        return host_io(static_cast<char*>(ring.buffers[slot]), row, col, nrows, ncols);
+    };
+
+    for(size_t b = 0; b < blocks; b++)
+    {
+        size_t row, col, nrows, ncols;
+        block_shape(b, row, col, nrows, ncols);
+        int   slot   = b % hipblas_staging_slots;
+        char* buffer = static_cast<char*>(ring.buffers[slot]);
+        char* dev    = device + row * size + col * dev_pitch;
+        if(to_device)
+        {
+            // The slot is free once its previous DMA, possibly from an earlier call, is done
+            if(hipEventSynchronize(ring.copied[slot]) != hipSuccess
+               || !host_io(buffer, row, col, nrows, ncols))
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            if(hipMemcpy2DAsync(dev,
+                                dev_pitch,
+                                buffer,
+                                nrows * size,
+                                nrows * size,
+                                ncols,
+                                hipMemcpyHostToDevice,
+                                stream)
+               != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+        else
+        {
+            // Unpack the block that last used the slot before reusing it
+            if(b >= size_t(hipblas_staging_slots) && !unpack(b - hipblas_staging_slots))
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            if(hipMemcpy2DAsync(buffer,
+                                nrows * size,
+                                dev,
+                                dev_pitch,
+                                nrows * size,
+                                ncols,
+                                hipMemcpyDeviceToHost,
+                                stream)
+               != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+        if(hipEventRecord(ring.copied[slot], stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    if(!to_device)
+    {
+        size_t first = blocks > size_t(hipblas_staging_slots) ? blocks - hipblas_staging_slots : 0;
+        for(size_t b = first; b < blocks; b++)
+            if(!unpack(b))
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Staged copy of a rows x cols column major matrix between host and device
+static hipblasStatus_t hipblasStagedCopy(bool        to_device,
+                                         int         rows,
+                                         int         cols,
+                                         int         elem_size,
+                                         char*       host,
+                                         int         ld_host,
+                                         char*       device,
+                                         int         ld_device,
+                                         hipStream_t stream,
+                                         bool        async)
+{
+    if(rows <= 0 || cols <= 0 || elem_size <= 0 || ld_host < rows || ld_device < rows || !host
+       || !device || size_t(elem_size) > hipblas_staging_slot_bytes
+       || !hipblasStagingUseful(rows, cols, elem_size, host, ld_host))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasStagingRing* ring_ptr;
+    hipblasStatus_t     status = hipblasStagingRingFor(stream, ring_ptr);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasStagingRing&         ring = *ring_ptr;
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    if(!hipblasStagingRingInit(ring))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    size_t size       = elem_size;
+    size_t host_pitch = ld_host * size;
+    status            = hipblasStagedBlocks(
+        ring,
+        to_device,
+        rows,
+        cols,
+        size,
+        device,
+        ld_device,
+        stream,
+        [&](char* buffer, size_t row, size_t col, size_t nrows, size_t ncols) {
+            for(size_t j = 0; j < ncols; j++)
+            {
+                char* column = host + row * size + (col + j) * host_pitch;
+                if(to_device)
+                    memcpy(buffer + j * nrows * size, column, nrows * size);
+                else
+                    memcpy(column, buffer + j * nrows * size, nrows * size);
+            }
+            return true;
+        });
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(to_device && !async && hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasStagedSetMatrix(int         rows,
+                                       int         cols,
+                                       int         elem_size,
+                                       const void* host,
+                                       int         ld_host,
+                                       void*       device,
+                                       int         ld_device,
+                                       hipStream_t stream,
+                                       bool        async)
+{
+    return hipblasStagedCopy(true,
+                             rows,
+                             cols,
+                             elem_size,
+                             static_cast<char*>(const_cast<void*>(host)),
+                             ld_host,
+                             static_cast<char*>(device),
+                             ld_device,
+                             stream,
+                             async);
+}
+
+hipblasStatus_t hipblasStagedGetMatrix(int         rows,
+                                       int         cols,
+                                       int         elem_size,
+                                       const void* device,
+                                       int         ld_device,
+                                       void*       host,
+                                       int         ld_host,
+                                       hipStream_t stream)
+{
+    return hipblasStagedCopy(false,
+                             rows,
+                             cols,
+                             elem_size,
+                             static_cast<char*>(host),
+                             ld_host,
+                             static_cast<char*>(const_cast<void*>(device)),
+                             ld_device,
+                             stream,
+                             false);
+}
+
+#ifdef __linux__
+// Reads or writes all bytes at offset of fd, retrying short and interrupted transfers. A read past
+// the end of the file fails.
+static bool hipblasFileTransfer(bool read, int fd, char* buffer, size_t bytes, int64_t offset)
+{
+    while(bytes)
+    {
+        ssize_t done = read ? pread(fd, buffer, bytes, offset) : pwrite(fd, buffer, bytes, offset);
+        if(done < 0 && errno == EINTR)
+            continue;
+        if(done <= 0)
+            return false;
+        buffer += done;
+        bytes -= done;
+        offset += done;
+    }
+    return true;
+}
+#endif
+
+hipblasStatus_t hipblasStagedFileCopy(bool        to_device,
+                                      int64_t     rows,
+                                      int64_t     cols,
+                                      int         elem_size,
+                                      int         fd,
+                                      int64_t     offset,
+                                      int64_t     ld_file,
+                                      void*       device,
+                                      int64_t     ld_device,
+                                      hipStream_t stream)
+{
+#ifdef __linux__
+    if(rows <= 0 || cols <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(size_t(elem_size) > hipblas_staging_slot_bytes)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasStagingRing* ring_ptr;
+    hipblasStatus_t     status = hipblasStagingRingFor(stream, ring_ptr);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasStagingRing&         ring = *ring_ptr;
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    if(!hipblasStagingRingInit(ring))
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    // Columns contiguous in the file are read or written with one call
+    size_t size = elem_size;
+    status      = hipblasStagedBlocks(
+        ring,
+        to_device,
+        rows,
+        cols,
+        size,
+        static_cast<char*>(device),
+        ld_device,
+        stream,
+        [&](char* buffer, size_t row, size_t col, size_t nrows, size_t ncols) {
+            int64_t start = offset + int64_t(row + col * ld_file) * size;
+            if(ld_file == rows || ncols == 1)
+                return hipblasFileTransfer(to_device, fd, buffer, nrows * ncols * size, start);
+            for(size_t j = 0; j < ncols; j++)
+                if(!hipblasFileTransfer(to_device,
+                                        fd,
+                                        buffer + j * nrows * size,
+                                        nrows * size,
+                                        start + int64_t(j * ld_file * size)))
+                    return false;
+            return true;
+        });
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(to_device && hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// One 2D copy per matrix, without staging
+static hipblasStatus_t hipblasDirectCopyBatched(bool         to_device,
+                                                int          rows,
+                                                int          cols,
+                                                int          elem_size,
+                                                char* const* host,
+                                                int          ld_host,
+                                                char* const* device,
+                                                int          ld_device,
+                                                int          batch_count,
+                                                hipStream_t  stream)
+{
+    size_t width      = size_t(rows) * elem_size;
+    size_t host_pitch = size_t(ld_host) * elem_size;
+    size_t dev_pitch  = size_t(ld_device) * elem_size;
+    for(int i = 0; i < batch_count; i++)
+    {
+        hipError_t err = to_device ? hipMemcpy2DAsync(device[i],
+                                                      dev_pitch,
+                                                      host[i],
+                                                      host_pitch,
+                                                      width,
+                                                      cols,
+                                                      hipMemcpyHostToDevice,
+                                                      stream)
+                                   : hipMemcpy2DAsync(host[i],
+                                                      host_pitch,
+                                                      device[i],
+                                                      dev_pitch,
+                                                      width,
+                                                      cols,
+                                                      hipMemcpyDeviceToHost,
+                                                      stream);
+        if(err != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Staged copy of batch_count rows x cols matrices. As many whole matrices as fit are packed into
+// one slot and copied with a single 2D copy when the device matrices of the chunk are evenly
+// spaced, so small matrices cost one DMA per chunk rather than one per matrix.
+static hipblasStatus_t hipblasStagedCopyBatched(bool         to_device,
+                                                int          rows,
+                                                int          cols,
+                                                int          elem_size,
+                                                char* const* host,
+                                                int          ld_host,
+                                                char* const* device,
+                                                int          ld_device,
+                                                int          batch_count,
+                                                hipStream_t  stream)
+{
+    size_t size         = elem_size;
+    size_t width        = rows * size;
+    size_t matrix_bytes = width * cols;
+    size_t host_pitch   = ld_host * size;
+    size_t dev_pitch    = ld_device * size;
+
+    auto direct = [&]() {
+        return hipblasDirectCopyBatched(to_device,
+                                        rows,
+                                        cols,
+                                        elem_size,
+                                        host,
+                                        ld_host,
+                                        device,
+                                        ld_device,
+                                        batch_count,
+                                        stream);
+    };
+
+    // A matrix larger than a slot gains nothing from batching
+    if(matrix_bytes > hipblas_staging_slot_bytes)
+    {
+        for(int i = 0; i < batch_count; i++)
+        {
+            hipblasStatus_t status = hipblasStagedCopy(to_device,
+                                                       rows,
+                                                       cols,
+                                                       elem_size,
+                                                       host[i],
+                                                       ld_host,
+                                                       device[i],
+                                                       ld_device,
+                                                       stream,
+                                                       true);
+            if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+                status = hipblasDirectCopyBatched(to_device,
+                                                  rows,
+                                                  cols,
+                                                  elem_size,
+                                                  host + i,
+                                                  ld_host,
+                                                  device + i,
+                                                  ld_device,
+                                                  1,
+                                                  stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStagingRing* ring_ptr;
+    hipblasStatus_t     status = hipblasStagingRingFor(stream, ring_ptr);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return direct();
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasStagingRing&         ring = *ring_ptr;
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    if(!hipblasStagingRingInit(ring))
+        return direct();
+
+    size_t chunk_size = hipblas_staging_slot_bytes / matrix_bytes;
+    size_t chunks     = (batch_count + chunk_size - 1) / chunk_size;
+    auto   chunk_of   = [&](size_t c, size_t& first, size_t& count) {
+        first = c * chunk_size;
+        count = std::min(chunk_size, batch_count - first);
+    };
+
+    // Copies of the chunk between slot buffer and device, one 2D copy when the device matrices
+    // are evenly spaced
+    auto dma = [&](size_t first, size_t count, char* buffer) {
+        hipMemcpyKind kind   = to_device ? hipMemcpyHostToDevice : hipMemcpyDeviceToHost;
+        ptrdiff_t     stride = count > 1 ? device[first + 1] - device[first] : matrix_bytes;
+        for(size_t i = 2; i < count && stride; i++)
+            if(device[first + i] - device[first + i - 1] != stride)
+                stride = 0;
+
+        auto copy = [&](char* dev, size_t pitch, size_t copy_width, size_t height) {
+            return to_device ? hipMemcpy2DAsync(
+                       dev, pitch, buffer, copy_width, copy_width, height, kind, stream)
+                             : hipMemcpy2DAsync(
+                                 buffer, copy_width, dev, pitch, copy_width, height, kind, stream);
+        };
+
+        // Packed matrices, stride apart
+        if(dev_pitch == width && stride >= ptrdiff_t(matrix_bytes))
+            return copy(device[first], stride, matrix_bytes, count) == hipSuccess;
+        // Columns dev_pitch apart across the whole chunk
+        if(stride == ptrdiff_t(dev_pitch * cols))
+            return copy(device[first], dev_pitch, width, cols * count) == hipSuccess;
+
+        for(size_t i = 0; i < count; i++, buffer += matrix_bytes)
+            if(copy(device[first + i], dev_pitch, width, cols) != hipSuccess)
+                return false;
+        return true;
+    };
+
+    // Copies the chunk in slot c % hipblas_staging_slots to host
+    auto unpack = [&](size_t c) {
+        size_t first, count;
+        chunk_of(c, first, count);
+        int slot = c % hipblas_staging_slots;
+        if(hipEventSynchronize(ring.copied[slot]) != hipSuccess)
+            return false;
+        const char* buffer = static_cast<char*>(ring.buffers[slot]);
+        for(size_t i = 0; i < count; i++)
+            for(int j = 0; j < cols; j++, buffer += width)
+                memcpy(host[first + i] + j * host_pitch, buffer, width);
+        return true;
+    };
+
+    for(size_t c = 0; c < chunks; c++)
+    {
+        size_t first, count;
+        chunk_of(c, first, count);
+        int   slot   = c % hipblas_staging_slots;
+        char* buffer = static_cast<char*>(ring.buffers[slot]);
+        if(to_device)
+        {
+            if(hipEventSynchronize(ring.copied[slot]) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            char* packed = buffer;
+            for(size_t i = 0; i < count; i++)
+                for(int j = 0; j < cols; j++, packed += width)
+                    memcpy(packed, host[first + i] + j * host_pitch, width);
+        }
+        else if(c >= size_t(hipblas_staging_slots) && !unpack(c - hipblas_staging_slots))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if(!dma(first, count, buffer) || hipEventRecord(ring.copied[slot], stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    if(!to_device)
+    {
+        size_t first = chunks > size_t(hipblas_staging_slots) ? chunks - hipblas_staging_slots : 0;
+        for(size_t c = first; c < chunks; c++)
+            if(!unpack(c))
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Arguments shared by the batched transfers. Returns HIPBLAS_STATUS_SUCCESS with batch_count set
+// to 0 when there is nothing to copy.
+static hipblasStatus_t hipblasCheckMatrixBatched(
+    int rows, int cols, int elem_size, int lda, int ldb, int& batch_count)
+{
+    if(rows < 0 || cols < 0 || elem_size <= 0 || lda <= 0 || ldb <= 0 || lda < rows || ldb < rows
+       || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!rows || !cols)
+        batch_count = 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Matrix pointers of a strided batch
+static std::vector<char*> hipblasStridedPointers(const void* base,
+                                                 hipblasStride stride,
+                                                 int           elem_size,
+                                                 int           batch_count)
+{
+    std::vector<char*> pointers(batch_count);
+    for(int i = 0; i < batch_count; i++)
+        pointers[i] = static_cast<char*>(const_cast<void*>(base)) + i * stride * elem_size;
+    return pointers;
+}
+
+extern "C" hipblasStatus_t hipblasSetMatrixBatchedAsync(int               rows,
+                                                        int               cols,
+                                                        int               elemSize,
+                                                        const void* const AP[],
+                                                        int               lda,
+                                                        void* const       BP[],
+                                                        int               ldb,
+                                                        int               batchCount,
+                                                        hipStream_t       stream)
+try
+{
+    HIPBLAS_LAYER(nullptr, rows, cols, elemSize, AP, lda, BP, ldb, batchCount, stream);
+    hipblasStatus_t status = hipblasCheckMatrixBatched(rows, cols, elemSize, lda, ldb, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !batchCount)
+        return status;
+    if(!AP || !BP)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int i = 0; i < batchCount; i++)
+        if(!AP[i] || !BP[i])
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasStagedCopyBatched(true,
+                                    rows,
+                                    cols,
+                                    elemSize,
+                                    reinterpret_cast<char* const*>(const_cast<void* const*>(AP)),
+                                    lda,
+                                    reinterpret_cast<char* const*>(BP),
+                                    ldb,
+                                    batchCount,
+                                    stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetMatrixBatchedAsync(int               rows,
+                                                        int               cols,
+                                                        int               elemSize,
+                                                        const void* const AP[],
+                                                        int               lda,
+                                                        void* const       BP[],
+                                                        int               ldb,
+                                                        int               batchCount,
+                                                        hipStream_t       stream)
+try
+{
+    HIPBLAS_LAYER(nullptr, rows, cols, elemSize, AP, lda, BP, ldb, batchCount, stream);
+    hipblasStatus_t status = hipblasCheckMatrixBatched(rows, cols, elemSize, lda, ldb, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !batchCount)
+        return status;
+    if(!AP || !BP)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int i = 0; i < batchCount; i++)
+        if(!AP[i] || !BP[i])
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasStagedCopyBatched(false,
+                                    rows,
+                                    cols,
+                                    elemSize,
+                                    reinterpret_cast<char* const*>(BP),
+                                    ldb,
+                                    reinterpret_cast<char* const*>(const_cast<void* const*>(AP)),
+                                    lda,
+                                    batchCount,
+                                    stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetMatrixStridedBatchedAsync(int           rows,
+                                                               int           cols,
+                                                               int           elemSize,
+                                                               const void*   AP,
+                                                               int           lda,
+                                                               hipblasStride strideA,
+                                                               void*         BP,
+                                                               int           ldb,
+                                                               hipblasStride strideB,
+                                                               int           batchCount,
+                                                               hipStream_t   stream)
+try
+{
+    HIPBLAS_LAYER(
+        nullptr, rows, cols, elemSize, AP, lda, strideA, BP, ldb, strideB, batchCount, stream);
+    hipblasStatus_t status = hipblasCheckMatrixBatched(rows, cols, elemSize, lda, ldb, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !batchCount)
+        return status;
+    if(!AP || !BP)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto host   = hipblasStridedPointers(AP, strideA, elemSize, batchCount);
+    auto device = hipblasStridedPointers(BP, strideB, elemSize, batchCount);
+    return hipblasStagedCopyBatched(
+        true, rows, cols, elemSize, host.data(), lda, device.data(), ldb, batchCount, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetMatrixStridedBatchedAsync(int           rows,
+                                                               int           cols,
+                                                               int           elemSize,
+                                                               const void*   AP,
+                                                               int           lda,
+                                                               hipblasStride strideA,
+                                                               void*         BP,
+                                                               int           ldb,
+                                                               hipblasStride strideB,
+                                                               int           batchCount,
+                                                               hipStream_t   stream)
+try
+{
+    HIPBLAS_LAYER(
+        nullptr, rows, cols, elemSize, AP, lda, strideA, BP, ldb, strideB, batchCount, stream);
+    hipblasStatus_t status = hipblasCheckMatrixBatched(rows, cols, elemSize, lda, ldb, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !batchCount)
+        return status;
+    if(!AP || !BP)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto device = hipblasStridedPointers(AP, strideA, elemSize, batchCount);
+    auto host   = hipblasStridedPointers(BP, strideB, elemSize, batchCount);
+    return hipblasStagedCopyBatched(
+        false, rows, cols, elemSize, host.data(), ldb, device.data(), lda, batchCount, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,481 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "stream_pool.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "shared_handle.hpp"
+#include <algorithm>
+#include <atomic>
+#include <hip/hip_runtime_api.h>
+#ifndef __HIP_PLATFORM_NVCC__
+#include <hip/hip_ext.h>
+#endif
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Largest pool accepted by hipblasSetStreamPoolSize
+static constexpr int stream_pool_max_size = 32;
+
+// Fewest problems given to one pool stream, so launching on several streams pays off
+static constexpr int stream_pool_min_chunk = 64;
+
+// One pool stream with the handle that runs its chunks and the event the handle stream waits for
+struct hipblasStreamPoolStream
+{
+    hipStream_t     stream = nullptr;
+    hipblasHandle_t handle = nullptr;
+    hipEvent_t      done   = nullptr;
+};
+
+struct hipblasStreamPool
+{
+    hipEvent_t                           fork     = nullptr;
+    hipblasStreamPriority_t              priority = HIPBLAS_STREAM_PRIORITY_DEFAULT;
+    std::vector<uint32_t>                cu_mask;
+    std::vector<hipblasStreamPoolStream> streams;
+
+    ~hipblasStreamPool()
+    {
+        for(auto& s : streams)
+        {
+            if(s.handle)
+                (void)hipblasDestroy(s.handle);
+            if(s.done)
+                (void)hipEventDestroy(s.done);
+            if(s.stream)
+                (void)hipStreamDestroy(s.stream);
+        }
+        if(fork)
+            (void)hipEventDestroy(fork);
+    }
+};
+
+// The pools of the handles, released outside the lock as destroying a pool destroys handles.
+// stream_pool_handles counts the handles with a pool, so calls on other handles skip the lock.
+static std::mutex       stream_pool_mutex;
+static std::atomic<int> stream_pool_handles{0};
+
+static std::unordered_map<hipblasHandle_t, std::shared_ptr<hipblasStreamPool>> stream_pools;
+
+// Priorities set with hipblasSetStreamPriority, also under stream_pool_mutex. Handles of the
+// default priority have no entry.
+static std::unordered_map<hipblasHandle_t, hipblasStreamPriority_t> stream_priorities;
+
+// CU masks set with hipblasSetComputeUnitMask, also under stream_pool_mutex. Handles without a
+// mask have no entry.
+static std::unordered_map<hipblasHandle_t, std::vector<uint32_t>> stream_cu_masks;
+
+static hipblasStreamPriority_t hipblasStreamPriorityGet(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(stream_pool_mutex);
+
+    auto it = stream_priorities.find(handle);
+    return it == stream_priorities.end() ? HIPBLAS_STREAM_PRIORITY_DEFAULT : it->second;
+}
+
+static std::vector<uint32_t> hipblasStreamCUMaskGet(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(stream_pool_mutex);
+
+    auto it = stream_cu_masks.find(handle);
+    return it == stream_cu_masks.end() ? std::vector<uint32_t>{} : it->second;
+}
+
+// A stream restricted to the CUs of cu_mask when it is not empty, of priority otherwise
+static hipError_t hipblasStreamCreateWith(hipblasStreamPriority_t      priority,
+                                          const std::vector<uint32_t>& cu_mask,
+                                          hipStream_t*                 stream)
+{
+#ifndef __HIP_PLATFORM_NVCC__
+    if(!cu_mask.empty())
+        return hipExtStreamCreateWithCUMask(stream, uint32_t(cu_mask.size()), cu_mask.data());
+#endif
+    if(priority == HIPBLAS_STREAM_PRIORITY_DEFAULT)
+        return hipStreamCreateWithFlags(stream, hipStreamNonBlocking);
+
+    int        least, greatest;
+    hipError_t error = hipDeviceGetStreamPriorityRange(&least, &greatest);
+    if(error != hipSuccess)
+        return error;
+    int value = priority == HIPBLAS_STREAM_PRIORITY_LATENCY ? greatest : least;
+    return hipStreamCreateWithPriority(stream, hipStreamNonBlocking, value);
+}
+
+hipError_t hipblasInternalStreamCreate(hipblasHandle_t handle, hipStream_t* stream)
+{
+    return hipblasStreamCreateWith(
+        hipblasStreamPriorityGet(handle), hipblasStreamCUMaskGet(handle), stream);
+}
+
+static std::shared_ptr<hipblasStreamPool> hipblasStreamPoolGet(hipblasHandle_t handle)
+{
+    if(!stream_pool_handles.load(std::memory_order_relaxed))
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(stream_pool_mutex);
+
+    auto pool = stream_pools.find(handle);
+    return pool == stream_pools.end() ? nullptr : pool->second;
+}
+
+// Replace the pool of handle, returning the previous one
+static std::shared_ptr<hipblasStreamPool>
+    hipblasStreamPoolExchange(hipblasHandle_t handle, std::shared_ptr<hipblasStreamPool> pool)
+{
+    std::lock_guard<std::mutex> lock(stream_pool_mutex);
+
+    std::shared_ptr<hipblasStreamPool> old;
+
+    auto it = stream_pools.find(handle);
+    if(it != stream_pools.end())
+    {
+        old = std::move(it->second);
+        if(pool)
+            it->second = std::move(pool);
+        else
+        {
+            stream_pools.erase(it);
+            stream_pool_handles--;
+        }
+    }
+    else if(pool)
+    {
+        stream_pools.emplace(handle, std::move(pool));
+        stream_pool_handles++;
+    }
+    return old;
+}
+
+int hipblasStreamPoolChunks(hipblasHandle_t handle, int batch_count)
+{
+    if(batch_count < 2 * stream_pool_min_chunk)
+        return 0;
+
+    auto pool = hipblasStreamPoolGet(handle);
+    if(!pool)
+        return 0;
+
+    int chunks = std::min(int(pool->streams.size()), batch_count / stream_pool_min_chunk);
+    if(chunks < 2)
+        return 0;
+
+    // The pool streams are not part of a capture
+    hipStream_t            stream;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+    {
+        (void)hipGetLastError();
+        return 0;
+    }
+    return chunks;
+}
+
+hipblasStatus_t hipblasStreamPoolRun(hipblasHandle_t                 handle,
+                                     int                             batch_count,
+                                     int                             chunks,
+                                     const hipblasStreamPoolChunkFn& run)
+{
+    // The pool may have been replaced since the chunks were counted
+    auto pool = hipblasStreamPoolGet(handle);
+    chunks    = pool ? std::min(chunks, int(pool->streams.size())) : 0;
+    if(chunks < 2)
+        return run(handle, 0, batch_count);
+
+    hipStream_t          stream;
+    hipblasPointerMode_t pointer_mode;
+    hipblasAtomicsMode_t atomics_mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetAtomicsMode(handle, &atomics_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(hipEventRecord(pool->fork, stream) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    for(int i = 0; i < chunks && status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        auto& s     = pool->streams[i];
+        int   first = int(int64_t(batch_count) * i / chunks);
+        int   count = int(int64_t(batch_count) * (i + 1) / chunks) - first;
+
+        if(hipStreamWaitEvent(s.stream, pool->fork, 0) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+
+        status = hipblasSetPointerMode(s.handle, pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetAtomicsMode(s.handle, atomics_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = run(s.handle, first, count);
+
+        // Join every chunk that was started, even when a later one fails
+        if(hipEventRecord(s.done, s.stream) != hipSuccess
+           || hipStreamWaitEvent(stream, s.done, 0) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+    }
+    return status;
+}
+
+void hipblasStreamPoolErase(hipblasHandle_t handle)
+{
+    if(stream_pool_handles.load(std::memory_order_relaxed))
+        hipblasStreamPoolExchange(handle, nullptr);
+
+    std::lock_guard<std::mutex> lock(stream_pool_mutex);
+    stream_priorities.erase(handle);
+    stream_cu_masks.erase(handle);
+}
+
+// Creates a pool of size streams of priority and cu_mask, destroyed again when one of them fails
+static hipblasStatus_t hipblasStreamPoolCreate(int                                 size,
+                                               hipblasStreamPriority_t             priority,
+                                               const std::vector<uint32_t>&        cu_mask,
+                                               std::shared_ptr<hipblasStreamPool>& pool)
+{
+    pool           = std::make_shared<hipblasStreamPool>();
+    pool->priority = priority;
+    pool->cu_mask  = cu_mask;
+    pool->streams.resize(size);
+
+    if(hipEventCreateWithFlags(&pool->fork, hipEventDisableTiming) != hipSuccess)
+    {
+        pool->fork = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    for(auto& s : pool->streams)
+    {
+        if(hipblasStreamCreateWith(priority, cu_mask, &s.stream) != hipSuccess)
+        {
+            s.stream = nullptr;
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        if(hipEventCreateWithFlags(&s.done, hipEventDisableTiming) != hipSuccess)
+        {
+            s.done = nullptr;
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+
+        hipblasStatus_t status = hipblasCreate(&s.handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            s.handle = nullptr;
+            return status;
+        }
+        status = hipblasSetStream(s.handle, s.stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+extern "C" hipblasStatus_t hipblasSetStreamPoolSize(hipblasHandle_t handle, int size)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, size);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(size < 0 || size > stream_pool_max_size)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::shared_ptr<hipblasStreamPool> pool;
+    if(size)
+    {
+        hipblasStatus_t status = hipblasStreamPoolCreate(
+            size, hipblasStreamPriorityGet(handle), hipblasStreamCUMaskGet(handle), pool);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    // The previous pool is destroyed once no call is using it
+    hipblasStreamPoolExchange(handle, std::move(pool));
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetStreamPoolSize(hipblasHandle_t handle, int* size)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, size);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!size)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto pool = hipblasStreamPoolGet(handle);
+    *size     = pool ? int(pool->streams.size()) : 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSetStreamPriority(hipblasHandle_t         handle,
+                                                    hipblasStreamPriority_t priority)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, priority);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(priority != HIPBLAS_STREAM_PRIORITY_DEFAULT && priority != HIPBLAS_STREAM_PRIORITY_LATENCY
+       && priority != HIPBLAS_STREAM_PRIORITY_BULK)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    // An existing pool is replaced by one of the same size on streams of the new priority
+    auto existing = hipblasStreamPoolGet(handle);
+    if(existing && existing->priority != priority)
+    {
+        std::shared_ptr<hipblasStreamPool> pool;
+        hipblasStatus_t                    status = hipblasStreamPoolCreate(
+            int(existing->streams.size()), priority, existing->cu_mask, pool);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        hipblasStreamPoolExchange(handle, std::move(pool));
+    }
+
+    std::lock_guard<std::mutex> lock(stream_pool_mutex);
+    if(priority == HIPBLAS_STREAM_PRIORITY_DEFAULT)
+        stream_priorities.erase(handle);
+    else
+        stream_priorities[handle] = priority;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetStreamPriority(hipblasHandle_t          handle,
+                                                    hipblasStreamPriority_t* priority)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, priority);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!priority)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *priority = hipblasStreamPriorityGet(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasSetComputeUnitMask(hipblasHandle_t handle, int maskSize, const uint32_t* mask)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, maskSize, mask);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(maskSize < 0 || (maskSize && !mask))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::vector<uint32_t> cu_mask(mask, mask + maskSize);
+    if(maskSize && std::all_of(cu_mask.begin(), cu_mask.end(), [](uint32_t m) { return !m; }))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+#ifdef __HIP_PLATFORM_NVCC__
+    if(maskSize)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+
+    // An existing pool is replaced by one of the same size on streams of the new mask
+    auto existing = hipblasStreamPoolGet(handle);
+    if(existing && existing->cu_mask != cu_mask)
+    {
+        std::shared_ptr<hipblasStreamPool> pool;
+        hipblasStatus_t                    status = hipblasStreamPoolCreate(
+            int(existing->streams.size()), existing->priority, cu_mask, pool);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        hipblasStreamPoolExchange(handle, std::move(pool));
+    }
+
+    std::lock_guard<std::mutex> lock(stream_pool_mutex);
+    if(cu_mask.empty())
+        stream_cu_masks.erase(handle);
+    else
+        stream_cu_masks[handle] = std::move(cu_mask);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasGetComputeUnitMask(hipblasHandle_t handle, int* maskSize, uint32_t* mask)
+try
+{
+    HIPBLAS_LAYER_HANDLE(handle, maskSize, mask);
+    if(hipblasSharedHandleIs(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!maskSize || *maskSize < 0 || (*maskSize && !mask))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // The words beyond the mask read as zero, as hipExtStreamCreateWithCUMask takes them
+    auto cu_mask = hipblasStreamCUMaskGet(handle);
+    for(int i = 0; i < *maskSize; i++)
+        mask[i] = i < int(cu_mask.size()) ? cu_mask[i] : 0;
+    *maskSize = int(cu_mask.size());
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,1327 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <type_traits>
+#include <vector>
+
+// hipBLAS functions of each precision run by tpmm and tpsm
+template <typename T>
+struct hipblasTpmmFunctions;
+
+template <>
+struct hipblasTpmmFunctions<float>
+{
+    static constexpr auto gemmBatched        = hipblasSgemmBatched;
+    static constexpr auto gemmStridedBatched = hipblasSgemmStridedBatched;
+    static constexpr auto trmmBatched        = hipblasStrmmBatched;
+    static constexpr auto trmmStridedBatched = hipblasStrmmStridedBatched;
+    static constexpr auto trsmBatched        = hipblasStrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasStrsmStridedBatched;
+};
+
+template <>
+struct hipblasTpmmFunctions<double>
+{
+    static constexpr auto gemmBatched        = hipblasDgemmBatched;
+    static constexpr auto gemmStridedBatched = hipblasDgemmStridedBatched;
+    static constexpr auto trmmBatched        = hipblasDtrmmBatched;
+    static constexpr auto trmmStridedBatched = hipblasDtrmmStridedBatched;
+    static constexpr auto trsmBatched        = hipblasDtrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasDtrsmStridedBatched;
+};
+
+template <>
+struct hipblasTpmmFunctions<hipblasComplex>
+{
+    static constexpr auto gemmBatched        = hipblasCgemmBatched;
+    static constexpr auto gemmStridedBatched = hipblasCgemmStridedBatched;
+    static constexpr auto trmmBatched        = hipblasCtrmmBatched;
+    static constexpr auto trmmStridedBatched = hipblasCtrmmStridedBatched;
+    static constexpr auto trsmBatched        = hipblasCtrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasCtrsmStridedBatched;
+};
+
+template <>
+struct hipblasTpmmFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto gemmBatched        = hipblasZgemmBatched;
+    static constexpr auto gemmStridedBatched = hipblasZgemmStridedBatched;
+    static constexpr auto trmmBatched        = hipblasZtrmmBatched;
+    static constexpr auto trmmStridedBatched = hipblasZtrmmStridedBatched;
+    static constexpr auto trsmBatched        = hipblasZtrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasZtrsmStridedBatched;
+};
+
+// Number of columns of A unpacked at a time
+constexpr int hipblasTpmmPanel = 128;
+
+// Block of the matrices of a batch: ptr and stride for the non-batched and strided batched forms,
+// or array of the device pointers of the batched form
+template <typename T>
+struct hipblasTpmmBlock
+{
+    T*            ptr;
+    T* const*     array;
+    int           ld;
+    hipblasStride stride;
+};
+
+// B := alpha op(A) B or alpha B op(A) for tpmm, and the solution X of op(A) X = alpha B or
+// X op(A) = alpha B for tpsm, with A a k by k packed triangular matrix. The columns of A are
+// unpacked a panel of hipblasTpmmPanel at a time into a k by hipblasTpmmPanel scratch, which keeps
+// the rows of each column at their full storage positions, so that the memory taken is a fraction
+// of a full A. Each panel P then takes a trmm or trsm with its triangular diagonal block and one
+// gemm with the rectangle R of its other stored rows, rows 0 to P - 1 of an upper and rows after P
+// of a lower A:
+//   - with op(A) on the left of A and HIPBLAS_OP_N, or on the right and HIPBLAS_OP_T or C, the
+//     panel scatters: the block of B at P is read to update the blocks of B at R,
+//   - otherwise the panel gathers: the block of B at P is updated from the blocks at R.
+// The panels run in the order that reads blocks of B before they are updated for tpmm, or after
+// they are solved for tpsm. alpha scales each block of B when the block is first written.
+template <typename T>
+static hipblasStatus_t hipblasTpmm(hipblasHandle_t    handle,
+                                   bool               solve,
+                                   hipblasSideMode_t  side,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t transA,
+                                   hipblasDiagType_t  diag,
+                                   int                m,
+                                   int                n,
+                                   const T*           alpha,
+                                   const T*           AP,
+                                   const T* const*    AP_array,
+                                   hipblasStride      strideAP,
+                                   T*                 B,
+                                   T* const*          B_array,
+                                   int                ldb,
+                                   hipblasStride      strideB,
+                                   int                batchCount)
+{
+    using F = hipblasTpmmFunctions<T>;
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+       || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+       || (transA != HIPBLAS_OP_N && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+       || (diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m < 0 || n < 0 || batchCount < 0 || ldb < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    bool batched = AP_array || B_array;
+    if(!alpha || (batched ? !AP_array || !B_array : !AP || !B))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // HIPBLAS_OP_C is HIPBLAS_OP_T on real data
+    constexpr bool is_complex = !std::is_same<T, float>{} && !std::is_same<T, double>{};
+    if(!is_complex && transA == HIPBLAS_OP_C)
+        transA = HIPBLAS_OP_T;
+
+    hipStream_t            stream;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    hipblasPointerMode_t   pointer_mode;
+    hipblasStatus_t        status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    bool          left    = side == HIPBLAS_SIDE_LEFT;
+    bool          upper   = uplo == HIPBLAS_FILL_MODE_UPPER;
+    bool          scatter = left == (transA == HIPBLAS_OP_N);
+    bool          forward = solve ? scatter != upper : scatter == upper;
+    int           k       = left ? m : n;
+    int           nb      = std::min(k, hipblasTpmmPanel);
+    int           panels  = (k + nb - 1) / nb;
+    hipblasStride strideS = hipblasStride(k) * nb;
+
+    // The scratch holds the panel of each A_i, and for the batched form the pointer arrays of the
+    // diagonal block and rectangle of the panel and of the blocks of B at P and R for every step
+    hipblasDeviceScratch scratch;
+    size_t               bytes       = (sizeof(T) * strideS * batchCount + 255) / 256 * 256;
+    size_t               array_bytes = batched ? 4 * sizeof(T*) * batchCount * panels : 0;
+    if(hipMalloc((void**)&scratch.base, bytes + array_bytes) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    T*  S      = (T*)scratch.base;
+    T** arrays = (T**)(scratch.base + bytes);
+
+    // The panels run in host pointer mode, with alpha read back in device pointer mode
+    T          h_alpha;
+    hipError_t error = hipSuccess;
+    if(pointer_mode == HIPBLAS_POINTER_MODE_DEVICE)
+        error = hipMemcpyAsync(&h_alpha, alpha, sizeof(T), hipMemcpyDeviceToHost, stream);
+    else
+        h_alpha = *alpha;
+
+    std::vector<const T*> AP_b(batchCount);
+    std::vector<T*>       B_b(batchCount);
+    if(batched)
+    {
+        size_t ptr_bytes = sizeof(T*) * batchCount;
+        if(error == hipSuccess)
+            error = hipMemcpyAsync(AP_b.data(), AP_array, ptr_bytes, hipMemcpyDeviceToHost, stream);
+        if(error == hipSuccess)
+            error = hipMemcpyAsync(B_b.data(), B_array, ptr_bytes, hipMemcpyDeviceToHost, stream);
+    }
+    if(error != hipSuccess || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    // Offsets of the step s: the panel at rows and columns c to c + w - 1 of A, and its rectangle
+    // at rows r to r + rl - 1
+    auto panel = [&](int s, int& c, int& w, int& r, int& rl) {
+        int p = forward ? s : panels - 1 - s;
+        c     = p * nb;
+        w     = std::min(nb, k - c);
+        r     = upper ? 0 : c + w;
+        rl    = upper ? c : k - c - w;
+    };
+
+    // Offset of row i of B on the left, or of column i on the right
+    auto offset_b = [&](int i) { return left ? size_t(i) : size_t(i) * ldb; };
+
+    if(batched)
+    {
+        std::vector<T*> host(4 * size_t(batchCount) * panels);
+        for(int s = 0; s < panels; s++)
+        {
+            int c, w, r, rl;
+            panel(s, c, w, r, rl);
+            for(int b = 0; b < batchCount; b++)
+            {
+                T** step = host.data() + 4 * size_t(batchCount) * s + b;
+
+                step[0]              = S + b * strideS + c;
+                step[batchCount]     = S + b * strideS + r;
+                step[2 * batchCount] = B_b[b] + offset_b(c);
+                step[3 * batchCount] = B_b[b] + offset_b(r);
+            }
+        }
+        if(hipMemcpyAsync(
+               arrays, host.data(), sizeof(T*) * host.size(), hipMemcpyHostToDevice, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // Copies the stored rows of columns c to c + w - 1 of each A_i into S, one 2D copy per column
+    // over a strided batch of packed matrices that do not overlap and one copy per matrix otherwise
+    auto unpack = [&](int c, int w) {
+        size_t pitch_s = sizeof(T) * strideS;
+        size_t pitch_a = sizeof(T) * strideAP;
+        for(int j = c; j < c + w && error == hipSuccess; j++)
+        {
+            int    first  = upper ? 0 : j;
+            size_t offset = upper ? size_t(j) * (j + 1) / 2
+                                  : size_t(j) * (2 * size_t(k) - j + 1) / 2;
+            size_t width  = sizeof(T) * (upper ? j + 1 : k - j);
+            T*     dst    = S + size_t(j - c) * k + first;
+            if(!batched && batchCount > 1 && pitch_a >= width)
+                error = hipMemcpy2DAsync(dst,
+                                         pitch_s,
+                                         AP + offset,
+                                         pitch_a,
+                                         width,
+                                         batchCount,
+                                         hipMemcpyDeviceToDevice,
+                                         stream);
+            else
+                for(int b = 0; b < batchCount && error == hipSuccess; b++)
+                    error = hipMemcpyAsync(dst + b * strideS,
+                                           (batched ? AP_b[b] : AP + b * strideAP) + offset,
+                                           width,
+                                           hipMemcpyDeviceToDevice,
+                                           stream);
+        }
+        return error == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+    };
+
+    // Z := a op_x(X) op_y(Y) + beta Z with Z rows by cols
+    auto gemm = [&](hipblasOperation_t         op_x,
+                    hipblasOperation_t         op_y,
+                    int                        rows,
+                    int                        cols,
+                    int                        inner,
+                    const T*                   a,
+                    const hipblasTpmmBlock<T>& X,
+                    const hipblasTpmmBlock<T>& Y,
+                    const T*                   beta,
+                    const hipblasTpmmBlock<T>& Z) {
+        if(batched)
+            return F::gemmBatched(handle,
+                                  op_x,
+                                  op_y,
+                                  rows,
+                                  cols,
+                                  inner,
+                                  a,
+                                  X.array,
+                                  X.ld,
+                                  Y.array,
+                                  Y.ld,
+                                  beta,
+                                  Z.array,
+                                  Z.ld,
+                                  batchCount);
+        return F::gemmStridedBatched(handle,
+                                     op_x,
+                                     op_y,
+                                     rows,
+                                     cols,
+                                     inner,
+                                     a,
+                                     X.ptr,
+                                     X.ld,
+                                     X.stride,
+                                     Y.ptr,
+                                     Y.ld,
+                                     Y.stride,
+                                     beta,
+                                     Z.ptr,
+                                     Z.ld,
+                                     Z.stride,
+                                     batchCount);
+    };
+
+    // Y := a op(T) Y or a Y op(T) for tpmm, and Y := a op(T)^-1 Y or a Y op(T)^-1 for tpsm, with T
+    // the w by w diagonal block of the panel
+    auto diagonal = [&](int                        w,
+                        const T*                   a,
+                        const hipblasTpmmBlock<T>& D,
+                        const hipblasTpmmBlock<T>& Y) {
+        int rows = left ? w : m;
+        int cols = left ? n : w;
+        if(solve && batched)
+            return F::trsmBatched(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  rows,
+                                  cols,
+                                  a,
+                                  D.array,
+                                  D.ld,
+                                  Y.array,
+                                  Y.ld,
+                                  batchCount);
+        if(solve)
+            return F::trsmStridedBatched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         rows,
+                                         cols,
+                                         a,
+                                         D.ptr,
+                                         D.ld,
+                                         D.stride,
+                                         Y.ptr,
+                                         Y.ld,
+                                         Y.stride,
+                                         batchCount);
+        if(batched)
+            return F::trmmBatched(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  rows,
+                                  cols,
+                                  a,
+                                  D.array,
+                                  D.ld,
+                                  Y.array,
+                                  Y.ld,
+                                  Y.array,
+                                  Y.ld,
+                                  batchCount);
+        return F::trmmStridedBatched(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     rows,
+                                     cols,
+                                     a,
+                                     D.ptr,
+                                     D.ld,
+                                     D.stride,
+                                     Y.ptr,
+                                     Y.ld,
+                                     Y.stride,
+                                     Y.ptr,
+                                     Y.ld,
+                                     Y.stride,
+                                     batchCount);
+    };
+
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    const T one = 1, minus_one = -1;
+    for(int s = 0; s < panels && status == HIPBLAS_STATUS_SUCCESS; s++)
+    {
+        int c, w, r, rl;
+        panel(s, c, w, r, rl);
+
+        T* const*           step = arrays + 4 * size_t(batchCount) * s;
+        hipblasTpmmBlock<T> D{S + c, batched ? step : nullptr, k, strideS};
+        hipblasTpmmBlock<T> R{S + r, batched ? step + batchCount : nullptr, k, strideS};
+        hipblasTpmmBlock<T> BP{
+            B + offset_b(c), batched ? step + 2 * batchCount : nullptr, ldb, strideB};
+        hipblasTpmmBlock<T> BR{
+            B + offset_b(r), batched ? step + 3 * batchCount : nullptr, ldb, strideB};
+
+        // The gemm of the panel: the blocks of B at R from the block at P when scattering, and the
+        // block at P from the blocks at R when gathering
+        auto update = [&](const T* a, const T* beta) {
+            if(scatter && left)
+                return gemm(HIPBLAS_OP_N, HIPBLAS_OP_N, rl, n, w, a, R, BP, beta, BR);
+            if(scatter)
+                return gemm(HIPBLAS_OP_N, transA, m, rl, w, a, BP, R, beta, BR);
+            if(left)
+                return gemm(transA, HIPBLAS_OP_N, w, n, rl, a, R, BR, beta, BP);
+            return gemm(HIPBLAS_OP_N, HIPBLAS_OP_N, m, w, rl, a, BR, R, beta, BP);
+        };
+
+        status = unpack(c, w);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+        if(!solve && scatter)
+        {
+            if(rl)
+                status = update(&h_alpha, &one);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = diagonal(w, &h_alpha, D, BP);
+        }
+        else if(!solve)
+        {
+            status = diagonal(w, &h_alpha, D, BP);
+            if(status == HIPBLAS_STATUS_SUCCESS && rl)
+                status = update(&h_alpha, &one);
+        }
+        else if(scatter)
+        {
+            // The first panel solved scales the rest of B by alpha
+            const T* a = s ? &one : &h_alpha;
+            status     = diagonal(w, a, D, BP);
+            if(status == HIPBLAS_STATUS_SUCCESS && rl)
+                status = update(&minus_one, a);
+        }
+        else
+        {
+            status = rl ? update(&minus_one, &h_alpha) : HIPBLAS_STATUS_SUCCESS;
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = diagonal(w, rl ? &one : &h_alpha, D, BP);
+        }
+    }
+
+    hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+    return status != HIPBLAS_STATUS_SUCCESS ? status : restore;
+}
+
+extern "C" hipblasStatus_t hipblasStpmm(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const float*       alpha,
+                                        const float*       AP,
+                                        float*             B,
+                                        int                ldb)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb);
+    return hipblasTpmm<float>(handle,
+                              false,
+                              side,
+                              uplo,
+                              transA,
+                              diag,
+                              m,
+                              n,
+                              alpha,
+                              AP,
+                              nullptr,
+                              0,
+                              B,
+                              nullptr,
+                              ldb,
+                              0,
+                              1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtpmm(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const double*      alpha,
+                                        const double*      AP,
+                                        double*            B,
+                                        int                ldb)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb);
+    return hipblasTpmm<double>(handle,
+                               false,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               AP,
+                               nullptr,
+                               0,
+                               B,
+                               nullptr,
+                               ldb,
+                               0,
+                               1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtpmm(hipblasHandle_t       handle,
+                                        hipblasSideMode_t     side,
+                                        hipblasFillMode_t     uplo,
+                                        hipblasOperation_t    transA,
+                                        hipblasDiagType_t     diag,
+                                        int                   m,
+                                        int                   n,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* AP,
+                                        hipblasComplex*       B,
+                                        int                   ldb)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb);
+    return hipblasTpmm<hipblasComplex>(handle,
+                                       false,
+                                       side,
+                                       uplo,
+                                       transA,
+                                       diag,
+                                       m,
+                                       n,
+                                       alpha,
+                                       AP,
+                                       nullptr,
+                                       0,
+                                       B,
+                                       nullptr,
+                                       ldb,
+                                       0,
+                                       1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtpmm(hipblasHandle_t             handle,
+                                        hipblasSideMode_t           side,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        hipblasDiagType_t           diag,
+                                        int                         m,
+                                        int                         n,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* AP,
+                                        hipblasDoubleComplex*       B,
+                                        int                         ldb)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb);
+    return hipblasTpmm<hipblasDoubleComplex>(handle,
+                                             false,
+                                             side,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             m,
+                                             n,
+                                             alpha,
+                                             AP,
+                                             nullptr,
+                                             0,
+                                             B,
+                                             nullptr,
+                                             ldb,
+                                             0,
+                                             1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStpmmBatched(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int                m,
+                                               int                n,
+                                               const float*       alpha,
+                                               const float* const AP[],
+                                               float* const       B[],
+                                               int                ldb,
+                                               int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb, batchCount);
+    return hipblasTpmm<float>(handle,
+                              false,
+                              side,
+                              uplo,
+                              transA,
+                              diag,
+                              m,
+                              n,
+                              alpha,
+                              nullptr,
+                              AP,
+                              0,
+                              nullptr,
+                              B,
+                              ldb,
+                              0,
+                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtpmmBatched(hipblasHandle_t     handle,
+                                               hipblasSideMode_t   side,
+                                               hipblasFillMode_t   uplo,
+                                               hipblasOperation_t  transA,
+                                               hipblasDiagType_t   diag,
+                                               int                 m,
+                                               int                 n,
+                                               const double*       alpha,
+                                               const double* const AP[],
+                                               double* const       B[],
+                                               int                 ldb,
+                                               int                 batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb, batchCount);
+    return hipblasTpmm<double>(handle,
+                               false,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               nullptr,
+                               AP,
+                               0,
+                               nullptr,
+                               B,
+                               ldb,
+                               0,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtpmmBatched(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int                         m,
+                                               int                         n,
+                                               const hipblasComplex*       alpha,
+                                               const hipblasComplex* const AP[],
+                                               hipblasComplex* const       B[],
+                                               int                         ldb,
+                                               int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb, batchCount);
+    return hipblasTpmm<hipblasComplex>(handle,
+                                       false,
+                                       side,
+                                       uplo,
+                                       transA,
+                                       diag,
+                                       m,
+                                       n,
+                                       alpha,
+                                       nullptr,
+                                       AP,
+                                       0,
+                                       nullptr,
+                                       B,
+                                       ldb,
+                                       0,
+                                       batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtpmmBatched(hipblasHandle_t                   handle,
+                                               hipblasSideMode_t                 side,
+                                               hipblasFillMode_t                 uplo,
+                                               hipblasOperation_t                transA,
+                                               hipblasDiagType_t                 diag,
+                                               int                               m,
+                                               int                               n,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const AP[],
+                                               hipblasDoubleComplex* const       B[],
+                                               int                               ldb,
+                                               int                               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb, batchCount);
+    return hipblasTpmm<hipblasDoubleComplex>(handle,
+                                             false,
+                                             side,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             m,
+                                             n,
+                                             alpha,
+                                             nullptr,
+                                             AP,
+                                             0,
+                                             nullptr,
+                                             B,
+                                             ldb,
+                                             0,
+                                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStpmmStridedBatched(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int                m,
+                                                      int                n,
+                                                      const float*       alpha,
+                                                      const float*       AP,
+                                                      hipblasStride      strideAP,
+                                                      float*             B,
+                                                      int                ldb,
+                                                      hipblasStride      strideB,
+                                                      int                batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, strideAP, B, ldb, strideB, batchCount);
+    return hipblasTpmm<float>(handle,
+                              false,
+                              side,
+                              uplo,
+                              transA,
+                              diag,
+                              m,
+                              n,
+                              alpha,
+                              AP,
+                              nullptr,
+                              strideAP,
+                              B,
+                              nullptr,
+                              ldb,
+                              strideB,
+                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtpmmStridedBatched(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int                m,
+                                                      int                n,
+                                                      const double*      alpha,
+                                                      const double*      AP,
+                                                      hipblasStride      strideAP,
+                                                      double*            B,
+                                                      int                ldb,
+                                                      hipblasStride      strideB,
+                                                      int                batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, strideAP, B, ldb, strideB, batchCount);
+    return hipblasTpmm<double>(handle,
+                               false,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               AP,
+                               nullptr,
+                               strideAP,
+                               B,
+                               nullptr,
+                               ldb,
+                               strideB,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtpmmStridedBatched(hipblasHandle_t       handle,
+                                                      hipblasSideMode_t     side,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      hipblasDiagType_t     diag,
+                                                      int                   m,
+                                                      int                   n,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* AP,
+                                                      hipblasStride         strideAP,
+                                                      hipblasComplex*       B,
+                                                      int                   ldb,
+                                                      hipblasStride         strideB,
+                                                      int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, strideAP, B, ldb, strideB, batchCount);
+    return hipblasTpmm<hipblasComplex>(handle,
+                                       false,
+                                       side,
+                                       uplo,
+                                       transA,
+                                       diag,
+                                       m,
+                                       n,
+                                       alpha,
+                                       AP,
+                                       nullptr,
+                                       strideAP,
+                                       B,
+                                       nullptr,
+                                       ldb,
+                                       strideB,
+                                       batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtpmmStridedBatched(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int                         m,
+                                                      int                         n,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* AP,
+                                                      hipblasStride               strideAP,
+                                                      hipblasDoubleComplex*       B,
+                                                      int                         ldb,
+                                                      hipblasStride               strideB,
+                                                      int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, strideAP, B, ldb, strideB, batchCount);
+    return hipblasTpmm<hipblasDoubleComplex>(handle,
+                                             false,
+                                             side,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             m,
+                                             n,
+                                             alpha,
+                                             AP,
+                                             nullptr,
+                                             strideAP,
+                                             B,
+                                             nullptr,
+                                             ldb,
+                                             strideB,
+                                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStpsm(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const float*       alpha,
+                                        const float*       AP,
+                                        float*             B,
+                                        int                ldb)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb);
+    return hipblasTpmm<float>(
+        handle, true, side, uplo, transA, diag, m, n, alpha, AP, nullptr, 0, B, nullptr, ldb, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtpsm(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const double*      alpha,
+                                        const double*      AP,
+                                        double*            B,
+                                        int                ldb)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb);
+    return hipblasTpmm<double>(
+        handle, true, side, uplo, transA, diag, m, n, alpha, AP, nullptr, 0, B, nullptr, ldb, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtpsm(hipblasHandle_t       handle,
+                                        hipblasSideMode_t     side,
+                                        hipblasFillMode_t     uplo,
+                                        hipblasOperation_t    transA,
+                                        hipblasDiagType_t     diag,
+                                        int                   m,
+                                        int                   n,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* AP,
+                                        hipblasComplex*       B,
+                                        int                   ldb)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb);
+    return hipblasTpmm<hipblasComplex>(
+        handle, true, side, uplo, transA, diag, m, n, alpha, AP, nullptr, 0, B, nullptr, ldb, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtpsm(hipblasHandle_t             handle,
+                                        hipblasSideMode_t           side,
+                                        hipblasFillMode_t           uplo,
+                                        hipblasOperation_t          transA,
+                                        hipblasDiagType_t           diag,
+                                        int                         m,
+                                        int                         n,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* AP,
+                                        hipblasDoubleComplex*       B,
+                                        int                         ldb)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb);
+    return hipblasTpmm<hipblasDoubleComplex>(
+        handle, true, side, uplo, transA, diag, m, n, alpha, AP, nullptr, 0, B, nullptr, ldb, 0, 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStpsmBatched(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int                m,
+                                               int                n,
+                                               const float*       alpha,
+                                               const float* const AP[],
+                                               float* const       B[],
+                                               int                ldb,
+                                               int                batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb, batchCount);
+    return hipblasTpmm<float>(handle,
+                              true,
+                              side,
+                              uplo,
+                              transA,
+                              diag,
+                              m,
+                              n,
+                              alpha,
+                              nullptr,
+                              AP,
+                              0,
+                              nullptr,
+                              B,
+                              ldb,
+                              0,
+                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtpsmBatched(hipblasHandle_t     handle,
+                                               hipblasSideMode_t   side,
+                                               hipblasFillMode_t   uplo,
+                                               hipblasOperation_t  transA,
+                                               hipblasDiagType_t   diag,
+                                               int                 m,
+                                               int                 n,
+                                               const double*       alpha,
+                                               const double* const AP[],
+                                               double* const       B[],
+                                               int                 ldb,
+                                               int                 batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb, batchCount);
+    return hipblasTpmm<double>(handle,
+                               true,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               nullptr,
+                               AP,
+                               0,
+                               nullptr,
+                               B,
+                               ldb,
+                               0,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtpsmBatched(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int                         m,
+                                               int                         n,
+                                               const hipblasComplex*       alpha,
+                                               const hipblasComplex* const AP[],
+                                               hipblasComplex* const       B[],
+                                               int                         ldb,
+                                               int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb, batchCount);
+    return hipblasTpmm<hipblasComplex>(handle,
+                                       true,
+                                       side,
+                                       uplo,
+                                       transA,
+                                       diag,
+                                       m,
+                                       n,
+                                       alpha,
+                                       nullptr,
+                                       AP,
+                                       0,
+                                       nullptr,
+                                       B,
+                                       ldb,
+                                       0,
+                                       batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtpsmBatched(hipblasHandle_t                   handle,
+                                               hipblasSideMode_t                 side,
+                                               hipblasFillMode_t                 uplo,
+                                               hipblasOperation_t                transA,
+                                               hipblasDiagType_t                 diag,
+                                               int                               m,
+                                               int                               n,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const AP[],
+                                               hipblasDoubleComplex* const       B[],
+                                               int                               ldb,
+                                               int                               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, side, uplo, transA, diag, m, n, alpha, AP, B, ldb, batchCount);
+    return hipblasTpmm<hipblasDoubleComplex>(handle,
+                                             true,
+                                             side,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             m,
+                                             n,
+                                             alpha,
+                                             nullptr,
+                                             AP,
+                                             0,
+                                             nullptr,
+                                             B,
+                                             ldb,
+                                             0,
+                                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStpsmStridedBatched(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int                m,
+                                                      int                n,
+                                                      const float*       alpha,
+                                                      const float*       AP,
+                                                      hipblasStride      strideAP,
+                                                      float*             B,
+                                                      int                ldb,
+                                                      hipblasStride      strideB,
+                                                      int                batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, strideAP, B, ldb, strideB, batchCount);
+    return hipblasTpmm<float>(handle,
+                              true,
+                              side,
+                              uplo,
+                              transA,
+                              diag,
+                              m,
+                              n,
+                              alpha,
+                              AP,
+                              nullptr,
+                              strideAP,
+                              B,
+                              nullptr,
+                              ldb,
+                              strideB,
+                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtpsmStridedBatched(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int                m,
+                                                      int                n,
+                                                      const double*      alpha,
+                                                      const double*      AP,
+                                                      hipblasStride      strideAP,
+                                                      double*            B,
+                                                      int                ldb,
+                                                      hipblasStride      strideB,
+                                                      int                batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, strideAP, B, ldb, strideB, batchCount);
+    return hipblasTpmm<double>(handle,
+                               true,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               AP,
+                               nullptr,
+                               strideAP,
+                               B,
+                               nullptr,
+                               ldb,
+                               strideB,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtpsmStridedBatched(hipblasHandle_t       handle,
+                                                      hipblasSideMode_t     side,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      hipblasDiagType_t     diag,
+                                                      int                   m,
+                                                      int                   n,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* AP,
+                                                      hipblasStride         strideAP,
+                                                      hipblasComplex*       B,
+                                                      int                   ldb,
+                                                      hipblasStride         strideB,
+                                                      int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, strideAP, B, ldb, strideB, batchCount);
+    return hipblasTpmm<hipblasComplex>(handle,
+                                       true,
+                                       side,
+                                       uplo,
+                                       transA,
+                                       diag,
+                                       m,
+                                       n,
+                                       alpha,
+                                       AP,
+                                       nullptr,
+                                       strideAP,
+                                       B,
+                                       nullptr,
+                                       ldb,
+                                       strideB,
+                                       batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtpsmStridedBatched(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int                         m,
+                                                      int                         n,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* AP,
+                                                      hipblasStride               strideAP,
+                                                      hipblasDoubleComplex*       B,
+                                                      int                         ldb,
+                                                      hipblasStride               strideB,
+                                                      int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(
+        handle, side, uplo, transA, diag, m, n, alpha, AP, strideAP, B, ldb, strideB, batchCount);
+    return hipblasTpmm<hipblasDoubleComplex>(handle,
+                                             true,
+                                             side,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             m,
+                                             n,
+                                             alpha,
+                                             AP,
+                                             nullptr,
+                                             strideAP,
+                                             B,
+                                             nullptr,
+                                             ldb,
+                                             strideB,
+                                             batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
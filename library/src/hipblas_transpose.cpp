@@ -0,0 +1,261 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "transpose.hpp"
+#include <algorithm>
+
+#ifndef HIPBLAS_TRANSPOSE
+template <typename T>
+struct hipblasTransposeGeamFunctions;
+
+template <>
+struct hipblasTransposeGeamFunctions<float>
+{
+    static constexpr auto geam          = hipblasSgeam;
+    static constexpr auto batched       = hipblasSgeamBatched;
+    static constexpr auto strideBatched = hipblasSgeamStridedBatched;
+};
+
+template <>
+struct hipblasTransposeGeamFunctions<double>
+{
+    static constexpr auto geam          = hipblasDgeam;
+    static constexpr auto batched       = hipblasDgeamBatched;
+    static constexpr auto strideBatched = hipblasDgeamStridedBatched;
+};
+
+// C := 1 * A^T + 0 * C through geam in host pointer mode, with B = C, which geam allows as
+// ldb == ldc and transb == HIPBLAS_OP_N
+template <typename T>
+static hipblasStatus_t hipblasTransposeGeam(hipblasHandle_t    handle,
+                                            int                m,
+                                            int                n,
+                                            const void*        A,
+                                            const void* const* A_array,
+                                            int                lda,
+                                            hipblasStride      strideA,
+                                            void*              C,
+                                            void* const*       C_array,
+                                            int                ldc,
+                                            hipblasStride      strideC,
+                                            int                batchCount,
+                                            bool               strided)
+{
+    using F = hipblasTransposeGeamFunctions<T>;
+
+    const T         one = 1, zero = 0;
+    const T*        a       = (const T*)A;
+    T*              c       = (T*)C;
+    const T* const* a_array = (const T* const*)A_array;
+    T* const*       c_array = (T* const*)C_array;
+
+    hipblasPointerMode_t pointer_mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(A_array)
+        status = F::batched(handle,
+                            HIPBLAS_OP_T,
+                            HIPBLAS_OP_N,
+                            n,
+                            m,
+                            &one,
+                            a_array,
+                            lda,
+                            &zero,
+                            c_array,
+                            ldc,
+                            c_array,
+                            ldc,
+                            batchCount);
+    else if(strided)
+        status = F::strideBatched(handle,
+                                  HIPBLAS_OP_T,
+                                  HIPBLAS_OP_N,
+                                  n,
+                                  m,
+                                  &one,
+                                  a,
+                                  lda,
+                                  strideA,
+                                  &zero,
+                                  c,
+                                  ldc,
+                                  strideC,
+                                  c,
+                                  ldc,
+                                  strideC,
+                                  batchCount);
+    else
+        status = F::geam(
+            handle, HIPBLAS_OP_T, HIPBLAS_OP_N, n, m, &one, a, lda, &zero, c, ldc, c, ldc);
+
+    hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+    return status == HIPBLAS_STATUS_SUCCESS ? restore : status;
+}
+#endif
+
+// Checks the arguments of the three forms, where A_array and C_array are the pointer arrays of the
+// batched form and null otherwise, then runs the transpose kernels. Without them, out-of-place
+// HIP_R_32F and HIP_R_64F transposes run geam and the others return HIPBLAS_STATUS_NOT_SUPPORTED.
+static hipblasStatus_t hipblasTranspose(hipblasHandle_t    handle,
+                                        int                m,
+                                        int                n,
+                                        const void*        A,
+                                        const void* const* A_array,
+                                        hipDataType        aType,
+                                        int                lda,
+                                        hipblasStride      strideA,
+                                        void*              C,
+                                        void* const*       C_array,
+                                        hipDataType        cType,
+                                        int                ldc,
+                                        hipblasStride      strideC,
+                                        int                batchCount,
+                                        bool               strided)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || batchCount < 0 || lda < std::max(1, m) || ldc < std::max(1, n))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    bool batched  = A_array || C_array;
+    bool in_place = batched ? (const void*)A_array == (const void*)C_array : A == C;
+    if(batched ? !A_array || !C_array : !A || !C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(in_place && (m != n || lda != ldc || aType != cType || strideA != strideC))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+#ifdef HIPBLAS_TRANSPOSE
+    return hipblasTransposeKernels(handle,
+                                   m,
+                                   n,
+                                   A,
+                                   A_array,
+                                   aType,
+                                   lda,
+                                   strideA,
+                                   C,
+                                   C_array,
+                                   cType,
+                                   ldc,
+                                   strideC,
+                                   batchCount,
+                                   in_place);
+#else
+    if(in_place || aType != cType)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(aType == HIP_R_32F)
+        return hipblasTransposeGeam<float>(
+            handle, m, n, A, A_array, lda, strideA, C, C_array, ldc, strideC, batchCount, strided);
+    if(aType == HIP_R_64F)
+        return hipblasTransposeGeam<double>(
+            handle, m, n, A, A_array, lda, strideA, C, C_array, ldc, strideC, batchCount, strided);
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+extern "C" hipblasStatus_t hipblasTransposeEx(hipblasHandle_t handle,
+                                              int             m,
+                                              int             n,
+                                              const void*     A,
+                                              hipDataType     aType,
+                                              int             lda,
+                                              void*           C,
+                                              hipDataType     cType,
+                                              int             ldc)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, A, aType, lda, C, cType, ldc);
+    return hipblasTranspose(
+        handle, m, n, A, nullptr, aType, lda, 0, C, nullptr, cType, ldc, 0, 1, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasTransposeBatchedEx(hipblasHandle_t   handle,
+                                                     int               m,
+                                                     int               n,
+                                                     const void* const A[],
+                                                     hipDataType       aType,
+                                                     int               lda,
+                                                     void* const       C[],
+                                                     hipDataType       cType,
+                                                     int               ldc,
+                                                     int               batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, A, aType, lda, C, cType, ldc, batchCount);
+    return hipblasTranspose(
+        handle, m, n, nullptr, A, aType, lda, 0, nullptr, C, cType, ldc, 0, batchCount, false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasTransposeStridedBatchedEx(hipblasHandle_t handle,
+                                                            int             m,
+                                                            int             n,
+                                                            const void*     A,
+                                                            hipDataType     aType,
+                                                            int             lda,
+                                                            hipblasStride   strideA,
+                                                            void*           C,
+                                                            hipDataType     cType,
+                                                            int             ldc,
+                                                            hipblasStride   strideC,
+                                                            int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, m, n, A, aType, lda, strideA, C, cType, ldc, strideC, batchCount);
+    return hipblasTranspose(handle,
+                            m,
+                            n,
+                            A,
+                            nullptr,
+                            aType,
+                            lda,
+                            strideA,
+                            C,
+                            nullptr,
+                            cType,
+                            ldc,
+                            strideC,
+                            batchCount,
+                            true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,251 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "transpose.hpp"
+#include "convert_device.hpp"
+#include <algorithm>
+#include <type_traits>
+
+// Rows and columns of the tile of a work group, and rows of threads: each thread moves
+// transpose_tile / transpose_rows elements of the tile
+constexpr int transpose_tile = 32;
+constexpr int transpose_rows = 8;
+
+// Largest grid in y and z. The work groups loop over the remaining column tiles and matrices.
+constexpr int transpose_max_grid = 65535;
+
+// Work group (x, y) moves the tile of A at rows x * transpose_tile and columns y * transpose_tile
+template <typename Ta, typename Tc>
+__global__ void __launch_bounds__(transpose_tile* transpose_rows)
+    hipblasTransposeKernel(int              m,
+                           int              n,
+                           const Ta*        A,
+                           const Ta* const* A_array,
+                           int              lda,
+                           hipblasStride    stride_A,
+                           Tc*              C,
+                           Tc* const*       C_array,
+                           int              ldc,
+                           hipblasStride    stride_C,
+                           int              batch_count)
+{
+    // One padding column, so that the threads reading a row of the tile use every bank
+    __shared__ Tc tile[transpose_tile][transpose_tile + 1];
+
+    int tx      = threadIdx.x;
+    int i0      = blockIdx.x * transpose_tile;
+    int n_tiles = (n + transpose_tile - 1) / transpose_tile;
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        const Ta* a = A_array ? A_array[b] : A + b * stride_A;
+        Tc*       c = C_array ? C_array[b] : C + b * stride_C;
+        for(int jt = blockIdx.y; jt < n_tiles; jt += gridDim.y)
+        {
+            int j0 = jt * transpose_tile;
+
+            // tile[j][i] holds A(i0 + i, j0 + j)
+            for(int j = threadIdx.y; j < transpose_tile; j += transpose_rows)
+                if(i0 + tx < m && j0 + j < n)
+                    tile[j][tx] = hipblasDeviceCast<Tc>(a[i0 + tx + size_t(j0 + j) * lda]);
+            __syncthreads();
+
+            // C(j0 + j, i0 + i) = A(i0 + i, j0 + j)
+            for(int i = threadIdx.y; i < transpose_tile; i += transpose_rows)
+                if(j0 + tx < n && i0 + i < m)
+                    c[j0 + tx + size_t(i0 + i) * ldc] = tile[tx][i];
+            __syncthreads();
+        }
+    }
+}
+
+// Work group (x, y), for x <= y, swaps the transposes of the tiles of the n by n A at rows
+// x * transpose_tile and columns y * transpose_tile and at the mirrored position
+template <typename T>
+__global__ void __launch_bounds__(transpose_tile* transpose_rows)
+    hipblasTransposeInPlaceKernel(
+        int n, T* A, T* const* A_array, int lda, hipblasStride stride_A, int batch_count)
+{
+    __shared__ T upper[transpose_tile][transpose_tile + 1];
+    __shared__ T lower[transpose_tile][transpose_tile + 1];
+
+    int tx      = threadIdx.x;
+    int i0      = blockIdx.x * transpose_tile;
+    int n_tiles = (n + transpose_tile - 1) / transpose_tile;
+    for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        T* a = A_array ? A_array[b] : A + b * stride_A;
+        for(int jt = blockIdx.y; jt < n_tiles; jt += gridDim.y)
+        {
+            // The tiles below the diagonal are swapped with their mirror
+            if(int(blockIdx.x) > jt)
+                continue;
+
+            int  j0       = jt * transpose_tile;
+            bool diagonal = i0 == j0;
+
+            // upper[j][i] holds A(i0 + i, j0 + j) and lower[j][i] holds A(j0 + i, i0 + j)
+            for(int j = threadIdx.y; j < transpose_tile; j += transpose_rows)
+            {
+                if(i0 + tx < n && j0 + j < n)
+                    upper[j][tx] = a[i0 + tx + size_t(j0 + j) * lda];
+                if(!diagonal && j0 + tx < n && i0 + j < n)
+                    lower[j][tx] = a[j0 + tx + size_t(i0 + j) * lda];
+            }
+            __syncthreads();
+
+            for(int i = threadIdx.y; i < transpose_tile; i += transpose_rows)
+            {
+                if(j0 + tx < n && i0 + i < n)
+                    a[j0 + tx + size_t(i0 + i) * lda] = upper[tx][i];
+                if(!diagonal && i0 + tx < n && j0 + i < n)
+                    a[i0 + tx + size_t(j0 + i) * lda] = lower[tx][i];
+            }
+            __syncthreads();
+        }
+    }
+}
+
+template <typename Ta, typename Tc>
+static hipblasStatus_t hipblasTransposeLaunch(hipblasHandle_t    handle,
+                                              int                m,
+                                              int                n,
+                                              const void*        A,
+                                              const void* const* A_array,
+                                              int                lda,
+                                              hipblasStride      stride_A,
+                                              void*              C,
+                                              void* const*       C_array,
+                                              int                ldc,
+                                              hipblasStride      stride_C,
+                                              int                batch_count,
+                                              bool               in_place)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int  m_tiles = (m + transpose_tile - 1) / transpose_tile;
+    int  n_tiles = (n + transpose_tile - 1) / transpose_tile;
+    dim3 grid(
+        m_tiles, std::min(n_tiles, transpose_max_grid), std::min(batch_count, transpose_max_grid));
+    dim3 threads(transpose_tile, transpose_rows);
+
+    if constexpr(std::is_same<Ta, Tc>{})
+    {
+        if(in_place)
+            hipLaunchKernelGGL(hipblasTransposeInPlaceKernel<Ta>,
+                               grid,
+                               threads,
+                               0,
+                               stream,
+                               n,
+                               (Ta*)C,
+                               (Ta* const*)C_array,
+                               lda,
+                               stride_A,
+                               batch_count);
+    }
+    if(!in_place)
+        hipLaunchKernelGGL((hipblasTransposeKernel<Ta, Tc>),
+                           grid,
+                           threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           (const Ta*)A,
+                           (const Ta* const*)A_array,
+                           lda,
+                           stride_A,
+                           (Tc*)C,
+                           (Tc* const*)C_array,
+                           ldc,
+                           stride_C,
+                           batch_count);
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblasTransposeKernels(hipblasHandle_t    handle,
+                                        int                m,
+                                        int                n,
+                                        const void*        A,
+                                        const void* const* A_array,
+                                        hipDataType        a_type,
+                                        int                lda,
+                                        hipblasStride      stride_A,
+                                        void*              C,
+                                        void* const*       C_array,
+                                        hipDataType        c_type,
+                                        int                ldc,
+                                        hipblasStride      stride_C,
+                                        int                batch_count,
+                                        bool               in_place)
+{
+    auto launch = [&](auto a, auto c) {
+        return hipblasTransposeLaunch<decltype(a), decltype(c)>(handle,
+                                                                m,
+                                                                n,
+                                                                A,
+                                                                A_array,
+                                                                lda,
+                                                                stride_A,
+                                                                C,
+                                                                C_array,
+                                                                ldc,
+                                                                stride_C,
+                                                                batch_count,
+                                                                in_place);
+    };
+
+    if(a_type == c_type)
+    {
+        switch(a_type)
+        {
+        case HIP_R_16F:
+            return launch(__half(), __half());
+        case HIP_R_16BF:
+            return launch(hipblasDeviceBfloat16(), hipblasDeviceBfloat16());
+        case HIP_R_32F:
+            return launch(float(), float());
+        case HIP_R_64F:
+            return launch(double(), double());
+        default:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    if(in_place)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(a_type == HIP_R_32F && c_type == HIP_R_16F)
+        return launch(float(), __half());
+    if(a_type == HIP_R_32F && c_type == HIP_R_16BF)
+        return launch(float(), hipblasDeviceBfloat16());
+    if(a_type == HIP_R_16F && c_type == HIP_R_32F)
+        return launch(__half(), float());
+    if(a_type == HIP_R_16BF && c_type == HIP_R_32F)
+        return launch(hipblasDeviceBfloat16(), float());
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
@@ -0,0 +1,986 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "layout.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <vector>
+
+// hipBLAS functions of each precision run by the out-of-place trsm
+template <typename T>
+struct hipblasTrsmOutOfPlaceFunctions;
+
+template <>
+struct hipblasTrsmOutOfPlaceFunctions<float>
+{
+    static constexpr auto geam               = hipblasSgeam;
+    static constexpr auto geamBatched        = hipblasSgeamBatched;
+    static constexpr auto geamStridedBatched = hipblasSgeamStridedBatched;
+    static constexpr auto trsm               = hipblasStrsm;
+    static constexpr auto trsmBatched        = hipblasStrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasStrsmStridedBatched;
+};
+
+template <>
+struct hipblasTrsmOutOfPlaceFunctions<double>
+{
+    static constexpr auto geam               = hipblasDgeam;
+    static constexpr auto geamBatched        = hipblasDgeamBatched;
+    static constexpr auto geamStridedBatched = hipblasDgeamStridedBatched;
+    static constexpr auto trsm               = hipblasDtrsm;
+    static constexpr auto trsmBatched        = hipblasDtrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasDtrsmStridedBatched;
+};
+
+template <>
+struct hipblasTrsmOutOfPlaceFunctions<hipblasComplex>
+{
+    static constexpr auto geam               = hipblasCgeam;
+    static constexpr auto geamBatched        = hipblasCgeamBatched;
+    static constexpr auto geamStridedBatched = hipblasCgeamStridedBatched;
+    static constexpr auto trsm               = hipblasCtrsm;
+    static constexpr auto trsmBatched        = hipblasCtrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasCtrsmStridedBatched;
+};
+
+template <>
+struct hipblasTrsmOutOfPlaceFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto geam               = hipblasZgeam;
+    static constexpr auto geamBatched        = hipblasZgeamBatched;
+    static constexpr auto geamStridedBatched = hipblasZgeamStridedBatched;
+    static constexpr auto trsm               = hipblasZtrsm;
+    static constexpr auto trsmBatched        = hipblasZtrsmBatched;
+    static constexpr auto trsmStridedBatched = hipblasZtrsmStridedBatched;
+};
+
+// C_i := B_i, in host pointer mode, as geam C_i = 1 B_i + 0 C_i. A strided batch whose B_i and
+// C_i lie side by side is one geam, and batched forms that the backend does not have, which
+// cuBLAS lacks, run one geam per instance, reading the pointer arrays back for the batched form.
+template <typename T>
+static hipblasStatus_t hipblasTrsmOutOfPlaceCopy(hipblasHandle_t handle,
+                                                 int             m,
+                                                 int             n,
+                                                 const T*        B,
+                                                 const T* const* B_array,
+                                                 int             ldb,
+                                                 hipblasStride   strideB,
+                                                 T*              C,
+                                                 T* const*       C_array,
+                                                 int             ldc,
+                                                 hipblasStride   strideC,
+                                                 int             batchCount,
+                                                 bool            strided)
+{
+    using F = hipblasTrsmOutOfPlaceFunctions<T>;
+
+    const T one = 1, zero = 0;
+    bool    batched = B_array != nullptr;
+    bool    merged  = strided && strideB == hipblasStride(ldb) * n
+                  && strideC == hipblasStride(ldc) * n
+                  && int64_t(n) * batchCount <= std::numeric_limits<int>::max();
+
+    if(!batched && (!strided || batchCount == 1 || merged))
+    {
+        int cols = merged ? n * batchCount : n;
+        return F::geam(handle,
+                       HIPBLAS_OP_N,
+                       HIPBLAS_OP_N,
+                       m,
+                       cols,
+                       &one,
+                       B,
+                       ldb,
+                       &zero,
+                       C,
+                       ldc,
+                       C,
+                       ldc);
+    }
+
+    hipblasStatus_t status
+        = batched ? F::geamBatched(handle,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   m,
+                                   n,
+                                   &one,
+                                   B_array,
+                                   ldb,
+                                   &zero,
+                                   (const T* const*)C_array,
+                                   ldc,
+                                   C_array,
+                                   ldc,
+                                   batchCount)
+                  : F::geamStridedBatched(handle,
+                                          HIPBLAS_OP_N,
+                                          HIPBLAS_OP_N,
+                                          m,
+                                          n,
+                                          &one,
+                                          B,
+                                          ldb,
+                                          strideB,
+                                          &zero,
+                                          C,
+                                          ldc,
+                                          strideC,
+                                          C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+
+    std::vector<const T*> B_host(batchCount);
+    std::vector<T*>       C_host(batchCount);
+    if(batched)
+    {
+        hipStream_t stream;
+        status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(hipMemcpyAsync(B_host.data(),
+                          B_array,
+                          sizeof(T*) * batchCount,
+                          hipMemcpyDeviceToHost,
+                          stream)
+               != hipSuccess
+           || hipMemcpyAsync(C_host.data(),
+                             C_array,
+                             sizeof(T*) * batchCount,
+                             hipMemcpyDeviceToHost,
+                             stream)
+                  != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    else
+    {
+        for(int b = 0; b < batchCount; b++)
+        {
+            B_host[b] = B + b * strideB;
+            C_host[b] = C + b * strideC;
+        }
+    }
+
+    status = HIPBLAS_STATUS_SUCCESS;
+    for(int b = 0; b < batchCount && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = F::geam(handle,
+                         HIPBLAS_OP_N,
+                         HIPBLAS_OP_N,
+                         m,
+                         n,
+                         &one,
+                         B_host[b],
+                         ldb,
+                         &zero,
+                         C_host[b],
+                         ldc,
+                         C_host[b],
+                         ldc);
+    return status;
+}
+
+// op(A_i) X_i = alpha B_i or X_i op(A_i) = alpha B_i with X_i written to C_i and B_i unchanged.
+// B_i is copied to C_i, then C_i is solved in place with the trsm of the same batched form. The
+// copy is left out when C_i is B_i. The arguments are made column-major here, as the inner
+// calls are not the outermost entry point and do not apply the layout of the handle.
+template <typename T>
+static hipblasStatus_t hipblasTrsmOutOfPlace(hipblasHandle_t    handle,
+                                             hipblasSideMode_t  side,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int                m,
+                                             int                n,
+                                             const T*           alpha,
+                                             const T*           A,
+                                             const T* const*    A_array,
+                                             int                lda,
+                                             hipblasStride      strideA,
+                                             const T*           B,
+                                             const T* const*    B_array,
+                                             int                ldb,
+                                             hipblasStride      strideB,
+                                             T*                 C,
+                                             T* const*          C_array,
+                                             int                ldc,
+                                             hipblasStride      strideC,
+                                             int                batchCount,
+                                             bool               strided)
+{
+    using F = hipblasTrsmOutOfPlaceFunctions<T>;
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+       || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+       || (transA != HIPBLAS_OP_N && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+       || (diag != HIPBLAS_DIAG_UNIT && diag != HIPBLAS_DIAG_NON_UNIT))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasLayoutTrsm(side, uplo, m, n);
+
+    int  k       = side == HIPBLAS_SIDE_LEFT ? m : n;
+    bool batched = B_array != nullptr;
+    if(m < 0 || n < 0 || batchCount < 0 || lda < std::max(1, k) || ldb < std::max(1, m)
+       || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || (batched ? !A_array || !C_array : !A || !B || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    bool same = batched ? (const void*)B_array == (const void*)C_array && ldb == ldc
+                        : (const void*)B == (const void*)C && ldb == ldc
+                              && (!strided || batchCount == 1 || strideB == strideC);
+    if(!same)
+    {
+        hipblasPointerMode_t pointer_mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        status = hipblasTrsmOutOfPlaceCopy(
+            handle, m, n, B, B_array, ldb, strideB, C, C_array, ldc, strideC, batchCount, strided);
+
+        hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+        if(status != HIPBLAS_STATUS_SUCCESS || restore != HIPBLAS_STATUS_SUCCESS)
+            return status != HIPBLAS_STATUS_SUCCESS ? status : restore;
+    }
+
+    if(batched)
+        return F::trsmBatched(
+            handle, side, uplo, transA, diag, m, n, alpha, A_array, lda, C_array, ldc, batchCount);
+    if(strided)
+        return F::trsmStridedBatched(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     n,
+                                     alpha,
+                                     A,
+                                     lda,
+                                     strideA,
+                                     C,
+                                     ldc,
+                                     strideC,
+                                     batchCount);
+    return F::trsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, C, ldc);
+}
+
+extern "C" hipblasStatus_t hipblasStrsmOutOfPlace(hipblasHandle_t    handle,
+                                                  hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  hipblasDiagType_t  diag,
+                                                  int                m,
+                                                  int                n,
+                                                  const float*       alpha,
+                                                  const float*       A,
+                                                  int                lda,
+                                                  const float*       B,
+                                                  int                ldb,
+                                                  float*             C,
+                                                  int                ldc)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc);
+    return hipblasTrsmOutOfPlace<float>(handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        nullptr,
+                                        lda,
+                                        0,
+                                        B,
+                                        nullptr,
+                                        ldb,
+                                        0,
+                                        C,
+                                        nullptr,
+                                        ldc,
+                                        0,
+                                        1,
+                                        false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtrsmOutOfPlace(hipblasHandle_t    handle,
+                                                  hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  hipblasDiagType_t  diag,
+                                                  int                m,
+                                                  int                n,
+                                                  const double*      alpha,
+                                                  const double*      A,
+                                                  int                lda,
+                                                  const double*      B,
+                                                  int                ldb,
+                                                  double*            C,
+                                                  int                ldc)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc);
+    return hipblasTrsmOutOfPlace<double>(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         nullptr,
+                                         lda,
+                                         0,
+                                         B,
+                                         nullptr,
+                                         ldb,
+                                         0,
+                                         C,
+                                         nullptr,
+                                         ldc,
+                                         0,
+                                         1,
+                                         false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtrsmOutOfPlace(hipblasHandle_t       handle,
+                                                  hipblasSideMode_t     side,
+                                                  hipblasFillMode_t     uplo,
+                                                  hipblasOperation_t    transA,
+                                                  hipblasDiagType_t     diag,
+                                                  int                   m,
+                                                  int                   n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int                   lda,
+                                                  const hipblasComplex* B,
+                                                  int                   ldb,
+                                                  hipblasComplex*       C,
+                                                  int                   ldc)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc);
+    return hipblasTrsmOutOfPlace<hipblasComplex>(handle,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 m,
+                                                 n,
+                                                 alpha,
+                                                 A,
+                                                 nullptr,
+                                                 lda,
+                                                 0,
+                                                 B,
+                                                 nullptr,
+                                                 ldb,
+                                                 0,
+                                                 C,
+                                                 nullptr,
+                                                 ldc,
+                                                 0,
+                                                 1,
+                                                 false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtrsmOutOfPlace(hipblasHandle_t             handle,
+                                                  hipblasSideMode_t           side,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int                         m,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int                         lda,
+                                                  const hipblasDoubleComplex* B,
+                                                  int                         ldb,
+                                                  hipblasDoubleComplex*       C,
+                                                  int                         ldc)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc);
+    return hipblasTrsmOutOfPlace<hipblasDoubleComplex>(handle,
+                                                       side,
+                                                       uplo,
+                                                       transA,
+                                                       diag,
+                                                       m,
+                                                       n,
+                                                       alpha,
+                                                       A,
+                                                       nullptr,
+                                                       lda,
+                                                       0,
+                                                       B,
+                                                       nullptr,
+                                                       ldb,
+                                                       0,
+                                                       C,
+                                                       nullptr,
+                                                       ldc,
+                                                       0,
+                                                       1,
+                                                       false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStrsmBatchedOutOfPlace(hipblasHandle_t    handle,
+                                                         hipblasSideMode_t  side,
+                                                         hipblasFillMode_t  uplo,
+                                                         hipblasOperation_t transA,
+                                                         hipblasDiagType_t  diag,
+                                                         int                m,
+                                                         int                n,
+                                                         const float*       alpha,
+                                                         const float* const A[],
+                                                         int                lda,
+                                                         const float* const B[],
+                                                         int                ldb,
+                                                         float* const       C[],
+                                                         int                ldc,
+                                                         int                batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            B,
+                            ldb,
+                            C,
+                            ldc,
+                            batchCount);
+    return hipblasTrsmOutOfPlace<float>(handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        nullptr,
+                                        A,
+                                        lda,
+                                        0,
+                                        nullptr,
+                                        B,
+                                        ldb,
+                                        0,
+                                        nullptr,
+                                        C,
+                                        ldc,
+                                        0,
+                                        batchCount,
+                                        false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtrsmBatchedOutOfPlace(hipblasHandle_t     handle,
+                                                         hipblasSideMode_t   side,
+                                                         hipblasFillMode_t   uplo,
+                                                         hipblasOperation_t  transA,
+                                                         hipblasDiagType_t   diag,
+                                                         int                 m,
+                                                         int                 n,
+                                                         const double*       alpha,
+                                                         const double* const A[],
+                                                         int                 lda,
+                                                         const double* const B[],
+                                                         int                 ldb,
+                                                         double* const       C[],
+                                                         int                 ldc,
+                                                         int                 batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            B,
+                            ldb,
+                            C,
+                            ldc,
+                            batchCount);
+    return hipblasTrsmOutOfPlace<double>(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         nullptr,
+                                         A,
+                                         lda,
+                                         0,
+                                         nullptr,
+                                         B,
+                                         ldb,
+                                         0,
+                                         nullptr,
+                                         C,
+                                         ldc,
+                                         0,
+                                         batchCount,
+                                         false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtrsmBatchedOutOfPlace(hipblasHandle_t             handle,
+                                                         hipblasSideMode_t           side,
+                                                         hipblasFillMode_t           uplo,
+                                                         hipblasOperation_t          transA,
+                                                         hipblasDiagType_t           diag,
+                                                         int                         m,
+                                                         int                         n,
+                                                         const hipblasComplex*       alpha,
+                                                         const hipblasComplex* const A[],
+                                                         int                         lda,
+                                                         const hipblasComplex* const B[],
+                                                         int                         ldb,
+                                                         hipblasComplex* const       C[],
+                                                         int                         ldc,
+                                                         int                         batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            B,
+                            ldb,
+                            C,
+                            ldc,
+                            batchCount);
+    return hipblasTrsmOutOfPlace<hipblasComplex>(handle,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 m,
+                                                 n,
+                                                 alpha,
+                                                 nullptr,
+                                                 A,
+                                                 lda,
+                                                 0,
+                                                 nullptr,
+                                                 B,
+                                                 ldb,
+                                                 0,
+                                                 nullptr,
+                                                 C,
+                                                 ldc,
+                                                 0,
+                                                 batchCount,
+                                                 false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasZtrsmBatchedOutOfPlace(hipblasHandle_t                   handle,
+                                  hipblasSideMode_t                 side,
+                                  hipblasFillMode_t                 uplo,
+                                  hipblasOperation_t                transA,
+                                  hipblasDiagType_t                 diag,
+                                  int                               m,
+                                  int                               n,
+                                  const hipblasDoubleComplex*       alpha,
+                                  const hipblasDoubleComplex* const A[],
+                                  int                               lda,
+                                  const hipblasDoubleComplex* const B[],
+                                  int                               ldb,
+                                  hipblasDoubleComplex* const       C[],
+                                  int                               ldc,
+                                  int                               batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            B,
+                            ldb,
+                            C,
+                            ldc,
+                            batchCount);
+    return hipblasTrsmOutOfPlace<hipblasDoubleComplex>(handle,
+                                                       side,
+                                                       uplo,
+                                                       transA,
+                                                       diag,
+                                                       m,
+                                                       n,
+                                                       alpha,
+                                                       nullptr,
+                                                       A,
+                                                       lda,
+                                                       0,
+                                                       nullptr,
+                                                       B,
+                                                       ldb,
+                                                       0,
+                                                       nullptr,
+                                                       C,
+                                                       ldc,
+                                                       0,
+                                                       batchCount,
+                                                       false);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasStrsmStridedBatchedOutOfPlace(hipblasHandle_t    handle,
+                                                                hipblasSideMode_t  side,
+                                                                hipblasFillMode_t  uplo,
+                                                                hipblasOperation_t transA,
+                                                                hipblasDiagType_t  diag,
+                                                                int                m,
+                                                                int                n,
+                                                                const float*       alpha,
+                                                                const float*       A,
+                                                                int                lda,
+                                                                hipblasStride      strideA,
+                                                                const float*       B,
+                                                                int                ldb,
+                                                                hipblasStride      strideB,
+                                                                float*             C,
+                                                                int                ldc,
+                                                                hipblasStride      strideC,
+                                                                int                batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            strideA,
+                            B,
+                            ldb,
+                            strideB,
+                            C,
+                            ldc,
+                            strideC,
+                            batchCount);
+    return hipblasTrsmOutOfPlace<float>(handle,
+                                        side,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        m,
+                                        n,
+                                        alpha,
+                                        A,
+                                        nullptr,
+                                        lda,
+                                        strideA,
+                                        B,
+                                        nullptr,
+                                        ldb,
+                                        strideB,
+                                        C,
+                                        nullptr,
+                                        ldc,
+                                        strideC,
+                                        batchCount,
+                                        true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtrsmStridedBatchedOutOfPlace(hipblasHandle_t    handle,
+                                                                hipblasSideMode_t  side,
+                                                                hipblasFillMode_t  uplo,
+                                                                hipblasOperation_t transA,
+                                                                hipblasDiagType_t  diag,
+                                                                int                m,
+                                                                int                n,
+                                                                const double*      alpha,
+                                                                const double*      A,
+                                                                int                lda,
+                                                                hipblasStride      strideA,
+                                                                const double*      B,
+                                                                int                ldb,
+                                                                hipblasStride      strideB,
+                                                                double*            C,
+                                                                int                ldc,
+                                                                hipblasStride      strideC,
+                                                                int                batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            strideA,
+                            B,
+                            ldb,
+                            strideB,
+                            C,
+                            ldc,
+                            strideC,
+                            batchCount);
+    return hipblasTrsmOutOfPlace<double>(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         nullptr,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         nullptr,
+                                         ldb,
+                                         strideB,
+                                         C,
+                                         nullptr,
+                                         ldc,
+                                         strideC,
+                                         batchCount,
+                                         true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtrsmStridedBatchedOutOfPlace(hipblasHandle_t       handle,
+                                                                hipblasSideMode_t     side,
+                                                                hipblasFillMode_t     uplo,
+                                                                hipblasOperation_t    transA,
+                                                                hipblasDiagType_t     diag,
+                                                                int                   m,
+                                                                int                   n,
+                                                                const hipblasComplex* alpha,
+                                                                const hipblasComplex* A,
+                                                                int                   lda,
+                                                                hipblasStride         strideA,
+                                                                const hipblasComplex* B,
+                                                                int                   ldb,
+                                                                hipblasStride         strideB,
+                                                                hipblasComplex*       C,
+                                                                int                   ldc,
+                                                                hipblasStride         strideC,
+                                                                int                   batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            strideA,
+                            B,
+                            ldb,
+                            strideB,
+                            C,
+                            ldc,
+                            strideC,
+                            batchCount);
+    return hipblasTrsmOutOfPlace<hipblasComplex>(handle,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 m,
+                                                 n,
+                                                 alpha,
+                                                 A,
+                                                 nullptr,
+                                                 lda,
+                                                 strideA,
+                                                 B,
+                                                 nullptr,
+                                                 ldb,
+                                                 strideB,
+                                                 C,
+                                                 nullptr,
+                                                 ldc,
+                                                 strideC,
+                                                 batchCount,
+                                                 true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasZtrsmStridedBatchedOutOfPlace(hipblasHandle_t             handle,
+                                         hipblasSideMode_t           side,
+                                         hipblasFillMode_t           uplo,
+                                         hipblasOperation_t          transA,
+                                         hipblasDiagType_t           diag,
+                                         int                         m,
+                                         int                         n,
+                                         const hipblasDoubleComplex* alpha,
+                                         const hipblasDoubleComplex* A,
+                                         int                         lda,
+                                         hipblasStride               strideA,
+                                         const hipblasDoubleComplex* B,
+                                         int                         ldb,
+                                         hipblasStride               strideB,
+                                         hipblasDoubleComplex*       C,
+                                         int                         ldc,
+                                         hipblasStride               strideC,
+                                         int                         batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            strideA,
+                            B,
+                            ldb,
+                            strideB,
+                            C,
+                            ldc,
+                            strideC,
+                            batchCount);
+    return hipblasTrsmOutOfPlace<hipblasDoubleComplex>(handle,
+                                                       side,
+                                                       uplo,
+                                                       transA,
+                                                       diag,
+                                                       m,
+                                                       n,
+                                                       alpha,
+                                                       A,
+                                                       nullptr,
+                                                       lda,
+                                                       strideA,
+                                                       B,
+                                                       nullptr,
+                                                       ldb,
+                                                       strideB,
+                                                       C,
+                                                       nullptr,
+                                                       ldc,
+                                                       strideC,
+                                                       batchCount,
+                                                       true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,244 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "tuned_level2.hpp"
+#include <hip/hip_runtime.h>
+
+constexpr int tuned_gemv_block_size = 256;
+
+// With a negative increment the vector starts at its last element, as in the reference BLAS
+template <typename T>
+static T* hipblasTunedGemvStart(T* x, int n, int incx)
+{
+    return incx < 0 ? x - int64_t(n - 1) * incx : x;
+}
+
+// y := alpha * sum + beta * y, without reading y when beta is zero
+template <typename T>
+__device__ void hipblasTunedGemvStore(
+    T sum, const T* alpha_device, T alpha_host, const T* beta_device, T beta_host, T* y)
+{
+    T alpha = alpha_device ? *alpha_device : alpha_host;
+    T beta  = beta_device ? *beta_device : beta_host;
+    *y      = beta == 0 ? alpha * sum : alpha * sum + beta * *y;
+}
+
+// y := alpha * A * x + beta * y with ROWS threads along the rows of a work group
+template <int ROWS, typename T>
+__global__ void __launch_bounds__(tuned_gemv_block_size)
+    hipblasTunedGemvNKernel(int      m,
+                            int      n,
+                            const T* alpha_device,
+                            T        alpha_host,
+                            const T* A,
+                            int      lda,
+                            const T* x,
+                            int      incx,
+                            const T* beta_device,
+                            T        beta_host,
+                            T*       y,
+                            int      incy)
+{
+    constexpr int COLS = tuned_gemv_block_size / ROWS;
+    __shared__ T  partial[COLS][ROWS];
+
+    int row = blockIdx.x * ROWS + threadIdx.x;
+    T   sum = 0;
+    if(row < m)
+        for(int j = threadIdx.y; j < n; j += COLS)
+            sum += A[row + size_t(j) * lda] * x[int64_t(j) * incx];
+    partial[threadIdx.y][threadIdx.x] = sum;
+    __syncthreads();
+
+    if(threadIdx.y == 0 && row < m)
+    {
+        for(int j = 1; j < COLS; j++)
+            sum += partial[j][threadIdx.x];
+        hipblasTunedGemvStore(
+            sum, alpha_device, alpha_host, beta_device, beta_host, y + int64_t(row) * incy);
+    }
+}
+
+// y := alpha * A^T * x + beta * y with ROWS threads summing each column of a work group
+template <int ROWS, typename T>
+__global__ void __launch_bounds__(tuned_gemv_block_size)
+    hipblasTunedGemvTKernel(int      m,
+                            int      n,
+                            const T* alpha_device,
+                            T        alpha_host,
+                            const T* A,
+                            int      lda,
+                            const T* x,
+                            int      incx,
+                            const T* beta_device,
+                            T        beta_host,
+                            T*       y,
+                            int      incy)
+{
+    constexpr int COLS = tuned_gemv_block_size / ROWS;
+    __shared__ T  partial[COLS][ROWS];
+
+    int col = blockIdx.x * COLS + threadIdx.y;
+    T   sum = 0;
+    if(col < n)
+        for(int i = threadIdx.x; i < m; i += ROWS)
+            sum += A[i + size_t(col) * lda] * x[int64_t(i) * incx];
+    partial[threadIdx.y][threadIdx.x] = sum;
+    __syncthreads();
+
+    for(int half = ROWS / 2; half > 0; half /= 2)
+    {
+        if(threadIdx.x < half)
+            partial[threadIdx.y][threadIdx.x] += partial[threadIdx.y][threadIdx.x + half];
+        __syncthreads();
+    }
+
+    if(threadIdx.x == 0 && col < n)
+        hipblasTunedGemvStore(partial[threadIdx.y][0],
+                              alpha_device,
+                              alpha_host,
+                              beta_device,
+                              beta_host,
+                              y + int64_t(col) * incy);
+}
+
+template <int ROWS, typename T>
+static hipblasStatus_t hipblasTunedGemvLaunch(hipStream_t        stream,
+                                              bool               device_scalars,
+                                              hipblasOperation_t trans,
+                                              int                m,
+                                              int                n,
+                                              const T*           alpha,
+                                              const T*           A,
+                                              int                lda,
+                                              const T*           x,
+                                              int                incx,
+                                              const T*           beta,
+                                              T*                 y,
+                                              int                incy)
+{
+    constexpr int COLS       = tuned_gemv_block_size / ROWS;
+    bool          transposed = trans != HIPBLAS_OP_N;
+    int           x_length   = transposed ? m : n;
+    int           y_length   = transposed ? n : m;
+    int           blocks     = transposed ? (n + COLS - 1) / COLS : (m + ROWS - 1) / ROWS;
+
+    auto kernel = transposed ? hipblasTunedGemvTKernel<ROWS, T> : hipblasTunedGemvNKernel<ROWS, T>;
+    hipLaunchKernelGGL(kernel,
+                       dim3(blocks),
+                       dim3(ROWS, COLS),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? T(0) : *alpha,
+                       A,
+                       lda,
+                       hipblasTunedGemvStart(x, x_length, incx),
+                       incx,
+                       device_scalars ? beta : nullptr,
+                       device_scalars ? T(0) : *beta,
+                       hipblasTunedGemvStart(y, y_length, incy),
+                       incy);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasTunedGemvTemplate(hipStream_t        stream,
+                                                int                variant,
+                                                bool               device_scalars,
+                                                hipblasOperation_t trans,
+                                                int                m,
+                                                int                n,
+                                                const T*           alpha,
+                                                const T*           A,
+                                                int                lda,
+                                                const T*           x,
+                                                int                incx,
+                                                const T*           beta,
+                                                T*                 y,
+                                                int                incy)
+{
+    if(m <= 0 || n <= 0 || lda < m || incx == 0 || incy == 0 || !alpha || !A || !x || !beta || !y
+       || (trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    switch(variant)
+    {
+    case 1:
+        return hipblasTunedGemvLaunch<256>(
+            stream, device_scalars, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    case 2:
+        return hipblasTunedGemvLaunch<128>(
+            stream, device_scalars, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    case 3:
+        return hipblasTunedGemvLaunch<64>(
+            stream, device_scalars, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    case 4:
+        return hipblasTunedGemvLaunch<32>(
+            stream, device_scalars, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    case 5:
+        return hipblasTunedGemvLaunch<16>(
+            stream, device_scalars, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    }
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasTunedGemv(hipStream_t        stream,
+                                 int                variant,
+                                 bool               device_scalars,
+                                 hipblasOperation_t trans,
+                                 int                m,
+                                 int                n,
+                                 const float*       alpha,
+                                 const float*       A,
+                                 int                lda,
+                                 const float*       x,
+                                 int                incx,
+                                 const float*       beta,
+                                 float*             y,
+                                 int                incy)
+{
+    return hipblasTunedGemvTemplate(
+        stream, variant, device_scalars, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+hipblasStatus_t hipblasTunedGemv(hipStream_t        stream,
+                                 int                variant,
+                                 bool               device_scalars,
+                                 hipblasOperation_t trans,
+                                 int                m,
+                                 int                n,
+                                 const double*      alpha,
+                                 const double*      A,
+                                 int                lda,
+                                 const double*      x,
+                                 int                incx,
+                                 const double*      beta,
+                                 double*            y,
+                                 int                incy)
+{
+    return hipblasTunedGemvTemplate(
+        stream, variant, device_scalars, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
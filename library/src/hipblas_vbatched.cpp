@@ -0,0 +1,766 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "batch_scalars.hpp"
+#include "exceptions.hpp"
+#include "info_summary.hpp"
+#include "layer.hpp"
+#include "layout.hpp"
+#include "scratch.hpp"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+// Variable-size batched calls. The sizes are in device memory, so they are copied to the host in
+// one stream-ordered transfer, the problems are binned by shape, and each bin runs as one batched
+// backend call on the handle stream, the largest first. The pointer arrays of the bins are
+// gathered into one device buffer, and the call returns once the stream is done with it.
+
+template <typename T>
+struct hipblasVbatchedTraits;
+
+template <>
+struct hipblasVbatchedTraits<float>
+{
+    static constexpr auto trsm = hipblasStrsmBatched;
+    static constexpr auto gemv = hipblasSgemvBatched;
+#ifdef __HIP_PLATFORM_SOLVER__
+    static constexpr auto getrf = hipblasSgetrfBatched;
+#endif
+};
+
+template <>
+struct hipblasVbatchedTraits<double>
+{
+    static constexpr auto trsm = hipblasDtrsmBatched;
+    static constexpr auto gemv = hipblasDgemvBatched;
+#ifdef __HIP_PLATFORM_SOLVER__
+    static constexpr auto getrf = hipblasDgetrfBatched;
+#endif
+};
+
+template <>
+struct hipblasVbatchedTraits<hipblasComplex>
+{
+    static constexpr auto trsm = hipblasCtrsmBatched;
+    static constexpr auto gemv = hipblasCgemvBatched;
+#ifdef __HIP_PLATFORM_SOLVER__
+    static constexpr auto getrf = hipblasCgetrfBatched;
+#endif
+};
+
+template <>
+struct hipblasVbatchedTraits<hipblasDoubleComplex>
+{
+    static constexpr auto trsm = hipblasZtrsmBatched;
+    static constexpr auto gemv = hipblasZgemvBatched;
+#ifdef __HIP_PLATFORM_SOLVER__
+    static constexpr auto getrf = hipblasZgetrfBatched;
+#endif
+};
+
+// Problem indices binned by shape, the largest first. With a per-instance scalar stride on the
+// handle, the index of the problem is part of its shape, so each bin has one problem and reads
+// its own scalars.
+template <size_t N>
+using hipblasVbatchedBins = std::map<std::array<int, N>, std::vector<int>, std::greater<>>;
+
+// The stream of handle. Returns HIPBLAS_STATUS_NOT_SUPPORTED while it is being captured, as the
+// sizes are read on the host.
+static hipblasStatus_t hipblasVbatchedStream(hipblasHandle_t handle, hipStream_t& stream)
+{
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Enqueues the copy of the batch_count entries of a device size or pointer array to host
+template <typename T>
+static bool hipblasVbatchedDownload(hipStream_t     stream,
+                                    int             batch_count,
+                                    const void*     device,
+                                    std::vector<T>& host)
+{
+    host.resize(batch_count);
+    return hipMemcpyAsync(
+               host.data(), device, sizeof(T) * batch_count, hipMemcpyDeviceToHost, stream)
+           == hipSuccess;
+}
+
+// Problem indices of the bins, concatenated in the order they run
+template <size_t N>
+static std::vector<int> hipblasVbatchedOrder(const hipblasVbatchedBins<N>& bins)
+{
+    std::vector<int> order;
+    for(auto& bin : bins)
+        order.insert(order.end(), bin.second.begin(), bin.second.end());
+    return order;
+}
+
+// Allocates extra_bytes of device scratch followed by the host pointer arrays in the given order,
+// and copies them. gathered[a] is then the device copy of arrays[a].
+static hipblasStatus_t hipblasVbatchedGather(hipStream_t                             stream,
+                                             const std::vector<std::vector<void*>*>& arrays,
+                                             const std::vector<int>&                 order,
+                                             size_t                                  extra_bytes,
+                                             hipblasDeviceScratch&                   scratch,
+                                             std::vector<void**>&                    gathered)
+{
+    size_t             count = order.size();
+    size_t             extra = (extra_bytes + 255) / 256 * 256;
+    std::vector<void*> host(arrays.size() * count);
+    for(size_t a = 0; a < arrays.size(); a++)
+        for(size_t j = 0; j < count; j++)
+            host[a * count + j] = (*arrays[a])[order[j]];
+
+    if(hipMalloc((void**)&scratch.base, extra + sizeof(void*) * host.size()) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    void** device = reinterpret_cast<void**>(scratch.base + extra);
+    if(hipMemcpyAsync(
+           device, host.data(), sizeof(void*) * host.size(), hipMemcpyHostToDevice, stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    gathered.resize(arrays.size());
+    for(size_t a = 0; a < arrays.size(); a++)
+        gathered[a] = device + a * count;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasTrsmVbatched(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasDiagType_t  diag,
+                                           const int*         m,
+                                           const int*         n,
+                                           const T*           alpha,
+                                           const T* const     A[],
+                                           const int*         lda,
+                                           T* const           B[],
+                                           const int*         ldb,
+                                           int                batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!m || !n || !alpha || !A || !lda || !B || !ldb)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasLayoutTrsm(side, uplo, m, n);
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasVbatchedStream(handle, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::vector<int>   hm, hn, hlda, hldb;
+    std::vector<void*> hA, hB;
+    if(!hipblasVbatchedDownload(stream, batch_count, m, hm)
+       || !hipblasVbatchedDownload(stream, batch_count, n, hn)
+       || !hipblasVbatchedDownload(stream, batch_count, lda, hlda)
+       || !hipblasVbatchedDownload(stream, batch_count, ldb, hldb)
+       || !hipblasVbatchedDownload(stream, batch_count, A, hA)
+       || !hipblasVbatchedDownload(stream, batch_count, B, hB)
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    // Every problem is checked before any runs, and empty ones are skipped
+    hipblasStride          stride_scalars = hipblasBatchScalarStride(handle);
+    hipblasVbatchedBins<5> bins;
+    for(int i = 0; i < batch_count; i++)
+    {
+        int k = side == HIPBLAS_SIDE_LEFT ? hm[i] : hn[i];
+        if(hm[i] < 0 || hn[i] < 0 || hlda[i] < std::max(1, k) || hldb[i] < std::max(1, hm[i]))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(hm[i] && hn[i])
+            bins[{hm[i], hn[i], hlda[i], hldb[i], stride_scalars ? i : 0}].push_back(i);
+    }
+    if(bins.empty())
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::vector<int>     order = hipblasVbatchedOrder(bins);
+    std::vector<void**>  gathered;
+    hipblasDeviceScratch scratch;
+    status = hipblasVbatchedGather(stream, {&hA, &hB}, order, 0, scratch, gathered);
+
+    size_t offset = 0;
+    for(auto& bin : bins)
+    {
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+        auto& shape = bin.first;
+        int   count = int(bin.second.size());
+        status      = hipblasVbatchedTraits<T>::trsm(handle,
+                                                     side,
+                                                     uplo,
+                                                     transA,
+                                                     diag,
+                                                     shape[0],
+                                                     shape[1],
+                                                     alpha + bin.second[0] * stride_scalars,
+                                                     (const T* const*)gathered[0] + offset,
+                                                     shape[2],
+                                                     (T* const*)gathered[1] + offset,
+                                                     shape[3],
+                                                     count);
+        offset += count;
+    }
+
+    if(hipStreamSynchronize(stream) != hipSuccess && status == HIPBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+
+template <typename T>
+static hipblasStatus_t hipblasGemvVbatched(hipblasHandle_t    handle,
+                                           hipblasOperation_t trans,
+                                           const int*         m,
+                                           const int*         n,
+                                           const T*           alpha,
+                                           const T* const     A[],
+                                           const int*         lda,
+                                           const T* const     x[],
+                                           const int*         incx,
+                                           const T*           beta,
+                                           T* const           y[],
+                                           const int*         incy,
+                                           int                batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!m || !n || !alpha || !A || !lda || !x || !incx || !beta || !y || !incy)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    constexpr bool complex = !std::is_same_v<T, float> && !std::is_same_v<T, double>;
+    if(!hipblasLayoutGemv(trans, m, n, complex))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasVbatchedStream(handle, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::vector<int>   hm, hn, hlda, hincx, hincy;
+    std::vector<void*> hA, hx, hy;
+    if(!hipblasVbatchedDownload(stream, batch_count, m, hm)
+       || !hipblasVbatchedDownload(stream, batch_count, n, hn)
+       || !hipblasVbatchedDownload(stream, batch_count, lda, hlda)
+       || !hipblasVbatchedDownload(stream, batch_count, incx, hincx)
+       || !hipblasVbatchedDownload(stream, batch_count, incy, hincy)
+       || !hipblasVbatchedDownload(stream, batch_count, A, hA)
+       || !hipblasVbatchedDownload(stream, batch_count, x, hx)
+       || !hipblasVbatchedDownload(stream, batch_count, y, hy)
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    // Every problem is checked before any runs, and empty ones are skipped as in BLAS
+    hipblasStride          stride_scalars = hipblasBatchScalarStride(handle);
+    hipblasVbatchedBins<6> bins;
+    for(int i = 0; i < batch_count; i++)
+    {
+        if(hm[i] < 0 || hn[i] < 0 || hlda[i] < std::max(1, hm[i]) || !hincx[i] || !hincy[i])
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(hm[i] && hn[i])
+            bins[{hm[i], hn[i], hlda[i], hincx[i], hincy[i], stride_scalars ? i : 0}].push_back(i);
+    }
+    if(bins.empty())
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::vector<int>     order = hipblasVbatchedOrder(bins);
+    std::vector<void**>  gathered;
+    hipblasDeviceScratch scratch;
+    status = hipblasVbatchedGather(stream, {&hA, &hx, &hy}, order, 0, scratch, gathered);
+
+    size_t offset = 0;
+    for(auto& bin : bins)
+    {
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+        auto& shape = bin.first;
+        int   count = int(bin.second.size());
+        status      = hipblasVbatchedTraits<T>::gemv(handle,
+                                                     trans,
+                                                     shape[0],
+                                                     shape[1],
+                                                     alpha + bin.second[0] * stride_scalars,
+                                                     (const T* const*)gathered[0] + offset,
+                                                     shape[2],
+                                                     (const T* const*)gathered[1] + offset,
+                                                     shape[3],
+                                                     beta + bin.second[0] * stride_scalars,
+                                                     (T* const*)gathered[2] + offset,
+                                                     shape[4],
+                                                     count);
+        offset += count;
+    }
+
+    if(hipStreamSynchronize(stream) != hipSuccess && status == HIPBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+
+#ifdef __HIP_PLATFORM_SOLVER__
+// Each bin factors into contiguous pivots and info in the scratch, which are then copied to
+// ipiv[i] and info[i] of its problems
+template <typename T>
+static hipblasStatus_t hipblasGetrfVbatched(hipblasHandle_t handle,
+                                            const int*      n,
+                                            T* const        A[],
+                                            const int*      lda,
+                                            int* const      ipiv[],
+                                            int*            info,
+                                            int             batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!n || !A || !lda || !info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasVbatchedStream(handle, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::vector<int>   hn, hlda;
+    std::vector<void*> hA, hipiv;
+    if(!hipblasVbatchedDownload(stream, batch_count, n, hn)
+       || !hipblasVbatchedDownload(stream, batch_count, lda, hlda)
+       || !hipblasVbatchedDownload(stream, batch_count, A, hA)
+       || (ipiv && !hipblasVbatchedDownload(stream, batch_count, ipiv, hipiv))
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    hipblasVbatchedBins<2> bins;
+    size_t                 pivots = 0;
+    for(int i = 0; i < batch_count; i++)
+    {
+        if(hn[i] < 0 || hlda[i] < std::max(1, hn[i]))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(hn[i])
+            bins[{hn[i], hlda[i]}].push_back(i);
+        pivots += hn[i];
+    }
+
+    // Only the info of the whole call is summarized, not that of the bins
+    std::vector<int> hinfo(batch_count, 0);
+    if(!bins.empty())
+    {
+        hipblasInfoSummarySuspend suspend;
+
+        std::vector<int>     order = hipblasVbatchedOrder(bins);
+        std::vector<void**>  gathered;
+        hipblasDeviceScratch scratch;
+        size_t               info_bytes = (sizeof(int) * order.size() + 255) / 256 * 256;
+        status                          = hipblasVbatchedGather(
+            stream, {&hA}, order, info_bytes + sizeof(int) * pivots, scratch, gathered);
+        int* dinfo = reinterpret_cast<int*>(scratch.base);
+        int* dipiv = reinterpret_cast<int*>(scratch.base + info_bytes);
+
+        size_t offset = 0, pivot = 0;
+        for(auto& bin : bins)
+        {
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+            int nb    = bin.first[0];
+            int count = int(bin.second.size());
+            status    = hipblasVbatchedTraits<T>::getrf(handle,
+                                                        nb,
+                                                        (T* const*)gathered[0] + offset,
+                                                        bin.first[1],
+                                                        ipiv ? dipiv + pivot : nullptr,
+                                                        dinfo + offset,
+                                                        count);
+            for(int j = 0; ipiv && status == HIPBLAS_STATUS_SUCCESS && j < count; j++)
+                if(hipMemcpyAsync(hipiv[bin.second[j]],
+                                  dipiv + pivot + size_t(j) * nb,
+                                  sizeof(int) * nb,
+                                  hipMemcpyDeviceToDevice,
+                                  stream)
+                   != hipSuccess)
+                    status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            offset += count;
+            pivot += size_t(nb) * count;
+        }
+
+        std::vector<int> binned(order.size());
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && (hipMemcpyAsync(binned.data(),
+                              dinfo,
+                              sizeof(int) * binned.size(),
+                              hipMemcpyDeviceToHost,
+                              stream)
+                   != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess))
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        for(size_t j = 0; j < order.size(); j++)
+            hinfo[order[j]] = binned[j];
+    }
+
+    if(status == HIPBLAS_STATUS_SUCCESS
+       && (hipMemcpyAsync(
+               info, hinfo.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess))
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    return hipblasInfoSummaryAfter(handle, info, batch_count, status);
+}
+#endif
+
+extern "C" hipblasStatus_t hipblasStrsmVbatched(hipblasHandle_t    handle,
+                                                hipblasSideMode_t  side,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                hipblasDiagType_t  diag,
+                                                const int*         m,
+                                                const int*         n,
+                                                const float*       alpha,
+                                                const float* const A[],
+                                                const int*         lda,
+                                                float* const       B[],
+                                                const int*         ldb,
+                                                int                batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            B,
+                            ldb,
+                            batchCount);
+    return hipblasTrsmVbatched(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDtrsmVbatched(hipblasHandle_t     handle,
+                                                hipblasSideMode_t   side,
+                                                hipblasFillMode_t   uplo,
+                                                hipblasOperation_t  transA,
+                                                hipblasDiagType_t   diag,
+                                                const int*          m,
+                                                const int*          n,
+                                                const double*       alpha,
+                                                const double* const A[],
+                                                const int*          lda,
+                                                double* const       B[],
+                                                const int*          ldb,
+                                                int                 batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            B,
+                            ldb,
+                            batchCount);
+    return hipblasTrsmVbatched(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCtrsmVbatched(hipblasHandle_t             handle,
+                                                hipblasSideMode_t           side,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasOperation_t          transA,
+                                                hipblasDiagType_t           diag,
+                                                const int*                  m,
+                                                const int*                  n,
+                                                const hipblasComplex*       alpha,
+                                                const hipblasComplex* const A[],
+                                                const int*                  lda,
+                                                hipblasComplex* const       B[],
+                                                const int*                  ldb,
+                                                int                         batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            B,
+                            ldb,
+                            batchCount);
+    return hipblasTrsmVbatched(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZtrsmVbatched(hipblasHandle_t                   handle,
+                                                hipblasSideMode_t                 side,
+                                                hipblasFillMode_t                 uplo,
+                                                hipblasOperation_t                transA,
+                                                hipblasDiagType_t                 diag,
+                                                const int*                        m,
+                                                const int*                        n,
+                                                const hipblasDoubleComplex*       alpha,
+                                                const hipblasDoubleComplex* const A[],
+                                                const int*                        lda,
+                                                hipblasDoubleComplex* const       B[],
+                                                const int*                        ldb,
+                                                int                               batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A,
+                            lda,
+                            B,
+                            ldb,
+                            batchCount);
+    return hipblasTrsmVbatched(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasSgemvVbatched(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                const int*         m,
+                                                const int*         n,
+                                                const float*       alpha,
+                                                const float* const A[],
+                                                const int*         lda,
+                                                const float* const x[],
+                                                const int*         incx,
+                                                const float*       beta,
+                                                float* const       y[],
+                                                const int*         incy,
+                                                int                batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasGemvVbatched(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgemvVbatched(hipblasHandle_t     handle,
+                                                hipblasOperation_t  trans,
+                                                const int*          m,
+                                                const int*          n,
+                                                const double*       alpha,
+                                                const double* const A[],
+                                                const int*          lda,
+                                                const double* const x[],
+                                                const int*          incx,
+                                                const double*       beta,
+                                                double* const       y[],
+                                                const int*          incy,
+                                                int                 batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasGemvVbatched(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgemvVbatched(hipblasHandle_t             handle,
+                                                hipblasOperation_t          trans,
+                                                const int*                  m,
+                                                const int*                  n,
+                                                const hipblasComplex*       alpha,
+                                                const hipblasComplex* const A[],
+                                                const int*                  lda,
+                                                const hipblasComplex* const x[],
+                                                const int*                  incx,
+                                                const hipblasComplex*       beta,
+                                                hipblasComplex* const       y[],
+                                                const int*                  incy,
+                                                int                         batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasGemvVbatched(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgemvVbatched(hipblasHandle_t                   handle,
+                                                hipblasOperation_t                trans,
+                                                const int*                        m,
+                                                const int*                        n,
+                                                const hipblasDoubleComplex*       alpha,
+                                                const hipblasDoubleComplex* const A[],
+                                                const int*                        lda,
+                                                const hipblasDoubleComplex* const x[],
+                                                const int*                        incx,
+                                                const hipblasDoubleComplex*       beta,
+                                                hipblasDoubleComplex* const       y[],
+                                                const int*                        incy,
+                                                int                               batchCount)
+try
+{
+    HIPBLAS_LAYER_ROW_MAJOR(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasGemvVbatched(
+        handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+#ifdef __HIP_PLATFORM_SOLVER__
+extern "C" hipblasStatus_t hipblasSgetrfVbatched(hipblasHandle_t handle,
+                                                 const int*      n,
+                                                 float* const    A[],
+                                                 const int*      lda,
+                                                 int* const      ipiv[],
+                                                 int*            info,
+                                                 int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, ipiv, info, batchCount);
+    return hipblasGetrfVbatched(handle, n, A, lda, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasDgetrfVbatched(hipblasHandle_t handle,
+                                                 const int*      n,
+                                                 double* const   A[],
+                                                 const int*      lda,
+                                                 int* const      ipiv[],
+                                                 int*            info,
+                                                 int             batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, ipiv, info, batchCount);
+    return hipblasGetrfVbatched(handle, n, A, lda, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasCgetrfVbatched(hipblasHandle_t       handle,
+                                                 const int*            n,
+                                                 hipblasComplex* const A[],
+                                                 const int*            lda,
+                                                 int* const            ipiv[],
+                                                 int*                  info,
+                                                 int                   batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, ipiv, info, batchCount);
+    return hipblasGetrfVbatched(handle, n, A, lda, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasZgetrfVbatched(hipblasHandle_t             handle,
+                                                 const int*                  n,
+                                                 hipblasDoubleComplex* const A[],
+                                                 const int*                  lda,
+                                                 int* const                  ipiv[],
+                                                 int*                        info,
+                                                 int                         batchCount)
+try
+{
+    HIPBLAS_LAYER(handle, n, A, lda, ipiv, info, batchCount);
+    return hipblasGetrfVbatched(handle, n, A, lda, ipiv, info, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+#endif
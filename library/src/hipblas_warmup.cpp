@@ -0,0 +1,350 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include "layout.hpp"
+#include "pointer_mode.hpp"
+#include "scratch.hpp"
+#include "warmup.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+
+// hipBLAS functions of each precision run for a trsm descriptor
+template <typename T>
+struct hipblasWarmupFunctions;
+
+template <>
+struct hipblasWarmupFunctions<float>
+{
+    static constexpr auto trsm               = hipblasStrsm;
+    static constexpr auto trsmStridedBatched = hipblasStrsmStridedBatched;
+};
+
+template <>
+struct hipblasWarmupFunctions<double>
+{
+    static constexpr auto trsm               = hipblasDtrsm;
+    static constexpr auto trsmStridedBatched = hipblasDtrsmStridedBatched;
+};
+
+template <>
+struct hipblasWarmupFunctions<hipblasComplex>
+{
+    static constexpr auto trsm               = hipblasCtrsm;
+    static constexpr auto trsmStridedBatched = hipblasCtrsmStridedBatched;
+};
+
+template <>
+struct hipblasWarmupFunctions<hipblasDoubleComplex>
+{
+    static constexpr auto trsm               = hipblasZtrsm;
+    static constexpr auto trsmStridedBatched = hipblasZtrsmStridedBatched;
+};
+
+// One call of a descriptor, column-major, on packed zero matrices in scratch
+struct hipblasWarmupCall
+{
+    hipblasWarmupDesc_t d;
+    const char*         A;
+    int                 lda;
+    hipblasStride       stride_A;
+    const char*         B;
+    int                 ldb;
+    hipblasStride       stride_B;
+    char*               C;
+    int                 ldc;
+    hipblasStride       stride_C;
+    char                one[16];
+};
+
+// Writes 1 in the scalar type of compute_type to one, which holds 16 bytes. gemm with a zero
+// alpha would only scale C, and trsm would only zero B, without the kernels of the problem.
+static void hipblasWarmupOne(hipblasComputeType_t compute_type, char* one)
+{
+    const uint16_t half_one   = 0x3c00;
+    const float    float_one  = 1;
+    const double   double_one = 1;
+    const int32_t  int_one    = 1;
+
+    std::memset(one, 0, 16);
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        std::memcpy(one, &half_one, sizeof(half_one));
+        break;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        std::memcpy(one, &double_one, sizeof(double_one));
+        break;
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        std::memcpy(one, &int_one, sizeof(int_one));
+        break;
+    default:
+        std::memcpy(one, &float_one, sizeof(float_one));
+        break;
+    }
+}
+
+template <typename T>
+static hipblasStatus_t hipblasWarmupTrsm(hipblasHandle_t handle, const hipblasWarmupCall& c)
+{
+    using F = hipblasWarmupFunctions<T>;
+
+    const hipblasWarmupDesc_t& d     = c.d;
+    const T*                   alpha = reinterpret_cast<const T*>(c.one);
+    const T*                   A     = reinterpret_cast<const T*>(c.A);
+    T*                         B     = reinterpret_cast<T*>(c.C);
+    if(d.batchCount == 1)
+        return F::trsm(
+            handle, d.side, d.uplo, d.transA, d.diag, d.m, d.n, alpha, A, c.lda, B, c.ldc);
+    return F::trsmStridedBatched(handle,
+                                 d.side,
+                                 d.uplo,
+                                 d.transA,
+                                 d.diag,
+                                 d.m,
+                                 d.n,
+                                 alpha,
+                                 A,
+                                 c.lda,
+                                 c.stride_A,
+                                 B,
+                                 c.ldc,
+                                 c.stride_C,
+                                 d.batchCount);
+}
+
+static hipblasStatus_t hipblasWarmupRun(hipblasHandle_t handle, const hipblasWarmupCall& c)
+{
+    const hipblasWarmupDesc_t& d        = c.d;
+    const char                 zero[16] = {};
+    if(d.routine == HIPBLAS_WARMUP_GEMM_EX && d.batchCount == 1)
+        return hipblasGemmEx_v2(handle,
+                                d.transA,
+                                d.transB,
+                                d.m,
+                                d.n,
+                                d.k,
+                                c.one,
+                                c.A,
+                                d.aType,
+                                c.lda,
+                                c.B,
+                                d.bType,
+                                c.ldb,
+                                zero,
+                                c.C,
+                                d.cType,
+                                c.ldc,
+                                d.computeType,
+                                HIPBLAS_GEMM_DEFAULT);
+    if(d.routine == HIPBLAS_WARMUP_GEMM_EX)
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              d.transA,
+                                              d.transB,
+                                              d.m,
+                                              d.n,
+                                              d.k,
+                                              c.one,
+                                              c.A,
+                                              d.aType,
+                                              c.lda,
+                                              c.stride_A,
+                                              c.B,
+                                              d.bType,
+                                              c.ldb,
+                                              c.stride_B,
+                                              zero,
+                                              c.C,
+                                              d.cType,
+                                              c.ldc,
+                                              c.stride_C,
+                                              d.batchCount,
+                                              d.computeType,
+                                              HIPBLAS_GEMM_DEFAULT);
+
+    switch(d.aType)
+    {
+    case HIP_R_32F:
+        return hipblasWarmupTrsm<float>(handle, c);
+    case HIP_R_64F:
+        return hipblasWarmupTrsm<double>(handle, c);
+    case HIP_C_32F:
+        return hipblasWarmupTrsm<hipblasComplex>(handle, c);
+    case HIP_C_64F:
+        return hipblasWarmupTrsm<hipblasDoubleComplex>(handle, c);
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static hipblasStatus_t hipblasWarmupShape(hipblasHandle_t handle, int, void* userData)
+{
+    return hipblasWarmupRun(handle, *static_cast<const hipblasWarmupCall*>(userData));
+}
+
+static hipblasStatus_t hipblasWarmupCheck(const hipblasWarmupDesc_t& d)
+{
+    auto op = [](hipblasOperation_t t) {
+        return t == HIPBLAS_OP_N || t == HIPBLAS_OP_T || t == HIPBLAS_OP_C;
+    };
+    if(d.routine == HIPBLAS_WARMUP_GEMM_EX)
+    {
+        if(!op(d.transA) || !op(d.transB))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(d.m < 0 || d.n < 0 || d.k < 0 || d.batchCount < 1)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    if(d.routine != HIPBLAS_WARMUP_TRSM || !op(d.transA)
+       || (d.side != HIPBLAS_SIDE_LEFT && d.side != HIPBLAS_SIDE_RIGHT)
+       || (d.uplo != HIPBLAS_FILL_MODE_UPPER && d.uplo != HIPBLAS_FILL_MODE_LOWER)
+       || (d.diag != HIPBLAS_DIAG_NON_UNIT && d.diag != HIPBLAS_DIAG_UNIT))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(d.m < 0 || d.n < 0 || d.batchCount < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Reserves the workspace of the call of desc, then runs it on zero matrices. The layout of the
+// handle is applied to the shape here, as the calls made from hipblasWarmup are nested.
+static hipblasStatus_t
+    hipblasWarmupDesc(hipblasHandle_t handle, hipStream_t stream, const hipblasWarmupDesc_t& desc)
+{
+    hipblasWarmupCall c = {};
+    c.d                 = desc;
+
+    hipblasWarmupDesc_t& d = c.d;
+    int                  a_rows, a_cols, b_rows, b_cols;
+    size_t               a_size, b_size, c_size;
+    if(d.routine == HIPBLAS_WARMUP_GEMM_EX)
+    {
+        hipblasLayoutGemm(d.transA, d.transB, d.m, d.n, std::tie(d.aType), std::tie(d.bType));
+        a_rows = d.transA == HIPBLAS_OP_N ? d.m : d.k;
+        a_cols = d.transA == HIPBLAS_OP_N ? d.k : d.m;
+        b_rows = d.transB == HIPBLAS_OP_N ? d.k : d.n;
+        b_cols = d.transB == HIPBLAS_OP_N ? d.n : d.k;
+        a_size = hipblasDatatypeSize(d.aType);
+        b_size = hipblasDatatypeSize(d.bType);
+        c_size = hipblasDatatypeSize(d.cType);
+        hipblasWarmupOne(d.computeType, c.one);
+    }
+    else
+    {
+        hipblasLayoutTrsm(d.side, d.uplo, d.m, d.n);
+        a_rows = a_cols = d.side == HIPBLAS_SIDE_LEFT ? d.m : d.n;
+        b_rows = b_cols = 0;
+        a_size = c_size = hipblasDatatypeSize(d.aType);
+        b_size          = 1;
+        hipblasWarmupOne(d.aType == HIP_R_64F || d.aType == HIP_C_64F ? HIPBLAS_COMPUTE_64F
+                                                                      : HIPBLAS_COMPUTE_32F,
+                         c.one);
+    }
+    if(!a_size || !b_size || !c_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!d.m || !d.n)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    c.lda      = std::max(a_rows, 1);
+    c.stride_A = hipblasStride(a_rows) * a_cols;
+    c.ldb      = std::max(b_rows, 1);
+    c.stride_B = hipblasStride(b_rows) * b_cols;
+    c.ldc      = d.m;
+    c.stride_C = hipblasStride(d.m) * d.n;
+
+    // Each matrix starts on a 256-byte boundary
+    auto   align   = [](size_t bytes) { return (bytes + 255) / 256 * 256; };
+    size_t a_bytes = align(a_size * c.stride_A * d.batchCount);
+    size_t b_bytes = align(b_size * c.stride_B * d.batchCount);
+    size_t c_bytes = c_size * c.stride_C * d.batchCount;
+
+    hipblasStreamScratch scratch;
+    scratch.stream = stream;
+    if(hipMallocAsync((void**)&scratch.base, a_bytes + b_bytes + c_bytes, stream) != hipSuccess)
+    {
+        scratch.base = nullptr;
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    if(hipMemsetAsync(scratch.base, 0, a_bytes + b_bytes + c_bytes, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    c.A = scratch.base;
+    c.B = scratch.base + a_bytes;
+    c.C = scratch.base + a_bytes + b_bytes;
+
+    hipblasStatus_t status = hipblasPrewarmWorkspace(handle, 1, hipblasWarmupShape, &c);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasWarmupRun(handle, c);
+    return status;
+}
+
+extern "C" hipblasStatus_t
+    hipblasWarmup(hipblasHandle_t handle, int descCount, const hipblasWarmupDesc_t* descs)
+try
+{
+    HIPBLAS_LAYER(handle, descCount, descs);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(descCount < 0 || (descCount && !descs))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int i = 0; i < descCount; i++)
+    {
+        hipblasStatus_t status = hipblasWarmupCheck(descs[i]);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(capture_status != hipStreamCaptureStatusNone)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasWarmupBackend();
+
+    hipblasPointerMode_t mode;
+    status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipblasPointerModeGuard restore{handle, mode};
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+    for(int i = 0; i < descCount && status == HIPBLAS_STATUS_SUCCESS; i++)
+        status = hipblasWarmupDesc(handle, stream, descs[i]);
+    if(status == HIPBLAS_STATUS_SUCCESS && hipStreamSynchronize(stream) != hipSuccess)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
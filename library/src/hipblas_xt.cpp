@@ -0,0 +1,1016 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "layer.hpp"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Default edge of the square tiles the output matrix is split into
+static constexpr int xt_default_block_dim = 2048;
+
+// Streams per device. The tiles of a device alternate between them, so the transfers of one tile
+// overlap the compute of the other.
+static constexpr int xt_slots = 2;
+
+// Stream, handle and device buffer working on one tile at a time
+struct hipblasXtSlot
+{
+    hipStream_t     stream = nullptr;
+    hipblasHandle_t handle = nullptr;
+    void*           buffer = nullptr;
+    size_t          size   = 0;
+};
+
+struct hipblasXtDevice
+{
+    int           id = 0;
+    hipblasXtSlot slots[xt_slots];
+};
+
+// A hipblasXtHandle_t. Calls on one context run one at a time.
+struct hipblasXtContext
+{
+    std::mutex                   mutex;
+    std::vector<hipblasXtDevice> devices;
+    int                          block_dim = xt_default_block_dim;
+};
+
+// The per tile calls go through the hipBLAS functions of each precision, so both backends share
+// this file
+template <typename T>
+struct hipblasXtTraits;
+
+template <>
+struct hipblasXtTraits<float>
+{
+    static constexpr bool complex = false;
+    static constexpr auto gemm    = hipblasSgemm;
+    static constexpr auto syrk    = hipblasSsyrk;
+    static constexpr auto trsm    = hipblasStrsm;
+};
+
+template <>
+struct hipblasXtTraits<double>
+{
+    static constexpr bool complex = false;
+    static constexpr auto gemm    = hipblasDgemm;
+    static constexpr auto syrk    = hipblasDsyrk;
+    static constexpr auto trsm    = hipblasDtrsm;
+};
+
+template <>
+struct hipblasXtTraits<hipblasComplex>
+{
+    static constexpr bool complex = true;
+    static constexpr auto gemm    = hipblasCgemm;
+    static constexpr auto syrk    = hipblasCsyrk;
+    static constexpr auto trsm    = hipblasCtrsm;
+};
+
+template <>
+struct hipblasXtTraits<hipblasDoubleComplex>
+{
+    static constexpr bool complex = true;
+    static constexpr auto gemm    = hipblasZgemm;
+    static constexpr auto syrk    = hipblasZsyrk;
+    static constexpr auto trsm    = hipblasZtrsm;
+};
+
+static bool hipblasXtIsZero(float x)
+{
+    return x == 0;
+}
+
+static bool hipblasXtIsZero(double x)
+{
+    return x == 0;
+}
+
+static bool hipblasXtIsZero(const hipblasComplex& x)
+{
+    return x.real() == 0 && x.imag() == 0;
+}
+
+static bool hipblasXtIsZero(const hipblasDoubleComplex& x)
+{
+    return x.real() == 0 && x.imag() == 0;
+}
+
+// Free the streams, handles and buffers of device. The current device of the calling thread is
+// kept.
+static void hipblasXtRelease(hipblasXtDevice& device)
+{
+    int current = 0;
+    (void)hipGetDevice(&current);
+    (void)hipSetDevice(device.id);
+    for(auto& slot : device.slots)
+    {
+        if(slot.handle)
+            (void)hipblasDestroy(slot.handle);
+        if(slot.stream)
+            (void)hipStreamDestroy(slot.stream);
+        if(slot.buffer)
+            (void)hipFree(slot.buffer);
+        slot = hipblasXtSlot();
+    }
+    (void)hipSetDevice(current);
+}
+
+// Create the streams and handles of device and grow its buffers to size bytes, on a thread whose
+// current device is device.id
+static hipblasStatus_t hipblasXtPrepare(hipblasXtDevice& device, size_t size)
+{
+    for(auto& slot : device.slots)
+    {
+        if(!slot.stream
+           && hipStreamCreateWithFlags(&slot.stream, hipStreamNonBlocking) != hipSuccess)
+        {
+            slot.stream = nullptr;
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        if(!slot.handle)
+        {
+            status = hipblasCreate(&slot.handle);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+            {
+                slot.handle = nullptr;
+                return status;
+            }
+        }
+        status = hipblasSetStream(slot.handle, slot.stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(slot.handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(slot.size < size)
+        {
+            if(slot.buffer)
+                (void)hipFree(slot.buffer);
+            slot.buffer = nullptr;
+            slot.size   = 0;
+            if(hipMalloc(&slot.buffer, size) != hipSuccess)
+            {
+                slot.buffer = nullptr;
+                (void)hipGetLastError();
+                return HIPBLAS_STATUS_ALLOC_FAILED;
+            }
+            slot.size = size;
+        }
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Run tile(slot, index) for the tiles 0 to count - 1 with one host thread per selected device.
+// Device d takes the tiles d, d + devices, ... and alternates them between its slots, whose
+// buffers hold at least size bytes. Returns the first error of any device.
+template <typename F>
+static hipblasStatus_t
+    hipblasXtRun(hipblasXtContext* context, size_t count, size_t size, const F& tile)
+{
+    size_t                       stride = context->devices.size();
+    size_t                       used   = std::min(stride, count);
+    std::vector<hipblasStatus_t> statuses(used, HIPBLAS_STATUS_SUCCESS);
+    std::vector<std::thread>     threads;
+
+    auto run = [&](size_t d) {
+        hipblasXtDevice& device = context->devices[d];
+        hipblasStatus_t& status = statuses[d];
+        if(hipSetDevice(device.id) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            return;
+        }
+
+        status = hipblasXtPrepare(device, size);
+        for(size_t i = d, n = 0; status == HIPBLAS_STATUS_SUCCESS && i < count; i += stride, n++)
+            status = tile(device.slots[n % xt_slots], i);
+
+        // Wait for the tiles also after an error, as they use the buffers
+        for(auto& slot : device.slots)
+        {
+            if(slot.stream && hipStreamSynchronize(slot.stream) != hipSuccess
+               && status == HIPBLAS_STATUS_SUCCESS)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+    };
+
+    for(size_t d = 1; d < used; d++)
+    {
+        try
+        {
+            threads.emplace_back(run, d);
+        }
+        catch(...)
+        {
+            statuses[d] = HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+    }
+
+    // The calling thread drives the first device and keeps its current device
+    int current = 0;
+    (void)hipGetDevice(&current);
+    if(used)
+        run(0);
+    (void)hipSetDevice(current);
+
+    for(auto& thread : threads)
+        thread.join();
+    for(hipblasStatus_t status : statuses)
+    {
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Copy the rows x cols block at src to dst, each on the host or on any device, ordered on stream
+template <typename T>
+static hipblasStatus_t hipblasXtCopy(T*          dst,
+                                     size_t      ld_dst,
+                                     const T*    src,
+                                     size_t      ld_src,
+                                     size_t      rows,
+                                     size_t      cols,
+                                     hipStream_t stream)
+{
+    if(!rows || !cols)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(hipMemcpy2DAsync(dst,
+                        ld_dst * sizeof(T),
+                        src,
+                        ld_src * sizeof(T),
+                        rows * sizeof(T),
+                        cols,
+                        hipMemcpyDefault,
+                        stream)
+       != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+static size_t hipblasXtTiles(size_t n, size_t block_dim)
+{
+    return (n + block_dim - 1) / block_dim;
+}
+
+// C = alpha op(A) op(B) + beta C. Each bs x bs tile of C is computed on one device, accumulating
+// the products of bs wide panels of op(A) and op(B).
+template <typename T>
+static hipblasStatus_t hipblasXtGemm(hipblasXtHandle_t  handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     size_t             m,
+                                     size_t             n,
+                                     size_t             k,
+                                     const T*           alpha,
+                                     const T*           A,
+                                     size_t             lda,
+                                     const T*           B,
+                                     size_t             ldb,
+                                     const T*           beta,
+                                     T*                 C,
+                                     size_t             ldc)
+{
+    auto* context = static_cast<hipblasXtContext*>(handle);
+    if(!context)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool a_n = transA == HIPBLAS_OP_N, b_n = transB == HIPBLAS_OP_N;
+    if(lda < std::max<size_t>(1, a_n ? m : k) || ldb < std::max<size_t>(1, b_n ? k : n)
+       || ldc < std::max<size_t>(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(context->mutex);
+
+    // With alpha == 0 only C is scaled
+    size_t  bs      = context->block_dim;
+    size_t  k_used  = hipblasXtIsZero(*alpha) ? 0 : k;
+    size_t  k_tiles = std::max<size_t>(1, hipblasXtTiles(k_used, bs));
+    size_t  m_tiles = hipblasXtTiles(m, bs);
+    const T one(1);
+
+    auto tile = [&](hipblasXtSlot& slot, size_t index) {
+        size_t i0 = index % m_tiles * bs, mb = std::min(bs, m - i0);
+        size_t j0 = index / m_tiles * bs, nb = std::min(bs, n - j0);
+        T*     dA = static_cast<T*>(slot.buffer);
+        T*     dB = dA + bs * bs;
+        T*     dC = dB + bs * bs;
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        if(!hipblasXtIsZero(*beta))
+            status = hipblasXtCopy(dC, bs, C + i0 + j0 * ldc, ldc, mb, nb, slot.stream);
+
+        for(size_t p = 0; status == HIPBLAS_STATUS_SUCCESS && p < k_tiles; p++)
+        {
+            size_t k0 = p * bs, kb = std::min(bs, k_used - k0);
+            if(a_n)
+                status = hipblasXtCopy(dA, bs, A + i0 + k0 * lda, lda, mb, kb, slot.stream);
+            else
+                status = hipblasXtCopy(dA, bs, A + k0 + i0 * lda, lda, kb, mb, slot.stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+            if(b_n)
+                status = hipblasXtCopy(dB, bs, B + k0 + j0 * ldb, ldb, kb, nb, slot.stream);
+            else
+                status = hipblasXtCopy(dB, bs, B + j0 + k0 * ldb, ldb, nb, kb, slot.stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+
+            status = hipblasXtTraits<T>::gemm(slot.handle,
+                                              transA,
+                                              transB,
+                                              mb,
+                                              nb,
+                                              kb,
+                                              alpha,
+                                              dA,
+                                              bs,
+                                              dB,
+                                              bs,
+                                              p ? &one : beta,
+                                              dC,
+                                              bs);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasXtCopy(C + i0 + j0 * ldc, ldc, dC, bs, mb, nb, slot.stream);
+        return status;
+    };
+
+    return hipblasXtRun(context, m_tiles * hipblasXtTiles(n, bs), 3 * bs * bs * sizeof(T), tile);
+}
+
+// C = alpha op(A) op(A)^T + beta C for the uplo triangle of C. The tiles on the diagonal use
+// syrk and the tiles below or above it gemm.
+template <typename T>
+static hipblasStatus_t hipblasXtSyrk(hipblasXtHandle_t  handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     size_t             n,
+                                     size_t             k,
+                                     const T*           alpha,
+                                     const T*           A,
+                                     size_t             lda,
+                                     const T*           beta,
+                                     T*                 C,
+                                     size_t             ldc)
+{
+    auto* context = static_cast<hipblasXtContext*>(handle);
+    if(!context)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool a_n = transA == HIPBLAS_OP_N;
+    if(uplo != HIPBLAS_FILL_MODE_LOWER && uplo != HIPBLAS_FILL_MODE_UPPER)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!a_n && transA != HIPBLAS_OP_T && (hipblasXtTraits<T>::complex || transA != HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(lda < std::max<size_t>(1, a_n ? n : k) || ldc < std::max<size_t>(1, n))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !C || (k && !A))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(context->mutex);
+
+    size_t  bs      = context->block_dim;
+    size_t  k_used  = hipblasXtIsZero(*alpha) ? 0 : k;
+    size_t  k_tiles = std::max<size_t>(1, hipblasXtTiles(k_used, bs));
+    size_t  n_tiles = hipblasXtTiles(n, bs);
+    bool    lower   = uplo == HIPBLAS_FILL_MODE_LOWER;
+    const T one(1);
+
+    std::vector<std::pair<size_t, size_t>> tiles;
+    for(size_t j = 0; j < n_tiles; j++)
+    {
+        for(size_t i = lower ? j : 0; i < (lower ? n_tiles : j + 1); i++)
+            tiles.emplace_back(i * bs, j * bs);
+    }
+
+    auto tile = [&](hipblasXtSlot& slot, size_t index) {
+        size_t i0 = tiles[index].first, mb = std::min(bs, n - i0);
+        size_t j0 = tiles[index].second, nb = std::min(bs, n - j0);
+        T*     dA = static_cast<T*>(slot.buffer);
+        T*     dB = dA + bs * bs;
+        T*     dC = dB + bs * bs;
+
+        // A tile on the diagonal is written back whole, so its other triangle is read as well
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        if(i0 == j0 || !hipblasXtIsZero(*beta))
+            status = hipblasXtCopy(dC, bs, C + i0 + j0 * ldc, ldc, mb, nb, slot.stream);
+
+        for(size_t p = 0; status == HIPBLAS_STATUS_SUCCESS && p < k_tiles; p++)
+        {
+            size_t   k0     = p * bs, kb = std::min(bs, k_used - k0);
+            const T* beta_p = p ? &one : beta;
+            if(a_n)
+                status = hipblasXtCopy(dA, bs, A + i0 + k0 * lda, lda, mb, kb, slot.stream);
+            else
+                status = hipblasXtCopy(dA, bs, A + k0 + i0 * lda, lda, kb, mb, slot.stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+
+            if(i0 == j0)
+            {
+                status = hipblasXtTraits<T>::syrk(
+                    slot.handle, uplo, transA, nb, kb, alpha, dA, bs, beta_p, dC, bs);
+                continue;
+            }
+
+            if(a_n)
+                status = hipblasXtCopy(dB, bs, A + j0 + k0 * lda, lda, nb, kb, slot.stream);
+            else
+                status = hipblasXtCopy(dB, bs, A + k0 + j0 * lda, lda, kb, nb, slot.stream);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasXtTraits<T>::gemm(slot.handle,
+                                                  a_n ? HIPBLAS_OP_N : HIPBLAS_OP_T,
+                                                  a_n ? HIPBLAS_OP_T : HIPBLAS_OP_N,
+                                                  mb,
+                                                  nb,
+                                                  kb,
+                                                  alpha,
+                                                  dA,
+                                                  bs,
+                                                  dB,
+                                                  bs,
+                                                  beta_p,
+                                                  dC,
+                                                  bs);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasXtCopy(C + i0 + j0 * ldc, ldc, dC, bs, mb, nb, slot.stream);
+        return status;
+    };
+
+    return hipblasXtRun(context, tiles.size(), 3 * bs * bs * sizeof(T), tile);
+}
+
+// Solve op(A) X = alpha B or X op(A) = alpha B, overwriting B with X. B is split into panels of
+// bs columns (left side) or rows (right side), each solved on one device by a blocked
+// substitution that streams the bs x bs blocks of A.
+template <typename T>
+static hipblasStatus_t hipblasXtTrsm(hipblasXtHandle_t  handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     size_t             m,
+                                     size_t             n,
+                                     const T*           alpha,
+                                     const T*           A,
+                                     size_t             lda,
+                                     T*                 B,
+                                     size_t             ldb)
+{
+    auto* context = static_cast<hipblasXtContext*>(handle);
+    if(!context)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool left = side == HIPBLAS_SIDE_LEFT, a_n = transA == HIPBLAS_OP_N;
+    if(!left && side != HIPBLAS_SIDE_RIGHT)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(uplo != HIPBLAS_FILL_MODE_LOWER && uplo != HIPBLAS_FILL_MODE_UPPER)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Order of A, the dimension of B each panel holds whole
+    size_t dim = left ? m : n;
+    if(lda < std::max<size_t>(1, dim) || ldb < std::max<size_t>(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !A || !B)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(dim > INT_MAX)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    std::lock_guard<std::mutex> lock(context->mutex);
+
+    // Substitute forward when op(A) is lower triangular (left) or upper triangular (right)
+    size_t  bs      = context->block_dim;
+    size_t  blocks  = hipblasXtTiles(dim, bs);
+    size_t  ld      = left ? m : bs;
+    bool    forward = (uplo == HIPBLAS_FILL_MODE_LOWER) == (a_n == left);
+    const T one(1), minus_one(-1);
+
+    auto block = [&](size_t s, size_t& b0, size_t& nb) {
+        b0 = (forward ? s : blocks - 1 - s) * bs;
+        nb = std::min(bs, dim - b0);
+    };
+
+    auto tile = [&](hipblasXtSlot& slot, size_t index) {
+        size_t p0 = index * bs, pb = std::min(bs, (left ? n : m) - p0);
+        T*     dA = static_cast<T*>(slot.buffer);
+        T*     dP = dA + bs * bs;
+
+        hipblasStatus_t status
+            = left ? hipblasXtCopy(dP, ld, B + p0 * ldb, ldb, m, pb, slot.stream)
+                   : hipblasXtCopy(dP, ld, B + p0, ldb, pb, n, slot.stream);
+
+        // Solve with each diagonal block of A, then remove its part from the blocks after it.
+        // Alpha scales the right hand side on the first step.
+        for(size_t s = 0; status == HIPBLAS_STATUS_SUCCESS && s < blocks; s++)
+        {
+            size_t   i0, bi;
+            const T* scale = s ? &one : alpha;
+            block(s, i0, bi);
+
+            status = hipblasXtCopy(dA, bs, A + i0 + i0 * lda, lda, bi, bi, slot.stream);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasXtTraits<T>::trsm(slot.handle,
+                                                  side,
+                                                  uplo,
+                                                  transA,
+                                                  diag,
+                                                  left ? bi : pb,
+                                                  left ? pb : bi,
+                                                  scale,
+                                                  dA,
+                                                  bs,
+                                                  left ? dP + i0 : dP + i0 * ld,
+                                                  ld);
+
+            for(size_t t = s + 1; status == HIPBLAS_STATUS_SUCCESS && t < blocks; t++)
+            {
+                size_t r0, br;
+                block(t, r0, br);
+
+                // The block of op(A) coupling block r to block i, stored transposed unless a_n
+                if(a_n == left)
+                    status = hipblasXtCopy(dA, bs, A + r0 + i0 * lda, lda, br, bi, slot.stream);
+                else
+                    status = hipblasXtCopy(dA, bs, A + i0 + r0 * lda, lda, bi, br, slot.stream);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    break;
+
+                if(left)
+                    status = hipblasXtTraits<T>::gemm(slot.handle,
+                                                      transA,
+                                                      HIPBLAS_OP_N,
+                                                      br,
+                                                      pb,
+                                                      bi,
+                                                      &minus_one,
+                                                      dA,
+                                                      bs,
+                                                      dP + i0,
+                                                      ld,
+                                                      scale,
+                                                      dP + r0,
+                                                      ld);
+                else
+                    status = hipblasXtTraits<T>::gemm(slot.handle,
+                                                      HIPBLAS_OP_N,
+                                                      transA,
+                                                      pb,
+                                                      br,
+                                                      bi,
+                                                      &minus_one,
+                                                      dP + i0 * ld,
+                                                      ld,
+                                                      dA,
+                                                      bs,
+                                                      scale,
+                                                      dP + r0 * ld,
+                                                      ld);
+            }
+        }
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = left ? hipblasXtCopy(B + p0 * ldb, ldb, dP, ld, m, pb, slot.stream)
+                          : hipblasXtCopy(B + p0, ldb, dP, ld, pb, n, slot.stream);
+        return status;
+    };
+
+    return hipblasXtRun(context,
+                        hipblasXtTiles(left ? n : m, bs),
+                        (dim + bs) * bs * sizeof(T),
+                        tile);
+}
+
+extern "C" hipblasStatus_t hipblasXtCreate(hipblasXtHandle_t* handle)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle);
+    if(!handle)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int count = 0;
+    if(hipGetDeviceCount(&count) != hipSuccess || count <= 0)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+
+    // All visible devices are used until hipblasXtDeviceSelect is called
+    std::unique_ptr<hipblasXtContext> context(new hipblasXtContext);
+    context->devices.resize(count);
+    for(int id = 0; id < count; id++)
+        context->devices[id].id = id;
+    *handle = context.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtDestroy(hipblasXtHandle_t handle)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle);
+    auto* context = static_cast<hipblasXtContext*>(handle);
+    if(!context)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    for(auto& device : context->devices)
+        hipblasXtRelease(device);
+    delete context;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasXtDeviceSelect(hipblasXtHandle_t handle, int nbDevices, const int* deviceId)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, nbDevices, deviceId);
+    auto* context = static_cast<hipblasXtContext*>(handle);
+    if(!context)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    int count = 0;
+    if(hipGetDeviceCount(&count) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(nbDevices <= 0 || !deviceId)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int i = 0; i < nbDevices; i++)
+    {
+        if(deviceId[i] < 0 || deviceId[i] >= count
+           || std::find(deviceId, deviceId + i, deviceId[i]) != deviceId + i)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    std::vector<hipblasXtDevice> devices(nbDevices);
+    for(int i = 0; i < nbDevices; i++)
+        devices[i].id = deviceId[i];
+
+    std::lock_guard<std::mutex> lock(context->mutex);
+    for(auto& device : context->devices)
+        hipblasXtRelease(device);
+    context->devices = std::move(devices);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtSetBlockDim(hipblasXtHandle_t handle, int blockDim)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, blockDim);
+    auto* context = static_cast<hipblasXtContext*>(handle);
+    if(!context)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blockDim <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(context->mutex);
+    context->block_dim = blockDim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtGetBlockDim(hipblasXtHandle_t handle, int* blockDim)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, blockDim);
+    auto* context = static_cast<hipblasXtContext*>(handle);
+    if(!context)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!blockDim)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::lock_guard<std::mutex> lock(context->mutex);
+    *blockDim = context->block_dim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtSgemm(hipblasXtHandle_t  handle,
+                                          hipblasOperation_t transA,
+                                          hipblasOperation_t transB,
+                                          size_t             m,
+                                          size_t             n,
+                                          size_t             k,
+                                          const float*       alpha,
+                                          const float*       AP,
+                                          size_t             lda,
+                                          const float*       BP,
+                                          size_t             ldb,
+                                          const float*       beta,
+                                          float*             CP,
+                                          size_t             ldc)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+    return hipblasXtGemm(handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtSsyrk(hipblasXtHandle_t  handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          size_t             n,
+                                          size_t             k,
+                                          const float*       alpha,
+                                          const float*       AP,
+                                          size_t             lda,
+                                          const float*       beta,
+                                          float*             CP,
+                                          size_t             ldc)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+    return hipblasXtSyrk(handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtStrsm(hipblasXtHandle_t  handle,
+                                          hipblasSideMode_t  side,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          hipblasDiagType_t  diag,
+                                          size_t             m,
+                                          size_t             n,
+                                          const float*       alpha,
+                                          const float*       AP,
+                                          size_t             lda,
+                                          float*             BP,
+                                          size_t             ldb)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+    return hipblasXtTrsm(handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtDgemm(hipblasXtHandle_t  handle,
+                                          hipblasOperation_t transA,
+                                          hipblasOperation_t transB,
+                                          size_t             m,
+                                          size_t             n,
+                                          size_t             k,
+                                          const double*      alpha,
+                                          const double*      AP,
+                                          size_t             lda,
+                                          const double*      BP,
+                                          size_t             ldb,
+                                          const double*      beta,
+                                          double*            CP,
+                                          size_t             ldc)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+    return hipblasXtGemm(handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtDsyrk(hipblasXtHandle_t  handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          size_t             n,
+                                          size_t             k,
+                                          const double*      alpha,
+                                          const double*      AP,
+                                          size_t             lda,
+                                          const double*      beta,
+                                          double*            CP,
+                                          size_t             ldc)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+    return hipblasXtSyrk(handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtDtrsm(hipblasXtHandle_t  handle,
+                                          hipblasSideMode_t  side,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          hipblasDiagType_t  diag,
+                                          size_t             m,
+                                          size_t             n,
+                                          const double*      alpha,
+                                          const double*      AP,
+                                          size_t             lda,
+                                          double*            BP,
+                                          size_t             ldb)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+    return hipblasXtTrsm(handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtCgemm(hipblasXtHandle_t     handle,
+                                          hipblasOperation_t    transA,
+                                          hipblasOperation_t    transB,
+                                          size_t                m,
+                                          size_t                n,
+                                          size_t                k,
+                                          const hipblasComplex* alpha,
+                                          const hipblasComplex* AP,
+                                          size_t                lda,
+                                          const hipblasComplex* BP,
+                                          size_t                ldb,
+                                          const hipblasComplex* beta,
+                                          hipblasComplex*       CP,
+                                          size_t                ldc)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+    return hipblasXtGemm(handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtCsyrk(hipblasXtHandle_t     handle,
+                                          hipblasFillMode_t     uplo,
+                                          hipblasOperation_t    transA,
+                                          size_t                n,
+                                          size_t                k,
+                                          const hipblasComplex* alpha,
+                                          const hipblasComplex* AP,
+                                          size_t                lda,
+                                          const hipblasComplex* beta,
+                                          hipblasComplex*       CP,
+                                          size_t                ldc)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+    return hipblasXtSyrk(handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtCtrsm(hipblasXtHandle_t     handle,
+                                          hipblasSideMode_t     side,
+                                          hipblasFillMode_t     uplo,
+                                          hipblasOperation_t    transA,
+                                          hipblasDiagType_t     diag,
+                                          size_t                m,
+                                          size_t                n,
+                                          const hipblasComplex* alpha,
+                                          const hipblasComplex* AP,
+                                          size_t                lda,
+                                          hipblasComplex*       BP,
+                                          size_t                ldb)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+    return hipblasXtTrsm(handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtZgemm(hipblasXtHandle_t           handle,
+                                          hipblasOperation_t          transA,
+                                          hipblasOperation_t          transB,
+                                          size_t                      m,
+                                          size_t                      n,
+                                          size_t                      k,
+                                          const hipblasDoubleComplex* alpha,
+                                          const hipblasDoubleComplex* AP,
+                                          size_t                      lda,
+                                          const hipblasDoubleComplex* BP,
+                                          size_t                      ldb,
+                                          const hipblasDoubleComplex* beta,
+                                          hipblasDoubleComplex*       CP,
+                                          size_t                      ldc)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+    return hipblasXtGemm(handle, transA, transB, m, n, k, alpha, AP, lda, BP, ldb, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtZsyrk(hipblasXtHandle_t           handle,
+                                          hipblasFillMode_t           uplo,
+                                          hipblasOperation_t          transA,
+                                          size_t                      n,
+                                          size_t                      k,
+                                          const hipblasDoubleComplex* alpha,
+                                          const hipblasDoubleComplex* AP,
+                                          size_t                      lda,
+                                          const hipblasDoubleComplex* beta,
+                                          hipblasDoubleComplex*       CP,
+                                          size_t                      ldc)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+    return hipblasXtSyrk(handle, uplo, transA, n, k, alpha, AP, lda, beta, CP, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasXtZtrsm(hipblasXtHandle_t           handle,
+                                          hipblasSideMode_t           side,
+                                          hipblasFillMode_t           uplo,
+                                          hipblasOperation_t          transA,
+                                          hipblasDiagType_t           diag,
+                                          size_t                      m,
+                                          size_t                      n,
+                                          const hipblasDoubleComplex* alpha,
+                                          const hipblasDoubleComplex* AP,
+                                          size_t                      lda,
+                                          hipblasDoubleComplex*       BP,
+                                          size_t                      ldb)
+try
+{
+    HIPBLAS_LAYER(nullptr, handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+    return hipblasXtTrsm(handle, side, uplo, transA, diag, m, n, alpha, AP, lda, BP, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,43 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Device and NUMA node of the handles made by hipblasCreateWithAttributes. The staging buffers
+// and info summary buffers are pinned host memory shared by the handles of a device, so their
+// node is set per device, by the handle created last on it.
+
+// NUMA node set for device, or HIPBLAS_NUMA_NODE_ANY
+int hipblasAffinityDeviceNode(int device);
+
+// Allocates pinned host memory on node, with hipHostMalloc when node is HIPBLAS_NUMA_NODE_ANY or
+// the memory cannot be bound to it
+hipError_t hipblasAffinityHostMalloc(void** ptr, size_t bytes, int node);
+
+// Frees memory from hipblasAffinityHostMalloc
+hipError_t hipblasAffinityHostFree(void* ptr);
+
+// Forget the attributes of handle
+void hipblasAffinityErase(hipblasHandle_t handle);
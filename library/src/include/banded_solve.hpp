@@ -0,0 +1,156 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Only built with BUILD_WITH_BANDED_SOLVE (HIPBLAS_BANDED_SOLVE). Largest n of the parallel
+// cyclic reduction kernel of gtsv, which keeps a whole system in local memory, with one work group
+// per system and one thread per equation. Larger systems and the interleaved layout are solved by
+// the Thomas algorithm with one thread per system.
+constexpr int hipblas_gtsv_pcr_max_n = 512;
+
+// gtsv without pivoting of every system of a batch, overwriting x with the solution. With
+// interleaved, element j of system b is at j * batch_count + b of every array and strideA and
+// strideX are not used. Otherwise it is at j + b * strideA of dl, d and du and at j + b * strideX
+// of x. dl[0] and du[n - 1] of each system are not read. The arguments are checked by the callers,
+// and the call does not wait for the stream.
+hipblasStatus_t hipblasGtsvKernels(hipblasHandle_t handle,
+                                   int             n,
+                                   const float*    dl,
+                                   const float*    d,
+                                   const float*    du,
+                                   hipblasStride   strideA,
+                                   float*          x,
+                                   hipblasStride   strideX,
+                                   bool            interleaved,
+                                   int             batch_count);
+
+hipblasStatus_t hipblasGtsvKernels(hipblasHandle_t handle,
+                                   int             n,
+                                   const double*   dl,
+                                   const double*   d,
+                                   const double*   du,
+                                   hipblasStride   strideA,
+                                   double*         x,
+                                   hipblasStride   strideX,
+                                   bool            interleaved,
+                                   int             batch_count);
+
+hipblasStatus_t hipblasGtsvKernels(hipblasHandle_t       handle,
+                                   int                   n,
+                                   const hipblasComplex* dl,
+                                   const hipblasComplex* d,
+                                   const hipblasComplex* du,
+                                   hipblasStride         strideA,
+                                   hipblasComplex*       x,
+                                   hipblasStride         strideX,
+                                   bool                  interleaved,
+                                   int                   batch_count);
+
+hipblasStatus_t hipblasGtsvKernels(hipblasHandle_t             handle,
+                                   int                         n,
+                                   const hipblasDoubleComplex* dl,
+                                   const hipblasDoubleComplex* d,
+                                   const hipblasDoubleComplex* du,
+                                   hipblasStride               strideA,
+                                   hipblasDoubleComplex*       x,
+                                   hipblasStride               strideX,
+                                   bool                        interleaved,
+                                   int                         batch_count);
+
+// gbsv with partial pivoting of every system of a batch, as LAPACK ?gbsv, with AB_b being
+// AB_array[b] when AB_array is not null and AB + b * strideAB otherwise, and B_b alike. ipiv_b is
+// at ipiv + b * strideP, and info holds one value per system on the device.
+hipblasStatus_t hipblasGbsvKernels(hipblasHandle_t handle,
+                                   int             n,
+                                   int             kl,
+                                   int             ku,
+                                   int             nrhs,
+                                   float*          AB,
+                                   float* const*   AB_array,
+                                   int             ldab,
+                                   hipblasStride   strideAB,
+                                   int*            ipiv,
+                                   hipblasStride   strideP,
+                                   float*          B,
+                                   float* const*   B_array,
+                                   int             ldb,
+                                   hipblasStride   strideB,
+                                   int*            info,
+                                   int             batch_count);
+
+hipblasStatus_t hipblasGbsvKernels(hipblasHandle_t handle,
+                                   int             n,
+                                   int             kl,
+                                   int             ku,
+                                   int             nrhs,
+                                   double*         AB,
+                                   double* const*  AB_array,
+                                   int             ldab,
+                                   hipblasStride   strideAB,
+                                   int*            ipiv,
+                                   hipblasStride   strideP,
+                                   double*         B,
+                                   double* const*  B_array,
+                                   int             ldb,
+                                   hipblasStride   strideB,
+                                   int*            info,
+                                   int             batch_count);
+
+hipblasStatus_t hipblasGbsvKernels(hipblasHandle_t        handle,
+                                   int                    n,
+                                   int                    kl,
+                                   int                    ku,
+                                   int                    nrhs,
+                                   hipblasComplex*        AB,
+                                   hipblasComplex* const* AB_array,
+                                   int                    ldab,
+                                   hipblasStride          strideAB,
+                                   int*                   ipiv,
+                                   hipblasStride          strideP,
+                                   hipblasComplex*        B,
+                                   hipblasComplex* const* B_array,
+                                   int                    ldb,
+                                   hipblasStride          strideB,
+                                   int*                   info,
+                                   int                    batch_count);
+
+hipblasStatus_t hipblasGbsvKernels(hipblasHandle_t              handle,
+                                   int                          n,
+                                   int                          kl,
+                                   int                          ku,
+                                   int                          nrhs,
+                                   hipblasDoubleComplex*        AB,
+                                   hipblasDoubleComplex* const* AB_array,
+                                   int                          ldab,
+                                   hipblasStride                strideAB,
+                                   int*                         ipiv,
+                                   hipblasStride                strideP,
+                                   hipblasDoubleComplex*        B,
+                                   hipblasDoubleComplex* const* B_array,
+                                   int                          ldb,
+                                   hipblasStride                strideB,
+                                   int*                         info,
+                                   int                          batch_count);
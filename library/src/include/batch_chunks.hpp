@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "batch_scalars.hpp"
+#include <algorithm>
+
+// Strided batched calls over more problems than one backend call takes are split into chunks of
+// at most hipblas_batch_chunk problems. Each chunk is a nested call of the same entry point on the
+// problems from first, with the pointers advanced by first * stride in 64 bits. The entry point
+// applies the layout of the handle before it splits the call, as the nested calls are
+// column-major. The chunks run one after the other on the handle stream, and each may itself be
+// spread over the stream pool of the handle. Some backend kernels put the batch on the y or z
+// dimension of their grid, which is limited to 65535.
+constexpr int64_t hipblas_batch_chunk = 65535;
+
+// True when a call over batch_count problems on handle is split. Calls with per-instance scalars
+// set with hipblasSetBatchScalarStride are not, as their kernels loop over the batch themselves.
+inline bool hipblasBatchChunked(hipblasHandle_t handle, int64_t batch_count)
+{
+    return batch_count > hipblas_batch_chunk && !hipblasBatchScalarStride(handle);
+}
+
+// Runs run(first, count) over the chunks of batch_count problems in order, and returns the first
+// failing status
+template <typename Run>
+inline hipblasStatus_t hipblasBatchChunks(int64_t batch_count, Run&& run)
+{
+    for(int64_t first = 0; first < batch_count; first += hipblas_batch_chunk)
+    {
+        int             count  = int(std::min(hipblas_batch_chunk, batch_count - first));
+        hipblasStatus_t status = run(first, count);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
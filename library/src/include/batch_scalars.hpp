@@ -0,0 +1,214 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Per-instance alpha and beta of the batched gemm, trsm, gemv, axpy and scal calls, set with
+// hipblasSetBatchScalarStride. In device pointer mode instance i of a call with batch_count > 1
+// then reads alpha[i * stride] and beta[i * stride].
+//
+// With BUILD_WITH_BATCH_SCALARS (HIPBLAS_BATCH_SCALARS) the scalars are applied by one kernel
+// over the batch: a gemm writes op( A_i ) * op( B_i ) into a stream-ordered scratch buffer, which
+// the kernel combines into C_i, and a trsm scales B_i by alpha_i before solving with alpha = 1.
+// A gemv does as a gemm with op( A_i ) * x_i, and axpy and scal are one kernel each. Otherwise,
+// or when the kernel does not support the types, each instance is one backend call.
+
+// Stride of the scalars of the batched calls on handle, or 0 when each call takes one alpha and
+// one beta, as in host pointer mode
+hipblasStride hipblasBatchScalarStride(hipblasHandle_t handle);
+
+// Forget the stride set on handle
+void hipblasBatchScalarStrideErase(hipblasHandle_t handle);
+
+// gemm with per-instance scalars, where A_array, B_array and C_array are the pointer arrays of
+// the batched form and null otherwise
+hipblasStatus_t hipblasGemmBatchScalars(hipblasHandle_t      handle,
+                                        hipblasOperation_t   transa,
+                                        hipblasOperation_t   transb,
+                                        int                  m,
+                                        int                  n,
+                                        int                  k,
+                                        const void*          alpha,
+                                        const void*          A,
+                                        const void* const*   A_array,
+                                        hipDataType          a_type,
+                                        int                  lda,
+                                        hipblasStride        stride_A,
+                                        const void*          B,
+                                        const void* const*   B_array,
+                                        hipDataType          b_type,
+                                        int                  ldb,
+                                        hipblasStride        stride_B,
+                                        const void*          beta,
+                                        void*                C,
+                                        void* const*         C_array,
+                                        hipDataType          c_type,
+                                        int                  ldc,
+                                        hipblasStride        stride_C,
+                                        int                  batch_count,
+                                        hipblasComputeType_t compute_type,
+                                        hipblasGemmAlgo_t    algo,
+                                        hipblasStride        stride_scalars);
+
+// trsm_batched with per-instance alpha, for float, double, hipblasComplex and
+// hipblasDoubleComplex
+template <typename T>
+hipblasStatus_t hipblasTrsmBatchScalars(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const T*           alpha,
+                                        const T* const     A[],
+                                        int                lda,
+                                        T* const           B[],
+                                        int                ldb,
+                                        int                batch_count,
+                                        hipblasStride      stride_scalars);
+
+// scal, axpy and gemv of the batched and strided batched forms with per-instance scalars, for
+// float, double, hipblasComplex and hipblasDoubleComplex. x_array, y_array and A_array are the
+// pointer arrays of the batched forms; the strided batched forms pass null for them and give the
+// base pointers and strides instead.
+template <typename T>
+hipblasStatus_t hipblasScalBatchScalars(hipblasHandle_t handle,
+                                        int             n,
+                                        const T*        alpha,
+                                        T*              x,
+                                        T* const*       x_array,
+                                        int             incx,
+                                        hipblasStride   stride_x,
+                                        int             batch_count,
+                                        hipblasStride   stride_scalars);
+
+template <typename T>
+hipblasStatus_t hipblasAxpyBatchScalars(hipblasHandle_t handle,
+                                        int             n,
+                                        const T*        alpha,
+                                        const T*        x,
+                                        const T* const* x_array,
+                                        int             incx,
+                                        hipblasStride   stride_x,
+                                        T*              y,
+                                        T* const*       y_array,
+                                        int             incy,
+                                        hipblasStride   stride_y,
+                                        int             batch_count,
+                                        hipblasStride   stride_scalars);
+
+template <typename T>
+hipblasStatus_t hipblasGemvBatchScalars(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const T*           alpha,
+                                        const T*           A,
+                                        const T* const*    A_array,
+                                        int                lda,
+                                        hipblasStride      stride_A,
+                                        const T*           x,
+                                        const T* const*    x_array,
+                                        int                incx,
+                                        hipblasStride      stride_x,
+                                        const T*           beta,
+                                        T*                 y,
+                                        T* const*          y_array,
+                                        int                incy,
+                                        hipblasStride      stride_y,
+                                        int                batch_count,
+                                        hipblasStride      stride_scalars);
+
+// Kernels of batch_scalars_kernels.cpp, only built with BUILD_WITH_BATCH_SCALARS. They return
+// HIPBLAS_STATUS_NOT_SUPPORTED, without launching, for the types they have no kernel for.
+
+// array[i] := base + i * stride bytes
+hipblasStatus_t hipblasBatchScalarsPointers(
+    hipStream_t stream, void** array, void* base, size_t stride, int batch_count);
+
+// C_i := alpha_i * W_i + beta_i * C_i, where W_i is m by n of scalar_type at W + i * m * n with
+// leading dimension m, and C_i is not read when beta_i is 0. scalar_type is HIP_R_32F, with a
+// c_type of HIP_R_16F, HIP_R_16BF or HIP_R_32F, or HIP_R_64F, HIP_C_32F or HIP_C_64F with the
+// same c_type.
+hipblasStatus_t hipblasBatchScalarsAxpby(hipStream_t   stream,
+                                         int           m,
+                                         int           n,
+                                         const void*   alpha,
+                                         const void*   beta,
+                                         hipDataType   scalar_type,
+                                         hipblasStride stride_scalars,
+                                         const void*   W,
+                                         void*         C,
+                                         void* const*  C_array,
+                                         hipDataType   c_type,
+                                         int           ldc,
+                                         hipblasStride stride_C,
+                                         int           batch_count);
+
+// B_i := alpha_i * B_i, with B_i set to 0 when alpha_i is 0, for HIP_R_32F, HIP_R_64F, HIP_C_32F
+// and HIP_C_64F
+hipblasStatus_t hipblasBatchScalarsScale(hipStream_t   stream,
+                                         int           m,
+                                         int           n,
+                                         const void*   alpha,
+                                         hipDataType   type,
+                                         hipblasStride stride_scalars,
+                                         void* const*  B_array,
+                                         int           ldb,
+                                         int           batch_count);
+
+// y_i := alpha_i * x_i + beta_i * y_i over n elements, or y_i := alpha_i * x_i + y_i when beta is
+// null, for HIP_R_32F, HIP_R_64F, HIP_C_32F and HIP_C_64F. x_i is not read when alpha_i is 0, nor
+// y_i when beta_i is 0. The vectors are x_array[i] when it is given and x + i * stride_x
+// otherwise, and a negative increment starts at the last element, as in the reference BLAS.
+hipblasStatus_t hipblasBatchScalarsAxpbyVector(hipStream_t        stream,
+                                               int                n,
+                                               const void*        alpha,
+                                               const void*        beta,
+                                               hipDataType        type,
+                                               hipblasStride      stride_scalars,
+                                               const void*        x,
+                                               const void* const* x_array,
+                                               int                incx,
+                                               hipblasStride      stride_x,
+                                               void*              y,
+                                               void* const*       y_array,
+                                               int                incy,
+                                               hipblasStride      stride_y,
+                                               int                batch_count);
+
+// x_i := alpha_i * x_i over n elements, with the types and vectors of
+// hipblasBatchScalarsAxpbyVector
+hipblasStatus_t hipblasBatchScalarsScaleVector(hipStream_t   stream,
+                                               int           n,
+                                               const void*   alpha,
+                                               hipDataType   type,
+                                               hipblasStride stride_scalars,
+                                               void*         x,
+                                               void* const*  x_array,
+                                               int           incx,
+                                               hipblasStride stride_x,
+                                               int           batch_count);
@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Batched and strided batched iamax, iamin, nrm2 and scal kernels for the cuBLAS backend, which
+// has no batched Level-1 routines. Each function is one launch over the whole batch: a work group
+// reduces one vector of iamax, iamin and nrm2, and scal strides over every element of the batch.
+// Results are written to the device array result in device pointer mode, without waiting for the
+// stream; in host pointer mode they go through a device buffer kept per handle and the call
+// waits for them, as the backend does for a host result.
+//
+// Only built with BUILD_WITH_BATCHED_LEVEL1 (HIPBLAS_BATCHED_LEVEL1). T is float, double,
+// hipblasComplex or hipblasDoubleComplex, with Ta of scal either T or the real type of T.
+// The strided batched vectors are x + i * stridex.
+
+template <typename T>
+hipblasStatus_t hipblasBatchedIamax(hipblasHandle_t handle,
+                                    bool            amin,
+                                    int             n,
+                                    const T* const  x[],
+                                    int             incx,
+                                    int             batch_count,
+                                    int*            result);
+
+template <typename T>
+hipblasStatus_t hipblasBatchedIamax(hipblasHandle_t handle,
+                                    bool            amin,
+                                    int             n,
+                                    const T*        x,
+                                    int             incx,
+                                    hipblasStride   stridex,
+                                    int             batch_count,
+                                    int*            result);
+
+template <typename T, typename Tr>
+hipblasStatus_t hipblasBatchedNrm2(hipblasHandle_t handle,
+                                   int             n,
+                                   const T* const  x[],
+                                   int             incx,
+                                   int             batch_count,
+                                   Tr*             result);
+
+template <typename T, typename Tr>
+hipblasStatus_t hipblasBatchedNrm2(hipblasHandle_t handle,
+                                   int             n,
+                                   const T*        x,
+                                   int             incx,
+                                   hipblasStride   stridex,
+                                   int             batch_count,
+                                   Tr*             result);
+
+template <typename T, typename Ta>
+hipblasStatus_t hipblasBatchedScal(
+    hipblasHandle_t handle, int n, const Ta* alpha, T* const x[], int incx, int batch_count);
+
+template <typename T, typename Ta>
+hipblasStatus_t hipblasBatchedScal(hipblasHandle_t handle,
+                                   int             n,
+                                   const Ta*       alpha,
+                                   T*              x,
+                                   int             incx,
+                                   hipblasStride   stridex,
+                                   int             batch_count);
+
+// Free the device buffer of handle
+void hipblasBatchedLevel1Erase(hipblasHandle_t handle);
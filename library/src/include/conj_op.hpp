@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// HIPBLAS_OP_CONJ, the conjugate of a complex operand without its transpose, which neither backend
+// takes. A gemm conjugate-transposes each such operand into stream-ordered scratch with geam and
+// runs on it with HIPBLAS_OP_T, as conj( A ) = ( A^H )^T. A gemv uses
+// conj( A )*x = conj( A*conj( x ) ): it conjugates y in place, a copy of x and the scalars, runs
+// with HIPBLAS_OP_N and conjugates y back, so only vectors are touched and A is read once. The
+// imaginary parts are negated by a real scal on the interleaved data, without a kernel of its own.
+
+// Returns false, without doing anything, unless transa or transb is HIPBLAS_OP_CONJ, and true with
+// the result in status otherwise. The arguments are those of hipblasCgemmStridedBatched; a single
+// gemm has batch_count 1.
+bool hipblasGemmConj(hipblasHandle_t       handle,
+                     hipblasOperation_t    transa,
+                     hipblasOperation_t    transb,
+                     int                   m,
+                     int                   n,
+                     int                   k,
+                     const hipblasComplex* alpha,
+                     const hipblasComplex* A,
+                     int                   lda,
+                     hipblasStride         stride_A,
+                     const hipblasComplex* B,
+                     int                   ldb,
+                     hipblasStride         stride_B,
+                     const hipblasComplex* beta,
+                     hipblasComplex*       C,
+                     int                   ldc,
+                     hipblasStride         stride_C,
+                     int                   batch_count,
+                     hipblasStatus_t&      status);
+
+bool hipblasGemmConj(hipblasHandle_t             handle,
+                     hipblasOperation_t          transa,
+                     hipblasOperation_t          transb,
+                     int                         m,
+                     int                         n,
+                     int                         k,
+                     const hipblasDoubleComplex* alpha,
+                     const hipblasDoubleComplex* A,
+                     int                         lda,
+                     hipblasStride               stride_A,
+                     const hipblasDoubleComplex* B,
+                     int                         ldb,
+                     hipblasStride               stride_B,
+                     const hipblasDoubleComplex* beta,
+                     hipblasDoubleComplex*       C,
+                     int                         ldc,
+                     hipblasStride               stride_C,
+                     int                         batch_count,
+                     hipblasStatus_t&            status);
+
+// The same for gemv and trans, with the arguments of hipblasCgemvStridedBatched
+bool hipblasGemvConj(hipblasHandle_t       handle,
+                     hipblasOperation_t    trans,
+                     int                   m,
+                     int                   n,
+                     const hipblasComplex* alpha,
+                     const hipblasComplex* A,
+                     int                   lda,
+                     hipblasStride         stride_A,
+                     const hipblasComplex* x,
+                     int                   incx,
+                     hipblasStride         stride_x,
+                     const hipblasComplex* beta,
+                     hipblasComplex*       y,
+                     int                   incy,
+                     hipblasStride         stride_y,
+                     int                   batch_count,
+                     hipblasStatus_t&      status);
+
+bool hipblasGemvConj(hipblasHandle_t             handle,
+                     hipblasOperation_t          trans,
+                     int                         m,
+                     int                         n,
+                     const hipblasDoubleComplex* alpha,
+                     const hipblasDoubleComplex* A,
+                     int                         lda,
+                     hipblasStride               stride_A,
+                     const hipblasDoubleComplex* x,
+                     int                         incx,
+                     hipblasStride               stride_x,
+                     const hipblasDoubleComplex* beta,
+                     hipblasDoubleComplex*       y,
+                     int                         incy,
+                     hipblasStride               stride_y,
+                     int                         batch_count,
+                     hipblasStatus_t&            status);
@@ -0,0 +1,55 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Conversion kernels behind hipblasConvertEx and its batched forms. Each thread converts
+// convert_vector consecutive elements, with one vector load and store when the pointers and
+// strides allow it, in float, or in double when a 64-bit float or a 32-bit integer is involved.
+//
+// Only built with BUILD_WITH_CONVERT (HIPBLAS_CONVERT). Any pair of the real types of
+// hipDataType is supported, and complex pairs convert as pairs of reals; real to complex and
+// complex to real return HIPBLAS_STATUS_NOT_SUPPORTED. The arguments are checked by the callers,
+// and the call does not wait for the stream nor allocate, so it may be captured in a graph.
+
+// y_b := alpha * x_b for b = 0, ..., batch_count - 1, where x_b is x_array[b] when x_array is not
+// null and x + b * stride_x otherwise, and likewise for y_b. alpha is a host or device pointer as
+// the pointer mode of handle, of alpha_type HIP_R_32F or HIP_R_64F, or nullptr for no scaling.
+// When saturate is set, values beyond the range of a floating-point y_type become its largest
+// finite value instead of infinity; integer y_types always saturate.
+hipblasStatus_t hipblasConvertKernels(hipblasHandle_t    handle,
+                                      int                n,
+                                      const void*        alpha,
+                                      hipDataType        alpha_type,
+                                      const void*        x,
+                                      const void* const* x_array,
+                                      hipDataType        x_type,
+                                      hipblasStride      stride_x,
+                                      void*              y,
+                                      void* const*       y_array,
+                                      hipDataType        y_type,
+                                      hipblasStride      stride_y,
+                                      int                batch_count,
+                                      bool               saturate);
@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdint>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+// Element conversions of the optional kernels, which need a HIP compiler. half and bfloat16 convert
+// through float.
+
+// bfloat16, kept as its bits
+struct hipblasDeviceBfloat16
+{
+    uint16_t data;
+};
+
+__device__ inline float hipblasDeviceToFloat(float a)
+{
+    return a;
+}
+
+__device__ inline float hipblasDeviceToFloat(__half a)
+{
+    return __half2float(a);
+}
+
+__device__ inline float hipblasDeviceToFloat(hipblasDeviceBfloat16 a)
+{
+    return __uint_as_float(uint32_t(a.data) << 16);
+}
+
+__device__ inline void hipblasDeviceFromFloat(float f, float& c)
+{
+    c = f;
+}
+
+__device__ inline void hipblasDeviceFromFloat(float f, __half& c)
+{
+    c = __float2half(f);
+}
+
+// Rounds to nearest even, as hipblasBfloat16
+__device__ inline void hipblasDeviceFromFloat(float f, hipblasDeviceBfloat16& c)
+{
+    uint32_t u = __float_as_uint(f);
+    if(~u & 0x7f800000)
+        u += 0x7fff + ((u >> 16) & 1);
+    else if(u & 0xffff)
+        u |= 0x10000; // Preserve signaling NaN
+    c.data = uint16_t(u >> 16);
+}
+
+// a as a Tc, unchanged when it is a Tc already
+template <typename Tc, typename Ta>
+__device__ inline Tc hipblasDeviceCast(Ta a)
+{
+    if constexpr(std::is_same<Ta, Tc>{})
+        return a;
+    else
+    {
+        Tc c;
+        hipblasDeviceFromFloat(hipblasDeviceToFloat(a), c);
+        return c;
+    }
+}
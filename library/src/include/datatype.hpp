@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstddef>
+
+// Size in bytes of an element of type, or 0 when it is not a type hipBLAS moves or converts
+inline size_t hipblasDatatypeElementSize(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_8I:
+    case HIP_R_8U:
+    case HIP_R_8F_E4M3:
+    case HIP_R_8F_E5M2:
+    case HIP_R_8F_E4M3_FNUZ:
+    case HIP_R_8F_E5M2_FNUZ:
+        return 1;
+    case HIP_R_16F:
+    case HIP_R_16BF:
+    case HIP_C_8I:
+    case HIP_C_8U:
+        return 2;
+    case HIP_R_32F:
+    case HIP_R_32I:
+    case HIP_R_32U:
+    case HIP_C_16F:
+    case HIP_C_16BF:
+        return 4;
+    case HIP_R_64F:
+    case HIP_C_32F:
+    case HIP_C_32I:
+    case HIP_C_32U:
+        return 8;
+    case HIP_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+// Size in bytes of an element of type, or 0 when it is not a matrix type of the gemm Ex routines
+inline size_t hipblasDatatypeSize(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_8I:
+    case HIP_R_16F:
+    case HIP_R_16BF:
+    case HIP_R_32F:
+    case HIP_R_32I:
+    case HIP_R_64F:
+    case HIP_C_32F:
+    case HIP_C_64F:
+        return hipblasDatatypeElementSize(type);
+    default:
+        return 0;
+    }
+}
+
+// Whether type is complex
+inline bool hipblasDatatypeComplex(hipDataType type)
+{
+    return type == HIP_C_8I || type == HIP_C_8U || type == HIP_C_16F || type == HIP_C_16BF
+           || type == HIP_C_32F || type == HIP_C_32I || type == HIP_C_32U || type == HIP_C_64F;
+}
+
+// Whether type is a floating point matrix type of the gemm Ex routines, real or complex
+inline bool hipblasDatatypeFloating(hipDataType type)
+{
+    return hipblasDatatypeSize(type) && type != HIP_R_8I && type != HIP_R_32I;
+}
@@ -0,0 +1,320 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <type_traits>
+
+// Calls queued on handles in HIPBLAS_DEFERRED_MODE_ON, set with hipblasSetDeferredMode. A gemv or
+// axpy call made on such a handle joins the queue when it has the routine, sizes, increments and
+// scalars of the calls queued before it and touches none of their outputs, and the queue runs as
+// one batched call when a call does not join it, when it is full, and first in the outermost entry
+// point of any other call on the handle, which HIPBLAS_LAYER and HIPBLAS_LAYER_HANDLE place.
+// ger, syr and her calls join the queue when they update the same matrix instead, and the queue
+// runs as one rank-k update of it by gemm, syrk or herk.
+// On handles in HIPBLAS_DEFERRED_MODE_PERSISTENT, small gemv, axpy, gemm and trsv calls are
+// posted to the persistent kernel instead, see persistent.hpp, and any other call waits for the
+// posted calls to run first.
+
+// Number of handles in deferred mode, so calls skip the lookup while there are none
+extern std::atomic<int> hipblas_deferred_handles;
+
+// Depth of nested entry points on this thread. Only the outermost one queues or runs the queue,
+// so the calls made by a flush run as they are.
+extern thread_local int hipblas_deferred_depth;
+
+enum hipblasDeferredRoutine
+{
+    hipblas_deferred_sgemv,
+    hipblas_deferred_dgemv,
+    hipblas_deferred_saxpy,
+    hipblas_deferred_daxpy,
+    hipblas_deferred_sger,
+    hipblas_deferred_dger,
+    hipblas_deferred_ssyr,
+    hipblas_deferred_dsyr,
+    hipblas_deferred_cher,
+    hipblas_deferred_zher,
+    hipblas_deferred_sgemm,
+    hipblas_deferred_dgemm,
+    hipblas_deferred_strsv,
+    hipblas_deferred_dtrsv,
+};
+
+// Arguments of a call that may be deferred, m and lda unused by axpy. The rank-1 updates write A
+// and read y, beta is unused, and syr and her have m = n and no y. gemm reads x as B and writes y
+// as C, with incx and incy as ldb and ldc, and trsv solves in place in y with m = n.
+struct hipblasDeferredCall
+{
+    hipblasDeferredRoutine routine;
+    hipblasOperation_t     trans;
+    hipblasFillMode_t      uplo;
+    int                    m;
+    int                    n;
+    const void*            alpha;
+    const void*            A;
+    int                    lda;
+    const void*            x;
+    int                    incx;
+    const void*            beta;
+    void*                  y;
+    int                    incy;
+    hipblasOperation_t     transB = HIPBLAS_OP_N;
+    hipblasDiagType_t      diag   = HIPBLAS_DIAG_NON_UNIT;
+    int                    k      = 0;
+};
+
+// Queues call on handle, running the queue first when call does not join it. Returns false,
+// once the queue has run, when call is not deferred and must run now.
+bool hipblasDeferredEnqueue(hipblasHandle_t handle, const hipblasDeferredCall& call);
+
+// Runs the calls queued on handle. An error is kept for hipblasFlush to return.
+void hipblasDeferredFlush(hipblasHandle_t handle);
+
+// Forget the queue of handle
+void hipblasDeferredErase(hipblasHandle_t handle);
+
+// Placed in every entry point by HIPBLAS_LAYER and HIPBLAS_LAYER_HANDLE, with deferrable set by
+// the gemv and axpy entry points that queue their call instead
+class hipblasDeferredScope
+{
+public:
+    explicit hipblasDeferredScope(hipblasHandle_t handle, bool deferrable)
+    {
+        if(!hipblas_deferred_depth++ && !deferrable && handle
+           && hipblas_deferred_handles.load(std::memory_order_relaxed))
+            hipblasDeferredFlush(handle);
+    }
+
+    // Entry points without a handle argument
+    template <typename T>
+    explicit hipblasDeferredScope(const T&, bool)
+    {
+        hipblas_deferred_depth++;
+    }
+
+    ~hipblasDeferredScope()
+    {
+        hipblas_deferred_depth--;
+    }
+
+    hipblasDeferredScope(const hipblasDeferredScope&) = delete;
+    hipblasDeferredScope& operator=(const hipblasDeferredScope&) = delete;
+};
+
+// True in the outermost entry point of a call on a handle that may be deferred
+inline bool hipblasDeferredActive()
+{
+    return hipblas_deferred_depth == 1 && hipblas_deferred_handles.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+inline bool hipblasDeferredGemv(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                m,
+                                int                n,
+                                const T*           alpha,
+                                const T*           A,
+                                int                lda,
+                                const T*           x,
+                                int                incx,
+                                const T*           beta,
+                                T*                 y,
+                                int                incy)
+{
+    static_assert(std::is_same<T, float>{} || std::is_same<T, double>{});
+    hipblasDeferredRoutine routine
+        = std::is_same<T, float>{} ? hipblas_deferred_sgemv : hipblas_deferred_dgemv;
+    return hipblasDeferredActive()
+           && hipblasDeferredEnqueue(handle,
+                                     {routine,
+                                      trans,
+                                      HIPBLAS_FILL_MODE_FULL,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      x,
+                                      incx,
+                                      beta,
+                                      y,
+                                      incy});
+}
+
+template <typename T>
+inline bool hipblasDeferredAxpy(
+    hipblasHandle_t handle, int n, const T* alpha, const T* x, int incx, T* y, int incy)
+{
+    static_assert(std::is_same<T, float>{} || std::is_same<T, double>{});
+    hipblasDeferredRoutine routine
+        = std::is_same<T, float>{} ? hipblas_deferred_saxpy : hipblas_deferred_daxpy;
+    return hipblasDeferredActive()
+           && hipblasDeferredEnqueue(handle,
+                                     {routine,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_FILL_MODE_FULL,
+                                      0,
+                                      n,
+                                      alpha,
+                                      nullptr,
+                                      0,
+                                      x,
+                                      incx,
+                                      nullptr,
+                                      y,
+                                      incy});
+}
+
+template <typename T>
+inline bool hipblasDeferredGer(hipblasHandle_t handle,
+                               int             m,
+                               int             n,
+                               const T*        alpha,
+                               const T*        x,
+                               int             incx,
+                               const T*        y,
+                               int             incy,
+                               T*              A,
+                               int             lda)
+{
+    static_assert(std::is_same<T, float>{} || std::is_same<T, double>{});
+    hipblasDeferredRoutine routine
+        = std::is_same<T, float>{} ? hipblas_deferred_sger : hipblas_deferred_dger;
+    return hipblasDeferredActive()
+           && hipblasDeferredEnqueue(handle,
+                                     {routine,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_FILL_MODE_FULL,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      x,
+                                      incx,
+                                      nullptr,
+                                      (void*)y,
+                                      incy});
+}
+
+// syr for float and double, her for hipblasComplex and hipblasDoubleComplex, whose alpha is real
+template <typename T, typename R>
+inline bool hipblasDeferredSyr(hipblasHandle_t   handle,
+                               hipblasFillMode_t uplo,
+                               int               n,
+                               const R*          alpha,
+                               const T*          x,
+                               int               incx,
+                               T*                A,
+                               int               lda)
+{
+    static_assert(std::is_same<T, float>{} || std::is_same<T, double>{}
+                  || std::is_same<T, hipblasComplex>{} || std::is_same<T, hipblasDoubleComplex>{});
+    hipblasDeferredRoutine routine = hipblas_deferred_zher;
+    if(std::is_same<T, float>{})
+        routine = hipblas_deferred_ssyr;
+    else if(std::is_same<T, double>{})
+        routine = hipblas_deferred_dsyr;
+    else if(std::is_same<T, hipblasComplex>{})
+        routine = hipblas_deferred_cher;
+    return hipblasDeferredActive()
+           && hipblasDeferredEnqueue(
+               handle,
+               {routine, HIPBLAS_OP_N, uplo, n, n, alpha, A, lda, x, incx, nullptr, nullptr, 0});
+}
+
+template <typename T>
+inline bool hipblasDeferredGemm(hipblasHandle_t    handle,
+                                hipblasOperation_t transa,
+                                hipblasOperation_t transb,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const T*           alpha,
+                                const T*           A,
+                                int                lda,
+                                const T*           B,
+                                int                ldb,
+                                const T*           beta,
+                                T*                 C,
+                                int                ldc)
+{
+    static_assert(std::is_same<T, float>{} || std::is_same<T, double>{});
+    hipblasDeferredRoutine routine
+        = std::is_same<T, float>{} ? hipblas_deferred_sgemm : hipblas_deferred_dgemm;
+    return hipblasDeferredActive()
+           && hipblasDeferredEnqueue(handle,
+                                     {routine,
+                                      transa,
+                                      HIPBLAS_FILL_MODE_FULL,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      B,
+                                      ldb,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      transb,
+                                      HIPBLAS_DIAG_NON_UNIT,
+                                      k});
+}
+
+template <typename T>
+inline bool hipblasDeferredTrsv(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int                m,
+                                const T*           A,
+                                int                lda,
+                                T*                 x,
+                                int                incx)
+{
+    static_assert(std::is_same<T, float>{} || std::is_same<T, double>{});
+    hipblasDeferredRoutine routine
+        = std::is_same<T, float>{} ? hipblas_deferred_strsv : hipblas_deferred_dtrsv;
+    return hipblasDeferredActive()
+           && hipblasDeferredEnqueue(handle,
+                                     {routine,
+                                      transA,
+                                      uplo,
+                                      m,
+                                      m,
+                                      nullptr,
+                                      A,
+                                      lda,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      x,
+                                      incx,
+                                      HIPBLAS_OP_N,
+                                      diag,
+                                      0});
+}
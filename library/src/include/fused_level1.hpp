@@ -0,0 +1,79 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Fused Level-1 kernels behind hipblasAxpyDotEx, hipblasDotDualEx and hipblasAxpbyNrm2Ex. Each
+// reads the vectors once: a first kernel updates y where the function does and adds up one
+// partial result per work group, and a second, single work group kernel adds the partial results
+// to the result. The partial results are kept in a device buffer of the handle, so the calls on
+// one handle must stay ordered on its stream.
+//
+// Alpha, beta and the results follow the pointer mode of the handle. In device pointer mode the
+// calls do not wait for the stream; in host pointer mode the results go through the buffer and
+// the call waits for them. The results of empty vectors are 0.
+//
+// Only built with BUILD_WITH_FUSED_LEVEL1 (HIPBLAS_FUSED_LEVEL1), for float and double. The
+// arguments are checked by the callers.
+
+// y := alpha * x + y, then result = y^T z with the updated y. z may be y.
+template <typename T>
+hipblasStatus_t hipblasFusedAxpyDot(hipblasHandle_t handle,
+                                    int             n,
+                                    const T*        alpha,
+                                    const T*        x,
+                                    int             incx,
+                                    T*              y,
+                                    int             incy,
+                                    const T*        z,
+                                    int             incz,
+                                    T*              result);
+
+// result[0] = x^T y and result[1] = x^T z. y or z may be x.
+template <typename T>
+hipblasStatus_t hipblasFusedDotDual(hipblasHandle_t handle,
+                                    int             n,
+                                    const T*        x,
+                                    int             incx,
+                                    const T*        y,
+                                    int             incy,
+                                    const T*        z,
+                                    int             incz,
+                                    T*              result);
+
+// y := alpha * x + beta * y, then result = ||y||_2 with the updated y
+template <typename T>
+hipblasStatus_t hipblasFusedAxpbyNrm2(hipblasHandle_t handle,
+                                      int             n,
+                                      const T*        alpha,
+                                      const T*        x,
+                                      int             incx,
+                                      const T*        beta,
+                                      T*              y,
+                                      int             incy,
+                                      T*              result);
+
+// Frees the buffer of handle
+void hipblasFusedLevel1Erase(hipblasHandle_t handle);
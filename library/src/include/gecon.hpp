@@ -0,0 +1,75 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Only built with BUILD_WITH_GECON (HIPBLAS_GECON). Estimates the reciprocal condition number of
+// every matrix of a batch from its LU factors, one work group per matrix, behind hipblas?gecon
+// Batched and StridedBatched. The arguments are checked by the callers. A_b is A_array[b] when
+// A_array is not null and A + b * strideA otherwise; anorm and rcond hold one value per matrix on
+// the device. The call does not wait for the stream.
+hipblasStatus_t hipblasGeconKernels(hipblasHandle_t     handle,
+                                    bool                one_norm,
+                                    int                 n,
+                                    const float*        A,
+                                    const float* const* A_array,
+                                    int                 lda,
+                                    hipblasStride       strideA,
+                                    const float*        anorm,
+                                    float*              rcond,
+                                    int                 batch_count);
+
+hipblasStatus_t hipblasGeconKernels(hipblasHandle_t      handle,
+                                    bool                 one_norm,
+                                    int                  n,
+                                    const double*        A,
+                                    const double* const* A_array,
+                                    int                  lda,
+                                    hipblasStride        strideA,
+                                    const double*        anorm,
+                                    double*              rcond,
+                                    int                  batch_count);
+
+hipblasStatus_t hipblasGeconKernels(hipblasHandle_t              handle,
+                                    bool                         one_norm,
+                                    int                          n,
+                                    const hipblasComplex*        A,
+                                    const hipblasComplex* const* A_array,
+                                    int                          lda,
+                                    hipblasStride                strideA,
+                                    const float*                 anorm,
+                                    float*                       rcond,
+                                    int                          batch_count);
+
+hipblasStatus_t hipblasGeconKernels(hipblasHandle_t                    handle,
+                                    bool                               one_norm,
+                                    int                                n,
+                                    const hipblasDoubleComplex*        A,
+                                    const hipblasDoubleComplex* const* A_array,
+                                    int                                lda,
+                                    hipblasStride                      strideA,
+                                    const double*                      anorm,
+                                    double*                            rcond,
+                                    int                                batch_count);
@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// bf16x3 emulation of fp32 gemm. Each element a of op( A ) and op( B ) is split into bf16 parts,
+// hi = bf16( a ) and lo = bf16( a - hi ), and C = alpha (Ahi Bhi + Ahi Blo + Alo Bhi) + beta C
+// is one bf16 gemm with fp32 sums over k' = 3 k, on [Ahi Ahi Alo] and [Bhi; Blo; Bhi]. The
+// dropped Alo Blo and the rounding of lo keep about 16 bits of each product, against 8 for a
+// plain bf16 gemm and 24 for fp32.
+//
+// It is taken by hipblasGemmEx and hipblasGemmStridedBatchedEx with
+// HIPBLAS_COMPUTE_32F_FAST_16BFX3, and by hipblasSgemm and hipblasSgemmStridedBatched on a handle
+// in HIPBLAS_FP32_EMULATED_BF16X3_MATH. Elsewhere, and without BUILD_WITH_GEMM_BF16X3
+// (HIPBLAS_GEMM_BF16X3), the compute type runs as HIPBLAS_COMPUTE_32F.
+
+// Whether the split kernel is built, so the math mode can be set
+bool hipblasGemmBf16x3Built();
+
+// Set or clear HIPBLAS_FP32_EMULATED_BF16X3_MATH on handle, kept by hipBLAS over the math mode of
+// the backend
+void hipblasGemmBf16x3SetMath(hipblasHandle_t handle, bool enable);
+
+bool hipblasGemmBf16x3Math(hipblasHandle_t handle);
+
+// Forget the math mode of handle
+void hipblasGemmBf16x3Erase(hipblasHandle_t handle);
+
+// Runs an fp32 gemm as a bf16x3 gemm. Returns false, without doing anything, when the call must
+// run in fp32, and true with the result in status otherwise. Invalid arguments and empty
+// problems are left to the caller, and nothing is emulated while the stream of handle is being
+// captured.
+bool hipblasGemmBf16x3(hipblasHandle_t    handle,
+                       hipblasOperation_t transa,
+                       hipblasOperation_t transb,
+                       int                m,
+                       int                n,
+                       int                k,
+                       const float*       alpha,
+                       const float*       A,
+                       int                lda,
+                       hipblasStride      stride_a,
+                       const float*       B,
+                       int                ldb,
+                       hipblasStride      stride_b,
+                       const float*       beta,
+                       float*             C,
+                       int                ldc,
+                       hipblasStride      stride_c,
+                       int                batch_count,
+                       hipblasStatus_t&   status);
+
+// Only built with BUILD_WITH_GEMM_BF16X3. Splits the lines of X, the rows of a column-major
+// matrix or with contiguous its columns, of k elements each, and writes element q of line r of
+// batch b to out[b * stride_out + r * 3 k], hi to [q], then hi or with lo_second lo to [k + q],
+// and the other one to [2 k + q]. Does not wait for the stream.
+hipblasStatus_t hipblasBf16x3Split(hipStream_t      stream,
+                                   int              lines,
+                                   int              k,
+                                   const float*     X,
+                                   int              ld,
+                                   hipblasStride    stride_x,
+                                   bool             contiguous,
+                                   bool             lo_second,
+                                   int              batch_count,
+                                   hipblasBfloat16* out,
+                                   hipblasStride    stride_out);
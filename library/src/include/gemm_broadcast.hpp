@@ -0,0 +1,184 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <limits>
+
+// A strided batched gemm whose A or B is shared by the whole batch, with a stride of 0, is one
+// larger gemm when the other operands of the batch lie side by side:
+//
+// - With a shared A, the C_i = op(A) op(B_i) of a batch of b are the columns of the m by b * n
+//   C = op(A) [op(B_1) ... op(B_b)]. The C_i must follow each other, stride_C == ldc * n, and so
+//   must the op(B_i): stride_B == ldb * n for HIPBLAS_OP_N, or the B_i are the rows of one
+//   matrix, stride_B == n and ldb >= b * n.
+// - With a shared B, the C_i = op(A_i) op(B) are the rows of the b * m by n
+//   C = [op(A_1); ...; op(A_b)] op(B). The C_i must be the rows of one matrix, stride_C == m and
+//   ldc >= b * m, and so must the op(A_i): stride_A == m and lda >= b * m for HIPBLAS_OP_N, or
+//   the A_i follow each other, stride_A == lda * m.
+//
+// The backends would otherwise run b small gemms that each read the shared operand. Rewrites m or
+// n and sets batch_count to 1 when the call is such a gemm, and leaves the arguments unchanged
+// otherwise. Called on the column-major arguments, after hipblasLayoutGemm, and never when the
+// batch has scalars per instance.
+template <typename I, typename S>
+inline void hipblasGemmBroadcast(hipblasOperation_t transa,
+                                 hipblasOperation_t transb,
+                                 I&                 m,
+                                 I&                 n,
+                                 I                  k,
+                                 I                  lda,
+                                 S                  stride_A,
+                                 I                  ldb,
+                                 S                  stride_B,
+                                 I                  ldc,
+                                 S                  stride_C,
+                                 I&                 batch_count)
+{
+    if(batch_count <= 1 || m <= 0 || n <= 0 || k <= 0 || (stride_A && stride_B))
+        return;
+
+    int64_t b = batch_count;
+    if(!stride_A && n <= std::numeric_limits<I>::max() / batch_count
+       && stride_C == int64_t(ldc) * n
+       && (transb == HIPBLAS_OP_N ? stride_B == int64_t(ldb) * n
+                                  : stride_B == n && ldb >= b * n))
+    {
+        n *= batch_count;
+        batch_count = 1;
+    }
+    else if(!stride_B && m <= std::numeric_limits<I>::max() / batch_count && stride_C == m
+            && ldc >= b * m
+            && (transa == HIPBLAS_OP_N ? stride_A == m && lda >= b * m
+                                       : stride_A == int64_t(lda) * m))
+    {
+        m *= batch_count;
+        batch_count = 1;
+    }
+}
+
+// A strided batched trsm whose A is shared by the whole batch, with stride_A == 0, is one wider
+// trsm when the B_i lie side by side:
+//
+// - On the left, op(A) X_i = alpha B_i, the X_i are the columns of the m by b * n solution of
+//   op(A) X = alpha [B_1 ... B_b]. The B_i must follow each other, stride_B == ldb * n.
+// - On the right, X_i op(A) = alpha B_i, the X_i are the rows of the b * m by n solution of
+//   X op(A) = alpha [B_1; ...; B_b]. The B_i must be the rows of one matrix, stride_B == m and
+//   ldb >= b * m.
+//
+// The backends would otherwise solve b small systems that each read A and invert its diagonal
+// blocks. Rewrites m or n and sets batch_count to 1 when the call is such a trsm, and leaves the
+// arguments unchanged otherwise. Called on the column-major arguments, after hipblasLayoutTrsm,
+// and never when the batch has scalars per instance.
+template <typename I, typename S>
+inline void hipblasTrsmBroadcast(
+    hipblasSideMode_t side, I& m, I& n, S stride_A, I ldb, S stride_B, I& batch_count)
+{
+    if(batch_count <= 1 || m <= 0 || n <= 0 || stride_A)
+        return;
+
+    int64_t b = batch_count;
+    if(side == HIPBLAS_SIDE_LEFT && n <= std::numeric_limits<I>::max() / batch_count
+       && stride_B == int64_t(ldb) * n)
+    {
+        n *= batch_count;
+        batch_count = 1;
+    }
+    else if(side == HIPBLAS_SIDE_RIGHT && m <= std::numeric_limits<I>::max() / batch_count
+            && stride_B == m && ldb >= b * m)
+    {
+        m *= batch_count;
+        batch_count = 1;
+    }
+}
+
+// A strided batched getrs whose LU factor is shared by the whole batch, with stride_A == 0 and
+// stride_P == 0, is one getrs with b * nrhs right-hand sides when the B_i follow each other,
+// stride_B == ldb * nrhs: op(A) X_i = B_i are the columns of op(A) X = [B_1 ... B_b]. The
+// backends would otherwise read A and apply the pivots once per instance. Rewrites nrhs and sets
+// batch_count to 1 when the call is such a getrs, and leaves the arguments unchanged otherwise.
+// stride_P is passed as 0 when the factor has no pivots.
+template <typename I, typename S>
+inline void hipblasGetrsBroadcast(
+    I n, I& nrhs, S stride_A, S stride_P, I ldb, S stride_B, I& batch_count)
+{
+    if(batch_count <= 1 || n <= 0 || nrhs <= 0 || stride_A || stride_P)
+        return;
+
+    if(nrhs <= std::numeric_limits<I>::max() / batch_count && stride_B == int64_t(ldb) * nrhs)
+    {
+        nrhs *= batch_count;
+        batch_count = 1;
+    }
+}
+
+// A strided batched gemv whose A is shared by the whole batch, with stride_A == 0, is the gemm
+// Y = op(A) X when the x_i and y_i are the columns of the matrices X and Y. The y_i must be
+// contiguous, incy == 1, and stride_y >= the length of y is the leading dimension of Y. X is
+// either the same with incx == 1, or the transpose of a matrix with stride_x == 1 and
+// incx >= batch_count, for which transx is HIPBLAS_OP_T.
+//
+// The backends would otherwise read A once per instance. Returns true and sets m and n to the rows
+// and columns of op(A), the m and k of the gemm, when the call is such a gemm, and leaves the
+// arguments unchanged otherwise. Called on the column-major arguments, after hipblasLayoutGemv.
+template <typename I, typename S>
+inline bool hipblasGemvBroadcast(hipblasOperation_t  trans,
+                                 I&                  m,
+                                 I&                  n,
+                                 S                   stride_A,
+                                 I                   incx,
+                                 S                   stride_x,
+                                 I                   incy,
+                                 S                   stride_y,
+                                 I                   batch_count,
+                                 hipblasOperation_t& transx,
+                                 I&                  ldx,
+                                 I&                  ldy)
+{
+    if(batch_count <= 1 || m <= 0 || n <= 0 || stride_A)
+        return false;
+
+    I x_len = trans == HIPBLAS_OP_N ? n : m;
+    I y_len = trans == HIPBLAS_OP_N ? m : n;
+    if(incy != 1 || stride_y < y_len || stride_y > std::numeric_limits<I>::max())
+        return false;
+
+    if(incx == 1 && stride_x >= x_len && stride_x <= std::numeric_limits<I>::max())
+    {
+        transx = HIPBLAS_OP_N;
+        ldx    = I(stride_x);
+    }
+    else if(stride_x == 1 && incx >= batch_count)
+    {
+        transx = HIPBLAS_OP_T;
+        ldx    = incx;
+    }
+    else
+        return false;
+
+    ldy = I(stride_y);
+    m   = y_len;
+    n   = x_len;
+    return true;
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Widest intermediate T of the fused hipblasGemmChainEx kernel, whose rows of T stay in shared
+// memory
+constexpr int gemm_chain_max_n = 256;
+
+// Only built with BUILD_WITH_GEMM_CHAIN (HIPBLAS_GEMM_CHAIN). Runs both gemms of every chain of
+// desc in a single launch that does not wait for the stream. The scalars are floats, in device
+// memory when device_scalars is set. desc is checked by the caller; returns
+// HIPBLAS_STATUS_NOT_SUPPORTED without launching unless 0 < n <= gemm_chain_max_n, computeType is
+// HIPBLAS_COMPUTE_32F and dataType is HIP_R_16F, HIP_R_16BF or HIP_R_32F.
+hipblasStatus_t hipblasGemmChainKernels(hipStream_t                   stream,
+                                        bool                          device_scalars,
+                                        const hipblasGemmChainDesc_t& desc,
+                                        const float*                  alpha1,
+                                        const void*                   A,
+                                        const void*                   B,
+                                        const float*                  alpha2,
+                                        const void*                   E,
+                                        const float*                  beta2,
+                                        void*                         D);
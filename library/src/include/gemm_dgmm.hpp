@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Shared parts of hipblasGemmDgmmEx and hipblasGemmStridedBatchedDgmmEx. The diagonal scalings
+// are applied by hipblasXdgmm to copies of A and B, then the backends run one gemm reading C and
+// writing D: rocBLAS takes C and D as separate matrices, and cuBLAS, whose gemm has none, copies
+// C to D first.
+
+// Operands of the gemm: A and B, or their scaled copies in stream-ordered scratch
+struct hipblasGemmDgmmOperands
+{
+    hipStream_t   stream  = nullptr;
+    char*         scratch = nullptr;
+    const void*   A       = nullptr;
+    int           lda     = 0;
+    hipblasStride strideA = 0;
+    const void*   B       = nullptr;
+    int           ldb     = 0;
+    hipblasStride strideB = 0;
+
+    ~hipblasGemmDgmmOperands();
+};
+
+// Check the arguments and set operands. x_left scales the m rows of op( A ) and x_right the n
+// columns of op( B ); either may be nullptr. Returns HIPBLAS_STATUS_NOT_SUPPORTED for a scaled
+// operand whose type has no hipblasXdgmm, or which is complex and conjugated.
+hipblasStatus_t hipblasGemmDgmmPrepare(hipblasHandle_t          handle,
+                                       hipblasOperation_t       transa,
+                                       hipblasOperation_t       transb,
+                                       int                      m,
+                                       int                      n,
+                                       int                      k,
+                                       const void*              x_left,
+                                       int                      incx_left,
+                                       hipblasStride            stride_x_left,
+                                       const void*              A,
+                                       hipDataType              a_type,
+                                       int                      lda,
+                                       hipblasStride            stride_A,
+                                       const void*              B,
+                                       hipDataType              b_type,
+                                       int                      ldb,
+                                       hipblasStride            stride_B,
+                                       const void*              x_right,
+                                       int                      incx_right,
+                                       hipblasStride            stride_x_right,
+                                       const void*              C,
+                                       hipDataType              c_type,
+                                       int                      ldc,
+                                       hipblasStride            stride_C,
+                                       const void*              D,
+                                       int                      ldd,
+                                       hipblasStride            stride_D,
+                                       int                      batch_count,
+                                       hipblasGemmDgmmOperands& operands);
+
+// D_i = C_i on stream, for a gemm without a separate D. Nothing is copied when C is D.
+hipblasStatus_t hipblasGemmDgmmCopyC(hipStream_t   stream,
+                                     hipDataType   c_type,
+                                     int           m,
+                                     int           n,
+                                     const void*   C,
+                                     int           ldc,
+                                     hipblasStride stride_C,
+                                     void*         D,
+                                     int           ldd,
+                                     hipblasStride stride_D,
+                                     int           batch_count);
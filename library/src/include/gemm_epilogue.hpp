@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <functional>
+
+// Shared parts of hipblasGemmEpilogueEx. The backends try a fused cuBLASLt or hipBLASLt
+// kernel first and use hipblasGemmEpilogueUnfused when none is available.
+
+bool hipblasEpilogueHasBias(hipblasEpilogue_t epilogue);
+
+bool hipblasEpilogueHasAux(hipblasEpilogue_t epilogue);
+
+// Check the epilogue arguments. Returns HIPBLAS_STATUS_NOT_SUPPORTED for a c_type the
+// epilogue cannot be applied to.
+hipblasStatus_t hipblasGemmEpilogueCheck(hipblasEpilogue_t epilogue,
+                                         int               m,
+                                         int               n,
+                                         hipDataType       c_type,
+                                         const void*       bias,
+                                         const void*       aux,
+                                         int               ldaux);
+
+// Bit of the column reductions of hipblasEpilogueReduction_t. Without it, a reduction is the row
+// reduction of the same statistic.
+constexpr int hipblas_epilogue_reduction_column = 16;
+
+// Check the reduction of hipblasGemmEpilogueReductionEx
+hipblasStatus_t
+    hipblasEpilogueReductionCheck(hipblasEpilogueReduction_t reduction, int m, int n, void* reduce);
+
+// Call gemm(), which writes the m x n matrix C on stream, then apply the epilogue to C on the
+// host, writing the reduction of the result to reduce in the same pass. The stream is
+// synchronized. Returns HIPBLAS_STATUS_NOT_SUPPORTED without calling gemm() while stream is
+// being captured.
+hipblasStatus_t hipblasGemmEpilogueUnfused(hipStream_t                             stream,
+                                           const std::function<hipblasStatus_t()>& gemm,
+                                           hipblasEpilogue_t                       epilogue,
+                                           hipDataType                             c_type,
+                                           int                                     m,
+                                           int                                     n,
+                                           void*                                   C,
+                                           int                                     ldc,
+                                           const void*                             bias,
+                                           void*                                   aux,
+                                           int                                     ldaux,
+                                           hipblasEpilogueReduction_t              reduction
+                                           = HIPBLAS_EPILOGUE_REDUCTION_NONE,
+                                           void* reduce = nullptr);
+
+// Only built with BUILD_WITH_EPILOGUE_REDUCTION (HIPBLAS_EPILOGUE_REDUCTION). Applies epilogue
+// to the m x n matrix C, 0 < m, n, written on stream, and writes the reduction of the result to
+// reduce, in one pass over C that does not wait for the stream. HIPBLAS_EPILOGUE_DEFAULT only
+// reads C. The arguments are checked by the caller.
+hipblasStatus_t hipblasGemmEpilogueReductionKernels(hipStream_t                stream,
+                                                    hipblasEpilogue_t          epilogue,
+                                                    hipDataType                c_type,
+                                                    int                        m,
+                                                    int                        n,
+                                                    void*                      C,
+                                                    int                        ldc,
+                                                    const void*                bias,
+                                                    void*                      aux,
+                                                    int                        ldaux,
+                                                    hipblasEpilogueReduction_t reduction,
+                                                    void*                      reduce);
@@ -0,0 +1,111 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <climits>
+#include <cstdint>
+
+// FP64 emulation of the dgemm calls on a handle, set with hipblasSetGemmFp64Emulation. Row i of
+// op( A ) is scaled by 2^-ea[i], where 2^ea[i] is above its largest magnitude, and split into
+// int8 slices of fp64_emulation_bits bits: a = 2^ea[i] * sum_s 2^(-7 (s + 1)) A_s. The columns of
+// op( B ) are split alike. The products A_s B_t with s + t < slices are int8 gemms with int32
+// sums, exact for chunks of k of at most fp64_emulation_max_k, and are scaled and summed in fp64.
+
+constexpr int fp64_emulation_bits       = 7;
+constexpr int fp64_emulation_max_slices = 16;
+constexpr int fp64_emulation_max_k      = 131072;
+
+// Exponent of a row or column holding an infinity or NaN, whose elements of C are NaN
+constexpr int fp64_emulation_nonfinite = INT_MAX;
+
+// Forget the fp64 emulation mode of handle
+void hipblasGemmFp64EmulationErase(hipblasHandle_t handle);
+
+// Runs a dgemm call on int8 gemms when the fp64 emulation mode of handle asks for it. Returns
+// false, without doing anything, when the call must run in fp64, and true with the result in
+// status otherwise. Invalid arguments and empty problems are left to the caller, and nothing is
+// emulated while the stream of handle is being captured.
+bool hipblasGemmFp64Emulation(hipblasHandle_t    handle,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const double*      alpha,
+                              const double*      A,
+                              int                lda,
+                              const double*      B,
+                              int                ldb,
+                              const double*      beta,
+                              double*            C,
+                              int                ldc,
+                              hipblasStatus_t&   status);
+
+// Only built with BUILD_WITH_GEMM_FP64_EMULATION (HIPBLAS_GEMM_FP64_EMULATION). None of them
+// waits for the stream, and the arguments are checked by the caller.
+
+// Splits the lines of X, the rows of a column-major matrix or with contiguous its columns, of
+// len elements each. Writes the exponent of line r to exps[r], and element q of slice s of line
+// r to out[s * slice_stride + r * ld_out + q], with zeros for q in [len, ld_out).
+hipblasStatus_t hipblasFp64EmulationSplit(hipStream_t   stream,
+                                          int           lines,
+                                          int           len,
+                                          const double* X,
+                                          int           ld,
+                                          bool          contiguous,
+                                          int           slices,
+                                          int8_t*       out,
+                                          int           ld_out,
+                                          size_t        slice_stride,
+                                          int*          exps);
+
+// D += 2^(ea[i] + eb[j]) * sum_t 2^(-7 (s + 1)) 2^(-7 (t0 + t + 1)) P_t for t in [0, count),
+// where P_t is the m x n block of columns t * n onwards of P, the products of slice s of op( A )
+// with slices t0 onwards of op( B ). D is m x n and packed.
+hipblasStatus_t hipblasFp64EmulationAccumulate(hipStream_t    stream,
+                                               int            m,
+                                               int            n,
+                                               int            s,
+                                               int            t0,
+                                               int            count,
+                                               const int32_t* P,
+                                               int            ldp,
+                                               const int*     ea,
+                                               const int*     eb,
+                                               double*        D);
+
+// C = alpha D + beta C, with NaN for the elements of nonfinite rows or columns. alpha and beta
+// are read on the device with device_scalars, and C is not read when beta is zero.
+hipblasStatus_t hipblasFp64EmulationFinish(hipStream_t   stream,
+                                           bool          device_scalars,
+                                           int           m,
+                                           int           n,
+                                           const double* alpha,
+                                           const double* beta,
+                                           const int*    ea,
+                                           const int*    eb,
+                                           const double* D,
+                                           double*       C,
+                                           int           ldc);
@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "hipblas.h"
+
+// Complex times real products of hipblasGemmEx and its batched forms, which neither backend
+// multiplies natively. A complex A with op( A ) = A is read as a real 2m x k matrix with leading
+// dimension 2*lda, so op( A )*op( B ) is one real gemm into C, read as a real 2m x n matrix, when
+// alpha and beta are real host scalars, or into a device scratch that geam scales into C
+// otherwise. A complex B is read the same way as op( B )^T, so the real gemm forms
+// ( op( A )*op( B ) )^T and geam transposes it into C. A complex operand that cannot be read this
+// way, a transposed A or a B with op( B ) = B, is first transposed into scratch by geam. The real
+// operand is never expanded.
+
+// Returns false, without doing anything, unless a_type and b_type are a complex and a real type of
+// the precision of the complex c_type, and true with the result in status otherwise. The arguments
+// are those of hipblasGemmStridedBatchedEx; a single gemm has batch_count 1.
+bool hipblasGemmMixedComplex(hipblasHandle_t      handle,
+                             hipblasOperation_t   transa,
+                             hipblasOperation_t   transb,
+                             int                  m,
+                             int                  n,
+                             int                  k,
+                             const void*          alpha,
+                             const void*          A,
+                             hipDataType          a_type,
+                             int                  lda,
+                             hipblasStride        stride_A,
+                             const void*          B,
+                             hipDataType          b_type,
+                             int                  ldb,
+                             hipblasStride        stride_B,
+                             const void*          beta,
+                             void*                C,
+                             hipDataType          c_type,
+                             int                  ldc,
+                             hipblasStride        stride_C,
+                             int                  batch_count,
+                             hipblasComputeType_t compute_type,
+                             hipblasStatus_t&     status);
+
+// The same for the pointer arrays of hipblasGemmBatchedEx. Products that need scratch read the
+// arrays back to the host and run one instance at a time.
+bool hipblasGemmBatchedMixedComplex(hipblasHandle_t      handle,
+                                    hipblasOperation_t   transa,
+                                    hipblasOperation_t   transb,
+                                    int                  m,
+                                    int                  n,
+                                    int                  k,
+                                    const void*          alpha,
+                                    const void*          A[],
+                                    hipDataType          a_type,
+                                    int                  lda,
+                                    const void*          B[],
+                                    hipDataType          b_type,
+                                    int                  ldb,
+                                    const void*          beta,
+                                    void*                C[],
+                                    hipDataType          c_type,
+                                    int                  ldc,
+                                    int                  batch_count,
+                                    hipblasComputeType_t compute_type,
+                                    hipblasStatus_t&     status);
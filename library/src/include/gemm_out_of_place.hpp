@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Shared parts of hipblasGemmOutOfPlaceEx and its batched forms, D = alpha*op( A )*op( B ) +
+// beta*C with C only read. rocBLAS runs them as one gemm when dType is cType; cuBLAS, whose gemm
+// has no separate D, and a dType other than cType run the emulation below.
+
+// Check the arguments of the three forms. C may be D only when both have the same type,
+// leading dimension and stride.
+hipblasStatus_t hipblasGemmOutOfPlaceCheck(hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           int                lda,
+                                           int                ldb,
+                                           const void*        C,
+                                           hipDataType        c_type,
+                                           int                ldc,
+                                           hipblasStride      stride_C,
+                                           const void*        D,
+                                           hipDataType        d_type,
+                                           int                ldd,
+                                           hipblasStride      stride_D,
+                                           int                batch_count);
+
+// The gemm as C_i copied to D_i, then hipblasGemmStridedBatchedEx_v2 updating D_i in place. For a
+// d_type other than c_type, C_i is copied to a packed matrix of c_type in stream-ordered scratch
+// instead, which is converted to D_i by hipblasConvertStridedBatchedEx after the gemm; it returns
+// HIPBLAS_STATUS_NOT_SUPPORTED without BUILD_WITH_CONVERT (HIPBLAS_CONVERT). With batched, A, B,
+// C and D are the pointer arrays of the batched form, which are copied to the host after the
+// stream is synchronized, and every instance runs on its own.
+hipblasStatus_t hipblasGemmOutOfPlaceEmulated(hipblasHandle_t      handle,
+                                              hipblasOperation_t   transa,
+                                              hipblasOperation_t   transb,
+                                              int                  m,
+                                              int                  n,
+                                              int                  k,
+                                              const void*          alpha,
+                                              const void*          A,
+                                              hipDataType          a_type,
+                                              int                  lda,
+                                              hipblasStride        stride_A,
+                                              const void*          B,
+                                              hipDataType          b_type,
+                                              int                  ldb,
+                                              hipblasStride        stride_B,
+                                              const void*          beta,
+                                              const void*          C,
+                                              hipDataType          c_type,
+                                              int                  ldc,
+                                              hipblasStride        stride_C,
+                                              void*                D,
+                                              hipDataType          d_type,
+                                              int                  ldd,
+                                              hipblasStride        stride_D,
+                                              int                  batch_count,
+                                              hipblasComputeType_t compute_type,
+                                              hipblasGemmAlgo_t    algo,
+                                              bool                 batched);
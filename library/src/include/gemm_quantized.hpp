@@ -0,0 +1,74 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Only built with BUILD_WITH_GEMM_QUANTIZED (HIPBLAS_GEMM_QUANTIZED). Requantizes the int32
+// accumulators of hipblasGemmQuantizedEx: element (i, j) of matrix b of C is
+// acc(i, j) * s rounded to the nearest integer and clamped to [-128, 127] for an int8 C, and
+// converted for an fp16 or fp32 C, where s is scale[i], scale[col0 + j] or scale[0] as given by
+// mode. The arguments are checked by the caller; c_type is HIP_R_8I, HIP_R_16F or HIP_R_32F. The
+// call does not wait for the stream.
+hipblasStatus_t hipblasQuantizeKernels(hipStream_t             stream,
+                                       hipDataType             c_type,
+                                       hipblasQuantScaleMode_t mode,
+                                       int                     m,
+                                       int                     n,
+                                       const int32_t*          acc,
+                                       int                     ld_acc,
+                                       hipblasStride           stride_acc,
+                                       const float*            scale,
+                                       int                     col0,
+                                       void*                   C,
+                                       int                     ldc,
+                                       hipblasStride           stride_C,
+                                       int                     batch_count);
+
+// Only built with BUILD_WITH_GEMM_QUANTIZED. Dequantizes rows row0 to row0 + rows - 1 of
+// op( A_b ) of hipblasGemmWeightOnlyEx for b = 0, ..., batch_count - 1 into panel_b, of b_type,
+// which keeps the orientation of A: element (i, p) is at i + p * rows for transA N and at
+// p + i * k otherwise. Weight e of A_b is weight a_offset + b * stride_a + e of A, and the
+// scale factors and zero points of A_b start b * stride_scale elements into scale and zero, with
+// leading dimension ld_scale. zero may be null. The arguments are checked by the caller. The
+// call does not wait for the stream.
+hipblasStatus_t hipblasDequantizeKernels(hipStream_t         stream,
+                                         hipblasWeightType_t a_type,
+                                         hipDataType         b_type,
+                                         bool                trans_a,
+                                         int                 rows,
+                                         int                 k,
+                                         int                 row0,
+                                         const void*         A,
+                                         int64_t             a_offset,
+                                         int                 lda,
+                                         hipblasStride       stride_a,
+                                         const void*         scale,
+                                         const void*         zero,
+                                         int                 ld_scale,
+                                         hipblasStride       stride_scale,
+                                         int                 group_size,
+                                         void*               panel,
+                                         hipblasStride       stride_panel,
+                                         int                 batch_count);
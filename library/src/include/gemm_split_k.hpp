@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Split-K of the hipblasGemmEx calls on a handle, set with hipblasSetGemmSplitK. A split gemm
+// writes the products of s slices of the k dimension into s partial matrices of the accumulation
+// type with one strided batched gemm, then sums them into C with alpha and beta by a second gemm
+// over the columns of C. fp16 and bf16 C, whose partials are fp32, are summed in fp32 and applied
+// by the kernel of hipblasBatchScalarsAxpby, so they are only split with BUILD_WITH_BATCH_SCALARS.
+//
+// syrk, herk and syrkx of a small n and a large k, whose output has too few tiles for the device,
+// are split the same way: one strided batched gemm writes the whole n by n Gram matrix of each
+// slice of k, a second sums them, and a syrkx or herkx with the identity as B applies the sum
+// with alpha and beta to the triangle of C.
+
+// Forget the split-K mode of handle
+void hipblasGemmSplitKErase(hipblasHandle_t handle);
+
+// Split-K mode and factor of the handles that set none, HIPBLAS_GEMM_SPLIT_K_AUTO unless a tuning
+// profile set another. SetDefault returns false, changing nothing, for an invalid mode or factor.
+void hipblasGemmSplitKGetDefault(hipblasGemmSplitKMode_t& mode, int& factor);
+bool hipblasGemmSplitKSetDefault(hipblasGemmSplitKMode_t mode, int factor);
+
+// Runs a hipblasGemmEx call split along k when the split-K mode of handle, or with
+// HIPBLAS_GEMM_SPLIT_K_AUTO the shape of the problem on the current device, asks for it. Returns
+// false, without doing anything, when the call is not split and must run as one gemm, and true
+// with the result in status otherwise. The arguments are those of hipblasGemmEx with
+// HIPBLAS_GEMM_DEFAULT; nothing is split while the stream of handle is being captured.
+bool hipblasGemmSplitK(hipblasHandle_t      handle,
+                       hipblasOperation_t   transa,
+                       hipblasOperation_t   transb,
+                       int                  m,
+                       int                  n,
+                       int                  k,
+                       const void*          alpha,
+                       const void*          A,
+                       hipDataType          a_type,
+                       int                  lda,
+                       const void*          B,
+                       hipDataType          b_type,
+                       int                  ldb,
+                       const void*          beta,
+                       void*                C,
+                       hipDataType          c_type,
+                       int                  ldc,
+                       hipblasComputeType_t compute_type,
+                       hipblasStatus_t&     status);
+
+// Runs a syrk, herk (hermitian) or syrkx (B not null) call of the given type split along k, as
+// hipblasGemmSplitK does, for n up to 256. Returns false, without doing anything, when the call
+// is not split, and true with the result in status otherwise. alpha and beta of a herk are real.
+// The syrk, herk, syrkx and herkx entry points of both backends try it before the backend call.
+bool hipblasSyrkSplitK(hipblasHandle_t    handle,
+                       hipblasFillMode_t  uplo,
+                       hipblasOperation_t trans,
+                       int                n,
+                       int                k,
+                       const void*        alpha,
+                       const void*        A,
+                       int                lda,
+                       const void*        B,
+                       int                ldb,
+                       const void*        beta,
+                       void*              C,
+                       int                ldc,
+                       hipDataType        type,
+                       bool               hermitian,
+                       hipblasStatus_t&   status);
@@ -0,0 +1,100 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+// Tuned GEMM solutions are shared by all handles in the process. The table is keyed by the
+// device architecture and the problem, and the winning solution index and its time are
+// stored for each key. The table is read from HIPBLAS_GEMM_TUNING_FILE when the first handle
+// is created and written back when a handle is destroyed after new solutions were added.
+
+// Load the tuning file and the default mode (HIPBLAS_GEMM_TUNING) once per process.
+// backend_version identifies the rocBLAS or cuBLAS build; files written by a different
+// build are ignored, as solution indices are specific to one build.
+//
+// The section of the current device architecture in the tuning profile named by
+// HIPBLAS_TUNING_PROFILE is applied next. A profile gathers the tuned choices of several
+// architectures and backend builds, one section each, so one file serves a mixed fleet:
+//
+//   hipblas_tuning_profile 1
+//   arch <architecture> <backend version>
+//   tuned <key> <solution> <seconds>        gemm and Level-2 entries, as in the tuning file
+//   split_k <mode> <factor>                 default of hipblasSetGemmSplitK
+//   host_dispatch <routine> <threshold>     default of hipblasSetHostDispatchThreshold
+//   small_level1 <n>                        see hipblasSmallLevel1Size
+//
+// tuned lines only apply to the backend version of their section, the others to any.
+void hipblasGemmTuningInit(const std::string& backend_version);
+
+// Architecture name of the current device, such as gfx90a, or sm_80 on NVIDIA devices
+std::string hipblasGemmTuningArch();
+
+// Longest vector run by the small Level-1 kernels of BUILD_WITH_SMALL_LEVEL1. It is
+// small_level1_max_size unless a tuning profile gave a shorter one, past which the backend is
+// faster on that architecture.
+int hipblasSmallLevel1Size();
+
+// Forget the handle's tuning mode, saving the table if new solutions were added
+void hipblasGemmTuningErase(hipblasHandle_t handle);
+
+bool hipblasGemmTuningEnabled(hipblasHandle_t handle);
+
+// Text key of a hipblasGemmEx problem on the current device
+std::string hipblasGemmTuningKey(hipblasOperation_t   transA,
+                                 hipblasOperation_t   transB,
+                                 int                  m,
+                                 int                  n,
+                                 int                  k,
+                                 hipDataType          a_type,
+                                 hipDataType          b_type,
+                                 hipDataType          c_type,
+                                 hipblasComputeType_t compute_type);
+
+// Text key of the shape bucket of a Level-2 call of routine, such as "sgemv", on the current
+// device. m and n are rounded up to powers of two, so one tuning serves the shapes of a bucket.
+std::string hipblasLevel2TuningKey(const char* routine, hipblasOperation_t trans, int m, int n);
+
+// Tuned solution index for key, or 0 (the backend default) when it has not been tuned
+// and tuning is not possible right now.
+//
+// The first time key is seen, every index returned by candidates() is timed with events on
+// stream by calling run(index, C_scratch), where C_scratch is a copy of the C_size bytes at
+// C, so the caller's output is only written by its own final call. The stream is
+// synchronized while tuning. Nothing is tuned while stream is being captured.
+int hipblasGemmTuningSolution(const std::string&                                key,
+                              hipStream_t                                       stream,
+                              void*                                             C,
+                              size_t                                            C_size,
+                              const std::function<std::vector<int>()>&          candidates,
+                              const std::function<hipblasStatus_t(int, void*)>& run);
+
+// Tuned solution index for key, false if key has not been tuned, without tuning it
+bool hipblasGemmTuningLookup(const std::string& key, int& solution);
+
+// Device time of one call with the tuned solution for key, false if key has not been timed
+bool hipblasGemmTuningTime(const std::string& key, double& seconds);
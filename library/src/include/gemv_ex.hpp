@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Types of A and x, y and the computation of one hipblasGemvEx call, named after the routines
+// of the backends: the input, output and compute type of the mixed-precision gemv, h for fp16,
+// t for bf16 and s for fp32, or the precision of hipblasXgemv when every type is the same
+enum class hipblasGemvExType
+{
+    unsupported,
+    s,
+    d,
+    c,
+    z,
+    hsh,
+    hss,
+    tst,
+    tss,
+};
+
+inline hipblasGemvExType hipblasGemvExTypeOf(hipDataType          a_type,
+                                             hipDataType          x_type,
+                                             hipDataType          y_type,
+                                             hipblasComputeType_t compute_type)
+{
+    bool compute_32f
+        = compute_type == HIPBLAS_COMPUTE_32F || compute_type == HIPBLAS_COMPUTE_32F_PEDANTIC;
+    bool compute_64f
+        = compute_type == HIPBLAS_COMPUTE_64F || compute_type == HIPBLAS_COMPUTE_64F_PEDANTIC;
+    if(a_type != x_type || !(compute_32f || compute_64f))
+        return hipblasGemvExType::unsupported;
+
+    switch(a_type)
+    {
+    case HIP_R_16F:
+        if(compute_32f && y_type == HIP_R_16F)
+            return hipblasGemvExType::hsh;
+        if(compute_32f && y_type == HIP_R_32F)
+            return hipblasGemvExType::hss;
+        break;
+    case HIP_R_16BF:
+        if(compute_32f && y_type == HIP_R_16BF)
+            return hipblasGemvExType::tst;
+        if(compute_32f && y_type == HIP_R_32F)
+            return hipblasGemvExType::tss;
+        break;
+    case HIP_R_32F:
+        if(compute_32f && y_type == HIP_R_32F)
+            return hipblasGemvExType::s;
+        break;
+    case HIP_R_64F:
+        if(compute_64f && y_type == HIP_R_64F)
+            return hipblasGemvExType::d;
+        break;
+    case HIP_C_32F:
+        if(compute_32f && y_type == HIP_C_32F)
+            return hipblasGemvExType::c;
+        break;
+    case HIP_C_64F:
+        if(compute_64f && y_type == HIP_C_64F)
+            return hipblasGemvExType::z;
+        break;
+    default:
+        break;
+    }
+    return hipblasGemvExType::unsupported;
+}
+
+// Element and scalar types of each hipblasGemvExType
+template <typename Ti, typename To = Ti, typename Tc = To>
+struct hipblasGemvExTypes
+{
+    using input  = Ti;
+    using output = To;
+    using scalar = Tc;
+};
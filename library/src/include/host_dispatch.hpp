@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Host dispatch of the calls on a handle, set with hipblasSetHostDispatch. Calls within the
+// threshold of their routine whose operands are on the host run there once the stream of the
+// handle is synchronized, as a copy to the device and back costs more than the problem itself.
+// The sums are taken in order by the reference loops below, with the semantics of the BLAS for
+// negative increments.
+
+// Forget the host dispatch mode and the thresholds of handle
+void hipblasHostDispatchErase(hipblasHandle_t handle);
+
+// Threshold of routine for the handles that set none
+int64_t hipblasHostDispatchGetDefault(hipblasHostDispatchRoutine_t routine);
+
+// Set the threshold of routine for the handles that set none, as a tuning profile does, unless
+// HIPBLAS_HOST_DISPATCH_THRESHOLDS gives one. Negative thresholds are ignored.
+void hipblasHostDispatchSetDefault(hipblasHostDispatchRoutine_t routine, int64_t threshold);
+
+// Each runs its call on the host when the host dispatch mode of handle asks for it. Returns
+// false, without doing anything, when the call must run on the device, and true with the result
+// in status otherwise. Only the outermost entry point of a call dispatches to the host, with
+// HIPBLAS_POINTER_MODE_HOST; invalid arguments are left to the caller, and nothing runs on the
+// host while the stream of handle is being captured.
+bool hipblasHostDot(hipblasHandle_t  handle,
+                    int              n,
+                    const float*     x,
+                    int              incx,
+                    const float*     y,
+                    int              incy,
+                    float*           result,
+                    hipblasStatus_t& status);
+
+bool hipblasHostDot(hipblasHandle_t  handle,
+                    int              n,
+                    const double*    x,
+                    int              incx,
+                    const double*    y,
+                    int              incy,
+                    double*          result,
+                    hipblasStatus_t& status);
+
+bool hipblasHostAxpy(hipblasHandle_t  handle,
+                     int              n,
+                     const float*     alpha,
+                     const float*     x,
+                     int              incx,
+                     float*           y,
+                     int              incy,
+                     hipblasStatus_t& status);
+
+bool hipblasHostAxpy(hipblasHandle_t  handle,
+                     int              n,
+                     const double*    alpha,
+                     const double*    x,
+                     int              incx,
+                     double*          y,
+                     int              incy,
+                     hipblasStatus_t& status);
+
+bool hipblasHostGemv(hipblasHandle_t    handle,
+                     hipblasOperation_t trans,
+                     int                m,
+                     int                n,
+                     const float*       alpha,
+                     const float*       A,
+                     int                lda,
+                     const float*       x,
+                     int                incx,
+                     const float*       beta,
+                     float*             y,
+                     int                incy,
+                     hipblasStatus_t&   status);
+
+bool hipblasHostGemv(hipblasHandle_t    handle,
+                     hipblasOperation_t trans,
+                     int                m,
+                     int                n,
+                     const double*      alpha,
+                     const double*      A,
+                     int                lda,
+                     const double*      x,
+                     int                incx,
+                     const double*      beta,
+                     double*            y,
+                     int                incy,
+                     hipblasStatus_t&   status);
+
+bool hipblasHostGemm(hipblasHandle_t    handle,
+                     hipblasOperation_t transa,
+                     hipblasOperation_t transb,
+                     int                m,
+                     int                n,
+                     int                k,
+                     const float*       alpha,
+                     const float*       A,
+                     int                lda,
+                     const float*       B,
+                     int                ldb,
+                     const float*       beta,
+                     float*             C,
+                     int                ldc,
+                     hipblasStatus_t&   status);
+
+bool hipblasHostGemm(hipblasHandle_t    handle,
+                     hipblasOperation_t transa,
+                     hipblasOperation_t transb,
+                     int                m,
+                     int                n,
+                     int                k,
+                     const double*      alpha,
+                     const double*      A,
+                     int                lda,
+                     const double*      B,
+                     int                ldb,
+                     const double*      beta,
+                     double*            C,
+                     int                ldc,
+                     hipblasStatus_t&   status);
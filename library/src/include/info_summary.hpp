@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Summaries of the info arrays written by batched solver calls. hipBLAS has no device code, so
+// the info values are copied into a pinned buffer in stream order and reduced by a host function
+// launched on the stream. The caller is never blocked and the summary is written once the stream
+// reaches the host function.
+
+// Enqueue the summary of the batch_count info values at info on stream. Returns
+// HIPBLAS_STATUS_NOT_SUPPORTED while stream is being captured, as the pinned buffer is reused once
+// the host function has run.
+hipblasStatus_t hipblasInfoSummaryEnqueue(hipStream_t           stream,
+                                          const int*            info,
+                                          int                   batch_count,
+                                          hipblasInfoSummary_t* summary);
+
+// Status of a solver call that wrote batch_count info values to info. When status is
+// HIPBLAS_STATUS_SUCCESS and hipblasSetInfoSummary set a summary on handle, the summary of info
+// is enqueued and its status is returned instead. Captured calls are not summarized.
+hipblasStatus_t hipblasInfoSummaryAfter(hipblasHandle_t handle,
+                                        const int*      info,
+                                        int             batch_count,
+                                        hipblasStatus_t status);
+
+// Forget the summary set on handle
+void hipblasInfoSummaryErase(hipblasHandle_t handle);
+
+// While alive, hipblasInfoSummaryAfter leaves the summary of the handle alone on this thread. Used
+// by functions built on other batched hipBLAS calls, so only their own info is summarized.
+struct hipblasInfoSummarySuspend
+{
+    hipblasInfoSummarySuspend();
+    ~hipblasInfoSummarySuspend();
+
+    hipblasInfoSummarySuspend(const hipblasInfoSummarySuspend&) = delete;
+    hipblasInfoSummarySuspend& operator=(const hipblasInfoSummarySuspend&) = delete;
+};
@@ -0,0 +1,411 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "deferred.hpp"
+#include "hipblas.h"
+#include "layout.hpp"
+#include "perf_counters.hpp"
+#include "shared_handle.hpp"
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// API call layer enabled through the HIPBLAS_LAYER environment variable, a bitwise OR of
+//   1 (trace)   the routine and its arguments,
+//   2 (bench)   a hipblas-bench command line reproducing the call,
+//   4 (profile) the device time of the call, measured with events on the handle stream,
+//   8 (markers) a ROCTX or NVTX range around the call, named after the routine and its sizes.
+//               Only available when hipBLAS is built with BUILD_WITH_MARKERS.
+//  16 (replay)  the bench command line of the call with its host start time, thread, stream and
+//               pointer mode, which hipblas-bench --replay runs again in the same order.
+//  32 (histogram) the device time of sampled calls in a latency histogram per routine and shape.
+//               Every HIPBLAS_LAYER_SAMPLE_INTERVAL-th call of each routine is timed (default 1),
+//               or with HIPBLAS_LAYER_SAMPLE_RANDOM=1 each call with a probability of one in the
+//               interval. The histograms are written every HIPBLAS_LAYER_HISTOGRAM_INTERVAL
+//               seconds and at exit, to HIPBLAS_LAYER_HISTOGRAM_PATH, or when it is unset to
+//               stderr and at exit with the other output. Calls that are not sampled and not
+//               recorded otherwise cost one lookup of their routine.
+//  64 (bench summary) every distinct hipblas-bench command line with the number of calls making
+//               it, most called first. Unlike the bench mode, it covers all calls of the process.
+// Calls are recorded in a ring buffer per thread, holding the last HIPBLAS_LAYER_BUFFER_SIZE
+// calls (default 4096), and written at exit to HIPBLAS_LOG_PATH, or stderr when it is unset.
+// Only the outermost hipBLAS call is recorded when one entry point calls another.
+enum hipblas_layer_mode : int
+{
+    hipblas_layer_mode_none      = 0,
+    hipblas_layer_mode_trace     = 1,
+    hipblas_layer_mode_bench     = 2,
+    hipblas_layer_mode_profile   = 4,
+    hipblas_layer_mode_markers   = 8,
+    hipblas_layer_mode_replay    = 16,
+    hipblas_layer_mode_histogram = 32,
+    hipblas_layer_mode_summary   = 64,
+};
+
+// Read once from HIPBLAS_LAYER while the library is loaded
+extern const int hipblas_layer;
+
+struct hipblasLayerValue
+{
+    std::string value; // as shown in the trace
+    std::string bench; // as passed to hipblas-bench, empty when it has no bench option
+    std::string imag; // imaginary part of a complex scalar for hipblas-bench
+    std::string compute; // hipblas-bench --compute_type_gemm of a compute type
+};
+
+struct hipblasLayerEntry;
+
+std::string hipblasLayerFormat(double value);
+std::string hipblasLayerFormat(const void* value);
+std::string hipblasLayerFormat(hipDataType type);
+std::string hipblasLayerFormat(hipblasComputeType_t type);
+
+// Name of a compute type as hipblas-bench --compute_type_gemm takes it, such as 32f_fast_tf32
+std::string hipblasLayerComputeName(hipblasComputeType_t type);
+
+inline hipblasLayerValue hipblasLayerValueOf(hipblasOperation_t op, bool)
+{
+    std::string s = op == HIPBLAS_OP_N ? "N" : op == HIPBLAS_OP_T ? "T" : "C";
+    return {s, s, ""};
+}
+
+inline hipblasLayerValue hipblasLayerValueOf(hipblasFillMode_t uplo, bool)
+{
+    std::string s = uplo == HIPBLAS_FILL_MODE_UPPER   ? "U"
+                    : uplo == HIPBLAS_FILL_MODE_LOWER ? "L"
+                                                      : "F";
+    return {s, s, ""};
+}
+
+inline hipblasLayerValue hipblasLayerValueOf(hipblasDiagType_t diag, bool)
+{
+    std::string s = diag == HIPBLAS_DIAG_UNIT ? "U" : "N";
+    return {s, s, ""};
+}
+
+inline hipblasLayerValue hipblasLayerValueOf(hipblasSideMode_t side, bool)
+{
+    std::string s = side == HIPBLAS_SIDE_LEFT ? "L" : side == HIPBLAS_SIDE_RIGHT ? "R" : "B";
+    return {s, s, ""};
+}
+
+inline hipblasLayerValue hipblasLayerValueOf(hipDataType type, bool)
+{
+    std::string s = hipblasLayerFormat(type);
+    return {s, s, ""};
+}
+
+inline hipblasLayerValue hipblasLayerValueOf(hipblasComputeType_t type, bool)
+{
+    std::string s = hipblasLayerComputeName(type);
+    return {s, hipblasLayerFormat(type), "", s};
+}
+
+template <typename T, typename = void>
+struct hipblasLayerHasReal : std::false_type
+{
+};
+
+template <typename T>
+struct hipblasLayerHasReal<T, std::void_t<decltype(std::declval<T>().real())>> : std::true_type
+{
+};
+
+template <typename T, typename = void>
+struct hipblasLayerHasXY : std::false_type
+{
+};
+
+template <typename T>
+struct hipblasLayerHasXY<T, std::void_t<decltype(std::declval<T>().x + std::declval<T>().y)>>
+    : std::true_type
+{
+};
+
+// Sizes and enums are shown as integers, pointers as addresses. scalar is set for alpha and
+// beta, which are shown by value when they are on the host.
+template <typename T>
+hipblasLayerValue hipblasLayerValueOf(const T& value, bool scalar)
+{
+    if constexpr(std::is_pointer_v<T>)
+    {
+        using U = std::remove_cv_t<std::remove_pointer_t<T>>;
+
+        if(scalar && value)
+        {
+            if constexpr(std::is_floating_point_v<U>)
+            {
+                std::string s = hipblasLayerFormat(double(*value));
+                return {s, s, ""};
+            }
+            else if constexpr(hipblasLayerHasReal<U>::value || hipblasLayerHasXY<U>::value)
+            {
+                // hipblasComplex and hipblasDoubleComplex, or hipComplex and hipDoubleComplex
+                std::string re, im;
+                if constexpr(hipblasLayerHasReal<U>::value)
+                {
+                    re = hipblasLayerFormat(double(value->real()));
+                    im = hipblasLayerFormat(double(value->imag()));
+                }
+                else
+                {
+                    re = hipblasLayerFormat(double(value->x));
+                    im = hipblasLayerFormat(double(value->y));
+                }
+                return {"(" + re + "," + im + ")", re, im};
+            }
+        }
+        return {hipblasLayerFormat((const void*)value), "", ""};
+    }
+    else if constexpr(std::is_floating_point_v<T>)
+    {
+        std::string s = hipblasLayerFormat(double(value));
+        return {s, s, ""};
+    }
+    else
+    {
+        std::string s = std::to_string(int64_t(value));
+        return {s, s, ""};
+    }
+}
+
+// Splits the stringized argument list of HIPBLAS_LAYER
+std::vector<std::string> hipblasLayerNames(const char* names);
+
+// hipblas-bench -f and -r values of a routine, e.g. "gemm_strided_batched" and "f32_r" for
+// hipblasSgemmStridedBatched
+void hipblasLayerBenchFunction(const char* func, std::string& function, std::string& precision);
+
+// Starts recording a call, returning nullptr when it is not recorded
+hipblasLayerEntry* hipblasLayerBegin(hipblasHandle_t                       handle,
+                                     const char*                           func,
+                                     const std::vector<std::string>&       names,
+                                     const std::vector<hipblasLayerValue>& values);
+
+void hipblasLayerEnd(hipblasLayerEntry* entry);
+
+// Counts the call under its hipblas-bench command line for the bench summary
+void hipblasLayerCount(const char*                           func,
+                       const std::vector<std::string>&       names,
+                       const std::vector<hipblasLayerValue>& values);
+
+// Returns true when this call of func is timed for the histograms
+bool hipblasLayerSampled(const char* func);
+
+// Times the call on the handle stream for the histogram of its shape, returning false when it is
+// not timed. At most one call per thread is timed at a time, as only outermost calls are.
+bool hipblasLayerHistogramBegin(hipblasHandle_t                       handle,
+                                const char*                           func,
+                                const std::vector<std::string>&       names,
+                                const std::vector<hipblasLayerValue>& values);
+
+void hipblasLayerHistogramEnd();
+
+bool hipblasLayerHostScalars(hipblasHandle_t handle);
+
+// True when a call on handle must not run, as handle is in HIPBLAS_STREAM_CAPTURE_MODE_SAFE, its
+// stream is being captured and the backend may still grow its workspace, which any call could do.
+// Defined by each backend; entry points without a handle are never refused.
+bool hipblasCaptureSafeRefused(hipblasHandle_t handle);
+
+template <typename T>
+bool hipblasCaptureSafeRefused(const T&)
+{
+    return false;
+}
+
+#ifdef HIPBLAS_MARKERS
+// Range name of a call, the routine followed by its sizes
+std::string hipblasLayerMarkerName(const char*                           func,
+                                   const std::vector<std::string>&       names,
+                                   const std::vector<hipblasLayerValue>& values);
+
+void hipblasMarkerPush(const char* name);
+void hipblasMarkerPop();
+#endif
+
+// Marks a part of an entry point with a nested range, when markers are enabled
+class hipblasMarkerScope
+{
+#ifdef HIPBLAS_MARKERS
+    bool pushed = false;
+
+public:
+    explicit hipblasMarkerScope(const char* name)
+    {
+        if(hipblas_layer & hipblas_layer_mode_markers)
+        {
+            hipblasMarkerPush(name);
+            pushed = true;
+        }
+    }
+
+    ~hipblasMarkerScope()
+    {
+        if(pushed)
+            hipblasMarkerPop();
+    }
+#else
+public:
+    explicit hipblasMarkerScope(const char*) {}
+#endif
+
+    hipblasMarkerScope(const hipblasMarkerScope&) = delete;
+    hipblasMarkerScope& operator=(const hipblasMarkerScope&) = delete;
+};
+
+// Depth of nested hipBLAS calls on this thread
+extern thread_local int hipblas_layer_depth;
+
+// Records the enclosing entry point for as long as it is in scope
+class hipblasLayerScope
+{
+    hipblasLayerEntry* entry   = nullptr;
+    bool               counted = false;
+    bool               sampled = false;
+#ifdef HIPBLAS_MARKERS
+    bool marked = false;
+#endif
+
+public:
+    template <typename... Ts>
+    hipblasLayerScope(const char*     func,
+                      const char*     names,
+                      hipblasHandle_t handle,
+                      const Ts&... args)
+    {
+        if(!hipblas_layer)
+            return;
+
+        counted = true;
+        if(hipblas_layer_depth++)
+            return;
+
+        // Calls only timed for the histograms stop here unless they are sampled
+        bool sample = (hipblas_layer & hipblas_layer_mode_histogram) && hipblasLayerSampled(func);
+        if(!sample && !(hipblas_layer & ~hipblas_layer_mode_histogram))
+            return;
+
+        // Recording must never make the call itself fail
+        try
+        {
+            // The first name is the handle argument
+            std::vector<std::string> arg_names = hipblasLayerNames(names);
+            if(arg_names.size() != sizeof...(args) + 1)
+                return;
+
+            // Scalars are only shown in the trace, bench, replay and summary output
+            int  scalar_modes = hipblas_layer_mode_trace | hipblas_layer_mode_bench
+                               | hipblas_layer_mode_replay | hipblas_layer_mode_summary;
+            bool host_scalars = (hipblas_layer & scalar_modes) && hipblasLayerHostScalars(handle);
+
+            std::vector<hipblasLayerValue> values;
+            size_t                         i = 1;
+            values.reserve(sizeof...(args));
+            ((values.push_back(hipblasLayerValueOf(
+                  args, host_scalars && (arg_names[i] == "alpha" || arg_names[i] == "beta"))),
+              i++),
+             ...);
+
+#ifdef HIPBLAS_MARKERS
+            if(hipblas_layer & hipblas_layer_mode_markers)
+            {
+                hipblasMarkerPush(hipblasLayerMarkerName(func, arg_names, values).c_str());
+                marked = true;
+            }
+#endif
+            if(hipblas_layer
+               & (hipblas_layer_mode_trace | hipblas_layer_mode_bench | hipblas_layer_mode_profile
+                  | hipblas_layer_mode_replay))
+                entry = hipblasLayerBegin(handle, func, arg_names, values);
+            if(hipblas_layer & hipblas_layer_mode_summary)
+                hipblasLayerCount(func, arg_names, values);
+            if(sample)
+                sampled = hipblasLayerHistogramBegin(handle, func, arg_names, values);
+        }
+        catch(...)
+        {
+            entry   = nullptr;
+            sampled = false;
+        }
+    }
+
+    ~hipblasLayerScope()
+    {
+        if(!counted)
+            return;
+        if(sampled)
+            hipblasLayerHistogramEnd();
+        if(entry)
+            hipblasLayerEnd(entry);
+#ifdef HIPBLAS_MARKERS
+        if(marked)
+            hipblasMarkerPop();
+#endif
+        hipblas_layer_depth--;
+    }
+
+    hipblasLayerScope(const hipblasLayerScope&) = delete;
+    hipblasLayerScope& operator=(const hipblasLayerScope&) = delete;
+};
+
+#define HIPBLAS_LAYER_FIRST(first, ...) first
+
+#define HIPBLAS_LAYER_SCOPES(deferrable, row_major, ...)                                       \
+    hipblasLayerScope        hipblas_layer_scope(__func__, #__VA_ARGS__, __VA_ARGS__);         \
+    hipblasPerfCounterScope  hipblas_perf_counter_scope(__func__, #__VA_ARGS__, __VA_ARGS__);  \
+    hipblasSharedHandleScope hipblas_shared_handle_scope(HIPBLAS_LAYER_FIRST(__VA_ARGS__, 0)); \
+    hipblasLayoutScope       hipblas_layout_scope(HIPBLAS_LAYER_FIRST(__VA_ARGS__, 0));        \
+    if(hipblasLayoutRefused(row_major, #__VA_ARGS__))                                          \
+        return HIPBLAS_STATUS_NOT_SUPPORTED;                                                   \
+    if(hipblasCaptureSafeRefused(HIPBLAS_LAYER_FIRST(__VA_ARGS__, 0)))                         \
+        return HIPBLAS_STATUS_WORKSPACE_TOO_SMALL;                                             \
+    hipblasDeferredScope hipblas_deferred_scope(HIPBLAS_LAYER_FIRST(__VA_ARGS__, 0), deferrable)
+
+// Placed first in every entry point, with the handle (or nullptr) followed by the arguments. The
+// call is counted when the handle has performance counters, then a shared handle argument is
+// replaced by the handle the call borrows from its pool, the layout of the handle is looked up
+// and the calls deferred on the handle are run for the outermost entry point. Calls taking a
+// matrix return HIPBLAS_STATUS_NOT_SUPPORTED on a row-major handle, and calls that could
+// allocate in a safe stream capture return HIPBLAS_STATUS_WORKSPACE_TOO_SMALL.
+#define HIPBLAS_LAYER(...) HIPBLAS_LAYER_SCOPES(false, false, __VA_ARGS__)
+
+// Placed first instead of HIPBLAS_LAYER in the entry points that run a row-major call through
+// hipblasLayoutGemm, hipblasLayoutGemv or hipblasLayoutTrsm
+#define HIPBLAS_LAYER_ROW_MAJOR(...) HIPBLAS_LAYER_SCOPES(false, true, __VA_ARGS__)
+
+// Placed first instead of HIPBLAS_LAYER in the gemv and axpy entry points that may queue their
+// call on a deferred handle, which do not run the queue when the call joins it
+#define HIPBLAS_LAYER_DEFERRED(...) HIPBLAS_LAYER_SCOPES(true, false, __VA_ARGS__)
+
+// HIPBLAS_LAYER_DEFERRED for the entry points that also have a row-major form
+#define HIPBLAS_LAYER_DEFERRED_ROW_MAJOR(...) HIPBLAS_LAYER_SCOPES(true, true, __VA_ARGS__)
+
+// Placed first instead of HIPBLAS_LAYER in the entry points acting on a shared handle itself.
+// The calls deferred on the handle are run first.
+#define HIPBLAS_LAYER_HANDLE(...)                                              \
+    hipblasLayerScope    hipblas_layer_scope(__func__, #__VA_ARGS__, __VA_ARGS__); \
+    hipblasDeferredScope hipblas_deferred_scope(HIPBLAS_LAYER_FIRST(__VA_ARGS__, 0), false)
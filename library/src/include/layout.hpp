@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+// Matrix layout set on a handle with hipblasSetLayout. A row-major matrix is the transpose of the
+// column-major matrix in the same memory, so the gemm, gemv and trsm entry points run a row-major
+// call as the equivalent column-major one by swapping their arguments. Only the outermost entry
+// point of a thread does so: calls one entry point makes to another are column-major already.
+// Those entry points are placed with HIPBLAS_LAYER_ROW_MAJOR; any other entry point taking a
+// matrix returns HIPBLAS_STATUS_NOT_SUPPORTED on a row-major handle.
+
+// HIPBLAS_ROW_MAJOR or HIPBLAS_COL_MAJOR, without locking when no handle is row-major
+hipblasLayout_t hipblasLayoutGet(hipblasHandle_t handle);
+
+// Forget the layout of handle
+void hipblasLayoutErase(hipblasHandle_t handle);
+
+// Depth of nested entry points on this thread, and whether the outermost one is row-major
+extern thread_local int  hipblas_layout_depth;
+extern thread_local bool hipblas_layout_row_major;
+
+// Placed in every entry point by HIPBLAS_LAYER
+class hipblasLayoutScope
+{
+public:
+    explicit hipblasLayoutScope(hipblasHandle_t handle)
+    {
+        if(!hipblas_layout_depth++)
+            hipblas_layout_row_major = handle && hipblasLayoutGet(handle) == HIPBLAS_ROW_MAJOR;
+    }
+
+    ~hipblasLayoutScope()
+    {
+        hipblas_layout_depth--;
+    }
+
+    hipblasLayoutScope(const hipblasLayoutScope&) = delete;
+    hipblasLayoutScope& operator=(const hipblasLayoutScope&) = delete;
+};
+
+// True in the outermost entry point of a call on a row-major handle
+inline bool hipblasLayoutRowMajor()
+{
+    return hipblas_layout_depth == 1 && hipblas_layout_row_major;
+}
+
+// Whether c may appear in an identifier
+constexpr bool hipblasLayoutIdentifierChar(char c)
+{
+    return c == '_' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// Whether the len characters at name spell word
+constexpr bool hipblasLayoutIdentifierIs(const char* name, size_t len, const char* word)
+{
+    for(size_t i = 0; i < len; i++)
+        if(name[i] != word[i])
+            return false;
+    return word[len] == '\0';
+}
+
+// Whether names, the arguments of an entry point as HIPBLAS_LAYER spells them, include the leading
+// dimension or packed storage of a matrix
+constexpr bool hipblasLayoutHasMatrix(const char* names)
+{
+    const char* matrix_names[] = {"lda", "ldb", "ldc", "lda_array", "AP"};
+    while(*names)
+    {
+        size_t len = 0;
+        while(hipblasLayoutIdentifierChar(names[len]))
+            len++;
+        for(const char* word : matrix_names)
+            if(len && hipblasLayoutIdentifierIs(names, len, word))
+                return true;
+        names += len ? len : 1;
+    }
+    return false;
+}
+
+// True in the outermost entry point of a call on a row-major handle when the entry point takes a
+// matrix, as names tells, but has no row-major form, as row_major tells
+inline bool hipblasLayoutRefused(bool row_major, const char* names)
+{
+    return !row_major && hipblasLayoutRowMajor() && hipblasLayoutHasMatrix(names);
+}
+
+// A row-major C = op(A) op(B) is the column-major C^T = op(B)^T op(A)^T: swaps transa with transb,
+// m with n, and the arguments of A with those of B. a and b tie the pointer, leading dimension
+// and, as they apply, the type and stride of each operand.
+template <typename I, typename Operands>
+inline void hipblasLayoutGemm(hipblasOperation_t& transa,
+                              hipblasOperation_t& transb,
+                              I&                  m,
+                              I&                  n,
+                              Operands            a,
+                              Operands            b)
+{
+    if(!hipblasLayoutRowMajor())
+        return;
+    std::swap(transa, transb);
+    std::swap(m, n);
+    a.swap(b);
+}
+
+// A row-major m by n A is the column-major n by m A^T, so HIPBLAS_OP_N and HIPBLAS_OP_T swap, and
+// on complex data HIPBLAS_OP_C and HIPBLAS_OP_CONJ swap too. False for those two unless the entry
+// point takes HIPBLAS_OP_CONJ, as conj says.
+template <typename I>
+inline bool
+    hipblasLayoutGemv(hipblasOperation_t& trans, I& m, I& n, bool complex, bool conj = false)
+{
+    if(!hipblasLayoutRowMajor())
+        return true;
+    if(complex && (trans == HIPBLAS_OP_C || trans == HIPBLAS_OP_CONJ))
+    {
+        if(!conj)
+            return false;
+        trans = trans == HIPBLAS_OP_C ? HIPBLAS_OP_CONJ : HIPBLAS_OP_C;
+    }
+    else
+        trans = trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_CONJ ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+    std::swap(m, n);
+    return true;
+}
+
+// A row-major op(A) X = alpha B is the column-major X^T op(A)^T = alpha B^T, with A^T in the other
+// triangle: side and uplo flip, m and n swap, and trans is unchanged.
+template <typename I>
+inline void hipblasLayoutTrsm(hipblasSideMode_t& side, hipblasFillMode_t& uplo, I& m, I& n)
+{
+    if(!hipblasLayoutRowMajor())
+        return;
+    side = side == HIPBLAS_SIDE_LEFT ? HIPBLAS_SIDE_RIGHT : HIPBLAS_SIDE_LEFT;
+    uplo = uplo == HIPBLAS_FILL_MODE_UPPER ? HIPBLAS_FILL_MODE_LOWER : HIPBLAS_FILL_MODE_UPPER;
+    std::swap(m, n);
+}
@@ -0,0 +1,901 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+// With BUILD_WITH_LAZY_LOADING hipBLAS is not linked against rocBLAS and rocSOLVER. Every
+// rocblas_ and rocsolver_ function used by the backend is renamed below to a function pointer
+// that is looked up on its first call, so each library is only opened by the first routine
+// that needs it and a process using no solver routines never loads rocSOLVER.
+//
+// This header must be included after the rocBLAS and rocSOLVER headers.
+
+#ifdef HIPBLAS_LAZY_LOADING
+
+#include <dlfcn.h>
+
+#ifndef HIPBLAS_ROCBLAS_LIBRARY
+#define HIPBLAS_ROCBLAS_LIBRARY "librocblas.so"
+#endif
+#ifndef HIPBLAS_ROCSOLVER_LIBRARY
+#define HIPBLAS_ROCSOLVER_LIBRARY "librocsolver.so"
+#endif
+
+enum hipblasLazyLibrary
+{
+    hipblas_lazy_rocblas,
+    hipblas_lazy_rocsolver
+};
+
+// Opens library on its first use. The handle is kept until the process exits.
+inline void* hipblasLazyOpen(hipblasLazyLibrary library)
+{
+    if(library == hipblas_lazy_rocsolver)
+    {
+        static void* rocsolver = dlopen(HIPBLAS_ROCSOLVER_LIBRARY, RTLD_NOW | RTLD_LOCAL);
+        return rocsolver;
+    }
+    static void* rocblas = dlopen(HIPBLAS_ROCBLAS_LIBRARY, RTLD_NOW | RTLD_LOCAL);
+    return rocblas;
+}
+
+// Address of symbol in library. Throws HIPBLAS_STATUS_NOT_INITIALIZED, returned by the
+// catch of the calling entry point, when the library or the symbol cannot be found.
+inline void* hipblasLazySymbol(hipblasLazyLibrary library, const char* symbol)
+{
+    void* lib  = hipblasLazyOpen(library);
+    void* addr = lib ? dlsym(lib, symbol) : nullptr;
+    if(!addr)
+        throw HIPBLAS_STATUS_NOT_INITIALIZED;
+    return addr;
+}
+
+// Each use has its own lambda, so the lookup result is cached in a static per call site
+#define HIPBLAS_LAZY(library, name)                                                 \
+    ([]() {                                                                         \
+        static const auto fn                                                        \
+            = reinterpret_cast<decltype(&name)>(hipblasLazySymbol(library, #name)); \
+        return fn;                                                                  \
+    }())
+#define HIPBLAS_LAZY_ROCBLAS(name) HIPBLAS_LAZY(hipblas_lazy_rocblas, name)
+#define HIPBLAS_LAZY_ROCSOLVER(name) HIPBLAS_LAZY(hipblas_lazy_rocsolver, name)
+
+// rocBLAS
+#define rocblas_axpy_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_axpy_batched_ex)
+#define rocblas_axpy_ex HIPBLAS_LAZY_ROCBLAS(rocblas_axpy_ex)
+#define rocblas_axpy_strided_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_axpy_strided_batched_ex)
+#define rocblas_bfdot HIPBLAS_LAZY_ROCBLAS(rocblas_bfdot)
+#define rocblas_bfdot_batched HIPBLAS_LAZY_ROCBLAS(rocblas_bfdot_batched)
+#define rocblas_bfdot_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_bfdot_strided_batched)
+#define rocblas_caxpy HIPBLAS_LAZY_ROCBLAS(rocblas_caxpy)
+#define rocblas_caxpy_64 HIPBLAS_LAZY_ROCBLAS(rocblas_caxpy_64)
+#define rocblas_caxpy_batched HIPBLAS_LAZY_ROCBLAS(rocblas_caxpy_batched)
+#define rocblas_caxpy_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_caxpy_strided_batched)
+#define rocblas_ccopy HIPBLAS_LAZY_ROCBLAS(rocblas_ccopy)
+#define rocblas_ccopy_64 HIPBLAS_LAZY_ROCBLAS(rocblas_ccopy_64)
+#define rocblas_ccopy_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ccopy_batched)
+#define rocblas_ccopy_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ccopy_strided_batched)
+#define rocblas_cdgmm HIPBLAS_LAZY_ROCBLAS(rocblas_cdgmm)
+#define rocblas_cdgmm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cdgmm_batched)
+#define rocblas_cdgmm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cdgmm_strided_batched)
+#define rocblas_cdotc HIPBLAS_LAZY_ROCBLAS(rocblas_cdotc)
+#define rocblas_cdotc_64 HIPBLAS_LAZY_ROCBLAS(rocblas_cdotc_64)
+#define rocblas_cdotc_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cdotc_batched)
+#define rocblas_cdotc_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cdotc_strided_batched)
+#define rocblas_cdotu HIPBLAS_LAZY_ROCBLAS(rocblas_cdotu)
+#define rocblas_cdotu_64 HIPBLAS_LAZY_ROCBLAS(rocblas_cdotu_64)
+#define rocblas_cdotu_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cdotu_batched)
+#define rocblas_cdotu_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cdotu_strided_batched)
+#define rocblas_cgbmv HIPBLAS_LAZY_ROCBLAS(rocblas_cgbmv)
+#define rocblas_cgbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgbmv_batched)
+#define rocblas_cgbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgbmv_strided_batched)
+#define rocblas_cgeam HIPBLAS_LAZY_ROCBLAS(rocblas_cgeam)
+#define rocblas_cgeam_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgeam_batched)
+#define rocblas_cgeam_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgeam_strided_batched)
+#define rocblas_cgemm HIPBLAS_LAZY_ROCBLAS(rocblas_cgemm)
+#define rocblas_cgemm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgemm_batched)
+#define rocblas_cgemm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgemm_strided_batched)
+#define rocblas_cgemv HIPBLAS_LAZY_ROCBLAS(rocblas_cgemv)
+#define rocblas_cgemv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgemv_batched)
+#define rocblas_cgemv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgemv_strided_batched)
+#define rocblas_cgerc HIPBLAS_LAZY_ROCBLAS(rocblas_cgerc)
+#define rocblas_cgerc_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgerc_batched)
+#define rocblas_cgerc_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgerc_strided_batched)
+#define rocblas_cgeru HIPBLAS_LAZY_ROCBLAS(rocblas_cgeru)
+#define rocblas_cgeru_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgeru_batched)
+#define rocblas_cgeru_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cgeru_strided_batched)
+#define rocblas_chbmv HIPBLAS_LAZY_ROCBLAS(rocblas_chbmv)
+#define rocblas_chbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chbmv_batched)
+#define rocblas_chbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chbmv_strided_batched)
+#define rocblas_chemm HIPBLAS_LAZY_ROCBLAS(rocblas_chemm)
+#define rocblas_chemm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chemm_batched)
+#define rocblas_chemm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chemm_strided_batched)
+#define rocblas_chemv HIPBLAS_LAZY_ROCBLAS(rocblas_chemv)
+#define rocblas_chemv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chemv_batched)
+#define rocblas_chemv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chemv_strided_batched)
+#define rocblas_cher HIPBLAS_LAZY_ROCBLAS(rocblas_cher)
+#define rocblas_cher2 HIPBLAS_LAZY_ROCBLAS(rocblas_cher2)
+#define rocblas_cher2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cher2_batched)
+#define rocblas_cher2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cher2_strided_batched)
+#define rocblas_cher2k HIPBLAS_LAZY_ROCBLAS(rocblas_cher2k)
+#define rocblas_cher2k_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cher2k_batched)
+#define rocblas_cher2k_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cher2k_strided_batched)
+#define rocblas_cher_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cher_batched)
+#define rocblas_cher_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cher_strided_batched)
+#define rocblas_cherk HIPBLAS_LAZY_ROCBLAS(rocblas_cherk)
+#define rocblas_cherk_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cherk_batched)
+#define rocblas_cherk_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cherk_strided_batched)
+#define rocblas_cherkx HIPBLAS_LAZY_ROCBLAS(rocblas_cherkx)
+#define rocblas_cherkx_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cherkx_batched)
+#define rocblas_cherkx_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cherkx_strided_batched)
+#define rocblas_chpmv HIPBLAS_LAZY_ROCBLAS(rocblas_chpmv)
+#define rocblas_chpmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chpmv_batched)
+#define rocblas_chpmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chpmv_strided_batched)
+#define rocblas_chpr HIPBLAS_LAZY_ROCBLAS(rocblas_chpr)
+#define rocblas_chpr2 HIPBLAS_LAZY_ROCBLAS(rocblas_chpr2)
+#define rocblas_chpr2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chpr2_batched)
+#define rocblas_chpr2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chpr2_strided_batched)
+#define rocblas_chpr_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chpr_batched)
+#define rocblas_chpr_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_chpr_strided_batched)
+#define rocblas_create_handle HIPBLAS_LAZY_ROCBLAS(rocblas_create_handle)
+#define rocblas_crot HIPBLAS_LAZY_ROCBLAS(rocblas_crot)
+#define rocblas_crot_64 HIPBLAS_LAZY_ROCBLAS(rocblas_crot_64)
+#define rocblas_crot_batched HIPBLAS_LAZY_ROCBLAS(rocblas_crot_batched)
+#define rocblas_crot_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_crot_strided_batched)
+#define rocblas_crotg HIPBLAS_LAZY_ROCBLAS(rocblas_crotg)
+#define rocblas_crotg_batched HIPBLAS_LAZY_ROCBLAS(rocblas_crotg_batched)
+#define rocblas_crotg_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_crotg_strided_batched)
+#define rocblas_cscal HIPBLAS_LAZY_ROCBLAS(rocblas_cscal)
+#define rocblas_cscal_64 HIPBLAS_LAZY_ROCBLAS(rocblas_cscal_64)
+#define rocblas_cscal_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cscal_batched)
+#define rocblas_cscal_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cscal_strided_batched)
+#define rocblas_cspr HIPBLAS_LAZY_ROCBLAS(rocblas_cspr)
+#define rocblas_cspr_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cspr_batched)
+#define rocblas_cspr_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cspr_strided_batched)
+#define rocblas_csrot HIPBLAS_LAZY_ROCBLAS(rocblas_csrot)
+#define rocblas_csrot_64 HIPBLAS_LAZY_ROCBLAS(rocblas_csrot_64)
+#define rocblas_csrot_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csrot_batched)
+#define rocblas_csrot_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csrot_strided_batched)
+#define rocblas_csscal HIPBLAS_LAZY_ROCBLAS(rocblas_csscal)
+#define rocblas_csscal_64 HIPBLAS_LAZY_ROCBLAS(rocblas_csscal_64)
+#define rocblas_csscal_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csscal_batched)
+#define rocblas_csscal_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csscal_strided_batched)
+#define rocblas_cswap HIPBLAS_LAZY_ROCBLAS(rocblas_cswap)
+#define rocblas_cswap_64 HIPBLAS_LAZY_ROCBLAS(rocblas_cswap_64)
+#define rocblas_cswap_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cswap_batched)
+#define rocblas_cswap_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_cswap_strided_batched)
+#define rocblas_csymm HIPBLAS_LAZY_ROCBLAS(rocblas_csymm)
+#define rocblas_csymm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csymm_batched)
+#define rocblas_csymm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csymm_strided_batched)
+#define rocblas_csymv HIPBLAS_LAZY_ROCBLAS(rocblas_csymv)
+#define rocblas_csymv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csymv_batched)
+#define rocblas_csymv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csymv_strided_batched)
+#define rocblas_csyr HIPBLAS_LAZY_ROCBLAS(rocblas_csyr)
+#define rocblas_csyr2 HIPBLAS_LAZY_ROCBLAS(rocblas_csyr2)
+#define rocblas_csyr2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csyr2_batched)
+#define rocblas_csyr2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csyr2_strided_batched)
+#define rocblas_csyr2k HIPBLAS_LAZY_ROCBLAS(rocblas_csyr2k)
+#define rocblas_csyr2k_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csyr2k_batched)
+#define rocblas_csyr2k_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csyr2k_strided_batched)
+#define rocblas_csyr_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csyr_batched)
+#define rocblas_csyr_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csyr_strided_batched)
+#define rocblas_csyrk HIPBLAS_LAZY_ROCBLAS(rocblas_csyrk)
+#define rocblas_csyrk_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csyrk_batched)
+#define rocblas_csyrk_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csyrk_strided_batched)
+#define rocblas_csyrkx HIPBLAS_LAZY_ROCBLAS(rocblas_csyrkx)
+#define rocblas_csyrkx_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csyrkx_batched)
+#define rocblas_csyrkx_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_csyrkx_strided_batched)
+#define rocblas_ctbmv HIPBLAS_LAZY_ROCBLAS(rocblas_ctbmv)
+#define rocblas_ctbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctbmv_batched)
+#define rocblas_ctbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctbmv_strided_batched)
+#define rocblas_ctbsv HIPBLAS_LAZY_ROCBLAS(rocblas_ctbsv)
+#define rocblas_ctbsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctbsv_batched)
+#define rocblas_ctbsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctbsv_strided_batched)
+#define rocblas_ctpmv HIPBLAS_LAZY_ROCBLAS(rocblas_ctpmv)
+#define rocblas_ctpmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctpmv_batched)
+#define rocblas_ctpmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctpmv_strided_batched)
+#define rocblas_ctpsv HIPBLAS_LAZY_ROCBLAS(rocblas_ctpsv)
+#define rocblas_ctpsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctpsv_batched)
+#define rocblas_ctpsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctpsv_strided_batched)
+#define rocblas_ctrmm HIPBLAS_LAZY_ROCBLAS(rocblas_ctrmm)
+#define rocblas_ctrmm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctrmm_batched)
+#define rocblas_ctrmm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctrmm_strided_batched)
+#define rocblas_ctrmv HIPBLAS_LAZY_ROCBLAS(rocblas_ctrmv)
+#define rocblas_ctrmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctrmv_batched)
+#define rocblas_ctrmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctrmv_strided_batched)
+#define rocblas_ctrsm HIPBLAS_LAZY_ROCBLAS(rocblas_ctrsm)
+#define rocblas_ctrsm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctrsm_batched)
+#define rocblas_ctrsm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctrsm_strided_batched)
+#define rocblas_ctrsv HIPBLAS_LAZY_ROCBLAS(rocblas_ctrsv)
+#define rocblas_ctrsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctrsv_batched)
+#define rocblas_ctrsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctrsv_strided_batched)
+#define rocblas_ctrtri HIPBLAS_LAZY_ROCBLAS(rocblas_ctrtri)
+#define rocblas_ctrtri_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctrtri_batched)
+#define rocblas_ctrtri_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ctrtri_strided_batched)
+#define rocblas_dasum HIPBLAS_LAZY_ROCBLAS(rocblas_dasum)
+#define rocblas_dasum_64 HIPBLAS_LAZY_ROCBLAS(rocblas_dasum_64)
+#define rocblas_dasum_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dasum_batched)
+#define rocblas_dasum_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dasum_strided_batched)
+#define rocblas_daxpy HIPBLAS_LAZY_ROCBLAS(rocblas_daxpy)
+#define rocblas_daxpy_64 HIPBLAS_LAZY_ROCBLAS(rocblas_daxpy_64)
+#define rocblas_daxpy_batched HIPBLAS_LAZY_ROCBLAS(rocblas_daxpy_batched)
+#define rocblas_daxpy_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_daxpy_strided_batched)
+#define rocblas_dcopy HIPBLAS_LAZY_ROCBLAS(rocblas_dcopy)
+#define rocblas_dcopy_64 HIPBLAS_LAZY_ROCBLAS(rocblas_dcopy_64)
+#define rocblas_dcopy_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dcopy_batched)
+#define rocblas_dcopy_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dcopy_strided_batched)
+#define rocblas_ddgmm HIPBLAS_LAZY_ROCBLAS(rocblas_ddgmm)
+#define rocblas_ddgmm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ddgmm_batched)
+#define rocblas_ddgmm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ddgmm_strided_batched)
+#define rocblas_ddot HIPBLAS_LAZY_ROCBLAS(rocblas_ddot)
+#define rocblas_ddot_64 HIPBLAS_LAZY_ROCBLAS(rocblas_ddot_64)
+#define rocblas_ddot_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ddot_batched)
+#define rocblas_ddot_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ddot_strided_batched)
+#define rocblas_destroy_handle HIPBLAS_LAZY_ROCBLAS(rocblas_destroy_handle)
+#define rocblas_dgbmv HIPBLAS_LAZY_ROCBLAS(rocblas_dgbmv)
+#define rocblas_dgbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dgbmv_batched)
+#define rocblas_dgbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dgbmv_strided_batched)
+#define rocblas_dgeam HIPBLAS_LAZY_ROCBLAS(rocblas_dgeam)
+#define rocblas_dgeam_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dgeam_batched)
+#define rocblas_dgeam_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dgeam_strided_batched)
+#define rocblas_dgemm HIPBLAS_LAZY_ROCBLAS(rocblas_dgemm)
+#define rocblas_dgemm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dgemm_batched)
+#define rocblas_dgemm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dgemm_strided_batched)
+#define rocblas_dgemv HIPBLAS_LAZY_ROCBLAS(rocblas_dgemv)
+#define rocblas_dgemv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dgemv_batched)
+#define rocblas_dgemv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dgemv_strided_batched)
+#define rocblas_dger HIPBLAS_LAZY_ROCBLAS(rocblas_dger)
+#define rocblas_dger_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dger_batched)
+#define rocblas_dger_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dger_strided_batched)
+#define rocblas_dnrm2 HIPBLAS_LAZY_ROCBLAS(rocblas_dnrm2)
+#define rocblas_dnrm2_64 HIPBLAS_LAZY_ROCBLAS(rocblas_dnrm2_64)
+#define rocblas_dnrm2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dnrm2_batched)
+#define rocblas_dnrm2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dnrm2_strided_batched)
+#define rocblas_dot_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_dot_batched_ex)
+#define rocblas_dot_ex HIPBLAS_LAZY_ROCBLAS(rocblas_dot_ex)
+#define rocblas_dot_strided_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_dot_strided_batched_ex)
+#define rocblas_dotc_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_dotc_batched_ex)
+#define rocblas_dotc_ex HIPBLAS_LAZY_ROCBLAS(rocblas_dotc_ex)
+#define rocblas_dotc_strided_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_dotc_strided_batched_ex)
+#define rocblas_drot HIPBLAS_LAZY_ROCBLAS(rocblas_drot)
+#define rocblas_drot_64 HIPBLAS_LAZY_ROCBLAS(rocblas_drot_64)
+#define rocblas_drot_batched HIPBLAS_LAZY_ROCBLAS(rocblas_drot_batched)
+#define rocblas_drot_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_drot_strided_batched)
+#define rocblas_drotg HIPBLAS_LAZY_ROCBLAS(rocblas_drotg)
+#define rocblas_drotg_batched HIPBLAS_LAZY_ROCBLAS(rocblas_drotg_batched)
+#define rocblas_drotg_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_drotg_strided_batched)
+#define rocblas_drotm HIPBLAS_LAZY_ROCBLAS(rocblas_drotm)
+#define rocblas_drotm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_drotm_batched)
+#define rocblas_drotm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_drotm_strided_batched)
+#define rocblas_drotmg HIPBLAS_LAZY_ROCBLAS(rocblas_drotmg)
+#define rocblas_drotmg_batched HIPBLAS_LAZY_ROCBLAS(rocblas_drotmg_batched)
+#define rocblas_drotmg_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_drotmg_strided_batched)
+#define rocblas_dsbmv HIPBLAS_LAZY_ROCBLAS(rocblas_dsbmv)
+#define rocblas_dsbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsbmv_batched)
+#define rocblas_dsbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsbmv_strided_batched)
+#define rocblas_dscal HIPBLAS_LAZY_ROCBLAS(rocblas_dscal)
+#define rocblas_dscal_64 HIPBLAS_LAZY_ROCBLAS(rocblas_dscal_64)
+#define rocblas_dscal_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dscal_batched)
+#define rocblas_dscal_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dscal_strided_batched)
+#define rocblas_dspmv HIPBLAS_LAZY_ROCBLAS(rocblas_dspmv)
+#define rocblas_dspmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dspmv_batched)
+#define rocblas_dspmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dspmv_strided_batched)
+#define rocblas_dspr HIPBLAS_LAZY_ROCBLAS(rocblas_dspr)
+#define rocblas_dspr2 HIPBLAS_LAZY_ROCBLAS(rocblas_dspr2)
+#define rocblas_dspr2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dspr2_batched)
+#define rocblas_dspr2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dspr2_strided_batched)
+#define rocblas_dspr_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dspr_batched)
+#define rocblas_dspr_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dspr_strided_batched)
+#define rocblas_dswap HIPBLAS_LAZY_ROCBLAS(rocblas_dswap)
+#define rocblas_dswap_64 HIPBLAS_LAZY_ROCBLAS(rocblas_dswap_64)
+#define rocblas_dswap_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dswap_batched)
+#define rocblas_dswap_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dswap_strided_batched)
+#define rocblas_dsymm HIPBLAS_LAZY_ROCBLAS(rocblas_dsymm)
+#define rocblas_dsymm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsymm_batched)
+#define rocblas_dsymm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsymm_strided_batched)
+#define rocblas_dsymv HIPBLAS_LAZY_ROCBLAS(rocblas_dsymv)
+#define rocblas_dsymv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsymv_batched)
+#define rocblas_dsymv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsymv_strided_batched)
+#define rocblas_dsyr HIPBLAS_LAZY_ROCBLAS(rocblas_dsyr)
+#define rocblas_dsyr2 HIPBLAS_LAZY_ROCBLAS(rocblas_dsyr2)
+#define rocblas_dsyr2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsyr2_batched)
+#define rocblas_dsyr2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsyr2_strided_batched)
+#define rocblas_dsyr2k HIPBLAS_LAZY_ROCBLAS(rocblas_dsyr2k)
+#define rocblas_dsyr2k_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsyr2k_batched)
+#define rocblas_dsyr2k_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsyr2k_strided_batched)
+#define rocblas_dsyr_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsyr_batched)
+#define rocblas_dsyr_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsyr_strided_batched)
+#define rocblas_dsyrk HIPBLAS_LAZY_ROCBLAS(rocblas_dsyrk)
+#define rocblas_dsyrk_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsyrk_batched)
+#define rocblas_dsyrk_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsyrk_strided_batched)
+#define rocblas_dsyrkx HIPBLAS_LAZY_ROCBLAS(rocblas_dsyrkx)
+#define rocblas_dsyrkx_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsyrkx_batched)
+#define rocblas_dsyrkx_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dsyrkx_strided_batched)
+#define rocblas_dtbmv HIPBLAS_LAZY_ROCBLAS(rocblas_dtbmv)
+#define rocblas_dtbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtbmv_batched)
+#define rocblas_dtbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtbmv_strided_batched)
+#define rocblas_dtbsv HIPBLAS_LAZY_ROCBLAS(rocblas_dtbsv)
+#define rocblas_dtbsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtbsv_batched)
+#define rocblas_dtbsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtbsv_strided_batched)
+#define rocblas_dtpmv HIPBLAS_LAZY_ROCBLAS(rocblas_dtpmv)
+#define rocblas_dtpmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtpmv_batched)
+#define rocblas_dtpmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtpmv_strided_batched)
+#define rocblas_dtpsv HIPBLAS_LAZY_ROCBLAS(rocblas_dtpsv)
+#define rocblas_dtpsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtpsv_batched)
+#define rocblas_dtpsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtpsv_strided_batched)
+#define rocblas_dtrmm HIPBLAS_LAZY_ROCBLAS(rocblas_dtrmm)
+#define rocblas_dtrmm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtrmm_batched)
+#define rocblas_dtrmm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtrmm_strided_batched)
+#define rocblas_dtrmv HIPBLAS_LAZY_ROCBLAS(rocblas_dtrmv)
+#define rocblas_dtrmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtrmv_batched)
+#define rocblas_dtrmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtrmv_strided_batched)
+#define rocblas_dtrsm HIPBLAS_LAZY_ROCBLAS(rocblas_dtrsm)
+#define rocblas_dtrsm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtrsm_batched)
+#define rocblas_dtrsm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtrsm_strided_batched)
+#define rocblas_dtrsv HIPBLAS_LAZY_ROCBLAS(rocblas_dtrsv)
+#define rocblas_dtrsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtrsv_batched)
+#define rocblas_dtrsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtrsv_strided_batched)
+#define rocblas_dtrtri HIPBLAS_LAZY_ROCBLAS(rocblas_dtrtri)
+#define rocblas_dtrtri_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtrtri_batched)
+#define rocblas_dtrtri_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dtrtri_strided_batched)
+#define rocblas_dzasum HIPBLAS_LAZY_ROCBLAS(rocblas_dzasum)
+#define rocblas_dzasum_64 HIPBLAS_LAZY_ROCBLAS(rocblas_dzasum_64)
+#define rocblas_dzasum_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dzasum_batched)
+#define rocblas_dzasum_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dzasum_strided_batched)
+#define rocblas_dznrm2 HIPBLAS_LAZY_ROCBLAS(rocblas_dznrm2)
+#define rocblas_dznrm2_64 HIPBLAS_LAZY_ROCBLAS(rocblas_dznrm2_64)
+#define rocblas_dznrm2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dznrm2_batched)
+#define rocblas_dznrm2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_dznrm2_strided_batched)
+#define rocblas_gemm_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_gemm_batched_ex)
+#define rocblas_gemm_batched_ex_64 HIPBLAS_LAZY_ROCBLAS(rocblas_gemm_batched_ex_64)
+#define rocblas_gemm_batched_ex_get_solutions \
+    HIPBLAS_LAZY_ROCBLAS(rocblas_gemm_batched_ex_get_solutions)
+#define rocblas_gemm_ex HIPBLAS_LAZY_ROCBLAS(rocblas_gemm_ex)
+#define rocblas_gemm_ex_64 HIPBLAS_LAZY_ROCBLAS(rocblas_gemm_ex_64)
+#define rocblas_gemm_ex_get_solutions HIPBLAS_LAZY_ROCBLAS(rocblas_gemm_ex_get_solutions)
+#define rocblas_gemm_strided_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_gemm_strided_batched_ex)
+#define rocblas_gemm_strided_batched_ex_64 HIPBLAS_LAZY_ROCBLAS(rocblas_gemm_strided_batched_ex_64)
+#define rocblas_gemm_strided_batched_ex_get_solutions \
+    HIPBLAS_LAZY_ROCBLAS(rocblas_gemm_strided_batched_ex_get_solutions)
+#define rocblas_get_atomics_mode HIPBLAS_LAZY_ROCBLAS(rocblas_get_atomics_mode)
+#define rocblas_get_device_memory_size HIPBLAS_LAZY_ROCBLAS(rocblas_get_device_memory_size)
+#define rocblas_get_math_mode HIPBLAS_LAZY_ROCBLAS(rocblas_get_math_mode)
+#define rocblas_get_matrix HIPBLAS_LAZY_ROCBLAS(rocblas_get_matrix)
+#define rocblas_get_matrix_async HIPBLAS_LAZY_ROCBLAS(rocblas_get_matrix_async)
+#define rocblas_get_pointer_mode HIPBLAS_LAZY_ROCBLAS(rocblas_get_pointer_mode)
+#define rocblas_get_stream HIPBLAS_LAZY_ROCBLAS(rocblas_get_stream)
+#define rocblas_get_vector HIPBLAS_LAZY_ROCBLAS(rocblas_get_vector)
+#define rocblas_get_vector_async HIPBLAS_LAZY_ROCBLAS(rocblas_get_vector_async)
+#define rocblas_get_version_string HIPBLAS_LAZY_ROCBLAS(rocblas_get_version_string)
+#define rocblas_get_version_string_size HIPBLAS_LAZY_ROCBLAS(rocblas_get_version_string_size)
+#define rocblas_haxpy HIPBLAS_LAZY_ROCBLAS(rocblas_haxpy)
+#define rocblas_haxpy_batched HIPBLAS_LAZY_ROCBLAS(rocblas_haxpy_batched)
+#define rocblas_haxpy_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_haxpy_strided_batched)
+#define rocblas_hdot HIPBLAS_LAZY_ROCBLAS(rocblas_hdot)
+#define rocblas_hdot_batched HIPBLAS_LAZY_ROCBLAS(rocblas_hdot_batched)
+#define rocblas_hdot_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_hdot_strided_batched)
+#define rocblas_hgemm HIPBLAS_LAZY_ROCBLAS(rocblas_hgemm)
+#define rocblas_hgemm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_hgemm_batched)
+#define rocblas_hgemm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_hgemm_strided_batched)
+#define rocblas_hshgemv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_hshgemv_batched)
+#define rocblas_hshgemv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_hshgemv_strided_batched)
+#define rocblas_hssgemv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_hssgemv_batched)
+#define rocblas_hssgemv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_hssgemv_strided_batched)
+#define rocblas_icamax HIPBLAS_LAZY_ROCBLAS(rocblas_icamax)
+#define rocblas_icamax_64 HIPBLAS_LAZY_ROCBLAS(rocblas_icamax_64)
+#define rocblas_icamax_batched HIPBLAS_LAZY_ROCBLAS(rocblas_icamax_batched)
+#define rocblas_icamax_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_icamax_strided_batched)
+#define rocblas_icamin HIPBLAS_LAZY_ROCBLAS(rocblas_icamin)
+#define rocblas_icamin_64 HIPBLAS_LAZY_ROCBLAS(rocblas_icamin_64)
+#define rocblas_icamin_batched HIPBLAS_LAZY_ROCBLAS(rocblas_icamin_batched)
+#define rocblas_icamin_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_icamin_strided_batched)
+#define rocblas_idamax HIPBLAS_LAZY_ROCBLAS(rocblas_idamax)
+#define rocblas_idamax_64 HIPBLAS_LAZY_ROCBLAS(rocblas_idamax_64)
+#define rocblas_idamax_batched HIPBLAS_LAZY_ROCBLAS(rocblas_idamax_batched)
+#define rocblas_idamax_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_idamax_strided_batched)
+#define rocblas_idamin HIPBLAS_LAZY_ROCBLAS(rocblas_idamin)
+#define rocblas_idamin_64 HIPBLAS_LAZY_ROCBLAS(rocblas_idamin_64)
+#define rocblas_idamin_batched HIPBLAS_LAZY_ROCBLAS(rocblas_idamin_batched)
+#define rocblas_idamin_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_idamin_strided_batched)
+#define rocblas_initialize HIPBLAS_LAZY_ROCBLAS(rocblas_initialize)
+#define rocblas_is_device_memory_size_query \
+    HIPBLAS_LAZY_ROCBLAS(rocblas_is_device_memory_size_query)
+#define rocblas_is_user_managing_device_memory \
+    HIPBLAS_LAZY_ROCBLAS(rocblas_is_user_managing_device_memory)
+#define rocblas_isamax HIPBLAS_LAZY_ROCBLAS(rocblas_isamax)
+#define rocblas_isamax_64 HIPBLAS_LAZY_ROCBLAS(rocblas_isamax_64)
+#define rocblas_isamax_batched HIPBLAS_LAZY_ROCBLAS(rocblas_isamax_batched)
+#define rocblas_isamax_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_isamax_strided_batched)
+#define rocblas_isamin HIPBLAS_LAZY_ROCBLAS(rocblas_isamin)
+#define rocblas_isamin_64 HIPBLAS_LAZY_ROCBLAS(rocblas_isamin_64)
+#define rocblas_isamin_batched HIPBLAS_LAZY_ROCBLAS(rocblas_isamin_batched)
+#define rocblas_isamin_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_isamin_strided_batched)
+#define rocblas_izamax HIPBLAS_LAZY_ROCBLAS(rocblas_izamax)
+#define rocblas_izamax_64 HIPBLAS_LAZY_ROCBLAS(rocblas_izamax_64)
+#define rocblas_izamax_batched HIPBLAS_LAZY_ROCBLAS(rocblas_izamax_batched)
+#define rocblas_izamax_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_izamax_strided_batched)
+#define rocblas_izamin HIPBLAS_LAZY_ROCBLAS(rocblas_izamin)
+#define rocblas_izamin_64 HIPBLAS_LAZY_ROCBLAS(rocblas_izamin_64)
+#define rocblas_izamin_batched HIPBLAS_LAZY_ROCBLAS(rocblas_izamin_batched)
+#define rocblas_izamin_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_izamin_strided_batched)
+#define rocblas_nrm2_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_nrm2_batched_ex)
+#define rocblas_nrm2_ex HIPBLAS_LAZY_ROCBLAS(rocblas_nrm2_ex)
+#define rocblas_nrm2_strided_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_nrm2_strided_batched_ex)
+#define rocblas_rot_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_rot_batched_ex)
+#define rocblas_rot_ex HIPBLAS_LAZY_ROCBLAS(rocblas_rot_ex)
+#define rocblas_rot_strided_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_rot_strided_batched_ex)
+#define rocblas_sasum HIPBLAS_LAZY_ROCBLAS(rocblas_sasum)
+#define rocblas_sasum_64 HIPBLAS_LAZY_ROCBLAS(rocblas_sasum_64)
+#define rocblas_sasum_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sasum_batched)
+#define rocblas_sasum_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sasum_strided_batched)
+#define rocblas_saxpy HIPBLAS_LAZY_ROCBLAS(rocblas_saxpy)
+#define rocblas_saxpy_64 HIPBLAS_LAZY_ROCBLAS(rocblas_saxpy_64)
+#define rocblas_saxpy_batched HIPBLAS_LAZY_ROCBLAS(rocblas_saxpy_batched)
+#define rocblas_saxpy_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_saxpy_strided_batched)
+#define rocblas_scal_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_scal_batched_ex)
+#define rocblas_scal_ex HIPBLAS_LAZY_ROCBLAS(rocblas_scal_ex)
+#define rocblas_scal_strided_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_scal_strided_batched_ex)
+#define rocblas_scasum HIPBLAS_LAZY_ROCBLAS(rocblas_scasum)
+#define rocblas_scasum_64 HIPBLAS_LAZY_ROCBLAS(rocblas_scasum_64)
+#define rocblas_scasum_batched HIPBLAS_LAZY_ROCBLAS(rocblas_scasum_batched)
+#define rocblas_scasum_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_scasum_strided_batched)
+#define rocblas_scnrm2 HIPBLAS_LAZY_ROCBLAS(rocblas_scnrm2)
+#define rocblas_scnrm2_64 HIPBLAS_LAZY_ROCBLAS(rocblas_scnrm2_64)
+#define rocblas_scnrm2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_scnrm2_batched)
+#define rocblas_scnrm2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_scnrm2_strided_batched)
+#define rocblas_scopy HIPBLAS_LAZY_ROCBLAS(rocblas_scopy)
+#define rocblas_scopy_64 HIPBLAS_LAZY_ROCBLAS(rocblas_scopy_64)
+#define rocblas_scopy_batched HIPBLAS_LAZY_ROCBLAS(rocblas_scopy_batched)
+#define rocblas_scopy_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_scopy_strided_batched)
+#define rocblas_sdgmm HIPBLAS_LAZY_ROCBLAS(rocblas_sdgmm)
+#define rocblas_sdgmm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sdgmm_batched)
+#define rocblas_sdgmm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sdgmm_strided_batched)
+#define rocblas_sdot HIPBLAS_LAZY_ROCBLAS(rocblas_sdot)
+#define rocblas_sdot_64 HIPBLAS_LAZY_ROCBLAS(rocblas_sdot_64)
+#define rocblas_sdot_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sdot_batched)
+#define rocblas_sdot_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sdot_strided_batched)
+#define rocblas_set_atomics_mode HIPBLAS_LAZY_ROCBLAS(rocblas_set_atomics_mode)
+#define rocblas_set_device_memory_size HIPBLAS_LAZY_ROCBLAS(rocblas_set_device_memory_size)
+#define rocblas_set_math_mode HIPBLAS_LAZY_ROCBLAS(rocblas_set_math_mode)
+#define rocblas_set_matrix HIPBLAS_LAZY_ROCBLAS(rocblas_set_matrix)
+#define rocblas_set_matrix_async HIPBLAS_LAZY_ROCBLAS(rocblas_set_matrix_async)
+#define rocblas_set_pointer_mode HIPBLAS_LAZY_ROCBLAS(rocblas_set_pointer_mode)
+#define rocblas_set_stream HIPBLAS_LAZY_ROCBLAS(rocblas_set_stream)
+#define rocblas_set_vector HIPBLAS_LAZY_ROCBLAS(rocblas_set_vector)
+#define rocblas_set_vector_async HIPBLAS_LAZY_ROCBLAS(rocblas_set_vector_async)
+#define rocblas_set_workspace HIPBLAS_LAZY_ROCBLAS(rocblas_set_workspace)
+#define rocblas_sgbmv HIPBLAS_LAZY_ROCBLAS(rocblas_sgbmv)
+#define rocblas_sgbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sgbmv_batched)
+#define rocblas_sgbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sgbmv_strided_batched)
+#define rocblas_sgeam HIPBLAS_LAZY_ROCBLAS(rocblas_sgeam)
+#define rocblas_sgeam_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sgeam_batched)
+#define rocblas_sgeam_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sgeam_strided_batched)
+#define rocblas_sgemm HIPBLAS_LAZY_ROCBLAS(rocblas_sgemm)
+#define rocblas_sgemm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sgemm_batched)
+#define rocblas_sgemm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sgemm_strided_batched)
+#define rocblas_sgemv HIPBLAS_LAZY_ROCBLAS(rocblas_sgemv)
+#define rocblas_sgemv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sgemv_batched)
+#define rocblas_sgemv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sgemv_strided_batched)
+#define rocblas_sger HIPBLAS_LAZY_ROCBLAS(rocblas_sger)
+#define rocblas_sger_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sger_batched)
+#define rocblas_sger_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sger_strided_batched)
+#define rocblas_snrm2 HIPBLAS_LAZY_ROCBLAS(rocblas_snrm2)
+#define rocblas_snrm2_64 HIPBLAS_LAZY_ROCBLAS(rocblas_snrm2_64)
+#define rocblas_snrm2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_snrm2_batched)
+#define rocblas_snrm2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_snrm2_strided_batched)
+#define rocblas_srot HIPBLAS_LAZY_ROCBLAS(rocblas_srot)
+#define rocblas_srot_64 HIPBLAS_LAZY_ROCBLAS(rocblas_srot_64)
+#define rocblas_srot_batched HIPBLAS_LAZY_ROCBLAS(rocblas_srot_batched)
+#define rocblas_srot_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_srot_strided_batched)
+#define rocblas_srotg HIPBLAS_LAZY_ROCBLAS(rocblas_srotg)
+#define rocblas_srotg_batched HIPBLAS_LAZY_ROCBLAS(rocblas_srotg_batched)
+#define rocblas_srotg_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_srotg_strided_batched)
+#define rocblas_srotm HIPBLAS_LAZY_ROCBLAS(rocblas_srotm)
+#define rocblas_srotm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_srotm_batched)
+#define rocblas_srotm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_srotm_strided_batched)
+#define rocblas_srotmg HIPBLAS_LAZY_ROCBLAS(rocblas_srotmg)
+#define rocblas_srotmg_batched HIPBLAS_LAZY_ROCBLAS(rocblas_srotmg_batched)
+#define rocblas_srotmg_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_srotmg_strided_batched)
+#define rocblas_ssbmv HIPBLAS_LAZY_ROCBLAS(rocblas_ssbmv)
+#define rocblas_ssbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssbmv_batched)
+#define rocblas_ssbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssbmv_strided_batched)
+#define rocblas_sscal HIPBLAS_LAZY_ROCBLAS(rocblas_sscal)
+#define rocblas_sscal_64 HIPBLAS_LAZY_ROCBLAS(rocblas_sscal_64)
+#define rocblas_sscal_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sscal_batched)
+#define rocblas_sscal_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sscal_strided_batched)
+#define rocblas_sspmv HIPBLAS_LAZY_ROCBLAS(rocblas_sspmv)
+#define rocblas_sspmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sspmv_batched)
+#define rocblas_sspmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sspmv_strided_batched)
+#define rocblas_sspr HIPBLAS_LAZY_ROCBLAS(rocblas_sspr)
+#define rocblas_sspr2 HIPBLAS_LAZY_ROCBLAS(rocblas_sspr2)
+#define rocblas_sspr2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sspr2_batched)
+#define rocblas_sspr2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sspr2_strided_batched)
+#define rocblas_sspr_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sspr_batched)
+#define rocblas_sspr_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sspr_strided_batched)
+#define rocblas_sswap HIPBLAS_LAZY_ROCBLAS(rocblas_sswap)
+#define rocblas_sswap_64 HIPBLAS_LAZY_ROCBLAS(rocblas_sswap_64)
+#define rocblas_sswap_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sswap_batched)
+#define rocblas_sswap_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_sswap_strided_batched)
+#define rocblas_ssymm HIPBLAS_LAZY_ROCBLAS(rocblas_ssymm)
+#define rocblas_ssymm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssymm_batched)
+#define rocblas_ssymm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssymm_strided_batched)
+#define rocblas_ssymv HIPBLAS_LAZY_ROCBLAS(rocblas_ssymv)
+#define rocblas_ssymv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssymv_batched)
+#define rocblas_ssymv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssymv_strided_batched)
+#define rocblas_ssyr HIPBLAS_LAZY_ROCBLAS(rocblas_ssyr)
+#define rocblas_ssyr2 HIPBLAS_LAZY_ROCBLAS(rocblas_ssyr2)
+#define rocblas_ssyr2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssyr2_batched)
+#define rocblas_ssyr2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssyr2_strided_batched)
+#define rocblas_ssyr2k HIPBLAS_LAZY_ROCBLAS(rocblas_ssyr2k)
+#define rocblas_ssyr2k_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssyr2k_batched)
+#define rocblas_ssyr2k_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssyr2k_strided_batched)
+#define rocblas_ssyr_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssyr_batched)
+#define rocblas_ssyr_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssyr_strided_batched)
+#define rocblas_ssyrk HIPBLAS_LAZY_ROCBLAS(rocblas_ssyrk)
+#define rocblas_ssyrk_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssyrk_batched)
+#define rocblas_ssyrk_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssyrk_strided_batched)
+#define rocblas_ssyrkx HIPBLAS_LAZY_ROCBLAS(rocblas_ssyrkx)
+#define rocblas_ssyrkx_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssyrkx_batched)
+#define rocblas_ssyrkx_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ssyrkx_strided_batched)
+#define rocblas_start_device_memory_size_query \
+    HIPBLAS_LAZY_ROCBLAS(rocblas_start_device_memory_size_query)
+#define rocblas_stbmv HIPBLAS_LAZY_ROCBLAS(rocblas_stbmv)
+#define rocblas_stbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_stbmv_batched)
+#define rocblas_stbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_stbmv_strided_batched)
+#define rocblas_stbsv HIPBLAS_LAZY_ROCBLAS(rocblas_stbsv)
+#define rocblas_stbsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_stbsv_batched)
+#define rocblas_stbsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_stbsv_strided_batched)
+#define rocblas_stop_device_memory_size_query \
+    HIPBLAS_LAZY_ROCBLAS(rocblas_stop_device_memory_size_query)
+#define rocblas_stpmv HIPBLAS_LAZY_ROCBLAS(rocblas_stpmv)
+#define rocblas_stpmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_stpmv_batched)
+#define rocblas_stpmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_stpmv_strided_batched)
+#define rocblas_stpsv HIPBLAS_LAZY_ROCBLAS(rocblas_stpsv)
+#define rocblas_stpsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_stpsv_batched)
+#define rocblas_stpsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_stpsv_strided_batched)
+#define rocblas_strmm HIPBLAS_LAZY_ROCBLAS(rocblas_strmm)
+#define rocblas_strmm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_strmm_batched)
+#define rocblas_strmm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_strmm_strided_batched)
+#define rocblas_strmv HIPBLAS_LAZY_ROCBLAS(rocblas_strmv)
+#define rocblas_strmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_strmv_batched)
+#define rocblas_strmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_strmv_strided_batched)
+#define rocblas_strsm HIPBLAS_LAZY_ROCBLAS(rocblas_strsm)
+#define rocblas_strsm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_strsm_batched)
+#define rocblas_strsm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_strsm_strided_batched)
+#define rocblas_strsv HIPBLAS_LAZY_ROCBLAS(rocblas_strsv)
+#define rocblas_strsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_strsv_batched)
+#define rocblas_strsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_strsv_strided_batched)
+#define rocblas_strtri HIPBLAS_LAZY_ROCBLAS(rocblas_strtri)
+#define rocblas_strtri_batched HIPBLAS_LAZY_ROCBLAS(rocblas_strtri_batched)
+#define rocblas_strtri_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_strtri_strided_batched)
+#define rocblas_trsm_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_trsm_batched_ex)
+#define rocblas_trsm_ex HIPBLAS_LAZY_ROCBLAS(rocblas_trsm_ex)
+#define rocblas_trsm_strided_batched_ex HIPBLAS_LAZY_ROCBLAS(rocblas_trsm_strided_batched_ex)
+#define rocblas_tssgemv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_tssgemv_batched)
+#define rocblas_tssgemv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_tssgemv_strided_batched)
+#define rocblas_tstgemv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_tstgemv_batched)
+#define rocblas_tstgemv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_tstgemv_strided_batched)
+#define rocblas_zaxpy HIPBLAS_LAZY_ROCBLAS(rocblas_zaxpy)
+#define rocblas_zaxpy_64 HIPBLAS_LAZY_ROCBLAS(rocblas_zaxpy_64)
+#define rocblas_zaxpy_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zaxpy_batched)
+#define rocblas_zaxpy_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zaxpy_strided_batched)
+#define rocblas_zcopy HIPBLAS_LAZY_ROCBLAS(rocblas_zcopy)
+#define rocblas_zcopy_64 HIPBLAS_LAZY_ROCBLAS(rocblas_zcopy_64)
+#define rocblas_zcopy_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zcopy_batched)
+#define rocblas_zcopy_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zcopy_strided_batched)
+#define rocblas_zdgmm HIPBLAS_LAZY_ROCBLAS(rocblas_zdgmm)
+#define rocblas_zdgmm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zdgmm_batched)
+#define rocblas_zdgmm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zdgmm_strided_batched)
+#define rocblas_zdotc HIPBLAS_LAZY_ROCBLAS(rocblas_zdotc)
+#define rocblas_zdotc_64 HIPBLAS_LAZY_ROCBLAS(rocblas_zdotc_64)
+#define rocblas_zdotc_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zdotc_batched)
+#define rocblas_zdotc_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zdotc_strided_batched)
+#define rocblas_zdotu HIPBLAS_LAZY_ROCBLAS(rocblas_zdotu)
+#define rocblas_zdotu_64 HIPBLAS_LAZY_ROCBLAS(rocblas_zdotu_64)
+#define rocblas_zdotu_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zdotu_batched)
+#define rocblas_zdotu_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zdotu_strided_batched)
+#define rocblas_zdrot HIPBLAS_LAZY_ROCBLAS(rocblas_zdrot)
+#define rocblas_zdrot_64 HIPBLAS_LAZY_ROCBLAS(rocblas_zdrot_64)
+#define rocblas_zdrot_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zdrot_batched)
+#define rocblas_zdrot_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zdrot_strided_batched)
+#define rocblas_zdscal HIPBLAS_LAZY_ROCBLAS(rocblas_zdscal)
+#define rocblas_zdscal_64 HIPBLAS_LAZY_ROCBLAS(rocblas_zdscal_64)
+#define rocblas_zdscal_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zdscal_batched)
+#define rocblas_zdscal_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zdscal_strided_batched)
+#define rocblas_zgbmv HIPBLAS_LAZY_ROCBLAS(rocblas_zgbmv)
+#define rocblas_zgbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgbmv_batched)
+#define rocblas_zgbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgbmv_strided_batched)
+#define rocblas_zgeam HIPBLAS_LAZY_ROCBLAS(rocblas_zgeam)
+#define rocblas_zgeam_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgeam_batched)
+#define rocblas_zgeam_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgeam_strided_batched)
+#define rocblas_zgemm HIPBLAS_LAZY_ROCBLAS(rocblas_zgemm)
+#define rocblas_zgemm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgemm_batched)
+#define rocblas_zgemm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgemm_strided_batched)
+#define rocblas_zgemv HIPBLAS_LAZY_ROCBLAS(rocblas_zgemv)
+#define rocblas_zgemv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgemv_batched)
+#define rocblas_zgemv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgemv_strided_batched)
+#define rocblas_zgerc HIPBLAS_LAZY_ROCBLAS(rocblas_zgerc)
+#define rocblas_zgerc_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgerc_batched)
+#define rocblas_zgerc_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgerc_strided_batched)
+#define rocblas_zgeru HIPBLAS_LAZY_ROCBLAS(rocblas_zgeru)
+#define rocblas_zgeru_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgeru_batched)
+#define rocblas_zgeru_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zgeru_strided_batched)
+#define rocblas_zhbmv HIPBLAS_LAZY_ROCBLAS(rocblas_zhbmv)
+#define rocblas_zhbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhbmv_batched)
+#define rocblas_zhbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhbmv_strided_batched)
+#define rocblas_zhemm HIPBLAS_LAZY_ROCBLAS(rocblas_zhemm)
+#define rocblas_zhemm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhemm_batched)
+#define rocblas_zhemm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhemm_strided_batched)
+#define rocblas_zhemv HIPBLAS_LAZY_ROCBLAS(rocblas_zhemv)
+#define rocblas_zhemv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhemv_batched)
+#define rocblas_zhemv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhemv_strided_batched)
+#define rocblas_zher HIPBLAS_LAZY_ROCBLAS(rocblas_zher)
+#define rocblas_zher2 HIPBLAS_LAZY_ROCBLAS(rocblas_zher2)
+#define rocblas_zher2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zher2_batched)
+#define rocblas_zher2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zher2_strided_batched)
+#define rocblas_zher2k HIPBLAS_LAZY_ROCBLAS(rocblas_zher2k)
+#define rocblas_zher2k_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zher2k_batched)
+#define rocblas_zher2k_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zher2k_strided_batched)
+#define rocblas_zher_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zher_batched)
+#define rocblas_zher_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zher_strided_batched)
+#define rocblas_zherk HIPBLAS_LAZY_ROCBLAS(rocblas_zherk)
+#define rocblas_zherk_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zherk_batched)
+#define rocblas_zherk_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zherk_strided_batched)
+#define rocblas_zherkx HIPBLAS_LAZY_ROCBLAS(rocblas_zherkx)
+#define rocblas_zherkx_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zherkx_batched)
+#define rocblas_zherkx_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zherkx_strided_batched)
+#define rocblas_zhpmv HIPBLAS_LAZY_ROCBLAS(rocblas_zhpmv)
+#define rocblas_zhpmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhpmv_batched)
+#define rocblas_zhpmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhpmv_strided_batched)
+#define rocblas_zhpr HIPBLAS_LAZY_ROCBLAS(rocblas_zhpr)
+#define rocblas_zhpr2 HIPBLAS_LAZY_ROCBLAS(rocblas_zhpr2)
+#define rocblas_zhpr2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhpr2_batched)
+#define rocblas_zhpr2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhpr2_strided_batched)
+#define rocblas_zhpr_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhpr_batched)
+#define rocblas_zhpr_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zhpr_strided_batched)
+#define rocblas_zrot HIPBLAS_LAZY_ROCBLAS(rocblas_zrot)
+#define rocblas_zrot_64 HIPBLAS_LAZY_ROCBLAS(rocblas_zrot_64)
+#define rocblas_zrot_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zrot_batched)
+#define rocblas_zrot_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zrot_strided_batched)
+#define rocblas_zrotg HIPBLAS_LAZY_ROCBLAS(rocblas_zrotg)
+#define rocblas_zrotg_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zrotg_batched)
+#define rocblas_zrotg_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zrotg_strided_batched)
+#define rocblas_zscal HIPBLAS_LAZY_ROCBLAS(rocblas_zscal)
+#define rocblas_zscal_64 HIPBLAS_LAZY_ROCBLAS(rocblas_zscal_64)
+#define rocblas_zscal_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zscal_batched)
+#define rocblas_zscal_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zscal_strided_batched)
+#define rocblas_zspr HIPBLAS_LAZY_ROCBLAS(rocblas_zspr)
+#define rocblas_zspr_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zspr_batched)
+#define rocblas_zspr_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zspr_strided_batched)
+#define rocblas_zswap HIPBLAS_LAZY_ROCBLAS(rocblas_zswap)
+#define rocblas_zswap_64 HIPBLAS_LAZY_ROCBLAS(rocblas_zswap_64)
+#define rocblas_zswap_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zswap_batched)
+#define rocblas_zswap_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zswap_strided_batched)
+#define rocblas_zsymm HIPBLAS_LAZY_ROCBLAS(rocblas_zsymm)
+#define rocblas_zsymm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsymm_batched)
+#define rocblas_zsymm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsymm_strided_batched)
+#define rocblas_zsymv HIPBLAS_LAZY_ROCBLAS(rocblas_zsymv)
+#define rocblas_zsymv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsymv_batched)
+#define rocblas_zsymv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsymv_strided_batched)
+#define rocblas_zsyr HIPBLAS_LAZY_ROCBLAS(rocblas_zsyr)
+#define rocblas_zsyr2 HIPBLAS_LAZY_ROCBLAS(rocblas_zsyr2)
+#define rocblas_zsyr2_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsyr2_batched)
+#define rocblas_zsyr2_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsyr2_strided_batched)
+#define rocblas_zsyr2k HIPBLAS_LAZY_ROCBLAS(rocblas_zsyr2k)
+#define rocblas_zsyr2k_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsyr2k_batched)
+#define rocblas_zsyr2k_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsyr2k_strided_batched)
+#define rocblas_zsyr_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsyr_batched)
+#define rocblas_zsyr_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsyr_strided_batched)
+#define rocblas_zsyrk HIPBLAS_LAZY_ROCBLAS(rocblas_zsyrk)
+#define rocblas_zsyrk_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsyrk_batched)
+#define rocblas_zsyrk_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsyrk_strided_batched)
+#define rocblas_zsyrkx HIPBLAS_LAZY_ROCBLAS(rocblas_zsyrkx)
+#define rocblas_zsyrkx_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsyrkx_batched)
+#define rocblas_zsyrkx_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_zsyrkx_strided_batched)
+#define rocblas_ztbmv HIPBLAS_LAZY_ROCBLAS(rocblas_ztbmv)
+#define rocblas_ztbmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztbmv_batched)
+#define rocblas_ztbmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztbmv_strided_batched)
+#define rocblas_ztbsv HIPBLAS_LAZY_ROCBLAS(rocblas_ztbsv)
+#define rocblas_ztbsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztbsv_batched)
+#define rocblas_ztbsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztbsv_strided_batched)
+#define rocblas_ztpmv HIPBLAS_LAZY_ROCBLAS(rocblas_ztpmv)
+#define rocblas_ztpmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztpmv_batched)
+#define rocblas_ztpmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztpmv_strided_batched)
+#define rocblas_ztpsv HIPBLAS_LAZY_ROCBLAS(rocblas_ztpsv)
+#define rocblas_ztpsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztpsv_batched)
+#define rocblas_ztpsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztpsv_strided_batched)
+#define rocblas_ztrmm HIPBLAS_LAZY_ROCBLAS(rocblas_ztrmm)
+#define rocblas_ztrmm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztrmm_batched)
+#define rocblas_ztrmm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztrmm_strided_batched)
+#define rocblas_ztrmv HIPBLAS_LAZY_ROCBLAS(rocblas_ztrmv)
+#define rocblas_ztrmv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztrmv_batched)
+#define rocblas_ztrmv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztrmv_strided_batched)
+#define rocblas_ztrsm HIPBLAS_LAZY_ROCBLAS(rocblas_ztrsm)
+#define rocblas_ztrsm_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztrsm_batched)
+#define rocblas_ztrsm_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztrsm_strided_batched)
+#define rocblas_ztrsv HIPBLAS_LAZY_ROCBLAS(rocblas_ztrsv)
+#define rocblas_ztrsv_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztrsv_batched)
+#define rocblas_ztrsv_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztrsv_strided_batched)
+#define rocblas_ztrtri HIPBLAS_LAZY_ROCBLAS(rocblas_ztrtri)
+#define rocblas_ztrtri_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztrtri_batched)
+#define rocblas_ztrtri_strided_batched HIPBLAS_LAZY_ROCBLAS(rocblas_ztrtri_strided_batched)
+
+// rocSOLVER
+#define rocsolver_cgels HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgels)
+#define rocsolver_cgels_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgels_batched)
+#define rocsolver_cgels_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgels_strided_batched)
+#define rocsolver_cgeqrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgeqrf)
+#define rocsolver_cgeqrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgeqrf_strided_batched)
+#define rocsolver_cgesv_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgesv_batched)
+#define rocsolver_cgesv_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgesv_strided_batched)
+#define rocsolver_cgesvdj_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgesvdj_batched)
+#define rocsolver_cgesvdj_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgesvdj_strided_batched)
+#define rocsolver_cgetrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetrf)
+#define rocsolver_cgetrf_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetrf_batched)
+#define rocsolver_cgetrf_npvt HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetrf_npvt)
+#define rocsolver_cgetrf_npvt_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetrf_npvt_batched)
+#define rocsolver_cgetrf_npvt_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetrf_npvt_strided_batched)
+#define rocsolver_cgetrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetrf_strided_batched)
+#define rocsolver_cgetri_npvt_outofplace_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetri_npvt_outofplace_batched)
+#define rocsolver_cgetri_npvt_outofplace_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetri_npvt_outofplace_strided_batched)
+#define rocsolver_cgetri_outofplace_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetri_outofplace_batched)
+#define rocsolver_cgetri_outofplace_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetri_outofplace_strided_batched)
+#define rocsolver_cgetrs HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetrs)
+#define rocsolver_cgetrs_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetrs_batched)
+#define rocsolver_cgetrs_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cgetrs_strided_batched)
+#define rocsolver_cheevj_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cheevj_batched)
+#define rocsolver_cheevj_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cheevj_strided_batched)
+#define rocsolver_cpotrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_cpotrf)
+#define rocsolver_cpotrf_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cpotrf_batched)
+#define rocsolver_cpotrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cpotrf_strided_batched)
+#define rocsolver_cpotri HIPBLAS_LAZY_ROCSOLVER(rocsolver_cpotri)
+#define rocsolver_cpotri_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cpotri_batched)
+#define rocsolver_cpotri_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cpotri_strided_batched)
+#define rocsolver_cpotrs HIPBLAS_LAZY_ROCSOLVER(rocsolver_cpotrs)
+#define rocsolver_cpotrs_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cpotrs_batched)
+#define rocsolver_cpotrs_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_cpotrs_strided_batched)
+#define rocsolver_cunmqr HIPBLAS_LAZY_ROCSOLVER(rocsolver_cunmqr)
+#define rocsolver_dgels HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgels)
+#define rocsolver_dgels_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgels_batched)
+#define rocsolver_dgels_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgels_strided_batched)
+#define rocsolver_dgeqrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgeqrf)
+#define rocsolver_dgeqrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgeqrf_strided_batched)
+#define rocsolver_dgesv_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgesv_batched)
+#define rocsolver_dgesv_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgesv_strided_batched)
+#define rocsolver_dgesvdj_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgesvdj_batched)
+#define rocsolver_dgesvdj_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgesvdj_strided_batched)
+#define rocsolver_dgetrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetrf)
+#define rocsolver_dgetrf_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetrf_batched)
+#define rocsolver_dgetrf_npvt HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetrf_npvt)
+#define rocsolver_dgetrf_npvt_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetrf_npvt_batched)
+#define rocsolver_dgetrf_npvt_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetrf_npvt_strided_batched)
+#define rocsolver_dgetrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetrf_strided_batched)
+#define rocsolver_dgetri_npvt_outofplace_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetri_npvt_outofplace_batched)
+#define rocsolver_dgetri_npvt_outofplace_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetri_npvt_outofplace_strided_batched)
+#define rocsolver_dgetri_outofplace_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetri_outofplace_batched)
+#define rocsolver_dgetri_outofplace_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetri_outofplace_strided_batched)
+#define rocsolver_dgetrs HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetrs)
+#define rocsolver_dgetrs_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetrs_batched)
+#define rocsolver_dgetrs_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dgetrs_strided_batched)
+#define rocsolver_dormqr HIPBLAS_LAZY_ROCSOLVER(rocsolver_dormqr)
+#define rocsolver_dpotrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_dpotrf)
+#define rocsolver_dpotrf_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dpotrf_batched)
+#define rocsolver_dpotrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dpotrf_strided_batched)
+#define rocsolver_dpotri HIPBLAS_LAZY_ROCSOLVER(rocsolver_dpotri)
+#define rocsolver_dpotri_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dpotri_batched)
+#define rocsolver_dpotri_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dpotri_strided_batched)
+#define rocsolver_dpotrs HIPBLAS_LAZY_ROCSOLVER(rocsolver_dpotrs)
+#define rocsolver_dpotrs_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dpotrs_batched)
+#define rocsolver_dpotrs_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dpotrs_strided_batched)
+#define rocsolver_dsyevj_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dsyevj_batched)
+#define rocsolver_dsyevj_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_dsyevj_strided_batched)
+#define rocsolver_sgels HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgels)
+#define rocsolver_sgels_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgels_batched)
+#define rocsolver_sgels_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgels_strided_batched)
+#define rocsolver_sgeqrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgeqrf)
+#define rocsolver_sgeqrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgeqrf_strided_batched)
+#define rocsolver_sgesv_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgesv_batched)
+#define rocsolver_sgesv_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgesv_strided_batched)
+#define rocsolver_sgesvdj_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgesvdj_batched)
+#define rocsolver_sgesvdj_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgesvdj_strided_batched)
+#define rocsolver_sgetrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetrf)
+#define rocsolver_sgetrf_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetrf_batched)
+#define rocsolver_sgetrf_npvt HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetrf_npvt)
+#define rocsolver_sgetrf_npvt_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetrf_npvt_batched)
+#define rocsolver_sgetrf_npvt_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetrf_npvt_strided_batched)
+#define rocsolver_sgetrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetrf_strided_batched)
+#define rocsolver_sgetri_npvt_outofplace_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetri_npvt_outofplace_batched)
+#define rocsolver_sgetri_npvt_outofplace_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetri_npvt_outofplace_strided_batched)
+#define rocsolver_sgetri_outofplace_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetri_outofplace_batched)
+#define rocsolver_sgetri_outofplace_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetri_outofplace_strided_batched)
+#define rocsolver_sgetrs HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetrs)
+#define rocsolver_sgetrs_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetrs_batched)
+#define rocsolver_sgetrs_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_sgetrs_strided_batched)
+#define rocsolver_sormqr HIPBLAS_LAZY_ROCSOLVER(rocsolver_sormqr)
+#define rocsolver_spotrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_spotrf)
+#define rocsolver_spotrf_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_spotrf_batched)
+#define rocsolver_spotrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_spotrf_strided_batched)
+#define rocsolver_spotri HIPBLAS_LAZY_ROCSOLVER(rocsolver_spotri)
+#define rocsolver_spotri_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_spotri_batched)
+#define rocsolver_spotri_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_spotri_strided_batched)
+#define rocsolver_spotrs HIPBLAS_LAZY_ROCSOLVER(rocsolver_spotrs)
+#define rocsolver_spotrs_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_spotrs_batched)
+#define rocsolver_spotrs_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_spotrs_strided_batched)
+#define rocsolver_ssyevj_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_ssyevj_batched)
+#define rocsolver_ssyevj_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_ssyevj_strided_batched)
+#define rocsolver_zgels HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgels)
+#define rocsolver_zgels_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgels_batched)
+#define rocsolver_zgels_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgels_strided_batched)
+#define rocsolver_zgeqrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgeqrf)
+#define rocsolver_zgeqrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgeqrf_strided_batched)
+#define rocsolver_zgesv_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgesv_batched)
+#define rocsolver_zgesv_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgesv_strided_batched)
+#define rocsolver_zgesvdj_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgesvdj_batched)
+#define rocsolver_zgesvdj_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgesvdj_strided_batched)
+#define rocsolver_zgetrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetrf)
+#define rocsolver_zgetrf_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetrf_batched)
+#define rocsolver_zgetrf_npvt HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetrf_npvt)
+#define rocsolver_zgetrf_npvt_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetrf_npvt_batched)
+#define rocsolver_zgetrf_npvt_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetrf_npvt_strided_batched)
+#define rocsolver_zgetrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetrf_strided_batched)
+#define rocsolver_zgetri_npvt_outofplace_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetri_npvt_outofplace_batched)
+#define rocsolver_zgetri_npvt_outofplace_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetri_npvt_outofplace_strided_batched)
+#define rocsolver_zgetri_outofplace_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetri_outofplace_batched)
+#define rocsolver_zgetri_outofplace_strided_batched \
+    HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetri_outofplace_strided_batched)
+#define rocsolver_zgetrs HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetrs)
+#define rocsolver_zgetrs_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetrs_batched)
+#define rocsolver_zgetrs_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zgetrs_strided_batched)
+#define rocsolver_zheevj_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zheevj_batched)
+#define rocsolver_zheevj_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zheevj_strided_batched)
+#define rocsolver_zpotrf HIPBLAS_LAZY_ROCSOLVER(rocsolver_zpotrf)
+#define rocsolver_zpotrf_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zpotrf_batched)
+#define rocsolver_zpotrf_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zpotrf_strided_batched)
+#define rocsolver_zpotri HIPBLAS_LAZY_ROCSOLVER(rocsolver_zpotri)
+#define rocsolver_zpotri_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zpotri_batched)
+#define rocsolver_zpotri_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zpotri_strided_batched)
+#define rocsolver_zpotrs HIPBLAS_LAZY_ROCSOLVER(rocsolver_zpotrs)
+#define rocsolver_zpotrs_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zpotrs_batched)
+#define rocsolver_zpotrs_strided_batched HIPBLAS_LAZY_ROCSOLVER(rocsolver_zpotrs_strided_batched)
+#define rocsolver_zunmqr HIPBLAS_LAZY_ROCSOLVER(rocsolver_zunmqr)
+
+#endif // HIPBLAS_LAZY_LOADING
@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Kernels of the fp16 and bf16 forms of hipblasCopyEx, hipblasSwapEx, hipblasAsumEx,
+// hipblasIamaxEx and hipblasIaminEx and their batched forms, and of all the forms of
+// hipblasNormalizeEx and of the batched hipblasIamaxValue and hipblasIaminValue functions. Copies
+// and swaps move the 16-bit elements unchanged, with one thread per element, and the reductions
+// run one work group per vector in float. Results are written to the device array result in device pointer mode without
+// waiting for the stream; in host pointer mode they go through a device allocation and the call
+// waits for them, as the backend does for a host result.
+//
+// Only built with BUILD_WITH_LEVEL1_EX (HIPBLAS_LEVEL1_EX). x_type is HIP_R_16F or HIP_R_16BF,
+// x_b is x_array[b] when x_array is not null and x + b * stride_x otherwise, and likewise for y_b.
+// The arguments are checked by the callers; vectors with negative increments run from their last
+// element.
+
+// y_b := x_b for b = 0, ..., batch_count - 1, or swaps x_b and y_b when swap is set
+hipblasStatus_t hipblasLevel1ExCopyKernels(hipblasHandle_t    handle,
+                                           bool               swap,
+                                           int                n,
+                                           const void*        x,
+                                           const void* const* x_array,
+                                           int                incx,
+                                           hipblasStride      stride_x,
+                                           void*              y,
+                                           void* const*       y_array,
+                                           int                incy,
+                                           hipblasStride      stride_y,
+                                           int                batch_count);
+
+// result[b] := sum_i |x_b[i]|, stored as result_type, HIP_R_32F or x_type. The sums of empty
+// vectors are 0, and x may then be null.
+hipblasStatus_t hipblasLevel1ExAsumKernels(hipblasHandle_t    handle,
+                                           int                n,
+                                           const void*        x,
+                                           const void* const* x_array,
+                                           hipDataType        x_type,
+                                           int                incx,
+                                           hipblasStride      stride_x,
+                                           int                batch_count,
+                                           void*              result,
+                                           hipDataType        result_type);
+
+// result[b] := the 1-based index of the first element of largest magnitude of x_b, or smallest
+// when amin is set, and 0 for empty vectors. When value is not null, value[b] := that element of
+// x_b, or its magnitude when absolute is set, and 0 for empty vectors, stored as x_type and read
+// back with result in host pointer mode. x_type may also be HIP_R_32F or HIP_R_64F, compared in
+// their own type.
+hipblasStatus_t hipblasLevel1ExIamaxKernels(hipblasHandle_t    handle,
+                                            bool               amin,
+                                            int                n,
+                                            const void*        x,
+                                            const void* const* x_array,
+                                            hipDataType        x_type,
+                                            int                incx,
+                                            hipblasStride      stride_x,
+                                            int                batch_count,
+                                            int*               result,
+                                            void*              value    = nullptr,
+                                            bool               absolute = false);
+
+// result[b] := ||x_b||_2 and x_b := x_b / max(result[b], epsilon), in one pass over x_b with the
+// sum of squares computed in float, or in double for HIP_R_64F. x_type may also be HIP_R_32F or
+// HIP_R_64F, and result_type is then x_type. epsilon holds a value of the compute type, read as
+// result is, and x_b is left unchanged when both its norm and epsilon are 0. result may be null,
+// and the call then does not wait for the stream.
+hipblasStatus_t hipblasLevel1ExNormalizeKernels(hipblasHandle_t handle,
+                                                int             n,
+                                                void*           x,
+                                                void* const*    x_array,
+                                                hipDataType     x_type,
+                                                int             incx,
+                                                hipblasStride   stride_x,
+                                                int             batch_count,
+                                                const void*     epsilon,
+                                                void*           result,
+                                                hipDataType     result_type);
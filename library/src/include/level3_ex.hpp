@@ -0,0 +1,77 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Triangle kernels behind the fp16 and bf16 forms of hipblasSyrkEx, hipblasSyr2kEx, hipblasTrmmEx
+// and hipblasSymmEx, which run as hipblasGemmEx calls on blocks of their operands: one copies the
+// lower or upper triangle of a matrix, with the other triangle left alone, copied, zeroed
+// or the mirror of the triangle, and one offsets the pointers of a batched operand to a block.
+//
+// Only built with BUILD_WITH_LEVEL3_EX (HIPBLAS_LEVEL3_EX). The element types are HIP_R_16F,
+// HIP_R_16BF, HIP_R_32F and HIP_R_64F; others return HIPBLAS_STATUS_NOT_SUPPORTED. The arguments
+// are checked by the callers, and the calls do not wait for the stream.
+
+// What hipblasTriangleKernels writes to the triangle of Y other than uplo
+enum class hipblasTriangleFill
+{
+    keep, // nothing
+    copy, // the same elements of X
+    zero, // zeros
+    mirror, // the transpose of the uplo triangle of X
+};
+
+// Y_b := the m by n matrix X_b, within the uplo triangle (i <= j or i >= j) and as fill outside
+// it, for b = 0, ..., batch_count - 1, where X_b is X_array[b] + offset_X when X_array is not null
+// and X + b * stride_X + offset_X otherwise, and likewise for Y_b. With unit_diag the diagonal of
+// Y is one rather than that of X. The offsets and strides are in elements.
+hipblasStatus_t hipblasTriangleKernels(hipStream_t         stream,
+                                       hipDataType         type,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasTriangleFill fill,
+                                       bool                unit_diag,
+                                       int                 m,
+                                       int                 n,
+                                       const void*         X,
+                                       const void* const*  X_array,
+                                       size_t              offset_X,
+                                       int                 ldx,
+                                       hipblasStride       stride_X,
+                                       void*               Y,
+                                       void* const*        Y_array,
+                                       size_t              offset_Y,
+                                       int                 ldy,
+                                       hipblasStride       stride_Y,
+                                       int                 batch_count);
+
+// out[b] := in[b] + offset_bytes when in is not null and base + b * stride_bytes + offset_bytes
+// otherwise, for b = 0, ..., batch_count - 1, with out in device memory
+hipblasStatus_t hipblasOffsetPointersKernel(hipStream_t        stream,
+                                            const void* const* in,
+                                            const void*        base,
+                                            size_t             stride_bytes,
+                                            size_t             offset_bytes,
+                                            void**             out,
+                                            int                batch_count);
@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// getrs without pivoting, run by the getrs functions of both backends when ipiv is null. Solves
+// op(A) X = B with the L and U factors left in A by a getrf without pivoting, as two triangular
+// solves. A_array and B_array are the device pointer arrays of the batched form and null
+// otherwise, and strided selects the strided batched form. Checks the arguments like getrs,
+// setting info to minus the position of the first invalid one in the form that is called.
+hipblasStatus_t hipblasGetrsNoPivot(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    int                n,
+                                    int                nrhs,
+                                    float*             A,
+                                    float* const*      A_array,
+                                    int                lda,
+                                    hipblasStride      strideA,
+                                    float*             B,
+                                    float* const*      B_array,
+                                    int                ldb,
+                                    hipblasStride      strideB,
+                                    int*               info,
+                                    int                batch_count,
+                                    bool               strided);
+
+hipblasStatus_t hipblasGetrsNoPivot(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    int                n,
+                                    int                nrhs,
+                                    double*            A,
+                                    double* const*     A_array,
+                                    int                lda,
+                                    hipblasStride      strideA,
+                                    double*            B,
+                                    double* const*     B_array,
+                                    int                ldb,
+                                    hipblasStride      strideB,
+                                    int*               info,
+                                    int                batch_count,
+                                    bool               strided);
+
+hipblasStatus_t hipblasGetrsNoPivot(hipblasHandle_t        handle,
+                                    hipblasOperation_t     trans,
+                                    int                    n,
+                                    int                    nrhs,
+                                    hipblasComplex*        A,
+                                    hipblasComplex* const* A_array,
+                                    int                    lda,
+                                    hipblasStride          strideA,
+                                    hipblasComplex*        B,
+                                    hipblasComplex* const* B_array,
+                                    int                    ldb,
+                                    hipblasStride          strideB,
+                                    int*                   info,
+                                    int                    batch_count,
+                                    bool                   strided);
+
+hipblasStatus_t hipblasGetrsNoPivot(hipblasHandle_t              handle,
+                                    hipblasOperation_t           trans,
+                                    int                          n,
+                                    int                          nrhs,
+                                    hipblasDoubleComplex*        A,
+                                    hipblasDoubleComplex* const* A_array,
+                                    int                          lda,
+                                    hipblasStride                strideA,
+                                    hipblasDoubleComplex*        B,
+                                    hipblasDoubleComplex* const* B_array,
+                                    int                          ldb,
+                                    hipblasStride                strideB,
+                                    int*                         info,
+                                    int                          batch_count,
+                                    bool                         strided);
@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstddef>
+#include <cstdlib>
+#include <initializer_list>
+
+// Prefetch of the managed operands of the calls on a handle, set with hipblasSetManagedPrefetch
+
+// Forget the prefetch mode of handle
+void hipblasManagedPrefetchErase(hipblasHandle_t handle);
+
+// Bytes spanned by a vector, or by the batches of a matrix with a stride between them
+inline size_t hipblasManagedVectorBytes(size_t elem, int n, int inc)
+{
+    return n > 0 ? elem * (1 + size_t(n - 1) * std::abs(inc)) : 0;
+}
+
+inline size_t hipblasManagedMatrixBytes(
+    size_t elem, int rows, int cols, int ld, hipblasStride stride, int batch_count)
+{
+    if(rows <= 0 || cols <= 0 || batch_count <= 0)
+        return 0;
+    size_t matrix = size_t(cols - 1) * ld + rows;
+    return elem * (matrix + size_t(batch_count - 1) * size_t(stride < 0 ? 0 : stride));
+}
+
+// Placed in an entry point once its arguments are column-major. Prefetches the managed inputs
+// to the current device on the stream of handle when the prefetch mode of handle asks for it,
+// and, with HIPBLAS_MANAGED_PREFETCH_INPUTS_OUTPUTS, the managed output back to the host when
+// the entry point returns. Only the outermost entry point of a call prefetches, and nothing is
+// prefetched while the stream is being captured.
+class hipblasManagedPrefetch
+{
+public:
+    struct range
+    {
+        const void* ptr;
+        size_t      bytes;
+    };
+
+    hipblasManagedPrefetch(hipblasHandle_t handle, std::initializer_list<range> inputs);
+    ~hipblasManagedPrefetch();
+
+    hipblasManagedPrefetch(const hipblasManagedPrefetch&) = delete;
+    hipblasManagedPrefetch& operator=(const hipblasManagedPrefetch&) = delete;
+
+private:
+    hipStream_t stream = nullptr;
+    range       output = {nullptr, 0};
+};
+
+// The output is the last input of each, C or y
+template <typename T>
+inline hipblasManagedPrefetch hipblasManagedPrefetchGemm(hipblasHandle_t    handle,
+                                                         hipblasOperation_t transa,
+                                                         hipblasOperation_t transb,
+                                                         int                m,
+                                                         int                n,
+                                                         int                k,
+                                                         const T*           A,
+                                                         int                lda,
+                                                         hipblasStride      stride_a,
+                                                         const T*           B,
+                                                         int                ldb,
+                                                         hipblasStride      stride_b,
+                                                         T*                 C,
+                                                         int                ldc,
+                                                         hipblasStride      stride_c,
+                                                         int                batch_count = 1)
+{
+    bool a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+    return hipblasManagedPrefetch(
+        handle,
+        {{A,
+          hipblasManagedMatrixBytes(
+              sizeof(T), a_n ? m : k, a_n ? k : m, lda, stride_a, k > 0 ? batch_count : 0)},
+         {B,
+          hipblasManagedMatrixBytes(
+              sizeof(T), b_n ? k : n, b_n ? n : k, ldb, stride_b, k > 0 ? batch_count : 0)},
+         {C, hipblasManagedMatrixBytes(sizeof(T), m, n, ldc, stride_c, batch_count)}});
+}
+
+template <typename T>
+inline hipblasManagedPrefetch hipblasManagedPrefetchGemv(hipblasHandle_t    handle,
+                                                         hipblasOperation_t trans,
+                                                         int                m,
+                                                         int                n,
+                                                         const T*           A,
+                                                         int                lda,
+                                                         const T*           x,
+                                                         int                incx,
+                                                         T*                 y,
+                                                         int                incy)
+{
+    bool op_n = trans == HIPBLAS_OP_N;
+    return hipblasManagedPrefetch(
+        handle,
+        {{A, hipblasManagedMatrixBytes(sizeof(T), m, n, lda, 0, 1)},
+         {x, hipblasManagedVectorBytes(sizeof(T), op_n ? n : m, incx)},
+         {y, hipblasManagedVectorBytes(sizeof(T), op_n ? m : n, incy)}});
+}
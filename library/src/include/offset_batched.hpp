@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Only built with BUILD_WITH_OFFSET_BATCHED (HIPBLAS_OFFSET_BATCHED). Largest m, n and k of the
+// gemm, and m and n of the gemv, that run one kernel reading the 32 bit offsets itself, with one
+// thread per element of the result. Larger problems and the complex types expand the offsets into
+// pointer arrays for the backend batched routines.
+constexpr int hipblas_offset_gemm_max_size = 16;
+constexpr int hipblas_offset_gemv_max_size = 256;
+
+// An operand of an offset batched call: entry i is at base + offsets[i] elements
+struct hipblasOffsetOperand
+{
+    const void*     base;
+    const uint32_t* offsets;
+};
+
+// Writes the pointers of the entries of the three operands, each element_size bytes, into
+// pointers, which holds 3 * batch_count pointers with those of operand j from j * batch_count.
+// An operand with a null base gets null pointers.
+hipblasStatus_t hipblasOffsetPointers(hipStream_t                stream,
+                                      const hipblasOffsetOperand operands[3],
+                                      size_t                     element_size,
+                                      int                        batch_count,
+                                      void**                     pointers);
+
+// gemm and gemv of every entry of a batch reading the offsets, for real problems within the sizes
+// above. alpha_device and beta_device are null in host pointer mode, where alpha_host and
+// beta_host hold the scalars. The arguments are checked by the callers.
+hipblasStatus_t hipblasOffsetGemmKernel(hipStream_t        stream,
+                                        hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const float*       alpha_device,
+                                        float              alpha_host,
+                                        const float*       A,
+                                        int                lda,
+                                        const uint32_t*    offsetsA,
+                                        const float*       B,
+                                        int                ldb,
+                                        const uint32_t*    offsetsB,
+                                        const float*       beta_device,
+                                        float              beta_host,
+                                        float*             C,
+                                        int                ldc,
+                                        const uint32_t*    offsetsC,
+                                        int                batch_count);
+
+hipblasStatus_t hipblasOffsetGemmKernel(hipStream_t        stream,
+                                        hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const double*      alpha_device,
+                                        double             alpha_host,
+                                        const double*      A,
+                                        int                lda,
+                                        const uint32_t*    offsetsA,
+                                        const double*      B,
+                                        int                ldb,
+                                        const uint32_t*    offsetsB,
+                                        const double*      beta_device,
+                                        double             beta_host,
+                                        double*            C,
+                                        int                ldc,
+                                        const uint32_t*    offsetsC,
+                                        int                batch_count);
+
+hipblasStatus_t hipblasOffsetGemvKernel(hipStream_t        stream,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const float*       alpha_device,
+                                        float              alpha_host,
+                                        const float*       A,
+                                        int                lda,
+                                        const uint32_t*    offsetsA,
+                                        const float*       x,
+                                        int                incx,
+                                        const uint32_t*    offsetsx,
+                                        const float*       beta_device,
+                                        float              beta_host,
+                                        float*             y,
+                                        int                incy,
+                                        const uint32_t*    offsetsy,
+                                        int                batch_count);
+
+hipblasStatus_t hipblasOffsetGemvKernel(hipStream_t        stream,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const double*      alpha_device,
+                                        double             alpha_host,
+                                        const double*      A,
+                                        int                lda,
+                                        const uint32_t*    offsetsA,
+                                        const double*      x,
+                                        int                incx,
+                                        const uint32_t*    offsetsx,
+                                        const double*      beta_device,
+                                        double             beta_host,
+                                        double*            y,
+                                        int                incy,
+                                        const uint32_t*    offsetsy,
+                                        int                batch_count);
@@ -0,0 +1,64 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Copies between full and packed or band storage behind hipblas?tpttr, hipblas?trttp,
+// hipblas?gbpack and hipblas?gbunpack and their batched forms. The stored part of every column
+// is contiguous in both storages, rows first to last of the full column:
+//   - upper packed, rows 0 to j at AP[j * (j + 1) / 2],
+//   - lower packed, rows j to n - 1 at AP[j * (2 * n - j + 1) / 2],
+//   - band, rows max(0, j - ku) to min(m - 1, j + kl) at AB[ku + first - j + j * ldab].
+// Only the stored elements of the destination are written.
+enum class hipblasPackedOp
+{
+    tpttr, // packed to full
+    trttp, // full to packed
+    gbpack, // full to band
+    gbunpack, // band to full
+};
+
+// Only built with BUILD_WITH_PACKED (HIPBLAS_PACKED). Each thread copies one element, so that
+// both the reads and the writes of a column are contiguous. The arguments are checked by the
+// callers; ld_src or ld_dst of the packed array is unused. src_b is src_array[b] when src_array
+// is not null and src + b * stride_src otherwise, and likewise for dst_b. element_size is 4, 8
+// or 16. The call does not wait for the stream.
+hipblasStatus_t hipblasPackedKernels(hipblasHandle_t    handle,
+                                     hipblasPackedOp    op,
+                                     bool               upper,
+                                     int                m,
+                                     int                n,
+                                     int                kl,
+                                     int                ku,
+                                     const void*        src,
+                                     const void* const* src_array,
+                                     int                ld_src,
+                                     hipblasStride      stride_src,
+                                     void*              dst,
+                                     void* const*       dst_array,
+                                     int                ld_dst,
+                                     hipblasStride      stride_dst,
+                                     int                batch_count,
+                                     size_t             element_size);
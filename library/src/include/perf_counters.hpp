@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Per-handle performance counters, set with hipblasSetPerfCounters. The outermost entry point of
+// a call on a handle with counters adds one call to its routine, with the logical flops and bytes
+// of hipblas-bench worked out from the size arguments, and in HIPBLAS_PERF_COUNTERS_TIMED every
+// sampleInterval-th call of a routine is timed with events on the handle stream. Samples are
+// collected once their events completed, without waiting for them.
+
+// Number of handles counting calls, so calls skip the lookup while there are none
+extern std::atomic<int> hipblas_perf_counter_handles;
+
+// Depth of nested counted calls on this thread
+extern thread_local int hipblas_perf_counter_depth;
+
+struct hipblasPerfCounterState;
+
+// Sizes of a call, read from its arguments by name
+struct hipblasPerfCounterSizes
+{
+    int64_t            m     = 0;
+    int64_t            n     = 0;
+    int64_t            k     = 0;
+    int64_t            kl    = 0;
+    int64_t            ku    = 0;
+    int64_t            nrhs  = 0;
+    int64_t            batch = 1;
+    hipblasOperation_t trans = HIPBLAS_OP_N;
+    hipblasSideMode_t  side  = HIPBLAS_SIDE_LEFT;
+    hipDataType        type  = HIP_R_32F; // of A or x, for the routines without a precision
+    bool               typed = false;
+};
+
+void hipblasPerfCounterSize(hipblasPerfCounterSizes& sizes, const std::string& name, int64_t value);
+
+void hipblasPerfCounterSize(hipblasPerfCounterSizes& sizes,
+                            const std::string&       name,
+                            hipblasSideMode_t        side);
+
+void hipblasPerfCounterSize(hipblasPerfCounterSizes& sizes,
+                            const std::string&       name,
+                            hipblasOperation_t       trans);
+
+void hipblasPerfCounterSize(hipblasPerfCounterSizes& sizes,
+                            const std::string&       name,
+                            hipDataType              type);
+
+// Other arguments do not size the call
+template <typename T>
+void hipblasPerfCounterSize(hipblasPerfCounterSizes& sizes, const std::string& name, const T& value)
+{
+    if constexpr(std::is_integral_v<T>)
+        hipblasPerfCounterSize(sizes, name, int64_t(value));
+}
+
+// Logical flops and bytes of a call, as the flops.hpp and bytes.hpp of the clients count them.
+// func is the name of the entry point; returns false, counting neither, for routines without a
+// formula.
+bool hipblasPerfCounterWork(const char*                    func,
+                            const hipblasPerfCounterSizes& sizes,
+                            double&                        flops,
+                            double&                        bytes);
+
+// The split argument list of HIPBLAS_LAYER, parsed once per entry point and thread
+const std::vector<std::string>& hipblasPerfCounterNames(const char* names);
+
+// Counters of handle, or nullptr when it does not count calls
+std::shared_ptr<hipblasPerfCounterState> hipblasPerfCounterFind(hipblasHandle_t handle);
+
+// Counts a call, returning the events timing it when it is sampled
+struct hipblasPerfCounterSample
+{
+    hipEvent_t  start   = nullptr;
+    hipEvent_t  stop    = nullptr;
+    hipStream_t stream  = nullptr;
+    size_t      routine = 0;
+};
+
+bool hipblasPerfCounterBegin(hipblasPerfCounterState&       state,
+                             hipblasHandle_t                handle,
+                             const char*                    func,
+                             const hipblasPerfCounterSizes& sizes,
+                             hipblasPerfCounterSample&      sample);
+
+void hipblasPerfCounterEnd(hipblasPerfCounterState& state, hipblasPerfCounterSample& sample);
+
+// Forget the counters of handle
+void hipblasPerfCountersErase(hipblasHandle_t handle);
+
+// Counts the enclosing entry point for as long as it is in scope
+class hipblasPerfCounterScope
+{
+    std::shared_ptr<hipblasPerfCounterState> state;
+    hipblasPerfCounterSample                 sample;
+    bool                                     counted = false;
+    bool                                     timed   = false;
+
+public:
+    template <typename... Ts>
+    hipblasPerfCounterScope(const char*     func,
+                            const char*     names,
+                            hipblasHandle_t handle,
+                            const Ts&... args)
+    {
+        if(!handle || !hipblas_perf_counter_handles.load(std::memory_order_relaxed))
+            return;
+
+        counted = true;
+        if(hipblas_perf_counter_depth++)
+            return;
+
+        // Counting must never make the call itself fail
+        try
+        {
+            state = hipblasPerfCounterFind(handle);
+            if(!state)
+                return;
+
+            // The first name is the handle argument
+            const std::vector<std::string>& arg_names = hipblasPerfCounterNames(names);
+            if(arg_names.size() != sizeof...(args) + 1)
+                return;
+
+            hipblasPerfCounterSizes sizes;
+            size_t                  i = 1;
+            (hipblasPerfCounterSize(sizes, arg_names[i++], args), ...);
+
+            timed = hipblasPerfCounterBegin(*state, handle, func, sizes, sample);
+        }
+        catch(...)
+        {
+            timed = false;
+        }
+    }
+
+    ~hipblasPerfCounterScope()
+    {
+        if(!counted)
+            return;
+        if(timed)
+            hipblasPerfCounterEnd(*state, sample);
+        hipblas_perf_counter_depth--;
+    }
+
+    hipblasPerfCounterScope(const hipblasPerfCounterScope&) = delete;
+    hipblasPerfCounterScope& operator=(const hipblasPerfCounterScope&) = delete;
+};
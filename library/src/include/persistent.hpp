@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+
+// Calls posted to a persistent kernel on handles in HIPBLAS_DEFERRED_MODE_PERSISTENT. The kernel
+// runs one work group on an internal stream of the handle and reads the descriptors of small
+// gemm, gemv, axpy and trsv calls from a ring in pinned host memory, so posting a call costs the
+// host a write to that memory instead of a launch. Only built with BUILD_WITH_PERSISTENT
+// (HIPBLAS_PERSISTENT).
+
+// Largest sizes of a posted call, which one work group runs in about a launch latency or less
+constexpr int hipblas_persistent_max_gemm = 64;
+constexpr int hipblas_persistent_max_gemv = 1024;
+constexpr int hipblas_persistent_max_axpy = 1 << 16;
+constexpr int hipblas_persistent_max_trsv = 256;
+
+// Descriptors the ring holds, posting waits for a free one when it is full
+constexpr uint64_t hipblas_persistent_capacity = 1024;
+
+enum hipblasPersistentRoutine : int32_t
+{
+    hipblas_persistent_gemm,
+    hipblas_persistent_gemv,
+    hipblas_persistent_axpy,
+    hipblas_persistent_trsv,
+};
+
+// A posted call in column-major order. gemv reads B as its x and writes C as its y with ldb and
+// ldc as their increments, axpy likewise with n elements, and trsv solves in place in C with
+// increment ldc. alpha and beta are the values of host scalars, or null when alpha_device and
+// beta_device point to the scalars on the device.
+struct hipblasPersistentOp
+{
+    hipblasPersistentRoutine routine;
+    int32_t                  is_double;
+    int32_t                  transA;
+    int32_t                  transB;
+    int32_t                  lower;
+    int32_t                  unit_diag;
+    int32_t                  m;
+    int32_t                  n;
+    int32_t                  k;
+    int32_t                  lda;
+    int32_t                  ldb;
+    int32_t                  ldc;
+    double                   alpha;
+    double                   beta;
+    const void*              alpha_device;
+    const void*              beta_device;
+    const void*              A;
+    const void*              B;
+    void*                    C;
+};
+
+// Pinned host memory shared by the host and the kernel. The host writes the descriptor at
+// head % capacity, then head, and the kernel writes tail once it has run a descriptor. stop ends
+// the kernel once it has run every posted descriptor.
+struct hipblasPersistentRing
+{
+    hipblasPersistentOp ops[hipblas_persistent_capacity];
+    uint64_t            head;
+    uint64_t            tail;
+    int32_t             stop;
+};
+
+// Launches the persistent kernel on stream, reading ring through its device address
+hipblasStatus_t hipblasPersistentLaunch(hipblasPersistentRing* ring, hipStream_t stream);
+
+struct hipblasPersistentContext;
+
+// Allocates the ring and starts the kernel, which runs the posted calls after the work on stream
+// enqueued so far. Returns HIPBLAS_STATUS_NOT_SUPPORTED without the kernel.
+hipblasStatus_t hipblasPersistentCreate(hipStream_t stream, hipblasPersistentContext** context);
+
+// Posts op, first waiting for the work enqueued on stream since the last drain
+hipblasStatus_t hipblasPersistentPost(hipblasPersistentContext*  context,
+                                      hipStream_t                stream,
+                                      const hipblasPersistentOp& op);
+
+// Waits until the kernel has run every posted call. Work enqueued on the stream afterwards is
+// waited for by the next post.
+hipblasStatus_t hipblasPersistentDrain(hipblasPersistentContext* context);
+
+// Drains, stops the kernel and frees the ring
+void hipblasPersistentDestroy(hipblasPersistentContext* context);
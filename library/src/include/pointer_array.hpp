@@ -0,0 +1,102 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <cstdint>
+
+// Pointer arrays registered with hipblasSetPointerArrayStride. A registered array holds
+// base + i * stride for each of its batchCount entries, so a batched call whose A, B and C arrays
+// are all registered runs as the strided batched call on the base pointers instead, without
+// reading the arrays.
+
+// Base pointers and strides, in elements, of the pointer arrays of a batched call
+struct hipblasStridedPointers
+{
+    const void*   A;
+    hipblasStride stride_A;
+    const void*   B;
+    hipblasStride stride_B;
+    void*         C;
+    hipblasStride stride_C;
+};
+
+// True, with strided filled in, when A, B and C are registered on handle with at least
+// batch_count entries each
+bool hipblasPointerArraysStrided(hipblasHandle_t         handle,
+                                 int                     batch_count,
+                                 const void*             A,
+                                 const void*             B,
+                                 const void*             C,
+                                 hipblasStridedPointers* strided);
+
+// Forget the pointer arrays registered on handle
+void hipblasPointerArrayErase(hipblasHandle_t handle);
+
+// Pointer arrays on the host, for handles in HIPBLAS_POINTER_ARRAY_MODE_HOST set with
+// hipblasSetPointerArrayMode. The outermost batched entry point copies its arrays into the next
+// of a ring of pinned buffers of the handle and uploads them with one copy on the handle stream,
+// then runs on the device copies. Calls nested in another entry point take arrays hipBLAS built
+// on the device, and are left as they are.
+
+// Number of handles in host mode, so batched calls skip the lookup while there are none
+extern std::atomic<int> pointer_array_host_handles;
+
+// Uploads the count arrays of batch_count pointers in host and sets device to their copies, or
+// to host itself when the call is left as it is
+hipblasStatus_t hipblasPointerArraysUpload(hipblasHandle_t    handle,
+                                           int64_t            batch_count,
+                                           int                count,
+                                           const void* const* host,
+                                           const void**       device);
+
+// Replaces the pointer arrays of a batched call on a handle in host mode by their device copies
+template <typename... T>
+inline hipblasStatus_t
+    hipblasPointerArraysHost(hipblasHandle_t handle, int64_t batch_count, T*&... arrays)
+{
+    if(!pointer_array_host_handles.load(std::memory_order_relaxed))
+        return HIPBLAS_STATUS_SUCCESS;
+
+    const void*     host[] = {arrays...};
+    const void*     device[sizeof...(T)];
+    hipblasStatus_t status
+        = hipblasPointerArraysUpload(handle, batch_count, sizeof...(T), host, device);
+
+    size_t i = 0;
+    ((arrays = (T*)device[i++]), ...);
+    return status;
+}
+
+// Placed after HIPBLAS_LAYER in the batched entry points, with the batch count and the pointer
+// array arguments
+#define HIPBLAS_POINTER_ARRAYS(handle, batch_count, ...)                  \
+    do                                                                    \
+    {                                                                     \
+        hipblasStatus_t pointer_array_status                              \
+            = hipblasPointerArraysHost(handle, batch_count, __VA_ARGS__); \
+        if(pointer_array_status != HIPBLAS_STATUS_SUCCESS)                \
+            return pointer_array_status;                                  \
+    } while(0)
@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Reduction mode of the calls on a handle, set with hipblasSetReductionMode. In
+// HIPBLAS_REDUCTION_REPRODUCIBLE the handle runs with HIPBLAS_ATOMICS_NOT_ALLOWED, and with
+// BUILD_WITH_REPRODUCIBLE (HIPBLAS_REPRODUCIBLE) the routines below run on hipBLAS kernels
+// whose sums are taken in an order fixed by the problem alone, not by the device or the
+// scheduling of the work groups.
+
+// Forget the reduction mode of handle
+void hipblasReductionModeErase(hipblasHandle_t handle);
+
+bool hipblasReductionReproducible(hipblasHandle_t handle);
+
+// Every kernel takes the stream and pointer mode of the handle from the caller. dot and nrm2
+// sum reproducible_blocks partials of a grid-stride loop by a tree, then the partials by a tree;
+// their stream-ordered scratch holds the partials, and the result in host pointer mode, which
+// is copied to the host after the stream is synchronized. gemv, symv and hemv give each element
+// of y to one group of threads, which sums it by a tree, so they need no scratch.
+//
+// Only built with BUILD_WITH_REPRODUCIBLE. Returns HIPBLAS_STATUS_NOT_SUPPORTED, without
+// touching the arguments, for empty or invalid problems so the caller uses the backend, which
+// also reports the invalid arguments.
+constexpr int reproducible_blocks = 256;
+
+hipblasStatus_t hipblasReproducibleDot(hipStream_t  stream,
+                                       bool         device_scalars,
+                                       int          n,
+                                       const float* x,
+                                       int          incx,
+                                       const float* y,
+                                       int          incy,
+                                       float*       result);
+
+hipblasStatus_t hipblasReproducibleDot(hipStream_t   stream,
+                                       bool          device_scalars,
+                                       int           n,
+                                       const double* x,
+                                       int           incx,
+                                       const double* y,
+                                       int           incy,
+                                       double*       result);
+
+hipblasStatus_t hipblasReproducibleNrm2(
+    hipStream_t stream, bool device_scalars, int n, const float* x, int incx, float* result);
+
+hipblasStatus_t hipblasReproducibleNrm2(
+    hipStream_t stream, bool device_scalars, int n, const double* x, int incx, double* result);
+
+hipblasStatus_t hipblasReproducibleGemv(hipStream_t        stream,
+                                        bool               device_scalars,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const float*       alpha,
+                                        const float*       A,
+                                        int                lda,
+                                        const float*       x,
+                                        int                incx,
+                                        const float*       beta,
+                                        float*             y,
+                                        int                incy);
+
+hipblasStatus_t hipblasReproducibleGemv(hipStream_t        stream,
+                                        bool               device_scalars,
+                                        hipblasOperation_t trans,
+                                        int                m,
+                                        int                n,
+                                        const double*      alpha,
+                                        const double*      A,
+                                        int                lda,
+                                        const double*      x,
+                                        int                incx,
+                                        const double*      beta,
+                                        double*            y,
+                                        int                incy);
+
+// symv for float and double, hemv for hipblasComplex and hipblasDoubleComplex
+hipblasStatus_t hipblasReproducibleSymv(hipStream_t       stream,
+                                        bool              device_scalars,
+                                        hipblasFillMode_t uplo,
+                                        int               n,
+                                        const float*      alpha,
+                                        const float*      A,
+                                        int               lda,
+                                        const float*      x,
+                                        int               incx,
+                                        const float*      beta,
+                                        float*            y,
+                                        int               incy);
+
+hipblasStatus_t hipblasReproducibleSymv(hipStream_t       stream,
+                                        bool              device_scalars,
+                                        hipblasFillMode_t uplo,
+                                        int               n,
+                                        const double*     alpha,
+                                        const double*     A,
+                                        int               lda,
+                                        const double*     x,
+                                        int               incx,
+                                        const double*     beta,
+                                        double*           y,
+                                        int               incy);
+
+hipblasStatus_t hipblasReproducibleHemv(hipStream_t           stream,
+                                        bool                  device_scalars,
+                                        hipblasFillMode_t     uplo,
+                                        int                   n,
+                                        const hipblasComplex* alpha,
+                                        const hipblasComplex* A,
+                                        int                   lda,
+                                        const hipblasComplex* x,
+                                        int                   incx,
+                                        const hipblasComplex* beta,
+                                        hipblasComplex*       y,
+                                        int                   incy);
+
+hipblasStatus_t hipblasReproducibleHemv(hipStream_t                 stream,
+                                        bool                        device_scalars,
+                                        hipblasFillMode_t           uplo,
+                                        int                         n,
+                                        const hipblasDoubleComplex* alpha,
+                                        const hipblasDoubleComplex* A,
+                                        int                         lda,
+                                        const hipblasDoubleComplex* x,
+                                        int                         incx,
+                                        const hipblasDoubleComplex* beta,
+                                        hipblasDoubleComplex*       y,
+                                        int                         incy);
@@ -0,0 +1,110 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Only built with BUILD_WITH_ROT_CHAIN (HIPBLAS_ROT_CHAIN). Generates and applies the n Givens
+// rotations of hipblas?rotgChain and its batched forms, one work group per instance: for each k
+// in order, thread 0 computes rotg of A(k, k) and x(k) and stores c(k) and s(k), then the threads
+// share the columns k + 1 to m - 1 of row k of A and of x to rotate. c and s do not go back to
+// the host between the rotations.
+//
+// The arguments are checked by the callers. A_b is A_array[b] when A_array is not null and
+// A + b * stride_A otherwise, and likewise for x, c and s. The call does not wait for the stream.
+hipblasStatus_t hipblasRotChainKernels(hipblasHandle_t handle,
+                                       int             n,
+                                       int             m,
+                                       float*          A,
+                                       float* const*   A_array,
+                                       int             lda,
+                                       hipblasStride   stride_A,
+                                       float*          x,
+                                       float* const*   x_array,
+                                       int             incx,
+                                       hipblasStride   stride_x,
+                                       float*          c,
+                                       float* const*   c_array,
+                                       hipblasStride   stride_c,
+                                       float*          s,
+                                       float* const*   s_array,
+                                       hipblasStride   stride_s,
+                                       int             batch_count);
+
+hipblasStatus_t hipblasRotChainKernels(hipblasHandle_t handle,
+                                       int             n,
+                                       int             m,
+                                       double*         A,
+                                       double* const*  A_array,
+                                       int             lda,
+                                       hipblasStride   stride_A,
+                                       double*         x,
+                                       double* const*  x_array,
+                                       int             incx,
+                                       hipblasStride   stride_x,
+                                       double*         c,
+                                       double* const*  c_array,
+                                       hipblasStride   stride_c,
+                                       double*         s,
+                                       double* const*  s_array,
+                                       hipblasStride   stride_s,
+                                       int             batch_count);
+
+hipblasStatus_t hipblasRotChainKernels(hipblasHandle_t        handle,
+                                       int                    n,
+                                       int                    m,
+                                       hipblasComplex*        A,
+                                       hipblasComplex* const* A_array,
+                                       int                    lda,
+                                       hipblasStride          stride_A,
+                                       hipblasComplex*        x,
+                                       hipblasComplex* const* x_array,
+                                       int                    incx,
+                                       hipblasStride          stride_x,
+                                       float*                 c,
+                                       float* const*          c_array,
+                                       hipblasStride          stride_c,
+                                       hipblasComplex*        s,
+                                       hipblasComplex* const* s_array,
+                                       hipblasStride          stride_s,
+                                       int                    batch_count);
+
+hipblasStatus_t hipblasRotChainKernels(hipblasHandle_t              handle,
+                                       int                          n,
+                                       int                          m,
+                                       hipblasDoubleComplex*        A,
+                                       hipblasDoubleComplex* const* A_array,
+                                       int                          lda,
+                                       hipblasStride                stride_A,
+                                       hipblasDoubleComplex*        x,
+                                       hipblasDoubleComplex* const* x_array,
+                                       int                          incx,
+                                       hipblasStride                stride_x,
+                                       double*                      c,
+                                       double* const*               c_array,
+                                       hipblasStride                stride_c,
+                                       hipblasDoubleComplex*        s,
+                                       hipblasDoubleComplex* const* s_array,
+                                       hipblasStride                stride_s,
+                                       int                          batch_count);
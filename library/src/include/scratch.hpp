@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstddef>
+#include <hip/hip_runtime_api.h>
+
+// Stream-ordered scratch of one call, so the device is not synchronized when it is freed
+struct hipblasStreamScratch
+{
+    hipStream_t stream = nullptr;
+    char*       base   = nullptr;
+
+    ~hipblasStreamScratch()
+    {
+        if(base)
+            (void)hipFreeAsync(base, stream);
+    }
+
+    // Allocates bytes on stream, or nothing when bytes is 0
+    hipblasStatus_t allocate(size_t bytes)
+    {
+        if(bytes && hipMallocAsync((void**)&base, bytes, stream) != hipSuccess)
+        {
+            base = nullptr;
+            (void)hipGetLastError();
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+};
+
+// Device scratch of one call. hipFree waits for the device, so the stream is done with it.
+struct hipblasDeviceScratch
+{
+    char* base = nullptr;
+
+    ~hipblasDeviceScratch()
+    {
+        if(base)
+            (void)hipFree(base);
+    }
+};
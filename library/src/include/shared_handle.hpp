@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <memory>
+
+// Handles in HIPBLAS_HANDLE_MODE_SHARED, set with hipblasSetHandleMode. Every entry point rebinds
+// its shared handle argument to a backend handle borrowed from the pool of the shared handle for
+// the duration of the call, bound to the stream the calling thread set, so concurrent calls have
+// their own stream and workspace. The few entry points acting on the shared handle itself, such
+// as hipblasSetStream and hipblasDestroy, log with HIPBLAS_LAYER_HANDLE instead.
+
+struct hipblasSharedHandle;
+
+// Number of shared handles, so calls skip the lookup while there are none
+extern std::atomic<int> hipblas_shared_handles;
+
+// A backend handle of the pool, the stream it last ran on and the event recorded after its call,
+// with the modes of the shared handle last applied to it once configured is set
+struct hipblasSharedHandleEntry
+{
+    hipblasHandle_t      handle       = nullptr;
+    hipStream_t          stream       = nullptr;
+    hipEvent_t           done         = nullptr;
+    bool                 used         = false;
+    bool                 configured   = false;
+    hipblasPointerMode_t pointer_mode = HIPBLAS_POINTER_MODE_HOST;
+    hipblasAtomicsMode_t atomics_mode = HIPBLAS_ATOMICS_NOT_ALLOWED;
+    hipblasMath_t        math_mode    = HIPBLAS_DEFAULT_MATH;
+};
+
+// Borrows a pool handle when handle is shared, replacing handle with it, or with nullptr when no
+// handle could be borrowed so the call fails. The pool handle is returned on destruction.
+class hipblasSharedHandleScope
+{
+    std::shared_ptr<hipblasSharedHandle> shared;
+    hipblasSharedHandleEntry             entry;
+
+    void acquire(hipblasHandle_t& handle);
+    void release();
+
+public:
+    explicit hipblasSharedHandleScope(hipblasHandle_t& handle)
+    {
+        if(hipblas_shared_handles.load(std::memory_order_relaxed))
+            acquire(handle);
+    }
+
+    // Entry points without a handle argument
+    template <typename T>
+    explicit hipblasSharedHandleScope(const T&)
+    {
+    }
+
+    ~hipblasSharedHandleScope()
+    {
+        if(shared)
+            release();
+    }
+
+    hipblasSharedHandleScope(const hipblasSharedHandleScope&) = delete;
+    hipblasSharedHandleScope& operator=(const hipblasSharedHandleScope&) = delete;
+};
+
+// Returns true when handle is shared
+bool hipblasSharedHandleIs(hipblasHandle_t handle);
+
+// Set or get the stream of the calling thread when handle is shared, returning false otherwise
+bool hipblasSharedHandleSetStream(hipblasHandle_t handle, hipStream_t stream);
+bool hipblasSharedHandleGetStream(hipblasHandle_t handle, hipStream_t* stream);
+
+// Destroy the pool of handle
+void hipblasSharedHandleErase(hipblasHandle_t handle);
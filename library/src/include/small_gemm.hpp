@@ -0,0 +1,74 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Strided batched sgemm and dgemm kernels for problems with m, n and k up to small_gemm_max_size,
+// where the backend kernels spend most of each tile on padding. One work group holds the A and B
+// of several problems in shared memory and every thread keeps one element of C in a register;
+// the kernel is specialized for problems up to 4, 8 and 16.
+//
+// Only built with BUILD_WITH_SMALL_GEMM (HIPBLAS_SMALL_GEMM). Returns HIPBLAS_STATUS_NOT_SUPPORTED,
+// without touching C, for larger or invalid problems so the caller uses the backend, which also
+// reports the invalid arguments.
+constexpr int small_gemm_max_size = 16;
+
+hipblasStatus_t hipblasSmallGemmStridedBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const float*       alpha,
+                                               const float*       A,
+                                               int                lda,
+                                               hipblasStride      stride_a,
+                                               const float*       B,
+                                               int                ldb,
+                                               hipblasStride      stride_b,
+                                               const float*       beta,
+                                               float*             C,
+                                               int                ldc,
+                                               hipblasStride      stride_c,
+                                               int                batch_count);
+
+hipblasStatus_t hipblasSmallGemmStridedBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const double*      alpha,
+                                               const double*      A,
+                                               int                lda,
+                                               hipblasStride      stride_a,
+                                               const double*      B,
+                                               int                ldb,
+                                               hipblasStride      stride_b,
+                                               const double*      beta,
+                                               double*            C,
+                                               int                ldc,
+                                               hipblasStride      stride_c,
+                                               int                batch_count);
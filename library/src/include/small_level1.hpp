@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Single launch saxpy, daxpy, sscal, dscal, scopy, dcopy, sdot and ddot kernels for vectors of up
+// to small_level1_max_size elements, or the hipblasSmallLevel1Size of a tuning profile, where the
+// cost of a call is on the host. They take the stream and pointer mode of the handle from the
+// caller and check only what they need, so the call is little more than the kernel launch, and
+// they allocate nothing, so they can be captured in a graph. dot only runs here with a device
+// result, as a host result waits for the stream anyway.
+//
+// Only built with BUILD_WITH_SMALL_LEVEL1 (HIPBLAS_SMALL_LEVEL1). Returns
+// HIPBLAS_STATUS_NOT_SUPPORTED, without touching the vectors, for longer, empty or invalid
+// problems so the caller uses the backend, which also reports the invalid arguments.
+constexpr int small_level1_max_size = 1024;
+
+hipblasStatus_t hipblasSmallAxpy(hipStream_t  stream,
+                                 bool         device_scalars,
+                                 int          n,
+                                 const float* alpha,
+                                 const float* x,
+                                 int          incx,
+                                 float*       y,
+                                 int          incy);
+
+hipblasStatus_t hipblasSmallAxpy(hipStream_t   stream,
+                                 bool          device_scalars,
+                                 int           n,
+                                 const double* alpha,
+                                 const double* x,
+                                 int           incx,
+                                 double*       y,
+                                 int           incy);
+
+hipblasStatus_t hipblasSmallScal(
+    hipStream_t stream, bool device_scalars, int n, const float* alpha, float* x, int incx);
+
+hipblasStatus_t hipblasSmallScal(
+    hipStream_t stream, bool device_scalars, int n, const double* alpha, double* x, int incx);
+
+hipblasStatus_t
+    hipblasSmallCopy(hipStream_t stream, int n, const float* x, int incx, float* y, int incy);
+
+hipblasStatus_t
+    hipblasSmallCopy(hipStream_t stream, int n, const double* x, int incx, double* y, int incy);
+
+hipblasStatus_t hipblasSmallDot(hipStream_t  stream,
+                                bool         device_scalars,
+                                int          n,
+                                const float* x,
+                                int          incx,
+                                const float* y,
+                                int          incy,
+                                float*       result);
+
+hipblasStatus_t hipblasSmallDot(hipStream_t   stream,
+                                bool          device_scalars,
+                                int           n,
+                                const double* x,
+                                int           incx,
+                                const double* y,
+                                int           incy,
+                                double*       result);
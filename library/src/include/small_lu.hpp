@@ -0,0 +1,278 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Only built with BUILD_WITH_SMALL_LU (HIPBLAS_SMALL_LU). Largest n of the small LU kernels,
+// which keep a whole matrix in local memory, with one work group per matrix
+constexpr int hipblas_small_lu_max_n = 32;
+
+// getrf with partial pivoting of every n-by-n matrix of a batch, n <= hipblas_small_lu_max_n,
+// storing the 1-based pivots as integers of pivot_bytes = 1, 2 or 4 bytes. A_b is A_array[b]
+// when A_array is not null and A + b * strideA otherwise, and ipiv_b is at ipiv + b * strideP
+// elements. info holds one value per matrix on the device. The arguments are checked by the
+// callers, and the call does not wait for the stream.
+hipblasStatus_t hipblasSmallGetrfKernels(hipblasHandle_t handle,
+                                         int             n,
+                                         float*          A,
+                                         float* const*   A_array,
+                                         int             lda,
+                                         hipblasStride   strideA,
+                                         void*           ipiv,
+                                         int             pivot_bytes,
+                                         hipblasStride   strideP,
+                                         int*            info,
+                                         int             batch_count);
+
+hipblasStatus_t hipblasSmallGetrfKernels(hipblasHandle_t handle,
+                                         int             n,
+                                         double*         A,
+                                         double* const*  A_array,
+                                         int             lda,
+                                         hipblasStride   strideA,
+                                         void*           ipiv,
+                                         int             pivot_bytes,
+                                         hipblasStride   strideP,
+                                         int*            info,
+                                         int             batch_count);
+
+hipblasStatus_t hipblasSmallGetrfKernels(hipblasHandle_t        handle,
+                                         int                    n,
+                                         hipblasComplex*        A,
+                                         hipblasComplex* const* A_array,
+                                         int                    lda,
+                                         hipblasStride          strideA,
+                                         void*                  ipiv,
+                                         int                    pivot_bytes,
+                                         hipblasStride          strideP,
+                                         int*                   info,
+                                         int                    batch_count);
+
+hipblasStatus_t hipblasSmallGetrfKernels(hipblasHandle_t              handle,
+                                         int                          n,
+                                         hipblasDoubleComplex*        A,
+                                         hipblasDoubleComplex* const* A_array,
+                                         int                          lda,
+                                         hipblasStride                strideA,
+                                         void*                        ipiv,
+                                         int                          pivot_bytes,
+                                         hipblasStride                strideP,
+                                         int*                         info,
+                                         int                          batch_count);
+
+// getrs of every matrix of a batch with the factors and pivots of hipblasSmallGetrfKernels, in the
+// same forms, and B_b is B_array[b] when B_array is not null and B + b * strideB otherwise
+hipblasStatus_t hipblasSmallGetrsKernels(hipblasHandle_t     handle,
+                                         hipblasOperation_t  trans,
+                                         int                 n,
+                                         int                 nrhs,
+                                         const float*        A,
+                                         const float* const* A_array,
+                                         int                 lda,
+                                         hipblasStride       strideA,
+                                         const void*         ipiv,
+                                         int                 pivot_bytes,
+                                         hipblasStride       strideP,
+                                         float*              B,
+                                         float* const*       B_array,
+                                         int                 ldb,
+                                         hipblasStride       strideB,
+                                         int                 batch_count);
+
+hipblasStatus_t hipblasSmallGetrsKernels(hipblasHandle_t      handle,
+                                         hipblasOperation_t   trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         const double*        A,
+                                         const double* const* A_array,
+                                         int                  lda,
+                                         hipblasStride        strideA,
+                                         const void*          ipiv,
+                                         int                  pivot_bytes,
+                                         hipblasStride        strideP,
+                                         double*              B,
+                                         double* const*       B_array,
+                                         int                  ldb,
+                                         hipblasStride        strideB,
+                                         int                  batch_count);
+
+hipblasStatus_t hipblasSmallGetrsKernels(hipblasHandle_t              handle,
+                                         hipblasOperation_t           trans,
+                                         int                          n,
+                                         int                          nrhs,
+                                         const hipblasComplex*        A,
+                                         const hipblasComplex* const* A_array,
+                                         int                          lda,
+                                         hipblasStride                strideA,
+                                         const void*                  ipiv,
+                                         int                          pivot_bytes,
+                                         hipblasStride                strideP,
+                                         hipblasComplex*              B,
+                                         hipblasComplex* const*       B_array,
+                                         int                          ldb,
+                                         hipblasStride                strideB,
+                                         int                          batch_count);
+
+hipblasStatus_t hipblasSmallGetrsKernels(hipblasHandle_t                    handle,
+                                         hipblasOperation_t                 trans,
+                                         int                                n,
+                                         int                                nrhs,
+                                         const hipblasDoubleComplex*        A,
+                                         const hipblasDoubleComplex* const* A_array,
+                                         int                                lda,
+                                         hipblasStride                      strideA,
+                                         const void*                        ipiv,
+                                         int                                pivot_bytes,
+                                         hipblasStride                      strideP,
+                                         hipblasDoubleComplex*              B,
+                                         hipblasDoubleComplex* const*       B_array,
+                                         int                                ldb,
+                                         hipblasStride                      strideB,
+                                         int                                batch_count);
+
+// Copies the n pivots of every vector of a batch between integers of src_bytes and dst_bytes
+// = 1, 2 or 4 bytes, with the strides in elements. Narrower integers must hold every pivot.
+hipblasStatus_t hipblasPivotCopyKernels(hipblasHandle_t handle,
+                                        int             n,
+                                        const void*     src,
+                                        int             src_bytes,
+                                        hipblasStride   strideS,
+                                        void*           dst,
+                                        int             dst_bytes,
+                                        hipblasStride   strideD,
+                                        int             batch_count);
+
+// Inverts every n-by-n matrix of a batch by Gauss-Jordan elimination with partial pivoting,
+// n <= hipblas_small_lu_max_n, writing the inverse of A_array[b] to Ainv_array[b]. info[b] is the
+// position of the first zero pivot, as getrf reports it, or 0.
+hipblasStatus_t hipblasSmallMatinvKernels(hipblasHandle_t     handle,
+                                          int                 n,
+                                          const float* const* A_array,
+                                          int                 lda,
+                                          float* const*       Ainv_array,
+                                          int                 lda_inv,
+                                          int*                info,
+                                          int                 batch_count);
+
+hipblasStatus_t hipblasSmallMatinvKernels(hipblasHandle_t      handle,
+                                          int                  n,
+                                          const double* const* A_array,
+                                          int                  lda,
+                                          double* const*       Ainv_array,
+                                          int                  lda_inv,
+                                          int*                 info,
+                                          int                  batch_count);
+
+hipblasStatus_t hipblasSmallMatinvKernels(hipblasHandle_t              handle,
+                                          int                          n,
+                                          const hipblasComplex* const* A_array,
+                                          int                          lda,
+                                          hipblasComplex* const*       Ainv_array,
+                                          int                          lda_inv,
+                                          int*                         info,
+                                          int                          batch_count);
+
+hipblasStatus_t hipblasSmallMatinvKernels(hipblasHandle_t                    handle,
+                                          int                                n,
+                                          const hipblasDoubleComplex* const* A_array,
+                                          int                                lda,
+                                          hipblasDoubleComplex* const*       Ainv_array,
+                                          int                                lda_inv,
+                                          int*                               info,
+                                          int                                batch_count);
+
+// Copies every A_array[b] to W + b * n * n with leading dimension n, and sets W_array[b] to that
+// copy, for the getrf and getri of the inverse of larger matrices
+hipblasStatus_t hipblasMatinvStageKernels(hipblasHandle_t     handle,
+                                          int                 n,
+                                          const float* const* A_array,
+                                          int                 lda,
+                                          float*              W,
+                                          float**             W_array,
+                                          int                 batch_count);
+
+hipblasStatus_t hipblasMatinvStageKernels(hipblasHandle_t      handle,
+                                          int                  n,
+                                          const double* const* A_array,
+                                          int                  lda,
+                                          double*              W,
+                                          double**             W_array,
+                                          int                  batch_count);
+
+hipblasStatus_t hipblasMatinvStageKernels(hipblasHandle_t              handle,
+                                          int                          n,
+                                          const hipblasComplex* const* A_array,
+                                          int                          lda,
+                                          hipblasComplex*              W,
+                                          hipblasComplex**             W_array,
+                                          int                          batch_count);
+
+hipblasStatus_t hipblasMatinvStageKernels(hipblasHandle_t                    handle,
+                                          int                                n,
+                                          const hipblasDoubleComplex* const* A_array,
+                                          int                                lda,
+                                          hipblasDoubleComplex*              W,
+                                          hipblasDoubleComplex**             W_array,
+                                          int                                batch_count);
+
+// matinvBatched, built with the solver functions and run by both backends, the cuBLAS one only
+// above the n of cublas?matinvBatched. Small matrices are inverted by hipblasSmallMatinvKernels,
+// and larger ones are copied and inverted by getrfBatched and getriBatched. Checks the arguments,
+// and returns HIPBLAS_STATUS_NOT_SUPPORTED without BUILD_WITH_SMALL_LU.
+hipblasStatus_t hipblasMatinvBatched(hipblasHandle_t     handle,
+                                     int                 n,
+                                     const float* const* A,
+                                     int                 lda,
+                                     float* const*       Ainv,
+                                     int                 lda_inv,
+                                     int*                info,
+                                     int                 batch_count);
+
+hipblasStatus_t hipblasMatinvBatched(hipblasHandle_t      handle,
+                                     int                  n,
+                                     const double* const* A,
+                                     int                  lda,
+                                     double* const*       Ainv,
+                                     int                  lda_inv,
+                                     int*                 info,
+                                     int                  batch_count);
+
+hipblasStatus_t hipblasMatinvBatched(hipblasHandle_t              handle,
+                                     int                          n,
+                                     const hipblasComplex* const* A,
+                                     int                          lda,
+                                     hipblasComplex* const*       Ainv,
+                                     int                          lda_inv,
+                                     int*                         info,
+                                     int                          batch_count);
+
+hipblasStatus_t hipblasMatinvBatched(hipblasHandle_t                    handle,
+                                     int                                n,
+                                     const hipblasDoubleComplex* const* A,
+                                     int                                lda,
+                                     hipblasDoubleComplex* const*       Ainv,
+                                     int                                lda_inv,
+                                     int*                               info,
+                                     int                                batch_count);
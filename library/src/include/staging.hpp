@@ -0,0 +1,74 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Transfers for hipblasSetVector, hipblasGetVector, hipblasSetMatrix, hipblasGetMatrix and their
+// Async variants. The host side is packed into a ring of pinned staging buffers in chunks, so
+// packing one chunk overlaps the DMA of the previous one. A vector is passed as a 1 x n matrix
+// with its increment as the leading dimension.
+//
+// Both return HIPBLAS_STATUS_NOT_SUPPORTED, without copying, when staging would not help (packed
+// pinned or small host data), for arguments the backend has to reject, and while stream is being
+// captured. The caller then uses the backend copy.
+
+// Copy rows x cols elements of elem_size bytes from host to device. The host data is no longer
+// read when this returns. Unless async, stream is synchronized as well.
+hipblasStatus_t hipblasStagedSetMatrix(int         rows,
+                                       int         cols,
+                                       int         elem_size,
+                                       const void* host,
+                                       int         ld_host,
+                                       void*       device,
+                                       int         ld_device,
+                                       hipStream_t stream,
+                                       bool        async);
+
+// Copy rows x cols elements of elem_size bytes from device to host, ordered on stream. The host
+// data is unpacked before this returns, so the Async variants complete here too.
+hipblasStatus_t hipblasStagedGetMatrix(int         rows,
+                                       int         cols,
+                                       int         elem_size,
+                                       const void* device,
+                                       int         ld_device,
+                                       void*       host,
+                                       int         ld_host,
+                                       hipStream_t stream);
+
+// Copy rows x cols elements of elem_size bytes between the file fd, with column j at byte offset
+// + j * ld_file * elem_size, and device, through the staging buffers with pread and pwrite
+// overlapping the DMA of the previous chunk. The copy is done when this returns. Returns
+// HIPBLAS_STATUS_NOT_SUPPORTED while stream is being captured and off Linux, and
+// HIPBLAS_STATUS_EXECUTION_FAILED when the file cannot be read or written in full.
+hipblasStatus_t hipblasStagedFileCopy(bool        to_device,
+                                      int64_t     rows,
+                                      int64_t     cols,
+                                      int         elem_size,
+                                      int         fd,
+                                      int64_t     offset,
+                                      int64_t     ld_file,
+                                      void*       device,
+                                      int64_t     ld_device,
+                                      hipStream_t stream);
@@ -0,0 +1,55 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <functional>
+
+// Internal streams of a handle, set with hipblasSetStreamPoolSize. A batched call over enough
+// problems is split into contiguous chunks, one per pool stream, and each chunk is run by a pool
+// handle bound to its stream, so the chunks have their own workspace. The pool streams wait for
+// the work already on the handle stream and the handle stream waits for all of them, so the call
+// stays ordered on the handle stream for the caller.
+
+// Number of chunks a call over batch_count problems on handle is split into, or 0 when it runs on
+// the handle stream as usual. Calls are not split while the handle stream is being captured.
+int hipblasStreamPoolChunks(hipblasHandle_t handle, int batch_count);
+
+// Runs the count problems starting at first on pool_handle
+using hipblasStreamPoolChunkFn
+    = std::function<hipblasStatus_t(hipblasHandle_t pool_handle, int first, int count)>;
+
+// Calls run for each of the chunks of batch_count problems, on the pool streams of handle, and
+// joins them back to the handle stream. Returns the first failing status.
+hipblasStatus_t hipblasStreamPoolRun(hipblasHandle_t                 handle,
+                                     int                             batch_count,
+                                     int                             chunks,
+                                     const hipblasStreamPoolChunkFn& run);
+
+// Destroy the pool of handle and forget its stream priority
+void hipblasStreamPoolErase(hipblasHandle_t handle);
+
+// Creates a non-blocking stream of the priority set for handle with hipblasSetStreamPriority,
+// for the internal streams of its calls
+hipError_t hipblasInternalStreamCreate(hipblasHandle_t handle, hipStream_t* stream);
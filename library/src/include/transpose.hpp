@@ -0,0 +1,55 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Transpose kernels behind hipblasTransposeEx and its batched forms. Out of place, each work group
+// moves one square tile of A through shared memory, so that both the reads of A and the writes of
+// C are contiguous down the columns, converting the elements on the way. In place, which needs
+// a square A of one type, each work group swaps a tile above the diagonal with its mirror below.
+//
+// Only built with BUILD_WITH_TRANSPOSE (HIPBLAS_TRANSPOSE). The supported types are HIP_R_16F,
+// HIP_R_16BF, HIP_R_32F and HIP_R_64F unchanged, and HIP_R_32F to or from HIP_R_16F and
+// HIP_R_16BF; other pairs return HIPBLAS_STATUS_NOT_SUPPORTED. The arguments are checked by the
+// callers, and the call does not wait for the stream.
+
+// C_b := A_b^T for b = 0, ..., batch_count - 1, where A_b is A_array[b] when A_array is not null
+// and A + b * stride_A otherwise, and likewise for C_b. A is m by n and C is n by m. In place when
+// in_place is set, with C, C_array, ldc and stride_C then those of A.
+hipblasStatus_t hipblasTransposeKernels(hipblasHandle_t    handle,
+                                        int                m,
+                                        int                n,
+                                        const void*        A,
+                                        const void* const* A_array,
+                                        hipDataType        a_type,
+                                        int                lda,
+                                        hipblasStride      stride_A,
+                                        void*              C,
+                                        void* const*       C_array,
+                                        hipDataType        c_type,
+                                        int                ldc,
+                                        hipblasStride      stride_C,
+                                        int                batch_count,
+                                        bool               in_place);
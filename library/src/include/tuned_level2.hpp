@@ -0,0 +1,67 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// hipBLAS gemv kernels for the autotuning of Level-2 calls, built with BUILD_WITH_TUNED_LEVEL2.
+// Every variant runs work groups of 256 threads, 256 >> (variant - 1) of them along the rows of A
+// and the others along its columns. With HIPBLAS_OP_N a thread sums its row over every few
+// columns and adds the sums of the threads sharing the row in order, otherwise the threads of a
+// column sum it by a tree, so the results do not depend on scheduling.
+
+// Number of variants, numbered from 1 as tuning index 0 is the backend routine
+constexpr int tuned_gemv_variants = 5;
+
+// Runs variant of the gemv kernels on stream, returning HIPBLAS_STATUS_NOT_SUPPORTED when the
+// arguments are outside what they handle, which the backend checks instead
+hipblasStatus_t hipblasTunedGemv(hipStream_t        stream,
+                                 int                variant,
+                                 bool               device_scalars,
+                                 hipblasOperation_t trans,
+                                 int                m,
+                                 int                n,
+                                 const float*       alpha,
+                                 const float*       A,
+                                 int                lda,
+                                 const float*       x,
+                                 int                incx,
+                                 const float*       beta,
+                                 float*             y,
+                                 int                incy);
+
+hipblasStatus_t hipblasTunedGemv(hipStream_t        stream,
+                                 int                variant,
+                                 bool               device_scalars,
+                                 hipblasOperation_t trans,
+                                 int                m,
+                                 int                n,
+                                 const double*      alpha,
+                                 const double*      A,
+                                 int                lda,
+                                 const double*      x,
+                                 int                incx,
+                                 const double*      beta,
+                                 double*            y,
+                                 int                incy);
@@ -128,21 +128,32 @@ def L2_theo_max(GBps):
 
     return L2_theo_max_dict
 
-def write_machine_spec_yaml(machine_spec_filename):
+def peak_GBps(bench_command):
+    # hipblas-bench --efficiency reports the percent of the device bandwidth reached, which is
+    # the built-in peak of the arch or the one of its --peak_file
+    output = subprocess.check_output([bench_command, '-f', 'copy', '-r', 'f32_r',
+                                      '-n', '1048576', '-i', '1', '--efficiency'])
+    lines = output.decode('utf-8').strip().splitlines()
+    for name_line, value_line in zip(lines, lines[1:]):
+        names = name_line.split(',')
+        if 'hipblas-%peak-GB/s' not in names:
+            continue
+        values = [float(v) for v in value_line.split(',') if v.strip()]
+        percent = values[names.index('hipblas-%peak-GB/s')]
+        if percent > 0:
+            return values[names.index('hipblas-GB/s')] * 100 / percent
+    return 0
+
+def write_machine_spec_yaml(machine_spec_filename, bench_command):
     machine_spec_dict = {}
     device_number = 1
     cuda = False
     machine_spec_dict['arch'] = getspecs.getgfx(device_number, cuda)
 
-    if machine_spec_dict['arch'] == 'gfx906':
-        GBps = 1000
-    elif machine_spec_dict['arch'] == 'gfx908':
-        GBps = 1100
-    elif machine_spec_dict['arch'] == 'gfx90a':
-        GBps = 1600
-    else:
+    GBps = peak_GBps(bench_command)
+    if GBps <= 0:
         print("do not know GBps memory bandwidth for ", machine_spec_dict['arch'])
-        print("add GBps to", sys.argv[0])
+        print("add it to a hipblas-bench --peak_file")
         print("quitting ", sys.argv[0])
         quit()
 
@@ -199,7 +210,7 @@ if __name__ =='__main__':
 
     machine_spec_filename = os.path.join(args.level, args.tag, "machine_spec.yaml")
 
-    write_machine_spec_yaml(machine_spec_filename)
+    write_machine_spec_yaml(machine_spec_filename, args.bench_command)
 
     for function_name in args.function_names:
 
@@ -6,6 +6,8 @@ TAG2=ref
 LEVEL1=true
 LEVEL2=false
 LEVEL3=false
+BATCHED=false
+SOLVER=false
 BENCHMARK=true
 PLOT=true
 VS_THEO_MAX=false
@@ -14,7 +16,7 @@ VS_PERF=false
 usage()
 {
     echo ""
-    echo "Usage: $0 --tag1 <tag1>  -b <hipblas_bench> <--plot> <--benchmark> <--level1> <--level2> <--level3> <--theo_max> <--perf_vs_perf>"
+    echo "Usage: $0 --tag1 <tag1>  -b <hipblas_bench> <--plot> <--benchmark> <--level1> <--level2> <--level3> <--batched> <--solver> <--theo_max> <--perf_vs_perf>"
     echo ""
     echo "where tag1 = tag for storing files, typically set to architecture like: gfx906, gfx90a, ..."
     echo "            default: $TAG1"
@@ -40,6 +42,12 @@ usage()
     echo "--level3 true:  for L3 BLAS"
     echo "                default: $LEVEL3"
     echo ""
+    echo "--batched true:  for batched and strided batched BLAS, swept over batch_count"
+    echo "                 default: $BATCHED"
+    echo ""
+    echo "--solver true:  for getrf, getrs, geqrf and gels, swept over size and batch_count"
+    echo "                default: $SOLVER"
+    echo ""
     echo "--theo-max true:  to plot performance / theoretical_maximum_performance,"
     echo "                  only for BLAS1 and BLAS2, not for BLAS3"
     echo "                  default: $VS_THEO_MAX"
@@ -86,6 +94,16 @@ while [[ $# -gt 0 ]]; do
       shift # past argument
       shift # past value
       ;;
+    --batched)
+      BATCHED="$2"
+      shift # past argument
+      shift # past value
+      ;;
+    --solver)
+      SOLVER="$2"
+      shift # past argument
+      shift # past value
+      ;;
     --benchmark)
       BENCHMARK="$2"
       shift # past argument
@@ -142,6 +160,8 @@ echo ""
 echo "level 1            = $LEVEL1"
 echo "level 2            = $LEVEL2"
 echo "level 3            = $LEVEL3"
+echo "batched            = $BATCHED"
+echo "solver             = $SOLVER"
 echo ""
 
 
@@ -206,3 +226,44 @@ if [ "$LEVEL3" == "true" ]; then
     python3 plot.py -l blas3 --tag1 $TAG1 --tag2 $TAG2 $THEO_MAX $PERF_VS_PERF --label1 "M" --label2 "N" -f gemm -f hemm -f herk -f herkx -f her2k
   fi
 fi
+
+# batched functions are plotted against batch_count with a curve for each size and stride
+if [ "$BATCHED" == "true" ] || [ "$SOLVER" == "true" ]; then
+  if [ "$THEO_MAX" = "--theo_max" ]; then
+    echo "--theo-max is not for batched or solver functions, it can only be used with BLAS1 and BLAS2"
+    exit
+  fi
+fi
+
+if [ "$BATCHED" == "true" ]; then
+  if [ "$BENCHMARK" == "true" ]; then
+    python3 benchmark.py -l batched -t $TAG1 -b $ROCBLAS_BENCH -f axpy_strided_batched -f gemv_strided_batched
+    python3 benchmark.py -l batched -t $TAG1 -b $ROCBLAS_BENCH -f gemm_batched -f gemm_strided_batched -f gemm_strided_batched_ex
+    python3 benchmark.py -l batched -t $TAG1 -b $ROCBLAS_BENCH -f trsm_strided_batched
+  fi
+  if [ "$PLOT" == "true" ]; then
+    python3 plot.py -l batched --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --curve "N" --curve "stride_scale" -f axpy_strided_batched
+    python3 plot.py -l batched --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --curve "M" --curve "stride_scale" -f gemv_strided_batched
+    python3 plot.py -l batched --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --curve "M" -f gemm_batched -f gemm_strided_batched_ex
+    python3 plot.py -l batched --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --curve "M" --curve "stride_scale" -f gemm_strided_batched
+    python3 plot.py -l batched --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --curve "M" --curve "stride_scale" -f trsm_strided_batched
+  fi
+fi
+
+if [ "$SOLVER" == "true" ]; then
+  if [ "$BENCHMARK" == "true" ]; then
+    python3 benchmark.py -l solver -t $TAG1 -b $ROCBLAS_BENCH -f getrf -f getrs -f geqrf -f gels
+    python3 benchmark.py -l solver -t $TAG1 -b $ROCBLAS_BENCH -f getrf_batched -f getrf_strided_batched -f getrs_batched -f getrs_strided_batched
+    python3 benchmark.py -l solver -t $TAG1 -b $ROCBLAS_BENCH -f geqrf_batched -f geqrf_strided_batched -f gels_batched -f gels_strided_batched
+  fi
+  if [ "$PLOT" == "true" ]; then
+    python3 plot.py -l solver --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "N" --label2 "N" -f getrf -f getrs -f geqrf
+    python3 plot.py -l solver --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "N" --label2 "N" --yaxis "hipblas-us" -f gels # gels has no flop count
+    python3 plot.py -l solver --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --curve "N" -f getrf_batched -f getrs_batched -f geqrf_batched
+    python3 plot.py -l solver --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --curve "N" --curve "stride_scale" -f getrf_strided_batched
+    python3 plot.py -l solver --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --curve "N" --curve "stride_scale" -f getrs_strided_batched
+    python3 plot.py -l solver --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --curve "N" --curve "stride_scale" -f geqrf_strided_batched
+    python3 plot.py -l solver --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --yaxis "hipblas-us" --curve "N" -f gels_batched
+    python3 plot.py -l solver --tag1 $TAG1 --tag2 $TAG2 $PERF_VS_PERF --label1 "batch_count" --label2 "batch_count" --yaxis "hipblas-us" --curve "N" --curve "stride_scale" -f gels_strided_batched
+  fi
+fi
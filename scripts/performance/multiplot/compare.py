@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+
+import argparse
+import csv
+import json
+import math
+import statistics
+import sys
+
+# Fields describing the machine of a record, which may differ between the two runs
+machine_fields = {'device', 'device_name', 'device_arch', 'compute_units', 'clock_mhz',
+                  'memory_clock_mhz', 'memory_bus_width', 'driver_version', 'runtime_version',
+                  'hipblas_version', 'backend'}
+
+# Fields controlling the run rather than the problem
+run_fields = {'iters', 'cold_iters', 'timing', 'norm_check', 'unit_check', 'category', 'name'}
+
+# Measured fields which are not hipblas-* columns
+measured_fields = {'thread', 'stream', 'flop/byte', 'norm_error_host_ptr', 'norm_error_device_ptr'}
+
+
+def read_records(path):
+    """
+    reads the records written by hipblas-bench --output json or --output csv.
+
+    Parameters:
+        path (string): file of one JSON object per line, or CSV with a header line before the
+            records whenever the columns change.
+
+    Returns:
+        list[dict{string: string}]: the records.
+    """
+    with open(path, newline='') as f:
+        text = f.read()
+    if text.lstrip().startswith('{'):
+        return [json.loads(line) for line in text.splitlines() if line.strip()]
+
+    records, header = [], None
+    for row in csv.reader(text.splitlines()):
+        if not row:
+            continue
+        if row[0] == 'device' and 'device_name' in row:
+            header = row
+        elif header:
+            records.append(dict(zip(header, row)))
+    return records
+
+
+def case_key(record):
+    """returns the fields of the problem of a record, which identify it in both runs."""
+    return tuple(sorted((name, str(value)) for name, value in record.items()
+                        if name not in machine_fields and name not in run_fields
+                        and name not in measured_fields and not name.startswith('hipblas-')))
+
+
+def to_float(value):
+    try:
+        return float(value)
+    except (TypeError, ValueError):
+        return math.nan
+
+
+def summarize(records):
+    """
+    groups records by case and summarizes their times.
+
+    Returns:
+        dict{tuple: dict{string: float}}: for each case the median over its records of the time,
+            from hipblas-us-median when --timing_events recorded it and hipblas-us otherwise, and of
+            the relative standard deviation of the iterations, 0 without --timing_events.
+    """
+    cases = {}
+    for record in records:
+        time = to_float(record.get('hipblas-us-median', record.get('hipblas-us')))
+        if not time > 0:
+            continue
+        spread = to_float(record.get('hipblas-us-stddev')) / time
+        cases.setdefault(case_key(record), []).append((time, spread if spread >= 0 else 0))
+
+    return {key: {'us': statistics.median(t for t, _ in values),
+                  'rsd': statistics.median(s for _, s in values)}
+            for key, values in cases.items()}
+
+
+def describe(key):
+    fields = dict(key)
+    function = fields.pop('function', '?')
+    shown = ['{}={}'.format(name, value) for name, value in sorted(fields.items())
+             if value not in ('0', '0.0', '')]
+    return function + ' ' + ' '.join(shown)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare two hipblas-bench --output csv or json runs and exit with 1 when a '
+                    'case is slower than the noise allows.')
+    parser.add_argument('baseline', help='records of the baseline run')
+    parser.add_argument('current', help='records of the run to check')
+    parser.add_argument('--threshold', type=float, default=0.05,
+                        help='smallest relative slowdown reported as a regression (default 0.05)')
+    parser.add_argument('--sigmas', type=float, default=3.0,
+                        help='number of combined relative standard deviations of the iterations '
+                             'a slowdown must also exceed (default 3)')
+    parser.add_argument('--top', type=int, default=0,
+                        help='print only the first regressions of the ranking, all if 0')
+    args = parser.parse_args()
+
+    baseline = summarize(read_records(args.baseline))
+    current = summarize(read_records(args.current))
+
+    regressions, improvements, missing = [], 0, 0
+    for key, base in baseline.items():
+        if key not in current:
+            missing += 1
+            continue
+        cur = current[key]
+        speedup = base['us'] / cur['us']
+        noise = args.sigmas * math.hypot(base['rsd'], cur['rsd'])
+        allowed = max(args.threshold, noise)
+        if cur['us'] > base['us'] * (1 + allowed):
+            regressions.append((speedup, allowed, base['us'], cur['us'], key))
+        elif base['us'] > cur['us'] * (1 + allowed):
+            improvements += 1
+
+    regressions.sort(key=lambda r: r[0])
+    shown = regressions[:args.top] if args.top > 0 else regressions
+    if shown:
+        print('{:>8} {:>8} {:>12} {:>12}  case'.format('speedup', 'allowed', 'baseline-us',
+                                                      'current-us'))
+    for speedup, allowed, base_us, cur_us, key in shown:
+        print('{:8.3f} {:7.1f}% {:12.3f} {:12.3f}  {}'.format(speedup, 100 * allowed, base_us,
+                                                             cur_us, describe(key)))
+
+    compared = len(baseline) - missing
+    print('{} cases compared, {} regressions, {} improvements, {} baseline cases not in {}, '
+          '{} new cases'.format(compared, len(regressions), improvements, missing, args.current,
+                                len(set(current) - set(baseline))))
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -11,7 +11,7 @@ import numpy as np
 import yaml
 from pathlib import Path
 
-def plot_data(title, gflops_dicts1, gflops_dicts2, const_args_dicts, funcname_list, machine_spec_dict, savedir, theo_max, perf_vs_perf, size_arg = 'N'):
+def plot_data(title, gflops_dicts1, gflops_dicts2, const_args_dicts, funcname_list, machine_spec_dict, savedir, theo_max, perf_vs_perf, size_arg = 'N', yaxis_str = 'hipblas-Gflops'):
     """
     plots gflops data from dictionaries, one plot for each common precision present in all dictionaries.
 
@@ -26,10 +26,14 @@ def plot_data(title, gflops_dicts1, gflops_dicts2, const_args_dicts, funcname_li
         theo_max (string): true for plotting performance versus theoretical maximum performance
         perf_vs_perf (string): true for plotting relative performance of one machine versus another machine
         size_arg (string): x axis title on plot.
+        yaxis_str (string): column plotted on the y axis.
     """
     if len(gflops_dicts1) == 0:
         return
 
+    # batch_count sweeps double the batch, so they are plotted on a log scale
+    log_sizes = size_arg == 'batch_count'
+
     gflops_dict0 = gflops_dicts1[0]
     for prec, _ in gflops_dict0.items():
         colors=iter(cm.rainbow(np.linspace(0,1,len(gflops_dicts1))))
@@ -40,8 +44,8 @@ def plot_data(title, gflops_dicts1, gflops_dicts2, const_args_dicts, funcname_li
             if prec not in gflops_dict1:
                 continue
             gflops1 = gflops_dict1[prec]
-            gflops2 = gflops_dict2[prec]
-            if (perf_vs_perf != True):
+            gflops2 = gflops_dict2.get(prec, []) if perf_vs_perf == True else list(gflops1)
+            if (perf_vs_perf != True and not log_sizes):
                 gflops1.append((0, 0)) # I prefer having a 0 at the bottom so the performance looks more accurate
                 gflops2.append((0, 0)) # I prefer having a 0 at the bottom so the performance looks more accurate
             sorted_tuples1 = sorted(gflops1)
@@ -70,6 +74,8 @@ def plot_data(title, gflops_dicts1, gflops_dicts2, const_args_dicts, funcname_li
                 function_label = "c" + funcname
             elif(prec == "f64_c"):
                 function_label = "z" + funcname
+            else:
+                function_label = prec + " " + funcname
 
             if(theo_max == True):
                 theo_max_value = machine_spec_dict[function_label]
@@ -80,15 +86,18 @@ def plot_data(title, gflops_dicts1, gflops_dicts2, const_args_dicts, funcname_li
             axes.scatter(sorted_sizes1, sorted_gflops1, color=cur_color, label=function_label)
             axes.plot(sorted_sizes1, sorted_gflops1, '-o', color=cur_color)
 
+        ylabel = 'gflops' if yaxis_str == 'hipblas-Gflops' else yaxis_str
         if(theo_max == True):
             axes.set_ylim(0, 1)
             axes.set_ylabel('gflops / theoretical_maximum_gflops')
         elif(perf_vs_perf == True):
-            axes.set_ylabel('gflops / gflops')
+            axes.set_ylabel(ylabel + ' / ' + ylabel)
         else:
-            axes.set_ylabel('gflops')
+            axes.set_ylabel(ylabel)
 
-        axes.set_xlabel('='.join(size_arg)) # in case we add multiple params
+        axes.set_xlabel(size_arg if isinstance(size_arg, str) else '='.join(size_arg)) # in case we add multiple params
+        if log_sizes:
+            axes.set_xscale('log', base=2)
 
         # magic numbers from performancereport.py to make plots look nice
         axes.legend(fontsize=10, bbox_to_anchor=(0., 1.02, 1., .102), loc='lower left',
@@ -98,7 +107,7 @@ def plot_data(title, gflops_dicts1, gflops_dicts2, const_args_dicts, funcname_li
         figure.suptitle(title, y=0.96)
 
         filename = ''
-        for funcname in funcname_list:
+        for funcname in dict.fromkeys(funcname_list): # once for the curves of a function
             if filename != '':
                 filename += '_'
             filename += funcname
@@ -120,13 +129,28 @@ def get_function_name(filename):
             function_idx = arg_line.index(function_str)
             return data_line[function_idx]
 
-def get_data_from_file(filename, output_param='hipblas-Gflops', xaxis_str1='N', xaxis_str2='M', yaxis_str='hipblas-Gflops'):
+def get_precision(arg_line, data_line):
+    """returns compute_type, or a_type when it differs as for the half precision inputs of ex functions."""
+    precision = data_line[arg_line.index("compute_type")]
+    if "a_type" in arg_line and data_line[arg_line.index("a_type")] != precision:
+        precision = data_line[arg_line.index("a_type")]
+    return precision
 
-    precision_str = "compute_type"
-    if os.path.exists(filename):
-        lines = open(filename, 'r').readlines()
+def get_data_from_file(filename, output_param='hipblas-Gflops', xaxis_str1='N', xaxis_str2='M', yaxis_str='hipblas-Gflops', curve_strs=[]):
+    """
+    reads the data of one csv file for each precision in it.
 
-    function_name = get_function_name(filename)
+    Parameters:
+        curve_strs (list[string]): arguments whose values each get their own curve, like N in a sweep
+            of batch_count.
+
+    Returns:
+        dict{string: list[(int, float)]}: the (x axis, y axis) values of each precision, or with
+            curve_strs a dict of those for each value of the curve arguments, like 'N=32'.
+    """
+    if not os.path.exists(filename):
+        return {}
+    lines = open(filename, 'r').readlines()
 
     cur_dict = {}
     for i in range(0, len(lines)):
@@ -140,18 +164,18 @@ def get_data_from_file(filename, output_param='hipblas-Gflops', xaxis_str1='N',
             yaxis_idx = arg_line.index(yaxis_str)
             size_perf_tuple = (int(data_line[xaxis_idx]), float(data_line[yaxis_idx]))
 
-            precision_idx = arg_line.index(precision_str)
-            precision = data_line[precision_idx]
-            if precision in cur_dict:
-                cur_dict[precision].append(size_perf_tuple)
-            else:
-                cur_dict[precision] = [size_perf_tuple]
+            precision = get_precision(arg_line, data_line)
+            curve_dict = cur_dict
+            if curve_strs:
+                curve = ', '.join(arg + '=' + data_line[arg_line.index(arg)] for arg in curve_strs)
+                curve_dict = cur_dict.setdefault(curve, {})
+            curve_dict.setdefault(precision, []).append(size_perf_tuple)
 
     return cur_dict
 
 tracked_param_list = [ 'transA', 'transB', 'uplo', 'diag', 'side', 'M', 'N', 'K', 'KL', 'KU', 'alpha', 'alphai', 'beta', 'betai',
                        'incx', 'incy', 'lda', 'ldb', 'ldd', 'stride_x', 'stride_y', 'stride_a', 'stride_b', 'stride_c', 'stride_d',
-                       'batch_count']
+                       'stride_scale', 'batch_count']
 
 # return string of arguments that remain constant. For example, transA, transB, alpha, beta, incx may remain
 # constant. By contrast, M, N, K, lda, ldb, ldc may change
@@ -162,15 +186,13 @@ def get_const_args_dict(filename, output_param='hipblas-Gflops'):
         lines = open(filename, 'r').readlines()
 
 
-    precision_str = "compute_type"
     precisions = []
     for i in range(0, len(lines)):
         if(output_param in lines[i]):
             arg_line = lines[i].split(",")
             data_line = re.split(r',\s*(?![^()]*\))', lines[i+1])
 
-            precision_idx = arg_line.index(precision_str)
-            precision = data_line[precision_idx]
+            precision = get_precision(arg_line, data_line)
             if precision not in precisions:
                 precisions.append(precision)
 
@@ -226,6 +248,9 @@ if __name__ =='__main__':
     parser.add_argument(       '--tag2',          help='tag2',                dest='tag2',           default='ref')
     parser.add_argument(     '--label1',          help='label1',              dest='label1',         default='N')
     parser.add_argument(     '--label2',          help='label2',              dest='label2',         default='M')
+    parser.add_argument(     '--yaxis',           help='column on the y axis', dest='yaxis',         default='hipblas-Gflops')
+    parser.add_argument(     '--curve',           help='argument with a curve for each of its values, like N when label1 is batch_count',
+                                                                                 dest='curve_params',   default=[], action='append')
     parser.add_argument('-f'           ,          help='function name',       dest='function_names', required=True, action='append')
     parser.add_argument(     '--theo_max',        help="perf vs theo_max",    dest='theo_max', default="false", action='store_true')
     parser.add_argument(     '--no_theo_max',     help="no perf vs theo_max", dest='theo_max', action='store_false')
@@ -261,18 +286,26 @@ if __name__ =='__main__':
         output_filename1 = os.path.join(args.level, args.tag1, function_name+".csv")
         output_filename2   = os.path.join(args.level, args.tag2, function_name+".csv")
 
-        gflops_dict1 = get_data_from_file(output_filename1, "hipblas-Gflops", args.label1, args.label2, "hipblas-Gflops")
-        gflops_dict2 = get_data_from_file(output_filename2, "hipblas-Gflops", args.label1, args.label2, "hipblas-Gflops")
-
-        gflops_dicts1.append(gflops_dict1)
-        gflops_dicts2.append(gflops_dict2)
+        gflops_dict1 = get_data_from_file(output_filename1, "hipblas-Gflops", args.label1, args.label2, args.yaxis, args.curve_params)
+        gflops_dict2 = get_data_from_file(output_filename2, "hipblas-Gflops", args.label1, args.label2, args.yaxis, args.curve_params)
 
         const_args_dict = get_const_args_dict(output_filename1, "hipblas-Gflops")
 
-        const_args_dicts.append(const_args_dict)
-
         function_name = get_function_name(output_filename1)
-        funcname_list.append(function_name)
+
+        if not args.curve_params:
+            gflops_dicts1.append(gflops_dict1)
+            gflops_dicts2.append(gflops_dict2)
+            const_args_dicts.append(const_args_dict)
+            funcname_list.append(function_name)
+            continue
+
+        # one data set for each curve, labelled with the values of its arguments
+        for curve, curve_dict1 in gflops_dict1.items():
+            gflops_dicts1.append(curve_dict1)
+            gflops_dicts2.append(gflops_dict2.get(curve, {}))
+            const_args_dicts.append({prec: ", ".join(filter(None, [curve, const_args])) for prec, const_args in const_args_dict.items()})
+            funcname_list.append(function_name)
 
     print("plotting for: ", funcname_list)
-    plot_data(title, gflops_dicts1, gflops_dicts2, const_args_dicts, funcname_list, machine_spec_dict, savedir, args.theo_max, args.perf_vs_perf, args.label1)
+    plot_data(title, gflops_dicts1, gflops_dicts2, const_args_dicts, funcname_list, machine_spec_dict, savedir, args.theo_max, args.perf_vs_perf, args.label1, args.yaxis)
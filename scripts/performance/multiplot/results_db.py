@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+
+import argparse
+import json
+import math
+import sqlite3
+import statistics
+import sys
+
+from compare import case_key, describe, read_records, summarize, to_float
+
+# The table hipblas-bench --output sqlite appends to, one row per test
+SCHEMA = '''
+CREATE TABLE IF NOT EXISTS results(id INTEGER PRIMARY KEY,
+    recorded_at TEXT NOT NULL DEFAULT CURRENT_TIMESTAMP, hipblas_version TEXT, backend TEXT,
+    device_name TEXT, device_arch TEXT, driver_version TEXT, runtime_version TEXT,
+    function TEXT, args TEXT, machine TEXT, perf TEXT);
+CREATE INDEX IF NOT EXISTS results_case ON results(function, device_arch, backend,
+    hipblas_version);
+'''
+
+key_columns = ['hipblas_version', 'backend', 'device_name', 'device_arch', 'driver_version',
+               'runtime_version']
+
+# Machine fields of a record kept in the machine column
+machine_columns = ['device', 'compute_units', 'clock_mhz', 'memory_clock_mhz', 'memory_bus_width']
+
+
+def connect(path):
+    db = sqlite3.connect(path)
+    db.executescript(SCHEMA)
+    return db
+
+
+def version_key(version):
+    """orders versions such as 2.1.0.54 numerically."""
+    return tuple(int(part) if part.isdigit() else 0 for part in str(version).split('.'))
+
+
+def to_record(row):
+    """returns the flat record of a row of results, as read_records returns them."""
+    record = dict(zip(key_columns, row[:len(key_columns)]))
+    for column in row[len(key_columns):]:
+        record.update({name: str(value) for name, value in json.loads(column or '{}').items()})
+    return record
+
+
+def select(db, args):
+    """returns the records of the rows matching the --function, --arch and --backend filters."""
+    where, params = [], []
+    for column, value in (('function', args.function), ('device_arch', args.arch),
+                          ('backend', args.backend)):
+        if value:
+            where.append(column + ' = ?')
+            params.append(value)
+    sql = 'SELECT {}, args, machine, perf FROM results'.format(', '.join(key_columns))
+    if where:
+        sql += ' WHERE ' + ' AND '.join(where)
+    return [to_record(row) for row in db.execute(sql, params)]
+
+
+def metric_value(record, metric):
+    if metric == 'us':
+        return to_float(record.get('hipblas-us-median', record.get('hipblas-us')))
+    return to_float(record.get(metric))
+
+
+def by_version(records, metric):
+    """
+    groups records by case, device and backend, then by version.
+
+    Returns:
+        dict{tuple: dict{string: float}}: the median of the metric of each version of each case.
+    """
+    series = {}
+    for record in records:
+        value = metric_value(record, metric)
+        if math.isnan(value):
+            continue
+        key = (record['device_arch'], record['backend']) + case_key(record)
+        series.setdefault(key, {}).setdefault(record['hipblas_version'], []).append(value)
+    return {key: {version: statistics.median(values) for version, values in versions.items()}
+            for key, versions in series.items()}
+
+
+def describe_series(key):
+    return '{} {} {}'.format(key[0], key[1], describe(key[2:]))
+
+
+def import_records(args):
+    db = connect(args.database)
+    count = 0
+    for path in args.files:
+        for record in read_records(path):
+            fields = {name: value for name, value in record.items()
+                      if name not in key_columns and name not in machine_columns}
+            args_fields = {name: value for name, value in fields.items()
+                           if not name.startswith('hipblas-')
+                           and name not in ('thread', 'stream', 'flop/byte')}
+            perf = {name: value for name, value in fields.items() if name not in args_fields}
+            machine = {name: record[name] for name in machine_columns if name in record}
+            db.execute('INSERT INTO results({}, function, args, machine, perf) '
+                       'VALUES({}?, ?, ?, ?)'.format(', '.join(key_columns),
+                                                    '?, ' * len(key_columns)),
+                       [record.get(name, '') for name in key_columns]
+                       + [record.get('function', ''), json.dumps(args_fields),
+                          json.dumps(machine), json.dumps(perf)])
+            count += 1
+    db.commit()
+    print('{} records imported into {}'.format(count, args.database))
+    return 0
+
+
+def query(args):
+    series = by_version(select(connect(args.database), args), args.metric)
+    versions = sorted({v for values in series.values() for v in values}, key=version_key)
+    print(' '.join('{:>14}'.format(v) for v in versions) + '  case')
+    for key in sorted(series, key=describe_series):
+        values = series[key]
+        print(' '.join('{:14.3f}'.format(values[v]) if v in values else '{:>14}'.format('-')
+                       for v in versions) + '  ' + describe_series(key))
+    return 0
+
+
+def trend(args):
+    import matplotlib
+    matplotlib.use('Agg')
+    import matplotlib.pyplot as plt
+
+    series = by_version(select(connect(args.database), args), args.metric)
+    versions = sorted({v for values in series.values() for v in values}, key=version_key)
+    figure, axes = plt.subplots(figsize=(10, 6))
+    for key in sorted(series, key=describe_series)[:args.max_cases]:
+        shown = [v for v in versions if v in series[key]]
+        axes.plot([versions.index(v) for v in shown], [series[key][v] for v in shown],
+                  marker='o', label=describe_series(key))
+    axes.set_xticks(range(len(versions)))
+    axes.set_xticklabels(versions, rotation=45)
+    axes.set_xlabel('hipBLAS version')
+    axes.set_ylabel(args.metric)
+    axes.legend(fontsize='x-small')
+    figure.tight_layout()
+    figure.savefig(args.plot)
+    print('{} cases plotted to {}'.format(min(len(series), args.max_cases), args.plot))
+    return 0
+
+
+def regressions(args):
+    records = select(connect(args.database), args)
+    baseline = summarize([r for r in records if r['hipblas_version'] == args.baseline])
+    current = summarize([r for r in records if r['hipblas_version'] == args.current])
+
+    found = []
+    for key, base in baseline.items():
+        if key in current and current[key]['us'] > base['us'] * (1 + args.threshold):
+            found.append((base['us'] / current[key]['us'], base['us'], current[key]['us'], key))
+    found.sort(key=lambda r: r[0])
+    for speedup, base_us, cur_us, key in found:
+        print('{:8.3f} {:12.3f} {:12.3f}  {}'.format(speedup, base_us, cur_us, describe(key)))
+    print('{} cases of {} in both versions, {} regressions'.format(
+        len(set(baseline) & set(current)), args.baseline, len(found)))
+    return 1 if found else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Keep hipblas-bench records in an SQLite database, as written by --output '
+                    'sqlite, and follow their performance across versions.')
+    parser.add_argument('database', help='SQLite database of the results')
+    commands = parser.add_subparsers(dest='command', required=True)
+
+    command = commands.add_parser('import', help='add --output csv or json records')
+    command.add_argument('files', nargs='+', help='record files of hipblas-bench')
+    command.set_defaults(run=import_records)
+
+    for name, run, help in (('query', query, 'print a metric of each case for each version'),
+                            ('trend', trend, 'plot a metric of each case against the version'),
+                            ('regressions', regressions, 'compare the times of two versions')):
+        command = commands.add_parser(name, help=help)
+        command.add_argument('--function', help='only this function, for example gemm')
+        command.add_argument('--arch', help='only this device_arch, for example gfx90a')
+        command.add_argument('--backend', help='only rocBLAS or cuBLAS')
+        command.set_defaults(run=run)
+        if name == 'regressions':
+            command.add_argument('baseline', help='hipblas_version of the baseline')
+            command.add_argument('current', help='hipblas_version to check')
+            command.add_argument('--threshold', type=float, default=0.05,
+                                 help='smallest relative slowdown reported (default 0.05)')
+            continue
+        command.add_argument('--metric', default='us',
+                             help='performance field, for example hipblas-Gflops, or us for the '
+                                  'median time (default)')
+        if name == 'trend':
+            command.add_argument('--plot', default='trend.png', help='image to write')
+            command.add_argument('--max_cases', type=int, default=10,
+                                 help='number of cases plotted (default 10)')
+
+    args = parser.parse_args()
+    return args.run(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
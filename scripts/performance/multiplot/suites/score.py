@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+
+import argparse
+import math
+import os
+import re
+import statistics
+import sys
+
+import yaml
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+from compare import case_key, read_records, summarize, to_float  # noqa: E402
+
+INCLUDE_RE = re.compile(r'include\s*:\s*(\S+)')
+
+
+def read_yaml_text(path):
+    """returns the text of a YAML file with its include: lines replaced by the included files."""
+    lines = []
+    with open(path) as f:
+        for line in f:
+            match = line.startswith('include') and INCLUDE_RE.match(line)
+            if match:
+                lines.append(read_yaml_text(os.path.join(os.path.dirname(path), match.group(1))))
+            else:
+                lines.append(line)
+    return ''.join(lines)
+
+
+def read_weights(path):
+    """
+    reads the weights of the tests of a suite.
+
+    Returns:
+        dict{string: float}: the weight of each test by name, 1 when the test has none.
+    """
+    weights = {}
+    for doc in yaml.safe_load_all(read_yaml_text(path)):
+        for test in (doc or {}).get('Tests') or []:
+            if test['name'] in weights:
+                sys.exit('{}: test name {} is not unique'.format(path, test['name']))
+            weights[test['name']] = float(test.get('weight', 1))
+    return weights
+
+
+def test_totals(records, weights):
+    """
+    sums the times and flops of the cases of each test of a suite.
+
+    Returns:
+        dict{string: dict{string: float}}: for each test with records, the time of running each of
+            its cases once and the flops of them, nan when a case has no hipblas-Gflops.
+    """
+    by_name = {}
+    for record in records:
+        if record.get('name') in weights:
+            by_name.setdefault(record['name'], []).append(record)
+
+    totals = {}
+    for name, test_records in by_name.items():
+        cases = summarize(test_records)
+        flops = {}
+        for record in test_records:
+            flops.setdefault(case_key(record), []).append(
+                to_float(record.get('hipblas-Gflops')) * to_float(record.get('hipblas-us')) * 1e3)
+        totals[name] = {'us': sum(case['us'] for case in cases.values()),
+                        'flops': sum(statistics.median(flops[key]) for key in cases)}
+    return totals
+
+
+def score(totals, weights):
+    """returns the weighted time and rate of a suite over the tests of totals."""
+    us = sum(weights[name] * total['us'] for name, total in totals.items())
+    flops = sum(weights[name] * total['flops'] for name, total in totals.items())
+    return us, flops / us / 1e3 if us > 0 else math.nan
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Score a hipblas-bench --output csv or json run of a suite by the time of its '
+                    'tests weighted by their weight: fields.')
+    parser.add_argument('suite', help='suite YAML file the run was made from')
+    parser.add_argument('current', help='records of the run to score')
+    parser.add_argument('--baseline', help='records of a run to compare the score with')
+    parser.add_argument('--verbose', action='store_true', help='print the score of each test')
+    args = parser.parse_args()
+
+    weights = read_weights(args.suite)
+    current = test_totals(read_records(args.current), weights)
+    missing = sorted(set(weights) - set(current))
+    if missing:
+        print('tests without records in {}: {}'.format(args.current, ' '.join(missing)))
+
+    baseline = test_totals(read_records(args.baseline), weights) if args.baseline else None
+    if baseline is not None:
+        current = {name: total for name, total in current.items() if name in baseline}
+        baseline = {name: baseline[name] for name in current}
+
+    if args.verbose:
+        print('{:>8} {:>14} {:>10}  test'.format('weight', 'weighted-us', 'speedup'))
+        for name, total in sorted(current.items()):
+            speedup = baseline[name]['us'] / total['us'] if baseline is not None else math.nan
+            print('{:8g} {:14.3f} {:10.3f}  {}'.format(weights[name], weights[name] * total['us'],
+                                                      speedup, name))
+
+    us, gflops = score(current, weights)
+    print('{}: {} tests, weighted time {:.3f} us, {:.3f} Gflops'.format(
+        os.path.basename(args.suite), len(current), us, gflops))
+    if baseline is not None:
+        base_us, base_gflops = score(baseline, weights)
+        print('baseline {}: weighted time {:.3f} us, {:.3f} Gflops, speedup {:.3f}'.format(
+            args.baseline, base_us, base_gflops, base_us / us if us > 0 else math.nan))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())